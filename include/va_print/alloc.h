@@ -41,6 +41,22 @@
 #define va_asprintf_init_size 16
 #endif
 
+#ifndef va_asprintf_stage_size
+/** Number of entries in the on-stack buffer of va_aeprintf() etc. */
+#define va_asprintf_stage_size 512
+#endif
+
+#ifndef va_arena_chunk_size
+/** Minimal size in bytes of the chunks that an arena allocates. */
+#define va_arena_chunk_size 4096
+#endif
+
+#ifndef va_tprintf_slots
+/** Number of strings per thread that va_tprintf() etc. keep alive at
+ * the same time.  This is used when compiling the library. */
+#define va_tprintf_slots 4
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -53,21 +69,96 @@ extern "C" {
 #define VA_STREAM_VEC(M) \
     ((va_stream_vec_t){ \
         VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, \
-        va_asprintf_init_size, 0, (M) })
+        va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+/**
+ * Generate an object of type va_stream_vec_t that prints into the
+ * array B first, see va_aexprintf(). */
+#define VA_STREAM_VEC_STAGE(M,B) \
+    ((va_stream_vec_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), \
+        va_countof(B), 0, (M), (B), NULL, 0, {0} })
+
+/**
+ * Generate an object of type va_stream_vec_t that prints into the
+ * array B, and only allocates with M if the output does not fit, see
+ * va_bxprintf(). */
+#define VA_STREAM_VEC_INLINE(M,B) \
+    ((va_stream_vec_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), \
+        va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+/**
+ * Generate an object of type va_stream_vec_t that allocates from
+ * the arena A, see va_arena_printf(). */
+#define VA_STREAM_VEC_ARENA(A) \
+    ((va_stream_vec_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, \
+        va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
 
 /**
  * Generate an object of type va_stream_vec16_t */
 #define VA_STREAM_VEC16(M) \
     ((va_stream_vec16_t){ \
         VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, \
-        va_asprintf_init_size, 0, (M) })
+        va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+/**
+ * Generate an object of type va_stream_vec16_t that prints into the
+ * array B first, see va_aexprintf(). */
+#define VA_STREAM_VEC16_STAGE(M,B) \
+    ((va_stream_vec16_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), \
+        va_countof(B), 0, (M), (B), NULL, 0, {0} })
+
+/**
+ * Generate an object of type va_stream_vec16_t that prints into the
+ * array B, and only allocates with M if the output does not fit, see
+ * va_bxprintf(). */
+#define VA_STREAM_VEC16_INLINE(M,B) \
+    ((va_stream_vec16_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), \
+        va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+/**
+ * Generate an object of type va_stream_vec16_t that allocates from
+ * the arena A, see va_arena_printf(). */
+#define VA_STREAM_VEC16_ARENA(A) \
+    ((va_stream_vec16_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, \
+        va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
 
 /**
  * Generate an object of type va_stream_vec32_t */
 #define VA_STREAM_VEC32(M) \
     ((va_stream_vec32_t){ \
         VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, \
-        va_asprintf_init_size, 0, (M) })
+        va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+/**
+ * Generate an object of type va_stream_vec32_t that prints into the
+ * array B first, see va_aexprintf(). */
+#define VA_STREAM_VEC32_STAGE(M,B) \
+    ((va_stream_vec32_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), \
+        va_countof(B), 0, (M), (B), NULL, 0, {0} })
+
+/**
+ * Generate an object of type va_stream_vec32_t that prints into the
+ * array B, and only allocates with M if the output does not fit, see
+ * va_bxprintf(). */
+#define VA_STREAM_VEC32_INLINE(M,B) \
+    ((va_stream_vec32_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), \
+        va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+/**
+ * Generate an object of type va_stream_vec32_t that allocates from
+ * the arena A, see va_arena_printf(). */
+#define VA_STREAM_VEC32_ARENA(A) \
+    ((va_stream_vec32_t){ \
+        VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, \
+        va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
 
 /**
  * Prints into a newly allocated 'char*' buffer using the given alloc()
@@ -132,6 +223,157 @@ extern "C" {
 #define va_Uaxprintf(M,...) \
     VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32(M), __VA_ARGS__)->data)
 
+/**
+ * Prints into a newly allocated 'char*' buffer of exactly the needed
+ * size using the given alloc() function (mnemonic: Exact).
+ *
+ * This prints into an on-stack array of va_asprintf_stage_size entries
+ * first and then allocates the result once, so that short strings
+ * cost a single allocation and no memory is wasted.  Longer strings
+ * spill into a heap buffer that grows like in va_axprintf() and that
+ * is shrunk to fit at the end.
+ *
+ * The result and the error handling are like for va_axprintf().
+ */
+#define va_aexprintf(alloc,...) \
+    VA_BLOCK_EXPR( \
+        char va_stage_[va_asprintf_stage_size]; \
+        va_xprintf(&VA_STREAM_VEC_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+/**
+ * Like va_aexprintf(), but prints into a 'char16_t*' buffer.
+ */
+#define va_uaexprintf(alloc,...) \
+    VA_BLOCK_EXPR( \
+        char16_t va_stage_[va_asprintf_stage_size]; \
+        va_xprintf(&VA_STREAM_VEC16_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+/**
+ * Like va_aexprintf(), but prints into a 'char32_t*' buffer.
+ */
+#define va_Uaexprintf(alloc,...) \
+    VA_BLOCK_EXPR( \
+        char32_t va_stage_[va_asprintf_stage_size]; \
+        va_xprintf(&VA_STREAM_VEC32_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+/**
+ * Prints into the 'char' array B, and only if the output does not fit,
+ * into a newly allocated buffer using the given alloc() function
+ * (mnemonic: Buffer).
+ *
+ * This returns the va_stream_vec_t stream object by value.  Its 'data'
+ * member is the resulting string: use va_vec_is_inline() to find out
+ * whether this is B or allocated.  In any case, va_vec_free() releases
+ * what was allocated.
+ *
+ * If memory is exhausted, 'data' is NULL, like for va_axprintf().
+ */
+#define va_bxprintf(alloc,B,...) \
+    VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC_INLINE(alloc, B), __VA_ARGS__))
+
+/**
+ * Like va_bxprintf(), but for a 'char16_t' array and string.
+ */
+#define va_ubxprintf(alloc,B,...) \
+    VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC16_INLINE(alloc, B), __VA_ARGS__))
+
+/**
+ * Like va_bxprintf(), but for a 'char32_t' array and string.
+ */
+#define va_Ubxprintf(alloc,B,...) \
+    VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC32_INLINE(alloc, B), __VA_ARGS__))
+
+/**
+ * The va_bxprintf() function used with va_alloc().
+ */
+#define va_bprintf(B,...) va_bxprintf(va_alloc, B, __VA_ARGS__)
+
+/**
+ * The va_ubxprintf() function used with va_alloc().
+ */
+#define va_ubprintf(B,...) va_ubxprintf(va_alloc, B, __VA_ARGS__)
+
+/**
+ * The va_Ubxprintf() function used with va_alloc().
+ */
+#define va_Ubprintf(B,...) va_Ubxprintf(va_alloc, B, __VA_ARGS__)
+
+/**
+ * Whether the string of the vector stream T is still in the array it
+ * was given with VA_STREAM_VEC_INLINE() etc., i.e., nothing was
+ * allocated.  Works for all vector stream types.
+ */
+#define va_vec_is_inline(T) \
+    (((T)->data != NULL) && ((T)->data == (T)->stage))
+
+/**
+ * Generate an empty arena of type va_arena_t whose chunks are
+ * allocated with the given alloc() function.
+ */
+#define VA_ARENA(M) \
+    ((va_arena_t){ NULL, NULL, va_arena_chunk_size, (M) })
+
+/**
+ * Prints into a newly allocated 'char*' string in the arena A.
+ *
+ * Like va_axprintf(), but the string is allocated from the arena,
+ * where it grows in place while it is the arena's last allocation,
+ * and it is shrunk to fit at the end.  The string must not be freed
+ * individually: all strings of an arena are released together by
+ * va_arena_reset() or va_arena_free().
+ *
+ * If memory is exhausted, this returns NULL and sets VA_E_TRUNC.
+ */
+#define va_arena_printf(A,...) \
+    VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC_ARENA(A), __VA_ARGS__)->data)
+
+/**
+ * Like va_arena_printf(), but prints into a 'char16_t*' string.
+ */
+#define va_arena_uprintf(A,...) \
+    VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16_ARENA(A), __VA_ARGS__)->data)
+
+/**
+ * Like va_arena_printf(), but prints into a 'char32_t*' string.
+ */
+#define va_arena_Uprintf(A,...) \
+    VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32_ARENA(A), __VA_ARGS__)->data)
+
+/**
+ * Prints into a thread-local scratch buffer and returns the 'char*'
+ * string (mnemonic: Temporary).
+ *
+ * Each thread has a ring of va_tprintf_slots buffers that are used in
+ * turn.  They are kept and reused, and they only grow when a longer
+ * string is printed, so in a steady state, this does not allocate.
+ * The string is valid until the va_tprintf_slots-th next call of
+ * va_tprintf() on the same thread, so that several temporary strings
+ * can be used in one expression, e.g., as arguments of another print
+ * call.  The string must not be freed: va_tprintf_free() releases the
+ * buffers of the calling thread, e.g., before it terminates.
+ *
+ * If memory is exhausted, this returns NULL and sets VA_E_TRUNC.
+ */
+#define va_tprintf(...) \
+    VA_BLOCK_EXPR(va_xprintf( \
+        va_tmp_vec(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), __VA_ARGS__)->data)
+
+/**
+ * Like va_tprintf(), but prints into a 'char16_t*' string.  The
+ * 'char16_t' strings have their own ring.
+ */
+#define va_utprintf(...) \
+    VA_BLOCK_EXPR(va_xprintf( \
+        va_tmp_vec16(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), __VA_ARGS__)->data)
+
+/**
+ * Like va_tprintf(), but prints into a 'char32_t*' string.  The
+ * 'char32_t' strings have their own ring.
+ */
+#define va_Utprintf(...) \
+    VA_BLOCK_EXPR(va_xprintf( \
+        va_tmp_vec32(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), __VA_ARGS__)->data)
+
 /**
  * The va_axprintf() function used with va_alloc(), i.e., with the
  * system `realloc` and `free` allocator.
@@ -150,15 +392,63 @@ extern "C" {
  */
 #define va_Uasprintf(...) va_Uaxprintf(va_alloc, __VA_ARGS__)
 
+/**
+ * The va_aexprintf() function used with va_alloc(), i.e., with the
+ * system `realloc` and `free` allocator.
+ */
+#define va_aeprintf(...) va_aexprintf(va_alloc, __VA_ARGS__)
+
+/**
+ * The va_uaexprintf() function used with va_alloc(), i.e., with the
+ * system `realloc` and `free` allocator.
+ */
+#define va_uaeprintf(...) va_uaexprintf(va_alloc, __VA_ARGS__)
+
+/**
+ * The va_Uaexprintf() function used with va_alloc(), i.e., with the
+ * system `realloc` and `free` allocator.
+ */
+#define va_Uaeprintf(...) va_Uaexprintf(va_alloc, __VA_ARGS__)
+
+/**
+ * The va_format_xcompile() function used with va_alloc(), i.e., with
+ * the system `realloc` and `free` allocator.
+ */
+#define va_format_compile(X) va_format_xcompile(va_alloc, X)
+
 /* ********************************************************************** */
 /* types */
 
+typedef struct va_arena_chunk va_arena_chunk_t;
+
+/**
+ * A bump allocator for strings that are released together.
+ *
+ * Memory is taken from chunks that are allocated with 'alloc'.  The
+ * last allocation can grow and shrink in place.  Use VA_ARENA() to
+ * initialise, and va_arena_reset() or va_arena_free() to release.
+ */
+typedef struct {
+    /** current chunk, the older ones are linked */
+    va_arena_chunk_t *chunk;
+    /** the last allocation, or NULL */
+    void *last;
+    /** minimal chunk size in bytes */
+    size_t chunk_size;
+    /** allocator for the chunks */
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_arena_t;
+
 typedef struct {
     va_stream_t s;
     char *data;
     size_t size;
     size_t pos;
     void *(*alloc)(void *, size_t nmemb, size_t size);
+    char *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
 } va_stream_vec_t;
 
 typedef struct {
@@ -167,6 +457,10 @@ typedef struct {
     size_t size;
     size_t pos;
     void *(*alloc)(void *, size_t nmemb, size_t size);
+    char16_t *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
 } va_stream_vec16_t;
 
 typedef struct {
@@ -175,6 +469,10 @@ typedef struct {
     size_t size;
     size_t pos;
     void *(*alloc)(void *, size_t nmemb, size_t size);
+    char32_t *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
 } va_stream_vec32_t;
 
 /* ********************************************************************** */
@@ -183,6 +481,13 @@ typedef struct {
 extern void va_vec_init(
     va_stream_t *);
 
+extern void va_vec_finish(
+    va_stream_t *);
+
+extern bool va_vec_refill(
+    va_stream_t *,
+    size_t);
+
 extern void va_vec_put(
     va_stream_t *,
     char);
@@ -190,6 +495,13 @@ extern void va_vec_put(
 extern void va_vec16_init(
     va_stream_t *);
 
+extern void va_vec16_finish(
+    va_stream_t *);
+
+extern bool va_vec16_refill(
+    va_stream_t *,
+    size_t);
+
 extern void va_vec16_put(
     va_stream_t *,
     char16_t);
@@ -197,10 +509,130 @@ extern void va_vec16_put(
 extern void va_vec32_init(
     va_stream_t *);
 
+extern void va_vec32_finish(
+    va_stream_t *);
+
+extern bool va_vec32_refill(
+    va_stream_t *,
+    size_t);
+
 extern void va_vec32_put(
     va_stream_t *,
     char32_t);
 
+/*
+ * A va_stream_vec_t can be used as a string builder that keeps its
+ * buffer across print calls: va_iprintf() appends, and the functions
+ * below manage the buffer.  The same functions exist for
+ * va_stream_vec16_t and va_stream_vec32_t with 'vec16' and 'vec32' in
+ * their names.
+ *
+ * va_vec_clear() empties the string but keeps the buffer, so that
+ * repeatedly building strings does not allocate once the buffer is
+ * large enough.  After an allocation error, it makes the next print
+ * call try again.
+ *
+ * va_vec_reserve() makes room for a string of n entries (plus NUL).
+ * It returns false if memory is exhausted, keeping the old buffer.
+ *
+ * va_vec_shrink() reduces the buffer to fit a string of n entries, or
+ * the current string if that is longer, e.g., to not keep the memory
+ * of an unusually long string.
+ *
+ * va_vec_span() stores a view of the current string into 'span' and
+ * returns 'span'.
+ *
+ * va_vec_free() deallocates the buffer.  The stream can be used again
+ * afterwards.
+ */
+
+extern void va_vec_clear(
+    va_stream_vec_t *);
+
+extern bool va_vec_reserve(
+    va_stream_vec_t *,
+    size_t n);
+
+extern void va_vec_shrink(
+    va_stream_vec_t *,
+    size_t n);
+
+extern va_span_t *va_vec_span(
+    va_stream_vec_t *,
+    va_span_t *span);
+
+extern void va_vec_free(
+    va_stream_vec_t *);
+
+extern void va_vec16_clear(
+    va_stream_vec16_t *);
+
+extern bool va_vec16_reserve(
+    va_stream_vec16_t *,
+    size_t n);
+
+extern void va_vec16_shrink(
+    va_stream_vec16_t *,
+    size_t n);
+
+extern va_span16_t *va_vec16_span(
+    va_stream_vec16_t *,
+    va_span16_t *span);
+
+extern void va_vec16_free(
+    va_stream_vec16_t *);
+
+extern void va_vec32_clear(
+    va_stream_vec32_t *);
+
+extern bool va_vec32_reserve(
+    va_stream_vec32_t *,
+    size_t n);
+
+extern void va_vec32_shrink(
+    va_stream_vec32_t *,
+    size_t n);
+
+extern va_span32_t *va_vec32_span(
+    va_stream_vec32_t *,
+    va_span32_t *span);
+
+extern void va_vec32_free(
+    va_stream_vec32_t *);
+
+/**
+ * Returns the next string builder from the calling thread's ring for
+ * va_tprintf(), emptied and set up to print with the given vtab.
+ *
+ * 'vtab' must be a vtab of a 'char' string builder, i.e., one of the
+ * va_vec_vtab_* objects: the ring holds va_stream_vec_t objects.
+ * va_tprintf() passes the one selected by va_vec_encode.
+ */
+extern va_stream_vec_t *va_tmp_vec(
+    va_stream_vtab_t const *vtab);
+
+/**
+ * Like va_tmp_vec(), but for va_utprintf().  'vtab' must be one of the
+ * va_vec16_vtab_* objects.
+ */
+extern va_stream_vec16_t *va_tmp_vec16(
+    va_stream_vtab_t const *vtab);
+
+/**
+ * Like va_tmp_vec(), but for va_Utprintf().  'vtab' must be one of the
+ * va_vec32_vtab_* objects.
+ */
+extern va_stream_vec32_t *va_tmp_vec32(
+    va_stream_vtab_t const *vtab);
+
+/**
+ * Deallocate the buffers of va_tprintf(), va_utprintf(), and
+ * va_Utprintf() of the calling thread.  All strings returned by these
+ * on this thread become invalid.  The functions can be used again
+ * afterwards.
+ */
+extern void va_tprintf_free(void);
+
 /**
  * Allocate, reallocate, or deallocate.
  *
@@ -222,6 +654,32 @@ extern void *va_alloc(
     size_t nmemb,
     size_t size);
 
+/**
+ * Allocate, reallocate, or deallocate from an arena, with the same
+ * protocol as va_alloc().  A reallocation of the last allocation is
+ * done in place if the chunk has room.  Deallocation only gives back
+ * memory if it is the last allocation.
+ */
+extern void *va_arena_alloc(
+    va_arena_t *arena,
+    void *data,
+    size_t nmemb,
+    size_t size);
+
+/**
+ * Release all allocations of the arena at once.  The current chunk is
+ * kept for reuse, all others are deallocated.
+ */
+extern void va_arena_reset(
+    va_arena_t *arena);
+
+/**
+ * Deallocate all chunks of the arena.  The arena is empty afterwards
+ * and can be used again.
+ */
+extern void va_arena_free(
+    va_arena_t *arena);
+
 /* ********************************************************************** */
 /* epilogue */
 
@@ -68,7 +68,7 @@ extern "C" {
 /**
  * Compound literal of type va_stream_t.
  */
-#define VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0 })
+#define VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })
 
 /** Iterator for extracting single codepoint data */
 #define VA_READ_ITER(TAKE,DATA) \
@@ -126,6 +126,13 @@ extern "C" {
 /** ISO-8859-1 encoding */
 #define VA_U_ENC_ISO88591 0x04000000
 
+/**
+ * Encoding tag of a read iterator or stream vtab: the VA_U_ENC_* value
+ * shifted into a byte, or 0 if there is no such tag.  Strings with equal
+ * tags can be copied code unit by code unit, if valid.
+ */
+#define VA_ENC_TAG(E) ((unsigned char)((E) >> 24))
+
 /* Unicode standard values */
 
 /** Unicode replacement character */
@@ -211,6 +218,24 @@ typedef struct {
      * Get the chunk mode iterator */
     void (*set_chunk_mode)(struct va_read_iter *);
 
+    /**
+     * Bulk scan: return the number of code units, at most 'max', at
+     * the start of the string that form valid, complete, non-NUL code
+     * points, and store the number of these code points in '*cps'.
+     * 'end' is like in 'take'.  May be NULL. */
+    size_t (*bulk)(
+        struct va_read_iter const *, void const *end, size_t max, size_t *cps);
+
+    /**
+     * Bulk transcoding: convert 'n' code units at 'src' that 'bulk'
+     * accepted into the encoding 'enc' (see VA_ENC_TAG()) at 'dst'.
+     * At most 4 bytes are written per source code unit.  Returns the
+     * number of bytes written, or 0 if 'enc' is not supported.  If
+     * 'dst' is NULL, nothing is written, but the number of bytes is
+     * returned anyway.  May be NULL. */
+    size_t (*transcode)(
+        void *dst, unsigned char enc, void const *src, size_t n);
+
     /**
      * Whether this is a size or NUL terminated string */
     unsigned char has_size;
@@ -223,7 +248,11 @@ typedef struct {
      * C string indicator prefix character */
     unsigned char str_prefix;
 
-    char _pad[sizeof(void*) - 3];
+    /**
+     * Encoding tag, see VA_ENC_TAG(), or 0 */
+    unsigned char enc;
+
+    char _pad[sizeof(void*) - 4];
 } va_read_iter_vtab_t;
 
 /**
@@ -292,8 +321,48 @@ typedef struct {
     void const *end;
 } va_read_iter_end_t;
 
+struct va_format_lit;
+struct va_format_spec;
+
+/**
+ * A precompiled format string, see va_format_compile().
+ *
+ * This can be passed to the print functions in place of the format
+ * string.  It keeps a copy of the format string and reads it with a
+ * copy of the original read methods, whose 'type' is 'va_format_type',
+ * so that the printer finds the precompiled parts from the format
+ * iterator.  Anything that is not precompiled is parsed from the
+ * format string like usual.
+ */
+typedef struct {
+    /**
+     * Read methods of the format string */
+    va_read_iter_vtab_t vtab;
+
+    /**
+     * The copy of the format string */
+    void const *fmt;
+
+    /**
+     * Pre-encoded literal runs, sorted by position */
+    struct va_format_lit const *lit;
+    size_t lit_cnt;
+
+    /**
+     * Pre-parsed format specifiers, sorted by position */
+    struct va_format_spec const *spec;
+    size_t spec_cnt;
+
+    /**
+     * The allocator that was used to allocate this */
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_format_t;
+
 typedef struct va_stream va_stream_t;
 
+/** A set of quotation methods, see va_print/impl.h */
+typedef struct va_quotations va_quotations_t;
+
 /**
  * Stream methods.
  *
@@ -301,12 +370,48 @@ typedef struct va_stream va_stream_t;
  * functions to print into a stream.
  */
 typedef struct {
-    /** initialises the stream */
+    /** initialises the stream, once at the start of each print call */
     void (*init)(va_stream_t *);
     /** puts one code point into the output stream */
     void (*put)(va_stream_t *, unsigned c);
+    /** finishes the stream (NUL termination, flushing), once at the
+     * end of each print call */
+    void (*finish)(va_stream_t *);
+    /**
+     * Commits what was written into the stream's output window and
+     * provides a new window with room for at least 'need' bytes.
+     * Returns false (and an empty window) if the sink cannot provide
+     * that much room, in which case 'put' is used.  May be NULL if the
+     * stream has no output window. */
+    bool (*refill)(va_stream_t *, size_t need);
+    /**
+     * Puts the ASCII character 'c' 'count' times.  May be NULL, in
+     * which case the output window or 'put' is used. */
+    void (*put_fill)(va_stream_t *, unsigned c, size_t count);
+    /**
+     * Length-only streams: adds 'count' code units of the output
+     * encoding to the length without storing anything.  With this,
+     * valid string runs and literals are measured in bulk instead of
+     * being encoded code point by code point.  May be NULL. */
+    void (*put_len)(va_stream_t *, size_t count);
+    /**
+     * Encoding tag of the output window, see VA_ENC_TAG(), or 0.  With
+     * a tag, valid strings of the same encoding are copied into the
+     * window as is, or measured with 'put_len'. */
+    unsigned char enc;
+    char _pad[sizeof(void*) - 1];
 } va_stream_vtab_t;
 
+/**
+ * Output window of a stream: encoders store code units directly
+ * into [cur,end) and advance 'cur'.  Both are NULL if there is no
+ * window, e.g., before the first refill.
+ */
+typedef struct {
+    void *cur;
+    void *end;
+} va_window_t;
+
 /**
  * Stream: management type for printing.
  *
@@ -326,6 +431,10 @@ typedef struct {
  * can be marked using VA_ENC_EMORE, so that the encoder can
  * choose to only output a single VA_U_REPLACEMENT.  E.g.,
  * the UTF-8 decoder sets VA_ENC_EMORE to 0,1, or 2.
+ *
+ * Encoders first try to write into 'win' (see va_stream_reserve()),
+ * and only use the byte or word 'put' function of the sink if the
+ * stream has no window.
  */
 struct va_stream {
     va_stream_vtab_t const *vtab;
@@ -334,6 +443,11 @@ struct va_stream {
     unsigned prec;
     unsigned opt;
     unsigned qctxt;
+    va_window_t win;
+    /**
+     * Quotation methods of this stream, or NULL to use those of the
+     * thread or the global ones.  See va_quotations_thread(). */
+    va_quotations_t const *quote;
 };
 
 typedef struct va_print va_print_t;
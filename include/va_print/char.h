@@ -48,12 +48,28 @@ extern "C" {
     char16_t *:&VA_CONCAT(va_char16_p_vtab_,va_char16_p_encode), \
     char32_t *:&VA_CONCAT(va_char32_p_vtab_,va_char32_p_encode))
 
+/**
+ * Select a sizing vtab based on a string type */
+#define va_char_p_size_vtab_gen(x) _Generic(x, \
+    char *:&VA_CONCAT(va_char_p_size_vtab_,va_char_p_encode), \
+    char16_t *:&VA_CONCAT(va_char16_p_size_vtab_,va_char16_p_encode), \
+    char32_t *:&VA_CONCAT(va_char32_p_size_vtab_,va_char32_p_encode))
+
 /**
  * Value of type va_string_char_p_t */
 #define VA_STREAM_CHAR_P(S,N) \
     ((va_stream_char_p_t){ \
         VA_STREAM(va_char_p_vtab_gen(S)), (S), (N), 0 })
 
+/**
+ * Value of type va_string_char_p_t that only counts the 'Char'
+ * elements that would be printed, up to N-1 of them.  This adds up
+ * encoded lengths without encoding anything, and measures valid
+ * string runs in bulk. */
+#define VA_STREAM_CHAR_SIZE(Char,N) \
+    ((va_stream_char_p_t){ \
+        VA_STREAM(va_char_p_size_vtab_gen((Char*)NULL)), NULL, (N), 0 })
+
 /**
  * Value of type va_string_char_p_t.
  * For arrays: finds out the size using va_countof() */
@@ -146,7 +162,7 @@ extern "C" {
  */
 #define va_gzprintf(Char, ...) \
     VA_BLOCK_EXPR(va_xprintf( \
-        &VA_STREAM_CHAR_P((Char*)NULL, -(size_t)2), __VA_ARGS__)->pos + 1)
+        &VA_STREAM_CHAR_SIZE(Char, -(size_t)2), __VA_ARGS__)->pos + 1)
 
 /**
  * Computes the 'char[]' array element count needed to represent the output
@@ -175,6 +191,37 @@ extern "C" {
  */
 #define va_Uzprintf(...) va_gzprintf(char32_t, __VA_ARGS__)
 
+/**
+ * Computes the 'Char[]' array element count needed to represent the
+ * output string, up to a limit.
+ *
+ * This is like va_gzprintf(), but stops once more than N elements
+ * would be needed, and then skips the rest of the printing work.  This
+ * returns the needed element count if it is at most N, and N+1
+ * otherwise.  N+1 must not overflow.
+ */
+#define va_gznprintf(Char, N, ...) \
+    VA_BLOCK_EXPR(va_xprintf( \
+        &VA_STREAM_CHAR_SIZE(Char, (size_t)(N) + 1), __VA_ARGS__)->pos + 1)
+
+/**
+ * This is equivalent to invoking va_gznprintf() with 'char'
+ * as the first argument.
+ */
+#define va_znprintf(...) va_gznprintf(char, __VA_ARGS__)
+
+/**
+ * This is equivalent to invoking va_gznprintf() with 'char16_t'
+ * as the first argument.
+ */
+#define va_uznprintf(...) va_gznprintf(char16_t, __VA_ARGS__)
+
+/**
+ * This is equivalent to invoking va_gznprintf() with 'char32_t'
+ * as the first argument.
+ */
+#define va_Uznprintf(...) va_gznprintf(char32_t, __VA_ARGS__)
+
 /* ********************************************************************** */
 /* types */
 
@@ -195,10 +242,29 @@ extern void const *va_char_p_end(
 extern void va_char_p_init(
     va_stream_t *s);
 
+extern void va_char_p_finish(
+    va_stream_t *s);
+
+extern bool va_char_p_refill(
+    va_stream_t *s,
+    size_t need);
+
+extern void va_char_p_put_fill(
+    va_stream_t *,
+    unsigned c,
+    size_t n);
+
 extern void va_char_p_put(
     va_stream_t *,
     char);
 
+/**
+ * Counts 'n' elements without storing anything: the 'put_len' method
+ * of the sizing streams, for all element types. */
+extern void va_char_p_put_len(
+    va_stream_t *,
+    size_t n);
+
 extern void const *va_char16_p_end(
     va_read_iter_t *,
     size_t);
@@ -206,6 +272,18 @@ extern void const *va_char16_p_end(
 extern void va_char16_p_init(
     va_stream_t *s);
 
+extern void va_char16_p_finish(
+    va_stream_t *s);
+
+extern bool va_char16_p_refill(
+    va_stream_t *s,
+    size_t need);
+
+extern void va_char16_p_put_fill(
+    va_stream_t *,
+    unsigned c,
+    size_t n);
+
 extern void va_char16_p_put(
     va_stream_t *,
     char16_t);
@@ -217,6 +295,18 @@ extern void const *va_char32_p_end(
 extern void va_char32_p_init(
     va_stream_t *s);
 
+extern void va_char32_p_finish(
+    va_stream_t *s);
+
+extern bool va_char32_p_refill(
+    va_stream_t *s,
+    size_t need);
+
+extern void va_char32_p_put_fill(
+    va_stream_t *,
+    unsigned c,
+    size_t n);
+
 extern void va_char32_p_put(
     va_stream_t *,
     char32_t);
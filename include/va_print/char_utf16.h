@@ -21,6 +21,7 @@ extern "C" {
 /* extern objects */
 
 extern va_stream_vtab_t const va_char16_p_vtab_utf16;
+extern va_stream_vtab_t const va_char16_p_size_vtab_utf16;
 
 /* ********************************************************************** */
 /* epilogue */
@@ -21,6 +21,7 @@ extern "C" {
 /* extern objects */
 
 extern va_stream_vtab_t const va_char32_p_vtab_utf32;
+extern va_stream_vtab_t const va_char32_p_size_vtab_utf32;
 
 /* ********************************************************************** */
 /* epilogue */
@@ -52,6 +52,11 @@
 #define va_char32_p_decode utf32
 #endif
 
+#ifndef VA_SIGIL
+/** Sigil that starts a format specifier. */
+#define VA_SIGIL '~'
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -107,7 +112,25 @@ extern "C" {
     char16_t const *:&VA_CONCAT(va_char16_p_read_vtab_,va_char16_p_format), \
     char16_t *:&VA_CONCAT(va_char16_p_read_vtab_,va_char16_p_format), \
     char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), \
-    char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format))
+    char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), \
+    va_format_t const *:&va_format_read_vtab, \
+    va_format_t *:&va_format_read_vtab)
+
+/**
+ * Precompile a format string using the given allocator.
+ *
+ * The format string is parsed once, and the literal runs between
+ * format specifiers are stored in all output encodings, so that they
+ * can be copied into the stream as a whole.  The result can be passed
+ * to any print function in place of the format string, and it prints
+ * exactly the same, including errors like VA_E_FORMAT and VA_E_ARGC.
+ *
+ * 'alloc' is like in va_axprintf().  Returns NULL if memory is
+ * exhausted.  Printing with a NULL format results in VA_E_NULL, like
+ * with a NULL format string.  Use va_format_free() to deallocate.
+ */
+#define va_format_xcompile(alloc,X) \
+    va_format_compile_f(alloc, X, va_format_gen(X))
 
 /**
  * Default initialiser function for a stream that assumes
@@ -187,9 +210,26 @@ extern "C" {
 #define va_xformat1(s,a)   va_xprintf_gen(va_xprintf_, s, a)
 
 #define va_xinit(i,arg)  (va_xinit ## i arg)
-#define va_xinit0(z,x,g) va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g)
+#define va_xinit0(z,x,g) \
+    (va_format_plain(x) ? \
+        va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : \
+        va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))
 #define va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)
 
+/**
+ * Whether X is an array, e.g., a string literal, instead of a pointer.
+ */
+#define VA_IS_ARRAY(X) \
+    (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))
+
+/**
+ * Whether the format string X is known at compile time to contain no
+ * VA_SIGIL, i.e., to print as is.  This is false unless X is a string
+ * literal (or constant array) and the compiler optimises.
+ */
+#define va_format_plain(X) \
+    (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))
+
 /**
  * Get stream error code.
  */
@@ -200,6 +240,14 @@ extern "C" {
 
 extern va_read_iter_vtab_t const va_char_p_read_vtab_iso8859_1;
 
+/**
+ * Read methods that mark a va_format_t passed as a format string. */
+extern va_read_iter_vtab_t const va_format_read_vtab;
+
+/**
+ * The 'type' of the read methods of a va_format_t's format string. */
+extern char const va_format_type[];
+
 /* ********************************************************************** */
 /* extern functions */
 
@@ -222,6 +270,8 @@ extern va_stream_t *va_xprintf_error_t_p(va_stream_t *, va_error_t *x);
 
 extern va_stream_t *va_xprintf_iter_chunk(va_stream_t *, va_read_iter_t *);
 extern va_stream_t *va_xprintf_iter(va_stream_t *, va_read_iter_t *);
+/* like va_xprintf_iter(), but the iterator's final position is not used */
+extern va_stream_t *va_xprintf_iter_local(va_stream_t *, va_read_iter_t *);
 extern va_stream_t *va_xprintf_custom(va_stream_t *, va_print_t *);
 
 extern va_stream_t *va_xprintf_last_schar(va_stream_t *, signed char x);
@@ -269,6 +319,27 @@ extern va_stream_t *va_xprintf_init_last(
     void const *x,
     va_read_iter_vtab_t const *get_vtab);
 
+/**
+ * Like va_xprintf_init_last(), but for a format string without
+ * VA_SIGIL, which is copied into the stream in bulk.
+ */
+extern va_stream_t *va_xprintf_init_last_plain(
+    va_stream_t *,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+/**
+ * Whether the 'n' bytes at 'x' are constant and contain no VA_SIGIL
+ * byte.  Since the check is on bytes, a UTF-16 or UTF-32 code unit
+ * that contains the byte counts as a sigil, too, which is safe.
+ */
+__attribute__((always_inline))
+static inline bool va_format_plain_f(void const *x, size_t n)
+{
+    return __builtin_constant_p(__builtin_memchr(x, VA_SIGIL, n) == NULL) &&
+        (__builtin_memchr(x, VA_SIGIL, n) == NULL);
+}
+
 /**
  * Get a stream's error code.
  *
@@ -282,6 +353,22 @@ extern unsigned va_stream_get_error_f(va_stream_t const *s);
  */
 extern char const *va_strerror(unsigned);
 
+/**
+ * Precompile a format string, see va_format_xcompile().
+ *
+ * External function.
+ */
+extern va_format_t *va_format_compile_f(
+    void *(*alloc)(void *, size_t nmemb, size_t size),
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+/**
+ * Deallocate a precompiled format string using the allocator that
+ * it was allocated with.  Does nothing for NULL.
+ */
+extern void va_format_free(va_format_t *);
+
 /* ********************************************************************** */
 /* epilogue */
 
@@ -34,6 +34,11 @@
 #define va_fd32_encode utf32be
 #endif
 
+#ifndef va_fd_buf_size
+/** Size of the stack buffer va_dprintf() collects its output in. */
+#define va_fd_buf_size 512
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -46,62 +51,168 @@ extern "C" {
  * format string. */
 #define VA_STREAM_FD(FD) \
     ((va_stream_fd_t){ \
-        VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD) })
+        VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), NULL, 0, 0, 0, 0, {0} })
 
 /**
  * Create a 'char16_t' based va_stream_fd_t object with an initial
  * format string. */
 #define VA_STREAM_FD16(FD) \
     ((va_stream_fd_t){ \
-        VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD) })
+        VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), NULL, 0, 0, 0, 0, {0} })
 
 /**
  * Create a 'char32_t' based va_stream_fd_t object with an initial
  * format string. */
 #define VA_STREAM_FD32(FD) \
     ((va_stream_fd_t){ \
-        VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD) })
+        VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), NULL, 0, 0, 0, 0, {0} })
+
+/**
+ * Create a 'char' based va_stream_fd_t object that collects the
+ * output in the buffer B of N bytes.  The buffer is written when
+ * it is full, or on va_fd_flush(). */
+#define VA_STREAM_FD_BUF(FD,B,N) \
+    ((va_stream_fd_t){ \
+        VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), (B), (N), 0, 0, 0, {0} })
+
+/**
+ * Create a 'char16_t' based va_stream_fd_t object with a buffer.
+ * The buffer is a 'char' array: it stores the encoded bytes. */
+#define VA_STREAM_FD16_BUF(FD,B,N) \
+    ((va_stream_fd_t){ \
+        VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), (B), (N), 0, 0, 0, {0} })
+
+/**
+ * Create a 'char32_t' based va_stream_fd_t object with a buffer.
+ * The buffer is a 'char' array: it stores the encoded bytes. */
+#define VA_STREAM_FD32_BUF(FD,B,N) \
+    ((va_stream_fd_t){ \
+        VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), (B), (N), 0, 0, 0, {0} })
+
+/**
+ * Body of the va_dprintf() family: print into a buffered stream
+ * constructed by STREAM_BUF using a stack buffer of va_fd_buf_size
+ * bytes.  The stream is marked 'autoflush', so its 'finish' hook
+ * flushes it at the end, and a message is written with a single
+ * write() unless it is longer than the buffer or PIPE_BUF.  Longer
+ * messages are written in chunks that end at code point boundaries.
+ */
+#define va_xdprintf(STREAM_BUF,F,...) \
+    VA_BLOCK_STMT( \
+        char va_fd_buf_[va_fd_buf_size]; \
+        va_stream_fd_t va_fd_s_ = STREAM_BUF(F, va_fd_buf_, sizeof(va_fd_buf_)); \
+        va_fd_s_.autoflush = true; \
+        (void)va_xprintf(&va_fd_s_, __VA_ARGS__))
 
 /**
  * Prints a formatted string into a 'char' based FD.
  *
  * Returns nothing.
  */
-#define va_dprintf(F,...) \
-    VA_BLOCK_STMT((void)va_xprintf(&VA_STREAM_FD(F), __VA_ARGS__))
+#define va_dprintf(F,...) va_xdprintf(VA_STREAM_FD_BUF, F, __VA_ARGS__)
 
 /**
  * Prints a formatted string into a 'char16_t' based FD.
  *
  * Returns nothing.
  */
-#define va_udprintf(F,...) \
-    VA_BLOCK_STMT((void)va_xprintf(&VA_STREAM_FD16(F), __VA_ARGS__))
+#define va_udprintf(F,...) va_xdprintf(VA_STREAM_FD16_BUF, F, __VA_ARGS__)
 
 /**
  * Prints a formatted string into a 'char32_t' based FD.
  *
  * Returns nothing.
  */
-#define va_Udprintf(F,...) \
-    VA_BLOCK_STMT((void)va_xprintf(&VA_STREAM_FD32(F), __VA_ARGS__))
+#define va_Udprintf(F,...) va_xdprintf(VA_STREAM_FD32_BUF, F, __VA_ARGS__)
 
 /* ********************************************************************** */
 /* types */
 
+/**
+ * FD stream.
+ *
+ * If 'data' is NULL, the stream is unbuffered and every code point is
+ * written immediately with a single write().  Otherwise, the encoded
+ * output is collected in 'data' (of 'size' bytes, 'pos' of which are
+ * used) and written when the buffer is full, or when va_fd_flush() is
+ * invoked, so output is collected across print calls.  'mark' is the
+ * end of the last complete code point in 'data': a full buffer is only
+ * written up to there, so that no write() ends in the middle of a code
+ * point.
+ *
+ * If 'autoflush' is set, the buffer is also written at the end of each
+ * print call, and at most PIPE_BUF bytes are collected per write(), so
+ * that each write() is atomic on pipes.  va_dprintf() uses this for
+ * its stack buffer.
+ */
 typedef struct {
     va_stream_t s;
     long fd;
+    char *data;
+    size_t size;
+    size_t pos;
+    size_t mark;
+    bool autoflush;
+    char _pad[sizeof(size_t) - 1];
 } va_stream_fd_t;
 
 /* ********************************************************************** */
 /* extern functions */
 
+/**
+ * Write the buffered output of the stream, if any.
+ *
+ * This handles short writes and EINTR.  On write errors, the stream
+ * error is set to VA_E_TRUNC and the buffered output is dropped.
+ */
+extern void va_fd_flush(va_stream_fd_t *);
+
+/**
+ * Stream 'finish' hook: flush the buffer at the end of a print call
+ * if the stream is marked 'autoflush'.
+ */
+extern void va_fd_finish(va_stream_t *);
+
+/**
+ * Stream 'refill' hook: provide an output window into the buffer,
+ * flushing it if it is full.  Unbuffered streams have no window.
+ */
+extern bool va_fd_refill(va_stream_t *, size_t);
+
+/**
+ * Append N bytes to the stream's output: into the buffer, flushing
+ * it first if it is full, or directly using write() if the stream is
+ * unbuffered.  For 'autoflush' streams, at most PIPE_BUF bytes are
+ * collected before writing.
+ */
+extern void va_fd_write(va_stream_t *, void const *, size_t);
+
+/**
+ * Encode a code point using PUT so that its code units are written
+ * together: for unbuffered streams, with a single write(), and for
+ * buffered streams, by marking the end of a complete code point.
+ */
+extern void va_fd_put_whole(
+    va_stream_t *,
+    unsigned,
+    void (*)(va_stream_t *, unsigned));
+
+/**
+ * Append N copies of the K byte code point X to the stream's output,
+ * in chunks of whole code points.
+ */
+extern void va_fd_fill(va_stream_t *, void const *x, size_t k, size_t n);
+
 extern void va_fd_put(va_stream_t *, char);
 extern void va_fd16_put_be(va_stream_t *, char16_t);
 extern void va_fd16_put_le(va_stream_t *, char16_t);
 extern void va_fd32_put_be(va_stream_t *, char32_t);
 extern void va_fd32_put_le(va_stream_t *, char32_t);
+extern void va_fd_put_fill(va_stream_t *, unsigned, size_t);
+extern void va_fd16_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_fd16_put_fill_le(va_stream_t *, unsigned, size_t);
+extern void va_fd32_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_fd32_put_fill_le(va_stream_t *, unsigned, size_t);
 
 /* ********************************************************************** */
 /* epilogue */
@@ -35,6 +35,11 @@
 #define va_file32_encode utf32be
 #endif
 
+#ifndef va_file_buf_size
+/** Size of the stack buffer va_fprintf() collects its output in. */
+#define va_file_buf_size 256
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -47,45 +52,78 @@ extern "C" {
  * format string. */
 #define VA_STREAM_FILE(F) \
     ((va_stream_file_t){ \
-        VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F) })
+        VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), NULL, 0, 0, 0, {0} })
 
 /**
  * Create a 'char16_t' based va_stream_file_t object with an initial
  * format string. */
 #define VA_STREAM_FILE16(F) \
     ((va_stream_file_t){ \
-        VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F) })
+        VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), NULL, 0, 0, 0, {0} })
 
 /**
  * Create a 'char32_t' based va_stream_file_t object with an initial
  * format string. */
 #define VA_STREAM_FILE32(F) \
     ((va_stream_file_t){ \
-        VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F) })
+        VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), NULL, 0, 0, 0, {0} })
+
+/**
+ * Create a 'char' based va_stream_file_t object that collects the
+ * output in the buffer B of N bytes.  The buffer is written when it
+ * is full, or on va_file_flush(). */
+#define VA_STREAM_FILE_BUF(F,B,N) \
+    ((va_stream_file_t){ \
+        VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), (B), (N), 0, 0, {0} })
+
+/**
+ * Create a 'char16_t' based va_stream_file_t object with a buffer.
+ * The buffer is a 'char' array: it stores the encoded bytes. */
+#define VA_STREAM_FILE16_BUF(F,B,N) \
+    ((va_stream_file_t){ \
+        VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), (B), (N), 0, 0, {0} })
+
+/**
+ * Create a 'char32_t' based va_stream_file_t object with a buffer.
+ * The buffer is a 'char' array: it stores the encoded bytes. */
+#define VA_STREAM_FILE32_BUF(F,B,N) \
+    ((va_stream_file_t){ \
+        VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), (B), (N), 0, 0, {0} })
+
+/**
+ * Body of the va_fprintf() family: print into a buffered stream
+ * constructed by STREAM_BUF using a stack buffer of va_file_buf_size
+ * bytes.  The stream's 'init' and 'finish' hooks lock the FILE once,
+ * and as the stream is marked 'autoflush', 'finish' also writes the
+ * rest of the buffer.
+ */
+#define va_xfprintf(STREAM_BUF,F,...) \
+    VA_BLOCK_STMT( \
+        char va_file_buf_[va_file_buf_size]; \
+        va_stream_file_t va_file_s_ = STREAM_BUF(F, va_file_buf_, sizeof(va_file_buf_)); \
+        va_file_s_.autoflush = true; \
+        (void)va_xprintf(&va_file_s_, __VA_ARGS__))
 
 /**
  * Prints a formatted string into a 'char' based FILE*.
  *
  * Returns nothing.
  */
-#define va_fprintf(F,...) \
-    VA_BLOCK_STMT((void)va_xprintf(&VA_STREAM_FILE(F), __VA_ARGS__))
+#define va_fprintf(F,...) va_xfprintf(VA_STREAM_FILE_BUF, F, __VA_ARGS__)
 
 /**
  * Prints a formatted string into a 'char16_t' based FILE*.
  *
  * Returns nothing.
  */
-#define va_ufprintf(F,...) \
-    VA_BLOCK_STMT((void)va_xprintf(&VA_STREAM_FILE16(F), __VA_ARGS__))
+#define va_ufprintf(F,...) va_xfprintf(VA_STREAM_FILE16_BUF, F, __VA_ARGS__)
 
 /**
  * Prints a formatted string into a 'char32_t' based FILE*.
  *
  * Returns nothing.
  */
-#define va_Ufprintf(F,...) \
-    VA_BLOCK_STMT((void)va_xprintf(&VA_STREAM_FILE32(F), __VA_ARGS__))
+#define va_Ufprintf(F,...) va_xfprintf(VA_STREAM_FILE32_BUF, F, __VA_ARGS__)
 
 /**
  * Prints a formatted string into 'char' based stdout.
@@ -104,19 +142,81 @@ extern "C" {
 /* ********************************************************************** */
 /* types */
 
+/**
+ * FILE* stream.
+ *
+ * If 'data' is NULL, the stream is unbuffered and every code unit is
+ * passed to fwrite() immediately.  Otherwise, the encoded output is
+ * collected in 'data' (of 'size' bytes, 'pos' of which are used) and
+ * written with a single fwrite_unlocked() (under the FILE lock) when
+ * the buffer is full, or when va_file_flush() is invoked, so output is
+ * collected across print calls.  The FILE is locked during each print
+ * call.
+ *
+ * If 'autoflush' is set, the buffer is also written at the end of each
+ * print call.  va_fprintf() uses this for its stack buffer.
+ */
 typedef struct {
     va_stream_t s;
     FILE *file;
+    char *data;
+    size_t size;
+    size_t pos;
+    bool autoflush;
+    char _pad[sizeof(size_t) - 1];
 } va_stream_file_t;
 
 /* ********************************************************************** */
 /* extern functions */
 
+/**
+ * Stream 'init' hook: lock the stream's FILE using flockfile() for
+ * the print call.
+ */
+extern void va_file_init(va_stream_t *);
+
+/**
+ * Stream 'finish' hook: flush the stream if it is marked 'autoflush',
+ * and unlock its FILE using funlockfile().
+ */
+extern void va_file_finish(va_stream_t *);
+
+/**
+ * Write the buffered output of the stream, if any.
+ *
+ * On write errors, the stream error is set to VA_E_TRUNC.
+ */
+extern void va_file_flush(va_stream_file_t *);
+
+/**
+ * Stream 'refill' hook: provide an output window into the buffer,
+ * flushing it if it is full.  Unbuffered streams have no window.
+ */
+extern bool va_file_refill(va_stream_t *, size_t);
+
+/**
+ * Append N bytes to the stream's output: into the buffer, flushing
+ * it first if it is full, or directly using fwrite() if the stream is
+ * unbuffered.
+ */
+extern void va_file_write(va_stream_t *, void const *, size_t);
+
+/**
+ * Append N copies of the K byte code point X to the stream's output,
+ * in chunks of whole code points.
+ */
+extern void va_file_fill(va_stream_t *, void const *x, size_t k, size_t n);
+
 extern void va_file_put(va_stream_t *, char);
 extern void va_file16_put_be(va_stream_t *, char16_t);
 extern void va_file16_put_le(va_stream_t *, char16_t);
 extern void va_file32_put_be(va_stream_t *, char32_t);
 extern void va_file32_put_le(va_stream_t *, char32_t);
+extern void va_file_put_fill(va_stream_t *, unsigned, size_t);
+extern void va_file16_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_file16_put_fill_le(va_stream_t *, unsigned, size_t);
+extern void va_file32_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_file32_put_fill_le(va_stream_t *, unsigned, size_t);
 
 /* ********************************************************************** */
 /* epilogue */
@@ -12,6 +12,7 @@
 #ifndef VA_PRINT_IMPL_H_
 #define VA_PRINT_IMPL_H_
 
+#include <string.h>
 #include <va_print/base.h>
 
 #ifdef __cplusplus
@@ -75,12 +76,12 @@ extern "C" {
 #define VA_OPT_MINUS  0x0008
 /** '=' modifier */
 #define VA_OPT_EQUAL  0x0010
-/** internal: simulate printing (for counting) */
+/** internal: simulate printing (for counting), or stream is full */
 #define VA_OPT_SIM    0x0020
 /** last argument: terminate format string reading */
 #define VA_OPT_LAST   0x0040
-/** reserved */
-#define VA_OPT_X7     0x0080
+/** internal: stream 'init' was invoked, 'finish' is pending */
+#define VA_OPT_INIT   0x0080
 
 /** sign options */
 #define VA_OPT_SIGN   (8, 3U)
@@ -136,10 +137,11 @@ extern "C" {
 #define VA_OPT_EMORE  (30, 3U)
 
 /** mask of resetting print options at end of string */
-#define VA_OPT_RESET_END VA_MASH(VA_OPT_ERR)
+#define VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)
 
 /** mask of resetting print options at beginning of new argument */
-#define VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST)
+#define VA_OPT_RESET_ARG \
+    (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)
 
 /** mask for casting width */
 #define VA_WIDTH_MASK 0x7fffffff
@@ -172,6 +174,45 @@ extern "C" {
 #define VA_DELIM_FRONT(x)  ((unsigned short) ((x) >> 16))
 #define VA_DELIM_BACK(x)   ((unsigned short) ((x) >> 32))
 
+/**
+ * Character classes of a quotation class table, see
+ * va_quotation_table_t.
+ */
+
+/** Printed as is, does not cause quotation. */
+#define VA_QCLASS_PLAIN 0
+
+/** Printed as is, but causes the string to be quoted. */
+#define VA_QCLASS_QUOTE 1
+
+/** Rendered by the quotation's render_quote(), causes quotation. */
+#define VA_QCLASS_CALL 2
+
+/** Rendered as the escape sequence esc[N], causes quotation. */
+#define VA_QCLASS_ESC(N) (3 + (N))
+
+/**
+ * A declarative description of how ASCII characters are quoted.
+ *
+ * Quotations with a class table are run by the library without
+ * invoking callbacks for ASCII characters, and runs of characters
+ * that are printed as is are output in bulk.
+ */
+typedef struct {
+    /**
+     * The class of each ASCII character: VA_QCLASS_PLAIN,
+     * VA_QCLASS_QUOTE, VA_QCLASS_CALL, or VA_QCLASS_ESC(n).
+     */
+    unsigned char cls[128];
+
+    /**
+     * The escape sequences for VA_QCLASS_ESC(n) in esc[n], as NUL
+     * terminated strings of ASCII characters.  May be NULL if no
+     * character has class VA_QCLASS_ESC(n).
+     */
+    char const *const *esc;
+} va_quotation_table_t;
+
 /**
  * A virtual table for custom quotation.
  *
@@ -262,8 +303,39 @@ typedef struct {
      * quote correctly).
      */
     void (*render_flush)(va_stream_t *);
+
+    /**
+     * Optional class table for ASCII characters.
+     *
+     * If this is non-NULL, the table decides about quotation and
+     * rendering of ASCII characters, and check_quote() and
+     * render_quote() are only invoked for non-ASCII characters,
+     * for characters with decoding errors, and, in case of
+     * render_quote(), for VA_QCLASS_CALL.  If check_quote() is NULL,
+     * then non-ASCII characters do not cause quotation, and if
+     * render_quote() is NULL, they are printed using va_stream_render().
+     *
+     * The check for quotation sets s->qctxt to 1 for each character,
+     * so check_flush() can find out whether the string was empty.
+     */
+    va_quotation_table_t const *table;
 } va_quotation_t;
 
+/**
+ * A set of quotation methods, indexed by VA_QUOTE_*.
+ *
+ * This can be attached to a stream in s->quote, or to a thread with
+ * va_quotations_thread(), to be used instead of the global quotation
+ * methods that are set with va_quotation_set().  A NULL entry means
+ * 'no quotation'.  va_quotations_init() copies the global quotation
+ * methods into such a set, e.g., to keep the built-in ones.
+ *
+ * The set must not be changed while it is in use for printing.
+ */
+struct va_quotations {
+    va_quotation_t const *q[VA_MASK(VA_OPT_QUOTE) + 1];
+};
+
 /* ********************************************************************** */
 /* debug and analysis stuff (internal) */
 
@@ -312,12 +384,34 @@ extern void va_stream_render_quote_u(
  * This returns the previously set value.
  *
  * If quotation == NULL, the corresponding entry will be reset to 'no quotation'.
+ *
+ * This sets the global quotation method, used by streams and threads
+ * that have no set of their own.  The entry is replaced atomically, so
+ * concurrent printing either uses the old or the new quotation method,
+ * without locking.  The old method may still be in use by concurrent
+ * printing after this returns, so it should not be deallocated.
  */
 
 extern va_quotation_t const *va_quotation_set(
     unsigned which,
     va_quotation_t const *quotation);
 
+/**
+ * Initialise 'set' with the currently set global quotation methods.
+ */
+extern void va_quotations_init(
+    va_quotations_t *set);
+
+/**
+ * Use the quotation methods of 'set' for printing in the calling thread,
+ * unless a stream has its own set in s->quote.  If set == NULL, the
+ * global quotation methods are used again.
+ *
+ * This returns the previously set value.
+ */
+extern va_quotations_t const *va_quotations_thread(
+    va_quotations_t const *set);
+
 /* ********************************************************************** */
 /* static inline functions */
 
@@ -335,6 +429,167 @@ static inline void va_stream_set_error(va_stream_t *s, unsigned e)
     }
 }
 
+/**
+ * Mark that the stream had to drop output, e.g., because its buffer is
+ * full or memory is exhausted, and that it takes no more output in this
+ * print call.  This sets VA_E_TRUNC, and the printer then skips
+ * rendering the remaining arguments.  It still reads the whole format
+ * string and all arguments so that errors like VA_E_ARGC are reported
+ * like before.
+ */
+__attribute__((always_inline))
+static inline void va_stream_set_full(va_stream_t *s)
+{
+    va_stream_set_error(s, VA_E_TRUNC);
+    s->opt |= VA_OPT_SIM;
+}
+
+/**
+ * Store a valid code point as UTF-8 at 'w', return the end.
+ */
+__attribute__((always_inline))
+static inline char *va_store_utf8(char *w, unsigned c)
+{
+    if (c < 0x80) {
+        *w++ = (char)c;
+    }
+    else if (c < 0x800) {
+        *w++ = (char)(0xc0 | (c >> 6));
+        *w++ = (char)(0x80 | (c & 0x3f));
+    }
+    else if (c < 0x10000) {
+        *w++ = (char)(0xe0 | (c >> 12));
+        *w++ = (char)(0x80 | ((c >> 6) & 0x3f));
+        *w++ = (char)(0x80 | (c & 0x3f));
+    }
+    else {
+        *w++ = (char)(0xf0 | (c >> 18));
+        *w++ = (char)(0x80 | ((c >> 12) & 0x3f));
+        *w++ = (char)(0x80 | ((c >> 6) & 0x3f));
+        *w++ = (char)(0x80 | (c & 0x3f));
+    }
+    return w;
+}
+
+/**
+ * Store a valid code point as UTF-16 at 'w', return the end.
+ */
+__attribute__((always_inline))
+static inline char16_t *va_store_utf16(char16_t *w, unsigned c)
+{
+    if (c > 0xffff) {
+        c -= 0x10000;
+        *w++ = (char16_t)(0xd800 + (c >> 10));
+        *w++ = (char16_t)(0xdc00 + (c & 0x3ff));
+    }
+    else {
+        *w++ = (char16_t)c;
+    }
+    return w;
+}
+
+/**
+ * Decode a code point of a valid UTF-8 sequence, e.g., one that a
+ * 'bulk' function accepted, and advance '*pp' past it.
+ */
+__attribute__((always_inline))
+static inline unsigned va_take_utf8(unsigned char const **pp)
+{
+    unsigned char const *p = *pp;
+    unsigned c = p[0];
+    if (c < 0x80) {
+        *pp = p + 1;
+        return c;
+    }
+    if (c < 0xe0) {
+        *pp = p + 2;
+        return ((c & 0x1f) << 6) | (p[1] & 0x3fU);
+    }
+    if (c < 0xf0) {
+        *pp = p + 3;
+        return ((c & 0x0f) << 12) | ((p[1] & 0x3fU) << 6) | (p[2] & 0x3fU);
+    }
+    *pp = p + 4;
+    return ((c & 0x07) << 18) | ((p[1] & 0x3fU) << 12) |
+        ((p[2] & 0x3fU) << 6) | (p[3] & 0x3fU);
+}
+
+/**
+ * Decode a code point of a valid UTF-16 sequence and advance '*pp'
+ * past it.
+ */
+__attribute__((always_inline))
+static inline unsigned va_take_utf16(char16_t const **pp)
+{
+    char16_t const *p = *pp;
+    unsigned c = p[0];
+    if ((c < VA_U_SURR_MIN) || (c > VA_U_SURR_MAX)) {
+        *pp = p + 1;
+        return c;
+    }
+    *pp = p + 2;
+    return ((c & 0x3ff) << 10) + (p[1] & 0x3ffU) + 0x10000;
+}
+
+/**
+ * Number of UTF-8 code units of a valid code point.
+ */
+__attribute__((always_inline))
+static inline size_t va_units_utf8(unsigned c)
+{
+    return 1U + (c >= 0x80) + (c >= 0x800) + (c >= 0x10000);
+}
+
+/**
+ * Number of UTF-16 code units of a valid code point.
+ */
+__attribute__((always_inline))
+static inline size_t va_units_utf16(unsigned c)
+{
+    return 1U + (c > 0xffff);
+}
+
+/**
+ * Store 'n' copies of the 'k' byte code unit sequence 'x' at 'w'.
+ */
+__attribute__((always_inline))
+static inline void va_fill_pattern(
+    void *w, void const *x, size_t k, size_t n)
+{
+    char *p = w;
+    if (k == 1) {
+        memset(p, *(char const *)x, n);
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        memcpy(p, x, k);
+        p += k;
+    }
+}
+
+/**
+ * Number of bytes left in the stream's output window.
+ */
+__attribute__((always_inline))
+static inline size_t va_stream_room(va_stream_t const *s)
+{
+    return (size_t)((char*)s->win.end - (char*)s->win.cur);
+}
+
+/**
+ * Make sure that the stream's output window has room for n bytes.
+ * Returns false if the stream has no window or cannot provide that much
+ * room: the encoder then uses the sink's 'put' function.
+ */
+__attribute__((always_inline))
+static inline bool va_stream_reserve(va_stream_t *s, size_t n)
+{
+    if (va_stream_room(s) >= n) {
+        return true;
+    }
+    return (s->vtab->refill != NULL) && s->vtab->refill(s, n);
+}
+
 /* ********************************************************************** */
 /* epilogue */
 
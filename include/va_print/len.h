@@ -23,7 +23,13 @@ extern "C" {
 /**
  * Generate a value of typeva_stream_len_t */
 #define VA_STREAM_LEN() \
-    ((va_stream_len_t){ VA_STREAM(&va_len_vtab), 0 })
+    VA_STREAM_LEN_MAX(-(size_t)1)
+
+/**
+ * Generate a value of type va_stream_len_t that stops counting after
+ * N code points, see va_lnprintf(). */
+#define VA_STREAM_LEN_MAX(N) \
+    ((va_stream_len_t){ VA_STREAM(&va_len_vtab), 0, (N) })
 
 /**
  * Compute length of printed string, without actually
@@ -36,12 +42,24 @@ extern "C" {
 #define va_lprintf(...) \
     (va_xprintf(&VA_STREAM_LEN(), __VA_ARGS__)->pos)
 
+/**
+ * Compute the length of the printed string up to a limit.
+ *
+ * This is like va_lprintf(), but stops once the string is longer than
+ * N code points, and then skips the rest of the printing work.  This
+ * returns the length of the printed string if it is at most N, and
+ * N+1 otherwise, and sets VA_E_TRUNC in that case.
+ */
+#define va_lnprintf(N,...) \
+    (va_xprintf(&VA_STREAM_LEN_MAX(N), __VA_ARGS__)->pos)
+
 /* ********************************************************************** */
 /* types */
 
 typedef struct {
     va_stream_t s;
     size_t pos;
+    size_t max;
 } va_stream_len_t;
 
 /* ********************************************************************** */
@@ -0,0 +1,135 @@
+/* -*- Mode: C -*- */
+/* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
+
+/**
+ * This prints into a rope: a list of fixed size 'char' chunks that
+ * are appended as printing proceeds.  Written data is never moved, so
+ * very large outputs are not copied repeatedly like in reallocated
+ * vectors.  It uses UTF-8 encoding.
+ */
+
+/* ********************************************************************** */
+/* prologue */
+
+#ifndef VA_PRINT_ROPE_H_
+#define VA_PRINT_ROPE_H_
+
+#include <sys/uio.h>
+#include <va_print/core.h>
+#include <va_print/rope_utf8.h>
+
+/* ********************************************************************** */
+/* defaults */
+
+#ifndef va_rope_chunk_size
+/** Size in bytes of the chunks of a rope. */
+#define va_rope_chunk_size 16384
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ********************************************************************** */
+/* macros */
+
+/**
+ * Generate an empty rope of type va_stream_rope_t whose chunks are
+ * allocated with the given alloc() function.  Print into it with
+ * va_iprintf() or va_xprintf(): each call appends.
+ */
+#define VA_STREAM_ROPE(M) \
+    ((va_stream_rope_t){ \
+        VA_STREAM(&va_rope_vtab_utf8), NULL, NULL, va_rope_chunk_size, (M) })
+
+/* ********************************************************************** */
+/* types */
+
+typedef struct va_rope_chunk va_rope_chunk_t;
+
+/**
+ * Rope stream.
+ *
+ * The chunks are linked from 'first' to 'last', and only 'last' is
+ * appended to.  If memory is exhausted, the output is truncated and
+ * the stream error is set to VA_E_TRUNC.
+ */
+typedef struct {
+    va_stream_t s;
+    va_rope_chunk_t *first;
+    va_rope_chunk_t *last;
+    /** size in bytes of new chunks */
+    size_t chunk_size;
+    /** allocator for the chunks */
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_stream_rope_t;
+
+/* ********************************************************************** */
+/* extern functions */
+
+extern void va_rope_finish(
+    va_stream_t *);
+
+extern bool va_rope_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_rope_put(
+    va_stream_t *,
+    char);
+
+/**
+ * The number of bytes in the rope.
+ */
+extern size_t va_rope_len(
+    va_stream_rope_t *);
+
+/**
+ * Store views of the rope's chunks into iov[0..n-1], in order.  Returns
+ * the number of non-empty chunks, which may be more than n, so that
+ * with n == 0, this only counts.
+ */
+extern size_t va_rope_iovec(
+    va_stream_rope_t *,
+    struct iovec *iov,
+    size_t n);
+
+/**
+ * Write the rope to the file descriptor fd using writev().
+ *
+ * This handles short writes and EINTR.  Returns false on write errors.
+ */
+extern bool va_rope_writev(
+    va_stream_rope_t *,
+    int fd);
+
+/**
+ * Copy the rope into a single NUL terminated string that is newly
+ * allocated with the rope's alloc() function.  Returns NULL if memory
+ * is exhausted.  The rope is not changed.
+ */
+extern char *va_rope_flatten(
+    va_stream_rope_t *);
+
+/**
+ * Empty the rope.  The first chunk is kept for reuse, all others are
+ * deallocated.
+ */
+extern void va_rope_clear(
+    va_stream_rope_t *);
+
+/**
+ * Deallocate all chunks of the rope.  The rope is empty afterwards
+ * and can be used again.
+ */
+extern void va_rope_free(
+    va_stream_rope_t *);
+
+/* ********************************************************************** */
+/* epilogue */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VA_PRINT_ROPE_H_ */
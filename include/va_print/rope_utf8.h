@@ -0,0 +1,32 @@
+/* -*- Mode: C -*- */
+/* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
+
+/**
+ * This prints into ropes of 'char' chunks.  It uses UTF-8 encoding.
+ */
+
+/* ********************************************************************** */
+/* prologue */
+
+#ifndef VA_PRINT_ROPE_UTF8_H_
+#define VA_PRINT_ROPE_UTF8_H_
+
+#include <va_print/core.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ********************************************************************** */
+/* extern objects */
+
+extern va_stream_vtab_t const va_rope_vtab_utf8;
+
+/* ********************************************************************** */
+/* epilogue */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VA_PRINT_ROPE_UTF8_H_ */
@@ -37,6 +37,30 @@ extern unsigned va_span16_p_take_utf16(
     va_read_iter_t *,
     void const *end);
 
+/**
+ * Bulk scan for the UTF-16 read iterators: see va_read_iter_vtab_t::bulk.
+ */
+extern size_t va_char16_p_bulk_utf16(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span16_p_bulk_utf16(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+/**
+ * Bulk transcoding for the UTF-16 read iterators: see
+ * va_read_iter_vtab_t::transcode.
+ */
+extern size_t va_char16_p_transcode_utf16(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+
 /**
  * Encode UTF-16 code point.
  *
@@ -56,6 +80,15 @@ extern void va_put_utf16(
     unsigned,
     void (*put)(va_stream_t *, char16_t));
 
+/**
+ * Number of UTF-16 code units that va_put_utf16() prints for 'c',
+ * without encoding anything.  Sets the same stream errors.  Also
+ * applies to the big and little endian variants of the encoding.
+ */
+extern size_t va_len_utf16(
+    va_stream_t *,
+    unsigned);
+
 extern va_stream_t *va_xprintf_char16_p_utf16(
     va_stream_t *,
     char16_t const *);
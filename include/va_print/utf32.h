@@ -36,6 +36,30 @@ extern unsigned va_span32_p_take_utf32(
     va_read_iter_t *,
     void const *end);
 
+/**
+ * Bulk scan for the UTF-32 read iterators: see va_read_iter_vtab_t::bulk.
+ */
+extern size_t va_char32_p_bulk_utf32(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span32_p_bulk_utf32(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+/**
+ * Bulk transcoding for the UTF-32 read iterators: see
+ * va_read_iter_vtab_t::transcode.
+ */
+extern size_t va_char32_p_transcode_utf32(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+
 /**
  * Encode UTF-32 code point.
  *
@@ -55,6 +79,15 @@ extern void va_put_utf32(
     unsigned,
     void (*put)(va_stream_t *, char32_t));
 
+/**
+ * Number of UTF-32 code units that va_put_utf32() prints for 'c',
+ * without encoding anything.  Sets the same stream errors.  Also
+ * applies to the big and little endian variants of the encoding.
+ */
+extern size_t va_len_utf32(
+    va_stream_t *,
+    unsigned);
+
 extern va_stream_t *va_xprintf_char32_p_utf32(
     va_stream_t *,
     char32_t const *);
@@ -60,6 +60,30 @@ extern unsigned va_span_p_take_utf8(
     va_read_iter_t *,
     void const *end);
 
+/**
+ * Bulk scan for the UTF-8 read iterators: see va_read_iter_vtab_t::bulk.
+ */
+extern size_t va_char_p_bulk_utf8(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span_p_bulk_utf8(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+/**
+ * Bulk transcoding for the UTF-8 read iterators: see
+ * va_read_iter_vtab_t::transcode.
+ */
+extern size_t va_char_p_transcode_utf8(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+
 /**
  * Encode UTF-8 code point.
  *
@@ -83,6 +107,15 @@ extern void va_put_utf8(
     unsigned c,
     void (*put)(va_stream_t *, char));
 
+/**
+ * Number of UTF-8 code units that va_put_utf8() prints for 'c',
+ * without encoding anything.  Sets the same stream errors.  Also
+ * applies to the big and little endian variants of the encoding.
+ */
+extern size_t va_len_utf8(
+    va_stream_t *,
+    unsigned);
+
 extern va_stream_t *va_xprintf_char_p_utf8(
     va_stream_t *,
     char const *x);
@@ -0,0 +1,9980 @@
+	.file	"alloc.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc.c"
+	.type	commit, @function
+commit:
+.LVL0:
+.LFB14:
+	.file 1 "src/alloc.c"
+	.loc 1 13 1 view -0
+	.cfi_startproc
+	.loc 1 14 5 view .LVU1
+	.loc 1 14 17 is_stmt 0 view .LVU2
+	movq	40(%rdi), %rax
+	.loc 1 14 8 view .LVU3
+	testq	%rax, %rax
+	je	.L1
+.LBB27:
+	.loc 1 15 9 is_stmt 1 view .LVU4
+	.loc 1 15 47 is_stmt 0 view .LVU5
+	subq	64(%rdi), %rax
+	.loc 1 15 16 view .LVU6
+	movq	%rax, 80(%rdi)
+	.loc 1 16 9 is_stmt 1 view .LVU7
+	.loc 1 16 18 is_stmt 0 view .LVU8
+	xorl	%eax, %eax
+	movq	%rax, 40(%rdi)
+	movq	%rax, 48(%rdi)
+.L1:
+.LBE27:
+	.loc 1 18 1 view .LVU9
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	commit, .-commit
+	.type	vec_alloc, @function
+vec_alloc:
+.LVL1:
+.LFB15:
+	.loc 1 25 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 26 5 view .LVU11
+	.loc 1 25 1 is_stmt 0 view .LVU12
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+.LVL2:
+	.loc 1 25 1 view .LVU13
+	movq	%rdx, %rsi
+.LVL3:
+	.loc 1 26 10 view .LVU14
+	movq	104(%rax), %r8
+	.loc 1 26 8 view .LVU15
+	testq	%r8, %r8
+	je	.L8
+	.loc 1 27 9 is_stmt 1 view .LVU16
+	.loc 1 27 16 is_stmt 0 view .LVU17
+	movq	%rdi, %rsi
+	movl	$1, %ecx
+	movq	%r8, %rdi
+.LVL4:
+	.loc 1 27 16 view .LVU18
+	jmp	va_arena_alloc@PLT
+.LVL5:
+.L8:
+.LBB30:
+.LBI30:
+	.loc 1 24 14 is_stmt 1 view .LVU19
+.LBB31:
+	.loc 1 29 5 view .LVU20
+	.loc 1 29 12 is_stmt 0 view .LVU21
+	movq	88(%rax), %rax
+.LVL6:
+	.loc 1 29 12 view .LVU22
+	movl	$1, %edx
+.LVL7:
+	.loc 1 29 12 view .LVU23
+	jmp	*%rax
+.LVL8:
+	.loc 1 29 12 view .LVU24
+.LBE31:
+.LBE30:
+	.cfi_endproc
+.LFE15:
+	.size	vec_alloc, .-vec_alloc
+	.type	resize, @function
+resize:
+.LVL9:
+.LFB16:
+	.loc 1 38 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 39 5 view .LVU26
+	.loc 1 40 5 view .LVU27
+	.loc 1 38 1 is_stmt 0 view .LVU28
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 41 20 view .LVU29
+	movq	%rbp, %rdx
+	.loc 1 38 1 view .LVU30
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	.loc 1 40 10 view .LVU31
+	movq	64(%rdi), %rsi
+.LVL10:
+	.loc 1 40 8 view .LVU32
+	cmpq	96(%rdi), %rsi
+	jne	.L10
+	.loc 1 41 9 is_stmt 1 view .LVU33
+	.loc 1 41 20 is_stmt 0 view .LVU34
+	xorl	%esi, %esi
+	call	vec_alloc
+.LVL11:
+	.loc 1 42 9 is_stmt 1 view .LVU35
+	.loc 1 42 12 is_stmt 0 view .LVU36
+	testq	%rax, %rax
+	jne	.L11
+.L14:
+	.loc 1 50 15 view .LVU37
+	xorl	%eax, %eax
+.LVL12:
+	.loc 1 50 15 view .LVU38
+	jmp	.L9
+.LVL13:
+.L11:
+	.loc 1 43 13 is_stmt 1 view .LVU39
+	movq	64(%rbx), %rsi
+	movq	80(%rbx), %rcx
+	movq	%rax, %rdi
+	rep movsb
+	.loc 1 49 5 view .LVU40
+	jmp	.L13
+.LVL14:
+.L10:
+	.loc 1 47 9 view .LVU41
+	.loc 1 47 20 is_stmt 0 view .LVU42
+	call	vec_alloc
+.LVL15:
+	.loc 1 49 5 is_stmt 1 view .LVU43
+	.loc 1 49 8 is_stmt 0 view .LVU44
+	testq	%rax, %rax
+	je	.L14
+.L13:
+	.loc 1 52 5 is_stmt 1 view .LVU45
+	.loc 1 53 13 is_stmt 0 view .LVU46
+	movq	%rbp, 72(%rbx)
+	.loc 1 52 13 view .LVU47
+	movq	%rax, 64(%rbx)
+	.loc 1 53 5 is_stmt 1 view .LVU48
+	.loc 1 54 5 view .LVU49
+	.loc 1 54 11 is_stmt 0 view .LVU50
+	movb	$1, %al
+.LVL16:
+.L9:
+	.loc 1 55 1 view .LVU51
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL17:
+	.loc 1 55 1 view .LVU52
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL18:
+	.loc 1 55 1 view .LVU53
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	resize, .-resize
+	.type	grow, @function
+grow:
+.LVL19:
+.LFB17:
+	.loc 1 62 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 1 is_stmt 0 view .LVU55
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	.loc 1 63 5 is_stmt 1 view .LVU56
+	.loc 1 62 1 is_stmt 0 view .LVU57
+	pushq	%r8
+	.cfi_def_cfa_offset 32
+	.loc 1 63 9 view .LVU58
+	call	resize
+.LVL20:
+	.loc 1 63 9 view .LVU59
+	movl	%eax, %ebp
+	.loc 1 63 8 view .LVU60
+	testb	%al, %al
+	jne	.L19
+.LVL21:
+.LBB39:
+.LBI39:
+	.loc 1 61 12 is_stmt 1 view .LVU61
+.LBB40:
+	.loc 1 66 5 view .LVU62
+	.loc 1 66 10 is_stmt 0 view .LVU63
+	movq	64(%rbx), %rsi
+	.loc 1 66 8 view .LVU64
+	cmpq	96(%rbx), %rsi
+	je	.L21
+	.loc 1 67 9 is_stmt 1 view .LVU65
+	.loc 1 67 15 is_stmt 0 view .LVU66
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	call	vec_alloc
+.LVL22:
+.L21:
+	.loc 1 69 5 is_stmt 1 view .LVU67
+.LBB41:
+.LBI41:
+	.file 2 "./include/va_print/impl.h"
+	.loc 2 441 20 view .LVU68
+.LBB42:
+	.loc 2 443 5 view .LVU69
+.LBB43:
+.LBI43:
+	.loc 2 425 20 view .LVU70
+.LBB44:
+	.loc 2 427 5 view .LVU71
+	.loc 2 427 13 is_stmt 0 view .LVU72
+	movl	32(%rbx), %edx
+	.loc 2 427 8 view .LVU73
+	testl	$939524096, %edx
+	jne	.L22
+	.loc 2 428 9 is_stmt 1 view .LVU74
+.LBB45:
+	.loc 2 428 25 view .LVU75
+.LVL23:
+	.loc 2 428 62 view .LVU76
+	.loc 2 428 101 is_stmt 0 view .LVU77
+	andl	$-939524097, %edx
+	.loc 2 428 123 view .LVU78
+	orl	$536870912, %edx
+	movl	%edx, 32(%rbx)
+.LVL24:
+.L22:
+	.loc 2 428 123 view .LVU79
+.LBE45:
+.LBE44:
+.LBE43:
+	.loc 2 444 5 is_stmt 1 view .LVU80
+.LBE42:
+.LBE41:
+	.loc 1 71 13 is_stmt 0 view .LVU81
+	xorl	%ecx, %ecx
+.LBB47:
+.LBB46:
+	.loc 2 444 12 view .LVU82
+	orl	$32, 32(%rbx)
+.LVL25:
+	.loc 2 444 12 view .LVU83
+.LBE46:
+.LBE47:
+	.loc 1 70 5 is_stmt 1 view .LVU84
+	.loc 1 71 13 is_stmt 0 view .LVU85
+	movq	%rcx, 80(%rbx)
+	.loc 1 72 13 view .LVU86
+	movq	%rcx, 72(%rbx)
+	movq	%rcx, 64(%rbx)
+	.loc 1 73 5 is_stmt 1 view .LVU87
+.LVL26:
+.L19:
+	.loc 1 73 5 is_stmt 0 view .LVU88
+.LBE40:
+.LBE39:
+	.loc 1 74 1 view .LVU89
+	movl	%ebp, %eax
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL27:
+	.loc 1 74 1 view .LVU90
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	grow, .-grow
+	.globl	va_vec_init
+	.type	va_vec_init, @function
+va_vec_init:
+.LVL28:
+.LFB18:
+	.loc 1 81 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 82 5 view .LVU92
+	.loc 1 83 5 view .LVU93
+	.loc 1 83 8 is_stmt 0 view .LVU94
+	cmpq	$0, 64(%rdi)
+	jne	.L32
+	.loc 1 83 31 discriminator 1 view .LVU95
+	movq	72(%rdi), %rdx
+	.loc 1 81 1 discriminator 1 view .LVU96
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	.loc 1 83 26 discriminator 1 view .LVU97
+	testq	%rdx, %rdx
+	je	.L24
+	.loc 1 87 5 is_stmt 1 view .LVU98
+	.loc 1 87 15 is_stmt 0 view .LVU99
+	xorl	%esi, %esi
+	call	vec_alloc
+.LVL29:
+	.loc 1 87 13 view .LVU100
+	movq	%rax, 64(%rbx)
+	.loc 1 88 5 is_stmt 1 view .LVU101
+	.loc 1 88 8 is_stmt 0 view .LVU102
+	testq	%rax, %rax
+	jne	.L26
+	.loc 1 89 9 is_stmt 1 view .LVU103
+.LVL30:
+.LBB48:
+.LBI48:
+	.loc 2 441 20 view .LVU104
+.LBB49:
+	.loc 2 443 5 view .LVU105
+.LBB50:
+.LBI50:
+	.loc 2 425 20 view .LVU106
+.LBB51:
+	.loc 2 427 5 view .LVU107
+	.loc 2 427 13 is_stmt 0 view .LVU108
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU109
+	testl	$939524096, %eax
+	jne	.L27
+	.loc 2 428 9 is_stmt 1 view .LVU110
+.LBB52:
+	.loc 2 428 25 view .LVU111
+.LVL31:
+	.loc 2 428 62 view .LVU112
+	.loc 2 428 101 is_stmt 0 view .LVU113
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU114
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+.LVL32:
+.L27:
+	.loc 2 428 123 view .LVU115
+.LBE52:
+.LBE51:
+.LBE50:
+	.loc 2 444 5 is_stmt 1 view .LVU116
+.LBE49:
+.LBE48:
+	.loc 1 91 17 is_stmt 0 view .LVU117
+	xorl	%edx, %edx
+.LBB54:
+.LBB53:
+	.loc 2 444 12 view .LVU118
+	orl	$32, 32(%rbx)
+.LVL33:
+	.loc 2 444 12 view .LVU119
+.LBE53:
+.LBE54:
+	.loc 1 90 9 is_stmt 1 view .LVU120
+	.loc 1 91 17 is_stmt 0 view .LVU121
+	movq	%rdx, 80(%rbx)
+	movq	%rdx, 72(%rbx)
+	.loc 1 92 9 is_stmt 1 view .LVU122
+	jmp	.L24
+.L26:
+	.loc 1 95 5 view .LVU123
+	.loc 1 95 12 is_stmt 0 view .LVU124
+	xorl	%eax, %eax
+	movq	%rax, 80(%rbx)
+.L24:
+	.loc 1 96 1 view .LVU125
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL34:
+	.loc 1 96 1 view .LVU126
+	ret
+.LVL35:
+.L32:
+	.cfi_restore 3
+	.loc 1 96 1 view .LVU127
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	va_vec_init, .-va_vec_init
+	.globl	va_vec_finish
+	.type	va_vec_finish, @function
+va_vec_finish:
+.LVL36:
+.LFB19:
+	.loc 1 100 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 101 5 view .LVU129
+	.loc 1 102 5 view .LVU130
+	.loc 1 100 1 is_stmt 0 view .LVU131
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	.loc 1 102 5 view .LVU132
+	call	commit
+.LVL37:
+	.loc 1 103 5 is_stmt 1 view .LVU133
+	.loc 1 103 10 is_stmt 0 view .LVU134
+	movq	64(%rdi), %rax
+	.loc 1 103 8 view .LVU135
+	testq	%rax, %rax
+	je	.L35
+	.loc 1 106 5 is_stmt 1 view .LVU136
+	.loc 1 106 21 is_stmt 0 view .LVU137
+	movq	80(%rdi), %rdx
+	movb	$0, (%rax,%rdx)
+	.loc 1 107 5 is_stmt 1 view .LVU138
+	.loc 1 107 8 is_stmt 0 view .LVU139
+	cmpb	$0, 112(%rdi)
+	jne	.L35
+	.loc 1 107 23 discriminator 1 view .LVU140
+	movq	96(%rdi), %rax
+	.loc 1 107 17 discriminator 1 view .LVU141
+	testq	%rax, %rax
+	jne	.L39
+	.loc 1 107 39 discriminator 2 view .LVU142
+	cmpq	$0, 104(%rdi)
+	je	.L35
+.L39:
+	.loc 1 113 5 is_stmt 1 view .LVU143
+	.loc 1 113 12 is_stmt 0 view .LVU144
+	movq	80(%rbx), %rcx
+	.loc 1 114 10 view .LVU145
+	movq	64(%rbx), %rsi
+	.loc 1 113 12 view .LVU146
+	leaq	1(%rcx), %rbp
+.LVL38:
+	.loc 1 114 5 is_stmt 1 view .LVU147
+	.loc 1 114 8 is_stmt 0 view .LVU148
+	cmpq	%rsi, %rax
+	jne	.L40
+.LBB55:
+	.loc 1 115 9 is_stmt 1 view .LVU149
+	.loc 1 115 26 is_stmt 0 view .LVU150
+	xorl	%esi, %esi
+	movq	%rbp, %rdx
+	movq	%rbx, %rdi
+.LVL39:
+	.loc 1 115 26 view .LVU151
+	call	vec_alloc
+.LVL40:
+	.loc 1 116 9 is_stmt 1 view .LVU152
+	.loc 1 116 12 is_stmt 0 view .LVU153
+	testq	%rax, %rax
+	jne	.L41
+	.loc 1 117 13 is_stmt 1 view .LVU154
+.LVL41:
+.LBB56:
+.LBI56:
+	.loc 2 441 20 view .LVU155
+.LBB57:
+	.loc 2 443 5 view .LVU156
+.LBB58:
+.LBI58:
+	.loc 2 425 20 view .LVU157
+.LBB59:
+	.loc 2 427 5 view .LVU158
+	.loc 2 427 13 is_stmt 0 view .LVU159
+	movl	32(%rbx), %eax
+.LVL42:
+	.loc 2 427 8 view .LVU160
+	testl	$939524096, %eax
+	jne	.L42
+	.loc 2 428 9 is_stmt 1 view .LVU161
+.LBB60:
+	.loc 2 428 25 view .LVU162
+.LVL43:
+	.loc 2 428 62 view .LVU163
+	.loc 2 428 101 is_stmt 0 view .LVU164
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU165
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+.LVL44:
+.L42:
+	.loc 2 428 123 view .LVU166
+.LBE60:
+.LBE59:
+.LBE58:
+	.loc 2 444 5 is_stmt 1 view .LVU167
+.LBE57:
+.LBE56:
+	.loc 1 119 21 is_stmt 0 view .LVU168
+	xorl	%edx, %edx
+.LBB62:
+.LBB61:
+	.loc 2 444 12 view .LVU169
+	orl	$32, 32(%rbx)
+.LVL45:
+	.loc 2 444 12 view .LVU170
+.LBE61:
+.LBE62:
+	.loc 1 118 13 is_stmt 1 view .LVU171
+	.loc 1 119 21 is_stmt 0 view .LVU172
+	movq	%rdx, 80(%rbx)
+	.loc 1 120 21 view .LVU173
+	movq	%rdx, 72(%rbx)
+	movq	%rdx, 64(%rbx)
+	.loc 1 121 13 is_stmt 1 view .LVU174
+	jmp	.L35
+.LVL46:
+.L41:
+	.loc 1 123 9 view .LVU175
+	movq	64(%rbx), %rsi
+	movq	%rax, %rdi
+	movq	%rbp, %rcx
+	rep movsb
+	.loc 1 124 9 view .LVU176
+	jmp	.L47
+.LVL47:
+.L40:
+	.loc 1 124 9 is_stmt 0 view .LVU177
+.LBE55:
+	.loc 1 127 10 is_stmt 1 view .LVU178
+	.loc 1 127 13 is_stmt 0 view .LVU179
+	cmpq	72(%rbx), %rbp
+	jnb	.L35
+.LBB63:
+	.loc 1 129 9 is_stmt 1 view .LVU180
+	.loc 1 129 26 is_stmt 0 view .LVU181
+	movq	%rbp, %rdx
+	movq	%rbx, %rdi
+	call	vec_alloc
+.LVL48:
+	.loc 1 130 9 is_stmt 1 view .LVU182
+	.loc 1 130 12 is_stmt 0 view .LVU183
+	testq	%rax, %rax
+	je	.L35
+.LVL49:
+.L47:
+	.loc 1 131 13 is_stmt 1 view .LVU184
+	.loc 1 131 21 is_stmt 0 view .LVU185
+	movq	%rax, 64(%rbx)
+	.loc 1 132 13 is_stmt 1 view .LVU186
+	.loc 1 132 21 is_stmt 0 view .LVU187
+	movq	%rbp, 72(%rbx)
+.LVL50:
+.L35:
+	.loc 1 132 21 view .LVU188
+.LBE63:
+	.loc 1 135 1 view .LVU189
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL51:
+	.loc 1 135 1 view .LVU190
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	va_vec_finish, .-va_vec_finish
+	.globl	va_vec_refill
+	.type	va_vec_refill, @function
+va_vec_refill:
+.LVL52:
+.LFB20:
+	.loc 1 140 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 141 5 view .LVU192
+	.loc 1 142 5 view .LVU193
+	.loc 1 140 1 is_stmt 0 view .LVU194
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 140 1 view .LVU195
+	movq	%rdi, %rbx
+	.loc 1 142 5 view .LVU196
+	call	commit
+.LVL53:
+	.loc 1 143 5 is_stmt 1 view .LVU197
+	.loc 1 143 8 is_stmt 0 view .LVU198
+	cmpq	$0, 64(%rdi)
+	jne	.L49
+.LVL54:
+.L55:
+	.loc 1 144 15 view .LVU199
+	xorl	%eax, %eax
+	jmp	.L48
+.LVL55:
+.L49:
+	.loc 1 147 5 is_stmt 1 view .LVU200
+	.loc 1 148 5 view .LVU201
+	.loc 1 148 17 is_stmt 0 view .LVU202
+	movq	80(%rdi), %rax
+	addq	%rsi, %rax
+	.loc 1 148 26 view .LVU203
+	movq	72(%rdi), %rsi
+.LVL56:
+	.loc 1 148 8 view .LVU204
+	cmpq	%rsi, %rax
+	jnb	.L53
+.L54:
+	.loc 1 158 5 is_stmt 1 view .LVU205
+	.loc 1 158 32 is_stmt 0 view .LVU206
+	movq	64(%rbx), %rax
+	.loc 1 158 67 view .LVU207
+	movq	72(%rbx), %rdx
+	leaq	-1(%rax,%rdx), %rdx
+	.loc 1 158 39 view .LVU208
+	addq	80(%rbx), %rax
+	.loc 1 158 14 view .LVU209
+	movq	%rax, 40(%rbx)
+	.loc 1 159 11 view .LVU210
+	movb	$1, %al
+	.loc 1 158 14 view .LVU211
+	movq	%rdx, 48(%rbx)
+	.loc 1 159 5 is_stmt 1 view .LVU212
+	.loc 1 159 11 is_stmt 0 view .LVU213
+	jmp	.L48
+.L53:
+.LBB64:
+	.loc 1 151 13 is_stmt 1 view .LVU214
+	.loc 1 151 18 is_stmt 0 view .LVU215
+	addq	%rsi, %rsi
+.LVL57:
+	.loc 1 150 29 is_stmt 1 view .LVU216
+	cmpq	%rsi, %rax
+	jnb	.L53
+	.loc 1 153 9 view .LVU217
+	.loc 1 153 14 is_stmt 0 view .LVU218
+	movq	%rbx, %rdi
+	call	grow
+.LVL58:
+	.loc 1 153 12 view .LVU219
+	testb	%al, %al
+	jne	.L54
+	jmp	.L55
+.LVL59:
+.L48:
+	.loc 1 153 12 view .LVU220
+.LBE64:
+	.loc 1 160 1 view .LVU221
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL60:
+	.loc 1 160 1 view .LVU222
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	va_vec_refill, .-va_vec_refill
+	.globl	va_vec_put
+	.type	va_vec_put, @function
+va_vec_put:
+.LVL61:
+.LFB21:
+	.loc 1 165 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 166 5 view .LVU224
+	.loc 1 167 5 view .LVU225
+	.loc 1 167 8 is_stmt 0 view .LVU226
+	cmpq	$0, 64(%rdi)
+	je	.L64
+	.loc 1 165 1 view .LVU227
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	.loc 1 171 5 is_stmt 1 view .LVU228
+	.loc 1 165 1 is_stmt 0 view .LVU229
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rdx
+	.cfi_def_cfa_offset 32
+	.loc 1 171 18 view .LVU230
+	movq	80(%rdi), %rax
+	.loc 1 171 27 view .LVU231
+	movq	72(%rdi), %rsi
+.LVL62:
+	.loc 1 171 18 view .LVU232
+	incq	%rax
+	.loc 1 171 8 view .LVU233
+	cmpq	%rsi, %rax
+	jnb	.L60
+.LVL63:
+.L61:
+	.loc 1 175 5 is_stmt 1 view .LVU234
+	.loc 1 175 21 is_stmt 0 view .LVU235
+	movq	80(%rbx), %rax
+	movq	64(%rbx), %rdx
+	movb	%bpl, (%rdx,%rax)
+	.loc 1 176 5 is_stmt 1 view .LVU236
+	.loc 1 176 11 is_stmt 0 view .LVU237
+	incq	80(%rbx)
+	jmp	.L57
+.L60:
+	.loc 1 171 39 discriminator 1 view .LVU238
+	addq	%rsi, %rsi
+	call	grow
+.LVL64:
+	.loc 1 171 35 discriminator 1 view .LVU239
+	testb	%al, %al
+	jne	.L61
+.L57:
+	.loc 1 177 1 view .LVU240
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL65:
+	.loc 1 177 1 view .LVU241
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+.LVL66:
+.L64:
+	.cfi_restore 3
+	.cfi_restore 6
+	.loc 1 177 1 view .LVU242
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	va_vec_put, .-va_vec_put
+	.globl	va_vec_clear
+	.type	va_vec_clear, @function
+va_vec_clear:
+.LVL67:
+.LFB22:
+	.loc 1 181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU244
+	call	commit
+.LVL68:
+	.loc 1 183 5 view .LVU245
+	.loc 1 183 12 is_stmt 0 view .LVU246
+	xorl	%eax, %eax
+	movq	%rax, 80(%rdi)
+	.loc 1 184 5 is_stmt 1 view .LVU247
+	.loc 1 184 10 is_stmt 0 view .LVU248
+	movq	64(%rdi), %rax
+	.loc 1 184 8 view .LVU249
+	testq	%rax, %rax
+	je	.L68
+	.loc 1 185 9 is_stmt 1 view .LVU250
+	.loc 1 185 20 is_stmt 0 view .LVU251
+	movb	$0, (%rax)
+	ret
+.L68:
+	.loc 1 187 10 is_stmt 1 view .LVU252
+	.loc 1 187 13 is_stmt 0 view .LVU253
+	cmpq	$0, 72(%rdi)
+	jne	.L67
+	.loc 1 189 9 is_stmt 1 view .LVU254
+	.loc 1 189 17 is_stmt 0 view .LVU255
+	movq	$16, 72(%rdi)
+.L67:
+	.loc 1 191 1 view .LVU256
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	va_vec_clear, .-va_vec_clear
+	.globl	va_vec_reserve
+	.type	va_vec_reserve, @function
+va_vec_reserve:
+.LVL69:
+.LFB23:
+	.loc 1 196 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 197 5 view .LVU258
+	.loc 1 196 1 is_stmt 0 view .LVU259
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 196 1 view .LVU260
+	movq	%rdi, %rbx
+	.loc 1 197 5 view .LVU261
+	call	commit
+.LVL70:
+	.loc 1 198 5 is_stmt 1 view .LVU262
+	.loc 1 198 8 is_stmt 0 view .LVU263
+	cmpq	$-1, %rsi
+	jne	.L71
+.LVL71:
+.L74:
+	.loc 1 199 15 view .LVU264
+	xorl	%eax, %eax
+	jmp	.L70
+.LVL72:
+.L71:
+	.loc 1 201 5 is_stmt 1 view .LVU265
+	.loc 1 201 8 is_stmt 0 view .LVU266
+	cmpq	$0, 64(%rdi)
+	jne	.L73
+	.loc 1 202 9 is_stmt 1 view .LVU267
+	.loc 1 202 33 is_stmt 0 view .LVU268
+	movl	$15, %eax
+	cmpq	%rax, %rsi
+	cmovb	%rax, %rsi
+.LVL73:
+	.loc 1 203 16 view .LVU269
+	xorl	%eax, %eax
+	movq	%rax, 80(%rdi)
+	.loc 1 202 33 view .LVU270
+	leaq	1(%rsi), %rdx
+	.loc 1 204 19 view .LVU271
+	xorl	%esi, %esi
+	.loc 1 202 17 view .LVU272
+	movq	%rdx, 72(%rdi)
+	.loc 1 203 9 is_stmt 1 view .LVU273
+	.loc 1 204 9 view .LVU274
+	.loc 1 204 19 is_stmt 0 view .LVU275
+	call	vec_alloc
+.LVL74:
+	.loc 1 204 17 view .LVU276
+	movq	%rax, 64(%rbx)
+	.loc 1 205 9 is_stmt 1 view .LVU277
+	.loc 1 205 12 is_stmt 0 view .LVU278
+	testq	%rax, %rax
+	je	.L74
+	.loc 1 208 9 is_stmt 1 view .LVU279
+	.loc 1 208 20 is_stmt 0 view .LVU280
+	movb	$0, (%rax)
+	.loc 1 209 9 is_stmt 1 view .LVU281
+	.loc 1 209 15 is_stmt 0 view .LVU282
+	movb	$1, %al
+	jmp	.L70
+.LVL75:
+.L73:
+	.loc 1 211 5 is_stmt 1 view .LVU283
+	.loc 1 211 26 is_stmt 0 view .LVU284
+	movl	$1, %eax
+	cmpq	72(%rdi), %rsi
+	jb	.L75
+	.loc 1 211 29 discriminator 2 view .LVU285
+	incq	%rsi
+.LVL76:
+	.loc 1 211 29 discriminator 2 view .LVU286
+	call	resize
+.LVL77:
+	.loc 1 211 26 discriminator 2 view .LVU287
+	movzbl	%al, %eax
+.L75:
+	.loc 1 211 26 discriminator 6 view .LVU288
+	andl	$1, %eax
+.L70:
+	.loc 1 212 1 view .LVU289
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL78:
+	.loc 1 212 1 view .LVU290
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	va_vec_reserve, .-va_vec_reserve
+	.globl	va_vec_shrink
+	.type	va_vec_shrink, @function
+va_vec_shrink:
+.LVL79:
+.LFB24:
+	.loc 1 217 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 218 5 view .LVU292
+	.loc 1 217 1 is_stmt 0 view .LVU293
+	pushq	%rcx
+	.cfi_def_cfa_offset 16
+	.loc 1 218 5 view .LVU294
+	call	commit
+.LVL80:
+	.loc 1 219 5 is_stmt 1 view .LVU295
+	.loc 1 220 5 view .LVU296
+	.loc 1 220 11 is_stmt 0 view .LVU297
+	movq	64(%rdi), %rax
+	.loc 1 220 8 view .LVU298
+	testq	%rax, %rax
+	je	.L81
+	.loc 1 220 26 discriminator 1 view .LVU299
+	cmpq	96(%rdi), %rax
+	je	.L81
+	.loc 1 219 37 discriminator 2 view .LVU300
+	movq	80(%rdi), %rax
+	cmpq	%rax, %rsi
+	cmovb	%rax, %rsi
+.LVL81:
+	.loc 1 219 12 discriminator 2 view .LVU301
+	incq	%rsi
+	.loc 1 220 51 discriminator 2 view .LVU302
+	cmpq	72(%rdi), %rsi
+	jnb	.L81
+	.loc 1 221 9 is_stmt 1 view .LVU303
+	.loc 1 223 1 is_stmt 0 view .LVU304
+	popq	%rdx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 221 15 view .LVU305
+	jmp	resize
+.LVL82:
+.L81:
+	.cfi_restore_state
+	.loc 1 223 1 view .LVU306
+	popq	%rax
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	va_vec_shrink, .-va_vec_shrink
+	.globl	va_vec_span
+	.type	va_vec_span, @function
+va_vec_span:
+.LVL83:
+.LFB25:
+	.loc 1 228 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 229 5 view .LVU308
+	call	commit
+.LVL84:
+	.loc 1 230 5 view .LVU309
+	.loc 1 230 35 is_stmt 0 view .LVU310
+	movq	64(%rdi), %rax
+	.loc 1 230 27 view .LVU311
+	movq	80(%rdi), %rdx
+	.loc 1 230 11 view .LVU312
+	movq	%rax, 8(%rsi)
+	.loc 1 231 5 is_stmt 1 view .LVU313
+	.loc 1 232 1 is_stmt 0 view .LVU314
+	movq	%rsi, %rax
+	.loc 1 230 11 view .LVU315
+	movq	%rdx, (%rsi)
+	.loc 1 232 1 view .LVU316
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	va_vec_span, .-va_vec_span
+	.globl	va_vec_free
+	.type	va_vec_free, @function
+va_vec_free:
+.LVL85:
+.LFB26:
+	.loc 1 236 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 237 5 view .LVU318
+	.loc 1 236 1 is_stmt 0 view .LVU319
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 236 1 view .LVU320
+	movq	%rdi, %rbx
+	.loc 1 237 5 view .LVU321
+	call	commit
+.LVL86:
+	.loc 1 238 5 is_stmt 1 view .LVU322
+	.loc 1 238 11 is_stmt 0 view .LVU323
+	movq	64(%rdi), %rsi
+	.loc 1 238 8 view .LVU324
+	testq	%rsi, %rsi
+	je	.L89
+	.loc 1 238 26 discriminator 1 view .LVU325
+	cmpq	96(%rdi), %rsi
+	je	.L89
+	.loc 1 239 9 is_stmt 1 view .LVU326
+	.loc 1 239 15 is_stmt 0 view .LVU327
+	xorl	%edx, %edx
+	call	vec_alloc
+.LVL87:
+.L89:
+	.loc 1 241 5 is_stmt 1 view .LVU328
+	.loc 1 242 12 is_stmt 0 view .LVU329
+	xorl	%eax, %eax
+	.loc 1 243 13 view .LVU330
+	movq	$16, 72(%rbx)
+	.loc 1 242 12 view .LVU331
+	movq	%rax, 64(%rbx)
+	movq	%rax, 80(%rbx)
+	.loc 1 243 5 is_stmt 1 view .LVU332
+	.loc 1 244 1 is_stmt 0 view .LVU333
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL88:
+	.loc 1 244 1 view .LVU334
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	va_vec_free, .-va_vec_free
+.Letext0:
+	.file 3 "./include/va_print/base.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./include/va_print/alloc.h"
+	.file 6 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xfc3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2a
+	.long	.LASF987
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3e
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF905
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF906
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0xc
+	.long	0x53
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF907
+	.uleb128 0xc
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF908
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF909
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF910
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF911
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF912
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF913
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF914
+	.uleb128 0x2c
+	.byte	0x8
+	.uleb128 0x3
+	.long	0x5d
+	.uleb128 0x10
+	.long	0x5d
+	.long	0xb1
+	.uleb128 0x11
+	.long	0x3e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x18
+	.byte	0x38
+	.byte	0x3
+	.byte	0xc1
+	.long	0x149
+	.uleb128 0xb
+	.long	.LASF915
+	.byte	0x3
+	.byte	0xc4
+	.byte	0x11
+	.long	0x53
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF916
+	.byte	0x3
+	.byte	0xd3
+	.byte	0x10
+	.long	0x198
+	.byte	0x8
+	.uleb128 0x15
+	.string	"end"
+	.byte	0x3
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1b1
+	.byte	0x10
+	.uleb128 0xb
+	.long	.LASF917
+	.byte	0x3
+	.byte	0xdb
+	.byte	0xc
+	.long	0x1c1
+	.byte	0x18
+	.uleb128 0xb
+	.long	.LASF918
+	.byte	0x3
+	.byte	0xe2
+	.byte	0xe
+	.long	0x1ee
+	.byte	0x20
+	.uleb128 0xb
+	.long	.LASF919
+	.byte	0x3
+	.byte	0xec
+	.byte	0xe
+	.long	0x211
+	.byte	0x28
+	.uleb128 0xb
+	.long	.LASF920
+	.byte	0x3
+	.byte	0xf1
+	.byte	0x13
+	.long	0x7e
+	.byte	0x30
+	.uleb128 0xb
+	.long	.LASF921
+	.byte	0x3
+	.byte	0xf5
+	.byte	0x13
+	.long	0x7e
+	.byte	0x31
+	.uleb128 0xb
+	.long	.LASF922
+	.byte	0x3
+	.byte	0xf9
+	.byte	0x13
+	.long	0x7e
+	.byte	0x32
+	.uleb128 0x15
+	.string	"enc"
+	.byte	0x3
+	.byte	0xfd
+	.byte	0x13
+	.long	0x7e
+	.byte	0x33
+	.uleb128 0xb
+	.long	.LASF923
+	.byte	0x3
+	.byte	0xff
+	.byte	0xa
+	.long	0xa1
+	.byte	0x34
+	.byte	0
+	.uleb128 0xd
+	.long	0x85
+	.long	0x15d
+	.uleb128 0x1
+	.long	0x15d
+	.uleb128 0x1
+	.long	0x192
+	.byte	0
+	.uleb128 0x3
+	.long	0x162
+	.uleb128 0x16
+	.long	.LASF929
+	.byte	0x10
+	.byte	0x3
+	.value	0x132
+	.byte	0x10
+	.long	0x18d
+	.uleb128 0x4
+	.long	.LASF924
+	.byte	0x3
+	.value	0x135
+	.byte	0x20
+	.long	0x228
+	.byte	0
+	.uleb128 0x8
+	.string	"cur"
+	.byte	0x3
+	.value	0x138
+	.byte	0x11
+	.long	0x192
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	0x162
+	.uleb128 0x3
+	.long	0x197
+	.uleb128 0x2d
+	.uleb128 0x3
+	.long	0x149
+	.uleb128 0xd
+	.long	0x192
+	.long	0x1b1
+	.uleb128 0x1
+	.long	0x15d
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	0x19d
+	.uleb128 0x12
+	.long	0x1c1
+	.uleb128 0x1
+	.long	0x15d
+	.byte	0
+	.uleb128 0x3
+	.long	0x1b6
+	.uleb128 0xd
+	.long	0x32
+	.long	0x1e4
+	.uleb128 0x1
+	.long	0x1e4
+	.uleb128 0x1
+	.long	0x192
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x1e9
+	.byte	0
+	.uleb128 0x3
+	.long	0x18d
+	.uleb128 0x3
+	.long	0x32
+	.uleb128 0x3
+	.long	0x1c6
+	.uleb128 0xd
+	.long	0x32
+	.long	0x211
+	.uleb128 0x1
+	.long	0x9a
+	.uleb128 0x1
+	.long	0x7e
+	.uleb128 0x1
+	.long	0x192
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	0x1f3
+	.uleb128 0x9
+	.long	.LASF926
+	.byte	0x3
+	.value	0x100
+	.byte	0x3
+	.long	0xb1
+	.uleb128 0xc
+	.long	0x216
+	.uleb128 0x3
+	.long	0x223
+	.uleb128 0x9
+	.long	.LASF927
+	.byte	0x3
+	.value	0x139
+	.byte	0x3
+	.long	0x162
+	.uleb128 0xd
+	.long	0x9a
+	.long	0x253
+	.uleb128 0x1
+	.long	0x9a
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	0x23a
+	.uleb128 0x9
+	.long	.LASF928
+	.byte	0x3
+	.value	0x169
+	.byte	0x1a
+	.long	0x265
+	.uleb128 0x16
+	.long	.LASF930
+	.byte	0x40
+	.byte	0x3
+	.value	0x1b7
+	.byte	0x8
+	.long	0x2e4
+	.uleb128 0x4
+	.long	.LASF924
+	.byte	0x3
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x459
+	.byte	0
+	.uleb128 0x8
+	.string	"pat"
+	.byte	0x3
+	.value	0x1b9
+	.byte	0x14
+	.long	0x22d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF931
+	.byte	0x3
+	.value	0x1ba
+	.byte	0xe
+	.long	0x85
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF932
+	.byte	0x3
+	.value	0x1bb
+	.byte	0xe
+	.long	0x85
+	.byte	0x1c
+	.uleb128 0x8
+	.string	"opt"
+	.byte	0x3
+	.value	0x1bc
+	.byte	0xe
+	.long	0x85
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF933
+	.byte	0x3
+	.value	0x1bd
+	.byte	0xe
+	.long	0x85
+	.byte	0x24
+	.uleb128 0x8
+	.string	"win"
+	.byte	0x3
+	.value	0x1be
+	.byte	0x11
+	.long	0x44c
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF934
+	.byte	0x3
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x45e
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF935
+	.byte	0x3
+	.value	0x16c
+	.byte	0x1e
+	.long	0x2f6
+	.uleb128 0xc
+	.long	0x2e4
+	.uleb128 0x16
+	.long	.LASF936
+	.byte	0x40
+	.byte	0x2
+	.value	0x14f
+	.byte	0x8
+	.long	0x311
+	.uleb128 0x8
+	.string	"q"
+	.byte	0x2
+	.value	0x150
+	.byte	0x1b
+	.long	0x699
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.byte	0x38
+	.byte	0x3
+	.value	0x174
+	.long	0x38b
+	.uleb128 0x4
+	.long	.LASF937
+	.byte	0x3
+	.value	0x176
+	.byte	0xc
+	.long	0x39b
+	.byte	0
+	.uleb128 0x8
+	.string	"put"
+	.byte	0x3
+	.value	0x178
+	.byte	0xc
+	.long	0x3b0
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF938
+	.byte	0x3
+	.value	0x17b
+	.byte	0xc
+	.long	0x39b
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF939
+	.byte	0x3
+	.value	0x182
+	.byte	0xb
+	.long	0x3d0
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF940
+	.byte	0x3
+	.value	0x186
+	.byte	0xc
+	.long	0x3ea
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF941
+	.byte	0x3
+	.value	0x18c
+	.byte	0xc
+	.long	0x3ff
+	.byte	0x28
+	.uleb128 0x8
+	.string	"enc"
+	.byte	0x3
+	.value	0x191
+	.byte	0x13
+	.long	0x7e
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF923
+	.byte	0x3
+	.value	0x192
+	.byte	0xa
+	.long	0x404
+	.byte	0x31
+	.byte	0
+	.uleb128 0x12
+	.long	0x396
+	.uleb128 0x1
+	.long	0x396
+	.byte	0
+	.uleb128 0x3
+	.long	0x258
+	.uleb128 0x3
+	.long	0x38b
+	.uleb128 0x12
+	.long	0x3b0
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x85
+	.byte	0
+	.uleb128 0x3
+	.long	0x3a0
+	.uleb128 0xd
+	.long	0x3c9
+	.long	0x3c9
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF942
+	.uleb128 0x3
+	.long	0x3b5
+	.uleb128 0x12
+	.long	0x3ea
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x85
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	0x3d5
+	.uleb128 0x12
+	.long	0x3ff
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	0x3ef
+	.uleb128 0x10
+	.long	0x5d
+	.long	0x414
+	.uleb128 0x11
+	.long	0x3e
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF943
+	.byte	0x3
+	.value	0x193
+	.byte	0x3
+	.long	0x311
+	.uleb128 0xc
+	.long	0x414
+	.uleb128 0x17
+	.byte	0x10
+	.byte	0x3
+	.value	0x19a
+	.long	0x44c
+	.uleb128 0x8
+	.string	"cur"
+	.byte	0x3
+	.value	0x19b
+	.byte	0xb
+	.long	0x9a
+	.byte	0
+	.uleb128 0x8
+	.string	"end"
+	.byte	0x3
+	.value	0x19c
+	.byte	0xb
+	.long	0x9a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF944
+	.byte	0x3
+	.value	0x19d
+	.byte	0x3
+	.long	0x426
+	.uleb128 0x3
+	.long	0x421
+	.uleb128 0x3
+	.long	0x2f1
+	.uleb128 0x16
+	.long	.LASF945
+	.byte	0x10
+	.byte	0x3
+	.value	0x1e5
+	.byte	0x10
+	.long	0x48e
+	.uleb128 0x4
+	.long	.LASF946
+	.byte	0x3
+	.value	0x1e6
+	.byte	0xc
+	.long	0x32
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF947
+	.byte	0x3
+	.value	0x1e7
+	.byte	0x11
+	.long	0x53
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF948
+	.byte	0x3
+	.value	0x1e8
+	.byte	0x3
+	.long	0x463
+	.uleb128 0x9
+	.long	.LASF949
+	.byte	0x5
+	.value	0x1a6
+	.byte	0x1f
+	.long	0x4a8
+	.uleb128 0x2e
+	.long	.LASF988
+	.uleb128 0x17
+	.byte	0x20
+	.byte	0x5
+	.value	0x1af
+	.long	0x4ef
+	.uleb128 0x4
+	.long	.LASF950
+	.byte	0x5
+	.value	0x1b1
+	.byte	0x17
+	.long	0x4ef
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF951
+	.byte	0x5
+	.value	0x1b3
+	.byte	0xb
+	.long	0x9a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF952
+	.byte	0x5
+	.value	0x1b5
+	.byte	0xc
+	.long	0x32
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF953
+	.byte	0x5
+	.value	0x1b7
+	.byte	0xd
+	.long	0x253
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	0x49b
+	.uleb128 0x9
+	.long	.LASF954
+	.byte	0x5
+	.value	0x1b8
+	.byte	0x3
+	.long	0x4ad
+	.uleb128 0x17
+	.byte	0x78
+	.byte	0x5
+	.value	0x1ba
+	.long	0x587
+	.uleb128 0x8
+	.string	"s"
+	.byte	0x5
+	.value	0x1bb
+	.byte	0x11
+	.long	0x258
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF947
+	.byte	0x5
+	.value	0x1bc
+	.byte	0xb
+	.long	0x9c
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF946
+	.byte	0x5
+	.value	0x1bd
+	.byte	0xc
+	.long	0x32
+	.byte	0x48
+	.uleb128 0x8
+	.string	"pos"
+	.byte	0x5
+	.value	0x1be
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF953
+	.byte	0x5
+	.value	0x1bf
+	.byte	0xd
+	.long	0x253
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF955
+	.byte	0x5
+	.value	0x1c0
+	.byte	0xb
+	.long	0x9c
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF956
+	.byte	0x5
+	.value	0x1c1
+	.byte	0x11
+	.long	0x587
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF957
+	.byte	0x5
+	.value	0x1c2
+	.byte	0x13
+	.long	0x7e
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF923
+	.byte	0x5
+	.value	0x1c3
+	.byte	0xa
+	.long	0x404
+	.byte	0x71
+	.byte	0
+	.uleb128 0x3
+	.long	0x4f4
+	.uleb128 0x9
+	.long	.LASF958
+	.byte	0x5
+	.value	0x1c4
+	.byte	0x3
+	.long	0x501
+	.uleb128 0x18
+	.byte	0x88
+	.byte	0x2
+	.byte	0xc9
+	.long	0x5bc
+	.uleb128 0x15
+	.string	"cls"
+	.byte	0x2
+	.byte	0xce
+	.byte	0x13
+	.long	0x5bc
+	.byte	0
+	.uleb128 0x15
+	.string	"esc"
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x18
+	.long	0x5cc
+	.byte	0x80
+	.byte	0
+	.uleb128 0x10
+	.long	0x7e
+	.long	0x5cc
+	.uleb128 0x11
+	.long	0x3e
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x3
+	.long	0x58
+	.uleb128 0x22
+	.long	.LASF959
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x3
+	.long	0x599
+	.uleb128 0xc
+	.long	0x5d1
+	.uleb128 0x18
+	.byte	0x38
+	.byte	0x2
+	.byte	0xe0
+	.long	0x63e
+	.uleb128 0xb
+	.long	.LASF960
+	.byte	0x2
+	.byte	0xef
+	.byte	0x18
+	.long	0x63e
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF961
+	.byte	0x2
+	.value	0x101
+	.byte	0xb
+	.long	0x669
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF962
+	.byte	0x2
+	.value	0x10e
+	.byte	0xb
+	.long	0x67d
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF963
+	.byte	0x2
+	.value	0x12a
+	.byte	0xc
+	.long	0x3b0
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF964
+	.byte	0x2
+	.value	0x131
+	.byte	0xc
+	.long	0x39b
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF965
+	.byte	0x2
+	.value	0x141
+	.byte	0x21
+	.long	0x682
+	.byte	0x30
+	.byte	0
+	.uleb128 0x10
+	.long	0x64e
+	.long	0x64e
+	.uleb128 0x11
+	.long	0x3e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF966
+	.uleb128 0xd
+	.long	0x3c9
+	.long	0x669
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x85
+	.byte	0
+	.uleb128 0x3
+	.long	0x655
+	.uleb128 0xd
+	.long	0x3c9
+	.long	0x67d
+	.uleb128 0x1
+	.long	0x396
+	.byte	0
+	.uleb128 0x3
+	.long	0x66e
+	.uleb128 0x3
+	.long	0x5dd
+	.uleb128 0x9
+	.long	.LASF967
+	.byte	0x2
+	.value	0x142
+	.byte	0x3
+	.long	0x5e2
+	.uleb128 0xc
+	.long	0x687
+	.uleb128 0x10
+	.long	0x6a9
+	.long	0x6a9
+	.uleb128 0x11
+	.long	0x3e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	0x694
+	.uleb128 0x2f
+	.long	.LASF968
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.long	0x9a
+	.long	0x6ce
+	.uleb128 0x1
+	.long	0x9a
+	.uleb128 0x1
+	.long	0x192
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF969
+	.byte	0x5
+	.value	0x297
+	.byte	0xe
+	.long	0x9a
+	.long	0x6f4
+	.uleb128 0x1
+	.long	0x587
+	.uleb128 0x1
+	.long	0x9a
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF971
+	.byte	0xea
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x753
+	.uleb128 0xa
+	.string	"t"
+	.byte	0xeb
+	.byte	0x16
+	.long	0x753
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x13
+	.quad	.LVL86
+	.long	0xd66
+	.long	0x739
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL87
+	.long	0xd37
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x58c
+	.uleb128 0x19
+	.long	.LASF973
+	.byte	0xe1
+	.byte	0x13
+	.long	0x7a7
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7a7
+	.uleb128 0x1a
+	.string	"t"
+	.byte	0xe2
+	.byte	0x16
+	.long	0x753
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x31
+	.long	.LASF970
+	.byte	0x1
+	.byte	0xe3
+	.byte	0x10
+	.long	0x7a7
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.quad	.LVL84
+	.long	0xd66
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x48e
+	.uleb128 0xe
+	.long	.LASF972
+	.byte	0xd6
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x82b
+	.uleb128 0xa
+	.string	"t"
+	.byte	0xd7
+	.byte	0x16
+	.long	0x753
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0xa
+	.string	"n"
+	.byte	0xd8
+	.byte	0xc
+	.long	0x32
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0xf
+	.long	.LASF946
+	.byte	0xdb
+	.byte	0xc
+	.long	0x32
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x13
+	.quad	.LVL80
+	.long	0xd66
+	.long	0x815
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL82
+	.long	0xcad
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF974
+	.byte	0xc1
+	.byte	0xc
+	.long	0x3c9
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8ea
+	.uleb128 0xa
+	.string	"t"
+	.byte	0xc2
+	.byte	0x16
+	.long	0x753
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0xa
+	.string	"n"
+	.byte	0xc3
+	.byte	0xc
+	.long	0x32
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x13
+	.quad	.LVL70
+	.long	0xd66
+	.long	0x886
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL74
+	.long	0xd37
+	.long	0x8cc
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x25
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x3f
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775793
+	.byte	0x2a
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL77
+	.long	0xcad
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF975
+	.byte	0xb3
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x926
+	.uleb128 0x1a
+	.string	"t"
+	.byte	0xb4
+	.byte	0x16
+	.long	0x753
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.quad	.LVL68
+	.long	0xd66
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF976
+	.byte	0xa2
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x983
+	.uleb128 0xa
+	.string	"s"
+	.byte	0xa3
+	.byte	0x12
+	.long	0x396
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0xa
+	.string	"c"
+	.byte	0xa4
+	.byte	0xa
+	.long	0x5d
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x14
+	.string	"t"
+	.byte	0xa6
+	.byte	0x16
+	.long	0x753
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x24
+	.quad	.LVL64
+	.long	0xc89
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF977
+	.byte	0x89
+	.byte	0xc
+	.long	0x3c9
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa3c
+	.uleb128 0xa
+	.string	"s"
+	.byte	0x8a
+	.byte	0x12
+	.long	0x396
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x25
+	.long	.LASF978
+	.byte	0x8b
+	.byte	0xc
+	.long	0x32
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x14
+	.string	"t"
+	.byte	0x8d
+	.byte	0x16
+	.long	0x753
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x14
+	.string	"n"
+	.byte	0x93
+	.byte	0xc
+	.long	0x32
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1b
+	.quad	.LBB64
+	.quad	.LBE64-.LBB64
+	.long	0xa27
+	.uleb128 0xf
+	.long	.LASF946
+	.byte	0x95
+	.byte	0x10
+	.long	0x32
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x7
+	.quad	.LVL58
+	.long	0xc89
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL53
+	.long	0xd66
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF979
+	.byte	0x62
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbaf
+	.uleb128 0xa
+	.string	"s"
+	.byte	0x63
+	.byte	0x12
+	.long	0x396
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x14
+	.string	"t"
+	.byte	0x65
+	.byte	0x16
+	.long	0x753
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0xf
+	.long	.LASF946
+	.byte	0x71
+	.byte	0xc
+	.long	0x32
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1b
+	.quad	.LBB55
+	.quad	.LBE55-.LBB55
+	.long	0xb57
+	.uleb128 0xf
+	.long	.LASF980
+	.byte	0x73
+	.byte	0xf
+	.long	0x9c
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x1c
+	.long	0xd90
+	.quad	.LBI56
+	.byte	.LVU155
+	.long	.LLRL28
+	.byte	0x75
+	.byte	0xd
+	.long	0xb37
+	.uleb128 0x5
+	.long	0xd9b
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x1d
+	.long	0xda6
+	.quad	.LBI58
+	.byte	.LVU157
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.uleb128 0x5
+	.long	0xdbb
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x5
+	.long	0xdb1
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1e
+	.long	0xdc5
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.uleb128 0x1f
+	.long	0xdc6
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL40
+	.long	0xd37
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.long	0xb9a
+	.uleb128 0xf
+	.long	.LASF980
+	.byte	0x81
+	.byte	0xf
+	.long	0x9c
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x7
+	.quad	.LVL48
+	.long	0xd37
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL37
+	.long	0xd66
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF981
+	.byte	0x4f
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc89
+	.uleb128 0xa
+	.string	"s"
+	.byte	0x50
+	.byte	0x12
+	.long	0x396
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x14
+	.string	"t"
+	.byte	0x52
+	.byte	0x16
+	.long	0x753
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1c
+	.long	0xd90
+	.quad	.LBI48
+	.byte	.LVU104
+	.long	.LLRL19
+	.byte	0x59
+	.byte	0x9
+	.long	0xc6f
+	.uleb128 0x5
+	.long	0xd9b
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1d
+	.long	0xda6
+	.quad	.LBI50
+	.byte	.LVU106
+	.quad	.LBB50
+	.quad	.LBE50-.LBB50
+	.uleb128 0x5
+	.long	0xdbb
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x5
+	.long	0xdb1
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1e
+	.long	0xdc5
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.uleb128 0x1f
+	.long	0xdc6
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL29
+	.long	0xd37
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF982
+	.byte	0x3d
+	.byte	0xc
+	.long	0x3c9
+	.long	0xcad
+	.uleb128 0x27
+	.string	"t"
+	.byte	0x3d
+	.byte	0x22
+	.long	0x753
+	.uleb128 0x20
+	.long	.LASF946
+	.byte	0x3d
+	.byte	0x2c
+	.long	0x32
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF989
+	.byte	0x1
+	.byte	0x25
+	.byte	0xc
+	.long	0x3c9
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd37
+	.uleb128 0xa
+	.string	"t"
+	.byte	0x25
+	.byte	0x24
+	.long	0x753
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x25
+	.long	.LASF946
+	.byte	0x25
+	.byte	0x2e
+	.long	0x32
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0xf
+	.long	.LASF980
+	.byte	0x27
+	.byte	0xb
+	.long	0x9c
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x13
+	.quad	.LVL11
+	.long	0xd37
+	.long	0xd29
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL15
+	.long	0xd37
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF983
+	.byte	0x18
+	.byte	0xe
+	.long	0x9a
+	.long	0xd66
+	.uleb128 0x27
+	.string	"t"
+	.byte	0x18
+	.byte	0x29
+	.long	0x753
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x18
+	.byte	0x32
+	.long	0x9a
+	.uleb128 0x20
+	.long	.LASF984
+	.byte	0x18
+	.byte	0x3f
+	.long	0x32
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF990
+	.byte	0x1
+	.byte	0xc
+	.byte	0xd
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd90
+	.uleb128 0x1a
+	.string	"t"
+	.byte	0xc
+	.byte	0x25
+	.long	0x753
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF985
+	.value	0x1b9
+	.long	0xda6
+	.uleb128 0x21
+	.string	"s"
+	.value	0x1b9
+	.byte	0x34
+	.long	0x396
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF986
+	.value	0x1a9
+	.long	0xdd5
+	.uleb128 0x21
+	.string	"s"
+	.value	0x1a9
+	.byte	0x35
+	.long	0x396
+	.uleb128 0x21
+	.string	"e"
+	.value	0x1a9
+	.byte	0x41
+	.long	0x85
+	.uleb128 0x34
+	.uleb128 0x35
+	.string	"_xp"
+	.byte	0x2
+	.value	0x1ac
+	.byte	0x2d
+	.long	0xdd5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x85
+	.uleb128 0x36
+	.long	0xd37
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe9f
+	.uleb128 0x5
+	.long	0xd46
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x5
+	.long	0xd4f
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x5
+	.long	0xd5a
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x29
+	.long	0xd37
+	.quad	.LBI30
+	.byte	.LVU19
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.byte	0x18
+	.byte	0xe
+	.long	0xe7d
+	.uleb128 0x37
+	.long	0xd46
+	.uleb128 0x5
+	.long	0xd5a
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x5
+	.long	0xd4f
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x38
+	.quad	.LVL8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL5
+	.long	0x6ce
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0xc89
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x5
+	.long	0xc98
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x5
+	.long	0xca1
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x29
+	.long	0xc89
+	.quad	.LBI39
+	.byte	.LVU61
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.byte	0x3d
+	.byte	0xc
+	.long	0xfaa
+	.uleb128 0x5
+	.long	0xca1
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x5
+	.long	0xc98
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x1c
+	.long	0xd90
+	.quad	.LBI41
+	.byte	.LVU68
+	.long	.LLRL12
+	.byte	0x45
+	.byte	0x5
+	.long	0xf90
+	.uleb128 0x5
+	.long	0xd9b
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1d
+	.long	0xda6
+	.quad	.LBI43
+	.byte	.LVU70
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.uleb128 0x5
+	.long	0xdbb
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x5
+	.long	0xdb1
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1e
+	.long	0xdc5
+	.quad	.LBB45
+	.quad	.LBE45-.LBB45
+	.uleb128 0x1f
+	.long	0xdc6
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL22
+	.long	0xd37
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LVL20
+	.long	0xcad
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 443
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU328
+	.uleb128 .LVU328
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 0
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL87-1-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU296
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU306
+	.uleb128 .LVU306
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x28
+	.byte	0x75
+	.sleb128 80
+	.byte	0x6
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x74
+	.sleb128 0
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-1-.Ltext0
+	.uleb128 0x29
+	.byte	0x75
+	.sleb128 80
+	.byte	0x6
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x29
+	.byte	0x75
+	.sleb128 80
+	.byte	0x6
+	.byte	0x12
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x16
+	.byte	0x14
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2b
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU290
+	.uleb128 .LVU290
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 .LVU287
+	.uleb128 .LVU287
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL77-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS39:
+	.uleb128 0
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS40:
+	.uleb128 0
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 0
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU225
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 0
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU200
+	.uleb128 .LVU200
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU193
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 0
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU201
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU220
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU130
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU190
+	.uleb128 .LVU190
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU147
+	.uleb128 .LVU188
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU152
+	.uleb128 .LVU160
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU155
+	.uleb128 .LVU170
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU157
+	.uleb128 .LVU166
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU157
+	.uleb128 .LVU166
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU163
+	.uleb128 .LVU166
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU93
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU104
+	.uleb128 .LVU119
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU106
+	.uleb128 .LVU115
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU106
+	.uleb128 .LVU115
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU112
+	.uleb128 .LVU115
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL15-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU41
+	.uleb128 .LVU43
+	.uleb128 .LVU51
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU22
+	.uleb128 .LVU22
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU18
+	.uleb128 .LVU18
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU19
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU19
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU59
+	.uleb128 .LVU59
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL20-1-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU62
+	.uleb128 .LVU88
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU61
+	.uleb128 .LVU88
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU68
+	.uleb128 .LVU83
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU70
+	.uleb128 .LVU79
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU70
+	.uleb128 .LVU79
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU76
+	.uleb128 .LVU79
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL12:
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL19:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB62-.Ltext0
+	.uleb128 .LBE62-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/include/assert.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF386
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF587
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF588
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF590
+	.file 21 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF591
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF592
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 23 "/usr/include/uchar.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF633
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF693
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF694
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF695
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 29 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF755
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF758
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 31 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF761
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 32 "./include/va_print/alloc_utf8.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF781
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF782
+	.file 33 "./include/va_print/alloc_utf16.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF783
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF784
+	.file 34 "./include/va_print/alloc_utf32.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF785
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF437
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF451
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF452
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF513
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF531
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF539
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.40.d34159d34f444de373121677553af6a7,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF545
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF547
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF548
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF622
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF626
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF631
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF625
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF648
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF690
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF692
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF754
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF760
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF780
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloc.h.36.de1e80339a384712e904cf7f8ce67801,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF829
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.13.ba8b097355bd637e9189dfa7d96daa61,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF904
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF648:
+	.string	"__STD_TYPE typedef"
+.LASF439:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF950:
+	.string	"chunk"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF925:
+	.string	"size_t"
+.LASF840:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF422:
+	.string	"__USE_ISOC11 1"
+.LASF726:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF867:
+	.string	"VA_MODE_X7 7"
+.LASF587:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF774:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF782:
+	.string	"va_vec_encode utf8"
+.LASF538:
+	.string	"__stub_sigreturn "
+.LASF402:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF744:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF977:
+	.string	"va_vec_refill"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF888:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF414:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF790:
+	.string	"va_tprintf_slots 4"
+.LASF476:
+	.string	"__flexarr []"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF681:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF842:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF758:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF776:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF447:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF818:
+	.string	"va_arena_uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16_ARENA(A), __VA_ARGS__)->data)"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF879:
+	.string	"VA_QUOTE_K 4"
+.LASF857:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF959:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF777:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF742:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF625:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF833:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF757:
+	.string	"va_char_p_decode utf8"
+.LASF730:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF741:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF749:
+	.string	"VA_E_DECODE 2"
+.LASF490:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF668:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF708:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF693:
+	.string	"__STD_TYPE"
+.LASF541:
+	.string	"_ASSERT_H_DECLS "
+.LASF643:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF463:
+	.string	"__P(args) args"
+.LASF773:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF737:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF809:
+	.string	"va_bxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC_INLINE(alloc, B), __VA_ARGS__))"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF901:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF661:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF745:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF624:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF916:
+	.string	"take"
+.LASF915:
+	.string	"type"
+.LASF895:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF819:
+	.string	"va_arena_Uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32_ARENA(A), __VA_ARGS__)->data)"
+.LASF601:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF408:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF582:
+	.string	"__size_t "
+.LASF897:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF645:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF849:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF451:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF478:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF938:
+	.string	"finish"
+.LASF703:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF904:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF405:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF701:
+	.string	"VA_NIX "
+.LASF359:
+	.string	"__k8 1"
+.LASF392:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF704:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF591:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF584:
+	.string	"NULL"
+.LASF473:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF987:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF675:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF755:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF980:
+	.string	"new_data"
+.LASF962:
+	.string	"check_flush"
+.LASF534:
+	.string	"__stub_fchflags "
+.LASF716:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF593:
+	.string	"_STDDEF_H "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF670:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF815:
+	.string	"va_vec_is_inline(T) (((T)->data != NULL) && ((T)->data == (T)->stage))"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF738:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF416:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF396:
+	.string	"__USE_XOPEN"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF956:
+	.string	"arena"
+.LASF401:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF500:
+	.string	"__always_inline"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF412:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF449:
+	.string	"__GLIBC__ 2"
+.LASF908:
+	.string	"long int"
+.LASF441:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF813:
+	.string	"va_ubprintf(B,...) va_ubxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF971:
+	.string	"va_vec_free"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF417:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF435:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF954:
+	.string	"va_arena_t"
+.LASF600:
+	.string	"_PTRDIFF_T_ "
+.LASF565:
+	.string	"__size_t__ "
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF964:
+	.string	"render_flush"
+.LASF880:
+	.string	"VA_QUOTE_kk 5"
+.LASF543:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF746:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF690:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF890:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF948:
+	.string	"va_span_t"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF906:
+	.string	"short unsigned int"
+.LASF887:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF497:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF465:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF521:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF800:
+	.string	"VA_STREAM_VEC32_STAGE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF486:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF973:
+	.string	"va_vec_span"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF547:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF928:
+	.string	"va_stream_t"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF479:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF456:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF913:
+	.string	"signed char"
+.LASF789:
+	.string	"va_arena_chunk_size 4096"
+.LASF635:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF467:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF743:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF650:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF514:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF786:
+	.string	"va_vec32_encode utf32"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF666:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF787:
+	.string	"va_asprintf_init_size 16"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF780:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF423:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF464:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF985:
+	.string	"va_stream_set_full"
+.LASF982:
+	.string	"grow"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF772:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF988:
+	.string	"va_arena_chunk"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF826:
+	.string	"va_aeprintf(...) va_aexprintf(va_alloc, __VA_ARGS__)"
+.LASF878:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF942:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF508:
+	.string	"__restrict_arr __restrict"
+.LASF532:
+	.string	"__stub___compat_bdflush "
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF965:
+	.string	"table"
+.LASF767:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF875:
+	.string	"VA_QUOTE_NONE 0"
+.LASF677:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF445:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF487:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF798:
+	.string	"VA_STREAM_VEC16_ARENA(A) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF899:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF808:
+	.string	"va_Uaexprintf(alloc,...) VA_BLOCK_EXPR( char32_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC32_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF563:
+	.string	"__need_size_t "
+.LASF638:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF660:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF520:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF970:
+	.string	"span"
+.LASF505:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF425:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF766:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF399:
+	.string	"__USE_XOPEN2K"
+.LASF692:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF400:
+	.string	"__USE_XOPEN2KXSI"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF503:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF845:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF432:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF952:
+	.string	"chunk_size"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF972:
+	.string	"va_vec_shrink"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF394:
+	.string	"__USE_POSIX199309"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF734:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF450:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF398:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF415:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF696:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF540:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF691:
+	.string	"_BITS_TIME64_H 1"
+.LASF654:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF619:
+	.string	"__INT_WCHAR_T_H "
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF639:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF986:
+	.string	"va_stream_set_error"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF684:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF720:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF507:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF719:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF978:
+	.string	"need"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF537:
+	.string	"__stub_setlogin "
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF686:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF676:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF841:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF869:
+	.string	"VA_STATE_INIT 0"
+.LASF712:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF628:
+	.string	"bool _Bool"
+.LASF939:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF614:
+	.string	"_BSD_WCHAR_T_ "
+.LASF960:
+	.string	"delim"
+.LASF721:
+	.string	"VA_REC0() VA_REC0B"
+.LASF765:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF485:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF695:
+	.string	"____mbstate_t_defined 1"
+.LASF949:
+	.string	"va_arena_chunk_t"
+.LASF801:
+	.string	"VA_STREAM_VEC32_INLINE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF935:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF847:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF665:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF974:
+	.string	"va_vec_reserve"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF585:
+	.string	"NULL ((void *)0)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF764:
+	.string	"VA_SIGIL '~'"
+.LASF495:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF586:
+	.string	"__need_NULL"
+.LASF930:
+	.string	"va_stream"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF433:
+	.string	"__USE_POSIX199506 1"
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF436:
+	.string	"_ATFILE_SOURCE"
+.LASF644:
+	.string	"__SLONG32_TYPE int"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF548:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF715:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF846:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF943:
+	.string	"va_stream_vtab_t"
+.LASF440:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF750:
+	.string	"VA_E_ENCODE 3"
+.LASF592:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF748:
+	.string	"VA_E_NULL 1"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF989:
+	.string	"resize"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF667:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF751:
+	.string	"VA_E_TRUNC 4"
+.LASF633:
+	.string	"_BITS_TYPES_H 1"
+.LASF458:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF958:
+	.string	"va_stream_vec_t"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF426:
+	.string	"_POSIX_SOURCE"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF834:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF424:
+	.string	"__USE_ISOC95 1"
+.LASF524:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF536:
+	.string	"__stub_revoke "
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF791:
+	.string	"VA_STREAM_VEC(M) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF779:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF477:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF824:
+	.string	"va_uasprintf(...) va_uaxprintf(va_alloc, __VA_ARGS__)"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF838:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF459:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF564:
+	.string	"__need_NULL "
+.LASF387:
+	.string	"_FEATURES_H 1"
+.LASF420:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF811:
+	.string	"va_Ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC32_INLINE(alloc, B), __VA_ARGS__))"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF933:
+	.string	"qctxt"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF515:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF403:
+	.string	"__USE_LARGEFILE"
+.LASF489:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF851:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF649:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF827:
+	.string	"va_uaeprintf(...) va_uaexprintf(va_alloc, __VA_ARGS__)"
+.LASF602:
+	.string	"___int_ptrdiff_t_h "
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF697:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF794:
+	.string	"VA_STREAM_VEC_ARENA(A) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF597:
+	.string	"_T_PTRDIFF_ "
+.LASF835:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF854:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF407:
+	.string	"__USE_ATFILE"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF861:
+	.string	"VA_MODE_B32 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF917:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF685:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF610:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF517:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF393:
+	.string	"__USE_POSIX2"
+.LASF775:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF583:
+	.string	"__need_size_t"
+.LASF876:
+	.string	"VA_QUOTE_k 1"
+.LASF542:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF894:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF768:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"VA_E_FORMAT 5"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF531:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF931:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF622:
+	.string	"__DEFINED_wchar_t "
+.LASF936:
+	.string	"va_quotations"
+.LASF795:
+	.string	"VA_STREAM_VEC16(M) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF884:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF783:
+	.string	"VA_PRINT_MALLOC_UTF16_H_ "
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF740:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF512:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF850:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF612:
+	.string	"__WCHAR_T "
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF889:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF462:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF830:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF493:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF596:
+	.string	"_PTRDIFF_T "
+.LASF511:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF937:
+	.string	"init"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF453:
+	.string	"__PMT"
+.LASF707:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF863:
+	.string	"VA_MODE_PTR 3"
+.LASF646:
+	.string	"__S64_TYPE long int"
+.LASF671:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF920:
+	.string	"has_size"
+.LASF731:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF640:
+	.string	"__SQUAD_TYPE long int"
+.LASF710:
+	.string	"VA_P(X,...) X"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF410:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF528:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF595:
+	.string	"_ANSI_STDDEF_H "
+.LASF713:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF825:
+	.string	"va_Uasprintf(...) va_Uaxprintf(va_alloc, __VA_ARGS__)"
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF953:
+	.string	"alloc"
+.LASF523:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF837:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF472:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF912:
+	.string	"unsigned int"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF817:
+	.string	"va_arena_printf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC_ARENA(A), __VA_ARGS__)->data)"
+.LASF771:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF454:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF984:
+	.string	"nmemb"
+.LASF406:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF627:
+	.string	"_STDBOOL_H "
+.LASF621:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF434:
+	.string	"__USE_XOPEN2K 1"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF770:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF678:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF637:
+	.string	"__U32_TYPE unsigned int"
+.LASF844:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF598:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF484:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF723:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF488:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF784:
+	.string	"va_vec16_encode utf16"
+.LASF510:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF535:
+	.string	"__stub_gtty "
+.LASF608:
+	.string	"__WCHAR_T__ "
+.LASF828:
+	.string	"va_Uaeprintf(...) va_Uaexprintf(va_alloc, __VA_ARGS__)"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF674:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF929:
+	.string	"va_read_iter"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF651:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF499:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF924:
+	.string	"vtab"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF630:
+	.string	"false 0"
+.LASF873:
+	.string	"VA_STATE_SKIP 4"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF781:
+	.string	"VA_PRINT_MALLOC_UTF8_H_ "
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF629:
+	.string	"true 1"
+.LASF604:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF413:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF689:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF448:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF653:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF864:
+	.string	"VA_MODE_TYPE 4"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF662:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF831:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF460:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF516:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF466:
+	.string	"__STRING(x) #x"
+.LASF911:
+	.string	"unsigned char"
+.LASF513:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF687:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF609:
+	.string	"_WCHAR_T "
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF724:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF603:
+	.string	"_GCC_PTRDIFF_T "
+.LASF386:
+	.string	"_ASSERT_H 1"
+.LASF907:
+	.string	"char"
+.LASF461:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF522:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF803:
+	.string	"va_axprintf(alloc,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC(alloc), __VA_ARGS__)->data)"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF617:
+	.string	"_WCHAR_T_H "
+.LASF812:
+	.string	"va_bprintf(B,...) va_bxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF944:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF910:
+	.string	"long double"
+.LASF955:
+	.string	"stage"
+.LASF481:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF983:
+	.string	"vec_alloc"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF975:
+	.string	"va_vec_clear"
+.LASF594:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF718:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF705:
+	.string	"VA_PAR ()"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF390:
+	.string	"__USE_ISOC95"
+.LASF717:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF389:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF397:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF501:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF756:
+	.string	"va_char_p_format utf8"
+.LASF902:
+	.string	"VA_QCLASS_CALL 2"
+.LASF468:
+	.string	"__BEGIN_DECLS "
+.LASF714:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF620:
+	.string	"_GCC_WCHAR_T "
+.LASF893:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF858:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF496:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF736:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF981:
+	.string	"va_vec_init"
+.LASF785:
+	.string	"VA_PRINT_MALLOC_UTF32_H_ "
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF885:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF669:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF946:
+	.string	"size"
+.LASF728:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF860:
+	.string	"VA_MODE_NORM 0"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF966:
+	.string	"long long unsigned int"
+.LASF870:
+	.string	"VA_STATE_ARG 1"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF391:
+	.string	"__USE_ISOCXX11"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF792:
+	.string	"VA_STREAM_VEC_STAGE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF788:
+	.string	"va_asprintf_stage_size 512"
+.LASF527:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF599:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF877:
+	.string	"VA_QUOTE_q 2"
+.LASF816:
+	.string	"VA_ARENA(M) ((va_arena_t){ NULL, NULL, va_arena_chunk_size, (M) })"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF429:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF934:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF976:
+	.string	"va_vec_put"
+.LASF492:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF395:
+	.string	"__USE_POSIX199506"
+.LASF754:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF859:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF805:
+	.string	"va_Uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32(M), __VA_ARGS__)->data)"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF763:
+	.string	"va_char32_p_decode utf32"
+.LASF762:
+	.string	"va_char32_p_format utf32"
+.LASF927:
+	.string	"va_read_iter_t"
+.LASF438:
+	.string	"__WORDSIZE 64"
+.LASF616:
+	.string	"_WCHAR_T_DEFINED "
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF539:
+	.string	"__stub_stty "
+.LASF886:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF821:
+	.string	"va_utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec16(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), __VA_ARGS__)->data)"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF474:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF471:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF918:
+	.string	"bulk"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF761:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF732:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF839:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF611:
+	.string	"_T_WCHAR "
+.LASF806:
+	.string	"va_aexprintf(alloc,...) VA_BLOCK_EXPR( char va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF636:
+	.string	"__S32_TYPE int"
+.LASF760:
+	.string	"va_char16_p_decode utf16"
+.LASF759:
+	.string	"va_char16_p_format utf16"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF823:
+	.string	"va_asprintf(...) va_axprintf(va_alloc, __VA_ARGS__)"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF546:
+	.string	"_STRING_H 1"
+.LASF848:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF814:
+	.string	"va_Ubprintf(B,...) va_Ubxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF855:
+	.string	"VA_SIGN_NORM 0"
+.LASF443:
+	.string	"__USE_ATFILE 1"
+.LASF388:
+	.string	"__USE_ISOC11"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF829:
+	.string	"va_format_compile(X) va_format_xcompile(va_alloc, X)"
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF613:
+	.string	"_WCHAR_T_ "
+.LASF699:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF793:
+	.string	"VA_STREAM_VEC_INLINE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF545:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF729:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF941:
+	.string	"put_len"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF896:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF533:
+	.string	"__stub_chflags "
+.LASF626:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF409:
+	.string	"__USE_GNU"
+.LASF725:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF581:
+	.string	"_SIZET_ "
+.LASF680:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF778:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF735:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF882:
+	.string	"VA_QUOTE_QQ 7"
+.LASF526:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF919:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF961:
+	.string	"check_quote"
+.LASF673:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF969:
+	.string	"va_arena_alloc"
+.LASF504:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF871:
+	.string	"VA_STATE_WIDTH 2"
+.LASF494:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF898:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF437:
+	.string	"_ATFILE_SOURCE 1"
+.LASF469:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF442:
+	.string	"__USE_MISC 1"
+.LASF769:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF874:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF872:
+	.string	"VA_STATE_PREC 3"
+.LASF900:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF914:
+	.string	"short int"
+.LASF452:
+	.string	"_SYS_CDEFS_H 1"
+.LASF632:
+	.string	"_UCHAR_H 1"
+.LASF706:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF804:
+	.string	"va_uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16(M), __VA_ARGS__)->data)"
+.LASF418:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF963:
+	.string	"render_quote"
+.LASF722:
+	.string	"VA_REC1() VA_REC1B"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF482:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF457:
+	.string	"__LEAF , __leaf__"
+.LASF822:
+	.string	"va_Utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec32(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), __VA_ARGS__)->data)"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF957:
+	.string	"keep"
+.LASF519:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF641:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF606:
+	.string	"__need_ptrdiff_t"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF530:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF679:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF480:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF921:
+	.string	"chunk_mode"
+.LASF658:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF483:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF642:
+	.string	"__SWORD_TYPE long int"
+.LASF799:
+	.string	"VA_STREAM_VEC32(M) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF945:
+	.string	"va_span"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF923:
+	.string	"_pad"
+.LASF491:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF655:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF430:
+	.string	"__USE_POSIX 1"
+.LASF647:
+	.string	"__U64_TYPE unsigned long int"
+.LASF529:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF709:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF832:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF940:
+	.string	"put_fill"
+.LASF634:
+	.string	"__S16_TYPE short int"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF852:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF498:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF502:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF862:
+	.string	"VA_MODE_CHAR 2"
+.LASF807:
+	.string	"va_uaexprintf(alloc,...) VA_BLOCK_EXPR( char16_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC16_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF618:
+	.string	"___int_wchar_t_h "
+.LASF968:
+	.string	"memcpy"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF802:
+	.string	"VA_STREAM_VEC32_ARENA(A) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF518:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF672:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF506:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF663:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF711:
+	.string	"VA_F(...) VA_H"
+.LASF810:
+	.string	"va_ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC16_INLINE(alloc, B), __VA_ARGS__))"
+.LASF419:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF865:
+	.string	"VA_MODE_STAT 5"
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF702:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF698:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF623:
+	.string	"_BSD_WCHAR_T_"
+.LASF843:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF909:
+	.string	"long long int"
+.LASF866:
+	.string	"VA_MODE_X6 6"
+.LASF733:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF892:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF652:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF694:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF470:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF350:
+	.string	"__amd64 1"
+.LASF427:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF431:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF664:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF525:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF926:
+	.string	"va_read_iter_vtab_t"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF656:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF820:
+	.string	"va_tprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), __VA_ARGS__)->data)"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF657:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF891:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF739:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF455:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF377:
+	.string	"unix 1"
+.LASF922:
+	.string	"str_prefix"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF607:
+	.string	"__wchar_t__ "
+.LASF967:
+	.string	"va_quotation_t"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF444:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF631:
+	.string	"__bool_true_false_are_defined 1"
+.LASF796:
+	.string	"VA_STREAM_VEC16_STAGE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF683:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF700:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF590:
+	.string	"VA_PRINT_MALLOC_H_ "
+.LASF605:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF475:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF856:
+	.string	"VA_SIGN_SPACE 1"
+.LASF883:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF868:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF659:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF411:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF747:
+	.string	"VA_E_OK 0"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF797:
+	.string	"VA_STREAM_VEC16_INLINE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF404:
+	.string	"__USE_LARGEFILE64"
+.LASF903:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF588:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF932:
+	.string	"prec"
+.LASF372:
+	.string	"__linux 1"
+.LASF615:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF947:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF589:
+	.string	"_STRINGS_H 1"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF753:
+	.string	"VA_E_ARGC 6"
+.LASF688:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF990:
+	.string	"commit"
+.LASF544:
+	.string	"static_assert"
+.LASF428:
+	.string	"_POSIX_C_SOURCE"
+.LASF727:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF682:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF853:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF881:
+	.string	"VA_QUOTE_qq 6"
+.LASF905:
+	.string	"long unsigned int"
+.LASF836:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF509:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF979:
+	.string	"va_vec_finish"
+.LASF951:
+	.string	"last"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,3784 @@
+# 0 "src/alloc_arena.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 201710L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE_SIZE__ 1
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "src/alloc_arena.c"
+
+
+
+# 1 "/usr/include/assert.h" 1 3 4
+# 34 "/usr/include/assert.h" 3 4
+#define _ASSERT_H 1
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+
+
+
+
+
+#define __USE_ISOC11 1
+
+
+
+
+
+
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+
+
+
+
+
+
+
+#define __GLIBC_USE_DEPRECATED_GETS 0
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 36 "/usr/include/assert.h" 2 3 4
+
+
+
+
+#define __ASSERT_VOID_CAST (void)
+# 65 "/usr/include/assert.h" 3 4
+#define _ASSERT_H_DECLS 
+
+
+
+
+# 69 "/usr/include/assert.h" 3 4
+extern void __assert_fail (const char *__assertion, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+# 107 "/usr/include/assert.h" 3 4
+#define assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))
+# 129 "/usr/include/assert.h" 3 4
+#define __ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__
+# 142 "/usr/include/assert.h" 3 4
+#undef static_assert
+#define static_assert _Static_assert
+# 5 "src/alloc_arena.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+
+
+
+
+#define _GCC_MAX_ALIGN_T 
+
+
+
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 6 "src/alloc_arena.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 7 "src/alloc_arena.c" 2
+# 1 "./include/va_print/alloc.h" 1
+# 14 "./include/va_print/alloc.h"
+#define VA_PRINT_MALLOC_H_ 
+
+# 1 "./include/va_print/core.h" 1
+# 12 "./include/va_print/core.h"
+#define VA_PRINT_CORE_H_ 
+
+# 1 "./include/va_print/base.h" 1
+# 12 "./include/va_print/base.h"
+#define VA_PRINT_BASE_H_ 
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 15 "./include/va_print/base.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 16 "./include/va_print/base.h" 2
+# 1 "/usr/include/uchar.h" 1 3 4
+# 24 "/usr/include/uchar.h" 3 4
+#define _UCHAR_H 1
+
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 30 "/usr/include/uchar.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 32 "/usr/include/uchar.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h" 1 3 4
+
+#define __mbstate_t_defined 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+
+#define ____mbstate_t_defined 1
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h" 2 3 4
+
+typedef __mbstate_t mbstate_t;
+# 33 "/usr/include/uchar.h" 2 3 4
+# 51 "/usr/include/uchar.h" 3 4
+typedef __uint_least16_t char16_t;
+typedef __uint_least32_t char32_t;
+
+
+
+
+# 74 "/usr/include/uchar.h" 3 4
+extern size_t mbrtoc16 (char16_t *__restrict __pc16,
+   const char *__restrict __s, size_t __n,
+   mbstate_t *__restrict __p) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t c16rtomb (char *__restrict __s, char16_t __c16,
+   mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern size_t mbrtoc32 (char32_t *__restrict __pc32,
+   const char *__restrict __s, size_t __n,
+   mbstate_t *__restrict __p) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t c32rtomb (char *__restrict __s, char32_t __c32,
+   mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 17 "./include/va_print/base.h" 2
+# 26 "./include/va_print/base.h"
+#define VA_CONCAT(A,B) VA_CONCAT1(A,B)
+#define VA_CONCAT1(A,B) VA_CONCAT2(A,B)
+#define VA_CONCAT2(A,B) A ## B
+
+#define VA_BLOCK_STMT(A) do{ A ;}while(0)
+#define VA_BLOCK_EXPR(A) __extension__({ A ;})
+
+
+#define VA_NIX 
+#define VA_EAT(...) 
+#define VA_ECHO(...) __VA_ARGS__
+#define VA_NOC(...) , ##__VA_ARGS__
+#define VA_PAR ()
+
+
+#define VA_EXP1(...) __VA_ARGS__
+#define VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))
+#define VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))
+#define VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))
+
+
+#define VA_P(X,...) X
+#define VA_F(...) VA_H
+
+
+#define VA_SUBVA_H(Z,N) Z
+#define VA_SUBVA_F(Z,N) N
+#define VA_OPT3(...) VA_P(__VA_ARGS__)
+#define VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)
+#define VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)
+#define VA_OPT0(...) __VA_ARGS__
+#define VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))
+
+
+#define VA_REC0B(F,A,...) A
+#define VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)
+#define VA_REC0() VA_REC0B
+#define VA_REC1() VA_REC1B
+#define VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)
+
+#define VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))
+
+
+
+
+#define VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })
+
+
+#define VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })
+
+
+
+
+
+
+
+#define VA_U_ENC 0x1f000000
+
+
+
+
+
+#define VA_U_DATA 0x00ffffff
+# 105 "./include/va_print/base.h"
+#define VA_U_EMORE (29,3U)
+
+
+
+
+
+
+#define VA_U_ECONT 0x80000000
+
+
+#define VA_U_ENC_ERR VA_U_ENC
+
+
+#define VA_U_ENC_UTF8 0x01000000
+
+
+#define VA_U_ENC_UTF16 0x02000000
+
+
+#define VA_U_ENC_UTF32 0x03000000
+
+
+#define VA_U_ENC_ISO88591 0x04000000
+
+
+
+
+
+
+#define VA_ENC_TAG(E) ((unsigned char)((E) >> 24))
+
+
+
+
+#define VA_U_REPLACEMENT 0xfffd
+
+
+#define VA_U_BOM 0xfeff
+
+
+#define VA_U_MAX 0x10ffff
+
+
+#define VA_U_MAXMAX VA_U_DATA
+
+
+#define VA_U_SURR_MIN 0xd800
+
+
+#define VA_U_SURR_MAX 0xdfff
+
+
+
+
+#define va_countof(A) (sizeof(A)/sizeof((A)[0]))
+# 173 "./include/va_print/base.h"
+#define va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = (_val); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })
+# 189 "./include/va_print/base.h"
+
+# 189 "./include/va_print/base.h"
+struct va_read_iter;
+
+
+
+typedef struct {
+
+
+    char const *type;
+# 211 "./include/va_print/base.h"
+    unsigned (*take)(struct va_read_iter *, void const *end);
+
+
+
+    void const *(*end)(struct va_read_iter *, size_t size);
+
+
+
+    void (*set_chunk_mode)(struct va_read_iter *);
+
+
+
+
+
+
+    size_t (*bulk)(
+        struct va_read_iter const *, void const *end, size_t max, size_t *cps);
+# 236 "./include/va_print/base.h"
+    size_t (*transcode)(
+        void *dst, unsigned char enc, void const *src, size_t n);
+
+
+
+    unsigned char has_size;
+
+
+
+    unsigned char chunk_mode;
+
+
+
+    unsigned char str_prefix;
+
+
+
+    unsigned char enc;
+
+    char _pad[sizeof(void*) - 4];
+} va_read_iter_vtab_t;
+# 269 "./include/va_print/base.h"
+#define VA_U_EOT -1U
+# 306 "./include/va_print/base.h"
+typedef struct va_read_iter {
+
+
+    va_read_iter_vtab_t const *vtab;
+
+
+    void const *cur;
+} va_read_iter_t;
+
+
+
+
+
+typedef struct {
+    va_read_iter_t super;
+    void const *end;
+} va_read_iter_end_t;
+
+struct va_format_lit;
+struct va_format_spec;
+# 337 "./include/va_print/base.h"
+typedef struct {
+
+
+    va_read_iter_vtab_t vtab;
+
+
+
+    void const *fmt;
+
+
+
+    struct va_format_lit const *lit;
+    size_t lit_cnt;
+
+
+
+    struct va_format_spec const *spec;
+    size_t spec_cnt;
+
+
+
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_format_t;
+
+typedef struct va_stream va_stream_t;
+
+
+typedef struct va_quotations va_quotations_t;
+
+
+
+
+
+
+
+typedef struct {
+
+    void (*init)(va_stream_t *);
+
+    void (*put)(va_stream_t *, unsigned c);
+
+
+    void (*finish)(va_stream_t *);
+
+
+
+
+
+
+    
+# 386 "./include/va_print/base.h" 3 4
+   _Bool 
+# 386 "./include/va_print/base.h"
+        (*refill)(va_stream_t *, size_t need);
+
+
+
+    void (*put_fill)(va_stream_t *, unsigned c, size_t count);
+
+
+
+
+
+    void (*put_len)(va_stream_t *, size_t count);
+
+
+
+
+    unsigned char enc;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vtab_t;
+
+
+
+
+
+
+typedef struct {
+    void *cur;
+    void *end;
+} va_window_t;
+# 439 "./include/va_print/base.h"
+struct va_stream {
+    va_stream_vtab_t const *vtab;
+    va_read_iter_t pat;
+    unsigned width;
+    unsigned prec;
+    unsigned opt;
+    unsigned qctxt;
+    va_window_t win;
+
+
+
+    va_quotations_t const *quote;
+};
+
+typedef struct va_print va_print_t;
+# 469 "./include/va_print/base.h"
+struct va_print {
+    void (*print) (va_stream_t *s, va_print_t *);
+    void const *value;
+    unsigned width;
+    unsigned prec;
+    unsigned opt;
+    unsigned _pad1;
+};
+
+
+
+
+#define VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })
+
+
+
+typedef struct va_span {
+    size_t size;
+    char const *data;
+} va_span_t;
+
+
+
+typedef struct va_span16 {
+    size_t size;
+    char16_t const *data;
+} va_span16_t;
+
+
+
+typedef struct va_span32 {
+    size_t size;
+    char32_t const *data;
+} va_span32_t;
+# 516 "./include/va_print/base.h"
+typedef struct {
+    unsigned code;
+} va_error_t;
+
+
+
+#define VA_E_OK 0
+
+
+
+#define VA_E_NULL 1
+
+
+
+#define VA_E_DECODE 2
+
+
+
+
+#define VA_E_ENCODE 3
+
+
+
+
+
+#define VA_E_TRUNC 4
+
+
+
+#define VA_E_FORMAT 5
+
+
+
+#define VA_E_ARGC 6
+
+
+
+#define VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)
+# 15 "./include/va_print/core.h" 2
+
+
+
+
+
+# 1 "./include/va_print/utf8.h" 1
+# 12 "./include/va_print/utf8.h"
+#define VA_PRINT_UTF8_H_ 
+# 23 "./include/va_print/utf8.h"
+extern va_read_iter_vtab_t const va_char_p_read_vtab_utf8;
+extern va_read_iter_vtab_t const va_span_p_read_vtab_utf8;
+extern va_read_iter_vtab_t const va_char_p_read_vtab_utf8_chunk;
+extern va_read_iter_vtab_t const va_span_p_read_vtab_utf8_chunk;
+# 52 "./include/va_print/utf8.h"
+extern unsigned va_char_p_take_utf8(
+    va_read_iter_t *i,
+    void const *end);
+
+
+
+
+extern unsigned va_span_p_take_utf8(
+    va_read_iter_t *,
+    void const *end);
+
+
+
+
+extern size_t va_char_p_bulk_utf8(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span_p_bulk_utf8(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+
+
+
+
+extern size_t va_char_p_transcode_utf8(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+# 105 "./include/va_print/utf8.h"
+extern void va_put_utf8(
+    va_stream_t *s,
+    unsigned c,
+    void (*put)(va_stream_t *, char));
+
+
+
+
+
+
+extern size_t va_len_utf8(
+    va_stream_t *,
+    unsigned);
+
+extern va_stream_t *va_xprintf_char_p_utf8(
+    va_stream_t *,
+    char const *x);
+
+extern va_stream_t *va_xprintf_char_const_pp_utf8(
+    va_stream_t *,
+    char const **);
+
+extern va_stream_t *va_xprintf_char_pp_utf8(
+    va_stream_t *,
+    char **);
+
+extern va_stream_t *va_xprintf_last_char_p_utf8(
+    va_stream_t *,
+    char const *x);
+
+extern va_stream_t *va_xprintf_last_char_const_pp_utf8(
+    va_stream_t *,
+    char const **);
+
+extern va_stream_t *va_xprintf_last_char_pp_utf8(
+    va_stream_t *,
+    char **);
+
+extern va_stream_t *va_xprintf_span_p_utf8(
+    va_stream_t *,
+    va_span_t const *);
+
+extern va_stream_t *va_xprintf_last_span_p_utf8(
+    va_stream_t *,
+    va_span_t const *);
+
+extern void va_char_p_set_chunk_mode(
+    va_read_iter_t *iter);
+
+extern void va_span_p_set_chunk_mode(
+    va_read_iter_t *iter);
+# 21 "./include/va_print/core.h" 2
+
+#define va_char_p_format utf8
+
+
+
+
+
+#define va_char_p_decode utf8
+
+
+
+# 1 "./include/va_print/utf16.h" 1
+# 12 "./include/va_print/utf16.h"
+#define VA_PRINT_UTF16_H_ 
+# 24 "./include/va_print/utf16.h"
+extern va_read_iter_vtab_t const va_char16_p_read_vtab_utf16;
+extern va_read_iter_vtab_t const va_span16_p_read_vtab_utf16;
+extern va_read_iter_vtab_t const va_char16_p_read_vtab_utf16_chunk;
+extern va_read_iter_vtab_t const va_span16_p_read_vtab_utf16_chunk;
+
+
+
+
+extern unsigned va_char16_p_take_utf16(
+    va_read_iter_t *,
+    void const *end);
+
+extern unsigned va_span16_p_take_utf16(
+    va_read_iter_t *,
+    void const *end);
+
+
+
+
+extern size_t va_char16_p_bulk_utf16(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span16_p_bulk_utf16(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+
+
+
+
+extern size_t va_char16_p_transcode_utf16(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+# 78 "./include/va_print/utf16.h"
+extern void va_put_utf16(
+    va_stream_t *,
+    unsigned,
+    void (*put)(va_stream_t *, char16_t));
+
+
+
+
+
+
+extern size_t va_len_utf16(
+    va_stream_t *,
+    unsigned);
+
+extern va_stream_t *va_xprintf_char16_p_utf16(
+    va_stream_t *,
+    char16_t const *);
+
+extern va_stream_t *va_xprintf_char16_const_pp_utf16(
+    va_stream_t *,
+    char16_t const **);
+
+extern va_stream_t *va_xprintf_char16_pp_utf16(
+    va_stream_t *,
+    char16_t **);
+
+extern va_stream_t *va_xprintf_last_char16_p_utf16(
+    va_stream_t *,
+    char16_t const *);
+
+extern va_stream_t *va_xprintf_last_char16_const_pp_utf16(
+    va_stream_t *,
+    char16_t const **);
+
+extern va_stream_t *va_xprintf_last_char16_pp_utf16(
+    va_stream_t *,
+    char16_t **);
+
+extern va_stream_t *va_xprintf_span16_p_utf16(
+    va_stream_t *,
+    va_span16_t const *);
+
+extern va_stream_t *va_xprintf_last_span16_p_utf16(
+    va_stream_t *,
+    va_span16_t const *);
+
+extern void va_char16_p_set_chunk_mode(
+    va_read_iter_t *iter);
+
+extern void va_span16_p_set_chunk_mode(
+    va_read_iter_t *iter);
+# 33 "./include/va_print/core.h" 2
+
+#define va_char16_p_format utf16
+
+
+
+
+
+#define va_char16_p_decode utf16
+
+
+
+# 1 "./include/va_print/utf32.h" 1
+# 12 "./include/va_print/utf32.h"
+#define VA_PRINT_UTF32_H_ 
+# 24 "./include/va_print/utf32.h"
+extern va_read_iter_vtab_t const va_char32_p_read_vtab_utf32;
+
+extern va_read_iter_vtab_t const va_span32_p_read_vtab_utf32;
+
+
+
+
+extern unsigned va_char32_p_take_utf32(
+    va_read_iter_t *,
+    void const *end);
+
+extern unsigned va_span32_p_take_utf32(
+    va_read_iter_t *,
+    void const *end);
+
+
+
+
+extern size_t va_char32_p_bulk_utf32(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span32_p_bulk_utf32(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+
+
+
+
+extern size_t va_char32_p_transcode_utf32(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+# 77 "./include/va_print/utf32.h"
+extern void va_put_utf32(
+    va_stream_t *,
+    unsigned,
+    void (*put)(va_stream_t *, char32_t));
+
+
+
+
+
+
+extern size_t va_len_utf32(
+    va_stream_t *,
+    unsigned);
+
+extern va_stream_t *va_xprintf_char32_p_utf32(
+    va_stream_t *,
+    char32_t const *);
+
+extern va_stream_t *va_xprintf_char32_const_pp_utf32(
+    va_stream_t *,
+    char32_t const **);
+
+extern va_stream_t *va_xprintf_char32_pp_utf32(
+    va_stream_t *,
+    char32_t **);
+
+extern va_stream_t *va_xprintf_last_char32_p_utf32(
+    va_stream_t *,
+    char32_t const *);
+
+extern va_stream_t *va_xprintf_last_char32_const_pp_utf32(
+    va_stream_t *,
+    char32_t const **);
+
+extern va_stream_t *va_xprintf_last_char32_pp_utf32(
+    va_stream_t *,
+    char32_t **);
+
+extern va_stream_t *va_xprintf_span32_p_utf32(
+    va_stream_t *,
+    va_span32_t const *);
+
+extern va_stream_t *va_xprintf_last_span32_p_utf32(
+    va_stream_t *,
+    va_span32_t const *);
+# 45 "./include/va_print/core.h" 2
+
+#define va_char32_p_format utf32
+
+
+
+
+
+#define va_char32_p_decode utf32
+
+
+
+
+#define VA_SIGIL '~'
+# 70 "./include/va_print/core.h"
+#define va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(fun ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_const_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,va_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_,va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,va_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(fun ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCAT(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t const *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bool:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulong, unsigned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)
+# 109 "./include/va_print/core.h"
+#define va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(va_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CONCAT(va_char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)
+# 132 "./include/va_print/core.h"
+#define va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))
+# 142 "./include/va_print/core.h"
+#define VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)
+# 169 "./include/va_print/core.h"
+#define va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))
+# 185 "./include/va_print/core.h"
+#define va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)
+# 203 "./include/va_print/core.h"
+#define va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))
+
+
+
+
+#define va_xformat(i,s,a) va_xformat ## i (s,a)
+#define va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)
+#define va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)
+
+#define va_xinit(i,arg) (va_xinit ## i arg)
+#define va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))
+
+
+
+#define va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)
+
+
+
+
+#define VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))
+
+
+
+
+
+
+
+#define va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))
+
+
+
+
+
+#define va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)
+
+
+
+
+extern va_read_iter_vtab_t const va_char_p_read_vtab_iso8859_1;
+
+
+
+extern va_read_iter_vtab_t const va_format_read_vtab;
+
+
+
+extern char const va_format_type[];
+
+
+
+
+extern va_stream_t *va_xprintf_schar(va_stream_t *, signed char x);
+extern va_stream_t *va_xprintf_short(va_stream_t *, short x);
+extern va_stream_t *va_xprintf_sint(va_stream_t *, int x);
+extern va_stream_t *va_xprintf_slong(va_stream_t *, long x);
+extern va_stream_t *va_xprintf_sll(va_stream_t *, long long x);
+
+extern va_stream_t *va_xprintf_uchar(va_stream_t *, unsigned char x);
+extern va_stream_t *va_xprintf_ushort(va_stream_t *, unsigned short x);
+extern va_stream_t *va_xprintf_bool(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_uint(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_ulong(va_stream_t *, unsigned long x);
+extern va_stream_t *va_xprintf_ull(va_stream_t *, unsigned long long x);
+
+extern va_stream_t *va_xprintf_ptr(va_stream_t *, void const *);
+extern va_stream_t *va_xprintf_char(va_stream_t *, char x);
+extern va_stream_t *va_xprintf_error_t_p(va_stream_t *, va_error_t *x);
+
+extern va_stream_t *va_xprintf_iter_chunk(va_stream_t *, va_read_iter_t *);
+extern va_stream_t *va_xprintf_iter(va_stream_t *, va_read_iter_t *);
+
+extern va_stream_t *va_xprintf_iter_local(va_stream_t *, va_read_iter_t *);
+extern va_stream_t *va_xprintf_custom(va_stream_t *, va_print_t *);
+
+extern va_stream_t *va_xprintf_last_schar(va_stream_t *, signed char x);
+extern va_stream_t *va_xprintf_last_short(va_stream_t *, short x);
+extern va_stream_t *va_xprintf_last_sint(va_stream_t *, int x);
+extern va_stream_t *va_xprintf_last_slong(va_stream_t *, long x);
+extern va_stream_t *va_xprintf_last_sll(va_stream_t *, long long x);
+
+extern va_stream_t *va_xprintf_last_uchar(va_stream_t *, unsigned char x);
+extern va_stream_t *va_xprintf_last_ushort(va_stream_t *, unsigned short x);
+extern va_stream_t *va_xprintf_last_bool(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_last_uint(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_last_ulong(va_stream_t *, unsigned long x);
+extern va_stream_t *va_xprintf_last_ull(va_stream_t *, unsigned long long x);
+
+extern va_stream_t *va_xprintf_last_ptr(va_stream_t *, void const *);
+extern va_stream_t *va_xprintf_last_char(va_stream_t *, char x);
+extern va_stream_t *va_xprintf_last_error_t_p(va_stream_t *, va_error_t *x);
+
+extern va_stream_t *va_xprintf_last_iter_chunk(va_stream_t *, va_read_iter_t *);
+extern va_stream_t *va_xprintf_last_custom(va_stream_t *, va_print_t *);
+
+
+
+static inline va_stream_t *va_xprintf_init(
+    va_stream_t *s,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab)
+{
+    s->pat = ((va_read_iter_t){ (get_vtab),(x) });
+    return s;
+}
+# 317 "./include/va_print/core.h"
+extern va_stream_t *va_xprintf_init_last(
+    va_stream_t *,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+
+
+
+
+extern va_stream_t *va_xprintf_init_last_plain(
+    va_stream_t *,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+
+
+
+
+
+__attribute__((always_inline))
+static inline 
+# 337 "./include/va_print/core.h" 3 4
+             _Bool 
+# 337 "./include/va_print/core.h"
+                  va_format_plain_f(void const *x, size_t n)
+{
+    return __builtin_constant_p(__builtin_memchr(x, '~', n) == 
+# 339 "./include/va_print/core.h" 3 4
+                                                                   ((void *)0)
+# 339 "./include/va_print/core.h"
+                                                                       ) &&
+        (__builtin_memchr(x, '~', n) == 
+# 340 "./include/va_print/core.h" 3 4
+                                            ((void *)0)
+# 340 "./include/va_print/core.h"
+                                                );
+}
+
+
+
+
+
+
+extern unsigned va_stream_get_error_f(va_stream_t const *s);
+
+
+
+
+
+extern char const *va_strerror(unsigned);
+
+
+
+
+
+
+extern va_format_t *va_format_compile_f(
+    void *(*alloc)(void *, size_t nmemb, size_t size),
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+
+
+
+
+extern void va_format_free(va_format_t *);
+# 17 "./include/va_print/alloc.h" 2
+
+
+
+
+
+# 1 "./include/va_print/alloc_utf8.h" 1
+# 14 "./include/va_print/alloc_utf8.h"
+#define VA_PRINT_MALLOC_UTF8_H_ 
+# 25 "./include/va_print/alloc_utf8.h"
+extern va_stream_vtab_t const va_vec_vtab_utf8;
+# 23 "./include/va_print/alloc.h" 2
+
+#define va_vec_encode utf8
+
+
+
+# 1 "./include/va_print/alloc_utf16.h" 1
+# 14 "./include/va_print/alloc_utf16.h"
+#define VA_PRINT_MALLOC_UTF16_H_ 
+# 25 "./include/va_print/alloc_utf16.h"
+extern va_stream_vtab_t const va_vec16_vtab_utf16;
+# 29 "./include/va_print/alloc.h" 2
+
+#define va_vec16_encode utf16
+
+
+
+# 1 "./include/va_print/alloc_utf32.h" 1
+# 14 "./include/va_print/alloc_utf32.h"
+#define VA_PRINT_MALLOC_UTF32_H_ 
+# 25 "./include/va_print/alloc_utf32.h"
+extern va_stream_vtab_t const va_vec32_vtab_utf32;
+# 35 "./include/va_print/alloc.h" 2
+
+#define va_vec32_encode utf32
+
+
+
+
+#define va_asprintf_init_size 16
+
+
+
+
+#define va_asprintf_stage_size 512
+
+
+
+
+#define va_arena_chunk_size 4096
+
+
+
+
+
+#define va_tprintf_slots 4
+# 69 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC(M) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC_STAGE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })
+# 86 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC_INLINE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC_ARENA(A) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_VEC16(M) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC16_STAGE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })
+# 118 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC16_INLINE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC16_ARENA(A) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_VEC32(M) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC32_STAGE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })
+# 150 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC32_INLINE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC32_ARENA(A) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
+# 191 "./include/va_print/alloc.h"
+#define va_axprintf(alloc,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC(alloc), __VA_ARGS__)->data)
+# 207 "./include/va_print/alloc.h"
+#define va_uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16(M), __VA_ARGS__)->data)
+# 223 "./include/va_print/alloc.h"
+#define va_Uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32(M), __VA_ARGS__)->data)
+# 238 "./include/va_print/alloc.h"
+#define va_aexprintf(alloc,...) VA_BLOCK_EXPR( char va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_uaexprintf(alloc,...) VA_BLOCK_EXPR( char16_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC16_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_Uaexprintf(alloc,...) VA_BLOCK_EXPR( char32_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC32_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+# 271 "./include/va_print/alloc.h"
+#define va_bxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC_INLINE(alloc, B), __VA_ARGS__))
+
+
+
+
+
+#define va_ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC16_INLINE(alloc, B), __VA_ARGS__))
+
+
+
+
+
+#define va_Ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC32_INLINE(alloc, B), __VA_ARGS__))
+
+
+
+
+
+#define va_bprintf(B,...) va_bxprintf(va_alloc, B, __VA_ARGS__)
+
+
+
+
+#define va_ubprintf(B,...) va_ubxprintf(va_alloc, B, __VA_ARGS__)
+
+
+
+
+#define va_Ubprintf(B,...) va_Ubxprintf(va_alloc, B, __VA_ARGS__)
+
+
+
+
+
+
+#define va_vec_is_inline(T) (((T)->data != NULL) && ((T)->data == (T)->stage))
+
+
+
+
+
+
+#define VA_ARENA(M) ((va_arena_t){ NULL, NULL, va_arena_chunk_size, (M) })
+# 327 "./include/va_print/alloc.h"
+#define va_arena_printf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC_ARENA(A), __VA_ARGS__)->data)
+
+
+
+
+
+#define va_arena_uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16_ARENA(A), __VA_ARGS__)->data)
+
+
+
+
+
+#define va_arena_Uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32_ARENA(A), __VA_ARGS__)->data)
+# 357 "./include/va_print/alloc.h"
+#define va_tprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec16(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_Utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec32(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_asprintf(...) va_axprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_uasprintf(...) va_uaxprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_Uasprintf(...) va_Uaxprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_aeprintf(...) va_aexprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_uaeprintf(...) va_uaexprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_Uaeprintf(...) va_Uaexprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_format_compile(X) va_format_xcompile(va_alloc, X)
+
+
+
+
+typedef struct va_arena_chunk va_arena_chunk_t;
+# 431 "./include/va_print/alloc.h"
+typedef struct {
+
+    va_arena_chunk_t *chunk;
+
+    void *last;
+
+    size_t chunk_size;
+
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_arena_t;
+
+typedef struct {
+    va_stream_t s;
+    char *data;
+    size_t size;
+    size_t pos;
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+    char *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vec_t;
+
+typedef struct {
+    va_stream_t s;
+    char16_t *data;
+    size_t size;
+    size_t pos;
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+    char16_t *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vec16_t;
+
+typedef struct {
+    va_stream_t s;
+    char32_t *data;
+    size_t size;
+    size_t pos;
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+    char32_t *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vec32_t;
+
+
+
+
+extern void va_vec_init(
+    va_stream_t *);
+
+extern void va_vec_finish(
+    va_stream_t *);
+
+extern 
+# 487 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 487 "./include/va_print/alloc.h"
+           va_vec_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_vec_put(
+    va_stream_t *,
+    char);
+
+extern void va_vec16_init(
+    va_stream_t *);
+
+extern void va_vec16_finish(
+    va_stream_t *);
+
+extern 
+# 501 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 501 "./include/va_print/alloc.h"
+           va_vec16_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_vec16_put(
+    va_stream_t *,
+    char16_t);
+
+extern void va_vec32_init(
+    va_stream_t *);
+
+extern void va_vec32_finish(
+    va_stream_t *);
+
+extern 
+# 515 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 515 "./include/va_print/alloc.h"
+           va_vec32_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_vec32_put(
+    va_stream_t *,
+    char32_t);
+# 549 "./include/va_print/alloc.h"
+extern void va_vec_clear(
+    va_stream_vec_t *);
+
+extern 
+# 552 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 552 "./include/va_print/alloc.h"
+           va_vec_reserve(
+    va_stream_vec_t *,
+    size_t n);
+
+extern void va_vec_shrink(
+    va_stream_vec_t *,
+    size_t n);
+
+extern va_span_t *va_vec_span(
+    va_stream_vec_t *,
+    va_span_t *span);
+
+extern void va_vec_free(
+    va_stream_vec_t *);
+
+extern void va_vec16_clear(
+    va_stream_vec16_t *);
+
+extern 
+# 570 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 570 "./include/va_print/alloc.h"
+           va_vec16_reserve(
+    va_stream_vec16_t *,
+    size_t n);
+
+extern void va_vec16_shrink(
+    va_stream_vec16_t *,
+    size_t n);
+
+extern va_span16_t *va_vec16_span(
+    va_stream_vec16_t *,
+    va_span16_t *span);
+
+extern void va_vec16_free(
+    va_stream_vec16_t *);
+
+extern void va_vec32_clear(
+    va_stream_vec32_t *);
+
+extern 
+# 588 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 588 "./include/va_print/alloc.h"
+           va_vec32_reserve(
+    va_stream_vec32_t *,
+    size_t n);
+
+extern void va_vec32_shrink(
+    va_stream_vec32_t *,
+    size_t n);
+
+extern va_span32_t *va_vec32_span(
+    va_stream_vec32_t *,
+    va_span32_t *span);
+
+extern void va_vec32_free(
+    va_stream_vec32_t *);
+# 611 "./include/va_print/alloc.h"
+extern va_stream_vec_t *va_tmp_vec(
+    va_stream_vtab_t const *vtab);
+
+
+
+
+
+extern va_stream_vec16_t *va_tmp_vec16(
+    va_stream_vtab_t const *vtab);
+
+
+
+
+
+extern va_stream_vec32_t *va_tmp_vec32(
+    va_stream_vtab_t const *vtab);
+
+
+
+
+
+
+
+extern void va_tprintf_free(void);
+# 652 "./include/va_print/alloc.h"
+extern void *va_alloc(
+    void *data,
+    size_t nmemb,
+    size_t size);
+
+
+
+
+
+
+
+extern void *va_arena_alloc(
+    va_arena_t *arena,
+    void *data,
+    size_t nmemb,
+    size_t size);
+
+
+
+
+
+extern void va_arena_reset(
+    va_arena_t *arena);
+
+
+
+
+
+extern void va_arena_free(
+    va_arena_t *arena);
+# 8 "src/alloc_arena.c" 2
+# 17 "src/alloc_arena.c"
+#define ALIGN ((size_t)_Alignof(max_align_t))
+#define ALIGN_UP(N) ((((N) + ALIGN - 1) / ALIGN) * ALIGN)
+#define HEAD ALIGN_UP(sizeof(size_t))
+#define CHUNK_HEAD ALIGN_UP(sizeof(va_arena_chunk_t))
+
+
+
+
+struct va_arena_chunk {
+    va_arena_chunk_t *next;
+    size_t size;
+    size_t used;
+};
+
+
+
+
+static char *chunk_data(va_arena_chunk_t *c)
+{
+    return (char*)c + ((((sizeof(va_arena_chunk_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t)));
+}
+
+static size_t *head(void *data)
+{
+    return (size_t*)((char*)data - ((((sizeof(size_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t))));
+}
+
+
+
+
+static size_t block_size(size_t n)
+{
+    if (n > (-(size_t)1 - ((((sizeof(size_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t))) - ((size_t)_Alignof(max_align_t)))) {
+        return 0;
+    }
+    return ((((sizeof(size_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t))) + ((((n) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t)));
+}
+
+static void *take(va_arena_t *a, size_t n)
+{
+    size_t need = block_size(n);
+    if (need == 0) {
+        return 
+# 59 "src/alloc_arena.c" 3 4
+              ((void *)0)
+# 59 "src/alloc_arena.c"
+                  ;
+    }
+    va_arena_chunk_t *c = a->chunk;
+    if ((c == 
+# 62 "src/alloc_arena.c" 3 4
+             ((void *)0)
+# 62 "src/alloc_arena.c"
+                 ) || ((c->size - c->used) < need)) {
+        size_t size = (need < a->chunk_size) ? a->chunk_size : need;
+        size = ((((size) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t)));
+        if (size > (-(size_t)1 - ((((sizeof(va_arena_chunk_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t))))) {
+            return 
+# 66 "src/alloc_arena.c" 3 4
+                  ((void *)0)
+# 66 "src/alloc_arena.c"
+                      ;
+        }
+        c = a->alloc(
+# 68 "src/alloc_arena.c" 3 4
+                    ((void *)0)
+# 68 "src/alloc_arena.c"
+                        , ((((sizeof(va_arena_chunk_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t))) + size, 1);
+        if (c == 
+# 69 "src/alloc_arena.c" 3 4
+                ((void *)0)
+# 69 "src/alloc_arena.c"
+                    ) {
+            return 
+# 70 "src/alloc_arena.c" 3 4
+                  ((void *)0)
+# 70 "src/alloc_arena.c"
+                      ;
+        }
+        c->next = a->chunk;
+        c->size = size;
+        c->used = 0;
+        a->chunk = c;
+    }
+    char *p = chunk_data(c) + c->used;
+    c->used += need;
+    a->last = p + ((((sizeof(size_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t)));
+    *head(a->last) = n;
+    return a->last;
+}
+
+
+
+
+extern void *va_arena_alloc(
+    va_arena_t *a,
+    void *data,
+    size_t nmemb,
+    size_t size)
+{
+    
+# 93 "src/alloc_arena.c" 3 4
+   ((void) sizeof ((
+# 93 "src/alloc_arena.c"
+   size != 0
+# 93 "src/alloc_arena.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 93 "src/alloc_arena.c"
+   size != 0
+# 93 "src/alloc_arena.c" 3 4
+   ) ; else __assert_fail (
+# 93 "src/alloc_arena.c"
+   "size != 0"
+# 93 "src/alloc_arena.c" 3 4
+   , "src/alloc_arena.c", 93, __extension__ __PRETTY_FUNCTION__); }))
+# 93 "src/alloc_arena.c"
+                    ;
+    if (nmemb == 0) {
+
+        if ((data != 
+# 96 "src/alloc_arena.c" 3 4
+                    ((void *)0)
+# 96 "src/alloc_arena.c"
+                        ) && (data == a->last)) {
+            a->chunk->used -= block_size(*head(data));
+            a->last = 
+# 98 "src/alloc_arena.c" 3 4
+                     ((void *)0)
+# 98 "src/alloc_arena.c"
+                         ;
+        }
+        return 
+# 100 "src/alloc_arena.c" 3 4
+              ((void *)0)
+# 100 "src/alloc_arena.c"
+                  ;
+    }
+
+    size_t n;
+    if (__builtin_mul_overflow(nmemb, size, &n)) {
+        return 
+# 105 "src/alloc_arena.c" 3 4
+              ((void *)0)
+# 105 "src/alloc_arena.c"
+                  ;
+    }
+    if (data == 
+# 107 "src/alloc_arena.c" 3 4
+               ((void *)0)
+# 107 "src/alloc_arena.c"
+                   ) {
+        return take(a, n);
+    }
+
+    size_t old = *head(data);
+    if (data == a->last) {
+
+        va_arena_chunk_t *c = a->chunk;
+        size_t off = (size_t)((char*)data - chunk_data(c));
+        if (n <= (c->size - off)) {
+            c->used = off - ((((sizeof(size_t)) + ((size_t)_Alignof(max_align_t)) - 1) / ((size_t)_Alignof(max_align_t))) * ((size_t)_Alignof(max_align_t))) + block_size(n);
+            *head(data) = n;
+            return data;
+        }
+    }
+    else if (n <= old) {
+        return data;
+    }
+
+    void *new_data = take(a, n);
+    if (new_data != 
+# 127 "src/alloc_arena.c" 3 4
+                   ((void *)0)
+# 127 "src/alloc_arena.c"
+                       ) {
+        memcpy(new_data, data, (old < n) ? old : n);
+    }
+    return new_data;
+}
+
+extern void va_arena_reset(
+    va_arena_t *a)
+{
+    va_arena_chunk_t *c = a->chunk;
+    if (c == 
+# 137 "src/alloc_arena.c" 3 4
+            ((void *)0)
+# 137 "src/alloc_arena.c"
+                ) {
+        return;
+    }
+    while (c->next != 
+# 140 "src/alloc_arena.c" 3 4
+                     ((void *)0)
+# 140 "src/alloc_arena.c"
+                         ) {
+        va_arena_chunk_t *next = c->next->next;
+        (void)a->alloc(c->next, 0, 1);
+        c->next = next;
+    }
+    c->used = 0;
+    a->last = 
+# 146 "src/alloc_arena.c" 3 4
+             ((void *)0)
+# 146 "src/alloc_arena.c"
+                 ;
+}
+
+extern void va_arena_free(
+    va_arena_t *a)
+{
+    va_arena_chunk_t *c = a->chunk;
+    while (c != 
+# 153 "src/alloc_arena.c" 3 4
+               ((void *)0)
+# 153 "src/alloc_arena.c"
+                   ) {
+        va_arena_chunk_t *next = c->next;
+        (void)a->alloc(c, 0, 1);
+        c = next;
+    }
+    a->chunk = 
+# 158 "src/alloc_arena.c" 3 4
+              ((void *)0)
+# 158 "src/alloc_arena.c"
+                  ;
+    a->last = 
+# 159 "src/alloc_arena.c" 3 4
+             ((void *)0)
+# 159 "src/alloc_arena.c"
+                 ;
+}
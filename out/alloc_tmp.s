@@ -0,0 +1,6743 @@
+	.file	"alloc_tmp.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/alloc_tmp.c"
+	.globl	va_tmp_vec
+	.type	va_tmp_vec, @function
+va_tmp_vec:
+.LVL0:
+.LFB2:
+	.file 1 "src/alloc_tmp.c"
+	.loc 1 27 1 view -0
+	.cfi_startproc
+	.loc 1 28 5 view .LVU1
+	.loc 1 28 22 is_stmt 0 view .LVU2
+	movq	%fs:0, %rdx
+	.loc 1 27 1 view .LVU3
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 28 31 view .LVU4
+	movl	%fs:next@tpoff, %ebx
+	.loc 1 28 22 view .LVU5
+	imulq	$120, %rbx, %rcx
+	.loc 1 28 31 view .LVU6
+	movq	%rbx, %rax
+	.loc 1 29 18 view .LVU7
+	incl	%eax
+	.loc 1 29 23 view .LVU8
+	andl	$3, %eax
+	.loc 1 28 22 view .LVU9
+	leaq	ring@tpoff(%rcx,%rdx), %rbp
+.LVL1:
+	.loc 1 29 5 is_stmt 1 view .LVU10
+	.loc 1 30 10 is_stmt 0 view .LVU11
+	addq	%rcx, %rdx
+	.loc 1 29 23 view .LVU12
+	movl	%eax, %fs:next@tpoff
+	.loc 1 30 5 is_stmt 1 view .LVU13
+	.loc 1 30 8 is_stmt 0 view .LVU14
+	cmpq	$0, 88+ring@tpoff(%rdx)
+	jne	.L2
+.LBB2:
+	.loc 1 31 9 is_stmt 1 view .LVU15
+	.loc 1 31 12 is_stmt 0 view .LVU16
+	xorl	%eax, %eax
+	movl	$30, %ecx
+	movq	%rbp, %rdi
+.LVL2:
+	.loc 1 31 12 view .LVU17
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	movq	$16, 72(%rbp)
+	movq	%rax, ring@tpoff(%rdx)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 88(%rbp)
+.L2:
+.LBE2:
+	.loc 1 33 5 is_stmt 1 view .LVU18
+	movq	%rbp, %rdi
+	call	va_vec_clear@PLT
+.LVL3:
+	.loc 1 34 5 view .LVU19
+	.loc 1 34 10 is_stmt 0 view .LVU20
+	imulq	$120, %rbx, %rdx
+	xorl	%eax, %eax
+	movl	$16, %ecx
+	addq	%fs:0, %rdx
+	leaq	ring@tpoff(%rdx), %rsi
+	movq	%rsi, %rdi
+	rep stosl
+	movq	%r12, ring@tpoff(%rdx)
+	.loc 1 35 5 is_stmt 1 view .LVU21
+	.loc 1 36 1 is_stmt 0 view .LVU22
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL4:
+	.loc 1 36 1 view .LVU23
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL5:
+	.loc 1 36 1 view .LVU24
+	ret
+	.cfi_endproc
+.LFE2:
+	.size	va_tmp_vec, .-va_tmp_vec
+	.globl	va_tmp_vec16
+	.type	va_tmp_vec16, @function
+va_tmp_vec16:
+.LVL6:
+.LFB3:
+	.loc 1 40 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 41 5 view .LVU26
+	.loc 1 41 24 is_stmt 0 view .LVU27
+	movq	%fs:0, %rdx
+	.loc 1 40 1 view .LVU28
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 41 35 view .LVU29
+	movl	%fs:next16@tpoff, %ebx
+	.loc 1 41 24 view .LVU30
+	imulq	$120, %rbx, %rcx
+	.loc 1 41 35 view .LVU31
+	movq	%rbx, %rax
+	.loc 1 42 22 view .LVU32
+	incl	%eax
+	.loc 1 42 27 view .LVU33
+	andl	$3, %eax
+	.loc 1 41 24 view .LVU34
+	leaq	ring16@tpoff(%rcx,%rdx), %rbp
+.LVL7:
+	.loc 1 42 5 is_stmt 1 view .LVU35
+	.loc 1 43 10 is_stmt 0 view .LVU36
+	addq	%rcx, %rdx
+	.loc 1 42 27 view .LVU37
+	movl	%eax, %fs:next16@tpoff
+	.loc 1 43 5 is_stmt 1 view .LVU38
+	.loc 1 43 8 is_stmt 0 view .LVU39
+	cmpq	$0, 88+ring16@tpoff(%rdx)
+	jne	.L6
+.LBB3:
+	.loc 1 44 9 is_stmt 1 view .LVU40
+	.loc 1 44 12 is_stmt 0 view .LVU41
+	xorl	%eax, %eax
+	movl	$30, %ecx
+	movq	%rbp, %rdi
+.LVL8:
+	.loc 1 44 12 view .LVU42
+	rep stosl
+	leaq	va_vec16_vtab_utf16(%rip), %rax
+	movq	$16, 72(%rbp)
+	movq	%rax, ring16@tpoff(%rdx)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 88(%rbp)
+.L6:
+.LBE3:
+	.loc 1 46 5 is_stmt 1 view .LVU43
+	movq	%rbp, %rdi
+	call	va_vec16_clear@PLT
+.LVL9:
+	.loc 1 47 5 view .LVU44
+	.loc 1 47 10 is_stmt 0 view .LVU45
+	imulq	$120, %rbx, %rdx
+	xorl	%eax, %eax
+	movl	$16, %ecx
+	addq	%fs:0, %rdx
+	leaq	ring16@tpoff(%rdx), %rsi
+	movq	%rsi, %rdi
+	rep stosl
+	movq	%r12, ring16@tpoff(%rdx)
+	.loc 1 48 5 is_stmt 1 view .LVU46
+	.loc 1 49 1 is_stmt 0 view .LVU47
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL10:
+	.loc 1 49 1 view .LVU48
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL11:
+	.loc 1 49 1 view .LVU49
+	ret
+	.cfi_endproc
+.LFE3:
+	.size	va_tmp_vec16, .-va_tmp_vec16
+	.globl	va_tmp_vec32
+	.type	va_tmp_vec32, @function
+va_tmp_vec32:
+.LVL12:
+.LFB4:
+	.loc 1 53 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 54 5 view .LVU51
+	.loc 1 54 24 is_stmt 0 view .LVU52
+	movq	%fs:0, %rdx
+	.loc 1 53 1 view .LVU53
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 54 35 view .LVU54
+	movl	%fs:next32@tpoff, %ebx
+	.loc 1 54 24 view .LVU55
+	imulq	$120, %rbx, %rcx
+	.loc 1 54 35 view .LVU56
+	movq	%rbx, %rax
+	.loc 1 55 22 view .LVU57
+	incl	%eax
+	.loc 1 55 27 view .LVU58
+	andl	$3, %eax
+	.loc 1 54 24 view .LVU59
+	leaq	ring32@tpoff(%rcx,%rdx), %rbp
+.LVL13:
+	.loc 1 55 5 is_stmt 1 view .LVU60
+	.loc 1 56 10 is_stmt 0 view .LVU61
+	addq	%rcx, %rdx
+	.loc 1 55 27 view .LVU62
+	movl	%eax, %fs:next32@tpoff
+	.loc 1 56 5 is_stmt 1 view .LVU63
+	.loc 1 56 8 is_stmt 0 view .LVU64
+	cmpq	$0, 88+ring32@tpoff(%rdx)
+	jne	.L9
+.LBB4:
+	.loc 1 57 9 is_stmt 1 view .LVU65
+	.loc 1 57 12 is_stmt 0 view .LVU66
+	xorl	%eax, %eax
+	movl	$30, %ecx
+	movq	%rbp, %rdi
+.LVL14:
+	.loc 1 57 12 view .LVU67
+	rep stosl
+	leaq	va_vec32_vtab_utf32(%rip), %rax
+	movq	$16, 72(%rbp)
+	movq	%rax, ring32@tpoff(%rdx)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 88(%rbp)
+.L9:
+.LBE4:
+	.loc 1 59 5 is_stmt 1 view .LVU68
+	movq	%rbp, %rdi
+	call	va_vec32_clear@PLT
+.LVL15:
+	.loc 1 60 5 view .LVU69
+	.loc 1 60 10 is_stmt 0 view .LVU70
+	imulq	$120, %rbx, %rdx
+	xorl	%eax, %eax
+	movl	$16, %ecx
+	addq	%fs:0, %rdx
+	leaq	ring32@tpoff(%rdx), %rsi
+	movq	%rsi, %rdi
+	rep stosl
+	movq	%r12, ring32@tpoff(%rdx)
+	.loc 1 61 5 is_stmt 1 view .LVU71
+	.loc 1 62 1 is_stmt 0 view .LVU72
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL16:
+	.loc 1 62 1 view .LVU73
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL17:
+	.loc 1 62 1 view .LVU74
+	ret
+	.cfi_endproc
+.LFE4:
+	.size	va_tmp_vec32, .-va_tmp_vec32
+	.globl	va_tprintf_free
+	.type	va_tprintf_free, @function
+va_tprintf_free:
+.LFB5:
+	.loc 1 65 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 66 5 view .LVU76
+.LBB5:
+	.loc 1 66 10 view .LVU77
+.LVL18:
+	.loc 1 66 28 view .LVU78
+.LBE5:
+	.loc 1 65 1 is_stmt 0 view .LVU79
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	xorl	%ebx, %ebx
+	pushq	%rdx
+	.cfi_def_cfa_offset 32
+.LVL19:
+.L12:
+.LBB6:
+	.loc 1 67 9 is_stmt 1 discriminator 3 view .LVU80
+	movq	%fs:0, %rbp
+	leaq	ring@tpoff(%rbx,%rbp), %rdi
+	call	va_vec_free@PLT
+.LVL20:
+	.loc 1 68 9 discriminator 3 view .LVU81
+	leaq	ring16@tpoff(%rbx,%rbp), %rdi
+	call	va_vec16_free@PLT
+.LVL21:
+	.loc 1 69 9 discriminator 3 view .LVU82
+	leaq	ring32@tpoff(%rbx,%rbp), %rdi
+	.loc 1 66 28 is_stmt 0 discriminator 3 view .LVU83
+	addq	$120, %rbx
+.LVL22:
+	.loc 1 69 9 discriminator 3 view .LVU84
+	call	va_vec32_free@PLT
+.LVL23:
+	.loc 1 66 34 is_stmt 1 discriminator 3 view .LVU85
+	.loc 1 66 28 discriminator 3 view .LVU86
+	cmpq	$480, %rbx
+	jne	.L12
+.LBE6:
+	.loc 1 71 1 is_stmt 0 view .LVU87
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE5:
+	.size	va_tprintf_free, .-va_tprintf_free
+	.section	.tbss,"awT",@nobits
+	.align 4
+	.type	next32, @object
+	.size	next32, 4
+next32:
+	.zero	4
+	.align 4
+	.type	next16, @object
+	.size	next16, 4
+next16:
+	.zero	4
+	.align 4
+	.type	next, @object
+	.size	next, 4
+next:
+	.zero	4
+	.align 8
+	.type	ring32, @object
+	.size	ring32, 480
+ring32:
+	.zero	480
+	.align 8
+	.type	ring16, @object
+	.size	ring16, 480
+ring16:
+	.zero	480
+	.align 8
+	.type	ring, @object
+	.size	ring, 480
+ring:
+	.zero	480
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/uchar.h"
+	.file 5 "./include/va_print/base.h"
+	.file 6 "./include/va_print/alloc_utf8.h"
+	.file 7 "./include/va_print/alloc_utf16.h"
+	.file 8 "./include/va_print/alloc_utf32.h"
+	.file 9 "./include/va_print/alloc.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x978
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF882
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF802
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF803
+	.uleb128 0x8
+	.long	.LASF811
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x32
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF804
+	.uleb128 0x5
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF805
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF806
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF807
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF808
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF809
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF810
+	.uleb128 0x8
+	.long	.LASF812
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x68
+	.uleb128 0x8
+	.long	.LASF813
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6f
+	.uleb128 0x8
+	.long	.LASF814
+	.byte	0x3
+	.byte	0x37
+	.byte	0x14
+	.long	0x84
+	.uleb128 0x8
+	.long	.LASF815
+	.byte	0x3
+	.byte	0x39
+	.byte	0x14
+	.long	0x90
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x3
+	.long	0xbb
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF816
+	.uleb128 0xd
+	.long	0xbb
+	.uleb128 0xe
+	.long	0xbb
+	.long	0xd7
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF817
+	.byte	0x4
+	.byte	0x33
+	.byte	0x1a
+	.long	0x9c
+	.uleb128 0x8
+	.long	.LASF818
+	.byte	0x4
+	.byte	0x34
+	.byte	0x1a
+	.long	0xa8
+	.uleb128 0x1e
+	.byte	0x38
+	.byte	0x5
+	.byte	0xc1
+	.byte	0x9
+	.long	0x17b
+	.uleb128 0x7
+	.long	.LASF819
+	.byte	0xc4
+	.byte	0x11
+	.long	0x17b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF820
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1ce
+	.byte	0x8
+	.uleb128 0x17
+	.string	"end"
+	.byte	0xd7
+	.long	0x1e7
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF821
+	.byte	0xdb
+	.byte	0xc
+	.long	0x1f7
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF822
+	.byte	0xe2
+	.byte	0xe
+	.long	0x224
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF823
+	.byte	0xec
+	.byte	0xe
+	.long	0x247
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF824
+	.byte	0xf1
+	.byte	0x13
+	.long	0x61
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF825
+	.byte	0xf5
+	.byte	0x13
+	.long	0x61
+	.byte	0x31
+	.uleb128 0x7
+	.long	.LASF826
+	.byte	0xf9
+	.byte	0x13
+	.long	0x61
+	.byte	0x32
+	.uleb128 0x17
+	.string	"enc"
+	.byte	0xfd
+	.long	0x61
+	.byte	0x33
+	.uleb128 0x7
+	.long	.LASF827
+	.byte	0xff
+	.byte	0xa
+	.long	0xc7
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.long	0xc2
+	.uleb128 0x9
+	.long	0x6f
+	.long	0x194
+	.uleb128 0x2
+	.long	0x194
+	.uleb128 0x2
+	.long	0x1c8
+	.byte	0
+	.uleb128 0x3
+	.long	0x199
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x10
+	.value	0x132
+	.byte	0x10
+	.long	0x1c3
+	.uleb128 0x1
+	.long	.LASF828
+	.byte	0x5
+	.value	0x135
+	.byte	0x20
+	.long	0x25e
+	.byte	0
+	.uleb128 0x4
+	.string	"cur"
+	.byte	0x5
+	.value	0x138
+	.byte	0x11
+	.long	0x1c8
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	0x199
+	.uleb128 0x3
+	.long	0x1cd
+	.uleb128 0x1f
+	.uleb128 0x3
+	.long	0x180
+	.uleb128 0x9
+	.long	0x1c8
+	.long	0x1e7
+	.uleb128 0x2
+	.long	0x194
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	0x1d3
+	.uleb128 0x10
+	.long	0x1f7
+	.uleb128 0x2
+	.long	0x194
+	.byte	0
+	.uleb128 0x3
+	.long	0x1ec
+	.uleb128 0x9
+	.long	0x40
+	.long	0x21a
+	.uleb128 0x2
+	.long	0x21a
+	.uleb128 0x2
+	.long	0x1c8
+	.uleb128 0x2
+	.long	0x40
+	.uleb128 0x2
+	.long	0x21f
+	.byte	0
+	.uleb128 0x3
+	.long	0x1c3
+	.uleb128 0x3
+	.long	0x40
+	.uleb128 0x3
+	.long	0x1fc
+	.uleb128 0x9
+	.long	0x40
+	.long	0x247
+	.uleb128 0x2
+	.long	0xb4
+	.uleb128 0x2
+	.long	0x61
+	.uleb128 0x2
+	.long	0x1c8
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	0x229
+	.uleb128 0x6
+	.long	.LASF829
+	.byte	0x5
+	.value	0x100
+	.byte	0x3
+	.long	0xef
+	.uleb128 0xd
+	.long	0x24c
+	.uleb128 0x3
+	.long	0x259
+	.uleb128 0x6
+	.long	.LASF830
+	.byte	0x5
+	.value	0x139
+	.byte	0x3
+	.long	0x199
+	.uleb128 0x9
+	.long	0xb4
+	.long	0x289
+	.uleb128 0x2
+	.long	0xb4
+	.uleb128 0x2
+	.long	0x40
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	0x270
+	.uleb128 0x6
+	.long	.LASF831
+	.byte	0x5
+	.value	0x169
+	.byte	0x1a
+	.long	0x29b
+	.uleb128 0x18
+	.long	.LASF833
+	.byte	0x40
+	.value	0x1b7
+	.byte	0x8
+	.long	0x319
+	.uleb128 0x1
+	.long	.LASF828
+	.byte	0x5
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x478
+	.byte	0
+	.uleb128 0x4
+	.string	"pat"
+	.byte	0x5
+	.value	0x1b9
+	.byte	0x14
+	.long	0x263
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF834
+	.byte	0x5
+	.value	0x1ba
+	.byte	0xe
+	.long	0x6f
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF835
+	.byte	0x5
+	.value	0x1bb
+	.byte	0xe
+	.long	0x6f
+	.byte	0x1c
+	.uleb128 0x4
+	.string	"opt"
+	.byte	0x5
+	.value	0x1bc
+	.byte	0xe
+	.long	0x6f
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF836
+	.byte	0x5
+	.value	0x1bd
+	.byte	0xe
+	.long	0x6f
+	.byte	0x24
+	.uleb128 0x4
+	.string	"win"
+	.byte	0x5
+	.value	0x1be
+	.byte	0x11
+	.long	0x46b
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF837
+	.byte	0x5
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x47d
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF838
+	.byte	0x5
+	.value	0x16c
+	.byte	0x1e
+	.long	0x32b
+	.uleb128 0xd
+	.long	0x319
+	.uleb128 0x19
+	.long	.LASF851
+	.uleb128 0xa
+	.byte	0x38
+	.byte	0x5
+	.value	0x174
+	.long	0x3aa
+	.uleb128 0x1
+	.long	.LASF839
+	.byte	0x5
+	.value	0x176
+	.byte	0xc
+	.long	0x3ba
+	.byte	0
+	.uleb128 0x4
+	.string	"put"
+	.byte	0x5
+	.value	0x178
+	.byte	0xc
+	.long	0x3cf
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF840
+	.byte	0x5
+	.value	0x17b
+	.byte	0xc
+	.long	0x3ba
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF841
+	.byte	0x5
+	.value	0x182
+	.byte	0xb
+	.long	0x3ef
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF842
+	.byte	0x5
+	.value	0x186
+	.byte	0xc
+	.long	0x409
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF843
+	.byte	0x5
+	.value	0x18c
+	.byte	0xc
+	.long	0x41e
+	.byte	0x28
+	.uleb128 0x4
+	.string	"enc"
+	.byte	0x5
+	.value	0x191
+	.byte	0x13
+	.long	0x61
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF827
+	.byte	0x5
+	.value	0x192
+	.byte	0xa
+	.long	0x423
+	.byte	0x31
+	.byte	0
+	.uleb128 0x10
+	.long	0x3b5
+	.uleb128 0x2
+	.long	0x3b5
+	.byte	0
+	.uleb128 0x3
+	.long	0x28e
+	.uleb128 0x3
+	.long	0x3aa
+	.uleb128 0x10
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x3b5
+	.uleb128 0x2
+	.long	0x6f
+	.byte	0
+	.uleb128 0x3
+	.long	0x3bf
+	.uleb128 0x9
+	.long	0x3e8
+	.long	0x3e8
+	.uleb128 0x2
+	.long	0x3b5
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF844
+	.uleb128 0x3
+	.long	0x3d4
+	.uleb128 0x10
+	.long	0x409
+	.uleb128 0x2
+	.long	0x3b5
+	.uleb128 0x2
+	.long	0x6f
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	0x3f4
+	.uleb128 0x10
+	.long	0x41e
+	.uleb128 0x2
+	.long	0x3b5
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	0x40e
+	.uleb128 0xe
+	.long	0xbb
+	.long	0x433
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF845
+	.byte	0x5
+	.value	0x193
+	.byte	0x3
+	.long	0x330
+	.uleb128 0xd
+	.long	0x433
+	.uleb128 0xa
+	.byte	0x10
+	.byte	0x5
+	.value	0x19a
+	.long	0x46b
+	.uleb128 0x4
+	.string	"cur"
+	.byte	0x5
+	.value	0x19b
+	.byte	0xb
+	.long	0xb4
+	.byte	0
+	.uleb128 0x4
+	.string	"end"
+	.byte	0x5
+	.value	0x19c
+	.byte	0xb
+	.long	0xb4
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF846
+	.byte	0x5
+	.value	0x19d
+	.byte	0x3
+	.long	0x445
+	.uleb128 0x3
+	.long	0x440
+	.uleb128 0x3
+	.long	0x326
+	.uleb128 0x12
+	.long	.LASF847
+	.byte	0x6
+	.long	0x440
+	.uleb128 0x12
+	.long	.LASF848
+	.byte	0x7
+	.long	0x440
+	.uleb128 0x12
+	.long	.LASF849
+	.byte	0x8
+	.long	0x440
+	.uleb128 0x6
+	.long	.LASF850
+	.byte	0x9
+	.value	0x1a6
+	.byte	0x1f
+	.long	0x4ad
+	.uleb128 0x19
+	.long	.LASF852
+	.uleb128 0xa
+	.byte	0x20
+	.byte	0x9
+	.value	0x1af
+	.long	0x4f4
+	.uleb128 0x1
+	.long	.LASF853
+	.byte	0x9
+	.value	0x1b1
+	.byte	0x17
+	.long	0x4f4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF854
+	.byte	0x9
+	.value	0x1b3
+	.byte	0xb
+	.long	0xb4
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF855
+	.byte	0x9
+	.value	0x1b5
+	.byte	0xc
+	.long	0x40
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF856
+	.byte	0x9
+	.value	0x1b7
+	.byte	0xd
+	.long	0x289
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	0x4a0
+	.uleb128 0x6
+	.long	.LASF857
+	.byte	0x9
+	.value	0x1b8
+	.byte	0x3
+	.long	0x4b2
+	.uleb128 0xa
+	.byte	0x78
+	.byte	0x9
+	.value	0x1ba
+	.long	0x58c
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x9
+	.value	0x1bb
+	.byte	0x11
+	.long	0x28e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF858
+	.byte	0x9
+	.value	0x1bc
+	.byte	0xb
+	.long	0xb6
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF859
+	.byte	0x9
+	.value	0x1bd
+	.byte	0xc
+	.long	0x40
+	.byte	0x48
+	.uleb128 0x4
+	.string	"pos"
+	.byte	0x9
+	.value	0x1be
+	.byte	0xc
+	.long	0x40
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF856
+	.byte	0x9
+	.value	0x1bf
+	.byte	0xd
+	.long	0x289
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF860
+	.byte	0x9
+	.value	0x1c0
+	.byte	0xb
+	.long	0xb6
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF861
+	.byte	0x9
+	.value	0x1c1
+	.byte	0x11
+	.long	0x58c
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF862
+	.byte	0x9
+	.value	0x1c2
+	.byte	0x13
+	.long	0x61
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF827
+	.byte	0x9
+	.value	0x1c3
+	.byte	0xa
+	.long	0x423
+	.byte	0x71
+	.byte	0
+	.uleb128 0x3
+	.long	0x4f9
+	.uleb128 0x6
+	.long	.LASF863
+	.byte	0x9
+	.value	0x1c4
+	.byte	0x3
+	.long	0x506
+	.uleb128 0xa
+	.byte	0x78
+	.byte	0x9
+	.value	0x1c6
+	.long	0x624
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x9
+	.value	0x1c7
+	.byte	0x11
+	.long	0x28e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF858
+	.byte	0x9
+	.value	0x1c8
+	.byte	0xf
+	.long	0x624
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF859
+	.byte	0x9
+	.value	0x1c9
+	.byte	0xc
+	.long	0x40
+	.byte	0x48
+	.uleb128 0x4
+	.string	"pos"
+	.byte	0x9
+	.value	0x1ca
+	.byte	0xc
+	.long	0x40
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF856
+	.byte	0x9
+	.value	0x1cb
+	.byte	0xd
+	.long	0x289
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF860
+	.byte	0x9
+	.value	0x1cc
+	.byte	0xf
+	.long	0x624
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF861
+	.byte	0x9
+	.value	0x1cd
+	.byte	0x11
+	.long	0x58c
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF862
+	.byte	0x9
+	.value	0x1ce
+	.byte	0x13
+	.long	0x61
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF827
+	.byte	0x9
+	.value	0x1cf
+	.byte	0xa
+	.long	0x423
+	.byte	0x71
+	.byte	0
+	.uleb128 0x3
+	.long	0xd7
+	.uleb128 0x6
+	.long	.LASF864
+	.byte	0x9
+	.value	0x1d0
+	.byte	0x3
+	.long	0x59e
+	.uleb128 0xa
+	.byte	0x78
+	.byte	0x9
+	.value	0x1d2
+	.long	0x6bc
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x9
+	.value	0x1d3
+	.byte	0x11
+	.long	0x28e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF858
+	.byte	0x9
+	.value	0x1d4
+	.byte	0xf
+	.long	0x6bc
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF859
+	.byte	0x9
+	.value	0x1d5
+	.byte	0xc
+	.long	0x40
+	.byte	0x48
+	.uleb128 0x4
+	.string	"pos"
+	.byte	0x9
+	.value	0x1d6
+	.byte	0xc
+	.long	0x40
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF856
+	.byte	0x9
+	.value	0x1d7
+	.byte	0xd
+	.long	0x289
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF860
+	.byte	0x9
+	.value	0x1d8
+	.byte	0xf
+	.long	0x6bc
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF861
+	.byte	0x9
+	.value	0x1d9
+	.byte	0x11
+	.long	0x58c
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF862
+	.byte	0x9
+	.value	0x1da
+	.byte	0x13
+	.long	0x61
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF827
+	.byte	0x9
+	.value	0x1db
+	.byte	0xa
+	.long	0x423
+	.byte	0x71
+	.byte	0
+	.uleb128 0x3
+	.long	0xe3
+	.uleb128 0x6
+	.long	.LASF865
+	.byte	0x9
+	.value	0x1dc
+	.byte	0x3
+	.long	0x636
+	.uleb128 0xe
+	.long	0x591
+	.long	0x6de
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF866
+	.byte	0xe
+	.byte	0x26
+	.long	0x6ce
+	.uleb128 0xa
+	.byte	0xe
+	.long	ring@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xe
+	.long	0x629
+	.long	0x704
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF867
+	.byte	0xf
+	.byte	0x28
+	.long	0x6f4
+	.uleb128 0xa
+	.byte	0xe
+	.long	ring16@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xe
+	.long	0x6c1
+	.long	0x72a
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF868
+	.byte	0x10
+	.byte	0x28
+	.long	0x71a
+	.uleb128 0xa
+	.byte	0xe
+	.long	ring32@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xb
+	.long	.LASF869
+	.byte	0x12
+	.byte	0x1f
+	.long	0x6f
+	.uleb128 0xa
+	.byte	0xe
+	.long	next@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xb
+	.long	.LASF870
+	.byte	0x13
+	.byte	0x1f
+	.long	0x6f
+	.uleb128 0xa
+	.byte	0xe
+	.long	next16@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xb
+	.long	.LASF871
+	.byte	0x14
+	.byte	0x1f
+	.long	0x6f
+	.uleb128 0xa
+	.byte	0xe
+	.long	next32@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0xc
+	.long	.LASF872
+	.value	0x258
+	.long	0x793
+	.uleb128 0x2
+	.long	0x793
+	.byte	0
+	.uleb128 0x3
+	.long	0x6c1
+	.uleb128 0xc
+	.long	.LASF873
+	.value	0x246
+	.long	0x7a9
+	.uleb128 0x2
+	.long	0x7a9
+	.byte	0
+	.uleb128 0x3
+	.long	0x629
+	.uleb128 0xc
+	.long	.LASF874
+	.value	0x234
+	.long	0x7bf
+	.uleb128 0x2
+	.long	0x7bf
+	.byte	0
+	.uleb128 0x3
+	.long	0x591
+	.uleb128 0xc
+	.long	.LASF875
+	.value	0x249
+	.long	0x7d5
+	.uleb128 0x2
+	.long	0x793
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF876
+	.value	0x237
+	.long	0x7e6
+	.uleb128 0x2
+	.long	0x7a9
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF877
+	.value	0x225
+	.long	0x7f7
+	.uleb128 0x2
+	.long	0x7bf
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF883
+	.byte	0x9
+	.value	0x28c
+	.byte	0xe
+	.long	0xb4
+	.long	0x818
+	.uleb128 0x2
+	.long	0xb4
+	.uleb128 0x2
+	.long	0x40
+	.uleb128 0x2
+	.long	0x40
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF880
+	.byte	0x1
+	.byte	0x40
+	.byte	0xd
+	.quad	.LFB5
+	.quad	.LFE5-.LFB5
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x875
+	.uleb128 0x22
+	.long	.LLRL6
+	.uleb128 0x11
+	.string	"i"
+	.byte	0x42
+	.byte	0x13
+	.long	0x6f
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x13
+	.quad	.LVL20
+	.long	0x7ae
+	.uleb128 0x13
+	.quad	.LVL21
+	.long	0x798
+	.uleb128 0x13
+	.quad	.LVL23
+	.long	0x782
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF878
+	.byte	0x33
+	.long	0x793
+	.quad	.LFB4
+	.quad	.LFE4-.LFB4
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8cd
+	.uleb128 0x14
+	.long	.LASF828
+	.byte	0x34
+	.long	0x478
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x11
+	.string	"t"
+	.byte	0x36
+	.byte	0x18
+	.long	0x793
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x15
+	.quad	.LVL15
+	.long	0x7c4
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF879
+	.byte	0x26
+	.long	0x7a9
+	.quad	.LFB3
+	.quad	.LFE3-.LFB3
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x925
+	.uleb128 0x14
+	.long	.LASF828
+	.byte	0x27
+	.long	0x478
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x11
+	.string	"t"
+	.byte	0x29
+	.byte	0x18
+	.long	0x7a9
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x15
+	.quad	.LVL9
+	.long	0x7d5
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF881
+	.byte	0x1
+	.byte	0x19
+	.byte	0x19
+	.long	0x7bf
+	.quad	.LFB2
+	.quad	.LFE2-.LFB2
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x14
+	.long	.LASF828
+	.byte	0x1a
+	.long	0x478
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x11
+	.string	"t"
+	.byte	0x1c
+	.byte	0x16
+	.long	0x7bf
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.quad	.LVL3
+	.long	0x7e6
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 31
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS7:
+	.uleb128 .LVU78
+	.uleb128 .LVU80
+	.uleb128 .LVU80
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU86
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0xc
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0xd
+	.byte	0x73
+	.sleb128 -120
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x8
+	.byte	0x78
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU60
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LFE4-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU35
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE3-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU10
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE2-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF386
+	.file 11 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF387
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF388
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF450
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF505
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF578
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF604
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF605
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF505
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF665
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF666
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF667
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.file 25 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF727
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 26 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF730
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 27 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF733
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF753
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF754
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF755
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF756
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF757
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.3e0425629195acf083c9561151306b4d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF444
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF449
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF501
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF504
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF515
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF516
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF575
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF577
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF595
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF603
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF443
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF620
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF662
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF664
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF726
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF729
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF752
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloc.h.36.de1e80339a384712e904cf7f8ce67801,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF801
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF620:
+	.string	"__STD_TYPE typedef"
+.LASF757:
+	.string	"VA_PRINT_MALLOC_UTF32_H_ "
+.LASF503:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF853:
+	.string	"chunk"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF847:
+	.string	"va_vec_vtab_utf8"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF811:
+	.string	"size_t"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF698:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF746:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF754:
+	.string	"va_vec_encode utf8"
+.LASF602:
+	.string	"__stub_sigreturn "
+.LASF466:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF565:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF721:
+	.string	"VA_E_DECODE 2"
+.LASF633:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF478:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF540:
+	.string	"__flexarr []"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF730:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF748:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF511:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF790:
+	.string	"va_arena_uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16_ARENA(A), __VA_ARGS__)->data)"
+.LASF793:
+	.string	"va_utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec16(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), __VA_ARGS__)->data)"
+.LASF719:
+	.string	"VA_E_OK 0"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF749:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF714:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF443:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF447:
+	.string	"true 1"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF729:
+	.string	"va_char_p_decode utf8"
+.LASF702:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF713:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF554:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF680:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF665:
+	.string	"__STD_TYPE"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF527:
+	.string	"__P(args) args"
+.LASF745:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF404:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF709:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF781:
+	.string	"va_bxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC_INLINE(alloc, B), __VA_ARGS__))"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF717:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF439:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF820:
+	.string	"take"
+.LASF819:
+	.string	"type"
+.LASF791:
+	.string	"va_arena_Uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32_ARENA(A), __VA_ARGS__)->data)"
+.LASF397:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF420:
+	.string	"__size_t "
+.LASF659:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF617:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF515:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF542:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF408:
+	.string	"_T_SIZE "
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF840:
+	.string	"finish"
+.LASF675:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF673:
+	.string	"VA_NIX "
+.LASF359:
+	.string	"__k8 1"
+.LASF456:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF676:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF387:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF440:
+	.string	"NULL"
+.LASF663:
+	.string	"_BITS_TIME64_H 1"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF882:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF727:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF598:
+	.string	"__stub_fchflags "
+.LASF688:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF642:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF787:
+	.string	"va_vec_is_inline(T) (((T)->data != NULL) && ((T)->data == (T)->stage))"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF710:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF480:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF460:
+	.string	"__USE_XOPEN"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF861:
+	.string	"arena"
+.LASF465:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF564:
+	.string	"__always_inline"
+.LASF406:
+	.string	"_SYS_SIZE_T_H "
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF476:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF513:
+	.string	"__GLIBC__ 2"
+.LASF803:
+	.string	"long int"
+.LASF785:
+	.string	"va_ubprintf(B,...) va_ubxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF874:
+	.string	"va_vec_free"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF481:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF499:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF396:
+	.string	"_PTRDIFF_T_ "
+.LASF477:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF857:
+	.string	"va_arena_t"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF718:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF662:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF647:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF881:
+	.string	"va_tmp_vec"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF641:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF640:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF561:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF398:
+	.string	"___int_ptrdiff_t_h "
+.LASF562:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF415:
+	.string	"_SIZE_T_DECLARED "
+.LASF849:
+	.string	"va_vec32_vtab_utf32"
+.LASF777:
+	.string	"va_Uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32(M), __VA_ARGS__)->data)"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF873:
+	.string	"va_vec16_free"
+.LASF772:
+	.string	"VA_STREAM_VEC32_STAGE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF550:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF831:
+	.string	"va_stream_t"
+.LASF867:
+	.string	"ring16"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF543:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF510:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF520:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF524:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF809:
+	.string	"signed char"
+.LASF761:
+	.string	"va_arena_chunk_size 4096"
+.LASF403:
+	.string	"__size_t__ "
+.LASF607:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF531:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF715:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF622:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF578:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF758:
+	.string	"va_vec32_encode utf32"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF638:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF759:
+	.string	"va_asprintf_init_size 16"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF814:
+	.string	"__uint_least16_t"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF414:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF752:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF417:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF487:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF528:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF817:
+	.string	"char16_t"
+.LASF416:
+	.string	"__DEFINED_size_t "
+.LASF744:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF852:
+	.string	"va_arena_chunk"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF798:
+	.string	"va_aeprintf(...) va_aexprintf(va_alloc, __VA_ARGS__)"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF844:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF572:
+	.string	"__restrict_arr __restrict"
+.LASF868:
+	.string	"ring32"
+.LASF412:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF739:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF760:
+	.string	"va_asprintf_stage_size 512"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF649:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF509:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF551:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF770:
+	.string	"VA_STREAM_VEC16_ARENA(A) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF780:
+	.string	"va_Uaexprintf(alloc,...) VA_BLOCK_EXPR( char32_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC32_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF604:
+	.string	"__need_size_t "
+.LASF610:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF632:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF584:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF569:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF489:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF812:
+	.string	"__uint16_t"
+.LASF463:
+	.string	"__USE_XOPEN2K"
+.LASF537:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF664:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF464:
+	.string	"__USE_XOPEN2KXSI"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF567:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF771:
+	.string	"VA_STREAM_VEC32(M) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF496:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF855:
+	.string	"chunk_size"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF458:
+	.string	"__USE_POSIX199309"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF706:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF484:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF514:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF462:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF479:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF691:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF626:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF611:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF656:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF692:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF601:
+	.string	"__stub_setlogin "
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF658:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF648:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF684:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF446:
+	.string	"bool _Bool"
+.LASF841:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF429:
+	.string	"_BSD_WCHAR_T_ "
+.LASF693:
+	.string	"VA_REC0() VA_REC0B"
+.LASF737:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF549:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF667:
+	.string	"____mbstate_t_defined 1"
+.LASF850:
+	.string	"va_arena_chunk_t"
+.LASF773:
+	.string	"VA_STREAM_VEC32_INLINE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF838:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF441:
+	.string	"NULL ((void *)0)"
+.LASF736:
+	.string	"VA_SIGIL '~'"
+.LASF559:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF442:
+	.string	"__need_NULL"
+.LASF833:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF500:
+	.string	"_ATFILE_SOURCE"
+.LASF616:
+	.string	"__SLONG32_TYPE int"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF637:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF687:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF845:
+	.string	"va_stream_vtab_t"
+.LASF504:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF388:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF720:
+	.string	"VA_E_NULL 1"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF639:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF723:
+	.string	"VA_E_TRUNC 4"
+.LASF605:
+	.string	"_BITS_TYPES_H 1"
+.LASF864:
+	.string	"va_stream_vec16_t"
+.LASF522:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF863:
+	.string	"va_stream_vec_t"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF722:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF490:
+	.string	"_POSIX_SOURCE"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF813:
+	.string	"__uint32_t"
+.LASF488:
+	.string	"__USE_ISOC95 1"
+.LASF588:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF407:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF815:
+	.string	"__uint_least32_t"
+.LASF751:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF541:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF878:
+	.string	"va_tmp_vec32"
+.LASF796:
+	.string	"va_uasprintf(...) va_uaxprintf(va_alloc, __VA_ARGS__)"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF523:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF451:
+	.string	"_FEATURES_H 1"
+.LASF818:
+	.string	"char32_t"
+.LASF783:
+	.string	"va_Ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC32_INLINE(alloc, B), __VA_ARGS__))"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF836:
+	.string	"qctxt"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF579:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF553:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF621:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF799:
+	.string	"va_uaeprintf(...) va_uaexprintf(va_alloc, __VA_ARGS__)"
+.LASF763:
+	.string	"VA_STREAM_VEC(M) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF669:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF766:
+	.string	"VA_STREAM_VEC_ARENA(A) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF393:
+	.string	"_T_PTRDIFF_ "
+.LASF471:
+	.string	"__USE_ATFILE"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF821:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF657:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF425:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF581:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF876:
+	.string	"va_vec16_clear"
+.LASF457:
+	.string	"__USE_POSIX2"
+.LASF747:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF421:
+	.string	"__need_size_t"
+.LASF410:
+	.string	"_SIZE_T_ "
+.LASF872:
+	.string	"va_vec32_free"
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF740:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF724:
+	.string	"VA_E_FORMAT 5"
+.LASF686:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF590:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF595:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF834:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF437:
+	.string	"__DEFINED_wchar_t "
+.LASF851:
+	.string	"va_quotations"
+.LASF767:
+	.string	"VA_STREAM_VEC16(M) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF755:
+	.string	"VA_PRINT_MALLOC_UTF16_H_ "
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF712:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF576:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF427:
+	.string	"__WCHAR_T "
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF526:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF848:
+	.string	"va_vec16_vtab_utf16"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF557:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF392:
+	.string	"_PTRDIFF_T "
+.LASF575:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF839:
+	.string	"init"
+.LASF762:
+	.string	"va_tprintf_slots 4"
+.LASF517:
+	.string	"__PMT"
+.LASF679:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF643:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF824:
+	.string	"has_size"
+.LASF703:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF612:
+	.string	"__SQUAD_TYPE long int"
+.LASF682:
+	.string	"VA_P(X,...) X"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF474:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF592:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF391:
+	.string	"_ANSI_STDDEF_H "
+.LASF685:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF797:
+	.string	"va_Uasprintf(...) va_Uaxprintf(va_alloc, __VA_ARGS__)"
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF856:
+	.string	"alloc"
+.LASF587:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF536:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF808:
+	.string	"unsigned int"
+.LASF875:
+	.string	"va_vec32_clear"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF789:
+	.string	"va_arena_printf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC_ARENA(A), __VA_ARGS__)->data)"
+.LASF743:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF419:
+	.string	"_SIZET_ "
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF518:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF470:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF467:
+	.string	"__USE_LARGEFILE"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF445:
+	.string	"_STDBOOL_H "
+.LASF436:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF498:
+	.string	"__USE_XOPEN2K 1"
+.LASF486:
+	.string	"__USE_ISOC11 1"
+.LASF742:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF650:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF609:
+	.string	"__U32_TYPE unsigned int"
+.LASF394:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF548:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF695:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF552:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF756:
+	.string	"va_vec16_encode utf16"
+.LASF574:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF599:
+	.string	"__stub_gtty "
+.LASF423:
+	.string	"__WCHAR_T__ "
+.LASF800:
+	.string	"va_Uaeprintf(...) va_Uaexprintf(va_alloc, __VA_ARGS__)"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF646:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF832:
+	.string	"va_read_iter"
+.LASF435:
+	.string	"_GCC_WCHAR_T "
+.LASF623:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF563:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF828:
+	.string	"vtab"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF448:
+	.string	"false 0"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF753:
+	.string	"VA_PRINT_MALLOC_UTF8_H_ "
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF400:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF615:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF661:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF512:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF625:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF634:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF651:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF580:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__STRING(x) #x"
+.LASF806:
+	.string	"unsigned char"
+.LASF577:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF865:
+	.string	"va_stream_vec32_t"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF424:
+	.string	"_WCHAR_T "
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF696:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF399:
+	.string	"_GCC_PTRDIFF_T "
+.LASF600:
+	.string	"__stub_revoke "
+.LASF816:
+	.string	"char"
+.LASF525:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF586:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF405:
+	.string	"_SIZE_T "
+.LASF432:
+	.string	"_WCHAR_T_H "
+.LASF784:
+	.string	"va_bprintf(B,...) va_bxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF846:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF805:
+	.string	"long double"
+.LASF860:
+	.string	"stage"
+.LASF545:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF877:
+	.string	"va_vec_clear"
+.LASF390:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF409:
+	.string	"__SIZE_T "
+.LASF505:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF690:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF454:
+	.string	"__USE_ISOC95"
+.LASF689:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF453:
+	.string	"__USE_ISOC99"
+.LASF883:
+	.string	"va_alloc"
+.LASF461:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF728:
+	.string	"va_char_p_format utf8"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF532:
+	.string	"__BEGIN_DECLS "
+.LASF560:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF708:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF497:
+	.string	"__USE_POSIX199506 1"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF859:
+	.string	"size"
+.LASF700:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF653:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF455:
+	.string	"__USE_ISOCXX11"
+.LASF413:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF764:
+	.string	"VA_STREAM_VEC_STAGE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF870:
+	.string	"next16"
+.LASF591:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF395:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF788:
+	.string	"VA_ARENA(M) ((va_arena_t){ NULL, NULL, va_arena_chunk_size, (M) })"
+.LASF802:
+	.string	"long unsigned int"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF493:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF837:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF556:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF459:
+	.string	"__USE_POSIX199506"
+.LASF726:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"va_char32_p_decode utf32"
+.LASF734:
+	.string	"va_char32_p_format utf32"
+.LASF830:
+	.string	"va_read_iter_t"
+.LASF502:
+	.string	"__WORDSIZE 64"
+.LASF738:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF431:
+	.string	"_WCHAR_T_DEFINED "
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF603:
+	.string	"__stub_stty "
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF538:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF618:
+	.string	"__S64_TYPE long int"
+.LASF411:
+	.string	"_BSD_SIZE_T_ "
+.LASF535:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF822:
+	.string	"bulk"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF733:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF704:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF426:
+	.string	"_T_WCHAR "
+.LASF778:
+	.string	"va_aexprintf(alloc,...) VA_BLOCK_EXPR( char va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF608:
+	.string	"__S32_TYPE int"
+.LASF732:
+	.string	"va_char16_p_decode utf16"
+.LASF731:
+	.string	"va_char16_p_format utf16"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF434:
+	.string	"__INT_WCHAR_T_H "
+.LASF795:
+	.string	"va_asprintf(...) va_axprintf(va_alloc, __VA_ARGS__)"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF786:
+	.string	"va_Ubprintf(B,...) va_Ubxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF879:
+	.string	"va_tmp_vec16"
+.LASF507:
+	.string	"__USE_ATFILE 1"
+.LASF452:
+	.string	"__USE_ISOC11"
+.LASF871:
+	.string	"next32"
+.LASF801:
+	.string	"va_format_compile(X) va_format_xcompile(va_alloc, X)"
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF428:
+	.string	"_WCHAR_T_ "
+.LASF671:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF765:
+	.string	"VA_STREAM_VEC_INLINE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF701:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF843:
+	.string	"put_len"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF597:
+	.string	"__stub_chflags "
+.LASF444:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF473:
+	.string	"__USE_GNU"
+.LASF697:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF668:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF652:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF750:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF707:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF866:
+	.string	"ring"
+.LASF823:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF645:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF585:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF529:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF568:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF472:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF558:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF501:
+	.string	"_ATFILE_SOURCE 1"
+.LASF533:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF716:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF741:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF810:
+	.string	"short int"
+.LASF389:
+	.string	"_STDDEF_H "
+.LASF450:
+	.string	"_UCHAR_H 1"
+.LASF678:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF386:
+	.string	"VA_PRINT_MALLOC_H_ "
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF776:
+	.string	"va_uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16(M), __VA_ARGS__)->data)"
+.LASF482:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF571:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF516:
+	.string	"_SYS_CDEFS_H 1"
+.LASF694:
+	.string	"VA_REC1() VA_REC1B"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF546:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF521:
+	.string	"__LEAF , __leaf__"
+.LASF794:
+	.string	"va_Utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec32(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), __VA_ARGS__)->data)"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF862:
+	.string	"keep"
+.LASF583:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF613:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF402:
+	.string	"__need_ptrdiff_t"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF594:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF544:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF825:
+	.string	"chunk_mode"
+.LASF630:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF547:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF614:
+	.string	"__SWORD_TYPE long int"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF827:
+	.string	"_pad"
+.LASF555:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF627:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF494:
+	.string	"__USE_POSIX 1"
+.LASF677:
+	.string	"VA_PAR ()"
+.LASF619:
+	.string	"__U64_TYPE unsigned long int"
+.LASF593:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF681:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF842:
+	.string	"put_fill"
+.LASF606:
+	.string	"__S16_TYPE short int"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF775:
+	.string	"va_axprintf(alloc,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC(alloc), __VA_ARGS__)->data)"
+.LASF430:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF566:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF779:
+	.string	"va_uaexprintf(alloc,...) VA_BLOCK_EXPR( char16_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC16_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF433:
+	.string	"___int_wchar_t_h "
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF774:
+	.string	"VA_STREAM_VEC32_ARENA(A) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF582:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF570:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF635:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF683:
+	.string	"VA_F(...) VA_H"
+.LASF483:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF418:
+	.string	"_GCC_SIZE_T "
+.LASF674:
+	.string	"VA_EAT(...) "
+.LASF807:
+	.string	"short unsigned int"
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF670:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF438:
+	.string	"_BSD_WCHAR_T_"
+.LASF596:
+	.string	"__stub___compat_bdflush "
+.LASF804:
+	.string	"long long int"
+.LASF705:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF485:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF624:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF666:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF534:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF350:
+	.string	"__amd64 1"
+.LASF491:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF495:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF636:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF589:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF829:
+	.string	"va_read_iter_vtab_t"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF628:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF792:
+	.string	"va_tprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), __VA_ARGS__)->data)"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF629:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF711:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF519:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF377:
+	.string	"unix 1"
+.LASF826:
+	.string	"str_prefix"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF422:
+	.string	"__wchar_t__ "
+.LASF782:
+	.string	"va_ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC16_INLINE(alloc, B), __VA_ARGS__))"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF508:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF506:
+	.string	"__USE_MISC 1"
+.LASF449:
+	.string	"__bool_true_false_are_defined 1"
+.LASF768:
+	.string	"VA_STREAM_VEC16_STAGE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF655:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF672:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF401:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF539:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF631:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF475:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF769:
+	.string	"VA_STREAM_VEC16_INLINE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF468:
+	.string	"__USE_LARGEFILE64"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF835:
+	.string	"prec"
+.LASF372:
+	.string	"__linux 1"
+.LASF869:
+	.string	"next"
+.LASF858:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF725:
+	.string	"VA_E_ARGC 6"
+.LASF660:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF492:
+	.string	"_POSIX_C_SOURCE"
+.LASF699:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF654:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF573:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF854:
+	.string	"last"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF880:
+	.string	"va_tprintf_free"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/alloc_tmp.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
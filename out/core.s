@@ -0,0 +1,50842 @@
+	.file	"core.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/core.c"
+	.type	check_quote_sh, @function
+check_quote_sh:
+.LVL0:
+.LFB543:
+	.file 1 "src/core.c"
+	.loc 1 184 1 view -0
+	.cfi_startproc
+	.loc 1 185 5 view .LVU1
+	.loc 1 186 8 is_stmt 0 view .LVU2
+	movl	%esi, %edx
+	.loc 1 185 14 view .LVU3
+	movl	$1, 36(%rdi)
+	.loc 1 186 5 is_stmt 1 view .LVU4
+	.loc 1 186 43 is_stmt 0 view .LVU5
+	xorl	%eax, %eax
+	.loc 1 186 8 view .LVU6
+	andl	$-33, %edx
+	subl	$65, %edx
+	cmpl	$25, %edx
+	jbe	.L1
+	.loc 1 187 5 is_stmt 1 view .LVU7
+	.loc 1 188 5 view .LVU8
+	.loc 1 188 20 is_stmt 0 view .LVU9
+	leal	-48(%rsi), %edx
+	.loc 1 188 8 view .LVU10
+	cmpl	$9, %edx
+	jbe	.L1
+	.loc 1 189 5 is_stmt 1 view .LVU11
+	cmpl	$47, %esi
+	ja	.L3
+	cmpl	$42, %esi
+	setbe	%al
+	ret
+.L3:
+	cmpl	$95, %esi
+	setne	%al
+.L1:
+	.loc 1 198 1 is_stmt 0 view .LVU12
+	ret
+	.cfi_endproc
+.LFE543:
+	.size	check_quote_sh, .-check_quote_sh
+	.type	check_flush_sh, @function
+check_flush_sh:
+.LVL1:
+.LFB544:
+	.loc 1 201 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 202 5 view .LVU14
+	.loc 1 202 22 is_stmt 0 view .LVU15
+	cmpl	$0, 36(%rdi)
+	sete	%al
+	.loc 1 203 1 view .LVU16
+	ret
+	.cfi_endproc
+.LFE544:
+	.size	check_flush_sh, .-check_flush_sh
+	.type	va_quote1_c, @function
+va_quote1_c:
+.LVL2:
+.LFB545:
+	.loc 1 206 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 207 5 view .LVU18
+	.loc 1 212 23 is_stmt 0 view .LVU19
+	movb	$34, %al
+	.loc 1 207 5 view .LVU20
+	cmpl	$34, %edi
+	je	.L8
+	ja	.L10
+	.loc 1 208 23 view .LVU21
+	movb	$110, %al
+	.loc 1 207 5 view .LVU22
+	cmpl	$10, %edi
+	je	.L8
+	movb	$114, %al
+	cmpl	$13, %edi
+	je	.L8
+	.loc 1 214 21 view .LVU23
+	cmpl	$9, %edi
+	movb	$116, %al
+	jmp	.L19
+.L10:
+	.loc 1 211 23 view .LVU24
+	movb	$39, %al
+	.loc 1 207 5 view .LVU25
+	cmpl	$39, %edi
+	je	.L8
+	.loc 1 214 21 view .LVU26
+	cmpl	$92, %edi
+	movb	$92, %al
+.L19:
+	.loc 1 214 21 view .LVU27
+	movb	$0, %dl
+	cmovne	%edx, %eax
+.L8:
+	.loc 1 216 1 view .LVU28
+	ret
+	.cfi_endproc
+.LFE545:
+	.size	va_quote1_c, .-va_quote1_c
+	.type	iter_take, @function
+iter_take:
+.LVL3:
+.LFB549:
+	.loc 1 264 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 265 5 view .LVU30
+	.loc 1 264 1 is_stmt 0 view .LVU31
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 265 8 view .LVU32
+	cmpq	$0, 8(%rsi)
+	.loc 1 264 1 view .LVU33
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+.LVL4:
+	.loc 1 265 8 view .LVU34
+	jne	.L21
+	.loc 1 266 9 is_stmt 1 view .LVU35
+.LVL5:
+.LBB396:
+.LBI396:
+	.file 2 "./include/va_print/impl.h"
+	.loc 2 425 20 view .LVU36
+.LBB397:
+	.loc 2 427 5 view .LVU37
+	.loc 2 427 13 is_stmt 0 view .LVU38
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU39
+	testl	$939524096, %eax
+	jne	.L23
+	.loc 2 428 9 is_stmt 1 view .LVU40
+.LBB398:
+	.loc 2 428 25 view .LVU41
+.LVL6:
+	.loc 2 428 62 view .LVU42
+	.loc 2 428 101 is_stmt 0 view .LVU43
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU44
+	orl	$134217728, %eax
+	movl	%eax, 32(%rbx)
+	jmp	.L23
+.LVL7:
+.L21:
+	.loc 2 428 123 view .LVU45
+.LBE398:
+.LBE397:
+.LBE396:
+	.loc 1 270 28 view .LVU46
+	movq	(%rdi), %rax
+	movq	%rdx, %rsi
+.LVL8:
+	.loc 1 270 5 is_stmt 1 view .LVU47
+	.loc 1 270 18 is_stmt 0 view .LVU48
+	call	*8(%rax)
+.LVL9:
+	.loc 1 271 5 is_stmt 1 view .LVU49
+	.loc 1 271 8 is_stmt 0 view .LVU50
+	cmpl	$-1, %eax
+	je	.L23
+	.loc 1 277 5 is_stmt 1 view .LVU51
+	.loc 1 277 26 is_stmt 0 view .LVU52
+	movl	32(%rbx), %edx
+.LVL10:
+	.loc 1 278 5 is_stmt 1 view .LVU53
+	.loc 1 278 8 is_stmt 0 view .LVU54
+	movl	%edx, %ecx
+	shrl	$30, %ecx
+.LVL11:
+	.loc 1 278 8 view .LVU55
+	jne	.L25
+	.loc 1 279 9 is_stmt 1 view .LVU56
+.LBB399:
+	.loc 1 279 25 view .LVU57
+.LVL12:
+	.loc 1 279 52 view .LVU58
+	.loc 1 279 85 view .LVU59
+	.loc 1 279 97 view .LVU60
+	.loc 1 279 109 view .LVU61
+	andl	$2147483647, %eax
+.LVL13:
+	.loc 1 279 109 is_stmt 0 view .LVU62
+	jmp	.L26
+.LVL14:
+.L25:
+	.loc 1 279 109 view .LVU63
+.LBE399:
+	.loc 1 282 9 is_stmt 1 view .LVU64
+	.loc 1 283 18 is_stmt 0 view .LVU65
+	movl	%eax, %esi
+	decl	%ecx
+.LVL15:
+.LBB400:
+	.loc 1 288 101 view .LVU66
+	andl	$1073741823, %edx
+.LBE400:
+	.loc 1 283 18 view .LVU67
+	sarl	$31, %esi
+	andl	%esi, %ecx
+.LVL16:
+	.loc 1 288 9 is_stmt 1 view .LVU68
+.LBB401:
+	.loc 1 288 25 view .LVU69
+	.loc 1 288 62 view .LVU70
+	.loc 1 288 134 is_stmt 0 view .LVU71
+	movl	%ecx, %esi
+	sall	$30, %esi
+	.loc 1 288 123 view .LVU72
+	orl	%esi, %edx
+	movl	%edx, 32(%rbx)
+.LVL17:
+.L26:
+	.loc 1 288 123 view .LVU73
+.LBE401:
+	.loc 1 292 5 is_stmt 1 view .LVU74
+	.loc 1 292 8 is_stmt 0 view .LVU75
+	testl	$520093696, %eax
+	je	.L20
+	.loc 1 293 9 is_stmt 1 view .LVU76
+.LVL18:
+.LBB402:
+.LBI402:
+	.loc 2 425 20 view .LVU77
+.LBB403:
+	.loc 2 427 5 view .LVU78
+	.loc 2 427 13 is_stmt 0 view .LVU79
+	movl	32(%rbx), %edx
+	.loc 2 427 8 view .LVU80
+	testl	$939524096, %edx
+	jne	.L30
+	.loc 2 428 9 is_stmt 1 view .LVU81
+.LBB404:
+	.loc 2 428 25 view .LVU82
+.LVL19:
+	.loc 2 428 62 view .LVU83
+	.loc 2 428 101 is_stmt 0 view .LVU84
+	andl	$-939524097, %edx
+	.loc 2 428 123 view .LVU85
+	orl	$268435456, %edx
+	movl	%edx, 32(%rbx)
+.LVL20:
+.L30:
+	.loc 2 428 123 view .LVU86
+.LBE404:
+.LBE403:
+.LBE402:
+	.loc 1 294 9 is_stmt 1 view .LVU87
+	.loc 1 294 12 is_stmt 0 view .LVU88
+	testl	%ecx, %ecx
+	jne	.L20
+	.loc 1 295 13 is_stmt 1 view .LVU89
+	.loc 1 295 27 is_stmt 0 view .LVU90
+	movl	%eax, %edx
+	shrl	$29, %edx
+.LVL21:
+	.loc 1 296 13 is_stmt 1 view .LVU91
+	.loc 1 296 16 is_stmt 0 view .LVU92
+	andl	$3, %edx
+.LVL22:
+	.loc 1 296 16 view .LVU93
+	je	.L20
+	.loc 1 297 17 is_stmt 1 view .LVU94
+.LBB405:
+	.loc 1 297 33 view .LVU95
+.LVL23:
+	.loc 1 297 70 view .LVU96
+	.loc 1 297 109 is_stmt 0 view .LVU97
+	movl	32(%rbx), %ecx
+	.loc 1 297 142 view .LVU98
+	sall	$30, %edx
+.LVL24:
+	.loc 1 297 109 view .LVU99
+	andl	$1073741823, %ecx
+	.loc 1 297 131 view .LVU100
+	orl	%ecx, %edx
+	movl	%edx, 32(%rbx)
+	jmp	.L20
+.LVL25:
+.L23:
+	.loc 1 297 131 view .LVU101
+.LBE405:
+	.loc 1 267 16 view .LVU102
+	orl	$-1, %eax
+.L20:
+	.loc 1 303 1 view .LVU103
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL26:
+	.loc 1 303 1 view .LVU104
+	ret
+	.cfi_endproc
+.LFE549:
+	.size	iter_take, .-iter_take
+	.type	render_quote_flush, @function
+render_quote_flush:
+.LVL27:
+.LFB561:
+	.loc 1 533 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 534 5 view .LVU106
+	.loc 1 533 1 is_stmt 0 view .LVU107
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+.LVL28:
+	.loc 1 534 8 view .LVU108
+	testq	%rax, %rax
+	je	.L40
+	.loc 1 534 25 discriminator 1 view .LVU109
+	movq	40(%rax), %rax
+.LVL29:
+	.loc 1 534 20 discriminator 1 view .LVU110
+	testq	%rax, %rax
+	je	.L40
+	.loc 1 535 9 is_stmt 1 view .LVU111
+	.loc 1 535 16 is_stmt 0 view .LVU112
+	jmp	*%rax
+.LVL30:
+.L40:
+	.loc 1 537 1 view .LVU113
+	ret
+	.cfi_endproc
+.LFE561:
+	.size	render_quote_flush, .-render_quote_flush
+	.type	iter_skip, @function
+iter_skip:
+.LVL31:
+.LFB569:
+	.loc 1 701 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 702 5 view .LVU115
+	.loc 1 701 1 is_stmt 0 view .LVU116
+	movq	%rdi, %rax
+	movq	%rcx, %rdi
+.LVL32:
+	.loc 1 702 60 view .LVU117
+	movq	(%rsi), %rcx
+.LVL33:
+	.loc 1 702 60 view .LVU118
+	movzbl	51(%rcx), %ecx
+	.loc 1 702 66 view .LVU119
+	decl	%ecx
+	.loc 1 702 46 view .LVU120
+	salq	%cl, %rdx
+.LVL34:
+	.loc 1 702 41 view .LVU121
+	addq	%rdx, 8(%rsi)
+	.loc 1 703 5 is_stmt 1 view .LVU122
+	.loc 1 703 24 is_stmt 0 view .LVU123
+	movl	24(%rax), %esi
+.LVL35:
+	.loc 1 703 60 view .LVU124
+	xorl	%edx, %edx
+	cmpq	%rsi, %rdi
+	jnb	.L49
+	.loc 1 703 60 discriminator 1 view .LVU125
+	movl	%esi, %edx
+	subl	%edi, %edx
+.L49:
+.LBB406:
+	.loc 1 704 119 discriminator 4 view .LVU126
+	andl	$1073741823, 32(%rax)
+.LBE406:
+	.loc 1 703 14 discriminator 4 view .LVU127
+	movl	%edx, 24(%rax)
+	.loc 1 704 5 is_stmt 1 discriminator 4 view .LVU128
+.LBB407:
+	.loc 1 704 21 discriminator 4 view .LVU129
+.LVL36:
+	.loc 1 704 58 discriminator 4 view .LVU130
+.LBE407:
+	.loc 1 705 1 is_stmt 0 discriminator 4 view .LVU131
+	ret
+	.cfi_endproc
+.LFE569:
+	.size	iter_skip, .-iter_skip
+	.type	iter_reserve_bulk, @function
+iter_reserve_bulk:
+.LVL37:
+.LFB570:
+	.loc 1 717 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 718 5 view .LVU133
+.LBB408:
+.LBI408:
+	.loc 2 574 22 view .LVU134
+.LBB409:
+	.loc 2 576 5 view .LVU135
+	.loc 2 576 5 is_stmt 0 view .LVU136
+.LBE409:
+.LBE408:
+	.loc 1 717 1 view .LVU137
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+.LBB411:
+.LBB410:
+	.loc 2 576 39 view .LVU138
+	movq	48(%rdi), %rax
+	subq	40(%rdi), %rax
+.LBE410:
+.LBE411:
+	.loc 1 718 8 view .LVU139
+	cmpq	%rcx, %rax
+	jb	.L52
+.LVL38:
+.L54:
+	.loc 1 719 15 view .LVU140
+	movb	$1, %al
+	jmp	.L51
+.LVL39:
+.L52:
+	.loc 1 719 15 view .LVU141
+	movq	%rsi, %rdi
+	movq	%rcx, %rbp
+	.loc 1 721 5 is_stmt 1 view .LVU142
+	.loc 1 723 5 view .LVU143
+	.loc 1 723 9 is_stmt 0 view .LVU144
+	leaq	8(%rsp), %rcx
+.LVL40:
+	.loc 1 723 9 view .LVU145
+	movq	%rdx, %rsi
+.LVL41:
+	.loc 1 723 19 view .LVU146
+	movq	(%rdi), %rax
+	.loc 1 723 9 view .LVU147
+	movl	$4, %edx
+.LVL42:
+	.loc 1 723 9 view .LVU148
+	call	*32(%rax)
+.LVL43:
+	.loc 1 723 9 view .LVU149
+	movq	%rax, %rdx
+	.loc 1 724 15 view .LVU150
+	xorl	%eax, %eax
+	.loc 1 723 8 view .LVU151
+	testq	%rdx, %rdx
+	je	.L51
+	.loc 1 726 5 is_stmt 1 view .LVU152
+.LVL44:
+.LBB412:
+.LBI412:
+	.loc 2 585 19 view .LVU153
+.LBB413:
+	.loc 2 587 5 view .LVU154
+.LBB414:
+.LBI414:
+	.loc 2 574 22 view .LVU155
+.LBB415:
+	.loc 2 576 5 view .LVU156
+	.loc 2 576 39 is_stmt 0 view .LVU157
+	movq	48(%rbx), %rax
+	subq	40(%rbx), %rax
+.LBE415:
+.LBE414:
+	.loc 2 587 8 view .LVU158
+	cmpq	%rbp, %rax
+	jnb	.L54
+	.loc 2 590 5 is_stmt 1 view .LVU159
+	.loc 2 590 20 is_stmt 0 view .LVU160
+	movq	(%rbx), %rax
+	movq	24(%rax), %rdx
+	.loc 2 590 37 view .LVU161
+	xorl	%eax, %eax
+	testq	%rdx, %rdx
+	je	.L55
+	.loc 2 590 40 view .LVU162
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	*%rdx
+.LVL45:
+	.loc 2 590 37 view .LVU163
+	movzbl	%al, %eax
+.L55:
+	.loc 2 590 37 view .LVU164
+	andl	$1, %eax
+.LVL46:
+.L51:
+	.loc 2 590 37 view .LVU165
+.LBE413:
+.LBE412:
+	.loc 1 727 1 view .LVU166
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL47:
+	.loc 1 727 1 view .LVU167
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE570:
+	.size	iter_reserve_bulk, .-iter_reserve_bulk
+	.type	iter_len_bulk, @function
+iter_len_bulk:
+.LVL48:
+.LFB573:
+	.loc 1 789 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 790 5 view .LVU169
+	.loc 1 789 1 is_stmt 0 view .LVU170
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rsi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 790 8 view .LVU171
+	cmpq	$0, 8(%rsi)
+	je	.L59
+	.loc 1 794 26 view .LVU172
+	movq	(%rbx), %rax
+	movq	%rdx, %rsi
+.LVL49:
+	.loc 1 793 5 is_stmt 1 view .LVU173
+	.loc 1 794 5 view .LVU174
+	movq	%rdi, %rbp
+	.loc 1 794 16 is_stmt 0 view .LVU175
+	leaq	8(%rsp), %rcx
+	orq	$-1, %rdx
+.LVL50:
+	.loc 1 794 16 view .LVU176
+	movq	%rbx, %rdi
+.LVL51:
+	.loc 1 794 16 view .LVU177
+	call	*32(%rax)
+.LVL52:
+	.loc 1 794 16 view .LVU178
+	movq	%rax, %r12
+.LVL53:
+	.loc 1 795 5 is_stmt 1 view .LVU179
+	.loc 1 795 8 is_stmt 0 view .LVU180
+	testq	%rax, %rax
+	je	.L59
+	.loc 1 798 5 is_stmt 1 view .LVU181
+.LVL54:
+	.loc 1 799 5 view .LVU182
+	.loc 1 799 35 is_stmt 0 view .LVU183
+	movq	0(%rbp), %rax
+.LVL55:
+	.loc 1 799 13 view .LVU184
+	movq	(%rbx), %r8
+	movq	%r12, %rsi
+	.loc 1 799 35 view .LVU185
+	movb	48(%rax), %al
+	.loc 1 799 8 view .LVU186
+	cmpb	%al, 51(%r8)
+	je	.L61
+	.loc 1 800 9 is_stmt 1 view .LVU187
+	.loc 1 800 13 is_stmt 0 view .LVU188
+	movq	8(%rbx), %rdx
+	movzbl	%al, %esi
+	movq	%r12, %rcx
+	xorl	%edi, %edi
+	call	*40(%r8)
+.LVL56:
+	.loc 1 801 21 view .LVU189
+	movq	0(%rbp), %rdx
+	movzbl	48(%rdx), %ecx
+	.loc 1 801 27 view .LVU190
+	decl	%ecx
+	.loc 1 800 11 view .LVU191
+	shrq	%cl, %rax
+	movq	%rax, %rsi
+.LVL57:
+.L61:
+	.loc 1 803 5 is_stmt 1 view .LVU192
+	.loc 1 803 12 is_stmt 0 view .LVU193
+	movq	0(%rbp), %rax
+	.loc 1 803 5 view .LVU194
+	movq	%rbp, %rdi
+	call	*40(%rax)
+.LVL58:
+	.loc 1 804 5 is_stmt 1 view .LVU195
+	movq	8(%rsp), %rcx
+	movq	%r12, %rdx
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	iter_skip
+.LVL59:
+.L59:
+	.loc 1 805 1 is_stmt 0 view .LVU196
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL60:
+	.loc 1 805 1 view .LVU197
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE573:
+	.size	iter_len_bulk, .-iter_len_bulk
+	.type	plain_run_utf16, @function
+plain_run_utf16:
+.LVL61:
+.LFB580:
+	.loc 1 1014 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1015 5 view .LVU199
+	.loc 1 1016 5 view .LVU200
+	.loc 1 1014 1 is_stmt 0 view .LVU201
+	movq	%rdx, %r8
+.LBB416:
+.LBB417:
+	.loc 1 939 5 view .LVU202
+	leaq	.L72(%rip), %r9
+.LBE417:
+.LBE416:
+	.loc 1 1015 12 view .LVU203
+	xorl	%edx, %edx
+.LVL62:
+.L69:
+	.loc 1 1016 20 is_stmt 1 view .LVU204
+	cmpq	%r8, %rdx
+	je	.L68
+.LBB423:
+.LBB418:
+	.loc 1 939 5 is_stmt 0 discriminator 1 view .LVU205
+	movl	8(%rdi), %r11d
+.LBE418:
+.LBE423:
+	.loc 1 1016 39 discriminator 1 view .LVU206
+	movzwl	(%rsi,%rdx,2), %ecx
+.LBB424:
+.LBB419:
+	.loc 1 939 5 discriminator 1 view .LVU207
+	leal	-1(%r11), %r10d
+.LBE419:
+.LBE424:
+	.loc 1 1016 39 discriminator 1 view .LVU208
+	movq	%rcx, %rax
+.LVL63:
+.LBB425:
+.LBI416:
+	.loc 1 937 19 is_stmt 1 discriminator 1 view .LVU209
+.LBB420:
+	.loc 1 939 5 discriminator 1 view .LVU210
+	cmpl	$4, %r10d
+	ja	.L68
+	movslq	(%r9,%r10,4), %r10
+	addq	%r9, %r10
+	jmp	*%r10
+	.section	.rodata
+	.align 4
+	.align 4
+.L72:
+	.long	.L76-.L72
+	.long	.L75-.L72
+	.long	.L74-.L72
+	.long	.L73-.L72
+	.long	.L71-.L72
+	.text
+.L76:
+	.loc 1 941 9 view .LVU211
+	.loc 1 941 19 is_stmt 0 view .LVU212
+	cmpw	$39, %cx
+	ja	.L77
+	movl	$4294967163, %eax
+	salq	$32, %rax
+	sarq	%cl, %rax
+	.loc 1 941 72 view .LVU213
+	testb	$1, %al
+	jmp	.L89
+.L77:
+	cmpl	$127, %ecx
+	je	.L68
+	cmpl	$92, %ecx
+	jmp	.L89
+.L75:
+	.loc 1 943 9 is_stmt 1 view .LVU214
+	.loc 1 943 28 is_stmt 0 view .LVU215
+	subl	$32, %ecx
+.LVL64:
+	.loc 1 943 28 view .LVU216
+	cmpl	$94, %ecx
+	.loc 1 943 48 view .LVU217
+	leal	-34(%rax), %ecx
+.LVL65:
+	.loc 1 943 48 view .LVU218
+	movb	$1, %al
+.LVL66:
+	.loc 1 943 28 view .LVU219
+	setbe	%r10b
+	.loc 1 943 48 view .LVU220
+	cmpw	$58, %cx
+	ja	.L79
+	movabsq	$-288230376151711778, %rax
+	sarq	%cl, %rax
+	andl	$1, %eax
+.L79:
+	.loc 1 943 71 view .LVU221
+	testb	%r10b, %r10b
+	je	.L68
+	testb	%al, %al
+	jmp	.L89
+.LVL67:
+.L74:
+	.loc 1 945 9 is_stmt 1 view .LVU222
+	.loc 1 945 9 is_stmt 0 view .LVU223
+.LBE420:
+.LBE425:
+	.loc 1 1016 20 view .LVU224
+	cmpl	$39, %ecx
+	jmp	.L89
+.LVL68:
+.L73:
+.LBB426:
+.LBB421:
+	.loc 1 947 9 is_stmt 1 view .LVU225
+	.loc 1 947 28 is_stmt 0 view .LVU226
+	leal	-43(%rcx), %r10d
+	.loc 1 947 57 view .LVU227
+	cmpl	$14, %r10d
+	ja	.L91
+.LVL69:
+.L78:
+	.loc 1 947 57 view .LVU228
+.LBE421:
+.LBE426:
+	.loc 1 1017 9 is_stmt 1 view .LVU229
+	.loc 1 1017 10 is_stmt 0 view .LVU230
+	incq	%rdx
+.LVL70:
+	.loc 1 1017 10 view .LVU231
+	jmp	.L69
+.LVL71:
+.L91:
+.LBB427:
+.LBB422:
+	.loc 1 947 57 view .LVU232
+	cmpl	$95, %ecx
+	je	.L78
+	.loc 1 948 18 view .LVU233
+	orl	$32, %eax
+	movzwl	%ax, %eax
+	.loc 1 948 34 view .LVU234
+	subl	$97, %eax
+	.loc 1 947 57 view .LVU235
+	cmpl	$25, %eax
+	jbe	.L78
+	jmp	.L68
+.L71:
+	.loc 1 950 9 is_stmt 1 view .LVU236
+	.loc 1 950 53 is_stmt 0 view .LVU237
+	cmpl	$127, %ecx
+	ja	.L81
+.LVL72:
+	.loc 1 950 37 view .LVU238
+	movq	(%rdi), %rcx
+.LBE422:
+.LBE427:
+	.loc 1 1016 20 view .LVU239
+	movb	(%rcx,%rax), %al
+	cmpb	%al, 12(%rdi)
+	jnb	.L78
+	jmp	.L68
+.LVL73:
+.L81:
+	.loc 1 1016 20 view .LVU240
+	cmpb	$0, 13(%rdi)
+.L89:
+	.loc 1 1016 20 view .LVU241
+	jne	.L78
+.L68:
+	.loc 1 1020 1 view .LVU242
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE580:
+	.size	plain_run_utf16, .-plain_run_utf16
+	.type	plain_run_utf32, @function
+plain_run_utf32:
+.LVL74:
+.LFB581:
+	.loc 1 1023 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1024 5 view .LVU244
+	.loc 1 1025 5 view .LVU245
+	.loc 1 1023 1 is_stmt 0 view .LVU246
+	movq	%rdi, %rax
+	movq	%rdx, %r8
+.LBB428:
+.LBB429:
+	.loc 1 939 5 view .LVU247
+	leaq	.L96(%rip), %r9
+.LBE429:
+.LBE428:
+	.loc 1 1023 1 view .LVU248
+	movq	%rsi, %rdi
+.LVL75:
+	.loc 1 1024 12 view .LVU249
+	xorl	%esi, %esi
+.LVL76:
+.L93:
+	.loc 1 1025 20 is_stmt 1 view .LVU250
+	cmpq	%r8, %rsi
+	je	.L92
+.LBB434:
+.LBB430:
+	.loc 1 939 5 is_stmt 0 discriminator 1 view .LVU251
+	movl	8(%rax), %edx
+.LBE430:
+.LBE434:
+	.loc 1 1025 23 discriminator 1 view .LVU252
+	movl	(%rdi,%rsi,4), %ecx
+.LVL77:
+.LBB435:
+.LBI428:
+	.loc 1 937 19 is_stmt 1 discriminator 1 view .LVU253
+.LBB431:
+	.loc 1 939 5 discriminator 1 view .LVU254
+	decl	%edx
+	cmpl	$4, %edx
+	ja	.L92
+	movslq	(%r9,%rdx,4), %rdx
+	addq	%r9, %rdx
+	jmp	*%rdx
+	.section	.rodata
+	.align 4
+	.align 4
+.L96:
+	.long	.L100-.L96
+	.long	.L99-.L96
+	.long	.L98-.L96
+	.long	.L97-.L96
+	.long	.L95-.L96
+	.text
+.L100:
+	.loc 1 941 9 view .LVU255
+	.loc 1 941 19 is_stmt 0 view .LVU256
+	cmpl	$39, %ecx
+	ja	.L101
+	movl	$4294967163, %edx
+	salq	$32, %rdx
+	sarq	%cl, %rdx
+	.loc 1 941 72 view .LVU257
+	andb	$1, %dl
+	jmp	.L113
+.L101:
+	cmpl	$127, %ecx
+	je	.L92
+	cmpl	$92, %ecx
+	jmp	.L113
+.L99:
+	.loc 1 943 9 is_stmt 1 view .LVU258
+	.loc 1 943 28 is_stmt 0 view .LVU259
+	leal	-32(%rcx), %edx
+	cmpl	$94, %edx
+	.loc 1 943 48 view .LVU260
+	movb	$1, %dl
+	.loc 1 943 28 view .LVU261
+	setbe	%r10b
+	.loc 1 943 48 view .LVU262
+	subl	$34, %ecx
+.LVL78:
+	.loc 1 943 48 view .LVU263
+	cmpl	$58, %ecx
+	ja	.L103
+	movabsq	$-288230376151711778, %rdx
+	sarq	%cl, %rdx
+	andl	$1, %edx
+.L103:
+	.loc 1 943 71 view .LVU264
+	testb	%r10b, %r10b
+	je	.L92
+	testb	%dl, %dl
+	jmp	.L113
+.LVL79:
+.L98:
+	.loc 1 945 9 is_stmt 1 view .LVU265
+	.loc 1 945 9 is_stmt 0 view .LVU266
+.LBE431:
+.LBE435:
+	.loc 1 1025 20 view .LVU267
+	cmpl	$39, %ecx
+	jmp	.L113
+.LVL80:
+.L97:
+.LBB436:
+.LBB432:
+	.loc 1 947 9 is_stmt 1 view .LVU268
+	.loc 1 947 28 is_stmt 0 view .LVU269
+	leal	-43(%rcx), %edx
+	.loc 1 947 57 view .LVU270
+	cmpl	$14, %edx
+	ja	.L115
+.LVL81:
+.L102:
+	.loc 1 947 57 view .LVU271
+.LBE432:
+.LBE436:
+	.loc 1 1026 9 is_stmt 1 view .LVU272
+	.loc 1 1026 10 is_stmt 0 view .LVU273
+	incq	%rsi
+.LVL82:
+	.loc 1 1026 10 view .LVU274
+	jmp	.L93
+.LVL83:
+.L115:
+.LBB437:
+.LBB433:
+	.loc 1 947 57 view .LVU275
+	cmpl	$95, %ecx
+	je	.L102
+	.loc 1 948 18 view .LVU276
+	orl	$32, %ecx
+.LVL84:
+	.loc 1 948 34 view .LVU277
+	subl	$97, %ecx
+	.loc 1 947 57 view .LVU278
+	cmpl	$25, %ecx
+	jbe	.L102
+	jmp	.L92
+.LVL85:
+.L95:
+	.loc 1 950 9 is_stmt 1 view .LVU279
+	.loc 1 950 53 is_stmt 0 view .LVU280
+	cmpl	$127, %ecx
+	ja	.L105
+.LVL86:
+	.loc 1 950 37 view .LVU281
+	movq	(%rax), %rdx
+.LBE433:
+.LBE437:
+	.loc 1 1025 20 view .LVU282
+	movb	(%rdx,%rcx), %cl
+	cmpb	%cl, 12(%rax)
+	jnb	.L102
+	jmp	.L92
+.LVL87:
+.L105:
+	.loc 1 1025 20 view .LVU283
+	cmpb	$0, 13(%rax)
+.L113:
+	.loc 1 1025 20 view .LVU284
+	jne	.L102
+.L92:
+	.loc 1 1029 1 view .LVU285
+	movq	%rsi, %rax
+.LVL88:
+	.loc 1 1029 1 view .LVU286
+	ret
+	.cfi_endproc
+.LFE581:
+	.size	plain_run_utf32, .-plain_run_utf32
+	.type	arr1_utf64_take, @function
+arr1_utf64_take:
+.LVL89:
+.LFB592:
+	.loc 1 1625 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1626 5 view .LVU288
+	.loc 1 1626 14 is_stmt 0 view .LVU289
+	movq	8(%rdi), %rax
+	.loc 1 1626 28 view .LVU290
+	cmpq	%rsi, %rax
+	je	.L118
+	testq	%rax, %rax
+	je	.L118
+	.loc 1 1629 5 is_stmt 1 view .LVU291
+	.loc 1 1629 24 is_stmt 0 view .LVU292
+	movq	(%rax), %rdx
+.LVL90:
+	.loc 1 1630 5 is_stmt 1 view .LVU293
+	.loc 1 1630 15 is_stmt 0 view .LVU294
+	xorl	%eax, %eax
+	movq	%rax, 8(%rdi)
+	.loc 1 1632 5 is_stmt 1 view .LVU295
+	.loc 1 1632 14 is_stmt 0 view .LVU296
+	movl	%edx, %eax
+	andl	$16777215, %eax
+.LVL91:
+	.loc 1 1633 5 is_stmt 1 view .LVU297
+	.loc 1 1633 8 is_stmt 0 view .LVU298
+	cmpq	$16777215, %rdx
+	jbe	.L116
+	.loc 1 1634 9 is_stmt 1 view .LVU299
+	.loc 1 1634 18 is_stmt 0 view .LVU300
+	orl	$520093696, %eax
+.LVL92:
+	.loc 1 1634 18 view .LVU301
+	ret
+.LVL93:
+.L118:
+	.loc 1 1627 16 view .LVU302
+	orl	$-1, %eax
+.L116:
+	.loc 1 1637 1 view .LVU303
+	ret
+	.cfi_endproc
+.LFE592:
+	.size	arr1_utf64_take, .-arr1_utf64_take
+	.type	arr1_utf64_end, @function
+arr1_utf64_end:
+.LVL94:
+.LFB593:
+	.loc 1 1640 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1641 5 view .LVU305
+	.loc 1 1644 11 is_stmt 0 view .LVU306
+	xorl	%eax, %eax
+	.loc 1 1641 8 view .LVU307
+	testq	%rsi, %rsi
+	jne	.L119
+	.loc 1 1642 9 is_stmt 1 view .LVU308
+	.loc 1 1642 20 is_stmt 0 view .LVU309
+	movq	8(%rdi), %rax
+.L119:
+	.loc 1 1645 1 view .LVU310
+	ret
+	.cfi_endproc
+.LFE593:
+	.size	arr1_utf64_end, .-arr1_utf64_end
+	.type	iter_take_pat, @function
+iter_take_pat:
+.LVL95:
+.LFB598:
+	.loc 1 1795 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1796 5 view .LVU312
+	.loc 1 1796 22 is_stmt 0 view .LVU313
+	movq	8(%rsi), %rax
+	.loc 1 1797 12 view .LVU314
+	xorl	%edx, %edx
+	.loc 1 1796 16 view .LVU315
+	movq	%rax, 16(%rdi)
+	.loc 1 1797 5 is_stmt 1 view .LVU316
+	.loc 1 1797 12 is_stmt 0 view .LVU317
+	jmp	iter_take
+.LVL96:
+	.loc 1 1797 12 view .LVU318
+	.cfi_endproc
+.LFE598:
+	.size	iter_take_pat, .-iter_take_pat
+	.type	set_ast, @function
+set_ast:
+.LVL97:
+.LFB603:
+	.loc 1 2142 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2143 5 view .LVU320
+	.loc 1 2143 17 is_stmt 0 view .LVU321
+	movl	32(%rdi), %eax
+	.loc 1 2143 24 view .LVU322
+	movl	%eax, %ecx
+	shrl	$13, %ecx
+	.loc 1 2143 37 view .LVU323
+	movl	%ecx, %edx
+	andl	$7, %edx
+	.loc 1 2143 5 view .LVU324
+	cmpl	$3, %edx
+	je	.L124
+	andb	$4, %cl
+	jne	.L125
+	testl	%edx, %edx
+	je	.L126
+	cmpl	$2, %edx
+	je	.L127
+	jmp	.L135
+.L125:
+	cmpl	$4, %edx
+	je	.L129
+.L135:
+	movb	$1, %al
+	ret
+.L127:
+	.loc 1 2145 9 is_stmt 1 view .LVU325
+	.loc 1 2145 12 is_stmt 0 view .LVU326
+	testq	%rsi, %rsi
+	jns	.L130
+	.loc 1 2146 13 is_stmt 1 view .LVU327
+	.loc 1 2146 20 is_stmt 0 view .LVU328
+	orl	$8, %eax
+	.loc 1 2147 15 view .LVU329
+	negq	%rsi
+.LVL98:
+	.loc 1 2146 20 view .LVU330
+	movl	%eax, 32(%rdi)
+	.loc 1 2147 13 is_stmt 1 view .LVU331
+.LVL99:
+.L130:
+	.loc 1 2149 9 view .LVU332
+	.loc 1 2149 18 is_stmt 0 view .LVU333
+	movl	$2147483646, %eax
+	cmpq	%rax, %rsi
+	cmovg	%rax, %rsi
+.LVL100:
+	.loc 1 2149 18 view .LVU334
+	movl	%esi, 24(%rdi)
+	.loc 1 2150 9 is_stmt 1 view .LVU335
+	.loc 1 2150 16 is_stmt 0 view .LVU336
+	jmp	.L131
+.LVL101:
+.L124:
+	.loc 1 2153 9 is_stmt 1 view .LVU337
+	.loc 1 2153 17 is_stmt 0 view .LVU338
+	movl	$2147483646, %eax
+	cmpq	$2147483645, %rsi
+	jg	.L132
+	.loc 1 2153 17 discriminator 1 view .LVU339
+	movl	%esi, %eax
+	andl	$2147483647, %eax
+.L132:
+	.loc 1 2153 17 discriminator 4 view .LVU340
+	movl	%eax, 28(%rdi)
+	.loc 1 2154 9 is_stmt 1 discriminator 4 view .LVU341
+.LVL102:
+.L131:
+	.loc 1 2150 16 is_stmt 0 view .LVU342
+	xorl	%eax, %eax
+	.loc 1 2166 1 view .LVU343
+	ret
+.LVL103:
+.L129:
+	.loc 1 2157 9 is_stmt 1 view .LVU344
+.LBB438:
+	.loc 1 2157 25 view .LVU345
+	.loc 1 2157 62 view .LVU346
+	.loc 1 2157 101 is_stmt 0 view .LVU347
+	andb	$31, %ah
+	.loc 1 2157 123 view .LVU348
+	orb	$32, %ah
+	jmp	.L134
+.LVL104:
+.L126:
+	.loc 1 2157 123 view .LVU349
+.LBE438:
+	.loc 1 2161 9 is_stmt 1 view .LVU350
+.LBB439:
+.LBI439:
+	.loc 2 425 20 view .LVU351
+.LBB440:
+	.loc 2 427 5 view .LVU352
+	.loc 2 427 8 is_stmt 0 view .LVU353
+	testl	$939524096, %eax
+	jne	.L131
+	.loc 2 428 9 is_stmt 1 view .LVU354
+.LBB441:
+	.loc 2 428 25 view .LVU355
+.LVL105:
+	.loc 2 428 62 view .LVU356
+	.loc 2 428 101 is_stmt 0 view .LVU357
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU358
+	orl	$805306368, %eax
+.LVL106:
+.L134:
+	.loc 2 428 123 view .LVU359
+	movl	%eax, 32(%rdi)
+	jmp	.L131
+.LBE441:
+.LBE440:
+.LBE439:
+	.cfi_endproc
+.LFE603:
+	.size	set_ast, .-set_ast
+	.type	ensure_init_stream, @function
+ensure_init_stream:
+.LVL107:
+.LFB604:
+	.loc 1 2169 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2171 5 view .LVU361
+	.loc 1 2171 11 is_stmt 0 view .LVU362
+	movl	32(%rdi), %eax
+	.loc 1 2171 8 view .LVU363
+	testb	$-128, %al
+	jne	.L136
+	.loc 1 2172 9 is_stmt 1 view .LVU364
+	.loc 1 2173 9 view .LVU365
+.LBB442:
+	.loc 1 2173 25 view .LVU366
+.LVL108:
+	.loc 1 2173 62 view .LVU367
+	.loc 1 2173 96 view .LVU368
+	.loc 1 2173 108 view .LVU369
+	.loc 1 2173 120 view .LVU370
+	.loc 1 2173 101 is_stmt 0 view .LVU371
+	orb	$-96, %al
+	.loc 1 2173 125 view .LVU372
+	xorl	$32, %eax
+	movl	%eax, 32(%rdi)
+.LBE442:
+	.loc 1 2174 9 is_stmt 1 view .LVU373
+	.loc 1 2174 20 is_stmt 0 view .LVU374
+	movq	(%rdi), %rax
+	movq	(%rax), %rax
+	.loc 1 2174 12 view .LVU375
+	testq	%rax, %rax
+	je	.L136
+	.loc 1 2175 13 is_stmt 1 view .LVU376
+	jmp	*%rax
+.LVL109:
+.L136:
+	.loc 1 2178 1 is_stmt 0 view .LVU377
+	ret
+	.cfi_endproc
+.LFE604:
+	.size	ensure_init_stream, .-ensure_init_stream
+	.type	finish, @function
+finish:
+.LVL110:
+.LFB606:
+	.loc 1 2191 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2192 5 view .LVU379
+	.loc 1 2192 11 is_stmt 0 view .LVU380
+	movl	32(%rdi), %eax
+	.loc 1 2192 8 view .LVU381
+	testb	$-128, %al
+	je	.L143
+	.loc 1 2195 5 is_stmt 1 view .LVU382
+.LBB443:
+	.loc 1 2195 21 view .LVU383
+.LVL111:
+	.loc 1 2195 58 view .LVU384
+	.loc 1 2195 92 view .LVU385
+	.loc 1 2195 104 view .LVU386
+	.loc 1 2195 116 view .LVU387
+	.loc 1 2195 121 is_stmt 0 view .LVU388
+	andb	$127, %al
+	movl	%eax, 32(%rdi)
+.LBE443:
+	.loc 1 2196 5 is_stmt 1 view .LVU389
+	.loc 1 2196 16 is_stmt 0 view .LVU390
+	movq	(%rdi), %rax
+	movq	16(%rax), %rax
+	.loc 1 2196 8 view .LVU391
+	testq	%rax, %rax
+	je	.L143
+	.loc 1 2197 9 is_stmt 1 view .LVU392
+	jmp	*%rax
+.LVL112:
+.L143:
+	.loc 1 2199 1 is_stmt 0 view .LVU393
+	ret
+	.cfi_endproc
+.LFE606:
+	.size	finish, .-finish
+	.type	format_scratch_put, @function
+format_scratch_put:
+.LVL113:
+.LFB610:
+	.loc 1 2246 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2247 5 view .LVU395
+	.loc 1 2248 5 view .LVU396
+	.loc 1 2249 1 is_stmt 0 view .LVU397
+	ret
+	.cfi_endproc
+.LFE610:
+	.size	format_scratch_put, .-format_scratch_put
+	.type	quotation_get, @function
+quotation_get:
+.LVL114:
+.LFB556:
+	.loc 1 448 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 449 5 view .LVU399
+	.loc 1 449 33 is_stmt 0 view .LVU400
+	movzwl	34(%rdi), %eax
+	.loc 1 450 10 view .LVU401
+	movq	56(%rdi), %rdx
+	.loc 1 449 14 view .LVU402
+	andl	$7, %eax
+.LVL115:
+	.loc 1 450 5 is_stmt 1 view .LVU403
+	.loc 1 450 8 is_stmt 0 view .LVU404
+	testq	%rdx, %rdx
+	jne	.L155
+	.loc 1 453 5 is_stmt 1 view .LVU405
+	.loc 1 453 28 is_stmt 0 view .LVU406
+	movq	%fs:va_quote_thread@tpoff, %rdx
+.LVL116:
+	.loc 1 454 5 is_stmt 1 view .LVU407
+	.loc 1 454 8 is_stmt 0 view .LVU408
+	testq	%rdx, %rdx
+	je	.L154
+.LVL117:
+.L155:
+	.loc 1 455 9 is_stmt 1 view .LVU409
+	.loc 1 455 20 is_stmt 0 view .LVU410
+	movq	(%rdx,%rax,8), %rax
+	ret
+.LVL118:
+.L154:
+	.loc 1 457 5 is_stmt 1 view .LVU411
+.LBB444:
+	.loc 1 457 28 view .LVU412
+	.loc 1 457 14 view .LVU413
+	.loc 1 457 74 view .LVU414
+	leaq	va_quote(%rip), %rdx
+.LVL119:
+	.loc 1 457 74 is_stmt 0 view .LVU415
+	movq	(%rdx,%rax,8), %rax
+.LVL120:
+	.loc 1 457 15 is_stmt 1 view .LVU416
+.LBE444:
+	.loc 1 458 1 is_stmt 0 view .LVU417
+	ret
+	.cfi_endproc
+.LFE556:
+	.size	quotation_get, .-quotation_get
+	.type	iter_copy_bulk, @function
+iter_copy_bulk:
+.LVL121:
+.LFB572:
+	.loc 1 758 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 759 5 view .LVU419
+	.loc 1 759 8 is_stmt 0 view .LVU420
+	cmpq	$0, 8(%rsi)
+	je	.L167
+	.loc 1 758 1 view .LVU421
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	.loc 1 764 12 view .LVU422
+	movl	$1, %r14d
+	.loc 1 758 1 view .LVU423
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	.loc 1 762 5 is_stmt 1 view .LVU424
+	.loc 1 758 1 is_stmt 0 view .LVU425
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	.loc 1 762 32 view .LVU426
+	movq	(%rsi), %rax
+.LBB445:
+	.loc 1 766 20 view .LVU427
+	leaq	8(%rsp), %r15
+.LBE445:
+	.loc 1 762 32 view .LVU428
+	movzbl	51(%rax), %r12d
+	.loc 1 762 14 view .LVU429
+	decl	%r12d
+.LVL122:
+	.loc 1 764 5 is_stmt 1 view .LVU430
+	.loc 1 764 12 is_stmt 0 view .LVU431
+	movl	%r12d, %ecx
+	sall	%cl, %r14d
+.LVL123:
+.L159:
+	.loc 1 764 12 is_stmt 1 view .LVU432
+	movq	%r14, %rcx
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_reserve_bulk
+.LVL124:
+	testb	%al, %al
+	je	.L156
+.LBB454:
+	.loc 1 765 9 view .LVU433
+	.loc 1 766 9 view .LVU434
+.LVL125:
+.LBB446:
+.LBI446:
+	.loc 2 574 22 view .LVU435
+.LBB447:
+	.loc 2 576 5 view .LVU436
+	.loc 2 576 5 is_stmt 0 view .LVU437
+.LBE447:
+.LBE446:
+	.loc 1 766 30 view .LVU438
+	movq	0(%rbp), %rax
+.LBB450:
+.LBB448:
+	.loc 2 576 39 view .LVU439
+	movq	48(%rbx), %rdx
+.LBE448:
+.LBE450:
+	.loc 1 766 20 view .LVU440
+	movl	%r12d, %ecx
+	movq	%r13, %rsi
+.LBB451:
+.LBB449:
+	.loc 2 576 39 view .LVU441
+	subq	40(%rbx), %rdx
+.LBE449:
+.LBE451:
+	.loc 1 766 20 view .LVU442
+	movq	%rbp, %rdi
+	shrq	%cl, %rdx
+	movq	%r15, %rcx
+	call	*32(%rax)
+.LVL126:
+	movq	%rax, %rdx
+.LVL127:
+	.loc 1 767 9 is_stmt 1 view .LVU443
+	.loc 1 767 12 is_stmt 0 view .LVU444
+	testq	%rax, %rax
+	je	.L156
+	.loc 1 770 9 is_stmt 1 view .LVU445
+	movl	%r12d, %ecx
+	movq	8(%rbp), %rsi
+	movq	40(%rbx), %rdi
+	salq	%cl, %rax
+.LVL128:
+	.loc 1 770 9 is_stmt 0 view .LVU446
+	movq	%rax, %rcx
+	rep movsb
+	.loc 1 771 9 is_stmt 1 view .LVU447
+	.loc 1 772 9 is_stmt 0 view .LVU448
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	.loc 1 771 40 view .LVU449
+	addq	%rax, 40(%rbx)
+	.loc 1 772 9 is_stmt 1 view .LVU450
+	movq	8(%rsp), %rcx
+	call	iter_skip
+.LVL129:
+	.loc 1 773 9 view .LVU451
+.LBB452:
+.LBI452:
+	.loc 2 574 22 view .LVU452
+.LBB453:
+	.loc 2 576 5 view .LVU453
+	.loc 2 576 39 is_stmt 0 view .LVU454
+	movq	48(%rbx), %rax
+	subq	40(%rbx), %rax
+.LBE453:
+.LBE452:
+	.loc 1 773 12 view .LVU455
+	cmpq	$3, %rax
+	jbe	.L159
+.LVL130:
+.L156:
+	.loc 1 773 12 view .LVU456
+.LBE454:
+	.loc 1 778 1 view .LVU457
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL131:
+	.loc 1 778 1 view .LVU458
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL132:
+	.loc 1 778 1 view .LVU459
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL133:
+	.loc 1 778 1 view .LVU460
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL134:
+	.loc 1 778 1 view .LVU461
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+.LVL135:
+.L167:
+	.cfi_restore 3
+	.cfi_restore 6
+	.cfi_restore 12
+	.cfi_restore 13
+	.cfi_restore 14
+	.cfi_restore 15
+	.loc 1 778 1 view .LVU462
+	ret
+	.cfi_endproc
+.LFE572:
+	.size	iter_copy_bulk, .-iter_copy_bulk
+	.type	plain_run_utf8, @function
+plain_run_utf8:
+.LVL136:
+.LFB579:
+	.loc 1 996 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 997 5 view .LVU464
+	.loc 1 1000 5 view .LVU465
+	.loc 1 996 1 is_stmt 0 view .LVU466
+	movq	%rdi, %r8
+	.loc 1 997 12 view .LVU467
+	xorl	%eax, %eax
+	.loc 1 996 1 view .LVU468
+	movq	%rdx, %rdi
+.LVL137:
+	.loc 1 1000 15 view .LVU469
+	movl	8(%r8), %ecx
+	.loc 1 1000 28 is_stmt 1 view .LVU470
+	cmpl	$5, %ecx
+	je	.L172
+.LBB455:
+.LBB456:
+.LBB457:
+.LBB458:
+.LBB459:
+.LBB460:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 3 1323 33 is_stmt 0 view .LVU471
+	movaps	.LC5(%rip), %xmm1
+.LBE460:
+.LBE459:
+.LBB464:
+.LBB465:
+	.loc 3 1371 34 view .LVU472
+	movaps	.LC6(%rip), %xmm2
+.LBE465:
+.LBE464:
+.LBB469:
+.LBB470:
+	movaps	.LC7(%rip), %xmm3
+.LBE470:
+.LBE469:
+.LBB475:
+.LBB476:
+	.loc 3 1335 34 view .LVU473
+	movaps	.LC8(%rip), %xmm4
+.LBE476:
+.LBE475:
+.LBB479:
+.LBB480:
+	.loc 3 1371 34 view .LVU474
+	movaps	.LC9(%rip), %xmm5
+.LBE480:
+.LBE479:
+.LBB484:
+.LBB485:
+	movaps	.LC10(%rip), %xmm6
+.LBE485:
+.LBE484:
+.LBE458:
+.LBB523:
+.LBB524:
+.LBB525:
+	movaps	.LC0(%rip), %xmm7
+.LBE525:
+.LBE524:
+.LBB527:
+.LBB528:
+	.loc 3 1335 34 view .LVU475
+	movaps	.LC1(%rip), %xmm8
+.LBE528:
+.LBE527:
+.LBB532:
+.LBB533:
+	movaps	.LC2(%rip), %xmm9
+.LBE533:
+.LBE532:
+.LBB536:
+.LBB537:
+	movaps	.LC3(%rip), %xmm10
+.LVL138:
+.L171:
+	.loc 3 1335 34 view .LVU476
+.LBE537:
+.LBE536:
+.LBE523:
+.LBE457:
+.LBE456:
+.LBE455:
+	.loc 1 1000 28 view .LVU477
+	movq	%rdi, %rdx
+	subq	%rax, %rdx
+	cmpq	$15, %rdx
+	jbe	.L172
+.LBB596:
+	.loc 1 1001 9 is_stmt 1 view .LVU478
+.LVL139:
+.LBB590:
+.LBI590:
+	.loc 3 701 1 view .LVU479
+.LBB591:
+	.loc 3 703 3 view .LVU480
+	.loc 3 703 10 is_stmt 0 view .LVU481
+	movups	(%rsi,%rax), %xmm11
+	movaps	%xmm11, %xmm0
+.LVL140:
+	.loc 3 703 10 view .LVU482
+.LBE591:
+.LBE590:
+.LBB593:
+.LBI456:
+	.loc 1 960 24 is_stmt 1 view .LVU483
+.LBB588:
+	.loc 1 962 5 view .LVU484
+	.loc 1 963 5 view .LVU485
+	cmpl	$3, %ecx
+	je	.L173
+.LVL141:
+.L176:
+	.loc 1 963 5 is_stmt 0 view .LVU486
+	cmpl	$3, %ecx
+	ja	.L174
+	leal	-1(%rcx), %edx
+	cmpl	$1, %edx
+	jbe	.L175
+.LVL142:
+	.loc 1 963 5 view .LVU487
+.LBE588:
+.LBE593:
+.LBE596:
+	.loc 1 1000 51 is_stmt 1 view .LVU488
+	addq	$16, %rax
+.LVL143:
+	.loc 1 1000 28 view .LVU489
+	movq	%rdi, %rdx
+	subq	%rax, %rdx
+	cmpq	$15, %rdx
+	jbe	.L203
+.LBB597:
+	.loc 1 1001 9 view .LVU490
+.LVL144:
+.LBB594:
+	.loc 3 701 1 view .LVU491
+.LBB592:
+	.loc 3 703 3 view .LVU492
+	.loc 3 703 10 is_stmt 0 view .LVU493
+	movups	(%rsi,%rax), %xmm0
+.LVL145:
+	.loc 3 703 10 view .LVU494
+.LBE592:
+.LBE594:
+.LBB595:
+	.loc 1 960 24 is_stmt 1 view .LVU495
+.LBB589:
+	.loc 1 962 5 view .LVU496
+	.loc 1 963 5 view .LVU497
+	jmp	.L176
+.LVL146:
+.L174:
+	.loc 1 963 5 is_stmt 0 view .LVU498
+	cmpl	$4, %ecx
+	jne	.L178
+.LBB578:
+	.loc 1 980 9 is_stmt 1 view .LVU499
+.LVL147:
+.LBB489:
+.LBI459:
+	.loc 3 1321 1 view .LVU500
+.LBB461:
+	.loc 3 1323 3 view .LVU501
+	.loc 3 1323 3 is_stmt 0 view .LVU502
+.LBE461:
+.LBE489:
+	.loc 1 981 9 is_stmt 1 view .LVU503
+.LBB490:
+.LBI469:
+	.loc 3 1369 1 view .LVU504
+.LBB471:
+	.loc 3 1371 3 view .LVU505
+	.loc 3 1371 3 is_stmt 0 view .LVU506
+.LBE471:
+.LBE490:
+.LBB491:
+.LBI464:
+	.loc 3 1369 1 is_stmt 1 view .LVU507
+.LBB466:
+	.loc 3 1371 3 view .LVU508
+	.loc 3 1371 3 is_stmt 0 view .LVU509
+.LBE466:
+.LBE491:
+.LBB492:
+.LBI492:
+	.loc 3 1309 1 is_stmt 1 view .LVU510
+.LBB493:
+	.loc 3 1311 3 view .LVU511
+	.loc 3 1311 3 is_stmt 0 view .LVU512
+.LBE493:
+.LBE492:
+	.loc 1 982 9 is_stmt 1 view .LVU513
+.LBB495:
+.LBI484:
+	.loc 3 1369 1 view .LVU514
+.LBB486:
+	.loc 3 1371 3 view .LVU515
+.LBE486:
+.LBE495:
+.LBB496:
+.LBB472:
+	.loc 3 1371 34 is_stmt 0 view .LVU516
+	movaps	%xmm0, %xmm14
+.LBE472:
+.LBE496:
+.LBB497:
+.LBB467:
+	movaps	%xmm0, %xmm13
+.LBE467:
+.LBE497:
+.LBB498:
+.LBB473:
+	xorps	%xmm12, %xmm12
+	pcmpgtb	%xmm3, %xmm14
+.LBE473:
+.LBE498:
+.LBB499:
+.LBB468:
+	pcmpgtb	%xmm2, %xmm13
+.LBE468:
+.LBE499:
+.LBB500:
+.LBB462:
+	.loc 3 1323 33 view .LVU517
+	movaps	%xmm0, %xmm11
+.LBE462:
+.LBE500:
+.LBB501:
+.LBB477:
+	.loc 3 1335 34 view .LVU518
+	pcmpeqb	%xmm4, %xmm0
+.LVL148:
+	.loc 3 1335 34 view .LVU519
+.LBE477:
+.LBE501:
+.LBB502:
+.LBB463:
+	.loc 3 1323 33 view .LVU520
+	orps	%xmm1, %xmm11
+.LVL149:
+	.loc 3 1323 33 view .LVU521
+.LBE463:
+.LBE502:
+.LBB503:
+.LBI479:
+	.loc 3 1369 1 is_stmt 1 view .LVU522
+.LBB481:
+	.loc 3 1371 3 view .LVU523
+	.loc 3 1371 3 is_stmt 0 view .LVU524
+.LBE481:
+.LBE503:
+.LBB504:
+.LBI504:
+	.loc 3 1309 1 is_stmt 1 view .LVU525
+.LBB505:
+	.loc 3 1311 3 view .LVU526
+	.loc 3 1311 3 is_stmt 0 view .LVU527
+.LBE505:
+.LBE504:
+	.loc 1 983 9 is_stmt 1 view .LVU528
+.LBB507:
+.LBI475:
+	.loc 3 1333 1 view .LVU529
+.LBB478:
+	.loc 3 1335 3 view .LVU530
+	.loc 3 1335 3 is_stmt 0 view .LVU531
+.LBE478:
+.LBE507:
+.LBB508:
+.LBI508:
+	.loc 3 1321 1 is_stmt 1 view .LVU532
+.LBB509:
+	.loc 3 1323 3 view .LVU533
+	.loc 3 1323 3 is_stmt 0 view .LVU534
+.LBE509:
+.LBE508:
+	.loc 1 984 9 is_stmt 1 view .LVU535
+.LBB512:
+.LBI512:
+	.loc 3 1431 1 view .LVU536
+.LBB513:
+	.loc 3 1433 3 view .LVU537
+	.loc 3 1433 3 is_stmt 0 view .LVU538
+.LBE513:
+.LBE512:
+.LBB514:
+.LBB474:
+	.loc 3 1371 34 view .LVU539
+	pcmpeqb	%xmm12, %xmm14
+.LBE474:
+.LBE514:
+.LBB515:
+.LBB494:
+	.loc 3 1311 33 view .LVU540
+	andps	%xmm14, %xmm13
+.LBE494:
+.LBE515:
+.LBB516:
+.LBB510:
+	.loc 3 1323 33 view .LVU541
+	orps	%xmm13, %xmm0
+.LBE510:
+.LBE516:
+.LBB517:
+.LBB482:
+	.loc 3 1371 34 view .LVU542
+	movaps	%xmm11, %xmm13
+.LBE482:
+.LBE517:
+.LBB518:
+.LBB487:
+	pcmpgtb	%xmm6, %xmm11
+.LBE487:
+.LBE518:
+.LBB519:
+.LBB483:
+	pcmpgtb	%xmm5, %xmm13
+.LBE483:
+.LBE519:
+.LBB520:
+.LBB488:
+	pcmpeqb	%xmm12, %xmm11
+.LBE488:
+.LBE520:
+.LBB521:
+.LBB506:
+	.loc 3 1311 33 view .LVU543
+	andps	%xmm13, %xmm11
+.LBE506:
+.LBE521:
+.LBB522:
+.LBB511:
+	.loc 3 1323 33 view .LVU544
+	orps	%xmm11, %xmm0
+.LBE511:
+.LBE522:
+	.loc 1 984 16 view .LVU545
+	pmovmskb	%xmm0, %edx
+	.loc 1 984 50 view .LVU546
+	xorl	$65535, %edx
+	jmp	.L180
+.LVL150:
+.L175:
+	.loc 1 984 50 view .LVU547
+.LBE578:
+.LBB579:
+	.loc 1 967 9 is_stmt 1 view .LVU548
+.LBB541:
+.LBI524:
+	.loc 3 1369 1 view .LVU549
+.LBB526:
+	.loc 3 1371 3 view .LVU550
+	.loc 3 1371 34 is_stmt 0 view .LVU551
+	movaps	%xmm0, %xmm13
+	xorps	%xmm14, %xmm14
+	.loc 3 1371 36 view .LVU552
+	movaps	%xmm0, %xmm12
+	.loc 3 1371 34 view .LVU553
+	pcmpgtb	%xmm7, %xmm13
+	pcmpeqb	%xmm14, %xmm13
+	.loc 3 1371 10 view .LVU554
+	movaps	%xmm13, %xmm11
+.LVL151:
+	.loc 3 1371 10 view .LVU555
+.LBE526:
+.LBE541:
+	.loc 1 968 9 is_stmt 1 view .LVU556
+	.loc 1 968 12 is_stmt 0 view .LVU557
+	cmpl	$1, %ecx
+	jne	.L179
+	.loc 1 969 13 is_stmt 1 view .LVU558
+.LVL152:
+.LBB542:
+.LBI542:
+	.loc 3 1369 1 view .LVU559
+.LBB543:
+	.loc 3 1371 3 view .LVU560
+	.loc 3 1371 3 is_stmt 0 view .LVU561
+.LBE543:
+.LBE542:
+.LBB545:
+.LBI545:
+	.loc 3 1315 1 is_stmt 1 view .LVU562
+.LBB546:
+	.loc 3 1317 3 view .LVU563
+.LBE546:
+.LBE545:
+.LBB548:
+.LBB544:
+	.loc 3 1371 34 is_stmt 0 view .LVU564
+	pcmpgtb	%xmm0, %xmm14
+.LBE544:
+.LBE548:
+.LBB549:
+.LBB547:
+	.loc 3 1317 19 view .LVU565
+	movaps	%xmm14, %xmm11
+.LVL153:
+	.loc 3 1317 19 view .LVU566
+	andnps	%xmm13, %xmm11
+.LVL154:
+.L179:
+	.loc 3 1317 19 view .LVU567
+.LBE547:
+.LBE549:
+	.loc 1 971 9 is_stmt 1 view .LVU568
+.LBB550:
+.LBI527:
+	.loc 3 1333 1 view .LVU569
+.LBB529:
+	.loc 3 1335 3 view .LVU570
+	.loc 3 1335 3 is_stmt 0 view .LVU571
+.LBE529:
+.LBE550:
+.LBB551:
+.LBI551:
+	.loc 3 1321 1 is_stmt 1 view .LVU572
+.LBB552:
+	.loc 3 1323 3 view .LVU573
+	.loc 3 1323 3 is_stmt 0 view .LVU574
+.LBE552:
+.LBE551:
+	.loc 1 972 9 is_stmt 1 view .LVU575
+.LBB553:
+.LBI532:
+	.loc 3 1333 1 view .LVU576
+.LBB534:
+	.loc 3 1335 3 view .LVU577
+	.loc 3 1335 3 is_stmt 0 view .LVU578
+.LBE534:
+.LBE553:
+.LBB554:
+.LBI554:
+	.loc 3 1321 1 is_stmt 1 view .LVU579
+.LBB555:
+	.loc 3 1323 3 view .LVU580
+	.loc 3 1323 3 is_stmt 0 view .LVU581
+.LBE555:
+.LBE554:
+	.loc 1 973 9 is_stmt 1 view .LVU582
+.LBB556:
+.LBI536:
+	.loc 3 1333 1 view .LVU583
+.LBB538:
+	.loc 3 1335 3 view .LVU584
+	.loc 3 1335 3 is_stmt 0 view .LVU585
+.LBE538:
+.LBE556:
+.LBB557:
+.LBI557:
+	.loc 3 1321 1 is_stmt 1 view .LVU586
+.LBB558:
+	.loc 3 1323 3 view .LVU587
+	.loc 3 1323 3 is_stmt 0 view .LVU588
+.LBE558:
+.LBE557:
+	.loc 1 974 9 is_stmt 1 view .LVU589
+.LBB559:
+.LBI559:
+	.loc 3 1333 1 view .LVU590
+.LBB560:
+	.loc 3 1335 3 view .LVU591
+	.loc 3 1335 3 is_stmt 0 view .LVU592
+.LBE560:
+.LBE559:
+.LBB562:
+.LBI562:
+	.loc 3 1321 1 is_stmt 1 view .LVU593
+.LBB563:
+	.loc 3 1323 3 view .LVU594
+	.loc 3 1323 3 is_stmt 0 view .LVU595
+.LBE563:
+.LBE562:
+	.loc 1 975 9 is_stmt 1 view .LVU596
+.LBB566:
+.LBI566:
+	.loc 3 1431 1 view .LVU597
+.LBB567:
+	.loc 3 1433 3 view .LVU598
+.LBE567:
+.LBE566:
+.LBB569:
+.LBB530:
+	.loc 3 1335 34 is_stmt 0 view .LVU599
+	movaps	%xmm12, %xmm0
+	.loc 3 1335 34 view .LVU600
+.LBE530:
+.LBE569:
+.LBB570:
+.LBB535:
+	movaps	%xmm12, %xmm13
+	pcmpeqb	%xmm9, %xmm13
+.LBE535:
+.LBE570:
+.LBB571:
+.LBB531:
+	pcmpeqb	%xmm8, %xmm0
+.LVL155:
+	.loc 3 1335 34 view .LVU601
+.LBE531:
+.LBE571:
+.LBB572:
+.LBB564:
+	.loc 3 1323 33 view .LVU602
+	orps	%xmm13, %xmm0
+.LBE564:
+.LBE572:
+.LBB573:
+.LBB539:
+	.loc 3 1335 34 view .LVU603
+	movaps	%xmm12, %xmm13
+.LBE539:
+.LBE573:
+.LBB574:
+.LBB561:
+	pcmpeqb	.LC4(%rip), %xmm12
+.LVL156:
+	.loc 3 1335 34 view .LVU604
+.LBE561:
+.LBE574:
+.LBB575:
+.LBB540:
+	pcmpeqb	%xmm10, %xmm13
+.LVL157:
+	.loc 3 1335 34 view .LVU605
+.LBE540:
+.LBE575:
+.LBB576:
+.LBB565:
+	.loc 3 1323 33 view .LVU606
+	orps	%xmm13, %xmm0
+	orps	%xmm12, %xmm0
+	orps	%xmm11, %xmm0
+.LBE565:
+.LBE576:
+.LBB577:
+.LBB568:
+	.loc 3 1433 10 view .LVU607
+	pmovmskb	%xmm0, %edx
+.LVL158:
+	.loc 3 1433 10 view .LVU608
+.LBE568:
+.LBE577:
+	.loc 1 975 17 view .LVU609
+	jmp	.L180
+.LVL159:
+.L173:
+	.loc 1 975 17 view .LVU610
+.LBE579:
+	.loc 1 978 9 is_stmt 1 view .LVU611
+.LBB580:
+.LBI580:
+	.loc 3 1333 1 view .LVU612
+.LBB581:
+	.loc 3 1335 3 view .LVU613
+	.loc 3 1335 3 is_stmt 0 view .LVU614
+.LBE581:
+.LBE580:
+.LBB583:
+.LBI583:
+	.loc 3 1431 1 is_stmt 1 view .LVU615
+.LBB584:
+	.loc 3 1433 3 view .LVU616
+.LBE584:
+.LBE583:
+.LBB586:
+.LBB582:
+	.loc 3 1335 34 is_stmt 0 view .LVU617
+	pcmpeqb	.LC3(%rip), %xmm11
+.LBE582:
+.LBE586:
+.LBB587:
+.LBB585:
+	.loc 3 1433 10 view .LVU618
+	pmovmskb	%xmm11, %edx
+.LVL160:
+.L180:
+	.loc 3 1433 10 view .LVU619
+.LBE585:
+.LBE587:
+.LBE589:
+.LBE595:
+	.loc 1 1002 9 is_stmt 1 view .LVU620
+	.loc 1 1002 12 is_stmt 0 view .LVU621
+	testl	%edx, %edx
+	je	.L178
+	.loc 1 1003 13 is_stmt 1 view .LVU622
+	.loc 1 1003 32 is_stmt 0 view .LVU623
+	bsfl	%edx, %edx
+.LVL161:
+	.loc 1 1003 24 view .LVU624
+	movslq	%edx, %rdx
+	.loc 1 1003 22 view .LVU625
+	addq	%rdx, %rax
+	ret
+.LVL162:
+.L178:
+	.loc 1 1003 22 view .LVU626
+.LBE597:
+	.loc 1 1000 51 is_stmt 1 view .LVU627
+	addq	$16, %rax
+.LVL163:
+	.loc 1 1000 28 view .LVU628
+	jmp	.L171
+.L203:
+	.loc 1 1000 28 is_stmt 0 view .LVU629
+	xorl	%ecx, %ecx
+.LVL164:
+.L172:
+.LBB598:
+.LBB599:
+	.loc 1 939 5 view .LVU630
+	leal	-1(%rcx), %r11d
+	leaq	.L189(%rip), %r10
+.LVL165:
+	.loc 1 939 5 view .LVU631
+.LBE599:
+.LBE598:
+	.loc 1 1007 20 is_stmt 1 view .LVU632
+.LBB608:
+.LBB600:
+	.loc 1 939 5 is_stmt 0 view .LVU633
+	movq	%r11, %r9
+.LBE600:
+.LBE608:
+	.loc 1 1007 20 view .LVU634
+	cmpq	%rdi, %rax
+	jnb	.L223
+	.loc 1 1007 39 view .LVU635
+	movzbl	(%rsi,%rax), %edx
+	movq	%rdx, %rcx
+.LVL166:
+.LBB609:
+.LBI598:
+	.loc 1 937 19 is_stmt 1 view .LVU636
+.LBB601:
+	.loc 1 939 5 view .LVU637
+	cmpl	$4, %r11d
+	jbe	.L227
+.LVL167:
+.L223:
+	.loc 1 939 5 is_stmt 0 view .LVU638
+.LBE601:
+.LBE609:
+	.loc 1 1011 1 view .LVU639
+	ret
+.LVL168:
+.L227:
+	.loc 1 996 1 view .LVU640
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.L226:
+.LBB610:
+.LBB602:
+	.loc 1 939 5 discriminator 1 view .LVU641
+	movslq	(%r10,%r11,4), %rbx
+	addq	%r10, %rbx
+	jmp	*%rbx
+	.section	.rodata
+	.align 4
+	.align 4
+.L189:
+	.long	.L185-.L189
+	.long	.L186-.L189
+	.long	.L190-.L189
+	.long	.L183-.L189
+	.long	.L188-.L189
+	.text
+.L191:
+	.loc 1 941 72 view .LVU642
+	cmpl	$127, %edx
+	je	.L170
+	.loc 1 941 72 view .LVU643
+	cmpl	$92, %edx
+	je	.L170
+.LVL169:
+	.loc 1 941 72 view .LVU644
+.LBE602:
+.LBE610:
+	.loc 1 1008 9 is_stmt 1 view .LVU645
+	.loc 1 1008 10 is_stmt 0 view .LVU646
+	incq	%rax
+.LVL170:
+	.loc 1 1007 20 is_stmt 1 view .LVU647
+	cmpq	%rdi, %rax
+	jnb	.L170
+	.loc 1 1007 39 is_stmt 0 view .LVU648
+	movzbl	(%rsi,%rax), %edx
+	movl	%edx, %ecx
+.LVL171:
+.LBB611:
+	.loc 1 937 19 is_stmt 1 view .LVU649
+.LBB603:
+	.loc 1 939 5 view .LVU650
+.L185:
+	.loc 1 941 9 view .LVU651
+	.loc 1 941 19 is_stmt 0 view .LVU652
+	cmpb	$39, %cl
+	ja	.L191
+	.loc 1 941 72 view .LVU653
+	cmpl	$127, %edx
+	je	.L170
+	.loc 1 941 19 view .LVU654
+	movl	$4294967163, %edx
+.LVL172:
+	.loc 1 941 19 view .LVU655
+	salq	$32, %rdx
+	sarq	%cl, %rdx
+	.loc 1 941 72 view .LVU656
+	andb	$1, %dl
+	jmp	.L228
+.LVL173:
+.L195:
+	.loc 1 943 71 view .LVU657
+	testb	%r8b, %r8b
+	je	.L170
+	testb	%dl, %dl
+	je	.L170
+.LVL174:
+	.loc 1 943 71 view .LVU658
+.LBE603:
+.LBE611:
+	.loc 1 1008 9 is_stmt 1 view .LVU659
+	.loc 1 1008 10 is_stmt 0 view .LVU660
+	incq	%rax
+.LVL175:
+	.loc 1 1007 20 is_stmt 1 view .LVU661
+	cmpq	%rdi, %rax
+	jnb	.L170
+	.loc 1 1007 39 is_stmt 0 view .LVU662
+	movzbl	(%rsi,%rax), %edx
+	movl	%edx, %ecx
+.LVL176:
+.LBB612:
+	.loc 1 937 19 is_stmt 1 view .LVU663
+.LBB604:
+	.loc 1 939 5 view .LVU664
+.L186:
+	.loc 1 943 9 view .LVU665
+	.loc 1 943 28 is_stmt 0 view .LVU666
+	subl	$32, %edx
+.LVL177:
+	.loc 1 943 28 view .LVU667
+	cmpl	$94, %edx
+	.loc 1 943 48 view .LVU668
+	movb	$1, %dl
+.LVL178:
+	.loc 1 943 28 view .LVU669
+	setbe	%r8b
+	.loc 1 943 48 view .LVU670
+	subl	$34, %ecx
+	cmpb	$58, %cl
+	ja	.L195
+	movabsq	$-288230376151711778, %rdx
+	sarq	%cl, %rdx
+	andl	$1, %edx
+	jmp	.L195
+.LVL179:
+.L190:
+	.loc 1 945 9 is_stmt 1 view .LVU671
+	.loc 1 945 9 is_stmt 0 view .LVU672
+.LBE604:
+.LBE612:
+	.loc 1 1007 20 view .LVU673
+	cmpl	$39, %edx
+.L228:
+	.loc 1 1007 20 view .LVU674
+	je	.L170
+.L192:
+	.loc 1 1008 9 is_stmt 1 view .LVU675
+	.loc 1 1008 10 is_stmt 0 view .LVU676
+	incq	%rax
+.LVL180:
+	.loc 1 1007 20 is_stmt 1 view .LVU677
+	cmpq	%rdi, %rax
+	jnb	.L170
+	.loc 1 1007 39 is_stmt 0 discriminator 1 view .LVU678
+	movzbl	(%rsi,%rax), %edx
+	movq	%rdx, %rcx
+.LVL181:
+.LBB613:
+	.loc 1 937 19 is_stmt 1 discriminator 1 view .LVU679
+.LBB605:
+	.loc 1 939 5 discriminator 1 view .LVU680
+	cmpl	$4, %r9d
+	jbe	.L226
+	jmp	.L170
+.L231:
+	.loc 1 947 57 is_stmt 0 view .LVU681
+	cmpl	$95, %edx
+	je	.L192
+	.loc 1 948 18 view .LVU682
+	orl	$32, %ecx
+	movzbl	%cl, %ecx
+	.loc 1 948 34 view .LVU683
+	subl	$97, %ecx
+	.loc 1 947 57 view .LVU684
+	cmpl	$25, %ecx
+	ja	.L170
+.LVL182:
+	.loc 1 947 57 view .LVU685
+.LBE605:
+.LBE613:
+	.loc 1 1008 9 is_stmt 1 view .LVU686
+	.loc 1 1008 10 is_stmt 0 view .LVU687
+	incq	%rax
+.LVL183:
+	.loc 1 1007 20 is_stmt 1 view .LVU688
+	cmpq	%rdi, %rax
+	jnb	.L170
+	.loc 1 1007 39 is_stmt 0 view .LVU689
+	movzbl	(%rsi,%rax), %edx
+	movl	%edx, %ecx
+.LVL184:
+.LBB614:
+	.loc 1 937 19 is_stmt 1 view .LVU690
+.LBB606:
+	.loc 1 939 5 view .LVU691
+.L183:
+	.loc 1 947 9 view .LVU692
+	.loc 1 947 28 is_stmt 0 view .LVU693
+	leal	-43(%rdx), %ebx
+	.loc 1 947 57 view .LVU694
+	cmpl	$14, %ebx
+	ja	.L231
+	.loc 1 947 57 view .LVU695
+	jmp	.L192
+.L232:
+.LVL185:
+	.loc 1 950 37 view .LVU696
+	movq	(%r8), %rdx
+.LBE606:
+.LBE614:
+	.loc 1 1007 20 view .LVU697
+	movb	(%rdx,%rcx), %bl
+	cmpb	%bl, 12(%r8)
+	jb	.L170
+.L201:
+	.loc 1 1008 9 is_stmt 1 view .LVU698
+	.loc 1 1008 10 is_stmt 0 view .LVU699
+	incq	%rax
+.LVL186:
+	.loc 1 1007 20 is_stmt 1 view .LVU700
+	cmpq	%rdi, %rax
+	jnb	.L170
+	.loc 1 1007 39 is_stmt 0 view .LVU701
+	movzbl	(%rsi,%rax), %edx
+	movq	%rdx, %rcx
+.LVL187:
+.LBB615:
+	.loc 1 937 19 is_stmt 1 view .LVU702
+.LBB607:
+	.loc 1 939 5 view .LVU703
+.L188:
+	.loc 1 950 9 view .LVU704
+	.loc 1 950 53 is_stmt 0 view .LVU705
+	cmpl	$127, %edx
+	jbe	.L232
+.LVL188:
+	.loc 1 950 53 view .LVU706
+.LBE607:
+.LBE615:
+	.loc 1 1007 20 view .LVU707
+	cmpb	$0, 13(%r8)
+	jne	.L201
+.LVL189:
+.L170:
+	.loc 1 1011 1 view .LVU708
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE579:
+	.size	plain_run_utf8, .-plain_run_utf8
+	.type	ahead_put, @function
+ahead_put:
+.LVL190:
+.LFB562:
+	.loc 1 558 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 559 5 view .LVU710
+	.loc 1 560 5 view .LVU711
+	.loc 1 560 10 is_stmt 0 view .LVU712
+	movq	64(%rdi), %rax
+	.loc 1 560 8 view .LVU713
+	cmpq	$63, %rax
+	jbe	.L234
+.LVL191:
+.LBB618:
+.LBI618:
+	.loc 1 557 13 is_stmt 1 view .LVU714
+.LBB619:
+	.loc 1 561 9 view .LVU715
+	.loc 1 562 18 is_stmt 0 view .LVU716
+	orl	$32, 32(%rdi)
+	.loc 1 561 14 view .LVU717
+	movq	$65, 64(%rdi)
+	.loc 1 562 9 is_stmt 1 view .LVU718
+	.loc 1 563 9 view .LVU719
+	ret
+.LVL192:
+.L234:
+	.loc 1 563 9 is_stmt 0 view .LVU720
+.LBE619:
+.LBE618:
+	.loc 1 565 5 is_stmt 1 view .LVU721
+	.loc 1 565 16 is_stmt 0 view .LVU722
+	leaq	1(%rax), %rdx
+	movq	%rdx, 64(%rdi)
+	.loc 1 565 20 view .LVU723
+	movl	%esi, 72(%rdi,%rax,4)
+	.loc 1 566 1 view .LVU724
+	ret
+	.cfi_endproc
+.LFE562:
+	.size	ahead_put, .-ahead_put
+	.type	iter_transcode_bulk, @function
+iter_transcode_bulk:
+.LVL193:
+.LFB574:
+	.loc 1 816 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 817 5 view .LVU726
+	.loc 1 817 8 is_stmt 0 view .LVU727
+	cmpq	$0, 8(%rsi)
+	jne	.L249
+	ret
+.L249:
+	.loc 1 816 1 view .LVU728
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+	leaq	8(%rsp), %r15
+.LVL194:
+.L237:
+.LBB625:
+.LBB626:
+	.loc 1 822 12 is_stmt 1 view .LVU729
+	movl	$1, %ecx
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_reserve_bulk
+.LVL195:
+	testb	%al, %al
+	je	.L236
+.LBB627:
+	.loc 1 823 9 view .LVU730
+.LVL196:
+.LBB628:
+.LBI628:
+	.loc 2 574 22 view .LVU731
+.LBB629:
+	.loc 2 576 5 view .LVU732
+	.loc 2 576 39 is_stmt 0 view .LVU733
+	movq	48(%rbx), %rax
+	subq	40(%rbx), %rax
+.LVL197:
+	.loc 2 576 39 view .LVU734
+.LBE629:
+.LBE628:
+	.loc 1 823 16 view .LVU735
+	movq	%rax, %r14
+	shrq	$2, %r14
+.LVL198:
+	.loc 1 824 9 is_stmt 1 view .LVU736
+	.loc 1 824 12 is_stmt 0 view .LVU737
+	cmpq	$3, %rax
+	jbe	.L236
+	.loc 1 827 9 is_stmt 1 view .LVU738
+	.loc 1 828 9 view .LVU739
+	.loc 1 828 30 is_stmt 0 view .LVU740
+	movq	0(%rbp), %rax
+	.loc 1 828 20 view .LVU741
+	movq	%r15, %rcx
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	call	*32(%rax)
+.LVL199:
+	movq	%rax, %r12
+.LVL200:
+	.loc 1 829 9 is_stmt 1 view .LVU742
+	.loc 1 829 12 is_stmt 0 view .LVU743
+	testq	%rax, %rax
+	je	.L236
+	.loc 1 832 9 is_stmt 1 view .LVU744
+	.loc 1 832 61 is_stmt 0 view .LVU745
+	movq	(%rbx), %rax
+.LVL201:
+	.loc 1 832 20 view .LVU746
+	movq	8(%rbp), %rdx
+	movq	%r12, %rcx
+	movq	40(%rbx), %rdi
+	movzbl	48(%rax), %esi
+	.loc 1 832 30 view .LVU747
+	movq	0(%rbp), %rax
+	.loc 1 832 20 view .LVU748
+	call	*40(%rax)
+.LVL202:
+	.loc 1 833 9 is_stmt 1 view .LVU749
+	.loc 1 833 12 is_stmt 0 view .LVU750
+	testq	%rax, %rax
+	je	.L236
+	.loc 1 836 9 is_stmt 1 view .LVU751
+	.loc 1 836 40 is_stmt 0 view .LVU752
+	addq	%rax, 40(%rbx)
+	.loc 1 837 9 is_stmt 1 view .LVU753
+	movq	8(%rsp), %rcx
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_skip
+.LVL203:
+	.loc 1 838 9 view .LVU754
+	.loc 1 838 12 is_stmt 0 view .LVU755
+	cmpq	%r14, %r12
+	jnb	.L237
+.LVL204:
+.L236:
+	.loc 1 838 12 view .LVU756
+.LBE627:
+.LBE626:
+.LBE625:
+	.loc 1 843 1 view .LVU757
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL205:
+	.loc 1 843 1 view .LVU758
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL206:
+	.loc 1 843 1 view .LVU759
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL207:
+	.loc 1 843 1 view .LVU760
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE574:
+	.size	iter_transcode_bulk, .-iter_transcode_bulk
+	.type	render_fill, @function
+render_fill:
+.LVL208:
+.LFB542:
+	.loc 1 132 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 133 5 view .LVU762
+	.loc 1 132 1 is_stmt 0 view .LVU763
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	xorl	%eax, %eax
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 133 22 view .LVU764
+	movl	24(%rdi), %ecx
+	.loc 1 132 1 view .LVU765
+	movq	%rdi, %rbx
+	.loc 1 133 56 view .LVU766
+	cmpq	%rcx, %rdx
+	jnb	.L254
+	.loc 1 133 56 discriminator 1 view .LVU767
+	movl	%ecx, %eax
+	subl	%edx, %eax
+.L254:
+	.loc 1 133 14 discriminator 4 view .LVU768
+	movl	%eax, 24(%rbx)
+	.loc 1 134 5 is_stmt 1 discriminator 4 view .LVU769
+	.loc 1 134 8 is_stmt 0 discriminator 4 view .LVU770
+	testb	$32, 32(%rbx)
+	jne	.L253
+.LVL209:
+.LBB655:
+.LBI655:
+	.loc 1 131 13 is_stmt 1 view .LVU771
+.LBB656:
+	.loc 1 137 5 view .LVU772
+	.loc 1 137 10 is_stmt 0 view .LVU773
+	movq	(%rbx), %rax
+	.loc 1 137 16 view .LVU774
+	movq	32(%rax), %rcx
+	.loc 1 137 8 view .LVU775
+	testq	%rcx, %rcx
+	je	.L257
+	.loc 1 138 9 is_stmt 1 view .LVU776
+	movq	%rbp, %rdx
+.LVL210:
+	.loc 1 138 9 is_stmt 0 view .LVU777
+	movl	%r12d, %esi
+.LVL211:
+	.loc 1 138 9 view .LVU778
+	movq	%rbx, %rdi
+.LVL212:
+	.loc 1 138 9 view .LVU779
+.LBE656:
+.LBE655:
+	.loc 1 181 1 view .LVU780
+	popq	%rbx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+.LVL213:
+	.loc 1 181 1 view .LVU781
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL214:
+	.loc 1 181 1 view .LVU782
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL215:
+.LBB695:
+.LBB694:
+	.loc 1 138 9 view .LVU783
+	jmp	*%rcx
+.LVL216:
+.L257:
+	.cfi_restore_state
+	.loc 1 141 5 is_stmt 1 view .LVU784
+	.loc 1 141 20 is_stmt 0 view .LVU785
+	movb	48(%rax), %al
+	.loc 1 141 5 view .LVU786
+	cmpb	$2, %al
+	je	.L258
+	cmpb	$3, %al
+	je	.L259
+	decb	%al
+	jne	.L274
+.LVL217:
+.L260:
+	.loc 1 143 24 is_stmt 1 view .LVU787
+	testq	%rbp, %rbp
+	jne	.L262
+.L267:
+.LBB657:
+.LBB658:
+	.loc 1 170 25 is_stmt 0 view .LVU788
+	xorl	%ebp, %ebp
+.LVL218:
+	.loc 1 170 25 view .LVU789
+	jmp	.L274
+.LVL219:
+.L262:
+	.loc 1 170 25 view .LVU790
+.LBE658:
+.LBE657:
+.LBB662:
+.LBI662:
+	.loc 2 585 19 is_stmt 1 view .LVU791
+.LBB663:
+	.loc 2 587 5 view .LVU792
+.LBB664:
+.LBI664:
+	.loc 2 574 22 view .LVU793
+.LBB665:
+	.loc 2 576 5 view .LVU794
+	.loc 2 576 5 is_stmt 0 view .LVU795
+.LBE665:
+.LBE664:
+	.loc 2 587 8 view .LVU796
+	movq	40(%rbx), %rax
+	cmpq	%rax, 48(%rbx)
+	je	.L297
+.L263:
+.LVL220:
+	.loc 2 587 8 view .LVU797
+.LBE663:
+.LBE662:
+.LBB667:
+	.loc 1 144 13 is_stmt 1 view .LVU798
+.LBB668:
+.LBI668:
+	.loc 2 574 22 view .LVU799
+.LBB669:
+	.loc 2 576 5 view .LVU800
+	.loc 2 576 54 is_stmt 0 view .LVU801
+	movq	40(%rbx), %rsi
+.LVL221:
+	.loc 2 576 54 view .LVU802
+.LBE669:
+.LBE668:
+	.loc 1 145 13 is_stmt 1 view .LVU803
+.LBB672:
+.LBB670:
+	.loc 2 576 39 is_stmt 0 view .LVU804
+	movq	48(%rbx), %rdx
+.LBE670:
+.LBE672:
+	.loc 1 146 13 view .LVU805
+	movl	%r12d, %eax
+.LBB673:
+.LBB671:
+	.loc 2 576 39 view .LVU806
+	subq	%rsi, %rdx
+.LVL222:
+	.loc 2 576 39 view .LVU807
+.LBE671:
+.LBE673:
+	.loc 1 146 13 view .LVU808
+	movq	%rsi, %rdi
+	.loc 1 145 15 view .LVU809
+	cmpq	%rbp, %rdx
+	cmova	%rbp, %rdx
+.LVL223:
+	.loc 1 146 13 is_stmt 1 view .LVU810
+	movq	%rdx, %rcx
+	.loc 1 148 15 is_stmt 0 view .LVU811
+	subq	%rdx, %rbp
+.LVL224:
+	.loc 1 146 13 view .LVU812
+	rep stosb
+	.loc 1 147 13 is_stmt 1 view .LVU813
+	.loc 1 147 44 is_stmt 0 view .LVU814
+	addq	%rdx, 40(%rbx)
+	.loc 1 148 13 is_stmt 1 view .LVU815
+.LVL225:
+	.loc 1 148 13 is_stmt 0 view .LVU816
+	jmp	.L260
+.LVL226:
+.L297:
+	.loc 1 148 13 view .LVU817
+.LBE667:
+.LBB674:
+.LBB666:
+	.loc 2 590 5 is_stmt 1 view .LVU818
+	.loc 2 590 20 is_stmt 0 view .LVU819
+	movq	(%rbx), %rax
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU820
+	testq	%rax, %rax
+	je	.L274
+	.loc 2 590 40 view .LVU821
+	movl	$1, %esi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL227:
+	.loc 2 590 37 view .LVU822
+	testb	%al, %al
+	jne	.L263
+	jmp	.L274
+.LVL228:
+.L299:
+	.loc 2 590 37 view .LVU823
+.LBE666:
+.LBE674:
+.LBB675:
+	.loc 1 160 13 is_stmt 1 view .LVU824
+	.loc 1 160 24 is_stmt 0 view .LVU825
+	leaq	(%rdx,%rdx), %rcx
+.LVL229:
+	.loc 1 161 15 view .LVU826
+	subq	%rdx, %rbp
+.LVL230:
+	.loc 1 160 24 view .LVU827
+	addq	%rcx, %rax
+	movq	%rax, 40(%rbx)
+	.loc 1 161 13 is_stmt 1 view .LVU828
+.LVL231:
+.L258:
+	.loc 1 161 13 is_stmt 0 view .LVU829
+.LBE675:
+	.loc 1 153 24 is_stmt 1 view .LVU830
+	testq	%rbp, %rbp
+	je	.L267
+.LVL232:
+.LBB679:
+.LBI679:
+	.loc 2 585 19 view .LVU831
+.LBB680:
+	.loc 2 587 5 view .LVU832
+.LBB681:
+.LBI681:
+	.loc 2 574 22 view .LVU833
+.LBB682:
+	.loc 2 576 5 view .LVU834
+	.loc 2 576 39 is_stmt 0 view .LVU835
+	movq	48(%rbx), %rax
+	subq	40(%rbx), %rax
+.LBE682:
+.LBE681:
+	.loc 2 587 8 view .LVU836
+	cmpq	$1, %rax
+	jbe	.L298
+.L268:
+.LVL233:
+	.loc 2 587 8 view .LVU837
+.LBE680:
+.LBE679:
+.LBB684:
+	.loc 1 154 13 is_stmt 1 view .LVU838
+.LBB676:
+.LBI676:
+	.loc 2 574 22 view .LVU839
+.LBB677:
+	.loc 2 576 5 view .LVU840
+	.loc 2 576 54 is_stmt 0 view .LVU841
+	movq	40(%rbx), %rax
+.LVL234:
+	.loc 2 576 39 view .LVU842
+	movq	48(%rbx), %rdx
+	subq	%rax, %rdx
+.LBE677:
+.LBE676:
+	.loc 1 154 20 view .LVU843
+	shrq	%rdx
+.LVL235:
+	.loc 1 155 13 is_stmt 1 view .LVU844
+	.loc 1 155 15 is_stmt 0 view .LVU845
+	cmpq	%rbp, %rdx
+	cmova	%rbp, %rdx
+.LVL236:
+	.loc 1 156 13 is_stmt 1 view .LVU846
+	.loc 1 157 13 view .LVU847
+.LBB678:
+	.loc 1 157 18 view .LVU848
+	.loc 1 157 25 is_stmt 0 view .LVU849
+	xorl	%ecx, %ecx
+.LVL237:
+.L265:
+	.loc 1 157 34 is_stmt 1 view .LVU850
+	cmpq	%rcx, %rdx
+	je	.L299
+	.loc 1 158 17 view .LVU851
+.LVL238:
+	.loc 1 158 24 is_stmt 0 view .LVU852
+	movw	%r12w, (%rax,%rcx,2)
+	.loc 1 157 40 is_stmt 1 view .LVU853
+	incq	%rcx
+.LVL239:
+	.loc 1 157 40 is_stmt 0 view .LVU854
+	jmp	.L265
+.LVL240:
+.L298:
+	.loc 1 157 40 view .LVU855
+.LBE678:
+.LBE684:
+.LBB685:
+.LBB683:
+	.loc 2 590 5 is_stmt 1 view .LVU856
+	.loc 2 590 20 is_stmt 0 view .LVU857
+	movq	(%rbx), %rax
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU858
+	testq	%rax, %rax
+	je	.L274
+	.loc 2 590 40 view .LVU859
+	movl	$2, %esi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL241:
+	.loc 2 590 37 view .LVU860
+	testb	%al, %al
+	jne	.L268
+	jmp	.L274
+.LVL242:
+.L301:
+	.loc 2 590 37 view .LVU861
+.LBE683:
+.LBE685:
+.LBB686:
+	.loc 1 173 13 is_stmt 1 view .LVU862
+	.loc 1 173 24 is_stmt 0 view .LVU863
+	leaq	(%rcx,%rax,4), %rdx
+.LVL243:
+	.loc 1 174 15 view .LVU864
+	subq	%rax, %rbp
+.LVL244:
+	.loc 1 173 24 view .LVU865
+	movq	%rdx, 40(%rbx)
+	.loc 1 174 13 is_stmt 1 view .LVU866
+.LVL245:
+.L259:
+	.loc 1 174 13 is_stmt 0 view .LVU867
+.LBE686:
+	.loc 1 166 24 is_stmt 1 view .LVU868
+	testq	%rbp, %rbp
+	je	.L267
+.LVL246:
+.LBB687:
+.LBI687:
+	.loc 2 585 19 view .LVU869
+.LBB688:
+	.loc 2 587 5 view .LVU870
+.LBB689:
+.LBI689:
+	.loc 2 574 22 view .LVU871
+.LBB690:
+	.loc 2 576 5 view .LVU872
+	.loc 2 576 39 is_stmt 0 view .LVU873
+	movq	48(%rbx), %rax
+	subq	40(%rbx), %rax
+.LBE690:
+.LBE689:
+	.loc 2 587 8 view .LVU874
+	cmpq	$3, %rax
+	jbe	.L300
+.L275:
+.LVL247:
+	.loc 2 587 8 view .LVU875
+.LBE688:
+.LBE687:
+.LBB692:
+	.loc 1 167 13 is_stmt 1 view .LVU876
+.LBB659:
+.LBI659:
+	.loc 2 574 22 view .LVU877
+.LBB660:
+	.loc 2 576 5 view .LVU878
+	.loc 2 576 54 is_stmt 0 view .LVU879
+	movq	40(%rbx), %rcx
+.LVL248:
+	.loc 2 576 39 view .LVU880
+	movq	48(%rbx), %rax
+	subq	%rcx, %rax
+.LBE660:
+.LBE659:
+	.loc 1 167 20 view .LVU881
+	shrq	$2, %rax
+.LVL249:
+	.loc 1 168 13 is_stmt 1 view .LVU882
+	.loc 1 168 15 is_stmt 0 view .LVU883
+	cmpq	%rbp, %rax
+	cmova	%rbp, %rax
+.LVL250:
+	.loc 1 169 13 is_stmt 1 view .LVU884
+	.loc 1 170 13 view .LVU885
+.LBB661:
+	.loc 1 170 18 view .LVU886
+	.loc 1 170 25 is_stmt 0 view .LVU887
+	xorl	%edx, %edx
+.LVL251:
+.L271:
+	.loc 1 170 34 is_stmt 1 view .LVU888
+	cmpq	%rdx, %rax
+	je	.L301
+	.loc 1 171 17 view .LVU889
+.LVL252:
+	.loc 1 171 22 is_stmt 0 view .LVU890
+	movl	%r12d, (%rcx,%rdx,4)
+	.loc 1 170 40 is_stmt 1 view .LVU891
+	incq	%rdx
+.LVL253:
+	.loc 1 170 40 is_stmt 0 view .LVU892
+	jmp	.L271
+.LVL254:
+.L300:
+	.loc 1 170 40 view .LVU893
+.LBE661:
+.LBE692:
+.LBB693:
+.LBB691:
+	.loc 2 590 5 is_stmt 1 view .LVU894
+	.loc 2 590 20 is_stmt 0 view .LVU895
+	movq	(%rbx), %rax
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU896
+	testq	%rax, %rax
+	je	.L274
+	.loc 2 590 40 view .LVU897
+	movl	$4, %esi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL255:
+	.loc 2 590 37 view .LVU898
+	testb	%al, %al
+	jne	.L275
+.LVL256:
+.L274:
+	.loc 2 590 37 view .LVU899
+.LBE691:
+.LBE693:
+	.loc 1 178 14 is_stmt 1 view .LVU900
+	testq	%rbp, %rbp
+	je	.L253
+	.loc 1 179 9 view .LVU901
+	.loc 1 179 16 is_stmt 0 view .LVU902
+	movq	(%rbx), %rax
+	.loc 1 179 9 view .LVU903
+	movl	%r12d, %esi
+	movq	%rbx, %rdi
+	.loc 1 178 20 view .LVU904
+	decq	%rbp
+.LVL257:
+	.loc 1 179 9 view .LVU905
+	call	*8(%rax)
+.LVL258:
+	.loc 1 178 20 is_stmt 1 view .LVU906
+	.loc 1 178 20 is_stmt 0 view .LVU907
+	jmp	.L274
+.LVL259:
+.L253:
+	.loc 1 178 20 view .LVU908
+.LBE694:
+.LBE695:
+	.loc 1 181 1 view .LVU909
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL260:
+	.loc 1 181 1 view .LVU910
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL261:
+	.loc 1 181 1 view .LVU911
+	ret
+	.cfi_endproc
+.LFE542:
+	.size	render_fill, .-render_fill
+	.type	check_quote_put, @function
+check_quote_put:
+.LVL262:
+.LFB559:
+	.loc 1 505 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 506 5 view .LVU913
+	.loc 1 505 1 is_stmt 0 view .LVU914
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+.LVL263:
+	.loc 1 505 1 view .LVU915
+	movl	%edx, %esi
+.LVL264:
+	.loc 1 506 8 view .LVU916
+	cmpq	$0, 48(%rax)
+	je	.L303
+	.loc 1 507 9 is_stmt 1 view .LVU917
+.LVL265:
+.LBB700:
+.LBI700:
+	.loc 1 489 12 view .LVU918
+.LBB701:
+	.loc 1 494 5 view .LVU919
+	.loc 1 494 14 is_stmt 0 view .LVU920
+	movl	$1, 36(%rdi)
+	.loc 1 495 5 is_stmt 1 view .LVU921
+	.loc 1 495 8 is_stmt 0 view .LVU922
+	cmpl	$127, %esi
+	ja	.L304
+	.loc 1 496 9 is_stmt 1 view .LVU923
+	.loc 1 496 29 is_stmt 0 view .LVU924
+	movq	48(%rax), %rax
+.LVL266:
+	.loc 1 496 33 view .LVU925
+	cmpb	$0, (%rax,%rsi)
+	setne	%al
+	ret
+.LVL267:
+.L304:
+	.loc 1 498 5 is_stmt 1 view .LVU926
+	.loc 1 498 14 is_stmt 0 view .LVU927
+	movq	16(%rax), %rdx
+.LVL268:
+	.loc 1 498 36 view .LVU928
+	xorl	%eax, %eax
+.LVL269:
+	.loc 1 498 36 view .LVU929
+	testq	%rdx, %rdx
+	je	.L310
+.LBE701:
+.LBE700:
+	.loc 1 505 1 view .LVU930
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB705:
+.LBB702:
+	.loc 1 498 39 view .LVU931
+	call	*%rdx
+.LVL270:
+	.loc 1 498 39 view .LVU932
+.LBE702:
+.LBE705:
+	.loc 1 511 1 view .LVU933
+	popq	%rdx
+	.cfi_def_cfa_offset 8
+.LBB706:
+.LBB703:
+	.loc 1 498 36 view .LVU934
+	movzbl	%al, %eax
+	andl	$1, %eax
+.LBE703:
+.LBE706:
+	.loc 1 511 1 view .LVU935
+	ret
+.LVL271:
+.L303:
+.LBB707:
+.LBI707:
+	.loc 1 501 12 is_stmt 1 view .LVU936
+.LBB708:
+	.loc 1 509 5 view .LVU937
+	.loc 1 510 5 view .LVU938
+	.loc 1 510 12 is_stmt 0 view .LVU939
+	jmp	*16(%rax)
+.LVL272:
+.L310:
+	.loc 1 510 12 view .LVU940
+.LBE708:
+.LBE707:
+.LBB709:
+.LBB704:
+	.loc 1 498 36 view .LVU941
+	andl	$1, %eax
+.LBE704:
+.LBE709:
+	.loc 1 511 1 view .LVU942
+	ret
+	.cfi_endproc
+.LFE559:
+	.size	check_quote_put, .-check_quote_put
+	.type	custom_needquote, @function
+custom_needquote:
+.LVL273:
+.LFB587:
+	.loc 1 1399 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1400 5 view .LVU944
+	.loc 1 1401 5 view .LVU945
+	.loc 1 1399 1 is_stmt 0 view .LVU946
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 1399 1 view .LVU947
+	movl	%esi, %edx
+	movq	%rdi, %rbx
+	.loc 1 1401 9 view .LVU948
+	movq	64(%rdi), %rsi
+.LVL274:
+	.loc 1 1401 9 view .LVU949
+	movq	80(%rdi), %rdi
+.LVL275:
+	.loc 1 1401 9 view .LVU950
+	call	check_quote_put
+.LVL276:
+	.loc 1 1401 8 view .LVU951
+	testb	%al, %al
+	je	.L313
+	.loc 1 1402 9 is_stmt 1 view .LVU952
+	.loc 1 1402 17 is_stmt 0 view .LVU953
+	movq	$1, 72(%rbx)
+.L313:
+	.loc 1 1404 1 view .LVU954
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL277:
+	.loc 1 1404 1 view .LVU955
+	ret
+	.cfi_endproc
+.LFE587:
+	.size	custom_needquote, .-custom_needquote
+	.globl	va_stream_render
+	.type	va_stream_render, @function
+va_stream_render:
+.LVL278:
+.LFB541:
+	.loc 1 95 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 96 5 view .LVU957
+	.loc 1 96 8 is_stmt 0 view .LVU958
+	testl	%esi, %esi
+	je	.L319
+	.loc 1 99 5 is_stmt 1 view .LVU959
+	.loc 1 99 10 is_stmt 0 view .LVU960
+	movl	24(%rdi), %eax
+	.loc 1 99 8 view .LVU961
+	testl	%eax, %eax
+	je	.L322
+	.loc 1 100 9 is_stmt 1 view .LVU962
+	.loc 1 100 17 is_stmt 0 view .LVU963
+	decl	%eax
+	movl	%eax, 24(%rdi)
+.L322:
+	.loc 1 102 5 is_stmt 1 view .LVU964
+	.loc 1 102 8 is_stmt 0 view .LVU965
+	testb	$32, 32(%rdi)
+	jne	.L319
+.LVL279:
+.LBB721:
+.LBI721:
+	.loc 1 94 13 is_stmt 1 view .LVU966
+.LBB722:
+	.loc 1 107 5 view .LVU967
+.LBB723:
+.LBI723:
+	.loc 2 574 22 view .LVU968
+.LBB724:
+	.loc 2 576 5 view .LVU969
+	.loc 2 576 54 is_stmt 0 view .LVU970
+	movq	40(%rdi), %rax
+.LVL280:
+	.loc 2 576 39 view .LVU971
+	movq	48(%rdi), %rdx
+.LBE724:
+.LBE723:
+	.loc 1 108 18 view .LVU972
+	movq	(%rdi), %rcx
+.LBB726:
+.LBB725:
+	.loc 2 576 39 view .LVU973
+	subq	%rax, %rdx
+.LBE725:
+.LBE726:
+	.loc 1 107 8 view .LVU974
+	cmpq	$3, %rdx
+	jbe	.L324
+.LVL281:
+.LBB727:
+.LBI727:
+	.loc 2 419 19 is_stmt 1 view .LVU975
+.LBB728:
+	.loc 2 421 5 view .LVU976
+	.loc 2 421 26 is_stmt 0 view .LVU977
+	leal	-55296(%rsi), %edx
+.LBE728:
+.LBE727:
+	.loc 1 107 34 view .LVU978
+	cmpl	$2047, %edx
+	jbe	.L324
+	cmpl	$1114111, %esi
+	ja	.L324
+	.loc 1 108 9 is_stmt 1 view .LVU979
+	.loc 1 108 24 is_stmt 0 view .LVU980
+	movb	48(%rcx), %dl
+	.loc 1 108 9 view .LVU981
+	cmpb	$2, %dl
+	je	.L325
+	cmpb	$3, %dl
+	je	.L326
+	decb	%dl
+	jne	.L324
+	.loc 1 110 13 is_stmt 1 view .LVU982
+.LVL282:
+.LBB729:
+.LBI729:
+	.loc 2 451 21 view .LVU983
+.LBB730:
+	.loc 2 453 5 view .LVU984
+	.loc 2 453 8 is_stmt 0 view .LVU985
+	cmpl	$127, %esi
+	ja	.L327
+	.loc 2 454 9 is_stmt 1 view .LVU986
+	.loc 2 454 16 is_stmt 0 view .LVU987
+	movb	%sil, (%rax)
+	.loc 2 454 11 view .LVU988
+	leaq	1(%rax), %rdx
+.LVL283:
+	.loc 2 454 11 view .LVU989
+	jmp	.L332
+.LVL284:
+.L327:
+	.loc 2 456 10 is_stmt 1 view .LVU990
+	.loc 2 458 33 is_stmt 0 view .LVU991
+	movl	%esi, %r8d
+	.loc 2 457 33 view .LVU992
+	movl	%esi, %edx
+	.loc 2 458 33 view .LVU993
+	andl	$63, %r8d
+	.loc 2 457 33 view .LVU994
+	shrl	$6, %edx
+	.loc 2 458 28 view .LVU995
+	orl	$-128, %r8d
+	.loc 2 456 13 view .LVU996
+	cmpl	$2047, %esi
+	ja	.L329
+	.loc 2 457 9 is_stmt 1 view .LVU997
+.LVL285:
+	.loc 2 457 28 is_stmt 0 view .LVU998
+	orl	$-64, %edx
+	.loc 2 458 14 view .LVU999
+	movb	%r8b, 1(%rax)
+	.loc 2 457 28 view .LVU1000
+	movb	%dl, (%rax)
+	.loc 2 458 9 is_stmt 1 view .LVU1001
+	.loc 2 458 11 is_stmt 0 view .LVU1002
+	leaq	2(%rax), %rdx
+.LVL286:
+	.loc 2 458 11 view .LVU1003
+	jmp	.L332
+.LVL287:
+.L329:
+	.loc 2 460 10 is_stmt 1 view .LVU1004
+	.loc 2 461 33 is_stmt 0 view .LVU1005
+	movl	%esi, %ecx
+	.loc 2 462 40 view .LVU1006
+	andl	$63, %edx
+	.loc 2 461 33 view .LVU1007
+	shrl	$12, %ecx
+	.loc 2 462 28 view .LVU1008
+	orl	$-128, %edx
+	.loc 2 460 13 view .LVU1009
+	cmpl	$65535, %esi
+	ja	.L330
+	.loc 2 461 9 is_stmt 1 view .LVU1010
+.LVL288:
+	.loc 2 461 28 is_stmt 0 view .LVU1011
+	orl	$-32, %ecx
+	.loc 2 462 14 view .LVU1012
+	movb	%dl, 1(%rax)
+	.loc 2 463 11 view .LVU1013
+	leaq	3(%rax), %rdx
+	.loc 2 461 28 view .LVU1014
+	movb	%cl, (%rax)
+	.loc 2 462 9 is_stmt 1 view .LVU1015
+.LVL289:
+	.loc 2 463 9 view .LVU1016
+	.loc 2 463 14 is_stmt 0 view .LVU1017
+	movb	%r8b, 2(%rax)
+	jmp	.L332
+.LVL290:
+.L330:
+	.loc 2 466 9 is_stmt 1 view .LVU1018
+	.loc 2 466 33 is_stmt 0 view .LVU1019
+	shrl	$18, %esi
+.LVL291:
+	.loc 2 467 41 view .LVU1020
+	andl	$63, %ecx
+	.loc 2 468 14 view .LVU1021
+	movb	%dl, 2(%rax)
+	.loc 2 469 11 view .LVU1022
+	leaq	4(%rax), %rdx
+	.loc 2 466 28 view .LVU1023
+	orl	$-16, %esi
+	.loc 2 467 28 view .LVU1024
+	orl	$-128, %ecx
+	.loc 2 469 14 view .LVU1025
+	movb	%r8b, 3(%rax)
+	.loc 2 466 28 view .LVU1026
+	movb	%sil, (%rax)
+	.loc 2 467 9 is_stmt 1 view .LVU1027
+.LVL292:
+	.loc 2 467 28 is_stmt 0 view .LVU1028
+	movb	%cl, 1(%rax)
+	.loc 2 468 9 is_stmt 1 view .LVU1029
+.LVL293:
+	.loc 2 469 9 view .LVU1030
+	.loc 2 471 5 view .LVU1031
+	.loc 2 471 5 is_stmt 0 view .LVU1032
+	jmp	.L332
+.LVL294:
+.L325:
+	.loc 2 471 5 view .LVU1033
+.LBE730:
+.LBE729:
+	.loc 1 114 13 is_stmt 1 view .LVU1034
+.LBB731:
+.LBI731:
+	.loc 2 478 25 view .LVU1035
+.LBB732:
+	.loc 2 480 5 view .LVU1036
+	.loc 2 480 8 is_stmt 0 view .LVU1037
+	cmpl	$65535, %esi
+	jbe	.L331
+	.loc 2 481 9 is_stmt 1 view .LVU1038
+	.loc 2 481 11 is_stmt 0 view .LVU1039
+	subl	$65536, %esi
+.LVL295:
+	.loc 2 482 9 is_stmt 1 view .LVU1040
+	.loc 2 482 39 is_stmt 0 view .LVU1041
+	movl	%esi, %edx
+	.loc 2 483 39 view .LVU1042
+	andw	$1023, %si
+.LVL296:
+	.loc 2 482 39 view .LVU1043
+	shrl	$10, %edx
+.LVL297:
+	.loc 2 483 16 view .LVU1044
+	subw	$9216, %si
+	.loc 2 482 16 view .LVU1045
+	subw	$10240, %dx
+	.loc 2 483 16 view .LVU1046
+	movw	%si, 2(%rax)
+	.loc 2 482 16 view .LVU1047
+	movw	%dx, (%rax)
+	.loc 2 483 9 is_stmt 1 view .LVU1048
+	.loc 2 483 11 is_stmt 0 view .LVU1049
+	leaq	4(%rax), %rdx
+.LVL298:
+	.loc 2 483 11 view .LVU1050
+	jmp	.L332
+.LVL299:
+.L331:
+	.loc 2 486 9 is_stmt 1 view .LVU1051
+	.loc 2 486 16 is_stmt 0 view .LVU1052
+	movw	%si, (%rax)
+	.loc 2 486 11 view .LVU1053
+	leaq	2(%rax), %rdx
+.LVL300:
+.L332:
+	.loc 2 488 5 is_stmt 1 view .LVU1054
+	.loc 2 488 5 is_stmt 0 view .LVU1055
+.LBE732:
+.LBE731:
+	.loc 1 114 24 view .LVU1056
+	movq	%rdx, 40(%rdi)
+	.loc 1 115 13 is_stmt 1 view .LVU1057
+	ret
+.LVL301:
+.L326:
+.LBB733:
+	.loc 1 118 13 view .LVU1058
+	.loc 1 119 13 view .LVU1059
+	.loc 1 119 18 is_stmt 0 view .LVU1060
+	movl	%esi, (%rax)
+	.loc 1 120 13 is_stmt 1 view .LVU1061
+	.loc 1 119 15 is_stmt 0 view .LVU1062
+	addq	$4, %rax
+.LVL302:
+	.loc 1 119 15 view .LVU1063
+	movq	%rax, 40(%rdi)
+	.loc 1 121 13 is_stmt 1 view .LVU1064
+	ret
+.LVL303:
+.L324:
+	.loc 1 121 13 is_stmt 0 view .LVU1065
+.LBE733:
+	.loc 1 125 5 is_stmt 1 view .LVU1066
+	jmp	*8(%rcx)
+.LVL304:
+.L319:
+	.loc 1 125 5 is_stmt 0 view .LVU1067
+.LBE722:
+.LBE721:
+	.loc 1 126 1 view .LVU1068
+	ret
+	.cfi_endproc
+.LFE541:
+	.size	va_stream_render, .-va_stream_render
+	.type	render_quote_sh, @function
+render_quote_sh:
+.LVL305:
+.LFB552:
+	.loc 1 390 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 391 5 view .LVU1070
+	.loc 1 390 1 is_stmt 0 view .LVU1071
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 390 1 view .LVU1072
+	movq	%rdi, %rbx
+	.loc 1 391 8 view .LVU1073
+	cmpl	$39, %esi
+	jne	.L343
+.LVL306:
+.LBB736:
+.LBI736:
+	.loc 1 387 13 is_stmt 1 view .LVU1074
+.LBB737:
+	.loc 1 392 9 view .LVU1075
+	call	va_stream_render
+.LVL307:
+	.loc 1 393 9 view .LVU1076
+	movl	$92, %esi
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL308:
+	.loc 1 394 9 view .LVU1077
+	movl	$39, %esi
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL309:
+	.loc 1 395 9 view .LVU1078
+	movl	$39, %esi
+	movq	%rbx, %rdi
+.LVL310:
+.L343:
+	.loc 1 395 9 is_stmt 0 view .LVU1079
+.LBE737:
+.LBE736:
+	.loc 1 398 5 is_stmt 1 view .LVU1080
+	.loc 1 399 1 is_stmt 0 view .LVU1081
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL311:
+	.loc 1 398 5 view .LVU1082
+	jmp	va_stream_render
+.LVL312:
+	.loc 1 398 5 view .LVU1083
+	.cfi_endproc
+.LFE552:
+	.size	render_quote_sh, .-render_quote_sh
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC11:
+	.string	"src/core.c"
+.LC12:
+	.string	"start != NULL"
+	.text
+	.type	render_rawstr, @function
+render_rawstr:
+.LVL313:
+.LFB566:
+	.loc 1 611 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 612 4 view .LVU1085
+	.loc 1 611 1 is_stmt 0 view .LVU1086
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	pushq	%rdx
+	.cfi_def_cfa_offset 32
+	.loc 1 612 47 view .LVU1087
+	testq	%rsi, %rsi
+	jne	.L346
+	.loc 1 612 24 is_stmt 1 discriminator 1 view .LVU1088
+	leaq	__PRETTY_FUNCTION__.6(%rip), %rcx
+	movl	$612, %edx
+	leaq	.LC11(%rip), %rsi
+.LVL314:
+	.loc 1 612 24 is_stmt 0 discriminator 1 view .LVU1089
+	leaq	.LC12(%rip), %rdi
+.LVL315:
+	.loc 1 612 24 discriminator 1 view .LVU1090
+	call	__assert_fail@PLT
+.LVL316:
+.L346:
+	.loc 1 612 24 discriminator 1 view .LVU1091
+	movq	%rdi, %rbx
+	movq	%rsi, %rbp
+	.loc 1 614 5 is_stmt 1 view .LVU1092
+	.loc 1 614 8 is_stmt 0 view .LVU1093
+	testb	$8, 32(%rdi)
+	jne	.L351
+.LVL317:
+	.loc 1 614 8 view .LVU1094
+	movq	%rsi, %rax
+.L347:
+.LVL318:
+.LBB738:
+	.loc 1 616 53 is_stmt 1 discriminator 1 view .LVU1095
+	.loc 1 616 40 is_stmt 0 discriminator 1 view .LVU1096
+	movl	24(%rbx), %edx
+	.loc 1 616 53 discriminator 1 view .LVU1097
+	testl	%edx, %edx
+	je	.L349
+	.loc 1 616 53 discriminator 3 view .LVU1098
+	cmpb	$0, (%rax)
+	je	.L349
+	.loc 1 617 13 is_stmt 1 discriminator 4 view .LVU1099
+	.loc 1 617 21 is_stmt 0 discriminator 4 view .LVU1100
+	decl	%edx
+	.loc 1 616 72 discriminator 4 view .LVU1101
+	incq	%rax
+.LVL319:
+	.loc 1 617 21 discriminator 4 view .LVU1102
+	movl	%edx, 24(%rbx)
+	.loc 1 616 72 is_stmt 1 discriminator 4 view .LVU1103
+.LVL320:
+	.loc 1 616 72 is_stmt 0 discriminator 4 view .LVU1104
+	jmp	.L347
+.L349:
+	.loc 1 616 72 discriminator 4 view .LVU1105
+.LBE738:
+	.loc 1 621 9 is_stmt 1 view .LVU1106
+	movl	$32, %esi
+.LVL321:
+	.loc 1 621 9 is_stmt 0 view .LVU1107
+	movq	%rbx, %rdi
+	call	render_fill
+.LVL322:
+.L351:
+.LBB739:
+	.loc 1 625 40 is_stmt 1 discriminator 1 view .LVU1108
+	.loc 1 625 35 is_stmt 0 discriminator 1 view .LVU1109
+	movzbl	0(%rbp), %esi
+	.loc 1 625 40 discriminator 1 view .LVU1110
+	testb	%sil, %sil
+	je	.L358
+	.loc 1 626 9 is_stmt 1 discriminator 3 view .LVU1111
+	movq	%rbx, %rdi
+	.loc 1 625 50 is_stmt 0 discriminator 3 view .LVU1112
+	incq	%rbp
+.LVL323:
+	.loc 1 626 9 discriminator 3 view .LVU1113
+	call	va_stream_render
+.LVL324:
+	.loc 1 625 50 is_stmt 1 discriminator 3 view .LVU1114
+	.loc 1 625 50 is_stmt 0 discriminator 3 view .LVU1115
+	jmp	.L351
+.L358:
+	.loc 1 625 50 discriminator 3 view .LVU1116
+.LBE739:
+	.loc 1 630 5 is_stmt 1 view .LVU1117
+	movl	24(%rbx), %edx
+	movq	%rbx, %rdi
+	.loc 1 631 1 is_stmt 0 view .LVU1118
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	.loc 1 630 5 view .LVU1119
+	movl	$32, %esi
+	.loc 1 631 1 view .LVU1120
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL325:
+	.loc 1 631 1 view .LVU1121
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL326:
+	.loc 1 630 5 view .LVU1122
+	jmp	render_fill
+.LVL327:
+	.loc 1 630 5 view .LVU1123
+	.cfi_endproc
+.LFE566:
+	.size	render_rawstr, .-render_rawstr
+	.type	render_int, @function
+render_int:
+.LVL328:
+.LFB591:
+	.loc 1 1500 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1502 5 view .LVU1125
+	.loc 1 1500 1 is_stmt 0 view .LVU1126
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%edx, %eax
+	movl	%ecx, %r8d
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+.LVL329:
+	.loc 1 1500 1 view .LVU1127
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 144
+	.loc 1 1502 13 view .LVU1128
+	movl	32(%rbx), %esi
+.LVL330:
+	.loc 1 1502 20 view .LVU1129
+	movl	%esi, %edx
+.LVL331:
+	.loc 1 1502 20 view .LVU1130
+	shrl	$21, %edx
+	.loc 1 1502 8 view .LVU1131
+	testb	$62, %dl
+	je	.L360
+	.loc 1 1503 9 is_stmt 1 view .LVU1132
+	.loc 1 1503 14 is_stmt 0 view .LVU1133
+	movl	%edx, %eax
+.LVL332:
+	.loc 1 1503 14 view .LVU1134
+	andl	$63, %eax
+.LVL333:
+.L360:
+	.loc 1 1505 5 is_stmt 1 view .LVU1135
+	.loc 1 1505 8 is_stmt 0 view .LVU1136
+	movl	$36, %ecx
+.LVL334:
+	.loc 1 1505 8 view .LVU1137
+	cmpl	%ecx, %eax
+	cmovbe	%rax, %rcx
+.LVL335:
+	.loc 1 1510 5 is_stmt 1 view .LVU1138
+	.loc 1 1510 8 is_stmt 0 view .LVU1139
+	cmpb	$45, %r8b
+	jne	.L361
+	.loc 1 1511 9 is_stmt 1 view .LVU1140
+	.loc 1 1511 11 is_stmt 0 view .LVU1141
+	negq	%rdi
+.LVL336:
+.L361:
+	.loc 1 1514 5 is_stmt 1 view .LVU1142
+	.loc 1 1515 5 view .LVU1143
+	.loc 1 1516 5 view .LVU1144
+	.loc 1 1516 8 is_stmt 0 view .LVU1145
+	testq	%rdi, %rdi
+	je	.L405
+	.loc 1 1517 9 is_stmt 1 view .LVU1146
+	.loc 1 1517 12 is_stmt 0 view .LVU1147
+	testb	$1, %sil
+	je	.L405
+	.loc 1 1518 13 is_stmt 1 view .LVU1148
+	cmpl	$16, %eax
+	je	.L363
+	ja	.L364
+	cmpl	$2, %eax
+	je	.L365
+	.loc 1 1515 19 is_stmt 0 view .LVU1149
+	xorl	%ebp, %ebp
+	movb	$48, %r15b
+	cmpl	$8, %eax
+	cmovne	%ebp, %r15d
+	jmp	.L362
+.L364:
+	.loc 1 1518 13 view .LVU1150
+	cmpl	$32, %eax
+	jne	.L405
+	.loc 1 1531 17 is_stmt 1 view .LVU1151
+.LVL337:
+	.loc 1 1532 17 view .LVU1152
+	.loc 1 1532 35 is_stmt 0 view .LVU1153
+	movl	%esi, %edx
+	andl	$2, %edx
+	.loc 1 1532 25 view .LVU1154
+	cmpl	$1, %edx
+	sbbl	%ebp, %ebp
+	andl	$32, %ebp
+	addl	$69, %ebp
+	jmp	.L445
+.LVL338:
+.L365:
+	.loc 1 1520 17 is_stmt 1 view .LVU1155
+	.loc 1 1521 17 view .LVU1156
+	.loc 1 1521 35 is_stmt 0 view .LVU1157
+	movl	%esi, %edx
+	andl	$2, %edx
+	.loc 1 1521 25 view .LVU1158
+	cmpl	$1, %edx
+	sbbl	%ebp, %ebp
+	andl	$32, %ebp
+	addl	$66, %ebp
+	jmp	.L445
+.LVL339:
+.L363:
+	.loc 1 1527 17 is_stmt 1 view .LVU1159
+	.loc 1 1528 17 view .LVU1160
+	.loc 1 1528 35 is_stmt 0 view .LVU1161
+	movl	%esi, %edx
+	andl	$2, %edx
+	.loc 1 1528 25 view .LVU1162
+	cmpl	$1, %edx
+	sbbl	%ebp, %ebp
+	andl	$32, %ebp
+	addl	$88, %ebp
+.L445:
+	movb	$48, %r15b
+	jmp	.L362
+.LVL340:
+.L405:
+	.loc 1 1515 19 view .LVU1163
+	xorl	%ebp, %ebp
+	.loc 1 1514 19 view .LVU1164
+	xorl	%r15d, %r15d
+.LVL341:
+.L362:
+	.loc 1 1539 5 is_stmt 1 view .LVU1165
+	.loc 1 1540 5 view .LVU1166
+	.loc 1 1543 31 is_stmt 0 view .LVU1167
+	leaq	0(,%rsi,4), %r9
+	andl	$8, %r9d
+	.loc 1 1540 8 view .LVU1168
+	cmpl	$32, %eax
+	jbe	.L367
+	.loc 1 1543 5 is_stmt 1 view .LVU1169
+	.loc 1 1543 17 is_stmt 0 view .LVU1170
+	leaq	digit2_std(%rip), %rax
+	movq	(%rax,%r9), %r9
+.LVL342:
+	.loc 1 1546 5 is_stmt 1 view .LVU1171
+	.loc 1 1547 5 view .LVU1172
+	.loc 1 1548 5 view .LVU1173
+	.loc 1 1549 5 view .LVU1174
+	.loc 1 1549 8 is_stmt 0 view .LVU1175
+	testq	%rdi, %rdi
+	jne	.L368
+.LVL343:
+.LBB766:
+.LBI766:
+	.loc 1 1490 24 is_stmt 1 view .LVU1176
+.LBB767:
+	.loc 1 1492 5 view .LVU1177
+	.loc 1 1492 5 is_stmt 0 view .LVU1178
+.LBE767:
+.LBE766:
+	.loc 1 1549 17 view .LVU1179
+	cmpl	$0, 28(%rbx)
+	.loc 1 1548 11 view .LVU1180
+	leaq	80(%rsp), %r13
+.LVL344:
+	.loc 1 1549 17 view .LVU1181
+	jne	.L369
+	jmp	.L370
+.LVL345:
+.L367:
+	.loc 1 1540 37 discriminator 1 view .LVU1182
+	movl	%esi, %edx
+	.loc 1 1541 16 discriminator 1 view .LVU1183
+	leaq	digit2_b32(%rip), %r10
+	.loc 1 1540 37 discriminator 1 view .LVU1184
+	shrl	$10, %edx
+	.loc 1 1540 50 discriminator 1 view .LVU1185
+	andl	$7, %edx
+	.loc 1 1541 16 discriminator 1 view .LVU1186
+	decl	%edx
+	leaq	digit2_std(%rip), %rdx
+	cmove	%r10, %rdx
+.LVL346:
+	.loc 1 1543 5 is_stmt 1 discriminator 1 view .LVU1187
+	.loc 1 1543 17 is_stmt 0 discriminator 1 view .LVU1188
+	movq	(%rdx,%r9), %r9
+.LVL347:
+	.loc 1 1546 5 is_stmt 1 discriminator 1 view .LVU1189
+	.loc 1 1547 5 discriminator 1 view .LVU1190
+	.loc 1 1548 5 discriminator 1 view .LVU1191
+	.loc 1 1549 5 discriminator 1 view .LVU1192
+	.loc 1 1549 8 is_stmt 0 discriminator 1 view .LVU1193
+	testq	%rdi, %rdi
+	jne	.L372
+.LVL348:
+.LBB769:
+	.loc 1 1490 24 is_stmt 1 view .LVU1194
+.LBB768:
+	.loc 1 1492 5 view .LVU1195
+	.loc 1 1492 5 is_stmt 0 view .LVU1196
+.LBE768:
+.LBE769:
+	.loc 1 1549 17 view .LVU1197
+	cmpl	$0, 28(%rbx)
+	.loc 1 1548 11 view .LVU1198
+	leaq	80(%rsp), %r13
+.LVL349:
+	.loc 1 1549 17 view .LVU1199
+	je	.L370
+.LVL350:
+.L372:
+	.loc 1 1550 9 is_stmt 1 view .LVU1200
+	.loc 1 1550 12 is_stmt 0 view .LVU1201
+	cmpl	$10, %eax
+	jne	.L369
+	.loc 1 1550 26 discriminator 1 view .LVU1202
+	leaq	digit2_std(%rip), %rax
+	cmpq	%rax, %rdx
+	jne	.L368
+	.loc 1 1548 11 view .LVU1203
+	leaq	80(%rsp), %rcx
+.LVL351:
+.LBB770:
+	.loc 1 1553 43 view .LVU1204
+	movl	$100, %r10d
+	.loc 1 1555 36 view .LVU1205
+	leaq	digit_pair(%rip), %r11
+.LVL352:
+.L373:
+	.loc 1 1555 36 view .LVU1206
+.LBE770:
+	.loc 1 1552 22 is_stmt 1 view .LVU1207
+	cmpq	$99, %rdi
+	jbe	.L447
+.LBB771:
+	.loc 1 1553 17 view .LVU1208
+	.loc 1 1553 43 is_stmt 0 view .LVU1209
+	movq	%rdi, %rax
+	xorl	%edx, %edx
+	.loc 1 1556 24 view .LVU1210
+	subq	$2, %rcx
+.LVL353:
+	.loc 1 1553 43 view .LVU1211
+	divq	%r10
+	movq	%rax, %rdi
+.LVL354:
+	.loc 1 1554 17 is_stmt 1 view .LVU1212
+	.loc 1 1555 17 view .LVU1213
+	.loc 1 1555 24 is_stmt 0 view .LVU1214
+	movb	1(%r11,%rdx,2), %al
+.LVL355:
+	.loc 1 1555 24 view .LVU1215
+	movb	%al, 1(%rcx)
+	.loc 1 1556 17 is_stmt 1 view .LVU1216
+.LVL356:
+	.loc 1 1556 24 is_stmt 0 view .LVU1217
+	movb	(%r11,%rdx,2), %al
+	movb	%al, (%rcx)
+	jmp	.L373
+.LVL357:
+.L447:
+	.loc 1 1556 24 view .LVU1218
+.LBE771:
+	.loc 1 1558 13 is_stmt 1 view .LVU1219
+	.loc 1 1558 16 is_stmt 0 view .LVU1220
+	cmpq	$9, %rdi
+	jbe	.L375
+.LBB772:
+	.loc 1 1559 17 is_stmt 1 view .LVU1221
+	.loc 1 1559 26 is_stmt 0 view .LVU1222
+	addl	%edi, %edi
+.LVL358:
+	.loc 1 1560 17 is_stmt 1 view .LVU1223
+	.loc 1 1560 36 is_stmt 0 view .LVU1224
+	leaq	digit_pair(%rip), %rax
+	.loc 1 1561 24 view .LVU1225
+	leaq	-2(%rcx), %r13
+	.loc 1 1560 36 view .LVU1226
+	leal	1(%rdi), %edx
+	.loc 1 1560 24 view .LVU1227
+	movb	(%rax,%rdx), %dl
+	.loc 1 1561 24 view .LVU1228
+	movb	(%rax,%rdi), %al
+	.loc 1 1560 24 view .LVU1229
+	movb	%dl, -1(%rcx)
+	.loc 1 1561 17 is_stmt 1 view .LVU1230
+.LVL359:
+	.loc 1 1561 24 is_stmt 0 view .LVU1231
+	movb	%al, -2(%rcx)
+.LBE772:
+	jmp	.L370
+.LVL360:
+.L375:
+	.loc 1 1564 17 is_stmt 1 view .LVU1232
+	.loc 1 1564 24 is_stmt 0 view .LVU1233
+	movb	(%r9,%rdi), %al
+	leaq	-1(%rcx), %r13
+.LVL361:
+	.loc 1 1564 24 view .LVU1234
+	movb	%al, -1(%rcx)
+	jmp	.L370
+.LVL362:
+.L369:
+	.loc 1 1567 14 is_stmt 1 view .LVU1235
+	.loc 1 1567 32 is_stmt 0 view .LVU1236
+	leal	-1(%rcx), %eax
+	.loc 1 1567 17 view .LVU1237
+	testl	%ecx, %eax
+	jne	.L368
+.LBB773:
+	.loc 1 1569 13 is_stmt 1 view .LVU1238
+	.loc 1 1569 40 is_stmt 0 view .LVU1239
+	bsfl	%ecx, %ecx
+.LVL363:
+	.loc 1 1569 40 view .LVU1240
+.LBE773:
+	.loc 1 1548 11 view .LVU1241
+	leaq	80(%rsp), %r13
+.LVL364:
+.L376:
+.LBB774:
+	.loc 1 1570 13 is_stmt 1 discriminator 1 view .LVU1242
+	.loc 1 1571 17 discriminator 1 view .LVU1243
+	.loc 1 1571 34 is_stmt 0 discriminator 1 view .LVU1244
+	movq	%rax, %rdx
+	.loc 1 1571 24 discriminator 1 view .LVU1245
+	decq	%r13
+.LVL365:
+	.loc 1 1571 34 discriminator 1 view .LVU1246
+	andq	%rdi, %rdx
+	.loc 1 1572 19 discriminator 1 view .LVU1247
+	shrq	%cl, %rdi
+.LVL366:
+	.loc 1 1571 24 discriminator 1 view .LVU1248
+	movb	(%r9,%rdx), %dl
+	movb	%dl, 0(%r13)
+	.loc 1 1572 17 is_stmt 1 discriminator 1 view .LVU1249
+.LVL367:
+	.loc 1 1573 24 discriminator 1 view .LVU1250
+	testq	%rdi, %rdi
+	jne	.L376
+	.loc 1 1573 24 is_stmt 0 discriminator 1 view .LVU1251
+	jmp	.L370
+.LVL368:
+.L368:
+	.loc 1 1573 24 discriminator 1 view .LVU1252
+.LBE774:
+	.loc 1 1548 11 view .LVU1253
+	leaq	80(%rsp), %r13
+.LVL369:
+.L377:
+	.loc 1 1576 13 is_stmt 1 discriminator 1 view .LVU1254
+	.loc 1 1577 17 discriminator 1 view .LVU1255
+	movq	%rdi, %rax
+	xorl	%edx, %edx
+	.loc 1 1577 24 is_stmt 0 discriminator 1 view .LVU1256
+	decq	%r13
+.LVL370:
+	.loc 1 1577 24 discriminator 1 view .LVU1257
+	divq	%rcx
+.LVL371:
+	.loc 1 1577 24 discriminator 1 view .LVU1258
+	movb	(%r9,%rdx), %dl
+	movb	%dl, 0(%r13)
+	.loc 1 1578 17 is_stmt 1 discriminator 1 view .LVU1259
+	movq	%rdi, %rdx
+	.loc 1 1578 19 is_stmt 0 discriminator 1 view .LVU1260
+	movq	%rax, %rdi
+.LVL372:
+	.loc 1 1579 24 is_stmt 1 discriminator 1 view .LVU1261
+	cmpq	%rcx, %rdx
+	jnb	.L377
+.LVL373:
+.L370:
+	.loc 1 1582 5 view .LVU1262
+.LBB775:
+.LBB776:
+	.loc 1 1492 13 is_stmt 0 view .LVU1263
+	movl	28(%rbx), %edx
+.LBE776:
+.LBE775:
+	.loc 1 1582 35 view .LVU1264
+	leaq	80(%rsp), %r14
+.LVL374:
+.LBB779:
+.LBB777:
+	.loc 1 1492 40 view .LVU1265
+	movl	$1, %eax
+.LBE777:
+.LBE779:
+	.loc 1 1582 35 view .LVU1266
+	subq	%r13, %r14
+.LVL375:
+	.loc 1 1583 5 is_stmt 1 view .LVU1267
+	.loc 1 1584 5 view .LVU1268
+.LBB780:
+.LBI775:
+	.loc 1 1490 24 view .LVU1269
+.LBB778:
+	.loc 1 1492 5 view .LVU1270
+	.loc 1 1492 40 is_stmt 0 view .LVU1271
+	cmpl	$2147483647, %edx
+	cmovne	%edx, %eax
+.LVL376:
+	.loc 1 1492 40 view .LVU1272
+	cmpl	%r14d, %eax
+	cmovb	%r14d, %eax
+.LVL377:
+	.loc 1 1492 40 view .LVU1273
+.LBE778:
+.LBE780:
+	.loc 1 1588 5 is_stmt 1 view .LVU1274
+	.loc 1 1589 5 view .LVU1275
+	.loc 1 1590 5 view .LVU1276
+	.loc 1 1589 12 is_stmt 0 view .LVU1277
+	xorl	%r12d, %r12d
+	testb	%r15b, %r15b
+	setne	%r12b
+	.loc 1 1590 9 view .LVU1278
+	cmpb	$1, %bpl
+	sbbl	$-1, %r12d
+	cmpb	$1, %r8b
+	sbbl	$-1, %r12d
+	addl	%eax, %r12d
+.LVL378:
+	.loc 1 1592 5 is_stmt 1 view .LVU1279
+	.loc 1 1592 18 is_stmt 0 view .LVU1280
+	movl	%esi, %eax
+	andl	$12, %eax
+	.loc 1 1592 48 view .LVU1281
+	cmpl	$4, %eax
+	jne	.L379
+	.loc 1 1592 48 view .LVU1282
+	cmpl	$2147483647, %edx
+	jne	.L379
+	movl	24(%rbx), %eax
+	cmpl	%eax, %r12d
+	cmovb	%eax, %r12d
+.LVL379:
+.L379:
+	.loc 1 1599 5 is_stmt 1 view .LVU1283
+	.loc 1 1599 8 is_stmt 0 view .LVU1284
+	andl	$8, %esi
+	movl	%esi, %edx
+	jne	.L380
+	.loc 1 1600 9 is_stmt 1 view .LVU1285
+	.loc 1 1600 22 is_stmt 0 view .LVU1286
+	movl	24(%rbx), %eax
+	.loc 1 1600 56 view .LVU1287
+	cmpl	%eax, %r12d
+	jnb	.L381
+	.loc 1 1600 56 discriminator 1 view .LVU1288
+	subl	%r12d, %eax
+	movl	%eax, %edx
+.L381:
+	.loc 1 1600 18 discriminator 4 view .LVU1289
+	movl	%edx, 24(%rbx)
+	.loc 1 1601 9 is_stmt 1 discriminator 4 view .LVU1290
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	movl	%r8d, 12(%rsp)
+	call	render_fill
+.LVL380:
+	.loc 1 1601 9 is_stmt 0 discriminator 4 view .LVU1291
+	movl	12(%rsp), %r8d
+.L380:
+	.loc 1 1604 5 is_stmt 1 view .LVU1292
+	.loc 1 1604 8 is_stmt 0 view .LVU1293
+	testb	%r8b, %r8b
+	je	.L382
+	.loc 1 1605 9 is_stmt 1 view .LVU1294
+	movzbl	%r8b, %esi
+	movq	%rbx, %rdi
+	.loc 1 1606 12 is_stmt 0 view .LVU1295
+	decl	%r12d
+.LVL381:
+	.loc 1 1605 9 view .LVU1296
+	call	va_stream_render
+.LVL382:
+	.loc 1 1606 9 is_stmt 1 view .LVU1297
+.L382:
+	.loc 1 1608 5 view .LVU1298
+	.loc 1 1608 8 is_stmt 0 view .LVU1299
+	testb	%r15b, %r15b
+	je	.L383
+	.loc 1 1609 9 is_stmt 1 view .LVU1300
+	movl	$48, %esi
+	movq	%rbx, %rdi
+	.loc 1 1610 12 is_stmt 0 view .LVU1301
+	decl	%r12d
+.LVL383:
+	.loc 1 1609 9 view .LVU1302
+	call	va_stream_render
+.LVL384:
+	.loc 1 1610 9 is_stmt 1 view .LVU1303
+.L383:
+	.loc 1 1612 5 view .LVU1304
+	.loc 1 1612 8 is_stmt 0 view .LVU1305
+	testb	%bpl, %bpl
+	je	.L384
+	.loc 1 1613 9 is_stmt 1 view .LVU1306
+	movzbl	%bpl, %esi
+	movq	%rbx, %rdi
+	.loc 1 1614 12 is_stmt 0 view .LVU1307
+	decl	%r12d
+.LVL385:
+	.loc 1 1613 9 view .LVU1308
+	call	va_stream_render
+.LVL386:
+	.loc 1 1614 9 is_stmt 1 view .LVU1309
+.L384:
+	.loc 1 1617 5 view .LVU1310
+	movl	%r12d, %edx
+	movl	$48, %esi
+	movq	%rbx, %rdi
+.LBB781:
+.LBB782:
+	.loc 1 639 22 is_stmt 0 view .LVU1311
+	movl	%r14d, %r12d
+.LVL387:
+	.loc 1 639 22 view .LVU1312
+.LBE782:
+.LBE781:
+	.loc 1 1617 5 view .LVU1313
+	subl	%r14d, %edx
+.LVL388:
+	.loc 1 1617 5 view .LVU1314
+	call	render_fill
+.LVL389:
+	.loc 1 1619 5 is_stmt 1 view .LVU1315
+.LBB820:
+.LBI781:
+	.loc 1 637 13 view .LVU1316
+.LBB819:
+	.loc 1 639 5 view .LVU1317
+	.loc 1 639 22 is_stmt 0 view .LVU1318
+	movl	24(%rbx), %edx
+	.loc 1 639 56 view .LVU1319
+	xorl	%eax, %eax
+	cmpl	%r14d, %edx
+	jbe	.L385
+	movl	%edx, %eax
+	subl	%r14d, %eax
+.L385:
+	.loc 1 639 14 view .LVU1320
+	movl	%eax, 24(%rbx)
+	.loc 1 640 5 is_stmt 1 view .LVU1321
+	.loc 1 640 34 is_stmt 0 view .LVU1322
+	testb	$32, 32(%rbx)
+	jne	.L388
+	testq	%r12, %r12
+	je	.L388
+	.loc 1 643 5 is_stmt 1 view .LVU1323
+	.loc 1 643 10 is_stmt 0 view .LVU1324
+	movq	(%rbx), %rax
+	.loc 1 643 16 view .LVU1325
+	movq	40(%rax), %rdx
+	.loc 1 643 8 view .LVU1326
+	testq	%rdx, %rdx
+	je	.L389
+	.loc 1 644 9 is_stmt 1 view .LVU1327
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	*%rdx
+.LVL390:
+	.loc 1 645 9 view .LVU1328
+	jmp	.L388
+.L389:
+	.loc 1 647 5 view .LVU1329
+	.loc 1 647 20 is_stmt 0 view .LVU1330
+	movb	48(%rax), %dl
+	.loc 1 647 5 view .LVU1331
+	cmpb	$2, %dl
+	je	.L390
+	cmpb	$3, %dl
+	je	.L391
+	decb	%dl
+	jne	.L394
+	.loc 1 649 9 is_stmt 1 view .LVU1332
+.LVL391:
+.LBB783:
+.LBI783:
+	.loc 2 585 19 view .LVU1333
+.LBB784:
+	.loc 2 587 5 view .LVU1334
+.LBB785:
+.LBI785:
+	.loc 2 574 22 view .LVU1335
+.LBB786:
+	.loc 2 576 5 view .LVU1336
+	.loc 2 576 39 is_stmt 0 view .LVU1337
+	movq	48(%rbx), %rdx
+	subq	40(%rbx), %rdx
+.LBE786:
+.LBE785:
+	.loc 2 587 8 view .LVU1338
+	cmpq	%r12, %rdx
+	jnb	.L393
+	.loc 2 590 5 is_stmt 1 view .LVU1339
+	.loc 2 590 20 is_stmt 0 view .LVU1340
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU1341
+	testq	%rax, %rax
+	je	.L394
+	.loc 2 590 40 view .LVU1342
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL392:
+	.loc 2 590 37 view .LVU1343
+	testb	%al, %al
+	je	.L394
+.L393:
+.LVL393:
+	.loc 2 590 37 view .LVU1344
+.LBE784:
+.LBE783:
+	.loc 1 650 13 is_stmt 1 view .LVU1345
+	movq	40(%rbx), %rdi
+	movq	%r13, %rsi
+	movq	%r12, %rcx
+	rep movsb
+	.loc 1 651 13 view .LVU1346
+	.loc 1 651 44 is_stmt 0 view .LVU1347
+	addq	%r12, 40(%rbx)
+	.loc 1 652 13 is_stmt 1 view .LVU1348
+	jmp	.L388
+.L390:
+	.loc 1 657 9 view .LVU1349
+.LBB787:
+.LBB788:
+.LBB789:
+.LBB790:
+	.loc 2 576 39 is_stmt 0 view .LVU1350
+	movq	48(%rbx), %rdx
+.LBE790:
+.LBE789:
+.LBE788:
+.LBE787:
+	.loc 1 657 13 view .LVU1351
+	leaq	(%r12,%r12), %rbp
+.LVL394:
+.LBB795:
+.LBI787:
+	.loc 2 585 19 is_stmt 1 view .LVU1352
+.LBB793:
+	.loc 2 587 5 view .LVU1353
+.LBB792:
+.LBI789:
+	.loc 2 574 22 view .LVU1354
+.LBB791:
+	.loc 2 576 5 view .LVU1355
+	.loc 2 576 39 is_stmt 0 view .LVU1356
+	subq	40(%rbx), %rdx
+.LBE791:
+.LBE792:
+	.loc 2 587 8 view .LVU1357
+	cmpq	%rbp, %rdx
+	jb	.L395
+.L398:
+.LVL395:
+	.loc 2 587 8 view .LVU1358
+.LBE793:
+.LBE795:
+.LBB796:
+	.loc 1 658 13 is_stmt 1 view .LVU1359
+	.loc 1 658 23 is_stmt 0 view .LVU1360
+	movq	40(%rbx), %rdx
+.LVL396:
+	.loc 1 659 13 is_stmt 1 view .LVU1361
+.LBB797:
+	.loc 1 659 18 view .LVU1362
+	.loc 1 659 34 view .LVU1363
+	.loc 1 659 25 is_stmt 0 view .LVU1364
+	xorl	%eax, %eax
+	jmp	.L396
+.LVL397:
+.L395:
+	.loc 1 659 25 view .LVU1365
+.LBE797:
+.LBE796:
+.LBB800:
+.LBB794:
+	.loc 2 590 5 is_stmt 1 view .LVU1366
+	.loc 2 590 20 is_stmt 0 view .LVU1367
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU1368
+	testq	%rax, %rax
+	je	.L394
+	.loc 2 590 40 view .LVU1369
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL398:
+	.loc 2 590 37 view .LVU1370
+	testb	%al, %al
+	jne	.L398
+	jmp	.L394
+.LVL399:
+.L396:
+	.loc 2 590 37 view .LVU1371
+.LBE794:
+.LBE800:
+.LBB801:
+.LBB798:
+	.loc 1 660 17 is_stmt 1 view .LVU1372
+	.loc 1 660 24 is_stmt 0 view .LVU1373
+	movzbl	0(%r13,%rax), %ecx
+	movw	%cx, (%rdx,%rax,2)
+	.loc 1 659 40 is_stmt 1 view .LVU1374
+	incq	%rax
+.LVL400:
+	.loc 1 659 34 view .LVU1375
+	cmpq	%r12, %rax
+	jb	.L396
+.LBE798:
+	.loc 1 662 13 view .LVU1376
+.LBB799:
+	.loc 1 660 19 is_stmt 0 view .LVU1377
+	testq	%r12, %r12
+	movl	$2, %eax
+.LVL401:
+	.loc 1 660 19 view .LVU1378
+	jmp	.L446
+.LVL402:
+.L391:
+	.loc 1 660 19 view .LVU1379
+.LBE799:
+.LBE801:
+	.loc 1 668 9 is_stmt 1 view .LVU1380
+.LBB802:
+.LBB803:
+.LBB804:
+.LBB805:
+	.loc 2 576 39 is_stmt 0 view .LVU1381
+	movq	48(%rbx), %rdx
+.LBE805:
+.LBE804:
+.LBE803:
+.LBE802:
+	.loc 1 668 13 view .LVU1382
+	leaq	0(,%r12,4), %rbp
+.LVL403:
+.LBB810:
+.LBI802:
+	.loc 2 585 19 is_stmt 1 view .LVU1383
+.LBB808:
+	.loc 2 587 5 view .LVU1384
+.LBB807:
+.LBI804:
+	.loc 2 574 22 view .LVU1385
+.LBB806:
+	.loc 2 576 5 view .LVU1386
+	.loc 2 576 39 is_stmt 0 view .LVU1387
+	subq	40(%rbx), %rdx
+.LBE806:
+.LBE807:
+	.loc 2 587 8 view .LVU1388
+	cmpq	%rbp, %rdx
+	jb	.L399
+.L401:
+.LVL404:
+	.loc 2 587 8 view .LVU1389
+.LBE808:
+.LBE810:
+.LBB811:
+	.loc 1 669 13 is_stmt 1 view .LVU1390
+	.loc 1 669 23 is_stmt 0 view .LVU1391
+	movq	40(%rbx), %rdx
+.LVL405:
+	.loc 1 670 13 is_stmt 1 view .LVU1392
+.LBB812:
+	.loc 1 670 18 view .LVU1393
+	.loc 1 670 34 view .LVU1394
+	.loc 1 670 25 is_stmt 0 view .LVU1395
+	xorl	%eax, %eax
+	jmp	.L400
+.LVL406:
+.L399:
+	.loc 1 670 25 view .LVU1396
+.LBE812:
+.LBE811:
+.LBB816:
+.LBB809:
+	.loc 2 590 5 is_stmt 1 view .LVU1397
+	.loc 2 590 20 is_stmt 0 view .LVU1398
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU1399
+	testq	%rax, %rax
+	je	.L394
+	.loc 2 590 40 view .LVU1400
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL407:
+	.loc 2 590 37 view .LVU1401
+	testb	%al, %al
+	jne	.L401
+	jmp	.L394
+.LVL408:
+.L400:
+	.loc 2 590 37 view .LVU1402
+.LBE809:
+.LBE816:
+.LBB817:
+.LBB813:
+	.loc 1 671 17 is_stmt 1 view .LVU1403
+	.loc 1 671 24 is_stmt 0 view .LVU1404
+	movzbl	0(%r13,%rax), %ecx
+	movl	%ecx, (%rdx,%rax,4)
+	.loc 1 670 40 is_stmt 1 view .LVU1405
+	incq	%rax
+.LVL409:
+	.loc 1 670 34 view .LVU1406
+	cmpq	%r12, %rax
+	jb	.L400
+.LBE813:
+	.loc 1 673 13 view .LVU1407
+.LBB814:
+	.loc 1 671 19 is_stmt 0 view .LVU1408
+	testq	%r12, %r12
+	movl	$4, %eax
+.LVL410:
+.L446:
+	.loc 1 671 19 view .LVU1409
+	cmove	%rax, %rbp
+	addq	%rbp, %rdx
+	movq	%rdx, 40(%rbx)
+.LBE814:
+	.loc 1 674 13 is_stmt 1 view .LVU1410
+	jmp	.L388
+.L394:
+.LBB815:
+	.loc 1 670 25 is_stmt 0 view .LVU1411
+	xorl	%ebp, %ebp
+.L402:
+.LVL411:
+	.loc 1 670 25 view .LVU1412
+.LBE815:
+.LBE817:
+.LBB818:
+	.loc 1 679 9 is_stmt 1 view .LVU1413
+	.loc 1 679 16 is_stmt 0 view .LVU1414
+	movq	(%rbx), %rax
+	.loc 1 679 9 view .LVU1415
+	movzbl	0(%r13,%rbp), %esi
+	.loc 1 678 32 view .LVU1416
+	incq	%rbp
+.LVL412:
+	.loc 1 679 9 view .LVU1417
+	movq	%rbx, %rdi
+	call	*8(%rax)
+.LVL413:
+	.loc 1 678 32 is_stmt 1 view .LVU1418
+	.loc 1 678 26 view .LVU1419
+	cmpq	%r12, %rbp
+	jb	.L402
+.LVL414:
+.L388:
+	.loc 1 678 26 is_stmt 0 view .LVU1420
+.LBE818:
+.LBE819:
+.LBE820:
+	.loc 1 1621 5 is_stmt 1 view .LVU1421
+	movl	24(%rbx), %edx
+	.loc 1 1622 1 is_stmt 0 view .LVU1422
+	addq	$88, %rsp
+	.cfi_def_cfa_offset 56
+	.loc 1 1621 5 view .LVU1423
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	.loc 1 1622 1 view .LVU1424
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL415:
+	.loc 1 1622 1 view .LVU1425
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL416:
+	.loc 1 1622 1 view .LVU1426
+	popq	%r14
+	.cfi_def_cfa_offset 16
+.LVL417:
+	.loc 1 1622 1 view .LVU1427
+	popq	%r15
+	.cfi_def_cfa_offset 8
+.LVL418:
+	.loc 1 1621 5 view .LVU1428
+	jmp	render_fill
+.LVL419:
+	.loc 1 1621 5 view .LVU1429
+	.cfi_endproc
+.LFE591:
+	.size	render_int, .-render_int
+	.section	.rodata.str1.1
+.LC13:
+	.string	"void*"
+	.text
+	.type	render_ptr, @function
+render_ptr:
+.LVL420:
+.LFB568:
+	.loc 1 684 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 685 5 view .LVU1431
+	.loc 1 685 13 is_stmt 0 view .LVU1432
+	movl	32(%rdi), %eax
+	.loc 1 685 20 view .LVU1433
+	movl	%eax, %edx
+	shrl	$10, %edx
+	.loc 1 685 33 view .LVU1434
+	andl	$7, %edx
+	.loc 1 685 8 view .LVU1435
+	cmpl	$4, %edx
+	jne	.L449
+.LVL421:
+.LBB823:
+.LBI823:
+	.loc 1 683 13 is_stmt 1 view .LVU1436
+.LBB824:
+	.loc 1 686 9 view .LVU1437
+	leaq	.LC13(%rip), %rsi
+.LVL422:
+	.loc 1 686 9 is_stmt 0 view .LVU1438
+	jmp	render_rawstr
+.LVL423:
+.L449:
+	.loc 1 686 9 view .LVU1439
+.LBE824:
+.LBE823:
+	.loc 1 689 5 is_stmt 1 view .LVU1440
+	.loc 1 689 8 is_stmt 0 view .LVU1441
+	testl	$458752, %eax
+	je	.L450
+	.loc 1 690 9 is_stmt 1 view .LVU1442
+	.loc 1 690 16 is_stmt 0 view .LVU1443
+	orl	$1, %eax
+	movl	%eax, 32(%rdi)
+.L450:
+	.loc 1 692 5 is_stmt 1 view .LVU1444
+	xorl	%ecx, %ecx
+	movl	$16, %edx
+	jmp	render_int
+.LVL424:
+	.loc 1 692 5 is_stmt 0 view .LVU1445
+	.cfi_endproc
+.LFE568:
+	.size	render_ptr, .-render_ptr
+	.type	iter_plain_bulk, @function
+iter_plain_bulk:
+.LVL425:
+.LFB582:
+	.loc 1 1040 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1041 5 view .LVU1447
+	.loc 1 1040 1 is_stmt 0 view .LVU1448
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+	.loc 1 1041 8 view .LVU1449
+	testb	$32, 32(%rdi)
+	jne	.L455
+	.loc 1 1041 39 discriminator 1 view .LVU1450
+	movq	(%rdi), %rax
+	.loc 1 1041 45 discriminator 1 view .LVU1451
+	movb	48(%rax), %dl
+.LVL426:
+	.loc 1 1041 34 discriminator 1 view .LVU1452
+	testb	%dl, %dl
+	je	.L455
+	.loc 1 1042 9 is_stmt 1 view .LVU1453
+	.loc 1 1042 12 is_stmt 0 view .LVU1454
+	cmpq	$0, 40(%rax)
+	je	.L456
+	.loc 1 1043 13 is_stmt 1 view .LVU1455
+	movq	%r12, %rdx
+	call	iter_len_bulk
+.LVL427:
+	.loc 1 1043 13 is_stmt 0 view .LVU1456
+	jmp	.L455
+.LVL428:
+.L456:
+	.loc 1 1045 14 is_stmt 1 view .LVU1457
+	.loc 1 1045 22 is_stmt 0 view .LVU1458
+	movq	(%rsi), %rax
+	.loc 1 1045 17 view .LVU1459
+	cmpb	51(%rax), %dl
+	jne	.L457
+	.loc 1 1046 13 is_stmt 1 view .LVU1460
+	movq	%r12, %rdx
+	call	iter_copy_bulk
+.LVL429:
+	.loc 1 1046 13 is_stmt 0 view .LVU1461
+	jmp	.L455
+.LVL430:
+.L457:
+	.loc 1 1048 14 is_stmt 1 view .LVU1462
+	.loc 1 1048 17 is_stmt 0 view .LVU1463
+	cmpq	$0, 40(%rax)
+	je	.L455
+	.loc 1 1049 13 is_stmt 1 view .LVU1464
+	movq	%r12, %rdx
+	call	iter_transcode_bulk
+.LVL431:
+.L455:
+	.loc 1 1052 5 view .LVU1465
+	.loc 1 1052 23 is_stmt 0 view .LVU1466
+	movq	(%rbx), %rax
+	movb	51(%rax), %al
+	.loc 1 1052 5 view .LVU1467
+	cmpb	$2, %al
+	je	.L458
+	cmpb	$3, %al
+	je	.L459
+	decb	%al
+	jne	.L460
+.LBB825:
+	.loc 1 1054 9 is_stmt 1 view .LVU1468
+	.loc 1 1054 38 is_stmt 0 view .LVU1469
+	movq	8(%rbx), %r13
+.LVL432:
+	.loc 1 1055 9 is_stmt 1 view .LVU1470
+.L461:
+	.loc 1 1055 18 view .LVU1471
+	cmpq	%r12, %r13
+	jnb	.L460
+	.loc 1 1056 13 view .LVU1472
+.LVL433:
+.LBB826:
+.LBI826:
+	.loc 2 496 24 view .LVU1473
+.LBB827:
+	.loc 2 498 5 view .LVU1474
+	.loc 2 499 5 view .LVU1475
+	.loc 2 499 14 is_stmt 0 view .LVU1476
+	movzbl	0(%r13), %esi
+.LVL434:
+	.loc 2 500 5 is_stmt 1 view .LVU1477
+	.loc 2 500 8 is_stmt 0 view .LVU1478
+	cmpl	$127, %esi
+	ja	.L462
+	.loc 2 501 9 is_stmt 1 view .LVU1479
+	.loc 2 501 17 is_stmt 0 view .LVU1480
+	incq	%r13
+.LVL435:
+	.loc 2 502 9 is_stmt 1 view .LVU1481
+	.loc 2 502 16 is_stmt 0 view .LVU1482
+	jmp	.L463
+.LVL436:
+.L462:
+	.loc 2 504 5 is_stmt 1 view .LVU1483
+	.loc 2 506 38 is_stmt 0 view .LVU1484
+	movzbl	1(%r13), %eax
+	.loc 2 504 8 view .LVU1485
+	cmpl	$223, %esi
+	ja	.L464
+	.loc 2 505 9 is_stmt 1 view .LVU1486
+	.loc 2 506 28 is_stmt 0 view .LVU1487
+	sall	$6, %esi
+.LVL437:
+	.loc 2 506 42 view .LVU1488
+	andl	$63, %eax
+	.loc 2 505 17 view .LVU1489
+	addq	$2, %r13
+.LVL438:
+	.loc 2 506 9 is_stmt 1 view .LVU1490
+	.loc 2 506 28 is_stmt 0 view .LVU1491
+	andl	$1984, %esi
+	.loc 2 506 34 view .LVU1492
+	orl	%eax, %esi
+	jmp	.L463
+.LVL439:
+.L464:
+	.loc 2 508 5 is_stmt 1 view .LVU1493
+	.loc 2 510 63 is_stmt 0 view .LVU1494
+	movb	2(%r13), %dl
+	.loc 2 508 8 view .LVU1495
+	cmpl	$239, %esi
+	ja	.L465
+	.loc 2 509 9 is_stmt 1 view .LVU1496
+	.loc 2 510 28 is_stmt 0 view .LVU1497
+	sall	$12, %esi
+.LVL440:
+	.loc 2 510 53 view .LVU1498
+	sall	$6, %eax
+	.loc 2 510 67 view .LVU1499
+	andl	$63, %edx
+	.loc 2 509 17 view .LVU1500
+	addq	$3, %r13
+.LVL441:
+	.loc 2 510 9 is_stmt 1 view .LVU1501
+	.loc 2 510 28 is_stmt 0 view .LVU1502
+	movzwl	%si, %esi
+	.loc 2 510 53 view .LVU1503
+	andl	$4032, %eax
+	.loc 2 510 35 view .LVU1504
+	orl	%eax, %esi
+	.loc 2 510 59 view .LVU1505
+	orl	%edx, %esi
+	jmp	.L463
+.LVL442:
+.L465:
+	.loc 2 512 5 is_stmt 1 view .LVU1506
+	.loc 2 513 5 view .LVU1507
+	.loc 2 513 24 is_stmt 0 view .LVU1508
+	sall	$18, %esi
+.LVL443:
+	.loc 2 513 49 view .LVU1509
+	sall	$12, %eax
+	.loc 2 512 9 view .LVU1510
+	addq	$4, %r13
+.LVL444:
+	.loc 2 513 49 view .LVU1511
+	andl	$258048, %eax
+	.loc 2 513 24 view .LVU1512
+	andl	$1835008, %esi
+	.loc 2 514 25 view .LVU1513
+	sall	$6, %edx
+	.loc 2 513 31 view .LVU1514
+	orl	%eax, %esi
+	.loc 2 514 39 view .LVU1515
+	movb	-1(%r13), %al
+	.loc 2 514 25 view .LVU1516
+	andl	$4032, %edx
+	.loc 2 514 39 view .LVU1517
+	andl	$63, %eax
+	.loc 2 514 31 view .LVU1518
+	orl	%eax, %esi
+	orl	%edx, %esi
+.LVL445:
+.L463:
+	.loc 2 514 31 view .LVU1519
+.LBE827:
+.LBE826:
+	.loc 1 1056 13 view .LVU1520
+	movq	%rbp, %rdi
+	call	va_stream_render
+.LVL446:
+	jmp	.L461
+.LVL447:
+.L458:
+	.loc 1 1056 13 view .LVU1521
+.LBE825:
+.LBB828:
+	.loc 1 1062 9 is_stmt 1 view .LVU1522
+	.loc 1 1062 33 is_stmt 0 view .LVU1523
+	movq	8(%rbx), %r13
+.LVL448:
+	.loc 1 1063 9 is_stmt 1 view .LVU1524
+.L467:
+	.loc 1 1063 18 view .LVU1525
+	cmpq	%r12, %r13
+	jnb	.L460
+	.loc 1 1064 13 view .LVU1526
+.LVL449:
+.LBB829:
+.LBI829:
+	.loc 2 522 24 view .LVU1527
+.LBB830:
+	.loc 2 524 5 view .LVU1528
+	.loc 2 525 5 view .LVU1529
+	.loc 2 525 14 is_stmt 0 view .LVU1530
+	movzwl	0(%r13), %esi
+.LVL450:
+	.loc 2 526 5 is_stmt 1 view .LVU1531
+	.loc 2 526 22 is_stmt 0 view .LVU1532
+	leal	-55296(%rsi), %eax
+	.loc 2 526 8 view .LVU1533
+	cmpl	$2047, %eax
+	jbe	.L468
+	.loc 2 527 9 is_stmt 1 view .LVU1534
+	.loc 2 527 17 is_stmt 0 view .LVU1535
+	addq	$2, %r13
+.LVL451:
+	.loc 2 528 9 is_stmt 1 view .LVU1536
+	.loc 2 528 16 is_stmt 0 view .LVU1537
+	jmp	.L469
+.LVL452:
+.L468:
+	.loc 2 530 5 is_stmt 1 view .LVU1538
+	.loc 2 531 5 view .LVU1539
+	.loc 2 531 40 is_stmt 0 view .LVU1540
+	movw	2(%r13), %ax
+	.loc 2 531 25 view .LVU1541
+	sall	$10, %esi
+.LVL453:
+	.loc 2 530 9 view .LVU1542
+	addq	$4, %r13
+.LVL454:
+	.loc 2 531 25 view .LVU1543
+	andl	$1047552, %esi
+	.loc 2 531 40 view .LVU1544
+	andl	$1023, %eax
+	.loc 2 531 32 view .LVU1545
+	orl	%eax, %esi
+	.loc 2 531 50 view .LVU1546
+	addl	$65536, %esi
+.LVL455:
+.L469:
+	.loc 2 531 50 view .LVU1547
+.LBE830:
+.LBE829:
+	.loc 1 1064 13 view .LVU1548
+	movq	%rbp, %rdi
+	call	va_stream_render
+.LVL456:
+	jmp	.L467
+.LVL457:
+.L459:
+	.loc 1 1064 13 view .LVU1549
+.LBE828:
+.LBB831:
+	.loc 1 1070 9 is_stmt 1 view .LVU1550
+	.loc 1 1070 25 is_stmt 0 view .LVU1551
+	movq	8(%rbx), %r13
+.LVL458:
+	.loc 1 1071 9 is_stmt 1 view .LVU1552
+.L472:
+	.loc 1 1071 18 view .LVU1553
+	cmpq	%r12, %r13
+	jnb	.L460
+	.loc 1 1072 13 view .LVU1554
+	movl	0(%r13), %esi
+	movq	%rbp, %rdi
+	.loc 1 1072 35 is_stmt 0 view .LVU1555
+	addq	$4, %r13
+.LVL459:
+	.loc 1 1072 13 view .LVU1556
+	call	va_stream_render
+.LVL460:
+	jmp	.L472
+.LVL461:
+.L460:
+	.loc 1 1072 13 view .LVU1557
+.LBE831:
+	.loc 1 1077 5 is_stmt 1 view .LVU1558
+	.loc 1 1077 15 is_stmt 0 view .LVU1559
+	movq	%r12, 8(%rbx)
+	.loc 1 1078 1 view .LVU1560
+	popq	%rax
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL462:
+	.loc 1 1078 1 view .LVU1561
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL463:
+	.loc 1 1078 1 view .LVU1562
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL464:
+	.loc 1 1078 1 view .LVU1563
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE582:
+	.size	iter_plain_bulk, .-iter_plain_bulk
+	.type	render_quote_put, @function
+render_quote_put:
+.LVL465:
+.LFB560:
+	.loc 1 517 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 518 5 view .LVU1565
+	.loc 1 517 1 is_stmt 0 view .LVU1566
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+.LVL466:
+	.loc 1 517 1 view .LVU1567
+	movl	%edx, %esi
+.LVL467:
+	.loc 1 518 8 view .LVU1568
+	testq	%rax, %rax
+	je	.L479
+	.loc 1 519 9 is_stmt 1 view .LVU1569
+	.loc 1 519 14 is_stmt 0 view .LVU1570
+	movq	48(%rax), %rdx
+.LVL468:
+	.loc 1 519 12 view .LVU1571
+	testq	%rdx, %rdx
+	je	.L480
+	.loc 1 520 13 is_stmt 1 view .LVU1572
+.LVL469:
+.LBB837:
+.LBI837:
+	.loc 1 463 13 view .LVU1573
+.LBB838:
+	.loc 1 468 5 view .LVU1574
+	.loc 1 468 48 is_stmt 0 view .LVU1575
+	cmpl	$127, %esi
+	ja	.L481
+	.loc 1 468 44 view .LVU1576
+	movl	%esi, %ecx
+	.loc 1 468 48 view .LVU1577
+	movzbl	(%rdx,%rcx), %ecx
+.LVL470:
+	.loc 1 469 5 is_stmt 1 view .LVU1578
+	.loc 1 469 8 is_stmt 0 view .LVU1579
+	cmpl	$1, %ecx
+	ja	.L482
+.LVL471:
+.L479:
+	.loc 1 470 9 is_stmt 1 view .LVU1580
+	jmp	va_stream_render
+.LVL472:
+.L482:
+	.loc 1 473 5 view .LVU1581
+	.loc 1 473 8 is_stmt 0 view .LVU1582
+	cmpl	$2, %ecx
+	jne	.L483
+.L481:
+	.loc 1 474 9 is_stmt 1 view .LVU1583
+	.loc 1 474 14 is_stmt 0 view .LVU1584
+	movq	32(%rax), %rax
+.LVL473:
+	.loc 1 474 12 view .LVU1585
+	testq	%rax, %rax
+	jne	.L496
+	jmp	.L479
+.LVL474:
+.L483:
+	.loc 1 480 5 is_stmt 1 view .LVU1586
+.LBB839:
+	.loc 1 480 10 view .LVU1587
+.LBE839:
+.LBE838:
+.LBE837:
+	.loc 1 517 1 is_stmt 0 view .LVU1588
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB844:
+.LBB842:
+.LBB840:
+	.loc 1 480 42 view .LVU1589
+	subl	$3, %ecx
+.LBE840:
+.LBE842:
+.LBE844:
+	.loc 1 517 1 view .LVU1590
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+.LBB845:
+.LBB843:
+.LBB841:
+	.loc 1 480 22 view .LVU1591
+	movq	128(%rdx), %rax
+.LVL475:
+	.loc 1 480 22 view .LVU1592
+	movq	(%rax,%rcx,8), %rbx
+.LVL476:
+.L484:
+	.loc 1 480 59 is_stmt 1 view .LVU1593
+	.loc 1 480 56 is_stmt 0 view .LVU1594
+	movzbl	(%rbx), %esi
+	.loc 1 480 59 view .LVU1595
+	testb	%sil, %sil
+	je	.L497
+	.loc 1 481 9 is_stmt 1 view .LVU1596
+	movq	%rdi, 8(%rsp)
+	.loc 1 480 66 is_stmt 0 view .LVU1597
+	incq	%rbx
+.LVL477:
+	.loc 1 481 9 view .LVU1598
+	call	va_stream_render
+.LVL478:
+	.loc 1 480 66 is_stmt 1 view .LVU1599
+	movq	8(%rsp), %rdi
+.LVL479:
+	.loc 1 480 66 is_stmt 0 view .LVU1600
+	jmp	.L484
+.LVL480:
+.L480:
+	.cfi_def_cfa_offset 8
+	.cfi_restore 3
+	.loc 1 480 66 view .LVU1601
+.LBE841:
+.LBE843:
+.LBE845:
+.LBB846:
+.LBI846:
+	.loc 1 513 13 is_stmt 1 view .LVU1602
+.LBB847:
+	.loc 1 522 9 view .LVU1603
+	.loc 1 523 9 view .LVU1604
+	.loc 1 524 9 view .LVU1605
+	.loc 1 525 9 view .LVU1606
+	.loc 1 525 16 is_stmt 0 view .LVU1607
+	movq	32(%rax), %rax
+.LVL481:
+.L496:
+	.loc 1 525 16 view .LVU1608
+	jmp	*%rax
+.LVL482:
+.L497:
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -16
+	.loc 1 525 16 view .LVU1609
+.LBE847:
+.LBE846:
+	.loc 1 528 1 view .LVU1610
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL483:
+	.loc 1 528 1 view .LVU1611
+	ret
+	.cfi_endproc
+.LFE560:
+	.size	render_quote_put, .-render_quote_put
+	.type	iter_quote_bulk, @function
+iter_quote_bulk:
+.LVL484:
+.LFB584:
+	.loc 1 1136 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1137 5 view .LVU1613
+	.loc 1 1136 1 is_stmt 0 view .LVU1614
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 1137 8 view .LVU1615
+	cmpq	$0, 8(%rdx)
+	je	.L498
+	.loc 1 1141 26 view .LVU1616
+	movq	(%rbx), %rax
+	movq	%rdi, %r12
+	movq	%rsi, %r13
+	movq	%r8, %rdx
+.LVL485:
+	.loc 1 1140 5 is_stmt 1 view .LVU1617
+	.loc 1 1141 5 view .LVU1618
+	movq	%rcx, %rsi
+.LVL486:
+	.loc 1 1141 16 is_stmt 0 view .LVU1619
+	movq	%rbx, %rdi
+.LVL487:
+	.loc 1 1141 16 view .LVU1620
+	leaq	40(%rsp), %rcx
+.LVL488:
+	.loc 1 1141 16 view .LVU1621
+	call	*32(%rax)
+.LVL489:
+	.loc 1 1141 16 view .LVU1622
+	movq	%rax, %rbp
+.LVL490:
+	.loc 1 1142 5 is_stmt 1 view .LVU1623
+	.loc 1 1142 8 is_stmt 0 view .LVU1624
+	testq	%rax, %rax
+	je	.L498
+	.loc 1 1145 5 is_stmt 1 view .LVU1625
+.LBB858:
+.LBB859:
+	.loc 1 898 9 is_stmt 0 view .LVU1626
+	xorps	%xmm0, %xmm0
+	.loc 1 899 25 view .LVU1627
+	leaq	quote_c(%rip), %rax
+.LVL491:
+	.loc 1 899 25 view .LVU1628
+.LBE859:
+.LBE858:
+	.loc 1 1145 17 view .LVU1629
+	movq	8(%rbx), %r14
+.LVL492:
+	.loc 1 1146 5 is_stmt 1 view .LVU1630
+	.loc 1 1147 5 view .LVU1631
+.LBB861:
+.LBI858:
+	.loc 1 896 13 view .LVU1632
+.LBB860:
+	.loc 1 898 5 view .LVU1633
+	.loc 1 898 9 is_stmt 0 view .LVU1634
+	movups	%xmm0, 48(%rsp)
+	.loc 1 899 5 is_stmt 1 view .LVU1635
+	.loc 1 899 25 is_stmt 0 view .LVU1636
+	cmpq	%rax, %r13
+	je	.L529
+	leaq	quote_j(%rip), %rax
+	cmpq	%rax, %r13
+	jne	.L500
+.L529:
+	.loc 1 900 9 is_stmt 1 view .LVU1637
+	.loc 1 900 29 is_stmt 0 view .LVU1638
+	movl	32(%r12), %eax
+	andl	$4, %eax
+	.loc 1 900 49 view .LVU1639
+	cmpl	$1, %eax
+	sbbl	%eax, %eax
+	addl	$2, %eax
+	.loc 1 900 18 view .LVU1640
+	movl	%eax, 56(%rsp)
+	jmp	.L503
+.L500:
+	.loc 1 902 10 is_stmt 1 view .LVU1641
+	.loc 1 902 13 is_stmt 0 view .LVU1642
+	leaq	quote_sh(%rip), %rax
+	cmpq	%rax, %r13
+	jne	.L504
+	.loc 1 903 9 is_stmt 1 view .LVU1643
+	.loc 1 903 18 is_stmt 0 view .LVU1644
+	movl	$3, 56(%rsp)
+	jmp	.L503
+.L504:
+	.loc 1 905 10 is_stmt 1 view .LVU1645
+	.loc 1 905 13 is_stmt 0 view .LVU1646
+	testq	%r13, %r13
+	je	.L503
+	.loc 1 905 30 view .LVU1647
+	movq	48(%r13), %rax
+	.loc 1 905 25 view .LVU1648
+	testq	%rax, %rax
+	je	.L503
+	.loc 1 906 9 is_stmt 1 view .LVU1649
+	.loc 1 906 18 is_stmt 0 view .LVU1650
+	movl	$5, 56(%rsp)
+	.loc 1 907 9 is_stmt 1 view .LVU1651
+	.loc 1 909 38 is_stmt 0 view .LVU1652
+	cmpq	$0, 32(%r13)
+	.loc 1 907 17 view .LVU1653
+	movq	%rax, 48(%rsp)
+	.loc 1 908 9 is_stmt 1 view .LVU1654
+	.loc 1 908 17 is_stmt 0 view .LVU1655
+	movb	$1, 60(%rsp)
+	.loc 1 909 9 is_stmt 1 view .LVU1656
+	.loc 1 909 19 is_stmt 0 view .LVU1657
+	sete	61(%rsp)
+.L503:
+.LVL493:
+	.loc 1 909 19 view .LVU1658
+.LBE860:
+.LBE861:
+	.loc 1 1148 5 is_stmt 1 view .LVU1659
+	.loc 1 1149 5 view .LVU1660
+	.loc 1 1149 23 is_stmt 0 view .LVU1661
+	movq	(%rbx), %rax
+	movb	51(%rax), %al
+	.loc 1 1149 5 view .LVU1662
+	cmpb	$2, %al
+	je	.L505
+	cmpb	$3, %al
+	je	.L506
+	decb	%al
+	jne	.L498
+.LBB862:
+	.loc 1 1151 9 is_stmt 1 view .LVU1663
+.LVL494:
+	.loc 1 1152 9 view .LVU1664
+	.loc 1 1152 30 is_stmt 0 view .LVU1665
+	leaq	(%r14,%rbp), %rax
+	.loc 1 1151 30 view .LVU1666
+	movq	%r14, %r15
+	.loc 1 1152 30 view .LVU1667
+	movq	%rax, 8(%rsp)
+.LVL495:
+	.loc 1 1153 9 is_stmt 1 view .LVU1668
+	.loc 1 1154 41 is_stmt 0 view .LVU1669
+	leaq	48(%rsp), %rax
+.LVL496:
+	.loc 1 1154 41 view .LVU1670
+	movq	%rax, 16(%rsp)
+.LVL497:
+.L508:
+	.loc 1 1153 18 is_stmt 1 view .LVU1671
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r15
+	jnb	.L523
+	.loc 1 1154 13 view .LVU1672
+	.loc 1 1154 16 is_stmt 0 view .LVU1673
+	cmpl	$0, 56(%rsp)
+	je	.L509
+	.loc 1 1154 75 discriminator 1 view .LVU1674
+	movq	8(%rsp), %rdx
+	.loc 1 1154 41 discriminator 1 view .LVU1675
+	movq	16(%rsp), %rdi
+	movq	%r15, %rsi
+	.loc 1 1154 75 discriminator 1 view .LVU1676
+	subq	%r15, %rdx
+	.loc 1 1154 41 discriminator 1 view .LVU1677
+	call	plain_run_utf8
+.LVL498:
+	.loc 1 1154 32 discriminator 1 view .LVU1678
+	testq	%rax, %rax
+	je	.L509
+	.loc 1 1155 17 is_stmt 1 discriminator 2 view .LVU1679
+	.loc 1 1155 27 is_stmt 0 discriminator 2 view .LVU1680
+	movq	%r15, 8(%rbx)
+	.loc 1 1156 17 is_stmt 1 discriminator 2 view .LVU1681
+	.loc 1 1156 44 is_stmt 0 discriminator 2 view .LVU1682
+	addq	%rax, %r15
+.LVL499:
+	.loc 1 1156 17 discriminator 2 view .LVU1683
+	movq	%rbx, %rsi
+.LVL500:
+	.loc 1 1156 17 discriminator 2 view .LVU1684
+	movq	%r12, %rdi
+	movq	%r15, %rdx
+	call	iter_plain_bulk
+.LVL501:
+	.loc 1 1157 17 is_stmt 1 discriminator 2 view .LVU1685
+	.loc 1 1158 17 discriminator 2 view .LVU1686
+	jmp	.L508
+.LVL502:
+.L509:
+	.loc 1 1160 13 view .LVU1687
+.LBB863:
+.LBI863:
+	.loc 2 496 24 view .LVU1688
+.LBB864:
+	.loc 2 498 5 view .LVU1689
+	.loc 2 499 5 view .LVU1690
+	.loc 2 499 14 is_stmt 0 view .LVU1691
+	movzbl	(%r15), %edx
+.LVL503:
+	.loc 2 500 5 is_stmt 1 view .LVU1692
+	.loc 2 500 8 is_stmt 0 view .LVU1693
+	cmpl	$127, %edx
+	ja	.L511
+	.loc 2 501 9 is_stmt 1 view .LVU1694
+	.loc 2 501 17 is_stmt 0 view .LVU1695
+	incq	%r15
+.LVL504:
+	.loc 2 502 9 is_stmt 1 view .LVU1696
+	.loc 2 502 16 is_stmt 0 view .LVU1697
+	jmp	.L512
+.LVL505:
+.L511:
+	.loc 2 504 5 is_stmt 1 view .LVU1698
+	.loc 2 506 38 is_stmt 0 view .LVU1699
+	movzbl	1(%r15), %esi
+	.loc 2 504 8 view .LVU1700
+	cmpl	$223, %edx
+	ja	.L513
+	.loc 2 505 9 is_stmt 1 view .LVU1701
+	.loc 2 506 28 is_stmt 0 view .LVU1702
+	sall	$6, %edx
+.LVL506:
+	.loc 2 506 42 view .LVU1703
+	andl	$63, %esi
+	.loc 2 505 17 view .LVU1704
+	addq	$2, %r15
+.LVL507:
+	.loc 2 506 9 is_stmt 1 view .LVU1705
+	.loc 2 506 28 is_stmt 0 view .LVU1706
+	andl	$1984, %edx
+	.loc 2 506 34 view .LVU1707
+	orl	%esi, %edx
+	jmp	.L512
+.LVL508:
+.L513:
+	.loc 2 508 5 is_stmt 1 view .LVU1708
+	.loc 2 510 63 is_stmt 0 view .LVU1709
+	movb	2(%r15), %al
+	.loc 2 508 8 view .LVU1710
+	cmpl	$239, %edx
+	ja	.L514
+	.loc 2 509 9 is_stmt 1 view .LVU1711
+	.loc 2 510 28 is_stmt 0 view .LVU1712
+	sall	$12, %edx
+.LVL509:
+	.loc 2 510 53 view .LVU1713
+	sall	$6, %esi
+	.loc 2 510 67 view .LVU1714
+	andl	$63, %eax
+	.loc 2 509 17 view .LVU1715
+	addq	$3, %r15
+.LVL510:
+	.loc 2 510 9 is_stmt 1 view .LVU1716
+	.loc 2 510 28 is_stmt 0 view .LVU1717
+	movzwl	%dx, %edx
+	.loc 2 510 53 view .LVU1718
+	andl	$4032, %esi
+	.loc 2 510 35 view .LVU1719
+	orl	%esi, %edx
+	.loc 2 510 59 view .LVU1720
+	orl	%eax, %edx
+	jmp	.L512
+.LVL511:
+.L514:
+	.loc 2 512 5 is_stmt 1 view .LVU1721
+	.loc 2 513 5 view .LVU1722
+	.loc 2 513 24 is_stmt 0 view .LVU1723
+	sall	$18, %edx
+.LVL512:
+	.loc 2 513 49 view .LVU1724
+	sall	$12, %esi
+	.loc 2 512 9 view .LVU1725
+	addq	$4, %r15
+.LVL513:
+	.loc 2 513 49 view .LVU1726
+	andl	$258048, %esi
+	.loc 2 513 24 view .LVU1727
+	andl	$1835008, %edx
+	.loc 2 514 25 view .LVU1728
+	sall	$6, %eax
+	.loc 2 513 31 view .LVU1729
+	orl	%esi, %edx
+	.loc 2 514 39 view .LVU1730
+	movb	-1(%r15), %sil
+	.loc 2 514 25 view .LVU1731
+	andl	$4032, %eax
+	.loc 2 514 39 view .LVU1732
+	andl	$63, %esi
+	.loc 2 514 31 view .LVU1733
+	orl	%esi, %edx
+	orl	%eax, %edx
+.LVL514:
+.L512:
+	.loc 2 514 31 view .LVU1734
+.LBE864:
+.LBE863:
+	.loc 1 1160 13 view .LVU1735
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	render_quote_put
+.LVL515:
+	jmp	.L508
+.LVL516:
+.L505:
+	.loc 1 1160 13 view .LVU1736
+.LBE862:
+.LBB865:
+	.loc 1 1166 9 is_stmt 1 view .LVU1737
+	.loc 1 1167 9 view .LVU1738
+	.loc 1 1167 31 is_stmt 0 view .LVU1739
+	leaq	0(%rbp,%rbp), %r15
+	.loc 1 1167 25 view .LVU1740
+	leaq	(%r14,%r15), %rax
+	.loc 1 1166 25 view .LVU1741
+	movq	%r14, %r15
+	.loc 1 1167 25 view .LVU1742
+	movq	%rax, 8(%rsp)
+.LVL517:
+	.loc 1 1168 9 is_stmt 1 view .LVU1743
+	.loc 1 1169 41 is_stmt 0 view .LVU1744
+	leaq	48(%rsp), %rax
+.LVL518:
+	.loc 1 1169 41 view .LVU1745
+	movq	%rax, 16(%rsp)
+.LVL519:
+.L517:
+	.loc 1 1168 18 is_stmt 1 view .LVU1746
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r15
+	jb	.L522
+.LVL520:
+.L523:
+	.loc 1 1168 18 is_stmt 0 view .LVU1747
+.LBE865:
+	.loc 1 1198 5 is_stmt 1 view .LVU1748
+	.loc 1 1198 56 is_stmt 0 view .LVU1749
+	movq	(%rbx), %rax
+	movzbl	51(%rax), %ecx
+	.loc 1 1198 62 view .LVU1750
+	decl	%ecx
+	.loc 1 1198 42 view .LVU1751
+	salq	%cl, %rbp
+.LVL521:
+	.loc 1 1198 37 view .LVU1752
+	addq	%r14, %rbp
+	movq	%rbp, 8(%rbx)
+	.loc 1 1199 5 is_stmt 1 view .LVU1753
+.LBB868:
+	.loc 1 1199 21 view .LVU1754
+.LVL522:
+	.loc 1 1199 58 view .LVU1755
+	.loc 1 1199 119 is_stmt 0 view .LVU1756
+	andl	$1073741823, 32(%r12)
+.LBE868:
+	jmp	.L498
+.LVL523:
+.L522:
+.LBB869:
+	.loc 1 1169 13 is_stmt 1 view .LVU1757
+	.loc 1 1169 16 is_stmt 0 view .LVU1758
+	cmpl	$0, 56(%rsp)
+	je	.L518
+	.loc 1 1169 76 discriminator 1 view .LVU1759
+	movq	8(%rsp), %rdx
+	.loc 1 1169 41 discriminator 1 view .LVU1760
+	movq	16(%rsp), %rdi
+	movq	%r15, %rsi
+	.loc 1 1169 76 discriminator 1 view .LVU1761
+	subq	%r15, %rdx
+	sarq	%rdx
+	.loc 1 1169 41 discriminator 1 view .LVU1762
+	call	plain_run_utf16
+.LVL524:
+	.loc 1 1169 32 discriminator 1 view .LVU1763
+	testq	%rax, %rax
+	je	.L518
+.LVL525:
+	.loc 1 1170 17 is_stmt 1 discriminator 2 view .LVU1764
+	.loc 1 1170 27 is_stmt 0 discriminator 2 view .LVU1765
+	movq	%r15, 8(%rbx)
+	.loc 1 1171 17 is_stmt 1 discriminator 2 view .LVU1766
+	.loc 1 1171 44 is_stmt 0 discriminator 2 view .LVU1767
+	addq	%rax, %rax
+.LVL526:
+	.loc 1 1171 17 discriminator 2 view .LVU1768
+	movq	%rbx, %rsi
+.LVL527:
+	.loc 1 1171 17 discriminator 2 view .LVU1769
+	movq	%r12, %rdi
+	.loc 1 1171 44 discriminator 2 view .LVU1770
+	addq	%rax, %r15
+.LVL528:
+	.loc 1 1171 17 discriminator 2 view .LVU1771
+	movq	%r15, %rdx
+	call	iter_plain_bulk
+.LVL529:
+	.loc 1 1172 17 is_stmt 1 discriminator 2 view .LVU1772
+	.loc 1 1173 17 discriminator 2 view .LVU1773
+	jmp	.L517
+.LVL530:
+.L518:
+	.loc 1 1175 13 view .LVU1774
+.LBB866:
+.LBI866:
+	.loc 2 522 24 view .LVU1775
+.LBB867:
+	.loc 2 524 5 view .LVU1776
+	.loc 2 525 5 view .LVU1777
+	.loc 2 525 14 is_stmt 0 view .LVU1778
+	movzwl	(%r15), %edx
+.LVL531:
+	.loc 2 526 5 is_stmt 1 view .LVU1779
+	.loc 2 526 22 is_stmt 0 view .LVU1780
+	leal	-55296(%rdx), %eax
+	.loc 2 526 8 view .LVU1781
+	cmpl	$2047, %eax
+	jbe	.L520
+	.loc 2 527 9 is_stmt 1 view .LVU1782
+	.loc 2 527 17 is_stmt 0 view .LVU1783
+	addq	$2, %r15
+.LVL532:
+	.loc 2 528 9 is_stmt 1 view .LVU1784
+	.loc 2 528 16 is_stmt 0 view .LVU1785
+	jmp	.L521
+.LVL533:
+.L520:
+	.loc 2 530 5 is_stmt 1 view .LVU1786
+	.loc 2 531 5 view .LVU1787
+	.loc 2 531 40 is_stmt 0 view .LVU1788
+	movw	2(%r15), %ax
+	.loc 2 531 25 view .LVU1789
+	sall	$10, %edx
+.LVL534:
+	.loc 2 530 9 view .LVU1790
+	addq	$4, %r15
+.LVL535:
+	.loc 2 531 25 view .LVU1791
+	andl	$1047552, %edx
+	.loc 2 531 40 view .LVU1792
+	andl	$1023, %eax
+	.loc 2 531 32 view .LVU1793
+	orl	%eax, %edx
+	.loc 2 531 50 view .LVU1794
+	addl	$65536, %edx
+.LVL536:
+.L521:
+	.loc 2 531 50 view .LVU1795
+.LBE867:
+.LBE866:
+	.loc 1 1175 13 view .LVU1796
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	render_quote_put
+.LVL537:
+	jmp	.L517
+.LVL538:
+.L506:
+	.loc 1 1175 13 view .LVU1797
+.LBE869:
+.LBB870:
+	.loc 1 1181 9 is_stmt 1 view .LVU1798
+	.loc 1 1182 9 view .LVU1799
+	.loc 1 1182 25 is_stmt 0 view .LVU1800
+	leaq	(%r14,%rbp,4), %rax
+	.loc 1 1181 25 view .LVU1801
+	movq	%r14, %r15
+	.loc 1 1182 25 view .LVU1802
+	movq	%rax, 8(%rsp)
+.LVL539:
+	.loc 1 1183 9 is_stmt 1 view .LVU1803
+	.loc 1 1184 41 is_stmt 0 view .LVU1804
+	leaq	48(%rsp), %rax
+.LVL540:
+	.loc 1 1184 41 view .LVU1805
+	movq	%rax, 24(%rsp)
+.LVL541:
+.L524:
+	.loc 1 1183 18 is_stmt 1 view .LVU1806
+	movq	8(%rsp), %rax
+	cmpq	%rax, %r15
+	jnb	.L523
+	.loc 1 1184 13 view .LVU1807
+	.loc 1 1184 16 is_stmt 0 view .LVU1808
+	cmpl	$0, 56(%rsp)
+	je	.L525
+	.loc 1 1184 76 discriminator 1 view .LVU1809
+	movq	8(%rsp), %rdx
+	.loc 1 1184 41 discriminator 1 view .LVU1810
+	movq	24(%rsp), %rdi
+	movq	%r15, %rsi
+	.loc 1 1184 76 discriminator 1 view .LVU1811
+	subq	%r15, %rdx
+	sarq	$2, %rdx
+	.loc 1 1184 41 discriminator 1 view .LVU1812
+	call	plain_run_utf32
+.LVL542:
+	.loc 1 1184 32 discriminator 1 view .LVU1813
+	testq	%rax, %rax
+	je	.L525
+	.loc 1 1185 17 is_stmt 1 discriminator 2 view .LVU1814
+	.loc 1 1185 27 is_stmt 0 discriminator 2 view .LVU1815
+	movq	%r15, 8(%rbx)
+	.loc 1 1186 17 is_stmt 1 discriminator 2 view .LVU1816
+	.loc 1 1186 44 is_stmt 0 discriminator 2 view .LVU1817
+	leaq	(%r15,%rax,4), %r15
+.LVL543:
+	.loc 1 1186 17 discriminator 2 view .LVU1818
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	movq	%r15, %rdx
+	call	iter_plain_bulk
+.LVL544:
+	.loc 1 1187 17 is_stmt 1 discriminator 2 view .LVU1819
+	.loc 1 1188 17 discriminator 2 view .LVU1820
+	jmp	.L524
+.LVL545:
+.L525:
+	.loc 1 1190 13 view .LVU1821
+	movl	(%r15), %edx
+	.loc 1 1190 38 is_stmt 0 view .LVU1822
+	leaq	4(%r15), %rax
+	.loc 1 1190 13 view .LVU1823
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	.loc 1 1190 38 view .LVU1824
+	movq	%rax, 16(%rsp)
+.LVL546:
+	.loc 1 1190 13 view .LVU1825
+	call	render_quote_put
+.LVL547:
+	.loc 1 1190 38 view .LVU1826
+	movq	16(%rsp), %r15
+	jmp	.L524
+.LVL548:
+.L498:
+	.loc 1 1190 38 view .LVU1827
+.LBE870:
+	.loc 1 1200 1 view .LVU1828
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL549:
+	.loc 1 1200 1 view .LVU1829
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE584:
+	.size	iter_quote_bulk, .-iter_quote_bulk
+	.type	custom_put, @function
+custom_put:
+.LVL550:
+.LFB588:
+	.loc 1 1407 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1408 5 view .LVU1831
+	.loc 1 1409 5 view .LVU1832
+	.loc 1 1407 1 is_stmt 0 view .LVU1833
+	movl	%esi, %edx
+	.loc 1 1409 5 view .LVU1834
+	movq	64(%rdi), %rsi
+.LVL551:
+	.loc 1 1409 5 view .LVU1835
+	movq	80(%rdi), %rdi
+.LVL552:
+	.loc 1 1409 5 view .LVU1836
+	jmp	render_quote_put
+.LVL553:
+	.loc 1 1409 5 view .LVU1837
+	.cfi_endproc
+.LFE588:
+	.size	custom_put, .-custom_put
+	.section	.rodata.str1.1
+.LC14:
+	.string	"null"
+.LC15:
+	.string	"NULL"
+	.text
+	.type	render_iter_algo, @function
+render_iter_algo:
+.LVL554:
+.LFB585:
+	.loc 1 1203 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1204 5 view .LVU1839
+	.loc 1 1203 1 is_stmt 0 view .LVU1840
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$392, %rsp
+	.cfi_def_cfa_offset 448
+	.loc 1 1204 13 view .LVU1841
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rsp)
+	.loc 1 1204 8 view .LVU1842
+	testq	%rax, %rax
+	jne	.L551
+	.loc 1 1205 9 is_stmt 1 view .LVU1843
+	.loc 1 1205 28 is_stmt 0 view .LVU1844
+	movzwl	34(%rdi), %eax
+	.loc 1 1205 41 view .LVU1845
+	andl	$7, %eax
+	.loc 1 1205 9 view .LVU1846
+	cmpl	$2, %eax
+	je	.L552
+	subl	$3, %eax
+	.loc 1 1212 13 view .LVU1847
+	leaq	.LC14(%rip), %rsi
+.LVL555:
+	.loc 1 1205 9 view .LVU1848
+	cmpl	$1, %eax
+	jbe	.L663
+	jmp	.L551
+.LVL556:
+.L552:
+	.loc 1 1207 13 is_stmt 1 view .LVU1849
+	leaq	.LC15(%rip), %rsi
+.LVL557:
+.L663:
+	.loc 1 1375 1 is_stmt 0 view .LVU1850
+	addq	$392, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	.loc 1 1207 13 view .LVU1851
+	movq	%rbx, %rdi
+.LVL558:
+	.loc 1 1375 1 view .LVU1852
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL559:
+	.loc 1 1375 1 view .LVU1853
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL560:
+	.loc 1 1375 1 view .LVU1854
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	.loc 1 1207 13 view .LVU1855
+	jmp	render_rawstr
+.LVL561:
+.L551:
+	.cfi_restore_state
+	.loc 1 1218 5 is_stmt 1 view .LVU1856
+	.loc 1 1219 5 view .LVU1857
+	.loc 1 1220 5 view .LVU1858
+	.loc 1 1220 10 is_stmt 0 view .LVU1859
+	movl	28(%rbx), %esi
+	.loc 1 1219 17 view .LVU1860
+	xorl	%r10d, %r10d
+	movq	%r10, (%rsp)
+	.loc 1 1220 8 view .LVU1861
+	cmpl	$2147483647, %esi
+	je	.L553
+	.loc 1 1221 9 is_stmt 1 view .LVU1862
+	.loc 1 1221 25 is_stmt 0 view .LVU1863
+	movq	0(%rbp), %rax
+	.loc 1 1221 15 view .LVU1864
+	movq	%rbp, %rdi
+	call	*16(%rax)
+.LVL562:
+	movq	%rax, (%rsp)
+.LVL563:
+.L553:
+	.loc 1 1225 5 is_stmt 1 view .LVU1865
+	.loc 1 1225 31 is_stmt 0 view .LVU1866
+	movq	%rbx, %rdi
+	call	quotation_get
+.LVL564:
+	movq	%rax, %r12
+.LVL565:
+	.loc 1 1226 5 is_stmt 1 view .LVU1867
+	.loc 1 1227 5 view .LVU1868
+	.loc 1 1228 5 view .LVU1869
+	.loc 1 1228 11 is_stmt 0 view .LVU1870
+	movl	32(%rbx), %eax
+.LVL566:
+	.loc 1 1229 9 is_stmt 1 view .LVU1871
+	.loc 1 1229 12 is_stmt 0 view .LVU1872
+	testq	%r12, %r12
+	je	.L576
+	.loc 1 1229 12 view .LVU1873
+	testb	$1, %al
+	je	.L554
+.L576:
+	.loc 1 1227 24 view .LVU1874
+	xorl	%eax, %eax
+	jmp	.L556
+.L554:
+	.loc 1 1230 13 is_stmt 1 view .LVU1875
+	.loc 1 1230 19 is_stmt 0 view .LVU1876
+	movq	16(%r12), %rdx
+	.loc 1 1230 16 view .LVU1877
+	testq	%rdx, %rdx
+	jne	.L557
+	.loc 1 1230 41 discriminator 1 view .LVU1878
+	cmpq	$0, 48(%r12)
+	je	.L660
+.LBB902:
+	.loc 1 1234 17 is_stmt 1 view .LVU1879
+	.loc 1 1235 17 view .LVU1880
+.LVL567:
+.LBB903:
+.LBI903:
+	.loc 1 917 13 view .LVU1881
+.LBB904:
+	.loc 1 919 5 view .LVU1882
+	.loc 1 919 9 is_stmt 0 view .LVU1883
+	xorps	%xmm0, %xmm0
+	movups	%xmm0, 56(%rsp)
+	.loc 1 920 5 is_stmt 1 view .LVU1884
+	jmp	.L560
+.LVL568:
+.L557:
+	.loc 1 920 5 is_stmt 0 view .LVU1885
+.LBE904:
+.LBE903:
+	.loc 1 1234 17 is_stmt 1 view .LVU1886
+	.loc 1 1235 17 view .LVU1887
+.LBB907:
+	.loc 1 917 13 view .LVU1888
+.LBB905:
+	.loc 1 919 5 view .LVU1889
+	.loc 1 919 9 is_stmt 0 view .LVU1890
+	xorps	%xmm0, %xmm0
+	.loc 1 920 8 view .LVU1891
+	leaq	check_quote_sh(%rip), %rcx
+	.loc 1 919 9 view .LVU1892
+	movups	%xmm0, 56(%rsp)
+	.loc 1 920 5 is_stmt 1 view .LVU1893
+	.loc 1 920 8 is_stmt 0 view .LVU1894
+	cmpq	%rcx, %rdx
+	jne	.L560
+	.loc 1 921 9 is_stmt 1 view .LVU1895
+	.loc 1 921 18 is_stmt 0 view .LVU1896
+	movl	$4, 64(%rsp)
+	jmp	.L561
+.L560:
+	.loc 1 923 10 is_stmt 1 view .LVU1897
+	.loc 1 923 15 is_stmt 0 view .LVU1898
+	movq	48(%r12), %rcx
+	.loc 1 923 13 view .LVU1899
+	testq	%rcx, %rcx
+	jne	.L562
+.LVL569:
+.L619:
+	.loc 1 923 13 view .LVU1900
+.LBE905:
+.LBE907:
+	.loc 1 1238 47 view .LVU1901
+	xorl	%r14d, %r14d
+	jmp	.L563
+.LVL570:
+.L562:
+.LBB908:
+.LBB906:
+	.loc 1 924 9 is_stmt 1 view .LVU1902
+	.loc 1 924 18 is_stmt 0 view .LVU1903
+	movl	$5, 64(%rsp)
+	.loc 1 925 9 is_stmt 1 view .LVU1904
+	.loc 1 927 37 is_stmt 0 view .LVU1905
+	testq	%rdx, %rdx
+	.loc 1 925 17 view .LVU1906
+	movq	%rcx, 56(%rsp)
+	.loc 1 926 9 is_stmt 1 view .LVU1907
+	.loc 1 927 9 view .LVU1908
+	.loc 1 927 19 is_stmt 0 view .LVU1909
+	sete	69(%rsp)
+.L561:
+.LVL571:
+	.loc 1 927 19 view .LVU1910
+.LBE906:
+.LBE908:
+	.loc 1 1236 16 is_stmt 1 view .LVU1911
+	.loc 1 1238 26 is_stmt 0 view .LVU1912
+	movq	0(%rbp), %rdx
+	.loc 1 1237 36 view .LVU1913
+	cmpq	$0, 32(%rdx)
+	je	.L619
+	.loc 1 1238 47 discriminator 4 view .LVU1914
+	xorl	%r14d, %r14d
+	cmpb	$0, 51(%rdx)
+	setne	%r14b
+.L563:
+.LVL572:
+	.loc 1 1239 17 is_stmt 1 view .LVU1915
+.LBB909:
+.LBI909:
+	.loc 1 250 13 view .LVU1916
+.LBB910:
+	.loc 1 255 5 view .LVU1917
+.LBB911:
+	.loc 1 255 21 view .LVU1918
+	.loc 1 255 58 view .LVU1919
+	.loc 1 255 119 is_stmt 0 view .LVU1920
+	andl	$1073741823, %eax
+.LBE911:
+	.loc 1 256 14 view .LVU1921
+	xorl	%r9d, %r9d
+.LBE910:
+.LBE909:
+.LBB914:
+.LBB915:
+.LBB916:
+	.loc 1 1096 20 view .LVU1922
+	leaq	48(%rsp), %r15
+.LBE916:
+.LBE915:
+.LBE914:
+.LBB920:
+.LBB913:
+.LBB912:
+	.loc 1 255 119 view .LVU1923
+	movl	%eax, 32(%rbx)
+.LBE912:
+	.loc 1 256 5 is_stmt 1 view .LVU1924
+	.loc 1 257 15 is_stmt 0 view .LVU1925
+	movq	8(%rsp), %rax
+	.loc 1 256 14 view .LVU1926
+	movl	%r9d, 36(%rbx)
+	.loc 1 257 5 is_stmt 1 view .LVU1927
+	.loc 1 257 15 is_stmt 0 view .LVU1928
+	movq	%rax, 8(%rbp)
+.LVL573:
+.L573:
+	.loc 1 257 15 view .LVU1929
+.LBE913:
+.LBE920:
+	.loc 1 1240 21 is_stmt 1 view .LVU1930
+	.loc 1 1240 24 is_stmt 0 view .LVU1931
+	testl	%r14d, %r14d
+	je	.L564
+	.loc 1 1241 25 is_stmt 1 view .LVU1932
+.LVL574:
+.LBB921:
+.LBI914:
+	.loc 1 1085 13 view .LVU1933
+.LBB919:
+	.loc 1 1091 5 view .LVU1934
+	.loc 1 1091 8 is_stmt 0 view .LVU1935
+	cmpq	$0, 8(%rbp)
+	je	.L564
+.L571:
+	.loc 1 1094 5 is_stmt 1 view .LVU1936
+.LBB918:
+	.loc 1 1095 9 view .LVU1937
+	.loc 1 1096 9 view .LVU1938
+	.loc 1 1096 30 is_stmt 0 view .LVU1939
+	movq	0(%rbp), %rax
+	.loc 1 1096 20 view .LVU1940
+	movq	(%rsp), %rsi
+	movq	%r15, %rcx
+	movl	$256, %edx
+	movq	%rbp, %rdi
+	call	*32(%rax)
+.LVL575:
+	movq	%rax, %r13
+.LVL576:
+	.loc 1 1097 9 is_stmt 1 view .LVU1941
+	.loc 1 1098 9 view .LVU1942
+	.loc 1 1098 27 is_stmt 0 view .LVU1943
+	movq	0(%rbp), %rax
+.LVL577:
+	.loc 1 1098 27 view .LVU1944
+	movb	51(%rax), %al
+	.loc 1 1098 9 view .LVU1945
+	cmpb	$2, %al
+	je	.L565
+	cmpb	$3, %al
+	je	.L566
+	decb	%al
+	jne	.L564
+	.loc 1 1100 13 is_stmt 1 view .LVU1946
+	.loc 1 1100 17 is_stmt 0 view .LVU1947
+	movq	8(%rbp), %rsi
+	leaq	56(%rsp), %rdi
+.LVL578:
+	.loc 1 1100 17 view .LVU1948
+	movq	%r13, %rdx
+	call	plain_run_utf8
+.LVL579:
+	.loc 1 1101 13 is_stmt 1 view .LVU1949
+	jmp	.L568
+.LVL580:
+.L565:
+	.loc 1 1103 13 view .LVU1950
+	.loc 1 1103 17 is_stmt 0 view .LVU1951
+	movq	8(%rbp), %rsi
+	leaq	56(%rsp), %rdi
+.LVL581:
+	.loc 1 1103 17 view .LVU1952
+	movq	%r13, %rdx
+	call	plain_run_utf16
+.LVL582:
+	.loc 1 1104 13 is_stmt 1 view .LVU1953
+	jmp	.L568
+.LVL583:
+.L566:
+	.loc 1 1106 13 view .LVU1954
+	.loc 1 1106 17 is_stmt 0 view .LVU1955
+	movq	8(%rbp), %rsi
+	leaq	56(%rsp), %rdi
+.LVL584:
+	.loc 1 1106 17 view .LVU1956
+	movq	%r13, %rdx
+	call	plain_run_utf32
+.LVL585:
+	.loc 1 1107 13 is_stmt 1 view .LVU1957
+.L568:
+	.loc 1 1111 9 view .LVU1958
+	.loc 1 1111 12 is_stmt 0 view .LVU1959
+	testq	%rax, %rax
+	je	.L564
+	.loc 1 1112 13 is_stmt 1 view .LVU1960
+	.loc 1 1112 22 is_stmt 0 view .LVU1961
+	movl	$1, 36(%rbx)
+	.loc 1 1113 13 is_stmt 1 view .LVU1962
+	.loc 1 1113 68 is_stmt 0 view .LVU1963
+	movq	0(%rbp), %rdx
+	.loc 1 1116 12 view .LVU1964
+	decq	%r13
+.LVL586:
+	.loc 1 1113 68 view .LVU1965
+	movzbl	51(%rdx), %ecx
+	.loc 1 1113 54 view .LVU1966
+	movq	%rax, %rdx
+	.loc 1 1113 74 view .LVU1967
+	decl	%ecx
+	.loc 1 1113 54 view .LVU1968
+	salq	%cl, %rdx
+	.loc 1 1113 49 view .LVU1969
+	addq	%rdx, 8(%rbp)
+	.loc 1 1114 13 is_stmt 1 view .LVU1970
+.LBB917:
+	.loc 1 1114 29 view .LVU1971
+.LVL587:
+	.loc 1 1114 66 view .LVU1972
+	.loc 1 1114 127 is_stmt 0 view .LVU1973
+	andl	$1073741823, 32(%rbx)
+.LBE917:
+	.loc 1 1116 9 is_stmt 1 view .LVU1974
+	.loc 1 1116 12 is_stmt 0 view .LVU1975
+	cmpq	%rax, %r13
+	jb	.L571
+.LVL588:
+.L564:
+	.loc 1 1116 12 view .LVU1976
+.LBE918:
+.LBE919:
+.LBE921:
+	.loc 1 1243 21 is_stmt 1 view .LVU1977
+	.loc 1 1243 31 is_stmt 0 view .LVU1978
+	movq	(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_take
+.LVL589:
+	movl	%eax, %edx
+.LVL590:
+	.loc 1 1243 24 view .LVU1979
+	cmpl	$-1, %eax
+	je	.L572
+	.loc 1 1246 21 is_stmt 1 view .LVU1980
+	.loc 1 1246 25 is_stmt 0 view .LVU1981
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	check_quote_put
+.LVL591:
+	.loc 1 1246 24 view .LVU1982
+	testb	%al, %al
+	je	.L573
+	jmp	.L661
+.LVL592:
+.L572:
+	.loc 1 1251 17 is_stmt 1 view .LVU1983
+	.loc 1 1251 20 is_stmt 0 view .LVU1984
+	cmpq	$0, 8(%rsp)
+	je	.L576
+	.loc 1 1252 21 is_stmt 1 view .LVU1985
+	.loc 1 1253 21 view .LVU1986
+	.loc 1 1253 26 is_stmt 0 view .LVU1987
+	movq	24(%r12), %rax
+.LVL593:
+	.loc 1 1253 24 view .LVU1988
+	testq	%rax, %rax
+	je	.L576
+	.loc 1 1253 43 discriminator 1 view .LVU1989
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL594:
+	.loc 1 1253 40 discriminator 1 view .LVU1990
+	testb	%al, %al
+	je	.L576
+.L661:
+	.loc 1 1254 25 is_stmt 1 view .LVU1991
+	.loc 1 1254 54 is_stmt 0 view .LVU1992
+	movl	32(%rbx), %eax
+.LVL595:
+.L660:
+.L574:
+	.loc 1 1254 54 view .LVU1993
+	shrl	$10, %eax
+.LBE902:
+	.loc 1 1263 18 view .LVU1994
+	movl	32(%rbx), %edx
+.LBB922:
+	.loc 1 1254 67 view .LVU1995
+	andl	$7, %eax
+	.loc 1 1254 88 view .LVU1996
+	cmpl	$2, %eax
+	.loc 1 1254 42 view .LVU1997
+	setne	%al
+	movzbl	%al, %eax
+	movq	(%r12,%rax,8), %rax
+.LVL596:
+	.loc 1 1257 30 is_stmt 1 view .LVU1998
+	.loc 1 1257 30 is_stmt 0 view .LVU1999
+.LBE922:
+	.loc 1 1261 5 is_stmt 1 view .LVU2000
+	.loc 1 1261 8 is_stmt 0 view .LVU2001
+	cmpb	$-1, %ah
+	jne	.L556
+	.loc 1 1262 9 is_stmt 1 view .LVU2002
+	.loc 1 1263 37 is_stmt 0 view .LVU2003
+	xorb	$3, %dh
+	.loc 1 1262 15 view .LVU2004
+	xorb	$-1, %ah
+.LVL597:
+	.loc 1 1263 9 is_stmt 1 view .LVU2005
+	.loc 1 1263 12 is_stmt 0 view .LVU2006
+	andb	$3, %dh
+	jne	.L556
+	.loc 1 1264 24 discriminator 1 view .LVU2007
+	movq	0(%rbp), %rdx
+	movzbl	50(%rdx), %edx
+	.loc 1 1263 55 discriminator 1 view .LVU2008
+	testb	%dl, %dl
+	je	.L556
+	.loc 1 1266 13 is_stmt 1 view .LVU2009
+	.loc 1 1266 83 is_stmt 0 view .LVU2010
+	salq	$8, %rdx
+	.loc 1 1266 19 view .LVU2011
+	addq	%rdx, %rax
+.LVL598:
+.L556:
+	.loc 1 1269 5 is_stmt 1 view .LVU2012
+	.loc 1 1269 17 is_stmt 0 view .LVU2013
+	xorl	%edx, %edx
+	.loc 1 1269 87 view .LVU2014
+	movq	%rax, %rcx
+	.loc 1 1269 17 view .LVU2015
+	testl	$4294901760, %eax
+	setne	%dl
+	.loc 1 1269 87 view .LVU2016
+	shrq	$32, %rcx
+	.loc 1 1269 56 view .LVU2017
+	cmpw	$1, %cx
+	.loc 1 1269 97 view .LVU2018
+	movzbl	%ah, %ecx
+	.loc 1 1269 56 view .LVU2019
+	sbbl	$-1, %edx
+	.loc 1 1269 95 view .LVU2020
+	cmpq	$1, %rcx
+	sbbl	$-1, %edx
+	.loc 1 1269 11 view .LVU2021
+	addq	%rdx, %rax
+.LVL599:
+	.loc 1 1273 14 view .LVU2022
+	movq	0(%rbp), %rdx
+	.loc 1 1273 35 view .LVU2023
+	testq	%r12, %r12
+	sete	%r15b
+	.loc 1 1269 11 view .LVU2024
+	movq	%rax, 24(%rsp)
+.LVL600:
+	.loc 1 1272 4 is_stmt 1 view .LVU2025
+	.loc 1 1274 26 is_stmt 0 view .LVU2026
+	movl	32(%rbx), %eax
+.LVL601:
+	.loc 1 1273 20 view .LVU2027
+	movq	32(%rdx), %rcx
+	.loc 1 1273 35 view .LVU2028
+	testq	%rcx, %rcx
+	setne	%sil
+	andb	%sil, %r15b
+	movb	%r15b, 32(%rsp)
+	je	.L578
+.LVL602:
+	.loc 1 1274 4 is_stmt 1 view .LVU2029
+	.loc 1 1274 20 is_stmt 0 view .LVU2030
+	testb	$32, %al
+	jne	.L625
+	.loc 1 1275 34 view .LVU2031
+	movb	51(%rdx), %cl
+.LVL603:
+	.loc 1 1275 4 is_stmt 1 view .LVU2032
+	.loc 1 1275 20 is_stmt 0 view .LVU2033
+	testb	%cl, %cl
+	je	.L580
+	.loc 1 1276 36 discriminator 3 view .LVU2034
+	movq	(%rbx), %rsi
+	.loc 1 1275 46 discriminator 3 view .LVU2035
+	cmpb	%cl, 48(%rsi)
+	je	.L622
+.L580:
+.LVL604:
+	.loc 1 1277 34 discriminator 1 view .LVU2036
+	cmpq	$0, 40(%rdx)
+	je	.L625
+	.loc 1 1278 51 discriminator 4 view .LVU2037
+	movq	(%rbx), %rdx
+	.loc 1 1278 40 discriminator 4 view .LVU2038
+	cmpb	$0, 48(%rdx)
+	je	.L625
+	.loc 1 1278 40 view .LVU2039
+	movl	$1, %r13d
+	xorl	%r14d, %r14d
+	jmp	.L581
+.L578:
+.LVL605:
+	.loc 1 1279 4 is_stmt 1 view .LVU2040
+	.loc 1 1280 4 view .LVU2041
+	.loc 1 1281 70 is_stmt 0 view .LVU2042
+	testq	%rcx, %rcx
+	je	.L625
+	jmp	.L582
+.LVL606:
+.L622:
+	.loc 1 1278 40 view .LVU2043
+	xorl	%r13d, %r13d
+	.loc 1 1275 46 view .LVU2044
+	movl	$1, %r14d
+.LVL607:
+.L581:
+	.loc 1 1279 46 discriminator 1 view .LVU2045
+	movq	(%rbx), %rdx
+	.loc 1 1279 35 discriminator 1 view .LVU2046
+	xorl	%r15d, %r15d
+	cmpq	$0, 40(%rdx)
+	setne	%r15b
+	jmp	.L662
+.LVL608:
+.L582:
+	.loc 1 1281 61 discriminator 1 view .LVU2047
+	cmpb	$0, 51(%rdx)
+	je	.L625
+	.loc 1 1281 70 discriminator 5 view .LVU2048
+	movl	%eax, %edx
+	.loc 1 1278 40 discriminator 5 view .LVU2049
+	xorl	%r13d, %r13d
+	.loc 1 1275 46 discriminator 5 view .LVU2050
+	xorl	%r14d, %r14d
+	.loc 1 1279 35 discriminator 5 view .LVU2051
+	xorl	%r15d, %r15d
+	.loc 1 1281 70 discriminator 5 view .LVU2052
+	shrl	$5, %edx
+	xorl	$1, %edx
+	andl	$1, %edx
+	movl	%edx, 20(%rsp)
+	jmp	.L583
+.LVL609:
+.L625:
+	.loc 1 1278 40 view .LVU2053
+	xorl	%r13d, %r13d
+	.loc 1 1275 46 view .LVU2054
+	xorl	%r14d, %r14d
+	.loc 1 1279 35 view .LVU2055
+	xorl	%r15d, %r15d
+.L662:
+	.loc 1 1281 70 view .LVU2056
+	xorl	%r8d, %r8d
+	movl	%r8d, 20(%rsp)
+.L583:
+.LVL610:
+	.loc 1 1285 5 is_stmt 1 view .LVU2057
+	.loc 1 1286 4 view .LVU2058
+	.loc 1 1287 4 view .LVU2059
+	.loc 1 1288 5 view .LVU2060
+	.loc 1 1288 8 is_stmt 0 view .LVU2061
+	testb	$8, %al
+	jne	.L584
+	.loc 1 1289 9 is_stmt 1 view .LVU2062
+	.loc 1 1289 14 is_stmt 0 view .LVU2063
+	movl	24(%rbx), %edx
+	.loc 1 1289 26 view .LVU2064
+	movzbl	24(%rsp), %ecx
+	.loc 1 1289 12 view .LVU2065
+	cmpl	%edx, %ecx
+	jb	.L585
+	.loc 1 1290 13 is_stmt 1 view .LVU2066
+	.loc 1 1290 22 is_stmt 0 view .LVU2067
+	xorl	%edi, %edi
+	movl	%edi, 24(%rbx)
+.L584:
+	.loc 1 1287 9 view .LVU2068
+	movb	$0, 32(%rsp)
+	.loc 1 1286 9 view .LVU2069
+	xorl	%eax, %eax
+	jmp	.L586
+.L585:
+	.loc 1 1292 14 is_stmt 1 view .LVU2070
+.LBB923:
+	.loc 1 1294 22 is_stmt 0 view .LVU2071
+	movl	%eax, %edi
+	.loc 1 1293 22 view .LVU2072
+	subl	%ecx, %edx
+	.loc 1 1294 22 view .LVU2073
+	andl	$32, %edi
+.LBE923:
+	.loc 1 1292 17 view .LVU2074
+	cmpb	$0, 32(%rsp)
+.LBB935:
+	.loc 1 1293 22 view .LVU2075
+	movl	%edx, 24(%rbx)
+	.loc 1 1294 22 view .LVU2076
+	movl	%edi, 40(%rsp)
+.LBE935:
+	.loc 1 1292 17 view .LVU2077
+	je	.L587
+.LBB936:
+	.loc 1 1293 13 is_stmt 1 view .LVU2078
+	.loc 1 1294 13 view .LVU2079
+.LVL611:
+	.loc 1 1295 13 view .LVU2080
+	.loc 1 1296 13 view .LVU2081
+.LBB924:
+.LBI924:
+	.loc 1 250 13 view .LVU2082
+.LBB925:
+	.loc 1 255 5 view .LVU2083
+.LBB926:
+	.loc 1 255 21 view .LVU2084
+	.loc 1 255 58 view .LVU2085
+	.loc 1 255 119 is_stmt 0 view .LVU2086
+	andl	$1073741823, %eax
+.LBE926:
+	.loc 1 256 14 view .LVU2087
+	xorl	%esi, %esi
+.LBB927:
+	.loc 1 255 119 view .LVU2088
+	orl	$32, %eax
+.LBE927:
+	.loc 1 256 14 view .LVU2089
+	movl	%esi, 36(%rbx)
+.LBB928:
+	.loc 1 255 119 view .LVU2090
+	movl	%eax, 32(%rbx)
+.LVL612:
+	.loc 1 255 119 view .LVU2091
+.LBE928:
+	.loc 1 256 5 is_stmt 1 view .LVU2092
+	.loc 1 257 5 view .LVU2093
+	.loc 1 257 15 is_stmt 0 view .LVU2094
+	movq	8(%rsp), %rax
+	movq	%rax, 8(%rbp)
+.LBE925:
+.LBE924:
+.LBB929:
+.LBB930:
+	.loc 1 743 16 view .LVU2095
+	leaq	56(%rsp), %rax
+	movq	%rax, 32(%rsp)
+.LVL613:
+.L588:
+	.loc 1 743 16 view .LVU2096
+.LBE930:
+.LBE929:
+	.loc 1 1297 29 is_stmt 1 view .LVU2097
+	.loc 1 1297 21 is_stmt 0 view .LVU2098
+	movl	24(%rbx), %edx
+	.loc 1 1297 29 view .LVU2099
+	testl	%edx, %edx
+	je	.L593
+	.loc 1 1298 17 is_stmt 1 view .LVU2100
+.LVL614:
+.LBB932:
+.LBI929:
+	.loc 1 734 13 view .LVU2101
+.LBB931:
+	.loc 1 739 5 view .LVU2102
+	.loc 1 739 8 is_stmt 0 view .LVU2103
+	cmpq	$0, 8(%rbp)
+	je	.L590
+	.loc 1 742 5 is_stmt 1 view .LVU2104
+	.loc 1 743 5 view .LVU2105
+	.loc 1 743 26 is_stmt 0 view .LVU2106
+	movq	0(%rbp), %rax
+	.loc 1 743 16 view .LVU2107
+	movq	32(%rsp), %rcx
+	movq	%rbp, %rdi
+	movq	(%rsp), %rsi
+	call	*32(%rax)
+.LVL615:
+	.loc 1 744 5 view .LVU2108
+	movq	56(%rsp), %rcx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	.loc 1 743 16 view .LVU2109
+	movq	%rax, %rdx
+.LVL616:
+	.loc 1 744 5 is_stmt 1 view .LVU2110
+	call	iter_skip
+.LVL617:
+	.loc 1 744 5 is_stmt 0 view .LVU2111
+.LBE931:
+.LBE932:
+	.loc 1 1299 17 is_stmt 1 view .LVU2112
+	.loc 1 1299 20 is_stmt 0 view .LVU2113
+	cmpl	$0, 24(%rbx)
+	jne	.L590
+.L593:
+	.loc 1 1307 13 is_stmt 1 view .LVU2114
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	render_quote_flush
+.LVL618:
+	.loc 1 1308 13 view .LVU2115
+.LBB933:
+	.loc 1 1308 29 view .LVU2116
+	.loc 1 1308 66 view .LVU2117
+	.loc 1 1308 100 view .LVU2118
+	movl	32(%rbx), %edx
+	.loc 1 1308 112 view .LVU2119
+	movl	%edx, %eax
+	andl	$-33, %eax
+	.loc 1 1308 115 is_stmt 0 view .LVU2120
+	cmpl	$0, 40(%rsp)
+	je	.L592
+	.loc 1 1308 105 view .LVU2121
+	movl	%edx, %eax
+	orl	$32, %eax
+	jmp	.L592
+.LVL619:
+.L590:
+	.loc 1 1308 105 view .LVU2122
+.LBE933:
+	.loc 1 1302 17 is_stmt 1 view .LVU2123
+	.loc 1 1302 27 is_stmt 0 view .LVU2124
+	movq	(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_take
+.LVL620:
+	movl	%eax, %edx
+.LVL621:
+	.loc 1 1302 20 view .LVU2125
+	cmpl	$-1, %eax
+	je	.L593
+	.loc 1 1305 17 is_stmt 1 view .LVU2126
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	call	render_quote_put
+.LVL622:
+	.loc 1 1305 17 is_stmt 0 view .LVU2127
+	jmp	.L588
+.LVL623:
+.L592:
+.LBB934:
+	.loc 1 1308 105 view .LVU2128
+	movl	%eax, 32(%rbx)
+.LBE934:
+	.loc 1 1311 13 is_stmt 1 view .LVU2129
+	movl	24(%rbx), %edx
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	call	render_fill
+.LVL624:
+.LBE936:
+	jmp	.L584
+.LVL625:
+.L587:
+	.loc 1 1317 13 view .LVU2130
+	.loc 1 1318 13 view .LVU2131
+.LBB937:
+.LBI937:
+	.loc 1 572 13 view .LVU2132
+.LBB938:
+	.loc 1 574 5 view .LVU2133
+	.loc 1 574 10 is_stmt 0 view .LVU2134
+	leaq	56(%rsp), %rdi
+.LVL626:
+	.loc 1 574 10 view .LVU2135
+	movl	$16, %ecx
+	movq	%rbx, %rsi
+	.loc 1 576 14 view .LVU2136
+	xorl	%edx, %edx
+	.loc 1 574 10 view .LVU2137
+	rep movsl
+.LVL627:
+	.loc 1 575 5 is_stmt 1 view .LVU2138
+	.loc 1 575 15 is_stmt 0 view .LVU2139
+	leaq	ahead_vtab(%rip), %rax
+	.loc 1 576 14 view .LVU2140
+	movq	%rdx, 96(%rsp)
+	.loc 1 575 15 view .LVU2141
+	movq	%rax, 56(%rsp)
+	.loc 1 576 5 is_stmt 1 view .LVU2142
+	.loc 1 578 46 is_stmt 0 view .LVU2143
+	movl	40(%rsp), %eax
+	.loc 1 576 14 view .LVU2144
+	movq	%rdx, 104(%rsp)
+	.loc 1 578 5 is_stmt 1 view .LVU2145
+	.loc 1 578 46 is_stmt 0 view .LVU2146
+	negl	%eax
+	sbbq	%rax, %rax
+.LBE938:
+.LBE937:
+.LBB941:
+.LBB942:
+	.loc 1 256 14 view .LVU2147
+	xorl	%ecx, %ecx
+.LBB943:
+	.loc 1 255 119 view .LVU2148
+	andl	$1073741823, 88(%rsp)
+.LBE943:
+.LBE942:
+.LBE941:
+.LBB947:
+.LBB939:
+	.loc 1 578 46 view .LVU2149
+	andl	$65, %eax
+.LBE939:
+.LBE947:
+.LBB948:
+.LBB945:
+	.loc 1 256 14 view .LVU2150
+	movl	%ecx, 92(%rsp)
+.LBE945:
+.LBE948:
+.LBB949:
+.LBB940:
+	.loc 1 578 10 view .LVU2151
+	movq	%rax, 120(%rsp)
+.LVL628:
+	.loc 1 578 10 view .LVU2152
+.LBE940:
+.LBE949:
+	.loc 1 1319 13 is_stmt 1 view .LVU2153
+.LBB950:
+.LBI941:
+	.loc 1 250 13 view .LVU2154
+.LBB946:
+	.loc 1 255 5 view .LVU2155
+.LBB944:
+	.loc 1 255 21 view .LVU2156
+	.loc 1 255 58 view .LVU2157
+.LBE944:
+	.loc 1 256 5 view .LVU2158
+	.loc 1 257 5 view .LVU2159
+	.loc 1 257 15 is_stmt 0 view .LVU2160
+	movq	8(%rsp), %rax
+	movq	%rax, 8(%rbp)
+.LBE946:
+.LBE950:
+	.loc 1 1323 21 view .LVU2161
+	leaq	56(%rsp), %rax
+.LVL629:
+	.loc 1 1323 21 view .LVU2162
+	movq	%rax, 40(%rsp)
+.LVL630:
+.L596:
+	.loc 1 1320 34 is_stmt 1 view .LVU2163
+	.loc 1 1320 27 is_stmt 0 view .LVU2164
+	movl	80(%rsp), %r8d
+	.loc 1 1320 34 view .LVU2165
+	testl	%r8d, %r8d
+	je	.L601
+	.loc 1 1321 17 is_stmt 1 view .LVU2166
+	.loc 1 1321 20 is_stmt 0 view .LVU2167
+	cmpl	$0, 20(%rsp)
+	jne	.L597
+.L600:
+	.loc 1 1328 17 is_stmt 1 view .LVU2168
+	.loc 1 1328 27 is_stmt 0 view .LVU2169
+	movq	(%rsp), %rdx
+	movq	40(%rsp), %rdi
+	movq	%rbp, %rsi
+	call	iter_take
+.LVL631:
+	movl	%eax, %edx
+.LVL632:
+	.loc 1 1328 20 view .LVU2170
+	cmpl	$-1, %eax
+	jne	.L656
+	.loc 1 1329 21 is_stmt 1 view .LVU2171
+	movq	40(%rsp), %rsi
+	movq	%r12, %rdi
+	call	render_quote_flush
+.LVL633:
+	.loc 1 1330 21 view .LVU2172
+	.loc 1 1331 21 view .LVU2173
+	.loc 1 1330 28 is_stmt 0 view .LVU2174
+	movb	$1, 32(%rsp)
+	.loc 1 1331 21 view .LVU2175
+	jmp	.L601
+.LVL634:
+.L597:
+	.loc 1 1323 21 is_stmt 1 view .LVU2176
+	movq	(%rsp), %rcx
+	movq	40(%rsp), %rdi
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	call	iter_quote_bulk
+.LVL635:
+	.loc 1 1324 21 view .LVU2177
+	.loc 1 1324 24 is_stmt 0 view .LVU2178
+	cmpl	$0, 80(%rsp)
+	jne	.L600
+	jmp	.L601
+.LVL636:
+.L656:
+	.loc 1 1333 17 is_stmt 1 view .LVU2179
+	movq	40(%rsp), %rsi
+	movq	%r12, %rdi
+	call	render_quote_put
+.LVL637:
+	.loc 1 1333 17 is_stmt 0 view .LVU2180
+	jmp	.L596
+.LVL638:
+.L601:
+	.loc 1 1335 13 is_stmt 1 view .LVU2181
+.LBB951:
+.LBI951:
+	.loc 1 586 12 view .LVU2182
+.LBB952:
+	.loc 1 588 5 view .LVU2183
+	.loc 1 589 5 view .LVU2184
+	.loc 1 589 18 is_stmt 0 view .LVU2185
+	movl	88(%rsp), %edx
+	.loc 1 590 5 is_stmt 1 view .LVU2186
+.LBB953:
+	.loc 1 590 21 view .LVU2187
+.LVL639:
+	.loc 1 590 58 view .LVU2188
+	.loc 1 590 92 view .LVU2189
+	.loc 1 590 104 view .LVU2190
+	movl	%edx, %eax
+	andl	$-33, %eax
+	.loc 1 590 107 is_stmt 0 view .LVU2191
+	testb	$32, 32(%rbx)
+	je	.L605
+	.loc 1 590 97 view .LVU2192
+	movl	%edx, %eax
+	orl	$32, %eax
+.L605:
+	.loc 1 590 97 view .LVU2193
+	movl	%eax, 32(%rbx)
+.LVL640:
+	.loc 1 590 97 view .LVU2194
+.LBE953:
+	.loc 1 591 5 is_stmt 1 view .LVU2195
+	.loc 1 592 20 is_stmt 0 view .LVU2196
+	movl	80(%rsp), %edx
+	.loc 1 593 5 view .LVU2197
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	.loc 1 591 14 view .LVU2198
+	movl	92(%rsp), %eax
+	.loc 1 592 14 view .LVU2199
+	movl	%edx, 24(%rbx)
+	.loc 1 591 14 view .LVU2200
+	movl	%eax, 36(%rbx)
+	.loc 1 592 5 is_stmt 1 view .LVU2201
+	.loc 1 593 5 view .LVU2202
+	call	render_fill
+.LVL641:
+	.loc 1 594 5 view .LVU2203
+	.loc 1 594 17 is_stmt 0 view .LVU2204
+	cmpq	$64, 120(%rsp)
+	setbe	%al
+.LVL642:
+.L586:
+	.loc 1 594 17 view .LVU2205
+	movb	%al, 40(%rsp)
+.LVL643:
+	.loc 1 594 17 view .LVU2206
+.LBE952:
+.LBE951:
+	.loc 1 1340 5 is_stmt 1 view .LVU2207
+	movl	24(%rsp), %eax
+.LVL644:
+	.loc 1 1340 5 is_stmt 0 view .LVU2208
+	movq	%rbx, %rdi
+	movzbl	%ah, %esi
+	call	va_stream_render
+.LVL645:
+	.loc 1 1341 5 is_stmt 1 view .LVU2209
+	movl	24(%rsp), %esi
+	movq	%rbx, %rdi
+	shrl	$16, %esi
+	call	va_stream_render
+.LVL646:
+	.loc 1 1342 5 view .LVU2210
+	.loc 1 1342 8 is_stmt 0 view .LVU2211
+	movb	40(%rsp), %al
+	testb	%al, %al
+	je	.L657
+.LBB954:
+.LBB955:
+	.loc 1 599 17 view .LVU2212
+	xorl	%eax, %eax
+.LVL647:
+.L606:
+	.loc 1 599 26 is_stmt 1 view .LVU2213
+	cmpq	120(%rsp), %rax
+	jnb	.L664
+	.loc 1 600 9 view .LVU2214
+	movl	128(%rsp,%rax,4), %esi
+	movq	%rbx, %rdi
+	movq	%rax, 8(%rsp)
+	call	va_stream_render
+.LVL648:
+	.loc 1 599 35 view .LVU2215
+	movq	8(%rsp), %rax
+	incq	%rax
+.LVL649:
+	.loc 1 599 35 is_stmt 0 view .LVU2216
+	jmp	.L606
+.L664:
+.LVL650:
+	.loc 1 599 35 view .LVU2217
+.LBE955:
+.LBE954:
+	.loc 1 1344 9 is_stmt 1 view .LVU2218
+	.loc 1 1344 12 is_stmt 0 view .LVU2219
+	cmpb	$0, 32(%rsp)
+	je	.L616
+	jmp	.L609
+.LVL651:
+.L657:
+	.loc 1 1349 9 is_stmt 1 view .LVU2220
+.LBB956:
+.LBI956:
+	.loc 1 250 13 view .LVU2221
+.LBB957:
+	.loc 1 255 5 view .LVU2222
+.LBB958:
+	.loc 1 255 21 view .LVU2223
+	.loc 1 255 58 view .LVU2224
+.LBE958:
+	.loc 1 256 14 is_stmt 0 view .LVU2225
+	xorl	%eax, %eax
+.LBB959:
+	.loc 1 255 119 view .LVU2226
+	andl	$1073741823, 32(%rbx)
+.LBE959:
+	.loc 1 256 5 is_stmt 1 view .LVU2227
+	.loc 1 256 14 is_stmt 0 view .LVU2228
+	movl	%eax, 36(%rbx)
+	.loc 1 257 5 is_stmt 1 view .LVU2229
+	.loc 1 257 15 is_stmt 0 view .LVU2230
+	movq	8(%rsp), %rax
+	movq	%rax, 8(%rbp)
+.LVL652:
+.L616:
+	.loc 1 257 15 view .LVU2231
+.LBE957:
+.LBE956:
+	.loc 1 1351 5 is_stmt 1 view .LVU2232
+	.loc 1 1352 9 view .LVU2233
+	.loc 1 1352 12 is_stmt 0 view .LVU2234
+	testl	%r15d, %r15d
+	je	.L611
+	.loc 1 1353 13 is_stmt 1 view .LVU2235
+	movq	(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_len_bulk
+.LVL653:
+	jmp	.L612
+.L611:
+	.loc 1 1355 14 view .LVU2236
+	.loc 1 1355 17 is_stmt 0 view .LVU2237
+	testl	%r14d, %r14d
+	je	.L613
+	.loc 1 1356 13 is_stmt 1 view .LVU2238
+	movq	(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_copy_bulk
+.LVL654:
+	jmp	.L612
+.L613:
+	.loc 1 1358 14 view .LVU2239
+	.loc 1 1358 17 is_stmt 0 view .LVU2240
+	testl	%r13d, %r13d
+	je	.L614
+	.loc 1 1359 13 is_stmt 1 view .LVU2241
+	movq	(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_transcode_bulk
+.LVL655:
+	jmp	.L612
+.L614:
+	.loc 1 1361 14 view .LVU2242
+	.loc 1 1361 17 is_stmt 0 view .LVU2243
+	cmpl	$0, 20(%rsp)
+	je	.L612
+	.loc 1 1362 13 is_stmt 1 view .LVU2244
+	movq	(%rsp), %rcx
+	orq	$-1, %r8
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	iter_quote_bulk
+.LVL656:
+.L612:
+	.loc 1 1364 9 view .LVU2245
+	.loc 1 1364 19 is_stmt 0 view .LVU2246
+	movq	(%rsp), %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	iter_take
+.LVL657:
+	.loc 1 1369 5 view .LVU2247
+	movq	%rbx, %rsi
+	movq	%r12, %rdi
+	.loc 1 1364 19 view .LVU2248
+	movl	%eax, %edx
+.LVL658:
+	.loc 1 1364 12 view .LVU2249
+	cmpl	$-1, %eax
+	je	.L615
+.LVL659:
+	.loc 1 1367 9 is_stmt 1 view .LVU2250
+	call	render_quote_put
+.LVL660:
+	.loc 1 1351 5 view .LVU2251
+	.loc 1 1352 12 is_stmt 0 view .LVU2252
+	jmp	.L616
+.LVL661:
+.L615:
+	.loc 1 1369 5 is_stmt 1 view .LVU2253
+	call	render_quote_flush
+.LVL662:
+.L609:
+	.loc 1 1371 5 view .LVU2254
+	.loc 1 1371 52 is_stmt 0 view .LVU2255
+	movq	24(%rsp), %rsi
+	.loc 1 1371 5 view .LVU2256
+	movq	%rbx, %rdi
+	.loc 1 1371 52 view .LVU2257
+	shrq	$32, %rsi
+	.loc 1 1371 5 view .LVU2258
+	movzwl	%si, %esi
+	call	va_stream_render
+.LVL663:
+	.loc 1 1374 5 is_stmt 1 view .LVU2259
+	movl	24(%rbx), %edx
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	render_fill
+.LVL664:
+	.loc 1 1375 1 is_stmt 0 view .LVU2260
+	addq	$392, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL665:
+	.loc 1 1375 1 view .LVU2261
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL666:
+	.loc 1 1375 1 view .LVU2262
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL667:
+	.loc 1 1375 1 view .LVU2263
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE585:
+	.size	render_iter_algo, .-render_iter_algo
+	.type	render_iter, @function
+render_iter:
+.LVL668:
+.LFB586:
+	.loc 1 1378 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1379 5 view .LVU2265
+	.loc 1 1379 15 is_stmt 0 view .LVU2266
+	movq	%rdx, 8(%rsi)
+	.loc 1 1380 5 is_stmt 1 view .LVU2267
+	.loc 1 1380 24 is_stmt 0 view .LVU2268
+	movl	32(%rdi), %eax
+	shrl	$10, %eax
+	.loc 1 1380 37 view .LVU2269
+	andl	$7, %eax
+	.loc 1 1380 5 view .LVU2270
+	cmpl	$3, %eax
+	je	.L666
+	cmpl	$4, %eax
+	jne	.L667
+.LVL669:
+.LBB962:
+.LBI962:
+	.loc 1 1377 13 is_stmt 1 view .LVU2271
+.LBB963:
+	.loc 1 1382 9 view .LVU2272
+	.loc 1 1382 36 is_stmt 0 view .LVU2273
+	movq	(%rsi), %rax
+	.loc 1 1382 9 view .LVU2274
+	movq	(%rax), %rsi
+.LVL670:
+	.loc 1 1382 9 view .LVU2275
+	jmp	render_rawstr
+.LVL671:
+.L666:
+	.loc 1 1382 9 view .LVU2276
+.LBE963:
+.LBE962:
+	.loc 1 1385 9 is_stmt 1 view .LVU2277
+	movq	%rdx, %rsi
+.LVL672:
+	.loc 1 1385 9 is_stmt 0 view .LVU2278
+	jmp	render_ptr
+.LVL673:
+.L667:
+	.loc 1 1388 5 is_stmt 1 view .LVU2279
+	jmp	render_iter_algo
+.LVL674:
+	.loc 1 1388 5 is_stmt 0 view .LVU2280
+	.cfi_endproc
+.LFE586:
+	.size	render_iter, .-render_iter
+	.section	.rodata.str1.1
+.LC16:
+	.string	"(VA_BGET(s->opt, VA_OPT_STATE) == VA_STATE_ARG) || (VA_BGET(s->opt, VA_OPT_STATE) == VA_STATE_SKIP)"
+	.text
+	.type	parse_format, @function
+parse_format:
+.LVL675:
+.LFB602:
+	.loc 1 1879 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1880 5 view .LVU2282
+.LBB1019:
+.LBI1019:
+	.loc 1 1805 27 view .LVU2283
+.LBB1020:
+	.loc 1 1807 5 view .LVU2284
+.LBE1020:
+.LBE1019:
+	.loc 1 1879 1 is_stmt 0 view .LVU2285
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB1024:
+.LBB1022:
+	.loc 1 1807 8 view .LVU2286
+	leaq	va_format_read_vtab(%rip), %rax
+.LBE1022:
+.LBE1024:
+	.loc 1 1879 1 view .LVU2287
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 80
+.LBB1025:
+.LBB1023:
+	.loc 1 1807 12 view .LVU2288
+	movq	8(%rdi), %rbp
+	.loc 1 1807 8 view .LVU2289
+	cmpq	%rax, %rbp
+	jne	.L669
+.LBB1021:
+	.loc 1 1808 9 is_stmt 1 view .LVU2290
+	.loc 1 1808 28 is_stmt 0 view .LVU2291
+	movq	16(%rdi), %rbp
+.LVL676:
+	.loc 1 1809 9 is_stmt 1 view .LVU2292
+	.loc 1 1809 12 is_stmt 0 view .LVU2293
+	testq	%rbp, %rbp
+	je	.L671
+	.loc 1 1812 9 is_stmt 1 view .LVU2294
+	.loc 1 1812 48 is_stmt 0 view .LVU2295
+	movq	56(%rbp), %rax
+	.loc 1 1812 14 view .LVU2296
+	movq	%rbp, 8(%rdi)
+	movq	%rax, 16(%rdi)
+	.loc 1 1813 9 is_stmt 1 view .LVU2297
+	.loc 1 1813 16 is_stmt 0 view .LVU2298
+	jmp	.L671
+.LVL677:
+.L669:
+	.loc 1 1813 16 view .LVU2299
+.LBE1021:
+	.loc 1 1815 5 is_stmt 1 view .LVU2300
+	.loc 1 1815 8 is_stmt 0 view .LVU2301
+	leaq	va_format_type(%rip), %rax
+	cmpq	%rax, 0(%rbp)
+	je	.L671
+	.loc 1 1816 15 view .LVU2302
+	xorl	%ebp, %ebp
+.L671:
+.LVL678:
+	.loc 1 1816 15 view .LVU2303
+.LBE1023:
+.LBE1025:
+	.loc 1 1881 5 is_stmt 1 view .LVU2304
+	.loc 1 1881 20 is_stmt 0 view .LVU2305
+	movups	8(%rbx), %xmm0
+	.loc 1 1885 18 view .LVU2306
+	movq	%rsp, %r12
+	.loc 1 1881 20 view .LVU2307
+	movaps	%xmm0, (%rsp)
+.LVL679:
+.L673:
+	.loc 1 1883 7 is_stmt 1 view .LVU2308
+	.loc 1 1884 5 view .LVU2309
+	.loc 1 1885 18 is_stmt 0 view .LVU2310
+	movq	%r12, %rsi
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	.loc 1 1884 17 view .LVU2311
+	movq	8(%rsp), %r13
+.LVL680:
+	.loc 1 1885 5 is_stmt 1 view .LVU2312
+	.loc 1 1885 18 is_stmt 0 view .LVU2313
+	call	iter_take
+.LVL681:
+	movl	%eax, %esi
+.LVL682:
+	.loc 1 1887 5 is_stmt 1 view .LVU2314
+	.loc 1 1887 18 is_stmt 0 view .LVU2315
+	leal	-1(%rax), %eax
+.LVL683:
+	.loc 1 1887 8 view .LVU2316
+	cmpl	$-3, %eax
+	ja	.L674
+	.loc 1 1892 5 is_stmt 1 view .LVU2317
+	.loc 1 1892 13 is_stmt 0 view .LVU2318
+	movl	32(%rbx), %edi
+	.loc 1 1892 20 view .LVU2319
+	movl	%edi, %eax
+	shrl	$13, %eax
+	.loc 1 1892 8 view .LVU2320
+	testb	$6, %al
+	jne	.L675
+	.loc 1 1893 9 is_stmt 1 view .LVU2321
+	.loc 1 1894 9 view .LVU2322
+	.loc 1 1893 18 is_stmt 0 view .LVU2323
+	movl	$2147483647, %eax
+	salq	$32, %rax
+	movq	%rax, 24(%rbx)
+	.loc 1 1895 9 is_stmt 1 view .LVU2324
+	.loc 1 1895 16 is_stmt 0 view .LVU2325
+	movl	%edi, %eax
+	andl	$939524320, %eax
+	movl	%eax, 32(%rbx)
+	.loc 1 1898 9 is_stmt 1 view .LVU2326
+	.loc 1 1898 12 is_stmt 0 view .LVU2327
+	testq	%rbp, %rbp
+	je	.L693
+.LBB1026:
+	.loc 1 1899 13 is_stmt 1 view .LVU2328
+	.loc 1 1900 42 is_stmt 0 view .LVU2329
+	movq	72(%rbp), %r8
+	.loc 1 1900 31 view .LVU2330
+	movq	64(%rbp), %r10
+.LVL684:
+.LBB1027:
+.LBI1027:
+	.loc 1 1824 20 is_stmt 1 view .LVU2331
+.LBB1028:
+	.loc 1 1831 5 view .LVU2332
+	.loc 1 1831 44 is_stmt 0 view .LVU2333
+	movq	%r13, %rcx
+	.loc 1 1832 12 view .LVU2334
+	xorl	%edx, %edx
+	.loc 1 1831 44 view .LVU2335
+	subq	56(%rbp), %rcx
+.LVL685:
+	.loc 1 1832 5 is_stmt 1 view .LVU2336
+	.loc 1 1833 5 view .LVU2337
+.L679:
+	.loc 1 1833 15 view .LVU2338
+	cmpq	%r8, %rdx
+	jnb	.L693
+.LBB1029:
+	.loc 1 1834 9 view .LVU2339
+	.loc 1 1834 33 is_stmt 0 view .LVU2340
+	movq	%r8, %rax
+	subq	%rdx, %rax
+	.loc 1 1834 39 view .LVU2341
+	shrq	%rax
+	.loc 1 1834 16 view .LVU2342
+	addq	%rdx, %rax
+.LVL686:
+	.loc 1 1835 9 is_stmt 1 view .LVU2343
+	.loc 1 1835 51 is_stmt 0 view .LVU2344
+	imulq	$88, %rax, %r13
+	.loc 1 1835 21 view .LVU2345
+	addq	%r10, %r13
+.LVL687:
+	.loc 1 1836 9 is_stmt 1 view .LVU2346
+	.loc 1 1836 16 is_stmt 0 view .LVU2347
+	movq	0(%r13), %r9
+.LVL688:
+	.loc 1 1837 9 is_stmt 1 view .LVU2348
+	.loc 1 1837 12 is_stmt 0 view .LVU2349
+	cmpq	%r9, %rcx
+	je	.L678
+	.loc 1 1840 9 is_stmt 1 view .LVU2350
+	.loc 1 1840 12 is_stmt 0 view .LVU2351
+	cmpq	%rcx, %r9
+	jnb	.L755
+	.loc 1 1841 13 is_stmt 1 view .LVU2352
+	.loc 1 1841 16 is_stmt 0 view .LVU2353
+	leaq	1(%rax), %rdx
+.LVL689:
+	.loc 1 1841 16 view .LVU2354
+	jmp	.L679
+.L755:
+	.loc 1 1834 16 view .LVU2355
+	movq	%rax, %r8
+.LVL690:
+	.loc 1 1834 16 view .LVU2356
+	jmp	.L679
+.LVL691:
+.L678:
+	.loc 1 1834 16 view .LVU2357
+.LBE1029:
+.LBE1028:
+.LBE1027:
+	.loc 1 1901 13 is_stmt 1 view .LVU2358
+	.loc 1 1901 16 is_stmt 0 view .LVU2359
+	testq	%r13, %r13
+	je	.L693
+	.loc 1 1902 17 is_stmt 1 view .LVU2360
+.LVL692:
+.LBB1030:
+.LBI1030:
+	.loc 1 1854 13 view .LVU2361
+.LBB1031:
+	.loc 1 1856 5 view .LVU2362
+	.loc 1 1857 5 view .LVU2363
+	.loc 1 1857 8 is_stmt 0 view .LVU2364
+	andb	$32, %dil
+	jne	.L682
+	.loc 1 1860 5 is_stmt 1 view .LVU2365
+	.loc 1 1860 21 is_stmt 0 view .LVU2366
+	movq	(%rbx), %rdi
+	.loc 1 1860 27 view .LVU2367
+	movzbl	48(%rdi), %ecx
+.LVL693:
+	.loc 1 1861 5 is_stmt 1 view .LVU2368
+	.loc 1 1861 8 is_stmt 0 view .LVU2369
+	testl	%ecx, %ecx
+	je	.L683
+	.loc 1 1861 31 view .LVU2370
+	movq	40(%rdi), %rdx
+	leaq	0(%r13,%rcx,8), %r14
+	.loc 1 1862 38 view .LVU2371
+	movq	56(%r14), %rsi
+.LVL694:
+	.loc 1 1861 20 view .LVU2372
+	testq	%rdx, %rdx
+	je	.L684
+	.loc 1 1862 9 is_stmt 1 view .LVU2373
+	.loc 1 1862 52 is_stmt 0 view .LVU2374
+	decl	%ecx
+.LVL695:
+	.loc 1 1862 9 view .LVU2375
+	movq	%rbx, %rdi
+.LVL696:
+	.loc 1 1862 9 view .LVU2376
+	shrq	%cl, %rsi
+	call	*%rdx
+.LVL697:
+	.loc 1 1863 9 is_stmt 1 view .LVU2377
+	jmp	.L682
+.LVL698:
+.L684:
+	.loc 1 1865 5 view .LVU2378
+.LBB1032:
+.LBI1032:
+	.loc 2 585 19 view .LVU2379
+.LBB1033:
+	.loc 2 587 5 view .LVU2380
+.LBB1034:
+.LBI1034:
+	.loc 2 574 22 view .LVU2381
+.LBB1035:
+	.loc 2 576 5 view .LVU2382
+	.loc 2 576 39 is_stmt 0 view .LVU2383
+	movq	48(%rbx), %rax
+	subq	40(%rbx), %rax
+.LBE1035:
+.LBE1034:
+	.loc 2 587 8 view .LVU2384
+	cmpq	%rsi, %rax
+	jb	.L685
+.LVL699:
+.L686:
+	.loc 2 587 8 view .LVU2385
+.LBE1033:
+.LBE1032:
+	.loc 1 1866 9 is_stmt 1 view .LVU2386
+	movq	24(%r14), %rsi
+	movq	56(%r14), %rcx
+	movq	40(%rbx), %rdi
+	rep movsb
+	.loc 1 1867 9 view .LVU2387
+	.loc 1 1867 40 is_stmt 0 view .LVU2388
+	movq	56(%r14), %rax
+	addq	%rax, 40(%rbx)
+	.loc 1 1868 9 is_stmt 1 view .LVU2389
+	jmp	.L682
+.LVL700:
+.L685:
+.LBB1037:
+.LBB1036:
+	.loc 2 590 5 view .LVU2390
+	.loc 2 590 20 is_stmt 0 view .LVU2391
+	movq	24(%rdi), %rax
+	.loc 2 590 37 view .LVU2392
+	testq	%rax, %rax
+	je	.L683
+	.loc 2 590 40 view .LVU2393
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL701:
+	.loc 2 590 37 view .LVU2394
+	testb	%al, %al
+	jne	.L686
+.LVL702:
+.L683:
+	.loc 2 590 37 view .LVU2395
+.LBE1036:
+.LBE1037:
+	.loc 1 1870 5 is_stmt 1 view .LVU2396
+	.loc 1 1870 21 is_stmt 0 view .LVU2397
+	movq	48(%r13), %r15
+.LVL703:
+	.loc 1 1871 5 is_stmt 1 view .LVU2398
+.LBB1038:
+	.loc 1 1871 10 view .LVU2399
+	.loc 1 1871 17 is_stmt 0 view .LVU2400
+	xorl	%r14d, %r14d
+.LVL704:
+.L687:
+	.loc 1 1871 26 is_stmt 1 view .LVU2401
+	cmpq	16(%r13), %r14
+	jnb	.L682
+	.loc 1 1872 9 view .LVU2402
+	.loc 1 1872 16 is_stmt 0 view .LVU2403
+	movq	(%rbx), %rax
+	.loc 1 1872 9 view .LVU2404
+	movl	(%r15,%r14,4), %esi
+	movq	%rbx, %rdi
+	.loc 1 1871 39 view .LVU2405
+	incq	%r14
+.LVL705:
+	.loc 1 1872 9 view .LVU2406
+	call	*8(%rax)
+.LVL706:
+	.loc 1 1871 39 is_stmt 1 view .LVU2407
+	.loc 1 1871 39 is_stmt 0 view .LVU2408
+	jmp	.L687
+.LVL707:
+.L682:
+	.loc 1 1871 39 view .LVU2409
+.LBE1038:
+.LBE1031:
+.LBE1030:
+	.loc 1 1903 17 is_stmt 1 view .LVU2410
+	.loc 1 1903 53 is_stmt 0 view .LVU2411
+	movq	8(%r13), %rax
+	addq	56(%rbp), %rax
+	.loc 1 1903 27 view .LVU2412
+	movq	%rax, 8(%rsp)
+.LVL708:
+.L777:
+	.loc 1 1904 17 is_stmt 1 view .LVU2413
+	.loc 1 1904 21 is_stmt 0 view .LVU2414
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	iter_take_pat
+.LVL709:
+	movl	%eax, %esi
+.LVL710:
+.L693:
+	.loc 1 1904 21 view .LVU2415
+.LBE1026:
+	.loc 1 1909 9 is_stmt 1 view .LVU2416
+	.loc 1 1910 13 view .LVU2417
+	.loc 1 1910 26 is_stmt 0 view .LVU2418
+	leal	-1(%rsi), %eax
+	.loc 1 1910 16 view .LVU2419
+	cmpl	$-3, %eax
+	ja	.L674
+	.loc 1 1913 13 is_stmt 1 view .LVU2420
+	.loc 1 1913 16 is_stmt 0 view .LVU2421
+	cmpl	$126, %esi
+	jne	.L690
+	.loc 1 1914 17 is_stmt 1 view .LVU2422
+	.loc 1 1914 21 is_stmt 0 view .LVU2423
+	movq	%r12, %rsi
+.LVL711:
+	.loc 1 1914 21 view .LVU2424
+	movq	%rbx, %rdi
+	call	iter_take_pat
+.LVL712:
+	.loc 1 1914 21 view .LVU2425
+	movl	%eax, %esi
+.LVL713:
+	.loc 1 1915 17 is_stmt 1 view .LVU2426
+	.loc 1 1922 9 view .LVU2427
+	.loc 1 1922 12 is_stmt 0 view .LVU2428
+	testq	%rbp, %rbp
+	je	.L692
+.LBB1039:
+	.loc 1 1923 13 is_stmt 1 view .LVU2429
+.LBB1040:
+.LBB1041:
+	.loc 1 1831 44 is_stmt 0 view .LVU2430
+	movq	16(%rbx), %rdi
+.LBE1041:
+.LBE1040:
+	.loc 1 1924 51 view .LVU2431
+	movq	88(%rbp), %r8
+.LBB1047:
+.LBB1044:
+	.loc 1 1832 12 view .LVU2432
+	xorl	%ecx, %ecx
+.LBE1044:
+.LBE1047:
+	.loc 1 1924 39 view .LVU2433
+	movq	80(%rbp), %r10
+.LVL714:
+.LBB1048:
+.LBI1040:
+	.loc 1 1824 20 is_stmt 1 view .LVU2434
+.LBB1045:
+	.loc 1 1831 5 view .LVU2435
+	.loc 1 1831 44 is_stmt 0 view .LVU2436
+	subq	56(%rbp), %rdi
+.LVL715:
+	.loc 1 1832 5 is_stmt 1 view .LVU2437
+	.loc 1 1833 5 view .LVU2438
+	.loc 1 1833 11 is_stmt 0 view .LVU2439
+	jmp	.L696
+.LVL716:
+.L690:
+	.loc 1 1833 11 view .LVU2440
+.LBE1045:
+.LBE1048:
+.LBE1039:
+	.loc 1 1917 13 is_stmt 1 view .LVU2441
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL717:
+	.loc 1 1918 13 view .LVU2442
+	jmp	.L777
+.LVL718:
+.L697:
+.LBB1050:
+.LBB1049:
+.LBB1046:
+.LBB1042:
+	.loc 1 1834 9 view .LVU2443
+	.loc 1 1834 33 is_stmt 0 view .LVU2444
+	movq	%r8, %rdx
+	subq	%rcx, %rdx
+	.loc 1 1834 39 view .LVU2445
+	shrq	%rdx
+	.loc 1 1834 16 view .LVU2446
+	addq	%rcx, %rdx
+.LVL719:
+	.loc 1 1835 9 is_stmt 1 view .LVU2447
+	.loc 1 1835 51 is_stmt 0 view .LVU2448
+	movq	%rdx, %rax
+	salq	$5, %rax
+	.loc 1 1835 21 view .LVU2449
+	addq	%r10, %rax
+.LVL720:
+	.loc 1 1836 9 is_stmt 1 view .LVU2450
+	.loc 1 1836 16 is_stmt 0 view .LVU2451
+	movq	(%rax), %r9
+.LVL721:
+	.loc 1 1837 9 is_stmt 1 view .LVU2452
+	.loc 1 1837 12 is_stmt 0 view .LVU2453
+	cmpq	%r9, %rdi
+	je	.L695
+	.loc 1 1840 9 is_stmt 1 view .LVU2454
+	.loc 1 1840 12 is_stmt 0 view .LVU2455
+	cmpq	%rdi, %r9
+	jnb	.L756
+	.loc 1 1841 13 is_stmt 1 view .LVU2456
+	.loc 1 1841 16 is_stmt 0 view .LVU2457
+	leaq	1(%rdx), %rcx
+.LVL722:
+.L696:
+	.loc 1 1841 16 view .LVU2458
+.LBE1042:
+	.loc 1 1833 15 is_stmt 1 view .LVU2459
+	cmpq	%r8, %rcx
+	jb	.L697
+	jmp	.L692
+.LVL723:
+.L756:
+.LBB1043:
+	.loc 1 1834 16 is_stmt 0 view .LVU2460
+	movq	%rdx, %r8
+.LVL724:
+	.loc 1 1834 16 view .LVU2461
+	jmp	.L696
+.LVL725:
+.L695:
+	.loc 1 1834 16 view .LVU2462
+.LBE1043:
+.LBE1046:
+.LBE1049:
+	.loc 1 1925 13 is_stmt 1 view .LVU2463
+	.loc 1 1925 16 is_stmt 0 view .LVU2464
+	testq	%rax, %rax
+	je	.L692
+	.loc 1 1926 17 is_stmt 1 view .LVU2465
+	.loc 1 1926 24 is_stmt 0 view .LVU2466
+	movl	16(%rax), %edx
+	orl	%edx, 32(%rbx)
+	.loc 1 1927 17 is_stmt 1 view .LVU2467
+	.loc 1 1927 32 is_stmt 0 view .LVU2468
+	movl	20(%rax), %edx
+	.loc 1 1927 26 view .LVU2469
+	movl	%edx, 24(%rbx)
+	.loc 1 1928 17 is_stmt 1 view .LVU2470
+	.loc 1 1928 31 is_stmt 0 view .LVU2471
+	movl	24(%rax), %edx
+	.loc 1 1928 25 view .LVU2472
+	movl	%edx, 28(%rbx)
+	.loc 1 1929 17 is_stmt 1 view .LVU2473
+	.loc 1 1929 53 is_stmt 0 view .LVU2474
+	movq	8(%rax), %rax
+.LVL726:
+	.loc 1 1929 53 view .LVU2475
+	addq	56(%rbp), %rax
+	.loc 1 1929 27 view .LVU2476
+	movq	%rax, 8(%rsp)
+	.loc 1 1930 17 is_stmt 1 view .LVU2477
+	.loc 1 1930 24 is_stmt 0 view .LVU2478
+	movaps	(%rsp), %xmm1
+	movups	%xmm1, 8(%rbx)
+	.loc 1 1931 17 is_stmt 1 view .LVU2479
+	jmp	.L698
+.LVL727:
+.L692:
+	.loc 1 1931 17 is_stmt 0 view .LVU2480
+.LBE1050:
+	.loc 1 1936 9 is_stmt 1 view .LVU2481
+	.loc 1 1936 18 is_stmt 0 view .LVU2482
+	movl	$2147483647, 24(%rbx)
+.L710:
+	.loc 1 1939 9 is_stmt 1 view .LVU2483
+	.loc 1 1940 13 view .LVU2484
+.LBB1051:
+	.loc 1 1966 73 is_stmt 0 view .LVU2485
+	movl	32(%rbx), %eax
+.LBE1051:
+	.loc 1 1940 13 view .LVU2486
+	cmpl	$45, %esi
+	je	.L699
+	.loc 1 1940 13 view .LVU2487
+	ja	.L700
+	cmpl	$35, %esi
+	je	.L701
+	cmpl	$43, %esi
+	je	.L702
+	cmpl	$32, %esi
+	je	.L703
+	jmp	.L795
+.L700:
+	cmpl	$48, %esi
+	je	.L705
+	cmpl	$61, %esi
+	je	.L706
+	.loc 1 1942 17 is_stmt 1 view .LVU2488
+	.loc 1 1966 9 view .LVU2489
+.LBB1052:
+	.loc 1 1966 25 view .LVU2490
+.LVL728:
+	.loc 1 1966 62 view .LVU2491
+	.loc 1 1966 101 is_stmt 0 view .LVU2492
+	andb	$31, %ah
+	.loc 1 1966 123 view .LVU2493
+	orb	$64, %ah
+	movl	%eax, 32(%rbx)
+.LBE1052:
+	.loc 1 1969 9 is_stmt 1 view .LVU2494
+.LDL1:
+	.loc 1 1974 9 view .LVU2495
+	.loc 1 1974 24 is_stmt 0 view .LVU2496
+	leal	-49(%rsi), %eax
+	.loc 1 1974 12 view .LVU2497
+	cmpl	$8, %eax
+	ja	.L675
+	.loc 1 1975 13 is_stmt 1 view .LVU2498
+	.loc 1 1975 26 is_stmt 0 view .LVU2499
+	subl	$48, %esi
+.LVL729:
+	.loc 1 1975 26 view .LVU2500
+	movl	%esi, 24(%rbx)
+	.loc 1 1976 13 is_stmt 1 view .LVU2501
+	jmp	.L779
+.LVL730:
+.L795:
+	.loc 1 1942 17 view .LVU2502
+	.loc 1 1966 9 view .LVU2503
+.LBB1053:
+	.loc 1 1966 25 view .LVU2504
+	.loc 1 1966 62 view .LVU2505
+	.loc 1 1966 101 is_stmt 0 view .LVU2506
+	andb	$31, %ah
+	.loc 1 1966 123 view .LVU2507
+	orb	$64, %ah
+	movl	%eax, 32(%rbx)
+.LBE1053:
+	.loc 1 1969 9 is_stmt 1 view .LVU2508
+	.loc 1 1969 12 is_stmt 0 view .LVU2509
+	cmpl	$42, %esi
+	jne	.L675
+	.loc 1 1970 13 is_stmt 1 view .LVU2510
+	.loc 1 1971 20 is_stmt 0 view .LVU2511
+	movaps	(%rsp), %xmm2
+	.loc 1 1970 22 view .LVU2512
+	xorl	%ecx, %ecx
+	movl	%ecx, 24(%rbx)
+	.loc 1 1971 13 is_stmt 1 view .LVU2513
+	.loc 1 1971 20 is_stmt 0 view .LVU2514
+	movups	%xmm2, 8(%rbx)
+	.loc 1 1972 13 is_stmt 1 view .LVU2515
+	jmp	.L711
+.LVL731:
+.L701:
+	.loc 1 1944 17 view .LVU2516
+	.loc 1 1944 24 is_stmt 0 view .LVU2517
+	orl	$1, %eax
+	jmp	.L778
+.L699:
+	.loc 1 1947 17 is_stmt 1 view .LVU2518
+	.loc 1 1947 24 is_stmt 0 view .LVU2519
+	orl	$8, %eax
+	jmp	.L778
+.L702:
+	.loc 1 1950 17 is_stmt 1 view .LVU2520
+.LBB1054:
+	.loc 1 1950 33 view .LVU2521
+.LVL732:
+	.loc 1 1950 70 view .LVU2522
+	.loc 1 1950 108 is_stmt 0 view .LVU2523
+	andb	$-4, %ah
+	.loc 1 1950 129 view .LVU2524
+	orb	$2, %ah
+	jmp	.L778
+.LVL733:
+.L703:
+	.loc 1 1950 129 view .LVU2525
+.LBE1054:
+	.loc 1 1953 17 is_stmt 1 view .LVU2526
+.LBB1055:
+	.loc 1 1953 33 view .LVU2527
+	.loc 1 1953 70 view .LVU2528
+	.loc 1 1953 108 is_stmt 0 view .LVU2529
+	andb	$-4, %ah
+	.loc 1 1953 129 view .LVU2530
+	orb	$1, %ah
+	jmp	.L778
+.LVL734:
+.L705:
+	.loc 1 1953 129 view .LVU2531
+.LBE1055:
+	.loc 1 1956 17 is_stmt 1 view .LVU2532
+	.loc 1 1956 24 is_stmt 0 view .LVU2533
+	orl	$4, %eax
+	jmp	.L778
+.L706:
+	.loc 1 1959 17 is_stmt 1 view .LVU2534
+	.loc 1 1959 24 is_stmt 0 view .LVU2535
+	orl	$16, %eax
+.L778:
+	.loc 1 1959 24 view .LVU2536
+	movl	%eax, 32(%rbx)
+	.loc 1 1960 17 is_stmt 1 view .LVU2537
+	.loc 1 1962 13 view .LVU2538
+	.loc 1 1962 17 is_stmt 0 view .LVU2539
+	movq	%r12, %rsi
+.LVL735:
+	.loc 1 1962 17 view .LVU2540
+	movq	%rbx, %rdi
+	call	iter_take_pat
+.LVL736:
+	movl	%eax, %esi
+.LVL737:
+	.loc 1 1939 9 is_stmt 1 view .LVU2541
+	.loc 1 1940 13 is_stmt 0 view .LVU2542
+	jmp	.L710
+.LVL738:
+.L779:
+	.loc 1 1979 17 is_stmt 1 view .LVU2543
+	.loc 1 1979 21 is_stmt 0 view .LVU2544
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	iter_take_pat
+.LVL739:
+	movl	%eax, %esi
+.LVL740:
+	.loc 1 1977 31 is_stmt 1 view .LVU2545
+	leal	-48(%rax), %eax
+.LVL741:
+	.loc 1 1977 31 is_stmt 0 view .LVU2546
+	cmpl	$9, %eax
+	ja	.L675
+	.loc 1 1978 17 is_stmt 1 view .LVU2547
+	.loc 1 1978 38 is_stmt 0 view .LVU2548
+	imull	$10, 24(%rbx), %eax
+	.loc 1 1978 48 view .LVU2549
+	leal	-48(%rsi,%rax), %eax
+	movl	%eax, 24(%rbx)
+	jmp	.L779
+.LVL742:
+.L675:
+	.loc 1 1984 5 is_stmt 1 view .LVU2550
+	.loc 1 1984 13 is_stmt 0 view .LVU2551
+	movl	32(%rbx), %eax
+	.loc 1 1984 20 view .LVU2552
+	movl	%eax, %edx
+	shrl	$13, %edx
+	.loc 1 1984 33 view .LVU2553
+	andl	$7, %edx
+	.loc 1 1984 8 view .LVU2554
+	cmpl	$2, %edx
+	jne	.L716
+	.loc 1 1985 9 is_stmt 1 view .LVU2555
+.LBB1056:
+	.loc 1 1985 25 view .LVU2556
+.LVL743:
+	.loc 1 1985 62 view .LVU2557
+	.loc 1 1985 101 is_stmt 0 view .LVU2558
+	andb	$31, %ah
+	.loc 1 1985 123 view .LVU2559
+	orb	$96, %ah
+	movl	%eax, 32(%rbx)
+.LBE1056:
+	.loc 1 1988 9 is_stmt 1 view .LVU2560
+	.loc 1 1988 12 is_stmt 0 view .LVU2561
+	cmpl	$46, %esi
+	jne	.L716
+	.loc 1 1989 13 is_stmt 1 view .LVU2562
+	.loc 1 1989 21 is_stmt 0 view .LVU2563
+	xorl	%edx, %edx
+	.loc 1 1990 17 view .LVU2564
+	movq	%r12, %rsi
+.LVL744:
+	.loc 1 1990 17 view .LVU2565
+	movq	%rbx, %rdi
+	.loc 1 1989 21 view .LVU2566
+	movl	%edx, 28(%rbx)
+	.loc 1 1990 13 is_stmt 1 view .LVU2567
+	.loc 1 1990 17 is_stmt 0 view .LVU2568
+	call	iter_take_pat
+.LVL745:
+	movl	%eax, %esi
+.LVL746:
+	.loc 1 1991 13 is_stmt 1 view .LVU2569
+	.loc 1 1991 16 is_stmt 0 view .LVU2570
+	cmpl	$42, %eax
+	jne	.L717
+	.loc 1 1992 17 is_stmt 1 view .LVU2571
+	.loc 1 1992 24 is_stmt 0 view .LVU2572
+	movaps	(%rsp), %xmm3
+	movups	%xmm3, 8(%rbx)
+	.loc 1 1993 17 is_stmt 1 view .LVU2573
+	jmp	.L711
+.L717:
+	.loc 1 1995 31 view .LVU2574
+	leal	-48(%rsi), %eax
+.LVL747:
+	.loc 1 1995 31 is_stmt 0 view .LVU2575
+	cmpl	$9, %eax
+	ja	.L716
+	.loc 1 1996 17 is_stmt 1 view .LVU2576
+	.loc 1 1996 36 is_stmt 0 view .LVU2577
+	imull	$10, 28(%rbx), %eax
+	.loc 1 1997 21 view .LVU2578
+	movq	%rbx, %rdi
+	.loc 1 1996 46 view .LVU2579
+	leal	-48(%rsi,%rax), %eax
+	.loc 1 1997 21 view .LVU2580
+	movq	%r12, %rsi
+.LVL748:
+	.loc 1 1996 46 view .LVU2581
+	movl	%eax, 28(%rbx)
+	.loc 1 1997 17 is_stmt 1 view .LVU2582
+	.loc 1 1997 21 is_stmt 0 view .LVU2583
+	call	iter_take_pat
+.LVL749:
+	movl	%eax, %esi
+.LVL750:
+	.loc 1 1997 21 view .LVU2584
+	jmp	.L717
+.LVL751:
+.L716:
+	.loc 1 2002 5 is_stmt 1 view .LVU2585
+	.loc 1 2002 13 is_stmt 0 view .LVU2586
+	movl	32(%rbx), %eax
+	.loc 1 2002 20 view .LVU2587
+	movl	%eax, %edx
+	shrl	$13, %edx
+	.loc 1 2002 33 view .LVU2588
+	andl	$7, %edx
+	.loc 1 2002 8 view .LVU2589
+	cmpl	$3, %edx
+	jne	.L720
+	.loc 1 2003 9 is_stmt 1 view .LVU2590
+.LBB1057:
+	.loc 1 2003 25 view .LVU2591
+.LVL752:
+	.loc 1 2003 62 view .LVU2592
+	.loc 1 2003 101 is_stmt 0 view .LVU2593
+	andb	$31, %ah
+	.loc 1 2003 123 view .LVU2594
+	orb	$32, %ah
+	movl	%eax, 32(%rbx)
+.L745:
+	.loc 1 2003 123 view .LVU2595
+.LBE1057:
+	.loc 1 2006 9 is_stmt 1 view .LVU2596
+	.loc 1 2007 13 view .LVU2597
+	cmpl	$107, %esi
+	je	.L721
+	.loc 1 2007 13 is_stmt 0 view .LVU2598
+	ja	.L722
+	cmpl	$81, %esi
+	je	.L723
+	cmpl	$104, %esi
+	je	.L724
+	cmpl	$75, %esi
+	je	.L725
+	jmp	.L726
+.L722:
+	cmpl	$113, %esi
+	je	.L727
+	cmpl	$122, %esi
+	je	.L728
+.L726:
+	.loc 1 2009 17 is_stmt 1 view .LVU2599
+.LDL2:
+	.loc 1 2042 9 view .LVU2600
+	leal	-65(%rsi), %edx
+	.loc 1 2053 18 is_stmt 0 view .LVU2601
+	movl	24(%rbx), %edi
+	.loc 1 2042 9 view .LVU2602
+	cmpl	$61, %edx
+	ja	.L729
+	leaq	.L731(%rip), %rcx
+	movl	%edx, %eax
+	movslq	(%rcx,%rax,4), %rax
+	addq	%rcx, %rax
+	jmp	*%rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L731:
+	.long	.L792-.L731
+	.long	.L742-.L731
+	.long	.L741-.L731
+	.long	.L739-.L731
+	.long	.L740-.L731
+	.long	.L792-.L731
+	.long	.L792-.L731
+	.long	.L729-.L731
+	.long	.L739-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L738-.L731
+	.long	.L729-.L731
+	.long	.L737-.L731
+	.long	.L736-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L792-.L731
+	.long	.L734-.L731
+	.long	.L733-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L732-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L792-.L731
+	.long	.L742-.L731
+	.long	.L741-.L731
+	.long	.L739-.L731
+	.long	.L740-.L731
+	.long	.L792-.L731
+	.long	.L792-.L731
+	.long	.L729-.L731
+	.long	.L739-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L738-.L731
+	.long	.L729-.L731
+	.long	.L737-.L731
+	.long	.L736-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L792-.L731
+	.long	.L734-.L731
+	.long	.L733-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L732-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L729-.L731
+	.long	.L730-.L731
+	.text
+.L724:
+	.loc 1 2011 17 is_stmt 1 view .LVU2603
+	.loc 1 2011 25 is_stmt 0 view .LVU2604
+	movl	32(%rbx), %eax
+	.loc 1 2011 20 view .LVU2605
+	btl	$20, %eax
+	jnc	.L743
+	.loc 1 2012 21 is_stmt 1 view .LVU2606
+.LVL753:
+.LBB1058:
+.LBI1058:
+	.loc 2 425 20 view .LVU2607
+.LBB1059:
+	.loc 2 427 5 view .LVU2608
+	.loc 2 427 8 is_stmt 0 view .LVU2609
+	testl	$939524096, %eax
+	jne	.L744
+	.loc 2 428 9 is_stmt 1 view .LVU2610
+.LBB1060:
+	.loc 2 428 25 view .LVU2611
+.LVL754:
+	.loc 2 428 62 view .LVU2612
+	.loc 2 428 101 is_stmt 0 view .LVU2613
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU2614
+	orl	$671088640, %eax
+	jmp	.L780
+.LVL755:
+.L743:
+	.loc 2 428 123 view .LVU2615
+.LBE1060:
+.LBE1059:
+.LBE1058:
+	.loc 1 2015 21 is_stmt 1 view .LVU2616
+.LBB1061:
+	.loc 1 2015 37 view .LVU2617
+	.loc 1 2015 74 view .LVU2618
+	.loc 1 2015 175 is_stmt 0 view .LVU2619
+	movl	%eax, %edx
+	.loc 1 2015 113 view .LVU2620
+	andl	$-1572865, %eax
+	.loc 1 2015 175 view .LVU2621
+	andl	$1572864, %edx
+	.loc 1 2015 180 view .LVU2622
+	addl	$524288, %edx
+	jmp	.L793
+.LVL756:
+.L728:
+	.loc 1 2015 180 view .LVU2623
+.LBE1061:
+	.loc 1 2019 17 is_stmt 1 view .LVU2624
+.LBB1062:
+	.loc 1 2019 33 view .LVU2625
+	.loc 1 2019 70 view .LVU2626
+	.loc 1 2019 129 is_stmt 0 view .LVU2627
+	orl	$768, 32(%rbx)
+.LBE1062:
+	.loc 1 2020 17 is_stmt 1 view .LVU2628
+	jmp	.L744
+.LVL757:
+.L721:
+	.loc 1 2023 17 view .LVU2629
+.LBB1063:
+	.loc 1 2023 33 view .LVU2630
+	.loc 1 2023 70 view .LVU2631
+	.loc 1 2023 81 is_stmt 0 view .LVU2632
+	movl	32(%rbx), %edx
+	.loc 1 2023 172 view .LVU2633
+	movl	%edx, %eax
+	shrl	$14, %eax
+	andl	$28, %eax
+	.loc 1 2023 178 view .LVU2634
+	incl	%eax
+.LVL758:
+.L794:
+	.loc 1 2023 183 view .LVU2635
+	sall	$16, %eax
+	.loc 1 2023 109 view .LVU2636
+	andl	$-458753, %edx
+.L793:
+	.loc 1 2023 131 view .LVU2637
+	orl	%edx, %eax
+	jmp	.L780
+.L727:
+	.loc 1 2023 131 view .LVU2638
+.LBE1063:
+	.loc 1 2027 17 is_stmt 1 view .LVU2639
+.LBB1064:
+	.loc 1 2027 33 view .LVU2640
+.LVL759:
+	.loc 1 2027 70 view .LVU2641
+	.loc 1 2027 81 is_stmt 0 view .LVU2642
+	movl	32(%rbx), %edx
+	.loc 1 2027 172 view .LVU2643
+	movl	%edx, %eax
+	shrl	$15, %eax
+	andl	$14, %eax
+	.loc 1 2027 178 view .LVU2644
+	addl	$2, %eax
+	jmp	.L794
+.LVL760:
+.L723:
+	.loc 1 2027 178 view .LVU2645
+.LBE1064:
+	.loc 1 2031 17 is_stmt 1 view .LVU2646
+.LBB1065:
+	.loc 1 2031 33 view .LVU2647
+	.loc 1 2031 70 view .LVU2648
+	.loc 1 2031 81 is_stmt 0 view .LVU2649
+	movl	32(%rbx), %edx
+	.loc 1 2031 183 view .LVU2650
+	leal	(%rdx,%rdx), %eax
+	.loc 1 2031 109 view .LVU2651
+	andl	$-458753, %edx
+	.loc 1 2031 183 view .LVU2652
+	andl	$786432, %eax
+	.loc 1 2031 131 view .LVU2653
+	orl	%edx, %eax
+	orl	$196608, %eax
+	jmp	.L780
+.LVL761:
+.L725:
+	.loc 1 2031 131 view .LVU2654
+.LBE1065:
+	.loc 1 2034 17 is_stmt 1 view .LVU2655
+.LBB1066:
+	.loc 1 2034 33 view .LVU2656
+	.loc 1 2034 70 view .LVU2657
+	.loc 1 2034 109 is_stmt 0 view .LVU2658
+	movl	32(%rbx), %eax
+	andl	$-458753, %eax
+	.loc 1 2034 131 view .LVU2659
+	orl	$262144, %eax
+.LVL762:
+.L780:
+	.loc 1 2034 131 view .LVU2660
+	movl	%eax, 32(%rbx)
+.LBE1066:
+	.loc 1 2035 17 is_stmt 1 view .LVU2661
+.L744:
+	.loc 1 2037 13 view .LVU2662
+	.loc 1 2037 17 is_stmt 0 view .LVU2663
+	movq	%r12, %rsi
+.LVL763:
+	.loc 1 2037 17 view .LVU2664
+	movq	%rbx, %rdi
+	call	iter_take_pat
+.LVL764:
+	movl	%eax, %esi
+.LVL765:
+	.loc 1 2006 9 is_stmt 1 view .LVU2665
+	.loc 1 2007 13 is_stmt 0 view .LVU2666
+	jmp	.L745
+.LVL766:
+.L729:
+	.loc 1 2048 13 is_stmt 1 view .LVU2667
+.LBB1067:
+.LBI1067:
+	.loc 2 425 20 view .LVU2668
+.LBB1068:
+	.loc 2 427 5 view .LVU2669
+	.loc 2 427 13 is_stmt 0 view .LVU2670
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU2671
+	testl	$939524096, %eax
+	jne	.L746
+	.loc 2 428 9 is_stmt 1 view .LVU2672
+.LBB1069:
+	.loc 2 428 25 view .LVU2673
+.LVL767:
+	.loc 2 428 62 view .LVU2674
+	.loc 2 428 101 is_stmt 0 view .LVU2675
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU2676
+	orl	$671088640, %eax
+	movl	%eax, 32(%rbx)
+.LVL768:
+.L746:
+	.loc 2 428 123 view .LVU2677
+.LBE1069:
+.LBE1068:
+.LBE1067:
+	.loc 1 2049 13 is_stmt 1 view .LVU2678
+.LBB1070:
+	.loc 1 2049 29 view .LVU2679
+	.loc 1 2049 66 view .LVU2680
+	.loc 1 2049 105 is_stmt 0 view .LVU2681
+	movl	32(%rbx), %eax
+.LBE1070:
+	.loc 1 2104 24 view .LVU2682
+	subl	$97, %esi
+.LVL769:
+.LBB1071:
+	.loc 1 2049 105 view .LVU2683
+	andb	$31, %ah
+	.loc 1 2049 127 view .LVU2684
+	orb	$-128, %ah
+	movl	%eax, 32(%rbx)
+.LBE1071:
+	.loc 1 2050 13 is_stmt 1 view .LVU2685
+	.loc 1 2104 9 view .LVU2686
+	.loc 1 2104 12 is_stmt 0 view .LVU2687
+	cmpl	$25, %esi
+	jbe	.L747
+	jmp	.L796
+.LVL770:
+.L730:
+	.loc 1 2053 13 is_stmt 1 view .LVU2688
+	.loc 1 2053 16 is_stmt 0 view .LVU2689
+	cmpl	$2147483647, %edi
+	jne	.L749
+	.loc 1 2054 17 is_stmt 1 view .LVU2690
+	.loc 1 2054 50 is_stmt 0 view .LVU2691
+	movl	32(%rbx), %eax
+	shrl	$2, %eax
+	xorl	$1, %eax
+	andl	$1, %eax
+	.loc 1 2054 26 view .LVU2692
+	movl	%eax, 24(%rbx)
+.L749:
+	.loc 1 2056 13 is_stmt 1 view .LVU2693
+	movl	24(%rbx), %edx
+	movl	$126, %esi
+.LVL771:
+	.loc 1 2056 13 is_stmt 0 view .LVU2694
+	movq	%rbx, %rdi
+	call	render_fill
+.LVL772:
+	.loc 1 2057 13 is_stmt 1 view .LVU2695
+	jmp	.L673
+.LVL773:
+.L742:
+	.loc 1 2068 13 view .LVU2696
+.LBB1072:
+	.loc 1 2068 29 view .LVU2697
+	.loc 1 2068 66 view .LVU2698
+	.loc 1 2068 108 is_stmt 0 view .LVU2699
+	movl	32(%rbx), %eax
+	andl	$-132120577, %eax
+	.loc 1 2068 133 view .LVU2700
+	orl	$4194304, %eax
+.LVL774:
+.L782:
+	.loc 1 2068 133 view .LVU2701
+	movl	%eax, 32(%rbx)
+.L792:
+	.loc 1 2068 133 view .LVU2702
+.LBE1072:
+	.loc 1 2069 13 is_stmt 1 view .LVU2703
+	.loc 1 2104 9 view .LVU2704
+	.loc 1 2104 24 is_stmt 0 view .LVU2705
+	subl	$97, %esi
+.LVL775:
+	.loc 1 2104 12 view .LVU2706
+	cmpl	$25, %esi
+	jbe	.L747
+.L750:
+	.loc 1 2109 13 is_stmt 1 view .LVU2707
+	.loc 1 2110 20 is_stmt 0 view .LVU2708
+	movaps	(%rsp), %xmm4
+	.loc 1 2109 20 view .LVU2709
+	orl	$2, 32(%rbx)
+	.loc 1 2110 13 is_stmt 1 view .LVU2710
+	.loc 1 2110 20 is_stmt 0 view .LVU2711
+	movups	%xmm4, 8(%rbx)
+	jmp	.L720
+.L747:
+	.loc 1 2105 13 is_stmt 1 view .LVU2712
+	.loc 1 2105 20 is_stmt 0 view .LVU2713
+	movaps	(%rsp), %xmm5
+	movups	%xmm5, 8(%rbx)
+	jmp	.L720
+.LVL776:
+.L737:
+	.loc 1 2071 13 is_stmt 1 view .LVU2714
+.LBB1073:
+	.loc 1 2071 29 view .LVU2715
+	.loc 1 2071 66 view .LVU2716
+	.loc 1 2071 108 is_stmt 0 view .LVU2717
+	movl	32(%rbx), %eax
+	andl	$-132120577, %eax
+	.loc 1 2071 133 view .LVU2718
+	orl	$16777216, %eax
+	jmp	.L782
+.LVL777:
+.L733:
+	.loc 1 2071 133 view .LVU2719
+.LBE1073:
+	.loc 1 2074 13 is_stmt 1 view .LVU2720
+.LBB1074:
+	.loc 1 2074 29 view .LVU2721
+	.loc 1 2074 66 view .LVU2722
+.LBE1074:
+	.loc 1 2075 13 view .LVU2723
+.LBB1075:
+	.loc 1 2075 29 view .LVU2724
+	.loc 1 2075 66 view .LVU2725
+	.loc 1 2075 133 is_stmt 0 view .LVU2726
+	movl	32(%rbx), %eax
+	andl	$-132120577, %eax
+	orl	$20972288, %eax
+	jmp	.L782
+.LVL778:
+.L739:
+	.loc 1 2075 133 view .LVU2727
+.LBE1075:
+	.loc 1 2079 13 is_stmt 1 view .LVU2728
+.LBB1076:
+	.loc 1 2079 29 view .LVU2729
+	.loc 1 2079 66 view .LVU2730
+	.loc 1 2079 108 is_stmt 0 view .LVU2731
+	movl	32(%rbx), %eax
+	andl	$-132120577, %eax
+	.loc 1 2079 133 view .LVU2732
+	orl	$20971520, %eax
+	jmp	.L782
+.LVL779:
+.L732:
+	.loc 1 2079 133 view .LVU2733
+.LBE1076:
+	.loc 1 2082 13 is_stmt 1 view .LVU2734
+.LBB1077:
+	.loc 1 2082 29 view .LVU2735
+	.loc 1 2082 66 view .LVU2736
+	.loc 1 2082 108 is_stmt 0 view .LVU2737
+	movl	32(%rbx), %eax
+	andl	$-132120577, %eax
+	.loc 1 2082 133 view .LVU2738
+	orl	$33554432, %eax
+	jmp	.L782
+.LVL780:
+.L741:
+	.loc 1 2082 133 view .LVU2739
+.LBE1077:
+	.loc 1 2085 13 is_stmt 1 view .LVU2740
+.LBB1078:
+	.loc 1 2085 29 view .LVU2741
+	.loc 1 2085 66 view .LVU2742
+	.loc 1 2085 105 is_stmt 0 view .LVU2743
+	movl	32(%rbx), %eax
+	andb	$-29, %ah
+	.loc 1 2085 127 view .LVU2744
+	orb	$8, %ah
+	jmp	.L782
+.LVL781:
+.L736:
+	.loc 1 2085 127 view .LVU2745
+.LBE1078:
+	.loc 1 2088 13 is_stmt 1 view .LVU2746
+.LBB1079:
+	.loc 1 2088 29 view .LVU2747
+	.loc 1 2088 66 view .LVU2748
+.LBE1079:
+	.loc 1 2089 13 view .LVU2749
+	.loc 1 2089 29 view .LVU2750
+	.loc 1 2089 66 view .LVU2751
+	.loc 1 2090 13 view .LVU2752
+	.loc 1 2090 20 is_stmt 0 view .LVU2753
+	movl	32(%rbx), %eax
+	andl	$-132127745, %eax
+	xorl	$33557505, %eax
+	jmp	.L782
+.LVL782:
+.L734:
+	.loc 1 2093 13 is_stmt 1 view .LVU2754
+.LBB1080:
+	.loc 1 2093 29 view .LVU2755
+	.loc 1 2093 66 view .LVU2756
+	.loc 1 2093 105 is_stmt 0 view .LVU2757
+	movl	32(%rbx), %eax
+	andb	$-29, %ah
+	.loc 1 2093 127 view .LVU2758
+	orb	$16, %ah
+	jmp	.L782
+.LVL783:
+.L738:
+	.loc 1 2093 127 view .LVU2759
+.LBE1080:
+	.loc 1 2096 13 is_stmt 1 view .LVU2760
+.LBB1081:
+	.loc 1 2096 29 view .LVU2761
+	.loc 1 2096 66 view .LVU2762
+	.loc 1 2096 105 is_stmt 0 view .LVU2763
+	movl	32(%rbx), %eax
+	andb	$-29, %ah
+	.loc 1 2096 127 view .LVU2764
+	orb	$20, %ah
+	jmp	.L782
+.LVL784:
+.L740:
+	.loc 1 2096 127 view .LVU2765
+.LBE1081:
+	.loc 1 2099 13 is_stmt 1 view .LVU2766
+.LBB1082:
+	.loc 1 2099 29 view .LVU2767
+	.loc 1 2099 66 view .LVU2768
+.LBE1082:
+	.loc 1 2100 13 view .LVU2769
+.LBB1083:
+	.loc 1 2100 29 view .LVU2770
+	.loc 1 2100 66 view .LVU2771
+	.loc 1 2100 133 is_stmt 0 view .LVU2772
+	movl	32(%rbx), %eax
+	andl	$-132127745, %eax
+	orl	$67109888, %eax
+	jmp	.L782
+.LVL785:
+.L796:
+	.loc 1 2100 133 view .LVU2773
+.LBE1083:
+	.loc 1 2108 9 is_stmt 1 view .LVU2774
+	.loc 1 2108 12 is_stmt 0 view .LVU2775
+	cmpl	$25, %edx
+	jbe	.L750
+.LVL786:
+.L720:
+	.loc 1 2114 5 is_stmt 1 view .LVU2776
+	.loc 1 2114 8 is_stmt 0 view .LVU2777
+	cmpl	$2147483647, 24(%rbx)
+	jne	.L698
+	.loc 1 2115 9 is_stmt 1 view .LVU2778
+	.loc 1 2115 18 is_stmt 0 view .LVU2779
+	xorl	%eax, %eax
+	movl	%eax, 24(%rbx)
+.L698:
+	.loc 1 2118 4 is_stmt 1 view .LVU2780
+	.loc 1 2118 9 is_stmt 0 view .LVU2781
+	movl	32(%rbx), %edx
+	.loc 1 2118 36 view .LVU2782
+	movl	$18, %ecx
+	.loc 1 2118 16 view .LVU2783
+	movl	%edx, %eax
+	shrl	$13, %eax
+	.loc 1 2118 29 view .LVU2784
+	andl	$7, %eax
+	.loc 1 2118 36 view .LVU2785
+	btq	%rax, %rcx
+	jc	.L752
+	.loc 1 2118 13 is_stmt 1 discriminator 1 view .LVU2786
+	leaq	__PRETTY_FUNCTION__.5(%rip), %rcx
+	movl	$2118, %edx
+	leaq	.LC11(%rip), %rsi
+	leaq	.LC16(%rip), %rdi
+	call	__assert_fail@PLT
+.LVL787:
+.L752:
+	.loc 1 2121 5 view .LVU2787
+	.loc 1 2121 8 is_stmt 0 view .LVU2788
+	andb	$16, %dl
+	.loc 1 2122 16 view .LVU2789
+	movl	$1, %eax
+	.loc 1 2121 8 view .LVU2790
+	jne	.L668
+.L711:
+	.loc 1 2127 5 is_stmt 1 view .LVU2791
+	.loc 1 2127 8 is_stmt 0 view .LVU2792
+	movl	32(%rbx), %eax
+	shrl	$5, %eax
+	andl	$2, %eax
+	jmp	.L668
+.LVL788:
+.L674:
+.LDL3:
+	.loc 1 2134 5 is_stmt 1 view .LVU2793
+	.loc 1 2135 5 view .LVU2794
+	.loc 1 2136 12 is_stmt 0 view .LVU2795
+	andl	$939524224, 32(%rbx)
+	.loc 1 2134 14 view .LVU2796
+	movl	$2147483647, %eax
+	salq	$32, %rax
+	movq	%rax, 24(%rbx)
+	.loc 1 2136 5 is_stmt 1 view .LVU2797
+	.loc 1 2138 5 view .LVU2798
+	.loc 1 2131 12 is_stmt 0 view .LVU2799
+	xorl	%eax, %eax
+.LVL789:
+.L668:
+	.loc 1 2139 1 view .LVU2800
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL790:
+	.loc 1 2139 1 view .LVU2801
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL791:
+	.loc 1 2139 1 view .LVU2802
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE602:
+	.size	parse_format, .-parse_format
+	.type	ensure_init, @function
+ensure_init:
+.LVL792:
+.LFB605:
+	.loc 1 2181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2182 5 view .LVU2804
+	.loc 1 2181 1 is_stmt 0 view .LVU2805
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 2182 5 view .LVU2806
+	movq	%rdi, 8(%rsp)
+	call	ensure_init_stream
+.LVL793:
+	.loc 1 2185 5 is_stmt 1 view .LVU2807
+	.loc 1 2185 8 is_stmt 0 view .LVU2808
+	movq	8(%rsp), %rdi
+	testb	$-32, 33(%rdi)
+	jne	.L797
+	.loc 1 2186 9 is_stmt 1 view .LVU2809
+	.loc 1 2188 1 is_stmt 0 view .LVU2810
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	.loc 1 2186 9 view .LVU2811
+	jmp	parse_format
+.LVL794:
+.L797:
+	.cfi_restore_state
+	.loc 1 2188 1 view .LVU2812
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE605:
+	.size	ensure_init, .-ensure_init
+	.type	xprintf_ull, @function
+xprintf_ull:
+.LVL795:
+.LFB608:
+	.loc 1 2232 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2233 5 view .LVU2814
+.LBB1089:
+	.loc 1 2233 4 view .LVU2815
+.LBE1089:
+	.loc 1 2232 1 is_stmt 0 view .LVU2816
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+.LBB1095:
+	.loc 1 2233 21 view .LVU2817
+	movl	32(%rdi), %r13d
+	andl	$64, %r13d
+.LVL796:
+	.loc 1 2233 32 is_stmt 1 view .LVU2818
+	call	ensure_init
+.LVL797:
+.L808:
+	.loc 1 2233 48 discriminator 9 view .LVU2819
+	.loc 1 2233 60 discriminator 9 view .LVU2820
+	.loc 1 2233 65 discriminator 9 view .LVU2821
+	.loc 1 2233 69 is_stmt 0 discriminator 9 view .LVU2822
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL798:
+	.loc 1 2233 68 discriminator 9 view .LVU2823
+	testb	%al, %al
+	je	.L807
+	.loc 1 2233 12 discriminator 2 view .LVU2824
+	movl	32(%rbx), %eax
+	.loc 1 2233 94 discriminator 2 view .LVU2825
+	testb	$32, %al
+	jne	.L807
+	.loc 1 2233 38 is_stmt 1 view .LVU2826
+.LVL799:
+.LBB1090:
+.LBI1090:
+	.loc 1 1703 13 view .LVU2827
+.LBB1091:
+	.loc 1 1705 5 view .LVU2828
+	.loc 1 1711 5 view .LVU2829
+	.loc 1 1711 20 is_stmt 0 view .LVU2830
+	movl	%eax, %edx
+	shrl	$10, %edx
+	.loc 1 1711 33 view .LVU2831
+	andl	$7, %edx
+	.loc 1 1711 8 view .LVU2832
+	cmpl	$4, %edx
+	jne	.L802
+	.loc 1 1712 9 is_stmt 1 view .LVU2833
+	.loc 1 1712 35 is_stmt 0 view .LVU2834
+	leal	-1(%r12), %eax
+	.loc 1 1712 9 view .LVU2835
+	leaq	type_name.3(%rip), %rdx
+	movq	(%rdx,%rax,8), %rsi
+	call	render_rawstr
+.LVL800:
+	.loc 1 1713 9 is_stmt 1 view .LVU2836
+	jmp	.L807
+.L802:
+	.loc 1 1716 5 view .LVU2837
+	.loc 1 1716 24 is_stmt 0 view .LVU2838
+	shrl	$19, %eax
+	movzwl	%bp, %esi
+	.loc 1 1716 37 view .LVU2839
+	andl	$3, %eax
+	.loc 1 1716 5 view .LVU2840
+	cmpl	$1, %eax
+	je	.L805
+	movzbl	%bpl, %esi
+	cmpl	$2, %eax
+	cmovne	%rbp, %rsi
+.L805:
+.LVL801:
+	.loc 1 1721 5 is_stmt 1 view .LVU2841
+	.loc 1 1721 8 is_stmt 0 view .LVU2842
+	cmpl	$2, %edx
+	jne	.L806
+	.loc 1 1722 9 is_stmt 1 view .LVU2843
+.LVL802:
+.LBB1092:
+.LBB1093:
+	.loc 1 1700 50 is_stmt 0 view .LVU2844
+	leal	-1(%r12), %eax
+	.loc 1 1700 43 view .LVU2845
+	leaq	vtab.2(%rip), %rdx
+	movq	%rsi, 8(%rsp)
+.LVL803:
+	.loc 1 1700 43 view .LVU2846
+.LBE1093:
+.LBI1092:
+	.loc 1 1689 13 is_stmt 1 view .LVU2847
+.LBB1094:
+	.loc 1 1694 5 view .LVU2848
+	.loc 1 1700 5 view .LVU2849
+	movq	%rbx, %rdi
+	.loc 1 1700 43 is_stmt 0 view .LVU2850
+	movq	(%rdx,%rax,8), %rax
+	.loc 1 1700 5 view .LVU2851
+	leaq	16(%rsp), %rsi
+.LVL804:
+	.loc 1 1700 43 view .LVU2852
+	movq	%rax, 16(%rsp)
+	leaq	8(%rsp), %rax
+.LVL805:
+	.loc 1 1700 43 view .LVU2853
+	movq	%rax, 24(%rsp)
+	.loc 1 1700 5 view .LVU2854
+	call	render_iter_algo
+.LVL806:
+	.loc 1 1700 5 view .LVU2855
+.LBE1094:
+.LBE1092:
+	.loc 1 1723 9 is_stmt 1 view .LVU2856
+	jmp	.L807
+.LVL807:
+.L806:
+	.loc 1 1725 5 view .LVU2857
+	xorl	%ecx, %ecx
+	movl	$10, %edx
+	movq	%rbx, %rdi
+	call	render_int
+.LVL808:
+.L807:
+	.loc 1 1725 5 is_stmt 0 view .LVU2858
+.LBE1091:
+.LBE1090:
+	.loc 1 2233 98 is_stmt 1 discriminator 7 view .LVU2859
+	.loc 1 2233 91 discriminator 7 view .LVU2860
+	.loc 1 2233 74 is_stmt 0 discriminator 7 view .LVU2861
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL809:
+	.loc 1 2233 91 discriminator 7 view .LVU2862
+	cmpl	$1, %eax
+	ja	.L807
+	.loc 1 2233 109 is_stmt 1 discriminator 8 view .LVU2863
+	testl	%eax, %eax
+	jne	.L808
+	.loc 1 2233 113 discriminator 10 view .LVU2864
+	.loc 1 2233 116 is_stmt 0 discriminator 10 view .LVU2865
+	testl	%r13d, %r13d
+	je	.L809
+	.loc 1 2233 125 is_stmt 1 discriminator 11 view .LVU2866
+	movq	%rbx, %rdi
+	call	finish
+.LVL810:
+.L809:
+	.loc 1 2233 125 is_stmt 0 discriminator 11 view .LVU2867
+.LBE1095:
+	.loc 1 2233 7 is_stmt 1 discriminator 13 view .LVU2868
+	.loc 1 2234 5 discriminator 13 view .LVU2869
+	.loc 1 2235 1 is_stmt 0 discriminator 13 view .LVU2870
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL811:
+	.loc 1 2235 1 discriminator 13 view .LVU2871
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL812:
+	.loc 1 2235 1 discriminator 13 view .LVU2872
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL813:
+	.loc 1 2235 1 discriminator 13 view .LVU2873
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL814:
+	.loc 1 2235 1 discriminator 13 view .LVU2874
+	ret
+	.cfi_endproc
+.LFE608:
+	.size	xprintf_ull, .-xprintf_ull
+	.section	.rodata.str1.1
+.LC17:
+	.string	"true"
+.LC18:
+	.string	"false"
+.LC19:
+	.string	"bool"
+	.text
+	.type	xprintf_bool, @function
+xprintf_bool:
+.LVL815:
+.LFB609:
+	.loc 1 2238 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2239 5 view .LVU2876
+.LBB1099:
+	.loc 1 2239 4 view .LVU2877
+.LBE1099:
+	.loc 1 2238 1 is_stmt 0 view .LVU2878
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	leaq	.LC17(%rip), %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+.LBB1102:
+	.loc 1 2239 21 view .LVU2879
+	movl	32(%rdi), %r12d
+	andl	$64, %r12d
+.LVL816:
+	.loc 1 2239 32 is_stmt 1 view .LVU2880
+	call	ensure_init
+.LVL817:
+	.loc 1 2239 32 is_stmt 0 view .LVU2881
+	testq	%rbp, %rbp
+	leaq	.LC18(%rip), %rax
+	cmove	%rax, %r13
+.L824:
+	.loc 1 2239 48 is_stmt 1 discriminator 9 view .LVU2882
+	.loc 1 2239 60 discriminator 9 view .LVU2883
+	.loc 1 2239 65 discriminator 9 view .LVU2884
+	.loc 1 2239 69 is_stmt 0 discriminator 9 view .LVU2885
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL818:
+	.loc 1 2239 68 discriminator 9 view .LVU2886
+	testb	%al, %al
+	je	.L823
+	.loc 1 2239 12 discriminator 2 view .LVU2887
+	movl	32(%rbx), %eax
+	.loc 1 2239 94 discriminator 2 view .LVU2888
+	testb	$32, %al
+	jne	.L823
+	.loc 1 2239 38 is_stmt 1 view .LVU2889
+.LVL819:
+.LBB1100:
+.LBI1100:
+	.loc 1 1728 13 view .LVU2890
+.LBB1101:
+	.loc 1 1730 5 view .LVU2891
+	.loc 1 1730 20 is_stmt 0 view .LVU2892
+	movl	%eax, %edx
+	.loc 1 1731 9 view .LVU2893
+	leaq	.LC19(%rip), %rsi
+	.loc 1 1730 20 view .LVU2894
+	shrl	$10, %edx
+	.loc 1 1730 33 view .LVU2895
+	andl	$7, %edx
+	.loc 1 1730 8 view .LVU2896
+	cmpl	$4, %edx
+	je	.L835
+	.loc 1 1734 5 is_stmt 1 view .LVU2897
+	.loc 1 1734 20 is_stmt 0 view .LVU2898
+	shrl	$21, %eax
+	.loc 1 1734 8 view .LVU2899
+	testb	$62, %al
+	je	.L822
+	.loc 1 1735 9 is_stmt 1 view .LVU2900
+	xorl	%ecx, %ecx
+	movl	$10, %edx
+	movq	%rbp, %rsi
+	call	render_int
+.LVL820:
+	.loc 1 1736 9 view .LVU2901
+	jmp	.L823
+.L822:
+	.loc 1 1738 5 view .LVU2902
+	movq	%r13, %rsi
+.L835:
+	.loc 1 1738 5 is_stmt 0 view .LVU2903
+	call	render_rawstr
+.LVL821:
+.L823:
+	.loc 1 1738 5 view .LVU2904
+.LBE1101:
+.LBE1100:
+	.loc 1 2239 95 is_stmt 1 discriminator 7 view .LVU2905
+	.loc 1 2239 88 discriminator 7 view .LVU2906
+	.loc 1 2239 71 is_stmt 0 discriminator 7 view .LVU2907
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL822:
+	.loc 1 2239 88 discriminator 7 view .LVU2908
+	cmpl	$1, %eax
+	ja	.L823
+	.loc 1 2239 106 is_stmt 1 discriminator 8 view .LVU2909
+	testl	%eax, %eax
+	jne	.L824
+	.loc 1 2239 110 discriminator 10 view .LVU2910
+	.loc 1 2239 113 is_stmt 0 discriminator 10 view .LVU2911
+	testl	%r12d, %r12d
+	je	.L825
+	.loc 1 2239 122 is_stmt 1 discriminator 11 view .LVU2912
+	movq	%rbx, %rdi
+	call	finish
+.LVL823:
+.L825:
+	.loc 1 2239 122 is_stmt 0 discriminator 11 view .LVU2913
+.LBE1102:
+	.loc 1 2239 7 is_stmt 1 discriminator 13 view .LVU2914
+	.loc 1 2240 5 discriminator 13 view .LVU2915
+	.loc 1 2241 1 is_stmt 0 discriminator 13 view .LVU2916
+	popq	%rdx
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL824:
+	.loc 1 2241 1 discriminator 13 view .LVU2917
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL825:
+	.loc 1 2241 1 discriminator 13 view .LVU2918
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL826:
+	.loc 1 2241 1 discriminator 13 view .LVU2919
+	popq	%r13
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE609:
+	.size	xprintf_bool, .-xprintf_bool
+	.type	xprintf_sll, @function
+xprintf_sll:
+.LVL827:
+.LFB607:
+	.loc 1 2226 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2227 5 view .LVU2921
+.LBB1108:
+	.loc 1 2227 4 view .LVU2922
+.LBE1108:
+	.loc 1 2226 1 is_stmt 0 view .LVU2923
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%edx, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 80
+.LBB1119:
+	.loc 1 2227 21 view .LVU2924
+	movl	32(%rdi), %r13d
+	andl	$64, %r13d
+.LVL828:
+	.loc 1 2227 32 is_stmt 1 view .LVU2925
+	call	ensure_init
+.LVL829:
+.L846:
+	.loc 1 2227 48 discriminator 9 view .LVU2926
+	.loc 1 2227 60 discriminator 9 view .LVU2927
+	.loc 1 2227 65 discriminator 9 view .LVU2928
+	.loc 1 2227 69 is_stmt 0 discriminator 9 view .LVU2929
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL830:
+	.loc 1 2227 68 discriminator 9 view .LVU2930
+	testb	%al, %al
+	je	.L845
+	.loc 1 2227 12 discriminator 2 view .LVU2931
+	movl	32(%rbx), %eax
+	.loc 1 2227 83 discriminator 2 view .LVU2932
+	testb	$32, %al
+	jne	.L845
+	.loc 1 2227 38 is_stmt 1 view .LVU2933
+.LVL831:
+.LBB1109:
+.LBI1109:
+	.loc 1 1741 13 view .LVU2934
+.LBB1110:
+	.loc 1 1743 5 view .LVU2935
+	.loc 1 1749 5 view .LVU2936
+	.loc 1 1749 20 is_stmt 0 view .LVU2937
+	movl	%eax, %edi
+	shrl	$10, %edi
+	.loc 1 1749 33 view .LVU2938
+	andl	$7, %edi
+	.loc 1 1749 8 view .LVU2939
+	cmpl	$4, %edi
+	jne	.L838
+	.loc 1 1750 9 is_stmt 1 view .LVU2940
+	.loc 1 1750 35 is_stmt 0 view .LVU2941
+	leal	-1(%r12), %eax
+	.loc 1 1750 9 view .LVU2942
+	leaq	type_name.1(%rip), %rdx
+	movq	%rbx, %rdi
+	movq	(%rdx,%rax,8), %rsi
+	call	render_rawstr
+.LVL832:
+	.loc 1 1751 9 is_stmt 1 view .LVU2943
+	jmp	.L845
+.L838:
+	.loc 1 1754 5 view .LVU2944
+	.loc 1 1754 24 is_stmt 0 view .LVU2945
+	movl	%eax, %edx
+	shrl	$19, %edx
+	.loc 1 1754 37 view .LVU2946
+	andl	$3, %edx
+	.loc 1 1754 5 view .LVU2947
+	cmpl	$1, %edx
+	je	.L839
+	cmpl	$2, %edx
+	jne	.L848
+	.loc 1 1756 9 is_stmt 1 view .LVU2948
+	.loc 1 1756 11 is_stmt 0 view .LVU2949
+	movsbq	%bpl, %rsi
+.LVL833:
+	.loc 1 1757 9 is_stmt 1 view .LVU2950
+	.loc 1 1758 9 view .LVU2951
+	.loc 1 1757 12 is_stmt 0 view .LVU2952
+	movl	$1, %edx
+	.loc 1 1758 9 view .LVU2953
+	jmp	.L840
+.LVL834:
+.L839:
+	.loc 1 1760 9 is_stmt 1 view .LVU2954
+	.loc 1 1760 11 is_stmt 0 view .LVU2955
+	movswq	%bp, %rsi
+.LVL835:
+	.loc 1 1761 9 is_stmt 1 view .LVU2956
+	.loc 1 1762 9 view .LVU2957
+	.loc 1 1761 12 is_stmt 0 view .LVU2958
+	movl	$2, %edx
+	.loc 1 1762 9 view .LVU2959
+	jmp	.L840
+.LVL836:
+.L848:
+	.loc 1 1754 5 view .LVU2960
+	movl	%r12d, %edx
+	movq	%rbp, %rsi
+.LVL837:
+.L840:
+	.loc 1 1765 5 is_stmt 1 view .LVU2961
+	.loc 1 1766 5 view .LVU2962
+	.loc 1 1767 5 view .LVU2963
+	.loc 1 1767 20 is_stmt 0 view .LVU2964
+	shrl	$8, %eax
+	.loc 1 1767 32 view .LVU2965
+	andl	$3, %eax
+	.loc 1 1767 8 view .LVU2966
+	cmpl	$3, %eax
+	jne	.L841
+	.loc 1 1768 9 is_stmt 1 view .LVU2967
+	.loc 1 1768 44 is_stmt 0 view .LVU2968
+	movl	$8, %eax
+	subl	%edx, %eax
+	.loc 1 1768 21 view .LVU2969
+	leal	0(,%rax,8), %ecx
+	orq	$-1, %rax
+	shrq	%cl, %rax
+	.loc 1 1766 19 view .LVU2970
+	xorl	%ecx, %ecx
+	.loc 1 1768 12 view .LVU2971
+	andq	%rax, %rsi
+.LVL838:
+	.loc 1 1768 12 view .LVU2972
+	jmp	.L842
+.LVL839:
+.L841:
+	.loc 1 1770 10 is_stmt 1 view .LVU2973
+	.loc 1 1771 17 is_stmt 0 view .LVU2974
+	movb	$45, %cl
+	.loc 1 1770 13 view .LVU2975
+	testq	%rsi, %rsi
+	js	.L842
+	.loc 1 1773 10 is_stmt 1 view .LVU2976
+	.loc 1 1773 13 is_stmt 0 view .LVU2977
+	jne	.L843
+	.loc 1 1766 19 view .LVU2978
+	xorl	%ecx, %ecx
+	.loc 1 1773 23 view .LVU2979
+	cmpl	$0, 28(%rbx)
+	je	.L842
+.L843:
+	.loc 1 1776 10 is_stmt 1 view .LVU2980
+	.loc 1 1777 17 is_stmt 0 view .LVU2981
+	movb	$43, %cl
+	.loc 1 1776 13 view .LVU2982
+	cmpl	$2, %eax
+	je	.L842
+	.loc 1 1779 10 is_stmt 1 view .LVU2983
+	.loc 1 1779 13 is_stmt 0 view .LVU2984
+	movl	%eax, %ecx
+	sall	$5, %ecx
+.LVL840:
+.L842:
+	.loc 1 1783 5 is_stmt 1 view .LVU2985
+	.loc 1 1783 8 is_stmt 0 view .LVU2986
+	cmpl	$2, %edi
+	jne	.L844
+	.loc 1 1784 9 is_stmt 1 view .LVU2987
+.LVL841:
+	.loc 1 1785 9 view .LVU2988
+	.loc 1 1784 44 is_stmt 0 view .LVU2989
+	movl	$8, %eax
+.LBB1111:
+.LBB1112:
+	.loc 1 1700 5 view .LVU2990
+	movq	%rbx, %rdi
+.LBE1112:
+.LBE1111:
+	.loc 1 1784 44 view .LVU2991
+	subl	%edx, %eax
+.LBB1116:
+.LBB1113:
+	.loc 1 1700 50 view .LVU2992
+	decl	%edx
+.LVL842:
+	.loc 1 1700 50 view .LVU2993
+.LBE1113:
+.LBE1116:
+	.loc 1 1784 21 view .LVU2994
+	leal	0(,%rax,8), %ecx
+.LVL843:
+	.loc 1 1784 21 view .LVU2995
+	orq	$-1, %rax
+	shrq	%cl, %rax
+	.loc 1 1784 12 view .LVU2996
+	andq	%rsi, %rax
+.LBB1117:
+.LBB1114:
+	.loc 1 1700 5 view .LVU2997
+	leaq	16(%rsp), %rsi
+.LBE1114:
+.LBE1117:
+	.loc 1 1784 12 view .LVU2998
+	movq	%rax, 8(%rsp)
+.LVL844:
+.LBB1118:
+.LBI1111:
+	.loc 1 1689 13 is_stmt 1 view .LVU2999
+.LBB1115:
+	.loc 1 1694 5 view .LVU3000
+	.loc 1 1700 5 view .LVU3001
+	.loc 1 1700 43 is_stmt 0 view .LVU3002
+	leaq	vtab.2(%rip), %rax
+.LVL845:
+	.loc 1 1700 43 view .LVU3003
+	movq	(%rax,%rdx,8), %rax
+	movq	%rax, 16(%rsp)
+	leaq	8(%rsp), %rax
+.LVL846:
+	.loc 1 1700 43 view .LVU3004
+	movq	%rax, 24(%rsp)
+	.loc 1 1700 5 view .LVU3005
+	call	render_iter_algo
+.LVL847:
+	.loc 1 1700 5 view .LVU3006
+.LBE1115:
+.LBE1118:
+	.loc 1 1786 9 is_stmt 1 view .LVU3007
+	jmp	.L845
+.LVL848:
+.L844:
+	.loc 1 1789 5 view .LVU3008
+	movzbl	%cl, %ecx
+	.loc 1 1789 5 is_stmt 0 view .LVU3009
+	movl	$10, %edx
+.LVL849:
+	.loc 1 1789 5 view .LVU3010
+	movq	%rbx, %rdi
+	call	render_int
+.LVL850:
+.L845:
+	.loc 1 1789 5 view .LVU3011
+.LBE1110:
+.LBE1109:
+	.loc 1 2227 98 is_stmt 1 discriminator 7 view .LVU3012
+	.loc 1 2227 91 discriminator 7 view .LVU3013
+	.loc 1 2227 74 is_stmt 0 discriminator 7 view .LVU3014
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL851:
+	.loc 1 2227 91 discriminator 7 view .LVU3015
+	cmpl	$1, %eax
+	ja	.L845
+	.loc 1 2227 109 is_stmt 1 discriminator 8 view .LVU3016
+	testl	%eax, %eax
+	jne	.L846
+	.loc 1 2227 113 discriminator 10 view .LVU3017
+	.loc 1 2227 116 is_stmt 0 discriminator 10 view .LVU3018
+	testl	%r13d, %r13d
+	je	.L847
+	.loc 1 2227 125 is_stmt 1 discriminator 11 view .LVU3019
+	movq	%rbx, %rdi
+	call	finish
+.LVL852:
+.L847:
+	.loc 1 2227 125 is_stmt 0 discriminator 11 view .LVU3020
+.LBE1119:
+	.loc 1 2227 7 is_stmt 1 discriminator 13 view .LVU3021
+	.loc 1 2228 5 discriminator 13 view .LVU3022
+	.loc 1 2229 1 is_stmt 0 discriminator 13 view .LVU3023
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL853:
+	.loc 1 2229 1 discriminator 13 view .LVU3024
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL854:
+	.loc 1 2229 1 discriminator 13 view .LVU3025
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL855:
+	.loc 1 2229 1 discriminator 13 view .LVU3026
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL856:
+	.loc 1 2229 1 discriminator 13 view .LVU3027
+	ret
+	.cfi_endproc
+.LFE607:
+	.size	xprintf_sll, .-xprintf_sll
+	.type	format_scan, @function
+format_scan:
+.LVL857:
+.LFB613:
+	.loc 1 2376 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2377 5 view .LVU3029
+	.loc 1 2376 1 is_stmt 0 view .LVU3030
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 2380 14 view .LVU3031
+	xorl	%r12d, %r12d
+	.loc 1 2376 1 view .LVU3032
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$168, %rsp
+	.cfi_def_cfa_offset 224
+	.loc 1 2377 20 view .LVU3033
+	movq	8(%rdi), %rax
+	movq	%rax, 64(%rsp)
+	movq	(%rdi), %rax
+	movq	%rax, 72(%rsp)
+	.loc 1 2378 5 is_stmt 1 view .LVU3034
+.LVL858:
+	.loc 1 2379 5 view .LVU3035
+	.loc 1 2380 5 view .LVU3036
+	.loc 1 2378 12 is_stmt 0 view .LVU3037
+	xorl	%eax, %eax
+	movq	%rax, 8(%rsp)
+	movq	%rax, (%rsp)
+.LVL859:
+.L862:
+	.loc 1 2381 5 is_stmt 1 view .LVU3038
+.LBB1138:
+	.loc 1 2382 9 view .LVU3039
+	.loc 1 2382 48 is_stmt 0 view .LVU3040
+	movq	72(%rsp), %rdx
+	.loc 1 2382 53 view .LVU3041
+	movq	%rdx, %r13
+	subq	(%rbx), %r13
+.LVL860:
+	.loc 1 2383 9 is_stmt 1 view .LVU3042
+	.loc 1 2383 12 is_stmt 0 view .LVU3043
+	cmpq	%r13, (%rsp)
+	je	.L863
+	.loc 1 2383 30 discriminator 1 view .LVU3044
+	testl	%r12d, %r12d
+	je	.L864
+	.loc 1 2383 47 discriminator 2 view .LVU3045
+	testb	$1, %r12b
+	je	.L863
+.L885:
+.LBB1139:
+	.loc 1 2387 13 is_stmt 1 view .LVU3046
+.LVL861:
+.LBB1140:
+.LBI1140:
+	.loc 1 2337 15 view .LVU3047
+.LBB1141:
+	.loc 1 2339 5 view .LVU3048
+	.loc 1 2339 17 is_stmt 0 view .LVU3049
+	xorl	%eax, %eax
+	leaq	120(%rsp), %rdi
+	movl	$10, %ecx
+	.loc 1 2340 11 view .LVU3050
+	movq	8(%rbx), %rdx
+	.loc 1 2339 17 view .LVU3051
+	rep stosl
+	leaq	format_scratch_vtab(%rip), %rax
+	.loc 1 2341 11 view .LVU3052
+	leaq	96(%rsp), %rdi
+	.loc 1 2339 17 view .LVU3053
+	movq	%rax, 96(%rsp)
+	.loc 1 2340 5 is_stmt 1 view .LVU3054
+	.loc 1 2340 62 is_stmt 0 view .LVU3055
+	movq	8(%rsp), %rax
+	addq	(%rbx), %rax
+	.loc 1 2340 11 view .LVU3056
+	movq	%rdx, 104(%rsp)
+	movq	%rax, 112(%rsp)
+	.loc 1 2341 5 is_stmt 1 view .LVU3057
+	.loc 1 2341 11 is_stmt 0 view .LVU3058
+	call	parse_format
+.LVL862:
+	.loc 1 2342 5 is_stmt 1 view .LVU3059
+	.loc 1 2342 14 is_stmt 0 view .LVU3060
+	movl	128(%rsp), %edx
+	.loc 1 2342 20 view .LVU3061
+	movl	%edx, %eax
+	shrl	$13, %eax
+	.loc 1 2342 33 view .LVU3062
+	andl	$7, %eax
+	.loc 1 2342 8 view .LVU3063
+	decl	%eax
+	jne	.L864
+	jmp	.L919
+.LVL863:
+.L863:
+	.loc 1 2342 8 view .LVU3064
+.LBE1141:
+.LBE1140:
+.LBE1139:
+	.loc 1 2384 13 is_stmt 1 view .LVU3065
+.LBB1145:
+.LBI1145:
+	.loc 1 2275 13 view .LVU3066
+.LBB1146:
+	.loc 1 2277 5 view .LVU3067
+	.loc 1 2278 5 view .LVU3068
+	.loc 1 2278 20 is_stmt 0 view .LVU3069
+	movq	8(%rbx), %rax
+	.loc 1 2279 12 view .LVU3070
+	leaq	96(%rsp), %rdi
+	movl	$8, %ecx
+	.loc 1 2280 12 view .LVU3071
+	xorl	%r15d, %r15d
+	.loc 1 2278 20 view .LVU3072
+	movq	%rdx, 88(%rsp)
+	.loc 1 2279 5 is_stmt 1 view .LVU3073
+.LBB1147:
+	.loc 1 2283 22 is_stmt 0 view .LVU3074
+	leaq	80(%rsp), %rbp
+.LBE1147:
+	.loc 1 2278 20 view .LVU3075
+	movq	%rax, 80(%rsp)
+	.loc 1 2279 12 view .LVU3076
+	xorl	%eax, %eax
+	rep stosl
+	.loc 1 2280 5 is_stmt 1 view .LVU3077
+.LVL864:
+.L875:
+.LBB1148:
+	.loc 1 2283 29 is_stmt 0 view .LVU3078
+	movq	8(%rbx), %rax
+	movq	%rdx, 16(%rsp)
+.LVL865:
+	.loc 1 2283 29 view .LVU3079
+.LBE1148:
+	.loc 1 2281 5 is_stmt 1 view .LVU3080
+.LBB1149:
+	.loc 1 2282 9 view .LVU3081
+	.loc 1 2283 22 is_stmt 0 view .LVU3082
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	.loc 1 2282 21 view .LVU3083
+	movq	88(%rsp), %r14
+.LVL866:
+	.loc 1 2283 9 is_stmt 1 view .LVU3084
+	.loc 1 2283 22 is_stmt 0 view .LVU3085
+	call	*8(%rax)
+.LVL867:
+	.loc 1 2284 12 view .LVU3086
+	movq	16(%rsp), %rdx
+	.loc 1 2283 22 view .LVU3087
+	movl	%eax, %ecx
+.LVL868:
+	.loc 1 2284 9 is_stmt 1 view .LVU3088
+	.loc 1 2284 22 is_stmt 0 view .LVU3089
+	leal	-1(%rax), %eax
+.LVL869:
+	.loc 1 2284 12 view .LVU3090
+	cmpl	$-3, %eax
+	ja	.L895
+	cmpl	$126, %ecx
+	jne	.L867
+.L895:
+	.loc 1 2285 13 is_stmt 1 view .LVU3091
+	.loc 1 2285 22 is_stmt 0 view .LVU3092
+	movq	%r14, 88(%rsp)
+	.loc 1 2286 13 is_stmt 1 view .LVU3093
+.LBE1149:
+	.loc 1 2297 5 view .LVU3094
+	.loc 1 2297 8 is_stmt 0 view .LVU3095
+	testq	%r15, %r15
+	jne	.L916
+	.loc 1 2297 8 view .LVU3096
+	jmp	.L877
+.L867:
+.LBB1150:
+	.loc 1 2288 9 is_stmt 1 view .LVU3097
+	.loc 1 2288 12 is_stmt 0 view .LVU3098
+	testl	$520093696, %ecx
+	jne	.L877
+	.loc 1 2291 9 is_stmt 1 view .LVU3099
+	.loc 1 2292 13 is_stmt 0 view .LVU3100
+	movq	104(%rsp), %rax
+	.loc 1 2294 13 view .LVU3101
+	movq	112(%rsp), %rsi
+	.loc 1 2291 12 view .LVU3102
+	incq	%r15
+.LVL870:
+	.loc 1 2292 9 is_stmt 1 view .LVU3103
+	.loc 1 2293 28 is_stmt 0 view .LVU3104
+	cmpl	$127, %ecx
+	ja	.L871
+	.loc 1 2292 53 view .LVU3105
+	incq	%rax
+	.loc 1 2294 9 is_stmt 1 view .LVU3106
+	jmp	.L918
+.L871:
+	.loc 1 2293 28 is_stmt 0 view .LVU3107
+	cmpl	$2047, %ecx
+	jbe	.L873
+	cmpl	$65535, %ecx
+	jbe	.L874
+	.loc 1 2292 53 view .LVU3108
+	addq	$4, %rax
+	.loc 1 2294 9 is_stmt 1 view .LVU3109
+	.loc 1 2294 74 is_stmt 0 view .LVU3110
+	movl	$4, %ecx
+.LVL871:
+	.loc 1 2294 74 view .LVU3111
+	jmp	.L872
+.LVL872:
+.L874:
+	.loc 1 2292 53 view .LVU3112
+	addq	$3, %rax
+	.loc 1 2294 9 is_stmt 1 view .LVU3113
+	jmp	.L918
+.L873:
+	.loc 1 2292 53 is_stmt 0 view .LVU3114
+	addq	$2, %rax
+.L918:
+	.loc 1 2294 9 is_stmt 1 view .LVU3115
+	.loc 1 2294 74 is_stmt 0 view .LVU3116
+	movl	$2, %ecx
+.LVL873:
+.L872:
+	.loc 1 2294 53 view .LVU3117
+	addq	%rsi, %rcx
+	.loc 1 2295 53 view .LVU3118
+	addq	$4, 120(%rsp)
+	.loc 1 2292 53 view .LVU3119
+	movq	%rax, 104(%rsp)
+	.loc 1 2294 53 view .LVU3120
+	movq	%rcx, 112(%rsp)
+	.loc 1 2295 9 is_stmt 1 view .LVU3121
+.LBE1150:
+	.loc 1 2281 5 view .LVU3122
+	.loc 1 2281 14 is_stmt 0 view .LVU3123
+	jmp	.L875
+.LVL874:
+.L916:
+	.loc 1 2301 5 is_stmt 1 view .LVU3124
+	.loc 1 2301 10 is_stmt 0 view .LVU3125
+	movq	16(%rbx), %rax
+	.loc 1 2301 8 view .LVU3126
+	testq	%rax, %rax
+	jne	.L876
+.LVL875:
+.L884:
+	.loc 1 2324 5 is_stmt 1 view .LVU3127
+.LBB1151:
+	.loc 1 2326 20 is_stmt 0 view .LVU3128
+	movq	104(%rsp), %rax
+.LBE1151:
+	.loc 1 2324 15 view .LVU3129
+	incq	64(%rbx)
+	.loc 1 2325 5 is_stmt 1 view .LVU3130
+.LBB1152:
+	.loc 1 2325 10 view .LVU3131
+.LVL876:
+	.loc 1 2325 28 view .LVU3132
+	.loc 1 2326 9 view .LVU3133
+	.loc 1 2326 20 is_stmt 0 view .LVU3134
+	addq	%rax, 88(%rbx)
+	.loc 1 2325 34 is_stmt 1 view .LVU3135
+.LVL877:
+	.loc 1 2325 28 view .LVU3136
+	.loc 1 2326 9 view .LVU3137
+	.loc 1 2326 20 is_stmt 0 view .LVU3138
+	movq	112(%rsp), %rax
+	addq	%rax, 96(%rbx)
+	.loc 1 2325 34 is_stmt 1 view .LVU3139
+.LVL878:
+	.loc 1 2325 28 view .LVU3140
+	.loc 1 2326 9 view .LVU3141
+	.loc 1 2326 20 is_stmt 0 view .LVU3142
+	movq	120(%rsp), %rax
+	addq	%rax, 104(%rbx)
+	.loc 1 2325 34 is_stmt 1 view .LVU3143
+.LVL879:
+	.loc 1 2325 28 view .LVU3144
+	jmp	.L877
+.LVL880:
+.L876:
+	.loc 1 2325 28 is_stmt 0 view .LVU3145
+.LBE1152:
+.LBB1153:
+	.loc 1 2302 9 is_stmt 1 view .LVU3146
+	.loc 1 2302 44 is_stmt 0 view .LVU3147
+	imulq	$88, 64(%rbx), %rcx
+.LVL881:
+	.loc 1 2302 31 view .LVU3148
+	addq	%rcx, %rax
+.LVL882:
+	.loc 1 2303 9 is_stmt 1 view .LVU3149
+	.loc 1 2303 17 is_stmt 0 view .LVU3150
+	movq	%r13, (%rax)
+	.loc 1 2304 9 is_stmt 1 view .LVU3151
+	.loc 1 2304 53 is_stmt 0 view .LVU3152
+	movq	88(%rsp), %rcx
+	subq	(%rbx), %rcx
+	.loc 1 2305 18 view .LVU3153
+	movq	%r15, 16(%rax)
+	.loc 1 2304 19 view .LVU3154
+	movq	%rcx, 8(%rax)
+	.loc 1 2305 9 is_stmt 1 view .LVU3155
+	.loc 1 2306 9 view .LVU3156
+.LBB1154:
+	.loc 1 2306 14 view .LVU3157
+.LVL883:
+	.loc 1 2306 32 view .LVU3158
+	.loc 1 2307 13 view .LVU3159
+	.loc 1 2307 35 is_stmt 0 view .LVU3160
+	movq	40(%rbx), %rcx
+	.loc 1 2307 26 view .LVU3161
+	movq	%rcx, 32(%rax)
+	.loc 1 2308 13 is_stmt 1 view .LVU3162
+	.loc 1 2308 32 is_stmt 0 view .LVU3163
+	movq	104(%rsp), %r10
+	.loc 1 2308 26 view .LVU3164
+	movq	%r10, 64(%rax)
+	.loc 1 2306 38 is_stmt 1 view .LVU3165
+.LVL884:
+	.loc 1 2306 32 view .LVU3166
+	.loc 1 2307 13 view .LVU3167
+	.loc 1 2307 35 is_stmt 0 view .LVU3168
+	movq	48(%rbx), %rcx
+	.loc 1 2307 26 view .LVU3169
+	movq	%rcx, 40(%rax)
+	.loc 1 2308 13 is_stmt 1 view .LVU3170
+	.loc 1 2308 32 is_stmt 0 view .LVU3171
+	movq	112(%rsp), %r9
+	.loc 1 2308 26 view .LVU3172
+	movq	%r9, 72(%rax)
+	.loc 1 2306 38 is_stmt 1 view .LVU3173
+.LVL885:
+	.loc 1 2306 32 view .LVU3174
+	.loc 1 2307 13 view .LVU3175
+	.loc 1 2307 35 is_stmt 0 view .LVU3176
+	movq	56(%rbx), %rcx
+	.loc 1 2307 26 view .LVU3177
+	movq	%rcx, 48(%rax)
+	.loc 1 2308 13 is_stmt 1 view .LVU3178
+	.loc 1 2308 32 is_stmt 0 view .LVU3179
+	movq	120(%rsp), %r8
+.LBE1154:
+.LBB1155:
+	.loc 1 2314 21 view .LVU3180
+	xorl	%ecx, %ecx
+.LBE1155:
+.LBB1196:
+	.loc 1 2308 26 view .LVU3181
+	movq	%r8, 80(%rax)
+	.loc 1 2306 38 is_stmt 1 view .LVU3182
+.LVL886:
+	.loc 1 2306 32 view .LVU3183
+.LBE1196:
+	.loc 1 2310 9 view .LVU3184
+	.loc 1 2312 19 is_stmt 0 view .LVU3185
+	movq	56(%rbx), %rax
+.LVL887:
+	.loc 1 2310 15 view .LVU3186
+	movq	40(%rbx), %rbp
+.LVL888:
+	.loc 1 2311 9 is_stmt 1 view .LVU3187
+	.loc 1 2311 19 is_stmt 0 view .LVU3188
+	movq	48(%rbx), %r14
+.LVL889:
+	.loc 1 2312 9 is_stmt 1 view .LVU3189
+	.loc 1 2313 18 is_stmt 0 view .LVU3190
+	movq	%rdx, 88(%rsp)
+	.loc 1 2312 19 view .LVU3191
+	movq	%rax, 16(%rsp)
+.LVL890:
+	.loc 1 2313 9 is_stmt 1 view .LVU3192
+	.loc 1 2314 9 view .LVU3193
+.LBB1197:
+	.loc 1 2314 14 view .LVU3194
+	.loc 1 2314 30 view .LVU3195
+.LBB1156:
+	.loc 1 2315 26 is_stmt 0 view .LVU3196
+	leaq	80(%rsp), %rax
+.LVL891:
+	.loc 1 2315 26 view .LVU3197
+	movq	%rax, 24(%rsp)
+.LVL892:
+.L883:
+	.loc 1 2315 33 view .LVU3198
+	movq	8(%rbx), %rax
+	movq	%rcx, 56(%rsp)
+	.loc 1 2315 26 view .LVU3199
+	xorl	%esi, %esi
+	movq	%r10, 48(%rsp)
+	movq	24(%rsp), %rdi
+	movq	%r9, 40(%rsp)
+	movq	%r8, 32(%rsp)
+.LVL893:
+	.loc 1 2315 13 is_stmt 1 view .LVU3200
+	.loc 1 2315 26 is_stmt 0 view .LVU3201
+	call	*8(%rax)
+.LVL894:
+	.loc 1 2316 13 is_stmt 1 view .LVU3202
+.LBB1157:
+.LBI1157:
+	.loc 2 451 21 view .LVU3203
+.LBB1158:
+	.loc 2 453 5 view .LVU3204
+	.loc 2 453 8 is_stmt 0 view .LVU3205
+	movq	32(%rsp), %r8
+	movq	40(%rsp), %r9
+	cmpl	$127, %eax
+	movq	48(%rsp), %r10
+	movq	56(%rsp), %rcx
+	ja	.L878
+	.loc 2 454 9 is_stmt 1 view .LVU3206
+.LVL895:
+	.loc 2 454 16 is_stmt 0 view .LVU3207
+	movb	%al, 0(%rbp)
+	.loc 2 471 5 is_stmt 1 view .LVU3208
+.LVL896:
+	.loc 2 471 5 is_stmt 0 view .LVU3209
+.LBE1158:
+.LBE1157:
+	.loc 1 2317 13 is_stmt 1 view .LVU3210
+.LBB1167:
+.LBI1167:
+	.loc 2 478 25 view .LVU3211
+.LBB1168:
+	.loc 2 480 5 view .LVU3212
+.LBE1168:
+.LBE1167:
+.LBB1178:
+.LBB1159:
+	.loc 2 454 11 is_stmt 0 view .LVU3213
+	incq	%rbp
+.LVL897:
+	.loc 2 454 11 view .LVU3214
+	jmp	.L879
+.LVL898:
+.L878:
+	.loc 2 456 10 is_stmt 1 view .LVU3215
+	.loc 2 458 33 is_stmt 0 view .LVU3216
+	movl	%eax, %edi
+	.loc 2 457 33 view .LVU3217
+	movl	%eax, %edx
+	.loc 2 458 33 view .LVU3218
+	andl	$63, %edi
+	.loc 2 457 33 view .LVU3219
+	shrl	$6, %edx
+	.loc 2 458 28 view .LVU3220
+	orl	$-128, %edi
+	.loc 2 456 13 view .LVU3221
+	cmpl	$2047, %eax
+	ja	.L880
+	.loc 2 457 9 is_stmt 1 view .LVU3222
+.LVL899:
+	.loc 2 457 28 is_stmt 0 view .LVU3223
+	orl	$-64, %edx
+	.loc 2 458 14 view .LVU3224
+	movb	%dil, 1(%rbp)
+	.loc 2 458 11 view .LVU3225
+	addq	$2, %rbp
+.LVL900:
+	.loc 2 457 28 view .LVU3226
+	movb	%dl, -2(%rbp)
+	.loc 2 458 9 is_stmt 1 view .LVU3227
+.LVL901:
+	.loc 2 471 5 view .LVU3228
+	.loc 2 471 5 is_stmt 0 view .LVU3229
+.LBE1159:
+.LBE1178:
+	.loc 1 2317 13 is_stmt 1 view .LVU3230
+.LBB1179:
+	.loc 2 478 25 view .LVU3231
+.LBB1169:
+	.loc 2 480 5 view .LVU3232
+	jmp	.L879
+.LVL902:
+.L880:
+	.loc 2 480 5 is_stmt 0 view .LVU3233
+.LBE1169:
+.LBE1179:
+.LBB1180:
+.LBB1160:
+	.loc 2 460 10 is_stmt 1 view .LVU3234
+	.loc 2 461 33 is_stmt 0 view .LVU3235
+	movl	%eax, %esi
+	.loc 2 462 40 view .LVU3236
+	andl	$63, %edx
+	.loc 2 461 33 view .LVU3237
+	shrl	$12, %esi
+	.loc 2 462 28 view .LVU3238
+	orl	$-128, %edx
+	.loc 2 460 13 view .LVU3239
+	cmpl	$65535, %eax
+	ja	.L881
+	.loc 2 461 9 is_stmt 1 view .LVU3240
+.LVL903:
+	.loc 2 461 28 is_stmt 0 view .LVU3241
+	orl	$-32, %esi
+	.loc 2 462 14 view .LVU3242
+	movb	%dl, 1(%rbp)
+	.loc 2 463 11 view .LVU3243
+	addq	$3, %rbp
+.LVL904:
+	.loc 2 461 28 view .LVU3244
+	movb	%sil, -3(%rbp)
+	.loc 2 462 9 is_stmt 1 view .LVU3245
+.LVL905:
+	.loc 2 463 9 view .LVU3246
+	.loc 2 463 14 is_stmt 0 view .LVU3247
+	movb	%dil, -1(%rbp)
+	.loc 2 471 5 is_stmt 1 view .LVU3248
+.LVL906:
+	.loc 2 471 5 is_stmt 0 view .LVU3249
+.LBE1160:
+.LBE1180:
+	.loc 1 2317 13 is_stmt 1 view .LVU3250
+.LBB1181:
+	.loc 2 478 25 view .LVU3251
+.LBB1170:
+	.loc 2 480 5 view .LVU3252
+	jmp	.L879
+.LVL907:
+.L881:
+	.loc 2 480 5 is_stmt 0 view .LVU3253
+.LBE1170:
+.LBE1181:
+.LBB1182:
+.LBB1161:
+	.loc 2 466 9 is_stmt 1 view .LVU3254
+	.loc 2 467 41 is_stmt 0 view .LVU3255
+	andl	$63, %esi
+	.loc 2 468 14 view .LVU3256
+	movb	%dl, 2(%rbp)
+.LBE1161:
+.LBE1182:
+.LBB1183:
+.LBB1171:
+	.loc 2 481 11 view .LVU3257
+	leal	-65536(%rax), %edx
+.LBE1171:
+.LBE1183:
+.LBB1184:
+.LBB1162:
+	.loc 2 466 33 view .LVU3258
+	movl	%eax, %r11d
+	.loc 2 467 28 view .LVU3259
+	orl	$-128, %esi
+	.loc 2 466 33 view .LVU3260
+	shrl	$18, %r11d
+	.loc 2 469 14 view .LVU3261
+	movb	%dil, 3(%rbp)
+.LBE1162:
+.LBE1184:
+.LBB1185:
+.LBB1172:
+	.loc 2 483 11 view .LVU3262
+	addq	$4, %r14
+.LVL908:
+	.loc 2 483 11 view .LVU3263
+.LBE1172:
+.LBE1185:
+.LBB1186:
+.LBB1163:
+	.loc 2 467 28 view .LVU3264
+	movb	%sil, 1(%rbp)
+.LBE1163:
+.LBE1186:
+.LBB1187:
+.LBB1173:
+	.loc 2 482 39 view .LVU3265
+	movl	%edx, %esi
+	.loc 2 483 39 view .LVU3266
+	andw	$1023, %dx
+.LBE1173:
+.LBE1187:
+.LBB1188:
+.LBB1164:
+	.loc 2 466 28 view .LVU3267
+	orl	$-16, %r11d
+.LBE1164:
+.LBE1188:
+.LBB1189:
+.LBB1174:
+	.loc 2 482 39 view .LVU3268
+	shrl	$10, %esi
+	.loc 2 483 16 view .LVU3269
+	subw	$9216, %dx
+.LBE1174:
+.LBE1189:
+.LBB1190:
+.LBB1165:
+	.loc 2 466 28 view .LVU3270
+	movb	%r11b, 0(%rbp)
+	.loc 2 467 9 is_stmt 1 view .LVU3271
+.LVL909:
+	.loc 2 468 9 view .LVU3272
+	.loc 2 469 9 view .LVU3273
+	.loc 2 471 5 view .LVU3274
+	.loc 2 471 5 is_stmt 0 view .LVU3275
+.LBE1165:
+.LBE1190:
+	.loc 1 2317 13 is_stmt 1 view .LVU3276
+.LBB1191:
+	.loc 2 478 25 view .LVU3277
+.LBB1175:
+	.loc 2 480 5 view .LVU3278
+	.loc 2 481 9 view .LVU3279
+	.loc 2 482 9 view .LVU3280
+.LBE1175:
+.LBE1191:
+.LBB1192:
+.LBB1166:
+	.loc 2 469 11 is_stmt 0 view .LVU3281
+	addq	$4, %rbp
+.LVL910:
+	.loc 2 469 11 view .LVU3282
+.LBE1166:
+.LBE1192:
+.LBB1193:
+.LBB1176:
+	.loc 2 482 16 view .LVU3283
+	subw	$10240, %si
+	.loc 2 483 16 view .LVU3284
+	movw	%dx, -2(%r14)
+	.loc 2 482 16 view .LVU3285
+	movw	%si, -4(%r14)
+	.loc 2 483 9 is_stmt 1 view .LVU3286
+	jmp	.L882
+.LVL911:
+.L879:
+	.loc 2 486 9 view .LVU3287
+	.loc 2 486 16 is_stmt 0 view .LVU3288
+	movw	%ax, (%r14)
+	.loc 2 486 11 view .LVU3289
+	addq	$2, %r14
+.LVL912:
+.L882:
+	.loc 2 488 5 is_stmt 1 view .LVU3290
+	.loc 2 488 5 is_stmt 0 view .LVU3291
+.LBE1176:
+.LBE1193:
+	.loc 1 2318 13 is_stmt 1 view .LVU3292
+	.loc 1 2318 20 is_stmt 0 view .LVU3293
+	movq	16(%rsp), %rsi
+	movl	%eax, (%rsi,%rcx,4)
+.LBE1156:
+	.loc 1 2314 38 is_stmt 1 view .LVU3294
+	incq	%rcx
+.LVL913:
+	.loc 1 2314 30 view .LVU3295
+	cmpq	%rcx, %r15
+	jne	.L883
+.LVL914:
+	.loc 1 2314 30 is_stmt 0 view .LVU3296
+.LBE1197:
+.LBB1198:
+	.loc 1 2321 13 is_stmt 1 view .LVU3297
+	.loc 1 2321 24 is_stmt 0 view .LVU3298
+	addq	%r10, 40(%rbx)
+	.loc 1 2320 38 is_stmt 1 view .LVU3299
+.LVL915:
+	.loc 1 2320 32 view .LVU3300
+	.loc 1 2321 13 view .LVU3301
+	.loc 1 2321 24 is_stmt 0 view .LVU3302
+	addq	%r9, 48(%rbx)
+	.loc 1 2320 38 is_stmt 1 view .LVU3303
+.LVL916:
+	.loc 1 2320 32 view .LVU3304
+	.loc 1 2321 13 view .LVU3305
+	.loc 1 2321 24 is_stmt 0 view .LVU3306
+	addq	%r8, 56(%rbx)
+	.loc 1 2320 38 is_stmt 1 view .LVU3307
+.LVL917:
+	.loc 1 2320 32 view .LVU3308
+	jmp	.L884
+.LVL918:
+.L877:
+	.loc 1 2320 32 is_stmt 0 view .LVU3309
+.LBE1198:
+.LBE1153:
+.LBE1146:
+.LBE1145:
+	.loc 1 2386 9 is_stmt 1 view .LVU3310
+	.loc 1 2386 12 is_stmt 0 view .LVU3311
+	testb	$1, %r12b
+	jne	.L885
+.L864:
+.LBB1202:
+.LBB1201:
+.LBB1200:
+.LBB1199:
+.LBB1195:
+.LBB1194:
+.LBB1177:
+	.loc 2 486 11 view .LVU3312
+	movq	(%rsp), %rbp
+	jmp	.L886
+.LVL919:
+.L919:
+	.loc 2 486 11 view .LVU3313
+.LBE1177:
+.LBE1194:
+.LBE1195:
+.LBE1199:
+.LBE1200:
+.LBE1201:
+.LBE1202:
+.LBB1203:
+.LBB1144:
+.LBB1143:
+	.loc 1 2342 51 view .LVU3314
+	andl	$939524096, %edx
+	.loc 1 2349 48 view .LVU3315
+	movq	8(%rbx), %rax
+	.loc 1 2342 51 view .LVU3316
+	jne	.L864
+	.loc 1 2349 5 is_stmt 1 view .LVU3317
+	.loc 1 2349 20 is_stmt 0 view .LVU3318
+	movq	%rax, 80(%rsp)
+	.loc 1 2349 76 view .LVU3319
+	movq	(%rbx), %rax
+	.loc 1 2351 13 view .LVU3320
+	leaq	80(%rsp), %rbp
+	.loc 1 2349 76 view .LVU3321
+	addq	%r13, %rax
+	.loc 1 2349 20 view .LVU3322
+	movq	%rax, 88(%rsp)
+	.loc 1 2350 5 is_stmt 1 view .LVU3323
+.L888:
+	.loc 1 2350 21 view .LVU3324
+	.loc 1 2350 29 is_stmt 0 view .LVU3325
+	movq	112(%rsp), %rax
+	.loc 1 2350 21 view .LVU3326
+	cmpq	%rax, 88(%rsp)
+	je	.L920
+	.loc 1 2351 9 is_stmt 1 view .LVU3327
+	.loc 1 2351 20 is_stmt 0 view .LVU3328
+	movq	8(%rbx), %rax
+	.loc 1 2351 13 view .LVU3329
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	*8(%rax)
+.LVL920:
+	.loc 1 2351 12 view .LVU3330
+	cmpl	$126, %eax
+	jne	.L888
+	jmp	.L864
+.L920:
+	.loc 1 2356 5 is_stmt 1 view .LVU3331
+	.loc 1 2356 52 is_stmt 0 view .LVU3332
+	subq	(%rbx), %rax
+	movq	%rax, %rbp
+.LVL921:
+	.loc 1 2357 5 is_stmt 1 view .LVU3333
+	.loc 1 2357 10 is_stmt 0 view .LVU3334
+	movq	24(%rbx), %rax
+.LVL922:
+	.loc 1 2357 8 view .LVU3335
+	testq	%rax, %rax
+	je	.L891
+.LBB1142:
+	.loc 1 2358 9 is_stmt 1 view .LVU3336
+	.loc 1 2358 47 is_stmt 0 view .LVU3337
+	movq	72(%rbx), %rdx
+	salq	$5, %rdx
+	.loc 1 2358 32 view .LVU3338
+	addq	%rdx, %rax
+.LVL923:
+	.loc 1 2359 9 is_stmt 1 view .LVU3339
+	.loc 1 2359 18 is_stmt 0 view .LVU3340
+	movq	%r13, (%rax)
+	.loc 1 2360 9 is_stmt 1 view .LVU3341
+	.loc 1 2360 20 is_stmt 0 view .LVU3342
+	movq	%rbp, 8(%rax)
+	.loc 1 2361 9 is_stmt 1 view .LVU3343
+	.loc 1 2361 22 is_stmt 0 view .LVU3344
+	movl	128(%rsp), %edx
+	.loc 1 2361 19 view .LVU3345
+	movl	%edx, 16(%rax)
+	.loc 1 2362 9 is_stmt 1 view .LVU3346
+	.loc 1 2362 24 is_stmt 0 view .LVU3347
+	movl	120(%rsp), %edx
+	.loc 1 2362 21 view .LVU3348
+	movl	%edx, 20(%rax)
+	.loc 1 2363 9 is_stmt 1 view .LVU3349
+	.loc 1 2363 23 is_stmt 0 view .LVU3350
+	movl	124(%rsp), %edx
+	.loc 1 2363 20 view .LVU3351
+	movl	%edx, 24(%rax)
+.LVL924:
+.L891:
+	.loc 1 2363 20 view .LVU3352
+.LBE1142:
+	.loc 1 2365 5 is_stmt 1 view .LVU3353
+	.loc 1 2365 16 is_stmt 0 view .LVU3354
+	incq	72(%rbx)
+	.loc 1 2366 5 is_stmt 1 view .LVU3355
+.LVL925:
+	.loc 1 2366 5 is_stmt 0 view .LVU3356
+.LBE1143:
+.LBE1144:
+	.loc 1 2388 13 is_stmt 1 view .LVU3357
+	.loc 1 2388 16 is_stmt 0 view .LVU3358
+	testq	%rbp, %rbp
+	je	.L864
+.LVL926:
+.L886:
+	.loc 1 2388 16 view .LVU3359
+.LBE1203:
+	.loc 1 2392 9 is_stmt 1 view .LVU3360
+	.loc 1 2392 29 is_stmt 0 view .LVU3361
+	movq	8(%rbx), %rax
+	.loc 1 2392 22 view .LVU3362
+	leaq	64(%rsp), %rdi
+	xorl	%esi, %esi
+	call	*8(%rax)
+.LVL927:
+	.loc 1 2393 9 is_stmt 1 view .LVU3363
+	.loc 1 2393 22 is_stmt 0 view .LVU3364
+	leal	-1(%rax), %edx
+	.loc 1 2393 12 view .LVU3365
+	cmpl	$-3, %edx
+	ja	.L861
+	.loc 1 2396 9 is_stmt 1 view .LVU3366
+	.loc 1 2396 42 is_stmt 0 view .LVU3367
+	incl	%r12d
+.LVL928:
+	.loc 1 2396 42 view .LVU3368
+	cmpl	$126, %eax
+	je	.L893
+	xorl	%r12d, %r12d
+.LVL929:
+.L893:
+	.loc 1 2396 42 view .LVU3369
+	movq	%r13, 8(%rsp)
+.LVL930:
+	.loc 1 2396 42 view .LVU3370
+	movq	%rbp, (%rsp)
+	jmp	.L862
+.LVL931:
+.L861:
+	.loc 1 2396 42 view .LVU3371
+.LBE1138:
+	.loc 1 2399 1 view .LVU3372
+	addq	$168, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL932:
+	.loc 1 2399 1 view .LVU3373
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL933:
+	.loc 1 2399 1 view .LVU3374
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL934:
+	.loc 1 2399 1 view .LVU3375
+	popq	%r13
+	.cfi_def_cfa_offset 24
+.LVL935:
+	.loc 1 2399 1 view .LVU3376
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE613:
+	.size	format_scan, .-format_scan
+	.section	.rodata.str1.1
+.LC20:
+	.string	"print->print != NULL"
+	.text
+	.type	render_custom, @function
+render_custom:
+.LVL936:
+.LFB589:
+	.loc 1 1421 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 1422 5 view .LVU3378
+	.loc 1 1421 1 is_stmt 0 view .LVU3379
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 1422 23 view .LVU3380
+	xorl	%eax, %eax
+	movl	$22, %ecx
+	.loc 1 1421 1 view .LVU3381
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx
+	subq	$440, %rsp
+	.cfi_def_cfa_offset 496
+	.loc 1 1422 23 view .LVU3382
+	leaq	16(%rsp), %rdi
+.LVL937:
+	.loc 1 1422 23 view .LVU3383
+	rep stosl
+	.loc 1 1422 62 view .LVU3384
+	movq	%rbx, %rdi
+	.loc 1 1422 23 view .LVU3385
+	movq	%rbx, 80(%rsp)
+	.loc 1 1422 62 view .LVU3386
+	call	quotation_get
+.LVL938:
+	.loc 1 1423 16 view .LVU3387
+	movq	56(%rbx), %rdx
+	.loc 1 1428 9 view .LVU3388
+	movq	(%rsi), %rcx
+	.loc 1 1422 23 view .LVU3389
+	movq	%rax, 96(%rsp)
+	.loc 1 1423 5 is_stmt 1 view .LVU3390
+	.loc 1 1423 16 is_stmt 0 view .LVU3391
+	movq	%rdx, 72(%rsp)
+	.loc 1 1424 5 is_stmt 1 view .LVU3392
+	.loc 1 1424 21 is_stmt 0 view .LVU3393
+	movl	24(%rbx), %edx
+	.loc 1 1428 47 view .LVU3394
+	testq	%rcx, %rcx
+	.loc 1 1424 18 view .LVU3395
+	movl	%edx, 16(%rsi)
+	.loc 1 1425 5 is_stmt 1 view .LVU3396
+	.loc 1 1425 20 is_stmt 0 view .LVU3397
+	movl	28(%rbx), %edx
+	.loc 1 1425 17 view .LVU3398
+	movl	%edx, 20(%rsi)
+	.loc 1 1426 5 is_stmt 1 view .LVU3399
+	.loc 1 1426 19 is_stmt 0 view .LVU3400
+	movl	32(%rbx), %edx
+	.loc 1 1426 16 view .LVU3401
+	movl	%edx, 24(%rsi)
+	.loc 1 1428 4 is_stmt 1 view .LVU3402
+	leaq	16(%rsp), %rsi
+.LVL939:
+	.loc 1 1428 4 is_stmt 0 view .LVU3403
+	movq	%rsi, 8(%rsp)
+	.loc 1 1428 47 view .LVU3404
+	jne	.L922
+	.loc 1 1428 24 is_stmt 1 discriminator 1 view .LVU3405
+	leaq	__PRETTY_FUNCTION__.4(%rip), %rcx
+	movl	$1428, %edx
+	leaq	.LC11(%rip), %rsi
+	leaq	.LC20(%rip), %rdi
+	call	__assert_fail@PLT
+.LVL940:
+.L922:
+	.loc 1 1431 5 view .LVU3406
+	.loc 1 1432 5 view .LVU3407
+	.loc 1 1433 9 view .LVU3408
+	.loc 1 1433 12 is_stmt 0 view .LVU3409
+	testq	%rax, %rax
+	je	.L928
+	testb	$1, %dl
+	je	.L923
+.L928:
+	.loc 1 1431 24 view .LVU3410
+	xorl	%eax, %eax
+	jmp	.L925
+.L923:
+	.loc 1 1434 13 is_stmt 1 view .LVU3411
+	.loc 1 1434 16 is_stmt 0 view .LVU3412
+	cmpq	$0, 16(%rax)
+	jne	.L926
+	.loc 1 1434 44 discriminator 1 view .LVU3413
+	cmpq	$0, 48(%rax)
+	jne	.L926
+	.loc 1 1435 17 is_stmt 1 view .LVU3414
+	.loc 1 1435 48 is_stmt 0 view .LVU3415
+	shrl	$10, %edx
+	.loc 1 1435 61 view .LVU3416
+	andl	$7, %edx
+	.loc 1 1435 82 view .LVU3417
+	cmpl	$2, %edx
+	.loc 1 1435 23 view .LVU3418
+	setne	%dl
+	movzbl	%dl, %edx
+	jmp	.L950
+.L926:
+	.loc 1 1438 17 is_stmt 1 view .LVU3419
+	.loc 1 1439 25 is_stmt 0 view .LVU3420
+	xorl	%edi, %edi
+	.loc 1 1438 27 view .LVU3421
+	leaq	custom_needquote_vtab(%rip), %rax
+	.loc 1 1440 17 view .LVU3422
+	movq	%r12, %rsi
+	.loc 1 1439 25 view .LVU3423
+	movq	%rdi, 88(%rsp)
+	.loc 1 1440 17 view .LVU3424
+	movq	8(%rsp), %rdi
+	.loc 1 1438 27 view .LVU3425
+	movq	%rax, 16(%rsp)
+	.loc 1 1439 17 is_stmt 1 view .LVU3426
+	.loc 1 1440 17 view .LVU3427
+	call	*%rcx
+.LVL941:
+	.loc 1 1441 17 view .LVU3428
+	.loc 1 1441 20 is_stmt 0 view .LVU3429
+	cmpq	$0, 88(%rsp)
+	je	.L927
+.L929:
+	.loc 1 1442 21 is_stmt 1 view .LVU3430
+	.loc 1 1442 53 is_stmt 0 view .LVU3431
+	movl	32(%rbx), %eax
+	.loc 1 1442 41 view .LVU3432
+	xorl	%edx, %edx
+	.loc 1 1442 53 view .LVU3433
+	shrl	$10, %eax
+	.loc 1 1442 66 view .LVU3434
+	andl	$7, %eax
+	.loc 1 1442 41 view .LVU3435
+	cmpl	$2, %eax
+	movq	96(%rsp), %rax
+	setne	%dl
+.L950:
+	.loc 1 1442 41 view .LVU3436
+	movq	(%rax,%rdx,8), %rax
+.LVL942:
+	.loc 1 1442 41 view .LVU3437
+	jmp	.L925
+.LVL943:
+.L927:
+	.loc 1 1441 44 discriminator 1 view .LVU3438
+	movq	96(%rsp), %rax
+	movq	24(%rax), %rax
+	.loc 1 1441 36 discriminator 1 view .LVU3439
+	testq	%rax, %rax
+	je	.L928
+	.loc 1 1441 61 discriminator 2 view .LVU3440
+	movq	%rbx, %rdi
+	call	*%rax
+.LVL944:
+	.loc 1 1441 58 discriminator 2 view .LVU3441
+	testb	%al, %al
+	jne	.L929
+	jmp	.L928
+.LVL945:
+.L925:
+	.loc 1 1449 5 is_stmt 1 view .LVU3442
+	.loc 1 1449 48 is_stmt 0 view .LVU3443
+	movq	%rax, %rdx
+	.loc 1 1449 17 view .LVU3444
+	xorl	%ebp, %ebp
+	.loc 1 1449 48 view .LVU3445
+	shrq	$32, %rdx
+	.loc 1 1449 17 view .LVU3446
+	testw	%dx, %dx
+	.loc 1 1449 58 view .LVU3447
+	movzbl	%ah, %edx
+	.loc 1 1449 17 view .LVU3448
+	setne	%bpl
+	.loc 1 1449 56 view .LVU3449
+	cmpq	$1, %rdx
+	.loc 1 1456 11 view .LVU3450
+	movl	32(%rbx), %edx
+	.loc 1 1449 56 view .LVU3451
+	sbbl	$-1, %ebp
+	.loc 1 1449 11 view .LVU3452
+	addq	%rax, %rbp
+.LVL946:
+	.loc 1 1451 5 is_stmt 1 view .LVU3453
+	.loc 1 1451 15 is_stmt 0 view .LVU3454
+	leaq	custom_put_vtab(%rip), %rax
+	.loc 1 1475 5 view .LVU3455
+	movl	%ebp, %r13d
+	.loc 1 1451 15 view .LVU3456
+	movq	%rax, 16(%rsp)
+	.loc 1 1454 5 is_stmt 1 view .LVU3457
+	.loc 1 1455 4 view .LVU3458
+.LVL947:
+	.loc 1 1456 5 view .LVU3459
+	.loc 1 1475 5 is_stmt 0 view .LVU3460
+	shrl	$16, %r13d
+	.loc 1 1456 8 view .LVU3461
+	testb	$8, %dl
+	jne	.L951
+	.loc 1 1457 9 is_stmt 1 view .LVU3462
+	.loc 1 1457 14 is_stmt 0 view .LVU3463
+	movl	24(%rbx), %eax
+	.loc 1 1457 26 view .LVU3464
+	movzbl	%bpl, %ecx
+	.loc 1 1457 12 view .LVU3465
+	cmpl	%eax, %ecx
+	jb	.L932
+	.loc 1 1458 13 is_stmt 1 view .LVU3466
+	.loc 1 1458 22 is_stmt 0 view .LVU3467
+	xorl	%esi, %esi
+	movl	%esi, 24(%rbx)
+.L951:
+	.loc 1 1475 5 is_stmt 1 view .LVU3468
+	movl	%r13d, %esi
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL948:
+	.loc 1 1476 5 view .LVU3469
+	jmp	.L931
+.L932:
+	.loc 1 1463 13 view .LVU3470
+	.loc 1 1463 22 is_stmt 0 view .LVU3471
+	subl	%ecx, %eax
+.LBB1212:
+.LBB1213:
+	.loc 1 578 21 view .LVU3472
+	andl	$32, %edx
+	.loc 1 574 10 view .LVU3473
+	leaq	104(%rsp), %rdi
+	movl	$16, %ecx
+.LBE1213:
+.LBE1212:
+	.loc 1 1463 22 view .LVU3474
+	movl	%eax, 24(%rbx)
+	.loc 1 1464 13 is_stmt 1 view .LVU3475
+.LVL949:
+.LBB1217:
+.LBI1212:
+	.loc 1 572 13 view .LVU3476
+.LBB1214:
+	.loc 1 574 5 view .LVU3477
+	.loc 1 574 10 is_stmt 0 view .LVU3478
+	movq	%rbx, %rsi
+	leaq	104(%rsp), %r14
+	rep movsl
+.LVL950:
+	.loc 1 575 5 is_stmt 1 view .LVU3479
+.LBE1214:
+.LBE1217:
+	.loc 1 1465 20 is_stmt 0 view .LVU3480
+	movq	%r14, 80(%rsp)
+	.loc 1 1467 13 view .LVU3481
+	movq	8(%rsp), %rdi
+	movq	%r12, %rsi
+.LBB1218:
+.LBB1215:
+	.loc 1 575 15 view .LVU3482
+	leaq	ahead_vtab(%rip), %rcx
+.LBE1215:
+.LBE1218:
+	.loc 1 1466 26 view .LVU3483
+	movl	%eax, 16(%r12)
+.LBB1219:
+.LBB1216:
+	.loc 1 575 15 view .LVU3484
+	movq	%rcx, 104(%rsp)
+	.loc 1 576 5 is_stmt 1 view .LVU3485
+	.loc 1 576 14 is_stmt 0 view .LVU3486
+	xorl	%ecx, %ecx
+	.loc 1 578 46 view .LVU3487
+	negl	%edx
+	sbbq	%rdx, %rdx
+	.loc 1 576 14 view .LVU3488
+	movq	%rcx, 144(%rsp)
+	.loc 1 578 46 view .LVU3489
+	andl	$65, %edx
+	.loc 1 576 14 view .LVU3490
+	movq	%rcx, 152(%rsp)
+	.loc 1 578 5 is_stmt 1 view .LVU3491
+	.loc 1 578 10 is_stmt 0 view .LVU3492
+	movq	%rdx, 168(%rsp)
+.LVL951:
+	.loc 1 578 10 view .LVU3493
+.LBE1216:
+.LBE1219:
+	.loc 1 1465 13 is_stmt 1 view .LVU3494
+	.loc 1 1466 13 view .LVU3495
+	.loc 1 1467 13 view .LVU3496
+	call	*(%r12)
+.LVL952:
+	.loc 1 1468 13 view .LVU3497
+	movq	96(%rsp), %rdi
+	movq	%r14, %rsi
+	call	render_quote_flush
+.LVL953:
+	.loc 1 1469 13 view .LVU3498
+.LBB1220:
+.LBB1221:
+	.loc 1 589 18 is_stmt 0 view .LVU3499
+	movl	136(%rsp), %edx
+.LBE1221:
+.LBE1220:
+	.loc 1 1469 20 view .LVU3500
+	movq	%rbx, 80(%rsp)
+	.loc 1 1470 13 is_stmt 1 view .LVU3501
+.LVL954:
+.LBB1225:
+.LBI1220:
+	.loc 1 586 12 view .LVU3502
+.LBB1224:
+	.loc 1 588 5 view .LVU3503
+	.loc 1 589 5 view .LVU3504
+	.loc 1 590 5 view .LVU3505
+.LBB1222:
+	.loc 1 590 21 view .LVU3506
+	.loc 1 590 58 view .LVU3507
+	.loc 1 590 92 view .LVU3508
+	.loc 1 590 104 view .LVU3509
+	movl	%edx, %eax
+	andl	$-33, %eax
+	.loc 1 590 107 is_stmt 0 view .LVU3510
+	testb	$32, 32(%rbx)
+	je	.L935
+	.loc 1 590 97 view .LVU3511
+	movl	%edx, %eax
+	orl	$32, %eax
+.L935:
+	.loc 1 590 97 view .LVU3512
+.LBE1222:
+	.loc 1 592 20 view .LVU3513
+	movl	128(%rsp), %edx
+.LBB1223:
+	.loc 1 590 97 view .LVU3514
+	movl	%eax, 32(%rbx)
+.LVL955:
+	.loc 1 590 97 view .LVU3515
+.LBE1223:
+	.loc 1 591 5 is_stmt 1 view .LVU3516
+	.loc 1 593 5 is_stmt 0 view .LVU3517
+	movl	$32, %esi
+	movq	%rbx, %rdi
+	.loc 1 591 14 view .LVU3518
+	movl	140(%rsp), %eax
+	.loc 1 592 14 view .LVU3519
+	movl	%edx, 24(%rbx)
+	.loc 1 591 14 view .LVU3520
+	movl	%eax, 36(%rbx)
+	.loc 1 592 5 is_stmt 1 view .LVU3521
+	.loc 1 593 5 view .LVU3522
+	call	render_fill
+.LVL956:
+	.loc 1 594 5 view .LVU3523
+	.loc 1 594 13 is_stmt 0 view .LVU3524
+	movq	168(%rsp), %r15
+.LVL957:
+	.loc 1 594 13 view .LVU3525
+.LBE1224:
+.LBE1225:
+	.loc 1 1475 5 is_stmt 1 view .LVU3526
+	movl	%r13d, %esi
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL958:
+	.loc 1 1476 5 view .LVU3527
+.LBB1226:
+.LBB1227:
+	.loc 1 599 17 is_stmt 0 view .LVU3528
+	xorl	%r13d, %r13d
+.LBE1227:
+.LBE1226:
+	.loc 1 1476 8 view .LVU3529
+	cmpq	$64, %r15
+	ja	.L931
+.L936:
+.LVL959:
+.LBB1229:
+.LBB1228:
+	.loc 1 599 26 is_stmt 1 view .LVU3530
+	cmpq	168(%rsp), %r13
+	jnb	.L938
+	.loc 1 600 9 view .LVU3531
+	movl	72(%r14,%r13,4), %esi
+	movq	%rbx, %rdi
+	.loc 1 599 35 is_stmt 0 view .LVU3532
+	incq	%r13
+.LVL960:
+	.loc 1 600 9 view .LVU3533
+	call	va_stream_render
+.LVL961:
+	.loc 1 599 35 is_stmt 1 view .LVU3534
+	.loc 1 599 35 is_stmt 0 view .LVU3535
+	jmp	.L936
+.LVL962:
+.L931:
+	.loc 1 599 35 view .LVU3536
+.LBE1228:
+.LBE1229:
+	.loc 1 1480 9 is_stmt 1 view .LVU3537
+	.loc 1 1480 25 is_stmt 0 view .LVU3538
+	movl	24(%rbx), %eax
+	.loc 1 1481 9 view .LVU3539
+	movq	8(%rsp), %rdi
+	movq	%r12, %rsi
+	.loc 1 1480 22 view .LVU3540
+	movl	%eax, 16(%r12)
+	.loc 1 1481 9 is_stmt 1 view .LVU3541
+	call	*(%r12)
+.LVL963:
+	.loc 1 1482 9 view .LVU3542
+	movq	96(%rsp), %rdi
+	movq	%rbx, %rsi
+	call	render_quote_flush
+.LVL964:
+.L938:
+	.loc 1 1484 5 view .LVU3543
+	.loc 1 1484 52 is_stmt 0 view .LVU3544
+	shrq	$32, %rbp
+.LVL965:
+	.loc 1 1484 5 view .LVU3545
+	movq	%rbx, %rdi
+	movzwl	%bp, %esi
+	call	va_stream_render
+.LVL966:
+	.loc 1 1487 5 is_stmt 1 view .LVU3546
+	movl	24(%rbx), %edx
+	movq	%rbx, %rdi
+	movl	$32, %esi
+	call	render_fill
+.LVL967:
+	.loc 1 1488 1 is_stmt 0 view .LVU3547
+	addq	$440, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL968:
+	.loc 1 1488 1 view .LVU3548
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL969:
+	.loc 1 1488 1 view .LVU3549
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE589:
+	.size	render_custom, .-render_custom
+	.globl	va_stream_render_quote_oct
+	.type	va_stream_render_quote_oct, @function
+va_stream_render_quote_oct:
+.LVL970:
+.LFB546:
+	.loc 1 221 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 222 5 view .LVU3551
+	.loc 1 221 1 is_stmt 0 view .LVU3552
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%esi, %ebx
+	.loc 1 222 5 view .LVU3553
+	movl	$92, %esi
+.LVL971:
+	.loc 1 221 1 view .LVU3554
+	pushq	%rax
+	.cfi_def_cfa_offset 32
+	.loc 1 222 5 view .LVU3555
+	call	va_stream_render
+.LVL972:
+	.loc 1 223 5 is_stmt 1 view .LVU3556
+	.loc 1 223 35 is_stmt 0 view .LVU3557
+	movl	%ebx, %esi
+	.loc 1 223 5 view .LVU3558
+	movq	%rbp, %rdi
+	.loc 1 223 35 view .LVU3559
+	shrl	$6, %esi
+	.loc 1 223 41 view .LVU3560
+	andl	$7, %esi
+	.loc 1 223 5 view .LVU3561
+	addl	$48, %esi
+	call	va_stream_render
+.LVL973:
+	.loc 1 224 5 is_stmt 1 view .LVU3562
+	.loc 1 224 35 is_stmt 0 view .LVU3563
+	movl	%ebx, %esi
+	.loc 1 224 5 view .LVU3564
+	movq	%rbp, %rdi
+	.loc 1 225 41 view .LVU3565
+	andl	$7, %ebx
+.LVL974:
+	.loc 1 224 35 view .LVU3566
+	shrl	$3, %esi
+.LVL975:
+	.loc 1 224 41 view .LVU3567
+	andl	$7, %esi
+	.loc 1 224 5 view .LVU3568
+	addl	$48, %esi
+	call	va_stream_render
+.LVL976:
+	.loc 1 225 5 is_stmt 1 view .LVU3569
+	.loc 1 226 1 is_stmt 0 view .LVU3570
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	.loc 1 225 5 view .LVU3571
+	leal	48(%rbx), %esi
+	movq	%rbp, %rdi
+	.loc 1 226 1 view .LVU3572
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL977:
+	.loc 1 225 5 view .LVU3573
+	jmp	va_stream_render
+.LVL978:
+	.loc 1 225 5 view .LVU3574
+	.cfi_endproc
+.LFE546:
+	.size	va_stream_render_quote_oct, .-va_stream_render_quote_oct
+	.globl	va_stream_render_quote_u
+	.type	va_stream_render_quote_u, @function
+va_stream_render_quote_u:
+.LVL979:
+.LFB547:
+	.loc 1 231 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 232 5 view .LVU3576
+	.loc 1 231 1 is_stmt 0 view .LVU3577
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 232 24 view .LVU3578
+	leaq	digit2_std(%rip), %rdx
+	.loc 1 231 1 view .LVU3579
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp
+	.loc 1 233 5 view .LVU3580
+	movl	$92, %esi
+.LVL980:
+	.loc 1 231 1 view .LVU3581
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 232 43 view .LVU3582
+	movl	32(%rdi), %eax
+	.loc 1 231 1 view .LVU3583
+	movq	%rdi, %rbx
+	.loc 1 232 43 view .LVU3584
+	shrl	%eax
+	.loc 1 232 24 view .LVU3585
+	andl	$1, %eax
+	movq	(%rdx,%rax,8), %r12
+.LVL981:
+	.loc 1 233 5 is_stmt 1 view .LVU3586
+	call	va_stream_render
+.LVL982:
+	.loc 1 234 5 view .LVU3587
+	.loc 1 235 9 is_stmt 0 view .LVU3588
+	movl	$117, %esi
+	.loc 1 234 8 view .LVU3589
+	cmpl	$65535, %ebp
+	jbe	.L958
+	.loc 1 238 9 is_stmt 1 view .LVU3590
+	movl	$85, %esi
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL983:
+	.loc 1 239 9 view .LVU3591
+	.loc 1 239 53 is_stmt 0 view .LVU3592
+	movl	%ebp, %eax
+	.loc 1 239 9 view .LVU3593
+	movq	%rbx, %rdi
+	.loc 1 239 53 view .LVU3594
+	shrl	$28, %eax
+	.loc 1 239 9 view .LVU3595
+	movzbl	(%r12,%rax), %esi
+	call	va_stream_render
+.LVL984:
+	.loc 1 240 9 is_stmt 1 view .LVU3596
+	.loc 1 240 53 is_stmt 0 view .LVU3597
+	movl	%ebp, %eax
+	.loc 1 240 9 view .LVU3598
+	movq	%rbx, %rdi
+	.loc 1 240 53 view .LVU3599
+	shrl	$24, %eax
+	.loc 1 240 60 view .LVU3600
+	andl	$15, %eax
+	.loc 1 240 9 view .LVU3601
+	movzbl	(%r12,%rax), %esi
+	call	va_stream_render
+.LVL985:
+	.loc 1 241 9 is_stmt 1 view .LVU3602
+	.loc 1 241 53 is_stmt 0 view .LVU3603
+	movl	%ebp, %eax
+	.loc 1 241 9 view .LVU3604
+	movq	%rbx, %rdi
+	.loc 1 241 53 view .LVU3605
+	shrl	$20, %eax
+	.loc 1 241 60 view .LVU3606
+	andl	$15, %eax
+	.loc 1 241 9 view .LVU3607
+	movzbl	(%r12,%rax), %esi
+	call	va_stream_render
+.LVL986:
+	.loc 1 242 9 is_stmt 1 view .LVU3608
+	.loc 1 242 53 is_stmt 0 view .LVU3609
+	movl	%ebp, %eax
+	shrl	$16, %eax
+	.loc 1 242 60 view .LVU3610
+	andl	$15, %eax
+	.loc 1 242 9 view .LVU3611
+	movzbl	(%r12,%rax), %esi
+.L958:
+	movq	%rbx, %rdi
+	call	va_stream_render
+.LVL987:
+	.loc 1 244 5 is_stmt 1 view .LVU3612
+	.loc 1 244 49 is_stmt 0 view .LVU3613
+	movl	%ebp, %eax
+	.loc 1 244 5 view .LVU3614
+	movq	%rbx, %rdi
+	.loc 1 244 49 view .LVU3615
+	shrl	$12, %eax
+	.loc 1 244 56 view .LVU3616
+	andl	$15, %eax
+	.loc 1 244 5 view .LVU3617
+	movzbl	(%r12,%rax), %esi
+	call	va_stream_render
+.LVL988:
+	.loc 1 245 5 is_stmt 1 view .LVU3618
+	.loc 1 245 49 is_stmt 0 view .LVU3619
+	movl	%ebp, %eax
+	.loc 1 245 5 view .LVU3620
+	movq	%rbx, %rdi
+	.loc 1 245 49 view .LVU3621
+	shrl	$8, %eax
+	.loc 1 245 55 view .LVU3622
+	andl	$15, %eax
+	.loc 1 245 5 view .LVU3623
+	movzbl	(%r12,%rax), %esi
+	call	va_stream_render
+.LVL989:
+	.loc 1 246 5 is_stmt 1 view .LVU3624
+	.loc 1 246 49 is_stmt 0 view .LVU3625
+	movl	%ebp, %eax
+	.loc 1 246 5 view .LVU3626
+	movq	%rbx, %rdi
+	.loc 1 247 55 view .LVU3627
+	andl	$15, %ebp
+.LVL990:
+	.loc 1 246 49 view .LVU3628
+	shrl	$4, %eax
+.LVL991:
+	.loc 1 246 55 view .LVU3629
+	andl	$15, %eax
+	.loc 1 246 5 view .LVU3630
+	movzbl	(%r12,%rax), %esi
+	call	va_stream_render
+.LVL992:
+	.loc 1 247 5 is_stmt 1 view .LVU3631
+	movzbl	(%r12,%rbp), %esi
+	movq	%rbx, %rdi
+	.loc 1 248 1 is_stmt 0 view .LVU3632
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL993:
+	.loc 1 248 1 view .LVU3633
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL994:
+	.loc 1 247 5 view .LVU3634
+	jmp	va_stream_render
+.LVL995:
+	.loc 1 247 5 view .LVU3635
+	.cfi_endproc
+.LFE547:
+	.size	va_stream_render_quote_u, .-va_stream_render_quote_u
+	.type	render_quote_j, @function
+render_quote_j:
+.LVL996:
+.LFB551:
+	.loc 1 349 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 350 5 view .LVU3637
+	.loc 1 349 1 is_stmt 0 view .LVU3638
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%r8
+	.cfi_def_cfa_offset 32
+	.loc 1 350 10 view .LVU3639
+	movl	32(%rdi), %eax
+	.loc 1 350 8 view .LVU3640
+	testb	$4, %al
+	je	.L960
+	.loc 1 351 9 is_stmt 1 view .LVU3641
+	.loc 1 351 12 is_stmt 0 view .LVU3642
+	testl	$520093696, %esi
+	je	.L961
+	.loc 1 352 13 is_stmt 1 view .LVU3643
+	.loc 1 352 16 is_stmt 0 view .LVU3644
+	testl	%esi, %esi
+	jns	.L963
+	jmp	.L986
+.L961:
+	.loc 1 358 9 is_stmt 1 view .LVU3645
+.LVL997:
+.LBB1230:
+.LBI1230:
+	.loc 2 419 19 view .LVU3646
+.LBB1231:
+	.loc 2 421 5 view .LVU3647
+	.loc 2 421 26 is_stmt 0 view .LVU3648
+	leal	-55296(%rsi), %edx
+.LBE1231:
+.LBE1230:
+	.loc 1 358 12 view .LVU3649
+	cmpl	$2047, %edx
+	jbe	.L970
+	cmpl	$1114111, %esi
+	jbe	.L960
+.L970:
+	.loc 1 359 13 is_stmt 1 view .LVU3650
+.LVL998:
+.LBB1232:
+.LBI1232:
+	.loc 2 425 20 view .LVU3651
+.LBB1233:
+	.loc 2 427 5 view .LVU3652
+	.loc 2 427 8 is_stmt 0 view .LVU3653
+	testl	$939524096, %eax
+	je	.L965
+.LVL999:
+.L963:
+	.loc 2 427 8 view .LVU3654
+.LBE1233:
+.LBE1232:
+	.loc 1 355 15 view .LVU3655
+	movl	$65533, %esi
+.LVL1000:
+	.loc 1 355 15 view .LVU3656
+	jmp	.L960
+.LVL1001:
+.L965:
+.LBB1236:
+.LBB1235:
+	.loc 2 428 9 is_stmt 1 view .LVU3657
+.LBB1234:
+	.loc 2 428 25 view .LVU3658
+	.loc 2 428 62 view .LVU3659
+	.loc 2 428 101 is_stmt 0 view .LVU3660
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU3661
+	orl	$402653184, %eax
+	movl	%eax, 32(%rbx)
+	jmp	.L963
+.LVL1002:
+.L960:
+	.loc 2 428 123 view .LVU3662
+.LBE1234:
+.LBE1235:
+.LBE1236:
+	.loc 1 364 5 is_stmt 1 view .LVU3663
+	.loc 1 364 19 is_stmt 0 view .LVU3664
+	movl	%esi, %edi
+	call	va_quote1_c
+.LVL1003:
+	.loc 1 364 14 view .LVU3665
+	movzbl	%al, %ebp
+.LVL1004:
+	.loc 1 365 5 is_stmt 1 view .LVU3666
+	.loc 1 365 8 is_stmt 0 view .LVU3667
+	testl	%ebp, %ebp
+	je	.L966
+	.loc 1 366 9 is_stmt 1 view .LVU3668
+	movl	$92, %esi
+.LVL1005:
+	.loc 1 366 9 is_stmt 0 view .LVU3669
+	movq	%rbx, %rdi
+.LVL1006:
+	.loc 1 366 9 view .LVU3670
+	call	va_stream_render
+.LVL1007:
+	.loc 1 367 9 is_stmt 1 view .LVU3671
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	jmp	.L969
+.LVL1008:
+.L966:
+	.loc 1 370 5 view .LVU3672
+	.loc 1 375 9 is_stmt 0 view .LVU3673
+	movq	%rbx, %rdi
+	.loc 1 370 8 view .LVU3674
+	cmpl	$31, %esi
+	jbe	.L985
+	.loc 1 370 8 view .LVU3675
+	cmpl	$127, %esi
+	je	.L985
+	.loc 1 374 5 is_stmt 1 view .LVU3676
+	.loc 1 374 34 is_stmt 0 view .LVU3677
+	testb	$4, 32(%rbx)
+	je	.L969
+	cmpl	$127, %esi
+	jbe	.L969
+.L985:
+	.loc 1 375 9 is_stmt 1 view .LVU3678
+	.loc 1 379 1 is_stmt 0 view .LVU3679
+	popq	%rcx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1009:
+	.loc 1 379 1 view .LVU3680
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1010:
+	.loc 1 375 9 view .LVU3681
+	jmp	va_stream_render_quote_u
+.LVL1011:
+.L969:
+	.cfi_restore_state
+	.loc 1 378 5 is_stmt 1 view .LVU3682
+	.loc 1 379 1 is_stmt 0 view .LVU3683
+	popq	%rdx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1012:
+	.loc 1 379 1 view .LVU3684
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1013:
+	.loc 1 378 5 view .LVU3685
+	jmp	va_stream_render
+.LVL1014:
+.L986:
+	.cfi_restore_state
+	.loc 1 379 1 view .LVU3686
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1015:
+	.loc 1 379 1 view .LVU3687
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE551:
+	.size	render_quote_j, .-render_quote_j
+	.type	render_quote_c, @function
+render_quote_c:
+.LVL1016:
+.LFB550:
+	.loc 1 308 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 309 5 view .LVU3689
+	.loc 1 308 1 is_stmt 0 view .LVU3690
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%r9
+	.cfi_def_cfa_offset 32
+	.loc 1 309 10 view .LVU3691
+	movl	32(%rdi), %eax
+	.loc 1 309 8 view .LVU3692
+	testb	$4, %al
+	je	.L988
+	.loc 1 310 9 is_stmt 1 view .LVU3693
+	.loc 1 310 12 is_stmt 0 view .LVU3694
+	testl	$520093696, %esi
+	je	.L989
+	.loc 1 311 13 is_stmt 1 view .LVU3695
+	.loc 1 311 16 is_stmt 0 view .LVU3696
+	testl	%esi, %esi
+	jns	.L991
+	jmp	.L1013
+.L989:
+	.loc 1 316 14 is_stmt 1 view .LVU3697
+.LVL1017:
+.LBB1237:
+.LBI1237:
+	.loc 2 419 19 view .LVU3698
+.LBB1238:
+	.loc 2 421 5 view .LVU3699
+	.loc 2 421 26 is_stmt 0 view .LVU3700
+	leal	-55296(%rsi), %edx
+.LBE1238:
+.LBE1237:
+	.loc 1 316 17 view .LVU3701
+	cmpl	$2047, %edx
+	jbe	.L998
+	cmpl	$1114111, %esi
+	jbe	.L988
+.L998:
+	.loc 1 317 13 is_stmt 1 view .LVU3702
+.LVL1018:
+.LBB1239:
+.LBI1239:
+	.loc 2 425 20 view .LVU3703
+.LBB1240:
+	.loc 2 427 5 view .LVU3704
+	.loc 2 427 8 is_stmt 0 view .LVU3705
+	testl	$939524096, %eax
+	je	.L993
+.LVL1019:
+.L991:
+	.loc 2 427 8 view .LVU3706
+.LBE1240:
+.LBE1239:
+	.loc 1 314 15 view .LVU3707
+	movl	$65533, %esi
+.LVL1020:
+	.loc 1 314 15 view .LVU3708
+	jmp	.L988
+.LVL1021:
+.L993:
+.LBB1243:
+.LBB1242:
+	.loc 2 428 9 is_stmt 1 view .LVU3709
+.LBB1241:
+	.loc 2 428 25 view .LVU3710
+	.loc 2 428 62 view .LVU3711
+	.loc 2 428 101 is_stmt 0 view .LVU3712
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU3713
+	orl	$402653184, %eax
+	movl	%eax, 32(%rbx)
+	jmp	.L991
+.LVL1022:
+.L988:
+	.loc 2 428 123 view .LVU3714
+.LBE1241:
+.LBE1242:
+.LBE1243:
+	.loc 1 322 5 is_stmt 1 view .LVU3715
+	.loc 1 322 19 is_stmt 0 view .LVU3716
+	movl	%esi, %edi
+	call	va_quote1_c
+.LVL1023:
+	.loc 1 322 14 view .LVU3717
+	movzbl	%al, %ebp
+.LVL1024:
+	.loc 1 323 5 is_stmt 1 view .LVU3718
+	.loc 1 323 8 is_stmt 0 view .LVU3719
+	testl	%ebp, %ebp
+	je	.L994
+	.loc 1 324 9 is_stmt 1 view .LVU3720
+	movl	$92, %esi
+.LVL1025:
+	.loc 1 324 9 is_stmt 0 view .LVU3721
+	movq	%rbx, %rdi
+.LVL1026:
+	.loc 1 324 9 view .LVU3722
+	call	va_stream_render
+.LVL1027:
+	.loc 1 325 9 is_stmt 1 view .LVU3723
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+	jmp	.L997
+.LVL1028:
+.L994:
+	.loc 1 328 5 view .LVU3724
+	.loc 1 333 9 is_stmt 0 view .LVU3725
+	movq	%rbx, %rdi
+	.loc 1 328 8 view .LVU3726
+	cmpl	$31, %esi
+	jbe	.L999
+	.loc 1 328 8 view .LVU3727
+	cmpl	$127, %esi
+	jne	.L995
+.L999:
+	.loc 1 329 9 is_stmt 1 view .LVU3728
+	.loc 1 338 1 is_stmt 0 view .LVU3729
+	popq	%r8
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1029:
+	.loc 1 338 1 view .LVU3730
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1030:
+	.loc 1 329 9 view .LVU3731
+	jmp	va_stream_render_quote_oct
+.LVL1031:
+.L995:
+	.cfi_restore_state
+	.loc 1 332 5 is_stmt 1 view .LVU3732
+	.loc 1 332 34 is_stmt 0 view .LVU3733
+	testb	$4, 32(%rbx)
+	je	.L997
+	cmpl	$127, %esi
+	jbe	.L997
+	.loc 1 333 9 is_stmt 1 view .LVU3734
+	.loc 1 338 1 is_stmt 0 view .LVU3735
+	popq	%rcx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1032:
+	.loc 1 338 1 view .LVU3736
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1033:
+	.loc 1 333 9 view .LVU3737
+	jmp	va_stream_render_quote_u
+.LVL1034:
+.L997:
+	.cfi_restore_state
+	.loc 1 337 5 is_stmt 1 view .LVU3738
+	.loc 1 338 1 is_stmt 0 view .LVU3739
+	popq	%rdx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1035:
+	.loc 1 338 1 view .LVU3740
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1036:
+	.loc 1 337 5 view .LVU3741
+	jmp	va_stream_render
+.LVL1037:
+.L1013:
+	.cfi_restore_state
+	.loc 1 338 1 view .LVU3742
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1038:
+	.loc 1 338 1 view .LVU3743
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE550:
+	.size	render_quote_c, .-render_quote_c
+	.globl	va_quotation_set
+	.type	va_quotation_set, @function
+va_quotation_set:
+.LVL1039:
+.LFB553:
+	.loc 1 421 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 422 5 view .LVU3745
+	.loc 1 423 5 view .LVU3746
+.LBB1244:
+	.loc 1 423 28 view .LVU3747
+	.loc 1 423 14 view .LVU3748
+.LBE1244:
+	.loc 1 421 1 is_stmt 0 view .LVU3749
+	movq	%rsi, %rax
+.LVL1040:
+.LBB1245:
+	.loc 1 423 14 is_stmt 1 view .LVU3750
+	.loc 1 423 82 view .LVU3751
+	.loc 1 423 40 is_stmt 0 view .LVU3752
+	andl	$7, %edi
+.LVL1041:
+	.loc 1 423 82 view .LVU3753
+	leaq	va_quote(%rip), %rdx
+	xchgq	(%rdx,%rdi,8), %rax
+.LVL1042:
+	.loc 1 423 15 is_stmt 1 view .LVU3754
+.LBE1245:
+	.loc 1 424 1 is_stmt 0 view .LVU3755
+	ret
+	.cfi_endproc
+.LFE553:
+	.size	va_quotation_set, .-va_quotation_set
+	.globl	va_quotations_init
+	.type	va_quotations_init, @function
+va_quotations_init:
+.LVL1043:
+.LFB554:
+	.loc 1 428 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 429 5 view .LVU3757
+.LBB1246:
+	.loc 1 429 10 view .LVU3758
+	.loc 1 429 28 view .LVU3759
+.LBE1246:
+	.loc 1 428 1 is_stmt 0 view .LVU3760
+	xorl	%eax, %eax
+.LBB1249:
+.LBB1247:
+	.loc 1 430 83 view .LVU3761
+	leaq	va_quote(%rip), %rcx
+.LVL1044:
+.L1016:
+	.loc 1 430 83 view .LVU3762
+.LBE1247:
+	.loc 1 430 9 is_stmt 1 discriminator 3 view .LVU3763
+.LBB1248:
+	.loc 1 430 37 discriminator 3 view .LVU3764
+	.loc 1 430 23 discriminator 3 view .LVU3765
+	.loc 1 430 83 discriminator 3 view .LVU3766
+	movq	(%rcx,%rax), %rdx
+.LVL1045:
+	.loc 1 430 24 discriminator 3 view .LVU3767
+.LBE1248:
+	.loc 1 430 19 is_stmt 0 discriminator 3 view .LVU3768
+	movq	%rdx, (%rdi,%rax)
+	.loc 1 429 42 is_stmt 1 discriminator 3 view .LVU3769
+.LVL1046:
+	.loc 1 429 28 discriminator 3 view .LVU3770
+	addq	$8, %rax
+.LVL1047:
+	.loc 1 429 28 is_stmt 0 discriminator 3 view .LVU3771
+	cmpq	$64, %rax
+	jne	.L1016
+.LBE1249:
+	.loc 1 432 1 view .LVU3772
+	ret
+	.cfi_endproc
+.LFE554:
+	.size	va_quotations_init, .-va_quotations_init
+	.globl	va_quotations_thread
+	.type	va_quotations_thread, @function
+va_quotations_thread:
+.LVL1048:
+.LFB555:
+	.loc 1 436 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 437 5 view .LVU3774
+	.loc 1 437 28 is_stmt 0 view .LVU3775
+	movq	%fs:va_quote_thread@tpoff, %rax
+.LVL1049:
+	.loc 1 438 5 is_stmt 1 view .LVU3776
+	.loc 1 438 21 is_stmt 0 view .LVU3777
+	movq	%rdi, %fs:va_quote_thread@tpoff
+	.loc 1 439 5 is_stmt 1 view .LVU3778
+	.loc 1 440 1 is_stmt 0 view .LVU3779
+	ret
+	.cfi_endproc
+.LFE555:
+	.size	va_quotations_thread, .-va_quotations_thread
+	.globl	va_xprintf_iter
+	.type	va_xprintf_iter, @function
+va_xprintf_iter:
+.LVL1050:
+.LFB615:
+	.loc 1 2412 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2413 5 view .LVU3781
+	.loc 1 2412 1 is_stmt 0 view .LVU3782
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+.LBB1250:
+	.loc 1 2414 21 view .LVU3783
+	movl	32(%rdi), %r12d
+.LBE1250:
+	.loc 1 2413 17 view .LVU3784
+	movq	8(%rsi), %r13
+.LVL1051:
+	.loc 1 2414 5 is_stmt 1 view .LVU3785
+.LBB1251:
+	.loc 1 2414 4 view .LVU3786
+	.loc 1 2414 21 is_stmt 0 view .LVU3787
+	andl	$64, %r12d
+.LVL1052:
+	.loc 1 2414 32 is_stmt 1 view .LVU3788
+	call	ensure_init
+.LVL1053:
+.L1022:
+	.loc 1 2414 48 discriminator 9 view .LVU3789
+	.loc 1 2414 60 discriminator 9 view .LVU3790
+	.loc 1 2414 65 discriminator 9 view .LVU3791
+	.loc 1 2414 69 is_stmt 0 discriminator 9 view .LVU3792
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL1054:
+	.loc 1 2414 68 discriminator 9 view .LVU3793
+	testb	%al, %al
+	je	.L1021
+	.loc 1 2414 38 is_stmt 1 discriminator 4 view .LVU3794
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	call	render_iter
+.LVL1055:
+.L1021:
+	.loc 1 2414 102 discriminator 7 view .LVU3795
+	.loc 1 2414 95 discriminator 7 view .LVU3796
+	.loc 1 2414 78 is_stmt 0 discriminator 7 view .LVU3797
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL1056:
+	.loc 1 2414 95 discriminator 7 view .LVU3798
+	cmpl	$1, %eax
+	ja	.L1021
+	.loc 1 2414 113 is_stmt 1 discriminator 8 view .LVU3799
+	testl	%eax, %eax
+	jne	.L1022
+	.loc 1 2414 117 discriminator 10 view .LVU3800
+	.loc 1 2414 120 is_stmt 0 discriminator 10 view .LVU3801
+	testl	%r12d, %r12d
+	je	.L1023
+	.loc 1 2414 129 is_stmt 1 discriminator 11 view .LVU3802
+	movq	%rbx, %rdi
+	call	finish
+.LVL1057:
+.L1023:
+	.loc 1 2414 129 is_stmt 0 discriminator 11 view .LVU3803
+.LBE1251:
+	.loc 1 2414 7 is_stmt 1 discriminator 13 view .LVU3804
+	.loc 1 2415 5 discriminator 13 view .LVU3805
+	.loc 1 2416 1 is_stmt 0 discriminator 13 view .LVU3806
+	popq	%rdx
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL1058:
+	.loc 1 2416 1 discriminator 13 view .LVU3807
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL1059:
+	.loc 1 2416 1 discriminator 13 view .LVU3808
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL1060:
+	.loc 1 2416 1 discriminator 13 view .LVU3809
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL1061:
+	.loc 1 2416 1 discriminator 13 view .LVU3810
+	ret
+	.cfi_endproc
+.LFE615:
+	.size	va_xprintf_iter, .-va_xprintf_iter
+	.globl	va_xprintf_iter_local
+	.type	va_xprintf_iter_local, @function
+va_xprintf_iter_local:
+.LVL1062:
+.LFB616:
+	.loc 1 2421 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2422 5 view .LVU3812
+	.loc 1 2421 1 is_stmt 0 view .LVU3813
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+.LBB1252:
+	.loc 1 2423 21 view .LVU3814
+	movl	32(%rdi), %r12d
+.LBE1252:
+	.loc 1 2422 17 view .LVU3815
+	movq	8(%rsi), %r13
+.LVL1063:
+	.loc 1 2423 5 is_stmt 1 view .LVU3816
+.LBB1253:
+	.loc 1 2423 4 view .LVU3817
+	.loc 1 2423 21 is_stmt 0 view .LVU3818
+	andl	$64, %r12d
+.LVL1064:
+	.loc 1 2423 32 is_stmt 1 view .LVU3819
+	call	ensure_init
+.LVL1065:
+.L1036:
+	.loc 1 2423 48 discriminator 9 view .LVU3820
+	.loc 1 2423 60 discriminator 9 view .LVU3821
+	.loc 1 2423 65 discriminator 9 view .LVU3822
+	.loc 1 2423 69 is_stmt 0 discriminator 9 view .LVU3823
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL1066:
+	.loc 1 2423 68 discriminator 9 view .LVU3824
+	testb	%al, %al
+	je	.L1035
+	.loc 1 2423 83 discriminator 2 view .LVU3825
+	testb	$32, 32(%rbx)
+	jne	.L1035
+	.loc 1 2423 38 is_stmt 1 discriminator 4 view .LVU3826
+	movq	%r13, %rdx
+	movq	%rbp, %rsi
+	call	render_iter
+.LVL1067:
+.L1035:
+	.loc 1 2423 102 discriminator 7 view .LVU3827
+	.loc 1 2423 95 discriminator 7 view .LVU3828
+	.loc 1 2423 78 is_stmt 0 discriminator 7 view .LVU3829
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL1068:
+	.loc 1 2423 95 discriminator 7 view .LVU3830
+	cmpl	$1, %eax
+	ja	.L1035
+	.loc 1 2423 113 is_stmt 1 discriminator 8 view .LVU3831
+	testl	%eax, %eax
+	jne	.L1036
+	.loc 1 2423 117 discriminator 10 view .LVU3832
+	.loc 1 2423 120 is_stmt 0 discriminator 10 view .LVU3833
+	testl	%r12d, %r12d
+	je	.L1037
+	.loc 1 2423 129 is_stmt 1 discriminator 11 view .LVU3834
+	movq	%rbx, %rdi
+	call	finish
+.LVL1069:
+.L1037:
+	.loc 1 2423 129 is_stmt 0 discriminator 11 view .LVU3835
+.LBE1253:
+	.loc 1 2423 7 is_stmt 1 discriminator 13 view .LVU3836
+	.loc 1 2424 5 discriminator 13 view .LVU3837
+	.loc 1 2425 1 is_stmt 0 discriminator 13 view .LVU3838
+	popq	%rdx
+	.cfi_def_cfa_offset 40
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL1070:
+	.loc 1 2425 1 discriminator 13 view .LVU3839
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL1071:
+	.loc 1 2425 1 discriminator 13 view .LVU3840
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL1072:
+	.loc 1 2425 1 discriminator 13 view .LVU3841
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL1073:
+	.loc 1 2425 1 discriminator 13 view .LVU3842
+	ret
+	.cfi_endproc
+.LFE616:
+	.size	va_xprintf_iter_local, .-va_xprintf_iter_local
+	.globl	va_xprintf_iter_chunk
+	.type	va_xprintf_iter_chunk, @function
+va_xprintf_iter_chunk:
+.LVL1074:
+.LFB617:
+	.loc 1 2430 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2431 5 view .LVU3844
+	.loc 1 2430 1 is_stmt 0 view .LVU3845
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 2431 16 view .LVU3846
+	movq	(%rsi), %rax
+	movq	24(%rax), %rax
+	.loc 1 2431 8 view .LVU3847
+	testq	%rax, %rax
+	je	.L1048
+	.loc 1 2432 9 is_stmt 1 view .LVU3848
+	movq	%rsi, 8(%rsp)
+	movq	%rsi, %rdi
+.LVL1075:
+	.loc 1 2432 9 is_stmt 0 view .LVU3849
+	call	*%rax
+.LVL1076:
+	.loc 1 2432 9 view .LVU3850
+	movq	8(%rsp), %rsi
+.LVL1077:
+.L1048:
+	.loc 1 2434 5 is_stmt 1 view .LVU3851
+	.loc 1 2435 1 is_stmt 0 view .LVU3852
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	.loc 1 2434 12 view .LVU3853
+	movq	%rbp, %rdi
+	.loc 1 2435 1 view .LVU3854
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1078:
+	.loc 1 2434 12 view .LVU3855
+	jmp	va_xprintf_iter
+.LVL1079:
+	.loc 1 2434 12 view .LVU3856
+	.cfi_endproc
+.LFE617:
+	.size	va_xprintf_iter_chunk, .-va_xprintf_iter_chunk
+	.globl	va_xprintf_custom
+	.type	va_xprintf_custom, @function
+va_xprintf_custom:
+.LVL1080:
+.LFB618:
+	.loc 1 2440 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2441 5 view .LVU3858
+.LBB1254:
+	.loc 1 2441 4 view .LVU3859
+.LBE1254:
+	.loc 1 2440 1 is_stmt 0 view .LVU3860
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB1255:
+	.loc 1 2441 21 view .LVU3861
+	movl	32(%rdi), %ebp
+.LBE1255:
+	.loc 1 2440 1 view .LVU3862
+	movq	%rdi, %rbx
+.LBB1256:
+	.loc 1 2441 21 view .LVU3863
+	andl	$64, %ebp
+.LVL1081:
+	.loc 1 2441 32 is_stmt 1 view .LVU3864
+	call	ensure_init
+.LVL1082:
+.L1056:
+	.loc 1 2441 48 discriminator 9 view .LVU3865
+	.loc 1 2441 60 discriminator 9 view .LVU3866
+	.loc 1 2441 65 discriminator 9 view .LVU3867
+	.loc 1 2441 69 is_stmt 0 discriminator 9 view .LVU3868
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL1083:
+	.loc 1 2441 68 discriminator 9 view .LVU3869
+	testb	%al, %al
+	je	.L1055
+	.loc 1 2441 83 discriminator 2 view .LVU3870
+	testb	$32, 32(%rbx)
+	jne	.L1055
+	.loc 1 2441 38 is_stmt 1 discriminator 4 view .LVU3871
+	movq	%r12, %rsi
+	call	render_custom
+.LVL1084:
+.L1055:
+	.loc 1 2441 97 discriminator 7 view .LVU3872
+	.loc 1 2441 90 discriminator 7 view .LVU3873
+	.loc 1 2441 73 is_stmt 0 discriminator 7 view .LVU3874
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL1085:
+	.loc 1 2441 90 discriminator 7 view .LVU3875
+	cmpl	$1, %eax
+	ja	.L1055
+	.loc 1 2441 108 is_stmt 1 discriminator 8 view .LVU3876
+	testl	%eax, %eax
+	jne	.L1056
+	.loc 1 2441 112 discriminator 10 view .LVU3877
+	.loc 1 2441 115 is_stmt 0 discriminator 10 view .LVU3878
+	testl	%ebp, %ebp
+	je	.L1057
+	.loc 1 2441 124 is_stmt 1 discriminator 11 view .LVU3879
+	movq	%rbx, %rdi
+	call	finish
+.LVL1086:
+.L1057:
+	.loc 1 2441 124 is_stmt 0 discriminator 11 view .LVU3880
+.LBE1256:
+	.loc 1 2441 7 is_stmt 1 discriminator 13 view .LVU3881
+	.loc 1 2442 5 discriminator 13 view .LVU3882
+	.loc 1 2443 1 is_stmt 0 discriminator 13 view .LVU3883
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL1087:
+	.loc 1 2443 1 discriminator 13 view .LVU3884
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL1088:
+	.loc 1 2443 1 discriminator 13 view .LVU3885
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL1089:
+	.loc 1 2443 1 discriminator 13 view .LVU3886
+	ret
+	.cfi_endproc
+.LFE618:
+	.size	va_xprintf_custom, .-va_xprintf_custom
+	.globl	va_xprintf_ptr
+	.type	va_xprintf_ptr, @function
+va_xprintf_ptr:
+.LVL1090:
+.LFB619:
+	.loc 1 2446 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2447 5 view .LVU3888
+.LBB1257:
+	.loc 1 2447 4 view .LVU3889
+.LBE1257:
+	.loc 1 2446 1 is_stmt 0 view .LVU3890
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB1258:
+	.loc 1 2447 21 view .LVU3891
+	movl	32(%rdi), %ebp
+.LBE1258:
+	.loc 1 2446 1 view .LVU3892
+	movq	%rdi, %rbx
+.LBB1259:
+	.loc 1 2447 21 view .LVU3893
+	andl	$64, %ebp
+.LVL1091:
+	.loc 1 2447 32 is_stmt 1 view .LVU3894
+	call	ensure_init
+.LVL1092:
+.L1070:
+	.loc 1 2447 48 discriminator 9 view .LVU3895
+	.loc 1 2447 60 discriminator 9 view .LVU3896
+	.loc 1 2447 65 discriminator 9 view .LVU3897
+	.loc 1 2447 69 is_stmt 0 discriminator 9 view .LVU3898
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	set_ast
+.LVL1093:
+	.loc 1 2447 68 discriminator 9 view .LVU3899
+	testb	%al, %al
+	je	.L1069
+	.loc 1 2447 83 discriminator 2 view .LVU3900
+	testb	$32, 32(%rbx)
+	jne	.L1069
+	.loc 1 2447 38 is_stmt 1 discriminator 4 view .LVU3901
+	movq	%r12, %rsi
+	call	render_ptr
+.LVL1094:
+.L1069:
+	.loc 1 2447 94 discriminator 7 view .LVU3902
+	.loc 1 2447 87 discriminator 7 view .LVU3903
+	.loc 1 2447 70 is_stmt 0 discriminator 7 view .LVU3904
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL1095:
+	.loc 1 2447 87 discriminator 7 view .LVU3905
+	cmpl	$1, %eax
+	ja	.L1069
+	.loc 1 2447 105 is_stmt 1 discriminator 8 view .LVU3906
+	testl	%eax, %eax
+	jne	.L1070
+	.loc 1 2447 109 discriminator 10 view .LVU3907
+	.loc 1 2447 112 is_stmt 0 discriminator 10 view .LVU3908
+	testl	%ebp, %ebp
+	je	.L1071
+	.loc 1 2447 121 is_stmt 1 discriminator 11 view .LVU3909
+	movq	%rbx, %rdi
+	call	finish
+.LVL1096:
+.L1071:
+	.loc 1 2447 121 is_stmt 0 discriminator 11 view .LVU3910
+.LBE1259:
+	.loc 1 2447 7 is_stmt 1 discriminator 13 view .LVU3911
+	.loc 1 2448 5 discriminator 13 view .LVU3912
+	.loc 1 2449 1 is_stmt 0 discriminator 13 view .LVU3913
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL1097:
+	.loc 1 2449 1 discriminator 13 view .LVU3914
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL1098:
+	.loc 1 2449 1 discriminator 13 view .LVU3915
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL1099:
+	.loc 1 2449 1 discriminator 13 view .LVU3916
+	ret
+	.cfi_endproc
+.LFE619:
+	.size	va_xprintf_ptr, .-va_xprintf_ptr
+	.globl	va_xprintf_ulong
+	.type	va_xprintf_ulong, @function
+va_xprintf_ulong:
+.LVL1100:
+.LFB621:
+	.loc 1 2457 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2458 5 view .LVU3918
+	.loc 1 2458 12 is_stmt 0 view .LVU3919
+	movl	$8, %edx
+	jmp	xprintf_ull
+.LVL1101:
+	.loc 1 2458 12 view .LVU3920
+	.cfi_endproc
+.LFE621:
+	.size	va_xprintf_ulong, .-va_xprintf_ulong
+	.globl	va_xprintf_ull
+	.type	va_xprintf_ull, @function
+va_xprintf_ull:
+.LFB668:
+	.cfi_startproc
+	.loc 1 2451 21 is_stmt 1 view .LVU3921
+	jmp	va_xprintf_ulong
+	.cfi_endproc
+.LFE668:
+	.size	va_xprintf_ull, .-va_xprintf_ull
+	.globl	va_xprintf_bool
+	.type	va_xprintf_bool, @function
+va_xprintf_bool:
+.LVL1102:
+.LFB622:
+	.loc 1 2462 1 view -0
+	.cfi_startproc
+	.loc 1 2463 5 view .LVU3923
+	.loc 1 2463 12 is_stmt 0 view .LVU3924
+	movl	%esi, %esi
+	.loc 1 2463 12 view .LVU3925
+	jmp	xprintf_bool
+.LVL1103:
+	.loc 1 2463 12 view .LVU3926
+	.cfi_endproc
+.LFE622:
+	.size	va_xprintf_bool, .-va_xprintf_bool
+	.globl	va_xprintf_uint
+	.type	va_xprintf_uint, @function
+va_xprintf_uint:
+.LVL1104:
+.LFB623:
+	.loc 1 2467 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2468 5 view .LVU3928
+	.loc 1 2468 12 is_stmt 0 view .LVU3929
+	movl	%esi, %esi
+	.loc 1 2468 12 view .LVU3930
+	movl	$4, %edx
+	jmp	xprintf_ull
+.LVL1105:
+	.loc 1 2468 12 view .LVU3931
+	.cfi_endproc
+.LFE623:
+	.size	va_xprintf_uint, .-va_xprintf_uint
+	.globl	va_xprintf_ushort
+	.type	va_xprintf_ushort, @function
+va_xprintf_ushort:
+.LVL1106:
+.LFB624:
+	.loc 1 2472 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2473 5 view .LVU3933
+	.loc 1 2473 12 is_stmt 0 view .LVU3934
+	movzwl	%si, %esi
+	.loc 1 2473 12 view .LVU3935
+	movl	$2, %edx
+	jmp	xprintf_ull
+.LVL1107:
+	.loc 1 2473 12 view .LVU3936
+	.cfi_endproc
+.LFE624:
+	.size	va_xprintf_ushort, .-va_xprintf_ushort
+	.globl	va_xprintf_uchar
+	.type	va_xprintf_uchar, @function
+va_xprintf_uchar:
+.LVL1108:
+.LFB625:
+	.loc 1 2477 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2478 5 view .LVU3938
+	.loc 1 2478 12 is_stmt 0 view .LVU3939
+	movzbl	%sil, %esi
+	.loc 1 2478 12 view .LVU3940
+	movl	$1, %edx
+	jmp	xprintf_ull
+.LVL1109:
+	.loc 1 2478 12 view .LVU3941
+	.cfi_endproc
+.LFE625:
+	.size	va_xprintf_uchar, .-va_xprintf_uchar
+	.globl	va_xprintf_slong
+	.type	va_xprintf_slong, @function
+va_xprintf_slong:
+.LVL1110:
+.LFB627:
+	.loc 1 2487 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2488 5 view .LVU3943
+	.loc 1 2488 12 is_stmt 0 view .LVU3944
+	movl	$8, %edx
+	jmp	xprintf_sll
+.LVL1111:
+	.loc 1 2488 12 view .LVU3945
+	.cfi_endproc
+.LFE627:
+	.size	va_xprintf_slong, .-va_xprintf_slong
+	.globl	va_xprintf_sll
+	.type	va_xprintf_sll, @function
+va_xprintf_sll:
+.LFB666:
+	.cfi_startproc
+	.loc 1 2481 21 is_stmt 1 view .LVU3946
+	jmp	va_xprintf_slong
+	.cfi_endproc
+.LFE666:
+	.size	va_xprintf_sll, .-va_xprintf_sll
+	.globl	va_xprintf_sint
+	.type	va_xprintf_sint, @function
+va_xprintf_sint:
+.LVL1112:
+.LFB628:
+	.loc 1 2492 1 view -0
+	.cfi_startproc
+	.loc 1 2493 5 view .LVU3948
+	.loc 1 2493 12 is_stmt 0 view .LVU3949
+	movslq	%esi, %rsi
+	.loc 1 2493 12 view .LVU3950
+	movl	$4, %edx
+	jmp	xprintf_sll
+.LVL1113:
+	.loc 1 2493 12 view .LVU3951
+	.cfi_endproc
+.LFE628:
+	.size	va_xprintf_sint, .-va_xprintf_sint
+	.globl	va_xprintf_short
+	.type	va_xprintf_short, @function
+va_xprintf_short:
+.LVL1114:
+.LFB629:
+	.loc 1 2497 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2498 5 view .LVU3953
+	.loc 1 2498 12 is_stmt 0 view .LVU3954
+	movswq	%si, %rsi
+	.loc 1 2498 12 view .LVU3955
+	movl	$2, %edx
+	jmp	xprintf_sll
+.LVL1115:
+	.loc 1 2498 12 view .LVU3956
+	.cfi_endproc
+.LFE629:
+	.size	va_xprintf_short, .-va_xprintf_short
+	.globl	va_xprintf_schar
+	.type	va_xprintf_schar, @function
+va_xprintf_schar:
+.LVL1116:
+.LFB630:
+	.loc 1 2502 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2503 5 view .LVU3958
+	.loc 1 2503 12 is_stmt 0 view .LVU3959
+	movsbq	%sil, %rsi
+	.loc 1 2503 12 view .LVU3960
+	movl	$1, %edx
+	jmp	xprintf_sll
+.LVL1117:
+	.loc 1 2503 12 view .LVU3961
+	.cfi_endproc
+.LFE630:
+	.size	va_xprintf_schar, .-va_xprintf_schar
+	.globl	va_xprintf_char
+	.type	va_xprintf_char, @function
+va_xprintf_char:
+.LVL1118:
+.LFB631:
+	.loc 1 2507 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2508 5 view .LVU3963
+	.loc 1 2509 9 view .LVU3964
+	.loc 1 2509 16 is_stmt 0 view .LVU3965
+	movsbl	%sil, %esi
+	.loc 1 2509 16 view .LVU3966
+	jmp	va_xprintf_schar
+.LVL1119:
+	.loc 1 2509 16 view .LVU3967
+	.cfi_endproc
+.LFE631:
+	.size	va_xprintf_char, .-va_xprintf_char
+	.globl	va_stream_get_error_f
+	.type	va_stream_get_error_f, @function
+va_stream_get_error_f:
+.LVL1120:
+.LFB632:
+	.loc 1 2517 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2518 5 view .LVU3969
+	.loc 1 2518 23 is_stmt 0 view .LVU3970
+	movl	32(%rdi), %eax
+	shrl	$27, %eax
+	.loc 1 2518 36 view .LVU3971
+	andl	$7, %eax
+	.loc 1 2519 1 view .LVU3972
+	ret
+	.cfi_endproc
+.LFE632:
+	.size	va_stream_get_error_f, .-va_stream_get_error_f
+	.globl	va_xprintf_error_t_p
+	.type	va_xprintf_error_t_p, @function
+va_xprintf_error_t_p:
+.LVL1121:
+.LFB634:
+	.loc 1 2529 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2530 5 view .LVU3974
+	.loc 1 2529 1 is_stmt 0 view .LVU3975
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rax
+	.cfi_def_cfa_offset 32
+	.loc 1 2530 5 view .LVU3976
+	call	ensure_init
+.LVL1122:
+	.loc 1 2531 5 is_stmt 1 view .LVU3977
+.LBB1263:
+.LBI1263:
+	.loc 1 2521 21 view .LVU3978
+.LBB1264:
+	.loc 1 2523 5 view .LVU3979
+	.loc 1 2523 26 is_stmt 0 view .LVU3980
+	movl	32(%rbx), %eax
+	shrl	$27, %eax
+	.loc 1 2523 39 view .LVU3981
+	andl	$7, %eax
+	movl	%eax, 0(%rbp)
+	.loc 1 2524 5 is_stmt 1 view .LVU3982
+.LBB1265:
+	.loc 1 2524 21 view .LVU3983
+.LVL1123:
+	.loc 1 2524 58 view .LVU3984
+.LBE1265:
+.LBE1264:
+.LBE1263:
+	.loc 1 2532 1 is_stmt 0 view .LVU3985
+	movq	%rbx, %rax
+.LBB1268:
+.LBB1267:
+.LBB1266:
+	.loc 1 2524 119 view .LVU3986
+	andl	$-939524097, 32(%rbx)
+.LBE1266:
+	.loc 1 2525 5 is_stmt 1 view .LVU3987
+.LVL1124:
+	.loc 1 2525 5 is_stmt 0 view .LVU3988
+.LBE1267:
+.LBE1268:
+	.loc 1 2532 1 view .LVU3989
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1125:
+	.loc 1 2532 1 view .LVU3990
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1126:
+	.loc 1 2532 1 view .LVU3991
+	ret
+	.cfi_endproc
+.LFE634:
+	.size	va_xprintf_error_t_p, .-va_xprintf_error_t_p
+	.globl	va_xprintf_last_schar
+	.type	va_xprintf_last_schar, @function
+va_xprintf_last_schar:
+.LVL1127:
+.LFB635:
+	.loc 1 2535 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2536 5 view .LVU3993
+	.loc 1 2536 12 is_stmt 0 view .LVU3994
+	orl	$64, 32(%rdi)
+	.loc 1 2537 5 is_stmt 1 view .LVU3995
+	.loc 1 2537 12 is_stmt 0 view .LVU3996
+	movsbl	%sil, %esi
+	.loc 1 2537 12 view .LVU3997
+	jmp	va_xprintf_schar
+.LVL1128:
+	.loc 1 2537 12 view .LVU3998
+	.cfi_endproc
+.LFE635:
+	.size	va_xprintf_last_schar, .-va_xprintf_last_schar
+	.globl	va_xprintf_last_short
+	.type	va_xprintf_last_short, @function
+va_xprintf_last_short:
+.LVL1129:
+.LFB636:
+	.loc 1 2541 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2542 5 view .LVU4000
+	.loc 1 2542 12 is_stmt 0 view .LVU4001
+	orl	$64, 32(%rdi)
+	.loc 1 2543 5 is_stmt 1 view .LVU4002
+	.loc 1 2543 12 is_stmt 0 view .LVU4003
+	movswl	%si, %esi
+	.loc 1 2543 12 view .LVU4004
+	jmp	va_xprintf_short
+.LVL1130:
+	.loc 1 2543 12 view .LVU4005
+	.cfi_endproc
+.LFE636:
+	.size	va_xprintf_last_short, .-va_xprintf_last_short
+	.globl	va_xprintf_last_sint
+	.type	va_xprintf_last_sint, @function
+va_xprintf_last_sint:
+.LVL1131:
+.LFB637:
+	.loc 1 2547 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2548 5 view .LVU4007
+	.loc 1 2548 12 is_stmt 0 view .LVU4008
+	orl	$64, 32(%rdi)
+	.loc 1 2549 5 is_stmt 1 view .LVU4009
+	.loc 1 2549 12 is_stmt 0 view .LVU4010
+	jmp	va_xprintf_sint
+.LVL1132:
+	.loc 1 2549 12 view .LVU4011
+	.cfi_endproc
+.LFE637:
+	.size	va_xprintf_last_sint, .-va_xprintf_last_sint
+	.globl	va_xprintf_last_slong
+	.type	va_xprintf_last_slong, @function
+va_xprintf_last_slong:
+.LVL1133:
+.LFB638:
+	.loc 1 2553 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2554 5 view .LVU4013
+	.loc 1 2554 12 is_stmt 0 view .LVU4014
+	orl	$64, 32(%rdi)
+	.loc 1 2555 5 is_stmt 1 view .LVU4015
+	.loc 1 2555 12 is_stmt 0 view .LVU4016
+	jmp	va_xprintf_slong
+.LVL1134:
+	.loc 1 2555 12 view .LVU4017
+	.cfi_endproc
+.LFE638:
+	.size	va_xprintf_last_slong, .-va_xprintf_last_slong
+	.globl	va_xprintf_last_sll
+	.type	va_xprintf_last_sll, @function
+va_xprintf_last_sll:
+.LFB672:
+	.cfi_startproc
+	.loc 1 2558 21 is_stmt 1 view .LVU4018
+	jmp	va_xprintf_last_slong
+	.cfi_endproc
+.LFE672:
+	.size	va_xprintf_last_sll, .-va_xprintf_last_sll
+	.globl	va_xprintf_last_uchar
+	.type	va_xprintf_last_uchar, @function
+va_xprintf_last_uchar:
+.LVL1135:
+.LFB640:
+	.loc 1 2565 1 view -0
+	.cfi_startproc
+	.loc 1 2566 5 view .LVU4020
+	.loc 1 2566 12 is_stmt 0 view .LVU4021
+	orl	$64, 32(%rdi)
+	.loc 1 2567 5 is_stmt 1 view .LVU4022
+	.loc 1 2567 12 is_stmt 0 view .LVU4023
+	movzbl	%sil, %esi
+	.loc 1 2567 12 view .LVU4024
+	jmp	va_xprintf_uchar
+.LVL1136:
+	.loc 1 2567 12 view .LVU4025
+	.cfi_endproc
+.LFE640:
+	.size	va_xprintf_last_uchar, .-va_xprintf_last_uchar
+	.globl	va_xprintf_last_ushort
+	.type	va_xprintf_last_ushort, @function
+va_xprintf_last_ushort:
+.LVL1137:
+.LFB641:
+	.loc 1 2571 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2572 5 view .LVU4027
+	.loc 1 2572 12 is_stmt 0 view .LVU4028
+	orl	$64, 32(%rdi)
+	.loc 1 2573 5 is_stmt 1 view .LVU4029
+	.loc 1 2573 12 is_stmt 0 view .LVU4030
+	movzwl	%si, %esi
+	.loc 1 2573 12 view .LVU4031
+	jmp	va_xprintf_ushort
+.LVL1138:
+	.loc 1 2573 12 view .LVU4032
+	.cfi_endproc
+.LFE641:
+	.size	va_xprintf_last_ushort, .-va_xprintf_last_ushort
+	.globl	va_xprintf_last_bool
+	.type	va_xprintf_last_bool, @function
+va_xprintf_last_bool:
+.LVL1139:
+.LFB642:
+	.loc 1 2577 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2578 5 view .LVU4034
+	.loc 1 2578 12 is_stmt 0 view .LVU4035
+	orl	$64, 32(%rdi)
+	.loc 1 2579 5 is_stmt 1 view .LVU4036
+.LVL1140:
+.LBB1269:
+.LBI1269:
+	.loc 1 2461 21 view .LVU4037
+.LBB1270:
+	.loc 1 2463 5 view .LVU4038
+	.loc 1 2463 12 is_stmt 0 view .LVU4039
+	movl	%esi, %esi
+	.loc 1 2463 12 view .LVU4040
+	jmp	xprintf_bool
+.LVL1141:
+	.loc 1 2463 12 view .LVU4041
+.LBE1270:
+.LBE1269:
+	.cfi_endproc
+.LFE642:
+	.size	va_xprintf_last_bool, .-va_xprintf_last_bool
+	.globl	va_xprintf_last_uint
+	.type	va_xprintf_last_uint, @function
+va_xprintf_last_uint:
+.LVL1142:
+.LFB643:
+	.loc 1 2583 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2584 5 view .LVU4043
+	.loc 1 2584 12 is_stmt 0 view .LVU4044
+	orl	$64, 32(%rdi)
+	.loc 1 2585 5 is_stmt 1 view .LVU4045
+	.loc 1 2585 12 is_stmt 0 view .LVU4046
+	jmp	va_xprintf_uint
+.LVL1143:
+	.loc 1 2585 12 view .LVU4047
+	.cfi_endproc
+.LFE643:
+	.size	va_xprintf_last_uint, .-va_xprintf_last_uint
+	.globl	va_xprintf_last_ulong
+	.type	va_xprintf_last_ulong, @function
+va_xprintf_last_ulong:
+.LVL1144:
+.LFB644:
+	.loc 1 2589 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2590 5 view .LVU4049
+	.loc 1 2590 12 is_stmt 0 view .LVU4050
+	orl	$64, 32(%rdi)
+	.loc 1 2591 5 is_stmt 1 view .LVU4051
+	.loc 1 2591 12 is_stmt 0 view .LVU4052
+	jmp	va_xprintf_ulong
+.LVL1145:
+	.loc 1 2591 12 view .LVU4053
+	.cfi_endproc
+.LFE644:
+	.size	va_xprintf_last_ulong, .-va_xprintf_last_ulong
+	.globl	va_xprintf_last_ull
+	.type	va_xprintf_last_ull, @function
+va_xprintf_last_ull:
+.LFB674:
+	.cfi_startproc
+	.loc 1 2594 21 is_stmt 1 view .LVU4054
+	jmp	va_xprintf_last_ulong
+	.cfi_endproc
+.LFE674:
+	.size	va_xprintf_last_ull, .-va_xprintf_last_ull
+	.globl	va_xprintf_last_ptr
+	.type	va_xprintf_last_ptr, @function
+va_xprintf_last_ptr:
+.LVL1146:
+.LFB646:
+	.loc 1 2601 1 view -0
+	.cfi_startproc
+	.loc 1 2602 5 view .LVU4056
+	.loc 1 2602 12 is_stmt 0 view .LVU4057
+	orl	$64, 32(%rdi)
+	.loc 1 2603 5 is_stmt 1 view .LVU4058
+	.loc 1 2603 12 is_stmt 0 view .LVU4059
+	jmp	va_xprintf_ptr
+.LVL1147:
+	.loc 1 2603 12 view .LVU4060
+	.cfi_endproc
+.LFE646:
+	.size	va_xprintf_last_ptr, .-va_xprintf_last_ptr
+	.globl	va_xprintf_last_char
+	.type	va_xprintf_last_char, @function
+va_xprintf_last_char:
+.LFB670:
+	.cfi_startproc
+	.loc 1 2606 21 is_stmt 1 view .LVU4061
+	jmp	va_xprintf_last_schar
+	.cfi_endproc
+.LFE670:
+	.size	va_xprintf_last_char, .-va_xprintf_last_char
+	.globl	va_xprintf_last_iter_chunk
+	.type	va_xprintf_last_iter_chunk, @function
+va_xprintf_last_iter_chunk:
+.LVL1148:
+.LFB648:
+	.loc 1 2613 1 view -0
+	.cfi_startproc
+	.loc 1 2614 5 view .LVU4063
+	.loc 1 2614 12 is_stmt 0 view .LVU4064
+	orl	$64, 32(%rdi)
+	.loc 1 2615 5 is_stmt 1 view .LVU4065
+	.loc 1 2615 12 is_stmt 0 view .LVU4066
+	jmp	va_xprintf_iter_chunk
+.LVL1149:
+	.loc 1 2615 12 view .LVU4067
+	.cfi_endproc
+.LFE648:
+	.size	va_xprintf_last_iter_chunk, .-va_xprintf_last_iter_chunk
+	.globl	va_xprintf_last_custom
+	.type	va_xprintf_last_custom, @function
+va_xprintf_last_custom:
+.LVL1150:
+.LFB649:
+	.loc 1 2619 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2620 5 view .LVU4069
+	.loc 1 2620 12 is_stmt 0 view .LVU4070
+	orl	$64, 32(%rdi)
+	.loc 1 2621 5 is_stmt 1 view .LVU4071
+	.loc 1 2621 12 is_stmt 0 view .LVU4072
+	jmp	va_xprintf_custom
+.LVL1151:
+	.loc 1 2621 12 view .LVU4073
+	.cfi_endproc
+.LFE649:
+	.size	va_xprintf_last_custom, .-va_xprintf_last_custom
+	.globl	va_xprintf_last_error_t_p
+	.type	va_xprintf_last_error_t_p, @function
+va_xprintf_last_error_t_p:
+.LVL1152:
+.LFB650:
+	.loc 1 2625 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2626 5 view .LVU4075
+	.loc 1 2625 1 is_stmt 0 view .LVU4076
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	.loc 1 2626 5 view .LVU4077
+	call	ensure_init
+.LVL1153:
+	.loc 1 2627 5 is_stmt 1 view .LVU4078
+	.loc 1 2627 13 is_stmt 0 view .LVU4079
+	movl	32(%rbx), %eax
+	.loc 1 2627 8 view .LVU4080
+	testb	$-32, %ah
+	je	.L1112
+	.loc 1 2629 9 is_stmt 1 view .LVU4081
+.LVL1154:
+.LBB1277:
+.LBI1277:
+	.loc 2 425 20 view .LVU4082
+.LBB1278:
+	.loc 2 427 5 view .LVU4083
+	.loc 2 427 8 is_stmt 0 view .LVU4084
+	testl	$939524096, %eax
+	jne	.L1112
+	.loc 2 428 9 is_stmt 1 view .LVU4085
+.LBB1279:
+	.loc 2 428 25 view .LVU4086
+.LVL1155:
+	.loc 2 428 62 view .LVU4087
+	.loc 2 428 101 is_stmt 0 view .LVU4088
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU4089
+	orl	$805306368, %eax
+	movl	%eax, 32(%rbx)
+.LVL1156:
+.L1112:
+	.loc 2 428 123 view .LVU4090
+.LBE1279:
+.LBE1278:
+.LBE1277:
+	.loc 1 2631 5 is_stmt 1 view .LVU4091
+	.loc 1 2631 12 is_stmt 0 view .LVU4092
+	orl	$64, 32(%rbx)
+	.loc 1 2632 5 is_stmt 1 view .LVU4093
+.L1113:
+	.loc 1 2632 35 discriminator 1 view .LVU4094
+	.loc 1 2632 28 discriminator 1 view .LVU4095
+	.loc 1 2632 12 is_stmt 0 discriminator 1 view .LVU4096
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL1157:
+	.loc 1 2632 28 discriminator 1 view .LVU4097
+	cmpl	$1, %eax
+	ja	.L1113
+	.loc 1 2633 5 is_stmt 1 view .LVU4098
+	movq	%rbx, %rdi
+	call	finish
+.LVL1158:
+	.loc 1 2634 5 view .LVU4099
+.LBB1280:
+.LBI1280:
+	.loc 1 2521 21 view .LVU4100
+.LBB1281:
+	.loc 1 2523 5 view .LVU4101
+	.loc 1 2523 26 is_stmt 0 view .LVU4102
+	movl	32(%rbx), %eax
+	shrl	$27, %eax
+	.loc 1 2523 39 view .LVU4103
+	andl	$7, %eax
+	movl	%eax, 0(%rbp)
+	.loc 1 2524 5 is_stmt 1 view .LVU4104
+.LBB1282:
+	.loc 1 2524 21 view .LVU4105
+.LVL1159:
+	.loc 1 2524 58 view .LVU4106
+.LBE1282:
+.LBE1281:
+.LBE1280:
+	.loc 1 2635 1 is_stmt 0 view .LVU4107
+	movq	%rbx, %rax
+.LBB1285:
+.LBB1284:
+.LBB1283:
+	.loc 1 2524 119 view .LVU4108
+	andl	$-939524097, 32(%rbx)
+.LBE1283:
+	.loc 1 2525 5 is_stmt 1 view .LVU4109
+.LVL1160:
+	.loc 1 2525 5 is_stmt 0 view .LVU4110
+.LBE1284:
+.LBE1285:
+	.loc 1 2635 1 view .LVU4111
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1161:
+	.loc 1 2635 1 view .LVU4112
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1162:
+	.loc 1 2635 1 view .LVU4113
+	ret
+	.cfi_endproc
+.LFE650:
+	.size	va_xprintf_last_error_t_p, .-va_xprintf_last_error_t_p
+	.globl	va_xprintf_init_last
+	.type	va_xprintf_init_last, @function
+va_xprintf_init_last:
+.LVL1163:
+.LFB651:
+	.loc 1 2641 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2642 5 view .LVU4115
+.LBB1286:
+.LBI1286:
+	.file 4 "./include/va_print/core.h"
+	.loc 4 299 28 view .LVU4116
+.LBB1287:
+	.loc 4 304 5 view .LVU4117
+.LBE1287:
+.LBE1286:
+	.loc 1 2641 1 is_stmt 0 view .LVU4118
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 2641 1 view .LVU4119
+	movq	%rdi, %rbx
+.LBB1289:
+.LBB1288:
+	.loc 4 304 12 view .LVU4120
+	movq	%rdx, 8(%rdi)
+	movq	%rsi, 16(%rdi)
+	.loc 4 305 5 is_stmt 1 view .LVU4121
+.LVL1164:
+	.loc 4 305 5 is_stmt 0 view .LVU4122
+.LBE1288:
+.LBE1289:
+	.loc 1 2643 5 is_stmt 1 view .LVU4123
+	call	ensure_init
+.LVL1165:
+	.loc 1 2644 5 view .LVU4124
+	.loc 1 2644 12 is_stmt 0 view .LVU4125
+	orl	$64, 32(%rbx)
+	.loc 1 2645 5 is_stmt 1 view .LVU4126
+.L1120:
+	.loc 1 2645 35 discriminator 1 view .LVU4127
+	.loc 1 2645 28 discriminator 1 view .LVU4128
+	.loc 1 2645 12 is_stmt 0 discriminator 1 view .LVU4129
+	movq	%rbx, %rdi
+	call	parse_format
+.LVL1166:
+	.loc 1 2645 28 discriminator 1 view .LVU4130
+	cmpl	$1, %eax
+	ja	.L1120
+	.loc 1 2646 5 is_stmt 1 view .LVU4131
+	movq	%rbx, %rdi
+	call	finish
+.LVL1167:
+	.loc 1 2647 5 view .LVU4132
+	.loc 1 2648 1 is_stmt 0 view .LVU4133
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL1168:
+	.loc 1 2648 1 view .LVU4134
+	ret
+	.cfi_endproc
+.LFE651:
+	.size	va_xprintf_init_last, .-va_xprintf_init_last
+	.globl	va_format_compile_f
+	.type	va_format_compile_f, @function
+va_format_compile_f:
+.LVL1169:
+.LFB652:
+	.loc 1 2654 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2655 5 view .LVU4136
+	.loc 1 2654 1 is_stmt 0 view .LVU4137
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$200, %rsp
+	.cfi_def_cfa_offset 256
+	.loc 1 2655 8 view .LVU4138
+	testq	%rsi, %rsi
+	je	.L1124
+	.loc 1 2655 20 discriminator 1 view .LVU4139
+	cmpq	$0, 8(%rdx)
+	movq	%rdx, %r12
+	je	.L1129
+	.loc 1 2660 19 view .LVU4140
+	xorl	%eax, %eax
+	movq	%rdi, %r15
+	.loc 1 2660 5 is_stmt 1 view .LVU4141
+	.loc 1 2660 19 is_stmt 0 view .LVU4142
+	movl	$24, %ecx
+	movq	%rsi, 80(%rsp)
+	leaq	96(%rsp), %rdi
+.LVL1170:
+	.loc 1 2660 19 view .LVU4143
+	movq	%rdx, 88(%rsp)
+	.loc 1 2661 5 is_stmt 1 view .LVU4144
+.LBB1290:
+	.loc 1 2665 22 is_stmt 0 view .LVU4145
+	leaq	64(%rsp), %rbx
+.LBE1290:
+	.loc 1 2660 19 view .LVU4146
+	rep stosl
+	.loc 1 2661 5 view .LVU4147
+	leaq	80(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 24(%rsp)
+	call	format_scan
+.LVL1171:
+	.loc 1 2663 5 is_stmt 1 view .LVU4148
+	.loc 1 2663 20 is_stmt 0 view .LVU4149
+	movq	%r12, 64(%rsp)
+	movq	%rbp, 72(%rsp)
+.L1125:
+	.loc 1 2664 5 is_stmt 1 view .LVU4150
+.LBB1291:
+	.loc 1 2665 9 view .LVU4151
+	.loc 1 2665 22 is_stmt 0 view .LVU4152
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	call	*8(%r12)
+.LVL1172:
+	.loc 1 2666 9 is_stmt 1 view .LVU4153
+	.loc 1 2666 22 is_stmt 0 view .LVU4154
+	decl	%eax
+.LVL1173:
+	.loc 1 2666 12 view .LVU4155
+	cmpl	$-3, %eax
+	jbe	.L1125
+.LBE1291:
+	.loc 1 2670 5 is_stmt 1 view .LVU4156
+	.loc 1 2670 28 is_stmt 0 view .LVU4157
+	movb	51(%r12), %cl
+	.loc 1 2670 44 view .LVU4158
+	movl	$1, %r13d
+	testb	%cl, %cl
+	je	.L1126
+	.loc 1 2670 68 discriminator 1 view .LVU4159
+	decl	%ecx
+	.loc 1 2670 44 discriminator 1 view .LVU4160
+	sall	%cl, %r13d
+.L1126:
+.LVL1174:
+	.loc 1 2671 5 is_stmt 1 discriminator 4 view .LVU4161
+	.loc 1 2671 54 is_stmt 0 discriminator 4 view .LVU4162
+	movq	72(%rsp), %rax
+.LVL1175:
+	.loc 1 2681 15 discriminator 4 view .LVU4163
+	xorl	%edi, %edi
+	.loc 1 2675 44 discriminator 4 view .LVU4164
+	imulq	$88, 144(%rsp), %r8
+	.loc 1 2681 15 discriminator 4 view .LVU4165
+	movl	$1, %edx
+	.loc 1 2677 12 discriminator 4 view .LVU4166
+	movq	184(%rsp), %r9
+	.loc 1 2679 12 discriminator 4 view .LVU4167
+	movq	176(%rsp), %r11
+	.loc 1 2671 54 discriminator 4 view .LVU4168
+	subq	%rbp, %rax
+	movq	%rax, 8(%rsp)
+.LVL1176:
+	.loc 1 2674 5 is_stmt 1 discriminator 4 view .LVU4169
+	.loc 1 2675 5 discriminator 4 view .LVU4170
+	.loc 1 2676 43 is_stmt 0 discriminator 4 view .LVU4171
+	movq	152(%rsp), %rax
+.LVL1177:
+	.loc 1 2675 12 discriminator 4 view .LVU4172
+	addq	$104, %r8
+.LVL1178:
+	.loc 1 2676 5 is_stmt 1 discriminator 4 view .LVU4173
+	.loc 1 2676 12 is_stmt 0 discriminator 4 view .LVU4174
+	movq	%r8, 56(%rsp)
+	.loc 1 2676 43 discriminator 4 view .LVU4175
+	salq	$5, %rax
+	.loc 1 2676 12 discriminator 4 view .LVU4176
+	addq	%r8, %rax
+	.loc 1 2677 12 discriminator 4 view .LVU4177
+	addq	%rax, %r9
+	.loc 1 2676 12 discriminator 4 view .LVU4178
+	movq	%rax, 16(%rsp)
+.LVL1179:
+	.loc 1 2677 5 is_stmt 1 discriminator 4 view .LVU4179
+	.loc 1 2678 5 discriminator 4 view .LVU4180
+	.loc 1 2678 35 is_stmt 0 discriminator 4 view .LVU4181
+	movq	8(%rsp), %rax
+.LVL1180:
+	.loc 1 2678 35 discriminator 4 view .LVU4182
+	movq	%r9, 48(%rsp)
+	leaq	(%rax,%r9), %r10
+.LVL1181:
+.LBB1292:
+.LBI1292:
+	.loc 1 2401 15 is_stmt 1 discriminator 4 view .LVU4183
+.LBB1293:
+	.loc 1 2403 5 discriminator 4 view .LVU4184
+	.loc 1 2403 15 is_stmt 0 discriminator 4 view .LVU4185
+	leaq	3(%r10,%r13), %r14
+	movq	%r10, 40(%rsp)
+	.loc 1 2403 20 discriminator 4 view .LVU4186
+	andq	$-4, %r14
+.LVL1182:
+	.loc 1 2403 20 discriminator 4 view .LVU4187
+.LBE1293:
+.LBE1292:
+	.loc 1 2679 5 is_stmt 1 discriminator 4 view .LVU4188
+	.loc 1 2679 12 is_stmt 0 discriminator 4 view .LVU4189
+	addq	%r14, %r11
+.LVL1183:
+	.loc 1 2680 5 is_stmt 1 discriminator 4 view .LVU4190
+	.loc 1 2681 5 discriminator 4 view .LVU4191
+	.loc 1 2680 12 is_stmt 0 discriminator 4 view .LVU4192
+	movq	%r11, %rsi
+	movq	%r11, 32(%rsp)
+	addq	168(%rsp), %rsi
+.LVL1184:
+	.loc 1 2681 15 discriminator 4 view .LVU4193
+	call	*%r15
+.LVL1185:
+	.loc 1 2682 8 discriminator 4 view .LVU4194
+	movq	32(%rsp), %r11
+	movq	40(%rsp), %r10
+	testq	%rax, %rax
+	movq	48(%rsp), %r9
+	movq	56(%rsp), %r8
+	.loc 1 2681 15 discriminator 4 view .LVU4195
+	movq	%rax, %rbx
+.LVL1186:
+	.loc 1 2682 5 is_stmt 1 discriminator 4 view .LVU4196
+	.loc 1 2682 8 is_stmt 0 discriminator 4 view .LVU4197
+	jne	.L1127
+.LVL1187:
+.L1128:
+	.loc 1 2656 15 view .LVU4198
+	movq	%rbx, %rbp
+.LVL1188:
+	.loc 1 2656 15 view .LVU4199
+	jmp	.L1124
+.LVL1189:
+.L1127:
+	.loc 1 2686 5 is_stmt 1 view .LVU4200
+	.loc 1 2687 5 view .LVU4201
+	.loc 1 2687 13 is_stmt 0 view .LVU4202
+	movq	%rax, %rdi
+	movl	$14, %ecx
+	movq	%r12, %rsi
+	.loc 1 2689 14 view .LVU4203
+	addq	%rbx, %r9
+	.loc 1 2687 13 view .LVU4204
+	rep movsl
+	.loc 1 2688 5 is_stmt 1 view .LVU4205
+	.loc 1 2688 18 is_stmt 0 view .LVU4206
+	leaq	va_format_type(%rip), %rax
+.LVL1190:
+	.loc 1 2690 24 view .LVU4207
+	addq	%rbx, %r10
+	.loc 1 2689 5 view .LVU4208
+	movq	%r9, %rdi
+	.loc 1 2688 18 view .LVU4209
+	movq	%rax, (%rbx)
+	.loc 1 2689 5 is_stmt 1 view .LVU4210
+	movq	8(%rsp), %rcx
+	.loc 1 2690 5 is_stmt 0 view .LVU4211
+	xorl	%eax, %eax
+	.loc 1 2689 5 view .LVU4212
+	movq	%rbp, %rsi
+	rep movsb
+	.loc 1 2690 5 is_stmt 1 view .LVU4213
+	movq	%r10, %rdi
+	movq	%r13, %rcx
+	.loc 1 2699 45 is_stmt 0 view .LVU4214
+	addq	%rbx, %r8
+	.loc 1 2690 5 view .LVU4215
+	rep stosb
+	.loc 1 2691 5 is_stmt 1 view .LVU4216
+	.loc 1 2695 7 is_stmt 0 view .LVU4217
+	xorl	%eax, %eax
+	leaq	112(%rsp), %rdi
+	movl	$20, %ecx
+	.loc 1 2691 12 view .LVU4218
+	movq	%r9, 56(%rbx)
+	.loc 1 2692 5 is_stmt 1 view .LVU4219
+	.loc 1 2700 26 is_stmt 0 view .LVU4220
+	addq	%rbx, %r11
+	.loc 1 2700 36 view .LVU4221
+	addq	%rbx, %r14
+.LVL1191:
+	.loc 1 2692 14 view .LVU4222
+	movq	%r15, 96(%rbx)
+	.loc 1 2695 5 is_stmt 1 view .LVU4223
+	.loc 1 2695 7 is_stmt 0 view .LVU4224
+	rep stosl
+	.loc 1 2698 43 view .LVU4225
+	leaq	104(%rbx), %rax
+	.loc 1 2702 5 view .LVU4226
+	movq	24(%rsp), %rdi
+	.loc 1 2695 7 view .LVU4227
+	movq	%rbp, 80(%rsp)
+	.loc 1 2698 43 view .LVU4228
+	movq	%rax, 96(%rsp)
+	.loc 1 2700 47 view .LVU4229
+	movq	16(%rsp), %rax
+	.loc 1 2695 7 view .LVU4230
+	movq	%r12, 88(%rsp)
+	.loc 1 2700 47 view .LVU4231
+	addq	%rbx, %rax
+	.loc 1 2699 45 view .LVU4232
+	movq	%r8, 104(%rsp)
+	.loc 1 2700 47 view .LVU4233
+	movq	%rax, 136(%rsp)
+	.loc 1 2702 5 is_stmt 1 view .LVU4234
+	.loc 1 2700 26 is_stmt 0 view .LVU4235
+	movq	%r11, 120(%rsp)
+	.loc 1 2700 36 view .LVU4236
+	movq	%r14, 128(%rsp)
+	.loc 1 2702 5 view .LVU4237
+	call	format_scan
+.LVL1192:
+	.loc 1 2703 5 is_stmt 1 view .LVU4238
+	.loc 1 2703 12 is_stmt 0 view .LVU4239
+	movq	96(%rsp), %rax
+	movq	%rax, 64(%rbx)
+	.loc 1 2704 5 is_stmt 1 view .LVU4240
+	.loc 1 2704 16 is_stmt 0 view .LVU4241
+	movq	144(%rsp), %rax
+	movq	%rax, 72(%rbx)
+	.loc 1 2705 5 is_stmt 1 view .LVU4242
+	.loc 1 2705 13 is_stmt 0 view .LVU4243
+	movq	104(%rsp), %rax
+	movq	%rax, 80(%rbx)
+	.loc 1 2706 5 is_stmt 1 view .LVU4244
+	.loc 1 2706 17 is_stmt 0 view .LVU4245
+	movq	152(%rsp), %rax
+	movq	%rax, 88(%rbx)
+	.loc 1 2707 5 is_stmt 1 view .LVU4246
+	.loc 1 2707 12 is_stmt 0 view .LVU4247
+	jmp	.L1128
+.LVL1193:
+.L1129:
+	.loc 1 2656 15 view .LVU4248
+	xorl	%ebp, %ebp
+.LVL1194:
+.L1124:
+	.loc 1 2708 1 view .LVU4249
+	addq	$200, %rsp
+	.cfi_def_cfa_offset 56
+	movq	%rbp, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE652:
+	.size	va_format_compile_f, .-va_format_compile_f
+	.globl	va_format_free
+	.type	va_format_free, @function
+va_format_free:
+.LVL1195:
+.LFB653:
+	.loc 1 2711 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2712 5 view .LVU4251
+	.loc 1 2712 8 is_stmt 0 view .LVU4252
+	testq	%rdi, %rdi
+	je	.L1137
+	.loc 1 2713 9 is_stmt 1 view .LVU4253
+	movq	96(%rdi), %rax
+	movl	$1, %edx
+	xorl	%esi, %esi
+	jmp	*%rax
+.LVL1196:
+.L1137:
+	.loc 1 2715 1 is_stmt 0 view .LVU4254
+	ret
+	.cfi_endproc
+.LFE653:
+	.size	va_format_free, .-va_format_free
+	.globl	va_xprintf_init_last_plain
+	.type	va_xprintf_init_last_plain, @function
+va_xprintf_init_last_plain:
+.LVL1197:
+.LFB654:
+	.loc 1 2721 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2722 5 view .LVU4256
+.LBB1294:
+.LBI1294:
+	.loc 4 299 28 view .LVU4257
+.LBB1295:
+	.loc 4 304 5 view .LVU4258
+.LBE1295:
+.LBE1294:
+	.loc 1 2721 1 is_stmt 0 view .LVU4259
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+.LBB1297:
+.LBB1296:
+	.loc 4 304 12 view .LVU4260
+	movq	%rdx, 8(%rdi)
+	movq	%rsi, 16(%rdi)
+	.loc 4 305 5 is_stmt 1 view .LVU4261
+.LVL1198:
+	.loc 4 305 5 is_stmt 0 view .LVU4262
+.LBE1296:
+.LBE1297:
+	.loc 1 2723 5 is_stmt 1 view .LVU4263
+	call	ensure_init_stream
+.LVL1199:
+	.loc 1 2724 5 view .LVU4264
+	.loc 1 2724 8 is_stmt 0 view .LVU4265
+	testb	$-32, 33(%rbx)
+	jne	.L1140
+	.loc 1 2725 16 discriminator 1 view .LVU4266
+	movq	8(%rbx), %rax
+	.loc 1 2724 52 discriminator 1 view .LVU4267
+	cmpq	$0, 32(%rax)
+	je	.L1140
+	.loc 1 2726 11 view .LVU4268
+	movq	(%rbx), %rsi
+	.loc 1 2726 17 view .LVU4269
+	movb	48(%rsi), %dl
+	.loc 1 2725 36 view .LVU4270
+	testb	%dl, %dl
+	je	.L1140
+	.loc 1 2728 9 is_stmt 1 view .LVU4271
+	.loc 1 2728 12 is_stmt 0 view .LVU4272
+	cmpq	$0, 40(%rsi)
+	.loc 1 2729 42 view .LVU4273
+	movb	51(%rax), %cl
+	.loc 1 2728 12 view .LVU4274
+	je	.L1141
+	.loc 1 2728 39 discriminator 1 view .LVU4275
+	cmpb	%cl, %dl
+	je	.L1142
+	.loc 1 2729 49 view .LVU4276
+	cmpq	$0, 40(%rax)
+	je	.L1140
+.L1142:
+	.loc 1 2732 13 is_stmt 1 view .LVU4277
+	leaq	8(%rbx), %rsi
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	call	iter_len_bulk
+.LVL1200:
+	jmp	.L1140
+.L1141:
+	.loc 1 2735 9 view .LVU4278
+	.loc 1 2735 12 is_stmt 0 view .LVU4279
+	cmpb	%cl, %dl
+	jne	.L1143
+	.loc 1 2736 13 is_stmt 1 view .LVU4280
+	leaq	8(%rbx), %rsi
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	call	iter_copy_bulk
+.LVL1201:
+	jmp	.L1140
+.L1143:
+	.loc 1 2739 9 view .LVU4281
+	.loc 1 2739 12 is_stmt 0 view .LVU4282
+	cmpq	$0, 40(%rax)
+	je	.L1140
+	.loc 1 2740 13 is_stmt 1 view .LVU4283
+	leaq	8(%rbx), %rsi
+	xorl	%edx, %edx
+	movq	%rbx, %rdi
+	call	iter_transcode_bulk
+.LVL1202:
+.L1140:
+	.loc 1 2745 5 view .LVU4284
+	.loc 1 2745 12 is_stmt 0 view .LVU4285
+	movq	16(%rbx), %rsi
+	movq	%rbp, %rdx
+	.loc 1 2746 1 view .LVU4286
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	.loc 1 2745 12 view .LVU4287
+	movq	%rbx, %rdi
+	.loc 1 2746 1 view .LVU4288
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL1203:
+	.loc 1 2746 1 view .LVU4289
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL1204:
+	.loc 1 2745 12 view .LVU4290
+	jmp	va_xprintf_init_last
+.LVL1205:
+	.loc 1 2745 12 view .LVU4291
+	.cfi_endproc
+.LFE654:
+	.size	va_xprintf_init_last_plain, .-va_xprintf_init_last_plain
+	.globl	va_strerror
+	.type	va_strerror, @function
+va_strerror:
+.LVL1206:
+.LFB655:
+	.loc 1 2749 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 2750 5 view .LVU4293
+	.loc 1 2755 5 view .LVU4294
+	.loc 1 2758 11 is_stmt 0 view .LVU4295
+	xorl	%eax, %eax
+	.loc 1 2755 8 view .LVU4296
+	cmpl	$6, %edi
+	ja	.L1148
+	.loc 1 2756 9 is_stmt 1 view .LVU4297
+	.loc 1 2756 20 is_stmt 0 view .LVU4298
+	movl	%edi, %edi
+	.loc 1 2756 20 view .LVU4299
+	leaq	name.0(%rip), %rax
+	movq	(%rax,%rdi,8), %rax
+.LVL1207:
+.L1148:
+	.loc 1 2759 1 view .LVU4300
+	ret
+	.cfi_endproc
+.LFE655:
+	.size	va_strerror, .-va_strerror
+	.section	.rodata.str1.1
+.LC21:
+	.string	"VA_E_OK"
+.LC22:
+	.string	"VA_E_NULL"
+.LC23:
+	.string	"VA_E_DECODE"
+.LC24:
+	.string	"VA_E_ENCODE"
+.LC25:
+	.string	"VA_E_TRUNC"
+.LC26:
+	.string	"VA_E_FORMAT"
+.LC27:
+	.string	"VA_E_ARGC"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	name.0, @object
+	.size	name.0, 56
+name.0:
+	.quad	.LC21
+	.quad	.LC22
+	.quad	.LC23
+	.quad	.LC24
+	.quad	.LC25
+	.quad	.LC26
+	.quad	.LC27
+	.section	.rodata.str1.1
+.LC28:
+	.string	"int8_t"
+.LC29:
+	.string	"int16_t"
+.LC30:
+	.string	"int32_t"
+.LC31:
+	.string	"int64_t"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	type_name.1, @object
+	.size	type_name.1, 64
+type_name.1:
+	.quad	.LC28
+	.quad	.LC29
+	.zero	8
+	.quad	.LC30
+	.zero	24
+	.quad	.LC31
+	.align 32
+	.type	vtab.2, @object
+	.size	vtab.2, 64
+vtab.2:
+	.quad	arr1_vtab_8
+	.quad	arr1_vtab_16
+	.zero	8
+	.quad	arr1_vtab_32
+	.zero	24
+	.quad	arr1_vtab_32
+	.section	.rodata.str1.1
+.LC32:
+	.string	"uint8_t"
+.LC33:
+	.string	"uint16_t"
+.LC34:
+	.string	"uint32_t"
+.LC35:
+	.string	"uint64_t"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	type_name.3, @object
+	.size	type_name.3, 64
+type_name.3:
+	.quad	.LC32
+	.quad	.LC33
+	.zero	8
+	.quad	.LC34
+	.zero	24
+	.quad	.LC35
+	.section	.rodata
+	.align 8
+	.type	__PRETTY_FUNCTION__.4, @object
+	.size	__PRETTY_FUNCTION__.4, 14
+__PRETTY_FUNCTION__.4:
+	.string	"render_custom"
+	.align 8
+	.type	__PRETTY_FUNCTION__.5, @object
+	.size	__PRETTY_FUNCTION__.5, 13
+__PRETTY_FUNCTION__.5:
+	.string	"parse_format"
+	.align 8
+	.type	__PRETTY_FUNCTION__.6, @object
+	.size	__PRETTY_FUNCTION__.6, 14
+__PRETTY_FUNCTION__.6:
+	.string	"render_rawstr"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	format_scratch_vtab, @object
+	.size	format_scratch_vtab, 56
+format_scratch_vtab:
+	.zero	8
+	.quad	format_scratch_put
+	.zero	40
+	.align 32
+	.type	arr1_vtab_32, @object
+	.size	arr1_vtab_32, 56
+arr1_vtab_32:
+	.quad	0
+	.quad	arr1_utf64_take
+	.quad	arr1_utf64_end
+	.quad	0
+	.quad	0
+	.quad	0
+	.byte	1
+	.byte	0
+	.byte	85
+	.byte	0
+	.string	""
+	.string	""
+	.zero	2
+	.align 32
+	.type	arr1_vtab_16, @object
+	.size	arr1_vtab_16, 56
+arr1_vtab_16:
+	.quad	0
+	.quad	arr1_utf64_take
+	.quad	arr1_utf64_end
+	.quad	0
+	.quad	0
+	.quad	0
+	.byte	1
+	.byte	0
+	.byte	117
+	.byte	0
+	.string	""
+	.string	""
+	.zero	2
+	.align 32
+	.type	arr1_vtab_8, @object
+	.size	arr1_vtab_8, 56
+arr1_vtab_8:
+	.quad	0
+	.quad	arr1_utf64_take
+	.quad	arr1_utf64_end
+	.quad	0
+	.quad	0
+	.quad	0
+	.byte	1
+	.byte	0
+	.byte	0
+	.byte	0
+	.string	""
+	.string	""
+	.zero	2
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	custom_put_vtab, @object
+	.size	custom_put_vtab, 56
+custom_put_vtab:
+	.zero	8
+	.quad	custom_put
+	.zero	40
+	.align 32
+	.type	custom_needquote_vtab, @object
+	.size	custom_needquote_vtab, 56
+custom_needquote_vtab:
+	.zero	8
+	.quad	custom_needquote
+	.zero	40
+	.section	.data.rel.ro.local
+	.align 32
+	.type	ahead_vtab, @object
+	.size	ahead_vtab, 56
+ahead_vtab:
+	.zero	8
+	.quad	ahead_put
+	.zero	40
+	.section	.tbss,"awT",@nobits
+	.align 8
+	.type	va_quote_thread, @object
+	.size	va_quote_thread, 8
+va_quote_thread:
+	.zero	8
+	.section	.data.rel.local
+	.align 32
+	.type	va_quote, @object
+	.size	va_quote, 64
+va_quote:
+	.zero	8
+	.quad	quote_sh
+	.quad	quote_c
+	.quad	quote_j
+	.zero	32
+	.align 32
+	.type	quote_sh, @object
+	.size	quote_sh, 56
+quote_sh:
+	.quad	167506280448
+	.quad	167506280448
+	.quad	check_quote_sh
+	.quad	check_flush_sh
+	.quad	render_quote_sh
+	.zero	16
+	.align 32
+	.type	quote_j, @object
+	.size	quote_j, 56
+quote_j:
+	.quad	167506280448
+	.quad	146031116288
+	.quad	0
+	.zero	8
+	.quad	render_quote_j
+	.zero	16
+	.align 32
+	.type	quote_c, @object
+	.size	quote_c, 56
+quote_c:
+	.quad	167506345728
+	.quad	146031181568
+	.quad	0
+	.zero	8
+	.quad	render_quote_c
+	.zero	16
+	.globl	va_format_read_vtab
+	.section	.data.rel.ro.local
+	.align 32
+	.type	va_format_read_vtab, @object
+	.size	va_format_read_vtab, 56
+va_format_read_vtab:
+	.quad	va_format_type
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_format_type
+	.section	.rodata
+	.align 8
+	.type	va_format_type, @object
+	.size	va_format_type, 13
+va_format_type:
+	.string	"va_format_t*"
+	.align 32
+	.type	digit_pair, @object
+	.size	digit_pair, 200
+digit_pair:
+	.ascii	"000102030405060708091011121314151617181920212223242526272829"
+	.ascii	"303132333435363738394041424344454647484950515253545556575859"
+	.ascii	"606162636465666768697071727374757677787980818283848586878889"
+	.ascii	"90919293949596979899"
+	.section	.rodata.str1.1
+.LC36:
+	.string	"abcdefghijklmnopqrstuvwxyz234567"
+.LC37:
+	.string	"ABCDEFGHIJKLMNOPQRSTUVWXYZ234567"
+	.section	.data.rel.local
+	.align 16
+	.type	digit2_b32, @object
+	.size	digit2_b32, 16
+digit2_b32:
+	.quad	.LC36
+	.quad	.LC37
+	.section	.rodata.str1.1
+.LC38:
+	.string	"0123456789abcdefghijklmnopqrstuvwxyz"
+.LC39:
+	.string	"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+	.section	.data.rel.local
+	.align 16
+	.type	digit2_std, @object
+	.size	digit2_std, 16
+digit2_std:
+	.quad	.LC38
+	.quad	.LC39
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.byte	31
+	.align 16
+.LC1:
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.byte	127
+	.align 16
+.LC2:
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.byte	34
+	.align 16
+.LC3:
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.byte	39
+	.align 16
+.LC4:
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.byte	92
+	.align 16
+.LC5:
+	.quad	2314885530818453536
+	.quad	2314885530818453536
+	.align 16
+.LC6:
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.byte	42
+	.align 16
+.LC7:
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.byte	57
+	.align 16
+.LC8:
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.byte	95
+	.align 16
+.LC9:
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.byte	96
+	.align 16
+.LC10:
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.byte	122
+	.text
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 7 "/usr/include/uchar.h"
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdatomic.h"
+	.file 9 "./include/va_print/base.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/assert.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7f37
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x5d
+	.long	.LASF1434
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5e
+	.byte	0x7
+	.byte	0x4
+	.long	0x65
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x65
+	.uleb128 0x3b
+	.long	.LASF1116
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF1117
+	.byte	0x1
+	.uleb128 0x3b
+	.long	.LASF1118
+	.byte	0x2
+	.uleb128 0x3b
+	.long	.LASF1119
+	.byte	0x3
+	.uleb128 0x3b
+	.long	.LASF1120
+	.byte	0x4
+	.uleb128 0x3b
+	.long	.LASF1121
+	.byte	0x5
+	.byte	0
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1122
+	.uleb128 0x25
+	.long	0x65
+	.uleb128 0x24
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1123
+	.uleb128 0x25
+	.long	0x71
+	.uleb128 0x24
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1124
+	.uleb128 0x25
+	.long	0x7d
+	.uleb128 0x14
+	.long	0x7d
+	.uleb128 0x24
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1125
+	.uleb128 0x25
+	.long	0x8e
+	.uleb128 0x24
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1126
+	.uleb128 0x25
+	.long	0x9a
+	.uleb128 0x14
+	.long	0x9a
+	.uleb128 0x24
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1127
+	.uleb128 0x25
+	.long	0xab
+	.uleb128 0x24
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1128
+	.uleb128 0x25
+	.long	0xb7
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x25
+	.long	0xc3
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1129
+	.uleb128 0x25
+	.long	0xcf
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1130
+	.uleb128 0x25
+	.long	0xdb
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1131
+	.uleb128 0x25
+	.long	0xe7
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1132
+	.uleb128 0x25
+	.long	0xf3
+	.uleb128 0x43
+	.byte	0x1
+	.byte	0x8
+	.byte	0xda
+	.byte	0x11
+	.long	0x116
+	.uleb128 0x21
+	.long	.LASF1141
+	.byte	0x8
+	.byte	0xdd
+	.byte	0x9
+	.long	0x71
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	0xff
+	.uleb128 0x29
+	.long	.LASF1134
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0xdb
+	.uleb128 0x8
+	.long	0x89
+	.uleb128 0x14
+	.long	0x127
+	.uleb128 0x24
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1133
+	.uleb128 0x29
+	.long	.LASF1135
+	.byte	0x6
+	.byte	0x28
+	.byte	0x1c
+	.long	0xb7
+	.uleb128 0x29
+	.long	.LASF1136
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x16
+	.long	0x65
+	.uleb128 0x29
+	.long	.LASF1137
+	.byte	0x6
+	.byte	0x37
+	.byte	0x14
+	.long	0x138
+	.uleb128 0x29
+	.long	.LASF1138
+	.byte	0x6
+	.byte	0x39
+	.byte	0x14
+	.long	0x144
+	.uleb128 0x60
+	.byte	0x8
+	.uleb128 0x8
+	.long	0x7d
+	.uleb128 0x19
+	.long	0x7d
+	.long	0x17f
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x3
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1139
+	.byte	0x7
+	.byte	0x33
+	.byte	0x1a
+	.long	0x150
+	.uleb128 0x14
+	.long	0x17f
+	.uleb128 0x29
+	.long	.LASF1140
+	.byte	0x7
+	.byte	0x34
+	.byte	0x1a
+	.long	0x15c
+	.uleb128 0x14
+	.long	0x190
+	.uleb128 0x43
+	.byte	0x38
+	.byte	0x9
+	.byte	0xc1
+	.byte	0x9
+	.long	0x23a
+	.uleb128 0x21
+	.long	.LASF1142
+	.byte	0x9
+	.byte	0xc4
+	.byte	0x11
+	.long	0x127
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1143
+	.byte	0x9
+	.byte	0xd3
+	.byte	0x10
+	.long	0x289
+	.byte	0x8
+	.uleb128 0x32
+	.string	"end"
+	.byte	0x9
+	.byte	0xd7
+	.byte	0x13
+	.long	0x2a2
+	.byte	0x10
+	.uleb128 0x21
+	.long	.LASF1144
+	.byte	0x9
+	.byte	0xdb
+	.byte	0xc
+	.long	0x2b2
+	.byte	0x18
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x9
+	.byte	0xe2
+	.byte	0xe
+	.long	0x2df
+	.byte	0x20
+	.uleb128 0x21
+	.long	.LASF1146
+	.byte	0x9
+	.byte	0xec
+	.byte	0xe
+	.long	0x302
+	.byte	0x28
+	.uleb128 0x21
+	.long	.LASF1147
+	.byte	0x9
+	.byte	0xf1
+	.byte	0x13
+	.long	0x9a
+	.byte	0x30
+	.uleb128 0x21
+	.long	.LASF1148
+	.byte	0x9
+	.byte	0xf5
+	.byte	0x13
+	.long	0x9a
+	.byte	0x31
+	.uleb128 0x21
+	.long	.LASF1149
+	.byte	0x9
+	.byte	0xf9
+	.byte	0x13
+	.long	0x9a
+	.byte	0x32
+	.uleb128 0x32
+	.string	"enc"
+	.byte	0x9
+	.byte	0xfd
+	.byte	0x13
+	.long	0x9a
+	.byte	0x33
+	.uleb128 0x21
+	.long	.LASF1150
+	.byte	0x9
+	.byte	0xff
+	.byte	0xa
+	.long	0x16f
+	.byte	0x34
+	.byte	0
+	.uleb128 0x33
+	.long	0x65
+	.long	0x24e
+	.uleb128 0xe
+	.long	0x24e
+	.uleb128 0xe
+	.long	0x283
+	.byte	0
+	.uleb128 0x8
+	.long	0x253
+	.uleb128 0x44
+	.long	.LASF1158
+	.byte	0x10
+	.byte	0x9
+	.value	0x132
+	.byte	0x10
+	.long	0x27e
+	.uleb128 0xf
+	.long	.LASF1151
+	.byte	0x9
+	.value	0x135
+	.byte	0x20
+	.long	0x319
+	.byte	0
+	.uleb128 0x17
+	.string	"cur"
+	.byte	0x9
+	.value	0x138
+	.byte	0x11
+	.long	0x283
+	.byte	0x8
+	.byte	0
+	.uleb128 0x14
+	.long	0x253
+	.uleb128 0x8
+	.long	0x288
+	.uleb128 0x61
+	.uleb128 0x8
+	.long	0x23a
+	.uleb128 0x33
+	.long	0x283
+	.long	0x2a2
+	.uleb128 0xe
+	.long	0x24e
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x8
+	.long	0x28e
+	.uleb128 0x3c
+	.long	0x2b2
+	.uleb128 0xe
+	.long	0x24e
+	.byte	0
+	.uleb128 0x8
+	.long	0x2a7
+	.uleb128 0x33
+	.long	0x11b
+	.long	0x2d5
+	.uleb128 0xe
+	.long	0x2d5
+	.uleb128 0xe
+	.long	0x283
+	.uleb128 0xe
+	.long	0x11b
+	.uleb128 0xe
+	.long	0x2da
+	.byte	0
+	.uleb128 0x8
+	.long	0x27e
+	.uleb128 0x8
+	.long	0x11b
+	.uleb128 0x8
+	.long	0x2b7
+	.uleb128 0x33
+	.long	0x11b
+	.long	0x302
+	.uleb128 0xe
+	.long	0x168
+	.uleb128 0xe
+	.long	0x9a
+	.uleb128 0xe
+	.long	0x283
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x8
+	.long	0x2e4
+	.uleb128 0x22
+	.long	.LASF1152
+	.byte	0x9
+	.value	0x100
+	.byte	0x3
+	.long	0x1a1
+	.uleb128 0x14
+	.long	0x307
+	.uleb128 0x8
+	.long	0x314
+	.uleb128 0x14
+	.long	0x319
+	.uleb128 0x22
+	.long	.LASF1153
+	.byte	0x9
+	.value	0x139
+	.byte	0x3
+	.long	0x253
+	.uleb128 0x37
+	.byte	0x68
+	.byte	0x9
+	.value	0x151
+	.long	0x39c
+	.uleb128 0xf
+	.long	.LASF1151
+	.byte	0x9
+	.value	0x154
+	.byte	0x19
+	.long	0x307
+	.byte	0
+	.uleb128 0x17
+	.string	"fmt"
+	.byte	0x9
+	.value	0x158
+	.byte	0x11
+	.long	0x283
+	.byte	0x38
+	.uleb128 0x17
+	.string	"lit"
+	.byte	0x9
+	.value	0x15c
+	.byte	0x21
+	.long	0x3ed
+	.byte	0x40
+	.uleb128 0xf
+	.long	.LASF1154
+	.byte	0x9
+	.value	0x15d
+	.byte	0xc
+	.long	0x11b
+	.byte	0x48
+	.uleb128 0xf
+	.long	.LASF1155
+	.byte	0x9
+	.value	0x161
+	.byte	0x22
+	.long	0x450
+	.byte	0x50
+	.uleb128 0xf
+	.long	.LASF1156
+	.byte	0x9
+	.value	0x162
+	.byte	0xc
+	.long	0x11b
+	.byte	0x58
+	.uleb128 0xf
+	.long	.LASF1157
+	.byte	0x9
+	.value	0x166
+	.byte	0xd
+	.long	0x46e
+	.byte	0x60
+	.byte	0
+	.uleb128 0x4e
+	.long	.LASF1159
+	.byte	0x58
+	.byte	0x2e
+	.long	0x3e8
+	.uleb128 0x32
+	.string	"at"
+	.byte	0x1
+	.byte	0x2f
+	.byte	0xc
+	.long	0x11b
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1160
+	.byte	0x1
+	.byte	0x30
+	.byte	0xc
+	.long	0x11b
+	.byte	0x8
+	.uleb128 0x32
+	.string	"cps"
+	.byte	0x1
+	.byte	0x32
+	.byte	0xc
+	.long	0x11b
+	.byte	0x10
+	.uleb128 0x21
+	.long	.LASF1161
+	.byte	0x1
+	.byte	0x34
+	.byte	0x11
+	.long	0x97e
+	.byte	0x18
+	.uleb128 0x21
+	.long	.LASF1162
+	.byte	0x1
+	.byte	0x35
+	.byte	0xc
+	.long	0x98e
+	.byte	0x38
+	.byte	0
+	.uleb128 0x14
+	.long	0x39c
+	.uleb128 0x8
+	.long	0x3e8
+	.uleb128 0x4e
+	.long	.LASF1163
+	.byte	0x20
+	.byte	0x3d
+	.long	0x44b
+	.uleb128 0x32
+	.string	"at"
+	.byte	0x1
+	.byte	0x3e
+	.byte	0xc
+	.long	0x11b
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1160
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xc
+	.long	0x11b
+	.byte	0x8
+	.uleb128 0x32
+	.string	"opt"
+	.byte	0x1
+	.byte	0x40
+	.byte	0xe
+	.long	0x65
+	.byte	0x10
+	.uleb128 0x21
+	.long	.LASF1164
+	.byte	0x1
+	.byte	0x41
+	.byte	0xe
+	.long	0x65
+	.byte	0x14
+	.uleb128 0x21
+	.long	.LASF1165
+	.byte	0x1
+	.byte	0x42
+	.byte	0xe
+	.long	0x65
+	.byte	0x18
+	.uleb128 0x21
+	.long	.LASF1150
+	.byte	0x1
+	.byte	0x43
+	.byte	0xe
+	.long	0x65
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x14
+	.long	0x3f2
+	.uleb128 0x8
+	.long	0x44b
+	.uleb128 0x33
+	.long	0x168
+	.long	0x46e
+	.uleb128 0xe
+	.long	0x168
+	.uleb128 0xe
+	.long	0x11b
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x8
+	.long	0x455
+	.uleb128 0x22
+	.long	.LASF1166
+	.byte	0x9
+	.value	0x167
+	.byte	0x3
+	.long	0x330
+	.uleb128 0x14
+	.long	0x473
+	.uleb128 0x22
+	.long	.LASF1167
+	.byte	0x9
+	.value	0x169
+	.byte	0x1a
+	.long	0x497
+	.uleb128 0x14
+	.long	0x485
+	.uleb128 0x44
+	.long	.LASF1168
+	.byte	0x40
+	.byte	0x9
+	.value	0x1b7
+	.byte	0x8
+	.long	0x516
+	.uleb128 0xf
+	.long	.LASF1151
+	.byte	0x9
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x684
+	.byte	0
+	.uleb128 0x17
+	.string	"pat"
+	.byte	0x9
+	.value	0x1b9
+	.byte	0x14
+	.long	0x323
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF1164
+	.byte	0x9
+	.value	0x1ba
+	.byte	0xe
+	.long	0x65
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1165
+	.byte	0x9
+	.value	0x1bb
+	.byte	0xe
+	.long	0x65
+	.byte	0x1c
+	.uleb128 0x17
+	.string	"opt"
+	.byte	0x9
+	.value	0x1bc
+	.byte	0xe
+	.long	0x65
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF1169
+	.byte	0x9
+	.value	0x1bd
+	.byte	0xe
+	.long	0x65
+	.byte	0x24
+	.uleb128 0x17
+	.string	"win"
+	.byte	0x9
+	.value	0x1be
+	.byte	0x11
+	.long	0x677
+	.byte	0x28
+	.uleb128 0xf
+	.long	.LASF1170
+	.byte	0x9
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x689
+	.byte	0x38
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1171
+	.byte	0x9
+	.value	0x16c
+	.byte	0x1e
+	.long	0x528
+	.uleb128 0x14
+	.long	0x516
+	.uleb128 0x44
+	.long	.LASF1172
+	.byte	0x40
+	.byte	0x2
+	.value	0x14f
+	.byte	0x8
+	.long	0x543
+	.uleb128 0x17
+	.string	"q"
+	.byte	0x2
+	.value	0x150
+	.byte	0x1b
+	.long	0x868
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.byte	0x38
+	.byte	0x9
+	.value	0x174
+	.long	0x5bd
+	.uleb128 0xf
+	.long	.LASF1173
+	.byte	0x9
+	.value	0x176
+	.byte	0xc
+	.long	0x5cd
+	.byte	0
+	.uleb128 0x17
+	.string	"put"
+	.byte	0x9
+	.value	0x178
+	.byte	0xc
+	.long	0x5e2
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF1174
+	.byte	0x9
+	.value	0x17b
+	.byte	0xc
+	.long	0x5cd
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF1175
+	.byte	0x9
+	.value	0x182
+	.byte	0xb
+	.long	0x5fb
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1176
+	.byte	0x9
+	.value	0x186
+	.byte	0xc
+	.long	0x615
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF1177
+	.byte	0x9
+	.value	0x18c
+	.byte	0xc
+	.long	0x62a
+	.byte	0x28
+	.uleb128 0x17
+	.string	"enc"
+	.byte	0x9
+	.value	0x191
+	.byte	0x13
+	.long	0x9a
+	.byte	0x30
+	.uleb128 0xf
+	.long	.LASF1150
+	.byte	0x9
+	.value	0x192
+	.byte	0xa
+	.long	0x62f
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3c
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x5c8
+	.byte	0
+	.uleb128 0x8
+	.long	0x485
+	.uleb128 0x8
+	.long	0x5bd
+	.uleb128 0x3c
+	.long	0x5e2
+	.uleb128 0xe
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x8
+	.long	0x5d2
+	.uleb128 0x33
+	.long	0x71
+	.long	0x5fb
+	.uleb128 0xe
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x8
+	.long	0x5e7
+	.uleb128 0x3c
+	.long	0x615
+	.uleb128 0xe
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x65
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x8
+	.long	0x600
+	.uleb128 0x3c
+	.long	0x62a
+	.uleb128 0xe
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x8
+	.long	0x61a
+	.uleb128 0x19
+	.long	0x7d
+	.long	0x63f
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1178
+	.byte	0x9
+	.value	0x193
+	.byte	0x3
+	.long	0x543
+	.uleb128 0x14
+	.long	0x63f
+	.uleb128 0x37
+	.byte	0x10
+	.byte	0x9
+	.value	0x19a
+	.long	0x677
+	.uleb128 0x17
+	.string	"cur"
+	.byte	0x9
+	.value	0x19b
+	.byte	0xb
+	.long	0x168
+	.byte	0
+	.uleb128 0x17
+	.string	"end"
+	.byte	0x9
+	.value	0x19c
+	.byte	0xb
+	.long	0x168
+	.byte	0x8
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1179
+	.byte	0x9
+	.value	0x19d
+	.byte	0x3
+	.long	0x651
+	.uleb128 0x8
+	.long	0x64c
+	.uleb128 0x8
+	.long	0x523
+	.uleb128 0x22
+	.long	.LASF1180
+	.byte	0x9
+	.value	0x1c5
+	.byte	0x19
+	.long	0x69b
+	.uleb128 0x44
+	.long	.LASF1181
+	.byte	0x20
+	.byte	0x9
+	.value	0x1d5
+	.byte	0x8
+	.long	0x6fe
+	.uleb128 0xf
+	.long	.LASF1182
+	.byte	0x9
+	.value	0x1d6
+	.byte	0xc
+	.long	0x713
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1183
+	.byte	0x9
+	.value	0x1d7
+	.byte	0x11
+	.long	0x283
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF1164
+	.byte	0x9
+	.value	0x1d8
+	.byte	0xe
+	.long	0x65
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF1165
+	.byte	0x9
+	.value	0x1d9
+	.byte	0xe
+	.long	0x65
+	.byte	0x14
+	.uleb128 0x17
+	.string	"opt"
+	.byte	0x9
+	.value	0x1da
+	.byte	0xe
+	.long	0x65
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1184
+	.byte	0x9
+	.value	0x1db
+	.byte	0xe
+	.long	0x65
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3c
+	.long	0x70e
+	.uleb128 0xe
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x70e
+	.byte	0
+	.uleb128 0x8
+	.long	0x68e
+	.uleb128 0x8
+	.long	0x6fe
+	.uleb128 0x8
+	.long	0x18b
+	.uleb128 0x8
+	.long	0x19c
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x9
+	.value	0x204
+	.long	0x73a
+	.uleb128 0xf
+	.long	.LASF1185
+	.byte	0x9
+	.value	0x205
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1186
+	.byte	0x9
+	.value	0x206
+	.byte	0x3
+	.long	0x722
+	.uleb128 0x4f
+	.long	.LASF1187
+	.byte	0xf5
+	.byte	0x22
+	.long	0x314
+	.uleb128 0x19
+	.long	0x89
+	.long	0x75d
+	.uleb128 0x62
+	.byte	0
+	.uleb128 0x14
+	.long	0x752
+	.uleb128 0x4f
+	.long	.LASF1188
+	.byte	0xf9
+	.byte	0x13
+	.long	0x75d
+	.uleb128 0x43
+	.byte	0x88
+	.byte	0x2
+	.byte	0xc9
+	.byte	0x9
+	.long	0x791
+	.uleb128 0x32
+	.string	"cls"
+	.byte	0x2
+	.byte	0xce
+	.byte	0x13
+	.long	0x791
+	.byte	0
+	.uleb128 0x32
+	.string	"esc"
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x18
+	.long	0x7a1
+	.byte	0x80
+	.byte	0
+	.uleb128 0x19
+	.long	0x9a
+	.long	0x7a1
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x8
+	.long	0x12c
+	.uleb128 0x29
+	.long	.LASF1189
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x3
+	.long	0x76d
+	.uleb128 0x14
+	.long	0x7a6
+	.uleb128 0x43
+	.byte	0x38
+	.byte	0x2
+	.byte	0xe0
+	.byte	0x9
+	.long	0x814
+	.uleb128 0x21
+	.long	.LASF1190
+	.byte	0x2
+	.byte	0xef
+	.byte	0x18
+	.long	0x814
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1191
+	.byte	0x2
+	.value	0x101
+	.byte	0xb
+	.long	0x838
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF1192
+	.byte	0x2
+	.value	0x10e
+	.byte	0xb
+	.long	0x84c
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1193
+	.byte	0x2
+	.value	0x12a
+	.byte	0xc
+	.long	0x5e2
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF1194
+	.byte	0x2
+	.value	0x131
+	.byte	0xc
+	.long	0x5cd
+	.byte	0x28
+	.uleb128 0xf
+	.long	.LASF1195
+	.byte	0x2
+	.value	0x141
+	.byte	0x21
+	.long	0x851
+	.byte	0x30
+	.byte	0
+	.uleb128 0x19
+	.long	0xf3
+	.long	0x824
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x33
+	.long	0x71
+	.long	0x838
+	.uleb128 0xe
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x8
+	.long	0x824
+	.uleb128 0x33
+	.long	0x71
+	.long	0x84c
+	.uleb128 0xe
+	.long	0x5c8
+	.byte	0
+	.uleb128 0x8
+	.long	0x83d
+	.uleb128 0x8
+	.long	0x7b2
+	.uleb128 0x22
+	.long	.LASF1196
+	.byte	0x2
+	.value	0x142
+	.byte	0x3
+	.long	0x7b7
+	.uleb128 0x14
+	.long	0x856
+	.uleb128 0x19
+	.long	0x878
+	.long	0x878
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0x863
+	.uleb128 0x25
+	.long	0x878
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1197
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1198
+	.uleb128 0x29
+	.long	.LASF1199
+	.byte	0x3
+	.byte	0x29
+	.byte	0x13
+	.long	0x89c
+	.uleb128 0x3f
+	.long	0xe7
+	.long	0x8a8
+	.uleb128 0x40
+	.byte	0x1
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1200
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x8b4
+	.uleb128 0x3f
+	.long	0xf3
+	.long	0x8c0
+	.uleb128 0x40
+	.byte	0x1
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1201
+	.byte	0x3
+	.byte	0x2f
+	.byte	0xe
+	.long	0x8cc
+	.uleb128 0x3f
+	.long	0x7d
+	.long	0x8d8
+	.uleb128 0x40
+	.byte	0xf
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1202
+	.byte	0x3
+	.byte	0x30
+	.byte	0x15
+	.long	0x8e4
+	.uleb128 0x3f
+	.long	0x8e
+	.long	0x8f0
+	.uleb128 0x40
+	.byte	0xf
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1203
+	.byte	0x3
+	.byte	0x35
+	.byte	0x13
+	.long	0x8fc
+	.uleb128 0x3f
+	.long	0xe7
+	.long	0x908
+	.uleb128 0x40
+	.byte	0x1
+	.byte	0
+	.uleb128 0x63
+	.long	.LASF1435
+	.byte	0x3
+	.byte	0x39
+	.byte	0x13
+	.long	0x8fc
+	.byte	0x1
+	.uleb128 0x14
+	.long	0x908
+	.uleb128 0x19
+	.long	0x127
+	.long	0x92a
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF1204
+	.byte	0x13
+	.byte	0x14
+	.long	0x91a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	digit2_std
+	.uleb128 0x4a
+	.long	.LASF1205
+	.byte	0x17
+	.byte	0x14
+	.long	0x91a
+	.uleb128 0x9
+	.byte	0x3
+	.quad	digit2_b32
+	.uleb128 0x19
+	.long	0x89
+	.long	0x964
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0xc7
+	.byte	0
+	.uleb128 0x14
+	.long	0x954
+	.uleb128 0x4a
+	.long	.LASF1206
+	.byte	0x1d
+	.byte	0x13
+	.long	0x964
+	.uleb128 0x9
+	.byte	0x3
+	.quad	digit_pair
+	.uleb128 0x19
+	.long	0x283
+	.long	0x98e
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	0x11b
+	.long	0x99e
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	0x89
+	.long	0x9ae
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0xc
+	.byte	0
+	.uleb128 0x14
+	.long	0x99e
+	.uleb128 0x64
+	.long	0x762
+	.byte	0x1
+	.byte	0x49
+	.byte	0xc
+	.long	0x9ae
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_format_type
+	.uleb128 0x65
+	.long	0x747
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x1b
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_format_read_vtab
+	.uleb128 0x1a
+	.long	.LASF1207
+	.value	0x154
+	.byte	0x17
+	.long	0x856
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quote_c
+	.uleb128 0x1a
+	.long	.LASF1208
+	.value	0x17d
+	.byte	0x17
+	.long	0x856
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quote_j
+	.uleb128 0x1a
+	.long	.LASF1209
+	.value	0x191
+	.byte	0x17
+	.long	0x856
+	.uleb128 0x9
+	.byte	0x3
+	.quad	quote_sh
+	.uleb128 0x19
+	.long	0x87d
+	.long	0xa2d
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1210
+	.value	0x199
+	.byte	0x28
+	.long	0xa1d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_quote
+	.uleb128 0x1a
+	.long	.LASF1211
+	.value	0x1a0
+	.byte	0x2d
+	.long	0x689
+	.uleb128 0xa
+	.byte	0xe
+	.long	va_quote_thread@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x66
+	.value	0x148
+	.byte	0x1
+	.value	0x227
+	.byte	0x9
+	.long	0xa8c
+	.uleb128 0x17
+	.string	"s"
+	.byte	0x1
+	.value	0x228
+	.byte	0x11
+	.long	0x485
+	.byte	0
+	.uleb128 0x17
+	.string	"n"
+	.byte	0x1
+	.value	0x229
+	.byte	0xc
+	.long	0x11b
+	.byte	0x40
+	.uleb128 0x17
+	.string	"buf"
+	.byte	0x1
+	.value	0x22a
+	.byte	0xe
+	.long	0xa8c
+	.byte	0x48
+	.byte	0
+	.uleb128 0x19
+	.long	0x65
+	.long	0xa9c
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1212
+	.byte	0x1
+	.value	0x22b
+	.byte	0x3
+	.long	0xa5a
+	.uleb128 0x14
+	.long	0xa9c
+	.uleb128 0x1a
+	.long	.LASF1213
+	.value	0x238
+	.byte	0x1f
+	.long	0x64c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	ahead_vtab
+	.uleb128 0x37
+	.byte	0x10
+	.byte	0x1
+	.value	0x35a
+	.long	0xb14
+	.uleb128 0x17
+	.string	"cls"
+	.byte	0x1
+	.value	0x35c
+	.byte	0x1a
+	.long	0xb14
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1214
+	.byte	0x1
+	.value	0x35d
+	.byte	0xe
+	.long	0x65
+	.byte	0x8
+	.uleb128 0x17
+	.string	"max"
+	.byte	0x1
+	.value	0x35f
+	.byte	0x13
+	.long	0x9a
+	.byte	0xc
+	.uleb128 0xf
+	.long	.LASF1215
+	.byte	0x1
+	.value	0x361
+	.byte	0x9
+	.long	0x71
+	.byte	0xd
+	.uleb128 0xf
+	.long	.LASF1150
+	.byte	0x1
+	.value	0x362
+	.byte	0x13
+	.long	0xb19
+	.byte	0xe
+	.byte	0
+	.uleb128 0x8
+	.long	0xa6
+	.uleb128 0x19
+	.long	0x9a
+	.long	0xb29
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1216
+	.byte	0x1
+	.value	0x363
+	.byte	0x3
+	.long	0xac4
+	.uleb128 0x14
+	.long	0xb29
+	.uleb128 0x37
+	.byte	0x58
+	.byte	0x1
+	.value	0x56f
+	.long	0xb79
+	.uleb128 0x17
+	.string	"s"
+	.byte	0x1
+	.value	0x570
+	.byte	0x11
+	.long	0x485
+	.byte	0
+	.uleb128 0x17
+	.string	"dst"
+	.byte	0x1
+	.value	0x571
+	.byte	0x12
+	.long	0x5c8
+	.byte	0x40
+	.uleb128 0xf
+	.long	.LASF1217
+	.byte	0x1
+	.value	0x572
+	.byte	0xc
+	.long	0x11b
+	.byte	0x48
+	.uleb128 0x17
+	.string	"q"
+	.byte	0x1
+	.value	0x573
+	.byte	0x1b
+	.long	0x878
+	.byte	0x50
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1218
+	.byte	0x1
+	.value	0x574
+	.byte	0x3
+	.long	0xb3b
+	.uleb128 0x1a
+	.long	.LASF1219
+	.value	0x584
+	.byte	0x19
+	.long	0x63f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	custom_needquote_vtab
+	.uleb128 0x1a
+	.long	.LASF1220
+	.value	0x588
+	.byte	0x19
+	.long	0x63f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	custom_put_vtab
+	.uleb128 0x1a
+	.long	.LASF1221
+	.value	0x66f
+	.byte	0x22
+	.long	0x314
+	.uleb128 0x9
+	.byte	0x3
+	.quad	arr1_vtab_8
+	.uleb128 0x1a
+	.long	.LASF1222
+	.value	0x67d
+	.byte	0x22
+	.long	0x314
+	.uleb128 0x9
+	.byte	0x3
+	.quad	arr1_vtab_16
+	.uleb128 0x1a
+	.long	.LASF1223
+	.value	0x68b
+	.byte	0x22
+	.long	0x314
+	.uleb128 0x9
+	.byte	0x3
+	.quad	arr1_vtab_32
+	.uleb128 0x1a
+	.long	.LASF1224
+	.value	0x8cb
+	.byte	0x1f
+	.long	0x64c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	format_scratch_vtab
+	.uleb128 0x37
+	.byte	0x70
+	.byte	0x1
+	.value	0x8d3
+	.long	0xc82
+	.uleb128 0x17
+	.string	"x"
+	.byte	0x1
+	.value	0x8d4
+	.byte	0x11
+	.long	0x283
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1151
+	.byte	0x1
+	.value	0x8d5
+	.byte	0x20
+	.long	0x319
+	.byte	0x8
+	.uleb128 0x17
+	.string	"lit"
+	.byte	0x1
+	.value	0x8d6
+	.byte	0x1b
+	.long	0xc82
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF1155
+	.byte	0x1
+	.value	0x8d7
+	.byte	0x1c
+	.long	0xc87
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1225
+	.byte	0x1
+	.value	0x8d8
+	.byte	0xb
+	.long	0xc8c
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF1154
+	.byte	0x1
+	.value	0x8d9
+	.byte	0xc
+	.long	0x11b
+	.byte	0x40
+	.uleb128 0xf
+	.long	.LASF1156
+	.byte	0x1
+	.value	0x8da
+	.byte	0xc
+	.long	0x11b
+	.byte	0x48
+	.uleb128 0xf
+	.long	.LASF1162
+	.byte	0x1
+	.value	0x8db
+	.byte	0xc
+	.long	0x98e
+	.byte	0x50
+	.byte	0
+	.uleb128 0x8
+	.long	0x39c
+	.uleb128 0x8
+	.long	0x3f2
+	.uleb128 0x19
+	.long	0x16a
+	.long	0xc9c
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x3
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1226
+	.byte	0x1
+	.value	0x8dc
+	.byte	0x3
+	.long	0xc0a
+	.uleb128 0x50
+	.long	.LASF1227
+	.byte	0x2b
+	.long	0x168
+	.long	0xcc7
+	.uleb128 0xe
+	.long	0x168
+	.uleb128 0xe
+	.long	0x283
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x50
+	.long	.LASF1228
+	.byte	0x3d
+	.long	0x168
+	.long	0xce5
+	.uleb128 0xe
+	.long	0x168
+	.uleb128 0xe
+	.long	0xc3
+	.uleb128 0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x67
+	.long	.LASF1229
+	.byte	0xb
+	.byte	0x45
+	.byte	0xd
+	.long	0xd06
+	.uleb128 0xe
+	.long	0x127
+	.uleb128 0xe
+	.long	0x127
+	.uleb128 0xe
+	.long	0x65
+	.uleb128 0xe
+	.long	0x127
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1231
+	.value	0xabc
+	.byte	0x14
+	.long	0x127
+	.quad	.LFB655
+	.quad	.LFE655-.LFB655
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd51
+	.uleb128 0x3
+	.string	"u"
+	.value	0xabc
+	.byte	0x29
+	.long	0x65
+	.long	.LLST690
+	.long	.LVUS690
+	.uleb128 0x1a
+	.long	.LASF1230
+	.value	0xabe
+	.byte	0x1e
+	.long	0xd61
+	.uleb128 0x9
+	.byte	0x3
+	.quad	name.0
+	.byte	0
+	.uleb128 0x19
+	.long	0x12c
+	.long	0xd61
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x14
+	.long	0xd51
+	.uleb128 0x12
+	.long	.LASF1232
+	.value	0xa9d
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB654
+	.quad	.LFE654-.LFB654
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xea1
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa9e
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST683
+	.long	.LVUS683
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa9f
+	.byte	0x11
+	.long	0x283
+	.long	.LLST684
+	.long	.LVUS684
+	.uleb128 0x1e
+	.long	.LASF1233
+	.value	0xaa0
+	.byte	0x20
+	.long	0x319
+	.long	.LLST685
+	.long	.LVUS685
+	.uleb128 0xb
+	.long	0x7355
+	.quad	.LBI1294
+	.value	.LVU4257
+	.long	.LLRL686
+	.byte	0x1
+	.value	0xaa2
+	.byte	0x5
+	.long	0xe03
+	.uleb128 0x2
+	.long	0x737d
+	.long	.LLST687
+	.long	.LVUS687
+	.uleb128 0x2
+	.long	0x7372
+	.long	.LLST688
+	.long	.LVUS688
+	.uleb128 0x2
+	.long	0x7367
+	.long	.LLST689
+	.long	.LVUS689
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1199
+	.long	0x2d69
+	.long	0xe1b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1200
+	.long	0x5da8
+	.long	0xe3e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1201
+	.long	0x5ea7
+	.long	0xe61
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1202
+	.long	0x5d42
+	.long	0xe84
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL1205
+	.long	0x10f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF1380
+	.value	0xa96
+	.quad	.LFB653
+	.quad	.LFE653-.LFB653
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xeec
+	.uleb128 0x3
+	.string	"f"
+	.value	0xa96
+	.byte	0x29
+	.long	0xeec
+	.long	.LLST682
+	.long	.LVUS682
+	.uleb128 0x41
+	.quad	.LVL1196
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x473
+	.uleb128 0x12
+	.long	.LASF1234
+	.value	0xa5a
+	.byte	0x15
+	.long	0xeec
+	.quad	.LFB652
+	.quad	.LFE652-.LFB652
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x10f2
+	.uleb128 0x1e
+	.long	.LASF1157
+	.value	0xa5b
+	.byte	0xd
+	.long	0x46e
+	.long	.LLST665
+	.long	.LVUS665
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa5c
+	.byte	0x11
+	.long	0x283
+	.long	.LLST666
+	.long	.LVUS666
+	.uleb128 0x1e
+	.long	.LASF1233
+	.value	0xa5d
+	.byte	0x20
+	.long	0x319
+	.long	.LLST667
+	.long	.LVUS667
+	.uleb128 0x2f
+	.string	"t"
+	.value	0xa64
+	.byte	0x13
+	.long	0xc9c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x1a
+	.long	.LASF1235
+	.value	0xa67
+	.byte	0x14
+	.long	0x323
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0xc
+	.long	.LASF1236
+	.value	0xa6e
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST668
+	.long	.LVUS668
+	.uleb128 0xc
+	.long	.LASF1237
+	.value	0xa6f
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST669
+	.long	.LVUS669
+	.uleb128 0xc
+	.long	.LASF1238
+	.value	0xa72
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST670
+	.long	.LVUS670
+	.uleb128 0xc
+	.long	.LASF1239
+	.value	0xa73
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST671
+	.long	.LVUS671
+	.uleb128 0xc
+	.long	.LASF1240
+	.value	0xa74
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST672
+	.long	.LVUS672
+	.uleb128 0xc
+	.long	.LASF1241
+	.value	0xa75
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST673
+	.long	.LVUS673
+	.uleb128 0xc
+	.long	.LASF1242
+	.value	0xa76
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST674
+	.long	.LVUS674
+	.uleb128 0xc
+	.long	.LASF1243
+	.value	0xa77
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST675
+	.long	.LVUS675
+	.uleb128 0xc
+	.long	.LASF1244
+	.value	0xa78
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST676
+	.long	.LVUS676
+	.uleb128 0x6
+	.string	"p"
+	.value	0xa79
+	.byte	0xb
+	.long	0x16a
+	.long	.LLST677
+	.long	.LVUS677
+	.uleb128 0x6
+	.string	"f"
+	.value	0xa7e
+	.byte	0x12
+	.long	0xeec
+	.long	.LLST678
+	.long	.LVUS678
+	.uleb128 0x26
+	.long	.LLRL679
+	.long	0x1074
+	.uleb128 0x6
+	.string	"c"
+	.value	0xa69
+	.byte	0x12
+	.long	0x65
+	.long	.LLST680
+	.long	.LVUS680
+	.uleb128 0x18
+	.quad	.LVL1172
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x2204
+	.quad	.LBI1292
+	.value	.LVU4183
+	.quad	.LBB1292
+	.quad	.LBE1292-.LBB1292
+	.byte	0x1
+	.value	0xa76
+	.byte	0x14
+	.long	0x10a9
+	.uleb128 0x2
+	.long	0x2216
+	.long	.LLST681
+	.long	.LVUS681
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1171
+	.long	0x2222
+	.long	0x10c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL1185
+	.long	0x10db
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1192
+	.long	0x2222
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -232
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1245
+	.value	0xa4d
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB651
+	.quad	.LFE651-.LFB651
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11d4
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa4e
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST658
+	.long	.LVUS658
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa4f
+	.byte	0x11
+	.long	0x283
+	.long	.LLST659
+	.long	.LVUS659
+	.uleb128 0x1e
+	.long	.LASF1233
+	.value	0xa50
+	.byte	0x20
+	.long	0x319
+	.long	.LLST660
+	.long	.LVUS660
+	.uleb128 0xb
+	.long	0x7355
+	.quad	.LBI1286
+	.value	.LVU4116
+	.long	.LLRL661
+	.byte	0x1
+	.value	0xa52
+	.byte	0x5
+	.long	0x118f
+	.uleb128 0x2
+	.long	0x737d
+	.long	.LLST662
+	.long	.LVUS662
+	.uleb128 0x2
+	.long	0x7372
+	.long	.LLST663
+	.long	.LVUS663
+	.uleb128 0x2
+	.long	0x7367
+	.long	.LLST664
+	.long	.LVUS664
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1165
+	.long	0x2d0b
+	.long	0x11a7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1166
+	.long	0x2eb2
+	.long	0x11bf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1167
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1246
+	.value	0xa40
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB650
+	.quad	.LFE650-.LFB650
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1311
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa40
+	.byte	0x3c
+	.long	0x5c8
+	.long	.LLST648
+	.long	.LVUS648
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa40
+	.byte	0x4b
+	.long	0x1311
+	.long	.LLST649
+	.long	.LVUS649
+	.uleb128 0x10
+	.long	0x7303
+	.quad	.LBI1277
+	.value	.LVU4082
+	.quad	.LBB1277
+	.quad	.LBE1277-.LBB1277
+	.byte	0x1
+	.value	0xa45
+	.byte	0x9
+	.long	0x127f
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST650
+	.long	.LVUS650
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST651
+	.long	.LVUS651
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB1279
+	.quad	.LBE1279-.LBB1279
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST652
+	.long	.LVUS652
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x192f
+	.quad	.LBI1280
+	.value	.LVU4100
+	.long	.LLRL653
+	.byte	0x1
+	.value	0xa4a
+	.byte	0xc
+	.long	0x12cc
+	.uleb128 0x2
+	.long	0x194c
+	.long	.LLST654
+	.long	.LVUS654
+	.uleb128 0x2
+	.long	0x1941
+	.long	.LLST655
+	.long	.LVUS655
+	.uleb128 0x2a
+	.long	0x1957
+	.long	.LLRL656
+	.uleb128 0x7
+	.long	0x1958
+	.long	.LLST657
+	.long	.LVUS657
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1153
+	.long	0x2d0b
+	.long	0x12e4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1157
+	.long	0x2eb2
+	.long	0x12fc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1158
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x73a
+	.uleb128 0x12
+	.long	.LASF1247
+	.value	0xa3a
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB649
+	.quad	.LFE649-.LFB649
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1379
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa3a
+	.byte	0x39
+	.long	0x5c8
+	.long	.LLST646
+	.long	.LVUS646
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa3a
+	.byte	0x48
+	.long	0x70e
+	.long	.LLST647
+	.long	.LVUS647
+	.uleb128 0x13
+	.quad	.LVL1151
+	.long	0x1e89
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1248
+	.value	0xa34
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB648
+	.quad	.LFE648-.LFB648
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13dc
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa34
+	.byte	0x3d
+	.long	0x5c8
+	.long	.LLST644
+	.long	.LVUS644
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa34
+	.byte	0x50
+	.long	0x13dc
+	.long	.LLST645
+	.long	.LVUS645
+	.uleb128 0x13
+	.quad	.LVL1149
+	.long	0x1f7b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x323
+	.uleb128 0x42
+	.long	.LASF1250
+	.value	0xa2e
+	.long	0x5c8
+	.long	0x1407
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0xa2e
+	.byte	0x37
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0xa2e
+	.byte	0x3f
+	.long	0x7d
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1249
+	.value	0xa28
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB646
+	.quad	.LFE646-.LFB646
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x146a
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa28
+	.byte	0x36
+	.long	0x5c8
+	.long	.LLST642
+	.long	.LVUS642
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa28
+	.byte	0x45
+	.long	0x283
+	.long	.LLST643
+	.long	.LVUS643
+	.uleb128 0x13
+	.quad	.LVL1147
+	.long	0x1d97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1251
+	.value	0xa22
+	.long	0x5c8
+	.long	0x1490
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0xa22
+	.byte	0x36
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0xa22
+	.byte	0x4c
+	.long	0xf3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1252
+	.value	0xa1c
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB644
+	.quad	.LFE644-.LFB644
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14f3
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa1c
+	.byte	0x38
+	.long	0x5c8
+	.long	.LLST640
+	.long	.LVUS640
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa1c
+	.byte	0x49
+	.long	0xdb
+	.long	.LLST641
+	.long	.LVUS641
+	.uleb128 0x13
+	.quad	.LVL1145
+	.long	0x1d09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1253
+	.value	0xa16
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB643
+	.quad	.LFE643-.LFB643
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1556
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa16
+	.byte	0x37
+	.long	0x5c8
+	.long	.LLST638
+	.long	.LVUS638
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa16
+	.byte	0x47
+	.long	0x65
+	.long	.LLST639
+	.long	.LVUS639
+	.uleb128 0x13
+	.quad	.LVL1143
+	.long	0x1c75
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1254
+	.value	0xa10
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB642
+	.quad	.LFE642-.LFB642
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15fc
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa10
+	.byte	0x37
+	.long	0x5c8
+	.long	.LLST634
+	.long	.LVUS634
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa10
+	.byte	0x47
+	.long	0x65
+	.long	.LLST635
+	.long	.LVUS635
+	.uleb128 0x3d
+	.long	0x1ce3
+	.quad	.LBI1269
+	.value	.LVU4037
+	.quad	.LBB1269
+	.quad	.LBE1269-.LBB1269
+	.value	0xa13
+	.byte	0xc
+	.uleb128 0x2
+	.long	0x1cfd
+	.long	.LLST636
+	.long	.LVUS636
+	.uleb128 0x2
+	.long	0x1cf2
+	.long	.LLST637
+	.long	.LVUS637
+	.uleb128 0x13
+	.quad	.LVL1141
+	.long	0x2756
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1255
+	.value	0xa0a
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB641
+	.quad	.LFE641-.LFB641
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1663
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa0a
+	.byte	0x39
+	.long	0x5c8
+	.long	.LLST632
+	.long	.LVUS632
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa0a
+	.byte	0x4b
+	.long	0xb7
+	.long	.LLST633
+	.long	.LVUS633
+	.uleb128 0x13
+	.quad	.LVL1138
+	.long	0x1c09
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1256
+	.value	0xa04
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB640
+	.quad	.LFE640-.LFB640
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16c9
+	.uleb128 0x3
+	.string	"s"
+	.value	0xa04
+	.byte	0x38
+	.long	0x5c8
+	.long	.LLST630
+	.long	.LVUS630
+	.uleb128 0x3
+	.string	"x"
+	.value	0xa04
+	.byte	0x49
+	.long	0x9a
+	.long	.LLST631
+	.long	.LVUS631
+	.uleb128 0x13
+	.quad	.LVL1136
+	.long	0x1b9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1257
+	.value	0x9fe
+	.long	0x5c8
+	.long	0x16ef
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x9fe
+	.byte	0x36
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x9fe
+	.byte	0x43
+	.long	0xe7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1258
+	.value	0x9f8
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB638
+	.quad	.LFE638-.LFB638
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1752
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9f8
+	.byte	0x38
+	.long	0x5c8
+	.long	.LLST628
+	.long	.LVUS628
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9f8
+	.byte	0x40
+	.long	0xcf
+	.long	.LLST629
+	.long	.LVUS629
+	.uleb128 0x13
+	.quad	.LVL1134
+	.long	0x1b10
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1259
+	.value	0x9f2
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB637
+	.quad	.LFE637-.LFB637
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17b5
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9f2
+	.byte	0x37
+	.long	0x5c8
+	.long	.LLST626
+	.long	.LVUS626
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9f2
+	.byte	0x3e
+	.long	0xc3
+	.long	.LLST627
+	.long	.LVUS627
+	.uleb128 0x13
+	.quad	.LVL1132
+	.long	0x1aa2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1260
+	.value	0x9ec
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB636
+	.quad	.LFE636-.LFB636
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x181e
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9ec
+	.byte	0x38
+	.long	0x5c8
+	.long	.LLST624
+	.long	.LVUS624
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9ec
+	.byte	0x41
+	.long	0xab
+	.long	.LLST625
+	.long	.LVUS625
+	.uleb128 0x13
+	.quad	.LVL1130
+	.long	0x1a34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1261
+	.value	0x9e6
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB635
+	.quad	.LFE635-.LFB635
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1887
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9e6
+	.byte	0x38
+	.long	0x5c8
+	.long	.LLST622
+	.long	.LVUS622
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9e6
+	.byte	0x47
+	.long	0x8e
+	.long	.LLST623
+	.long	.LVUS623
+	.uleb128 0x13
+	.quad	.LVL1128
+	.long	0x19c6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1262
+	.value	0x9e0
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB634
+	.quad	.LFE634-.LFB634
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x192f
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9e0
+	.byte	0x37
+	.long	0x5c8
+	.long	.LLST615
+	.long	.LVUS615
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9e0
+	.byte	0x46
+	.long	0x1311
+	.long	.LLST616
+	.long	.LVUS616
+	.uleb128 0xb
+	.long	0x192f
+	.quad	.LBI1263
+	.value	.LVU3978
+	.long	.LLRL617
+	.byte	0x1
+	.value	0x9e3
+	.byte	0xc
+	.long	0x191a
+	.uleb128 0x2
+	.long	0x194c
+	.long	.LLST618
+	.long	.LVUS618
+	.uleb128 0x2
+	.long	0x1941
+	.long	.LLST619
+	.long	.LVUS619
+	.uleb128 0x2a
+	.long	0x1957
+	.long	.LLRL620
+	.uleb128 0x7
+	.long	0x1958
+	.long	.LLST621
+	.long	.LVUS621
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1122
+	.long	0x2d0b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1283
+	.byte	0x1
+	.value	0x9d9
+	.byte	0x15
+	.long	0x5c8
+	.byte	0x1
+	.long	0x1967
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x9d9
+	.byte	0x2d
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x9d9
+	.byte	0x3c
+	.long	0x1311
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"_xp"
+	.byte	0x1
+	.value	0x9dc
+	.byte	0x29
+	.long	0x1967
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x65
+	.uleb128 0x12
+	.long	.LASF1263
+	.value	0x9d4
+	.byte	0x11
+	.long	0x65
+	.quad	.LFB632
+	.quad	.LFE632-.LFB632
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x199b
+	.uleb128 0x2d
+	.string	"s"
+	.value	0x9d4
+	.byte	0x3a
+	.long	0x199b
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x8
+	.long	0x492
+	.uleb128 0x52
+	.long	.LASF1264
+	.value	0x9ca
+	.long	0x5c8
+	.long	0x19c6
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x9ca
+	.byte	0x32
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x9ca
+	.byte	0x3a
+	.long	0x7d
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1265
+	.value	0x9c5
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB630
+	.quad	.LFE630-.LFB630
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a34
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9c5
+	.byte	0x33
+	.long	0x5c8
+	.long	.LLST611
+	.long	.LVUS611
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9c5
+	.byte	0x42
+	.long	0x8e
+	.long	.LLST612
+	.long	.LVUS612
+	.uleb128 0x13
+	.quad	.LVL1117
+	.long	0x2a97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1266
+	.value	0x9c0
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB629
+	.quad	.LFE629-.LFB629
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1aa2
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9c0
+	.byte	0x33
+	.long	0x5c8
+	.long	.LLST609
+	.long	.LVUS609
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9c0
+	.byte	0x3c
+	.long	0xab
+	.long	.LLST610
+	.long	.LVUS610
+	.uleb128 0x13
+	.quad	.LVL1115
+	.long	0x2a97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x30
+	.byte	0x24
+	.byte	0x8
+	.byte	0x30
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1267
+	.value	0x9bb
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB628
+	.quad	.LFE628-.LFB628
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b10
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9bb
+	.byte	0x32
+	.long	0x5c8
+	.long	.LLST607
+	.long	.LVUS607
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9bb
+	.byte	0x39
+	.long	0xc3
+	.long	.LLST608
+	.long	.LVUS608
+	.uleb128 0x13
+	.quad	.LVL1113
+	.long	0x2a97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x8
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1268
+	.value	0x9b6
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB627
+	.quad	.LFE627-.LFB627
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b78
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9b6
+	.byte	0x33
+	.long	0x5c8
+	.long	.LLST605
+	.long	.LVUS605
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9b6
+	.byte	0x3b
+	.long	0xcf
+	.long	.LLST606
+	.long	.LVUS606
+	.uleb128 0x13
+	.quad	.LVL1111
+	.long	0x2a97
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1269
+	.value	0x9b1
+	.long	0x5c8
+	.long	0x1b9e
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x9b1
+	.byte	0x31
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x9b1
+	.byte	0x3e
+	.long	0xe7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1270
+	.value	0x9ac
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB625
+	.quad	.LFE625-.LFB625
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c09
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9ac
+	.byte	0x33
+	.long	0x5c8
+	.long	.LLST603
+	.long	.LVUS603
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9ac
+	.byte	0x44
+	.long	0x9a
+	.long	.LLST604
+	.long	.LVUS604
+	.uleb128 0x13
+	.quad	.LVL1109
+	.long	0x28a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1271
+	.value	0x9a7
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB624
+	.quad	.LFE624-.LFB624
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c75
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9a7
+	.byte	0x34
+	.long	0x5c8
+	.long	.LLST601
+	.long	.LVUS601
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9a7
+	.byte	0x46
+	.long	0xb7
+	.long	.LLST602
+	.long	.LVUS602
+	.uleb128 0x13
+	.quad	.LVL1107
+	.long	0x28a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1272
+	.value	0x9a2
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB623
+	.quad	.LFE623-.LFB623
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ce3
+	.uleb128 0x3
+	.string	"s"
+	.value	0x9a2
+	.byte	0x32
+	.long	0x5c8
+	.long	.LLST599
+	.long	.LVUS599
+	.uleb128 0x3
+	.string	"x"
+	.value	0x9a2
+	.byte	0x3e
+	.long	0x65
+	.long	.LLST600
+	.long	.LVUS600
+	.uleb128 0x13
+	.quad	.LVL1105
+	.long	0x28a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.long	.LASF1273
+	.value	0x99d
+	.long	0x5c8
+	.long	0x1d09
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x99d
+	.byte	0x32
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x99d
+	.byte	0x3e
+	.long	0x65
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1274
+	.value	0x998
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB621
+	.quad	.LFE621-.LFB621
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d71
+	.uleb128 0x3
+	.string	"s"
+	.value	0x998
+	.byte	0x33
+	.long	0x5c8
+	.long	.LLST595
+	.long	.LVUS595
+	.uleb128 0x3
+	.string	"x"
+	.value	0x998
+	.byte	0x44
+	.long	0xdb
+	.long	.LLST596
+	.long	.LVUS596
+	.uleb128 0x13
+	.quad	.LVL1101
+	.long	0x28a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x38
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1275
+	.value	0x993
+	.long	0x5c8
+	.long	0x1d97
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x993
+	.byte	0x31
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x993
+	.byte	0x47
+	.long	0xf3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1276
+	.value	0x98d
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB619
+	.quad	.LFE619-.LFB619
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e89
+	.uleb128 0x3
+	.string	"s"
+	.value	0x98d
+	.byte	0x31
+	.long	0x5c8
+	.long	.LLST590
+	.long	.LVUS590
+	.uleb128 0x3
+	.string	"x"
+	.value	0x98d
+	.byte	0x40
+	.long	0x283
+	.long	.LLST591
+	.long	.LVUS591
+	.uleb128 0x1d
+	.long	.LLRL592
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x98f
+	.byte	0x4
+	.long	0x71
+	.long	.LLST593
+	.long	.LVUS593
+	.uleb128 0x6
+	.string	"u"
+	.value	0x98f
+	.byte	0x39
+	.long	0x65
+	.long	.LLST594
+	.long	.LVUS594
+	.uleb128 0x5
+	.quad	.LVL1092
+	.long	0x2d0b
+	.long	0x1e20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1093
+	.long	0x2de7
+	.long	0x1e3d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1094
+	.long	0x6226
+	.long	0x1e5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1095
+	.long	0x2eb2
+	.long	0x1e73
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1096
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1278
+	.value	0x985
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB618
+	.quad	.LFE618-.LFB618
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f7b
+	.uleb128 0x3
+	.string	"s"
+	.value	0x986
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST585
+	.long	.LVUS585
+	.uleb128 0x3
+	.string	"x"
+	.value	0x987
+	.byte	0x11
+	.long	0x70e
+	.long	.LLST586
+	.long	.LVUS586
+	.uleb128 0x1d
+	.long	.LLRL587
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x989
+	.byte	0x4
+	.long	0x71
+	.long	.LLST588
+	.long	.LVUS588
+	.uleb128 0x6
+	.string	"u"
+	.value	0x989
+	.byte	0x39
+	.long	0x65
+	.long	.LLST589
+	.long	.LVUS589
+	.uleb128 0x5
+	.quad	.LVL1082
+	.long	0x2d0b
+	.long	0x1f12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1083
+	.long	0x2de7
+	.long	0x1f2f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1084
+	.long	0x41d0
+	.long	0x1f4d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1085
+	.long	0x2eb2
+	.long	0x1f65
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1086
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1279
+	.value	0x97b
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB617
+	.quad	.LFE617-.LFB617
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1fec
+	.uleb128 0x3
+	.string	"s"
+	.value	0x97c
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST583
+	.long	.LVUS583
+	.uleb128 0x3
+	.string	"x"
+	.value	0x97d
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST584
+	.long	.LVUS584
+	.uleb128 0x23
+	.quad	.LVL1076
+	.long	0x1fd6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL1079
+	.long	0x20f8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1280
+	.value	0x972
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB616
+	.quad	.LFE616-.LFB616
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x20f8
+	.uleb128 0x3
+	.string	"s"
+	.value	0x973
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST577
+	.long	.LVUS577
+	.uleb128 0x3
+	.string	"x"
+	.value	0x974
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST578
+	.long	.LVUS578
+	.uleb128 0xc
+	.long	.LASF1281
+	.value	0x976
+	.byte	0x11
+	.long	0x283
+	.long	.LLST579
+	.long	.LVUS579
+	.uleb128 0x1d
+	.long	.LLRL580
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x977
+	.byte	0x4
+	.long	0x71
+	.long	.LLST581
+	.long	.LVUS581
+	.uleb128 0x6
+	.string	"u"
+	.value	0x977
+	.byte	0x39
+	.long	0x65
+	.long	.LLST582
+	.long	.LVUS582
+	.uleb128 0x5
+	.quad	.LVL1065
+	.long	0x2d0b
+	.long	0x2089
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1066
+	.long	0x2de7
+	.long	0x20a6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1067
+	.long	0x45cc
+	.long	0x20ca
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1068
+	.long	0x2eb2
+	.long	0x20e2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1069
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1282
+	.value	0x969
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB615
+	.quad	.LFE615-.LFB615
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2204
+	.uleb128 0x3
+	.string	"s"
+	.value	0x96a
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST571
+	.long	.LVUS571
+	.uleb128 0x3
+	.string	"x"
+	.value	0x96b
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST572
+	.long	.LVUS572
+	.uleb128 0xc
+	.long	.LASF1281
+	.value	0x96d
+	.byte	0x11
+	.long	0x283
+	.long	.LLST573
+	.long	.LVUS573
+	.uleb128 0x1d
+	.long	.LLRL574
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x96e
+	.byte	0x4
+	.long	0x71
+	.long	.LLST575
+	.long	.LVUS575
+	.uleb128 0x6
+	.string	"u"
+	.value	0x96e
+	.byte	0x39
+	.long	0x65
+	.long	.LLST576
+	.long	.LVUS576
+	.uleb128 0x5
+	.quad	.LVL1053
+	.long	0x2d0b
+	.long	0x2195
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1054
+	.long	0x2de7
+	.long	0x21b2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1055
+	.long	0x45cc
+	.long	0x21d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1056
+	.long	0x2eb2
+	.long	0x21ee
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL1057
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1284
+	.byte	0x1
+	.value	0x961
+	.byte	0xf
+	.long	0x11b
+	.byte	0x1
+	.long	0x2222
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x961
+	.byte	0x1d
+	.long	0x11b
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1290
+	.value	0x947
+	.quad	.LFB613
+	.quad	.LFE613-.LFB613
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25b2
+	.uleb128 0x3
+	.string	"t"
+	.value	0x947
+	.byte	0x28
+	.long	0x25b2
+	.long	.LLST481
+	.long	.LVUS481
+	.uleb128 0x1a
+	.long	.LASF1235
+	.value	0x949
+	.byte	0x14
+	.long	0x323
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0xc
+	.long	.LASF1285
+	.value	0x94a
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST482
+	.long	.LVUS482
+	.uleb128 0xc
+	.long	.LASF1286
+	.value	0x94b
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST483
+	.long	.LVUS483
+	.uleb128 0xc
+	.long	.LASF1287
+	.value	0x94c
+	.byte	0xe
+	.long	0x65
+	.long	.LLST484
+	.long	.LVUS484
+	.uleb128 0x53
+	.quad	.LBB1138
+	.quad	.LBE1138-.LBB1138
+	.uleb128 0x6
+	.string	"at"
+	.value	0x94e
+	.byte	0x10
+	.long	0x11b
+	.long	.LLST485
+	.long	.LVUS485
+	.uleb128 0x6
+	.string	"c"
+	.value	0x958
+	.byte	0x12
+	.long	0x65
+	.long	.LLST486
+	.long	.LVUS486
+	.uleb128 0x26
+	.long	.LLRL487
+	.long	0x23a9
+	.uleb128 0xc
+	.long	.LASF1160
+	.value	0x953
+	.byte	0x14
+	.long	0x11b
+	.long	.LLST488
+	.long	.LVUS488
+	.uleb128 0x34
+	.long	0x25b7
+	.quad	.LBI1140
+	.value	.LVU3047
+	.long	.LLRL489
+	.value	0x953
+	.byte	0x1b
+	.uleb128 0x2
+	.long	0x25e1
+	.long	.LLST490
+	.long	.LVUS490
+	.uleb128 0x2
+	.long	0x25d4
+	.long	.LLST491
+	.long	.LVUS491
+	.uleb128 0x2
+	.long	0x25c9
+	.long	.LLST492
+	.long	.LVUS492
+	.uleb128 0x1d
+	.long	.LLRL489
+	.uleb128 0x38
+	.long	0x25ed
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x38
+	.long	0x25f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x7
+	.long	0x2604
+	.long	.LLST493
+	.long	.LVUS493
+	.uleb128 0x39
+	.long	0x2610
+	.quad	.LBB1142
+	.quad	.LBE1142-.LBB1142
+	.long	0x2378
+	.uleb128 0x7
+	.long	0x2611
+	.long	.LLST494
+	.long	.LVUS494
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL862
+	.long	0x2eb2
+	.long	0x2391
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL920
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x261f
+	.quad	.LBI1145
+	.value	.LVU3066
+	.long	.LLRL495
+	.byte	0x1
+	.value	0x950
+	.byte	0xd
+	.long	0x259a
+	.uleb128 0x2
+	.long	0x2638
+	.long	.LLST496
+	.long	.LVUS496
+	.uleb128 0x2
+	.long	0x262d
+	.long	.LLST497
+	.long	.LVUS497
+	.uleb128 0x1d
+	.long	.LLRL495
+	.uleb128 0x7
+	.long	0x2644
+	.long	.LLST498
+	.long	.LVUS498
+	.uleb128 0x38
+	.long	0x2650
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x38
+	.long	0x265c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x7
+	.long	0x2668
+	.long	.LLST499
+	.long	.LVUS499
+	.uleb128 0x2b
+	.long	0x2675
+	.long	.LLRL500
+	.long	0x244c
+	.uleb128 0x7
+	.long	0x267a
+	.long	.LLST501
+	.long	.LVUS501
+	.uleb128 0x7
+	.long	0x2687
+	.long	.LLST502
+	.long	.LVUS502
+	.uleb128 0x18
+	.quad	.LVL867
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x2708
+	.long	.LLRL503
+	.long	0x2467
+	.uleb128 0x7
+	.long	0x2709
+	.long	.LLST504
+	.long	.LVUS504
+	.byte	0
+	.uleb128 0x2a
+	.long	0x2693
+	.long	.LLRL505
+	.uleb128 0x7
+	.long	0x2698
+	.long	.LLST506
+	.long	.LVUS506
+	.uleb128 0x7
+	.long	0x26a5
+	.long	.LLST507
+	.long	.LVUS507
+	.uleb128 0x7
+	.long	0x26b1
+	.long	.LLST508
+	.long	.LVUS508
+	.uleb128 0x7
+	.long	0x26be
+	.long	.LLST509
+	.long	.LVUS509
+	.uleb128 0x2b
+	.long	0x26cb
+	.long	.LLRL510
+	.long	0x24bf
+	.uleb128 0x7
+	.long	0x26d0
+	.long	.LLST511
+	.long	.LVUS511
+	.byte	0
+	.uleb128 0x2b
+	.long	0x26dc
+	.long	.LLRL512
+	.long	0x2574
+	.uleb128 0x7
+	.long	0x26e1
+	.long	.LLST513
+	.long	.LVUS513
+	.uleb128 0x2a
+	.long	0x26ec
+	.long	.LLRL514
+	.uleb128 0x7
+	.long	0x26ed
+	.long	.LLST515
+	.long	.LVUS515
+	.uleb128 0xb
+	.long	0x72da
+	.quad	.LBI1157
+	.value	.LVU3203
+	.long	.LLRL516
+	.byte	0x1
+	.value	0x90c
+	.byte	0x12
+	.long	0x2525
+	.uleb128 0x2
+	.long	0x72f7
+	.long	.LLST517
+	.long	.LVUS517
+	.uleb128 0x2
+	.long	0x72ec
+	.long	.LLST518
+	.long	.LVUS518
+	.byte	0
+	.uleb128 0xb
+	.long	0x72b1
+	.quad	.LBI1167
+	.value	.LVU3211
+	.long	.LLRL519
+	.byte	0x1
+	.value	0x90d
+	.byte	0x13
+	.long	0x255b
+	.uleb128 0x2
+	.long	0x72ce
+	.long	.LLST520
+	.long	.LVUS520
+	.uleb128 0x2
+	.long	0x72c3
+	.long	.LLST521
+	.long	.LVUS521
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL894
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -200
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	0x26fa
+	.quad	.LBB1198
+	.quad	.LBE1198-.LBB1198
+	.uleb128 0x7
+	.long	0x26fb
+	.long	.LLST522
+	.long	.LVUS522
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL927
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xc9c
+	.uleb128 0x1f
+	.long	.LASF1288
+	.byte	0x1
+	.value	0x921
+	.byte	0xf
+	.long	0x11b
+	.byte	0x1
+	.long	0x261f
+	.uleb128 0x4
+	.string	"t"
+	.byte	0x1
+	.value	0x921
+	.byte	0x2f
+	.long	0x25b2
+	.uleb128 0x15
+	.long	.LASF1289
+	.byte	0x1
+	.value	0x921
+	.byte	0x39
+	.long	0x11b
+	.uleb128 0x4
+	.string	"at"
+	.byte	0x1
+	.value	0x921
+	.byte	0x47
+	.long	0x11b
+	.uleb128 0x9
+	.string	"s"
+	.byte	0x1
+	.value	0x923
+	.byte	0x11
+	.long	0x485
+	.uleb128 0x2c
+	.long	.LASF1235
+	.value	0x92d
+	.byte	0x14
+	.long	0x323
+	.uleb128 0x2c
+	.long	.LASF1160
+	.value	0x934
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x16
+	.uleb128 0x2c
+	.long	.LASF1155
+	.value	0x936
+	.byte	0x20
+	.long	0xc87
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1306
+	.byte	0x1
+	.value	0x8e3
+	.byte	0xd
+	.byte	0x1
+	.long	0x2716
+	.uleb128 0x4
+	.string	"t"
+	.byte	0x1
+	.value	0x8e3
+	.byte	0x2c
+	.long	0x25b2
+	.uleb128 0x4
+	.string	"at"
+	.byte	0x1
+	.value	0x8e3
+	.byte	0x36
+	.long	0x11b
+	.uleb128 0x2c
+	.long	.LASF1281
+	.value	0x8e5
+	.byte	0x11
+	.long	0x127
+	.uleb128 0x2c
+	.long	.LASF1235
+	.value	0x8e6
+	.byte	0x14
+	.long	0x323
+	.uleb128 0x2c
+	.long	.LASF1162
+	.value	0x8e7
+	.byte	0xc
+	.long	0x98e
+	.uleb128 0x9
+	.string	"cps"
+	.byte	0x1
+	.value	0x8e8
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x2e
+	.long	0x2693
+	.uleb128 0x9
+	.string	"cur"
+	.byte	0x1
+	.value	0x8ea
+	.byte	0x15
+	.long	0x283
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x1
+	.value	0x8eb
+	.byte	0x12
+	.long	0x65
+	.byte	0
+	.uleb128 0x2e
+	.long	0x2708
+	.uleb128 0x9
+	.string	"lit"
+	.byte	0x1
+	.value	0x8fe
+	.byte	0x1f
+	.long	0xc82
+	.uleb128 0x9
+	.string	"w8"
+	.byte	0x1
+	.value	0x906
+	.byte	0xf
+	.long	0x16a
+	.uleb128 0x9
+	.string	"w16"
+	.byte	0x1
+	.value	0x907
+	.byte	0x13
+	.long	0x2716
+	.uleb128 0x9
+	.string	"w32"
+	.byte	0x1
+	.value	0x908
+	.byte	0x13
+	.long	0x271b
+	.uleb128 0x2e
+	.long	0x26dc
+	.uleb128 0x9
+	.string	"e"
+	.byte	0x1
+	.value	0x902
+	.byte	0x17
+	.long	0x65
+	.byte	0
+	.uleb128 0x2e
+	.long	0x26fa
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x1
+	.value	0x90a
+	.byte	0x15
+	.long	0x11b
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x1
+	.value	0x90b
+	.byte	0x16
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"e"
+	.byte	0x1
+	.value	0x910
+	.byte	0x17
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"e"
+	.byte	0x1
+	.value	0x915
+	.byte	0x13
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x17f
+	.uleb128 0x8
+	.long	0x190
+	.uleb128 0x20
+	.long	.LASF1291
+	.value	0x8c5
+	.quad	.LFB610
+	.quad	.LFE610-.LFB610
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2756
+	.uleb128 0x2d
+	.string	"s"
+	.value	0x8c5
+	.byte	0x2d
+	.long	0x5c8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2d
+	.string	"c"
+	.value	0x8c5
+	.byte	0x39
+	.long	0x65
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1292
+	.value	0x8bd
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB609
+	.quad	.LFE609-.LFB609
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x28a2
+	.uleb128 0x3
+	.string	"s"
+	.value	0x8bd
+	.byte	0x2f
+	.long	0x5c8
+	.long	.LLST460
+	.long	.LVUS460
+	.uleb128 0x3
+	.string	"x"
+	.value	0x8bd
+	.byte	0x45
+	.long	0xf3
+	.long	.LLST461
+	.long	.LVUS461
+	.uleb128 0x1d
+	.long	.LLRL462
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x8bf
+	.byte	0x4
+	.long	0x71
+	.long	.LLST463
+	.long	.LVUS463
+	.uleb128 0x6
+	.string	"u"
+	.value	0x8bf
+	.byte	0x39
+	.long	0x65
+	.long	.LLST464
+	.long	.LVUS464
+	.uleb128 0x10
+	.long	0x3b25
+	.quad	.LBI1100
+	.value	.LVU2890
+	.quad	.LBB1100
+	.quad	.LBE1100-.LBB1100
+	.byte	0x1
+	.value	0x8bf
+	.byte	0x26
+	.long	0x283e
+	.uleb128 0x2
+	.long	0x3b3e
+	.long	.LLST465
+	.long	.LVUS465
+	.uleb128 0x2
+	.long	0x3b33
+	.long	.LLST466
+	.long	.LVUS466
+	.uleb128 0x5
+	.quad	.LVL820
+	.long	0x3c8f
+	.long	0x2830
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x54
+	.quad	.LVL821
+	.long	0x62c4
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL817
+	.long	0x2d0b
+	.long	0x2856
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL818
+	.long	0x2de7
+	.long	0x2874
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL822
+	.long	0x2eb2
+	.long	0x288c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL823
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1293
+	.value	0x8b7
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB608
+	.quad	.LFE608-.LFB608
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a97
+	.uleb128 0x3
+	.string	"s"
+	.value	0x8b7
+	.byte	0x2e
+	.long	0x5c8
+	.long	.LLST447
+	.long	.LVUS447
+	.uleb128 0x3
+	.string	"x"
+	.value	0x8b7
+	.byte	0x44
+	.long	0xf3
+	.long	.LLST448
+	.long	.LVUS448
+	.uleb128 0x3
+	.string	"sz"
+	.value	0x8b7
+	.byte	0x50
+	.long	0x65
+	.long	.LLST449
+	.long	.LVUS449
+	.uleb128 0x1d
+	.long	.LLRL450
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x8b9
+	.byte	0x4
+	.long	0x71
+	.long	.LLST451
+	.long	.LVUS451
+	.uleb128 0x6
+	.string	"u"
+	.value	0x8b9
+	.byte	0x39
+	.long	0x65
+	.long	.LLST452
+	.long	.LVUS452
+	.uleb128 0x10
+	.long	0x3b4a
+	.quad	.LBI1090
+	.value	.LVU2827
+	.quad	.LBB1090
+	.quad	.LBE1090-.LBB1090
+	.byte	0x1
+	.value	0x8b9
+	.byte	0x26
+	.long	0x2a33
+	.uleb128 0x2
+	.long	0x3b6e
+	.long	.LLST453
+	.long	.LVUS453
+	.uleb128 0x2
+	.long	0x3b63
+	.long	.LLST454
+	.long	.LVUS454
+	.uleb128 0x2
+	.long	0x3b58
+	.long	.LLST455
+	.long	.LVUS455
+	.uleb128 0x10
+	.long	0x3b91
+	.quad	.LBI1092
+	.value	.LVU2847
+	.quad	.LBB1092
+	.quad	.LBE1092-.LBB1092
+	.byte	0x1
+	.value	0x6ba
+	.byte	0x9
+	.long	0x29e3
+	.uleb128 0x2
+	.long	0x3bb5
+	.long	.LLST456
+	.long	.LVUS456
+	.uleb128 0x2
+	.long	0x3baa
+	.long	.LLST457
+	.long	.LVUS457
+	.uleb128 0x2
+	.long	0x3b9f
+	.long	.LLST458
+	.long	.LVUS458
+	.uleb128 0x1d
+	.long	.LLRL459
+	.uleb128 0xd
+	.quad	.LVL806
+	.long	0x4600
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL800
+	.long	0x62c4
+	.long	0x2a14
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x15
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	type_name.3
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL808
+	.long	0x3c8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL797
+	.long	0x2d0b
+	.long	0x2a4b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL798
+	.long	0x2de7
+	.long	0x2a69
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL809
+	.long	0x2eb2
+	.long	0x2a81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL810
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1294
+	.value	0x8b1
+	.byte	0x15
+	.long	0x5c8
+	.quad	.LFB607
+	.quad	.LFE607-.LFB607
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2c8d
+	.uleb128 0x3
+	.string	"s"
+	.value	0x8b1
+	.byte	0x2e
+	.long	0x5c8
+	.long	.LLST467
+	.long	.LVUS467
+	.uleb128 0x3
+	.string	"x"
+	.value	0x8b1
+	.byte	0x3b
+	.long	0xe7
+	.long	.LLST468
+	.long	.LVUS468
+	.uleb128 0x3
+	.string	"sz"
+	.value	0x8b1
+	.byte	0x47
+	.long	0x65
+	.long	.LLST469
+	.long	.LVUS469
+	.uleb128 0x1d
+	.long	.LLRL470
+	.uleb128 0xc
+	.long	.LASF1277
+	.value	0x8b3
+	.byte	0x4
+	.long	0x71
+	.long	.LLST471
+	.long	.LVUS471
+	.uleb128 0x6
+	.string	"u"
+	.value	0x8b3
+	.byte	0x39
+	.long	0x65
+	.long	.LLST472
+	.long	.LVUS472
+	.uleb128 0x10
+	.long	0x3ab1
+	.quad	.LBI1109
+	.value	.LVU2934
+	.quad	.LBB1109
+	.quad	.LBE1109-.LBB1109
+	.byte	0x1
+	.value	0x8b3
+	.byte	0x26
+	.long	0x2c29
+	.uleb128 0x2
+	.long	0x3ad5
+	.long	.LLST473
+	.long	.LVUS473
+	.uleb128 0x2
+	.long	0x3aca
+	.long	.LLST474
+	.long	.LVUS474
+	.uleb128 0x2
+	.long	0x3abf
+	.long	.LLST475
+	.long	.LVUS475
+	.uleb128 0x7
+	.long	0x3af7
+	.long	.LLST476
+	.long	.LVUS476
+	.uleb128 0x7
+	.long	0x3b03
+	.long	.LLST477
+	.long	.LVUS477
+	.uleb128 0xb
+	.long	0x3b91
+	.quad	.LBI1111
+	.value	.LVU2999
+	.long	.LLRL478
+	.byte	0x1
+	.value	0x6f9
+	.byte	0x9
+	.long	0x2bde
+	.uleb128 0xa
+	.long	0x3bb5
+	.uleb128 0x2
+	.long	0x3baa
+	.long	.LLST479
+	.long	.LVUS479
+	.uleb128 0x2
+	.long	0x3b9f
+	.long	.LLST480
+	.long	.LVUS480
+	.uleb128 0x1d
+	.long	.LLRL478
+	.uleb128 0xd
+	.quad	.LVL847
+	.long	0x4600
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL832
+	.long	0x62c4
+	.long	0x2c0f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x15
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	type_name.1
+	.byte	0x22
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL850
+	.long	0x3c8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL829
+	.long	0x2d0b
+	.long	0x2c41
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL830
+	.long	0x2de7
+	.long	0x2c5f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL851
+	.long	0x2eb2
+	.long	0x2c77
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL852
+	.long	0x2c8d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1174
+	.value	0x88e
+	.quad	.LFB606
+	.quad	.LFE606-.LFB606
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d0b
+	.uleb128 0x3
+	.string	"s"
+	.value	0x88e
+	.byte	0x21
+	.long	0x5c8
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x11
+	.quad	.LBB443
+	.quad	.LBE443-.LBB443
+	.long	0x2cf9
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x893
+	.byte	0x29
+	.long	0x1967
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x6
+	.string	"_m"
+	.value	0x893
+	.byte	0x4d
+	.long	0x65
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0x41
+	.quad	.LVL112
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1295
+	.value	0x884
+	.quad	.LFB605
+	.quad	.LFE605-.LFB605
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d69
+	.uleb128 0x3
+	.string	"s"
+	.value	0x884
+	.byte	0x26
+	.long	0x5c8
+	.long	.LLST446
+	.long	.LVUS446
+	.uleb128 0x5
+	.quad	.LVL793
+	.long	0x2d69
+	.long	0x2d53
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL794
+	.long	0x2eb2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1296
+	.value	0x878
+	.quad	.LFB604
+	.quad	.LFE604-.LFB604
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2de7
+	.uleb128 0x3
+	.string	"s"
+	.value	0x878
+	.byte	0x2d
+	.long	0x5c8
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x11
+	.quad	.LBB442
+	.quad	.LBE442-.LBB442
+	.long	0x2dd5
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x87d
+	.byte	0x2d
+	.long	0x1967
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x6
+	.string	"_m"
+	.value	0x87d
+	.byte	0x51
+	.long	0x65
+	.long	.LLST61
+	.long	.LVUS61
+	.byte	0
+	.uleb128 0x41
+	.quad	.LVL109
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1297
+	.value	0x85d
+	.byte	0xc
+	.long	0x71
+	.quad	.LFB603
+	.quad	.LFE603-.LFB603
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2eb2
+	.uleb128 0x2d
+	.string	"s"
+	.value	0x85d
+	.byte	0x21
+	.long	0x5c8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.string	"x"
+	.value	0x85d
+	.byte	0x2e
+	.long	0xe7
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x11
+	.quad	.LBB438
+	.quad	.LBE438-.LBB438
+	.long	0x2e51
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x86d
+	.byte	0x2d
+	.long	0x1967
+	.long	.LLST55
+	.long	.LVUS55
+	.byte	0
+	.uleb128 0x3d
+	.long	0x7303
+	.quad	.LBI439
+	.value	.LVU351
+	.quad	.LBB439
+	.quad	.LBE439-.LBB439
+	.value	0x871
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB441
+	.quad	.LBE441-.LBB441
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1298
+	.value	0x756
+	.byte	0x11
+	.long	0x65
+	.quad	.LFB602
+	.quad	.LFE602-.LFB602
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x38d6
+	.uleb128 0x3
+	.string	"s"
+	.value	0x756
+	.byte	0x2b
+	.long	0x5c8
+	.long	.LLST373
+	.long	.LVUS373
+	.uleb128 0xc
+	.long	.LASF1299
+	.value	0x758
+	.byte	0x18
+	.long	0x38d6
+	.long	.LLST374
+	.long	.LVUS374
+	.uleb128 0x1a
+	.long	.LASF1235
+	.value	0x759
+	.byte	0x14
+	.long	0x38db
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x35
+	.long	.LASF1300
+	.value	0x75b
+	.byte	0x1
+	.quad	.L673
+	.uleb128 0x6
+	.string	"at"
+	.value	0x75c
+	.byte	0x11
+	.long	0x283
+	.long	.LLST375
+	.long	.LVUS375
+	.uleb128 0x6
+	.string	"c"
+	.value	0x75d
+	.byte	0xe
+	.long	0x65
+	.long	.LLST376
+	.long	.LVUS376
+	.uleb128 0x35
+	.long	.LASF1301
+	.value	0x855
+	.byte	0x1
+	.quad	.LDL3
+	.uleb128 0x35
+	.long	.LASF1302
+	.value	0x845
+	.byte	0x1
+	.quad	.L698
+	.uleb128 0x35
+	.long	.LASF1303
+	.value	0x7ac
+	.byte	0x1
+	.quad	.LDL1
+	.uleb128 0x35
+	.long	.LASF1304
+	.value	0x84d
+	.byte	0x1
+	.quad	.L711
+	.uleb128 0x35
+	.long	.LASF1305
+	.value	0x7f7
+	.byte	0x1
+	.quad	.LDL2
+	.uleb128 0x4b
+	.long	.LASF1333
+	.long	0x9ae
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.5
+	.uleb128 0x11
+	.quad	.LBB1026
+	.quad	.LBE1026-.LBB1026
+	.long	0x31c4
+	.uleb128 0x6
+	.string	"lit"
+	.value	0x76b
+	.byte	0x29
+	.long	0x3ed
+	.long	.LLST380
+	.long	.LVUS380
+	.uleb128 0x10
+	.long	0x3937
+	.quad	.LBI1027
+	.value	.LVU2331
+	.quad	.LBB1027
+	.quad	.LBE1027-.LBB1027
+	.byte	0x1
+	.value	0x76b
+	.byte	0x2f
+	.long	0x308b
+	.uleb128 0x2
+	.long	0x3949
+	.long	.LLST381
+	.long	.LVUS381
+	.uleb128 0x2
+	.long	0x397b
+	.long	.LLST382
+	.long	.LVUS382
+	.uleb128 0x2
+	.long	0x396e
+	.long	.LLST383
+	.long	.LVUS383
+	.uleb128 0x2
+	.long	0x3961
+	.long	.LLST384
+	.long	.LVUS384
+	.uleb128 0x2
+	.long	0x3954
+	.long	.LLST385
+	.long	.LVUS385
+	.uleb128 0x7
+	.long	0x3988
+	.long	.LLST386
+	.long	.LVUS386
+	.uleb128 0x7
+	.long	0x3994
+	.long	.LLST387
+	.long	.LVUS387
+	.uleb128 0x27
+	.long	0x39a0
+	.quad	.LBB1029
+	.quad	.LBE1029-.LBB1029
+	.uleb128 0x7
+	.long	0x39a1
+	.long	.LLST388
+	.long	.LVUS388
+	.uleb128 0x7
+	.long	0x39ae
+	.long	.LLST389
+	.long	.LVUS389
+	.uleb128 0x7
+	.long	0x39b9
+	.long	.LLST390
+	.long	.LVUS390
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x38eb
+	.quad	.LBI1030
+	.value	.LVU2361
+	.quad	.LBB1030
+	.quad	.LBE1030-.LBB1030
+	.byte	0x1
+	.value	0x76e
+	.byte	0x11
+	.long	0x31a9
+	.uleb128 0x2
+	.long	0x3904
+	.long	.LLST391
+	.long	.LVUS391
+	.uleb128 0x2
+	.long	0x38f9
+	.long	.LLST392
+	.long	.LVUS392
+	.uleb128 0x7
+	.long	0x3911
+	.long	.LLST393
+	.long	.LVUS393
+	.uleb128 0x7
+	.long	0x391e
+	.long	.LLST394
+	.long	.LVUS394
+	.uleb128 0xb
+	.long	0x71f6
+	.quad	.LBI1032
+	.value	.LVU2379
+	.long	.LLRL395
+	.byte	0x1
+	.value	0x749
+	.byte	0x17
+	.long	0x3161
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST396
+	.long	.LVUS396
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST397
+	.long	.LVUS397
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI1034
+	.value	.LVU2381
+	.quad	.LBB1034
+	.quad	.LBE1034-.LBB1034
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x3150
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST398
+	.long	.LVUS398
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL701
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x3929
+	.quad	.LBB1038
+	.quad	.LBE1038-.LBB1038
+	.long	0x3198
+	.uleb128 0x7
+	.long	0x392a
+	.long	.LLST399
+	.long	.LVUS399
+	.uleb128 0x18
+	.quad	.LVL706
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL697
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL709
+	.long	0x3a47
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL400
+	.long	0x328b
+	.uleb128 0xc
+	.long	.LASF1155
+	.value	0x783
+	.byte	0x2a
+	.long	0x450
+	.long	.LLST401
+	.long	.LVUS401
+	.uleb128 0x34
+	.long	0x3937
+	.quad	.LBI1040
+	.value	.LVU2434
+	.long	.LLRL402
+	.value	0x783
+	.byte	0x31
+	.uleb128 0x2
+	.long	0x3949
+	.long	.LLST403
+	.long	.LVUS403
+	.uleb128 0x2
+	.long	0x397b
+	.long	.LLST404
+	.long	.LVUS404
+	.uleb128 0x2
+	.long	0x396e
+	.long	.LLST405
+	.long	.LVUS405
+	.uleb128 0x2
+	.long	0x3961
+	.long	.LLST406
+	.long	.LVUS406
+	.uleb128 0x2
+	.long	0x3954
+	.long	.LLST407
+	.long	.LVUS407
+	.uleb128 0x1d
+	.long	.LLRL402
+	.uleb128 0x7
+	.long	0x3988
+	.long	.LLST408
+	.long	.LVUS408
+	.uleb128 0x7
+	.long	0x3994
+	.long	.LLST409
+	.long	.LVUS409
+	.uleb128 0x2a
+	.long	0x39a0
+	.long	.LLRL410
+	.uleb128 0x7
+	.long	0x39a1
+	.long	.LLST411
+	.long	.LVUS411
+	.uleb128 0x7
+	.long	0x39ae
+	.long	.LLST412
+	.long	.LVUS412
+	.uleb128 0x7
+	.long	0x39b9
+	.long	.LLST413
+	.long	.LVUS413
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1054
+	.quad	.LBE1054-.LBB1054
+	.long	0x32b5
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x79e
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST416
+	.long	.LVUS416
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1055
+	.quad	.LBE1055-.LBB1055
+	.long	0x32df
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7a1
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST417
+	.long	.LVUS417
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL414
+	.long	0x32fd
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7ae
+	.byte	0x2d
+	.long	0x1967
+	.long	.LLST415
+	.long	.LVUS415
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1056
+	.quad	.LBE1056-.LBB1056
+	.long	0x3327
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7c1
+	.byte	0x2d
+	.long	0x1967
+	.long	.LLST418
+	.long	.LVUS418
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1057
+	.quad	.LBE1057-.LBB1057
+	.long	0x3351
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7d3
+	.byte	0x2d
+	.long	0x1967
+	.long	.LLST419
+	.long	.LVUS419
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1061
+	.quad	.LBE1061-.LBB1061
+	.long	0x337b
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7df
+	.byte	0x39
+	.long	0x1967
+	.long	.LLST423
+	.long	.LVUS423
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1062
+	.quad	.LBE1062-.LBB1062
+	.long	0x33a5
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7e3
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST424
+	.long	.LVUS424
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1063
+	.quad	.LBE1063-.LBB1063
+	.long	0x33cf
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7e7
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST425
+	.long	.LVUS425
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1064
+	.quad	.LBE1064-.LBB1064
+	.long	0x33f9
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7eb
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST426
+	.long	.LVUS426
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1065
+	.quad	.LBE1065-.LBB1065
+	.long	0x3423
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7ef
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST427
+	.long	.LVUS427
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1066
+	.quad	.LBE1066-.LBB1066
+	.long	0x344d
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x7f2
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST428
+	.long	.LVUS428
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL432
+	.long	0x346b
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x801
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST433
+	.long	.LVUS433
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1072
+	.quad	.LBE1072-.LBB1072
+	.long	0x3495
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x814
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST434
+	.long	.LVUS434
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1073
+	.quad	.LBE1073-.LBB1073
+	.long	0x34bf
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x817
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST435
+	.long	.LVUS435
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1074
+	.quad	.LBE1074-.LBB1074
+	.long	0x34e9
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x81a
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST436
+	.long	.LVUS436
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1075
+	.quad	.LBE1075-.LBB1075
+	.long	0x3513
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x81b
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST437
+	.long	.LVUS437
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1076
+	.quad	.LBE1076-.LBB1076
+	.long	0x353d
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x81f
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST438
+	.long	.LVUS438
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1077
+	.quad	.LBE1077-.LBB1077
+	.long	0x3567
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x822
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST439
+	.long	.LVUS439
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1078
+	.quad	.LBE1078-.LBB1078
+	.long	0x3591
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x825
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST440
+	.long	.LVUS440
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1079
+	.quad	.LBE1079-.LBB1079
+	.long	0x35bb
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x828
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST441
+	.long	.LVUS441
+	.byte	0
+	.uleb128 0x2e
+	.long	0x35ce
+	.uleb128 0x9
+	.string	"_xp"
+	.byte	0x1
+	.value	0x829
+	.byte	0x31
+	.long	0x1967
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1080
+	.quad	.LBE1080-.LBB1080
+	.long	0x35f8
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x82d
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST442
+	.long	.LVUS442
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1081
+	.quad	.LBE1081-.LBB1081
+	.long	0x3622
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x830
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST443
+	.long	.LVUS443
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1082
+	.quad	.LBE1082-.LBB1082
+	.long	0x364c
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x833
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST444
+	.long	.LVUS444
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB1083
+	.quad	.LBE1083-.LBB1083
+	.long	0x3676
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x834
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST445
+	.long	.LVUS445
+	.byte	0
+	.uleb128 0xb
+	.long	0x39c7
+	.quad	.LBI1019
+	.value	.LVU2283
+	.long	.LLRL377
+	.byte	0x1
+	.value	0x758
+	.byte	0x1f
+	.long	0x36c2
+	.uleb128 0x2
+	.long	0x39d9
+	.long	.LLST378
+	.long	.LVUS378
+	.uleb128 0x27
+	.long	0x39e6
+	.quad	.LBB1021
+	.quad	.LBE1021-.LBB1021
+	.uleb128 0x7
+	.long	0x39eb
+	.long	.LLST379
+	.long	.LVUS379
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x7303
+	.quad	.LBI1058
+	.value	.LVU2607
+	.quad	.LBB1058
+	.quad	.LBE1058-.LBB1058
+	.byte	0x1
+	.value	0x7dc
+	.byte	0x15
+	.long	0x3727
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST420
+	.long	.LVUS420
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST421
+	.long	.LVUS421
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB1060
+	.quad	.LBE1060-.LBB1060
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST422
+	.long	.LVUS422
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x7303
+	.quad	.LBI1067
+	.value	.LVU2668
+	.quad	.LBB1067
+	.quad	.LBE1067-.LBB1067
+	.byte	0x1
+	.value	0x800
+	.byte	0xd
+	.long	0x378c
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST429
+	.long	.LVUS429
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST430
+	.long	.LVUS430
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB1069
+	.quad	.LBE1069-.LBB1069
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST431
+	.long	.LVUS431
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL681
+	.long	0x6a81
+	.long	0x37af
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL712
+	.long	0x3a47
+	.long	0x37cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL717
+	.long	0x6fbd
+	.long	0x37e5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL736
+	.long	0x3a47
+	.long	0x3803
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL739
+	.long	0x3a47
+	.long	0x3821
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL745
+	.long	0x3a47
+	.long	0x383f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL749
+	.long	0x3a47
+	.long	0x385d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL764
+	.long	0x3a47
+	.long	0x387b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL772
+	.long	0x6f46
+	.long	0x3899
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7e
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL787
+	.long	0xce5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC16
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x846
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x480
+	.uleb128 0x19
+	.long	0x323
+	.long	0x38eb
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1307
+	.byte	0x1
+	.value	0x73e
+	.byte	0xd
+	.byte	0x1
+	.long	0x3937
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x73e
+	.byte	0x25
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"lit"
+	.byte	0x1
+	.value	0x73e
+	.byte	0x44
+	.long	0x3ed
+	.uleb128 0x9
+	.string	"enc"
+	.byte	0x1
+	.value	0x744
+	.byte	0xe
+	.long	0x65
+	.uleb128 0x9
+	.string	"u"
+	.byte	0x1
+	.value	0x74e
+	.byte	0x15
+	.long	0x71d
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x1
+	.value	0x74f
+	.byte	0x11
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1308
+	.byte	0x1
+	.value	0x720
+	.byte	0x14
+	.long	0x283
+	.byte	0x1
+	.long	0x39c7
+	.uleb128 0x4
+	.string	"f"
+	.byte	0x1
+	.value	0x721
+	.byte	0x18
+	.long	0x38d6
+	.uleb128 0x4
+	.string	"cur"
+	.byte	0x1
+	.value	0x722
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x15
+	.long	.LASF1309
+	.byte	0x1
+	.value	0x723
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x4
+	.string	"cnt"
+	.byte	0x1
+	.value	0x724
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x15
+	.long	.LASF1162
+	.byte	0x1
+	.value	0x725
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x9
+	.string	"at"
+	.byte	0x1
+	.value	0x727
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x9
+	.string	"lo"
+	.byte	0x1
+	.value	0x728
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"mid"
+	.byte	0x1
+	.value	0x72a
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x9
+	.string	"e"
+	.byte	0x1
+	.value	0x72b
+	.byte	0x15
+	.long	0x127
+	.uleb128 0x2c
+	.long	.LASF1310
+	.value	0x72c
+	.byte	0x10
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1311
+	.byte	0x1
+	.value	0x70d
+	.byte	0x1b
+	.long	0x38d6
+	.byte	0x1
+	.long	0x3a47
+	.uleb128 0x4
+	.string	"pat"
+	.byte	0x1
+	.value	0x70d
+	.byte	0x37
+	.long	0x13dc
+	.uleb128 0x2e
+	.long	0x39f7
+	.uleb128 0x9
+	.string	"f"
+	.byte	0x1
+	.value	0x710
+	.byte	0x1c
+	.long	0x38d6
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2c
+	.long	.LASF1312
+	.value	0x71a
+	.byte	0x29
+	.long	0x319
+	.uleb128 0x22
+	.long	.LASF1313
+	.byte	0x1
+	.value	0x71a
+	.byte	0x5d
+	.long	0x473
+	.uleb128 0x14
+	.long	0x3a04
+	.uleb128 0x9
+	.string	"r_"
+	.byte	0x1
+	.value	0x71a
+	.byte	0x6b
+	.long	0x3a22
+	.uleb128 0x8
+	.long	0x3a04
+	.uleb128 0x9
+	.string	"r2_"
+	.byte	0x1
+	.value	0x71a
+	.byte	0x1a
+	.long	0x3a34
+	.uleb128 0x8
+	.long	0x3a11
+	.uleb128 0x2c
+	.long	.LASF1314
+	.value	0x71a
+	.byte	0x85
+	.long	0x319
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1315
+	.value	0x702
+	.byte	0x11
+	.long	0x65
+	.quad	.LFB598
+	.quad	.LFE598-.LFB598
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ab1
+	.uleb128 0x3
+	.string	"s"
+	.value	0x702
+	.byte	0x2c
+	.long	0x5c8
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x702
+	.byte	0x3f
+	.long	0x13dc
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x13
+	.quad	.LVL96
+	.long	0x6a81
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1316
+	.byte	0x1
+	.value	0x6cd
+	.byte	0xd
+	.byte	0x1
+	.long	0x3b10
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x6cd
+	.byte	0x25
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x6cd
+	.byte	0x32
+	.long	0xe7
+	.uleb128 0x4
+	.string	"sz"
+	.byte	0x1
+	.value	0x6cd
+	.byte	0x3e
+	.long	0x65
+	.uleb128 0x1a
+	.long	.LASF1317
+	.value	0x6cf
+	.byte	0x1f
+	.long	0x3b20
+	.uleb128 0x9
+	.byte	0x3
+	.quad	type_name.1
+	.uleb128 0x9
+	.string	"ux"
+	.byte	0x1
+	.value	0x6e5
+	.byte	0x18
+	.long	0xf3
+	.uleb128 0x2c
+	.long	.LASF1318
+	.value	0x6e6
+	.byte	0x13
+	.long	0x9a
+	.byte	0
+	.uleb128 0x19
+	.long	0x12c
+	.long	0x3b20
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x7
+	.byte	0
+	.uleb128 0x14
+	.long	0x3b10
+	.uleb128 0x1b
+	.long	.LASF1319
+	.byte	0x1
+	.value	0x6c0
+	.byte	0xd
+	.byte	0x1
+	.long	0x3b4a
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x6c0
+	.byte	0x26
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x6c0
+	.byte	0x3c
+	.long	0xf3
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1320
+	.byte	0x1
+	.value	0x6a7
+	.byte	0xd
+	.byte	0x1
+	.long	0x3b91
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x6a7
+	.byte	0x25
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x6a7
+	.byte	0x3b
+	.long	0xf3
+	.uleb128 0x4
+	.string	"sz"
+	.byte	0x1
+	.value	0x6a7
+	.byte	0x47
+	.long	0x65
+	.uleb128 0x1a
+	.long	.LASF1317
+	.value	0x6a9
+	.byte	0x1f
+	.long	0x3b20
+	.uleb128 0x9
+	.byte	0x3
+	.quad	type_name.3
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1321
+	.byte	0x1
+	.value	0x699
+	.byte	0xd
+	.byte	0x1
+	.long	0x3bd8
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x69a
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x69b
+	.byte	0x18
+	.long	0xf3
+	.uleb128 0x4
+	.string	"sz"
+	.byte	0x1
+	.value	0x69c
+	.byte	0xe
+	.long	0x65
+	.uleb128 0x1a
+	.long	.LASF1151
+	.value	0x69e
+	.byte	0x2e
+	.long	0x3be8
+	.uleb128 0x9
+	.byte	0x3
+	.quad	vtab.2
+	.byte	0
+	.uleb128 0x19
+	.long	0x31e
+	.long	0x3be8
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x7
+	.byte	0
+	.uleb128 0x14
+	.long	0x3bd8
+	.uleb128 0x28
+	.long	.LASF1322
+	.value	0x667
+	.byte	0x14
+	.long	0x283
+	.quad	.LFB593
+	.quad	.LFE593-.LFB593
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c2c
+	.uleb128 0x45
+	.long	.LASF1235
+	.value	0x667
+	.byte	0x33
+	.long	0x13dc
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x45
+	.long	.LASF1162
+	.value	0x667
+	.byte	0x40
+	.long	0x11b
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1323
+	.value	0x658
+	.byte	0x11
+	.long	0x65
+	.quad	.LFB592
+	.quad	.LFE592-.LFB592
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c8f
+	.uleb128 0x45
+	.long	.LASF1235
+	.value	0x658
+	.byte	0x31
+	.long	0x13dc
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2d
+	.string	"end"
+	.value	0x658
+	.byte	0x43
+	.long	0x283
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.string	"x"
+	.value	0x65d
+	.byte	0x18
+	.long	0xf3
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x6
+	.string	"u"
+	.value	0x660
+	.byte	0xe
+	.long	0x65
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1324
+	.value	0x5d7
+	.quad	.LFB591
+	.quad	.LFE591-.LFB591
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4190
+	.uleb128 0x3
+	.string	"s"
+	.value	0x5d8
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST193
+	.long	.LVUS193
+	.uleb128 0x3
+	.string	"x"
+	.value	0x5d9
+	.byte	0x18
+	.long	0xf3
+	.long	.LLST194
+	.long	.LVUS194
+	.uleb128 0x1e
+	.long	.LASF1309
+	.value	0x5da
+	.byte	0xe
+	.long	0x65
+	.long	.LLST195
+	.long	.LVUS195
+	.uleb128 0x1e
+	.long	.LASF1318
+	.value	0x5db
+	.byte	0x13
+	.long	0x9a
+	.long	.LLST196
+	.long	.LVUS196
+	.uleb128 0xc
+	.long	.LASF1325
+	.value	0x5ea
+	.byte	0x13
+	.long	0x9a
+	.long	.LLST197
+	.long	.LVUS197
+	.uleb128 0xc
+	.long	.LASF1326
+	.value	0x5eb
+	.byte	0x13
+	.long	0x9a
+	.long	.LLST198
+	.long	.LVUS198
+	.uleb128 0xc
+	.long	.LASF1327
+	.value	0x603
+	.byte	0x12
+	.long	0x4190
+	.long	.LLST199
+	.long	.LVUS199
+	.uleb128 0xc
+	.long	.LASF1328
+	.value	0x607
+	.byte	0x11
+	.long	0x127
+	.long	.LLST200
+	.long	.LVUS200
+	.uleb128 0x2f
+	.string	"buf"
+	.value	0x60a
+	.byte	0xa
+	.long	0x4195
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x6
+	.string	"end"
+	.value	0x60b
+	.byte	0xb
+	.long	0x16a
+	.long	.LLST201
+	.long	.LVUS201
+	.uleb128 0x6
+	.string	"cur"
+	.value	0x60c
+	.byte	0xb
+	.long	0x16a
+	.long	.LLST202
+	.long	.LVUS202
+	.uleb128 0x6
+	.string	"len"
+	.value	0x62e
+	.byte	0xe
+	.long	0x65
+	.long	.LLST203
+	.long	.LVUS203
+	.uleb128 0xc
+	.long	.LASF1329
+	.value	0x62f
+	.byte	0xe
+	.long	0x65
+	.long	.LLST204
+	.long	.LVUS204
+	.uleb128 0x26
+	.long	.LLRL208
+	.long	0x3dc4
+	.uleb128 0x6
+	.string	"i"
+	.value	0x611
+	.byte	0x1a
+	.long	0x65
+	.long	.LLST209
+	.long	.LVUS209
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB772
+	.quad	.LBE772-.LBB772
+	.long	0x3dec
+	.uleb128 0x6
+	.string	"i"
+	.value	0x617
+	.byte	0x1a
+	.long	0x65
+	.long	.LLST210
+	.long	.LVUS210
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL211
+	.long	0x3e0a
+	.uleb128 0xc
+	.long	.LASF1330
+	.value	0x621
+	.byte	0x16
+	.long	0x65
+	.long	.LLST212
+	.long	.LVUS212
+	.byte	0
+	.uleb128 0xb
+	.long	0x41a5
+	.quad	.LBI766
+	.value	.LVU1176
+	.long	.LLRL205
+	.byte	0x1
+	.value	0x60d
+	.byte	0x15
+	.long	0x3e40
+	.uleb128 0x2
+	.long	0x41c2
+	.long	.LLST206
+	.long	.LVUS206
+	.uleb128 0x2
+	.long	0x41b7
+	.long	.LLST207
+	.long	.LVUS207
+	.byte	0
+	.uleb128 0xb
+	.long	0x41a5
+	.quad	.LBI775
+	.value	.LVU1269
+	.long	.LLRL213
+	.byte	0x1
+	.value	0x630
+	.byte	0xf
+	.long	0x3e76
+	.uleb128 0x2
+	.long	0x41c2
+	.long	.LLST214
+	.long	.LVUS214
+	.uleb128 0x2
+	.long	0x41b7
+	.long	.LLST215
+	.long	.LVUS215
+	.byte	0
+	.uleb128 0xb
+	.long	0x624b
+	.quad	.LBI781
+	.value	.LVU1316
+	.long	.LLRL216
+	.byte	0x1
+	.value	0x653
+	.byte	0x5
+	.long	0x40e1
+	.uleb128 0x2
+	.long	0x626f
+	.long	.LLST217
+	.long	.LVUS217
+	.uleb128 0x2
+	.long	0x6264
+	.long	.LLST218
+	.long	.LVUS218
+	.uleb128 0x2
+	.long	0x6259
+	.long	.LLST219
+	.long	.LVUS219
+	.uleb128 0x10
+	.long	0x71f6
+	.quad	.LBI783
+	.value	.LVU1333
+	.quad	.LBB783
+	.quad	.LBE783-.LBB783
+	.byte	0x1
+	.value	0x289
+	.byte	0xd
+	.long	0x3f45
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST220
+	.long	.LVUS220
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST221
+	.long	.LVUS221
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI785
+	.value	.LVU1335
+	.quad	.LBB785
+	.quad	.LBE785-.LBB785
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x3f2e
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST222
+	.long	.LVUS222
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL392
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x71f6
+	.quad	.LBI787
+	.value	.LVU1352
+	.long	.LLRL223
+	.byte	0x1
+	.value	0x291
+	.byte	0xd
+	.long	0x3fba
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST224
+	.long	.LVUS224
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST225
+	.long	.LVUS225
+	.uleb128 0xb
+	.long	0x721f
+	.quad	.LBI789
+	.value	.LVU1354
+	.long	.LLRL226
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x3fa3
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST227
+	.long	.LVUS227
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL398
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x627a
+	.long	.LLRL228
+	.long	0x3fec
+	.uleb128 0x7
+	.long	0x627f
+	.long	.LLST229
+	.long	.LVUS229
+	.uleb128 0x2a
+	.long	0x628a
+	.long	.LLRL230
+	.uleb128 0x7
+	.long	0x628b
+	.long	.LLST231
+	.long	.LVUS231
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x71f6
+	.quad	.LBI802
+	.value	.LVU1383
+	.long	.LLRL232
+	.byte	0x1
+	.value	0x29c
+	.byte	0xd
+	.long	0x4061
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST233
+	.long	.LVUS233
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST234
+	.long	.LVUS234
+	.uleb128 0xb
+	.long	0x721f
+	.quad	.LBI804
+	.value	.LVU1385
+	.long	.LLRL235
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x404a
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST236
+	.long	.LVUS236
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL407
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x6298
+	.long	.LLRL237
+	.long	0x4093
+	.uleb128 0x7
+	.long	0x629d
+	.long	.LLST238
+	.long	.LVUS238
+	.uleb128 0x2a
+	.long	0x62a8
+	.long	.LLRL239
+	.uleb128 0x7
+	.long	0x62a9
+	.long	.LLST240
+	.long	.LVUS240
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x62b6
+	.quad	.LBB818
+	.quad	.LBE818-.LBB818
+	.long	0x40ca
+	.uleb128 0x7
+	.long	0x62b7
+	.long	.LLST241
+	.long	.LVUS241
+	.uleb128 0x18
+	.quad	.LVL413
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL390
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL380
+	.long	0x6f46
+	.long	0x40ff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL382
+	.long	0x6fbd
+	.long	0x4117
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL384
+	.long	0x6fbd
+	.long	0x4135
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL386
+	.long	0x6fbd
+	.long	0x4156
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL389
+	.long	0x6f46
+	.long	0x4174
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x30
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL419
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x127
+	.uleb128 0x19
+	.long	0x7d
+	.long	0x41a5
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1331
+	.byte	0x1
+	.value	0x5d2
+	.byte	0x18
+	.long	0x65
+	.byte	0x3
+	.long	0x41d0
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x5d2
+	.byte	0x2e
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"def"
+	.byte	0x1
+	.value	0x5d2
+	.byte	0x3a
+	.long	0x65
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1332
+	.value	0x58c
+	.quad	.LFB589
+	.quad	.LFE589-.LFB589
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x44de
+	.uleb128 0x3
+	.string	"s"
+	.value	0x58c
+	.byte	0x28
+	.long	0x5c8
+	.long	.LLST523
+	.long	.LVUS523
+	.uleb128 0x1e
+	.long	.LASF1182
+	.value	0x58c
+	.byte	0x37
+	.long	0x70e
+	.long	.LLST524
+	.long	.LVUS524
+	.uleb128 0x2f
+	.string	"s2"
+	.value	0x58e
+	.byte	0x17
+	.long	0xb79
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -480
+	.uleb128 0x4b
+	.long	.LASF1333
+	.long	0x44ee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.4
+	.uleb128 0xc
+	.long	.LASF1190
+	.value	0x597
+	.byte	0x18
+	.long	0xf3
+	.long	.LLST525
+	.long	.LVUS525
+	.uleb128 0x1a
+	.long	.LASF1334
+	.value	0x5ae
+	.byte	0x14
+	.long	0xa9c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0xc
+	.long	.LASF1335
+	.value	0x5af
+	.byte	0x9
+	.long	0x71
+	.long	.LLST526
+	.long	.LVUS526
+	.uleb128 0xb
+	.long	0x6489
+	.quad	.LBI1212
+	.value	.LVU3476
+	.long	.LLRL527
+	.byte	0x1
+	.value	0x5b8
+	.byte	0xd
+	.long	0x42a3
+	.uleb128 0x2
+	.long	0x64a2
+	.long	.LLST528
+	.long	.LVUS528
+	.uleb128 0x2
+	.long	0x6497
+	.long	.LLST529
+	.long	.LVUS529
+	.byte	0
+	.uleb128 0xb
+	.long	0x6433
+	.quad	.LBI1220
+	.value	.LVU3502
+	.long	.LLRL530
+	.byte	0x1
+	.value	0x5be
+	.byte	0x16
+	.long	0x432e
+	.uleb128 0x2
+	.long	0x6450
+	.long	.LLST531
+	.long	.LVUS531
+	.uleb128 0x2
+	.long	0x6445
+	.long	.LLST532
+	.long	.LVUS532
+	.uleb128 0x1d
+	.long	.LLRL530
+	.uleb128 0x7
+	.long	0x645b
+	.long	.LLST533
+	.long	.LVUS533
+	.uleb128 0x2b
+	.long	0x6468
+	.long	.LLRL534
+	.long	0x4312
+	.uleb128 0x7
+	.long	0x6469
+	.long	.LLST535
+	.long	.LVUS535
+	.uleb128 0x7
+	.long	0x6476
+	.long	.LLST536
+	.long	.LVUS536
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL956
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.long	0x63fc
+	.long	.LLRL537
+	.byte	0x1
+	.value	0x5c5
+	.byte	0x9
+	.long	0x4375
+	.uleb128 0xa
+	.long	0x6415
+	.uleb128 0xa
+	.long	0x640a
+	.uleb128 0x2a
+	.long	0x6420
+	.long	.LLRL537
+	.uleb128 0x7
+	.long	0x6421
+	.long	.LLST538
+	.long	.LVUS538
+	.uleb128 0xd
+	.quad	.LVL961
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL938
+	.long	0x6612
+	.long	0x438d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL940
+	.long	0xce5
+	.long	0x43cd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC20
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x594
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.4
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL941
+	.long	0x43e9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -488
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL944
+	.long	0x43fd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL948
+	.long	0x6fbd
+	.long	0x441b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL952
+	.long	0x4437
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -488
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL953
+	.long	0x64df
+	.long	0x444f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL958
+	.long	0x6fbd
+	.long	0x446d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL963
+	.long	0x4489
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -488
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL964
+	.long	0x64df
+	.long	0x44a1
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL966
+	.long	0x6fbd
+	.long	0x44c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x76
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL967
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x89
+	.long	0x44ee
+	.uleb128 0x1c
+	.long	0xdb
+	.byte	0xd
+	.byte	0
+	.uleb128 0x14
+	.long	0x44de
+	.uleb128 0x20
+	.long	.LASF1336
+	.value	0x57e
+	.quad	.LFB588
+	.quad	.LFE588-.LFB588
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x455d
+	.uleb128 0x3
+	.string	"s_"
+	.value	0x57e
+	.byte	0x25
+	.long	0x5c8
+	.long	.LLST296
+	.long	.LVUS296
+	.uleb128 0x3
+	.string	"c"
+	.value	0x57e
+	.byte	0x32
+	.long	0x65
+	.long	.LLST297
+	.long	.LVUS297
+	.uleb128 0x6
+	.string	"s"
+	.value	0x580
+	.byte	0x18
+	.long	0x455d
+	.long	.LLST298
+	.long	.LVUS298
+	.uleb128 0x13
+	.quad	.LVL553
+	.long	0x6532
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xb79
+	.uleb128 0x20
+	.long	.LASF1337
+	.value	0x576
+	.quad	.LFB587
+	.quad	.LFE587-.LFB587
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x45cc
+	.uleb128 0x3
+	.string	"s_"
+	.value	0x576
+	.byte	0x2b
+	.long	0x5c8
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x3
+	.string	"c"
+	.value	0x576
+	.byte	0x38
+	.long	0x65
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x6
+	.string	"s"
+	.value	0x578
+	.byte	0x18
+	.long	0x455d
+	.long	.LLST172
+	.long	.LVUS172
+	.uleb128 0xd
+	.quad	.LVL276
+	.long	0x6562
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1338
+	.byte	0x1
+	.value	0x561
+	.byte	0xd
+	.byte	0x1
+	.long	0x4600
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x561
+	.byte	0x26
+	.long	0x5c8
+	.uleb128 0x15
+	.long	.LASF1235
+	.byte	0x1
+	.value	0x561
+	.byte	0x39
+	.long	0x13dc
+	.uleb128 0x15
+	.long	.LASF1281
+	.byte	0x1
+	.value	0x561
+	.byte	0x4b
+	.long	0x283
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1339
+	.value	0x4b2
+	.quad	.LFB585
+	.quad	.LFE585-.LFB585
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4fc5
+	.uleb128 0x3
+	.string	"s"
+	.value	0x4b2
+	.byte	0x2b
+	.long	0x5c8
+	.long	.LLST299
+	.long	.LVUS299
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x4b2
+	.byte	0x3e
+	.long	0x13dc
+	.long	.LLST300
+	.long	.LVUS300
+	.uleb128 0xc
+	.long	.LASF1281
+	.value	0x4c2
+	.byte	0x11
+	.long	0x283
+	.long	.LLST301
+	.long	.LVUS301
+	.uleb128 0x6
+	.string	"end"
+	.value	0x4c3
+	.byte	0x11
+	.long	0x283
+	.long	.LLST302
+	.long	.LVUS302
+	.uleb128 0x6
+	.string	"q"
+	.value	0x4c9
+	.byte	0x1b
+	.long	0x878
+	.long	.LLST303
+	.long	.LVUS303
+	.uleb128 0x6
+	.string	"ch"
+	.value	0x4ca
+	.byte	0xe
+	.long	0x65
+	.long	.LLST304
+	.long	.LVUS304
+	.uleb128 0xc
+	.long	.LASF1190
+	.value	0x4cb
+	.byte	0x18
+	.long	0xf3
+	.long	.LLST305
+	.long	.LVUS305
+	.uleb128 0x35
+	.long	.LASF1340
+	.value	0x4e9
+	.byte	0xd
+	.quad	.L574
+	.uleb128 0xc
+	.long	.LASF1145
+	.value	0x4f8
+	.byte	0x9
+	.long	0x71
+	.long	.LLST306
+	.long	.LVUS306
+	.uleb128 0x6
+	.string	"out"
+	.value	0x4fa
+	.byte	0x9
+	.long	0x71
+	.long	.LLST307
+	.long	.LVUS307
+	.uleb128 0x2c
+	.long	.LASF1341
+	.value	0x4fb
+	.byte	0x9
+	.long	0x71
+	.uleb128 0xc
+	.long	.LASF1146
+	.value	0x4fd
+	.byte	0x9
+	.long	0x71
+	.long	.LLST308
+	.long	.LVUS308
+	.uleb128 0x6
+	.string	"len"
+	.value	0x4ff
+	.byte	0x9
+	.long	0x71
+	.long	.LLST309
+	.long	.LVUS309
+	.uleb128 0xc
+	.long	.LASF1170
+	.value	0x500
+	.byte	0x9
+	.long	0x71
+	.long	.LLST310
+	.long	.LVUS310
+	.uleb128 0x1a
+	.long	.LASF1334
+	.value	0x505
+	.byte	0x14
+	.long	0xa9c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0xc
+	.long	.LASF1342
+	.value	0x506
+	.byte	0x9
+	.long	0x71
+	.long	.LLST311
+	.long	.LVUS311
+	.uleb128 0xc
+	.long	.LASF1343
+	.value	0x507
+	.byte	0x9
+	.long	0x71
+	.long	.LLST312
+	.long	.LVUS312
+	.uleb128 0x35
+	.long	.LASF1344
+	.value	0x55a
+	.byte	0x1
+	.quad	.L609
+	.uleb128 0x26
+	.long	.LLRL313
+	.long	0x49ae
+	.uleb128 0x2f
+	.string	"pl"
+	.value	0x4d2
+	.byte	0x19
+	.long	0xb29
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0xc
+	.long	.LASF1345
+	.value	0x4d4
+	.byte	0x15
+	.long	0x71
+	.long	.LLST314
+	.long	.LVUS314
+	.uleb128 0xb
+	.long	0x5ce6
+	.quad	.LBI903
+	.value	.LVU1881
+	.long	.LLRL315
+	.byte	0x1
+	.value	0x4d3
+	.byte	0x11
+	.long	0x47ce
+	.uleb128 0x2
+	.long	0x5d00
+	.long	.LLST316
+	.long	.LVUS316
+	.uleb128 0x2
+	.long	0x5cf4
+	.long	.LLST317
+	.long	.LVUS317
+	.byte	0
+	.uleb128 0xb
+	.long	0x6c6b
+	.quad	.LBI909
+	.value	.LVU1916
+	.long	.LLRL318
+	.byte	0x1
+	.value	0x4d7
+	.byte	0x16
+	.long	0x4828
+	.uleb128 0x2
+	.long	0x6c89
+	.long	.LLST319
+	.long	.LVUS319
+	.uleb128 0x2
+	.long	0x6c7e
+	.long	.LLST320
+	.long	.LVUS320
+	.uleb128 0x2
+	.long	0x6c75
+	.long	.LLST321
+	.long	.LVUS321
+	.uleb128 0x2a
+	.long	0x6c94
+	.long	.LLRL322
+	.uleb128 0x7
+	.long	0x6c95
+	.long	.LLST323
+	.long	.LVUS323
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x53a9
+	.quad	.LBI914
+	.value	.LVU1933
+	.long	.LLRL324
+	.byte	0x1
+	.value	0x4d9
+	.byte	0x19
+	.long	0x4959
+	.uleb128 0x2
+	.long	0x53dc
+	.long	.LLST325
+	.long	.LVUS325
+	.uleb128 0x2
+	.long	0x53cf
+	.long	.LLST326
+	.long	.LVUS326
+	.uleb128 0x2
+	.long	0x53c2
+	.long	.LLST327
+	.long	.LVUS327
+	.uleb128 0x2
+	.long	0x53b7
+	.long	.LLST328
+	.long	.LVUS328
+	.uleb128 0x2a
+	.long	0x53e8
+	.long	.LLRL329
+	.uleb128 0x38
+	.long	0x53e9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x7
+	.long	0x53f6
+	.long	.LLST330
+	.long	.LVUS330
+	.uleb128 0x7
+	.long	0x5401
+	.long	.LLST331
+	.long	.LVUS331
+	.uleb128 0x39
+	.long	0x540c
+	.quad	.LBB917
+	.quad	.LBE917-.LBB917
+	.long	0x48ca
+	.uleb128 0x7
+	.long	0x540d
+	.long	.LLST332
+	.long	.LVUS332
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL575
+	.long	0x48f3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x100
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL579
+	.long	0x5750
+	.long	0x4918
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL582
+	.long	0x56bf
+	.long	0x493c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL585
+	.long	0x5622
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL589
+	.long	0x6a81
+	.long	0x497f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL591
+	.long	0x6562
+	.long	0x499d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL594
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL333
+	.long	0x4b7c
+	.uleb128 0x6
+	.string	"sim"
+	.value	0x50e
+	.byte	0x16
+	.long	0x65
+	.long	.LLST334
+	.long	.LVUS334
+	.uleb128 0x26
+	.long	.LLRL345
+	.long	0x49fc
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x51c
+	.byte	0x31
+	.long	0x1967
+	.long	.LLST346
+	.long	.LVUS346
+	.uleb128 0x6
+	.string	"_m"
+	.value	0x51c
+	.byte	0x55
+	.long	0x65
+	.long	.LLST347
+	.long	.LVUS347
+	.byte	0
+	.uleb128 0x10
+	.long	0x6c6b
+	.quad	.LBI924
+	.value	.LVU2082
+	.quad	.LBB924
+	.quad	.LBE924-.LBB924
+	.byte	0x1
+	.value	0x510
+	.byte	0xd
+	.long	0x4a62
+	.uleb128 0x2
+	.long	0x6c89
+	.long	.LLST335
+	.long	.LVUS335
+	.uleb128 0x2
+	.long	0x6c7e
+	.long	.LLST336
+	.long	.LVUS336
+	.uleb128 0x2
+	.long	0x6c75
+	.long	.LLST337
+	.long	.LVUS337
+	.uleb128 0x2a
+	.long	0x6c94
+	.long	.LLRL338
+	.uleb128 0x7
+	.long	0x6c95
+	.long	.LLST339
+	.long	.LVUS339
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x5ffd
+	.quad	.LBI929
+	.value	.LVU2101
+	.long	.LLRL340
+	.byte	0x1
+	.value	0x512
+	.byte	0x11
+	.long	0x4aff
+	.uleb128 0x2
+	.long	0x6023
+	.long	.LLST341
+	.long	.LVUS341
+	.uleb128 0x2
+	.long	0x6016
+	.long	.LLST342
+	.long	.LVUS342
+	.uleb128 0x2
+	.long	0x600b
+	.long	.LLST343
+	.long	.LVUS343
+	.uleb128 0x1d
+	.long	.LLRL340
+	.uleb128 0x38
+	.long	0x6030
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x7
+	.long	0x603d
+	.long	.LLST344
+	.long	.LVUS344
+	.uleb128 0x23
+	.quad	.LVL615
+	.long	0x4ae3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -416
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL617
+	.long	0x61a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL618
+	.long	0x64df
+	.long	0x4b1d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL620
+	.long	0x6a81
+	.long	0x4b43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL622
+	.long	0x6532
+	.long	0x4b61
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL624
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x6489
+	.quad	.LBI937
+	.value	.LVU2132
+	.long	.LLRL348
+	.byte	0x1
+	.value	0x526
+	.byte	0xd
+	.long	0x4bb2
+	.uleb128 0x2
+	.long	0x64a2
+	.long	.LLST349
+	.long	.LVUS349
+	.uleb128 0x2
+	.long	0x6497
+	.long	.LLST350
+	.long	.LVUS350
+	.byte	0
+	.uleb128 0xb
+	.long	0x6c6b
+	.quad	.LBI941
+	.value	.LVU2154
+	.long	.LLRL351
+	.byte	0x1
+	.value	0x527
+	.byte	0xd
+	.long	0x4c0c
+	.uleb128 0x2
+	.long	0x6c89
+	.long	.LLST352
+	.long	.LVUS352
+	.uleb128 0x2
+	.long	0x6c7e
+	.long	.LLST353
+	.long	.LVUS353
+	.uleb128 0x2
+	.long	0x6c75
+	.long	.LLST354
+	.long	.LVUS354
+	.uleb128 0x2a
+	.long	0x6c94
+	.long	.LLRL355
+	.uleb128 0x7
+	.long	0x6c95
+	.long	.LLST356
+	.long	.LVUS356
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x6433
+	.quad	.LBI951
+	.value	.LVU2182
+	.quad	.LBB951
+	.quad	.LBE951-.LBB951
+	.byte	0x1
+	.value	0x537
+	.byte	0x16
+	.long	0x4ca9
+	.uleb128 0x2
+	.long	0x6450
+	.long	.LLST357
+	.long	.LVUS357
+	.uleb128 0x2
+	.long	0x6445
+	.long	.LLST358
+	.long	.LVUS358
+	.uleb128 0x7
+	.long	0x645b
+	.long	.LLST359
+	.long	.LVUS359
+	.uleb128 0x39
+	.long	0x6468
+	.quad	.LBB953
+	.quad	.LBE953-.LBB953
+	.long	0x4c8e
+	.uleb128 0x7
+	.long	0x6469
+	.long	.LLST360
+	.long	.LVUS360
+	.uleb128 0x7
+	.long	0x6476
+	.long	.LLST361
+	.long	.LVUS361
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL641
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.long	0x63fc
+	.quad	.LBB954
+	.quad	.LBE954-.LBB954
+	.byte	0x1
+	.value	0x53f
+	.byte	0x9
+	.long	0x4d08
+	.uleb128 0xa
+	.long	0x6415
+	.uleb128 0xa
+	.long	0x640a
+	.uleb128 0x27
+	.long	0x6420
+	.quad	.LBB955
+	.quad	.LBE955-.LBB955
+	.uleb128 0x7
+	.long	0x6421
+	.long	.LLST362
+	.long	.LVUS362
+	.uleb128 0xd
+	.quad	.LVL648
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x6c6b
+	.quad	.LBI956
+	.value	.LVU2221
+	.quad	.LBB956
+	.quad	.LBE956-.LBB956
+	.byte	0x1
+	.value	0x545
+	.byte	0x9
+	.long	0x4d6e
+	.uleb128 0x2
+	.long	0x6c89
+	.long	.LLST363
+	.long	.LVUS363
+	.uleb128 0x2
+	.long	0x6c7e
+	.long	.LLST364
+	.long	.LVUS364
+	.uleb128 0x2
+	.long	0x6c75
+	.long	.LLST365
+	.long	.LVUS365
+	.uleb128 0x2a
+	.long	0x6c94
+	.long	.LLRL366
+	.uleb128 0x7
+	.long	0x6c95
+	.long	.LLST367
+	.long	.LVUS367
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.quad	.LVL561
+	.long	0x62c4
+	.long	0x4d87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL562
+	.long	0x4d9b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL564
+	.long	0x6612
+	.long	0x4db3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL631
+	.long	0x6a81
+	.long	0x4ddb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL633
+	.long	0x64df
+	.long	0x4dfb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL635
+	.long	0x4fc5
+	.long	0x4e29
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL637
+	.long	0x6532
+	.long	0x4e49
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL645
+	.long	0x6fbd
+	.long	0x4e6d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x94
+	.byte	0x4
+	.byte	0x9
+	.byte	0xf8
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL646
+	.long	0x6fbd
+	.long	0x4e90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -424
+	.byte	0x94
+	.byte	0x4
+	.byte	0x40
+	.byte	0x25
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL653
+	.long	0x5da8
+	.long	0x4eb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL654
+	.long	0x5ea7
+	.long	0x4edc
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL655
+	.long	0x5d42
+	.long	0x4f02
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL656
+	.long	0x4fc5
+	.long	0x4f34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL657
+	.long	0x6a81
+	.long	0x4f5a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -448
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL660
+	.long	0x6532
+	.long	0x4f78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x54
+	.quad	.LVL662
+	.long	0x64df
+	.uleb128 0x5
+	.quad	.LVL663
+	.long	0x6fbd
+	.long	0x4faa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -420
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL664
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1346
+	.value	0x46a
+	.quad	.LFB584
+	.quad	.LFE584-.LFB584
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53a9
+	.uleb128 0x3
+	.string	"s"
+	.value	0x46b
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST270
+	.long	.LVUS270
+	.uleb128 0x3
+	.string	"q"
+	.value	0x46c
+	.byte	0x1b
+	.long	0x878
+	.long	.LLST271
+	.long	.LVUS271
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x46d
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST272
+	.long	.LVUS272
+	.uleb128 0x3
+	.string	"end"
+	.value	0x46e
+	.byte	0x11
+	.long	0x283
+	.long	.LLST273
+	.long	.LVUS273
+	.uleb128 0x3
+	.string	"max"
+	.value	0x46f
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST274
+	.long	.LVUS274
+	.uleb128 0x2f
+	.string	"cps"
+	.value	0x474
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x6
+	.string	"n"
+	.value	0x475
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST275
+	.long	.LVUS275
+	.uleb128 0xc
+	.long	.LASF1281
+	.value	0x479
+	.byte	0x11
+	.long	0x283
+	.long	.LLST276
+	.long	.LVUS276
+	.uleb128 0x2f
+	.string	"pl"
+	.value	0x47a
+	.byte	0xd
+	.long	0xb29
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x6
+	.string	"m"
+	.value	0x47c
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST277
+	.long	.LVUS277
+	.uleb128 0x11
+	.quad	.LBB862
+	.quad	.LBE862-.LBB862
+	.long	0x518b
+	.uleb128 0x6
+	.string	"p"
+	.value	0x47f
+	.byte	0x1e
+	.long	0xb14
+	.long	.LLST282
+	.long	.LVUS282
+	.uleb128 0x6
+	.string	"e"
+	.value	0x480
+	.byte	0x1e
+	.long	0xb14
+	.long	.LLST283
+	.long	.LVUS283
+	.uleb128 0x10
+	.long	0x7277
+	.quad	.LBI863
+	.value	.LVU1688
+	.quad	.LBB863
+	.quad	.LBE863-.LBB863
+	.byte	0x1
+	.value	0x488
+	.byte	0xd
+	.long	0x5121
+	.uleb128 0x2
+	.long	0x7289
+	.long	.LLST284
+	.long	.LVUS284
+	.uleb128 0x7
+	.long	0x7295
+	.long	.LLST285
+	.long	.LVUS285
+	.uleb128 0x7
+	.long	0x72a0
+	.long	.LLST286
+	.long	.LVUS286
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL498
+	.long	0x5750
+	.long	0x514c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -112
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x7
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL501
+	.long	0x5422
+	.long	0x5170
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL515
+	.long	0x6532
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL287
+	.long	0x5271
+	.uleb128 0x6
+	.string	"p"
+	.value	0x48e
+	.byte	0x19
+	.long	0x718
+	.long	.LLST288
+	.long	.LVUS288
+	.uleb128 0x6
+	.string	"e"
+	.value	0x48f
+	.byte	0x19
+	.long	0x718
+	.long	.LLST289
+	.long	.LVUS289
+	.uleb128 0x10
+	.long	0x723d
+	.quad	.LBI866
+	.value	.LVU1775
+	.quad	.LBB866
+	.quad	.LBE866-.LBB866
+	.byte	0x1
+	.value	0x497
+	.byte	0xd
+	.long	0x5207
+	.uleb128 0x2
+	.long	0x724f
+	.long	.LLST290
+	.long	.LVUS290
+	.uleb128 0x7
+	.long	0x725b
+	.long	.LLST291
+	.long	.LVUS291
+	.uleb128 0x7
+	.long	0x7266
+	.long	.LLST292
+	.long	.LVUS292
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL524
+	.long	0x56bf
+	.long	0x5232
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL529
+	.long	0x5422
+	.long	0x5256
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL537
+	.long	0x6532
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB870
+	.quad	.LBE870-.LBB870
+	.long	0x5316
+	.uleb128 0x6
+	.string	"p"
+	.value	0x49d
+	.byte	0x19
+	.long	0x71d
+	.long	.LLST294
+	.long	.LVUS294
+	.uleb128 0x6
+	.string	"e"
+	.value	0x49e
+	.byte	0x19
+	.long	0x71d
+	.long	.LLST295
+	.long	.LVUS295
+	.uleb128 0x5
+	.quad	.LVL542
+	.long	0x5622
+	.long	0x52d7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -104
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x9
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x6
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x32
+	.byte	0x26
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL544
+	.long	0x5422
+	.long	0x52fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL547
+	.long	0x6532
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB868
+	.quad	.LBE868-.LBB868
+	.long	0x5340
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x4af
+	.byte	0x29
+	.long	0x1967
+	.long	.LLST293
+	.long	.LVUS293
+	.byte	0
+	.uleb128 0xb
+	.long	0x5d11
+	.quad	.LBI858
+	.value	.LVU1632
+	.long	.LLRL278
+	.byte	0x1
+	.value	0x47b
+	.byte	0x5
+	.long	0x5383
+	.uleb128 0x2
+	.long	0x5d36
+	.long	.LLST279
+	.long	.LVUS279
+	.uleb128 0x2
+	.long	0x5d2b
+	.long	.LLST280
+	.long	.LVUS280
+	.uleb128 0x2
+	.long	0x5d1f
+	.long	.LLST281
+	.long	.LVUS281
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL489
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1347
+	.byte	0x1
+	.value	0x43d
+	.byte	0xd
+	.byte	0x1
+	.long	0x541d
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x43e
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x15
+	.long	.LASF1235
+	.byte	0x1
+	.value	0x43f
+	.byte	0x15
+	.long	0x13dc
+	.uleb128 0x4
+	.string	"end"
+	.byte	0x1
+	.value	0x440
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x4
+	.string	"pl"
+	.byte	0x1
+	.value	0x441
+	.byte	0x14
+	.long	0x541d
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"cps"
+	.byte	0x1
+	.value	0x447
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x1
+	.value	0x448
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x9
+	.string	"m"
+	.byte	0x1
+	.value	0x449
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"_xp"
+	.byte	0x1
+	.value	0x45a
+	.byte	0x31
+	.long	0x1967
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xb36
+	.uleb128 0x20
+	.long	.LASF1348
+	.value	0x40c
+	.quad	.LFB582
+	.quad	.LFE582-.LFB582
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5622
+	.uleb128 0x3
+	.string	"s"
+	.value	0x40d
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST246
+	.long	.LVUS246
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x40e
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST247
+	.long	.LVUS247
+	.uleb128 0x3
+	.string	"run"
+	.value	0x40f
+	.byte	0x11
+	.long	0x283
+	.long	.LLST248
+	.long	.LVUS248
+	.uleb128 0x11
+	.quad	.LBB825
+	.quad	.LBE825-.LBB825
+	.long	0x5504
+	.uleb128 0x6
+	.string	"p"
+	.value	0x41e
+	.byte	0x1e
+	.long	0xb14
+	.long	.LLST249
+	.long	.LVUS249
+	.uleb128 0x10
+	.long	0x7277
+	.quad	.LBI826
+	.value	.LVU1473
+	.quad	.LBB826
+	.quad	.LBE826-.LBB826
+	.byte	0x1
+	.value	0x420
+	.byte	0xd
+	.long	0x54ef
+	.uleb128 0x2
+	.long	0x7289
+	.long	.LLST250
+	.long	.LVUS250
+	.uleb128 0x7
+	.long	0x7295
+	.long	.LLST251
+	.long	.LVUS251
+	.uleb128 0x7
+	.long	0x72a0
+	.long	.LLST252
+	.long	.LVUS252
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL446
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB828
+	.quad	.LBE828-.LBB828
+	.long	0x558f
+	.uleb128 0x6
+	.string	"p"
+	.value	0x426
+	.byte	0x19
+	.long	0x718
+	.long	.LLST253
+	.long	.LVUS253
+	.uleb128 0x10
+	.long	0x723d
+	.quad	.LBI829
+	.value	.LVU1527
+	.quad	.LBB829
+	.quad	.LBE829-.LBB829
+	.byte	0x1
+	.value	0x428
+	.byte	0xd
+	.long	0x557a
+	.uleb128 0x2
+	.long	0x724f
+	.long	.LLST254
+	.long	.LVUS254
+	.uleb128 0x7
+	.long	0x725b
+	.long	.LLST255
+	.long	.LVUS255
+	.uleb128 0x7
+	.long	0x7266
+	.long	.LLST256
+	.long	.LVUS256
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL456
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB831
+	.quad	.LBE831-.LBB831
+	.long	0x55cb
+	.uleb128 0x6
+	.string	"p"
+	.value	0x42e
+	.byte	0x19
+	.long	0x71d
+	.long	.LLST257
+	.long	.LVUS257
+	.uleb128 0xd
+	.quad	.LVL460
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL427
+	.long	0x5da8
+	.long	0x55ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL429
+	.long	0x5ea7
+	.long	0x560d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL431
+	.long	0x5d42
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1349
+	.value	0x3fe
+	.byte	0xf
+	.long	0x11b
+	.quad	.LFB581
+	.quad	.LFE581-.LFB581
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x56bf
+	.uleb128 0x3
+	.string	"pl"
+	.value	0x3fe
+	.byte	0x2e
+	.long	0x541d
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x3
+	.string	"p"
+	.value	0x3fe
+	.byte	0x42
+	.long	0x71d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x3
+	.string	"n"
+	.value	0x3fe
+	.byte	0x4c
+	.long	0x11b
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x6
+	.string	"i"
+	.value	0x400
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x34
+	.long	0x5cbc
+	.quad	.LBI428
+	.value	.LVU253
+	.long	.LLRL47
+	.value	0x401
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x5cda
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x2
+	.long	0x5cce
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1350
+	.value	0x3f5
+	.byte	0xf
+	.long	0x11b
+	.quad	.LFB580
+	.quad	.LFE580-.LFB580
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5750
+	.uleb128 0x2d
+	.string	"pl"
+	.value	0x3f5
+	.byte	0x2e
+	.long	0x541d
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2d
+	.string	"p"
+	.value	0x3f5
+	.byte	0x42
+	.long	0x718
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.string	"n"
+	.value	0x3f5
+	.byte	0x4c
+	.long	0x11b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x6
+	.string	"i"
+	.value	0x3f7
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x34
+	.long	0x5cbc
+	.quad	.LBI416
+	.value	.LVU209
+	.long	.LLRL40
+	.value	0x3f8
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x5cda
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x5cce
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1351
+	.value	0x3e3
+	.byte	0xf
+	.long	0x11b
+	.quad	.LFB579
+	.quad	.LFE579-.LFB579
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5c5d
+	.uleb128 0x3
+	.string	"pl"
+	.value	0x3e3
+	.byte	0x2d
+	.long	0x541d
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x2d
+	.string	"p"
+	.value	0x3e3
+	.byte	0x46
+	.long	0xb14
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.string	"n"
+	.value	0x3e3
+	.byte	0x50
+	.long	0x11b
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x6
+	.string	"i"
+	.value	0x3e5
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x26
+	.long	.LLRL81
+	.long	0x5c2b
+	.uleb128 0x6
+	.string	"m"
+	.value	0x3e9
+	.byte	0x12
+	.long	0x65
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0xb
+	.long	0x5c5d
+	.quad	.LBI456
+	.value	.LVU483
+	.long	.LLRL83
+	.byte	0x1
+	.value	0x3e9
+	.byte	0x16
+	.long	0x5c06
+	.uleb128 0x2
+	.long	0x5c7b
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x2
+	.long	0x5c6f
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x1d
+	.long	.LLRL83
+	.uleb128 0x7
+	.long	0x5c86
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x2b
+	.long	0x5ca3
+	.long	.LLRL87
+	.long	0x59ad
+	.uleb128 0x4c
+	.long	0x5ca4
+	.uleb128 0x4c
+	.long	0x5caf
+	.uleb128 0xb
+	.long	0x7059
+	.quad	.LBI459
+	.value	.LVU500
+	.long	.LLRL88
+	.byte	0x1
+	.value	0x3d4
+	.byte	0x15
+	.long	0x5854
+	.uleb128 0xa
+	.long	0x7075
+	.uleb128 0xa
+	.long	0x7068
+	.byte	0
+	.uleb128 0xb
+	.long	0x7005
+	.quad	.LBI464
+	.value	.LVU507
+	.long	.LLRL89
+	.byte	0x1
+	.value	0x3d5
+	.byte	0x15
+	.long	0x587a
+	.uleb128 0xa
+	.long	0x7021
+	.uleb128 0xa
+	.long	0x7014
+	.byte	0
+	.uleb128 0xb
+	.long	0x7005
+	.quad	.LBI469
+	.value	.LVU504
+	.long	.LLRL90
+	.byte	0x1
+	.value	0x3d5
+	.byte	0x15
+	.long	0x58a0
+	.uleb128 0xa
+	.long	0x7021
+	.uleb128 0xa
+	.long	0x7014
+	.byte	0
+	.uleb128 0xb
+	.long	0x702f
+	.quad	.LBI475
+	.value	.LVU529
+	.long	.LLRL91
+	.byte	0x1
+	.value	0x3d7
+	.byte	0xd
+	.long	0x58c6
+	.uleb128 0xa
+	.long	0x704b
+	.uleb128 0xa
+	.long	0x703e
+	.byte	0
+	.uleb128 0xb
+	.long	0x7005
+	.quad	.LBI479
+	.value	.LVU522
+	.long	.LLRL92
+	.byte	0x1
+	.value	0x3d6
+	.byte	0xd
+	.long	0x58ec
+	.uleb128 0xa
+	.long	0x7021
+	.uleb128 0xa
+	.long	0x7014
+	.byte	0
+	.uleb128 0xb
+	.long	0x7005
+	.quad	.LBI484
+	.value	.LVU514
+	.long	.LLRL93
+	.byte	0x1
+	.value	0x3d6
+	.byte	0xd
+	.long	0x5912
+	.uleb128 0xa
+	.long	0x7021
+	.uleb128 0xa
+	.long	0x7014
+	.byte	0
+	.uleb128 0xb
+	.long	0x70ad
+	.quad	.LBI492
+	.value	.LVU510
+	.long	.LLRL94
+	.byte	0x1
+	.value	0x3d5
+	.byte	0x15
+	.long	0x5938
+	.uleb128 0xa
+	.long	0x70c9
+	.uleb128 0xa
+	.long	0x70bc
+	.byte	0
+	.uleb128 0xb
+	.long	0x70ad
+	.quad	.LBI504
+	.value	.LVU525
+	.long	.LLRL95
+	.byte	0x1
+	.value	0x3d6
+	.byte	0xd
+	.long	0x595e
+	.uleb128 0xa
+	.long	0x70c9
+	.uleb128 0xa
+	.long	0x70bc
+	.byte	0
+	.uleb128 0xb
+	.long	0x7059
+	.quad	.LBI508
+	.value	.LVU532
+	.long	.LLRL96
+	.byte	0x1
+	.value	0x3d7
+	.byte	0xd
+	.long	0x5984
+	.uleb128 0xa
+	.long	0x7075
+	.uleb128 0xa
+	.long	0x7068
+	.byte	0
+	.uleb128 0x3d
+	.long	0x6fe8
+	.quad	.LBI512
+	.value	.LVU536
+	.quad	.LBB512
+	.quad	.LBE512-.LBB512
+	.value	0x3d8
+	.byte	0x1c
+	.uleb128 0xa
+	.long	0x6ff7
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x5c92
+	.long	.LLRL97
+	.long	0x5bba
+	.uleb128 0x7
+	.long	0x5c97
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0xb
+	.long	0x7005
+	.quad	.LBI524
+	.value	.LVU549
+	.long	.LLRL99
+	.byte	0x1
+	.value	0x3c7
+	.byte	0x15
+	.long	0x59ed
+	.uleb128 0xa
+	.long	0x7021
+	.uleb128 0xa
+	.long	0x7014
+	.byte	0
+	.uleb128 0xb
+	.long	0x702f
+	.quad	.LBI527
+	.value	.LVU569
+	.long	.LLRL100
+	.byte	0x1
+	.value	0x3cb
+	.byte	0xd
+	.long	0x5a13
+	.uleb128 0xa
+	.long	0x704b
+	.uleb128 0xa
+	.long	0x703e
+	.byte	0
+	.uleb128 0xb
+	.long	0x702f
+	.quad	.LBI532
+	.value	.LVU576
+	.long	.LLRL101
+	.byte	0x1
+	.value	0x3cc
+	.byte	0xd
+	.long	0x5a39
+	.uleb128 0xa
+	.long	0x704b
+	.uleb128 0xa
+	.long	0x703e
+	.byte	0
+	.uleb128 0xb
+	.long	0x702f
+	.quad	.LBI536
+	.value	.LVU583
+	.long	.LLRL102
+	.byte	0x1
+	.value	0x3cd
+	.byte	0xd
+	.long	0x5a5f
+	.uleb128 0xa
+	.long	0x704b
+	.uleb128 0xa
+	.long	0x703e
+	.byte	0
+	.uleb128 0xb
+	.long	0x7005
+	.quad	.LBI542
+	.value	.LVU559
+	.long	.LLRL103
+	.byte	0x1
+	.value	0x3c9
+	.byte	0x11
+	.long	0x5a85
+	.uleb128 0xa
+	.long	0x7021
+	.uleb128 0xa
+	.long	0x7014
+	.byte	0
+	.uleb128 0xb
+	.long	0x7083
+	.quad	.LBI545
+	.value	.LVU562
+	.long	.LLRL104
+	.byte	0x1
+	.value	0x3c9
+	.byte	0x11
+	.long	0x5ab3
+	.uleb128 0x2
+	.long	0x709f
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0xa
+	.long	0x7092
+	.byte	0
+	.uleb128 0x10
+	.long	0x7059
+	.quad	.LBI551
+	.value	.LVU572
+	.quad	.LBB551
+	.quad	.LBE551-.LBB551
+	.byte	0x1
+	.value	0x3cb
+	.byte	0xd
+	.long	0x5aed
+	.uleb128 0xa
+	.long	0x7075
+	.uleb128 0x2
+	.long	0x7068
+	.long	.LLST106
+	.long	.LVUS106
+	.byte	0
+	.uleb128 0x10
+	.long	0x7059
+	.quad	.LBI554
+	.value	.LVU579
+	.quad	.LBB554
+	.quad	.LBE554-.LBB554
+	.byte	0x1
+	.value	0x3cc
+	.byte	0xd
+	.long	0x5b1f
+	.uleb128 0xa
+	.long	0x7075
+	.uleb128 0xa
+	.long	0x7068
+	.byte	0
+	.uleb128 0x10
+	.long	0x7059
+	.quad	.LBI557
+	.value	.LVU586
+	.quad	.LBB557
+	.quad	.LBE557-.LBB557
+	.byte	0x1
+	.value	0x3cd
+	.byte	0xd
+	.long	0x5b51
+	.uleb128 0xa
+	.long	0x7075
+	.uleb128 0xa
+	.long	0x7068
+	.byte	0
+	.uleb128 0xb
+	.long	0x702f
+	.quad	.LBI559
+	.value	.LVU590
+	.long	.LLRL107
+	.byte	0x1
+	.value	0x3ce
+	.byte	0xd
+	.long	0x5b77
+	.uleb128 0xa
+	.long	0x704b
+	.uleb128 0xa
+	.long	0x703e
+	.byte	0
+	.uleb128 0xb
+	.long	0x7059
+	.quad	.LBI562
+	.value	.LVU593
+	.long	.LLRL108
+	.byte	0x1
+	.value	0x3ce
+	.byte	0xd
+	.long	0x5b9d
+	.uleb128 0xa
+	.long	0x7075
+	.uleb128 0xa
+	.long	0x7068
+	.byte	0
+	.uleb128 0x34
+	.long	0x6fe8
+	.quad	.LBI566
+	.value	.LVU597
+	.long	.LLRL109
+	.value	0x3cf
+	.byte	0x1b
+	.uleb128 0xa
+	.long	0x6ff7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x702f
+	.quad	.LBI580
+	.value	.LVU612
+	.long	.LLRL110
+	.byte	0x1
+	.value	0x3d2
+	.byte	0x1b
+	.long	0x5be8
+	.uleb128 0xa
+	.long	0x704b
+	.uleb128 0x2
+	.long	0x703e
+	.long	.LLST111
+	.long	.LVUS111
+	.byte	0
+	.uleb128 0x34
+	.long	0x6fe8
+	.quad	.LBI583
+	.value	.LVU615
+	.long	.LLRL112
+	.value	0x3d2
+	.byte	0x1b
+	.uleb128 0xa
+	.long	0x6ff7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x70d7
+	.quad	.LBI590
+	.value	.LVU479
+	.long	.LLRL113
+	.value	0x3e9
+	.byte	0x16
+	.uleb128 0x2
+	.long	0x70e6
+	.long	.LLST114
+	.long	.LVUS114
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x5cbc
+	.quad	.LBI598
+	.value	.LVU636
+	.long	.LLRL115
+	.value	0x3ef
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x5cda
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x2
+	.long	0x5cce
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1352
+	.byte	0x1
+	.value	0x3c0
+	.byte	0x18
+	.long	0x65
+	.byte	0x3
+	.long	0x5cbc
+	.uleb128 0x4
+	.string	"pl"
+	.byte	0x1
+	.value	0x3c0
+	.byte	0x38
+	.long	0x541d
+	.uleb128 0x4
+	.string	"v"
+	.byte	0x1
+	.value	0x3c0
+	.byte	0x44
+	.long	0x8f0
+	.uleb128 0x2c
+	.long	.LASF1214
+	.value	0x3c2
+	.byte	0xe
+	.long	0x65
+	.uleb128 0x2e
+	.long	0x5ca3
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x1
+	.value	0x3c7
+	.byte	0x11
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"l"
+	.byte	0x1
+	.value	0x3d4
+	.byte	0x11
+	.long	0x8f0
+	.uleb128 0x9
+	.string	"x"
+	.byte	0x1
+	.value	0x3d5
+	.byte	0x11
+	.long	0x8f0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1353
+	.byte	0x1
+	.value	0x3a9
+	.byte	0x13
+	.long	0x71
+	.byte	0x3
+	.long	0x5ce6
+	.uleb128 0x4
+	.string	"pl"
+	.byte	0x1
+	.value	0x3a9
+	.byte	0x2d
+	.long	0x541d
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x3a9
+	.byte	0x3a
+	.long	0x65
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1354
+	.byte	0x1
+	.value	0x395
+	.byte	0xd
+	.byte	0x1
+	.long	0x5d0c
+	.uleb128 0x4
+	.string	"pl"
+	.byte	0x1
+	.value	0x395
+	.byte	0x22
+	.long	0x5d0c
+	.uleb128 0x4
+	.string	"q"
+	.byte	0x1
+	.value	0x395
+	.byte	0x3c
+	.long	0x878
+	.byte	0
+	.uleb128 0x8
+	.long	0xb29
+	.uleb128 0x1b
+	.long	.LASF1355
+	.byte	0x1
+	.value	0x380
+	.byte	0xd
+	.byte	0x1
+	.long	0x5d42
+	.uleb128 0x4
+	.string	"pl"
+	.byte	0x1
+	.value	0x380
+	.byte	0x23
+	.long	0x5d0c
+	.uleb128 0x4
+	.string	"q"
+	.byte	0x1
+	.value	0x380
+	.byte	0x3d
+	.long	0x878
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x380
+	.byte	0x53
+	.long	0x199b
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1356
+	.byte	0x1
+	.value	0x32c
+	.byte	0xd
+	.byte	0x1
+	.long	0x5da8
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x32d
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x15
+	.long	.LASF1235
+	.byte	0x1
+	.value	0x32e
+	.byte	0x15
+	.long	0x13dc
+	.uleb128 0x4
+	.string	"end"
+	.byte	0x1
+	.value	0x32f
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"max"
+	.byte	0x1
+	.value	0x337
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x9
+	.string	"cps"
+	.byte	0x1
+	.value	0x33b
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x1
+	.value	0x33c
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x9
+	.string	"k"
+	.byte	0x1
+	.value	0x340
+	.byte	0x10
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1357
+	.value	0x311
+	.quad	.LFB573
+	.quad	.LFE573-.LFB573
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5ea7
+	.uleb128 0x3
+	.string	"s"
+	.value	0x312
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x313
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x3
+	.string	"end"
+	.value	0x314
+	.byte	0x11
+	.long	0x283
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x2f
+	.string	"cps"
+	.value	0x319
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.string	"n"
+	.value	0x31a
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x6
+	.string	"k"
+	.value	0x31e
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x23
+	.quad	.LVL52
+	.long	0x5e59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x9
+	.byte	0xff
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL56
+	.long	0x5e72
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL58
+	.long	0x5e86
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL59
+	.long	0x61a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1358
+	.value	0x2f2
+	.quad	.LFB572
+	.quad	.LFE572-.LFB572
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5ffd
+	.uleb128 0x3
+	.string	"s"
+	.value	0x2f3
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x2f4
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x3
+	.string	"end"
+	.value	0x2f5
+	.byte	0x11
+	.long	0x283
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0xc
+	.long	.LASF1330
+	.value	0x2fa
+	.byte	0xe
+	.long	0x65
+	.long	.LLST72
+	.long	.LVUS72
+	.uleb128 0x26
+	.long	.LLRL73
+	.long	0x5fd6
+	.uleb128 0x2f
+	.string	"cps"
+	.value	0x2fd
+	.byte	0x10
+	.long	0x11b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.string	"n"
+	.value	0x2fe
+	.byte	0x10
+	.long	0x11b
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0xb
+	.long	0x721f
+	.quad	.LBI446
+	.value	.LVU435
+	.long	.LLRL75
+	.byte	0x1
+	.value	0x2fe
+	.byte	0x30
+	.long	0x5f66
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI452
+	.value	.LVU452
+	.quad	.LBB452
+	.quad	.LBE452-.LBB452
+	.byte	0x1
+	.value	0x305
+	.byte	0xd
+	.long	0x5f9b
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST77
+	.long	.LVUS77
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL126
+	.long	0x5fbb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL129
+	.long	0x61a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL124
+	.long	0x6049
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1359
+	.byte	0x1
+	.value	0x2de
+	.byte	0xd
+	.byte	0x1
+	.long	0x6049
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x2df
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x15
+	.long	.LASF1235
+	.byte	0x1
+	.value	0x2e0
+	.byte	0x15
+	.long	0x13dc
+	.uleb128 0x4
+	.string	"end"
+	.byte	0x1
+	.value	0x2e1
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x9
+	.string	"cps"
+	.byte	0x1
+	.value	0x2e6
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x1
+	.value	0x2e7
+	.byte	0xc
+	.long	0x11b
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1360
+	.value	0x2c8
+	.byte	0xc
+	.long	0x71
+	.quad	.LFB570
+	.quad	.LFE570-.LFB570
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x61a2
+	.uleb128 0x3
+	.string	"s"
+	.value	0x2c9
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x2ca
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x3
+	.string	"end"
+	.value	0x2cb
+	.byte	0x11
+	.long	0x283
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x1e
+	.long	.LASF1361
+	.value	0x2cc
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x2f
+	.string	"cps"
+	.value	0x2d1
+	.byte	0xc
+	.long	0x11b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.long	0x721f
+	.quad	.LBI408
+	.value	.LVU134
+	.long	.LLRL28
+	.byte	0x1
+	.value	0x2ce
+	.byte	0x9
+	.long	0x60f1
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0x10
+	.long	0x71f6
+	.quad	.LBI412
+	.value	.LVU153
+	.quad	.LBB412
+	.quad	.LBE412-.LBB412
+	.byte	0x1
+	.value	0x2d6
+	.byte	0xc
+	.long	0x617e
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI414
+	.value	.LVU155
+	.quad	.LBB414
+	.quad	.LBE414-.LBB414
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x6167
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST32
+	.long	.LVUS32
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL45
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL43
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x34
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1362
+	.value	0x2b8
+	.quad	.LFB569
+	.quad	.LFE569-.LFB569
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6226
+	.uleb128 0x3
+	.string	"s"
+	.value	0x2b9
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x2ba
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x3
+	.string	"n"
+	.value	0x2bb
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x3
+	.string	"cps"
+	.value	0x2bc
+	.byte	0xc
+	.long	0x11b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1d
+	.long	.LLRL22
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x2c0
+	.byte	0x29
+	.long	0x1967
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1363
+	.byte	0x1
+	.value	0x2ab
+	.byte	0xd
+	.byte	0x1
+	.long	0x624b
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x2ab
+	.byte	0x25
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x1
+	.value	0x2ab
+	.byte	0x34
+	.long	0x283
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1364
+	.byte	0x1
+	.value	0x27d
+	.byte	0xd
+	.byte	0x1
+	.long	0x62c4
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x27d
+	.byte	0x27
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"p"
+	.byte	0x1
+	.value	0x27d
+	.byte	0x36
+	.long	0x127
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x1
+	.value	0x27d
+	.byte	0x40
+	.long	0x11b
+	.uleb128 0x2e
+	.long	0x6298
+	.uleb128 0x9
+	.string	"w"
+	.byte	0x1
+	.value	0x292
+	.byte	0x17
+	.long	0x2716
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x1
+	.value	0x293
+	.byte	0x19
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x62b6
+	.uleb128 0x9
+	.string	"w"
+	.byte	0x1
+	.value	0x29d
+	.byte	0x17
+	.long	0x271b
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x1
+	.value	0x29e
+	.byte	0x19
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x1
+	.value	0x2a6
+	.byte	0x11
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1365
+	.value	0x262
+	.quad	.LFB566
+	.quad	.LFE566-.LFB566
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x63fc
+	.uleb128 0x3
+	.string	"s"
+	.value	0x262
+	.byte	0x28
+	.long	0x5c8
+	.long	.LLST189
+	.long	.LVUS189
+	.uleb128 0x1e
+	.long	.LASF1281
+	.value	0x262
+	.byte	0x37
+	.long	0x127
+	.long	.LLST190
+	.long	.LVUS190
+	.uleb128 0x4b
+	.long	.LASF1333
+	.long	0x44ee
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.6
+	.uleb128 0x11
+	.quad	.LBB738
+	.quad	.LBE738-.LBB738
+	.long	0x6344
+	.uleb128 0x6
+	.string	"cur"
+	.value	0x268
+	.byte	0x19
+	.long	0x127
+	.long	.LLST191
+	.long	.LVUS191
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB739
+	.quad	.LBE739-.LBB739
+	.long	0x6382
+	.uleb128 0x6
+	.string	"cur"
+	.value	0x271
+	.byte	0x15
+	.long	0x127
+	.long	.LLST192
+	.long	.LVUS192
+	.uleb128 0xd
+	.quad	.LVL324
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL316
+	.long	0xce5
+	.long	0x63c2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC11
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x264
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.6
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL322
+	.long	0x6f46
+	.long	0x63e0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL327
+	.long	0x6f46
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x20
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1366
+	.byte	0x1
+	.value	0x255
+	.byte	0xd
+	.byte	0x1
+	.long	0x642e
+	.uleb128 0x4
+	.string	"a"
+	.byte	0x1
+	.value	0x255
+	.byte	0x30
+	.long	0x642e
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x255
+	.byte	0x40
+	.long	0x5c8
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x1
+	.value	0x257
+	.byte	0x11
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xaa9
+	.uleb128 0x1f
+	.long	.LASF1367
+	.byte	0x1
+	.value	0x24a
+	.byte	0xc
+	.long	0x71
+	.byte	0x1
+	.long	0x6484
+	.uleb128 0x4
+	.string	"a"
+	.byte	0x1
+	.value	0x24a
+	.byte	0x26
+	.long	0x6484
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x24a
+	.byte	0x36
+	.long	0x5c8
+	.uleb128 0x9
+	.string	"sim"
+	.byte	0x1
+	.value	0x24c
+	.byte	0xe
+	.long	0x65
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"_xp"
+	.byte	0x1
+	.value	0x24e
+	.byte	0x29
+	.long	0x1967
+	.uleb128 0x9
+	.string	"_m"
+	.byte	0x1
+	.value	0x24e
+	.byte	0x4d
+	.long	0x65
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xa9c
+	.uleb128 0x1b
+	.long	.LASF1368
+	.byte	0x1
+	.value	0x23c
+	.byte	0xd
+	.byte	0x1
+	.long	0x64ae
+	.uleb128 0x4
+	.string	"a"
+	.byte	0x1
+	.value	0x23c
+	.byte	0x29
+	.long	0x6484
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x23c
+	.byte	0x39
+	.long	0x5c8
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1369
+	.byte	0x1
+	.value	0x22d
+	.byte	0xd
+	.byte	0x1
+	.long	0x64df
+	.uleb128 0x4
+	.string	"s_"
+	.byte	0x1
+	.value	0x22d
+	.byte	0x24
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x22d
+	.byte	0x31
+	.long	0x65
+	.uleb128 0x9
+	.string	"s"
+	.byte	0x1
+	.value	0x22f
+	.byte	0x15
+	.long	0x6484
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1370
+	.value	0x212
+	.quad	.LFB561
+	.quad	.LFE561-.LFB561
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6532
+	.uleb128 0x3
+	.string	"q"
+	.value	0x213
+	.byte	0x1b
+	.long	0x878
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x3
+	.string	"s"
+	.value	0x214
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x41
+	.quad	.LVL30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1371
+	.byte	0x1
+	.value	0x201
+	.byte	0xd
+	.byte	0x1
+	.long	0x6562
+	.uleb128 0x4
+	.string	"q"
+	.byte	0x1
+	.value	0x202
+	.byte	0x1b
+	.long	0x878
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x203
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x204
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1372
+	.byte	0x1
+	.value	0x1f5
+	.byte	0xc
+	.long	0x71
+	.byte	0x1
+	.long	0x6596
+	.uleb128 0x4
+	.string	"q"
+	.byte	0x1
+	.value	0x1f6
+	.byte	0x1b
+	.long	0x878
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x1f7
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x1f8
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1373
+	.byte	0x1
+	.value	0x1e9
+	.byte	0xc
+	.long	0x71
+	.byte	0x1
+	.long	0x65ca
+	.uleb128 0x4
+	.string	"q"
+	.byte	0x1
+	.value	0x1ea
+	.byte	0x1b
+	.long	0x878
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x1eb
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x1ec
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1374
+	.byte	0x1
+	.value	0x1cf
+	.byte	0xd
+	.byte	0x1
+	.long	0x6612
+	.uleb128 0x4
+	.string	"q"
+	.byte	0x1
+	.value	0x1d0
+	.byte	0x1b
+	.long	0x878
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x1d1
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x1d2
+	.byte	0xe
+	.long	0x65
+	.uleb128 0x9
+	.string	"k"
+	.byte	0x1
+	.value	0x1d4
+	.byte	0xe
+	.long	0x65
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"e"
+	.byte	0x1
+	.value	0x1e0
+	.byte	0x16
+	.long	0x127
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1375
+	.value	0x1be
+	.byte	0x1e
+	.long	0x878
+	.quad	.LFB556
+	.quad	.LFE556-.LFB556
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x66a1
+	.uleb128 0x2d
+	.string	"s"
+	.value	0x1bf
+	.byte	0x18
+	.long	0x199b
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xc
+	.long	.LASF1376
+	.value	0x1c1
+	.byte	0xe
+	.long	0x65
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x6
+	.string	"t"
+	.value	0x1c5
+	.byte	0x1c
+	.long	0x689
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x53
+	.quad	.LBB444
+	.quad	.LBE444-.LBB444
+	.uleb128 0xc
+	.long	.LASF1377
+	.value	0x1c9
+	.byte	0x28
+	.long	0x66a1
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0xc
+	.long	.LASF1378
+	.value	0x1c9
+	.byte	0x37
+	.long	0x878
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x87d
+	.uleb128 0x12
+	.long	.LASF1379
+	.value	0x1b2
+	.byte	0x1f
+	.long	0x689
+	.quad	.LFB555
+	.quad	.LFE555-.LFB555
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x66eb
+	.uleb128 0x2d
+	.string	"set"
+	.value	0x1b3
+	.byte	0x1c
+	.long	0x689
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x6
+	.string	"old"
+	.value	0x1b5
+	.byte	0x1c
+	.long	0x689
+	.long	.LLST570
+	.long	.LVUS570
+	.byte	0
+	.uleb128 0x51
+	.long	.LASF1381
+	.value	0x1aa
+	.quad	.LFB554
+	.quad	.LFE554-.LFB554
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x675d
+	.uleb128 0x2d
+	.string	"set"
+	.value	0x1ab
+	.byte	0x16
+	.long	0x675d
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1d
+	.long	.LLRL565
+	.uleb128 0x6
+	.string	"i"
+	.value	0x1ad
+	.byte	0x13
+	.long	0x65
+	.long	.LLST566
+	.long	.LVUS566
+	.uleb128 0x1d
+	.long	.LLRL567
+	.uleb128 0xc
+	.long	.LASF1377
+	.value	0x1ae
+	.byte	0x31
+	.long	0x66a1
+	.long	.LLST568
+	.long	.LVUS568
+	.uleb128 0xc
+	.long	.LASF1378
+	.value	0x1ae
+	.byte	0x40
+	.long	0x878
+	.long	.LLST569
+	.long	.LVUS569
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x516
+	.uleb128 0x12
+	.long	.LASF1382
+	.value	0x1a2
+	.byte	0x1e
+	.long	0x878
+	.quad	.LFB553
+	.quad	.LFE553-.LFB553
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x67e9
+	.uleb128 0x1e
+	.long	.LASF1376
+	.value	0x1a3
+	.byte	0xe
+	.long	0x65
+	.long	.LLST560
+	.long	.LVUS560
+	.uleb128 0x45
+	.long	.LASF1383
+	.value	0x1a4
+	.byte	0x1b
+	.long	0x878
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1d
+	.long	.LLRL561
+	.uleb128 0xc
+	.long	.LASF1384
+	.value	0x1a7
+	.byte	0x28
+	.long	0x66a1
+	.long	.LLST562
+	.long	.LVUS562
+	.uleb128 0xc
+	.long	.LASF1385
+	.value	0x1a7
+	.byte	0x3b
+	.long	0x878
+	.long	.LLST563
+	.long	.LVUS563
+	.uleb128 0xc
+	.long	.LASF1386
+	.value	0x1a7
+	.byte	0x3b
+	.long	0x878
+	.long	.LLST564
+	.long	.LVUS564
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1387
+	.byte	0x1
+	.value	0x183
+	.byte	0xd
+	.byte	0x1
+	.long	0x680e
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x1
+	.value	0x184
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x1
+	.value	0x185
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1388
+	.value	0x15a
+	.quad	.LFB551
+	.quad	.LFE551-.LFB551
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6941
+	.uleb128 0x3
+	.string	"s"
+	.value	0x15b
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST544
+	.long	.LVUS544
+	.uleb128 0x3
+	.string	"c"
+	.value	0x15c
+	.byte	0xe
+	.long	0x65
+	.long	.LLST545
+	.long	.LVUS545
+	.uleb128 0x6
+	.string	"c2"
+	.value	0x16c
+	.byte	0xe
+	.long	0x65
+	.long	.LLST546
+	.long	.LVUS546
+	.uleb128 0x10
+	.long	0x7337
+	.quad	.LBI1230
+	.value	.LVU3646
+	.quad	.LBB1230
+	.quad	.LBE1230-.LBB1230
+	.byte	0x1
+	.value	0x166
+	.byte	0xe
+	.long	0x6897
+	.uleb128 0x2
+	.long	0x7349
+	.long	.LLST547
+	.long	.LVUS547
+	.byte	0
+	.uleb128 0xb
+	.long	0x7303
+	.quad	.LBI1232
+	.value	.LVU3651
+	.long	.LLRL548
+	.byte	0x1
+	.value	0x167
+	.byte	0xd
+	.long	0x68f0
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST549
+	.long	.LVUS549
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST550
+	.long	.LVUS550
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB1234
+	.quad	.LBE1234-.LBB1234
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST551
+	.long	.LVUS551
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1003
+	.long	0x6eb4
+	.long	0x6908
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1007
+	.long	0x6fbd
+	.long	0x6926
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL1011
+	.long	0x6ca2
+	.uleb128 0x36
+	.quad	.LVL1014
+	.long	0x6fbd
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1389
+	.value	0x131
+	.quad	.LFB550
+	.quad	.LFE550-.LFB550
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6a81
+	.uleb128 0x3
+	.string	"s"
+	.value	0x132
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST552
+	.long	.LVUS552
+	.uleb128 0x3
+	.string	"c"
+	.value	0x133
+	.byte	0xe
+	.long	0x65
+	.long	.LLST553
+	.long	.LVUS553
+	.uleb128 0x6
+	.string	"c2"
+	.value	0x142
+	.byte	0xe
+	.long	0x65
+	.long	.LLST554
+	.long	.LVUS554
+	.uleb128 0x10
+	.long	0x7337
+	.quad	.LBI1237
+	.value	.LVU3698
+	.quad	.LBB1237
+	.quad	.LBE1237-.LBB1237
+	.byte	0x1
+	.value	0x13c
+	.byte	0x13
+	.long	0x69ca
+	.uleb128 0x2
+	.long	0x7349
+	.long	.LLST555
+	.long	.LVUS555
+	.byte	0
+	.uleb128 0xb
+	.long	0x7303
+	.quad	.LBI1239
+	.value	.LVU3703
+	.long	.LLRL556
+	.byte	0x1
+	.value	0x13d
+	.byte	0xd
+	.long	0x6a23
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST557
+	.long	.LVUS557
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST558
+	.long	.LVUS558
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB1241
+	.quad	.LBE1241-.LBB1241
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST559
+	.long	.LVUS559
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1023
+	.long	0x6eb4
+	.long	0x6a3b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL1027
+	.long	0x6fbd
+	.long	0x6a59
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL1031
+	.long	0x6dee
+	.uleb128 0x36
+	.quad	.LVL1034
+	.long	0x6ca2
+	.uleb128 0x36
+	.quad	.LVL1037
+	.long	0x6fbd
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1390
+	.value	0x104
+	.byte	0x11
+	.long	0x65
+	.quad	.LFB549
+	.quad	.LFE549-.LFB549
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6c6b
+	.uleb128 0x3
+	.string	"s"
+	.value	0x105
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x1e
+	.long	.LASF1235
+	.value	0x106
+	.byte	0x15
+	.long	0x13dc
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x3
+	.string	"end"
+	.value	0x107
+	.byte	0x11
+	.long	0x283
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x6
+	.string	"c"
+	.value	0x10e
+	.byte	0xe
+	.long	0x65
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xc
+	.long	.LASF1391
+	.value	0x115
+	.byte	0xe
+	.long	0x65
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x11
+	.quad	.LBB399
+	.quad	.LBE399-.LBB399
+	.long	0x6b40
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x117
+	.byte	0x28
+	.long	0x1967
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x6
+	.string	"_m"
+	.value	0x117
+	.byte	0x42
+	.long	0x65
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL10
+	.long	0x6b5e
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x120
+	.byte	0x2d
+	.long	0x1967
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.uleb128 0x11
+	.quad	.LBB405
+	.quad	.LBE405-.LBB405
+	.long	0x6b88
+	.uleb128 0x6
+	.string	"_xp"
+	.value	0x129
+	.byte	0x35
+	.long	0x1967
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x10
+	.long	0x7303
+	.quad	.LBI396
+	.value	.LVU36
+	.quad	.LBB396
+	.quad	.LBE396-.LBB396
+	.byte	0x1
+	.value	0x10a
+	.byte	0x9
+	.long	0x6bed
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB398
+	.quad	.LBE398-.LBB398
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST7
+	.long	.LVUS7
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x7303
+	.quad	.LBI402
+	.value	.LVU77
+	.quad	.LBB402
+	.quad	.LBE402-.LBB402
+	.byte	0x1
+	.value	0x125
+	.byte	0x9
+	.long	0x6c52
+	.uleb128 0x2
+	.long	0x731c
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x2
+	.long	0x7311
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x27
+	.long	0x7327
+	.quad	.LBB404
+	.quad	.LBE404-.LBB404
+	.uleb128 0x7
+	.long	0x7328
+	.long	.LLST14
+	.long	.LVUS14
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF1392
+	.byte	0xfa
+	.long	0x6ca2
+	.uleb128 0x3e
+	.string	"s"
+	.byte	0xfb
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x57
+	.long	.LASF1235
+	.byte	0xfc
+	.byte	0x15
+	.long	0x13dc
+	.uleb128 0x57
+	.long	.LASF1281
+	.byte	0xfd
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x16
+	.uleb128 0x30
+	.string	"_xp"
+	.byte	0xff
+	.byte	0x29
+	.long	0x1967
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF1393
+	.byte	0xe4
+	.quad	.LFB547
+	.quad	.LFE547-.LFB547
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6dee
+	.uleb128 0x46
+	.string	"s"
+	.byte	0xe5
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST541
+	.long	.LVUS541
+	.uleb128 0x46
+	.string	"c"
+	.byte	0xe6
+	.byte	0xe
+	.long	0x65
+	.long	.LLST542
+	.long	.LVUS542
+	.uleb128 0x6a
+	.long	.LASF1328
+	.byte	0x1
+	.byte	0xe8
+	.byte	0x18
+	.long	0x12c
+	.long	.LLST543
+	.long	.LVUS543
+	.uleb128 0x5
+	.quad	.LVL982
+	.long	0x6fbd
+	.long	0x6d12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL983
+	.long	0x6fbd
+	.long	0x6d30
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x55
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL984
+	.long	0x6fbd
+	.long	0x6d48
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL985
+	.long	0x6fbd
+	.long	0x6d60
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL986
+	.long	0x6fbd
+	.long	0x6d78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL987
+	.long	0x6fbd
+	.long	0x6d90
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL988
+	.long	0x6fbd
+	.long	0x6da8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL989
+	.long	0x6fbd
+	.long	0x6dc0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL992
+	.long	0x6fbd
+	.long	0x6dd8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL995
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.long	.LASF1394
+	.byte	0xda
+	.quad	.LFB546
+	.quad	.LFE546-.LFB546
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6eb4
+	.uleb128 0x46
+	.string	"s"
+	.byte	0xdb
+	.byte	0x12
+	.long	0x5c8
+	.long	.LLST539
+	.long	.LVUS539
+	.uleb128 0x46
+	.string	"c"
+	.byte	0xdc
+	.byte	0xe
+	.long	0x65
+	.long	.LLST540
+	.long	.LVUS540
+	.uleb128 0x5
+	.quad	.LVL972
+	.long	0x6fbd
+	.long	0x6e4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL973
+	.long	0x6fbd
+	.long	0x6e6e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 0
+	.byte	0x36
+	.byte	0x25
+	.byte	0x37
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL976
+	.long	0x6fbd
+	.long	0x6e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x33
+	.byte	0x25
+	.byte	0x37
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL978
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x37
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF1395
+	.byte	0xcd
+	.byte	0x16
+	.long	0x9a
+	.quad	.LFB545
+	.quad	.LFE545-.LFB545
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6ee1
+	.uleb128 0x47
+	.string	"c"
+	.byte	0xcd
+	.byte	0x2b
+	.long	0x65
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF1396
+	.byte	0xc8
+	.byte	0xc
+	.long	0x71
+	.quad	.LFB544
+	.quad	.LFE544-.LFB544
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f0e
+	.uleb128 0x47
+	.string	"s"
+	.byte	0xc8
+	.byte	0x28
+	.long	0x5c8
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4d
+	.long	.LASF1397
+	.byte	0xb7
+	.byte	0xc
+	.long	0x71
+	.quad	.LFB543
+	.quad	.LFE543-.LFB543
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f46
+	.uleb128 0x47
+	.string	"s"
+	.byte	0xb7
+	.byte	0x28
+	.long	0x5c8
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x47
+	.string	"c"
+	.byte	0xb7
+	.byte	0x34
+	.long	0x65
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF1398
+	.byte	0x83
+	.long	0x6fbd
+	.uleb128 0x3e
+	.string	"s"
+	.byte	0x83
+	.byte	0x26
+	.long	0x5c8
+	.uleb128 0x3e
+	.string	"c"
+	.byte	0x83
+	.byte	0x32
+	.long	0x65
+	.uleb128 0x3e
+	.string	"n"
+	.byte	0x83
+	.byte	0x3c
+	.long	0x11b
+	.uleb128 0x2e
+	.long	0x6f7a
+	.uleb128 0x30
+	.string	"k"
+	.byte	0x90
+	.byte	0x14
+	.long	0x11b
+	.byte	0
+	.uleb128 0x2e
+	.long	0x6f9d
+	.uleb128 0x30
+	.string	"k"
+	.byte	0x9a
+	.byte	0x14
+	.long	0x11b
+	.uleb128 0x30
+	.string	"w"
+	.byte	0x9c
+	.byte	0x17
+	.long	0x2716
+	.uleb128 0x16
+	.uleb128 0x30
+	.string	"i"
+	.byte	0x9d
+	.byte	0x19
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x30
+	.string	"k"
+	.byte	0xa7
+	.byte	0x14
+	.long	0x11b
+	.uleb128 0x30
+	.string	"w"
+	.byte	0xa9
+	.byte	0x17
+	.long	0x271b
+	.uleb128 0x16
+	.uleb128 0x30
+	.string	"i"
+	.byte	0xaa
+	.byte	0x19
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.long	.LASF1399
+	.byte	0x1
+	.byte	0x5e
+	.byte	0xd
+	.byte	0x1
+	.long	0x6fe8
+	.uleb128 0x3e
+	.string	"s"
+	.byte	0x5e
+	.byte	0x2b
+	.long	0x5c8
+	.uleb128 0x3e
+	.string	"c"
+	.byte	0x5e
+	.byte	0x37
+	.long	0x65
+	.uleb128 0x16
+	.uleb128 0x30
+	.string	"w"
+	.byte	0x76
+	.byte	0x17
+	.long	0x271b
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1400
+	.value	0x597
+	.long	0xc3
+	.long	0x7005
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x597
+	.byte	0x1c
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1401
+	.value	0x559
+	.long	0x8f0
+	.long	0x702f
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x559
+	.byte	0x19
+	.long	0x8f0
+	.uleb128 0x4
+	.string	"__B"
+	.byte	0x3
+	.value	0x559
+	.byte	0x26
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1402
+	.value	0x535
+	.long	0x8f0
+	.long	0x7059
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x535
+	.byte	0x19
+	.long	0x8f0
+	.uleb128 0x4
+	.string	"__B"
+	.byte	0x3
+	.value	0x535
+	.byte	0x26
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1403
+	.value	0x529
+	.long	0x8f0
+	.long	0x7083
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x529
+	.byte	0x17
+	.long	0x8f0
+	.uleb128 0x4
+	.string	"__B"
+	.byte	0x3
+	.value	0x529
+	.byte	0x24
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1404
+	.value	0x523
+	.long	0x8f0
+	.long	0x70ad
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x523
+	.byte	0x1b
+	.long	0x8f0
+	.uleb128 0x4
+	.string	"__B"
+	.byte	0x3
+	.value	0x523
+	.byte	0x28
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1405
+	.value	0x51d
+	.long	0x8f0
+	.long	0x70d7
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x51d
+	.byte	0x18
+	.long	0x8f0
+	.uleb128 0x4
+	.string	"__B"
+	.byte	0x3
+	.value	0x51d
+	.byte	0x25
+	.long	0x8f0
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1406
+	.value	0x2bd
+	.long	0x8f0
+	.long	0x70f4
+	.uleb128 0x4
+	.string	"__P"
+	.byte	0x3
+	.value	0x2bd
+	.byte	0x23
+	.long	0x70f4
+	.byte	0
+	.uleb128 0x8
+	.long	0x915
+	.uleb128 0x31
+	.long	.LASF1407
+	.value	0x28e
+	.long	0x8f0
+	.long	0x7116
+	.uleb128 0x4
+	.string	"__A"
+	.byte	0x3
+	.value	0x28e
+	.byte	0x15
+	.long	0x7d
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1408
+	.value	0x268
+	.long	0x8f0
+	.long	0x71f6
+	.uleb128 0x15
+	.long	.LASF1409
+	.byte	0x3
+	.value	0x268
+	.byte	0x14
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1410
+	.byte	0x3
+	.value	0x268
+	.byte	0x20
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1411
+	.byte	0x3
+	.value	0x268
+	.byte	0x2c
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1412
+	.byte	0x3
+	.value	0x268
+	.byte	0x38
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1413
+	.byte	0x3
+	.value	0x269
+	.byte	0xd
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1414
+	.byte	0x3
+	.value	0x269
+	.byte	0x19
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1415
+	.byte	0x3
+	.value	0x269
+	.byte	0x25
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1416
+	.byte	0x3
+	.value	0x269
+	.byte	0x31
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1417
+	.byte	0x3
+	.value	0x26a
+	.byte	0xd
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1418
+	.byte	0x3
+	.value	0x26a
+	.byte	0x19
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1419
+	.byte	0x3
+	.value	0x26a
+	.byte	0x25
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1420
+	.byte	0x3
+	.value	0x26a
+	.byte	0x31
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1421
+	.byte	0x3
+	.value	0x26b
+	.byte	0xd
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1422
+	.byte	0x3
+	.value	0x26b
+	.byte	0x19
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1423
+	.byte	0x3
+	.value	0x26b
+	.byte	0x25
+	.long	0x7d
+	.uleb128 0x15
+	.long	.LASF1424
+	.byte	0x3
+	.value	0x26b
+	.byte	0x31
+	.long	0x7d
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1425
+	.byte	0x2
+	.value	0x249
+	.byte	0x13
+	.long	0x71
+	.byte	0x3
+	.long	0x721f
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x2
+	.value	0x249
+	.byte	0x32
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x2
+	.value	0x249
+	.byte	0x3c
+	.long	0x11b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1426
+	.byte	0x2
+	.value	0x23e
+	.byte	0x16
+	.long	0x11b
+	.byte	0x3
+	.long	0x723d
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x2
+	.value	0x23e
+	.byte	0x38
+	.long	0x199b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1427
+	.byte	0x2
+	.value	0x20a
+	.byte	0x18
+	.long	0x65
+	.byte	0x3
+	.long	0x7272
+	.uleb128 0x4
+	.string	"pp"
+	.byte	0x2
+	.value	0x20a
+	.byte	0x37
+	.long	0x7272
+	.uleb128 0x9
+	.string	"p"
+	.byte	0x2
+	.value	0x20c
+	.byte	0x15
+	.long	0x718
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x2
+	.value	0x20d
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x8
+	.long	0x718
+	.uleb128 0x1f
+	.long	.LASF1428
+	.byte	0x2
+	.value	0x1f0
+	.byte	0x18
+	.long	0x65
+	.byte	0x3
+	.long	0x72ac
+	.uleb128 0x4
+	.string	"pp"
+	.byte	0x2
+	.value	0x1f0
+	.byte	0x3b
+	.long	0x72ac
+	.uleb128 0x9
+	.string	"p"
+	.byte	0x2
+	.value	0x1f2
+	.byte	0x1a
+	.long	0xb14
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x2
+	.value	0x1f3
+	.byte	0xe
+	.long	0x65
+	.byte	0
+	.uleb128 0x8
+	.long	0xb14
+	.uleb128 0x1f
+	.long	.LASF1429
+	.byte	0x2
+	.value	0x1de
+	.byte	0x19
+	.long	0x2716
+	.byte	0x3
+	.long	0x72da
+	.uleb128 0x4
+	.string	"w"
+	.byte	0x2
+	.value	0x1de
+	.byte	0x32
+	.long	0x2716
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x2
+	.value	0x1de
+	.byte	0x3e
+	.long	0x65
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1430
+	.byte	0x2
+	.value	0x1c3
+	.byte	0x15
+	.long	0x16a
+	.byte	0x3
+	.long	0x7303
+	.uleb128 0x4
+	.string	"w"
+	.byte	0x2
+	.value	0x1c3
+	.byte	0x29
+	.long	0x16a
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x2
+	.value	0x1c3
+	.byte	0x35
+	.long	0x65
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1431
+	.byte	0x2
+	.value	0x1a9
+	.byte	0x14
+	.byte	0x3
+	.long	0x7337
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x2
+	.value	0x1a9
+	.byte	0x35
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"e"
+	.byte	0x2
+	.value	0x1a9
+	.byte	0x41
+	.long	0x65
+	.uleb128 0x16
+	.uleb128 0x9
+	.string	"_xp"
+	.byte	0x2
+	.value	0x1ac
+	.byte	0x2d
+	.long	0x1967
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1432
+	.byte	0x2
+	.value	0x1a3
+	.byte	0x13
+	.long	0x71
+	.byte	0x3
+	.long	0x7355
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x2
+	.value	0x1a3
+	.byte	0x27
+	.long	0x65
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1433
+	.byte	0x4
+	.value	0x12b
+	.byte	0x1c
+	.long	0x5c8
+	.byte	0x3
+	.long	0x738b
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x4
+	.value	0x12c
+	.byte	0x12
+	.long	0x5c8
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x4
+	.value	0x12d
+	.byte	0x11
+	.long	0x283
+	.uleb128 0x15
+	.long	.LASF1233
+	.byte	0x4
+	.value	0x12e
+	.byte	0x20
+	.long	0x319
+	.byte	0
+	.uleb128 0x3a
+	.long	0x64ae
+	.quad	.LFB562
+	.quad	.LFE562-.LFB562
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7404
+	.uleb128 0x59
+	.long	0x64bc
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x59
+	.long	0x64c8
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.long	0x64d3
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x3d
+	.long	0x64ae
+	.quad	.LBI618
+	.value	.LVU714
+	.quad	.LBB618
+	.quad	.LBE618-.LBB618
+	.value	0x22d
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x64c8
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x2
+	.long	0x64bc
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x4c
+	.long	0x64d3
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	0x5d42
+	.quad	.LFB574
+	.quad	.LFE574-.LFB574
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x756e
+	.uleb128 0x2
+	.long	0x5d50
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0x2
+	.long	0x5d5b
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x2
+	.long	0x5d68
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x6c
+	.long	0x5d42
+	.quad	.LBB625
+	.quad	.LBE625-.LBB625
+	.byte	0x1
+	.value	0x32c
+	.byte	0xd
+	.uleb128 0xa
+	.long	0x5d68
+	.uleb128 0xa
+	.long	0x5d5b
+	.uleb128 0xa
+	.long	0x5d50
+	.uleb128 0x39
+	.long	0x5d75
+	.quad	.LBB627
+	.quad	.LBE627-.LBB627
+	.long	0x7547
+	.uleb128 0x7
+	.long	0x5d76
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x38
+	.long	0x5d83
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x7
+	.long	0x5d90
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x7
+	.long	0x5d9b
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI628
+	.value	.LVU731
+	.quad	.LBB628
+	.quad	.LBE628-.LBB628
+	.byte	0x1
+	.value	0x337
+	.byte	0x16
+	.long	0x74ec
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL199
+	.long	0x7512
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL202
+	.long	0x7526
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL203
+	.long	0x61a2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL195
+	.long	0x6049
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	0x6f46
+	.quad	.LFB542
+	.quad	.LFE542-.LFB542
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x78db
+	.uleb128 0x2
+	.long	0x6f50
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x2
+	.long	0x6f59
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x2
+	.long	0x6f62
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x5a
+	.long	0x6f46
+	.quad	.LBI655
+	.value	.LVU771
+	.long	.LLRL131
+	.byte	0x83
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x6f62
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x2
+	.long	0x6f59
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x2
+	.long	0x6f50
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x2b
+	.long	0x6f9d
+	.long	.LLRL135
+	.long	0x765e
+	.uleb128 0x7
+	.long	0x6f9e
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x7
+	.long	0x6fa7
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x2b
+	.long	0x6fb0
+	.long	.LLRL138
+	.long	0x762e
+	.uleb128 0x7
+	.long	0x6fb1
+	.long	.LLST139
+	.long	.LVUS139
+	.byte	0
+	.uleb128 0x5b
+	.long	0x721f
+	.quad	.LBI659
+	.value	.LVU877
+	.quad	.LBB659
+	.quad	.LBE659-.LBB659
+	.byte	0xa7
+	.byte	0x18
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST140
+	.long	.LVUS140
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.long	0x71f6
+	.quad	.LBI662
+	.value	.LVU791
+	.long	.LLRL141
+	.byte	0x8f
+	.byte	0x1b
+	.long	0x76dc
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI664
+	.value	.LVU793
+	.quad	.LBB664
+	.quad	.LBE664-.LBB664
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x76c6
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST144
+	.long	.LVUS144
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL227
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x6f6b
+	.quad	.LBB667
+	.quad	.LBE667-.LBB667
+	.long	0x7726
+	.uleb128 0x7
+	.long	0x6f70
+	.long	.LLST145
+	.long	.LVUS145
+	.uleb128 0x5a
+	.long	0x721f
+	.quad	.LBI668
+	.value	.LVU799
+	.long	.LLRL146
+	.byte	0x90
+	.byte	0x18
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST147
+	.long	.LVUS147
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	0x6f7a
+	.long	.LLRL148
+	.long	0x77a4
+	.uleb128 0x7
+	.long	0x6f7f
+	.long	.LLST149
+	.long	.LVUS149
+	.uleb128 0x7
+	.long	0x6f88
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0x49
+	.long	0x721f
+	.quad	.LBI676
+	.value	.LVU839
+	.quad	.LBB676
+	.quad	.LBE676-.LBB676
+	.byte	0x9a
+	.byte	0x18
+	.long	0x7780
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST151
+	.long	.LVUS151
+	.byte	0
+	.uleb128 0x27
+	.long	0x6f91
+	.quad	.LBB678
+	.quad	.LBE678-.LBB678
+	.uleb128 0x7
+	.long	0x6f92
+	.long	.LLST152
+	.long	.LVUS152
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.long	0x71f6
+	.quad	.LBI679
+	.value	.LVU831
+	.long	.LLRL153
+	.byte	0x99
+	.byte	0x1b
+	.long	0x7822
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI681
+	.value	.LVU833
+	.quad	.LBB681
+	.quad	.LBE681-.LBB681
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x780c
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST156
+	.long	.LVUS156
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL241
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.long	0x71f6
+	.quad	.LBI687
+	.value	.LVU869
+	.long	.LLRL157
+	.byte	0xa6
+	.byte	0x1b
+	.long	0x78a0
+	.uleb128 0x2
+	.long	0x7213
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x2
+	.long	0x7208
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x10
+	.long	0x721f
+	.quad	.LBI689
+	.value	.LVU871
+	.quad	.LBB689
+	.quad	.LBE689-.LBB689
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0x788a
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL255
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.quad	.LVL216
+	.long	0x78c3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x18
+	.quad	.LVL258
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.long	0x6562
+	.quad	.LFB559
+	.quad	.LFE559-.LFB559
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79b4
+	.uleb128 0x2
+	.long	0x6574
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x2
+	.long	0x657f
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x2
+	.long	0x658a
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0xb
+	.long	0x6596
+	.quad	.LBI700
+	.value	.LVU918
+	.long	.LLRL164
+	.byte	0x1
+	.value	0x1fb
+	.byte	0x10
+	.long	0x7960
+	.uleb128 0x2
+	.long	0x65be
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x2
+	.long	0x65b3
+	.long	.LLST166
+	.long	.LVUS166
+	.uleb128 0x2
+	.long	0x65a8
+	.long	.LLST167
+	.long	.LVUS167
+	.byte	0
+	.uleb128 0x3d
+	.long	0x6562
+	.quad	.LBI707
+	.value	.LVU936
+	.quad	.LBB707
+	.quad	.LBE707-.LBB707
+	.value	0x1f5
+	.byte	0xc
+	.uleb128 0xa
+	.long	0x6574
+	.uleb128 0x2
+	.long	0x658a
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x2
+	.long	0x657f
+	.long	.LLST169
+	.long	.LVUS169
+	.uleb128 0x41
+	.quad	.LVL272
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.long	0x6fbd
+	.quad	.LFB541
+	.quad	.LFE541-.LFB541
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7b23
+	.uleb128 0x2
+	.long	0x6fca
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x2
+	.long	0x6fd3
+	.long	.LLST174
+	.long	.LVUS174
+	.uleb128 0x5b
+	.long	0x6fbd
+	.quad	.LBI721
+	.value	.LVU966
+	.quad	.LBB721
+	.quad	.LBE721-.LBB721
+	.byte	0x5e
+	.byte	0xd
+	.uleb128 0x2
+	.long	0x6fd3
+	.long	.LLST175
+	.long	.LVUS175
+	.uleb128 0x2
+	.long	0x6fca
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x48
+	.long	0x721f
+	.quad	.LBI723
+	.value	.LVU968
+	.long	.LLRL177
+	.byte	0x6b
+	.byte	0xa
+	.long	0x7a4b
+	.uleb128 0x2
+	.long	0x7231
+	.long	.LLST178
+	.long	.LVUS178
+	.byte	0
+	.uleb128 0x49
+	.long	0x7337
+	.quad	.LBI727
+	.value	.LVU975
+	.quad	.LBB727
+	.quad	.LBE727-.LBB727
+	.byte	0x6b
+	.byte	0x25
+	.long	0x7a7e
+	.uleb128 0x2
+	.long	0x7349
+	.long	.LLST179
+	.long	.LVUS179
+	.byte	0
+	.uleb128 0x49
+	.long	0x72da
+	.quad	.LBI729
+	.value	.LVU983
+	.quad	.LBB729
+	.quad	.LBE729-.LBB729
+	.byte	0x6e
+	.byte	0x1a
+	.long	0x7abe
+	.uleb128 0x2
+	.long	0x72f7
+	.long	.LLST180
+	.long	.LVUS180
+	.uleb128 0x2
+	.long	0x72ec
+	.long	.LLST181
+	.long	.LVUS181
+	.byte	0
+	.uleb128 0x49
+	.long	0x72b1
+	.quad	.LBI731
+	.value	.LVU1035
+	.quad	.LBB731
+	.quad	.LBE731-.LBB731
+	.byte	0x72
+	.byte	0x1a
+	.long	0x7afe
+	.uleb128 0x2
+	.long	0x72ce
+	.long	.LLST182
+	.long	.LVUS182
+	.uleb128 0x2
+	.long	0x72c3
+	.long	.LLST183
+	.long	.LVUS183
+	.byte	0
+	.uleb128 0x27
+	.long	0x6fdc
+	.quad	.LBB733
+	.quad	.LBE733-.LBB733
+	.uleb128 0x7
+	.long	0x6fdd
+	.long	.LLST184
+	.long	.LVUS184
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	0x67e9
+	.quad	.LFB552
+	.quad	.LFE552-.LFB552
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7bff
+	.uleb128 0x2
+	.long	0x67f7
+	.long	.LLST185
+	.long	.LVUS185
+	.uleb128 0x2
+	.long	0x6802
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x10
+	.long	0x67e9
+	.quad	.LBI736
+	.value	.LVU1074
+	.quad	.LBB736
+	.quad	.LBE736-.LBB736
+	.byte	0x1
+	.value	0x183
+	.byte	0xd
+	.long	0x7bf1
+	.uleb128 0x2
+	.long	0x6802
+	.long	.LLST187
+	.long	.LVUS187
+	.uleb128 0x2
+	.long	0x67f7
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x5
+	.quad	.LVL307
+	.long	0x6fbd
+	.long	0x7bb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x5
+	.quad	.LVL308
+	.long	0x6fbd
+	.long	0x7bd6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5c
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL309
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x27
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL312
+	.long	0x6fbd
+	.byte	0
+	.uleb128 0x3a
+	.long	0x6226
+	.quad	.LFB568
+	.quad	.LFE568-.LFB568
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7cb1
+	.uleb128 0x2
+	.long	0x6234
+	.long	.LLST242
+	.long	.LVUS242
+	.uleb128 0x2
+	.long	0x623f
+	.long	.LLST243
+	.long	.LVUS243
+	.uleb128 0x10
+	.long	0x6226
+	.quad	.LBI823
+	.value	.LVU1436
+	.quad	.LBB823
+	.quad	.LBE823-.LBB823
+	.byte	0x1
+	.value	0x2ab
+	.byte	0xd
+	.long	0x7c98
+	.uleb128 0x2
+	.long	0x623f
+	.long	.LLST244
+	.long	.LVUS244
+	.uleb128 0x2
+	.long	0x6234
+	.long	.LLST245
+	.long	.LVUS245
+	.uleb128 0x13
+	.quad	.LVL423
+	.long	0x62c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LVL424
+	.long	0x3c8f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x40
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.long	0x6532
+	.quad	.LFB560
+	.quad	.LFE560-.LFB560
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7dc9
+	.uleb128 0x2
+	.long	0x6540
+	.long	.LLST258
+	.long	.LVUS258
+	.uleb128 0x2
+	.long	0x654b
+	.long	.LLST259
+	.long	.LVUS259
+	.uleb128 0x2
+	.long	0x6556
+	.long	.LLST260
+	.long	.LVUS260
+	.uleb128 0xb
+	.long	0x65ca
+	.quad	.LBI837
+	.value	.LVU1573
+	.long	.LLRL261
+	.byte	0x1
+	.value	0x208
+	.byte	0x14
+	.long	0x7d86
+	.uleb128 0x2
+	.long	0x65ee
+	.long	.LLST262
+	.long	.LVUS262
+	.uleb128 0x2
+	.long	0x65e3
+	.long	.LLST263
+	.long	.LVUS263
+	.uleb128 0x2
+	.long	0x65d8
+	.long	.LLST264
+	.long	.LVUS264
+	.uleb128 0x1d
+	.long	.LLRL261
+	.uleb128 0x7
+	.long	0x65f9
+	.long	.LLST265
+	.long	.LVUS265
+	.uleb128 0x2b
+	.long	0x6604
+	.long	.LLRL266
+	.long	0x7d77
+	.uleb128 0x7
+	.long	0x6605
+	.long	.LLST267
+	.long	.LVUS267
+	.uleb128 0xd
+	.quad	.LVL478
+	.long	0x6fbd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL472
+	.long	0x6fbd
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0x6532
+	.quad	.LBI846
+	.value	.LVU1602
+	.quad	.LBB846
+	.quad	.LBE846-.LBB846
+	.value	0x201
+	.byte	0xd
+	.uleb128 0xa
+	.long	0x6540
+	.uleb128 0x2
+	.long	0x6556
+	.long	.LLST268
+	.long	.LVUS268
+	.uleb128 0x2
+	.long	0x654b
+	.long	.LLST269
+	.long	.LVUS269
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	0x45cc
+	.quad	.LFB586
+	.quad	.LFE586-.LFB586
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7e8e
+	.uleb128 0x2
+	.long	0x45da
+	.long	.LLST368
+	.long	.LVUS368
+	.uleb128 0x2
+	.long	0x45e5
+	.long	.LLST369
+	.long	.LVUS369
+	.uleb128 0x2
+	.long	0x45f2
+	.long	.LLST370
+	.long	.LVUS370
+	.uleb128 0x10
+	.long	0x45cc
+	.quad	.LBI962
+	.value	.LVU2271
+	.quad	.LBB962
+	.quad	.LBE962-.LBB962
+	.byte	0x1
+	.value	0x561
+	.byte	0xd
+	.long	0x7e67
+	.uleb128 0xa
+	.long	0x45e5
+	.uleb128 0x2
+	.long	0x45f2
+	.long	.LLST371
+	.long	.LVUS371
+	.uleb128 0x2
+	.long	0x45da
+	.long	.LLST372
+	.long	.LVUS372
+	.uleb128 0x13
+	.quad	.LVL671
+	.long	0x62c4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.quad	.LVL673
+	.long	0x6226
+	.long	0x7e80
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL674
+	.long	0x4600
+	.byte	0
+	.uleb128 0x3a
+	.long	0x1ce3
+	.quad	.LFB622
+	.quad	.LFE622-.LFB622
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x7ee6
+	.uleb128 0x2
+	.long	0x1cf2
+	.long	.LLST597
+	.long	.LVUS597
+	.uleb128 0x2
+	.long	0x1cfd
+	.long	.LLST598
+	.long	.LVUS598
+	.uleb128 0x13
+	.quad	.LVL1103
+	.long	0x2756
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.long	0x19a0
+	.quad	.LFB631
+	.quad	.LFE631-.LFB631
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	0x19af
+	.long	.LLST613
+	.long	.LVUS613
+	.uleb128 0x2
+	.long	0x19ba
+	.long	.LLST614
+	.long	.LVUS614
+	.uleb128 0x13
+	.quad	.LVL1119
+	.long	0x19c6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x8
+	.byte	0x38
+	.byte	0x24
+	.byte	0x8
+	.byte	0x38
+	.byte	0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x47
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x60
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x61
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x62
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x63
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x64
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x65
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x66
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x67
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x68
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x69
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6c
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS690:
+	.uleb128 0
+	.uleb128 .LVU4300
+	.uleb128 .LVU4300
+	.uleb128 0
+.LLST690:
+	.byte	0x4
+	.uleb128 .LVL1206-.Ltext0
+	.uleb128 .LVL1207-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1207-.Ltext0
+	.uleb128 .LFE655-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS683:
+	.uleb128 0
+	.uleb128 .LVU4264
+	.uleb128 .LVU4264
+	.uleb128 .LVU4289
+	.uleb128 .LVU4289
+	.uleb128 .LVU4291
+	.uleb128 .LVU4291
+	.uleb128 0
+.LLST683:
+	.byte	0x4
+	.uleb128 .LVL1197-.Ltext0
+	.uleb128 .LVL1199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1199-1-.Ltext0
+	.uleb128 .LVL1203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1203-.Ltext0
+	.uleb128 .LVL1205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1205-1-.Ltext0
+	.uleb128 .LFE654-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS684:
+	.uleb128 0
+	.uleb128 .LVU4264
+	.uleb128 .LVU4264
+	.uleb128 0
+.LLST684:
+	.byte	0x4
+	.uleb128 .LVL1197-.Ltext0
+	.uleb128 .LVL1199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1199-1-.Ltext0
+	.uleb128 .LFE654-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS685:
+	.uleb128 0
+	.uleb128 .LVU4264
+	.uleb128 .LVU4264
+	.uleb128 .LVU4290
+	.uleb128 .LVU4290
+	.uleb128 .LVU4291
+	.uleb128 .LVU4291
+	.uleb128 0
+.LLST685:
+	.byte	0x4
+	.uleb128 .LVL1197-.Ltext0
+	.uleb128 .LVL1199-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1199-1-.Ltext0
+	.uleb128 .LVL1204-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1204-.Ltext0
+	.uleb128 .LVL1205-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1205-1-.Ltext0
+	.uleb128 .LFE654-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS687:
+	.uleb128 .LVU4257
+	.uleb128 .LVU4262
+.LLST687:
+	.byte	0x4
+	.uleb128 .LVL1197-.Ltext0
+	.uleb128 .LVL1198-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS688:
+	.uleb128 .LVU4257
+	.uleb128 .LVU4262
+.LLST688:
+	.byte	0x4
+	.uleb128 .LVL1197-.Ltext0
+	.uleb128 .LVL1198-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS689:
+	.uleb128 .LVU4257
+	.uleb128 .LVU4262
+.LLST689:
+	.byte	0x4
+	.uleb128 .LVL1197-.Ltext0
+	.uleb128 .LVL1198-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS682:
+	.uleb128 0
+	.uleb128 .LVU4254
+	.uleb128 .LVU4254
+	.uleb128 .LVU4254
+	.uleb128 .LVU4254
+	.uleb128 0
+.LLST682:
+	.byte	0x4
+	.uleb128 .LVL1195-.Ltext0
+	.uleb128 .LVL1196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1196-1-.Ltext0
+	.uleb128 .LVL1196-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1196-.Ltext0
+	.uleb128 .LFE653-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS665:
+	.uleb128 0
+	.uleb128 .LVU4143
+	.uleb128 .LVU4143
+	.uleb128 .LVU4248
+	.uleb128 .LVU4248
+	.uleb128 .LVU4249
+	.uleb128 .LVU4249
+	.uleb128 0
+.LLST665:
+	.byte	0x4
+	.uleb128 .LVL1169-.Ltext0
+	.uleb128 .LVL1170-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1170-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 .LVL1194-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1194-.Ltext0
+	.uleb128 .LFE652-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS666:
+	.uleb128 0
+	.uleb128 .LVU4148
+	.uleb128 .LVU4148
+	.uleb128 .LVU4199
+	.uleb128 .LVU4199
+	.uleb128 .LVU4200
+	.uleb128 .LVU4200
+	.uleb128 .LVU4248
+	.uleb128 .LVU4248
+	.uleb128 .LVU4249
+	.uleb128 .LVU4249
+	.uleb128 0
+.LLST666:
+	.byte	0x4
+	.uleb128 .LVL1169-.Ltext0
+	.uleb128 .LVL1171-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1171-1-.Ltext0
+	.uleb128 .LVL1188-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1188-.Ltext0
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 .LVL1194-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1194-.Ltext0
+	.uleb128 .LFE652-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS667:
+	.uleb128 0
+	.uleb128 .LVU4148
+	.uleb128 .LVU4148
+	.uleb128 .LVU4248
+	.uleb128 .LVU4248
+	.uleb128 .LVU4249
+	.uleb128 .LVU4249
+	.uleb128 0
+.LLST667:
+	.byte	0x4
+	.uleb128 .LVL1169-.Ltext0
+	.uleb128 .LVL1171-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1171-1-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 .LVL1194-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1194-.Ltext0
+	.uleb128 .LFE652-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS668:
+	.uleb128 .LVU4161
+	.uleb128 .LVU4248
+.LLST668:
+	.byte	0x4
+	.uleb128 .LVL1174-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS669:
+	.uleb128 .LVU4169
+	.uleb128 .LVU4172
+	.uleb128 .LVU4172
+	.uleb128 .LVU4248
+.LLST669:
+	.byte	0x4
+	.uleb128 .LVL1176-.Ltext0
+	.uleb128 .LVL1177-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1177-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.byte	0
+.LVUS670:
+	.uleb128 .LVU4170
+	.uleb128 .LVU4248
+.LLST670:
+	.byte	0x4
+	.uleb128 .LVL1176-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x68
+	.byte	0x9f
+	.byte	0
+.LVUS671:
+	.uleb128 .LVU4173
+	.uleb128 .LVU4194
+	.uleb128 .LVU4194
+	.uleb128 .LVU4248
+.LLST671:
+	.byte	0x4
+	.uleb128 .LVL1178-.Ltext0
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.byte	0
+.LVUS672:
+	.uleb128 .LVU4179
+	.uleb128 .LVU4182
+	.uleb128 .LVU4182
+	.uleb128 .LVU4248
+.LLST672:
+	.byte	0x4
+	.uleb128 .LVL1179-.Ltext0
+	.uleb128 .LVL1180-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1180-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.byte	0
+.LVUS673:
+	.uleb128 .LVU4180
+	.uleb128 .LVU4194
+	.uleb128 .LVU4194
+	.uleb128 .LVU4248
+.LLST673:
+	.byte	0x4
+	.uleb128 .LVL1179-.Ltext0
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+.LVUS674:
+	.uleb128 .LVU4187
+	.uleb128 .LVU4198
+	.uleb128 .LVU4198
+	.uleb128 .LVU4200
+	.uleb128 .LVU4200
+	.uleb128 .LVU4222
+	.uleb128 .LVU4222
+	.uleb128 .LVU4248
+.LLST674:
+	.byte	0x4
+	.uleb128 .LVL1182-.Ltext0
+	.uleb128 .LVL1187-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL1187-.Ltext0
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 0xd
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfc
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 .LVL1191-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL1191-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0xd
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x6
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xfc
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS675:
+	.uleb128 .LVU4190
+	.uleb128 .LVU4194
+	.uleb128 .LVU4194
+	.uleb128 .LVU4248
+.LLST675:
+	.byte	0x4
+	.uleb128 .LVL1183-.Ltext0
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+.LVUS676:
+	.uleb128 .LVU4191
+	.uleb128 .LVU4193
+	.uleb128 .LVU4193
+	.uleb128 .LVU4194
+.LLST676:
+	.byte	0x4
+	.uleb128 .LVL1183-.Ltext0
+	.uleb128 .LVL1184-.Ltext0
+	.uleb128 0x8
+	.byte	0x91
+	.sleb128 -88
+	.byte	0x6
+	.byte	0x7b
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1184-.Ltext0
+	.uleb128 .LVL1185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS677:
+	.uleb128 .LVU4196
+	.uleb128 .LVU4198
+	.uleb128 .LVU4198
+	.uleb128 .LVU4200
+	.uleb128 .LVU4200
+	.uleb128 .LVU4207
+	.uleb128 .LVU4207
+	.uleb128 .LVU4248
+.LLST677:
+	.byte	0x4
+	.uleb128 .LVL1186-.Ltext0
+	.uleb128 .LVL1187-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1187-.Ltext0
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 .LVL1190-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1190-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS678:
+	.uleb128 .LVU4201
+	.uleb128 .LVU4207
+	.uleb128 .LVU4207
+	.uleb128 .LVU4248
+.LLST678:
+	.byte	0x4
+	.uleb128 .LVL1189-.Ltext0
+	.uleb128 .LVL1190-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1190-.Ltext0
+	.uleb128 .LVL1193-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS680:
+	.uleb128 .LVU4153
+	.uleb128 .LVU4155
+	.uleb128 .LVU4155
+	.uleb128 .LVU4163
+.LLST680:
+	.byte	0x4
+	.uleb128 .LVL1172-.Ltext0
+	.uleb128 .LVL1173-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL1173-.Ltext0
+	.uleb128 .LVL1175-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS681:
+	.uleb128 .LVU4183
+	.uleb128 .LVU4187
+.LLST681:
+	.byte	0x4
+	.uleb128 .LVL1181-.Ltext0
+	.uleb128 .LVL1182-.Ltext0
+	.uleb128 0x6
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS658:
+	.uleb128 0
+	.uleb128 .LVU4124
+	.uleb128 .LVU4124
+	.uleb128 .LVU4134
+	.uleb128 .LVU4134
+	.uleb128 0
+.LLST658:
+	.byte	0x4
+	.uleb128 .LVL1163-.Ltext0
+	.uleb128 .LVL1165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1165-1-.Ltext0
+	.uleb128 .LVL1168-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1168-.Ltext0
+	.uleb128 .LFE651-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS659:
+	.uleb128 0
+	.uleb128 .LVU4124
+	.uleb128 .LVU4124
+	.uleb128 0
+.LLST659:
+	.byte	0x4
+	.uleb128 .LVL1163-.Ltext0
+	.uleb128 .LVL1165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1165-1-.Ltext0
+	.uleb128 .LFE651-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS660:
+	.uleb128 0
+	.uleb128 .LVU4124
+	.uleb128 .LVU4124
+	.uleb128 0
+.LLST660:
+	.byte	0x4
+	.uleb128 .LVL1163-.Ltext0
+	.uleb128 .LVL1165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL1165-1-.Ltext0
+	.uleb128 .LFE651-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS662:
+	.uleb128 .LVU4116
+	.uleb128 .LVU4122
+.LLST662:
+	.byte	0x4
+	.uleb128 .LVL1163-.Ltext0
+	.uleb128 .LVL1164-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS663:
+	.uleb128 .LVU4116
+	.uleb128 .LVU4122
+.LLST663:
+	.byte	0x4
+	.uleb128 .LVL1163-.Ltext0
+	.uleb128 .LVL1164-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS664:
+	.uleb128 .LVU4116
+	.uleb128 .LVU4122
+.LLST664:
+	.byte	0x4
+	.uleb128 .LVL1163-.Ltext0
+	.uleb128 .LVL1164-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS648:
+	.uleb128 0
+	.uleb128 .LVU4078
+	.uleb128 .LVU4078
+	.uleb128 .LVU4112
+	.uleb128 .LVU4112
+	.uleb128 0
+.LLST648:
+	.byte	0x4
+	.uleb128 .LVL1152-.Ltext0
+	.uleb128 .LVL1153-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1153-1-.Ltext0
+	.uleb128 .LVL1161-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1161-.Ltext0
+	.uleb128 .LFE650-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS649:
+	.uleb128 0
+	.uleb128 .LVU4078
+	.uleb128 .LVU4078
+	.uleb128 .LVU4113
+	.uleb128 .LVU4113
+	.uleb128 0
+.LLST649:
+	.byte	0x4
+	.uleb128 .LVL1152-.Ltext0
+	.uleb128 .LVL1153-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1153-1-.Ltext0
+	.uleb128 .LVL1162-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1162-.Ltext0
+	.uleb128 .LFE650-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS650:
+	.uleb128 .LVU4082
+	.uleb128 .LVU4090
+.LLST650:
+	.byte	0x4
+	.uleb128 .LVL1154-.Ltext0
+	.uleb128 .LVL1156-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0
+.LVUS651:
+	.uleb128 .LVU4082
+	.uleb128 .LVU4090
+.LLST651:
+	.byte	0x4
+	.uleb128 .LVL1154-.Ltext0
+	.uleb128 .LVL1156-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS652:
+	.uleb128 .LVU4087
+	.uleb128 .LVU4090
+.LLST652:
+	.byte	0x4
+	.uleb128 .LVL1155-.Ltext0
+	.uleb128 .LVL1156-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS654:
+	.uleb128 .LVU4100
+	.uleb128 .LVU4110
+.LLST654:
+	.byte	0x4
+	.uleb128 .LVL1158-.Ltext0
+	.uleb128 .LVL1160-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS655:
+	.uleb128 .LVU4100
+	.uleb128 .LVU4110
+.LLST655:
+	.byte	0x4
+	.uleb128 .LVL1158-.Ltext0
+	.uleb128 .LVL1160-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS657:
+	.uleb128 .LVU4106
+	.uleb128 .LVU4112
+	.uleb128 .LVU4112
+	.uleb128 0
+.LLST657:
+	.byte	0x4
+	.uleb128 .LVL1159-.Ltext0
+	.uleb128 .LVL1161-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1161-.Ltext0
+	.uleb128 .LFE650-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS646:
+	.uleb128 0
+	.uleb128 .LVU4073
+	.uleb128 .LVU4073
+	.uleb128 0
+.LLST646:
+	.byte	0x4
+	.uleb128 .LVL1150-.Ltext0
+	.uleb128 .LVL1151-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1151-1-.Ltext0
+	.uleb128 .LFE649-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS647:
+	.uleb128 0
+	.uleb128 .LVU4073
+	.uleb128 .LVU4073
+	.uleb128 0
+.LLST647:
+	.byte	0x4
+	.uleb128 .LVL1150-.Ltext0
+	.uleb128 .LVL1151-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1151-1-.Ltext0
+	.uleb128 .LFE649-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS644:
+	.uleb128 0
+	.uleb128 .LVU4067
+	.uleb128 .LVU4067
+	.uleb128 0
+.LLST644:
+	.byte	0x4
+	.uleb128 .LVL1148-.Ltext0
+	.uleb128 .LVL1149-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1149-1-.Ltext0
+	.uleb128 .LFE648-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS645:
+	.uleb128 0
+	.uleb128 .LVU4067
+	.uleb128 .LVU4067
+	.uleb128 0
+.LLST645:
+	.byte	0x4
+	.uleb128 .LVL1148-.Ltext0
+	.uleb128 .LVL1149-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1149-1-.Ltext0
+	.uleb128 .LFE648-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS642:
+	.uleb128 0
+	.uleb128 .LVU4060
+	.uleb128 .LVU4060
+	.uleb128 0
+.LLST642:
+	.byte	0x4
+	.uleb128 .LVL1146-.Ltext0
+	.uleb128 .LVL1147-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1147-1-.Ltext0
+	.uleb128 .LFE646-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS643:
+	.uleb128 0
+	.uleb128 .LVU4060
+	.uleb128 .LVU4060
+	.uleb128 0
+.LLST643:
+	.byte	0x4
+	.uleb128 .LVL1146-.Ltext0
+	.uleb128 .LVL1147-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1147-1-.Ltext0
+	.uleb128 .LFE646-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS640:
+	.uleb128 0
+	.uleb128 .LVU4053
+	.uleb128 .LVU4053
+	.uleb128 0
+.LLST640:
+	.byte	0x4
+	.uleb128 .LVL1144-.Ltext0
+	.uleb128 .LVL1145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1145-1-.Ltext0
+	.uleb128 .LFE644-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS641:
+	.uleb128 0
+	.uleb128 .LVU4053
+	.uleb128 .LVU4053
+	.uleb128 0
+.LLST641:
+	.byte	0x4
+	.uleb128 .LVL1144-.Ltext0
+	.uleb128 .LVL1145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1145-1-.Ltext0
+	.uleb128 .LFE644-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS638:
+	.uleb128 0
+	.uleb128 .LVU4047
+	.uleb128 .LVU4047
+	.uleb128 0
+.LLST638:
+	.byte	0x4
+	.uleb128 .LVL1142-.Ltext0
+	.uleb128 .LVL1143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1143-1-.Ltext0
+	.uleb128 .LFE643-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS639:
+	.uleb128 0
+	.uleb128 .LVU4047
+	.uleb128 .LVU4047
+	.uleb128 0
+.LLST639:
+	.byte	0x4
+	.uleb128 .LVL1142-.Ltext0
+	.uleb128 .LVL1143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1143-1-.Ltext0
+	.uleb128 .LFE643-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS634:
+	.uleb128 0
+	.uleb128 .LVU4041
+	.uleb128 .LVU4041
+	.uleb128 0
+.LLST634:
+	.byte	0x4
+	.uleb128 .LVL1139-.Ltext0
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 .LFE642-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS635:
+	.uleb128 0
+	.uleb128 .LVU4041
+	.uleb128 .LVU4041
+	.uleb128 0
+.LLST635:
+	.byte	0x4
+	.uleb128 .LVL1139-.Ltext0
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 .LFE642-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS636:
+	.uleb128 .LVU4037
+	.uleb128 .LVU4041
+	.uleb128 .LVU4041
+	.uleb128 0
+.LLST636:
+	.byte	0x4
+	.uleb128 .LVL1140-.Ltext0
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 .LFE642-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS637:
+	.uleb128 .LVU4037
+	.uleb128 .LVU4041
+	.uleb128 .LVU4041
+	.uleb128 0
+.LLST637:
+	.byte	0x4
+	.uleb128 .LVL1140-.Ltext0
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1141-1-.Ltext0
+	.uleb128 .LFE642-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS632:
+	.uleb128 0
+	.uleb128 .LVU4032
+	.uleb128 .LVU4032
+	.uleb128 0
+.LLST632:
+	.byte	0x4
+	.uleb128 .LVL1137-.Ltext0
+	.uleb128 .LVL1138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1138-1-.Ltext0
+	.uleb128 .LFE641-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS633:
+	.uleb128 0
+	.uleb128 .LVU4032
+	.uleb128 .LVU4032
+	.uleb128 0
+.LLST633:
+	.byte	0x4
+	.uleb128 .LVL1137-.Ltext0
+	.uleb128 .LVL1138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1138-1-.Ltext0
+	.uleb128 .LFE641-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS630:
+	.uleb128 0
+	.uleb128 .LVU4025
+	.uleb128 .LVU4025
+	.uleb128 0
+.LLST630:
+	.byte	0x4
+	.uleb128 .LVL1135-.Ltext0
+	.uleb128 .LVL1136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1136-1-.Ltext0
+	.uleb128 .LFE640-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS631:
+	.uleb128 0
+	.uleb128 .LVU4025
+	.uleb128 .LVU4025
+	.uleb128 0
+.LLST631:
+	.byte	0x4
+	.uleb128 .LVL1135-.Ltext0
+	.uleb128 .LVL1136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1136-1-.Ltext0
+	.uleb128 .LFE640-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS628:
+	.uleb128 0
+	.uleb128 .LVU4017
+	.uleb128 .LVU4017
+	.uleb128 0
+.LLST628:
+	.byte	0x4
+	.uleb128 .LVL1133-.Ltext0
+	.uleb128 .LVL1134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1134-1-.Ltext0
+	.uleb128 .LFE638-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS629:
+	.uleb128 0
+	.uleb128 .LVU4017
+	.uleb128 .LVU4017
+	.uleb128 0
+.LLST629:
+	.byte	0x4
+	.uleb128 .LVL1133-.Ltext0
+	.uleb128 .LVL1134-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1134-1-.Ltext0
+	.uleb128 .LFE638-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS626:
+	.uleb128 0
+	.uleb128 .LVU4011
+	.uleb128 .LVU4011
+	.uleb128 0
+.LLST626:
+	.byte	0x4
+	.uleb128 .LVL1131-.Ltext0
+	.uleb128 .LVL1132-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1132-1-.Ltext0
+	.uleb128 .LFE637-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS627:
+	.uleb128 0
+	.uleb128 .LVU4011
+	.uleb128 .LVU4011
+	.uleb128 0
+.LLST627:
+	.byte	0x4
+	.uleb128 .LVL1131-.Ltext0
+	.uleb128 .LVL1132-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1132-1-.Ltext0
+	.uleb128 .LFE637-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS624:
+	.uleb128 0
+	.uleb128 .LVU4005
+	.uleb128 .LVU4005
+	.uleb128 0
+.LLST624:
+	.byte	0x4
+	.uleb128 .LVL1129-.Ltext0
+	.uleb128 .LVL1130-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1130-1-.Ltext0
+	.uleb128 .LFE636-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS625:
+	.uleb128 0
+	.uleb128 .LVU4005
+	.uleb128 .LVU4005
+	.uleb128 0
+.LLST625:
+	.byte	0x4
+	.uleb128 .LVL1129-.Ltext0
+	.uleb128 .LVL1130-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1130-1-.Ltext0
+	.uleb128 .LFE636-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS622:
+	.uleb128 0
+	.uleb128 .LVU3998
+	.uleb128 .LVU3998
+	.uleb128 0
+.LLST622:
+	.byte	0x4
+	.uleb128 .LVL1127-.Ltext0
+	.uleb128 .LVL1128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1128-1-.Ltext0
+	.uleb128 .LFE635-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS623:
+	.uleb128 0
+	.uleb128 .LVU3998
+	.uleb128 .LVU3998
+	.uleb128 0
+.LLST623:
+	.byte	0x4
+	.uleb128 .LVL1127-.Ltext0
+	.uleb128 .LVL1128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1128-1-.Ltext0
+	.uleb128 .LFE635-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS615:
+	.uleb128 0
+	.uleb128 .LVU3977
+	.uleb128 .LVU3977
+	.uleb128 .LVU3990
+	.uleb128 .LVU3990
+	.uleb128 0
+.LLST615:
+	.byte	0x4
+	.uleb128 .LVL1121-.Ltext0
+	.uleb128 .LVL1122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1122-1-.Ltext0
+	.uleb128 .LVL1125-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1125-.Ltext0
+	.uleb128 .LFE634-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS616:
+	.uleb128 0
+	.uleb128 .LVU3977
+	.uleb128 .LVU3977
+	.uleb128 .LVU3991
+	.uleb128 .LVU3991
+	.uleb128 0
+.LLST616:
+	.byte	0x4
+	.uleb128 .LVL1121-.Ltext0
+	.uleb128 .LVL1122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1122-1-.Ltext0
+	.uleb128 .LVL1126-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1126-.Ltext0
+	.uleb128 .LFE634-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS618:
+	.uleb128 .LVU3978
+	.uleb128 .LVU3988
+.LLST618:
+	.byte	0x4
+	.uleb128 .LVL1122-.Ltext0
+	.uleb128 .LVL1124-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS619:
+	.uleb128 .LVU3978
+	.uleb128 .LVU3988
+.LLST619:
+	.byte	0x4
+	.uleb128 .LVL1122-.Ltext0
+	.uleb128 .LVL1124-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS621:
+	.uleb128 .LVU3984
+	.uleb128 .LVU3990
+	.uleb128 .LVU3990
+	.uleb128 0
+.LLST621:
+	.byte	0x4
+	.uleb128 .LVL1123-.Ltext0
+	.uleb128 .LVL1125-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1125-.Ltext0
+	.uleb128 .LFE634-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS611:
+	.uleb128 0
+	.uleb128 .LVU3961
+	.uleb128 .LVU3961
+	.uleb128 0
+.LLST611:
+	.byte	0x4
+	.uleb128 .LVL1116-.Ltext0
+	.uleb128 .LVL1117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1117-1-.Ltext0
+	.uleb128 .LFE630-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS612:
+	.uleb128 0
+	.uleb128 .LVU3961
+	.uleb128 .LVU3961
+	.uleb128 0
+.LLST612:
+	.byte	0x4
+	.uleb128 .LVL1116-.Ltext0
+	.uleb128 .LVL1117-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1117-1-.Ltext0
+	.uleb128 .LFE630-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS609:
+	.uleb128 0
+	.uleb128 .LVU3956
+	.uleb128 .LVU3956
+	.uleb128 0
+.LLST609:
+	.byte	0x4
+	.uleb128 .LVL1114-.Ltext0
+	.uleb128 .LVL1115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1115-1-.Ltext0
+	.uleb128 .LFE629-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS610:
+	.uleb128 0
+	.uleb128 .LVU3956
+	.uleb128 .LVU3956
+	.uleb128 0
+.LLST610:
+	.byte	0x4
+	.uleb128 .LVL1114-.Ltext0
+	.uleb128 .LVL1115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1115-1-.Ltext0
+	.uleb128 .LFE629-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS607:
+	.uleb128 0
+	.uleb128 .LVU3951
+	.uleb128 .LVU3951
+	.uleb128 0
+.LLST607:
+	.byte	0x4
+	.uleb128 .LVL1112-.Ltext0
+	.uleb128 .LVL1113-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1113-1-.Ltext0
+	.uleb128 .LFE628-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS608:
+	.uleb128 0
+	.uleb128 .LVU3951
+	.uleb128 .LVU3951
+	.uleb128 0
+.LLST608:
+	.byte	0x4
+	.uleb128 .LVL1112-.Ltext0
+	.uleb128 .LVL1113-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1113-1-.Ltext0
+	.uleb128 .LFE628-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS605:
+	.uleb128 0
+	.uleb128 .LVU3945
+	.uleb128 .LVU3945
+	.uleb128 0
+.LLST605:
+	.byte	0x4
+	.uleb128 .LVL1110-.Ltext0
+	.uleb128 .LVL1111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1111-1-.Ltext0
+	.uleb128 .LFE627-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS606:
+	.uleb128 0
+	.uleb128 .LVU3945
+	.uleb128 .LVU3945
+	.uleb128 0
+.LLST606:
+	.byte	0x4
+	.uleb128 .LVL1110-.Ltext0
+	.uleb128 .LVL1111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1111-1-.Ltext0
+	.uleb128 .LFE627-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS603:
+	.uleb128 0
+	.uleb128 .LVU3941
+	.uleb128 .LVU3941
+	.uleb128 0
+.LLST603:
+	.byte	0x4
+	.uleb128 .LVL1108-.Ltext0
+	.uleb128 .LVL1109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1109-1-.Ltext0
+	.uleb128 .LFE625-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS604:
+	.uleb128 0
+	.uleb128 .LVU3941
+	.uleb128 .LVU3941
+	.uleb128 0
+.LLST604:
+	.byte	0x4
+	.uleb128 .LVL1108-.Ltext0
+	.uleb128 .LVL1109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1109-1-.Ltext0
+	.uleb128 .LFE625-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS601:
+	.uleb128 0
+	.uleb128 .LVU3936
+	.uleb128 .LVU3936
+	.uleb128 0
+.LLST601:
+	.byte	0x4
+	.uleb128 .LVL1106-.Ltext0
+	.uleb128 .LVL1107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1107-1-.Ltext0
+	.uleb128 .LFE624-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS602:
+	.uleb128 0
+	.uleb128 .LVU3936
+	.uleb128 .LVU3936
+	.uleb128 0
+.LLST602:
+	.byte	0x4
+	.uleb128 .LVL1106-.Ltext0
+	.uleb128 .LVL1107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1107-1-.Ltext0
+	.uleb128 .LFE624-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS599:
+	.uleb128 0
+	.uleb128 .LVU3931
+	.uleb128 .LVU3931
+	.uleb128 0
+.LLST599:
+	.byte	0x4
+	.uleb128 .LVL1104-.Ltext0
+	.uleb128 .LVL1105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1105-1-.Ltext0
+	.uleb128 .LFE623-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS600:
+	.uleb128 0
+	.uleb128 .LVU3931
+	.uleb128 .LVU3931
+	.uleb128 0
+.LLST600:
+	.byte	0x4
+	.uleb128 .LVL1104-.Ltext0
+	.uleb128 .LVL1105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1105-1-.Ltext0
+	.uleb128 .LFE623-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS595:
+	.uleb128 0
+	.uleb128 .LVU3920
+	.uleb128 .LVU3920
+	.uleb128 0
+.LLST595:
+	.byte	0x4
+	.uleb128 .LVL1100-.Ltext0
+	.uleb128 .LVL1101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1101-1-.Ltext0
+	.uleb128 .LFE621-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS596:
+	.uleb128 0
+	.uleb128 .LVU3920
+	.uleb128 .LVU3920
+	.uleb128 0
+.LLST596:
+	.byte	0x4
+	.uleb128 .LVL1100-.Ltext0
+	.uleb128 .LVL1101-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1101-1-.Ltext0
+	.uleb128 .LFE621-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS590:
+	.uleb128 0
+	.uleb128 .LVU3895
+	.uleb128 .LVU3895
+	.uleb128 .LVU3914
+	.uleb128 .LVU3914
+	.uleb128 0
+.LLST590:
+	.byte	0x4
+	.uleb128 .LVL1090-.Ltext0
+	.uleb128 .LVL1092-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1092-1-.Ltext0
+	.uleb128 .LVL1097-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1097-.Ltext0
+	.uleb128 .LFE619-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS591:
+	.uleb128 0
+	.uleb128 .LVU3895
+	.uleb128 .LVU3895
+	.uleb128 .LVU3916
+	.uleb128 .LVU3916
+	.uleb128 0
+.LLST591:
+	.byte	0x4
+	.uleb128 .LVL1090-.Ltext0
+	.uleb128 .LVL1092-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1092-1-.Ltext0
+	.uleb128 .LVL1099-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL1099-.Ltext0
+	.uleb128 .LFE619-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS593:
+	.uleb128 .LVU3894
+	.uleb128 .LVU3915
+.LLST593:
+	.byte	0x4
+	.uleb128 .LVL1091-.Ltext0
+	.uleb128 .LVL1098-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS594:
+	.uleb128 .LVU3905
+	.uleb128 .LVU3910
+.LLST594:
+	.byte	0x4
+	.uleb128 .LVL1095-.Ltext0
+	.uleb128 .LVL1096-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS585:
+	.uleb128 0
+	.uleb128 .LVU3865
+	.uleb128 .LVU3865
+	.uleb128 .LVU3884
+	.uleb128 .LVU3884
+	.uleb128 0
+.LLST585:
+	.byte	0x4
+	.uleb128 .LVL1080-.Ltext0
+	.uleb128 .LVL1082-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1082-1-.Ltext0
+	.uleb128 .LVL1087-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1087-.Ltext0
+	.uleb128 .LFE618-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS586:
+	.uleb128 0
+	.uleb128 .LVU3865
+	.uleb128 .LVU3865
+	.uleb128 .LVU3886
+	.uleb128 .LVU3886
+	.uleb128 0
+.LLST586:
+	.byte	0x4
+	.uleb128 .LVL1080-.Ltext0
+	.uleb128 .LVL1082-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1082-1-.Ltext0
+	.uleb128 .LVL1089-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL1089-.Ltext0
+	.uleb128 .LFE618-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS588:
+	.uleb128 .LVU3864
+	.uleb128 .LVU3885
+.LLST588:
+	.byte	0x4
+	.uleb128 .LVL1081-.Ltext0
+	.uleb128 .LVL1088-.Ltext0
+	.uleb128 0x8
+	.byte	0x76
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS589:
+	.uleb128 .LVU3875
+	.uleb128 .LVU3880
+.LLST589:
+	.byte	0x4
+	.uleb128 .LVL1085-.Ltext0
+	.uleb128 .LVL1086-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS583:
+	.uleb128 0
+	.uleb128 .LVU3849
+	.uleb128 .LVU3849
+	.uleb128 .LVU3855
+	.uleb128 .LVU3855
+	.uleb128 .LVU3856
+	.uleb128 .LVU3856
+	.uleb128 0
+.LLST583:
+	.byte	0x4
+	.uleb128 .LVL1074-.Ltext0
+	.uleb128 .LVL1075-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1075-.Ltext0
+	.uleb128 .LVL1078-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1078-.Ltext0
+	.uleb128 .LVL1079-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1079-1-.Ltext0
+	.uleb128 .LFE617-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS584:
+	.uleb128 0
+	.uleb128 .LVU3850
+	.uleb128 .LVU3850
+	.uleb128 .LVU3851
+	.uleb128 .LVU3851
+	.uleb128 0
+.LLST584:
+	.byte	0x4
+	.uleb128 .LVL1074-.Ltext0
+	.uleb128 .LVL1076-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1076-1-.Ltext0
+	.uleb128 .LVL1077-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL1077-.Ltext0
+	.uleb128 .LFE617-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS577:
+	.uleb128 0
+	.uleb128 .LVU3820
+	.uleb128 .LVU3820
+	.uleb128 .LVU3839
+	.uleb128 .LVU3839
+	.uleb128 0
+.LLST577:
+	.byte	0x4
+	.uleb128 .LVL1062-.Ltext0
+	.uleb128 .LVL1065-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1065-1-.Ltext0
+	.uleb128 .LVL1070-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1070-.Ltext0
+	.uleb128 .LFE616-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS578:
+	.uleb128 0
+	.uleb128 .LVU3820
+	.uleb128 .LVU3820
+	.uleb128 .LVU3840
+	.uleb128 .LVU3840
+	.uleb128 0
+.LLST578:
+	.byte	0x4
+	.uleb128 .LVL1062-.Ltext0
+	.uleb128 .LVL1065-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1065-1-.Ltext0
+	.uleb128 .LVL1071-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1071-.Ltext0
+	.uleb128 .LFE616-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS579:
+	.uleb128 .LVU3816
+	.uleb128 .LVU3842
+.LLST579:
+	.byte	0x4
+	.uleb128 .LVL1063-.Ltext0
+	.uleb128 .LVL1073-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS581:
+	.uleb128 .LVU3819
+	.uleb128 .LVU3841
+.LLST581:
+	.byte	0x4
+	.uleb128 .LVL1064-.Ltext0
+	.uleb128 .LVL1072-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS582:
+	.uleb128 .LVU3830
+	.uleb128 .LVU3835
+.LLST582:
+	.byte	0x4
+	.uleb128 .LVL1068-.Ltext0
+	.uleb128 .LVL1069-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS571:
+	.uleb128 0
+	.uleb128 .LVU3789
+	.uleb128 .LVU3789
+	.uleb128 .LVU3807
+	.uleb128 .LVU3807
+	.uleb128 0
+.LLST571:
+	.byte	0x4
+	.uleb128 .LVL1050-.Ltext0
+	.uleb128 .LVL1053-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1053-1-.Ltext0
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1058-.Ltext0
+	.uleb128 .LFE615-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS572:
+	.uleb128 0
+	.uleb128 .LVU3789
+	.uleb128 .LVU3789
+	.uleb128 .LVU3808
+	.uleb128 .LVU3808
+	.uleb128 0
+.LLST572:
+	.byte	0x4
+	.uleb128 .LVL1050-.Ltext0
+	.uleb128 .LVL1053-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1053-1-.Ltext0
+	.uleb128 .LVL1059-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1059-.Ltext0
+	.uleb128 .LFE615-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS573:
+	.uleb128 .LVU3785
+	.uleb128 .LVU3810
+.LLST573:
+	.byte	0x4
+	.uleb128 .LVL1051-.Ltext0
+	.uleb128 .LVL1061-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS575:
+	.uleb128 .LVU3788
+	.uleb128 .LVU3809
+.LLST575:
+	.byte	0x4
+	.uleb128 .LVL1052-.Ltext0
+	.uleb128 .LVL1060-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS576:
+	.uleb128 .LVU3798
+	.uleb128 .LVU3803
+.LLST576:
+	.byte	0x4
+	.uleb128 .LVL1056-.Ltext0
+	.uleb128 .LVL1057-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS481:
+	.uleb128 0
+	.uleb128 .LVU3038
+	.uleb128 .LVU3038
+	.uleb128 .LVU3373
+	.uleb128 .LVU3373
+	.uleb128 0
+.LLST481:
+	.byte	0x4
+	.uleb128 .LVL857-.Ltext0
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 .LVL932-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL932-.Ltext0
+	.uleb128 .LFE613-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS482:
+	.uleb128 .LVU3035
+	.uleb128 .LVU3038
+	.uleb128 .LVU3038
+	.uleb128 .LVU3359
+	.uleb128 .LVU3359
+	.uleb128 .LVU3374
+.LLST482:
+	.byte	0x4
+	.uleb128 .LVL858-.Ltext0
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 .LVL926-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0x4
+	.uleb128 .LVL926-.Ltext0
+	.uleb128 .LVL933-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS483:
+	.uleb128 .LVU3036
+	.uleb128 .LVU3038
+	.uleb128 .LVU3038
+	.uleb128 .LVU3370
+	.uleb128 .LVU3371
+	.uleb128 0
+.LLST483:
+	.byte	0x4
+	.uleb128 .LVL858-.Ltext0
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 .LVL930-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x4
+	.uleb128 .LVL931-.Ltext0
+	.uleb128 .LFE613-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+.LVUS484:
+	.uleb128 .LVU3037
+	.uleb128 .LVU3038
+	.uleb128 .LVU3038
+	.uleb128 .LVU3368
+	.uleb128 .LVU3368
+	.uleb128 .LVU3369
+	.uleb128 .LVU3371
+	.uleb128 .LVU3375
+.LLST484:
+	.byte	0x4
+	.uleb128 .LVL858-.Ltext0
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL859-.Ltext0
+	.uleb128 .LVL928-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL928-.Ltext0
+	.uleb128 .LVL929-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL931-.Ltext0
+	.uleb128 .LVL934-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS485:
+	.uleb128 .LVU3042
+	.uleb128 .LVU3376
+.LLST485:
+	.byte	0x4
+	.uleb128 .LVL860-.Ltext0
+	.uleb128 .LVL935-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS486:
+	.uleb128 .LVU3363
+	.uleb128 0
+.LLST486:
+	.byte	0x4
+	.uleb128 .LVL927-.Ltext0
+	.uleb128 .LFE613-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS488:
+	.uleb128 .LVU3356
+	.uleb128 .LVU3359
+.LLST488:
+	.byte	0x4
+	.uleb128 .LVL925-.Ltext0
+	.uleb128 .LVL926-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS490:
+	.uleb128 .LVU3047
+	.uleb128 .LVU3064
+	.uleb128 .LVU3313
+	.uleb128 .LVU3356
+.LLST490:
+	.byte	0x4
+	.uleb128 .LVL861-.Ltext0
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL919-.Ltext0
+	.uleb128 .LVL925-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS491:
+	.uleb128 .LVU3047
+	.uleb128 .LVU3064
+	.uleb128 .LVU3313
+	.uleb128 .LVU3356
+.LLST491:
+	.byte	0x4
+	.uleb128 .LVL861-.Ltext0
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0x4
+	.uleb128 .LVL919-.Ltext0
+	.uleb128 .LVL925-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+.LVUS492:
+	.uleb128 .LVU3047
+	.uleb128 .LVU3064
+	.uleb128 .LVU3313
+	.uleb128 .LVU3356
+.LLST492:
+	.byte	0x4
+	.uleb128 .LVL861-.Ltext0
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL919-.Ltext0
+	.uleb128 .LVL925-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS493:
+	.uleb128 .LVU3333
+	.uleb128 .LVU3335
+	.uleb128 .LVU3335
+	.uleb128 .LVU3356
+.LLST493:
+	.byte	0x4
+	.uleb128 .LVL921-.Ltext0
+	.uleb128 .LVL922-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL922-.Ltext0
+	.uleb128 .LVL925-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS494:
+	.uleb128 .LVU3339
+	.uleb128 .LVU3352
+.LLST494:
+	.byte	0x4
+	.uleb128 .LVL923-.Ltext0
+	.uleb128 .LVL924-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS496:
+	.uleb128 .LVU3066
+	.uleb128 .LVU3309
+.LLST496:
+	.byte	0x4
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS497:
+	.uleb128 .LVU3066
+	.uleb128 .LVU3309
+.LLST497:
+	.byte	0x4
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS498:
+	.uleb128 .LVU3068
+	.uleb128 .LVU3078
+.LLST498:
+	.byte	0x4
+	.uleb128 .LVL863-.Ltext0
+	.uleb128 .LVL864-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS499:
+	.uleb128 .LVU3079
+	.uleb128 .LVU3309
+.LLST499:
+	.byte	0x4
+	.uleb128 .LVL865-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS501:
+	.uleb128 .LVU3084
+	.uleb128 .LVU3127
+	.uleb128 .LVU3145
+	.uleb128 .LVU3189
+.LLST501:
+	.byte	0x4
+	.uleb128 .LVL866-.Ltext0
+	.uleb128 .LVL875-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL880-.Ltext0
+	.uleb128 .LVL889-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS502:
+	.uleb128 .LVU3088
+	.uleb128 .LVU3090
+	.uleb128 .LVU3090
+	.uleb128 .LVU3111
+	.uleb128 .LVU3112
+	.uleb128 .LVU3117
+	.uleb128 .LVU3124
+	.uleb128 .LVU3127
+	.uleb128 .LVU3145
+	.uleb128 .LVU3148
+.LLST502:
+	.byte	0x4
+	.uleb128 .LVL868-.Ltext0
+	.uleb128 .LVL869-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL869-.Ltext0
+	.uleb128 .LVL871-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL872-.Ltext0
+	.uleb128 .LVL873-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL874-.Ltext0
+	.uleb128 .LVL875-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL880-.Ltext0
+	.uleb128 .LVL881-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS504:
+	.uleb128 .LVU3132
+	.uleb128 .LVU3136
+	.uleb128 .LVU3136
+	.uleb128 .LVU3140
+	.uleb128 .LVU3140
+	.uleb128 .LVU3144
+	.uleb128 .LVU3144
+	.uleb128 .LVU3145
+.LLST504:
+	.byte	0x4
+	.uleb128 .LVL876-.Ltext0
+	.uleb128 .LVL877-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL877-.Ltext0
+	.uleb128 .LVL878-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL878-.Ltext0
+	.uleb128 .LVL879-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL879-.Ltext0
+	.uleb128 .LVL880-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS506:
+	.uleb128 .LVU3149
+	.uleb128 .LVU3186
+.LLST506:
+	.byte	0x4
+	.uleb128 .LVL882-.Ltext0
+	.uleb128 .LVL887-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS507:
+	.uleb128 .LVU3187
+	.uleb128 .LVU3209
+	.uleb128 .LVU3209
+	.uleb128 .LVU3214
+	.uleb128 .LVU3214
+	.uleb128 .LVU3226
+	.uleb128 .LVU3226
+	.uleb128 .LVU3229
+	.uleb128 .LVU3233
+	.uleb128 .LVU3244
+	.uleb128 .LVU3244
+	.uleb128 .LVU3249
+	.uleb128 .LVU3253
+	.uleb128 .LVU3275
+	.uleb128 .LVU3275
+	.uleb128 .LVU3282
+	.uleb128 .LVU3282
+	.uleb128 .LVU3287
+	.uleb128 .LVU3295
+	.uleb128 .LVU3309
+.LLST507:
+	.byte	0x4
+	.uleb128 .LVL888-.Ltext0
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 .LVL897-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL897-.Ltext0
+	.uleb128 .LVL900-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL900-.Ltext0
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 .LVL904-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL904-.Ltext0
+	.uleb128 .LVL906-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 .LVL910-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL910-.Ltext0
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS508:
+	.uleb128 .LVU3189
+	.uleb128 .LVU3263
+	.uleb128 .LVU3263
+	.uleb128 .LVU3287
+	.uleb128 .LVU3287
+	.uleb128 .LVU3290
+	.uleb128 .LVU3291
+	.uleb128 .LVU3309
+.LLST508:
+	.byte	0x4
+	.uleb128 .LVL889-.Ltext0
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL908-.Ltext0
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS509:
+	.uleb128 .LVU3192
+	.uleb128 .LVU3197
+	.uleb128 .LVU3197
+	.uleb128 .LVU3198
+	.uleb128 .LVU3200
+	.uleb128 .LVU3202
+	.uleb128 .LVU3202
+	.uleb128 .LVU3293
+	.uleb128 .LVU3293
+	.uleb128 .LVU3295
+	.uleb128 .LVU3295
+	.uleb128 .LVU3309
+.LLST509:
+	.byte	0x4
+	.uleb128 .LVL890-.Ltext0
+	.uleb128 .LVL891-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL891-.Ltext0
+	.uleb128 .LVL892-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x4
+	.uleb128 .LVL893-.Ltext0
+	.uleb128 .LVL894-1-.Ltext0
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL894-1-.Ltext0
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 0xc
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 0xc
+	.byte	0x72
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0xe
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x6
+	.byte	0x32
+	.byte	0x24
+	.byte	0x91
+	.sleb128 -208
+	.byte	0x6
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0
+.LVUS511:
+	.uleb128 .LVU3158
+	.uleb128 .LVU3166
+	.uleb128 .LVU3166
+	.uleb128 .LVU3174
+	.uleb128 .LVU3174
+	.uleb128 .LVU3183
+	.uleb128 .LVU3183
+	.uleb128 .LVU3309
+.LLST511:
+	.byte	0x4
+	.uleb128 .LVL883-.Ltext0
+	.uleb128 .LVL884-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL884-.Ltext0
+	.uleb128 .LVL885-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL885-.Ltext0
+	.uleb128 .LVL886-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL886-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS513:
+	.uleb128 .LVU3195
+	.uleb128 .LVU3198
+	.uleb128 .LVU3200
+	.uleb128 .LVU3202
+	.uleb128 .LVU3202
+	.uleb128 .LVU3295
+	.uleb128 .LVU3295
+	.uleb128 .LVU3309
+.LLST513:
+	.byte	0x4
+	.uleb128 .LVL890-.Ltext0
+	.uleb128 .LVL892-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL893-.Ltext0
+	.uleb128 .LVL894-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL894-1-.Ltext0
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x4
+	.uleb128 .LVL913-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS515:
+	.uleb128 .LVU3202
+	.uleb128 .LVU3309
+.LLST515:
+	.byte	0x4
+	.uleb128 .LVL894-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS517:
+	.uleb128 .LVU3203
+	.uleb128 .LVU3209
+	.uleb128 .LVU3215
+	.uleb128 .LVU3229
+	.uleb128 .LVU3233
+	.uleb128 .LVU3249
+	.uleb128 .LVU3253
+	.uleb128 .LVU3275
+.LLST517:
+	.byte	0x4
+	.uleb128 .LVL894-.Ltext0
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL898-.Ltext0
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 .LVL906-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS518:
+	.uleb128 .LVU3203
+	.uleb128 .LVU3207
+	.uleb128 .LVU3207
+	.uleb128 .LVU3209
+	.uleb128 .LVU3215
+	.uleb128 .LVU3223
+	.uleb128 .LVU3223
+	.uleb128 .LVU3226
+	.uleb128 .LVU3226
+	.uleb128 .LVU3228
+	.uleb128 .LVU3233
+	.uleb128 .LVU3241
+	.uleb128 .LVU3241
+	.uleb128 .LVU3244
+	.uleb128 .LVU3244
+	.uleb128 .LVU3246
+	.uleb128 .LVU3253
+	.uleb128 .LVU3255
+	.uleb128 .LVU3255
+	.uleb128 .LVU3272
+	.uleb128 .LVU3272
+	.uleb128 .LVU3273
+	.uleb128 .LVU3273
+	.uleb128 .LVU3274
+	.uleb128 .LVU3274
+	.uleb128 .LVU3275
+.LLST518:
+	.byte	0x4
+	.uleb128 .LVL894-.Ltext0
+	.uleb128 .LVL895-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL895-.Ltext0
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL898-.Ltext0
+	.uleb128 .LVL899-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL899-.Ltext0
+	.uleb128 .LVL900-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL900-.Ltext0
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 .LVL903-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL903-.Ltext0
+	.uleb128 .LVL904-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL904-.Ltext0
+	.uleb128 .LVL905-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS520:
+	.uleb128 .LVU3211
+	.uleb128 .LVU3215
+	.uleb128 .LVU3231
+	.uleb128 .LVU3233
+	.uleb128 .LVU3251
+	.uleb128 .LVU3253
+	.uleb128 .LVU3277
+	.uleb128 .LVU3280
+	.uleb128 .LVU3287
+	.uleb128 .LVU3290
+.LLST520:
+	.byte	0x4
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 .LVL898-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL906-.Ltext0
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 .LVL909-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS521:
+	.uleb128 .LVU3211
+	.uleb128 .LVU3215
+	.uleb128 .LVU3231
+	.uleb128 .LVU3233
+	.uleb128 .LVU3251
+	.uleb128 .LVU3253
+	.uleb128 .LVU3287
+	.uleb128 .LVU3288
+	.uleb128 .LVU3288
+	.uleb128 .LVU3290
+	.uleb128 .LVU3290
+	.uleb128 .LVU3291
+.LLST521:
+	.byte	0x4
+	.uleb128 .LVL896-.Ltext0
+	.uleb128 .LVL898-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL901-.Ltext0
+	.uleb128 .LVL902-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL906-.Ltext0
+	.uleb128 .LVL907-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL911-.Ltext0
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 .LVL912-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS522:
+	.uleb128 .LVU3296
+	.uleb128 .LVU3300
+	.uleb128 .LVU3300
+	.uleb128 .LVU3304
+	.uleb128 .LVU3304
+	.uleb128 .LVU3308
+	.uleb128 .LVU3308
+	.uleb128 .LVU3309
+.LLST522:
+	.byte	0x4
+	.uleb128 .LVL914-.Ltext0
+	.uleb128 .LVL915-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL915-.Ltext0
+	.uleb128 .LVL916-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL916-.Ltext0
+	.uleb128 .LVL917-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL917-.Ltext0
+	.uleb128 .LVL918-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS460:
+	.uleb128 0
+	.uleb128 .LVU2881
+	.uleb128 .LVU2881
+	.uleb128 .LVU2917
+	.uleb128 .LVU2917
+	.uleb128 0
+.LLST460:
+	.byte	0x4
+	.uleb128 .LVL815-.Ltext0
+	.uleb128 .LVL817-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL817-1-.Ltext0
+	.uleb128 .LVL824-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL824-.Ltext0
+	.uleb128 .LFE609-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS461:
+	.uleb128 0
+	.uleb128 .LVU2881
+	.uleb128 .LVU2881
+	.uleb128 .LVU2918
+	.uleb128 .LVU2918
+	.uleb128 0
+.LLST461:
+	.byte	0x4
+	.uleb128 .LVL815-.Ltext0
+	.uleb128 .LVL817-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL817-1-.Ltext0
+	.uleb128 .LVL825-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL825-.Ltext0
+	.uleb128 .LFE609-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS463:
+	.uleb128 .LVU2880
+	.uleb128 .LVU2919
+.LLST463:
+	.byte	0x4
+	.uleb128 .LVL816-.Ltext0
+	.uleb128 .LVL826-.Ltext0
+	.uleb128 0x8
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS464:
+	.uleb128 .LVU2908
+	.uleb128 .LVU2913
+.LLST464:
+	.byte	0x4
+	.uleb128 .LVL822-.Ltext0
+	.uleb128 .LVL823-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS465:
+	.uleb128 .LVU2890
+	.uleb128 .LVU2904
+.LLST465:
+	.byte	0x4
+	.uleb128 .LVL819-.Ltext0
+	.uleb128 .LVL821-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS466:
+	.uleb128 .LVU2890
+	.uleb128 .LVU2904
+.LLST466:
+	.byte	0x4
+	.uleb128 .LVL819-.Ltext0
+	.uleb128 .LVL821-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS447:
+	.uleb128 0
+	.uleb128 .LVU2819
+	.uleb128 .LVU2819
+	.uleb128 .LVU2871
+	.uleb128 .LVU2871
+	.uleb128 0
+.LLST447:
+	.byte	0x4
+	.uleb128 .LVL795-.Ltext0
+	.uleb128 .LVL797-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL797-1-.Ltext0
+	.uleb128 .LVL811-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL811-.Ltext0
+	.uleb128 .LFE608-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS448:
+	.uleb128 0
+	.uleb128 .LVU2819
+	.uleb128 .LVU2819
+	.uleb128 .LVU2872
+	.uleb128 .LVU2872
+	.uleb128 0
+.LLST448:
+	.byte	0x4
+	.uleb128 .LVL795-.Ltext0
+	.uleb128 .LVL797-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL797-1-.Ltext0
+	.uleb128 .LVL812-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL812-.Ltext0
+	.uleb128 .LFE608-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS449:
+	.uleb128 0
+	.uleb128 .LVU2819
+	.uleb128 .LVU2819
+	.uleb128 .LVU2873
+	.uleb128 .LVU2873
+	.uleb128 0
+.LLST449:
+	.byte	0x4
+	.uleb128 .LVL795-.Ltext0
+	.uleb128 .LVL797-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL797-1-.Ltext0
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL813-.Ltext0
+	.uleb128 .LFE608-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS451:
+	.uleb128 .LVU2818
+	.uleb128 .LVU2874
+.LLST451:
+	.byte	0x4
+	.uleb128 .LVL796-.Ltext0
+	.uleb128 .LVL814-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS452:
+	.uleb128 .LVU2862
+	.uleb128 .LVU2867
+.LLST452:
+	.byte	0x4
+	.uleb128 .LVL809-.Ltext0
+	.uleb128 .LVL810-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS453:
+	.uleb128 .LVU2827
+	.uleb128 .LVU2858
+.LLST453:
+	.byte	0x4
+	.uleb128 .LVL799-.Ltext0
+	.uleb128 .LVL808-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS454:
+	.uleb128 .LVU2827
+	.uleb128 .LVU2841
+	.uleb128 .LVU2841
+	.uleb128 .LVU2852
+	.uleb128 .LVU2852
+	.uleb128 .LVU2853
+	.uleb128 .LVU2853
+	.uleb128 .LVU2855
+	.uleb128 .LVU2857
+	.uleb128 .LVU2858
+.LLST454:
+	.byte	0x4
+	.uleb128 .LVL799-.Ltext0
+	.uleb128 .LVL801-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL801-.Ltext0
+	.uleb128 .LVL804-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL804-.Ltext0
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 .LVL806-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL807-.Ltext0
+	.uleb128 .LVL808-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS455:
+	.uleb128 .LVU2827
+	.uleb128 .LVU2858
+.LLST455:
+	.byte	0x4
+	.uleb128 .LVL799-.Ltext0
+	.uleb128 .LVL808-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS456:
+	.uleb128 .LVU2846
+	.uleb128 .LVU2855
+.LLST456:
+	.byte	0x4
+	.uleb128 .LVL803-.Ltext0
+	.uleb128 .LVL806-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS457:
+	.uleb128 .LVU2846
+	.uleb128 .LVU2852
+	.uleb128 .LVU2852
+	.uleb128 .LVU2853
+	.uleb128 .LVU2853
+	.uleb128 .LVU2855
+.LLST457:
+	.byte	0x4
+	.uleb128 .LVL803-.Ltext0
+	.uleb128 .LVL804-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL804-.Ltext0
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL805-.Ltext0
+	.uleb128 .LVL806-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS458:
+	.uleb128 .LVU2844
+	.uleb128 .LVU2855
+.LLST458:
+	.byte	0x4
+	.uleb128 .LVL802-.Ltext0
+	.uleb128 .LVL806-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS467:
+	.uleb128 0
+	.uleb128 .LVU2926
+	.uleb128 .LVU2926
+	.uleb128 .LVU3024
+	.uleb128 .LVU3024
+	.uleb128 0
+.LLST467:
+	.byte	0x4
+	.uleb128 .LVL827-.Ltext0
+	.uleb128 .LVL829-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL829-1-.Ltext0
+	.uleb128 .LVL853-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL853-.Ltext0
+	.uleb128 .LFE607-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS468:
+	.uleb128 0
+	.uleb128 .LVU2926
+	.uleb128 .LVU2926
+	.uleb128 .LVU3025
+	.uleb128 .LVU3025
+	.uleb128 0
+.LLST468:
+	.byte	0x4
+	.uleb128 .LVL827-.Ltext0
+	.uleb128 .LVL829-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL829-1-.Ltext0
+	.uleb128 .LVL854-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL854-.Ltext0
+	.uleb128 .LFE607-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS469:
+	.uleb128 0
+	.uleb128 .LVU2926
+	.uleb128 .LVU2926
+	.uleb128 .LVU3026
+	.uleb128 .LVU3026
+	.uleb128 0
+.LLST469:
+	.byte	0x4
+	.uleb128 .LVL827-.Ltext0
+	.uleb128 .LVL829-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL829-1-.Ltext0
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL855-.Ltext0
+	.uleb128 .LFE607-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS471:
+	.uleb128 .LVU2925
+	.uleb128 .LVU3027
+.LLST471:
+	.byte	0x4
+	.uleb128 .LVL828-.Ltext0
+	.uleb128 .LVL856-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x9f
+	.byte	0
+.LVUS472:
+	.uleb128 .LVU3015
+	.uleb128 .LVU3020
+.LLST472:
+	.byte	0x4
+	.uleb128 .LVL851-.Ltext0
+	.uleb128 .LVL852-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS473:
+	.uleb128 .LVU2934
+	.uleb128 .LVU2951
+	.uleb128 .LVU2951
+	.uleb128 .LVU2954
+	.uleb128 .LVU2954
+	.uleb128 .LVU2957
+	.uleb128 .LVU2957
+	.uleb128 .LVU2960
+	.uleb128 .LVU2960
+	.uleb128 .LVU2961
+	.uleb128 .LVU2961
+	.uleb128 .LVU2993
+	.uleb128 .LVU3008
+	.uleb128 .LVU3010
+.LLST473:
+	.byte	0x4
+	.uleb128 .LVL831-.Ltext0
+	.uleb128 .LVL833-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL833-.Ltext0
+	.uleb128 .LVL834-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL834-.Ltext0
+	.uleb128 .LVL835-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL835-.Ltext0
+	.uleb128 .LVL836-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL836-.Ltext0
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 .LVL842-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL848-.Ltext0
+	.uleb128 .LVL849-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS474:
+	.uleb128 .LVU2934
+	.uleb128 .LVU2950
+	.uleb128 .LVU2950
+	.uleb128 .LVU2954
+	.uleb128 .LVU2954
+	.uleb128 .LVU2956
+	.uleb128 .LVU2956
+	.uleb128 .LVU2960
+	.uleb128 .LVU2960
+	.uleb128 .LVU2961
+	.uleb128 .LVU2961
+	.uleb128 .LVU2972
+	.uleb128 .LVU2973
+	.uleb128 .LVU2985
+.LLST474:
+	.byte	0x4
+	.uleb128 .LVL831-.Ltext0
+	.uleb128 .LVL833-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL833-.Ltext0
+	.uleb128 .LVL834-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL834-.Ltext0
+	.uleb128 .LVL835-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL835-.Ltext0
+	.uleb128 .LVL836-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL836-.Ltext0
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 .LVL838-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL839-.Ltext0
+	.uleb128 .LVL840-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS475:
+	.uleb128 .LVU2934
+	.uleb128 .LVU3011
+.LLST475:
+	.byte	0x4
+	.uleb128 .LVL831-.Ltext0
+	.uleb128 .LVL850-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS476:
+	.uleb128 .LVU2962
+	.uleb128 .LVU2988
+	.uleb128 .LVU2988
+	.uleb128 .LVU2993
+	.uleb128 .LVU3008
+	.uleb128 .LVU3011
+.LLST476:
+	.byte	0x4
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 .LVL841-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL841-.Ltext0
+	.uleb128 .LVL842-.Ltext0
+	.uleb128 0x13
+	.byte	0x9
+	.byte	0xff
+	.byte	0x38
+	.byte	0x71
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x33
+	.byte	0x24
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL848-.Ltext0
+	.uleb128 .LVL850-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS477:
+	.uleb128 .LVU2963
+	.uleb128 .LVU2985
+	.uleb128 .LVU2985
+	.uleb128 .LVU2995
+	.uleb128 .LVU3008
+	.uleb128 .LVU3011
+.LLST477:
+	.byte	0x4
+	.uleb128 .LVL837-.Ltext0
+	.uleb128 .LVL840-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL840-.Ltext0
+	.uleb128 .LVL843-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL848-.Ltext0
+	.uleb128 .LVL850-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS479:
+	.uleb128 .LVU2999
+	.uleb128 .LVU3003
+	.uleb128 .LVU3003
+	.uleb128 .LVU3004
+	.uleb128 .LVU3004
+	.uleb128 .LVU3006
+.LLST479:
+	.byte	0x4
+	.uleb128 .LVL844-.Ltext0
+	.uleb128 .LVL845-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL845-.Ltext0
+	.uleb128 .LVL846-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0x4
+	.uleb128 .LVL846-.Ltext0
+	.uleb128 .LVL847-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x70
+	.sleb128 0
+	.byte	0
+.LVUS480:
+	.uleb128 .LVU2989
+	.uleb128 .LVU3006
+.LLST480:
+	.byte	0x4
+	.uleb128 .LVL841-.Ltext0
+	.uleb128 .LVL847-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS62:
+	.uleb128 0
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LFE606-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU384
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+	.uleb128 .LVU393
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-1-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU385
+	.uleb128 .LVU393
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0
+.LVUS446:
+	.uleb128 0
+	.uleb128 .LVU2807
+	.uleb128 .LVU2807
+	.uleb128 0
+.LLST446:
+	.byte	0x4
+	.uleb128 .LVL792-.Ltext0
+	.uleb128 .LVL793-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL793-1-.Ltext0
+	.uleb128 .LFE605-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LFE604-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU367
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-1-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x23
+	.uleb128 0x20
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU368
+	.uleb128 .LVU377
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU330
+	.uleb128 .LVU330
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU334
+	.uleb128 .LVU337
+	.uleb128 .LVU342
+	.uleb128 .LVU344
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x4
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LFE603-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU346
+	.uleb128 .LVU349
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU351
+	.uleb128 .LVU359
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x2
+	.byte	0x36
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU351
+	.uleb128 .LVU359
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU356
+	.uleb128 .LVU359
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS373:
+	.uleb128 0
+	.uleb128 .LVU2308
+	.uleb128 .LVU2308
+	.uleb128 .LVU2801
+	.uleb128 .LVU2801
+	.uleb128 0
+.LLST373:
+	.byte	0x4
+	.uleb128 .LVL675-.Ltext0
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL679-.Ltext0
+	.uleb128 .LVL790-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL790-.Ltext0
+	.uleb128 .LFE602-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS374:
+	.uleb128 .LVU2303
+	.uleb128 .LVU2802
+.LLST374:
+	.byte	0x4
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 .LVL791-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS375:
+	.uleb128 .LVU2312
+	.uleb128 .LVU2338
+.LLST375:
+	.byte	0x4
+	.uleb128 .LVL680-.Ltext0
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS376:
+	.uleb128 .LVU2314
+	.uleb128 .LVU2316
+	.uleb128 .LVU2316
+	.uleb128 .LVU2372
+	.uleb128 .LVU2415
+	.uleb128 .LVU2424
+	.uleb128 .LVU2424
+	.uleb128 .LVU2425
+	.uleb128 .LVU2426
+	.uleb128 .LVU2440
+	.uleb128 .LVU2440
+	.uleb128 .LVU2442
+	.uleb128 .LVU2443
+	.uleb128 .LVU2500
+	.uleb128 .LVU2500
+	.uleb128 .LVU2502
+	.uleb128 .LVU2502
+	.uleb128 .LVU2540
+	.uleb128 .LVU2541
+	.uleb128 .LVU2543
+	.uleb128 .LVU2545
+	.uleb128 .LVU2546
+	.uleb128 .LVU2546
+	.uleb128 .LVU2565
+	.uleb128 .LVU2569
+	.uleb128 .LVU2575
+	.uleb128 .LVU2575
+	.uleb128 .LVU2581
+	.uleb128 .LVU2584
+	.uleb128 .LVU2585
+	.uleb128 .LVU2585
+	.uleb128 .LVU2664
+	.uleb128 .LVU2665
+	.uleb128 .LVU2667
+	.uleb128 .LVU2667
+	.uleb128 .LVU2683
+	.uleb128 .LVU2683
+	.uleb128 .LVU2688
+	.uleb128 .LVU2688
+	.uleb128 .LVU2694
+	.uleb128 .LVU2696
+	.uleb128 .LVU2706
+	.uleb128 .LVU2706
+	.uleb128 .LVU2714
+	.uleb128 .LVU2714
+	.uleb128 .LVU2773
+	.uleb128 .LVU2773
+	.uleb128 .LVU2776
+	.uleb128 .LVU2793
+	.uleb128 .LVU2800
+.LLST376:
+	.byte	0x4
+	.uleb128 .LVL682-.Ltext0
+	.uleb128 .LVL683-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL683-.Ltext0
+	.uleb128 .LVL694-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL710-.Ltext0
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL711-.Ltext0
+	.uleb128 .LVL712-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL713-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 .LVL717-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL729-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 48
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 .LVL735-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL737-.Ltext0
+	.uleb128 .LVL738-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL740-.Ltext0
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL741-.Ltext0
+	.uleb128 .LVL744-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL746-.Ltext0
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL747-.Ltext0
+	.uleb128 .LVL748-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL750-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 .LVL763-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL765-.Ltext0
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL769-.Ltext0
+	.uleb128 .LVL770-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 65
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL770-.Ltext0
+	.uleb128 .LVL771-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL773-.Ltext0
+	.uleb128 .LVL775-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL775-.Ltext0
+	.uleb128 .LVL776-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 65
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL776-.Ltext0
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 .LVL786-.Ltext0
+	.uleb128 0x4
+	.byte	0x71
+	.sleb128 65
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL788-.Ltext0
+	.uleb128 .LVL789-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS380:
+	.uleb128 .LVU2357
+	.uleb128 .LVU2413
+.LLST380:
+	.byte	0x4
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 .LVL708-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS381:
+	.uleb128 .LVU2332
+	.uleb128 .LVU2357
+.LLST381:
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS382:
+	.uleb128 .LVU2331
+	.uleb128 .LVU2357
+.LLST382:
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS383:
+	.uleb128 .LVU2331
+	.uleb128 .LVU2356
+.LLST383:
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL690-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS384:
+	.uleb128 .LVU2331
+	.uleb128 .LVU2357
+.LLST384:
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS385:
+	.uleb128 .LVU2331
+	.uleb128 .LVU2338
+.LLST385:
+	.byte	0x4
+	.uleb128 .LVL684-.Ltext0
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS386:
+	.uleb128 .LVU2336
+	.uleb128 .LVU2357
+.LLST386:
+	.byte	0x4
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS387:
+	.uleb128 .LVU2337
+	.uleb128 .LVU2338
+	.uleb128 .LVU2338
+	.uleb128 .LVU2357
+.LLST387:
+	.byte	0x4
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL685-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS388:
+	.uleb128 .LVU2343
+	.uleb128 .LVU2357
+.LLST388:
+	.byte	0x4
+	.uleb128 .LVL686-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS389:
+	.uleb128 .LVU2346
+	.uleb128 .LVU2357
+.LLST389:
+	.byte	0x4
+	.uleb128 .LVL687-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS390:
+	.uleb128 .LVU2348
+	.uleb128 .LVU2357
+.LLST390:
+	.byte	0x4
+	.uleb128 .LVL688-.Ltext0
+	.uleb128 .LVL691-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS391:
+	.uleb128 .LVU2361
+	.uleb128 .LVU2409
+.LLST391:
+	.byte	0x4
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS392:
+	.uleb128 .LVU2361
+	.uleb128 .LVU2409
+.LLST392:
+	.byte	0x4
+	.uleb128 .LVL692-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS393:
+	.uleb128 .LVU2368
+	.uleb128 .LVU2375
+	.uleb128 .LVU2375
+	.uleb128 .LVU2376
+	.uleb128 .LVU2376
+	.uleb128 .LVU2377
+	.uleb128 .LVU2378
+	.uleb128 .LVU2385
+	.uleb128 .LVU2390
+	.uleb128 .LVU2394
+.LLST393:
+	.byte	0x4
+	.uleb128 .LVL693-.Ltext0
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL695-.Ltext0
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 0x8
+	.byte	0x75
+	.sleb128 48
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL696-.Ltext0
+	.uleb128 .LVL697-1-.Ltext0
+	.uleb128 0xb
+	.byte	0x73
+	.sleb128 0
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x30
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL701-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS394:
+	.uleb128 .LVU2398
+	.uleb128 .LVU2409
+.LLST394:
+	.byte	0x4
+	.uleb128 .LVL703-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS396:
+	.uleb128 .LVU2379
+	.uleb128 .LVU2385
+	.uleb128 .LVU2390
+	.uleb128 .LVU2394
+.LLST396:
+	.byte	0x4
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 0xe
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x6
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL701-1-.Ltext0
+	.uleb128 0xe
+	.byte	0x72
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x23
+	.uleb128 0x6
+	.byte	0x33
+	.byte	0x24
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0
+.LVUS397:
+	.uleb128 .LVU2379
+	.uleb128 .LVU2385
+	.uleb128 .LVU2390
+	.uleb128 .LVU2395
+.LLST397:
+	.byte	0x4
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 .LVL699-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL700-.Ltext0
+	.uleb128 .LVL702-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS398:
+	.uleb128 .LVU2381
+	.uleb128 .LVU2383
+.LLST398:
+	.byte	0x4
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 .LVL698-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS399:
+	.uleb128 .LVU2400
+	.uleb128 .LVU2401
+	.uleb128 .LVU2401
+	.uleb128 .LVU2406
+	.uleb128 .LVU2406
+	.uleb128 .LVU2408
+	.uleb128 .LVU2408
+	.uleb128 .LVU2409
+.LLST399:
+	.byte	0x4
+	.uleb128 .LVL703-.Ltext0
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL704-.Ltext0
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL705-.Ltext0
+	.uleb128 .LVL706-.Ltext0
+	.uleb128 0x3
+	.byte	0x7e
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL706-.Ltext0
+	.uleb128 .LVL707-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS401:
+	.uleb128 .LVU2462
+	.uleb128 .LVU2475
+	.uleb128 .LVU2475
+	.uleb128 .LVU2480
+.LLST401:
+	.byte	0x4
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL726-.Ltext0
+	.uleb128 .LVL727-.Ltext0
+	.uleb128 0x10
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x25
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x35
+	.byte	0x24
+	.byte	0x7a
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS403:
+	.uleb128 .LVU2435
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2462
+.LLST403:
+	.byte	0x4
+	.uleb128 .LVL714-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS404:
+	.uleb128 .LVU2434
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2462
+.LLST404:
+	.byte	0x4
+	.uleb128 .LVL714-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS405:
+	.uleb128 .LVU2434
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2461
+.LLST405:
+	.byte	0x4
+	.uleb128 .LVL714-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL724-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS406:
+	.uleb128 .LVU2434
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2462
+.LLST406:
+	.byte	0x4
+	.uleb128 .LVL714-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS407:
+	.uleb128 .LVU2434
+	.uleb128 .LVU2437
+	.uleb128 .LVU2437
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2462
+.LLST407:
+	.byte	0x4
+	.uleb128 .LVL714-.Ltext0
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 16
+	.byte	0
+.LVUS408:
+	.uleb128 .LVU2437
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2462
+.LLST408:
+	.byte	0x4
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS409:
+	.uleb128 .LVU2438
+	.uleb128 .LVU2440
+	.uleb128 .LVU2443
+	.uleb128 .LVU2462
+.LLST409:
+	.byte	0x4
+	.uleb128 .LVL715-.Ltext0
+	.uleb128 .LVL716-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL718-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS411:
+	.uleb128 .LVU2447
+	.uleb128 .LVU2458
+	.uleb128 .LVU2460
+	.uleb128 .LVU2462
+.LLST411:
+	.byte	0x4
+	.uleb128 .LVL719-.Ltext0
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS412:
+	.uleb128 .LVU2450
+	.uleb128 .LVU2458
+	.uleb128 .LVU2460
+	.uleb128 .LVU2462
+.LLST412:
+	.byte	0x4
+	.uleb128 .LVL720-.Ltext0
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS413:
+	.uleb128 .LVU2452
+	.uleb128 .LVU2458
+	.uleb128 .LVU2460
+	.uleb128 .LVU2462
+.LLST413:
+	.byte	0x4
+	.uleb128 .LVL721-.Ltext0
+	.uleb128 .LVL722-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL723-.Ltext0
+	.uleb128 .LVL725-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS416:
+	.uleb128 .LVU2522
+	.uleb128 .LVU2525
+.LLST416:
+	.byte	0x4
+	.uleb128 .LVL732-.Ltext0
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS417:
+	.uleb128 .LVU2528
+	.uleb128 .LVU2531
+.LLST417:
+	.byte	0x4
+	.uleb128 .LVL733-.Ltext0
+	.uleb128 .LVL734-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS415:
+	.uleb128 .LVU2491
+	.uleb128 .LVU2502
+	.uleb128 .LVU2505
+	.uleb128 .LVU2516
+	.uleb128 .LVU2543
+	.uleb128 .LVU2550
+.LLST415:
+	.byte	0x4
+	.uleb128 .LVL728-.Ltext0
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL730-.Ltext0
+	.uleb128 .LVL731-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL738-.Ltext0
+	.uleb128 .LVL742-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS418:
+	.uleb128 .LVU2557
+	.uleb128 .LVU2585
+.LLST418:
+	.byte	0x4
+	.uleb128 .LVL743-.Ltext0
+	.uleb128 .LVL751-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS419:
+	.uleb128 .LVU2592
+	.uleb128 .LVU2776
+.LLST419:
+	.byte	0x4
+	.uleb128 .LVL752-.Ltext0
+	.uleb128 .LVL786-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS423:
+	.uleb128 .LVU2618
+	.uleb128 .LVU2623
+.LLST423:
+	.byte	0x4
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS424:
+	.uleb128 .LVU2626
+	.uleb128 .LVU2629
+.LLST424:
+	.byte	0x4
+	.uleb128 .LVL756-.Ltext0
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS425:
+	.uleb128 .LVU2631
+	.uleb128 .LVU2635
+.LLST425:
+	.byte	0x4
+	.uleb128 .LVL757-.Ltext0
+	.uleb128 .LVL758-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS426:
+	.uleb128 .LVU2641
+	.uleb128 .LVU2645
+.LLST426:
+	.byte	0x4
+	.uleb128 .LVL759-.Ltext0
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS427:
+	.uleb128 .LVU2648
+	.uleb128 .LVU2654
+.LLST427:
+	.byte	0x4
+	.uleb128 .LVL760-.Ltext0
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS428:
+	.uleb128 .LVU2657
+	.uleb128 .LVU2660
+.LLST428:
+	.byte	0x4
+	.uleb128 .LVL761-.Ltext0
+	.uleb128 .LVL762-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS433:
+	.uleb128 .LVU2680
+	.uleb128 .LVU2688
+	.uleb128 .LVU2773
+	.uleb128 .LVU2776
+.LLST433:
+	.byte	0x4
+	.uleb128 .LVL768-.Ltext0
+	.uleb128 .LVL770-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 .LVL786-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS434:
+	.uleb128 .LVU2698
+	.uleb128 .LVU2701
+.LLST434:
+	.byte	0x4
+	.uleb128 .LVL773-.Ltext0
+	.uleb128 .LVL774-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS435:
+	.uleb128 .LVU2716
+	.uleb128 .LVU2719
+.LLST435:
+	.byte	0x4
+	.uleb128 .LVL776-.Ltext0
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS436:
+	.uleb128 .LVU2722
+	.uleb128 .LVU2727
+.LLST436:
+	.byte	0x4
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 .LVL778-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS437:
+	.uleb128 .LVU2725
+	.uleb128 .LVU2727
+.LLST437:
+	.byte	0x4
+	.uleb128 .LVL777-.Ltext0
+	.uleb128 .LVL778-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS438:
+	.uleb128 .LVU2730
+	.uleb128 .LVU2733
+.LLST438:
+	.byte	0x4
+	.uleb128 .LVL778-.Ltext0
+	.uleb128 .LVL779-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS439:
+	.uleb128 .LVU2736
+	.uleb128 .LVU2739
+.LLST439:
+	.byte	0x4
+	.uleb128 .LVL779-.Ltext0
+	.uleb128 .LVL780-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS440:
+	.uleb128 .LVU2742
+	.uleb128 .LVU2745
+.LLST440:
+	.byte	0x4
+	.uleb128 .LVL780-.Ltext0
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS441:
+	.uleb128 .LVU2748
+	.uleb128 .LVU2754
+.LLST441:
+	.byte	0x4
+	.uleb128 .LVL781-.Ltext0
+	.uleb128 .LVL782-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS442:
+	.uleb128 .LVU2756
+	.uleb128 .LVU2759
+.LLST442:
+	.byte	0x4
+	.uleb128 .LVL782-.Ltext0
+	.uleb128 .LVL783-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS443:
+	.uleb128 .LVU2762
+	.uleb128 .LVU2765
+.LLST443:
+	.byte	0x4
+	.uleb128 .LVL783-.Ltext0
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS444:
+	.uleb128 .LVU2768
+	.uleb128 .LVU2773
+.LLST444:
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS445:
+	.uleb128 .LVU2771
+	.uleb128 .LVU2773
+.LLST445:
+	.byte	0x4
+	.uleb128 .LVL784-.Ltext0
+	.uleb128 .LVL785-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS378:
+	.uleb128 .LVU2283
+	.uleb128 .LVU2303
+.LLST378:
+	.byte	0x4
+	.uleb128 .LVL675-.Ltext0
+	.uleb128 .LVL678-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 8
+	.byte	0x9f
+	.byte	0
+.LVUS379:
+	.uleb128 .LVU2292
+	.uleb128 .LVU2299
+.LLST379:
+	.byte	0x4
+	.uleb128 .LVL676-.Ltext0
+	.uleb128 .LVL677-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS420:
+	.uleb128 .LVU2607
+	.uleb128 .LVU2615
+.LLST420:
+	.byte	0x4
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS421:
+	.uleb128 .LVU2607
+	.uleb128 .LVU2615
+.LLST421:
+	.byte	0x4
+	.uleb128 .LVL753-.Ltext0
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS422:
+	.uleb128 .LVU2612
+	.uleb128 .LVU2615
+.LLST422:
+	.byte	0x4
+	.uleb128 .LVL754-.Ltext0
+	.uleb128 .LVL755-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS429:
+	.uleb128 .LVU2668
+	.uleb128 .LVU2677
+.LLST429:
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL768-.Ltext0
+	.uleb128 0x2
+	.byte	0x35
+	.byte	0x9f
+	.byte	0
+.LVUS430:
+	.uleb128 .LVU2668
+	.uleb128 .LVU2677
+.LLST430:
+	.byte	0x4
+	.uleb128 .LVL766-.Ltext0
+	.uleb128 .LVL768-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS431:
+	.uleb128 .LVU2674
+	.uleb128 .LVU2677
+.LLST431:
+	.byte	0x4
+	.uleb128 .LVL767-.Ltext0
+	.uleb128 .LVL768-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 0
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 .LFE598-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL96-1-.Ltext0
+	.uleb128 .LFE598-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU293
+	.uleb128 .LVU302
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU297
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU302
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0xc
+	.long	0xffffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS193:
+	.uleb128 0
+	.uleb128 .LVU1127
+	.uleb128 .LVU1127
+	.uleb128 .LVU1425
+	.uleb128 .LVU1425
+	.uleb128 .LVU1429
+	.uleb128 .LVU1429
+	.uleb128 0
+.LLST193:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL329-.Ltext0
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL415-.Ltext0
+	.uleb128 .LVL419-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL419-1-.Ltext0
+	.uleb128 .LFE591-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS194:
+	.uleb128 0
+	.uleb128 .LVU1129
+	.uleb128 .LVU1129
+	.uleb128 .LVU1212
+	.uleb128 .LVU1213
+	.uleb128 .LVU1215
+	.uleb128 .LVU1215
+	.uleb128 .LVU1223
+	.uleb128 .LVU1232
+	.uleb128 .LVU1248
+	.uleb128 .LVU1250
+	.uleb128 .LVU1261
+	.uleb128 .LVU1261
+	.uleb128 .LVU1262
+.LLST194:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL330-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL355-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL366-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL367-.Ltext0
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL372-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS195:
+	.uleb128 0
+	.uleb128 .LVU1130
+	.uleb128 .LVU1130
+	.uleb128 .LVU1134
+	.uleb128 .LVU1134
+	.uleb128 .LVU1135
+	.uleb128 .LVU1135
+	.uleb128 .LVU1138
+	.uleb128 .LVU1138
+	.uleb128 .LVU1204
+	.uleb128 .LVU1235
+	.uleb128 .LVU1240
+	.uleb128 .LVU1252
+	.uleb128 .LVU1262
+.LLST195:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL331-.Ltext0
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL332-.Ltext0
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL333-.Ltext0
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL335-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL373-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS196:
+	.uleb128 0
+	.uleb128 .LVU1137
+	.uleb128 .LVU1137
+	.uleb128 0
+.LLST196:
+	.byte	0x4
+	.uleb128 .LVL328-.Ltext0
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL334-.Ltext0
+	.uleb128 .LFE591-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS197:
+	.uleb128 .LVU1143
+	.uleb128 .LVU1152
+	.uleb128 .LVU1152
+	.uleb128 .LVU1155
+	.uleb128 .LVU1155
+	.uleb128 .LVU1156
+	.uleb128 .LVU1156
+	.uleb128 .LVU1159
+	.uleb128 .LVU1159
+	.uleb128 .LVU1160
+	.uleb128 .LVU1160
+	.uleb128 .LVU1163
+	.uleb128 .LVU1163
+	.uleb128 .LVU1165
+	.uleb128 .LVU1165
+	.uleb128 .LVU1428
+.LLST197:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL337-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL338-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL339-.Ltext0
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL340-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL418-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS198:
+	.uleb128 .LVU1144
+	.uleb128 .LVU1165
+	.uleb128 .LVU1165
+	.uleb128 .LVU1352
+	.uleb128 .LVU1379
+	.uleb128 .LVU1383
+.LLST198:
+	.byte	0x4
+	.uleb128 .LVL336-.Ltext0
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL402-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS199:
+	.uleb128 .LVU1166
+	.uleb128 .LVU1187
+	.uleb128 .LVU1187
+	.uleb128 .LVU1206
+	.uleb128 .LVU1206
+	.uleb128 .LVU1235
+.LLST199:
+	.byte	0x4
+	.uleb128 .LVL341-.Ltext0
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	digit2_std
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL346-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 0x25
+	.byte	0x3
+	.quad	digit2_std
+	.byte	0x3
+	.quad	digit2_b32
+	.byte	0x74
+	.sleb128 0
+	.byte	0x3a
+	.byte	0x25
+	.byte	0x37
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x20
+	.byte	0x24
+	.byte	0x40
+	.byte	0x4c
+	.byte	0x24
+	.byte	0x2e
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0
+.LVUS200:
+	.uleb128 .LVU1171
+	.uleb128 .LVU1182
+	.uleb128 .LVU1189
+	.uleb128 .LVU1291
+.LLST200:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL380-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS201:
+	.uleb128 .LVU1173
+	.uleb128 .LVU1181
+	.uleb128 .LVU1181
+	.uleb128 .LVU1182
+	.uleb128 .LVU1191
+	.uleb128 .LVU1199
+	.uleb128 .LVU1199
+	.uleb128 .LVU1200
+	.uleb128 .LVU1200
+	.uleb128 .LVU1204
+	.uleb128 .LVU1204
+	.uleb128 .LVU1206
+	.uleb128 .LVU1206
+	.uleb128 .LVU1265
+	.uleb128 .LVU1265
+	.uleb128 .LVU1267
+	.uleb128 .LVU1267
+	.uleb128 0
+.LLST201:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL352-.Ltext0
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL374-.Ltext0
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LFE591-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0
+.LVUS202:
+	.uleb128 .LVU1174
+	.uleb128 .LVU1181
+	.uleb128 .LVU1181
+	.uleb128 .LVU1182
+	.uleb128 .LVU1192
+	.uleb128 .LVU1199
+	.uleb128 .LVU1199
+	.uleb128 .LVU1200
+	.uleb128 .LVU1200
+	.uleb128 .LVU1204
+	.uleb128 .LVU1204
+	.uleb128 .LVU1211
+	.uleb128 .LVU1211
+	.uleb128 .LVU1214
+	.uleb128 .LVU1217
+	.uleb128 .LVU1224
+	.uleb128 .LVU1224
+	.uleb128 .LVU1231
+	.uleb128 .LVU1231
+	.uleb128 .LVU1232
+	.uleb128 .LVU1232
+	.uleb128 .LVU1234
+	.uleb128 .LVU1234
+	.uleb128 .LVU1235
+	.uleb128 .LVU1235
+	.uleb128 .LVU1242
+	.uleb128 .LVU1242
+	.uleb128 .LVU1252
+	.uleb128 .LVU1252
+	.uleb128 .LVU1254
+	.uleb128 .LVU1254
+	.uleb128 .LVU1257
+	.uleb128 .LVU1257
+	.uleb128 .LVU1258
+	.uleb128 .LVU1258
+	.uleb128 .LVU1426
+.LLST202:
+	.byte	0x4
+	.uleb128 .LVL342-.Ltext0
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL344-.Ltext0
+	.uleb128 .LVL345-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL347-.Ltext0
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL349-.Ltext0
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL350-.Ltext0
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL351-.Ltext0
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL353-.Ltext0
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL356-.Ltext0
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL359-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL361-.Ltext0
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL362-.Ltext0
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL364-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL369-.Ltext0
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL370-.Ltext0
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL371-.Ltext0
+	.uleb128 .LVL416-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS203:
+	.uleb128 .LVU1267
+	.uleb128 .LVU1273
+	.uleb128 .LVU1273
+	.uleb128 .LVU1275
+	.uleb128 .LVU1275
+	.uleb128 .LVU1276
+	.uleb128 .LVU1276
+	.uleb128 .LVU1279
+	.uleb128 .LVU1279
+	.uleb128 .LVU1296
+	.uleb128 .LVU1296
+	.uleb128 .LVU1298
+	.uleb128 .LVU1298
+	.uleb128 .LVU1302
+	.uleb128 .LVU1302
+	.uleb128 .LVU1304
+	.uleb128 .LVU1304
+	.uleb128 .LVU1308
+	.uleb128 .LVU1308
+	.uleb128 .LVU1310
+	.uleb128 .LVU1310
+	.uleb128 .LVU1312
+	.uleb128 .LVU1312
+	.uleb128 .LVU1314
+.LLST203:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 0xe
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL377-.Ltext0
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 0x19
+	.byte	0x78
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL378-.Ltext0
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL381-.Ltext0
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL382-.Ltext0
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL383-.Ltext0
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL384-.Ltext0
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL385-.Ltext0
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL386-.Ltext0
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL387-.Ltext0
+	.uleb128 .LVL388-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS204:
+	.uleb128 .LVU1268
+	.uleb128 .LVU1427
+.LLST204:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL417-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS209:
+	.uleb128 .LVU1212
+	.uleb128 .LVU1218
+.LLST209:
+	.byte	0x4
+	.uleb128 .LVL354-.Ltext0
+	.uleb128 .LVL357-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x9f
+	.byte	0
+.LVUS210:
+	.uleb128 .LVU1223
+	.uleb128 .LVU1232
+.LLST210:
+	.byte	0x4
+	.uleb128 .LVL358-.Ltext0
+	.uleb128 .LVL360-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS212:
+	.uleb128 .LVU1240
+	.uleb128 .LVU1252
+.LLST212:
+	.byte	0x4
+	.uleb128 .LVL363-.Ltext0
+	.uleb128 .LVL368-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS206:
+	.uleb128 .LVU1176
+	.uleb128 .LVU1178
+	.uleb128 .LVU1194
+	.uleb128 .LVU1196
+.LLST206:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS207:
+	.uleb128 .LVU1176
+	.uleb128 .LVU1178
+	.uleb128 .LVU1194
+	.uleb128 .LVU1196
+.LLST207:
+	.byte	0x4
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 .LVL343-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 .LVL348-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS214:
+	.uleb128 .LVU1269
+	.uleb128 .LVU1272
+.LLST214:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS215:
+	.uleb128 .LVU1269
+	.uleb128 .LVU1272
+.LLST215:
+	.byte	0x4
+	.uleb128 .LVL375-.Ltext0
+	.uleb128 .LVL376-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS217:
+	.uleb128 .LVU1316
+	.uleb128 .LVU1420
+.LLST217:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS218:
+	.uleb128 .LVU1316
+	.uleb128 .LVU1420
+.LLST218:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS219:
+	.uleb128 .LVU1316
+	.uleb128 .LVU1420
+.LLST219:
+	.byte	0x4
+	.uleb128 .LVL389-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS220:
+	.uleb128 .LVU1333
+	.uleb128 .LVU1344
+.LLST220:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS221:
+	.uleb128 .LVU1333
+	.uleb128 .LVU1344
+.LLST221:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL393-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS222:
+	.uleb128 .LVU1335
+	.uleb128 .LVU1337
+.LLST222:
+	.byte	0x4
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 .LVL391-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS224:
+	.uleb128 .LVU1352
+	.uleb128 .LVU1358
+	.uleb128 .LVU1365
+	.uleb128 .LVU1371
+.LLST224:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS225:
+	.uleb128 .LVU1352
+	.uleb128 .LVU1358
+	.uleb128 .LVU1365
+	.uleb128 .LVU1371
+.LLST225:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL395-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS227:
+	.uleb128 .LVU1354
+	.uleb128 .LVU1356
+.LLST227:
+	.byte	0x4
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 .LVL394-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS229:
+	.uleb128 .LVU1361
+	.uleb128 .LVU1365
+	.uleb128 .LVU1371
+	.uleb128 .LVU1373
+	.uleb128 .LVU1373
+	.uleb128 .LVU1375
+	.uleb128 .LVU1375
+	.uleb128 .LVU1378
+.LLST229:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL400-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x31
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS231:
+	.uleb128 .LVU1363
+	.uleb128 .LVU1365
+	.uleb128 .LVU1371
+	.uleb128 .LVU1378
+.LLST231:
+	.byte	0x4
+	.uleb128 .LVL396-.Ltext0
+	.uleb128 .LVL397-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL399-.Ltext0
+	.uleb128 .LVL401-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS233:
+	.uleb128 .LVU1383
+	.uleb128 .LVU1389
+	.uleb128 .LVU1396
+	.uleb128 .LVU1402
+.LLST233:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS234:
+	.uleb128 .LVU1383
+	.uleb128 .LVU1389
+	.uleb128 .LVU1396
+	.uleb128 .LVU1402
+.LLST234:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL404-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS236:
+	.uleb128 .LVU1385
+	.uleb128 .LVU1387
+.LLST236:
+	.byte	0x4
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 .LVL403-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS238:
+	.uleb128 .LVU1392
+	.uleb128 .LVU1396
+	.uleb128 .LVU1402
+	.uleb128 .LVU1404
+	.uleb128 .LVU1404
+	.uleb128 .LVU1406
+	.uleb128 .LVU1406
+	.uleb128 .LVU1409
+.LLST238:
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL409-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0xa
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0
+.LVUS240:
+	.uleb128 .LVU1394
+	.uleb128 .LVU1396
+	.uleb128 .LVU1402
+	.uleb128 .LVU1409
+.LLST240:
+	.byte	0x4
+	.uleb128 .LVL405-.Ltext0
+	.uleb128 .LVL406-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL408-.Ltext0
+	.uleb128 .LVL410-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS241:
+	.uleb128 .LVU1412
+	.uleb128 .LVU1417
+	.uleb128 .LVU1417
+	.uleb128 .LVU1419
+	.uleb128 .LVU1419
+	.uleb128 .LVU1420
+.LLST241:
+	.byte	0x4
+	.uleb128 .LVL411-.Ltext0
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL412-.Ltext0
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL413-.Ltext0
+	.uleb128 .LVL414-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS523:
+	.uleb128 0
+	.uleb128 .LVU3383
+	.uleb128 .LVU3383
+	.uleb128 .LVU3548
+	.uleb128 .LVU3548
+	.uleb128 0
+.LLST523:
+	.byte	0x4
+	.uleb128 .LVL936-.Ltext0
+	.uleb128 .LVL937-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL937-.Ltext0
+	.uleb128 .LVL968-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL968-.Ltext0
+	.uleb128 .LFE589-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS524:
+	.uleb128 0
+	.uleb128 .LVU3403
+	.uleb128 .LVU3403
+	.uleb128 .LVU3549
+	.uleb128 .LVU3549
+	.uleb128 0
+.LLST524:
+	.byte	0x4
+	.uleb128 .LVL936-.Ltext0
+	.uleb128 .LVL939-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL939-.Ltext0
+	.uleb128 .LVL969-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL969-.Ltext0
+	.uleb128 .LFE589-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS525:
+	.uleb128 .LVU3407
+	.uleb128 .LVU3437
+	.uleb128 .LVU3437
+	.uleb128 .LVU3438
+	.uleb128 .LVU3438
+	.uleb128 .LVU3442
+	.uleb128 .LVU3442
+	.uleb128 .LVU3453
+	.uleb128 .LVU3453
+	.uleb128 .LVU3545
+.LLST525:
+	.byte	0x4
+	.uleb128 .LVL940-.Ltext0
+	.uleb128 .LVL942-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL942-.Ltext0
+	.uleb128 .LVL943-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL943-.Ltext0
+	.uleb128 .LVL945-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL945-.Ltext0
+	.uleb128 .LVL946-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL946-.Ltext0
+	.uleb128 .LVL965-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS526:
+	.uleb128 .LVU3459
+	.uleb128 .LVU3525
+	.uleb128 .LVU3525
+	.uleb128 .LVU3536
+.LLST526:
+	.byte	0x4
+	.uleb128 .LVL947-.Ltext0
+	.uleb128 .LVL957-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL957-.Ltext0
+	.uleb128 .LVL962-.Ltext0
+	.uleb128 0x1a
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x11
+	.sleb128 -9223372036854775744
+	.byte	0x2c
+	.byte	0x9f
+	.byte	0
+.LVUS528:
+	.uleb128 .LVU3476
+	.uleb128 .LVU3493
+.LLST528:
+	.byte	0x4
+	.uleb128 .LVL949-.Ltext0
+	.uleb128 .LVL951-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS529:
+	.uleb128 .LVU3476
+	.uleb128 .LVU3479
+	.uleb128 .LVU3479
+	.uleb128 .LVU3493
+.LLST529:
+	.byte	0x4
+	.uleb128 .LVL949-.Ltext0
+	.uleb128 .LVL950-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL950-.Ltext0
+	.uleb128 .LVL951-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS531:
+	.uleb128 .LVU3502
+	.uleb128 .LVU3525
+.LLST531:
+	.byte	0x4
+	.uleb128 .LVL954-.Ltext0
+	.uleb128 .LVL957-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS532:
+	.uleb128 .LVU3502
+	.uleb128 .LVU3525
+.LLST532:
+	.byte	0x4
+	.uleb128 .LVL954-.Ltext0
+	.uleb128 .LVL957-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS533:
+	.uleb128 .LVU3504
+	.uleb128 .LVU3515
+.LLST533:
+	.byte	0x4
+	.uleb128 .LVL954-.Ltext0
+	.uleb128 .LVL955-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 32
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS535:
+	.uleb128 .LVU3507
+	.uleb128 .LVU3536
+.LLST535:
+	.byte	0x4
+	.uleb128 .LVL954-.Ltext0
+	.uleb128 .LVL962-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS536:
+	.uleb128 .LVU3508
+	.uleb128 .LVU3536
+.LLST536:
+	.byte	0x4
+	.uleb128 .LVL954-.Ltext0
+	.uleb128 .LVL962-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS538:
+	.uleb128 .LVU3530
+	.uleb128 .LVU3533
+	.uleb128 .LVU3533
+	.uleb128 .LVU3535
+	.uleb128 .LVU3535
+	.uleb128 .LVU3536
+.LLST538:
+	.byte	0x4
+	.uleb128 .LVL959-.Ltext0
+	.uleb128 .LVL960-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL960-.Ltext0
+	.uleb128 .LVL961-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL961-.Ltext0
+	.uleb128 .LVL962-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS296:
+	.uleb128 0
+	.uleb128 .LVU1836
+	.uleb128 .LVU1836
+	.uleb128 0
+.LLST296:
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LFE588-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS297:
+	.uleb128 0
+	.uleb128 .LVU1835
+	.uleb128 .LVU1835
+	.uleb128 .LVU1837
+	.uleb128 .LVU1837
+	.uleb128 0
+.LLST297:
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL551-.Ltext0
+	.uleb128 .LVL553-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL553-1-.Ltext0
+	.uleb128 .LFE588-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS298:
+	.uleb128 .LVU1832
+	.uleb128 .LVU1836
+	.uleb128 .LVU1836
+	.uleb128 0
+.LLST298:
+	.byte	0x4
+	.uleb128 .LVL550-.Ltext0
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL552-.Ltext0
+	.uleb128 .LFE588-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS170:
+	.uleb128 0
+	.uleb128 .LVU950
+	.uleb128 .LVU950
+	.uleb128 .LVU955
+	.uleb128 .LVU955
+	.uleb128 0
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LFE587-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS171:
+	.uleb128 0
+	.uleb128 .LVU949
+	.uleb128 .LVU949
+	.uleb128 .LVU951
+	.uleb128 .LVU951
+	.uleb128 0
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL274-.Ltext0
+	.uleb128 .LVL276-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL276-1-.Ltext0
+	.uleb128 .LFE587-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS172:
+	.uleb128 .LVU945
+	.uleb128 .LVU950
+	.uleb128 .LVU950
+	.uleb128 .LVU955
+	.uleb128 .LVU955
+	.uleb128 0
+.LLST172:
+	.byte	0x4
+	.uleb128 .LVL273-.Ltext0
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL275-.Ltext0
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL277-.Ltext0
+	.uleb128 .LFE587-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS299:
+	.uleb128 0
+	.uleb128 .LVU1852
+	.uleb128 .LVU1852
+	.uleb128 .LVU1853
+	.uleb128 .LVU1853
+	.uleb128 .LVU1856
+	.uleb128 .LVU1856
+	.uleb128 .LVU1856
+	.uleb128 .LVU1856
+	.uleb128 .LVU2261
+	.uleb128 .LVU2261
+	.uleb128 0
+.LLST299:
+	.byte	0x4
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 .LVL558-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL558-.Ltext0
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL559-.Ltext0
+	.uleb128 .LVL561-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL561-1-.Ltext0
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL665-.Ltext0
+	.uleb128 .LFE585-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS300:
+	.uleb128 0
+	.uleb128 .LVU1848
+	.uleb128 .LVU1848
+	.uleb128 .LVU1849
+	.uleb128 .LVU1849
+	.uleb128 .LVU1850
+	.uleb128 .LVU1850
+	.uleb128 .LVU1854
+	.uleb128 .LVU1854
+	.uleb128 .LVU1856
+	.uleb128 .LVU1856
+	.uleb128 .LVU2262
+	.uleb128 .LVU2262
+	.uleb128 0
+.LLST300:
+	.byte	0x4
+	.uleb128 .LVL554-.Ltext0
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL555-.Ltext0
+	.uleb128 .LVL556-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL556-.Ltext0
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL557-.Ltext0
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL560-.Ltext0
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL666-.Ltext0
+	.uleb128 .LFE585-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS301:
+	.uleb128 .LVU1857
+	.uleb128 .LVU2213
+	.uleb128 .LVU2220
+	.uleb128 .LVU2231
+.LLST301:
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS302:
+	.uleb128 .LVU1858
+	.uleb128 .LVU1865
+	.uleb128 .LVU1865
+	.uleb128 0
+.LLST302:
+	.byte	0x4
+	.uleb128 .LVL561-.Ltext0
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL563-.Ltext0
+	.uleb128 .LFE585-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS303:
+	.uleb128 .LVU1867
+	.uleb128 .LVU1871
+	.uleb128 .LVU1871
+	.uleb128 .LVU2250
+	.uleb128 .LVU2250
+	.uleb128 .LVU2251
+	.uleb128 .LVU2251
+	.uleb128 .LVU2253
+	.uleb128 .LVU2253
+	.uleb128 .LVU2254
+	.uleb128 .LVU2254
+	.uleb128 .LVU2263
+.LLST303:
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL566-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL566-.Ltext0
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL659-.Ltext0
+	.uleb128 .LVL660-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL660-1-.Ltext0
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 .LVL662-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL662-1-.Ltext0
+	.uleb128 .LVL667-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS304:
+	.uleb128 .LVU1979
+	.uleb128 .LVU1982
+	.uleb128 .LVU1983
+	.uleb128 .LVU1988
+	.uleb128 .LVU1988
+	.uleb128 .LVU1990
+	.uleb128 .LVU2125
+	.uleb128 .LVU2127
+	.uleb128 .LVU2170
+	.uleb128 .LVU2172
+	.uleb128 .LVU2179
+	.uleb128 .LVU2180
+	.uleb128 .LVU2249
+	.uleb128 .LVU2251
+	.uleb128 .LVU2253
+	.uleb128 .LVU2254
+.LLST304:
+	.byte	0x4
+	.uleb128 .LVL590-.Ltext0
+	.uleb128 .LVL591-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL592-.Ltext0
+	.uleb128 .LVL593-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL593-.Ltext0
+	.uleb128 .LVL594-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL621-.Ltext0
+	.uleb128 .LVL622-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL632-.Ltext0
+	.uleb128 .LVL633-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL636-.Ltext0
+	.uleb128 .LVL637-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL658-.Ltext0
+	.uleb128 .LVL660-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL661-.Ltext0
+	.uleb128 .LVL662-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS305:
+	.uleb128 .LVU1869
+	.uleb128 .LVU1998
+	.uleb128 .LVU1998
+	.uleb128 .LVU2022
+	.uleb128 .LVU2025
+	.uleb128 .LVU2027
+	.uleb128 .LVU2027
+	.uleb128 0
+.LLST305:
+	.byte	0x4
+	.uleb128 .LVL565-.Ltext0
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL596-.Ltext0
+	.uleb128 .LVL599-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL600-.Ltext0
+	.uleb128 .LVL601-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL601-.Ltext0
+	.uleb128 .LFE585-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.byte	0
+.LVUS306:
+	.uleb128 .LVU2029
+	.uleb128 .LVU2036
+	.uleb128 .LVU2043
+	.uleb128 .LVU2045
+.LLST306:
+	.byte	0x4
+	.uleb128 .LVL602-.Ltext0
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS307:
+	.uleb128 .LVU2032
+	.uleb128 .LVU2036
+	.uleb128 .LVU2043
+	.uleb128 .LVU2045
+.LLST307:
+	.byte	0x4
+	.uleb128 .LVL603-.Ltext0
+	.uleb128 .LVL604-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 .LVL607-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS308:
+	.uleb128 .LVU2040
+	.uleb128 .LVU2041
+.LLST308:
+	.byte	0x4
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS309:
+	.uleb128 .LVU2041
+	.uleb128 .LVU2043
+	.uleb128 .LVU2047
+	.uleb128 .LVU2053
+.LLST309:
+	.byte	0x4
+	.uleb128 .LVL605-.Ltext0
+	.uleb128 .LVL606-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL608-.Ltext0
+	.uleb128 .LVL609-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS310:
+	.uleb128 .LVU2057
+	.uleb128 0
+.LLST310:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LFE585-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -428
+	.byte	0
+.LVUS311:
+	.uleb128 .LVU2059
+	.uleb128 .LVU2205
+	.uleb128 .LVU2206
+	.uleb128 .LVU2208
+	.uleb128 .LVU2208
+	.uleb128 .LVU2220
+	.uleb128 .LVU2220
+	.uleb128 .LVU2231
+.LLST311:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL643-.Ltext0
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL644-.Ltext0
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -408
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS312:
+	.uleb128 .LVU2060
+	.uleb128 .LVU2173
+	.uleb128 .LVU2173
+	.uleb128 .LVU2176
+	.uleb128 .LVU2176
+	.uleb128 .LVU2181
+.LLST312:
+	.byte	0x4
+	.uleb128 .LVL610-.Ltext0
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL633-.Ltext0
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL634-.Ltext0
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS314:
+	.uleb128 .LVU1915
+	.uleb128 .LVU1993
+.LLST314:
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS316:
+	.uleb128 .LVU1881
+	.uleb128 .LVU1885
+	.uleb128 .LVU1888
+	.uleb128 .LVU1900
+	.uleb128 .LVU1902
+	.uleb128 .LVU1910
+.LLST316:
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL570-.Ltext0
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS317:
+	.uleb128 .LVU1881
+	.uleb128 .LVU1885
+	.uleb128 .LVU1888
+	.uleb128 .LVU1900
+	.uleb128 .LVU1902
+	.uleb128 .LVU1910
+.LLST317:
+	.byte	0x4
+	.uleb128 .LVL567-.Ltext0
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL568-.Ltext0
+	.uleb128 .LVL569-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL570-.Ltext0
+	.uleb128 .LVL571-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0
+.LVUS319:
+	.uleb128 .LVU1916
+	.uleb128 .LVU1929
+.LLST319:
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS320:
+	.uleb128 .LVU1916
+	.uleb128 .LVU1929
+.LLST320:
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS321:
+	.uleb128 .LVU1916
+	.uleb128 .LVU1929
+.LLST321:
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL573-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS323:
+	.uleb128 .LVU1919
+	.uleb128 .LVU1993
+.LLST323:
+	.byte	0x4
+	.uleb128 .LVL572-.Ltext0
+	.uleb128 .LVL595-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS325:
+	.uleb128 .LVU1933
+	.uleb128 .LVU1948
+	.uleb128 .LVU1948
+	.uleb128 .LVU1949
+	.uleb128 .LVU1949
+	.uleb128 .LVU1952
+	.uleb128 .LVU1952
+	.uleb128 .LVU1954
+	.uleb128 .LVU1954
+	.uleb128 .LVU1956
+	.uleb128 .LVU1956
+	.uleb128 .LVU1957
+	.uleb128 .LVU1957
+	.uleb128 .LVU1976
+.LLST325:
+	.byte	0x4
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL578-.Ltext0
+	.uleb128 .LVL579-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL579-1-.Ltext0
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL581-.Ltext0
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL584-.Ltext0
+	.uleb128 .LVL585-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL585-1-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0
+.LVUS326:
+	.uleb128 .LVU1933
+	.uleb128 .LVU1976
+.LLST326:
+	.byte	0x4
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS327:
+	.uleb128 .LVU1933
+	.uleb128 .LVU1976
+.LLST327:
+	.byte	0x4
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS328:
+	.uleb128 .LVU1933
+	.uleb128 .LVU1976
+.LLST328:
+	.byte	0x4
+	.uleb128 .LVL574-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS330:
+	.uleb128 .LVU1941
+	.uleb128 .LVU1944
+	.uleb128 .LVU1944
+	.uleb128 .LVU1965
+	.uleb128 .LVU1965
+	.uleb128 .LVU1976
+.LLST330:
+	.byte	0x4
+	.uleb128 .LVL576-.Ltext0
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL577-.Ltext0
+	.uleb128 .LVL586-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL586-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 1
+	.byte	0x9f
+	.byte	0
+.LVUS331:
+	.uleb128 .LVU1949
+	.uleb128 .LVU1950
+	.uleb128 .LVU1953
+	.uleb128 .LVU1954
+	.uleb128 .LVU1957
+	.uleb128 .LVU1976
+.LLST331:
+	.byte	0x4
+	.uleb128 .LVL579-.Ltext0
+	.uleb128 .LVL580-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL582-.Ltext0
+	.uleb128 .LVL583-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL585-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS332:
+	.uleb128 .LVU1972
+	.uleb128 .LVU1976
+.LLST332:
+	.byte	0x4
+	.uleb128 .LVL587-.Ltext0
+	.uleb128 .LVL588-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS334:
+	.uleb128 .LVU2080
+	.uleb128 .LVU2091
+.LLST334:
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL612-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 32
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS346:
+	.uleb128 .LVU2117
+	.uleb128 .LVU2122
+	.uleb128 .LVU2128
+	.uleb128 .LVU2130
+.LLST346:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS347:
+	.uleb128 .LVU2118
+	.uleb128 .LVU2122
+	.uleb128 .LVU2128
+	.uleb128 .LVU2130
+.LLST347:
+	.byte	0x4
+	.uleb128 .LVL618-.Ltext0
+	.uleb128 .LVL619-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL623-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS335:
+	.uleb128 .LVU2082
+	.uleb128 .LVU2096
+.LLST335:
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS336:
+	.uleb128 .LVU2082
+	.uleb128 .LVU2096
+.LLST336:
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS337:
+	.uleb128 .LVU2082
+	.uleb128 .LVU2096
+.LLST337:
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL613-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS339:
+	.uleb128 .LVU2085
+	.uleb128 .LVU2130
+.LLST339:
+	.byte	0x4
+	.uleb128 .LVL611-.Ltext0
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS341:
+	.uleb128 .LVU2101
+	.uleb128 .LVU2111
+.LLST341:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -448
+	.byte	0
+.LVUS342:
+	.uleb128 .LVU2101
+	.uleb128 .LVU2111
+.LLST342:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS343:
+	.uleb128 .LVU2101
+	.uleb128 .LVU2111
+.LLST343:
+	.byte	0x4
+	.uleb128 .LVL614-.Ltext0
+	.uleb128 .LVL617-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS344:
+	.uleb128 .LVU2110
+	.uleb128 .LVU2111
+.LLST344:
+	.byte	0x4
+	.uleb128 .LVL616-.Ltext0
+	.uleb128 .LVL617-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS349:
+	.uleb128 .LVU2132
+	.uleb128 .LVU2152
+.LLST349:
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS350:
+	.uleb128 .LVU2132
+	.uleb128 .LVU2135
+	.uleb128 .LVU2135
+	.uleb128 .LVU2138
+	.uleb128 .LVU2138
+	.uleb128 .LVU2152
+.LLST350:
+	.byte	0x4
+	.uleb128 .LVL625-.Ltext0
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL626-.Ltext0
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL627-.Ltext0
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0
+.LVUS352:
+	.uleb128 .LVU2154
+	.uleb128 .LVU2163
+.LLST352:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS353:
+	.uleb128 .LVU2154
+	.uleb128 .LVU2163
+.LLST353:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS354:
+	.uleb128 .LVU2154
+	.uleb128 .LVU2162
+	.uleb128 .LVU2162
+	.uleb128 .LVU2163
+.LLST354:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -392
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL629-.Ltext0
+	.uleb128 .LVL630-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS356:
+	.uleb128 .LVU2157
+	.uleb128 .LVU2205
+.LLST356:
+	.byte	0x4
+	.uleb128 .LVL628-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -360
+	.byte	0x9f
+	.byte	0
+.LVUS357:
+	.uleb128 .LVU2182
+	.uleb128 .LVU2205
+.LLST357:
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS358:
+	.uleb128 .LVU2182
+	.uleb128 .LVU2205
+.LLST358:
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -408
+	.byte	0
+.LVUS359:
+	.uleb128 .LVU2184
+	.uleb128 .LVU2194
+.LLST359:
+	.byte	0x4
+	.uleb128 .LVL638-.Ltext0
+	.uleb128 .LVL640-.Ltext0
+	.uleb128 0x8
+	.byte	0x73
+	.sleb128 32
+	.byte	0x94
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS360:
+	.uleb128 .LVU2188
+	.uleb128 .LVU2205
+.LLST360:
+	.byte	0x4
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS361:
+	.uleb128 .LVU2189
+	.uleb128 .LVU2205
+.LLST361:
+	.byte	0x4
+	.uleb128 .LVL639-.Ltext0
+	.uleb128 .LVL642-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9f
+	.byte	0
+.LVUS362:
+	.uleb128 .LVU2213
+	.uleb128 .LVU2215
+	.uleb128 .LVU2215
+	.uleb128 .LVU2216
+	.uleb128 .LVU2216
+	.uleb128 .LVU2217
+.LLST362:
+	.byte	0x4
+	.uleb128 .LVL647-.Ltext0
+	.uleb128 .LVL648-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL648-1-.Ltext0
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x4
+	.uleb128 .LVL649-.Ltext0
+	.uleb128 .LVL650-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS363:
+	.uleb128 .LVU2221
+	.uleb128 .LVU2231
+.LLST363:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS364:
+	.uleb128 .LVU2221
+	.uleb128 .LVU2231
+.LLST364:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS365:
+	.uleb128 .LVU2221
+	.uleb128 .LVU2231
+.LLST365:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS367:
+	.uleb128 .LVU2224
+	.uleb128 .LVU2231
+.LLST367:
+	.byte	0x4
+	.uleb128 .LVL651-.Ltext0
+	.uleb128 .LVL652-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS270:
+	.uleb128 0
+	.uleb128 .LVU1620
+	.uleb128 .LVU1620
+	.uleb128 .LVU1827
+	.uleb128 .LVU1827
+	.uleb128 0
+.LLST270:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL487-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 .LFE584-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS271:
+	.uleb128 0
+	.uleb128 .LVU1619
+	.uleb128 .LVU1619
+	.uleb128 .LVU1827
+	.uleb128 .LVU1827
+	.uleb128 0
+.LLST271:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL486-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 .LFE584-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS272:
+	.uleb128 0
+	.uleb128 .LVU1617
+	.uleb128 .LVU1617
+	.uleb128 .LVU1829
+	.uleb128 .LVU1829
+	.uleb128 0
+.LLST272:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL485-.Ltext0
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL549-.Ltext0
+	.uleb128 .LFE584-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS273:
+	.uleb128 0
+	.uleb128 .LVU1621
+	.uleb128 .LVU1621
+	.uleb128 .LVU1622
+	.uleb128 .LVU1622
+	.uleb128 0
+.LLST273:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL488-.Ltext0
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 .LFE584-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS274:
+	.uleb128 0
+	.uleb128 .LVU1622
+	.uleb128 .LVU1622
+	.uleb128 0
+.LLST274:
+	.byte	0x4
+	.uleb128 .LVL484-.Ltext0
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL489-1-.Ltext0
+	.uleb128 .LFE584-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x9f
+	.byte	0
+.LVUS275:
+	.uleb128 .LVU1623
+	.uleb128 .LVU1628
+	.uleb128 .LVU1628
+	.uleb128 .LVU1752
+	.uleb128 .LVU1757
+	.uleb128 .LVU1827
+.LLST275:
+	.byte	0x4
+	.uleb128 .LVL490-.Ltext0
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL491-.Ltext0
+	.uleb128 .LVL521-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS276:
+	.uleb128 .LVU1630
+	.uleb128 .LVU1827
+.LLST276:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS277:
+	.uleb128 .LVU1678
+	.uleb128 .LVU1685
+	.uleb128 .LVU1763
+	.uleb128 .LVU1768
+	.uleb128 .LVU1813
+	.uleb128 .LVU1819
+.LLST277:
+	.byte	0x4
+	.uleb128 .LVL498-.Ltext0
+	.uleb128 .LVL501-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL524-.Ltext0
+	.uleb128 .LVL526-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL542-.Ltext0
+	.uleb128 .LVL544-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS282:
+	.uleb128 .LVU1664
+	.uleb128 .LVU1671
+	.uleb128 .LVU1671
+	.uleb128 .LVU1683
+	.uleb128 .LVU1683
+	.uleb128 .LVU1684
+	.uleb128 .LVU1684
+	.uleb128 .LVU1685
+	.uleb128 .LVU1686
+	.uleb128 .LVU1722
+	.uleb128 .LVU1722
+	.uleb128 .LVU1726
+	.uleb128 .LVU1726
+	.uleb128 .LVU1736
+.LLST282:
+	.byte	0x4
+	.uleb128 .LVL494-.Ltext0
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL497-.Ltext0
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL499-.Ltext0
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL500-.Ltext0
+	.uleb128 .LVL501-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL501-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS283:
+	.uleb128 .LVU1668
+	.uleb128 .LVU1670
+	.uleb128 .LVU1670
+	.uleb128 .LVU1736
+.LLST283:
+	.byte	0x4
+	.uleb128 .LVL495-.Ltext0
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL496-.Ltext0
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS284:
+	.uleb128 .LVU1688
+	.uleb128 .LVU1734
+.LLST284:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+20654
+	.sleb128 0
+	.byte	0
+.LVUS285:
+	.uleb128 .LVU1690
+	.uleb128 .LVU1696
+	.uleb128 .LVU1696
+	.uleb128 .LVU1698
+	.uleb128 .LVU1698
+	.uleb128 .LVU1705
+	.uleb128 .LVU1705
+	.uleb128 .LVU1708
+	.uleb128 .LVU1708
+	.uleb128 .LVU1716
+	.uleb128 .LVU1716
+	.uleb128 .LVU1721
+	.uleb128 .LVU1721
+	.uleb128 .LVU1726
+	.uleb128 .LVU1726
+	.uleb128 .LVU1734
+.LLST285:
+	.byte	0x4
+	.uleb128 .LVL502-.Ltext0
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL504-.Ltext0
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL505-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS286:
+	.uleb128 .LVU1692
+	.uleb128 .LVU1703
+	.uleb128 .LVU1703
+	.uleb128 .LVU1705
+	.uleb128 .LVU1705
+	.uleb128 .LVU1708
+	.uleb128 .LVU1708
+	.uleb128 .LVU1713
+	.uleb128 .LVU1713
+	.uleb128 .LVU1716
+	.uleb128 .LVU1716
+	.uleb128 .LVU1721
+	.uleb128 .LVU1721
+	.uleb128 .LVU1724
+	.uleb128 .LVU1724
+	.uleb128 .LVU1726
+	.uleb128 .LVU1726
+	.uleb128 .LVU1734
+.LLST286:
+	.byte	0x4
+	.uleb128 .LVL503-.Ltext0
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL506-.Ltext0
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL507-.Ltext0
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 -2
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL508-.Ltext0
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL509-.Ltext0
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL510-.Ltext0
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 -3
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL511-.Ltext0
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL512-.Ltext0
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL513-.Ltext0
+	.uleb128 .LVL514-.Ltext0
+	.uleb128 0x8
+	.byte	0x7f
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS288:
+	.uleb128 .LVU1738
+	.uleb128 .LVU1746
+	.uleb128 .LVU1746
+	.uleb128 .LVU1747
+	.uleb128 .LVU1757
+	.uleb128 .LVU1764
+	.uleb128 .LVU1764
+	.uleb128 .LVU1769
+	.uleb128 .LVU1769
+	.uleb128 .LVU1771
+	.uleb128 .LVU1771
+	.uleb128 .LVU1772
+	.uleb128 .LVU1773
+	.uleb128 .LVU1787
+	.uleb128 .LVU1787
+	.uleb128 .LVU1791
+	.uleb128 .LVU1791
+	.uleb128 .LVU1797
+.LLST288:
+	.byte	0x4
+	.uleb128 .LVL516-.Ltext0
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL519-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL525-.Ltext0
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL527-.Ltext0
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL528-.Ltext0
+	.uleb128 .LVL529-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL529-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS289:
+	.uleb128 .LVU1743
+	.uleb128 .LVU1745
+	.uleb128 .LVU1745
+	.uleb128 .LVU1747
+	.uleb128 .LVU1757
+	.uleb128 .LVU1797
+.LLST289:
+	.byte	0x4
+	.uleb128 .LVL517-.Ltext0
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL518-.Ltext0
+	.uleb128 .LVL520-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0x4
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS290:
+	.uleb128 .LVU1775
+	.uleb128 .LVU1795
+.LLST290:
+	.byte	0x4
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+20884
+	.sleb128 0
+	.byte	0
+.LVUS291:
+	.uleb128 .LVU1777
+	.uleb128 .LVU1784
+	.uleb128 .LVU1784
+	.uleb128 .LVU1786
+	.uleb128 .LVU1786
+	.uleb128 .LVU1791
+	.uleb128 .LVU1791
+	.uleb128 .LVU1795
+.LLST291:
+	.byte	0x4
+	.uleb128 .LVL530-.Ltext0
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL532-.Ltext0
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL533-.Ltext0
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x3
+	.byte	0x7f
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS292:
+	.uleb128 .LVU1779
+	.uleb128 .LVU1790
+	.uleb128 .LVU1790
+	.uleb128 .LVU1791
+	.uleb128 .LVU1791
+	.uleb128 .LVU1795
+.LLST292:
+	.byte	0x4
+	.uleb128 .LVL531-.Ltext0
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL534-.Ltext0
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 0
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL535-.Ltext0
+	.uleb128 .LVL536-.Ltext0
+	.uleb128 0x9
+	.byte	0x7f
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS294:
+	.uleb128 .LVU1799
+	.uleb128 .LVU1806
+	.uleb128 .LVU1806
+	.uleb128 .LVU1818
+	.uleb128 .LVU1818
+	.uleb128 .LVU1819
+	.uleb128 .LVU1820
+	.uleb128 .LVU1825
+	.uleb128 .LVU1825
+	.uleb128 .LVU1826
+	.uleb128 .LVU1826
+	.uleb128 .LVU1827
+.LLST294:
+	.byte	0x4
+	.uleb128 .LVL538-.Ltext0
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0x4
+	.uleb128 .LVL541-.Ltext0
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL543-.Ltext0
+	.uleb128 .LVL544-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL544-.Ltext0
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL546-.Ltext0
+	.uleb128 .LVL547-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL547-1-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+.LVUS295:
+	.uleb128 .LVU1803
+	.uleb128 .LVU1805
+	.uleb128 .LVU1805
+	.uleb128 .LVU1827
+.LLST295:
+	.byte	0x4
+	.uleb128 .LVL539-.Ltext0
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL540-.Ltext0
+	.uleb128 .LVL548-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+.LVUS293:
+	.uleb128 .LVU1755
+	.uleb128 .LVU1757
+.LLST293:
+	.byte	0x4
+	.uleb128 .LVL522-.Ltext0
+	.uleb128 .LVL523-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS279:
+	.uleb128 .LVU1632
+	.uleb128 .LVU1658
+.LLST279:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS280:
+	.uleb128 .LVU1632
+	.uleb128 .LVU1658
+.LLST280:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS281:
+	.uleb128 .LVU1632
+	.uleb128 .LVU1658
+.LLST281:
+	.byte	0x4
+	.uleb128 .LVL492-.Ltext0
+	.uleb128 .LVL493-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -80
+	.byte	0x9f
+	.byte	0
+.LVUS246:
+	.uleb128 0
+	.uleb128 .LVU1456
+	.uleb128 .LVU1456
+	.uleb128 .LVU1457
+	.uleb128 .LVU1457
+	.uleb128 .LVU1461
+	.uleb128 .LVU1461
+	.uleb128 .LVU1462
+	.uleb128 .LVU1462
+	.uleb128 .LVU1465
+	.uleb128 .LVU1465
+	.uleb128 .LVU1562
+	.uleb128 .LVU1562
+	.uleb128 0
+.LLST246:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL428-.Ltext0
+	.uleb128 .LVL429-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL429-1-.Ltext0
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL430-.Ltext0
+	.uleb128 .LVL431-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL431-1-.Ltext0
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL463-.Ltext0
+	.uleb128 .LFE582-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS247:
+	.uleb128 0
+	.uleb128 .LVU1456
+	.uleb128 .LVU1456
+	.uleb128 .LVU1561
+	.uleb128 .LVU1561
+	.uleb128 0
+.LLST247:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL427-1-.Ltext0
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL462-.Ltext0
+	.uleb128 .LFE582-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS248:
+	.uleb128 0
+	.uleb128 .LVU1452
+	.uleb128 .LVU1452
+	.uleb128 .LVU1563
+	.uleb128 .LVU1563
+	.uleb128 0
+.LLST248:
+	.byte	0x4
+	.uleb128 .LVL425-.Ltext0
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL426-.Ltext0
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL464-.Ltext0
+	.uleb128 .LFE582-.Ltext0
+	.uleb128 0x5
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x23
+	.uleb128 0x8
+	.byte	0
+.LVUS249:
+	.uleb128 .LVU1470
+	.uleb128 .LVU1507
+	.uleb128 .LVU1507
+	.uleb128 .LVU1511
+	.uleb128 .LVU1511
+	.uleb128 .LVU1521
+.LLST249:
+	.byte	0x4
+	.uleb128 .LVL432-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL447-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS250:
+	.uleb128 .LVU1473
+	.uleb128 .LVU1519
+.LLST250:
+	.byte	0x4
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+21646
+	.sleb128 0
+	.byte	0
+.LVUS251:
+	.uleb128 .LVU1475
+	.uleb128 .LVU1481
+	.uleb128 .LVU1481
+	.uleb128 .LVU1483
+	.uleb128 .LVU1483
+	.uleb128 .LVU1490
+	.uleb128 .LVU1490
+	.uleb128 .LVU1493
+	.uleb128 .LVU1493
+	.uleb128 .LVU1501
+	.uleb128 .LVU1501
+	.uleb128 .LVU1506
+	.uleb128 .LVU1506
+	.uleb128 .LVU1511
+	.uleb128 .LVU1511
+	.uleb128 .LVU1519
+.LLST251:
+	.byte	0x4
+	.uleb128 .LVL433-.Ltext0
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL435-.Ltext0
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL436-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS252:
+	.uleb128 .LVU1477
+	.uleb128 .LVU1488
+	.uleb128 .LVU1488
+	.uleb128 .LVU1490
+	.uleb128 .LVU1490
+	.uleb128 .LVU1493
+	.uleb128 .LVU1493
+	.uleb128 .LVU1498
+	.uleb128 .LVU1498
+	.uleb128 .LVU1501
+	.uleb128 .LVU1501
+	.uleb128 .LVU1506
+	.uleb128 .LVU1506
+	.uleb128 .LVU1509
+	.uleb128 .LVU1509
+	.uleb128 .LVU1511
+	.uleb128 .LVU1511
+	.uleb128 .LVU1519
+.LLST252:
+	.byte	0x4
+	.uleb128 .LVL434-.Ltext0
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL437-.Ltext0
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL438-.Ltext0
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 -2
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL439-.Ltext0
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL440-.Ltext0
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL441-.Ltext0
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 -3
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL442-.Ltext0
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL443-.Ltext0
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL444-.Ltext0
+	.uleb128 .LVL445-.Ltext0
+	.uleb128 0x8
+	.byte	0x7d
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS253:
+	.uleb128 .LVU1524
+	.uleb128 .LVU1539
+	.uleb128 .LVU1539
+	.uleb128 .LVU1543
+	.uleb128 .LVU1543
+	.uleb128 .LVU1549
+.LLST253:
+	.byte	0x4
+	.uleb128 .LVL448-.Ltext0
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL457-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS254:
+	.uleb128 .LVU1527
+	.uleb128 .LVU1547
+.LLST254:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+21785
+	.sleb128 0
+	.byte	0
+.LVUS255:
+	.uleb128 .LVU1529
+	.uleb128 .LVU1536
+	.uleb128 .LVU1536
+	.uleb128 .LVU1538
+	.uleb128 .LVU1538
+	.uleb128 .LVU1543
+	.uleb128 .LVU1543
+	.uleb128 .LVU1547
+.LLST255:
+	.byte	0x4
+	.uleb128 .LVL449-.Ltext0
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL451-.Ltext0
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL452-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS256:
+	.uleb128 .LVU1531
+	.uleb128 .LVU1542
+	.uleb128 .LVU1542
+	.uleb128 .LVU1543
+	.uleb128 .LVU1543
+	.uleb128 .LVU1547
+.LLST256:
+	.byte	0x4
+	.uleb128 .LVL450-.Ltext0
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL453-.Ltext0
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL454-.Ltext0
+	.uleb128 .LVL455-.Ltext0
+	.uleb128 0x9
+	.byte	0x7d
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS257:
+	.uleb128 .LVU1552
+	.uleb128 .LVU1557
+.LLST257:
+	.byte	0x4
+	.uleb128 .LVL458-.Ltext0
+	.uleb128 .LVL461-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS43:
+	.uleb128 0
+	.uleb128 .LVU249
+	.uleb128 .LVU249
+	.uleb128 .LVU286
+	.uleb128 .LVU286
+	.uleb128 0
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LFE581-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 0
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE581-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS45:
+	.uleb128 0
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 0
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE581-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU245
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LFE581-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU253
+	.uleb128 .LVU263
+	.uleb128 .LVU263
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU266
+	.uleb128 .LVU268
+	.uleb128 .LVU271
+	.uleb128 .LVU275
+	.uleb128 .LVU277
+	.uleb128 .LVU277
+	.uleb128 .LVU279
+	.uleb128 .LVU279
+	.uleb128 .LVU281
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 43
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU253
+	.uleb128 .LVU266
+	.uleb128 .LVU268
+	.uleb128 .LVU271
+	.uleb128 .LVU275
+	.uleb128 .LVU281
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS38:
+	.uleb128 0
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE580-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU200
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LFE580-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU209
+	.uleb128 .LVU216
+	.uleb128 .LVU216
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU223
+	.uleb128 .LVU225
+	.uleb128 .LVU228
+	.uleb128 .LVU232
+	.uleb128 .LVU238
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0xe
+	.byte	0x71
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x74
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU209
+	.uleb128 .LVU223
+	.uleb128 .LVU225
+	.uleb128 .LVU228
+	.uleb128 .LVU232
+	.uleb128 .LVU238
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS78:
+	.uleb128 0
+	.uleb128 .LVU469
+	.uleb128 .LVU469
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 0
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LFE579-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 0
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 0
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LFE579-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU465
+	.uleb128 .LVU476
+	.uleb128 .LVU489
+	.uleb128 .LVU498
+	.uleb128 .LVU628
+	.uleb128 .LVU630
+	.uleb128 .LVU631
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LFE579-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU619
+	.uleb128 .LVU624
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU482
+	.uleb128 .LVU486
+	.uleb128 .LVU494
+	.uleb128 .LVU498
+	.uleb128 .LVU610
+	.uleb128 .LVU619
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU482
+	.uleb128 .LVU487
+	.uleb128 .LVU494
+	.uleb128 .LVU619
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU497
+	.uleb128 .LVU498
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 8
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU555
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU567
+	.uleb128 .LVU567
+	.uleb128 .LVU574
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU561
+	.uleb128 .LVU566
+	.uleb128 .LVU566
+	.uleb128 .LVU567
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x6e
+	.byte	0
+.LVUS106:
+	.uleb128 .LVU571
+	.uleb128 .LVU574
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x6c
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU612
+	.uleb128 .LVU614
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU479
+	.uleb128 .LVU482
+	.uleb128 .LVU491
+	.uleb128 .LVU494
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU636
+	.uleb128 .LVU638
+	.uleb128 .LVU640
+	.uleb128 .LVU644
+	.uleb128 .LVU649
+	.uleb128 .LVU655
+	.uleb128 .LVU663
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU669
+	.uleb128 .LVU671
+	.uleb128 .LVU672
+	.uleb128 .LVU679
+	.uleb128 .LVU685
+	.uleb128 .LVU690
+	.uleb128 .LVU696
+	.uleb128 .LVU702
+	.uleb128 .LVU706
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU636
+	.uleb128 .LVU638
+	.uleb128 .LVU640
+	.uleb128 .LVU644
+	.uleb128 .LVU649
+	.uleb128 .LVU657
+	.uleb128 .LVU657
+	.uleb128 .LVU658
+	.uleb128 .LVU663
+	.uleb128 .LVU671
+	.uleb128 .LVU671
+	.uleb128 .LVU672
+	.uleb128 .LVU679
+	.uleb128 .LVU685
+	.uleb128 .LVU690
+	.uleb128 .LVU696
+	.uleb128 .LVU702
+	.uleb128 .LVU706
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 0
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LFE573-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 0
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE573-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 0
+	.uleb128 .LVU176
+	.uleb128 .LVU176
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 0
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL52-1-.Ltext0
+	.uleb128 .LFE573-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU179
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU196
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU182
+	.uleb128 .LVU184
+	.uleb128 .LVU184
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU195
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS69:
+	.uleb128 0
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE572-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS70:
+	.uleb128 0
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU459
+	.uleb128 .LVU459
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE572-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS71:
+	.uleb128 0
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU462
+	.uleb128 .LVU462
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LFE572-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU430
+	.uleb128 .LVU460
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU443
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU451
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU435
+	.uleb128 .LVU437
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU452
+	.uleb128 .LVU454
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU167
+	.uleb128 .LVU167
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LFE570-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LFE570-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-1-.Ltext0
+	.uleb128 .LFE570-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU140
+	.uleb128 .LVU140
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU145
+	.uleb128 .LVU145
+	.uleb128 .LVU165
+	.uleb128 .LVU165
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE570-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU134
+	.uleb128 .LVU136
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU153
+	.uleb128 .LVU165
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU153
+	.uleb128 .LVU165
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU155
+	.uleb128 .LVU157
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LFE569-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LFE569-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE569-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU118
+	.uleb128 .LVU118
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE569-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU130
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LFE569-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS189:
+	.uleb128 0
+	.uleb128 .LVU1090
+	.uleb128 .LVU1090
+	.uleb128 .LVU1091
+	.uleb128 .LVU1091
+	.uleb128 .LVU1094
+	.uleb128 .LVU1094
+	.uleb128 .LVU1121
+	.uleb128 .LVU1121
+	.uleb128 .LVU1123
+	.uleb128 .LVU1123
+	.uleb128 0
+.LLST189:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL315-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL317-.Ltext0
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL325-.Ltext0
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL327-1-.Ltext0
+	.uleb128 .LFE566-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS190:
+	.uleb128 0
+	.uleb128 .LVU1089
+	.uleb128 .LVU1089
+	.uleb128 .LVU1091
+	.uleb128 .LVU1091
+	.uleb128 .LVU1107
+	.uleb128 .LVU1107
+	.uleb128 .LVU1108
+	.uleb128 .LVU1108
+	.uleb128 0
+.LLST190:
+	.byte	0x4
+	.uleb128 .LVL313-.Ltext0
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL314-.Ltext0
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL316-.Ltext0
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL321-.Ltext0
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LFE566-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1095
+	.uleb128 .LVU1102
+	.uleb128 .LVU1102
+	.uleb128 .LVU1104
+	.uleb128 .LVU1104
+	.uleb128 .LVU1108
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL318-.Ltext0
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL319-.Ltext0
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL320-.Ltext0
+	.uleb128 .LVL322-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1108
+	.uleb128 .LVU1113
+	.uleb128 .LVU1113
+	.uleb128 .LVU1115
+	.uleb128 .LVU1115
+	.uleb128 .LVU1122
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL322-.Ltext0
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL323-.Ltext0
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL324-.Ltext0
+	.uleb128 .LVL326-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE561-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-1-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE561-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU403
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0xb
+	.byte	0x75
+	.sleb128 34
+	.byte	0x94
+	.byte	0x2
+	.byte	0x37
+	.byte	0x1a
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU407
+	.uleb128 .LVU409
+	.uleb128 .LVU411
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0xa
+	.byte	0x9b
+	.byte	0xe
+	.long	va_quote_thread@dtpoff, 0
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU413
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x17
+	.byte	0x75
+	.sleb128 34
+	.byte	0x94
+	.byte	0x2
+	.byte	0x37
+	.byte	0x1a
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	va_quote
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU416
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS570:
+	.uleb128 .LVU3776
+	.uleb128 0
+.LLST570:
+	.byte	0x4
+	.uleb128 .LVL1049-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS566:
+	.uleb128 .LVU3759
+	.uleb128 .LVU3762
+	.uleb128 .LVU3762
+	.uleb128 .LVU3770
+	.uleb128 .LVU3770
+	.uleb128 .LVU3771
+	.uleb128 .LVU3771
+	.uleb128 0
+.LLST566:
+	.byte	0x4
+	.uleb128 .LVL1043-.Ltext0
+	.uleb128 .LVL1044-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1044-.Ltext0
+	.uleb128 .LVL1046-.Ltext0
+	.uleb128 0x5
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1046-.Ltext0
+	.uleb128 .LVL1047-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1047-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x33
+	.byte	0x25
+	.byte	0x23
+	.uleb128 0x1
+	.byte	0x9f
+	.byte	0
+.LVUS568:
+	.uleb128 .LVU3765
+	.uleb128 .LVU3771
+	.uleb128 .LVU3771
+	.uleb128 0
+.LLST568:
+	.byte	0x4
+	.uleb128 .LVL1044-.Ltext0
+	.uleb128 .LVL1047-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	va_quote
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1047-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0xd
+	.byte	0x70
+	.sleb128 0
+	.byte	0x3
+	.quad	va_quote-8
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS569:
+	.uleb128 .LVU3767
+	.uleb128 0
+.LLST569:
+	.byte	0x4
+	.uleb128 .LVL1045-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS560:
+	.uleb128 0
+	.uleb128 .LVU3746
+	.uleb128 .LVU3746
+	.uleb128 .LVU3753
+	.uleb128 .LVU3753
+	.uleb128 0
+.LLST560:
+	.byte	0x4
+	.uleb128 .LVL1039-.Ltext0
+	.uleb128 .LVL1039-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1039-.Ltext0
+	.uleb128 .LVL1041-.Ltext0
+	.uleb128 0x5
+	.byte	0x75
+	.sleb128 0
+	.byte	0x37
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1041-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x6
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x37
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS562:
+	.uleb128 .LVU3748
+	.uleb128 .LVU3753
+	.uleb128 .LVU3753
+	.uleb128 0
+.LLST562:
+	.byte	0x4
+	.uleb128 .LVL1039-.Ltext0
+	.uleb128 .LVL1041-.Ltext0
+	.uleb128 0x17
+	.byte	0x75
+	.sleb128 0
+	.byte	0x37
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	va_quote
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1041-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x18
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x37
+	.byte	0x1a
+	.byte	0xc
+	.long	0xffffffff
+	.byte	0x1a
+	.byte	0x33
+	.byte	0x24
+	.byte	0x3
+	.quad	va_quote
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS563:
+	.uleb128 .LVU3750
+	.uleb128 0
+.LLST563:
+	.byte	0x4
+	.uleb128 .LVL1040-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS564:
+	.uleb128 .LVU3754
+	.uleb128 0
+.LLST564:
+	.byte	0x4
+	.uleb128 .LVL1042-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS544:
+	.uleb128 0
+	.uleb128 .LVU3654
+	.uleb128 .LVU3654
+	.uleb128 .LVU3680
+	.uleb128 .LVU3680
+	.uleb128 .LVU3682
+	.uleb128 .LVU3682
+	.uleb128 .LVU3682
+	.uleb128 .LVU3682
+	.uleb128 .LVU3684
+	.uleb128 .LVU3684
+	.uleb128 .LVU3686
+	.uleb128 .LVU3686
+	.uleb128 .LVU3686
+	.uleb128 .LVU3686
+	.uleb128 .LVU3687
+	.uleb128 .LVU3687
+	.uleb128 0
+.LLST544:
+	.byte	0x4
+	.uleb128 .LVL996-.Ltext0
+	.uleb128 .LVL999-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL999-.Ltext0
+	.uleb128 .LVL1009-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1009-.Ltext0
+	.uleb128 .LVL1011-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1011-1-.Ltext0
+	.uleb128 .LVL1011-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1011-.Ltext0
+	.uleb128 .LVL1012-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1012-.Ltext0
+	.uleb128 .LVL1014-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1014-1-.Ltext0
+	.uleb128 .LVL1014-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1014-.Ltext0
+	.uleb128 .LVL1015-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1015-.Ltext0
+	.uleb128 .LFE551-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS545:
+	.uleb128 0
+	.uleb128 .LVU3656
+	.uleb128 .LVU3656
+	.uleb128 .LVU3657
+	.uleb128 .LVU3657
+	.uleb128 .LVU3669
+	.uleb128 .LVU3669
+	.uleb128 .LVU3670
+	.uleb128 .LVU3672
+	.uleb128 .LVU3682
+	.uleb128 .LVU3686
+	.uleb128 0
+.LLST545:
+	.byte	0x4
+	.uleb128 .LVL996-.Ltext0
+	.uleb128 .LVL1000-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1000-.Ltext0
+	.uleb128 .LVL1001-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1001-.Ltext0
+	.uleb128 .LVL1005-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1005-.Ltext0
+	.uleb128 .LVL1006-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1008-.Ltext0
+	.uleb128 .LVL1011-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1014-.Ltext0
+	.uleb128 .LFE551-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS546:
+	.uleb128 .LVU3666
+	.uleb128 .LVU3681
+	.uleb128 .LVU3681
+	.uleb128 .LVU3682
+	.uleb128 .LVU3682
+	.uleb128 .LVU3685
+.LLST546:
+	.byte	0x4
+	.uleb128 .LVL1004-.Ltext0
+	.uleb128 .LVL1010-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1010-.Ltext0
+	.uleb128 .LVL1011-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1011-.Ltext0
+	.uleb128 .LVL1013-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS547:
+	.uleb128 .LVU3646
+	.uleb128 .LVU3648
+.LLST547:
+	.byte	0x4
+	.uleb128 .LVL997-.Ltext0
+	.uleb128 .LVL997-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS549:
+	.uleb128 .LVU3651
+	.uleb128 .LVU3654
+	.uleb128 .LVU3657
+	.uleb128 .LVU3662
+.LLST549:
+	.byte	0x4
+	.uleb128 .LVL998-.Ltext0
+	.uleb128 .LVL999-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1001-.Ltext0
+	.uleb128 .LVL1002-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS550:
+	.uleb128 .LVU3651
+	.uleb128 .LVU3654
+	.uleb128 .LVU3657
+	.uleb128 .LVU3662
+.LLST550:
+	.byte	0x4
+	.uleb128 .LVL998-.Ltext0
+	.uleb128 .LVL999-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1001-.Ltext0
+	.uleb128 .LVL1002-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS551:
+	.uleb128 .LVU3659
+	.uleb128 .LVU3662
+.LLST551:
+	.byte	0x4
+	.uleb128 .LVL1001-.Ltext0
+	.uleb128 .LVL1002-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS552:
+	.uleb128 0
+	.uleb128 .LVU3706
+	.uleb128 .LVU3706
+	.uleb128 .LVU3730
+	.uleb128 .LVU3730
+	.uleb128 .LVU3732
+	.uleb128 .LVU3732
+	.uleb128 .LVU3732
+	.uleb128 .LVU3732
+	.uleb128 .LVU3736
+	.uleb128 .LVU3736
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3740
+	.uleb128 .LVU3740
+	.uleb128 .LVU3742
+	.uleb128 .LVU3742
+	.uleb128 .LVU3742
+	.uleb128 .LVU3742
+	.uleb128 .LVU3743
+	.uleb128 .LVU3743
+	.uleb128 0
+.LLST552:
+	.byte	0x4
+	.uleb128 .LVL1016-.Ltext0
+	.uleb128 .LVL1019-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1019-.Ltext0
+	.uleb128 .LVL1029-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1029-.Ltext0
+	.uleb128 .LVL1031-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1031-1-.Ltext0
+	.uleb128 .LVL1031-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1031-.Ltext0
+	.uleb128 .LVL1032-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1032-.Ltext0
+	.uleb128 .LVL1034-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1034-1-.Ltext0
+	.uleb128 .LVL1034-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1034-.Ltext0
+	.uleb128 .LVL1035-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1035-.Ltext0
+	.uleb128 .LVL1037-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1037-1-.Ltext0
+	.uleb128 .LVL1037-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1037-.Ltext0
+	.uleb128 .LVL1038-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL1038-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS553:
+	.uleb128 0
+	.uleb128 .LVU3708
+	.uleb128 .LVU3708
+	.uleb128 .LVU3709
+	.uleb128 .LVU3709
+	.uleb128 .LVU3721
+	.uleb128 .LVU3721
+	.uleb128 .LVU3722
+	.uleb128 .LVU3724
+	.uleb128 .LVU3732
+	.uleb128 .LVU3732
+	.uleb128 .LVU3738
+	.uleb128 .LVU3742
+	.uleb128 0
+.LLST553:
+	.byte	0x4
+	.uleb128 .LVL1016-.Ltext0
+	.uleb128 .LVL1020-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1020-.Ltext0
+	.uleb128 .LVL1021-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1021-.Ltext0
+	.uleb128 .LVL1025-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1025-.Ltext0
+	.uleb128 .LVL1026-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1028-.Ltext0
+	.uleb128 .LVL1031-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1031-.Ltext0
+	.uleb128 .LVL1034-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1037-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS554:
+	.uleb128 .LVU3718
+	.uleb128 .LVU3731
+	.uleb128 .LVU3731
+	.uleb128 .LVU3732
+	.uleb128 .LVU3732
+	.uleb128 .LVU3737
+	.uleb128 .LVU3737
+	.uleb128 .LVU3738
+	.uleb128 .LVU3738
+	.uleb128 .LVU3741
+.LLST554:
+	.byte	0x4
+	.uleb128 .LVL1024-.Ltext0
+	.uleb128 .LVL1030-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1030-.Ltext0
+	.uleb128 .LVL1031-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1031-.Ltext0
+	.uleb128 .LVL1033-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL1033-.Ltext0
+	.uleb128 .LVL1034-1-.Ltext0
+	.uleb128 0x6
+	.byte	0x70
+	.sleb128 0
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1034-.Ltext0
+	.uleb128 .LVL1036-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS555:
+	.uleb128 .LVU3698
+	.uleb128 .LVU3700
+.LLST555:
+	.byte	0x4
+	.uleb128 .LVL1017-.Ltext0
+	.uleb128 .LVL1017-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS557:
+	.uleb128 .LVU3703
+	.uleb128 .LVU3706
+	.uleb128 .LVU3709
+	.uleb128 .LVU3714
+.LLST557:
+	.byte	0x4
+	.uleb128 .LVL1018-.Ltext0
+	.uleb128 .LVL1019-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL1021-.Ltext0
+	.uleb128 .LVL1022-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS558:
+	.uleb128 .LVU3703
+	.uleb128 .LVU3706
+	.uleb128 .LVU3709
+	.uleb128 .LVU3714
+.LLST558:
+	.byte	0x4
+	.uleb128 .LVL1018-.Ltext0
+	.uleb128 .LVL1019-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1021-.Ltext0
+	.uleb128 .LVL1022-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS559:
+	.uleb128 .LVU3711
+	.uleb128 .LVU3714
+.LLST559:
+	.byte	0x4
+	.uleb128 .LVL1021-.Ltext0
+	.uleb128 .LVL1022-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU34
+	.uleb128 .LVU34
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU49
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU101
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x8
+	.byte	0x70
+	.sleb128 0
+	.byte	0x40
+	.byte	0x4b
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x21
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 .LVU68
+	.uleb128 .LVU68
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU101
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4e
+	.byte	0x25
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 0
+	.byte	0x33
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x7
+	.byte	0x70
+	.sleb128 0
+	.byte	0x4d
+	.byte	0x25
+	.byte	0x33
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU58
+	.uleb128 .LVU63
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+27357
+	.sleb128 0
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU59
+	.uleb128 .LVU63
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x5
+	.byte	0x40
+	.byte	0x4b
+	.byte	0x24
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU70
+	.uleb128 .LVU73
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU36
+	.uleb128 .LVU45
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU36
+	.uleb128 .LVU45
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU42
+	.uleb128 .LVU45
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU77
+	.uleb128 .LVU86
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU77
+	.uleb128 .LVU86
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU83
+	.uleb128 .LVU86
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS541:
+	.uleb128 0
+	.uleb128 .LVU3587
+	.uleb128 .LVU3587
+	.uleb128 .LVU3633
+	.uleb128 .LVU3633
+	.uleb128 .LVU3635
+	.uleb128 .LVU3635
+	.uleb128 0
+.LLST541:
+	.byte	0x4
+	.uleb128 .LVL979-.Ltext0
+	.uleb128 .LVL982-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL982-1-.Ltext0
+	.uleb128 .LVL993-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL993-.Ltext0
+	.uleb128 .LVL995-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL995-1-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS542:
+	.uleb128 0
+	.uleb128 .LVU3581
+	.uleb128 .LVU3581
+	.uleb128 .LVU3628
+	.uleb128 .LVU3628
+	.uleb128 .LVU3629
+	.uleb128 .LVU3629
+	.uleb128 0
+.LLST542:
+	.byte	0x4
+	.uleb128 .LVL979-.Ltext0
+	.uleb128 .LVL980-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL980-.Ltext0
+	.uleb128 .LVL990-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL990-.Ltext0
+	.uleb128 .LVL991-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL991-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS543:
+	.uleb128 .LVU3586
+	.uleb128 .LVU3634
+.LLST543:
+	.byte	0x4
+	.uleb128 .LVL981-.Ltext0
+	.uleb128 .LVL994-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS539:
+	.uleb128 0
+	.uleb128 .LVU3556
+	.uleb128 .LVU3556
+	.uleb128 .LVU3573
+	.uleb128 .LVU3573
+	.uleb128 .LVU3574
+	.uleb128 .LVU3574
+	.uleb128 0
+.LLST539:
+	.byte	0x4
+	.uleb128 .LVL970-.Ltext0
+	.uleb128 .LVL972-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL972-1-.Ltext0
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL977-.Ltext0
+	.uleb128 .LVL978-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL978-1-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS540:
+	.uleb128 0
+	.uleb128 .LVU3554
+	.uleb128 .LVU3554
+	.uleb128 .LVU3566
+	.uleb128 .LVU3566
+	.uleb128 .LVU3567
+	.uleb128 .LVU3567
+	.uleb128 0
+.LLST540:
+	.byte	0x4
+	.uleb128 .LVL970-.Ltext0
+	.uleb128 .LVL971-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL971-.Ltext0
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL974-.Ltext0
+	.uleb128 .LVL975-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL975-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU711
+	.uleb128 0
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LFE562-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU715
+	.uleb128 .LVU720
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU714
+	.uleb128 .LVU720
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS121:
+	.uleb128 0
+	.uleb128 .LVU729
+	.uleb128 .LVU729
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LFE574-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS122:
+	.uleb128 0
+	.uleb128 .LVU729
+	.uleb128 .LVU729
+	.uleb128 .LVU759
+	.uleb128 .LVU759
+	.uleb128 0
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LFE574-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 0
+	.uleb128 .LVU729
+	.uleb128 .LVU729
+	.uleb128 .LVU760
+	.uleb128 .LVU760
+	.uleb128 0
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LFE574-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU736
+	.uleb128 .LVU756
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU742
+	.uleb128 .LVU746
+	.uleb128 .LVU746
+	.uleb128 .LVU756
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU749
+	.uleb128 .LVU754
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU731
+	.uleb128 .LVU734
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL196-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS128:
+	.uleb128 0
+	.uleb128 .LVU779
+	.uleb128 .LVU779
+	.uleb128 .LVU781
+	.uleb128 .LVU781
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU910
+	.uleb128 .LVU910
+	.uleb128 0
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL260-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS129:
+	.uleb128 0
+	.uleb128 .LVU778
+	.uleb128 .LVU778
+	.uleb128 .LVU783
+	.uleb128 .LVU783
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU787
+	.uleb128 .LVU787
+	.uleb128 .LVU911
+	.uleb128 .LVU911
+	.uleb128 0
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL261-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 0
+	.uleb128 .LVU777
+	.uleb128 .LVU777
+	.uleb128 .LVU782
+	.uleb128 .LVU782
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU787
+	.uleb128 .LVU787
+	.uleb128 0
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU771
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU787
+	.uleb128 .LVU787
+	.uleb128 .LVU789
+	.uleb128 .LVU790
+	.uleb128 .LVU812
+	.uleb128 .LVU816
+	.uleb128 .LVU827
+	.uleb128 .LVU829
+	.uleb128 .LVU865
+	.uleb128 .LVU867
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 .LVU907
+	.uleb128 .LVU907
+	.uleb128 .LVU908
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL258-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU771
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU787
+	.uleb128 .LVU787
+	.uleb128 .LVU908
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU771
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU784
+	.uleb128 .LVU908
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL216-1-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL259-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU861
+	.uleb128 .LVU867
+	.uleb128 .LVU882
+	.uleb128 .LVU893
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU861
+	.uleb128 .LVU864
+	.uleb128 .LVU885
+	.uleb128 .LVU888
+	.uleb128 .LVU888
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 .LVU892
+	.uleb128 .LVU892
+	.uleb128 .LVU893
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 0x8
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0xa
+	.byte	0x71
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0xa
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x32
+	.byte	0x24
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 .LVU861
+	.uleb128 .LVU864
+	.uleb128 .LVU887
+	.uleb128 .LVU888
+	.uleb128 .LVU888
+	.uleb128 .LVU893
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU877
+	.uleb128 .LVU880
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU790
+	.uleb128 .LVU797
+	.uleb128 .LVU817
+	.uleb128 .LVU823
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU790
+	.uleb128 .LVU797
+	.uleb128 .LVU817
+	.uleb128 .LVU823
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU793
+	.uleb128 .LVU795
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU802
+	.uleb128 .LVU807
+	.uleb128 .LVU807
+	.uleb128 .LVU817
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x7
+	.byte	0x73
+	.sleb128 48
+	.byte	0x6
+	.byte	0x74
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU799
+	.uleb128 .LVU802
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL220-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU823
+	.uleb128 .LVU829
+	.uleb128 .LVU844
+	.uleb128 .LVU855
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU823
+	.uleb128 .LVU826
+	.uleb128 .LVU847
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 .LVU852
+	.uleb128 .LVU852
+	.uleb128 .LVU854
+	.uleb128 .LVU854
+	.uleb128 .LVU855
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0xa
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x31
+	.byte	0x24
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 .LVU839
+	.uleb128 .LVU842
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU823
+	.uleb128 .LVU826
+	.uleb128 .LVU849
+	.uleb128 .LVU850
+	.uleb128 .LVU850
+	.uleb128 .LVU855
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS154:
+	.uleb128 .LVU831
+	.uleb128 .LVU837
+	.uleb128 .LVU855
+	.uleb128 .LVU861
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 .LVU831
+	.uleb128 .LVU837
+	.uleb128 .LVU855
+	.uleb128 .LVU861
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU833
+	.uleb128 .LVU835
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS158:
+	.uleb128 .LVU869
+	.uleb128 .LVU875
+	.uleb128 .LVU893
+	.uleb128 .LVU899
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU869
+	.uleb128 .LVU875
+	.uleb128 .LVU893
+	.uleb128 .LVU899
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU871
+	.uleb128 .LVU873
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS161:
+	.uleb128 0
+	.uleb128 .LVU915
+	.uleb128 .LVU915
+	.uleb128 .LVU925
+	.uleb128 .LVU925
+	.uleb128 .LVU926
+	.uleb128 .LVU926
+	.uleb128 .LVU929
+	.uleb128 .LVU929
+	.uleb128 .LVU936
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 0
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL263-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 0
+	.uleb128 .LVU916
+	.uleb128 .LVU916
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU936
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 0
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL264-.Ltext0
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS163:
+	.uleb128 0
+	.uleb128 .LVU928
+	.uleb128 .LVU928
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU936
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 0
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL262-.Ltext0
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL268-.Ltext0
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU918
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 0
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU918
+	.uleb128 .LVU932
+	.uleb128 .LVU932
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 0
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL270-1-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS167:
+	.uleb128 .LVU918
+	.uleb128 .LVU925
+	.uleb128 .LVU925
+	.uleb128 .LVU926
+	.uleb128 .LVU926
+	.uleb128 .LVU929
+	.uleb128 .LVU929
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 0
+.LLST167:
+	.byte	0x4
+	.uleb128 .LVL265-.Ltext0
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL266-.Ltext0
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL267-.Ltext0
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL269-.Ltext0
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU936
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+	.uleb128 .LVU940
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL271-.Ltext0
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL272-1-.Ltext0
+	.uleb128 .LVL272-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS173:
+	.uleb128 0
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 0
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE541-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS174:
+	.uleb128 0
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 .LVU1033
+	.uleb128 .LVU1033
+	.uleb128 .LVU1040
+	.uleb128 .LVU1040
+	.uleb128 .LVU1051
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+	.uleb128 .LVU1054
+	.uleb128 .LVU1058
+	.uleb128 .LVU1058
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 0
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL278-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 .LFE541-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS175:
+	.uleb128 .LVU966
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 .LVU1033
+	.uleb128 .LVU1033
+	.uleb128 .LVU1040
+	.uleb128 .LVU1040
+	.uleb128 .LVU1051
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+	.uleb128 .LVU1054
+	.uleb128 .LVU1058
+	.uleb128 .LVU1058
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+.LLST175:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU966
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+	.uleb128 .LVU1067
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL304-1-.Ltext0
+	.uleb128 .LVL304-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU968
+	.uleb128 .LVU971
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL279-.Ltext0
+	.uleb128 .LVL280-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU975
+	.uleb128 .LVU977
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 .LVL281-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS180:
+	.uleb128 .LVU983
+	.uleb128 .LVU1020
+	.uleb128 .LVU1020
+	.uleb128 .LVU1032
+.LLST180:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL291-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU983
+	.uleb128 .LVU989
+	.uleb128 .LVU989
+	.uleb128 .LVU990
+	.uleb128 .LVU990
+	.uleb128 .LVU998
+	.uleb128 .LVU998
+	.uleb128 .LVU1003
+	.uleb128 .LVU1003
+	.uleb128 .LVU1004
+	.uleb128 .LVU1004
+	.uleb128 .LVU1011
+	.uleb128 .LVU1011
+	.uleb128 .LVU1016
+	.uleb128 .LVU1016
+	.uleb128 .LVU1017
+	.uleb128 .LVU1017
+	.uleb128 .LVU1018
+	.uleb128 .LVU1018
+	.uleb128 .LVU1019
+	.uleb128 .LVU1019
+	.uleb128 .LVU1028
+	.uleb128 .LVU1028
+	.uleb128 .LVU1030
+	.uleb128 .LVU1030
+	.uleb128 .LVU1031
+	.uleb128 .LVU1031
+	.uleb128 .LVU1032
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL282-.Ltext0
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL283-.Ltext0
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL284-.Ltext0
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL285-.Ltext0
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL286-.Ltext0
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL287-.Ltext0
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL288-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL289-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL290-.Ltext0
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL292-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 .LVL293-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1035
+	.uleb128 .LVU1043
+	.uleb128 .LVU1043
+	.uleb128 .LVU1044
+	.uleb128 .LVU1044
+	.uleb128 .LVU1051
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL296-.Ltext0
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL297-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS183:
+	.uleb128 .LVU1035
+	.uleb128 .LVU1041
+	.uleb128 .LVU1041
+	.uleb128 .LVU1050
+	.uleb128 .LVU1050
+	.uleb128 .LVU1051
+	.uleb128 .LVU1051
+	.uleb128 .LVU1054
+	.uleb128 .LVU1054
+	.uleb128 .LVU1055
+.LLST183:
+	.byte	0x4
+	.uleb128 .LVL294-.Ltext0
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL295-.Ltext0
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL298-.Ltext0
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL299-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 .LVL300-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1059
+	.uleb128 .LVU1060
+	.uleb128 .LVU1060
+	.uleb128 .LVU1063
+	.uleb128 .LVU1063
+	.uleb128 .LVU1065
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL301-.Ltext0
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL302-.Ltext0
+	.uleb128 .LVL303-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS185:
+	.uleb128 0
+	.uleb128 .LVU1076
+	.uleb128 .LVU1076
+	.uleb128 .LVU1082
+	.uleb128 .LVU1082
+	.uleb128 .LVU1083
+	.uleb128 .LVU1083
+	.uleb128 0
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL307-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL307-1-.Ltext0
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL311-.Ltext0
+	.uleb128 .LVL312-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL312-1-.Ltext0
+	.uleb128 .LFE552-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS186:
+	.uleb128 0
+	.uleb128 .LVU1076
+	.uleb128 .LVU1076
+	.uleb128 0
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL305-.Ltext0
+	.uleb128 .LVL307-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL307-1-.Ltext0
+	.uleb128 .LFE552-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS187:
+	.uleb128 .LVU1075
+	.uleb128 .LVU1079
+.LLST187:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x27
+	.byte	0x9f
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1074
+	.uleb128 .LVU1076
+	.uleb128 .LVU1076
+	.uleb128 .LVU1079
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL306-.Ltext0
+	.uleb128 .LVL307-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL307-1-.Ltext0
+	.uleb128 .LVL310-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS242:
+	.uleb128 0
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+	.uleb128 .LVU1445
+	.uleb128 .LVU1445
+	.uleb128 0
+.LLST242:
+	.byte	0x4
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 .LVL423-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL423-1-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LVL424-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL424-1-.Ltext0
+	.uleb128 .LFE568-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS243:
+	.uleb128 0
+	.uleb128 .LVU1438
+	.uleb128 .LVU1438
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+	.uleb128 .LVU1445
+	.uleb128 .LVU1445
+	.uleb128 0
+.LLST243:
+	.byte	0x4
+	.uleb128 .LVL420-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 .LVL424-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL424-1-.Ltext0
+	.uleb128 .LFE568-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS244:
+	.uleb128 .LVU1437
+	.uleb128 .LVU1438
+	.uleb128 .LVU1438
+	.uleb128 .LVU1439
+.LLST244:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL422-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS245:
+	.uleb128 .LVU1436
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+	.uleb128 .LVU1439
+.LLST245:
+	.byte	0x4
+	.uleb128 .LVL421-.Ltext0
+	.uleb128 .LVL423-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL423-1-.Ltext0
+	.uleb128 .LVL423-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS258:
+	.uleb128 0
+	.uleb128 .LVU1567
+	.uleb128 .LVU1567
+	.uleb128 .LVU1580
+	.uleb128 .LVU1580
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1585
+	.uleb128 .LVU1585
+	.uleb128 .LVU1586
+	.uleb128 .LVU1586
+	.uleb128 .LVU1592
+	.uleb128 .LVU1592
+	.uleb128 .LVU1601
+	.uleb128 .LVU1601
+	.uleb128 .LVU1608
+	.uleb128 .LVU1608
+	.uleb128 0
+.LLST258:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL466-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS259:
+	.uleb128 0
+	.uleb128 .LVU1568
+	.uleb128 .LVU1568
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1593
+	.uleb128 .LVU1593
+	.uleb128 .LVU1601
+	.uleb128 .LVU1601
+	.uleb128 .LVU1609
+	.uleb128 .LVU1609
+	.uleb128 0
+.LLST259:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL467-.Ltext0
+	.uleb128 .LVL472-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL472-1-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS260:
+	.uleb128 0
+	.uleb128 .LVU1571
+	.uleb128 .LVU1571
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1581
+	.uleb128 .LVU1593
+	.uleb128 .LVU1593
+	.uleb128 .LVU1601
+	.uleb128 .LVU1601
+	.uleb128 .LVU1609
+	.uleb128 .LVU1609
+	.uleb128 0
+.LLST260:
+	.byte	0x4
+	.uleb128 .LVL465-.Ltext0
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL468-.Ltext0
+	.uleb128 .LVL472-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL472-1-.Ltext0
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL482-1-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS262:
+	.uleb128 .LVU1573
+	.uleb128 .LVU1580
+	.uleb128 .LVU1581
+	.uleb128 .LVU1593
+	.uleb128 .LVU1593
+	.uleb128 .LVU1601
+	.uleb128 .LVU1609
+	.uleb128 0
+.LLST262:
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS263:
+	.uleb128 .LVU1573
+	.uleb128 .LVU1580
+	.uleb128 .LVU1581
+	.uleb128 .LVU1593
+	.uleb128 .LVU1593
+	.uleb128 .LVU1601
+	.uleb128 .LVU1609
+	.uleb128 0
+.LLST263:
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS264:
+	.uleb128 .LVU1573
+	.uleb128 .LVU1580
+	.uleb128 .LVU1581
+	.uleb128 .LVU1585
+	.uleb128 .LVU1585
+	.uleb128 .LVU1586
+	.uleb128 .LVU1586
+	.uleb128 .LVU1592
+	.uleb128 .LVU1592
+	.uleb128 .LVU1601
+	.uleb128 .LVU1609
+	.uleb128 0
+.LLST264:
+	.byte	0x4
+	.uleb128 .LVL469-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL472-.Ltext0
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL473-.Ltext0
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL474-.Ltext0
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL475-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS265:
+	.uleb128 .LVU1578
+	.uleb128 .LVU1580
+.LLST265:
+	.byte	0x4
+	.uleb128 .LVL470-.Ltext0
+	.uleb128 .LVL471-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS267:
+	.uleb128 .LVU1593
+	.uleb128 .LVU1598
+	.uleb128 .LVU1598
+	.uleb128 .LVU1600
+	.uleb128 .LVU1600
+	.uleb128 .LVU1601
+	.uleb128 .LVU1609
+	.uleb128 .LVU1611
+.LLST267:
+	.byte	0x4
+	.uleb128 .LVL476-.Ltext0
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL477-.Ltext0
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL479-.Ltext0
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL482-.Ltext0
+	.uleb128 .LVL483-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS268:
+	.uleb128 .LVU1601
+	.uleb128 .LVU1608
+.LLST268:
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS269:
+	.uleb128 .LVU1601
+	.uleb128 .LVU1608
+.LLST269:
+	.byte	0x4
+	.uleb128 .LVL480-.Ltext0
+	.uleb128 .LVL481-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS368:
+	.uleb128 0
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2280
+	.uleb128 .LVU2280
+	.uleb128 0
+.LLST368:
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 .LVL673-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL673-1-.Ltext0
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 .LVL674-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL674-1-.Ltext0
+	.uleb128 .LFE586-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS369:
+	.uleb128 0
+	.uleb128 .LVU2275
+	.uleb128 .LVU2275
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2278
+	.uleb128 .LVU2278
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2280
+	.uleb128 .LVU2280
+	.uleb128 0
+.LLST369:
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL670-.Ltext0
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL672-.Ltext0
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 .LVL674-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL674-1-.Ltext0
+	.uleb128 .LFE586-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS370:
+	.uleb128 0
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2279
+	.uleb128 .LVU2280
+	.uleb128 .LVU2280
+	.uleb128 0
+.LLST370:
+	.byte	0x4
+	.uleb128 .LVL668-.Ltext0
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 .LVL673-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL673-1-.Ltext0
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL673-.Ltext0
+	.uleb128 .LVL674-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL674-1-.Ltext0
+	.uleb128 .LFE586-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS371:
+	.uleb128 .LVU2272
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+.LLST371:
+	.byte	0x4
+	.uleb128 .LVL669-.Ltext0
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS372:
+	.uleb128 .LVU2271
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+	.uleb128 .LVU2276
+.LLST372:
+	.byte	0x4
+	.uleb128 .LVL669-.Ltext0
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL671-1-.Ltext0
+	.uleb128 .LVL671-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS597:
+	.uleb128 0
+	.uleb128 .LVU3926
+	.uleb128 .LVU3926
+	.uleb128 0
+.LLST597:
+	.byte	0x4
+	.uleb128 .LVL1102-.Ltext0
+	.uleb128 .LVL1103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1103-1-.Ltext0
+	.uleb128 .LFE622-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS598:
+	.uleb128 0
+	.uleb128 .LVU3926
+	.uleb128 .LVU3926
+	.uleb128 0
+.LLST598:
+	.byte	0x4
+	.uleb128 .LVL1102-.Ltext0
+	.uleb128 .LVL1103-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1103-1-.Ltext0
+	.uleb128 .LFE622-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS613:
+	.uleb128 0
+	.uleb128 .LVU3967
+	.uleb128 .LVU3967
+	.uleb128 0
+.LLST613:
+	.byte	0x4
+	.uleb128 .LVL1118-.Ltext0
+	.uleb128 .LVL1119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1119-1-.Ltext0
+	.uleb128 .LFE631-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS614:
+	.uleb128 0
+	.uleb128 .LVU3967
+	.uleb128 .LVU3967
+	.uleb128 0
+.LLST614:
+	.byte	0x4
+	.uleb128 .LVL1118-.Ltext0
+	.uleb128 .LVL1119-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1119-1-.Ltext0
+	.uleb128 .LFE631-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB400-.Ltext0
+	.uleb128 .LBE400-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB401-.Ltext0
+	.uleb128 .LBE401-.Ltext0
+	.byte	0
+.LLRL22:
+	.byte	0x4
+	.uleb128 .LBB406-.Ltext0
+	.uleb128 .LBE406-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB407-.Ltext0
+	.uleb128 .LBE407-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB408-.Ltext0
+	.uleb128 .LBE408-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB411-.Ltext0
+	.uleb128 .LBE411-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB416-.Ltext0
+	.uleb128 .LBE416-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB423-.Ltext0
+	.uleb128 .LBE423-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB424-.Ltext0
+	.uleb128 .LBE424-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB425-.Ltext0
+	.uleb128 .LBE425-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB426-.Ltext0
+	.uleb128 .LBE426-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB427-.Ltext0
+	.uleb128 .LBE427-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB428-.Ltext0
+	.uleb128 .LBE428-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB434-.Ltext0
+	.uleb128 .LBE434-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB435-.Ltext0
+	.uleb128 .LBE435-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB436-.Ltext0
+	.uleb128 .LBE436-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB437-.Ltext0
+	.uleb128 .LBE437-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB445-.Ltext0
+	.uleb128 .LBE445-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB454-.Ltext0
+	.uleb128 .LBE454-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB446-.Ltext0
+	.uleb128 .LBE446-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB450-.Ltext0
+	.uleb128 .LBE450-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB451-.Ltext0
+	.uleb128 .LBE451-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB455-.Ltext0
+	.uleb128 .LBE455-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB596-.Ltext0
+	.uleb128 .LBE596-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB597-.Ltext0
+	.uleb128 .LBE597-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB456-.Ltext0
+	.uleb128 .LBE456-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB593-.Ltext0
+	.uleb128 .LBE593-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB595-.Ltext0
+	.uleb128 .LBE595-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB458-.Ltext0
+	.uleb128 .LBE458-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB578-.Ltext0
+	.uleb128 .LBE578-.Ltext0
+	.byte	0
+.LLRL88:
+	.byte	0x4
+	.uleb128 .LBB459-.Ltext0
+	.uleb128 .LBE459-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB489-.Ltext0
+	.uleb128 .LBE489-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB500-.Ltext0
+	.uleb128 .LBE500-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB502-.Ltext0
+	.uleb128 .LBE502-.Ltext0
+	.byte	0
+.LLRL89:
+	.byte	0x4
+	.uleb128 .LBB464-.Ltext0
+	.uleb128 .LBE464-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB491-.Ltext0
+	.uleb128 .LBE491-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB497-.Ltext0
+	.uleb128 .LBE497-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB499-.Ltext0
+	.uleb128 .LBE499-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB469-.Ltext0
+	.uleb128 .LBE469-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB490-.Ltext0
+	.uleb128 .LBE490-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB496-.Ltext0
+	.uleb128 .LBE496-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB498-.Ltext0
+	.uleb128 .LBE498-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB514-.Ltext0
+	.uleb128 .LBE514-.Ltext0
+	.byte	0
+.LLRL91:
+	.byte	0x4
+	.uleb128 .LBB475-.Ltext0
+	.uleb128 .LBE475-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB501-.Ltext0
+	.uleb128 .LBE501-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB507-.Ltext0
+	.uleb128 .LBE507-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB479-.Ltext0
+	.uleb128 .LBE479-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB503-.Ltext0
+	.uleb128 .LBE503-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB517-.Ltext0
+	.uleb128 .LBE517-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB519-.Ltext0
+	.uleb128 .LBE519-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB484-.Ltext0
+	.uleb128 .LBE484-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB495-.Ltext0
+	.uleb128 .LBE495-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB518-.Ltext0
+	.uleb128 .LBE518-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB520-.Ltext0
+	.uleb128 .LBE520-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB492-.Ltext0
+	.uleb128 .LBE492-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB515-.Ltext0
+	.uleb128 .LBE515-.Ltext0
+	.byte	0
+.LLRL95:
+	.byte	0x4
+	.uleb128 .LBB504-.Ltext0
+	.uleb128 .LBE504-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB521-.Ltext0
+	.uleb128 .LBE521-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB508-.Ltext0
+	.uleb128 .LBE508-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB516-.Ltext0
+	.uleb128 .LBE516-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB522-.Ltext0
+	.uleb128 .LBE522-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB523-.Ltext0
+	.uleb128 .LBE523-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB579-.Ltext0
+	.uleb128 .LBE579-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB524-.Ltext0
+	.uleb128 .LBE524-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB541-.Ltext0
+	.uleb128 .LBE541-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB527-.Ltext0
+	.uleb128 .LBE527-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB550-.Ltext0
+	.uleb128 .LBE550-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB569-.Ltext0
+	.uleb128 .LBE569-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB571-.Ltext0
+	.uleb128 .LBE571-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB532-.Ltext0
+	.uleb128 .LBE532-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB553-.Ltext0
+	.uleb128 .LBE553-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB570-.Ltext0
+	.uleb128 .LBE570-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB536-.Ltext0
+	.uleb128 .LBE536-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB556-.Ltext0
+	.uleb128 .LBE556-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB573-.Ltext0
+	.uleb128 .LBE573-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB575-.Ltext0
+	.uleb128 .LBE575-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB542-.Ltext0
+	.uleb128 .LBE542-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB548-.Ltext0
+	.uleb128 .LBE548-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB545-.Ltext0
+	.uleb128 .LBE545-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB549-.Ltext0
+	.uleb128 .LBE549-.Ltext0
+	.byte	0
+.LLRL107:
+	.byte	0x4
+	.uleb128 .LBB559-.Ltext0
+	.uleb128 .LBE559-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB574-.Ltext0
+	.uleb128 .LBE574-.Ltext0
+	.byte	0
+.LLRL108:
+	.byte	0x4
+	.uleb128 .LBB562-.Ltext0
+	.uleb128 .LBE562-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB572-.Ltext0
+	.uleb128 .LBE572-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB576-.Ltext0
+	.uleb128 .LBE576-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB566-.Ltext0
+	.uleb128 .LBE566-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB577-.Ltext0
+	.uleb128 .LBE577-.Ltext0
+	.byte	0
+.LLRL110:
+	.byte	0x4
+	.uleb128 .LBB580-.Ltext0
+	.uleb128 .LBE580-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB586-.Ltext0
+	.uleb128 .LBE586-.Ltext0
+	.byte	0
+.LLRL112:
+	.byte	0x4
+	.uleb128 .LBB583-.Ltext0
+	.uleb128 .LBE583-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB587-.Ltext0
+	.uleb128 .LBE587-.Ltext0
+	.byte	0
+.LLRL113:
+	.byte	0x4
+	.uleb128 .LBB590-.Ltext0
+	.uleb128 .LBE590-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB594-.Ltext0
+	.uleb128 .LBE594-.Ltext0
+	.byte	0
+.LLRL115:
+	.byte	0x4
+	.uleb128 .LBB598-.Ltext0
+	.uleb128 .LBE598-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB608-.Ltext0
+	.uleb128 .LBE608-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB609-.Ltext0
+	.uleb128 .LBE609-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB610-.Ltext0
+	.uleb128 .LBE610-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB611-.Ltext0
+	.uleb128 .LBE611-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB612-.Ltext0
+	.uleb128 .LBE612-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB613-.Ltext0
+	.uleb128 .LBE613-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB614-.Ltext0
+	.uleb128 .LBE614-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB615-.Ltext0
+	.uleb128 .LBE615-.Ltext0
+	.byte	0
+.LLRL131:
+	.byte	0x4
+	.uleb128 .LBB655-.Ltext0
+	.uleb128 .LBE655-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB695-.Ltext0
+	.uleb128 .LBE695-.Ltext0
+	.byte	0
+.LLRL135:
+	.byte	0x4
+	.uleb128 .LBB657-.Ltext0
+	.uleb128 .LBE657-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB686-.Ltext0
+	.uleb128 .LBE686-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB692-.Ltext0
+	.uleb128 .LBE692-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB658-.Ltext0
+	.uleb128 .LBE658-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB661-.Ltext0
+	.uleb128 .LBE661-.Ltext0
+	.byte	0
+.LLRL141:
+	.byte	0x4
+	.uleb128 .LBB662-.Ltext0
+	.uleb128 .LBE662-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB674-.Ltext0
+	.uleb128 .LBE674-.Ltext0
+	.byte	0
+.LLRL146:
+	.byte	0x4
+	.uleb128 .LBB668-.Ltext0
+	.uleb128 .LBE668-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB672-.Ltext0
+	.uleb128 .LBE672-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB673-.Ltext0
+	.uleb128 .LBE673-.Ltext0
+	.byte	0
+.LLRL148:
+	.byte	0x4
+	.uleb128 .LBB675-.Ltext0
+	.uleb128 .LBE675-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB684-.Ltext0
+	.uleb128 .LBE684-.Ltext0
+	.byte	0
+.LLRL153:
+	.byte	0x4
+	.uleb128 .LBB679-.Ltext0
+	.uleb128 .LBE679-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB685-.Ltext0
+	.uleb128 .LBE685-.Ltext0
+	.byte	0
+.LLRL157:
+	.byte	0x4
+	.uleb128 .LBB687-.Ltext0
+	.uleb128 .LBE687-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB693-.Ltext0
+	.uleb128 .LBE693-.Ltext0
+	.byte	0
+.LLRL164:
+	.byte	0x4
+	.uleb128 .LBB700-.Ltext0
+	.uleb128 .LBE700-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB705-.Ltext0
+	.uleb128 .LBE705-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB706-.Ltext0
+	.uleb128 .LBE706-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB709-.Ltext0
+	.uleb128 .LBE709-.Ltext0
+	.byte	0
+.LLRL177:
+	.byte	0x4
+	.uleb128 .LBB723-.Ltext0
+	.uleb128 .LBE723-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB726-.Ltext0
+	.uleb128 .LBE726-.Ltext0
+	.byte	0
+.LLRL205:
+	.byte	0x4
+	.uleb128 .LBB766-.Ltext0
+	.uleb128 .LBE766-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB769-.Ltext0
+	.uleb128 .LBE769-.Ltext0
+	.byte	0
+.LLRL208:
+	.byte	0x4
+	.uleb128 .LBB770-.Ltext0
+	.uleb128 .LBE770-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB771-.Ltext0
+	.uleb128 .LBE771-.Ltext0
+	.byte	0
+.LLRL211:
+	.byte	0x4
+	.uleb128 .LBB773-.Ltext0
+	.uleb128 .LBE773-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB774-.Ltext0
+	.uleb128 .LBE774-.Ltext0
+	.byte	0
+.LLRL213:
+	.byte	0x4
+	.uleb128 .LBB775-.Ltext0
+	.uleb128 .LBE775-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB779-.Ltext0
+	.uleb128 .LBE779-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB780-.Ltext0
+	.uleb128 .LBE780-.Ltext0
+	.byte	0
+.LLRL216:
+	.byte	0x4
+	.uleb128 .LBB781-.Ltext0
+	.uleb128 .LBE781-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB820-.Ltext0
+	.uleb128 .LBE820-.Ltext0
+	.byte	0
+.LLRL223:
+	.byte	0x4
+	.uleb128 .LBB787-.Ltext0
+	.uleb128 .LBE787-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB795-.Ltext0
+	.uleb128 .LBE795-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB800-.Ltext0
+	.uleb128 .LBE800-.Ltext0
+	.byte	0
+.LLRL226:
+	.byte	0x4
+	.uleb128 .LBB789-.Ltext0
+	.uleb128 .LBE789-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB792-.Ltext0
+	.uleb128 .LBE792-.Ltext0
+	.byte	0
+.LLRL228:
+	.byte	0x4
+	.uleb128 .LBB796-.Ltext0
+	.uleb128 .LBE796-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB801-.Ltext0
+	.uleb128 .LBE801-.Ltext0
+	.byte	0
+.LLRL230:
+	.byte	0x4
+	.uleb128 .LBB797-.Ltext0
+	.uleb128 .LBE797-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB798-.Ltext0
+	.uleb128 .LBE798-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB799-.Ltext0
+	.uleb128 .LBE799-.Ltext0
+	.byte	0
+.LLRL232:
+	.byte	0x4
+	.uleb128 .LBB802-.Ltext0
+	.uleb128 .LBE802-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB810-.Ltext0
+	.uleb128 .LBE810-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB816-.Ltext0
+	.uleb128 .LBE816-.Ltext0
+	.byte	0
+.LLRL235:
+	.byte	0x4
+	.uleb128 .LBB804-.Ltext0
+	.uleb128 .LBE804-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB807-.Ltext0
+	.uleb128 .LBE807-.Ltext0
+	.byte	0
+.LLRL237:
+	.byte	0x4
+	.uleb128 .LBB811-.Ltext0
+	.uleb128 .LBE811-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB817-.Ltext0
+	.uleb128 .LBE817-.Ltext0
+	.byte	0
+.LLRL239:
+	.byte	0x4
+	.uleb128 .LBB812-.Ltext0
+	.uleb128 .LBE812-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB813-.Ltext0
+	.uleb128 .LBE813-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB814-.Ltext0
+	.uleb128 .LBE814-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB815-.Ltext0
+	.uleb128 .LBE815-.Ltext0
+	.byte	0
+.LLRL261:
+	.byte	0x4
+	.uleb128 .LBB837-.Ltext0
+	.uleb128 .LBE837-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB844-.Ltext0
+	.uleb128 .LBE844-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB845-.Ltext0
+	.uleb128 .LBE845-.Ltext0
+	.byte	0
+.LLRL266:
+	.byte	0x4
+	.uleb128 .LBB839-.Ltext0
+	.uleb128 .LBE839-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB840-.Ltext0
+	.uleb128 .LBE840-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB841-.Ltext0
+	.uleb128 .LBE841-.Ltext0
+	.byte	0
+.LLRL278:
+	.byte	0x4
+	.uleb128 .LBB858-.Ltext0
+	.uleb128 .LBE858-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB861-.Ltext0
+	.uleb128 .LBE861-.Ltext0
+	.byte	0
+.LLRL287:
+	.byte	0x4
+	.uleb128 .LBB865-.Ltext0
+	.uleb128 .LBE865-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB869-.Ltext0
+	.uleb128 .LBE869-.Ltext0
+	.byte	0
+.LLRL313:
+	.byte	0x4
+	.uleb128 .LBB902-.Ltext0
+	.uleb128 .LBE902-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB922-.Ltext0
+	.uleb128 .LBE922-.Ltext0
+	.byte	0
+.LLRL315:
+	.byte	0x4
+	.uleb128 .LBB903-.Ltext0
+	.uleb128 .LBE903-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB907-.Ltext0
+	.uleb128 .LBE907-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB908-.Ltext0
+	.uleb128 .LBE908-.Ltext0
+	.byte	0
+.LLRL318:
+	.byte	0x4
+	.uleb128 .LBB909-.Ltext0
+	.uleb128 .LBE909-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB920-.Ltext0
+	.uleb128 .LBE920-.Ltext0
+	.byte	0
+.LLRL322:
+	.byte	0x4
+	.uleb128 .LBB911-.Ltext0
+	.uleb128 .LBE911-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB912-.Ltext0
+	.uleb128 .LBE912-.Ltext0
+	.byte	0
+.LLRL324:
+	.byte	0x4
+	.uleb128 .LBB914-.Ltext0
+	.uleb128 .LBE914-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB921-.Ltext0
+	.uleb128 .LBE921-.Ltext0
+	.byte	0
+.LLRL329:
+	.byte	0x4
+	.uleb128 .LBB916-.Ltext0
+	.uleb128 .LBE916-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB918-.Ltext0
+	.uleb128 .LBE918-.Ltext0
+	.byte	0
+.LLRL333:
+	.byte	0x4
+	.uleb128 .LBB923-.Ltext0
+	.uleb128 .LBE923-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB935-.Ltext0
+	.uleb128 .LBE935-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB936-.Ltext0
+	.uleb128 .LBE936-.Ltext0
+	.byte	0
+.LLRL338:
+	.byte	0x4
+	.uleb128 .LBB926-.Ltext0
+	.uleb128 .LBE926-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB927-.Ltext0
+	.uleb128 .LBE927-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB928-.Ltext0
+	.uleb128 .LBE928-.Ltext0
+	.byte	0
+.LLRL340:
+	.byte	0x4
+	.uleb128 .LBB929-.Ltext0
+	.uleb128 .LBE929-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB932-.Ltext0
+	.uleb128 .LBE932-.Ltext0
+	.byte	0
+.LLRL345:
+	.byte	0x4
+	.uleb128 .LBB933-.Ltext0
+	.uleb128 .LBE933-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB934-.Ltext0
+	.uleb128 .LBE934-.Ltext0
+	.byte	0
+.LLRL348:
+	.byte	0x4
+	.uleb128 .LBB937-.Ltext0
+	.uleb128 .LBE937-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB947-.Ltext0
+	.uleb128 .LBE947-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB949-.Ltext0
+	.uleb128 .LBE949-.Ltext0
+	.byte	0
+.LLRL351:
+	.byte	0x4
+	.uleb128 .LBB941-.Ltext0
+	.uleb128 .LBE941-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB948-.Ltext0
+	.uleb128 .LBE948-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB950-.Ltext0
+	.uleb128 .LBE950-.Ltext0
+	.byte	0
+.LLRL355:
+	.byte	0x4
+	.uleb128 .LBB943-.Ltext0
+	.uleb128 .LBE943-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB944-.Ltext0
+	.uleb128 .LBE944-.Ltext0
+	.byte	0
+.LLRL366:
+	.byte	0x4
+	.uleb128 .LBB958-.Ltext0
+	.uleb128 .LBE958-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB959-.Ltext0
+	.uleb128 .LBE959-.Ltext0
+	.byte	0
+.LLRL377:
+	.byte	0x4
+	.uleb128 .LBB1019-.Ltext0
+	.uleb128 .LBE1019-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1024-.Ltext0
+	.uleb128 .LBE1024-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1025-.Ltext0
+	.uleb128 .LBE1025-.Ltext0
+	.byte	0
+.LLRL395:
+	.byte	0x4
+	.uleb128 .LBB1032-.Ltext0
+	.uleb128 .LBE1032-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1037-.Ltext0
+	.uleb128 .LBE1037-.Ltext0
+	.byte	0
+.LLRL400:
+	.byte	0x4
+	.uleb128 .LBB1039-.Ltext0
+	.uleb128 .LBE1039-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1050-.Ltext0
+	.uleb128 .LBE1050-.Ltext0
+	.byte	0
+.LLRL402:
+	.byte	0x4
+	.uleb128 .LBB1040-.Ltext0
+	.uleb128 .LBE1040-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1047-.Ltext0
+	.uleb128 .LBE1047-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1048-.Ltext0
+	.uleb128 .LBE1048-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1049-.Ltext0
+	.uleb128 .LBE1049-.Ltext0
+	.byte	0
+.LLRL410:
+	.byte	0x4
+	.uleb128 .LBB1042-.Ltext0
+	.uleb128 .LBE1042-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1043-.Ltext0
+	.uleb128 .LBE1043-.Ltext0
+	.byte	0
+.LLRL414:
+	.byte	0x4
+	.uleb128 .LBB1051-.Ltext0
+	.uleb128 .LBE1051-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1052-.Ltext0
+	.uleb128 .LBE1052-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1053-.Ltext0
+	.uleb128 .LBE1053-.Ltext0
+	.byte	0
+.LLRL432:
+	.byte	0x4
+	.uleb128 .LBB1070-.Ltext0
+	.uleb128 .LBE1070-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1071-.Ltext0
+	.uleb128 .LBE1071-.Ltext0
+	.byte	0
+.LLRL450:
+	.byte	0x4
+	.uleb128 .LBB1089-.Ltext0
+	.uleb128 .LBE1089-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1095-.Ltext0
+	.uleb128 .LBE1095-.Ltext0
+	.byte	0
+.LLRL459:
+	.byte	0x4
+	.uleb128 .LBB1093-.Ltext0
+	.uleb128 .LBE1093-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1094-.Ltext0
+	.uleb128 .LBE1094-.Ltext0
+	.byte	0
+.LLRL462:
+	.byte	0x4
+	.uleb128 .LBB1099-.Ltext0
+	.uleb128 .LBE1099-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1102-.Ltext0
+	.uleb128 .LBE1102-.Ltext0
+	.byte	0
+.LLRL470:
+	.byte	0x4
+	.uleb128 .LBB1108-.Ltext0
+	.uleb128 .LBE1108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1119-.Ltext0
+	.uleb128 .LBE1119-.Ltext0
+	.byte	0
+.LLRL478:
+	.byte	0x4
+	.uleb128 .LBB1111-.Ltext0
+	.uleb128 .LBE1111-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1116-.Ltext0
+	.uleb128 .LBE1116-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1117-.Ltext0
+	.uleb128 .LBE1117-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1118-.Ltext0
+	.uleb128 .LBE1118-.Ltext0
+	.byte	0
+.LLRL487:
+	.byte	0x4
+	.uleb128 .LBB1139-.Ltext0
+	.uleb128 .LBE1139-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1203-.Ltext0
+	.uleb128 .LBE1203-.Ltext0
+	.byte	0
+.LLRL489:
+	.byte	0x4
+	.uleb128 .LBB1140-.Ltext0
+	.uleb128 .LBE1140-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1144-.Ltext0
+	.uleb128 .LBE1144-.Ltext0
+	.byte	0
+.LLRL495:
+	.byte	0x4
+	.uleb128 .LBB1145-.Ltext0
+	.uleb128 .LBE1145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1202-.Ltext0
+	.uleb128 .LBE1202-.Ltext0
+	.byte	0
+.LLRL500:
+	.byte	0x4
+	.uleb128 .LBB1147-.Ltext0
+	.uleb128 .LBE1147-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1148-.Ltext0
+	.uleb128 .LBE1148-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1149-.Ltext0
+	.uleb128 .LBE1149-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1150-.Ltext0
+	.uleb128 .LBE1150-.Ltext0
+	.byte	0
+.LLRL503:
+	.byte	0x4
+	.uleb128 .LBB1151-.Ltext0
+	.uleb128 .LBE1151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1152-.Ltext0
+	.uleb128 .LBE1152-.Ltext0
+	.byte	0
+.LLRL505:
+	.byte	0x4
+	.uleb128 .LBB1153-.Ltext0
+	.uleb128 .LBE1153-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1200-.Ltext0
+	.uleb128 .LBE1200-.Ltext0
+	.byte	0
+.LLRL510:
+	.byte	0x4
+	.uleb128 .LBB1154-.Ltext0
+	.uleb128 .LBE1154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1196-.Ltext0
+	.uleb128 .LBE1196-.Ltext0
+	.byte	0
+.LLRL512:
+	.byte	0x4
+	.uleb128 .LBB1155-.Ltext0
+	.uleb128 .LBE1155-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1197-.Ltext0
+	.uleb128 .LBE1197-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1199-.Ltext0
+	.uleb128 .LBE1199-.Ltext0
+	.byte	0
+.LLRL514:
+	.byte	0x4
+	.uleb128 .LBB1156-.Ltext0
+	.uleb128 .LBE1156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1195-.Ltext0
+	.uleb128 .LBE1195-.Ltext0
+	.byte	0
+.LLRL516:
+	.byte	0x4
+	.uleb128 .LBB1157-.Ltext0
+	.uleb128 .LBE1157-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1178-.Ltext0
+	.uleb128 .LBE1178-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1180-.Ltext0
+	.uleb128 .LBE1180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1182-.Ltext0
+	.uleb128 .LBE1182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1184-.Ltext0
+	.uleb128 .LBE1184-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1186-.Ltext0
+	.uleb128 .LBE1186-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1188-.Ltext0
+	.uleb128 .LBE1188-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1190-.Ltext0
+	.uleb128 .LBE1190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1192-.Ltext0
+	.uleb128 .LBE1192-.Ltext0
+	.byte	0
+.LLRL519:
+	.byte	0x4
+	.uleb128 .LBB1167-.Ltext0
+	.uleb128 .LBE1167-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1179-.Ltext0
+	.uleb128 .LBE1179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1181-.Ltext0
+	.uleb128 .LBE1181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1183-.Ltext0
+	.uleb128 .LBE1183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1185-.Ltext0
+	.uleb128 .LBE1185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1187-.Ltext0
+	.uleb128 .LBE1187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1189-.Ltext0
+	.uleb128 .LBE1189-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1191-.Ltext0
+	.uleb128 .LBE1191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1193-.Ltext0
+	.uleb128 .LBE1193-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1194-.Ltext0
+	.uleb128 .LBE1194-.Ltext0
+	.byte	0
+.LLRL527:
+	.byte	0x4
+	.uleb128 .LBB1212-.Ltext0
+	.uleb128 .LBE1212-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1217-.Ltext0
+	.uleb128 .LBE1217-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1218-.Ltext0
+	.uleb128 .LBE1218-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1219-.Ltext0
+	.uleb128 .LBE1219-.Ltext0
+	.byte	0
+.LLRL530:
+	.byte	0x4
+	.uleb128 .LBB1220-.Ltext0
+	.uleb128 .LBE1220-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1225-.Ltext0
+	.uleb128 .LBE1225-.Ltext0
+	.byte	0
+.LLRL534:
+	.byte	0x4
+	.uleb128 .LBB1222-.Ltext0
+	.uleb128 .LBE1222-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1223-.Ltext0
+	.uleb128 .LBE1223-.Ltext0
+	.byte	0
+.LLRL537:
+	.byte	0x4
+	.uleb128 .LBB1226-.Ltext0
+	.uleb128 .LBE1226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1229-.Ltext0
+	.uleb128 .LBE1229-.Ltext0
+	.byte	0
+.LLRL548:
+	.byte	0x4
+	.uleb128 .LBB1232-.Ltext0
+	.uleb128 .LBE1232-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1236-.Ltext0
+	.uleb128 .LBE1236-.Ltext0
+	.byte	0
+.LLRL556:
+	.byte	0x4
+	.uleb128 .LBB1239-.Ltext0
+	.uleb128 .LBE1239-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1243-.Ltext0
+	.uleb128 .LBE1243-.Ltext0
+	.byte	0
+.LLRL561:
+	.byte	0x4
+	.uleb128 .LBB1244-.Ltext0
+	.uleb128 .LBE1244-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1245-.Ltext0
+	.uleb128 .LBE1245-.Ltext0
+	.byte	0
+.LLRL565:
+	.byte	0x4
+	.uleb128 .LBB1246-.Ltext0
+	.uleb128 .LBE1246-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1249-.Ltext0
+	.uleb128 .LBE1249-.Ltext0
+	.byte	0
+.LLRL567:
+	.byte	0x4
+	.uleb128 .LBB1247-.Ltext0
+	.uleb128 .LBE1247-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1248-.Ltext0
+	.uleb128 .LBE1248-.Ltext0
+	.byte	0
+.LLRL574:
+	.byte	0x4
+	.uleb128 .LBB1250-.Ltext0
+	.uleb128 .LBE1250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1251-.Ltext0
+	.uleb128 .LBE1251-.Ltext0
+	.byte	0
+.LLRL580:
+	.byte	0x4
+	.uleb128 .LBB1252-.Ltext0
+	.uleb128 .LBE1252-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1253-.Ltext0
+	.uleb128 .LBE1253-.Ltext0
+	.byte	0
+.LLRL587:
+	.byte	0x4
+	.uleb128 .LBB1254-.Ltext0
+	.uleb128 .LBE1254-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1255-.Ltext0
+	.uleb128 .LBE1255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1256-.Ltext0
+	.uleb128 .LBE1256-.Ltext0
+	.byte	0
+.LLRL592:
+	.byte	0x4
+	.uleb128 .LBB1257-.Ltext0
+	.uleb128 .LBE1257-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1258-.Ltext0
+	.uleb128 .LBE1258-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1259-.Ltext0
+	.uleb128 .LBE1259-.Ltext0
+	.byte	0
+.LLRL617:
+	.byte	0x4
+	.uleb128 .LBB1263-.Ltext0
+	.uleb128 .LBE1263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1268-.Ltext0
+	.uleb128 .LBE1268-.Ltext0
+	.byte	0
+.LLRL620:
+	.byte	0x4
+	.uleb128 .LBB1265-.Ltext0
+	.uleb128 .LBE1265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1266-.Ltext0
+	.uleb128 .LBE1266-.Ltext0
+	.byte	0
+.LLRL653:
+	.byte	0x4
+	.uleb128 .LBB1280-.Ltext0
+	.uleb128 .LBE1280-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1285-.Ltext0
+	.uleb128 .LBE1285-.Ltext0
+	.byte	0
+.LLRL656:
+	.byte	0x4
+	.uleb128 .LBB1282-.Ltext0
+	.uleb128 .LBE1282-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1283-.Ltext0
+	.uleb128 .LBE1283-.Ltext0
+	.byte	0
+.LLRL661:
+	.byte	0x4
+	.uleb128 .LBB1286-.Ltext0
+	.uleb128 .LBE1286-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1289-.Ltext0
+	.uleb128 .LBE1289-.Ltext0
+	.byte	0
+.LLRL679:
+	.byte	0x4
+	.uleb128 .LBB1290-.Ltext0
+	.uleb128 .LBE1290-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1291-.Ltext0
+	.uleb128 .LBE1291-.Ltext0
+	.byte	0
+.LLRL686:
+	.byte	0x4
+	.uleb128 .LBB1294-.Ltext0
+	.uleb128 .LBE1294-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB1297-.Ltext0
+	.uleb128 .LBE1297-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF386
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF630
+	.byte	0x4
+	.byte	0x4
+	.file 24 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF632
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF633
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF674
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF734
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF735
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF736
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 30 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF796
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 31 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF799
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 32 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF802
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF897
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/xmmintrin.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF898
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mmintrin.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF899
+	.byte	0x4
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mm_malloc.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF900
+	.file 36 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF589
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF902
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF938
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 41 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF980
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF981
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF982
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF983
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF605
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF984
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF985
+	.file 47 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF986
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1003
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1016
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1021
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1024
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1025
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1042
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1043
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1044
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1056
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1063
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1064
+	.byte	0x4
+	.byte	0x4
+	.file 64 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1068
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x524
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1093
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x89c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x8ae
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xabf
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0xac1
+	.long	.LASF1115
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF437
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF451
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF452
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF513
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF531
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF539
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.40.d34159d34f444de373121677553af6a7,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF545
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdatomic.h.27.ba2a7422094b892a845a1efe65d25dc2,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF587
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF589
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF602
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF604
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF606
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF625
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF627
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF628
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF605
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF625
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF628
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF646
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF663
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF664
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF665
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF627
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF667
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF672
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF605
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF625
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF665
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF627
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF666
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF689
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF731
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF733
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF795
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF821
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.13.ba8b097355bd637e9189dfa7d96daa61,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF896
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF606
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF911
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF923
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF930
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF937
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF959
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF965
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF979
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF990
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF992
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF994
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF998
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1002
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1020
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1023
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1037
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1041
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1055
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1059
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1062
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF605
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1067
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.xmmintrin.h.78.59bb12a08107158c4936dd3dc3443849,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x516
+	.long	.LASF1092
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1041:
+	.string	"__fsfilcnt_t_defined "
+.LASF992:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1263:
+	.string	"va_stream_get_error_f"
+.LASF933:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1051:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF571:
+	.ascii	"atomic_compare_exchange_weak_explicit(PTR,VAL,DES,SUC,FAIL) "
+	.ascii	"__extension__ ({ __aut"
+	.string	"o_type __atomic_compare_exchange_ptr = (PTR); __typeof__ ((void)0, *__atomic_compare_exchange_ptr) __atomic_compare_exchange_tmp = (DES); __atomic_compare_exchange (__atomic_compare_exchange_ptr, (VAL), &__atomic_compare_exchange_tmp, 1, (SUC), (FAIL)); })"
+.LASF930:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF832:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF422:
+	.string	"__USE_ISOC11 1"
+.LASF1387:
+	.string	"render_quote_sh"
+.LASF946:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1281:
+	.string	"start"
+.LASF566:
+	.string	"atomic_load(PTR) atomic_load_explicit (PTR, __ATOMIC_SEQ_CST)"
+.LASF549:
+	.string	"kill_dependency(Y) __extension__ ({ __auto_type __kill_dependency_tmp = (Y); __kill_dependency_tmp; })"
+.LASF953:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF740:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF859:
+	.string	"VA_MODE_X7 7"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF815:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF1118:
+	.string	"memory_order_acquire"
+.LASF1265:
+	.string	"va_xprintf_schar"
+.LASF1327:
+	.string	"digit2"
+.LASF402:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF501:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF785:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF1010:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1371:
+	.string	"render_quote_put"
+.LASF1224:
+	.string	"format_scratch_vtab"
+.LASF880:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF414:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF981:
+	.string	"__clockid_t_defined 1"
+.LASF407:
+	.string	"__USE_ATFILE"
+.LASF476:
+	.string	"__flexarr []"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF722:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1085:
+	.string	"_MM_ROUND_NEAREST 0x0000"
+.LASF834:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF817:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1019:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF440:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1216:
+	.string	"plain_t"
+.LASF788:
+	.string	"VA_E_OK 0"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF871:
+	.string	"VA_QUOTE_K 4"
+.LASF849:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1367:
+	.string	"ahead_end"
+.LASF1189:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF818:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF1039:
+	.string	"__blkcnt_t_defined "
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1037:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1295:
+	.string	"ensure_init"
+.LASF783:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF666:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF905:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1314:
+	.string	"val2_"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF670:
+	.string	"true 1"
+.LASF798:
+	.string	"va_char_p_decode utf8"
+.LASF1332:
+	.string	"render_custom"
+.LASF1336:
+	.string	"custom_put"
+.LASF782:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF1243:
+	.string	"off8"
+.LASF914:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1048:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1345:
+	.string	"check_bulk"
+.LASF568:
+	.string	"atomic_exchange(PTR,VAL) atomic_exchange_explicit (PTR, VAL, __ATOMIC_SEQ_CST)"
+.LASF490:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF569:
+	.ascii	"atomic_compare_exchange_strong_explicit(PTR,VAL,DES,SUC,FAIL"
+	.ascii	") __extension__ ({ __aut"
+	.string	"o_type __atomic_compare_exchange_ptr = (PTR); __typeof__ ((void)0, *__atomic_compare_exchange_ptr) __atomic_compare_exchange_tmp = (DES); __atomic_compare_exchange (__atomic_compare_exchange_ptr, (VAL), &__atomic_compare_exchange_tmp, 0, (SUC), (FAIL)); })"
+.LASF709:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF749:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF1029:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF734:
+	.string	"__STD_TYPE"
+.LASF541:
+	.string	"_ASSERT_H_DECLS "
+.LASF1249:
+	.string	"va_xprintf_last_ptr"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF1233:
+	.string	"get_vtab"
+.LASF1022:
+	.string	"____sigset_t_defined "
+.LASF529:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF463:
+	.string	"__P(args) args"
+.LASF985:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF962:
+	.string	"RAND_MAX 2147483647"
+.LASF814:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1050:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF608:
+	.string	"__SIZE_T__ "
+.LASF778:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF1102:
+	.string	"PLAIN_BLOCK 16U"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF893:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF702:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF392:
+	.string	"__USE_POSIX"
+.LASF786:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1242:
+	.string	"off16"
+.LASF1307:
+	.string	"render_lit"
+.LASF665:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1143:
+	.string	"take"
+.LASF955:
+	.string	"__f64x(x) x ##f64x"
+.LASF1142:
+	.string	"type"
+.LASF547:
+	.string	"ATOMIC_VAR_INIT(VALUE) (VALUE)"
+.LASF876:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF1274:
+	.string	"va_xprintf_ulong"
+.LASF575:
+	.string	"atomic_fetch_sub(PTR,VAL) __atomic_fetch_sub ((PTR), (VAL), __ATOMIC_SEQ_CST)"
+.LASF940:
+	.string	"__HAVE_FLOAT32 1"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF622:
+	.string	"_GCC_SIZE_T "
+.LASF1285:
+	.string	"spec_end"
+.LASF408:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF733:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF889:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF1000:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1262:
+	.string	"va_xprintf_error_t_p"
+.LASF1241:
+	.string	"off_fmt"
+.LASF686:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF841:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF451:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1399:
+	.string	"va_stream_render"
+.LASF988:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF425:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF612:
+	.string	"_T_SIZE "
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF759:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF1174:
+	.string	"finish"
+.LASF744:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF775:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF896:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF390:
+	.string	"__USE_ISOC95"
+.LASF1396:
+	.string	"check_flush_sh"
+.LASF956:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF742:
+	.string	"VA_NIX "
+.LASF1273:
+	.string	"va_xprintf_bool"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF405:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF630:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1061:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1112:
+	.ascii	"RENDER_LOOP_X(s,astval,r"
+	.string	"ender,always) do{ bool last = !!(s->opt & VA_OPT_LAST); ensure_init(s); unsigned u; do { if (set_ast(s, astval) && ((always) || ((s->opt & VA_OPT_SIM) == 0))) { render; } while ((u = parse_format(s)) >= 2) {} } while (u); if (last) { finish(s); } }while(0)"
+.LASF359:
+	.string	"__k8 1"
+.LASF1347:
+	.string	"iter_check_bulk"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1105:
+	.string	"VEC_SET1(C) _mm_set1_epi8((char)(C))"
+.LASF1357:
+	.string	"iter_len_bulk"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF632:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF626:
+	.string	"NULL"
+.LASF978:
+	.string	"__daddr_t_defined "
+.LASF473:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF716:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF796:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF503:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF433:
+	.string	"__USE_POSIX199506 1"
+.LASF862:
+	.string	"VA_STATE_ARG 1"
+.LASF1360:
+	.string	"iter_reserve_bulk"
+.LASF1312:
+	.string	"val_"
+.LASF534:
+	.string	"__stub_fchflags "
+.LASF757:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF634:
+	.string	"_STDDEF_H "
+.LASF941:
+	.string	"__HAVE_FLOAT64 1"
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF711:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1432:
+	.string	"va_u_valid"
+.LASF1114:
+	.string	"EACH(X) [X] = #X,"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF396:
+	.string	"__USE_XOPEN"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF401:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF500:
+	.string	"__always_inline"
+.LASF1391:
+	.string	"emore"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF987:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF412:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1031:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF449:
+	.string	"__GLIBC__ 2"
+.LASF1240:
+	.string	"off32"
+.LASF947:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1129:
+	.string	"long int"
+.LASF441:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF869:
+	.string	"VA_QUOTE_q 2"
+.LASF821:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF1021:
+	.string	"__sigset_t_defined 1"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF478:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF417:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF435:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1342:
+	.string	"resume"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF587:
+	.string	"atomic_flag_clear_explicit(PTR,MO) __atomic_clear ((PTR), (MO))"
+.LASF416:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF641:
+	.string	"_PTRDIFF_T_ "
+.LASF607:
+	.string	"__size_t__ "
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1194:
+	.string	"render_flush"
+.LASF872:
+	.string	"VA_QUOTE_kk 5"
+.LASF1199:
+	.string	"__v2di"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1362:
+	.string	"iter_skip"
+.LASF1017:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1222:
+	.string	"arr1_vtab_16"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF882:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF823:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF502:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1200:
+	.string	"__v2du"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1330:
+	.string	"shift"
+.LASF1128:
+	.string	"short unsigned int"
+.LASF879:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF497:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1341:
+	.string	"copy"
+.LASF481:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF465:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1238:
+	.string	"off_lit"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF707:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF573:
+	.string	"atomic_fetch_add(PTR,VAL) __atomic_fetch_add ((PTR), (VAL), __ATOMIC_SEQ_CST)"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF486:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1231:
+	.string	"va_strerror"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1392:
+	.string	"iter_start"
+.LASF1071:
+	.string	"_MM_EXCEPT_INVALID 0x0001"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF951:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1368:
+	.string	"ahead_start"
+.LASF540:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF903:
+	.string	"WNOHANG 1"
+.LASF1079:
+	.string	"_MM_MASK_DENORM 0x0100"
+.LASF1167:
+	.string	"va_stream_t"
+.LASF794:
+	.string	"VA_E_ARGC 6"
+.LASF1113:
+	.string	"RENDER_LOOP(s,astval,render) RENDER_LOOP_X(s, astval, render, false)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF442:
+	.string	"__USE_MISC 1"
+.LASF592:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF570:
+	.string	"atomic_compare_exchange_strong(PTR,VAL,DES) atomic_compare_exchange_strong_explicit (PTR, VAL, DES, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)"
+.LASF1318:
+	.string	"prefix0"
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1056:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF456:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF771:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF1125:
+	.string	"signed char"
+.LASF682:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF842:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF1220:
+	.string	"custom_put_vtab"
+.LASF1256:
+	.string	"va_xprintf_last_uchar"
+.LASF676:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1423:
+	.string	"__q01"
+.LASF1422:
+	.string	"__q02"
+.LASF1421:
+	.string	"__q03"
+.LASF1420:
+	.string	"__q04"
+.LASF1419:
+	.string	"__q05"
+.LASF1418:
+	.string	"__q06"
+.LASF1417:
+	.string	"__q07"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1415:
+	.string	"__q09"
+.LASF691:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1382:
+	.string	"va_quotation_set"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1333:
+	.string	"__PRETTY_FUNCTION__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF1234:
+	.string	"va_format_compile_f"
+.LASF1276:
+	.string	"va_xprintf_ptr"
+.LASF656:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF601:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF963:
+	.string	"EXIT_FAILURE 1"
+.LASF974:
+	.string	"__off_t_defined "
+.LASF1137:
+	.string	"__uint_least16_t"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1159:
+	.string	"va_format_lit"
+.LASF618:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF415:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1126:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1223:
+	.string	"arr1_vtab_32"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF713:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF464:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1053:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF543:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF745:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF580:
+	.string	"atomic_fetch_xor_explicit(PTR,VAL,MO) __atomic_fetch_xor ((PTR), (VAL), (MO))"
+.LASF968:
+	.string	"__ino_t_defined "
+.LASF1139:
+	.string	"char16_t"
+.LASF555:
+	.string	"ATOMIC_CHAR16_T_LOCK_FREE __GCC_ATOMIC_CHAR16_T_LOCK_FREE"
+.LASF1377:
+	.string	"__atomic_load_ptr"
+.LASF674:
+	.string	"_BITS_TYPES_H 1"
+.LASF1205:
+	.string	"digit2_b32"
+.LASF1414:
+	.string	"__q10"
+.LASF1413:
+	.string	"__q11"
+.LASF1412:
+	.string	"__q12"
+.LASF1411:
+	.string	"__q13"
+.LASF1410:
+	.string	"__q14"
+.LASF1409:
+	.string	"__q15"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF990:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1115:
+	.string	"EACH"
+.LASF1030:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1373:
+	.string	"check_quote_table"
+.LASF772:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF975:
+	.string	"__pid_t_defined "
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1363:
+	.string	"render_ptr"
+.LASF1364:
+	.string	"render_ascii"
+.LASF870:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1036:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1123:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF1317:
+	.string	"type_name"
+.LASF1315:
+	.string	"iter_take_pat"
+.LASF1086:
+	.string	"_MM_ROUND_DOWN 0x2000"
+.LASF1082:
+	.string	"_MM_MASK_UNDERFLOW 0x0800"
+.LASF616:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1195:
+	.string	"table"
+.LASF1348:
+	.string	"iter_plain_bulk"
+.LASF808:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF1183:
+	.string	"value"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF835:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF718:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1157:
+	.string	"alloc"
+.LASF409:
+	.string	"__USE_GNU"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1108:
+	.string	"VEC_OR(A,B) _mm_or_si128(A,B)"
+.LASF1062:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF865:
+	.string	"VA_STATE_SKIP 4"
+.LASF1406:
+	.string	"_mm_loadu_si128"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF937:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF851:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF932:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1271:
+	.string	"va_xprintf_ushort"
+.LASF891:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1093:
+	.string	"_MM_SHUFFLE2(fp1,fp0) (((fp1) << 1) | (fp0))"
+.LASF1100:
+	.string	"PLAIN_SH_CHECK 4"
+.LASF646:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF916:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF537:
+	.string	"__stub_setlogin "
+.LASF1042:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF605:
+	.string	"__need_size_t "
+.LASF900:
+	.string	"_MM_MALLOC_H_INCLUDED "
+.LASF1355:
+	.string	"plain_render"
+.LASF679:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1184:
+	.string	"_pad1"
+.LASF411:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1259:
+	.string	"va_xprintf_last_sint"
+.LASF1350:
+	.string	"plain_run_utf16"
+.LASF1072:
+	.string	"_MM_EXCEPT_DENORM 0x0002"
+.LASF505:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1435:
+	.string	"__m128i_u"
+.LASF1135:
+	.string	"__uint16_t"
+.LASF790:
+	.string	"VA_E_DECODE 2"
+.LASF399:
+	.string	"__USE_XOPEN2K"
+.LASF853:
+	.string	"VA_MODE_B32 1"
+.LASF436:
+	.string	"_ATFILE_SOURCE"
+.LASF485:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF909:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1253:
+	.string	"va_xprintf_last_uint"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1038:
+	.string	"__blksize_t_defined "
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1133:
+	.string	"long double"
+.LASF1215:
+	.string	"other"
+.LASF538:
+	.string	"__stub_sigreturn "
+.LASF837:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF1120:
+	.string	"memory_order_acq_rel"
+.LASF1353:
+	.string	"plain_unit"
+.LASF1310:
+	.string	"e_at"
+.LASF432:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF1416:
+	.string	"__q08"
+.LASF578:
+	.string	"atomic_fetch_or_explicit(PTR,VAL,MO) __atomic_fetch_or ((PTR), (VAL), (MO))"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1104:
+	.string	"VEC_LOAD(P) _mm_loadu_si128((void const *)(P))"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1091:
+	.string	"_MM_FLUSH_ZERO_OFF 0x0000"
+.LASF1078:
+	.string	"_MM_MASK_INVALID 0x0080"
+.LASF928:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1403:
+	.string	"_mm_or_si128"
+.LASF394:
+	.string	"__USE_POSIX199309"
+.LASF942:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1261:
+	.string	"va_xprintf_last_schar"
+.LASF1246:
+	.string	"va_xprintf_last_error_t_p"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF957:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1214:
+	.string	"kind"
+.LASF1370:
+	.string	"render_quote_flush"
+.LASF1351:
+	.string	"plain_run_utf8"
+.LASF922:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1188:
+	.string	"va_format_type"
+.LASF1097:
+	.string	"PLAIN_QUOTE 1"
+.LASF804:
+	.string	"va_char32_p_decode utf32"
+.LASF1080:
+	.string	"_MM_MASK_DIV_ZERO 0x0200"
+.LASF450:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF398:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1045:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1331:
+	.string	"get_prec"
+.LASF737:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF1001:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1008:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF732:
+	.string	"_BITS_TIME64_H 1"
+.LASF1282:
+	.string	"va_xprintf_iter"
+.LASF695:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF583:
+	.string	"ATOMIC_FLAG_INIT { 0 }"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF899:
+	.string	"_MMINTRIN_H_INCLUDED "
+.LASF660:
+	.string	"__INT_WCHAR_T_H "
+.LASF766:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF1069:
+	.string	"_MM_SHUFFLE(fp3,fp2,fp1,fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))"
+.LASF1283:
+	.string	"take_error"
+.LASF1431:
+	.string	"va_stream_set_error"
+.LASF625:
+	.string	"__need_size_t"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF687:
+	.string	"__S64_TYPE long int"
+.LASF1096:
+	.string	"PLAIN_NONE 0"
+.LASF725:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF1389:
+	.string	"render_quote_c"
+.LASF982:
+	.string	"__time_t_defined 1"
+.LASF1025:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF760:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF1388:
+	.string	"render_quote_j"
+.LASF520:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1361:
+	.string	"need"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1349:
+	.string	"plain_run_utf32"
+.LASF727:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF717:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF979:
+	.string	"__key_t_defined "
+.LASF980:
+	.string	"__clock_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF602:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF833:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF1339:
+	.string	"render_iter_algo"
+.LASF861:
+	.string	"VA_STATE_INIT 0"
+.LASF753:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF514:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF669:
+	.string	"bool _Bool"
+.LASF624:
+	.string	"__size_t "
+.LASF1175:
+	.string	"refill"
+.LASF581:
+	.string	"atomic_fetch_and(PTR,VAL) __atomic_fetch_and ((PTR), (VAL), __ATOMIC_SEQ_CST)"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1011:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1304:
+	.string	"ast_arg"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1190:
+	.string	"delim"
+.LASF1329:
+	.string	"blen"
+.LASF762:
+	.string	"VA_REC0() VA_REC0B"
+.LASF806:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1294:
+	.string	"xprintf_sll"
+.LASF998:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1292:
+	.string	"xprintf_bool"
+.LASF1407:
+	.string	"_mm_set1_epi8"
+.LASF1301:
+	.string	"end_of_format"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF439:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1289:
+	.string	"sigil"
+.LASF736:
+	.string	"____mbstate_t_defined 1"
+.LASF479:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1171:
+	.string	"va_quotations_t"
+.LASF839:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF706:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1328:
+	.string	"digit"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF627:
+	.string	"NULL ((void *)0)"
+.LASF1154:
+	.string	"lit_cnt"
+.LASF613:
+	.string	"__SIZE_T "
+.LASF1237:
+	.string	"fmt_len"
+.LASF688:
+	.string	"__U64_TYPE unsigned long int"
+.LASF495:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1252:
+	.string	"va_xprintf_last_ulong"
+.LASF1424:
+	.string	"__q00"
+.LASF1168:
+	.string	"va_stream"
+.LASF642:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF586:
+	.string	"atomic_flag_clear(PTR) __atomic_clear ((PTR), __ATOMIC_SEQ_CST)"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1026:
+	.string	"__suseconds_t_defined "
+.LASF897:
+	.string	"_EMMINTRIN_H_INCLUDED "
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1358:
+	.string	"iter_copy_bulk"
+.LASF553:
+	.string	"ATOMIC_BOOL_LOCK_FREE __GCC_ATOMIC_BOOL_LOCK_FREE"
+.LASF685:
+	.string	"__SLONG32_TYPE int"
+.LASF1006:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1395:
+	.string	"va_quote1_c"
+.LASF1313:
+	.string	"_Type"
+.LASF945:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1394:
+	.string	"va_stream_render_quote_oct"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF590:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF756:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF838:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF972:
+	.string	"__nlink_t_defined "
+.LASF1178:
+	.string	"va_stream_vtab_t"
+.LASF1398:
+	.string	"render_fill"
+.LASF913:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF492:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1278:
+	.string	"va_xprintf_custom"
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1268:
+	.string	"va_xprintf_slong"
+.LASF420:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF789:
+	.string	"VA_E_NULL 1"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF805:
+	.string	"VA_SIGIL '~'"
+.LASF714:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF799:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF1090:
+	.string	"_MM_FLUSH_ZERO_ON 0x8000"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1155:
+	.string	"spec"
+.LASF904:
+	.string	"WUNTRACED 2"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1247:
+	.string	"va_xprintf_last_custom"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF773:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF708:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"VA_E_TRUNC 4"
+.LASF1130:
+	.string	"long unsigned int"
+.LASF1049:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF458:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF791:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF426:
+	.string	"_POSIX_SOURCE"
+.LASF560:
+	.string	"ATOMIC_LONG_LOCK_FREE __GCC_ATOMIC_LONG_LOCK_FREE"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF524:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF536:
+	.string	"__stub_revoke "
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF567:
+	.ascii	"atomic_exchange_explicit(PTR,VAL,MO) __extension__ ({ __auto"
+	.ascii	"_type __atomic_exchange_ptr = (PTR); __typeof__"
+	.string	" ((void)0, *__atomic_exchange_ptr) __atomic_exchange_val = (VAL); __typeof__ ((void)0, *__atomic_exchange_ptr) __atomic_exchange_tmp; __atomic_exchange (__atomic_exchange_ptr, &__atomic_exchange_val, &__atomic_exchange_tmp, (MO)); __atomic_exchange_tmp; })"
+.LASF611:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1081:
+	.string	"_MM_MASK_OVERFLOW 0x0400"
+.LASF395:
+	.string	"__USE_POSIX199506"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1323:
+	.string	"arr1_utf64_take"
+.LASF1138:
+	.string	"__uint_least32_t"
+.LASF1221:
+	.string	"arr1_vtab_8"
+.LASF477:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF644:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1013:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF508:
+	.string	"__restrict_arr __restrict"
+.LASF1208:
+	.string	"quote_j"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF1106:
+	.string	"VEC_EQ(A,B) _mm_cmpeq_epi8(A,B)"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF830:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF459:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF606:
+	.string	"__need_NULL "
+.LASF387:
+	.string	"_FEATURES_H 1"
+.LASF1140:
+	.string	"char32_t"
+.LASF1335:
+	.string	"replay"
+.LASF1180:
+	.string	"va_print_t"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1169:
+	.string	"qctxt"
+.LASF518:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF867:
+	.string	"VA_QUOTE_NONE 0"
+.LASF1287:
+	.string	"sigils"
+.LASF403:
+	.string	"__USE_LARGEFILE"
+.LASF1084:
+	.string	"_MM_ROUND_MASK 0x6000"
+.LASF1376:
+	.string	"which"
+.LASF489:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF843:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF712:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF554:
+	.string	"ATOMIC_CHAR_LOCK_FREE __GCC_ATOMIC_CHAR_LOCK_FREE"
+.LASF966:
+	.string	"_SYS_TYPES_H 1"
+.LASF1356:
+	.string	"iter_transcode_bulk"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF690:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1326:
+	.string	"prefix2"
+.LASF1206:
+	.string	"digit_pair"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1034:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF958:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF726:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF455:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF1269:
+	.string	"va_xprintf_sll"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF638:
+	.string	"_T_PTRDIFF_ "
+.LASF1290:
+	.string	"format_scan"
+.LASF1060:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF846:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF1203:
+	.string	"__m128i"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF577:
+	.string	"atomic_fetch_or(PTR,VAL) __atomic_fetch_or ((PTR), (VAL), __ATOMIC_SEQ_CST)"
+.LASF1272:
+	.string	"va_xprintf_uint"
+.LASF984:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1344:
+	.string	"done_meat"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF428:
+	.string	"_POSIX_C_SOURCE"
+.LASF1380:
+	.string	"va_format_free"
+.LASF976:
+	.string	"__id_t_defined "
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF784:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF1144:
+	.string	"set_chunk_mode"
+.LASF954:
+	.string	"__f32x(x) x ##f32x"
+.LASF1322:
+	.string	"arr1_utf64_end"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF548:
+	.string	"atomic_init(PTR,VAL) atomic_store_explicit (PTR, VAL, __ATOMIC_RELAXED)"
+.LASF927:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1016:
+	.string	"_SYS_SELECT_H 1"
+.LASF651:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF517:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF393:
+	.string	"__USE_POSIX2"
+.LASF1098:
+	.string	"PLAIN_QUOTE_7BIT 2"
+.LASF816:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF1404:
+	.string	"_mm_andnot_si128"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1063:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1136:
+	.string	"__uint32_t"
+.LASF868:
+	.string	"VA_QUOTE_k 1"
+.LASF542:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF886:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF614:
+	.string	"_SIZE_T_ "
+.LASF738:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF809:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF1131:
+	.string	"long long int"
+.LASF631:
+	.string	"_STRINGS_H 1"
+.LASF610:
+	.string	"_SYS_SIZE_T_H "
+.LASF1067:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF793:
+	.string	"VA_E_FORMAT 5"
+.LASF755:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1288:
+	.string	"format_scan_spec"
+.LASF648:
+	.string	"__wchar_t__ "
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF531:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1164:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF563:
+	.string	"atomic_store_explicit(PTR,VAL,MO) __extension__ ({ __auto_type __atomic_store_ptr = (PTR); __typeof__ ((void)0, *__atomic_store_ptr) __atomic_store_tmp = (VAL); __atomic_store (__atomic_store_ptr, &__atomic_store_tmp, (MO)); })"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1172:
+	.string	"va_quotations"
+.LASF763:
+	.string	"VA_REC1() VA_REC1B"
+.LASF828:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF906:
+	.string	"WEXITED 4"
+.LASF950:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF964:
+	.string	"EXIT_SUCCESS 0"
+.LASF550:
+	.string	"atomic_thread_fence(MO) __atomic_thread_fence (MO)"
+.LASF781:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1117:
+	.string	"memory_order_consume"
+.LASF512:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF653:
+	.string	"__WCHAR_T "
+.LASF680:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1198:
+	.string	"double"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF881:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF1266:
+	.string	"va_xprintf_short"
+.LASF1077:
+	.string	"_MM_MASK_MASK 0x1f80"
+.LASF462:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF678:
+	.string	"__U32_TYPE unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1121:
+	.string	"memory_order_seq_cst"
+.LASF822:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF825:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF511:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1173:
+	.string	"init"
+.LASF995:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF453:
+	.string	"__PMT"
+.LASF1374:
+	.string	"render_quote_table"
+.LASF748:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF758:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF1308:
+	.string	"format_find"
+.LASF582:
+	.string	"atomic_fetch_and_explicit(PTR,VAL,MO) __atomic_fetch_and ((PTR), (VAL), (MO))"
+.LASF936:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF855:
+	.string	"VA_MODE_PTR 3"
+.LASF677:
+	.string	"__S32_TYPE int"
+.LASF1235:
+	.string	"iter"
+.LASF1354:
+	.string	"plain_check"
+.LASF1397:
+	.string	"check_quote_sh"
+.LASF1020:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1147:
+	.string	"has_size"
+.LASF1119:
+	.string	"memory_order_release"
+.LASF681:
+	.string	"__SQUAD_TYPE long int"
+.LASF751:
+	.string	"VA_P(X,...) X"
+.LASF684:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF400:
+	.string	"__USE_XOPEN2KXSI"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF410:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF528:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF754:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF1302:
+	.string	"end_of_spec"
+.LASF467:
+	.string	"__ptr_t void *"
+.LASF1219:
+	.string	"custom_needquote_vtab"
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1076:
+	.string	"_MM_EXCEPT_INEXACT 0x0020"
+.LASF1209:
+	.string	"quote_sh"
+.LASF1267:
+	.string	"va_xprintf_sint"
+.LASF523:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1068:
+	.string	"__COMPAR_FN_T "
+.LASF1232:
+	.string	"va_xprintf_init_last_plain"
+.LASF1014:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF829:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF1340:
+	.string	"done_check_quote"
+.LASF919:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1122:
+	.string	"unsigned int"
+.LASF1064:
+	.string	"__have_pthread_attr_t 1"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1074:
+	.string	"_MM_EXCEPT_OVERFLOW 0x0008"
+.LASF812:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF1087:
+	.string	"_MM_ROUND_UP 0x4000"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF454:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1007:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF559:
+	.string	"ATOMIC_INT_LOCK_FREE __GCC_ATOMIC_INT_LOCK_FREE"
+.LASF1166:
+	.string	"va_format_t"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1250:
+	.string	"va_xprintf_last_char"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF668:
+	.string	"_STDBOOL_H "
+.LASF662:
+	.string	"_WCHAR_T_DECLARED "
+.LASF696:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1047:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF434:
+	.string	"__USE_XOPEN2K 1"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF811:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF719:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1057:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF388:
+	.string	"__USE_ISOC11"
+.LASF564:
+	.string	"atomic_store(PTR,VAL) atomic_store_explicit (PTR, VAL, __ATOMIC_SEQ_CST)"
+.LASF639:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF484:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF637:
+	.string	"_PTRDIFF_T "
+.LASF697:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF488:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1066:
+	.string	"alloca"
+.LASF510:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF535:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF715:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1158:
+	.string	"va_read_iter"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF603:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF997:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1207:
+	.string	"quote_c"
+.LASF499:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1151:
+	.string	"vtab"
+.LASF1015:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1186:
+	.string	"va_error_t"
+.LASF565:
+	.string	"atomic_load_explicit(PTR,MO) __extension__ ({ __auto_type __atomic_load_ptr = (PTR); __typeof__ ((void)0, *__atomic_load_ptr) __atomic_load_tmp; __atomic_load (__atomic_load_ptr, &__atomic_load_tmp, (MO)); __atomic_load_tmp; })"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1244:
+	.string	"total"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF457:
+	.string	"__LEAF , __leaf__"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF645:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF475:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF730:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF448:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF694:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1005:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF908:
+	.string	"WNOWAIT 0x01000000"
+.LASF856:
+	.string	"VA_MODE_TYPE 4"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1254:
+	.string	"va_xprintf_last_bool"
+.LASF701:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF562:
+	.string	"ATOMIC_POINTER_LOCK_FREE __GCC_ATOMIC_POINTER_LOCK_FREE"
+.LASF460:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF516:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF515:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF912:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF466:
+	.string	"__STRING(x) #x"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1300:
+	.string	"again"
+.LASF513:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF949:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF926:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF728:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF557:
+	.string	"ATOMIC_WCHAR_T_LOCK_FREE __GCC_ATOMIC_WCHAR_T_LOCK_FREE"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF621:
+	.string	"___int_size_t_h "
+.LASF787:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF650:
+	.string	"_WCHAR_T "
+.LASF1430:
+	.string	"va_store_utf8"
+.LASF943:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1182:
+	.string	"print"
+.LASF629:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF765:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF1211:
+	.string	"va_quote_thread"
+.LASF386:
+	.string	"_ASSERT_H 1"
+.LASF633:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF1352:
+	.string	"plain_block_mask"
+.LASF1124:
+	.string	"char"
+.LASF461:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1163:
+	.string	"va_format_spec"
+.LASF609:
+	.string	"_SIZE_T "
+.LASF658:
+	.string	"_WCHAR_T_H "
+.LASF1299:
+	.string	"plan"
+.LASF863:
+	.string	"VA_STATE_WIDTH 2"
+.LASF1319:
+	.string	"render_bool"
+.LASF1324:
+	.string	"render_int"
+.LASF1179:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF767:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF1343:
+	.string	"at_end"
+.LASF1070:
+	.string	"_MM_EXCEPT_MASK 0x003f"
+.LASF1075:
+	.string	"_MM_EXCEPT_UNDERFLOW 0x0010"
+.LASF703:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1055:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1401:
+	.string	"_mm_cmpgt_epi8"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1316:
+	.string	"render_sll"
+.LASF635:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF584:
+	.string	"atomic_flag_test_and_set(PTR) __atomic_test_and_set ((PTR), __ATOMIC_SEQ_CST)"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF986:
+	.string	"_ENDIAN_H 1"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF1212:
+	.string	"stream_ahead_t"
+.LASF746:
+	.string	"VA_PAR ()"
+.LASF1334:
+	.string	"ahead"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF389:
+	.string	"__USE_ISOC99"
+.LASF1032:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1303:
+	.string	"end_of_flags"
+.LASF589:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF924:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF813:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF935:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1217:
+	.string	"info"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF797:
+	.string	"va_char_p_format utf8"
+.LASF468:
+	.string	"__BEGIN_DECLS "
+.LASF1393:
+	.string	"va_stream_render_quote_u"
+.LASF885:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF496:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF777:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF907:
+	.string	"WCONTINUED 8"
+.LASF1257:
+	.string	"va_xprintf_last_sll"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1023:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF877:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF731:
+	.string	"__FD_SETSIZE 1024"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF710:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1337:
+	.string	"custom_needquote"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1162:
+	.string	"size"
+.LASF769:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF852:
+	.string	"VA_MODE_NORM 0"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1132:
+	.string	"long long unsigned int"
+.LASF636:
+	.string	"_ANSI_STDDEF_H "
+.LASF1258:
+	.string	"va_xprintf_last_slong"
+.LASF948:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF923:
+	.string	"__WCOREFLAG 0x80"
+.LASF1116:
+	.string	"memory_order_relaxed"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF391:
+	.string	"__USE_ISOCXX11"
+.LASF617:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1426:
+	.string	"va_stream_room"
+.LASF1156:
+	.string	"spec_cnt"
+.LASF1433:
+	.string	"va_xprintf_init"
+.LASF640:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1297:
+	.string	"set_ast"
+.LASF1225:
+	.string	"pool"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1018:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF983:
+	.string	"__timer_t_defined 1"
+.LASF429:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1192:
+	.string	"check_flush"
+.LASF1095:
+	.string	"AHEAD_SIZE 64"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF918:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF969:
+	.string	"__dev_t_defined "
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1218:
+	.string	"stream_redirect_t"
+.LASF1170:
+	.string	"quote"
+.LASF827:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1270:
+	.string	"va_xprintf_uchar"
+.LASF1390:
+	.string	"iter_take"
+.LASF413:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1275:
+	.string	"va_xprintf_ull"
+.LASF795:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF989:
+	.string	"__BIG_ENDIAN 4321"
+.LASF406:
+	.string	"__USE_MISC"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF574:
+	.string	"atomic_fetch_add_explicit(PTR,VAL,MO) __atomic_fetch_add ((PTR), (VAL), (MO))"
+.LASF944:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1405:
+	.string	"_mm_and_si128"
+.LASF803:
+	.string	"va_char32_p_format utf32"
+.LASF929:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1153:
+	.string	"va_read_iter_t"
+.LASF438:
+	.string	"__WORDSIZE 64"
+.LASF474:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF807:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF657:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1009:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF539:
+	.string	"__stub_stty "
+.LASF561:
+	.string	"ATOMIC_LLONG_LOCK_FREE __GCC_ATOMIC_LLONG_LOCK_FREE"
+.LASF1245:
+	.string	"va_xprintf_init_last"
+.LASF620:
+	.string	"__DEFINED_size_t "
+.LASF699:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1379:
+	.string	"va_quotations_thread"
+.LASF820:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF527:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1004:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1229:
+	.string	"__assert_fail"
+.LASF471:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF615:
+	.string	"_BSD_SIZE_T_ "
+.LASF628:
+	.string	"__need_NULL"
+.LASF1145:
+	.string	"bulk"
+.LASF1228:
+	.string	"memset"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF1402:
+	.string	"_mm_cmpeq_epi8"
+.LASF572:
+	.string	"atomic_compare_exchange_weak(PTR,VAL,DES) atomic_compare_exchange_weak_explicit (PTR, VAL, DES, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)"
+.LASF1002:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF831:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF652:
+	.string	"_T_WCHAR "
+.LASF902:
+	.string	"_STDLIB_H 1"
+.LASF643:
+	.string	"___int_ptrdiff_t_h "
+.LASF801:
+	.string	"va_char16_p_decode utf16"
+.LASF585:
+	.string	"atomic_flag_test_and_set_explicit(PTR,MO) __atomic_test_and_set ((PTR), (MO))"
+.LASF1210:
+	.string	"va_quote"
+.LASF911:
+	.string	"__WCLONE 0x80000000"
+.LASF1264:
+	.string	"va_xprintf_char"
+.LASF493:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF704:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF847:
+	.string	"VA_SIGN_NORM 0"
+.LASF1201:
+	.string	"__v16qi"
+.LASF588:
+	.string	"_STRING_H 1"
+.LASF1043:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF840:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1202:
+	.string	"__v16qs"
+.LASF850:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF655:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1149:
+	.string	"str_prefix"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF931:
+	.string	"_BITS_FLOATN_H "
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF654:
+	.string	"_WCHAR_T_ "
+.LASF423:
+	.string	"__USE_ISOC99 1"
+.LASF1293:
+	.string	"xprintf_ull"
+.LASF545:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF770:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF1226:
+	.string	"format_scan_t"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1185:
+	.string	"code"
+.LASF1306:
+	.string	"format_scan_lit"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1408:
+	.string	"_mm_set_epi8"
+.LASF1054:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1279:
+	.string	"va_xprintf_iter_chunk"
+.LASF1027:
+	.string	"__NFDBITS"
+.LASF1298:
+	.string	"parse_format"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1177:
+	.string	"put_len"
+.LASF934:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF888:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF533:
+	.string	"__stub_chflags "
+.LASF779:
+	.string	"VA_U_BOM 0xfeff"
+.LASF1296:
+	.string	"ensure_init_stream"
+.LASF1024:
+	.string	"__timeval_defined 1"
+.LASF623:
+	.string	"_SIZET_ "
+.LASF721:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1083:
+	.string	"_MM_MASK_INEXACT 0x1000"
+.LASF819:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF776:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF973:
+	.string	"__uid_t_defined "
+.LASF826:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF526:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1146:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1191:
+	.string	"check_quote"
+.LASF692:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF521:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF938:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF504:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF878:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF1386:
+	.string	"__atomic_exchange_tmp"
+.LASF952:
+	.string	"__f32(x) x ##f32"
+.LASF1284:
+	.string	"align4"
+.LASF494:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1094:
+	.string	"render va_stream_render"
+.LASF921:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1230:
+	.string	"name"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF890:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1385:
+	.string	"__atomic_exchange_val"
+.LASF437:
+	.string	"_ATFILE_SOURCE 1"
+.LASF977:
+	.string	"__ssize_t_defined "
+.LASF469:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF802:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF1260:
+	.string	"va_xprintf_last_short"
+.LASF810:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1248:
+	.string	"va_xprintf_last_iter_chunk"
+.LASF1044:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF866:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF1378:
+	.string	"__atomic_load_tmp"
+.LASF1251:
+	.string	"va_xprintf_last_ull"
+.LASF551:
+	.string	"atomic_signal_fence(MO) __atomic_signal_fence (MO)"
+.LASF892:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF1127:
+	.string	"short int"
+.LASF443:
+	.string	"__USE_ATFILE 1"
+.LASF673:
+	.string	"_UCHAR_H 1"
+.LASF1110:
+	.string	"VEC_ANDNOT(A,B) _mm_andnot_si128(A,B)"
+.LASF747:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF991:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF418:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF507:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1046:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1193:
+	.string	"render_quote"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1305:
+	.string	"end_of_size"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF482:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1325:
+	.string	"prefix1"
+.LASF1111:
+	.string	"VEC_MASK(A) ((unsigned)_mm_movemask_epi8(A))"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1035:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF519:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF996:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF452:
+	.string	"_SYS_CDEFS_H 1"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF647:
+	.string	"__need_ptrdiff_t"
+.LASF661:
+	.string	"_GCC_WCHAR_T "
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF604:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1366:
+	.string	"ahead_replay"
+.LASF530:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF720:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF480:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1148:
+	.string	"chunk_mode"
+.LASF1425:
+	.string	"va_stream_reserve"
+.LASF1089:
+	.string	"_MM_FLUSH_ZERO_MASK 0x8000"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1003:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF483:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF683:
+	.string	"__SWORD_TYPE long int"
+.LASF487:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF649:
+	.string	"__WCHAR_T__ "
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF1150:
+	.string	"_pad"
+.LASF491:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF546:
+	.string	"_STDATOMIC_H "
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1141:
+	.string	"__val"
+.LASF430:
+	.string	"__USE_POSIX 1"
+.LASF522:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1073:
+	.string	"_MM_EXCEPT_DIV_ZERO 0x0004"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1280:
+	.string	"va_xprintf_iter_local"
+.LASF552:
+	.string	"atomic_is_lock_free(OBJ) __atomic_is_lock_free (sizeof (*(OBJ)), (OBJ))"
+.LASF1338:
+	.string	"render_iter"
+.LASF663:
+	.string	"__DEFINED_wchar_t "
+.LASF965:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF750:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF824:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1059:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF898:
+	.string	"_XMMINTRIN_H_INCLUDED "
+.LASF671:
+	.string	"false 0"
+.LASF1176:
+	.string	"put_fill"
+.LASF675:
+	.string	"__S16_TYPE short int"
+.LASF1321:
+	.string	"render_char"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1291:
+	.string	"format_scratch_put"
+.LASF844:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF999:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1052:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1369:
+	.string	"ahead_put"
+.LASF764:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF498:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF424:
+	.string	"__USE_ISOC95 1"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF961:
+	.string	"__lldiv_t_defined 1"
+.LASF874:
+	.string	"VA_QUOTE_QQ 7"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1359:
+	.string	"iter_count_bulk"
+.LASF854:
+	.string	"VA_MODE_CHAR 2"
+.LASF659:
+	.string	"___int_wchar_t_h "
+.LASF1227:
+	.string	"memcpy"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1236:
+	.string	"unit"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1434:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF619:
+	.string	"_SIZE_T_DECLARED "
+.LASF506:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF939:
+	.string	"__HAVE_FLOAT16 0"
+.LASF901:
+	.string	"__need_wchar_t "
+.LASF752:
+	.string	"VA_F(...) VA_H"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1381:
+	.string	"va_quotations_init"
+.LASF960:
+	.string	"__ldiv_t_defined 1"
+.LASF419:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF857:
+	.string	"VA_MODE_STAT 5"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF743:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF739:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF664:
+	.string	"_BSD_WCHAR_T_"
+.LASF532:
+	.string	"__stub___compat_bdflush "
+.LASF858:
+	.string	"VA_MODE_X6 6"
+.LASF1372:
+	.string	"check_quote_put"
+.LASF884:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF1213:
+	.string	"ahead_vtab"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF693:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF735:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF470:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF994:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF350:
+	.string	"__amd64 1"
+.LASF427:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF431:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF705:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF920:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF525:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1152:
+	.string	"va_read_iter_vtab_t"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1134:
+	.string	"size_t"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1101:
+	.string	"PLAIN_TABLE 5"
+.LASF971:
+	.string	"__mode_t_defined "
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF698:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1427:
+	.string	"va_take_utf16"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1107:
+	.string	"VEC_GT(A,B) _mm_cmpgt_epi8(A,B)"
+.LASF883:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF780:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF1204:
+	.string	"digit2_std"
+.LASF377:
+	.string	"unix 1"
+.LASF1033:
+	.string	"NFDBITS __NFDBITS"
+.LASF689:
+	.string	"__STD_TYPE typedef"
+.LASF1197:
+	.string	"float"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1196:
+	.string	"va_quotation_t"
+.LASF1383:
+	.string	"quotation"
+.LASF1065:
+	.string	"_ALLOCA_H 1"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1187:
+	.string	"va_format_read_vtab"
+.LASF558:
+	.string	"ATOMIC_SHORT_LOCK_FREE __GCC_ATOMIC_SHORT_LOCK_FREE"
+.LASF1109:
+	.string	"VEC_AND(A,B) _mm_and_si128(A,B)"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF444:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1309:
+	.string	"base"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF447:
+	.string	"__GNU_LIBRARY__"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF672:
+	.string	"__bool_true_false_are_defined 1"
+.LASF724:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF894:
+	.string	"VA_QCLASS_CALL 2"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF445:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF741:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF915:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1311:
+	.string	"format_plan"
+.LASF667:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF925:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF774:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF1400:
+	.string	"_mm_movemask_epi8"
+.LASF970:
+	.string	"__gid_t_defined "
+.LASF1165:
+	.string	"prec"
+.LASF800:
+	.string	"va_char16_p_format utf16"
+.LASF848:
+	.string	"VA_SIGN_SPACE 1"
+.LASF875:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF1103:
+	.string	"VEC_T __m128i"
+.LASF860:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF959:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF700:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1384:
+	.string	"__atomic_exchange_ptr"
+.LASF1429:
+	.string	"va_store_utf16"
+.LASF1255:
+	.string	"va_xprintf_last_ushort"
+.LASF1375:
+	.string	"quotation_get"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF404:
+	.string	"__USE_LARGEFILE64"
+.LASF895:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1088:
+	.string	"_MM_ROUND_TOWARD_ZERO 0x6000"
+.LASF1012:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF910:
+	.string	"__WALL 0x40000000"
+.LASF967:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF993:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF372:
+	.string	"__linux 1"
+.LASF1160:
+	.string	"next"
+.LASF1161:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF576:
+	.string	"atomic_fetch_sub_explicit(PTR,VAL,MO) __atomic_fetch_sub ((PTR), (VAL), (MO))"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF579:
+	.string	"atomic_fetch_xor(PTR,VAL) __atomic_fetch_xor ((PTR), (VAL), __ATOMIC_SEQ_CST)"
+.LASF472:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF836:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF591:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1286:
+	.string	"prev"
+.LASF1346:
+	.string	"iter_quote_bulk"
+.LASF729:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF544:
+	.string	"static_assert"
+.LASF1239:
+	.string	"off_spec"
+.LASF864:
+	.string	"VA_STATE_PREC 3"
+.LASF1181:
+	.string	"va_print"
+.LASF768:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF723:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1028:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF845:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF873:
+	.string	"VA_QUOTE_qq 6"
+.LASF1058:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1428:
+	.string	"va_take_utf8"
+.LASF1320:
+	.string	"render_ull"
+.LASF509:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1277:
+	.string	"last"
+.LASF1092:
+	.ascii	"_MM_TRANSPOSE4_PS(row0,row1,row2,row3) do { __v4sf __r0 = (r"
+	.ascii	"ow0), __r1 = (row1), __r2 = (row2), __r3 = (row3); __v4sf __"
+	.ascii	"t0 = __builtin_ia32_unpcklps (__r0, __r1); __v4sf __t1 = __b"
+	.ascii	"uiltin_ia32_unpcklps (__r2, __r3); __v4sf __t2 = __builtin_i"
+	.ascii	"a32_unpckhps (__r0"
+	.string	", __r1); __v4sf __t3 = __builtin_ia32_unpckhps (__r2, __r3); (row0) = __builtin_ia32_movlhps (__t0, __t1); (row1) = __builtin_ia32_movhlps (__t1, __t0); (row2) = __builtin_ia32_movlhps (__t2, __t3); (row3) = __builtin_ia32_movhlps (__t3, __t2); } while (0)"
+.LASF556:
+	.string	"ATOMIC_CHAR32_T_LOCK_FREE __GCC_ATOMIC_CHAR32_T_LOCK_FREE"
+.LASF1365:
+	.string	"render_rawstr"
+.LASF1040:
+	.string	"__fsblkcnt_t_defined "
+.LASF1099:
+	.string	"PLAIN_SH 3"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/core.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14292 @@
+	.file	"fd.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/fd.c"
+	.type	fd_commit, @function
+fd_commit:
+.LVL0:
+.LFB15:
+	.file 1 "src/fd.c"
+	.loc 1 43 1 view -0
+	.cfi_startproc
+	.loc 1 44 5 view .LVU1
+	.loc 1 44 17 is_stmt 0 view .LVU2
+	movq	40(%rdi), %rax
+	.loc 1 44 8 view .LVU3
+	testq	%rax, %rax
+	je	.L1
+.LBB23:
+	.loc 1 45 9 is_stmt 1 view .LVU4
+	.loc 1 45 47 is_stmt 0 view .LVU5
+	subq	72(%rdi), %rax
+	.loc 1 45 16 view .LVU6
+	movq	%rax, 88(%rdi)
+	.loc 1 46 9 is_stmt 1 view .LVU7
+	.loc 1 46 17 is_stmt 0 view .LVU8
+	movq	%rax, 96(%rdi)
+	.loc 1 47 9 is_stmt 1 view .LVU9
+	.loc 1 47 18 is_stmt 0 view .LVU10
+	xorl	%eax, %eax
+	movq	%rax, 40(%rdi)
+	movq	%rax, 48(%rdi)
+.L1:
+.LBE23:
+	.loc 1 49 1 view .LVU11
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	fd_commit, .-fd_commit
+	.type	fd_write, @function
+fd_write:
+.LVL1:
+.LFB14:
+	.loc 1 20 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 20 1 is_stmt 0 view .LVU13
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdx, %rbx
+	.loc 1 21 5 is_stmt 1 view .LVU14
+.LVL2:
+.L8:
+	.loc 1 21 14 view .LVU15
+	testq	%rbx, %rbx
+	je	.L16
+.LVL3:
+.L10:
+.LBB24:
+	.loc 1 22 9 view .LVU16
+	.loc 1 22 21 is_stmt 0 view .LVU17
+	movl	64(%r12), %edi
+	movq	%rbx, %rdx
+	movq	%rbp, %rsi
+	call	write@PLT
+.LVL4:
+	.loc 1 23 9 is_stmt 1 view .LVU18
+	.loc 1 23 12 is_stmt 0 view .LVU19
+	testq	%rax, %rax
+	jns	.L9
+	.loc 1 24 13 is_stmt 1 view .LVU20
+	.loc 1 24 18 is_stmt 0 view .LVU21
+	call	__errno_location@PLT
+.LVL5:
+	.loc 1 24 16 view .LVU22
+	cmpl	$4, (%rax)
+	jne	.L12
+	jmp	.L10
+.LVL6:
+.L9:
+	.loc 1 29 9 is_stmt 1 view .LVU23
+	.loc 1 29 12 is_stmt 0 view .LVU24
+	je	.L12
+	.loc 1 32 9 is_stmt 1 view .LVU25
+	.loc 1 32 11 is_stmt 0 view .LVU26
+	addq	%rax, %rbp
+.LVL7:
+	.loc 1 33 9 is_stmt 1 view .LVU27
+	.loc 1 33 11 is_stmt 0 view .LVU28
+	subq	%rax, %rbx
+.LVL8:
+	.loc 1 33 11 view .LVU29
+	jmp	.L8
+.LVL9:
+.L16:
+	.loc 1 33 11 view .LVU30
+.LBE24:
+	.loc 1 35 11 view .LVU31
+	movb	$1, %al
+	jmp	.L7
+.LVL10:
+.L12:
+.LBB25:
+	.loc 1 27 19 view .LVU32
+	xorl	%eax, %eax
+.LVL11:
+.L7:
+	.loc 1 27 19 view .LVU33
+.LBE25:
+	.loc 1 36 1 view .LVU34
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL12:
+	.loc 1 36 1 view .LVU35
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	fd_write, .-fd_write
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"src/fd.c"
+.LC1:
+	.string	"n <= t->pos"
+	.text
+	.type	fd_flush_head, @function
+fd_flush_head:
+.LVL13:
+.LFB16:
+	.loc 1 55 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 56 5 view .LVU37
+	.loc 1 56 8 is_stmt 0 view .LVU38
+	testq	%rsi, %rsi
+	je	.L25
+	.loc 1 55 1 view .LVU39
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsi, %rbp
+	.loc 1 59 4 is_stmt 1 view .LVU40
+	.loc 1 55 1 is_stmt 0 view .LVU41
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	.loc 1 59 36 view .LVU42
+	cmpq	%rsi, 88(%rdi)
+	jnb	.L19
+	.loc 1 59 13 is_stmt 1 discriminator 1 view .LVU43
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx
+	movl	$59, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL14:
+	.loc 1 59 13 is_stmt 0 discriminator 1 view .LVU44
+	leaq	.LC1(%rip), %rdi
+.LVL15:
+	.loc 1 59 13 discriminator 1 view .LVU45
+	call	__assert_fail@PLT
+.LVL16:
+.L19:
+.LBB31:
+.LBI31:
+	.loc 1 54 13 is_stmt 1 view .LVU46
+.LBB32:
+	.loc 1 60 5 view .LVU47
+	.loc 1 60 10 is_stmt 0 view .LVU48
+	movq	72(%rdi), %rsi
+.LVL17:
+	.loc 1 60 10 view .LVU49
+	movq	%rbp, %rdx
+	call	fd_write
+.LVL18:
+	.loc 1 60 8 view .LVU50
+	testb	%al, %al
+	jne	.L20
+	.loc 1 61 9 is_stmt 1 view .LVU51
+.LVL19:
+.LBB33:
+.LBI33:
+	.file 2 "./include/va_print/impl.h"
+	.loc 2 425 20 view .LVU52
+.LBB34:
+	.loc 2 427 5 view .LVU53
+	.loc 2 427 13 is_stmt 0 view .LVU54
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU55
+	testl	$939524096, %eax
+	jne	.L20
+	.loc 2 428 9 is_stmt 1 view .LVU56
+.LBB35:
+	.loc 2 428 25 view .LVU57
+.LVL20:
+	.loc 2 428 62 view .LVU58
+	.loc 2 428 101 is_stmt 0 view .LVU59
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU60
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+.LVL21:
+.L20:
+	.loc 2 428 123 view .LVU61
+.LBE35:
+.LBE34:
+.LBE33:
+	.loc 1 63 5 is_stmt 1 view .LVU62
+	.loc 1 63 12 is_stmt 0 view .LVU63
+	movq	88(%rbx), %rdx
+	.loc 1 64 23 view .LVU64
+	movq	72(%rbx), %rdi
+	.loc 1 63 12 view .LVU65
+	subq	%rbp, %rdx
+	.loc 1 64 30 view .LVU66
+	leaq	(%rdi,%rbp), %rsi
+	.loc 1 63 12 view .LVU67
+	movq	%rdx, 88(%rbx)
+	.loc 1 64 5 is_stmt 1 view .LVU68
+	call	memmove@PLT
+.LVL22:
+	.loc 1 65 5 view .LVU69
+	.loc 1 65 13 is_stmt 0 view .LVU70
+	xorl	%eax, %eax
+	movq	%rax, 96(%rbx)
+.LVL23:
+	.loc 1 65 13 view .LVU71
+.LBE32:
+.LBE31:
+	.loc 1 66 1 view .LVU72
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL24:
+	.loc 1 66 1 view .LVU73
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL25:
+	.loc 1 66 1 view .LVU74
+	ret
+.LVL26:
+.L25:
+	.cfi_restore 3
+	.cfi_restore 6
+	.loc 1 66 1 view .LVU75
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	fd_flush_head, .-fd_flush_head
+	.globl	va_fd_flush
+	.type	va_fd_flush, @function
+va_fd_flush:
+.LVL27:
+.LFB18:
+	.loc 1 85 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 86 5 view .LVU77
+	.loc 1 85 1 is_stmt 0 view .LVU78
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	.loc 1 86 5 view .LVU79
+	call	fd_commit
+.LVL28:
+	.loc 1 87 5 is_stmt 1 view .LVU80
+	movq	88(%rdi), %rsi
+	.loc 1 88 1 is_stmt 0 view .LVU81
+	popq	%rdx
+	.cfi_def_cfa_offset 8
+	.loc 1 87 5 view .LVU82
+	jmp	fd_flush_head
+.LVL29:
+	.loc 1 87 5 view .LVU83
+	.cfi_endproc
+.LFE18:
+	.size	va_fd_flush, .-va_fd_flush
+	.globl	va_fd_finish
+	.type	va_fd_finish, @function
+va_fd_finish:
+.LVL30:
+.LFB19:
+	.loc 1 91 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 92 5 view .LVU85
+	.loc 1 93 5 view .LVU86
+	.loc 1 93 8 is_stmt 0 view .LVU87
+	cmpb	$0, 104(%rdi)
+	je	.L30
+	.loc 1 94 9 is_stmt 1 view .LVU88
+	jmp	va_fd_flush
+.LVL31:
+.L30:
+	.loc 1 96 1 is_stmt 0 view .LVU89
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	va_fd_finish, .-va_fd_finish
+	.globl	va_fd_write
+	.type	va_fd_write, @function
+va_fd_write:
+.LVL32:
+.LFB20:
+	.loc 1 99 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 100 5 view .LVU91
+	.loc 1 101 5 view .LVU92
+	.loc 1 99 1 is_stmt 0 view .LVU93
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+	.loc 1 101 5 view .LVU94
+	call	fd_commit
+.LVL33:
+	.loc 1 102 5 is_stmt 1 view .LVU95
+.LBB41:
+.LBI41:
+	.loc 1 73 15 view .LVU96
+.LBB42:
+	.loc 1 75 5 view .LVU97
+	.loc 1 75 8 is_stmt 0 view .LVU98
+	cmpb	$0, 104(%rdi)
+	movq	80(%rdi), %r12
+	je	.L34
+	.loc 1 78 5 is_stmt 1 view .LVU99
+	.loc 1 78 40 is_stmt 0 view .LVU100
+	movl	$4096, %eax
+	cmpq	%rax, %r12
+	cmova	%rax, %r12
+.L34:
+.LVL34:
+	.loc 1 78 40 view .LVU101
+.LBE42:
+.LBE41:
+	.loc 1 103 5 is_stmt 1 view .LVU102
+	.loc 1 103 17 is_stmt 0 view .LVU103
+	movq	88(%rbx), %rax
+	addq	%rbp, %rax
+	.loc 1 103 8 view .LVU104
+	cmpq	%rax, %r12
+	jnb	.L36
+	.loc 1 105 9 is_stmt 1 view .LVU105
+	movq	96(%rbx), %rsi
+.LVL35:
+	.loc 1 105 9 is_stmt 0 view .LVU106
+	movq	%rbx, %rdi
+.LVL36:
+	.loc 1 105 9 view .LVU107
+	call	fd_flush_head
+.LVL37:
+	.loc 1 106 9 is_stmt 1 view .LVU108
+	.loc 1 106 21 is_stmt 0 view .LVU109
+	movq	88(%rbx), %rax
+	addq	%rbp, %rax
+	.loc 1 106 12 view .LVU110
+	cmpq	%rax, %r12
+	jnb	.L36
+	.loc 1 107 13 is_stmt 1 view .LVU111
+	movq	%rbx, %rdi
+	call	va_fd_flush
+.LVL38:
+.L36:
+	.loc 1 110 5 view .LVU112
+	.loc 1 110 11 is_stmt 0 view .LVU113
+	movq	72(%rbx), %rax
+	.loc 1 110 26 view .LVU114
+	cmpq	%rbp, %r12
+	jb	.L41
+	testq	%rax, %rax
+	jne	.L38
+.L41:
+	.loc 1 111 9 is_stmt 1 view .LVU115
+	.loc 1 111 14 is_stmt 0 view .LVU116
+	movq	%rbp, %rdx
+	movq	%r13, %rsi
+	movq	%rbx, %rdi
+	call	fd_write
+.LVL39:
+	.loc 1 111 12 view .LVU117
+	testb	%al, %al
+	jne	.L32
+	.loc 1 112 13 is_stmt 1 view .LVU118
+.LVL40:
+.LBB43:
+.LBI43:
+	.loc 2 425 20 view .LVU119
+.LBB44:
+	.loc 2 427 5 view .LVU120
+	.loc 2 427 13 is_stmt 0 view .LVU121
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU122
+	testl	$939524096, %eax
+	jne	.L32
+	.loc 2 428 9 is_stmt 1 view .LVU123
+.LBB45:
+	.loc 2 428 25 view .LVU124
+.LVL41:
+	.loc 2 428 62 view .LVU125
+	.loc 2 428 101 is_stmt 0 view .LVU126
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU127
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+	jmp	.L32
+.LVL42:
+.L38:
+	.loc 2 428 123 view .LVU128
+.LBE45:
+.LBE44:
+.LBE43:
+	.loc 1 116 5 is_stmt 1 view .LVU129
+	.loc 1 116 20 is_stmt 0 view .LVU130
+	addq	88(%rbx), %rax
+	.loc 1 116 5 view .LVU131
+	movq	%r13, %rsi
+	movq	%rbp, %rcx
+	movq	%rax, %rdi
+	rep movsb
+	.loc 1 117 5 is_stmt 1 view .LVU132
+	.loc 1 117 12 is_stmt 0 view .LVU133
+	addq	%rbp, 88(%rbx)
+.L32:
+	.loc 1 118 1 view .LVU134
+	popq	%rax
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL43:
+	.loc 1 118 1 view .LVU135
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL44:
+	.loc 1 118 1 view .LVU136
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL45:
+	.loc 1 118 1 view .LVU137
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL46:
+	.loc 1 118 1 view .LVU138
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	va_fd_write, .-va_fd_write
+	.globl	va_fd_refill
+	.type	va_fd_refill, @function
+va_fd_refill:
+.LVL47:
+.LFB21:
+	.loc 1 121 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 122 5 view .LVU140
+	.loc 1 123 5 view .LVU141
+	.loc 1 121 1 is_stmt 0 view .LVU142
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 121 1 view .LVU143
+	movq	%rdi, %rbx
+	.loc 1 123 5 view .LVU144
+	call	fd_commit
+.LVL48:
+	.loc 1 124 5 is_stmt 1 view .LVU145
+	.loc 1 124 8 is_stmt 0 view .LVU146
+	cmpq	$0, 72(%rdi)
+	jne	.L44
+.LVL49:
+.L48:
+	.loc 1 125 15 view .LVU147
+	xorl	%eax, %eax
+	jmp	.L43
+.LVL50:
+.L44:
+.LBB48:
+.LBB49:
+	.loc 1 75 8 view .LVU148
+	cmpb	$0, 104(%rdi)
+	.loc 1 76 17 view .LVU149
+	movq	80(%rdi), %rbp
+	movq	%rsi, %r12
+.LBE49:
+.LBE48:
+	.loc 1 127 5 is_stmt 1 view .LVU150
+.LVL51:
+.LBB51:
+.LBI48:
+	.loc 1 73 15 view .LVU151
+.LBB50:
+	.loc 1 75 5 view .LVU152
+	.loc 1 75 8 is_stmt 0 view .LVU153
+	je	.L46
+	.loc 1 78 5 is_stmt 1 view .LVU154
+	.loc 1 78 40 is_stmt 0 view .LVU155
+	movl	$4096, %eax
+	cmpq	%rax, %rbp
+	cmova	%rax, %rbp
+.L46:
+.LVL52:
+	.loc 1 78 40 view .LVU156
+.LBE50:
+.LBE51:
+	.loc 1 128 5 is_stmt 1 view .LVU157
+	.loc 1 128 17 is_stmt 0 view .LVU158
+	movq	88(%rbx), %rax
+	addq	%r12, %rax
+	.loc 1 128 8 view .LVU159
+	cmpq	%rax, %rbp
+	jb	.L47
+.LVL53:
+.L49:
+	.loc 1 134 5 is_stmt 1 view .LVU160
+	.loc 1 134 32 is_stmt 0 view .LVU161
+	movq	72(%rbx), %rax
+	.loc 1 134 39 view .LVU162
+	movq	88(%rbx), %rdx
+	addq	%rax, %rdx
+	.loc 1 134 57 view .LVU163
+	addq	%rbp, %rax
+	movq	%rax, 48(%rbx)
+	.loc 1 135 5 is_stmt 1 view .LVU164
+	.loc 1 135 11 is_stmt 0 view .LVU165
+	movb	$1, %al
+	.loc 1 134 14 view .LVU166
+	movq	%rdx, 40(%rbx)
+	.loc 1 135 11 view .LVU167
+	jmp	.L43
+.LVL54:
+.L47:
+	.loc 1 129 9 is_stmt 1 view .LVU168
+	movq	%rbx, %rdi
+	call	va_fd_flush
+.LVL55:
+	.loc 1 130 9 view .LVU169
+	.loc 1 130 12 is_stmt 0 view .LVU170
+	cmpq	%r12, %rbp
+	jnb	.L49
+	jmp	.L48
+.LVL56:
+.L43:
+	.loc 1 136 1 view .LVU171
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL57:
+	.loc 1 136 1 view .LVU172
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	va_fd_refill, .-va_fd_refill
+	.globl	va_fd_fill
+	.type	va_fd_fill, @function
+va_fd_fill:
+.LVL58:
+.LFB22:
+	.loc 1 139 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 140 5 view .LVU174
+	.loc 1 141 5 view .LVU175
+	.loc 1 139 1 is_stmt 0 view .LVU176
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rcx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 141 5 view .LVU177
+	call	fd_commit
+.LVL59:
+	.loc 1 142 5 is_stmt 1 view .LVU178
+	.loc 1 142 8 is_stmt 0 view .LVU179
+	cmpq	$0, 72(%rdi)
+	jne	.L52
+.LBB66:
+	.loc 1 144 9 is_stmt 1 view .LVU180
+	.loc 1 145 9 view .LVU181
+	.loc 1 145 16 is_stmt 0 view .LVU182
+	xorl	%edx, %edx
+.LVL60:
+	.loc 1 145 16 view .LVU183
+	movl	$64, %eax
+	movq	%rsp, %r15
+	divq	%rbx
+	.loc 1 146 9 view .LVU184
+	cmpq	%rax, %rcx
+	.loc 1 145 16 view .LVU185
+	movq	%rax, %r14
+.LVL61:
+	.loc 1 146 9 is_stmt 1 view .LVU186
+	cmovbe	%rcx, %rax
+.LVL62:
+.LBB67:
+.LBI67:
+	.loc 2 556 20 view .LVU187
+.LBB68:
+	.loc 2 559 5 view .LVU188
+	.loc 2 560 5 view .LVU189
+	.loc 2 560 8 is_stmt 0 view .LVU190
+	cmpq	$1, %rbx
+	jne	.L72
+	.loc 2 561 9 is_stmt 1 view .LVU191
+	movl	%eax, %ecx
+.LVL63:
+	.loc 2 561 9 is_stmt 0 view .LVU192
+	movb	(%rsi), %al
+.LVL64:
+	.loc 2 561 9 view .LVU193
+	movq	%r15, %rdi
+.LVL65:
+	.loc 2 561 9 view .LVU194
+	rep stosb
+	.loc 2 562 9 is_stmt 1 view .LVU195
+	jmp	.L54
+.LVL66:
+.L72:
+.LBB69:
+	.loc 2 564 17 is_stmt 0 view .LVU196
+	xorl	%edx, %edx
+.LBE69:
+	.loc 2 559 11 view .LVU197
+	movq	%r15, %r8
+.LVL67:
+.L53:
+.LBB70:
+	.loc 2 564 26 is_stmt 1 view .LVU198
+	cmpq	%rdx, %rax
+	je	.L54
+	.loc 2 565 9 view .LVU199
+	movq	%r8, %rdi
+	movq	%r13, %rsi
+	movq	%rbx, %rcx
+	.loc 2 564 32 is_stmt 0 view .LVU200
+	incq	%rdx
+.LVL68:
+	.loc 2 565 9 view .LVU201
+	rep movsb
+	.loc 2 566 9 is_stmt 1 view .LVU202
+	.loc 2 566 11 is_stmt 0 view .LVU203
+	movq	%rdi, %r8
+.LVL69:
+	.loc 2 564 32 is_stmt 1 view .LVU204
+	.loc 2 564 32 is_stmt 0 view .LVU205
+	jmp	.L53
+.LVL70:
+.L60:
+	.loc 2 564 32 view .LVU206
+.LBE70:
+.LBE68:
+.LBE67:
+.LBB71:
+	.loc 1 148 13 is_stmt 1 view .LVU207
+	.loc 1 148 20 is_stmt 0 view .LVU208
+	cmpq	%r14, %r12
+	movq	%r14, %r13
+	.loc 1 149 18 view .LVU209
+	movq	%rbx, %rdx
+	movq	%r15, %rsi
+	.loc 1 148 20 view .LVU210
+	cmovbe	%r12, %r13
+.LVL71:
+	.loc 1 149 13 is_stmt 1 view .LVU211
+	.loc 1 149 18 is_stmt 0 view .LVU212
+	movq	%rbp, %rdi
+	imulq	%r13, %rdx
+	call	fd_write
+.LVL72:
+	.loc 1 149 16 view .LVU213
+	testb	%al, %al
+	je	.L76
+	.loc 1 153 13 is_stmt 1 view .LVU214
+	.loc 1 153 15 is_stmt 0 view .LVU215
+	subq	%r13, %r12
+.LVL73:
+.L54:
+	.loc 1 153 15 view .LVU216
+.LBE71:
+	.loc 1 147 18 is_stmt 1 view .LVU217
+	testq	%r12, %r12
+	jne	.L60
+	.loc 1 147 18 is_stmt 0 view .LVU218
+	jmp	.L51
+.LVL74:
+.L76:
+.LBB75:
+	.loc 1 150 17 is_stmt 1 view .LVU219
+.LBB72:
+.LBI72:
+	.loc 2 425 20 view .LVU220
+.LBB73:
+	.loc 2 427 5 view .LVU221
+	.loc 2 427 13 is_stmt 0 view .LVU222
+	movl	32(%rbp), %eax
+	.loc 2 427 8 view .LVU223
+	testl	$939524096, %eax
+	jne	.L51
+	.loc 2 428 9 is_stmt 1 view .LVU224
+.LBB74:
+	.loc 2 428 25 view .LVU225
+.LVL75:
+	.loc 2 428 62 view .LVU226
+	.loc 2 428 101 is_stmt 0 view .LVU227
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU228
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbp)
+	jmp	.L51
+.LVL76:
+.L52:
+	.loc 2 428 123 view .LVU229
+.LBE74:
+.LBE73:
+.LBE72:
+.LBE75:
+.LBE66:
+	.loc 1 157 5 is_stmt 1 view .LVU230
+.LBB76:
+.LBI76:
+	.loc 1 73 15 view .LVU231
+.LBB77:
+	.loc 1 75 5 view .LVU232
+	.loc 1 75 8 is_stmt 0 view .LVU233
+	cmpb	$0, 104(%rdi)
+	.loc 1 76 17 view .LVU234
+	movq	80(%rdi), %r14
+	.loc 1 75 8 view .LVU235
+	je	.L64
+	.loc 1 78 5 is_stmt 1 view .LVU236
+	.loc 1 78 40 is_stmt 0 view .LVU237
+	movl	$4096, %eax
+	cmpq	%rax, %r14
+	cmova	%rax, %r14
+.LVL77:
+	.loc 1 78 40 view .LVU238
+.LBE77:
+.LBE76:
+	.loc 1 158 5 is_stmt 1 view .LVU239
+	.loc 1 158 11 is_stmt 0 view .LVU240
+	jmp	.L64
+.LVL78:
+.L71:
+.LBB78:
+	.loc 1 159 9 is_stmt 1 view .LVU241
+	.loc 1 159 25 is_stmt 0 view .LVU242
+	movq	%r14, %rax
+	subq	88(%rbp), %rax
+.LVL79:
+	.loc 1 160 9 is_stmt 1 view .LVU243
+	.loc 1 160 12 is_stmt 0 view .LVU244
+	cmpq	%rbx, %rax
+	jnb	.L65
+	.loc 1 161 13 is_stmt 1 view .LVU245
+	movq	%rbp, %rdi
+	call	va_fd_flush
+.LVL80:
+	.loc 1 162 13 view .LVU246
+	.loc 1 162 15 is_stmt 0 view .LVU247
+	movq	%r14, %rax
+	xorl	%edx, %edx
+	divq	%rbx
+.LVL81:
+	.loc 1 163 13 is_stmt 1 view .LVU248
+	.loc 1 163 16 is_stmt 0 view .LVU249
+	cmpq	%rbx, %r14
+	jnb	.L66
+	.loc 1 164 17 is_stmt 1 discriminator 1 view .LVU250
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	.loc 1 165 18 is_stmt 0 discriminator 1 view .LVU251
+	decq	%r12
+.LVL82:
+	.loc 1 164 17 discriminator 1 view .LVU252
+	call	va_fd_write
+.LVL83:
+	.loc 1 165 17 is_stmt 1 discriminator 1 view .LVU253
+	.loc 1 166 17 discriminator 1 view .LVU254
+.L64:
+	.loc 1 166 17 is_stmt 0 discriminator 1 view .LVU255
+.LBE78:
+	.loc 1 158 14 is_stmt 1 view .LVU256
+	testq	%r12, %r12
+	jne	.L71
+	.loc 1 158 14 is_stmt 0 view .LVU257
+	jmp	.L51
+.LVL84:
+.L65:
+.LBB83:
+	.loc 1 159 16 view .LVU258
+	xorl	%edx, %edx
+	divq	%rbx
+.LVL85:
+.L66:
+	.loc 1 169 9 is_stmt 1 view .LVU259
+	.loc 1 170 33 is_stmt 0 view .LVU260
+	movq	88(%rbp), %r8
+	.loc 1 169 11 view .LVU261
+	cmpq	%rax, %r12
+	cmovbe	%r12, %rax
+.LVL86:
+	.loc 1 170 33 view .LVU262
+	addq	72(%rbp), %r8
+	.loc 1 169 11 view .LVU263
+	movq	%rax, %rdx
+.LVL87:
+	.loc 1 170 9 is_stmt 1 view .LVU264
+.LBB79:
+.LBI79:
+	.loc 2 556 20 view .LVU265
+.LBB80:
+	.loc 2 559 5 view .LVU266
+	.loc 2 560 5 view .LVU267
+.LBB81:
+	.loc 2 564 17 is_stmt 0 view .LVU268
+	xorl	%eax, %eax
+.LVL88:
+	.loc 2 564 17 view .LVU269
+.LBE81:
+	.loc 2 560 8 view .LVU270
+	cmpq	$1, %rbx
+	jne	.L68
+	.loc 2 561 9 is_stmt 1 view .LVU271
+	movb	0(%r13), %al
+	movq	%r8, %rdi
+	movq	%rdx, %rcx
+	rep stosb
+	.loc 2 562 9 view .LVU272
+	jmp	.L69
+.LVL89:
+.L68:
+.LBB82:
+	.loc 2 564 26 view .LVU273
+	cmpq	%rax, %rdx
+	je	.L69
+	.loc 2 565 9 view .LVU274
+	movq	%r8, %rdi
+	movq	%r13, %rsi
+	movq	%rbx, %rcx
+	.loc 2 564 32 is_stmt 0 view .LVU275
+	incq	%rax
+.LVL90:
+	.loc 2 565 9 view .LVU276
+	rep movsb
+	.loc 2 566 9 is_stmt 1 view .LVU277
+	.loc 2 566 11 is_stmt 0 view .LVU278
+	movq	%rdi, %r8
+.LVL91:
+	.loc 2 564 32 is_stmt 1 view .LVU279
+	.loc 2 564 32 is_stmt 0 view .LVU280
+	jmp	.L68
+.LVL92:
+.L69:
+	.loc 2 564 32 view .LVU281
+.LBE82:
+.LBE80:
+.LBE79:
+	.loc 1 171 9 is_stmt 1 view .LVU282
+	.loc 1 171 21 is_stmt 0 view .LVU283
+	movq	%rbx, %rax
+	.loc 1 173 11 view .LVU284
+	subq	%rdx, %r12
+.LVL93:
+	.loc 1 171 21 view .LVU285
+	imulq	%rdx, %rax
+	.loc 1 171 16 view .LVU286
+	addq	88(%rbp), %rax
+	movq	%rax, 88(%rbp)
+	.loc 1 172 9 is_stmt 1 view .LVU287
+	.loc 1 172 17 is_stmt 0 view .LVU288
+	movq	%rax, 96(%rbp)
+	.loc 1 173 9 is_stmt 1 view .LVU289
+.LVL94:
+	.loc 1 173 9 is_stmt 0 view .LVU290
+	jmp	.L64
+.LVL95:
+.L51:
+	.loc 1 173 9 view .LVU291
+.LBE83:
+	.loc 1 175 1 view .LVU292
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL96:
+	.loc 1 175 1 view .LVU293
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL97:
+	.loc 1 175 1 view .LVU294
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL98:
+	.loc 1 175 1 view .LVU295
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	va_fd_fill, .-va_fd_fill
+	.globl	va_fd_put_whole
+	.type	va_fd_put_whole, @function
+va_fd_put_whole:
+.LVL99:
+.LFB23:
+	.loc 1 181 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 182 5 view .LVU297
+	.loc 1 183 5 view .LVU298
+	.loc 1 181 1 is_stmt 0 view .LVU299
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 183 8 view .LVU300
+	cmpq	$0, 72(%rdi)
+	je	.L78
+	.loc 1 184 9 is_stmt 1 view .LVU301
+	call	*%rdx
+.LVL100:
+	.loc 1 185 9 view .LVU302
+	.loc 1 185 12 is_stmt 0 view .LVU303
+	cmpq	$0, 40(%rbx)
+	jne	.L77
+	.loc 1 187 13 is_stmt 1 view .LVU304
+	.loc 1 187 21 is_stmt 0 view .LVU305
+	movq	88(%rbx), %rax
+	movq	%rax, 96(%rbx)
+	.loc 1 189 9 is_stmt 1 view .LVU306
+	jmp	.L77
+.LVL101:
+.L78:
+	.loc 1 193 5 view .LVU307
+	.loc 1 194 5 view .LVU308
+	.loc 1 194 13 is_stmt 0 view .LVU309
+	leaq	12(%rsp), %rax
+	.loc 1 195 13 view .LVU310
+	movq	$4, 80(%rdi)
+	.loc 1 194 13 view .LVU311
+	movq	%rax, 72(%rdi)
+	.loc 1 195 5 is_stmt 1 view .LVU312
+	.loc 1 196 5 view .LVU313
+	call	*%rdx
+.LVL102:
+	.loc 1 197 5 view .LVU314
+	movq	%rbx, %rdi
+	call	va_fd_flush
+.LVL103:
+	.loc 1 198 5 view .LVU315
+	.loc 1 199 13 is_stmt 0 view .LVU316
+	xorl	%ecx, %ecx
+	movq	%rcx, 72(%rbx)
+	movq	%rcx, 80(%rbx)
+.L77:
+	.loc 1 200 1 view .LVU317
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL104:
+	.loc 1 200 1 view .LVU318
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	va_fd_put_whole, .-va_fd_put_whole
+	.globl	va_fd_put
+	.type	va_fd_put, @function
+va_fd_put:
+.LVL105:
+.LFB24:
+	.loc 1 203 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 204 5 view .LVU320
+	.loc 1 203 1 is_stmt 0 view .LVU321
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 204 5 view .LVU322
+	movl	$1, %edx
+	.loc 1 203 1 view .LVU323
+	movb	%sil, 12(%rsp)
+	.loc 1 204 5 view .LVU324
+	leaq	12(%rsp), %rsi
+.LVL106:
+	.loc 1 204 5 view .LVU325
+	call	va_fd_write
+.LVL107:
+	.loc 1 205 1 view .LVU326
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	va_fd_put, .-va_fd_put
+	.globl	va_fd_put_fill
+	.type	va_fd_put_fill, @function
+va_fd_put_fill:
+.LVL108:
+.LFB25:
+	.loc 1 208 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 209 5 view .LVU328
+	.loc 1 208 1 is_stmt 0 view .LVU329
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 208 1 view .LVU330
+	movq	%rdx, %rcx
+	.loc 1 210 5 view .LVU331
+	movl	$1, %edx
+.LVL109:
+	.loc 1 209 14 view .LVU332
+	movb	%sil, 15(%rsp)
+	.loc 1 210 5 is_stmt 1 view .LVU333
+	leaq	15(%rsp), %rsi
+.LVL110:
+	.loc 1 210 5 is_stmt 0 view .LVU334
+	call	va_fd_fill
+.LVL111:
+	.loc 1 211 1 view .LVU335
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	va_fd_put_fill, .-va_fd_put_fill
+	.section	.rodata
+	.align 8
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 14
+__PRETTY_FUNCTION__.0:
+	.string	"fd_flush_head"
+	.text
+.Letext0:
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/unistd.h"
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "./include/va_print/base.h"
+	.file 7 "./include/va_print/fd.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "/usr/include/assert.h"
+	.file 10 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x10ef
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF1644
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1571
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1572
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1573
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1574
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1575
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1576
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1577
+	.uleb128 0x29
+	.byte	0x8
+	.uleb128 0x17
+	.long	.LASF1579
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x12
+	.long	0x63
+	.uleb128 0x3
+	.long	0x7d
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1578
+	.uleb128 0xa
+	.long	0x7d
+	.uleb128 0x17
+	.long	.LASF1580
+	.byte	0x4
+	.byte	0xdc
+	.byte	0x13
+	.long	0x6c
+	.uleb128 0x17
+	.long	.LASF1581
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x32
+	.uleb128 0x3
+	.long	0x84
+	.uleb128 0xa
+	.long	0xa1
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1582
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1583
+	.uleb128 0xe
+	.long	0x7d
+	.long	0xc9
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.byte	0x38
+	.byte	0x6
+	.byte	0xc1
+	.long	0x161
+	.uleb128 0x7
+	.long	.LASF1584
+	.byte	0x6
+	.byte	0xc4
+	.byte	0x11
+	.long	0xa1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1585
+	.byte	0x6
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1b0
+	.byte	0x8
+	.uleb128 0x10
+	.string	"end"
+	.byte	0x6
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1c9
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF1586
+	.byte	0x6
+	.byte	0xdb
+	.byte	0xc
+	.long	0x1d9
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF1587
+	.byte	0x6
+	.byte	0xe2
+	.byte	0xe
+	.long	0x206
+	.byte	0x20
+	.uleb128 0x7
+	.long	.LASF1588
+	.byte	0x6
+	.byte	0xec
+	.byte	0xe
+	.long	0x229
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF1589
+	.byte	0x6
+	.byte	0xf1
+	.byte	0x13
+	.long	0x39
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF1590
+	.byte	0x6
+	.byte	0xf5
+	.byte	0x13
+	.long	0x39
+	.byte	0x31
+	.uleb128 0x7
+	.long	.LASF1591
+	.byte	0x6
+	.byte	0xf9
+	.byte	0x13
+	.long	0x39
+	.byte	0x32
+	.uleb128 0x10
+	.string	"enc"
+	.byte	0x6
+	.byte	0xfd
+	.byte	0x13
+	.long	0x39
+	.byte	0x33
+	.uleb128 0x7
+	.long	.LASF1592
+	.byte	0x6
+	.byte	0xff
+	.byte	0xa
+	.long	0xb9
+	.byte	0x34
+	.byte	0
+	.uleb128 0x11
+	.long	0x47
+	.long	0x175
+	.uleb128 0x1
+	.long	0x175
+	.uleb128 0x1
+	.long	0x1aa
+	.byte	0
+	.uleb128 0x3
+	.long	0x17a
+	.uleb128 0x1a
+	.long	.LASF1597
+	.byte	0x10
+	.byte	0x6
+	.value	0x132
+	.byte	0x10
+	.long	0x1a5
+	.uleb128 0x6
+	.long	.LASF1593
+	.byte	0x6
+	.value	0x135
+	.byte	0x20
+	.long	0x240
+	.byte	0
+	.uleb128 0xb
+	.string	"cur"
+	.byte	0x6
+	.value	0x138
+	.byte	0x11
+	.long	0x1aa
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x17a
+	.uleb128 0x3
+	.long	0x1af
+	.uleb128 0x2a
+	.uleb128 0x3
+	.long	0x161
+	.uleb128 0x11
+	.long	0x1aa
+	.long	0x1c9
+	.uleb128 0x1
+	.long	0x175
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x3
+	.long	0x1b5
+	.uleb128 0x18
+	.long	0x1d9
+	.uleb128 0x1
+	.long	0x175
+	.byte	0
+	.uleb128 0x3
+	.long	0x1ce
+	.uleb128 0x11
+	.long	0x95
+	.long	0x1fc
+	.uleb128 0x1
+	.long	0x1fc
+	.uleb128 0x1
+	.long	0x1aa
+	.uleb128 0x1
+	.long	0x95
+	.uleb128 0x1
+	.long	0x201
+	.byte	0
+	.uleb128 0x3
+	.long	0x1a5
+	.uleb128 0x3
+	.long	0x95
+	.uleb128 0x3
+	.long	0x1de
+	.uleb128 0x11
+	.long	0x95
+	.long	0x229
+	.uleb128 0x1
+	.long	0x6a
+	.uleb128 0x1
+	.long	0x39
+	.uleb128 0x1
+	.long	0x1aa
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x3
+	.long	0x20b
+	.uleb128 0x12
+	.long	.LASF1594
+	.byte	0x6
+	.value	0x100
+	.byte	0x3
+	.long	0xc9
+	.uleb128 0xa
+	.long	0x22e
+	.uleb128 0x3
+	.long	0x23b
+	.uleb128 0x12
+	.long	.LASF1595
+	.byte	0x6
+	.value	0x139
+	.byte	0x3
+	.long	0x17a
+	.uleb128 0x12
+	.long	.LASF1596
+	.byte	0x6
+	.value	0x169
+	.byte	0x1a
+	.long	0x25f
+	.uleb128 0x1a
+	.long	.LASF1598
+	.byte	0x40
+	.byte	0x6
+	.value	0x1b7
+	.byte	0x8
+	.long	0x2de
+	.uleb128 0x6
+	.long	.LASF1593
+	.byte	0x6
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x451
+	.byte	0
+	.uleb128 0xb
+	.string	"pat"
+	.byte	0x6
+	.value	0x1b9
+	.byte	0x14
+	.long	0x245
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1599
+	.byte	0x6
+	.value	0x1ba
+	.byte	0xe
+	.long	0x47
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1600
+	.byte	0x6
+	.value	0x1bb
+	.byte	0xe
+	.long	0x47
+	.byte	0x1c
+	.uleb128 0xb
+	.string	"opt"
+	.byte	0x6
+	.value	0x1bc
+	.byte	0xe
+	.long	0x47
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1601
+	.byte	0x6
+	.value	0x1bd
+	.byte	0xe
+	.long	0x47
+	.byte	0x24
+	.uleb128 0xb
+	.string	"win"
+	.byte	0x6
+	.value	0x1be
+	.byte	0x11
+	.long	0x444
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1602
+	.byte	0x6
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x456
+	.byte	0x38
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1603
+	.byte	0x6
+	.value	0x16c
+	.byte	0x1e
+	.long	0x2f0
+	.uleb128 0xa
+	.long	0x2de
+	.uleb128 0x1a
+	.long	.LASF1604
+	.byte	0x40
+	.byte	0x2
+	.value	0x14f
+	.byte	0x8
+	.long	0x30b
+	.uleb128 0xb
+	.string	"q"
+	.byte	0x2
+	.value	0x150
+	.byte	0x1b
+	.long	0x5da
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x38
+	.value	0x174
+	.long	0x384
+	.uleb128 0x6
+	.long	.LASF1605
+	.byte	0x6
+	.value	0x176
+	.byte	0xc
+	.long	0x394
+	.byte	0
+	.uleb128 0xb
+	.string	"put"
+	.byte	0x6
+	.value	0x178
+	.byte	0xc
+	.long	0x3a9
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1606
+	.byte	0x6
+	.value	0x17b
+	.byte	0xc
+	.long	0x394
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1607
+	.byte	0x6
+	.value	0x182
+	.byte	0xb
+	.long	0x3c9
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1608
+	.byte	0x6
+	.value	0x186
+	.byte	0xc
+	.long	0x3e3
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1609
+	.byte	0x6
+	.value	0x18c
+	.byte	0xc
+	.long	0x3f8
+	.byte	0x28
+	.uleb128 0xb
+	.string	"enc"
+	.byte	0x6
+	.value	0x191
+	.byte	0x13
+	.long	0x39
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF1592
+	.byte	0x6
+	.value	0x192
+	.byte	0xa
+	.long	0x3fd
+	.byte	0x31
+	.byte	0
+	.uleb128 0x18
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x38f
+	.byte	0
+	.uleb128 0x3
+	.long	0x252
+	.uleb128 0x3
+	.long	0x384
+	.uleb128 0x18
+	.long	0x3a9
+	.uleb128 0x1
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x47
+	.byte	0
+	.uleb128 0x3
+	.long	0x399
+	.uleb128 0x11
+	.long	0x3c2
+	.long	0x3c2
+	.uleb128 0x1
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1610
+	.uleb128 0x3
+	.long	0x3ae
+	.uleb128 0x18
+	.long	0x3e3
+	.uleb128 0x1
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x47
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x3
+	.long	0x3ce
+	.uleb128 0x18
+	.long	0x3f8
+	.uleb128 0x1
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x3
+	.long	0x3e8
+	.uleb128 0xe
+	.long	0x7d
+	.long	0x40d
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x6
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1611
+	.byte	0x6
+	.value	0x193
+	.byte	0x3
+	.long	0x30b
+	.uleb128 0xa
+	.long	0x40d
+	.uleb128 0x1f
+	.byte	0x10
+	.value	0x19a
+	.long	0x444
+	.uleb128 0xb
+	.string	"cur"
+	.byte	0x6
+	.value	0x19b
+	.byte	0xb
+	.long	0x6a
+	.byte	0
+	.uleb128 0xb
+	.string	"end"
+	.byte	0x6
+	.value	0x19c
+	.byte	0xb
+	.long	0x6a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1612
+	.byte	0x6
+	.value	0x19d
+	.byte	0x3
+	.long	0x41f
+	.uleb128 0x3
+	.long	0x41a
+	.uleb128 0x3
+	.long	0x2eb
+	.uleb128 0x19
+	.byte	0x70
+	.byte	0x7
+	.byte	0x94
+	.long	0x4c9
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x7
+	.byte	0x95
+	.byte	0x11
+	.long	0x252
+	.byte	0
+	.uleb128 0x10
+	.string	"fd"
+	.byte	0x7
+	.byte	0x96
+	.byte	0xa
+	.long	0x63
+	.byte	0x40
+	.uleb128 0x7
+	.long	.LASF1613
+	.byte	0x7
+	.byte	0x97
+	.byte	0xb
+	.long	0x78
+	.byte	0x48
+	.uleb128 0x7
+	.long	.LASF1614
+	.byte	0x7
+	.byte	0x98
+	.byte	0xc
+	.long	0x95
+	.byte	0x50
+	.uleb128 0x10
+	.string	"pos"
+	.byte	0x7
+	.byte	0x99
+	.byte	0xc
+	.long	0x95
+	.byte	0x58
+	.uleb128 0x7
+	.long	.LASF1615
+	.byte	0x7
+	.byte	0x9a
+	.byte	0xc
+	.long	0x95
+	.byte	0x60
+	.uleb128 0x7
+	.long	.LASF1616
+	.byte	0x7
+	.byte	0x9b
+	.byte	0x9
+	.long	0x3c2
+	.byte	0x68
+	.uleb128 0x7
+	.long	.LASF1592
+	.byte	0x7
+	.byte	0x9c
+	.byte	0xa
+	.long	0x3fd
+	.byte	0x69
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1617
+	.byte	0x7
+	.byte	0x9d
+	.byte	0x3
+	.long	0x45b
+	.uleb128 0xa
+	.long	0x4c9
+	.uleb128 0x19
+	.byte	0x88
+	.byte	0x2
+	.byte	0xc9
+	.long	0x4fd
+	.uleb128 0x10
+	.string	"cls"
+	.byte	0x2
+	.byte	0xce
+	.byte	0x13
+	.long	0x4fd
+	.byte	0
+	.uleb128 0x10
+	.string	"esc"
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x18
+	.long	0x50d
+	.byte	0x80
+	.byte	0
+	.uleb128 0xe
+	.long	0x39
+	.long	0x50d
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x3
+	.long	0xa6
+	.uleb128 0x17
+	.long	.LASF1618
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x3
+	.long	0x4da
+	.uleb128 0xa
+	.long	0x512
+	.uleb128 0x19
+	.byte	0x38
+	.byte	0x2
+	.byte	0xe0
+	.long	0x57f
+	.uleb128 0x7
+	.long	.LASF1619
+	.byte	0x2
+	.byte	0xef
+	.byte	0x18
+	.long	0x57f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1620
+	.byte	0x2
+	.value	0x101
+	.byte	0xb
+	.long	0x5aa
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1621
+	.byte	0x2
+	.value	0x10e
+	.byte	0xb
+	.long	0x5be
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1622
+	.byte	0x2
+	.value	0x12a
+	.byte	0xc
+	.long	0x3a9
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1623
+	.byte	0x2
+	.value	0x131
+	.byte	0xc
+	.long	0x394
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1624
+	.byte	0x2
+	.value	0x141
+	.byte	0x21
+	.long	0x5c3
+	.byte	0x30
+	.byte	0
+	.uleb128 0xe
+	.long	0x58f
+	.long	0x58f
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1625
+	.uleb128 0x11
+	.long	0x3c2
+	.long	0x5aa
+	.uleb128 0x1
+	.long	0x38f
+	.uleb128 0x1
+	.long	0x47
+	.byte	0
+	.uleb128 0x3
+	.long	0x596
+	.uleb128 0x11
+	.long	0x3c2
+	.long	0x5be
+	.uleb128 0x1
+	.long	0x38f
+	.byte	0
+	.uleb128 0x3
+	.long	0x5af
+	.uleb128 0x3
+	.long	0x51e
+	.uleb128 0x12
+	.long	.LASF1626
+	.byte	0x2
+	.value	0x142
+	.byte	0x3
+	.long	0x523
+	.uleb128 0xa
+	.long	0x5c8
+	.uleb128 0xe
+	.long	0x5ea
+	.long	0x5ea
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	0x5d5
+	.uleb128 0x1b
+	.long	.LASF1627
+	.byte	0x3d
+	.long	0x6a
+	.long	0x60d
+	.uleb128 0x1
+	.long	0x6a
+	.uleb128 0x1
+	.long	0x5c
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1628
+	.byte	0x2b
+	.long	0x6a
+	.long	0x62b
+	.uleb128 0x1
+	.long	0x6a
+	.uleb128 0x1
+	.long	0x1aa
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1645
+	.byte	0xa
+	.byte	0x25
+	.byte	0xd
+	.long	0x637
+	.uleb128 0x3
+	.long	0x5c
+	.uleb128 0x2c
+	.long	.LASF1629
+	.byte	0x4
+	.value	0x17a
+	.byte	0x10
+	.long	0x89
+	.long	0x65d
+	.uleb128 0x1
+	.long	0x5c
+	.uleb128 0x1
+	.long	0x1aa
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1630
+	.byte	0x2f
+	.long	0x6a
+	.long	0x67b
+	.uleb128 0x1
+	.long	0x6a
+	.uleb128 0x1
+	.long	0x1aa
+	.uleb128 0x1
+	.long	0x95
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1631
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0x69c
+	.uleb128 0x1
+	.long	0xa1
+	.uleb128 0x1
+	.long	0xa1
+	.uleb128 0x1
+	.long	0x47
+	.uleb128 0x1
+	.long	0xa1
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1632
+	.byte	0xcf
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x71e
+	.uleb128 0x4
+	.string	"s"
+	.byte	0xcf
+	.byte	0x29
+	.long	0x38f
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xcf
+	.byte	0x35
+	.long	0x47
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x4
+	.string	"n"
+	.byte	0xcf
+	.byte	0x3f
+	.long	0x95
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x20
+	.string	"x"
+	.byte	0xd1
+	.long	0x7d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.uleb128 0xc
+	.quad	.LVL111
+	.long	0x837
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1633
+	.byte	0xca
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x77d
+	.uleb128 0x4
+	.string	"s"
+	.byte	0xca
+	.byte	0x24
+	.long	0x38f
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xca
+	.byte	0x2c
+	.long	0x7d
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0xc
+	.quad	.LVL107
+	.long	0xbf2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1634
+	.byte	0xb1
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x832
+	.uleb128 0x4
+	.string	"s"
+	.byte	0xb2
+	.byte	0x12
+	.long	0x38f
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xb3
+	.byte	0xe
+	.long	0x47
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x4
+	.string	"put"
+	.byte	0xb4
+	.byte	0xc
+	.long	0x3a9
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x9
+	.string	"t"
+	.byte	0xb6
+	.byte	0x15
+	.long	0x832
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x20
+	.string	"x"
+	.byte	0xc1
+	.long	0xb9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2e
+	.quad	.LVL100
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.long	0x809
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.uleb128 0x2f
+	.quad	.LVL102
+	.long	0x81d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL103
+	.long	0xdb6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x4c9
+	.uleb128 0x13
+	.long	.LASF1635
+	.byte	0x8a
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb23
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x8a
+	.byte	0x25
+	.long	0x38f
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x8a
+	.byte	0x34
+	.long	0x1aa
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x4
+	.string	"k"
+	.byte	0x8a
+	.byte	0x3e
+	.long	0x95
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x8a
+	.byte	0x48
+	.long	0x95
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x9
+	.string	"t"
+	.byte	0x8c
+	.byte	0x15
+	.long	0x832
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x9
+	.string	"cap"
+	.byte	0x9d
+	.byte	0xc
+	.long	0x95
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x30
+	.quad	.LBB66
+	.quad	.LBE66-.LBB66
+	.long	0xa0c
+	.uleb128 0x31
+	.long	.LASF1636
+	.byte	0x1
+	.byte	0x90
+	.byte	0xe
+	.long	0xb23
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x9
+	.string	"m"
+	.byte	0x91
+	.byte	0x10
+	.long	0x95
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x21
+	.long	.LLRL44
+	.long	0x991
+	.uleb128 0x9
+	.string	"j"
+	.byte	0x94
+	.byte	0x14
+	.long	0x95
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x14
+	.long	0xf86
+	.quad	.LBI72
+	.byte	.LVU220
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.byte	0x96
+	.byte	0x11
+	.long	0x96d
+	.uleb128 0x5
+	.long	0xf9b
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x5
+	.long	0xf91
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x1c
+	.long	0xfa5
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.uleb128 0x15
+	.long	0xfa6
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL72
+	.long	0xea4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x7d
+	.sleb128 0
+	.byte	0x1e
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	0xf3c
+	.quad	.LBI67
+	.byte	.LVU187
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.byte	0x1
+	.byte	0x92
+	.byte	0x9
+	.uleb128 0x5
+	.long	0xf65
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x5
+	.long	0xf5b
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x5
+	.long	0xf51
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x5
+	.long	0xf47
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x15
+	.long	0xf6f
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x22
+	.long	0xf79
+	.long	.LLRL42
+	.uleb128 0x15
+	.long	0xf7a
+	.long	.LLST43
+	.long	.LVUS43
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LLRL50
+	.long	0xadc
+	.uleb128 0x9
+	.string	"j"
+	.byte	0x9f
+	.byte	0x10
+	.long	0x95
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x14
+	.long	0xf3c
+	.quad	.LBI79
+	.byte	.LVU265
+	.quad	.LBB79
+	.quad	.LBE79-.LBB79
+	.byte	0xaa
+	.byte	0x9
+	.long	0xaa3
+	.uleb128 0x5
+	.long	0xf65
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x5
+	.long	0xf5b
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x5
+	.long	0xf51
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x5
+	.long	0xf47
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x15
+	.long	0xf6f
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x22
+	.long	0xf79
+	.long	.LLRL57
+	.uleb128 0x15
+	.long	0xf7a
+	.long	.LLST58
+	.long	.LVUS58
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL80
+	.long	0xdb6
+	.long	0xabb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL83
+	.long	0xbf2
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0xe11
+	.quad	.LBI76
+	.byte	.LVU231
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.byte	0x9d
+	.byte	0x12
+	.long	0xb0e
+	.uleb128 0x5
+	.long	0xe22
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL59
+	.long	0xe79
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x7d
+	.long	0xb33
+	.uleb128 0xf
+	.long	0x32
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1646
+	.byte	0x1
+	.byte	0x78
+	.byte	0xc
+	.long	0x3c2
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbf2
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x78
+	.byte	0x26
+	.long	0x38f
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x34
+	.long	.LASF1637
+	.byte	0x1
+	.byte	0x78
+	.byte	0x30
+	.long	0x95
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x9
+	.string	"t"
+	.byte	0x7a
+	.byte	0x15
+	.long	0x832
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x9
+	.string	"cap"
+	.byte	0x7f
+	.byte	0xc
+	.long	0x95
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x35
+	.long	0xe11
+	.quad	.LBI48
+	.byte	.LVU151
+	.long	.LLRL28
+	.byte	0x1
+	.byte	0x7f
+	.byte	0x12
+	.long	0xbc5
+	.uleb128 0x5
+	.long	0xe22
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL48
+	.long	0xe79
+	.long	0xbdd
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL55
+	.long	0xdb6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1638
+	.byte	0x62
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd62
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x62
+	.byte	0x26
+	.long	0x38f
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x62
+	.byte	0x35
+	.long	0x1aa
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x62
+	.byte	0x3f
+	.long	0x95
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x9
+	.string	"t"
+	.byte	0x64
+	.byte	0x15
+	.long	0x832
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x9
+	.string	"cap"
+	.byte	0x66
+	.byte	0xc
+	.long	0x95
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x14
+	.long	0xe11
+	.quad	.LBI41
+	.byte	.LVU96
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.byte	0x66
+	.byte	0x12
+	.long	0xc97
+	.uleb128 0x5
+	.long	0xe22
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0x14
+	.long	0xf86
+	.quad	.LBI43
+	.byte	.LVU119
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.byte	0x70
+	.byte	0xd
+	.long	0xcf9
+	.uleb128 0x5
+	.long	0xf9b
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x5
+	.long	0xf91
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1c
+	.long	0xfa5
+	.quad	.LBB45
+	.quad	.LBE45-.LBB45
+	.uleb128 0x15
+	.long	0xfa6
+	.long	.LLST23
+	.long	.LVUS23
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL33
+	.long	0xe79
+	.long	0xd11
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL37
+	.long	0xe31
+	.long	0xd29
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL38
+	.long	0xdb6
+	.long	0xd41
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL39
+	.long	0xea4
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1639
+	.byte	0x5a
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdb6
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x5a
+	.byte	0x27
+	.long	0x38f
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x9
+	.string	"t"
+	.byte	0x5c
+	.byte	0x15
+	.long	0x832
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x23
+	.quad	.LVL31
+	.long	0xdb6
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1640
+	.byte	0x54
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe11
+	.uleb128 0x4
+	.string	"t"
+	.byte	0x54
+	.byte	0x29
+	.long	0x832
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0xd
+	.quad	.LVL28
+	.long	0xe79
+	.long	0xdfb
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x23
+	.quad	.LVL29
+	.long	0xe31
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1647
+	.byte	0x1
+	.byte	0x49
+	.byte	0xf
+	.long	0x95
+	.byte	0x1
+	.long	0xe2c
+	.uleb128 0x1d
+	.string	"t"
+	.byte	0x49
+	.byte	0x2c
+	.long	0xe2c
+	.byte	0
+	.uleb128 0x3
+	.long	0x4d5
+	.uleb128 0x37
+	.long	.LASF1641
+	.byte	0x1
+	.byte	0x36
+	.byte	0xd
+	.byte	0x1
+	.long	0xe64
+	.uleb128 0x1d
+	.string	"t"
+	.byte	0x36
+	.byte	0x2b
+	.long	0x832
+	.uleb128 0x1d
+	.string	"n"
+	.byte	0x36
+	.byte	0x35
+	.long	0x95
+	.uleb128 0x38
+	.long	.LASF1648
+	.long	0xe74
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.uleb128 0xe
+	.long	0x84
+	.long	0xe74
+	.uleb128 0xf
+	.long	0x32
+	.byte	0xd
+	.byte	0
+	.uleb128 0xa
+	.long	0xe64
+	.uleb128 0x39
+	.long	.LASF1649
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xd
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xea4
+	.uleb128 0x3a
+	.string	"t"
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x27
+	.long	0x832
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF1650
+	.byte	0x1
+	.byte	0x13
+	.byte	0xc
+	.long	0x3c2
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf3c
+	.uleb128 0x4
+	.string	"t"
+	.byte	0x13
+	.byte	0x25
+	.long	0x832
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x4
+	.string	"p"
+	.byte	0x13
+	.byte	0x34
+	.long	0xa1
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x13
+	.byte	0x3e
+	.long	0x95
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x3c
+	.long	.LLRL3
+	.uleb128 0x9
+	.string	"k"
+	.byte	0x16
+	.byte	0x11
+	.long	0x89
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xd
+	.quad	.LVL4
+	.long	0x63c
+	.long	0xf2d
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL5
+	.long	0x62b
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1642
+	.value	0x22c
+	.long	0xf86
+	.uleb128 0x16
+	.string	"w"
+	.value	0x22d
+	.byte	0xb
+	.long	0x6a
+	.uleb128 0x16
+	.string	"x"
+	.value	0x22d
+	.byte	0x1a
+	.long	0x1aa
+	.uleb128 0x16
+	.string	"k"
+	.value	0x22d
+	.byte	0x24
+	.long	0x95
+	.uleb128 0x16
+	.string	"n"
+	.value	0x22d
+	.byte	0x2e
+	.long	0x95
+	.uleb128 0x1e
+	.string	"p"
+	.value	0x22f
+	.byte	0xb
+	.long	0x78
+	.uleb128 0x26
+	.uleb128 0x1e
+	.string	"i"
+	.value	0x234
+	.byte	0x11
+	.long	0x95
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1643
+	.value	0x1a9
+	.long	0xfb4
+	.uleb128 0x16
+	.string	"s"
+	.value	0x1a9
+	.byte	0x35
+	.long	0x38f
+	.uleb128 0x16
+	.string	"e"
+	.value	0x1a9
+	.byte	0x41
+	.long	0x47
+	.uleb128 0x26
+	.uleb128 0x1e
+	.string	"_xp"
+	.value	0x1ac
+	.byte	0x2d
+	.long	0xfb4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x47
+	.uleb128 0x3d
+	.long	0xe31
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x5
+	.long	0xe3e
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x5
+	.long	0xe47
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x14
+	.long	0xe31
+	.quad	.LBI31
+	.byte	.LVU46
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.byte	0x36
+	.byte	0xd
+	.long	0x10b6
+	.uleb128 0x5
+	.long	0xe47
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x5
+	.long	0xe3e
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x14
+	.long	0xf86
+	.quad	.LBI33
+	.byte	.LVU52
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.byte	0x3d
+	.byte	0x9
+	.long	0x108a
+	.uleb128 0x5
+	.long	0xf9b
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x5
+	.long	0xf91
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1c
+	.long	0xfa5
+	.quad	.LBB35
+	.quad	.LBE35-.LBB35
+	.uleb128 0x15
+	.long	0xfa6
+	.long	.LLST11
+	.long	.LVUS11
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL18
+	.long	0xea4
+	.long	0x10a8
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL22
+	.long	0x65d
+	.byte	0
+	.uleb128 0xc
+	.quad	.LVL16
+	.long	0x67b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x3b
+	.uleb128 0x2
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x83
+	.uleb128 0x18
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS65:
+	.uleb128 0
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 0
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 0
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 0
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 0
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+	.uleb128 .LVU335
+	.uleb128 0
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL111-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 0
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 0
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 .LFE24-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS64:
+	.uleb128 0
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 0
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS61:
+	.uleb128 0
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU307
+	.uleb128 .LVU307
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL102-1-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU298
+	.uleb128 .LVU302
+	.uleb128 .LVU302
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 0
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU206
+	.uleb128 .LVU206
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU291
+	.uleb128 .LVU291
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 0
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU293
+	.uleb128 .LVU293
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS33:
+	.uleb128 0
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU252
+	.uleb128 .LVU252
+	.uleb128 .LVU254
+	.uleb128 .LVU254
+	.uleb128 .LVU285
+	.uleb128 .LVU290
+	.uleb128 .LVU295
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU175
+	.uleb128 .LVU194
+	.uleb128 .LVU194
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 0
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU238
+	.uleb128 .LVU241
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU186
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU229
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU211
+	.uleb128 .LVU216
+	.uleb128 .LVU219
+	.uleb128 .LVU229
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU220
+	.uleb128 .LVU229
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU220
+	.uleb128 .LVU229
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU226
+	.uleb128 .LVU229
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU187
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU206
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x25
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x7c
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU187
+	.uleb128 .LVU206
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU187
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU206
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU187
+	.uleb128 .LVU206
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU189
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU204
+	.uleb128 .LVU204
+	.uleb128 .LVU206
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU198
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU205
+	.uleb128 .LVU205
+	.uleb128 .LVU206
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU243
+	.uleb128 .LVU246
+	.uleb128 .LVU248
+	.uleb128 .LVU253
+	.uleb128 .LVU253
+	.uleb128 .LVU255
+	.uleb128 .LVU258
+	.uleb128 .LVU259
+	.uleb128 .LVU259
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU291
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0xc
+	.byte	0x7e
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU265
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU281
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU265
+	.uleb128 .LVU281
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU265
+	.uleb128 .LVU281
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU265
+	.uleb128 .LVU273
+	.uleb128 .LVU273
+	.uleb128 .LVU281
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0xa
+	.byte	0x76
+	.sleb128 72
+	.byte	0x6
+	.byte	0x76
+	.sleb128 88
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU267
+	.uleb128 .LVU279
+	.uleb128 .LVU279
+	.uleb128 .LVU281
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS58:
+	.uleb128 .LVU273
+	.uleb128 .LVU276
+	.uleb128 .LVU276
+	.uleb128 .LVU280
+	.uleb128 .LVU280
+	.uleb128 .LVU281
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU231
+	.uleb128 .LVU238
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU160
+	.uleb128 .LVU160
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU169
+	.uleb128 .LVU169
+	.uleb128 .LVU171
+	.uleb128 .LVU171
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-1-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU141
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU156
+	.uleb128 .LVU171
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU151
+	.uleb128 .LVU156
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU106
+	.uleb128 .LVU106
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU136
+	.uleb128 .LVU136
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU92
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU101
+	.uleb128 .LVU137
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU119
+	.uleb128 .LVU128
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU119
+	.uleb128 .LVU128
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU125
+	.uleb128 .LVU128
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU86
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL31-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL29-1-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU35
+	.uleb128 .LVU35
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU16
+	.uleb128 .LVU27
+	.uleb128 .LVU32
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU16
+	.uleb128 .LVU29
+	.uleb128 .LVU32
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU18
+	.uleb128 .LVU22
+	.uleb128 .LVU23
+	.uleb128 .LVU30
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS5:
+	.uleb128 0
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU46
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 .LVU71
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU46
+	.uleb128 .LVU71
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU52
+	.uleb128 .LVU61
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU52
+	.uleb128 .LVU61
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU58
+	.uleb128 .LVU61
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB24-.Ltext0
+	.uleb128 .LBE24-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB25-.Ltext0
+	.uleb128 .LBE25-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB69-.Ltext0
+	.uleb128 .LBE69-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB70-.Ltext0
+	.uleb128 .LBE70-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB71-.Ltext0
+	.uleb128 .LBE71-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB75-.Ltext0
+	.uleb128 .LBE75-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB78-.Ltext0
+	.uleb128 .LBE78-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF386
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0xd9
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF633
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF693
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1042
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1043
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1048
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1049
+	.file 29 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x1e
+	.file 31 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1050
+	.file 32 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1185
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1187
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1188
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x21
+	.file 35 "/usr/include/limits.h"
+	.byte	0x3
+	.uleb128 0xcb
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"
+	.byte	0x3
+	.uleb128 0xc3
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1210
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h"
+	.byte	0x3
+	.uleb128 0xa1
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 39 "/usr/include/linux/limits.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1274
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1281
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"
+	.byte	0x3
+	.uleb128 0xc7
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF1301
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1339
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1340
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1349
+	.file 46 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1350
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1351
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 47 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 48 "/usr/include/uchar.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1392
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1393
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 51 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1453
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 52 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1456
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 53 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1459
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 54 "./include/va_print/fd_utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1479
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1480
+	.file 55 "./include/va_print/fd_utf16be.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1481
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1482
+	.file 56 "./include/va_print/fd_utf32be.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1483
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF437
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF451
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF452
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF513
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF531
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF539
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.34.7aefa0a1ce660b7f06a1931d229ef869,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF555
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF617
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF629
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.210.b7626dff4e8645cee35c44183ab9e1fb,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF632
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF648
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF690
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF692
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.221.1c4b8ffb35d9df7e3e05ff92aa0722d4,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF696
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.233.3c1174b0f8677cd60103c1484341f85e,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF735
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1041
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.1108.0d9b49b7dac9f8f76c53696f4c15e077,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF1047
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1085
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1184
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.23.3c23ae3e8f372a0298be6ce978307bc7,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1190
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1191
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1197
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1199
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1201
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1205
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.32.6a1c51cbc8834927c9b529a347d7b23f,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1209
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix1_lim.h.32.a7cb894e219b90f9f73cd9217f417c40,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1240
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.25.97ee4129efb08ad296101237bcd3401b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1244
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.3.0a3ae0fffe30e22dfdd77ac2c1b1fbdd,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1258
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.42.a403368f4a1bbbff510e22bd9037c5aa,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1260
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1261
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF1262
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1263
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1264
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1273
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.local_lim.h.84.535be492ad9773d11e46b49da2c4d18d,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1280
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix2_lim.h.23.56b9c4f885cbac0b652f53ee56b244b1,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1300
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.limits.h.60.7bfe30ae3ff4e90f07238e284348f8e7,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1208
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1337
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1190
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF696
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.34.5c7a904026bfb22c2884c9ab35150e04,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1348
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1364
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1365
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1381
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1382
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1390
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1365
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1383
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1384
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1452
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1455
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1458
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1478
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fd.h.34.34eaa4e3f8e9cdaee5511d8aa0dc2d5e,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1495
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.13.ba8b097355bd637e9189dfa7d96daa61,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1570
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1443:
+	.string	"VA_U_EOT -1U"
+.LASF572:
+	.string	"_POSIX_THREADS 200809L"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1317:
+	.string	"SHRT_MAX"
+.LASF624:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF1031:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF974:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF801:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF849:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF1375:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1080:
+	.string	"ESPIPE 29"
+.LASF454:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1318:
+	.string	"SHRT_MAX __SHRT_MAX__"
+.LASF757:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF1102:
+	.string	"EL2HLT 51"
+.LASF962:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF481:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1175:
+	.string	"EMEDIUMTYPE 124"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1457:
+	.string	"va_char16_p_format utf16"
+.LASF1190:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF796:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF640:
+	.string	"__SQUAD_TYPE long int"
+.LASF1516:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF1523:
+	.string	"VA_SIGN_PLUS 2"
+.LASF442:
+	.string	"__USE_MISC 1"
+.LASF951:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF603:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF550:
+	.string	"_XOPEN_XPG2 1"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF726:
+	.string	"R_OK 4"
+.LASF723:
+	.string	"__pid_t_defined "
+.LASF1538:
+	.string	"VA_STATE_PREC 3"
+.LASF828:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF1539:
+	.string	"VA_STATE_SKIP 4"
+.LASF505:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1267:
+	.string	"_POSIX_THREAD_KEYS_MAX 128"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1269:
+	.string	"_POSIX_THREAD_DESTRUCTOR_ITERATIONS 4"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1160:
+	.string	"ETOOMANYREFS 109"
+.LASF821:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF1591:
+	.string	"str_prefix"
+.LASF1210:
+	.string	"_BITS_POSIX1_LIM_H 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1610:
+	.string	"_Bool"
+.LASF1256:
+	.string	"XATTR_SIZE_MAX 65536"
+.LASF1476:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF516:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1282:
+	.string	"_BITS_POSIX2_LIM_H 1"
+.LASF788:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1245:
+	.string	"_LINUX_LIMITS_H "
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1183:
+	.string	"ERFKILL 132"
+.LASF1208:
+	.string	"LLONG_MAX __LONG_LONG_MAX__"
+.LASF458:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF695:
+	.string	"__need_size_t "
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF498:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF911:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF1051:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF1227:
+	.string	"_POSIX_PIPE_BUF 512"
+.LASF958:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF1647:
+	.string	"fd_cap"
+.LASF789:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF1439:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF812:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF1143:
+	.string	"ENOPROTOOPT 92"
+.LASF1546:
+	.string	"VA_QUOTE_kk 5"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF1185:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF408:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF600:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF1289:
+	.string	"_POSIX2_LINE_MAX 2048"
+.LASF1092:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF1188:
+	.string	"_GCC_NEXT_LIMITS_H "
+.LASF1242:
+	.string	"__undef_LINK_MAX "
+.LASF1156:
+	.string	"ENOBUFS 105"
+.LASF1367:
+	.string	"__WCHAR_T__ "
+.LASF1103:
+	.string	"EBADE 52"
+.LASF1615:
+	.string	"mark"
+.LASF922:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF940:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF1486:
+	.string	"VA_STREAM_FD(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), NULL, 0, 0, 0, 0, {0} })"
+.LASF1291:
+	.string	"_POSIX2_CHARCLASS_NAME_MAX 14"
+.LASF1254:
+	.string	"PIPE_BUF 4096"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1168:
+	.string	"EUCLEAN 117"
+.LASF1283:
+	.string	"_POSIX2_BC_BASE_MAX 99"
+.LASF1386:
+	.string	"_STDBOOL_H "
+.LASF1308:
+	.string	"SCHAR_MAX __SCHAR_MAX__"
+.LASF1462:
+	.string	"VA_SIGIL '~'"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1326:
+	.string	"UINT_MAX (INT_MAX * 2U + 1U)"
+.LASF1127:
+	.string	"ENOTUNIQ 76"
+.LASF934:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF479:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1453:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF1003:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF770:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1639:
+	.string	"va_fd_finish"
+.LASF571:
+	.string	"_XOPEN_SHM 1"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF374:
+	.string	"linux 1"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF690:
+	.string	"__FD_SETSIZE 1024"
+.LASF582:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF1237:
+	.string	"_POSIX_TIMER_MAX 32"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF682:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1322:
+	.string	"INT_MIN (-INT_MAX - 1)"
+.LASF460:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF816:
+	.string	"_SC_POLL _SC_POLL"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1268:
+	.string	"PTHREAD_KEYS_MAX 1024"
+.LASF917:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF1069:
+	.string	"EXDEV 18"
+.LASF839:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF740:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF1074:
+	.string	"ENFILE 23"
+.LASF1468:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF637:
+	.string	"__U32_TYPE unsigned int"
+.LASF1418:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF1448:
+	.string	"VA_E_ENCODE 3"
+.LASF1038:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1441:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF1119:
+	.string	"EADV 68"
+.LASF1030:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF609:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF1557:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF730:
+	.string	"SEEK_SET 0"
+.LASF1171:
+	.string	"EISNAM 120"
+.LASF1622:
+	.string	"render_quote"
+.LASF406:
+	.string	"__USE_MISC"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF743:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF797:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1135:
+	.string	"EILSEQ 84"
+.LASF597:
+	.string	"_POSIX_SHELL 1"
+.LASF567:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF1619:
+	.string	"delim"
+.LASF1366:
+	.string	"__wchar_t__ "
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1077:
+	.string	"ETXTBSY 26"
+.LASF1425:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF397:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF619:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF1207:
+	.string	"LLONG_MIN (-LLONG_MAX-1)"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF517:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1123:
+	.string	"EMULTIHOP 72"
+.LASF657:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1288:
+	.string	"_POSIX2_EXPR_NEST_MAX 32"
+.LASF907:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1036:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF799:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1255:
+	.string	"XATTR_NAME_MAX 255"
+.LASF885:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF910:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1508:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF686:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF477:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1596:
+	.string	"va_stream_t"
+.LASF1356:
+	.string	"_T_PTRDIFF_ "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF708:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1607:
+	.string	"refill"
+.LASF1603:
+	.string	"va_quotations_t"
+.LASF1427:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1412:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF1090:
+	.string	"ENOTEMPTY 39"
+.LASF1493:
+	.string	"va_dprintf(F,...) va_xdprintf(VA_STREAM_FD_BUF, F, __VA_ARGS__)"
+.LASF1271:
+	.string	"_POSIX_THREAD_THREADS_MAX 64"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF456:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1280:
+	.string	"SEM_VALUE_MAX (2147483647)"
+.LASF769:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF1423:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1340:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1377:
+	.string	"___int_wchar_t_h "
+.LASF1068:
+	.string	"EEXIST 17"
+.LASF468:
+	.string	"__BEGIN_DECLS "
+.LASF832:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1217:
+	.string	"_POSIX_LINK_MAX 8"
+.LASF1634:
+	.string	"va_fd_put_whole"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF946:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF1349:
+	.string	"VA_PRINT_FD_H_ "
+.LASF527:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1262:
+	.string	"__undef_LINK_MAX"
+.LASF500:
+	.string	"__always_inline"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1249:
+	.string	"LINK_MAX 127"
+.LASF808:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1315:
+	.string	"SHRT_MIN"
+.LASF1107:
+	.string	"EBADRQC 56"
+.LASF559:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF589:
+	.string	"_LFS_LARGEFILE 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF748:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF826:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF1504:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF879:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF1301:
+	.string	"_GCC_NEXT_LIMITS_H"
+.LASF604:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1544:
+	.string	"VA_QUOTE_Q 3"
+.LASF987:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF1621:
+	.string	"check_flush"
+.LASF831:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF1039:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF667:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF877:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF959:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF483:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF643:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1117:
+	.string	"EREMOTE 66"
+.LASF747:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF891:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1151:
+	.string	"ENETDOWN 100"
+.LASF473:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF513:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1445:
+	.string	"VA_E_OK 0"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF533:
+	.string	"__stub_chflags "
+.LASF1223:
+	.string	"_POSIX_NAME_MAX 14"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1393:
+	.string	"____mbstate_t_defined 1"
+.LASF1073:
+	.string	"EINVAL 22"
+.LASF1310:
+	.string	"UCHAR_MAX (SCHAR_MAX * 2 + 1)"
+.LASF1389:
+	.string	"false 0"
+.LASF948:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1519:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF1534:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1094:
+	.string	"EIDRM 43"
+.LASF712:
+	.string	"_GCC_SIZE_T "
+.LASF537:
+	.string	"__stub_setlogin "
+.LASF787:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF929:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF539:
+	.string	"__stub_stty "
+.LASF1511:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF438:
+	.string	"__WORDSIZE 64"
+.LASF1296:
+	.string	"COLL_WEIGHTS_MAX 255"
+.LASF1264:
+	.string	"__undef_OPEN_MAX"
+.LASF526:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF985:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF611:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF945:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF720:
+	.string	"__uid_t_defined "
+.LASF1169:
+	.string	"ENOTNAM 118"
+.LASF1555:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF1054:
+	.string	"ESRCH 3"
+.LASF1636:
+	.string	"chunk"
+.LASF1155:
+	.string	"ECONNRESET 104"
+.LASF620:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF560:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF807:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF1286:
+	.string	"_POSIX2_BC_STRING_MAX 1000"
+.LASF1551:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF887:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF636:
+	.string	"__S32_TYPE int"
+.LASF1563:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF924:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1589:
+	.string	"has_size"
+.LASF512:
+	.string	"__attribute_copy__"
+.LASF1617:
+	.string	"va_stream_fd_t"
+.LASF709:
+	.string	"_SIZE_T_DECLARED "
+.LASF444:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1193:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF649:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF542:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF493:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1233:
+	.string	"_POSIX_SSIZE_MAX 32767"
+.LASF848:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1368:
+	.string	"_WCHAR_T "
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF601:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1204:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1347:
+	.string	"static_assert"
+.LASF1060:
+	.string	"EBADF 9"
+.LASF933:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1584:
+	.string	"type"
+.LASF1404:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF1571:
+	.string	"long unsigned int"
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF983:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF1133:
+	.string	"ELIBMAX 82"
+.LASF1362:
+	.string	"_GCC_PTRDIFF_T "
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1224:
+	.string	"_POSIX_NGROUPS_MAX 8"
+.LASF701:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1016:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF1005:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF599:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF1300:
+	.string	"RE_DUP_MAX (0x7fff)"
+.LASF1447:
+	.string	"VA_E_DECODE 2"
+.LASF1304:
+	.string	"CHAR_BIT __CHAR_BIT__"
+.LASF1048:
+	.string	"_ERRNO_H 1"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1424:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF610:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1114:
+	.string	"ENOSR 63"
+.LASF386:
+	.string	"_UNISTD_H 1"
+.LASF430:
+	.string	"__USE_POSIX 1"
+.LASF552:
+	.string	"_XOPEN_XPG4 1"
+.LASF392:
+	.string	"__USE_POSIX"
+.LASF866:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF1378:
+	.string	"__INT_WCHAR_T_H "
+.LASF719:
+	.string	"__gid_t_defined "
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1002:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF900:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF1628:
+	.string	"memcpy"
+.LASF524:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF749:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF1017:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF773:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF913:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1595:
+	.string	"va_read_iter_t"
+.LASF1047:
+	.string	"F_TEST 3"
+.LASF1022:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF475:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1469:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF1014:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1194:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF510:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1426:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF1520:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF1541:
+	.string	"VA_QUOTE_NONE 0"
+.LASF858:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF1136:
+	.string	"ERESTART 85"
+.LASF835:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF851:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1502:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF1543:
+	.string	"VA_QUOTE_q 2"
+.LASF350:
+	.string	"__amd64 1"
+.LASF1572:
+	.string	"unsigned char"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1248:
+	.string	"ARG_MAX 131072"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1363:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF785:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF737:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF969:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF359:
+	.string	"__k8 1"
+.LASF1442:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF1505:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF1058:
+	.string	"E2BIG 7"
+.LASF912:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF1342:
+	.string	"_ASSERT_H 1"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF390:
+	.string	"__USE_ISOC95"
+.LASF389:
+	.string	"__USE_ISOC99"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF742:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF1512:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF627:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF1588:
+	.string	"transcode"
+.LASF574:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF631:
+	.string	"STDOUT_FILENO 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1057:
+	.string	"ENXIO 6"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1415:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF1355:
+	.string	"_PTRDIFF_T "
+.LASF978:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF521:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF399:
+	.string	"__USE_XOPEN2K"
+.LASF1316:
+	.string	"SHRT_MIN (-SHRT_MAX - 1)"
+.LASF395:
+	.string	"__USE_POSIX199506"
+.LASF461:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1140:
+	.string	"EDESTADDRREQ 89"
+.LASF1428:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF419:
+	.string	"_DEFAULT_SOURCE"
+.LASF1278:
+	.string	"HOST_NAME_MAX 64"
+.LASF745:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF1444:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF556:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF993:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF1616:
+	.string	"autoflush"
+.LASF1482:
+	.string	"va_fd16_encode utf16be"
+.LASF499:
+	.string	"__wur "
+.LASF1509:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF1337:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF462:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1586:
+	.string	"set_chunk_mode"
+.LASF594:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF1540:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF1605:
+	.string	"init"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF420:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1374:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF878:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF659:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF802:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF921:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1400:
+	.string	"VA_EAT(...) "
+.LASF846:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF622:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF1642:
+	.string	"va_fill_pattern"
+.LASF1008:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF1391:
+	.string	"_UCHAR_H 1"
+.LASF724:
+	.string	"__intptr_t_defined "
+.LASF1273:
+	.string	"AIO_PRIO_DELTA_MAX 20"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF515:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1214:
+	.string	"_POSIX_CHILD_MAX 25"
+.LASF543:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF377:
+	.string	"unix 1"
+.LASF1139:
+	.string	"ENOTSOCK 88"
+.LASF901:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF641:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1440:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF402:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1537:
+	.string	"VA_STATE_WIDTH 2"
+.LASF838:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF1086:
+	.string	"EDEADLK 35"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1132:
+	.string	"ELIBSCN 81"
+.LASF441:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF1120:
+	.string	"ESRMNT 69"
+.LASF1122:
+	.string	"EPROTO 71"
+.LASF1560:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF814:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF409:
+	.string	"__USE_GNU"
+.LASF1343:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF889:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF648:
+	.string	"__STD_TYPE typedef"
+.LASF1061:
+	.string	"ECHILD 10"
+.LASF1104:
+	.string	"EBADR 53"
+.LASF713:
+	.string	"_SIZET_ "
+.LASF1411:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF1299:
+	.string	"CHARCLASS_NAME_MAX 2048"
+.LASF546:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF867:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF935:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF1297:
+	.string	"EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX"
+.LASF1436:
+	.string	"VA_U_BOM 0xfeff"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1449:
+	.string	"VA_E_TRUNC 4"
+.LASF411:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF647:
+	.string	"__U64_TYPE unsigned long int"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF691:
+	.string	"_BITS_TIME64_H 1"
+.LASF967:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF1466:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF671:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF485:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1477:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1332:
+	.string	"ULONG_MAX (LONG_MAX * 2UL + 1UL)"
+.LASF1614:
+	.string	"size"
+.LASF1206:
+	.string	"MB_LEN_MAX 16"
+.LASF404:
+	.string	"__USE_LARGEFILE64"
+.LASF598:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF699:
+	.string	"_SIZE_T "
+.LASF501:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF635:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1293:
+	.string	"BC_DIM_MAX _POSIX2_BC_DIM_MAX"
+.LASF496:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF914:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF936:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF486:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF1152:
+	.string	"ENETUNREACH 101"
+.LASF415:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1390:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1230:
+	.string	"_POSIX_SEM_NSEMS_MAX 256"
+.LASF941:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF883:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF880:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF1514:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF833:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF1458:
+	.string	"va_char16_p_decode utf16"
+.LASF1581:
+	.string	"size_t"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF976:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1113:
+	.string	"ETIME 62"
+.LASF1085:
+	.string	"ERANGE 34"
+.LASF1345:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF673:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF756:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF534:
+	.string	"__stub_fchflags "
+.LASF1562:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF639:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF629:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF716:
+	.string	"NULL"
+.LASF1189:
+	.string	"_LIBC_LIMITS_H_ 1"
+.LASF396:
+	.string	"__USE_XOPEN"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF1240:
+	.string	"_POSIX_CLOCKRES_MIN 20000000"
+.LASF418:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1620:
+	.string	"check_quote"
+.LASF1526:
+	.string	"VA_MODE_NORM 0"
+.LASF439:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1410:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF588:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF528:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1379:
+	.string	"_GCC_WCHAR_T "
+.LASF1246:
+	.string	"NR_OPEN 1024"
+.LASF823:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF711:
+	.string	"___int_size_t_h "
+.LASF652:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1052:
+	.string	"EPERM 1"
+.LASF1179:
+	.string	"EKEYREVOKED 128"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF520:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1331:
+	.string	"ULONG_MAX"
+.LASF1554:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF1153:
+	.string	"ENETRESET 102"
+.LASF1292:
+	.string	"BC_BASE_MAX _POSIX2_BC_BASE_MAX"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF979:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF1024:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF590:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF423:
+	.string	"__USE_ISOC99 1"
+.LASF1382:
+	.string	"_BSD_WCHAR_T_"
+.LASF906:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1513:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF884:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF704:
+	.string	"_SIZE_T_ "
+.LASF561:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF566:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1452:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF824:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF727:
+	.string	"W_OK 2"
+.LASF792:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF715:
+	.string	"__need_size_t"
+.LASF932:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF1494:
+	.string	"va_udprintf(F,...) va_xdprintf(VA_STREAM_FD16_BUF, F, __VA_ARGS__)"
+.LASF1527:
+	.string	"VA_MODE_B32 1"
+.LASF817:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF1097:
+	.string	"EL3HLT 46"
+.LASF1000:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF616:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF1324:
+	.string	"INT_MAX __INT_MAX__"
+.LASF1352:
+	.string	"_STDDEF_H "
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF881:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF398:
+	.string	"__USE_UNIX98"
+.LASF819:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF1547:
+	.string	"VA_QUOTE_qq 6"
+.LASF465:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1109:
+	.string	"EDEADLOCK EDEADLK"
+.LASF1532:
+	.string	"VA_MODE_X6 6"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1438:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF535:
+	.string	"__stub_gtty "
+.LASF565:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF685:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF939:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF1430:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF1646:
+	.string	"va_fd_refill"
+.LASF578:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF766:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF992:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF687:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF811:
+	.string	"_SC_PII _SC_PII"
+.LASF1335:
+	.string	"LLONG_MAX"
+.LASF840:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF892:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF873:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF591:
+	.string	"_LFS64_STDIO 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF859:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF944:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF1265:
+	.string	"ARG_MAX"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF981:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1597:
+	.string	"va_read_iter"
+.LASF1012:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF782:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF525:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1209:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1)"
+.LASF447:
+	.string	"__GNU_LIBRARY__"
+.LASF1593:
+	.string	"vtab"
+.LASF982:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF443:
+	.string	"__USE_ATFILE 1"
+.LASF975:
+	.string	"_CS_PATH _CS_PATH"
+.LASF564:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF1111:
+	.string	"ENOSTR 60"
+.LASF813:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF1483:
+	.string	"VA_PRINT_FD_UTF32BE_H_ "
+.LASF1287:
+	.string	"_POSIX2_COLL_WEIGHTS_MAX 2"
+.LASF1089:
+	.string	"ENOSYS 38"
+.LASF656:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1503:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF725:
+	.string	"__socklen_t_defined "
+.LASF1298:
+	.string	"LINE_MAX _POSIX2_LINE_MAX"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF943:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF729:
+	.string	"F_OK 0"
+.LASF1561:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF548:
+	.string	"_XOPEN_VERSION 700"
+.LASF1158:
+	.string	"ENOTCONN 107"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1579:
+	.string	"__ssize_t"
+.LASF1542:
+	.string	"VA_QUOTE_k 1"
+.LASF1329:
+	.string	"LONG_MAX"
+.LASF1490:
+	.string	"VA_STREAM_FD16_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), (B), (N), 0, 0, 0, {0} })"
+.LASF853:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1174:
+	.string	"ENOMEDIUM 123"
+.LASF1328:
+	.string	"LONG_MIN (-LONG_MAX - 1L)"
+.LASF459:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1144:
+	.string	"EPROTONOSUPPORT 93"
+.LASF453:
+	.string	"__PMT"
+.LASF1380:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1200:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF741:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF1063:
+	.string	"ENOMEM 12"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1522:
+	.string	"VA_SIGN_SPACE 1"
+.LASF1626:
+	.string	"va_quotation_t"
+.LASF562:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF825:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1251:
+	.string	"MAX_INPUT 255"
+.LASF893:
+	.string	"_SC_BASE _SC_BASE"
+.LASF1059:
+	.string	"ENOEXEC 8"
+.LASF1266:
+	.string	"__undef_ARG_MAX"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1037:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF1035:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1279:
+	.string	"MQ_PRIO_MAX 32768"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1487:
+	.string	"VA_STREAM_FD16(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), NULL, 0, 0, 0, 0, {0} })"
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF721:
+	.string	"__off_t_defined "
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF506:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF863:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1598:
+	.string	"va_stream"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF1021:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1019:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF638:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1088:
+	.string	"ENOLCK 37"
+.LASF1137:
+	.string	"ESTRPIPE 86"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF755:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF1290:
+	.string	"_POSIX2_RE_DUP_MAX 255"
+.LASF1472:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF449:
+	.string	"__GLIBC__ 2"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1078:
+	.string	"EFBIG 27"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1285:
+	.string	"_POSIX2_BC_SCALE_MAX 99"
+.LASF1372:
+	.string	"_WCHAR_T_ "
+.LASF584:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF1632:
+	.string	"va_fd_put_fill"
+.LASF790:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF961:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF1409:
+	.string	"VA_F(...) VA_H"
+.LASF463:
+	.string	"__P(args) args"
+.LASF732:
+	.string	"SEEK_END 2"
+.LASF1212:
+	.string	"_POSIX_AIO_MAX 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1489:
+	.string	"VA_STREAM_FD_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), (B), (N), 0, 0, 0, {0} })"
+.LASF786:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF700:
+	.string	"_SYS_SIZE_T_H "
+.LASF663:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1145:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF722:
+	.string	"__useconds_t_defined "
+.LASF1627:
+	.string	"memset"
+.LASF1247:
+	.string	"NGROUPS_MAX 65536"
+.LASF1040:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1034:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF1225:
+	.string	"_POSIX_OPEN_MAX 20"
+.LASF1330:
+	.string	"LONG_MAX __LONG_MAX__"
+.LASF795:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF1141:
+	.string	"EMSGSIZE 90"
+.LASF868:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF1431:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF410:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1533:
+	.string	"VA_MODE_X7 7"
+.LASF1211:
+	.string	"_POSIX_AIO_LISTIO_MAX 2"
+.LASF388:
+	.string	"__USE_ISOC11"
+.LASF1226:
+	.string	"_POSIX_PATH_MAX 256"
+.LASF1159:
+	.string	"ESHUTDOWN 108"
+.LASF674:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1177:
+	.string	"ENOKEY 126"
+.LASF915:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF728:
+	.string	"X_OK 1"
+.LASF1631:
+	.string	"__assert_fail"
+.LASF401:
+	.string	"__USE_XOPEN2K8"
+.LASF1568:
+	.string	"VA_QCLASS_CALL 2"
+.LASF1594:
+	.string	"va_read_iter_vtab_t"
+.LASF1147:
+	.string	"EPFNOSUPPORT 96"
+.LASF675:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF718:
+	.string	"__need_NULL"
+.LASF1384:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF764:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF414:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF783:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF440:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF403:
+	.string	"__USE_LARGEFILE"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF558:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1154:
+	.string	"ECONNABORTED 103"
+.LASF626:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF1075:
+	.string	"EMFILE 24"
+.LASF1592:
+	.string	"_pad"
+.LASF432:
+	.string	"__USE_POSIX199309 1"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF798:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF1648:
+	.string	"__PRETTY_FUNCTION__"
+.LASF488:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF803:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF842:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF1219:
+	.string	"_POSIX_MAX_CANON 255"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF469:
+	.string	"__END_DECLS "
+.LASF1084:
+	.string	"EDOM 33"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1338:
+	.string	"_STRING_H 1"
+.LASF971:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1463:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1043:
+	.string	"_GETOPT_CORE_H 1"
+.LASF660:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1157:
+	.string	"EISCONN 106"
+.LASF860:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF1459:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF1429:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF586:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF523:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1524:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1618:
+	.string	"va_quotation_table_t"
+.LASF1573:
+	.string	"short unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1294:
+	.string	"BC_SCALE_MAX _POSIX2_BC_SCALE_MAX"
+.LASF1575:
+	.string	"signed char"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1239:
+	.string	"_POSIX_TZNAME_MAX 6"
+.LASF899:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF1099:
+	.string	"ELNRNG 48"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF697:
+	.string	"__size_t__ "
+.LASF434:
+	.string	"__USE_XOPEN2K 1"
+.LASF1498:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF949:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF1474:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF947:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF1376:
+	.string	"_WCHAR_T_H "
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF489:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF1205:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1081:
+	.string	"EROFS 30"
+.LASF768:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF532:
+	.string	"__stub___compat_bdflush "
+.LASF942:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF806:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF895:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF767:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF387:
+	.string	"_FEATURES_H 1"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF705:
+	.string	"_BSD_SIZE_T_ "
+.LASF507:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF491:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1549:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF977:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF777:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF602:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF753:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF1041:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF557:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF1408:
+	.string	"VA_P(X,...) X"
+.LASF1025:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1348:
+	.string	"static_assert _Static_assert"
+.LASF1545:
+	.string	"VA_QUOTE_K 4"
+.LASF618:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF661:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1050:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF519:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF751:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF1649:
+	.string	"fd_commit"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF653:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1451:
+	.string	"VA_E_ARGC 6"
+.LASF1045:
+	.string	"F_LOCK 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1354:
+	.string	"_ANSI_STDDEF_H "
+.LASF1258:
+	.string	"RTSIG_MAX 32"
+.LASF457:
+	.string	"__LEAF , __leaf__"
+.LASF1475:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF1590:
+	.string	"chunk_mode"
+.LASF1327:
+	.string	"LONG_MIN"
+.LASF1435:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF793:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF1470:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF1221:
+	.string	"_POSIX_MQ_OPEN_MAX 8"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1491:
+	.string	"VA_STREAM_FD32_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), (B), (N), 0, 0, 0, {0} })"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1096:
+	.string	"EL2NSYNC 45"
+.LASF1010:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF630:
+	.string	"STDIN_FILENO 0"
+.LASF522:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF554:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF621:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF1405:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF909:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF855:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF735:
+	.string	"L_XTND SEEK_END"
+.LASF1161:
+	.string	"ETIMEDOUT 110"
+.LASF655:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF815:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF731:
+	.string	"SEEK_CUR 1"
+.LASF1525:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF1134:
+	.string	"ELIBEXEC 83"
+.LASF654:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF920:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF1644:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF1643:
+	.string	"va_stream_set_error"
+.LASF1162:
+	.string	"ECONNREFUSED 111"
+.LASF999:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF957:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF857:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF467:
+	.string	"__ptr_t void *"
+.LASF644:
+	.string	"__SLONG32_TYPE int"
+.LASF545:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1365:
+	.string	"__need_ptrdiff_t"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF1559:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF425:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF733:
+	.string	"L_SET SEEK_SET"
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF391:
+	.string	"__USE_ISOCXX11"
+.LASF1577:
+	.string	"long int"
+.LASF827:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF761:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF1530:
+	.string	"VA_MODE_TYPE 4"
+.LASF1479:
+	.string	"VA_PRINT_FD_UTF8_H_ "
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF472:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF998:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF417:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF850:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1478:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF480:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF905:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF1558:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1070:
+	.string	"ENODEV 19"
+.LASF1536:
+	.string	"VA_STATE_ARG 1"
+.LASF1641:
+	.string	"fd_flush_head"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1130:
+	.string	"ELIBACC 79"
+.LASF1095:
+	.string	"ECHRNG 44"
+.LASF464:
+	.string	"__PMT(args) args"
+.LASF632:
+	.string	"STDERR_FILENO 2"
+.LASF617:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF1359:
+	.string	"_PTRDIFF_T_ "
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1250:
+	.string	"MAX_CANON 255"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1506:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF1495:
+	.string	"va_Udprintf(F,...) va_xdprintf(VA_STREAM_FD32_BUF, F, __VA_ARGS__)"
+.LASF836:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF1044:
+	.string	"F_ULOCK 0"
+.LASF1358:
+	.string	"__PTRDIFF_T "
+.LASF1612:
+	.string	"va_window_t"
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF706:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1243:
+	.string	"__undef_OPEN_MAX "
+.LASF1110:
+	.string	"EBFONT 59"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1460:
+	.string	"va_char32_p_format utf32"
+.LASF1587:
+	.string	"bulk"
+.LASF577:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF1397:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF1629:
+	.string	"write"
+.LASF563:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1229:
+	.string	"_POSIX_RTSIG_MAX 8"
+.LASF452:
+	.string	"_SYS_CDEFS_H 1"
+.LASF470:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF972:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF703:
+	.string	"__SIZE_T "
+.LASF964:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF553:
+	.string	"_XOPEN_UNIX 1"
+.LASF614:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF931:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1276:
+	.string	"TTY_NAME_MAX 32"
+.LASF1187:
+	.string	"_GCC_LIMITS_H_ "
+.LASF1604:
+	.string	"va_quotations"
+.LASF665:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF681:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1583:
+	.string	"long double"
+.LASF952:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF752:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF573:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF843:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF431:
+	.string	"__USE_POSIX2 1"
+.LASF615:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF1381:
+	.string	"__DEFINED_wchar_t "
+.LASF1517:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF1148:
+	.string	"EAFNOSUPPORT 97"
+.LASF1611:
+	.string	"va_stream_vtab_t"
+.LASF1402:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF476:
+	.string	"__flexarr []"
+.LASF416:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF482:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF633:
+	.string	"_BITS_TYPES_H 1"
+.LASF1244:
+	.string	"__undef_ARG_MAX "
+.LASF1553:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1550:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1046:
+	.string	"F_TLOCK 2"
+.LASF478:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1197:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1492:
+	.string	"va_xdprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_fd_buf_[va_fd_buf_size]; va_stream_fd_t va_fd_s_ = STREAM_BUF(F, va_fd_buf_, sizeof(va_fd_buf_)); va_fd_s_.autoflush = true; (void)va_xprintf(&va_fd_s_, __VA_ARGS__))"
+.LASF1067:
+	.string	"EBUSY 16"
+.LASF1369:
+	.string	"_T_WCHAR_ "
+.LASF422:
+	.string	"__USE_ISOC11 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF781:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF428:
+	.string	"_POSIX_C_SOURCE"
+.LASF541:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF1481:
+	.string	"VA_PRINT_FD_UTF16BE_H_ "
+.LASF606:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF1020:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF871:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1001:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF1277:
+	.string	"LOGIN_NAME_MAX 256"
+.LASF1645:
+	.string	"__errno_location"
+.LASF759:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF794:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF547:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF968:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF1314:
+	.string	"CHAR_MAX SCHAR_MAX"
+.LASF583:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF805:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF1333:
+	.string	"LLONG_MIN"
+.LASF750:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF791:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF1578:
+	.string	"char"
+.LASF990:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF1420:
+	.string	"VA_REC1() VA_REC1B"
+.LASF1599:
+	.string	"width"
+.LASF538:
+	.string	"__stub_sigreturn "
+.LASF1128:
+	.string	"EBADFD 77"
+.LASF1257:
+	.string	"XATTR_LIST_MAX 65536"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF445:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1198:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF965:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF1566:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF830:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF1392:
+	.string	"__mbstate_t_defined 1"
+.LASF1307:
+	.string	"SCHAR_MAX"
+.LASF1624:
+	.string	"table"
+.LASF634:
+	.string	"__S16_TYPE short int"
+.LASF861:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF678:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF549:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF429:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF495:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1309:
+	.string	"UCHAR_MAX"
+.LASF1399:
+	.string	"VA_NIX "
+.LASF1173:
+	.string	"EDQUOT 122"
+.LASF1496:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF1100:
+	.string	"EUNATCH 49"
+.LASF1344:
+	.string	"_ASSERT_H_DECLS "
+.LASF1388:
+	.string	"true 1"
+.LASF882:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1015:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF502:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1072:
+	.string	"EISDIR 21"
+.LASF608:
+	.string	"_POSIX_IPV6 200809L"
+.LASF904:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF1027:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF1351:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF668:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF707:
+	.string	"_SIZE_T_DEFINED "
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1087:
+	.string	"ENAMETOOLONG 36"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1456:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF953:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF693:
+	.string	"__STD_TYPE"
+.LASF862:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF930:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF980:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF651:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF645:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF714:
+	.string	"__size_t "
+.LASF696:
+	.string	"__need_NULL "
+.LASF1028:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF575:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF888:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF1434:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF1606:
+	.string	"finish"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF775:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF717:
+	.string	"NULL ((void *)0)"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1565:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF894:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF1350:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF1009:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF908:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF1049:
+	.string	"_BITS_ERRNO_H 1"
+.LASF865:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF1167:
+	.string	"ESTALE 116"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF800:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF529:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF746:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF762:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF1432:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF996:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF518:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1401:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF503:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1383:
+	.string	"__need_wchar_t"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1357:
+	.string	"_T_PTRDIFF "
+.LASF455:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1126:
+	.string	"EOVERFLOW 75"
+.LASF1334:
+	.string	"LLONG_MIN (-LLONG_MAX - 1LL)"
+.LASF966:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF1106:
+	.string	"ENOANO 55"
+.LASF1195:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1076:
+	.string	"ENOTTY 25"
+.LASF1181:
+	.string	"EOWNERDEAD 130"
+.LASF372:
+	.string	"__linux 1"
+.LASF451:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1105:
+	.string	"EXFULL 54"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF531:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1263:
+	.string	"OPEN_MAX"
+.LASF1609:
+	.string	"put_len"
+.LASF903:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF1033:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF1149:
+	.string	"EADDRINUSE 98"
+.LASF854:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF1062:
+	.string	"EAGAIN 11"
+.LASF916:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF925:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF1065:
+	.string	"EFAULT 14"
+.LASF504:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1098:
+	.string	"EL3RST 47"
+.LASF569:
+	.string	"_XOPEN_REALTIME 1"
+.LASF852:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF760:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF926:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF471:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1637:
+	.string	"need"
+.LASF413:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1507:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF876:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF605:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF405:
+	.string	"__USE_FILE_OFFSET64"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1394:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF1281:
+	.string	"SSIZE_MAX LONG_MAX"
+.LASF1500:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF1313:
+	.string	"CHAR_MAX"
+.LASF779:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF834:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF1178:
+	.string	"EKEYEXPIRED 127"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1552:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF837:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF666:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF734:
+	.string	"L_INCR SEEK_CUR"
+.LASF1570:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF1232:
+	.string	"_POSIX_SIGQUEUE_MAX 32"
+.LASF1029:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1580:
+	.string	"ssize_t"
+.LASF628:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF676:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF437:
+	.string	"_ATFILE_SOURCE 1"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1455:
+	.string	"va_char_p_decode utf8"
+.LASF1284:
+	.string	"_POSIX2_BC_DIM_MAX 2048"
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1373:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1602:
+	.string	"quote"
+.LASF874:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF1252:
+	.string	"NAME_MAX 255"
+.LASF1216:
+	.string	"_POSIX_HOST_NAME_MAX 255"
+.LASF1302:
+	.string	"_LIMITS_H___ "
+.LASF490:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF923:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1485:
+	.string	"va_fd_buf_size 512"
+.LASF1480:
+	.string	"va_fd_encode utf8"
+.LASF580:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1529:
+	.string	"VA_MODE_PTR 3"
+.LASF1259:
+	.string	"NR_OPEN"
+.LASF1191:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1454:
+	.string	"va_char_p_format utf8"
+.LASF393:
+	.string	"__USE_POSIX2"
+.LASF1613:
+	.string	"data"
+.LASF1186:
+	.string	"errno (*__errno_location ())"
+.LASF1521:
+	.string	"VA_SIGN_NORM 0"
+.LASF1138:
+	.string	"EUSERS 87"
+.LASF679:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF856:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF784:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF1510:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF1124:
+	.string	"EDOTDOT 73"
+.LASF1129:
+	.string	"EREMCHG 78"
+.LASF886:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF1395:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF960:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF896:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF487:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1585:
+	.string	"take"
+.LASF1220:
+	.string	"_POSIX_MAX_INPUT 255"
+.LASF1146:
+	.string	"EOPNOTSUPP 95"
+.LASF642:
+	.string	"__SWORD_TYPE long int"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF400:
+	.string	"__USE_XOPEN2KXSI"
+.LASF919:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1421:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF1650:
+	.string	"fd_write"
+.LASF776:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF1370:
+	.string	"_T_WCHAR "
+.LASF1013:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF684:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1353:
+	.string	"_STDDEF_H_ "
+.LASF954:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF692:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF625:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF1101:
+	.string	"ENOCSI 50"
+.LASF1118:
+	.string	"ENOLINK 67"
+.LASF956:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1305:
+	.string	"SCHAR_MIN"
+.LASF688:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF847:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF1108:
+	.string	"EBADSLT 57"
+.LASF1007:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF394:
+	.string	"__USE_POSIX199309"
+.LASF1253:
+	.string	"PATH_MAX 4096"
+.LASF1323:
+	.string	"INT_MAX"
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF1142:
+	.string	"EPROTOTYPE 91"
+.LASF820:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1026:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF1260:
+	.string	"__undef_NR_OPEN"
+.LASF1360:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1371:
+	.string	"__WCHAR_T "
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF739:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF1042:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1303:
+	.string	"CHAR_BIT"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF1473:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1414:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF1398:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1488:
+	.string	"VA_STREAM_FD32(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), NULL, 0, 0, 0, 0, {0} })"
+.LASF1218:
+	.string	"_POSIX_LOGIN_NAME_MAX 9"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF804:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF581:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF1625:
+	.string	"long long unsigned int"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1630:
+	.string	"memmove"
+.LASF689:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1484:
+	.string	"va_fd32_encode utf32be"
+.LASF555:
+	.string	"_XOPEN_LEGACY 1"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF758:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF1172:
+	.string	"EREMOTEIO 121"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF955:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF1201:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF763:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF426:
+	.string	"_POSIX_SOURCE"
+.LASF1182:
+	.string	"ENOTRECOVERABLE 131"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1274:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF1417:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF918:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF508:
+	.string	"__restrict_arr __restrict"
+.LASF875:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF1032:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF1121:
+	.string	"ECOMM 70"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF568:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF1623:
+	.string	"render_flush"
+.LASF1564:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF1170:
+	.string	"ENAVAIL 119"
+.LASF702:
+	.string	"_T_SIZE "
+.LASF433:
+	.string	"__USE_POSIX199506 1"
+.LASF736:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF818:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1272:
+	.string	"PTHREAD_THREADS_MAX"
+.LASF536:
+	.string	"__stub_revoke "
+.LASF677:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF509:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1056:
+	.string	"EIO 5"
+.LASF540:
+	.string	"_POSIX_VERSION 200809L"
+.LASF928:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF1166:
+	.string	"EINPROGRESS 115"
+.LASF989:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF435:
+	.string	"__USE_XOPEN2K8 1"
+.LASF664:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF613:
+	.string	"_POSIX_TRACE -1"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1082:
+	.string	"EMLINK 31"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1336:
+	.string	"ULLONG_MAX"
+.LASF595:
+	.string	"_POSIX_REGEXP 1"
+.LASF754:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF683:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1341:
+	.string	"_STRINGS_H 1"
+.LASF938:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF1215:
+	.string	"_POSIX_DELAYTIMER_MAX 32"
+.LASF694:
+	.string	"__ssize_t_defined "
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF869:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF436:
+	.string	"_ATFILE_SOURCE"
+.LASF1437:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF1184:
+	.string	"EHWPOISON 133"
+.LASF1548:
+	.string	"VA_QUOTE_QQ 7"
+.LASF1518:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF1499:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF530:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF870:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF1066:
+	.string	"ENOTBLK 15"
+.LASF765:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF1202:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF950:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF1325:
+	.string	"UINT_MAX"
+.LASF484:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1535:
+	.string	"VA_STATE_INIT 0"
+.LASF778:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF592:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF427:
+	.string	"_POSIX_SOURCE 1"
+.LASF902:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF1079:
+	.string	"ENOSPC 28"
+.LASF607:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF1346:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF1419:
+	.string	"VA_REC0() VA_REC0B"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1422:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF1387:
+	.string	"bool _Bool"
+.LASF1361:
+	.string	"___int_ptrdiff_t_h "
+.LASF991:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF579:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF511:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF680:
+	.string	"__TIMER_T_TYPE void *"
+.LASF551:
+	.string	"_XOPEN_XPG3 1"
+.LASF1071:
+	.string	"ENOTDIR 20"
+.LASF1311:
+	.string	"CHAR_MIN"
+.LASF1640:
+	.string	"va_fd_flush"
+.LASF1091:
+	.string	"ELOOP 40"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1567:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF448:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1582:
+	.string	"long long int"
+.LASF1115:
+	.string	"ENONET 64"
+.LASF670:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF937:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF1416:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF1018:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF927:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF829:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF1163:
+	.string	"EHOSTDOWN 112"
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF890:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF1312:
+	.string	"CHAR_MIN SCHAR_MIN"
+.LASF1396:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF1446:
+	.string	"VA_E_NULL 1"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF593:
+	.string	"_POSIX_CPUTIME 0"
+.LASF710:
+	.string	"__DEFINED_size_t "
+.LASF1006:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF1131:
+	.string	"ELIBBAD 80"
+.LASF844:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF1465:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF1471:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1236:
+	.string	"_POSIX_SYMLOOP_MAX 8"
+.LASF984:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF492:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1125:
+	.string	"EBADMSG 74"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1055:
+	.string	"EINTR 4"
+.LASF1600:
+	.string	"prec"
+.LASF1116:
+	.string	"ENOPKG 65"
+.LASF994:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1406:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF407:
+	.string	"__USE_ATFILE"
+.LASF973:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF544:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF1180:
+	.string	"EKEYREJECTED 129"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF845:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF1306:
+	.string	"SCHAR_MIN (-SCHAR_MAX - 1)"
+.LASF375:
+	.string	"__unix 1"
+.LASF514:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1196:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF988:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF774:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF1053:
+	.string	"ENOENT 2"
+.LASF494:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF898:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF1461:
+	.string	"va_char32_p_decode utf32"
+.LASF1601:
+	.string	"qctxt"
+.LASF1528:
+	.string	"VA_MODE_CHAR 2"
+.LASF412:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1199:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1176:
+	.string	"ECANCELED 125"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1569:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF672:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1023:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF995:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF1228:
+	.string	"_POSIX_RE_DUP_MAX 255"
+.LASF738:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1339:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF810:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF669:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1501:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF1270:
+	.string	"PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF596:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF744:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF662:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF772:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF623:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF1385:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF780:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF1497:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF570:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF1403:
+	.string	"VA_PAR ()"
+.LASF1321:
+	.string	"INT_MIN"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1464:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF986:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF1083:
+	.string	"EPIPE 32"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF698:
+	.string	"__SIZE_T__ "
+.LASF822:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF587:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF1213:
+	.string	"_POSIX_ARG_MAX 4096"
+.LASF1433:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF658:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1235:
+	.string	"_POSIX_SYMLINK_MAX 255"
+.LASF897:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF474:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF466:
+	.string	"__STRING(x) #x"
+.LASF1238:
+	.string	"_POSIX_TTY_NAME_MAX 9"
+.LASF970:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF1556:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF576:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF1574:
+	.string	"unsigned int"
+.LASF1165:
+	.string	"EALREADY 114"
+.LASF1011:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF1150:
+	.string	"EADDRNOTAVAIL 99"
+.LASF1112:
+	.string	"ENODATA 61"
+.LASF1531:
+	.string	"VA_MODE_STAT 5"
+.LASF872:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF1004:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF1450:
+	.string	"VA_E_FORMAT 5"
+.LASF1320:
+	.string	"USHRT_MAX (SHRT_MAX * 2 + 1)"
+.LASF1638:
+	.string	"va_fd_write"
+.LASF1234:
+	.string	"_POSIX_STREAM_MAX 8"
+.LASF1203:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF497:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1407:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1222:
+	.string	"_POSIX_MQ_PRIO_MAX 32"
+.LASF1413:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF650:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF450:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1241:
+	.string	"__undef_NR_OPEN "
+.LASF1231:
+	.string	"_POSIX_SEM_VALUE_MAX 32767"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF612:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF1576:
+	.string	"short int"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF864:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF585:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF841:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1319:
+	.string	"USHRT_MAX"
+.LASF646:
+	.string	"__S64_TYPE long int"
+.LASF963:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF1275:
+	.string	"DELAYTIMER_MAX 2147483647"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1633:
+	.string	"va_fd_put"
+.LASF1608:
+	.string	"put_fill"
+.LASF809:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF771:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF1261:
+	.string	"LINK_MAX"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1467:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1164:
+	.string	"EHOSTUNREACH 113"
+.LASF1364:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF997:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF424:
+	.string	"__USE_ISOC95 1"
+.LASF1295:
+	.string	"BC_STRING_MAX _POSIX2_BC_STRING_MAX"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF1064:
+	.string	"EACCES 13"
+.LASF1515:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF1192:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF1093:
+	.string	"ENOMSG 42"
+.LASF1635:
+	.string	"va_fd_fill"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"src/fd.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10261 @@
+	.file	"file.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/file.c"
+	.type	file_commit, @function
+file_commit:
+.LVL0:
+.LFB14:
+	.file 1 "src/file.c"
+	.loc 1 27 1 view -0
+	.cfi_startproc
+	.loc 1 28 5 view .LVU1
+	.loc 1 28 17 is_stmt 0 view .LVU2
+	movq	40(%rdi), %rax
+	.loc 1 28 8 view .LVU3
+	testq	%rax, %rax
+	je	.L1
+.LBB23:
+	.loc 1 29 9 is_stmt 1 view .LVU4
+	.loc 1 29 47 is_stmt 0 view .LVU5
+	subq	72(%rdi), %rax
+	.loc 1 29 16 view .LVU6
+	movq	%rax, 88(%rdi)
+	.loc 1 30 9 is_stmt 1 view .LVU7
+	.loc 1 30 18 is_stmt 0 view .LVU8
+	xorl	%eax, %eax
+	movq	%rax, 40(%rdi)
+	movq	%rax, 48(%rdi)
+.L1:
+.LBE23:
+	.loc 1 32 1 view .LVU9
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	file_commit, .-file_commit
+	.globl	va_file_init
+	.type	va_file_init, @function
+va_file_init:
+.LVL1:
+.LFB15:
+	.loc 1 38 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 39 5 view .LVU11
+	.loc 1 40 5 view .LVU12
+	movq	64(%rdi), %rdi
+.LVL2:
+	.loc 1 40 5 is_stmt 0 view .LVU13
+	jmp	flockfile@PLT
+.LVL3:
+	.cfi_endproc
+.LFE15:
+	.size	va_file_init, .-va_file_init
+	.globl	va_file_flush
+	.type	va_file_flush, @function
+va_file_flush:
+.LVL4:
+.LFB17:
+	.loc 1 53 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 54 5 view .LVU15
+	.loc 1 53 1 is_stmt 0 view .LVU16
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 53 1 view .LVU17
+	movq	%rdi, %rbx
+	.loc 1 54 5 view .LVU18
+	call	file_commit
+.LVL5:
+	.loc 1 55 5 is_stmt 1 view .LVU19
+	.loc 1 55 8 is_stmt 0 view .LVU20
+	cmpq	$0, 88(%rdi)
+	je	.L8
+.LVL6:
+.LBB29:
+.LBI29:
+	.loc 1 52 13 is_stmt 1 view .LVU21
+.LBB30:
+	.loc 1 59 5 view .LVU22
+	movq	64(%rdi), %rdi
+.LVL7:
+	.loc 1 59 5 is_stmt 0 view .LVU23
+	call	flockfile@PLT
+.LVL8:
+	.loc 1 60 5 is_stmt 1 view .LVU24
+	.loc 1 60 9 is_stmt 0 view .LVU25
+	movq	64(%rbx), %rcx
+	movq	88(%rbx), %rdx
+	movl	$1, %esi
+	movq	72(%rbx), %rdi
+	call	fwrite_unlocked@PLT
+.LVL9:
+	.loc 1 60 8 view .LVU26
+	cmpq	88(%rbx), %rax
+	je	.L10
+	.loc 1 61 9 is_stmt 1 view .LVU27
+.LVL10:
+.LBB31:
+.LBI31:
+	.file 2 "./include/va_print/impl.h"
+	.loc 2 425 20 view .LVU28
+.LBB32:
+	.loc 2 427 5 view .LVU29
+	.loc 2 427 13 is_stmt 0 view .LVU30
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU31
+	testl	$939524096, %eax
+	jne	.L10
+	.loc 2 428 9 is_stmt 1 view .LVU32
+.LBB33:
+	.loc 2 428 25 view .LVU33
+.LVL11:
+	.loc 2 428 62 view .LVU34
+	.loc 2 428 101 is_stmt 0 view .LVU35
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU36
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+.LVL12:
+.L10:
+	.loc 2 428 123 view .LVU37
+.LBE33:
+.LBE32:
+.LBE31:
+	.loc 1 63 5 is_stmt 1 view .LVU38
+	movq	64(%rbx), %rdi
+	call	funlockfile@PLT
+.LVL13:
+	.loc 1 64 5 view .LVU39
+	.loc 1 64 12 is_stmt 0 view .LVU40
+	xorl	%eax, %eax
+	movq	%rax, 88(%rbx)
+.LVL14:
+.L8:
+	.loc 1 64 12 view .LVU41
+.LBE30:
+.LBE29:
+	.loc 1 65 1 view .LVU42
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL15:
+	.loc 1 65 1 view .LVU43
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	va_file_flush, .-va_file_flush
+	.globl	va_file_finish
+	.type	va_file_finish, @function
+va_file_finish:
+.LVL16:
+.LFB16:
+	.loc 1 44 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 45 5 view .LVU45
+	.loc 1 46 5 view .LVU46
+	.loc 1 44 1 is_stmt 0 view .LVU47
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 46 8 view .LVU48
+	cmpb	$0, 96(%rdi)
+	.loc 1 44 1 view .LVU49
+	movq	%rdi, %rbx
+	.loc 1 46 8 view .LVU50
+	je	.L13
+	.loc 1 47 9 is_stmt 1 view .LVU51
+	call	va_file_flush
+.LVL17:
+.L13:
+	.loc 1 49 5 view .LVU52
+	movq	64(%rbx), %rdi
+	.loc 1 50 1 is_stmt 0 view .LVU53
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL18:
+	.loc 1 49 5 view .LVU54
+	jmp	funlockfile@PLT
+.LVL19:
+	.cfi_endproc
+.LFE16:
+	.size	va_file_finish, .-va_file_finish
+	.globl	va_file_write
+	.type	va_file_write, @function
+va_file_write:
+.LVL20:
+.LFB18:
+	.loc 1 68 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 69 5 view .LVU56
+	.loc 1 70 5 view .LVU57
+	.loc 1 68 1 is_stmt 0 view .LVU58
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	.loc 1 68 1 view .LVU59
+	movq	%rdi, %rbx
+	.loc 1 70 5 view .LVU60
+	call	file_commit
+.LVL21:
+	.loc 1 71 5 is_stmt 1 view .LVU61
+	.loc 1 71 17 is_stmt 0 view .LVU62
+	movq	88(%rdi), %rax
+	addq	%rdx, %rax
+	.loc 1 71 8 view .LVU63
+	cmpq	%rax, 80(%rdi)
+	jnb	.L16
+	.loc 1 72 9 is_stmt 1 view .LVU64
+	call	va_file_flush
+.LVL22:
+.L16:
+	.loc 1 74 5 view .LVU65
+	.loc 1 74 11 is_stmt 0 view .LVU66
+	movq	72(%rbx), %rax
+	.loc 1 74 8 view .LVU67
+	testq	%rax, %rax
+	je	.L17
+	.loc 1 74 26 discriminator 1 view .LVU68
+	cmpq	%rbp, 80(%rbx)
+	jnb	.L18
+.L17:
+	.loc 1 75 9 is_stmt 1 view .LVU69
+	.loc 1 75 13 is_stmt 0 view .LVU70
+	movq	64(%rbx), %rcx
+	movq	%rbp, %rdx
+	movl	$1, %esi
+	movq	%r12, %rdi
+	call	fwrite@PLT
+.LVL23:
+	.loc 1 75 12 view .LVU71
+	cmpq	%rbp, %rax
+	je	.L15
+	.loc 1 76 13 is_stmt 1 view .LVU72
+.LVL24:
+.LBB34:
+.LBI34:
+	.loc 2 425 20 view .LVU73
+.LBB35:
+	.loc 2 427 5 view .LVU74
+	.loc 2 427 13 is_stmt 0 view .LVU75
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU76
+	testl	$939524096, %eax
+	jne	.L15
+	.loc 2 428 9 is_stmt 1 view .LVU77
+.LBB36:
+	.loc 2 428 25 view .LVU78
+.LVL25:
+	.loc 2 428 62 view .LVU79
+	.loc 2 428 101 is_stmt 0 view .LVU80
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU81
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+	jmp	.L15
+.LVL26:
+.L18:
+	.loc 2 428 123 view .LVU82
+.LBE36:
+.LBE35:
+.LBE34:
+	.loc 1 80 5 is_stmt 1 view .LVU83
+	.loc 1 80 20 is_stmt 0 view .LVU84
+	addq	88(%rbx), %rax
+	.loc 1 80 5 view .LVU85
+	movq	%r12, %rsi
+	movq	%rbp, %rcx
+	movq	%rax, %rdi
+	rep movsb
+	.loc 1 81 5 is_stmt 1 view .LVU86
+	.loc 1 81 12 is_stmt 0 view .LVU87
+	addq	%rbp, 88(%rbx)
+.L15:
+	.loc 1 82 1 view .LVU88
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL27:
+	.loc 1 82 1 view .LVU89
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL28:
+	.loc 1 82 1 view .LVU90
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL29:
+	.loc 1 82 1 view .LVU91
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	va_file_write, .-va_file_write
+	.globl	va_file_refill
+	.type	va_file_refill, @function
+va_file_refill:
+.LVL30:
+.LFB19:
+	.loc 1 85 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 86 5 view .LVU93
+	.loc 1 87 5 view .LVU94
+	.loc 1 85 1 is_stmt 0 view .LVU95
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	.loc 1 87 5 view .LVU96
+	call	file_commit
+.LVL31:
+	.loc 1 88 5 is_stmt 1 view .LVU97
+	.loc 1 88 8 is_stmt 0 view .LVU98
+	cmpq	$0, 72(%rdi)
+	jne	.L25
+.LVL32:
+.L28:
+	.loc 1 89 15 view .LVU99
+	xorl	%eax, %eax
+	jmp	.L24
+.LVL33:
+.L25:
+	.loc 1 91 17 view .LVU100
+	movq	88(%rdi), %rax
+	movq	%rsi, %rbp
+	.loc 1 91 5 is_stmt 1 view .LVU101
+	.loc 1 91 17 is_stmt 0 view .LVU102
+	addq	%rsi, %rax
+	.loc 1 91 8 view .LVU103
+	cmpq	%rax, 80(%rdi)
+	jb	.L27
+.LVL34:
+.L29:
+	.loc 1 97 5 is_stmt 1 view .LVU104
+	.loc 1 97 32 is_stmt 0 view .LVU105
+	movq	72(%rbx), %rax
+	.loc 1 97 57 view .LVU106
+	movq	80(%rbx), %rdx
+	addq	%rax, %rdx
+	.loc 1 97 39 view .LVU107
+	addq	88(%rbx), %rax
+	.loc 1 97 14 view .LVU108
+	movq	%rax, 40(%rbx)
+	.loc 1 98 11 view .LVU109
+	movb	$1, %al
+	.loc 1 97 14 view .LVU110
+	movq	%rdx, 48(%rbx)
+	.loc 1 98 5 is_stmt 1 view .LVU111
+	.loc 1 98 11 is_stmt 0 view .LVU112
+	jmp	.L24
+.LVL35:
+.L27:
+	.loc 1 92 9 is_stmt 1 view .LVU113
+	call	va_file_flush
+.LVL36:
+	.loc 1 93 9 view .LVU114
+	.loc 1 93 12 is_stmt 0 view .LVU115
+	cmpq	%rbp, 80(%rbx)
+	jnb	.L29
+	jmp	.L28
+.LVL37:
+.L24:
+	.loc 1 99 1 view .LVU116
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL38:
+	.loc 1 99 1 view .LVU117
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	va_file_refill, .-va_file_refill
+	.globl	va_file_fill
+	.type	va_file_fill, @function
+va_file_fill:
+.LVL39:
+.LFB20:
+	.loc 1 102 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 103 5 view .LVU119
+	.loc 1 104 5 view .LVU120
+	.loc 1 102 1 is_stmt 0 view .LVU121
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rsi, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rcx, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdx, %rbx
+	subq	$72, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 104 5 view .LVU122
+	call	file_commit
+.LVL40:
+	.loc 1 105 5 is_stmt 1 view .LVU123
+	.loc 1 105 8 is_stmt 0 view .LVU124
+	cmpq	$0, 72(%rdi)
+	jne	.L32
+.LBB37:
+	.loc 1 106 9 is_stmt 1 view .LVU125
+	.loc 1 107 9 view .LVU126
+	.loc 1 107 16 is_stmt 0 view .LVU127
+	xorl	%edx, %edx
+.LVL41:
+	.loc 1 107 16 view .LVU128
+	movl	$64, %eax
+	movq	%rsp, %r15
+	divq	%rbx
+	.loc 1 108 9 view .LVU129
+	cmpq	%rax, %rcx
+	.loc 1 107 16 view .LVU130
+	movq	%rax, %r14
+.LVL42:
+	.loc 1 108 9 is_stmt 1 view .LVU131
+	cmovbe	%rcx, %rax
+.LVL43:
+.LBB38:
+.LBI38:
+	.loc 2 556 20 view .LVU132
+.LBB39:
+	.loc 2 559 5 view .LVU133
+	.loc 2 560 5 view .LVU134
+	.loc 2 560 8 is_stmt 0 view .LVU135
+	cmpq	$1, %rbx
+	jne	.L50
+	.loc 2 561 9 is_stmt 1 view .LVU136
+	movl	%eax, %ecx
+.LVL44:
+	.loc 2 561 9 is_stmt 0 view .LVU137
+	movb	(%rsi), %al
+.LVL45:
+	.loc 2 561 9 view .LVU138
+	movq	%r15, %rdi
+.LVL46:
+	.loc 2 561 9 view .LVU139
+	rep stosb
+	.loc 2 562 9 is_stmt 1 view .LVU140
+	jmp	.L34
+.LVL47:
+.L50:
+.LBB40:
+	.loc 2 564 17 is_stmt 0 view .LVU141
+	xorl	%edx, %edx
+.LBE40:
+	.loc 2 559 11 view .LVU142
+	movq	%r15, %r8
+.LVL48:
+.L33:
+.LBB41:
+	.loc 2 564 26 is_stmt 1 view .LVU143
+	cmpq	%rdx, %rax
+	je	.L34
+	.loc 2 565 9 view .LVU144
+	movq	%r8, %rdi
+	movq	%r13, %rsi
+	movq	%rbx, %rcx
+	.loc 2 564 32 is_stmt 0 view .LVU145
+	incq	%rdx
+.LVL49:
+	.loc 2 565 9 view .LVU146
+	rep movsb
+	.loc 2 566 9 is_stmt 1 view .LVU147
+	.loc 2 566 11 is_stmt 0 view .LVU148
+	movq	%rdi, %r8
+.LVL50:
+	.loc 2 564 32 is_stmt 1 view .LVU149
+	.loc 2 564 32 is_stmt 0 view .LVU150
+	jmp	.L33
+.LVL51:
+.L40:
+	.loc 2 564 32 view .LVU151
+.LBE41:
+.LBE39:
+.LBE38:
+.LBB42:
+	.loc 1 110 13 is_stmt 1 view .LVU152
+	.loc 1 110 20 is_stmt 0 view .LVU153
+	cmpq	%r14, %rbp
+	movq	%r14, %r13
+	.loc 1 111 17 view .LVU154
+	movq	64(%r12), %rcx
+	movq	%rbx, %rsi
+	.loc 1 110 20 view .LVU155
+	cmovbe	%rbp, %r13
+.LVL52:
+	.loc 1 111 13 is_stmt 1 view .LVU156
+	.loc 1 111 17 is_stmt 0 view .LVU157
+	movq	%r15, %rdi
+	movq	%r13, %rdx
+	call	fwrite@PLT
+.LVL53:
+	.loc 1 111 16 view .LVU158
+	cmpq	%r13, %rax
+	jne	.L55
+	.loc 1 115 13 is_stmt 1 view .LVU159
+	.loc 1 115 15 is_stmt 0 view .LVU160
+	subq	%rax, %rbp
+.LVL54:
+.L34:
+	.loc 1 115 15 view .LVU161
+.LBE42:
+	.loc 1 109 18 is_stmt 1 view .LVU162
+	testq	%rbp, %rbp
+	jne	.L40
+	.loc 1 109 18 is_stmt 0 view .LVU163
+	jmp	.L31
+.LVL55:
+.L55:
+.LBB46:
+	.loc 1 112 17 is_stmt 1 view .LVU164
+.LBB43:
+.LBI43:
+	.loc 2 425 20 view .LVU165
+.LBB44:
+	.loc 2 427 5 view .LVU166
+	.loc 2 427 13 is_stmt 0 view .LVU167
+	movl	32(%r12), %eax
+	.loc 2 427 8 view .LVU168
+	testl	$939524096, %eax
+	jne	.L31
+	.loc 2 428 9 is_stmt 1 view .LVU169
+.LBB45:
+	.loc 2 428 25 view .LVU170
+.LVL56:
+	.loc 2 428 62 view .LVU171
+	.loc 2 428 101 is_stmt 0 view .LVU172
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU173
+	orl	$536870912, %eax
+	movl	%eax, 32(%r12)
+	jmp	.L31
+.LVL57:
+.L49:
+	.loc 2 428 123 view .LVU174
+.LBE45:
+.LBE44:
+.LBE43:
+.LBE46:
+.LBE37:
+.LBB47:
+	.loc 1 120 9 is_stmt 1 view .LVU175
+	.loc 1 120 29 is_stmt 0 view .LVU176
+	movq	80(%r12), %rax
+	subq	88(%r12), %rax
+.LVL58:
+	.loc 1 121 9 is_stmt 1 view .LVU177
+	.loc 1 121 12 is_stmt 0 view .LVU178
+	cmpq	%rbx, %rax
+	jnb	.L43
+	.loc 1 122 13 is_stmt 1 view .LVU179
+	movq	%r12, %rdi
+	call	va_file_flush
+.LVL59:
+	.loc 1 123 13 view .LVU180
+	.loc 1 123 15 is_stmt 0 view .LVU181
+	movq	80(%r12), %rax
+	xorl	%edx, %edx
+	divq	%rbx
+.LVL60:
+	.loc 1 124 13 is_stmt 1 view .LVU182
+	.loc 1 124 16 is_stmt 0 view .LVU183
+	cmpq	%rbx, 80(%r12)
+	jnb	.L44
+	.loc 1 125 17 is_stmt 1 discriminator 1 view .LVU184
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	.loc 1 126 18 is_stmt 0 discriminator 1 view .LVU185
+	decq	%rbp
+.LVL61:
+	.loc 1 125 17 discriminator 1 view .LVU186
+	call	va_file_write
+.LVL62:
+	.loc 1 126 17 is_stmt 1 discriminator 1 view .LVU187
+	.loc 1 127 17 discriminator 1 view .LVU188
+.L32:
+	.loc 1 127 17 is_stmt 0 discriminator 1 view .LVU189
+.LBE47:
+	.loc 1 119 14 is_stmt 1 view .LVU190
+	testq	%rbp, %rbp
+	jne	.L49
+	.loc 1 119 14 is_stmt 0 view .LVU191
+	jmp	.L31
+.LVL63:
+.L43:
+.LBB52:
+	.loc 1 120 16 view .LVU192
+	xorl	%edx, %edx
+	divq	%rbx
+.LVL64:
+.L44:
+	.loc 1 130 9 is_stmt 1 view .LVU193
+	.loc 1 131 33 is_stmt 0 view .LVU194
+	movq	88(%r12), %r8
+	.loc 1 130 11 view .LVU195
+	cmpq	%rax, %rbp
+	cmovbe	%rbp, %rax
+.LVL65:
+	.loc 1 131 33 view .LVU196
+	addq	72(%r12), %r8
+	.loc 1 130 11 view .LVU197
+	movq	%rax, %rdx
+.LVL66:
+	.loc 1 131 9 is_stmt 1 view .LVU198
+.LBB48:
+.LBI48:
+	.loc 2 556 20 view .LVU199
+.LBB49:
+	.loc 2 559 5 view .LVU200
+	.loc 2 560 5 view .LVU201
+.LBB50:
+	.loc 2 564 17 is_stmt 0 view .LVU202
+	xorl	%eax, %eax
+.LVL67:
+	.loc 2 564 17 view .LVU203
+.LBE50:
+	.loc 2 560 8 view .LVU204
+	cmpq	$1, %rbx
+	jne	.L46
+	.loc 2 561 9 is_stmt 1 view .LVU205
+	movb	0(%r13), %al
+	movq	%r8, %rdi
+	movq	%rdx, %rcx
+	rep stosb
+	.loc 2 562 9 view .LVU206
+	jmp	.L47
+.LVL68:
+.L46:
+.LBB51:
+	.loc 2 564 26 view .LVU207
+	cmpq	%rax, %rdx
+	je	.L47
+	.loc 2 565 9 view .LVU208
+	movq	%r8, %rdi
+	movq	%r13, %rsi
+	movq	%rbx, %rcx
+	.loc 2 564 32 is_stmt 0 view .LVU209
+	incq	%rax
+.LVL69:
+	.loc 2 565 9 view .LVU210
+	rep movsb
+	.loc 2 566 9 is_stmt 1 view .LVU211
+	.loc 2 566 11 is_stmt 0 view .LVU212
+	movq	%rdi, %r8
+.LVL70:
+	.loc 2 564 32 is_stmt 1 view .LVU213
+	.loc 2 564 32 is_stmt 0 view .LVU214
+	jmp	.L46
+.LVL71:
+.L47:
+	.loc 2 564 32 view .LVU215
+.LBE51:
+.LBE49:
+.LBE48:
+	.loc 1 132 9 is_stmt 1 view .LVU216
+	.loc 1 132 21 is_stmt 0 view .LVU217
+	movq	%rbx, %rax
+	.loc 1 133 11 view .LVU218
+	subq	%rdx, %rbp
+.LVL72:
+	.loc 1 132 21 view .LVU219
+	imulq	%rdx, %rax
+	.loc 1 132 16 view .LVU220
+	addq	%rax, 88(%r12)
+	.loc 1 133 9 is_stmt 1 view .LVU221
+.LVL73:
+	.loc 1 133 9 is_stmt 0 view .LVU222
+	jmp	.L32
+.LVL74:
+.L31:
+	.loc 1 133 9 view .LVU223
+.LBE52:
+	.loc 1 135 1 view .LVU224
+	addq	$72, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+.LVL75:
+	.loc 1 135 1 view .LVU225
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL76:
+	.loc 1 135 1 view .LVU226
+	popq	%r12
+	.cfi_def_cfa_offset 32
+.LVL77:
+	.loc 1 135 1 view .LVU227
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	va_file_fill, .-va_file_fill
+	.globl	va_file_put
+	.type	va_file_put, @function
+va_file_put:
+.LVL78:
+.LFB21:
+	.loc 1 138 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 139 5 view .LVU229
+	.loc 1 138 1 is_stmt 0 view .LVU230
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 139 5 view .LVU231
+	movl	$1, %edx
+	.loc 1 138 1 view .LVU232
+	movb	%sil, 12(%rsp)
+	.loc 1 139 5 view .LVU233
+	leaq	12(%rsp), %rsi
+.LVL79:
+	.loc 1 139 5 view .LVU234
+	call	va_file_write
+.LVL80:
+	.loc 1 140 1 view .LVU235
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	va_file_put, .-va_file_put
+	.globl	va_file_put_fill
+	.type	va_file_put_fill, @function
+va_file_put_fill:
+.LVL81:
+.LFB22:
+	.loc 1 143 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 144 5 view .LVU237
+	.loc 1 143 1 is_stmt 0 view .LVU238
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 143 1 view .LVU239
+	movq	%rdx, %rcx
+	.loc 1 145 5 view .LVU240
+	movl	$1, %edx
+.LVL82:
+	.loc 1 144 14 view .LVU241
+	movb	%sil, 15(%rsp)
+	.loc 1 145 5 is_stmt 1 view .LVU242
+	leaq	15(%rsp), %rsi
+.LVL83:
+	.loc 1 145 5 is_stmt 0 view .LVU243
+	call	va_file_fill
+.LVL84:
+	.loc 1 146 1 view .LVU244
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	va_file_put_fill, .-va_file_put_fill
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "./include/va_print/base.h"
+	.file 8 "./include/va_print/file.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/stdio.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x100d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x29
+	.long	.LASF1052
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF945
+	.uleb128 0x12
+	.long	.LASF952
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x32
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF946
+	.uleb128 0x2a
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF947
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF948
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF949
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF950
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF951
+	.uleb128 0x12
+	.long	.LASF953
+	.byte	0x4
+	.byte	0x98
+	.byte	0x12
+	.long	0x71
+	.uleb128 0x12
+	.long	.LASF954
+	.byte	0x4
+	.byte	0x99
+	.byte	0x12
+	.long	0x71
+	.uleb128 0x3
+	.long	0x95
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF955
+	.uleb128 0xa
+	.long	0x95
+	.uleb128 0xb
+	.long	0x95
+	.long	0xb1
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1000
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x8
+	.long	0x238
+	.uleb128 0x1
+	.long	.LASF956
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x6a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF957
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0x90
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF958
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0x90
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF959
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0x90
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF960
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0x90
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF961
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0x90
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF962
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0x90
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF963
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0x90
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF964
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0x90
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF965
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0x90
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF966
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0x90
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF967
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0x90
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF968
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x251
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF969
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x256
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF970
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x6a
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF971
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x6a
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF972
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0x78
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF973
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x55
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF974
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x5c
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF975
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x25b
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x26b
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF977
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0x84
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF978
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x275
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF979
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x27f
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF980
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x256
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF981
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0x4c
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF982
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x39
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF983
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x6a
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF984
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x284
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF985
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0xb1
+	.uleb128 0x2d
+	.long	.LASF1053
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1a
+	.long	.LASF986
+	.uleb128 0x3
+	.long	0x24c
+	.uleb128 0x3
+	.long	0xb1
+	.uleb128 0xb
+	.long	0x95
+	.long	0x26b
+	.uleb128 0xc
+	.long	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x244
+	.uleb128 0x1a
+	.long	.LASF987
+	.uleb128 0x3
+	.long	0x270
+	.uleb128 0x1a
+	.long	.LASF988
+	.uleb128 0x3
+	.long	0x27a
+	.uleb128 0xb
+	.long	0x95
+	.long	0x294
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	0x238
+	.uleb128 0x1f
+	.long	0x294
+	.uleb128 0x3
+	.long	0x9c
+	.uleb128 0xa
+	.long	0x29e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF989
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF990
+	.uleb128 0x19
+	.byte	0x38
+	.byte	0x7
+	.byte	0xc1
+	.long	0x34e
+	.uleb128 0x1
+	.long	.LASF991
+	.byte	0x7
+	.byte	0xc4
+	.byte	0x11
+	.long	0x29e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF992
+	.byte	0x7
+	.byte	0xd3
+	.byte	0x10
+	.long	0x3a2
+	.byte	0x8
+	.uleb128 0x13
+	.string	"end"
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x13
+	.long	0x3bb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF993
+	.byte	0x7
+	.byte	0xdb
+	.byte	0xc
+	.long	0x3cb
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF994
+	.byte	0x7
+	.byte	0xe2
+	.byte	0xe
+	.long	0x3f8
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF995
+	.byte	0x7
+	.byte	0xec
+	.byte	0xe
+	.long	0x41b
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF996
+	.byte	0x7
+	.byte	0xf1
+	.byte	0x13
+	.long	0x4e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF997
+	.byte	0x7
+	.byte	0xf5
+	.byte	0x13
+	.long	0x4e
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF998
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x4e
+	.byte	0x32
+	.uleb128 0x13
+	.string	"enc"
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x13
+	.long	0x4e
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF999
+	.byte	0x7
+	.byte	0xff
+	.byte	0xa
+	.long	0xa1
+	.byte	0x34
+	.byte	0
+	.uleb128 0xe
+	.long	0x45
+	.long	0x362
+	.uleb128 0x2
+	.long	0x362
+	.uleb128 0x2
+	.long	0x397
+	.byte	0
+	.uleb128 0x3
+	.long	0x367
+	.uleb128 0x1b
+	.long	.LASF1001
+	.byte	0x10
+	.byte	0x7
+	.value	0x132
+	.byte	0x10
+	.long	0x392
+	.uleb128 0x5
+	.long	.LASF1002
+	.byte	0x7
+	.value	0x135
+	.byte	0x20
+	.long	0x432
+	.byte	0
+	.uleb128 0x9
+	.string	"cur"
+	.byte	0x7
+	.value	0x138
+	.byte	0x11
+	.long	0x397
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x367
+	.uleb128 0x3
+	.long	0x3a1
+	.uleb128 0x1f
+	.long	0x397
+	.uleb128 0x2e
+	.uleb128 0x3
+	.long	0x34e
+	.uleb128 0xe
+	.long	0x397
+	.long	0x3bb
+	.uleb128 0x2
+	.long	0x362
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x3
+	.long	0x3a7
+	.uleb128 0x17
+	.long	0x3cb
+	.uleb128 0x2
+	.long	0x362
+	.byte	0
+	.uleb128 0x3
+	.long	0x3c0
+	.uleb128 0xe
+	.long	0x39
+	.long	0x3ee
+	.uleb128 0x2
+	.long	0x3ee
+	.uleb128 0x2
+	.long	0x397
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x3f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x392
+	.uleb128 0x3
+	.long	0x39
+	.uleb128 0x3
+	.long	0x3d0
+	.uleb128 0xe
+	.long	0x39
+	.long	0x41b
+	.uleb128 0x2
+	.long	0x4c
+	.uleb128 0x2
+	.long	0x4e
+	.uleb128 0x2
+	.long	0x397
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x3
+	.long	0x3fd
+	.uleb128 0xf
+	.long	.LASF1003
+	.byte	0x7
+	.value	0x100
+	.byte	0x3
+	.long	0x2b6
+	.uleb128 0xa
+	.long	0x420
+	.uleb128 0x3
+	.long	0x42d
+	.uleb128 0xf
+	.long	.LASF1004
+	.byte	0x7
+	.value	0x139
+	.byte	0x3
+	.long	0x367
+	.uleb128 0xf
+	.long	.LASF1005
+	.byte	0x7
+	.value	0x169
+	.byte	0x1a
+	.long	0x451
+	.uleb128 0x1b
+	.long	.LASF1006
+	.byte	0x40
+	.byte	0x7
+	.value	0x1b7
+	.byte	0x8
+	.long	0x4d0
+	.uleb128 0x5
+	.long	.LASF1002
+	.byte	0x7
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x643
+	.byte	0
+	.uleb128 0x9
+	.string	"pat"
+	.byte	0x7
+	.value	0x1b9
+	.byte	0x14
+	.long	0x437
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1007
+	.byte	0x7
+	.value	0x1ba
+	.byte	0xe
+	.long	0x45
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1008
+	.byte	0x7
+	.value	0x1bb
+	.byte	0xe
+	.long	0x45
+	.byte	0x1c
+	.uleb128 0x9
+	.string	"opt"
+	.byte	0x7
+	.value	0x1bc
+	.byte	0xe
+	.long	0x45
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1009
+	.byte	0x7
+	.value	0x1bd
+	.byte	0xe
+	.long	0x45
+	.byte	0x24
+	.uleb128 0x9
+	.string	"win"
+	.byte	0x7
+	.value	0x1be
+	.byte	0x11
+	.long	0x636
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF1010
+	.byte	0x7
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x648
+	.byte	0x38
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1011
+	.byte	0x7
+	.value	0x16c
+	.byte	0x1e
+	.long	0x4e2
+	.uleb128 0xa
+	.long	0x4d0
+	.uleb128 0x1b
+	.long	.LASF1012
+	.byte	0x40
+	.byte	0x2
+	.value	0x14f
+	.byte	0x8
+	.long	0x4fd
+	.uleb128 0x9
+	.string	"q"
+	.byte	0x2
+	.value	0x150
+	.byte	0x1b
+	.long	0x7bb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.byte	0x38
+	.value	0x174
+	.long	0x576
+	.uleb128 0x5
+	.long	.LASF1013
+	.byte	0x7
+	.value	0x176
+	.byte	0xc
+	.long	0x586
+	.byte	0
+	.uleb128 0x9
+	.string	"put"
+	.byte	0x7
+	.value	0x178
+	.byte	0xc
+	.long	0x59b
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1014
+	.byte	0x7
+	.value	0x17b
+	.byte	0xc
+	.long	0x586
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1015
+	.byte	0x7
+	.value	0x182
+	.byte	0xb
+	.long	0x5bb
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1016
+	.byte	0x7
+	.value	0x186
+	.byte	0xc
+	.long	0x5d5
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1017
+	.byte	0x7
+	.value	0x18c
+	.byte	0xc
+	.long	0x5ea
+	.byte	0x28
+	.uleb128 0x9
+	.string	"enc"
+	.byte	0x7
+	.value	0x191
+	.byte	0x13
+	.long	0x4e
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF999
+	.byte	0x7
+	.value	0x192
+	.byte	0xa
+	.long	0x5ef
+	.byte	0x31
+	.byte	0
+	.uleb128 0x17
+	.long	0x581
+	.uleb128 0x2
+	.long	0x581
+	.byte	0
+	.uleb128 0x3
+	.long	0x444
+	.uleb128 0x3
+	.long	0x576
+	.uleb128 0x17
+	.long	0x59b
+	.uleb128 0x2
+	.long	0x581
+	.uleb128 0x2
+	.long	0x45
+	.byte	0
+	.uleb128 0x3
+	.long	0x58b
+	.uleb128 0xe
+	.long	0x5b4
+	.long	0x5b4
+	.uleb128 0x2
+	.long	0x581
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1018
+	.uleb128 0x3
+	.long	0x5a0
+	.uleb128 0x17
+	.long	0x5d5
+	.uleb128 0x2
+	.long	0x581
+	.uleb128 0x2
+	.long	0x45
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x3
+	.long	0x5c0
+	.uleb128 0x17
+	.long	0x5ea
+	.uleb128 0x2
+	.long	0x581
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x3
+	.long	0x5da
+	.uleb128 0xb
+	.long	0x95
+	.long	0x5ff
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1019
+	.byte	0x7
+	.value	0x193
+	.byte	0x3
+	.long	0x4fd
+	.uleb128 0xa
+	.long	0x5ff
+	.uleb128 0x20
+	.byte	0x10
+	.value	0x19a
+	.long	0x636
+	.uleb128 0x9
+	.string	"cur"
+	.byte	0x7
+	.value	0x19b
+	.byte	0xb
+	.long	0x4c
+	.byte	0
+	.uleb128 0x9
+	.string	"end"
+	.byte	0x7
+	.value	0x19c
+	.byte	0xb
+	.long	0x4c
+	.byte	0x8
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1020
+	.byte	0x7
+	.value	0x19d
+	.byte	0x3
+	.long	0x611
+	.uleb128 0x3
+	.long	0x60c
+	.uleb128 0x3
+	.long	0x4dd
+	.uleb128 0x19
+	.byte	0x68
+	.byte	0x8
+	.byte	0x9f
+	.long	0x6af
+	.uleb128 0x13
+	.string	"s"
+	.byte	0x8
+	.byte	0xa0
+	.byte	0x11
+	.long	0x444
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1021
+	.byte	0x8
+	.byte	0xa1
+	.byte	0xb
+	.long	0x294
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1022
+	.byte	0x8
+	.byte	0xa2
+	.byte	0xb
+	.long	0x90
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1023
+	.byte	0x8
+	.byte	0xa3
+	.byte	0xc
+	.long	0x39
+	.byte	0x50
+	.uleb128 0x13
+	.string	"pos"
+	.byte	0x8
+	.byte	0xa4
+	.byte	0xc
+	.long	0x39
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1024
+	.byte	0x8
+	.byte	0xa5
+	.byte	0x9
+	.long	0x5b4
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF999
+	.byte	0x8
+	.byte	0xa6
+	.byte	0xa
+	.long	0x5ef
+	.byte	0x61
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1025
+	.byte	0x8
+	.byte	0xa7
+	.byte	0x3
+	.long	0x64d
+	.uleb128 0x19
+	.byte	0x88
+	.byte	0x2
+	.byte	0xc9
+	.long	0x6de
+	.uleb128 0x13
+	.string	"cls"
+	.byte	0x2
+	.byte	0xce
+	.byte	0x13
+	.long	0x6de
+	.byte	0
+	.uleb128 0x13
+	.string	"esc"
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x18
+	.long	0x6ee
+	.byte	0x80
+	.byte	0
+	.uleb128 0xb
+	.long	0x4e
+	.long	0x6ee
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x3
+	.long	0x2a3
+	.uleb128 0x12
+	.long	.LASF1026
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x3
+	.long	0x6bb
+	.uleb128 0xa
+	.long	0x6f3
+	.uleb128 0x19
+	.byte	0x38
+	.byte	0x2
+	.byte	0xe0
+	.long	0x760
+	.uleb128 0x1
+	.long	.LASF1027
+	.byte	0x2
+	.byte	0xef
+	.byte	0x18
+	.long	0x760
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1028
+	.byte	0x2
+	.value	0x101
+	.byte	0xb
+	.long	0x78b
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1029
+	.byte	0x2
+	.value	0x10e
+	.byte	0xb
+	.long	0x79f
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1030
+	.byte	0x2
+	.value	0x12a
+	.byte	0xc
+	.long	0x59b
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1031
+	.byte	0x2
+	.value	0x131
+	.byte	0xc
+	.long	0x586
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF1032
+	.byte	0x2
+	.value	0x141
+	.byte	0x21
+	.long	0x7a4
+	.byte	0x30
+	.byte	0
+	.uleb128 0xb
+	.long	0x770
+	.long	0x770
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1033
+	.uleb128 0xe
+	.long	0x5b4
+	.long	0x78b
+	.uleb128 0x2
+	.long	0x581
+	.uleb128 0x2
+	.long	0x45
+	.byte	0
+	.uleb128 0x3
+	.long	0x777
+	.uleb128 0xe
+	.long	0x5b4
+	.long	0x79f
+	.uleb128 0x2
+	.long	0x581
+	.byte	0
+	.uleb128 0x3
+	.long	0x790
+	.uleb128 0x3
+	.long	0x6ff
+	.uleb128 0xf
+	.long	.LASF1034
+	.byte	0x2
+	.value	0x142
+	.byte	0x3
+	.long	0x704
+	.uleb128 0xa
+	.long	0x7a9
+	.uleb128 0xb
+	.long	0x7cb
+	.long	0x7cb
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	0x7b6
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x3d
+	.long	0x4c
+	.long	0x7ee
+	.uleb128 0x2
+	.long	0x4c
+	.uleb128 0x2
+	.long	0x6a
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1036
+	.byte	0x2b
+	.long	0x4c
+	.long	0x80c
+	.uleb128 0x2
+	.long	0x4c
+	.uleb128 0x2
+	.long	0x397
+	.uleb128 0x2
+	.long	0x39
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1037
+	.value	0x2a9
+	.long	0x39
+	.long	0x830
+	.uleb128 0x2
+	.long	0x39c
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x299
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1038
+	.value	0x2c0
+	.long	0x39
+	.long	0x854
+	.uleb128 0x2
+	.long	0x39c
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x299
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1039
+	.value	0x36a
+	.long	0x865
+	.uleb128 0x2
+	.long	0x294
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1040
+	.value	0x363
+	.long	0x876
+	.uleb128 0x2
+	.long	0x294
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1041
+	.byte	0x8e
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8fa
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x8e
+	.byte	0x2b
+	.long	0x581
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x7
+	.string	"c"
+	.byte	0x8e
+	.byte	0x37
+	.long	0x45
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x7
+	.string	"n"
+	.byte	0x8e
+	.byte	0x41
+	.long	0x39
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2f
+	.string	"x"
+	.byte	0x1
+	.byte	0x90
+	.byte	0xa
+	.long	0x95
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.uleb128 0x10
+	.quad	.LVL84
+	.long	0x959
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -17
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1042
+	.byte	0x89
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x959
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x89
+	.byte	0x26
+	.long	0x581
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x7
+	.string	"c"
+	.byte	0x89
+	.byte	0x2e
+	.long	0x95
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x10
+	.quad	.LVL80
+	.long	0xc90
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1043
+	.byte	0x65
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbfd
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x65
+	.byte	0x27
+	.long	0x581
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x65
+	.byte	0x36
+	.long	0x397
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x7
+	.string	"k"
+	.byte	0x65
+	.byte	0x40
+	.long	0x39
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x7
+	.string	"n"
+	.byte	0x65
+	.byte	0x4a
+	.long	0x39
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0xd
+	.string	"t"
+	.byte	0x67
+	.byte	0x17
+	.long	0xbfd
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x30
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.long	0xb18
+	.uleb128 0x31
+	.long	.LASF1044
+	.byte	0x1
+	.byte	0x6a
+	.byte	0xe
+	.long	0xc02
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x6b
+	.byte	0x10
+	.long	0x39
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x24
+	.long	.LLRL32
+	.long	0xa9d
+	.uleb128 0xd
+	.string	"j"
+	.byte	0x6e
+	.byte	0x14
+	.long	0x39
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x18
+	.long	0xedf
+	.quad	.LBI43
+	.byte	.LVU165
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.byte	0x70
+	.byte	0x11
+	.long	0xa7c
+	.uleb128 0x6
+	.long	0xef4
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x6
+	.long	0xeea
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x1c
+	.long	0xefe
+	.quad	.LBB45
+	.quad	.LBE45-.LBB45
+	.uleb128 0x11
+	.long	0xeff
+	.long	.LLST36
+	.long	.LVUS36
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL53
+	.long	0x80c
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7f
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	0xe95
+	.quad	.LBI38
+	.byte	.LVU132
+	.quad	.LBB38
+	.quad	.LBE38-.LBB38
+	.byte	0x1
+	.byte	0x6c
+	.byte	0x9
+	.uleb128 0x6
+	.long	0xebe
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x6
+	.long	0xeb4
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x6
+	.long	0xeaa
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x6
+	.long	0xea0
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x11
+	.long	0xec8
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x25
+	.long	0xed2
+	.long	.LLRL30
+	.uleb128 0x11
+	.long	0xed3
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LLRL37
+	.long	0xbe8
+	.uleb128 0xd
+	.string	"j"
+	.byte	0x78
+	.byte	0x10
+	.long	0x39
+	.long	.LLST38
+	.long	.LVUS38
+	.uleb128 0x18
+	.long	0xe95
+	.quad	.LBI48
+	.byte	.LVU199
+	.quad	.LBB48
+	.quad	.LBE48-.LBB48
+	.byte	0x83
+	.byte	0x9
+	.long	0xbaf
+	.uleb128 0x6
+	.long	0xebe
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x6
+	.long	0xeb4
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x6
+	.long	0xeaa
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x6
+	.long	0xea0
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x11
+	.long	0xec8
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x25
+	.long	0xed2
+	.long	.LLRL44
+	.uleb128 0x11
+	.long	0xed3
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL59
+	.long	0xda2
+	.long	0xbc7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL62
+	.long	0xc90
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL40
+	.long	0xe6a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x6af
+	.uleb128 0xb
+	.long	0x95
+	.long	0xc12
+	.uleb128 0xc
+	.long	0x32
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1054
+	.byte	0x1
+	.byte	0x54
+	.byte	0xc
+	.long	0x5b4
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc90
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x54
+	.byte	0x28
+	.long	0x581
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x34
+	.long	.LASF1045
+	.byte	0x1
+	.byte	0x54
+	.byte	0x32
+	.long	0x39
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0xd
+	.string	"t"
+	.byte	0x56
+	.byte	0x17
+	.long	0xbfd
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x15
+	.quad	.LVL31
+	.long	0xe6a
+	.long	0xc82
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL36
+	.long	0xda2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1046
+	.byte	0x43
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xda2
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x43
+	.byte	0x28
+	.long	0x581
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x43
+	.byte	0x37
+	.long	0x397
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x7
+	.string	"n"
+	.byte	0x43
+	.byte	0x41
+	.long	0x39
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xd
+	.string	"t"
+	.byte	0x45
+	.byte	0x17
+	.long	0xbfd
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x18
+	.long	0xedf
+	.quad	.LBI34
+	.byte	.LVU73
+	.quad	.LBB34
+	.quad	.LBE34-.LBB34
+	.byte	0x4c
+	.byte	0xd
+	.long	0xd52
+	.uleb128 0x6
+	.long	0xef4
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x6
+	.long	0xeea
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x1c
+	.long	0xefe
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.uleb128 0x11
+	.long	0xeff
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL21
+	.long	0xe6a
+	.long	0xd6a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LVL22
+	.long	0xda2
+	.long	0xd82
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL23
+	.long	0x80c
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1047
+	.byte	0x1
+	.byte	0x34
+	.byte	0xd
+	.byte	0x1
+	.long	0xdba
+	.uleb128 0x36
+	.string	"t"
+	.byte	0x1
+	.byte	0x34
+	.byte	0x2d
+	.long	0xbfd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1048
+	.byte	0x2b
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe1e
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x2b
+	.byte	0x29
+	.long	0x581
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xd
+	.string	"t"
+	.byte	0x2d
+	.byte	0x17
+	.long	0xbfd
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x15
+	.quad	.LVL17
+	.long	0xda2
+	.long	0xe10
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x26
+	.quad	.LVL19
+	.long	0x854
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1049
+	.byte	0x25
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe6a
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x25
+	.byte	0x27
+	.long	0x581
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xd
+	.string	"t"
+	.byte	0x27
+	.byte	0x17
+	.long	0xbfd
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x26
+	.quad	.LVL3
+	.long	0x865
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1055
+	.byte	0x1
+	.byte	0x1a
+	.byte	0xd
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe95
+	.uleb128 0x38
+	.string	"t"
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x2b
+	.long	0xbfd
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1050
+	.value	0x22c
+	.long	0xedf
+	.uleb128 0x16
+	.string	"w"
+	.value	0x22d
+	.byte	0xb
+	.long	0x4c
+	.uleb128 0x16
+	.string	"x"
+	.value	0x22d
+	.byte	0x1a
+	.long	0x397
+	.uleb128 0x16
+	.string	"k"
+	.value	0x22d
+	.byte	0x24
+	.long	0x39
+	.uleb128 0x16
+	.string	"n"
+	.value	0x22d
+	.byte	0x2e
+	.long	0x39
+	.uleb128 0x1e
+	.string	"p"
+	.value	0x22f
+	.byte	0xb
+	.long	0x90
+	.uleb128 0x28
+	.uleb128 0x1e
+	.string	"i"
+	.value	0x234
+	.byte	0x11
+	.long	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1051
+	.value	0x1a9
+	.long	0xf0d
+	.uleb128 0x16
+	.string	"s"
+	.value	0x1a9
+	.byte	0x35
+	.long	0x581
+	.uleb128 0x16
+	.string	"e"
+	.value	0x1a9
+	.byte	0x41
+	.long	0x45
+	.uleb128 0x28
+	.uleb128 0x1e
+	.string	"_xp"
+	.value	0x1ac
+	.byte	0x2d
+	.long	0xf0d
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x45
+	.uleb128 0x39
+	.long	0xda2
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x6
+	.long	0xdaf
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x18
+	.long	0xda2
+	.quad	.LBI29
+	.byte	.LVU21
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.byte	0x34
+	.byte	0xd
+	.long	0xffb
+	.uleb128 0x6
+	.long	0xdaf
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x18
+	.long	0xedf
+	.quad	.LBI31
+	.byte	.LVU28
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.byte	0x3d
+	.byte	0x9
+	.long	0xfc9
+	.uleb128 0x6
+	.long	0xef4
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x6
+	.long	0xeea
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x1c
+	.long	0xefe
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0x11
+	.long	0xeff
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL8
+	.long	0x865
+	.uleb128 0x15
+	.quad	.LVL9
+	.long	0x830
+	.long	0xfed
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x1d
+	.quad	.LVL13
+	.long	0x854
+	.byte	0
+	.uleb128 0x10
+	.quad	.LVL5
+	.long	0xe6a
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS48:
+	.uleb128 0
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 0
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU243
+	.uleb128 .LVU243
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 0
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 0
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL84-1-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS46:
+	.uleb128 0
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 .LFE21-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 0
+	.uleb128 .LVU234
+	.uleb128 .LVU234
+	.uleb128 .LVU235
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU174
+	.uleb128 .LVU174
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU219
+	.uleb128 .LVU222
+	.uleb128 .LVU226
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU120
+	.uleb128 .LVU139
+	.uleb128 .LVU139
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LFE20-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU131
+	.uleb128 .LVU132
+	.uleb128 .LVU132
+	.uleb128 .LVU174
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU156
+	.uleb128 .LVU161
+	.uleb128 .LVU164
+	.uleb128 .LVU174
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU165
+	.uleb128 .LVU174
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU165
+	.uleb128 .LVU174
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU171
+	.uleb128 .LVU174
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x3
+	.byte	0x7c
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU132
+	.uleb128 .LVU138
+	.uleb128 .LVU138
+	.uleb128 .LVU141
+	.uleb128 .LVU141
+	.uleb128 .LVU151
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x25
+	.byte	0x76
+	.sleb128 0
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x76
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x7e
+	.sleb128 0
+	.byte	0x23
+	.uleb128 0x8000000000000000
+	.byte	0x2c
+	.byte	0x28
+	.value	0x1
+	.byte	0x16
+	.byte	0x13
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU132
+	.uleb128 .LVU151
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU132
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU151
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU132
+	.uleb128 .LVU151
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU134
+	.uleb128 .LVU143
+	.uleb128 .LVU143
+	.uleb128 .LVU149
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x5f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU143
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU151
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU177
+	.uleb128 .LVU180
+	.uleb128 .LVU182
+	.uleb128 .LVU187
+	.uleb128 .LVU192
+	.uleb128 .LVU193
+	.uleb128 .LVU193
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU223
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-1-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0xc
+	.byte	0x70
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x73
+	.sleb128 0
+	.byte	0xa8
+	.uleb128 0x32
+	.byte	0x1b
+	.byte	0xa8
+	.uleb128 0
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU199
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU215
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU199
+	.uleb128 .LVU215
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU199
+	.uleb128 .LVU215
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU199
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU215
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0xa
+	.byte	0x7c
+	.sleb128 72
+	.byte	0x6
+	.byte	0x7c
+	.sleb128 88
+	.byte	0x6
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU201
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU215
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU207
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU215
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU100
+	.uleb128 .LVU100
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU94
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LFE19-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU91
+	.uleb128 .LVU91
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU90
+	.uleb128 .LVU90
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU57
+	.uleb128 .LVU65
+	.uleb128 .LVU65
+	.uleb128 .LVU89
+	.uleb128 .LVU89
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LFE18-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU73
+	.uleb128 .LVU82
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU73
+	.uleb128 .LVU82
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU79
+	.uleb128 .LVU82
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU46
+	.uleb128 .LVU52
+	.uleb128 .LVU52
+	.uleb128 .LVU54
+	.uleb128 .LVU54
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LFE16-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 .LVU12
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LFE17-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU21
+	.uleb128 .LVU23
+	.uleb128 .LVU23
+	.uleb128 .LVU41
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU28
+	.uleb128 .LVU37
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU28
+	.uleb128 .LVU37
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU34
+	.uleb128 .LVU37
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB40-.Ltext0
+	.uleb128 .LBE40-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB46-.Ltext0
+	.uleb128 .LBE46-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0
+.LLRL44:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF388
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF516
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF580
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF583
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF643
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF644
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF645
+	.byte	0x4
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF646
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF647
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF648
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF688
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF516
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF711
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF712
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/assert.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF721
+	.file 35 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF722
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF723
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 37 "/usr/include/uchar.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF764
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 39 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF824
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 40 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF827
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 41 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF830
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 42 "./include/va_print/file_utf8.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF850
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF851
+	.file 43 "./include/va_print/file_utf16be.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF852
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF853
+	.file 44 "./include/va_print/file_utf32be.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF854
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF944
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF387
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF439
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF442
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF453
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF454
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF515
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF533
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF541
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF555
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF557
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF575
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF582
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF598
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF640
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF642
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF656
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF668
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF673
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF675
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF678
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF680
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF687
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF709
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF387
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF555
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF557
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF556
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.34.5c7a904026bfb22c2884c9ab35150e04,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF720
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF753
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF762
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF556
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF756
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF823
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF826
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF829
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF849
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.file.h.35.97e601440fdd2d29879dd346f15f7c01,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF868
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.13.ba8b097355bd637e9189dfa7d96daa61,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF943
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF441:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1044:
+	.string	"chunk"
+.LASF683:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF952:
+	.string	"size_t"
+.LASF944:
+	.string	"va_fwrite_unlocked fwrite_unlocked"
+.LASF879:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF676:
+	.string	"stdin stdin"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF703:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF768:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF906:
+	.string	"VA_MODE_X7 7"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF782:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF404:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF665:
+	.string	"SEEK_SET 0"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF813:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF818:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF987:
+	.string	"_IO_codecvt"
+.LASF517:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF478:
+	.string	"__flexarr []"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF881:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF827:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF845:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF449:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF925:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF967:
+	.string	"_IO_save_end"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF918:
+	.string	"VA_QUOTE_K 4"
+.LASF896:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1026:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF846:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF811:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF756:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF872:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF826:
+	.string	"va_char_p_decode utf8"
+.LASF1050:
+	.string	"va_fill_pattern"
+.LASF799:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF1028:
+	.string	"check_quote"
+.LASF810:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF860:
+	.string	"VA_STREAM_FILE_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF960:
+	.string	"_IO_write_base"
+.LASF492:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF618:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF643:
+	.string	"__STD_TYPE"
+.LASF716:
+	.string	"_ASSERT_H_DECLS "
+.LASF593:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF465:
+	.string	"__P(args) args"
+.LASF903:
+	.string	"VA_MODE_TYPE 4"
+.LASF842:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF976:
+	.string	"_lock"
+.LASF559:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF806:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF1000:
+	.string	"_IO_FILE"
+.LASF580:
+	.string	"__need___va_list "
+.LASF940:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF611:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF814:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF755:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF992:
+	.string	"take"
+.LASF861:
+	.string	"VA_STREAM_FILE16_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF705:
+	.string	"__f64x(x) x ##f64x"
+.LASF991:
+	.string	"type"
+.LASF934:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF923:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF682:
+	.string	"__HAVE_FLOAT128 1"
+.LASF732:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF690:
+	.string	"__HAVE_FLOAT32 1"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF965:
+	.string	"_IO_save_base"
+.LASF410:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF575:
+	.string	"__size_t "
+.LASF840:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF998:
+	.string	"str_prefix"
+.LASF595:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF888:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF453:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF480:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF563:
+	.string	"_T_SIZE "
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1014:
+	.string	"finish"
+.LASF772:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF943:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF969:
+	.string	"_chain"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF407:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF712:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF973:
+	.string	"_cur_column"
+.LASF855:
+	.string	"va_file32_encode utf32be"
+.LASF394:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF773:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF722:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF577:
+	.string	"NULL"
+.LASF475:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF865:
+	.string	"va_ufprintf(F,...) va_xfprintf(VA_STREAM_FILE16_BUF, F, __VA_ARGS__)"
+.LASF824:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF909:
+	.string	"VA_STATE_ARG 1"
+.LASF1029:
+	.string	"check_flush"
+.LASF536:
+	.string	"__stub_fchflags "
+.LASF785:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF724:
+	.string	"_STDDEF_H "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF620:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF807:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF418:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF398:
+	.string	"__USE_XOPEN"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF403:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__always_inline"
+.LASF561:
+	.string	"_SYS_SIZE_T_H "
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF414:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF868:
+	.string	"va_eprintf(...) va_fprintf(stderr, __VA_ARGS__)"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF451:
+	.string	"__GLIBC__ 2"
+.LASF697:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF951:
+	.string	"long int"
+.LASF443:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF437:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF731:
+	.string	"_PTRDIFF_T_ "
+.LASF558:
+	.string	"__size_t__ "
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF644:
+	.string	"_____fpos_t_defined 1"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1031:
+	.string	"render_flush"
+.LASF919:
+	.string	"VA_QUOTE_kk 5"
+.LASF718:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF815:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF640:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF929:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF986:
+	.string	"_IO_marker"
+.LASF625:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF675:
+	.string	"FOPEN_MAX 16"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF619:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF926:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF499:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF500:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF570:
+	.string	"_SIZE_T_DECLARED "
+.LASF467:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF677:
+	.string	"stdout stdout"
+.LASF523:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF488:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF701:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF387:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1005:
+	.string	"va_stream_t"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF481:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF866:
+	.string	"va_Ufprintf(F,...) va_xfprintf(VA_STREAM_FILE32_BUF, F, __VA_ARGS__)"
+.LASF622:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF448:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF458:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1039:
+	.string	"funlockfile"
+.LASF462:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF949:
+	.string	"signed char"
+.LASF585:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF469:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF812:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF988:
+	.string	"_IO_wide_data"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF600:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF516:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1049:
+	.string	"va_file_init"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF616:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF416:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF569:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF849:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF572:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF425:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF466:
+	.string	"__PMT(args) args"
+.LASF777:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF571:
+	.string	"__DEFINED_size_t "
+.LASF857:
+	.string	"VA_STREAM_FILE(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF841:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF917:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1018:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF510:
+	.string	"__restrict_arr __restrict"
+.LASF534:
+	.string	"__stub___compat_bdflush "
+.LASF567:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1032:
+	.string	"table"
+.LASF836:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF914:
+	.string	"VA_QUOTE_NONE 0"
+.LASF627:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF447:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF489:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF687:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1024:
+	.string	"autoflush"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF938:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF545:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF556:
+	.string	"__need_size_t "
+.LASF588:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF522:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF507:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF427:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF1053:
+	.string	"_IO_lock_t"
+.LASF835:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF401:
+	.string	"__USE_XOPEN2K"
+.LASF642:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF402:
+	.string	"__USE_XOPEN2KXSI"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF852:
+	.string	"VA_PRINT_FILE_UTF16BE_H_ "
+.LASF505:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF884:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF434:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF927:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF901:
+	.string	"VA_MODE_CHAR 2"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1041:
+	.string	"va_file_put_fill"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF646:
+	.string	"_____fpos64_t_defined 1"
+.LASF396:
+	.string	"__USE_POSIX199309"
+.LASF692:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF707:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF706:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF678:
+	.string	"stderr stderr"
+.LASF1040:
+	.string	"flockfile"
+.LASF648:
+	.string	"__FILE_defined 1"
+.LASF733:
+	.string	"___int_ptrdiff_t_h "
+.LASF651:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF452:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF400:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF417:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF765:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF715:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF641:
+	.string	"_BITS_TIME64_H 1"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF604:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF656:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF750:
+	.string	"__INT_WCHAR_T_H "
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF589:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1051:
+	.string	"va_stream_set_error"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF968:
+	.string	"_markers"
+.LASF634:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF789:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF657:
+	.string	"_VA_LIST_DEFINED "
+.LASF1021:
+	.string	"file"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF788:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF672:
+	.string	"FILENAME_MAX 4096"
+.LASF1045:
+	.string	"need"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF539:
+	.string	"__stub_setlogin "
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF636:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF582:
+	.string	"__GNUC_VA_LIST "
+.LASF908:
+	.string	"VA_STATE_INIT 0"
+.LASF742:
+	.string	"_T_WCHAR "
+.LASF759:
+	.string	"bool _Bool"
+.LASF1015:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF745:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1027:
+	.string	"delim"
+.LASF889:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF790:
+	.string	"VA_REC0() VA_REC0B"
+.LASF834:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF669:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF546:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF487:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF670:
+	.string	"L_tmpnam 20"
+.LASF863:
+	.string	"va_xfprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_file_buf_[va_file_buf_size]; va_stream_file_t va_file_s_ = STREAM_BUF(F, va_file_buf_, sizeof(va_file_buf_)); va_file_s_.autoflush = true; (void)va_xprintf(&va_file_s_, __VA_ARGS__))"
+.LASF645:
+	.string	"____mbstate_t_defined 1"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1011:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF953:
+	.string	"__off_t"
+.LASF615:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF547:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF578:
+	.string	"NULL ((void *)0)"
+.LASF762:
+	.string	"__bool_true_false_are_defined 1"
+.LASF833:
+	.string	"VA_SIGIL '~'"
+.LASF497:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF579:
+	.string	"__need_NULL"
+.LASF1006:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF435:
+	.string	"__USE_POSIX199506 1"
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF721:
+	.string	"VA_PRINT_FILE_H_ "
+.LASF438:
+	.string	"_ATFILE_SOURCE"
+.LASF594:
+	.string	"__SLONG32_TYPE int"
+.LASF689:
+	.string	"__HAVE_FLOAT16 0"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1055:
+	.string	"file_commit"
+.LASF695:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF388:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF784:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF885:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF1019:
+	.string	"va_stream_vtab_t"
+.LASF442:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF723:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF817:
+	.string	"VA_E_NULL 1"
+.LASF544:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF864:
+	.string	"va_fprintf(F,...) va_xfprintf(VA_STREAM_FILE_BUF, F, __VA_ARGS__)"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF617:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF820:
+	.string	"VA_E_TRUNC 4"
+.LASF583:
+	.string	"_BITS_TYPES_H 1"
+.LASF460:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF819:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF428:
+	.string	"_POSIX_SOURCE"
+.LASF873:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF426:
+	.string	"__USE_ISOC95 1"
+.LASF526:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF538:
+	.string	"__stub_revoke "
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF562:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF694:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF880:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF479:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF959:
+	.string	"_IO_read_base"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF877:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF461:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF557:
+	.string	"__need_NULL "
+.LASF389:
+	.string	"_FEATURES_H 1"
+.LASF422:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF984:
+	.string	"_unused2"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1009:
+	.string	"qctxt"
+.LASF520:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF459:
+	.string	"__LEAF , __leaf__"
+.LASF405:
+	.string	"__USE_LARGEFILE"
+.LASF770:
+	.string	"VA_NIX "
+.LASF491:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF890:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF747:
+	.string	"_WCHAR_T_DEFINED "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF700:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF599:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF708:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF766:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF728:
+	.string	"_T_PTRDIFF_ "
+.LASF972:
+	.string	"_old_offset"
+.LASF893:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF409:
+	.string	"__USE_ATFILE"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF900:
+	.string	"VA_MODE_B32 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF993:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF635:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF737:
+	.string	"__need_ptrdiff_t"
+.LASF741:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF395:
+	.string	"__USE_POSIX2"
+.LASF844:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF576:
+	.string	"__need_size_t"
+.LASF915:
+	.string	"VA_QUOTE_k 1"
+.LASF717:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF933:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF565:
+	.string	"_SIZE_T_ "
+.LASF660:
+	.string	"_IOFBF 0"
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF837:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF989:
+	.string	"long long int"
+.LASF821:
+	.string	"VA_E_FORMAT 5"
+.LASF783:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF738:
+	.string	"__wchar_t__ "
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF533:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1007:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1012:
+	.string	"va_quotations"
+.LASF680:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF809:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF980:
+	.string	"_freeres_list"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF514:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF886:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF743:
+	.string	"__WCHAR_T "
+.LASF897:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF928:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF464:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF962:
+	.string	"_IO_write_end"
+.LASF869:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF495:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF513:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1013:
+	.string	"init"
+.LASF455:
+	.string	"__PMT"
+.LASF776:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF686:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF902:
+	.string	"VA_MODE_PTR 3"
+.LASF596:
+	.string	"__S64_TYPE long int"
+.LASF621:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF439:
+	.string	"_ATFILE_SOURCE 1"
+.LASF800:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF590:
+	.string	"__SQUAD_TYPE long int"
+.LASF673:
+	.string	"L_ctermid 9"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF778:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF412:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF530:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF726:
+	.string	"_ANSI_STDDEF_H "
+.LASF664:
+	.string	"EOF (-1)"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF359:
+	.string	"__k8 1"
+.LASF655:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF525:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF963:
+	.string	"_IO_buf_base"
+.LASF971:
+	.string	"_flags2"
+.LASF876:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF474:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF946:
+	.string	"unsigned int"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1037:
+	.string	"fwrite"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF456:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF408:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF758:
+	.string	"_STDBOOL_H "
+.LASF752:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF436:
+	.string	"__USE_XOPEN2K 1"
+.LASF424:
+	.string	"__USE_ISOC11 1"
+.LASF839:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF628:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF982:
+	.string	"__pad5"
+.LASF587:
+	.string	"__U32_TYPE unsigned int"
+.LASF883:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF729:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF486:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1042:
+	.string	"va_file_put"
+.LASF727:
+	.string	"_PTRDIFF_T "
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF490:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF512:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF537:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF996:
+	.string	"has_size"
+.LASF624:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF856:
+	.string	"va_file_buf_size 256"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1001:
+	.string	"va_read_iter"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF601:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF501:
+	.string	"__wur "
+.LASF823:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF1002:
+	.string	"vtab"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF719:
+	.string	"static_assert"
+.LASF912:
+	.string	"VA_STATE_SKIP 4"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF779:
+	.string	"VA_P(X,...) X"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF956:
+	.string	"_flags"
+.LASF760:
+	.string	"true 1"
+.LASF735:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF415:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF639:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF450:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF603:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF853:
+	.string	"va_file16_encode utf16be"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF983:
+	.string	"_mode"
+.LASF610:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF870:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF629:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF518:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF468:
+	.string	"__STRING(x) #x"
+.LASF947:
+	.string	"unsigned char"
+.LASF515:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF699:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF978:
+	.string	"_codecvt"
+.LASF637:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF740:
+	.string	"_WCHAR_T "
+.LASF693:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF711:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF793:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF734:
+	.string	"_GCC_PTRDIFF_T "
+.LASF714:
+	.string	"_ASSERT_H 1"
+.LASF955:
+	.string	"char"
+.LASF463:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF524:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF560:
+	.string	"_SIZE_T "
+.LASF748:
+	.string	"_WCHAR_T_H "
+.LASF661:
+	.string	"_IOLBF 1"
+.LASF910:
+	.string	"VA_STATE_WIDTH 2"
+.LASF851:
+	.string	"va_file_encode utf8"
+.LASF662:
+	.string	"_IONBF 2"
+.LASF647:
+	.string	"____FILE_defined 1"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1020:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF990:
+	.string	"long double"
+.LASF795:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF483:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF612:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1054:
+	.string	"va_file_refill"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF948:
+	.string	"short unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF564:
+	.string	"__SIZE_T "
+.LASF985:
+	.string	"FILE"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF787:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF392:
+	.string	"__USE_ISOC95"
+.LASF786:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF391:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF399:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF977:
+	.string	"_offset"
+.LASF685:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF503:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF825:
+	.string	"va_char_p_format utf8"
+.LASF941:
+	.string	"VA_QCLASS_CALL 2"
+.LASF470:
+	.string	"__BEGIN_DECLS "
+.LASF1047:
+	.string	"va_file_flush"
+.LASF932:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF386:
+	.string	"_STDIO_H 1"
+.LASF498:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF805:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF924:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF1046:
+	.string	"va_file_write"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1023:
+	.string	"size"
+.LASF797:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF899:
+	.string	"VA_MODE_NORM 0"
+.LASF631:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1033:
+	.string	"long long unsigned int"
+.LASF850:
+	.string	"VA_PRINT_FILE_UTF8_H_ "
+.LASF666:
+	.string	"SEEK_CUR 1"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF393:
+	.string	"__USE_ISOCXX11"
+.LASF568:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF659:
+	.string	"__ssize_t_defined "
+.LASF529:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF730:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF916:
+	.string	"VA_QUOTE_q 2"
+.LASF945:
+	.string	"long unsigned int"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF431:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1010:
+	.string	"quote"
+.LASF874:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF803:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF494:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF397:
+	.string	"__USE_POSIX199506"
+.LASF696:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF898:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF981:
+	.string	"_freeres_buf"
+.LASF667:
+	.string	"SEEK_END 2"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF832:
+	.string	"va_char32_p_decode utf32"
+.LASF831:
+	.string	"va_char32_p_format utf32"
+.LASF1004:
+	.string	"va_read_iter_t"
+.LASF440:
+	.string	"__WORDSIZE 64"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF541:
+	.string	"__stub_stty "
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF476:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF848:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF566:
+	.string	"_BSD_SIZE_T_ "
+.LASF936:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF473:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF994:
+	.string	"bulk"
+.LASF1035:
+	.string	"memset"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF830:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF801:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF878:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF691:
+	.string	"__HAVE_FLOAT64 1"
+.LASF586:
+	.string	"__S32_TYPE int"
+.LASF829:
+	.string	"va_char16_p_decode utf16"
+.LASF828:
+	.string	"va_char16_p_format utf16"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF966:
+	.string	"_IO_backup_base"
+.LASF975:
+	.string	"_shortbuf"
+.LASF540:
+	.string	"__stub_sigreturn "
+.LASF543:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF710:
+	.string	"_STRING_H 1"
+.LASF887:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF751:
+	.string	"_GCC_WCHAR_T "
+.LASF894:
+	.string	"VA_SIGN_NORM 0"
+.LASF445:
+	.string	"__USE_ATFILE 1"
+.LASF390:
+	.string	"__USE_ISOC11"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF681:
+	.string	"_BITS_FLOATN_H "
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF744:
+	.string	"_WCHAR_T_ "
+.LASF658:
+	.string	"__off_t_defined "
+.LASF720:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF954:
+	.string	"__off64_t"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF798:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF746:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1017:
+	.string	"put_len"
+.LASF684:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF935:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF535:
+	.string	"__stub_chflags "
+.LASF653:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF757:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF411:
+	.string	"__USE_GNU"
+.LASF794:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF574:
+	.string	"_SIZET_ "
+.LASF630:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF847:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF804:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF921:
+	.string	"VA_QUOTE_QQ 7"
+.LASF1043:
+	.string	"va_file_fill"
+.LASF528:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF995:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF964:
+	.string	"_IO_buf_end"
+.LASF623:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1025:
+	.string	"va_stream_file_t"
+.LASF688:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF506:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF702:
+	.string	"__f32(x) x ##f32"
+.LASF496:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF937:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF471:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF674:
+	.string	"FOPEN_MAX"
+.LASF444:
+	.string	"__USE_MISC 1"
+.LASF838:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF913:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF911:
+	.string	"VA_STATE_PREC 3"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF939:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF950:
+	.string	"short int"
+.LASF454:
+	.string	"_SYS_CDEFS_H 1"
+.LASF763:
+	.string	"_UCHAR_H 1"
+.LASF775:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF420:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF509:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF663:
+	.string	"BUFSIZ 8192"
+.LASF1030:
+	.string	"render_quote"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF791:
+	.string	"VA_REC1() VA_REC1B"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF484:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF521:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF862:
+	.string	"VA_STREAM_FILE32_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF591:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF549:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF974:
+	.string	"_vtable_offset"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF532:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF482:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF997:
+	.string	"chunk_mode"
+.LASF608:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF485:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF592:
+	.string	"__SWORD_TYPE long int"
+.LASF739:
+	.string	"__WCHAR_T__ "
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF999:
+	.string	"_pad"
+.LASF854:
+	.string	"VA_PRINT_FILE_UTF32BE_H_ "
+.LASF493:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF605:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF432:
+	.string	"__USE_POSIX 1"
+.LASF774:
+	.string	"VA_PAR ()"
+.LASF858:
+	.string	"VA_STREAM_FILE16(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF597:
+	.string	"__U64_TYPE unsigned long int"
+.LASF679:
+	.string	"__attr_dealloc_fclose"
+.LASF531:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF753:
+	.string	"__DEFINED_wchar_t "
+.LASF704:
+	.string	"__f32x(x) x ##f32x"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF871:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF761:
+	.string	"false 0"
+.LASF1016:
+	.string	"put_fill"
+.LASF584:
+	.string	"__S16_TYPE short int"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF891:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF792:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF504:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"fwrite_unlocked"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF698:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF749:
+	.string	"___int_wchar_t_h "
+.LASF1036:
+	.string	"memcpy"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF859:
+	.string	"VA_STREAM_FILE32(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF1052:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF626:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF508:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF613:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF958:
+	.string	"_IO_read_end"
+.LASF652:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF780:
+	.string	"VA_F(...) VA_H"
+.LASF421:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF904:
+	.string	"VA_MODE_STAT 5"
+.LASF573:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF771:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF767:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF754:
+	.string	"_BSD_WCHAR_T_"
+.LASF882:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF905:
+	.string	"VA_MODE_X6 6"
+.LASF802:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF931:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF602:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF764:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF970:
+	.string	"_fileno"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF472:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF350:
+	.string	"__amd64 1"
+.LASF429:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF433:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF614:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF527:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1003:
+	.string	"va_read_iter_vtab_t"
+.LASF548:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF979:
+	.string	"_wide_data"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF606:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF843:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF607:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF668:
+	.string	"P_tmpdir \"/tmp\""
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF654:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF930:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF808:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF457:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF377:
+	.string	"unix 1"
+.LASF598:
+	.string	"__STD_TYPE typedef"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1034:
+	.string	"va_quotation_t"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF446:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1048:
+	.string	"va_file_finish"
+.LASF633:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF581:
+	.string	"__need___va_list"
+.LASF961:
+	.string	"_IO_write_ptr"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF769:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF736:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF649:
+	.string	"__struct_FILE_defined 1"
+.LASF477:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF895:
+	.string	"VA_SIGN_SPACE 1"
+.LASF922:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF957:
+	.string	"_IO_read_ptr"
+.LASF907:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF709:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF609:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF725:
+	.string	"_STDDEF_H_ "
+.LASF413:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF816:
+	.string	"VA_E_OK 0"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF406:
+	.string	"__USE_LARGEFILE64"
+.LASF650:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF942:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1008:
+	.string	"prec"
+.LASF372:
+	.string	"__linux 1"
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1022:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF713:
+	.string	"_STRINGS_H 1"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF542:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF822:
+	.string	"VA_E_ARGC 6"
+.LASF638:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF430:
+	.string	"_POSIX_C_SOURCE"
+.LASF796:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF632:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF867:
+	.string	"va_printf(...) va_fprintf(stdout, __VA_ARGS__)"
+.LASF892:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF920:
+	.string	"VA_QUOTE_qq 6"
+.LASF875:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF511:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF671:
+	.string	"TMP_MAX 238328"
+.LASF781:
+	.string	"VA_SUBVA_H(Z,N) Z"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/file.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
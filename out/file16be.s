@@ -0,0 +1,6880 @@
+	.file	"file16be.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/file16be.c"
+	.globl	va_file16_put_be
+	.type	va_file16_put_be, @function
+va_file16_put_be:
+.LVL0:
+.LFB14:
+	.file 1 "src/file16be.c"
+	.loc 1 12 1 view -0
+	.cfi_startproc
+	.loc 1 13 5 view .LVU1
+	.loc 1 14 5 view .LVU2
+	.loc 1 15 5 view .LVU3
+	.loc 1 12 1 is_stmt 0 view .LVU4
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 14 10 view .LVU5
+	rolw	$8, %si
+.LVL1:
+	.loc 1 16 5 view .LVU6
+	movl	$2, %edx
+	.loc 1 14 10 view .LVU7
+	movw	%si, 14(%rsp)
+	.loc 1 16 5 is_stmt 1 view .LVU8
+	leaq	14(%rsp), %rsi
+	call	va_file_write@PLT
+.LVL2:
+	.loc 1 17 1 is_stmt 0 view .LVU9
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	va_file16_put_be, .-va_file16_put_be
+	.globl	va_file16_put_fill_be
+	.type	va_file16_put_fill_be, @function
+va_file16_put_fill_be:
+.LVL3:
+.LFB15:
+	.loc 1 20 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 21 5 view .LVU11
+	.loc 1 20 1 is_stmt 0 view .LVU12
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 20 1 view .LVU13
+	movq	%rdx, %rcx
+	.loc 1 22 5 view .LVU14
+	movl	$2, %edx
+.LVL4:
+	.loc 1 21 31 view .LVU15
+	movb	%sil, 15(%rsp)
+	.loc 1 22 5 is_stmt 1 view .LVU16
+	leaq	14(%rsp), %rsi
+.LVL5:
+	.loc 1 21 19 is_stmt 0 view .LVU17
+	movb	$0, 14(%rsp)
+	.loc 1 22 5 view .LVU18
+	call	va_file_fill@PLT
+.LVL6:
+	.loc 1 23 1 view .LVU19
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	va_file16_put_fill_be, .-va_file16_put_fill_be
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/uchar.h"
+	.file 5 "./include/va_print/base.h"
+	.file 6 "./include/va_print/impl.h"
+	.file 7 "./include/va_print/file.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x6a9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF998
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.long	.LASF950
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3e
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF944
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF945
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF946
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF947
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF948
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF949
+	.uleb128 0xd
+	.long	.LASF951
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x55
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF952
+	.uleb128 0xd
+	.long	.LASF953
+	.byte	0x3
+	.byte	0x37
+	.byte	0x14
+	.long	0x6a
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF954
+	.uleb128 0x7
+	.long	0x90
+	.uleb128 0xb
+	.long	0x90
+	.long	0xac
+	.uleb128 0xc
+	.long	0x3e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF955
+	.uleb128 0x4
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF956
+	.uleb128 0xd
+	.long	.LASF957
+	.byte	0x4
+	.byte	0x33
+	.byte	0x1a
+	.long	0x84
+	.uleb128 0x11
+	.byte	0x38
+	.byte	0x5
+	.byte	0xc1
+	.long	0x15e
+	.uleb128 0x5
+	.long	.LASF958
+	.byte	0x5
+	.byte	0xc4
+	.byte	0x11
+	.long	0x15e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF959
+	.byte	0x5
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1b7
+	.byte	0x8
+	.uleb128 0x10
+	.string	"end"
+	.byte	0x5
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1d0
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF960
+	.byte	0x5
+	.byte	0xdb
+	.byte	0xc
+	.long	0x1e0
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF961
+	.byte	0x5
+	.byte	0xe2
+	.byte	0xe
+	.long	0x20d
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF962
+	.byte	0x5
+	.byte	0xec
+	.byte	0xe
+	.long	0x230
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF963
+	.byte	0x5
+	.byte	0xf1
+	.byte	0x13
+	.long	0x4e
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF964
+	.byte	0x5
+	.byte	0xf5
+	.byte	0x13
+	.long	0x4e
+	.byte	0x31
+	.uleb128 0x5
+	.long	.LASF965
+	.byte	0x5
+	.byte	0xf9
+	.byte	0x13
+	.long	0x4e
+	.byte	0x32
+	.uleb128 0x10
+	.string	"enc"
+	.byte	0x5
+	.byte	0xfd
+	.byte	0x13
+	.long	0x4e
+	.byte	0x33
+	.uleb128 0x5
+	.long	.LASF966
+	.byte	0x5
+	.byte	0xff
+	.byte	0xa
+	.long	0x9c
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.long	0x97
+	.uleb128 0x7
+	.long	0x15e
+	.uleb128 0x8
+	.long	0x45
+	.long	0x17c
+	.uleb128 0x1
+	.long	0x17c
+	.uleb128 0x1
+	.long	0x1b1
+	.byte	0
+	.uleb128 0x2
+	.long	0x181
+	.uleb128 0x12
+	.long	.LASF971
+	.byte	0x10
+	.byte	0x5
+	.value	0x132
+	.byte	0x10
+	.long	0x1ac
+	.uleb128 0x3
+	.long	.LASF967
+	.byte	0x5
+	.value	0x135
+	.byte	0x20
+	.long	0x247
+	.byte	0
+	.uleb128 0x6
+	.string	"cur"
+	.byte	0x5
+	.value	0x138
+	.byte	0x11
+	.long	0x1b1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x181
+	.uleb128 0x2
+	.long	0x1b6
+	.uleb128 0x1a
+	.uleb128 0x2
+	.long	0x168
+	.uleb128 0x8
+	.long	0x1b1
+	.long	0x1d0
+	.uleb128 0x1
+	.long	0x17c
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x1bc
+	.uleb128 0xe
+	.long	0x1e0
+	.uleb128 0x1
+	.long	0x17c
+	.byte	0
+	.uleb128 0x2
+	.long	0x1d5
+	.uleb128 0x8
+	.long	0x32
+	.long	0x203
+	.uleb128 0x1
+	.long	0x203
+	.uleb128 0x1
+	.long	0x1b1
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x208
+	.byte	0
+	.uleb128 0x2
+	.long	0x1ac
+	.uleb128 0x2
+	.long	0x32
+	.uleb128 0x2
+	.long	0x1e5
+	.uleb128 0x8
+	.long	0x32
+	.long	0x230
+	.uleb128 0x1
+	.long	0x4c
+	.uleb128 0x1
+	.long	0x4e
+	.uleb128 0x1
+	.long	0x1b1
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x212
+	.uleb128 0x9
+	.long	.LASF968
+	.byte	0x5
+	.value	0x100
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0x7
+	.long	0x235
+	.uleb128 0x2
+	.long	0x242
+	.uleb128 0x9
+	.long	.LASF969
+	.byte	0x5
+	.value	0x139
+	.byte	0x3
+	.long	0x181
+	.uleb128 0x9
+	.long	.LASF970
+	.byte	0x5
+	.value	0x169
+	.byte	0x1a
+	.long	0x266
+	.uleb128 0x12
+	.long	.LASF972
+	.byte	0x40
+	.byte	0x5
+	.value	0x1b7
+	.byte	0x8
+	.long	0x2e5
+	.uleb128 0x3
+	.long	.LASF967
+	.byte	0x5
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x458
+	.byte	0
+	.uleb128 0x6
+	.string	"pat"
+	.byte	0x5
+	.value	0x1b9
+	.byte	0x14
+	.long	0x24c
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF973
+	.byte	0x5
+	.value	0x1ba
+	.byte	0xe
+	.long	0x45
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF974
+	.byte	0x5
+	.value	0x1bb
+	.byte	0xe
+	.long	0x45
+	.byte	0x1c
+	.uleb128 0x6
+	.string	"opt"
+	.byte	0x5
+	.value	0x1bc
+	.byte	0xe
+	.long	0x45
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF975
+	.byte	0x5
+	.value	0x1bd
+	.byte	0xe
+	.long	0x45
+	.byte	0x24
+	.uleb128 0x6
+	.string	"win"
+	.byte	0x5
+	.value	0x1be
+	.byte	0x11
+	.long	0x44b
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF976
+	.byte	0x5
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x45d
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF977
+	.byte	0x5
+	.value	0x16c
+	.byte	0x1e
+	.long	0x2f7
+	.uleb128 0x7
+	.long	0x2e5
+	.uleb128 0x12
+	.long	.LASF978
+	.byte	0x40
+	.byte	0x6
+	.value	0x14f
+	.byte	0x8
+	.long	0x312
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x6
+	.value	0x150
+	.byte	0x1b
+	.long	0x562
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.byte	0x38
+	.value	0x174
+	.long	0x38b
+	.uleb128 0x3
+	.long	.LASF979
+	.byte	0x5
+	.value	0x176
+	.byte	0xc
+	.long	0x39b
+	.byte	0
+	.uleb128 0x6
+	.string	"put"
+	.byte	0x5
+	.value	0x178
+	.byte	0xc
+	.long	0x3b0
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF980
+	.byte	0x5
+	.value	0x17b
+	.byte	0xc
+	.long	0x39b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF981
+	.byte	0x5
+	.value	0x182
+	.byte	0xb
+	.long	0x3d0
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF982
+	.byte	0x5
+	.value	0x186
+	.byte	0xc
+	.long	0x3ea
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF983
+	.byte	0x5
+	.value	0x18c
+	.byte	0xc
+	.long	0x3ff
+	.byte	0x28
+	.uleb128 0x6
+	.string	"enc"
+	.byte	0x5
+	.value	0x191
+	.byte	0x13
+	.long	0x4e
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF966
+	.byte	0x5
+	.value	0x192
+	.byte	0xa
+	.long	0x404
+	.byte	0x31
+	.byte	0
+	.uleb128 0xe
+	.long	0x396
+	.uleb128 0x1
+	.long	0x396
+	.byte	0
+	.uleb128 0x2
+	.long	0x259
+	.uleb128 0x2
+	.long	0x38b
+	.uleb128 0xe
+	.long	0x3b0
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x45
+	.byte	0
+	.uleb128 0x2
+	.long	0x3a0
+	.uleb128 0x8
+	.long	0x3c9
+	.long	0x3c9
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF984
+	.uleb128 0x2
+	.long	0x3b5
+	.uleb128 0xe
+	.long	0x3ea
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x45
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x3d5
+	.uleb128 0xe
+	.long	0x3ff
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x3ef
+	.uleb128 0xb
+	.long	0x90
+	.long	0x414
+	.uleb128 0xc
+	.long	0x3e
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF985
+	.byte	0x5
+	.value	0x193
+	.byte	0x3
+	.long	0x312
+	.uleb128 0x7
+	.long	0x414
+	.uleb128 0x13
+	.byte	0x10
+	.value	0x19a
+	.long	0x44b
+	.uleb128 0x6
+	.string	"cur"
+	.byte	0x5
+	.value	0x19b
+	.byte	0xb
+	.long	0x4c
+	.byte	0
+	.uleb128 0x6
+	.string	"end"
+	.byte	0x5
+	.value	0x19c
+	.byte	0xb
+	.long	0x4c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF986
+	.byte	0x5
+	.value	0x19d
+	.byte	0x3
+	.long	0x426
+	.uleb128 0x2
+	.long	0x421
+	.uleb128 0x2
+	.long	0x2f2
+	.uleb128 0x11
+	.byte	0x88
+	.byte	0x6
+	.byte	0xc9
+	.long	0x485
+	.uleb128 0x10
+	.string	"cls"
+	.byte	0x6
+	.byte	0xce
+	.byte	0x13
+	.long	0x485
+	.byte	0
+	.uleb128 0x10
+	.string	"esc"
+	.byte	0x6
+	.byte	0xd5
+	.byte	0x18
+	.long	0x495
+	.byte	0x80
+	.byte	0
+	.uleb128 0xb
+	.long	0x4e
+	.long	0x495
+	.uleb128 0xc
+	.long	0x3e
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2
+	.long	0x163
+	.uleb128 0xd
+	.long	.LASF987
+	.byte	0x6
+	.byte	0xd6
+	.byte	0x3
+	.long	0x462
+	.uleb128 0x7
+	.long	0x49a
+	.uleb128 0x11
+	.byte	0x38
+	.byte	0x6
+	.byte	0xe0
+	.long	0x507
+	.uleb128 0x5
+	.long	.LASF988
+	.byte	0x6
+	.byte	0xef
+	.byte	0x18
+	.long	0x507
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF989
+	.byte	0x6
+	.value	0x101
+	.byte	0xb
+	.long	0x532
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF990
+	.byte	0x6
+	.value	0x10e
+	.byte	0xb
+	.long	0x546
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF991
+	.byte	0x6
+	.value	0x12a
+	.byte	0xc
+	.long	0x3b0
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF992
+	.byte	0x6
+	.value	0x131
+	.byte	0xc
+	.long	0x39b
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF993
+	.byte	0x6
+	.value	0x141
+	.byte	0x21
+	.long	0x54b
+	.byte	0x30
+	.byte	0
+	.uleb128 0xb
+	.long	0x517
+	.long	0x517
+	.uleb128 0xc
+	.long	0x3e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF994
+	.uleb128 0x8
+	.long	0x3c9
+	.long	0x532
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x45
+	.byte	0
+	.uleb128 0x2
+	.long	0x51e
+	.uleb128 0x8
+	.long	0x3c9
+	.long	0x546
+	.uleb128 0x1
+	.long	0x396
+	.byte	0
+	.uleb128 0x2
+	.long	0x537
+	.uleb128 0x2
+	.long	0x4a6
+	.uleb128 0x9
+	.long	.LASF995
+	.byte	0x6
+	.value	0x142
+	.byte	0x3
+	.long	0x4ab
+	.uleb128 0x7
+	.long	0x550
+	.uleb128 0xb
+	.long	0x572
+	.long	0x572
+	.uleb128 0xc
+	.long	0x3e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2
+	.long	0x55d
+	.uleb128 0x14
+	.long	.LASF996
+	.byte	0xd0
+	.long	0x596
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x1b1
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF997
+	.byte	0xca
+	.long	0x5b0
+	.uleb128 0x1
+	.long	0x396
+	.uleb128 0x1
+	.long	0x1b1
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF999
+	.byte	0x1
+	.byte	0x13
+	.byte	0xd
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x634
+	.uleb128 0xf
+	.string	"s"
+	.byte	0x13
+	.byte	0x30
+	.long	0x396
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xf
+	.string	"c"
+	.byte	0x13
+	.byte	0x3c
+	.long	0x45
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xf
+	.string	"n"
+	.byte	0x13
+	.byte	0x46
+	.long	0x32
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x15
+	.string	"x"
+	.byte	0x15
+	.long	0x634
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -18
+	.uleb128 0x16
+	.quad	.LVL6
+	.long	0x577
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -18
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x4e
+	.long	0x644
+	.uleb128 0xc
+	.long	0x3e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1000
+	.byte	0x1
+	.byte	0xb
+	.byte	0xd
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xf
+	.string	"s"
+	.byte	0xb
+	.byte	0x2b
+	.long	0x396
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xf
+	.string	"c"
+	.byte	0xb
+	.byte	0x37
+	.long	0xba
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x15
+	.string	"x"
+	.byte	0xd
+	.long	0x634
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -18
+	.uleb128 0x16
+	.quad	.LVL2
+	.long	0x596
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -18
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU17
+	.uleb128 .LVU17
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU15
+	.uleb128 .LVU15
+	.uleb128 .LVU19
+	.uleb128 .LVU19
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LFE15-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL2-1-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU6
+	.uleb128 .LVU6
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/include/assert.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF386
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF546
+	.file 18 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF588
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF591
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF651
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF652
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF653
+	.byte	0x4
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF654
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF655
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF656
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF696
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF718
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF719
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF760
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 35 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF820
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 36 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF823
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 37 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF826
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 38 "./include/va_print/file_utf8.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF846
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF847
+	.file 39 "./include/va_print/file_utf16be.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF848
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF849
+	.file 40 "./include/va_print/file_utf32be.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF850
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF865
+	.file 41 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF867
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF868
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF437
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF451
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF452
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF513
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF531
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF539
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.40.d34159d34f444de373121677553af6a7,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF545
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF548
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF563
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF565
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF584
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF586
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF587
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF590
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF606
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF648
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF650
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF664
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF676
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF681
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF683
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF686
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF688
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF717
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF733
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF749
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF751
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF586
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF753
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF758
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF564
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF733
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF584
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF751
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF586
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF752
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF819
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF822
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF825
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF845
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.file.h.35.97e601440fdd2d29879dd346f15f7c01,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF864
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF548
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF565
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF564
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.27.cd1557bd11ee28e696cbad9e723079c4,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF943
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF668:
+	.string	"_IOFBF 0"
+.LASF439:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF691:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF950:
+	.string	"size_t"
+.LASF879:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF684:
+	.string	"stdin stdin"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF711:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF764:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF906:
+	.string	"VA_MODE_X7 7"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF778:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF538:
+	.string	"__stub_sigreturn "
+.LASF402:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF673:
+	.string	"SEEK_SET 0"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF501:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF809:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF814:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF927:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF414:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF476:
+	.string	"__flexarr []"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF881:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF823:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF841:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF447:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF925:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF486:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF918:
+	.string	"VA_QUOTE_K 4"
+.LASF896:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF987:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF842:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF999:
+	.string	"va_file16_put_fill_be"
+.LASF807:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF752:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF872:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF822:
+	.string	"va_char_p_decode utf8"
+.LASF795:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF806:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF490:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1000:
+	.string	"va_file16_put_be"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF651:
+	.string	"__STD_TYPE"
+.LASF541:
+	.string	"_ASSERT_H_DECLS "
+.LASF669:
+	.string	"_IOLBF 1"
+.LASF463:
+	.string	"__P(args) args"
+.LASF838:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF567:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF802:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF588:
+	.string	"__need___va_list "
+.LASF940:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF619:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF810:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF751:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF959:
+	.string	"take"
+.LASF713:
+	.string	"__f64x(x) x ##f64x"
+.LASF958:
+	.string	"type"
+.LASF934:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF923:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF690:
+	.string	"__HAVE_FLOAT128 1"
+.LASF728:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF698:
+	.string	"__HAVE_FLOAT32 1"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF408:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF583:
+	.string	"__size_t "
+.LASF936:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF645:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF965:
+	.string	"str_prefix"
+.LASF603:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF888:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF451:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF478:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF571:
+	.string	"_T_SIZE "
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF980:
+	.string	"finish"
+.LASF768:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF943:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF405:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF766:
+	.string	"VA_NIX "
+.LASF851:
+	.string	"va_file32_encode utf32be"
+.LASF392:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF769:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF718:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF585:
+	.string	"NULL"
+.LASF649:
+	.string	"_BITS_TIME64_H 1"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF998:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF861:
+	.string	"va_ufprintf(F,...) va_xfprintf(VA_STREAM_FILE16_BUF, F, __VA_ARGS__)"
+.LASF820:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF909:
+	.string	"VA_STATE_ARG 1"
+.LASF990:
+	.string	"check_flush"
+.LASF534:
+	.string	"__stub_fchflags "
+.LASF781:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF720:
+	.string	"_STDDEF_H "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF628:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF803:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF416:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF396:
+	.string	"__USE_XOPEN"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF401:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF500:
+	.string	"__always_inline"
+.LASF569:
+	.string	"_SYS_SIZE_T_H "
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF412:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF864:
+	.string	"va_eprintf(...) va_fprintf(stderr, __VA_ARGS__)"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF449:
+	.string	"__GLIBC__ 2"
+.LASF705:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF952:
+	.string	"long int"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF417:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF435:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF727:
+	.string	"_PTRDIFF_T_ "
+.LASF413:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF652:
+	.string	"_____fpos_t_defined 1"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF992:
+	.string	"render_flush"
+.LASF919:
+	.string	"VA_QUOTE_kk 5"
+.LASF543:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF811:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF648:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF929:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF633:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF683:
+	.string	"FOPEN_MAX 16"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF627:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF926:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF626:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF497:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF578:
+	.string	"_SIZE_T_DECLARED "
+.LASF465:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF674:
+	.string	"SEEK_CUR 1"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF709:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF548:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF970:
+	.string	"va_stream_t"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF479:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF862:
+	.string	"va_Ufprintf(F,...) va_xfprintf(VA_STREAM_FILE32_BUF, F, __VA_ARGS__)"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF456:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF460:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF948:
+	.string	"signed char"
+.LASF566:
+	.string	"__size_t__ "
+.LASF593:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF467:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF808:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF608:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF514:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF457:
+	.string	"__LEAF , __leaf__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF624:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF953:
+	.string	"__uint_least16_t"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF577:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF845:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF580:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF423:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF464:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF957:
+	.string	"char16_t"
+.LASF579:
+	.string	"__DEFINED_size_t "
+.LASF853:
+	.string	"VA_STREAM_FILE(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF837:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF917:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF984:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF508:
+	.string	"__restrict_arr __restrict"
+.LASF532:
+	.string	"__stub___compat_bdflush "
+.LASF575:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF993:
+	.string	"table"
+.LASF832:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF868:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF914:
+	.string	"VA_QUOTE_NONE 0"
+.LASF635:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF445:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF487:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF695:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF938:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF564:
+	.string	"__need_size_t "
+.LASF596:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF411:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF505:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF425:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF951:
+	.string	"__uint16_t"
+.LASF399:
+	.string	"__USE_XOPEN2K"
+.LASF473:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF650:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF400:
+	.string	"__USE_XOPEN2KXSI"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF503:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF884:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF432:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF849:
+	.string	"va_file16_encode utf16be"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF394:
+	.string	"__USE_POSIX199309"
+.LASF700:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF715:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF714:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF686:
+	.string	"stderr stderr"
+.LASF656:
+	.string	"__FILE_defined 1"
+.LASF729:
+	.string	"___int_ptrdiff_t_h "
+.LASF659:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF450:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF398:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF415:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF761:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF540:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF784:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF612:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF664:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF746:
+	.string	"__INT_WCHAR_T_H "
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF597:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF642:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF785:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF665:
+	.string	"_VA_LIST_DEFINED "
+.LASF507:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF680:
+	.string	"FILENAME_MAX 4096"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF537:
+	.string	"__stub_setlogin "
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF644:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF634:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF590:
+	.string	"__GNUC_VA_LIST "
+.LASF908:
+	.string	"VA_STATE_INIT 0"
+.LASF738:
+	.string	"_T_WCHAR "
+.LASF755:
+	.string	"bool _Bool"
+.LASF981:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF741:
+	.string	"_BSD_WCHAR_T_ "
+.LASF988:
+	.string	"delim"
+.LASF786:
+	.string	"VA_REC0() VA_REC0B"
+.LASF830:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF526:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF485:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF678:
+	.string	"L_tmpnam 20"
+.LASF859:
+	.string	"va_xfprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_file_buf_[va_file_buf_size]; va_stream_file_t va_file_s_ = STREAM_BUF(F, va_file_buf_, sizeof(va_file_buf_)); va_file_s_.autoflush = true; (void)va_xprintf(&va_file_s_, __VA_ARGS__))"
+.LASF653:
+	.string	"____mbstate_t_defined 1"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF977:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF886:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF586:
+	.string	"NULL ((void *)0)"
+.LASF829:
+	.string	"VA_SIGIL '~'"
+.LASF495:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF587:
+	.string	"__need_NULL"
+.LASF972:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF433:
+	.string	"__USE_POSIX199506 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF546:
+	.string	"VA_PRINT_FILE_H_ "
+.LASF436:
+	.string	"_ATFILE_SOURCE"
+.LASF602:
+	.string	"__SLONG32_TYPE int"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF623:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF703:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF549:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF780:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF885:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF985:
+	.string	"va_stream_vtab_t"
+.LASF440:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF719:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF813:
+	.string	"VA_E_NULL 1"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF860:
+	.string	"va_fprintf(F,...) va_xfprintf(VA_STREAM_FILE_BUF, F, __VA_ARGS__)"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF605:
+	.string	"__U64_TYPE unsigned long int"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF625:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF816:
+	.string	"VA_E_TRUNC 4"
+.LASF591:
+	.string	"_BITS_TYPES_H 1"
+.LASF458:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF815:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF426:
+	.string	"_POSIX_SOURCE"
+.LASF873:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF424:
+	.string	"__USE_ISOC95 1"
+.LASF524:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF570:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF702:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF880:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF477:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF877:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF459:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF565:
+	.string	"__need_NULL "
+.LASF387:
+	.string	"_FEATURES_H 1"
+.LASF420:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF975:
+	.string	"qctxt"
+.LASF518:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF515:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF403:
+	.string	"__USE_LARGEFILE"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF489:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF890:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF708:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF607:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF716:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF762:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF724:
+	.string	"_T_PTRDIFF_ "
+.LASF874:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF893:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF407:
+	.string	"__USE_ATFILE"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF900:
+	.string	"VA_MODE_B32 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF960:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF643:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF737:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF517:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF393:
+	.string	"__USE_POSIX2"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF840:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF584:
+	.string	"__need_size_t"
+.LASF915:
+	.string	"VA_QUOTE_k 1"
+.LASF542:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF933:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF573:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF833:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF955:
+	.string	"long long int"
+.LASF817:
+	.string	"VA_E_FORMAT 5"
+.LASF779:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF734:
+	.string	"__wchar_t__ "
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF531:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF973:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF978:
+	.string	"va_quotations"
+.LASF688:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF805:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF512:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF889:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF739:
+	.string	"__WCHAR_T "
+.LASF897:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF928:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF462:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF865:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF493:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF511:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF979:
+	.string	"init"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF453:
+	.string	"__PMT"
+.LASF772:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF694:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF902:
+	.string	"VA_MODE_PTR 3"
+.LASF629:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF963:
+	.string	"has_size"
+.LASF796:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF598:
+	.string	"__SQUAD_TYPE long int"
+.LASF681:
+	.string	"L_ctermid 9"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF774:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF410:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF528:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF722:
+	.string	"_ANSI_STDDEF_H "
+.LASF672:
+	.string	"EOF (-1)"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF359:
+	.string	"__k8 1"
+.LASF663:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF523:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF876:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF472:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF945:
+	.string	"unsigned int"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF836:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF454:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF406:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF754:
+	.string	"_STDBOOL_H "
+.LASF748:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF434:
+	.string	"__USE_XOPEN2K 1"
+.LASF422:
+	.string	"__USE_ISOC11 1"
+.LASF835:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF636:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF595:
+	.string	"__U32_TYPE unsigned int"
+.LASF883:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF725:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF484:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF723:
+	.string	"_PTRDIFF_T "
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF488:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF510:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF535:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF632:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF852:
+	.string	"va_file_buf_size 256"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF971:
+	.string	"va_read_iter"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF609:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF499:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF967:
+	.string	"vtab"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF544:
+	.string	"static_assert"
+.LASF912:
+	.string	"VA_STATE_SKIP 4"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF775:
+	.string	"VA_P(X,...) X"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF756:
+	.string	"true 1"
+.LASF731:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF601:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF647:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF448:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF611:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF903:
+	.string	"VA_MODE_TYPE 4"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF618:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF870:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF637:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF516:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF466:
+	.string	"__STRING(x) #x"
+.LASF946:
+	.string	"unsigned char"
+.LASF513:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF707:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF736:
+	.string	"_WCHAR_T "
+.LASF701:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF867:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF789:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF730:
+	.string	"_GCC_PTRDIFF_T "
+.LASF536:
+	.string	"__stub_revoke "
+.LASF520:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF954:
+	.string	"char"
+.LASF461:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF522:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF568:
+	.string	"_SIZE_T "
+.LASF744:
+	.string	"_WCHAR_T_H "
+.LASF910:
+	.string	"VA_STATE_WIDTH 2"
+.LASF847:
+	.string	"va_file_encode utf8"
+.LASF655:
+	.string	"____FILE_defined 1"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF986:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF956:
+	.string	"long double"
+.LASF791:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF481:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF620:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF947:
+	.string	"short unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF572:
+	.string	"__SIZE_T "
+.LASF441:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF783:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF640:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF390:
+	.string	"__USE_ISOC95"
+.LASF782:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF389:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF397:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF866:
+	.string	"_STRING_H 1"
+.LASF856:
+	.string	"VA_STREAM_FILE_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF821:
+	.string	"va_char_p_format utf8"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF941:
+	.string	"VA_QCLASS_CALL 2"
+.LASF468:
+	.string	"__BEGIN_DECLS "
+.LASF777:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF747:
+	.string	"_GCC_WCHAR_T "
+.LASF932:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF547:
+	.string	"_STDIO_H 1"
+.LASF496:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF801:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF924:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF997:
+	.string	"va_file_write"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF907:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF793:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF899:
+	.string	"VA_MODE_NORM 0"
+.LASF639:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF994:
+	.string	"long long unsigned int"
+.LASF846:
+	.string	"VA_PRINT_FILE_UTF8_H_ "
+.LASF706:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF391:
+	.string	"__USE_ISOCXX11"
+.LASF576:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF667:
+	.string	"__ssize_t_defined "
+.LASF527:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF726:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF916:
+	.string	"VA_QUOTE_q 2"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF429:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF976:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF799:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF492:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF395:
+	.string	"__USE_POSIX199506"
+.LASF819:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF704:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF898:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF675:
+	.string	"SEEK_END 2"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF828:
+	.string	"va_char32_p_decode utf32"
+.LASF827:
+	.string	"va_char32_p_format utf32"
+.LASF969:
+	.string	"va_read_iter_t"
+.LASF438:
+	.string	"__WORDSIZE 64"
+.LASF831:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF743:
+	.string	"_WCHAR_T_DEFINED "
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF539:
+	.string	"__stub_stty "
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF474:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF857:
+	.string	"VA_STREAM_FILE16_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF844:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF604:
+	.string	"__S64_TYPE long int"
+.LASF574:
+	.string	"_BSD_SIZE_T_ "
+.LASF471:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF961:
+	.string	"bulk"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF826:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF797:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF878:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF699:
+	.string	"__HAVE_FLOAT64 1"
+.LASF594:
+	.string	"__S32_TYPE int"
+.LASF825:
+	.string	"va_char16_p_decode utf16"
+.LASF824:
+	.string	"va_char16_p_format utf16"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF848:
+	.string	"VA_PRINT_FILE_UTF16BE_H_ "
+.LASF887:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF894:
+	.string	"VA_SIGN_NORM 0"
+.LASF443:
+	.string	"__USE_ATFILE 1"
+.LASF388:
+	.string	"__USE_ISOC11"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF689:
+	.string	"_BITS_FLOATN_H "
+.LASF670:
+	.string	"_IONBF 2"
+.LASF740:
+	.string	"_WCHAR_T_ "
+.LASF666:
+	.string	"__off_t_defined "
+.LASF875:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF545:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF794:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF742:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF983:
+	.string	"put_len"
+.LASF692:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF935:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF533:
+	.string	"__stub_chflags "
+.LASF661:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF753:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF409:
+	.string	"__USE_GNU"
+.LASF790:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF582:
+	.string	"_SIZET_ "
+.LASF638:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF843:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF800:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF921:
+	.string	"VA_QUOTE_QQ 7"
+.LASF996:
+	.string	"va_file_fill"
+.LASF386:
+	.string	"_ASSERT_H 1"
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF962:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF989:
+	.string	"check_quote"
+.LASF631:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF521:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF696:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF504:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF710:
+	.string	"__f32(x) x ##f32"
+.LASF494:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF937:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF469:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF682:
+	.string	"FOPEN_MAX"
+.LASF442:
+	.string	"__USE_MISC 1"
+.LASF834:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF654:
+	.string	"_____fpos64_t_defined 1"
+.LASF913:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF911:
+	.string	"VA_STATE_PREC 3"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF949:
+	.string	"short int"
+.LASF452:
+	.string	"_SYS_CDEFS_H 1"
+.LASF759:
+	.string	"_UCHAR_H 1"
+.LASF771:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF418:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF671:
+	.string	"BUFSIZ 8192"
+.LASF991:
+	.string	"render_quote"
+.LASF787:
+	.string	"VA_REC1() VA_REC1B"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF482:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF519:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF858:
+	.string	"VA_STREAM_FILE32_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF599:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF733:
+	.string	"__need_ptrdiff_t"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF530:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF480:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF964:
+	.string	"chunk_mode"
+.LASF616:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF483:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF600:
+	.string	"__SWORD_TYPE long int"
+.LASF735:
+	.string	"__WCHAR_T__ "
+.LASF685:
+	.string	"stdout stdout"
+.LASF966:
+	.string	"_pad"
+.LASF850:
+	.string	"VA_PRINT_FILE_UTF32BE_H_ "
+.LASF491:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF613:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF430:
+	.string	"__USE_POSIX 1"
+.LASF770:
+	.string	"VA_PAR ()"
+.LASF854:
+	.string	"VA_STREAM_FILE16(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF687:
+	.string	"__attr_dealloc_fclose"
+.LASF529:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF749:
+	.string	"__DEFINED_wchar_t "
+.LASF712:
+	.string	"__f32x(x) x ##f32x"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF871:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF757:
+	.string	"false 0"
+.LASF982:
+	.string	"put_fill"
+.LASF592:
+	.string	"__S16_TYPE short int"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF891:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF788:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF498:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF502:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF901:
+	.string	"VA_MODE_CHAR 2"
+.LASF745:
+	.string	"___int_wchar_t_h "
+.LASF939:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF855:
+	.string	"VA_STREAM_FILE32(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF677:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF630:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF506:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF621:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF697:
+	.string	"__HAVE_FLOAT16 0"
+.LASF660:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF776:
+	.string	"VA_F(...) VA_H"
+.LASF419:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF904:
+	.string	"VA_MODE_STAT 5"
+.LASF581:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF767:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF763:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF750:
+	.string	"_BSD_WCHAR_T_"
+.LASF882:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF905:
+	.string	"VA_MODE_X6 6"
+.LASF798:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF931:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF610:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF760:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF773:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF470:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF350:
+	.string	"__amd64 1"
+.LASF427:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF431:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF622:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF525:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF968:
+	.string	"va_read_iter_vtab_t"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF614:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF839:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF615:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF676:
+	.string	"P_tmpdir \"/tmp\""
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF662:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF930:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF804:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF455:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF377:
+	.string	"unix 1"
+.LASF606:
+	.string	"__STD_TYPE typedef"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF995:
+	.string	"va_quotation_t"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF444:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF758:
+	.string	"__bool_true_false_are_defined 1"
+.LASF641:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF589:
+	.string	"__need___va_list"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF765:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF732:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF657:
+	.string	"__struct_FILE_defined 1"
+.LASF475:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF895:
+	.string	"VA_SIGN_SPACE 1"
+.LASF922:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF717:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF617:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"_STDDEF_H_ "
+.LASF437:
+	.string	"_ATFILE_SOURCE 1"
+.LASF812:
+	.string	"VA_E_OK 0"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF404:
+	.string	"__USE_LARGEFILE64"
+.LASF658:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF942:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF693:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF974:
+	.string	"prec"
+.LASF372:
+	.string	"__linux 1"
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF869:
+	.string	"_STRINGS_H 1"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF818:
+	.string	"VA_E_ARGC 6"
+.LASF646:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF428:
+	.string	"_POSIX_C_SOURCE"
+.LASF792:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF863:
+	.string	"va_printf(...) va_fprintf(stdout, __VA_ARGS__)"
+.LASF892:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF920:
+	.string	"VA_QUOTE_qq 6"
+.LASF944:
+	.string	"long unsigned int"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF509:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF679:
+	.string	"TMP_MAX 238328"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/file16be.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,13147 @@
+	.file	"rope.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/rope.c"
+	.type	commit, @function
+commit:
+.LVL0:
+.LFB21:
+	.file 1 "src/rope.c"
+	.loc 1 40 1 view -0
+	.cfi_startproc
+	.loc 1 41 5 view .LVU1
+	.loc 1 41 17 is_stmt 0 view .LVU2
+	movq	40(%rdi), %rax
+	.loc 1 41 8 view .LVU3
+	testq	%rax, %rax
+	je	.L1
+.LBB30:
+	.loc 1 42 9 is_stmt 1 view .LVU4
+	.loc 1 42 56 is_stmt 0 view .LVU5
+	movq	72(%rdi), %rdx
+.LVL1:
+.LBB31:
+.LBI31:
+	.loc 1 31 14 is_stmt 1 view .LVU6
+.LBB32:
+	.loc 1 33 5 view .LVU7
+	.loc 1 33 21 is_stmt 0 view .LVU8
+	leaq	24(%rdx), %rcx
+.LBE32:
+.LBE31:
+	.loc 1 42 54 view .LVU9
+	subq	%rcx, %rax
+	movq	%rax, 16(%rdx)
+	.loc 1 43 9 is_stmt 1 view .LVU10
+	.loc 1 43 18 is_stmt 0 view .LVU11
+	xorl	%eax, %eax
+	movq	%rax, 40(%rdi)
+	movq	%rax, 48(%rdi)
+.L1:
+.LBE30:
+	.loc 1 45 1 view .LVU12
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	commit, .-commit
+	.type	make_room, @function
+make_room:
+.LVL2:
+.LFB22:
+	.loc 1 53 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 54 5 view .LVU14
+	.loc 1 53 1 is_stmt 0 view .LVU15
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%r8
+	.cfi_def_cfa_offset 32
+	.loc 1 54 22 view .LVU16
+	movq	72(%rdi), %rdx
+.LVL3:
+	.loc 1 55 5 is_stmt 1 view .LVU17
+	.loc 1 55 8 is_stmt 0 view .LVU18
+	testq	%rdx, %rdx
+	je	.L8
+	.loc 1 55 33 discriminator 1 view .LVU19
+	movq	8(%rdx), %rax
+	subq	16(%rdx), %rax
+	.loc 1 55 20 discriminator 1 view .LVU20
+	cmpq	%rsi, %rax
+	jnb	.L9
+.L8:
+	.loc 1 59 5 is_stmt 1 view .LVU21
+	.loc 1 59 12 is_stmt 0 view .LVU22
+	movq	80(%rbx), %rax
+	cmpq	%rax, %rsi
+	cmovnb	%rsi, %rax
+	movq	%rax, %rbp
+.LVL4:
+	.loc 1 60 5 is_stmt 1 view .LVU23
+	.loc 1 61 5 view .LVU24
+	.loc 1 61 8 is_stmt 0 view .LVU25
+	cmpq	$-25, %rax
+	jbe	.L10
+.LVL5:
+.L13:
+	.loc 1 65 9 is_stmt 1 view .LVU26
+.LBB33:
+.LBI33:
+	.file 2 "./include/va_print/impl.h"
+	.loc 2 441 20 view .LVU27
+.LBB34:
+	.loc 2 443 5 view .LVU28
+.LBB35:
+.LBI35:
+	.loc 2 425 20 view .LVU29
+.LBB36:
+	.loc 2 427 5 view .LVU30
+	.loc 2 427 13 is_stmt 0 view .LVU31
+	movl	32(%rbx), %eax
+	.loc 2 427 8 view .LVU32
+	testl	$939524096, %eax
+	jne	.L12
+	.loc 2 428 9 is_stmt 1 view .LVU33
+.LBB37:
+	.loc 2 428 25 view .LVU34
+.LVL6:
+	.loc 2 428 62 view .LVU35
+	.loc 2 428 101 is_stmt 0 view .LVU36
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU37
+	orl	$536870912, %eax
+	movl	%eax, 32(%rbx)
+	jmp	.L12
+.LVL7:
+.L10:
+	.loc 2 428 123 view .LVU38
+.LBE37:
+.LBE36:
+.LBE35:
+.LBE34:
+.LBE33:
+	.loc 1 62 9 is_stmt 1 view .LVU39
+	.loc 1 62 13 is_stmt 0 view .LVU40
+	xorl	%edi, %edi
+	leaq	24(%rax), %rsi
+.LVL8:
+	.loc 1 62 13 view .LVU41
+	movl	$1, %edx
+	call	*88(%rbx)
+.LVL9:
+	.loc 1 64 5 is_stmt 1 view .LVU42
+	.loc 1 64 8 is_stmt 0 view .LVU43
+	testq	%rax, %rax
+	jne	.L24
+	jmp	.L13
+.LVL10:
+.L12:
+.LBB39:
+.LBB38:
+	.loc 2 444 5 is_stmt 1 view .LVU44
+	.loc 2 444 12 is_stmt 0 view .LVU45
+	orl	$32, 32(%rbx)
+.LVL11:
+	.loc 2 444 12 view .LVU46
+.LBE38:
+.LBE39:
+	.loc 1 66 9 is_stmt 1 view .LVU47
+	.loc 1 66 15 is_stmt 0 view .LVU48
+	xorl	%eax, %eax
+	jmp	.L7
+.LVL12:
+.L24:
+	.loc 1 68 5 is_stmt 1 view .LVU49
+	.loc 1 68 13 is_stmt 0 view .LVU50
+	xorl	%ecx, %ecx
+	.loc 1 70 13 view .LVU51
+	xorl	%esi, %esi
+	.loc 1 69 13 view .LVU52
+	movq	%rbp, 8(%rax)
+	.loc 1 68 13 view .LVU53
+	movq	%rcx, (%rax)
+	.loc 1 69 5 is_stmt 1 view .LVU54
+	.loc 1 70 5 view .LVU55
+	.loc 1 70 13 is_stmt 0 view .LVU56
+	movq	%rsi, 16(%rax)
+	.loc 1 71 5 is_stmt 1 view .LVU57
+	.loc 1 71 10 is_stmt 0 view .LVU58
+	movq	72(%rbx), %rdx
+	.loc 1 71 8 view .LVU59
+	testq	%rdx, %rdx
+	je	.L16
+	.loc 1 72 9 is_stmt 1 view .LVU60
+	.loc 1 72 23 is_stmt 0 view .LVU61
+	movq	%rax, (%rdx)
+	jmp	.L17
+.L16:
+	.loc 1 75 9 is_stmt 1 view .LVU62
+	.loc 1 75 18 is_stmt 0 view .LVU63
+	movq	%rax, 64(%rbx)
+.L17:
+	.loc 1 77 5 is_stmt 1 view .LVU64
+	.loc 1 77 13 is_stmt 0 view .LVU65
+	movq	%rax, 72(%rbx)
+	.loc 1 78 5 is_stmt 1 view .LVU66
+.LVL13:
+.L9:
+	.loc 1 56 15 is_stmt 0 view .LVU67
+	movb	$1, %al
+.L7:
+	.loc 1 79 1 view .LVU68
+	popq	%rdx
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL14:
+	.loc 1 79 1 view .LVU69
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	make_room, .-make_room
+	.type	free_chunks, @function
+free_chunks:
+.LVL15:
+.LFB23:
+	.loc 1 85 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 85 1 is_stmt 0 view .LVU71
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	movq	%rsi, %rdi
+.LVL16:
+	.loc 1 86 5 is_stmt 1 view .LVU72
+	.loc 1 85 1 is_stmt 0 view .LVU73
+	pushq	%rdx
+	.cfi_def_cfa_offset 32
+.LVL17:
+.L27:
+	.loc 1 86 14 is_stmt 1 view .LVU74
+	testq	%rdi, %rdi
+	je	.L30
+.LBB40:
+	.loc 1 87 9 view .LVU75
+	.loc 1 87 26 is_stmt 0 view .LVU76
+	movq	(%rdi), %rbp
+.LVL18:
+	.loc 1 88 9 is_stmt 1 view .LVU77
+	.loc 1 88 15 is_stmt 0 view .LVU78
+	movl	$1, %edx
+	xorl	%esi, %esi
+	call	*88(%rbx)
+.LVL19:
+	.loc 1 89 9 is_stmt 1 view .LVU79
+	.loc 1 89 11 is_stmt 0 view .LVU80
+	movq	%rbp, %rdi
+	jmp	.L27
+.LVL20:
+.L30:
+	.loc 1 89 11 view .LVU81
+.LBE40:
+	.loc 1 91 1 view .LVU82
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL21:
+	.loc 1 91 1 view .LVU83
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	free_chunks, .-free_chunks
+	.globl	va_rope_finish
+	.type	va_rope_finish, @function
+va_rope_finish:
+.LVL22:
+.LFB24:
+	.loc 1 98 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 99 5 view .LVU85
+	jmp	commit
+.LVL23:
+	.cfi_endproc
+.LFE24:
+	.size	va_rope_finish, .-va_rope_finish
+	.globl	va_rope_refill
+	.type	va_rope_refill, @function
+va_rope_refill:
+.LVL24:
+.LFB25:
+	.loc 1 105 1 view -0
+	.cfi_startproc
+	.loc 1 106 5 view .LVU87
+	.loc 1 105 1 is_stmt 0 view .LVU88
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 105 1 view .LVU89
+	movq	%rdi, %rbx
+.LVL25:
+	.loc 1 107 5 is_stmt 1 view .LVU90
+	call	commit
+.LVL26:
+	.loc 1 108 5 view .LVU91
+	.loc 1 108 10 is_stmt 0 view .LVU92
+	call	make_room
+.LVL27:
+	.loc 1 108 8 view .LVU93
+	testb	%al, %al
+	je	.L32
+	.loc 1 111 5 is_stmt 1 view .LVU94
+	.loc 1 111 22 is_stmt 0 view .LVU95
+	movq	72(%rbx), %rdx
+.LVL28:
+	.loc 1 112 5 is_stmt 1 view .LVU96
+	.loc 1 112 70 is_stmt 0 view .LVU97
+	movq	8(%rdx), %rcx
+	.loc 1 112 45 view .LVU98
+	movq	16(%rdx), %rsi
+	.loc 1 112 70 view .LVU99
+	leaq	24(%rdx,%rcx), %rcx
+	.loc 1 112 45 view .LVU100
+	leaq	24(%rdx,%rsi), %rdx
+.LVL29:
+	.loc 1 112 45 view .LVU101
+	movq	%rdx, 40(%rbx)
+	.loc 1 112 14 view .LVU102
+	movq	%rcx, 48(%rbx)
+	.loc 1 113 5 is_stmt 1 view .LVU103
+.LVL30:
+.L32:
+	.loc 1 114 1 is_stmt 0 view .LVU104
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL31:
+	.loc 1 114 1 view .LVU105
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	va_rope_refill, .-va_rope_refill
+	.globl	va_rope_put
+	.type	va_rope_put, @function
+va_rope_put:
+.LVL32:
+.LFB26:
+	.loc 1 119 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 120 5 view .LVU107
+	.loc 1 119 1 is_stmt 0 view .LVU108
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	%esi, %ebp
+	.loc 1 122 10 view .LVU109
+	movl	$1, %esi
+.LVL33:
+	.loc 1 119 1 view .LVU110
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+.LVL34:
+	.loc 1 121 5 is_stmt 1 view .LVU111
+	.loc 1 119 1 is_stmt 0 view .LVU112
+	pushq	%rdx
+	.cfi_def_cfa_offset 32
+	.loc 1 121 5 view .LVU113
+	call	commit
+.LVL35:
+	.loc 1 122 5 is_stmt 1 view .LVU114
+	.loc 1 122 10 is_stmt 0 view .LVU115
+	call	make_room
+.LVL36:
+	.loc 1 122 8 view .LVU116
+	testb	%al, %al
+	je	.L38
+	.loc 1 125 5 is_stmt 1 view .LVU117
+	movq	72(%rbx), %rax
+	.loc 1 125 32 is_stmt 0 view .LVU118
+	movq	16(%rax), %rdx
+	.loc 1 125 38 view .LVU119
+	leaq	1(%rdx), %rcx
+	movq	%rcx, 16(%rax)
+	.loc 1 125 42 view .LVU120
+	movb	%bpl, 24(%rax,%rdx)
+.L38:
+	.loc 1 126 1 view .LVU121
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL37:
+	.loc 1 126 1 view .LVU122
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	va_rope_put, .-va_rope_put
+	.globl	va_rope_len
+	.type	va_rope_len, @function
+va_rope_len:
+.LVL38:
+.LFB27:
+	.loc 1 130 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 131 5 view .LVU124
+	call	commit
+.LVL39:
+	.loc 1 132 5 view .LVU125
+	.loc 1 133 5 view .LVU126
+.LBB41:
+	.loc 1 133 10 view .LVU127
+	.loc 1 133 27 is_stmt 0 view .LVU128
+	movq	64(%rdi), %rax
+.LVL40:
+	.loc 1 133 27 view .LVU129
+.LBE41:
+	.loc 1 132 12 view .LVU130
+	xorl	%edx, %edx
+.LVL41:
+.L45:
+.LBB42:
+	.loc 1 133 43 is_stmt 1 discriminator 1 view .LVU131
+	testq	%rax, %rax
+	je	.L47
+	.loc 1 134 9 discriminator 3 view .LVU132
+	.loc 1 134 11 is_stmt 0 discriminator 3 view .LVU133
+	addq	16(%rax), %rdx
+.LVL42:
+	.loc 1 133 53 is_stmt 1 discriminator 3 view .LVU134
+	movq	(%rax), %rax
+.LVL43:
+	.loc 1 133 53 is_stmt 0 discriminator 3 view .LVU135
+	jmp	.L45
+.L47:
+	.loc 1 133 53 discriminator 3 view .LVU136
+.LBE42:
+	.loc 1 136 5 is_stmt 1 view .LVU137
+	.loc 1 137 1 is_stmt 0 view .LVU138
+	movq	%rdx, %rax
+.LVL44:
+	.loc 1 137 1 view .LVU139
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	va_rope_len, .-va_rope_len
+	.globl	va_rope_iovec
+	.type	va_rope_iovec, @function
+va_rope_iovec:
+.LVL45:
+.LFB28:
+	.loc 1 143 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 144 5 view .LVU141
+	.loc 1 143 1 is_stmt 0 view .LVU142
+	movq	%rdx, %r8
+	.loc 1 144 5 view .LVU143
+	call	commit
+.LVL46:
+	.loc 1 145 5 is_stmt 1 view .LVU144
+	.loc 1 146 5 view .LVU145
+.LBB43:
+	.loc 1 146 10 view .LVU146
+	.loc 1 146 27 is_stmt 0 view .LVU147
+	movq	64(%rdi), %rax
+.LVL47:
+	.loc 1 146 27 view .LVU148
+.LBE43:
+	.loc 1 145 12 view .LVU149
+	xorl	%ecx, %ecx
+.LVL48:
+.L49:
+.LBB48:
+	.loc 1 146 43 is_stmt 1 discriminator 1 view .LVU150
+	testq	%rax, %rax
+	je	.L53
+	.loc 1 147 9 view .LVU151
+	.loc 1 147 12 is_stmt 0 view .LVU152
+	cmpq	$0, 16(%rax)
+	je	.L50
+	.loc 1 150 9 is_stmt 1 view .LVU153
+	.loc 1 150 12 is_stmt 0 view .LVU154
+	cmpq	%r8, %rcx
+	jnb	.L51
+	.loc 1 151 13 is_stmt 1 view .LVU155
+	.loc 1 151 16 is_stmt 0 view .LVU156
+	movq	%rcx, %rdi
+.LBB44:
+.LBB45:
+	.loc 1 33 21 view .LVU157
+	leaq	24(%rax), %rdx
+.LBE45:
+.LBE44:
+	.loc 1 151 16 view .LVU158
+	salq	$4, %rdi
+	addq	%rsi, %rdi
+.LVL49:
+.LBB47:
+.LBI44:
+	.loc 1 31 14 is_stmt 1 view .LVU159
+.LBB46:
+	.loc 1 33 5 view .LVU160
+	.loc 1 33 21 is_stmt 0 view .LVU161
+	movq	%rdx, (%rdi)
+.LBE46:
+.LBE47:
+	.loc 1 152 13 is_stmt 1 view .LVU162
+	.loc 1 152 31 is_stmt 0 view .LVU163
+	movq	16(%rax), %rdx
+	.loc 1 152 28 view .LVU164
+	movq	%rdx, 8(%rdi)
+.L51:
+	.loc 1 154 9 is_stmt 1 view .LVU165
+	.loc 1 154 10 is_stmt 0 view .LVU166
+	incq	%rcx
+.LVL50:
+.L50:
+	.loc 1 146 53 is_stmt 1 discriminator 2 view .LVU167
+	movq	(%rax), %rax
+.LVL51:
+	.loc 1 146 53 is_stmt 0 discriminator 2 view .LVU168
+	jmp	.L49
+.L53:
+	.loc 1 146 53 discriminator 2 view .LVU169
+.LBE48:
+	.loc 1 156 5 is_stmt 1 view .LVU170
+	.loc 1 157 1 is_stmt 0 view .LVU171
+	movq	%rcx, %rax
+.LVL52:
+	.loc 1 157 1 view .LVU172
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	va_rope_iovec, .-va_rope_iovec
+	.globl	va_rope_writev
+	.type	va_rope_writev, @function
+va_rope_writev:
+.LVL53:
+.LFB29:
+	.loc 1 162 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 163 5 view .LVU174
+	.loc 1 162 1 is_stmt 0 view .LVU175
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%esi, %r12d
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	.loc 1 166 12 view .LVU176
+	xorl	%ebx, %ebx
+	.loc 1 162 1 view .LVU177
+	subq	$1032, %rsp
+	.cfi_def_cfa_offset 1072
+	.loc 1 163 5 view .LVU178
+	call	commit
+.LVL54:
+	.loc 1 164 5 is_stmt 1 view .LVU179
+	.loc 1 165 5 view .LVU180
+	.loc 1 165 22 is_stmt 0 view .LVU181
+	movq	64(%rdi), %r13
+.LVL55:
+	.loc 1 166 5 is_stmt 1 view .LVU182
+.L55:
+	.loc 1 167 5 view .LVU183
+.LBB49:
+	.loc 1 169 9 view .LVU184
+	.loc 1 170 9 view .LVU185
+	.loc 1 171 9 view .LVU186
+.LBB50:
+	.loc 1 171 14 view .LVU187
+	.loc 1 171 31 is_stmt 0 view .LVU188
+	movq	%r13, %rax
+.LBE50:
+	.loc 1 170 16 view .LVU189
+	movq	%rbx, %rcx
+	.loc 1 169 13 view .LVU190
+	xorl	%edx, %edx
+.LVL56:
+.L56:
+.LBB51:
+	.loc 1 171 49 is_stmt 1 discriminator 1 view .LVU191
+	.loc 1 171 41 is_stmt 0 discriminator 1 view .LVU192
+	testq	%rax, %rax
+	setne	%bpl
+	.loc 1 171 55 discriminator 1 view .LVU193
+	cmpl	$63, %edx
+	setle	%sil
+	.loc 1 171 49 discriminator 1 view .LVU194
+	andb	%sil, %bpl
+	je	.L73
+	.loc 1 172 13 is_stmt 1 view .LVU195
+	.loc 1 172 16 is_stmt 0 view .LVU196
+	cmpq	16(%rax), %rcx
+	jnb	.L57
+	.loc 1 173 17 is_stmt 1 view .LVU197
+	.loc 1 173 33 is_stmt 0 view .LVU198
+	movslq	%edx, %rsi
+	.loc 1 173 49 view .LVU199
+	leaq	24(%rax,%rcx), %rdi
+	.loc 1 175 18 view .LVU200
+	incl	%edx
+.LVL57:
+	.loc 1 173 33 view .LVU201
+	salq	$4, %rsi
+	.loc 1 173 49 view .LVU202
+	movq	%rdi, (%rsp,%rsi)
+	.loc 1 174 17 is_stmt 1 view .LVU203
+	.loc 1 174 42 is_stmt 0 view .LVU204
+	movq	16(%rax), %rdi
+	subq	%rcx, %rdi
+	.loc 1 174 32 view .LVU205
+	movq	%rdi, 8(%rsp,%rsi)
+	.loc 1 175 17 is_stmt 1 view .LVU206
+.LVL58:
+.L57:
+	.loc 1 177 13 discriminator 2 view .LVU207
+	.loc 1 171 64 discriminator 2 view .LVU208
+	movq	(%rax), %rax
+.LVL59:
+	.loc 1 177 15 is_stmt 0 discriminator 2 view .LVU209
+	xorl	%ecx, %ecx
+	jmp	.L56
+.LVL60:
+.L73:
+	.loc 1 177 15 discriminator 2 view .LVU210
+.LBE51:
+	.loc 1 179 9 is_stmt 1 view .LVU211
+	.loc 1 179 12 is_stmt 0 view .LVU212
+	testl	%edx, %edx
+	je	.L65
+	.loc 1 183 9 is_stmt 1 view .LVU213
+	.loc 1 183 21 is_stmt 0 view .LVU214
+	movq	%rsp, %rsi
+	movl	%r12d, %edi
+	call	writev@PLT
+.LVL61:
+	.loc 1 184 9 is_stmt 1 view .LVU215
+	.loc 1 184 12 is_stmt 0 view .LVU216
+	testq	%rax, %rax
+	jns	.L60
+	.loc 1 185 13 is_stmt 1 view .LVU217
+	.loc 1 185 18 is_stmt 0 view .LVU218
+	call	__errno_location@PLT
+.LVL62:
+	.loc 1 185 16 view .LVU219
+	cmpl	$4, (%rax)
+	jne	.L54
+	jmp	.L55
+.LVL63:
+.L60:
+	.loc 1 190 9 is_stmt 1 view .LVU220
+	.loc 1 190 12 is_stmt 0 view .LVU221
+	je	.L54
+	.loc 1 195 9 is_stmt 1 view .LVU222
+.LVL64:
+	.loc 1 196 9 view .LVU223
+	.loc 1 196 18 view .LVU224
+.LBB52:
+	.loc 1 197 13 view .LVU225
+	.loc 1 197 25 is_stmt 0 view .LVU226
+	movq	16(%r13), %rcx
+.LVL65:
+	.loc 1 198 13 is_stmt 1 view .LVU227
+	.loc 1 197 20 is_stmt 0 view .LVU228
+	movq	%rcx, %rdx
+	subq	%rbx, %rdx
+.LVL66:
+	.loc 1 198 16 view .LVU229
+	cmpq	%rdx, %rax
+	movq	%rbx, %rdx
+.LVL67:
+	.loc 1 198 16 view .LVU230
+.LBE52:
+	.loc 1 195 16 view .LVU231
+	movq	%rax, %rbx
+.LVL68:
+.L72:
+.LBB53:
+	.loc 1 198 16 view .LVU232
+	jnb	.L63
+	.loc 1 199 17 is_stmt 1 view .LVU233
+	.loc 1 199 21 is_stmt 0 view .LVU234
+	addq	%rdx, %rbx
+.LVL69:
+	.loc 1 200 17 is_stmt 1 view .LVU235
+	jmp	.L55
+.LVL70:
+.L63:
+	.loc 1 202 13 view .LVU236
+	.loc 1 202 15 is_stmt 0 view .LVU237
+	movq	%rdx, %rax
+	.loc 1 203 15 view .LVU238
+	movq	0(%r13), %r13
+.LVL71:
+	.loc 1 202 15 view .LVU239
+	subq	%rcx, %rax
+.LVL72:
+	.loc 1 203 13 is_stmt 1 view .LVU240
+	.loc 1 204 13 view .LVU241
+	.loc 1 204 13 is_stmt 0 view .LVU242
+.LBE53:
+	.loc 1 196 18 is_stmt 1 view .LVU243
+	addq	%rax, %rbx
+.LVL73:
+	.loc 1 196 18 is_stmt 0 view .LVU244
+	je	.L55
+.LBB54:
+	.loc 1 197 13 is_stmt 1 view .LVU245
+	.loc 1 197 25 is_stmt 0 view .LVU246
+	movq	16(%r13), %rcx
+.LVL74:
+	.loc 1 198 13 is_stmt 1 view .LVU247
+	.loc 1 204 17 is_stmt 0 view .LVU248
+	xorl	%edx, %edx
+	.loc 1 198 16 view .LVU249
+	cmpq	%rcx, %rbx
+	jmp	.L72
+.LVL75:
+.L65:
+	.loc 1 198 16 view .LVU250
+.LBE54:
+	.loc 1 180 19 view .LVU251
+	movb	$1, %bpl
+.LVL76:
+.L54:
+	.loc 1 180 19 view .LVU252
+.LBE49:
+	.loc 1 207 1 view .LVU253
+	addq	$1032, %rsp
+	.cfi_def_cfa_offset 40
+	movl	%ebp, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+.LVL77:
+	.loc 1 207 1 view .LVU254
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+	popq	%r12
+	.cfi_def_cfa_offset 16
+.LVL78:
+	.loc 1 207 1 view .LVU255
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL79:
+	.loc 1 207 1 view .LVU256
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	va_rope_writev, .-va_rope_writev
+	.globl	va_rope_flatten
+	.type	va_rope_flatten, @function
+va_rope_flatten:
+.LVL80:
+.LFB30:
+	.loc 1 211 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 212 5 view .LVU258
+	.loc 1 211 1 is_stmt 0 view .LVU259
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 211 1 view .LVU260
+	movq	%rdi, %rbx
+	.loc 1 212 16 view .LVU261
+	call	va_rope_len
+.LVL81:
+	.loc 1 213 5 is_stmt 1 view .LVU262
+	.loc 1 213 15 is_stmt 0 view .LVU263
+	xorl	%edi, %edi
+.LVL82:
+	.loc 1 213 15 view .LVU264
+	movl	$1, %edx
+	leaq	1(%rax), %rsi
+	call	*88(%rbx)
+.LVL83:
+	.loc 1 214 5 is_stmt 1 view .LVU265
+	.loc 1 214 8 is_stmt 0 view .LVU266
+	testq	%rax, %rax
+	je	.L74
+	.loc 1 217 5 is_stmt 1 view .LVU267
+.LVL84:
+	.loc 1 218 5 view .LVU268
+.LBB55:
+	.loc 1 218 10 view .LVU269
+	.loc 1 218 27 is_stmt 0 view .LVU270
+	movq	64(%rbx), %rdx
+.LVL85:
+	.loc 1 218 5 view .LVU271
+	movq	%rax, %r8
+.LVL86:
+.L76:
+	.loc 1 218 43 is_stmt 1 discriminator 1 view .LVU272
+	testq	%rdx, %rdx
+	je	.L82
+	.loc 1 219 9 discriminator 3 view .LVU273
+.LVL87:
+.LBB56:
+.LBI56:
+	.loc 1 31 14 discriminator 3 view .LVU274
+.LBB57:
+	.loc 1 33 5 discriminator 3 view .LVU275
+	.loc 1 33 5 is_stmt 0 discriminator 3 view .LVU276
+.LBE57:
+.LBE56:
+	.loc 1 219 9 discriminator 3 view .LVU277
+	movq	16(%rdx), %rcx
+.LBB59:
+.LBB58:
+	.loc 1 33 21 discriminator 3 view .LVU278
+	leaq	24(%rdx), %rsi
+.LBE58:
+.LBE59:
+	.loc 1 219 9 discriminator 3 view .LVU279
+	movq	%r8, %rdi
+	rep movsb
+	.loc 1 220 9 is_stmt 1 discriminator 3 view .LVU280
+	.loc 1 220 11 is_stmt 0 discriminator 3 view .LVU281
+	addq	16(%rdx), %r8
+.LVL88:
+	.loc 1 218 53 is_stmt 1 discriminator 3 view .LVU282
+	movq	(%rdx), %rdx
+.LVL89:
+	.loc 1 218 53 is_stmt 0 discriminator 3 view .LVU283
+	jmp	.L76
+.L82:
+	.loc 1 218 53 discriminator 3 view .LVU284
+.LBE55:
+	.loc 1 222 5 is_stmt 1 view .LVU285
+	.loc 1 222 8 is_stmt 0 view .LVU286
+	movb	$0, (%r8)
+	.loc 1 223 5 is_stmt 1 view .LVU287
+.LVL90:
+.L74:
+	.loc 1 224 1 is_stmt 0 view .LVU288
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL91:
+	.loc 1 224 1 view .LVU289
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	va_rope_flatten, .-va_rope_flatten
+	.globl	va_rope_clear
+	.type	va_rope_clear, @function
+va_rope_clear:
+.LVL92:
+.LFB31:
+	.loc 1 228 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 229 5 view .LVU291
+	.loc 1 228 1 is_stmt 0 view .LVU292
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	pushq	%rcx
+	.cfi_def_cfa_offset 32
+	.loc 1 229 5 view .LVU293
+	call	commit
+.LVL93:
+	.loc 1 230 5 is_stmt 1 view .LVU294
+	.loc 1 230 22 is_stmt 0 view .LVU295
+	movq	64(%rdi), %rbp
+.LVL94:
+	.loc 1 231 5 is_stmt 1 view .LVU296
+	.loc 1 231 8 is_stmt 0 view .LVU297
+	testq	%rbp, %rbp
+	je	.L83
+	.loc 1 234 5 is_stmt 1 view .LVU298
+	movq	0(%rbp), %rsi
+	call	free_chunks
+.LVL95:
+	.loc 1 235 5 view .LVU299
+	.loc 1 236 13 is_stmt 0 view .LVU300
+	xorl	%edx, %edx
+	movq	%rdx, 0(%rbp)
+	movq	%rdx, 16(%rbp)
+	.loc 1 237 5 is_stmt 1 view .LVU301
+	.loc 1 237 13 is_stmt 0 view .LVU302
+	movq	%rbp, 72(%rbx)
+.L83:
+	.loc 1 238 1 view .LVU303
+	popq	%rax
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL96:
+	.loc 1 238 1 view .LVU304
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL97:
+	.loc 1 238 1 view .LVU305
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	va_rope_clear, .-va_rope_clear
+	.globl	va_rope_free
+	.type	va_rope_free, @function
+va_rope_free:
+.LVL98:
+.LFB32:
+	.loc 1 242 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 243 5 view .LVU307
+	.loc 1 242 1 is_stmt 0 view .LVU308
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	.loc 1 242 1 view .LVU309
+	movq	%rdi, %rbx
+	.loc 1 243 5 view .LVU310
+	call	commit
+.LVL99:
+	.loc 1 244 5 is_stmt 1 view .LVU311
+	movq	64(%rdi), %rsi
+	call	free_chunks
+.LVL100:
+	.loc 1 245 5 view .LVU312
+	.loc 1 246 13 is_stmt 0 view .LVU313
+	xorl	%eax, %eax
+	movq	%rax, 64(%rbx)
+	movq	%rax, 72(%rbx)
+	.loc 1 247 1 view .LVU314
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+.LVL101:
+	.loc 1 247 1 view .LVU315
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	va_rope_free, .-va_rope_free
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/unistd.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 7 "./include/va_print/base.h"
+	.file 8 "./include/va_print/rope.h"
+	.file 9 "/usr/include/string.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/uio.h"
+	.file 11 "/usr/include/errno.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xe62
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF1596
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xe
+	.long	.LASF1524
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1516
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1517
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x9
+	.long	0x53
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1518
+	.uleb128 0x9
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1519
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1520
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1521
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1522
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1523
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF1525
+	.byte	0x4
+	.byte	0xc2
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x2
+	.long	0x5d
+	.uleb128 0xe
+	.long	.LASF1526
+	.byte	0x5
+	.byte	0xdc
+	.byte	0x13
+	.long	0x8e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1527
+	.uleb128 0xf
+	.long	0x5d
+	.long	0xc2
+	.uleb128 0x10
+	.long	0x3e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1528
+	.uleb128 0x1d
+	.long	.LASF1541
+	.byte	0x10
+	.byte	0x6
+	.byte	0x1a
+	.long	0xf0
+	.uleb128 0x5
+	.long	.LASF1529
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xb
+	.long	0x8c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1530
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xc
+	.long	0x32
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0xc9
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1531
+	.uleb128 0x16
+	.byte	0x38
+	.byte	0x7
+	.byte	0xc1
+	.long	0x194
+	.uleb128 0x5
+	.long	.LASF1532
+	.byte	0x7
+	.byte	0xc4
+	.byte	0x11
+	.long	0x53
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1533
+	.byte	0x7
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1e3
+	.byte	0x8
+	.uleb128 0x13
+	.string	"end"
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1fc
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1534
+	.byte	0x7
+	.byte	0xdb
+	.byte	0xc
+	.long	0x20c
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1535
+	.byte	0x7
+	.byte	0xe2
+	.byte	0xe
+	.long	0x239
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1536
+	.byte	0x7
+	.byte	0xec
+	.byte	0xe
+	.long	0x25c
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF1537
+	.byte	0x7
+	.byte	0xf1
+	.byte	0x13
+	.long	0x69
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF1538
+	.byte	0x7
+	.byte	0xf5
+	.byte	0x13
+	.long	0x69
+	.byte	0x31
+	.uleb128 0x5
+	.long	.LASF1539
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x69
+	.byte	0x32
+	.uleb128 0x13
+	.string	"enc"
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x13
+	.long	0x69
+	.byte	0x33
+	.uleb128 0x5
+	.long	.LASF1540
+	.byte	0x7
+	.byte	0xff
+	.byte	0xa
+	.long	0xb2
+	.byte	0x34
+	.byte	0
+	.uleb128 0xb
+	.long	0x70
+	.long	0x1a8
+	.uleb128 0x1
+	.long	0x1a8
+	.uleb128 0x1
+	.long	0x1dd
+	.byte	0
+	.uleb128 0x2
+	.long	0x1ad
+	.uleb128 0x1a
+	.long	.LASF1542
+	.byte	0x10
+	.byte	0x7
+	.value	0x132
+	.byte	0x10
+	.long	0x1d8
+	.uleb128 0x6
+	.long	.LASF1543
+	.byte	0x7
+	.value	0x135
+	.byte	0x20
+	.long	0x273
+	.byte	0
+	.uleb128 0xa
+	.string	"cur"
+	.byte	0x7
+	.value	0x138
+	.byte	0x11
+	.long	0x1dd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x1ad
+	.uleb128 0x2
+	.long	0x1e2
+	.uleb128 0x29
+	.uleb128 0x2
+	.long	0x194
+	.uleb128 0xb
+	.long	0x1dd
+	.long	0x1fc
+	.uleb128 0x1
+	.long	0x1a8
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x1e8
+	.uleb128 0x14
+	.long	0x20c
+	.uleb128 0x1
+	.long	0x1a8
+	.byte	0
+	.uleb128 0x2
+	.long	0x201
+	.uleb128 0xb
+	.long	0x32
+	.long	0x22f
+	.uleb128 0x1
+	.long	0x22f
+	.uleb128 0x1
+	.long	0x1dd
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x234
+	.byte	0
+	.uleb128 0x2
+	.long	0x1d8
+	.uleb128 0x2
+	.long	0x32
+	.uleb128 0x2
+	.long	0x211
+	.uleb128 0xb
+	.long	0x32
+	.long	0x25c
+	.uleb128 0x1
+	.long	0x8c
+	.uleb128 0x1
+	.long	0x69
+	.uleb128 0x1
+	.long	0x1dd
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x23e
+	.uleb128 0xc
+	.long	.LASF1544
+	.byte	0x7
+	.value	0x100
+	.byte	0x3
+	.long	0xfc
+	.uleb128 0x9
+	.long	0x261
+	.uleb128 0x2
+	.long	0x26e
+	.uleb128 0xc
+	.long	.LASF1545
+	.byte	0x7
+	.value	0x139
+	.byte	0x3
+	.long	0x1ad
+	.uleb128 0xb
+	.long	0x8c
+	.long	0x29e
+	.uleb128 0x1
+	.long	0x8c
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x285
+	.uleb128 0xc
+	.long	.LASF1546
+	.byte	0x7
+	.value	0x169
+	.byte	0x1a
+	.long	0x2b0
+	.uleb128 0x1a
+	.long	.LASF1547
+	.byte	0x40
+	.byte	0x7
+	.value	0x1b7
+	.byte	0x8
+	.long	0x32f
+	.uleb128 0x6
+	.long	.LASF1543
+	.byte	0x7
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x4a2
+	.byte	0
+	.uleb128 0xa
+	.string	"pat"
+	.byte	0x7
+	.value	0x1b9
+	.byte	0x14
+	.long	0x278
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1548
+	.byte	0x7
+	.value	0x1ba
+	.byte	0xe
+	.long	0x70
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1549
+	.byte	0x7
+	.value	0x1bb
+	.byte	0xe
+	.long	0x70
+	.byte	0x1c
+	.uleb128 0xa
+	.string	"opt"
+	.byte	0x7
+	.value	0x1bc
+	.byte	0xe
+	.long	0x70
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1550
+	.byte	0x7
+	.value	0x1bd
+	.byte	0xe
+	.long	0x70
+	.byte	0x24
+	.uleb128 0xa
+	.string	"win"
+	.byte	0x7
+	.value	0x1be
+	.byte	0x11
+	.long	0x495
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1551
+	.byte	0x7
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x4a7
+	.byte	0x38
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1552
+	.byte	0x7
+	.value	0x16c
+	.byte	0x1e
+	.long	0x341
+	.uleb128 0x9
+	.long	0x32f
+	.uleb128 0x1a
+	.long	.LASF1553
+	.byte	0x40
+	.byte	0x2
+	.value	0x14f
+	.byte	0x8
+	.long	0x35c
+	.uleb128 0xa
+	.string	"q"
+	.byte	0x2
+	.value	0x150
+	.byte	0x1b
+	.long	0x63e
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x38
+	.value	0x174
+	.long	0x3d5
+	.uleb128 0x6
+	.long	.LASF1554
+	.byte	0x7
+	.value	0x176
+	.byte	0xc
+	.long	0x3e5
+	.byte	0
+	.uleb128 0xa
+	.string	"put"
+	.byte	0x7
+	.value	0x178
+	.byte	0xc
+	.long	0x3fa
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1555
+	.byte	0x7
+	.value	0x17b
+	.byte	0xc
+	.long	0x3e5
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1556
+	.byte	0x7
+	.value	0x182
+	.byte	0xb
+	.long	0x41a
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1557
+	.byte	0x7
+	.value	0x186
+	.byte	0xc
+	.long	0x434
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1558
+	.byte	0x7
+	.value	0x18c
+	.byte	0xc
+	.long	0x449
+	.byte	0x28
+	.uleb128 0xa
+	.string	"enc"
+	.byte	0x7
+	.value	0x191
+	.byte	0x13
+	.long	0x69
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF1540
+	.byte	0x7
+	.value	0x192
+	.byte	0xa
+	.long	0x44e
+	.byte	0x31
+	.byte	0
+	.uleb128 0x14
+	.long	0x3e0
+	.uleb128 0x1
+	.long	0x3e0
+	.byte	0
+	.uleb128 0x2
+	.long	0x2a3
+	.uleb128 0x2
+	.long	0x3d5
+	.uleb128 0x14
+	.long	0x3fa
+	.uleb128 0x1
+	.long	0x3e0
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x2
+	.long	0x3ea
+	.uleb128 0xb
+	.long	0x413
+	.long	0x413
+	.uleb128 0x1
+	.long	0x3e0
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1559
+	.uleb128 0x2
+	.long	0x3ff
+	.uleb128 0x14
+	.long	0x434
+	.uleb128 0x1
+	.long	0x3e0
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x41f
+	.uleb128 0x14
+	.long	0x449
+	.uleb128 0x1
+	.long	0x3e0
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2
+	.long	0x439
+	.uleb128 0xf
+	.long	0x5d
+	.long	0x45e
+	.uleb128 0x10
+	.long	0x3e
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1560
+	.byte	0x7
+	.value	0x193
+	.byte	0x3
+	.long	0x35c
+	.uleb128 0x9
+	.long	0x45e
+	.uleb128 0x1e
+	.byte	0x10
+	.value	0x19a
+	.long	0x495
+	.uleb128 0xa
+	.string	"cur"
+	.byte	0x7
+	.value	0x19b
+	.byte	0xb
+	.long	0x8c
+	.byte	0
+	.uleb128 0xa
+	.string	"end"
+	.byte	0x7
+	.value	0x19c
+	.byte	0xb
+	.long	0x8c
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1561
+	.byte	0x7
+	.value	0x19d
+	.byte	0x3
+	.long	0x470
+	.uleb128 0x2
+	.long	0x46b
+	.uleb128 0x2
+	.long	0x33c
+	.uleb128 0xe
+	.long	.LASF1562
+	.byte	0x8
+	.byte	0x30
+	.byte	0x1e
+	.long	0x4b8
+	.uleb128 0x1d
+	.long	.LASF1563
+	.byte	0x18
+	.byte	0x1
+	.byte	0x16
+	.long	0x4ec
+	.uleb128 0x5
+	.long	.LASF1564
+	.byte	0x1
+	.byte	0x17
+	.byte	0x16
+	.long	0x534
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1565
+	.byte	0x1
+	.byte	0x18
+	.byte	0xc
+	.long	0x32
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1566
+	.byte	0x1
+	.byte	0x19
+	.byte	0xc
+	.long	0x32
+	.byte	0x10
+	.byte	0
+	.uleb128 0x16
+	.byte	0x60
+	.byte	0x8
+	.byte	0x39
+	.long	0x534
+	.uleb128 0x13
+	.string	"s"
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x11
+	.long	0x2a3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1567
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x16
+	.long	0x534
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1568
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x16
+	.long	0x534
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF1569
+	.byte	0x8
+	.byte	0x3e
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF1570
+	.byte	0x8
+	.byte	0x40
+	.byte	0xd
+	.long	0x29e
+	.byte	0x58
+	.byte	0
+	.uleb128 0x2
+	.long	0x4ac
+	.uleb128 0xe
+	.long	.LASF1571
+	.byte	0x8
+	.byte	0x41
+	.byte	0x3
+	.long	0x4ec
+	.uleb128 0x16
+	.byte	0x88
+	.byte	0x2
+	.byte	0xc9
+	.long	0x568
+	.uleb128 0x13
+	.string	"cls"
+	.byte	0x2
+	.byte	0xce
+	.byte	0x13
+	.long	0x568
+	.byte	0
+	.uleb128 0x13
+	.string	"esc"
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x18
+	.long	0x578
+	.byte	0x80
+	.byte	0
+	.uleb128 0xf
+	.long	0x69
+	.long	0x578
+	.uleb128 0x10
+	.long	0x3e
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2
+	.long	0x58
+	.uleb128 0xe
+	.long	.LASF1572
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x3
+	.long	0x545
+	.uleb128 0x9
+	.long	0x57d
+	.uleb128 0x16
+	.byte	0x38
+	.byte	0x2
+	.byte	0xe0
+	.long	0x5ea
+	.uleb128 0x5
+	.long	.LASF1573
+	.byte	0x2
+	.byte	0xef
+	.byte	0x18
+	.long	0x5ea
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1574
+	.byte	0x2
+	.value	0x101
+	.byte	0xb
+	.long	0x60e
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1575
+	.byte	0x2
+	.value	0x10e
+	.byte	0xb
+	.long	0x622
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1576
+	.byte	0x2
+	.value	0x12a
+	.byte	0xc
+	.long	0x3fa
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1577
+	.byte	0x2
+	.value	0x131
+	.byte	0xc
+	.long	0x3e5
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1578
+	.byte	0x2
+	.value	0x141
+	.byte	0x21
+	.long	0x627
+	.byte	0x30
+	.byte	0
+	.uleb128 0xf
+	.long	0xab
+	.long	0x5fa
+	.uleb128 0x10
+	.long	0x3e
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.long	0x413
+	.long	0x60e
+	.uleb128 0x1
+	.long	0x3e0
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fa
+	.uleb128 0xb
+	.long	0x413
+	.long	0x622
+	.uleb128 0x1
+	.long	0x3e0
+	.byte	0
+	.uleb128 0x2
+	.long	0x613
+	.uleb128 0x2
+	.long	0x589
+	.uleb128 0xc
+	.long	.LASF1579
+	.byte	0x2
+	.value	0x142
+	.byte	0x3
+	.long	0x58e
+	.uleb128 0x9
+	.long	0x62c
+	.uleb128 0xf
+	.long	0x64e
+	.long	0x64e
+	.uleb128 0x10
+	.long	0x3e
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2
+	.long	0x639
+	.uleb128 0x1f
+	.long	.LASF1580
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8c
+	.long	0x673
+	.uleb128 0x1
+	.long	0x8c
+	.uleb128 0x1
+	.long	0x1dd
+	.uleb128 0x1
+	.long	0x32
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1597
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0x67f
+	.uleb128 0x2
+	.long	0x4c
+	.uleb128 0x1f
+	.long	.LASF1581
+	.byte	0xa
+	.byte	0x34
+	.byte	0x10
+	.long	0x9f
+	.long	0x6a4
+	.uleb128 0x1
+	.long	0x4c
+	.uleb128 0x1
+	.long	0x6a4
+	.uleb128 0x1
+	.long	0x4c
+	.byte	0
+	.uleb128 0x2
+	.long	0xf0
+	.uleb128 0x17
+	.long	.LASF1582
+	.byte	0xf0
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x703
+	.uleb128 0x7
+	.string	"t"
+	.byte	0xf1
+	.byte	0x17
+	.long	0x703
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x11
+	.quad	.LVL99
+	.long	0xda8
+	.long	0x6ee
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL100
+	.long	0xc24
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x539
+	.uleb128 0x17
+	.long	.LASF1583
+	.byte	0xe2
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x773
+	.uleb128 0x7
+	.string	"t"
+	.byte	0xe3
+	.byte	0x17
+	.long	0x703
+	.long	.LLST49
+	.long	.LVUS49
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xe6
+	.byte	0x16
+	.long	0x534
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x11
+	.quad	.LVL93
+	.long	0xda8
+	.long	0x75e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL95
+	.long	0xc24
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1584
+	.byte	0xd1
+	.byte	0xe
+	.long	0x9a
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84e
+	.uleb128 0x7
+	.string	"t"
+	.byte	0xd2
+	.byte	0x17
+	.long	0x703
+	.long	.LLST42
+	.long	.LVUS42
+	.uleb128 0x4
+	.string	"n"
+	.byte	0xd4
+	.byte	0xc
+	.long	0x32
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x4
+	.string	"p"
+	.byte	0xd5
+	.byte	0xb
+	.long	0x9a
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x4
+	.string	"w"
+	.byte	0xd9
+	.byte	0xb
+	.long	0x9a
+	.long	.LLST45
+	.long	.LVUS45
+	.uleb128 0x20
+	.quad	.LBB55
+	.quad	.LBE55-.LBB55
+	.long	0x821
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xda
+	.byte	0x1b
+	.long	0x534
+	.long	.LLST46
+	.long	.LVUS46
+	.uleb128 0x21
+	.long	0xdff
+	.quad	.LBI56
+	.byte	.LVU274
+	.long	.LLRL47
+	.byte	0xdb
+	.byte	0x13
+	.uleb128 0x12
+	.long	0xe10
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL81
+	.long	0xa5f
+	.long	0x839
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL83
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1585
+	.byte	0x9f
+	.byte	0xc
+	.long	0x413
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x997
+	.uleb128 0x7
+	.string	"t"
+	.byte	0xa0
+	.byte	0x17
+	.long	0x703
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x7
+	.string	"fd"
+	.byte	0xa1
+	.byte	0x9
+	.long	0x4c
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x2b
+	.string	"iov"
+	.byte	0x1
+	.byte	0xa4
+	.byte	0x12
+	.long	0x997
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1072
+	.uleb128 0x4
+	.string	"c"
+	.byte	0xa5
+	.byte	0x16
+	.long	0x534
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4
+	.string	"off"
+	.byte	0xa6
+	.byte	0xc
+	.long	0x32
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x20
+	.quad	.LBB49
+	.quad	.LBE49-.LBB49
+	.long	0x982
+	.uleb128 0x4
+	.string	"n"
+	.byte	0xa9
+	.byte	0xd
+	.long	0x4c
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x4
+	.string	"o"
+	.byte	0xaa
+	.byte	0x10
+	.long	0x32
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x4
+	.string	"k"
+	.byte	0xb7
+	.byte	0x11
+	.long	0x9f
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x4
+	.string	"m"
+	.byte	0xc3
+	.byte	0x10
+	.long	0x32
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x18
+	.long	.LLRL38
+	.long	0x93a
+	.uleb128 0x4
+	.string	"d"
+	.byte	0xab
+	.byte	0x1f
+	.long	0x534
+	.long	.LLST39
+	.long	.LVUS39
+	.byte	0
+	.uleb128 0x18
+	.long	.LLRL40
+	.long	0x955
+	.uleb128 0x4
+	.string	"r"
+	.byte	0xc5
+	.byte	0x14
+	.long	0x32
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.uleb128 0x11
+	.quad	.LVL61
+	.long	0x684
+	.long	0x974
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1072
+	.byte	0
+	.uleb128 0x2c
+	.quad	.LVL62
+	.long	0x673
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL54
+	.long	0xda8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xc9
+	.long	0x9a7
+	.uleb128 0x10
+	.long	0x3e
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1586
+	.byte	0x8b
+	.byte	0xf
+	.long	0x32
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa5a
+	.uleb128 0x7
+	.string	"t"
+	.byte	0x8c
+	.byte	0x17
+	.long	0x703
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x19
+	.string	"iov"
+	.byte	0x8d
+	.byte	0x13
+	.long	0xa5a
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x7
+	.string	"n"
+	.byte	0x8e
+	.byte	0xc
+	.long	0x32
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x4
+	.string	"k"
+	.byte	0x91
+	.byte	0xc
+	.long	0x32
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x18
+	.long	.LLRL26
+	.long	0xa45
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x92
+	.byte	0x1b
+	.long	0x534
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x21
+	.long	0xdff
+	.quad	.LBI44
+	.byte	.LVU159
+	.long	.LLRL28
+	.byte	0x97
+	.byte	0x1f
+	.uleb128 0x12
+	.long	0xe10
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL46
+	.long	0xda8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0xc9
+	.uleb128 0x15
+	.long	.LASF1587
+	.byte	0x80
+	.byte	0xf
+	.long	0x32
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xacc
+	.uleb128 0x19
+	.string	"t"
+	.byte	0x81
+	.byte	0x17
+	.long	0x703
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x84
+	.byte	0xc
+	.long	0x32
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x18
+	.long	.LLRL21
+	.long	0xab7
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x85
+	.byte	0x1b
+	.long	0x534
+	.long	.LLST22
+	.long	.LVUS22
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL39
+	.long	0xda8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1588
+	.byte	0x74
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb4d
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x75
+	.byte	0x12
+	.long	0x3e0
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x7
+	.string	"c"
+	.byte	0x76
+	.byte	0xa
+	.long	0x5d
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x4
+	.string	"t"
+	.byte	0x78
+	.byte	0x17
+	.long	0x703
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x11
+	.quad	.LVL35
+	.long	0xda8
+	.long	0xb33
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL36
+	.long	0xc9c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1589
+	.byte	0x66
+	.byte	0xc
+	.long	0x413
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbe8
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x67
+	.byte	0x12
+	.long	0x3e0
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x22
+	.long	.LASF1590
+	.byte	0x68
+	.byte	0xc
+	.long	0x32
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x4
+	.string	"t"
+	.byte	0x6a
+	.byte	0x17
+	.long	0x703
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x6f
+	.byte	0x16
+	.long	0x534
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x11
+	.quad	.LVL26
+	.long	0xda8
+	.long	0xbcc
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LVL27
+	.long	0xc9c
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1591
+	.byte	0x60
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc24
+	.uleb128 0x19
+	.string	"s"
+	.byte	0x61
+	.byte	0x12
+	.long	0x3e0
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2d
+	.quad	.LVL23
+	.long	0xda8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1592
+	.byte	0x54
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc9c
+	.uleb128 0x7
+	.string	"t"
+	.byte	0x54
+	.byte	0x2b
+	.long	0x703
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x7
+	.string	"c"
+	.byte	0x54
+	.byte	0x3f
+	.long	0x534
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2e
+	.quad	.LBB40
+	.quad	.LBE40-.LBB40
+	.uleb128 0x24
+	.long	.LASF1564
+	.byte	0x57
+	.byte	0x1a
+	.long	0x534
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x1b
+	.quad	.LVL19
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF1598
+	.byte	0x1
+	.byte	0x34
+	.byte	0xc
+	.long	0x413
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xda8
+	.uleb128 0x7
+	.string	"t"
+	.byte	0x34
+	.byte	0x28
+	.long	0x703
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x22
+	.long	.LASF1590
+	.byte	0x34
+	.byte	0x32
+	.long	0x32
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x4
+	.string	"c"
+	.byte	0x36
+	.byte	0x16
+	.long	0x534
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x24
+	.long	.LASF1565
+	.byte	0x3b
+	.byte	0xc
+	.long	0x32
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x30
+	.long	0xe1b
+	.quad	.LBI33
+	.byte	.LVU27
+	.long	.LLRL5
+	.byte	0x1
+	.byte	0x41
+	.byte	0x9
+	.long	0xd8d
+	.uleb128 0x12
+	.long	0xe26
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x31
+	.long	0xe31
+	.quad	.LBI35
+	.byte	.LVU29
+	.quad	.LBB35
+	.quad	.LBE35-.LBB35
+	.byte	0x2
+	.value	0x1bb
+	.byte	0x5
+	.uleb128 0x12
+	.long	0xe46
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x12
+	.long	0xe3c
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x32
+	.long	0xe50
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.uleb128 0x33
+	.long	0xe51
+	.long	.LLST9
+	.long	.LVUS9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL9
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x1
+	.byte	0x30
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 24
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1593
+	.byte	0x27
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdff
+	.uleb128 0x19
+	.string	"t"
+	.byte	0x27
+	.byte	0x26
+	.long	0x703
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x34
+	.long	0xdff
+	.quad	.LBI31
+	.byte	.LVU6
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x38
+	.uleb128 0x12
+	.long	0xe10
+	.long	.LLST0
+	.long	.LVUS0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF1599
+	.byte	0x1
+	.byte	0x1f
+	.byte	0xe
+	.long	0x9a
+	.byte	0x1
+	.long	0xe1b
+	.uleb128 0x36
+	.string	"c"
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x2a
+	.long	0x534
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1594
+	.value	0x1b9
+	.long	0xe31
+	.uleb128 0x1c
+	.string	"s"
+	.value	0x1b9
+	.byte	0x34
+	.long	0x3e0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1595
+	.value	0x1a9
+	.long	0xe60
+	.uleb128 0x1c
+	.string	"s"
+	.value	0x1a9
+	.byte	0x35
+	.long	0x3e0
+	.uleb128 0x1c
+	.string	"e"
+	.value	0x1a9
+	.byte	0x41
+	.long	0x70
+	.uleb128 0x37
+	.uleb128 0x38
+	.string	"_xp"
+	.byte	0x2
+	.value	0x1ac
+	.byte	0x2d
+	.long	0xe60
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL100-1-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LFE32-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 0
+	.uleb128 .LVU299
+	.uleb128 .LVU299
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 0
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL95-1-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU296
+	.uleb128 .LVU305
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS42:
+	.uleb128 0
+	.uleb128 .LVU264
+	.uleb128 .LVU264
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 0
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU262
+	.uleb128 .LVU265
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL83-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU265
+	.uleb128 0
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LFE30-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU268
+	.uleb128 .LVU272
+	.uleb128 .LVU272
+	.uleb128 .LVU288
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU271
+	.uleb128 .LVU288
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU274
+	.uleb128 .LVU276
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU255
+	.uleb128 .LVU255
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LFE29-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU182
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU256
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU183
+	.uleb128 .LVU232
+	.uleb128 .LVU235
+	.uleb128 .LVU236
+	.uleb128 .LVU236
+	.uleb128 .LVU242
+	.uleb128 .LVU242
+	.uleb128 .LVU250
+	.uleb128 .LVU250
+	.uleb128 .LVU254
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU185
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU215
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU186
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU208
+	.uleb128 .LVU208
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU215
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU215
+	.uleb128 .LVU219
+	.uleb128 .LVU220
+	.uleb128 .LVU232
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU223
+	.uleb128 .LVU232
+	.uleb128 .LVU236
+	.uleb128 .LVU240
+	.uleb128 .LVU240
+	.uleb128 .LVU244
+	.uleb128 .LVU244
+	.uleb128 .LVU250
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x6
+	.byte	0x73
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU188
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU215
+	.uleb128 .LVU250
+	.uleb128 .LVU252
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU227
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU230
+	.uleb128 .LVU230
+	.uleb128 .LVU232
+	.uleb128 .LVU247
+	.uleb128 .LVU250
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS23:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS24:
+	.uleb128 0
+	.uleb128 .LVU144
+	.uleb128 .LVU144
+	.uleb128 0
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL46-1-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU145
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LFE28-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU148
+	.uleb128 .LVU172
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU159
+	.uleb128 .LVU161
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU126
+	.uleb128 .LVU131
+	.uleb128 .LVU131
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE27-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU129
+	.uleb128 .LVU139
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU110
+	.uleb128 .LVU110
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU111
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU122
+	.uleb128 .LVU122
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL36-1-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE26-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU90
+	.uleb128 .LVU93
+	.uleb128 .LVU93
+	.uleb128 .LVU105
+	.uleb128 .LVU105
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL27-1-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LFE25-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU96
+	.uleb128 .LVU101
+	.uleb128 .LVU101
+	.uleb128 .LVU104
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 72
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU79
+	.uleb128 .LVU80
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL19-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LFE23-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU77
+	.uleb128 .LVU81
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU69
+	.uleb128 .LVU69
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LFE22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU17
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU44
+	.uleb128 .LVU49
+	.uleb128 .LVU67
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU23
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU42
+	.uleb128 .LVU42
+	.uleb128 .LVU67
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU27
+	.uleb128 .LVU38
+	.uleb128 .LVU44
+	.uleb128 .LVU46
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU29
+	.uleb128 .LVU38
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU29
+	.uleb128 .LVU38
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU35
+	.uleb128 .LVU38
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 .LVU6
+	.uleb128 .LVU8
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB33-.Ltext0
+	.uleb128 .LBE33-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB39-.Ltext0
+	.uleb128 .LBE39-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB41-.Ltext0
+	.uleb128 .LBE41-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB42-.Ltext0
+	.uleb128 .LBE42-.Ltext0
+	.byte	0
+.LLRL26:
+	.byte	0x4
+	.uleb128 .LBB43-.Ltext0
+	.uleb128 .LBE43-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB48-.Ltext0
+	.uleb128 .LBE48-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB44-.Ltext0
+	.uleb128 .LBE44-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB47-.Ltext0
+	.uleb128 .LBE47-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB50-.Ltext0
+	.uleb128 .LBE50-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB51-.Ltext0
+	.uleb128 .LBE51-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB52-.Ltext0
+	.uleb128 .LBE52-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB53-.Ltext0
+	.uleb128 .LBE53-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB54-.Ltext0
+	.uleb128 .LBE54-.Ltext0
+	.byte	0
+.LLRL47:
+	.byte	0x4
+	.uleb128 .LBB56-.Ltext0
+	.uleb128 .LBE56-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB59-.Ltext0
+	.uleb128 .LBE59-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF386
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF514
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF540
+	.file 22 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x17
+	.file 24 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF541
+	.file 25 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF676
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF677
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF719
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0xd9
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF816
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF441
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF876
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1201
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1202
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1207
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1208
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1218
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1219
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1220
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1221
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF695
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1222
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1223
+	.file 44 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1224
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1241
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1254
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1259
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1262
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1263
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1280
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1281
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1282
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1294
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1301
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1302
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1306
+	.byte	0x4
+	.file 62 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1307
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1308
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 63 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 64 "/usr/include/uchar.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1349
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1350
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 67 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1410
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 68 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1413
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 69 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1416
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 70 "./include/va_print/rope_utf8.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1436
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1515
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF437
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF451
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF452
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF513
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF531
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF539
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF576
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF675
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF679
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF680
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF682
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF684
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF686
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF688
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF690
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF692
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF696
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF714
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.23.e34f3a5c100123d9385c8b91a86a6783,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF738
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF800
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF812
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.210.b7626dff4e8645cee35c44183ab9e1fb,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF815
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF831
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF873
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF875
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.221.1c4b8ffb35d9df7e3e05ff92aa0722d4,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF696
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.233.3c1174b0f8677cd60103c1484341f85e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF894
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1200
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.unistd.h.1108.0d9b49b7dac9f8f76c53696f4c15e077,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF1206
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.0cbe0b4ca2d1120a4ebe4557d72ed5f8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1217
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1228
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1230
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1232
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1236
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1240
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1253
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1258
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1261
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1264
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1275
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1279
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1293
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1297
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1300
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uio_lim.h.20.58ca37993639426c959d6d02e0db4a3a,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1305
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1342
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1347
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF695
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1341
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1409
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1412
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1415
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1435
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rope.h.26.f0af04571e11f5a39e85677a90e9d5ba,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1438
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.13.ba8b097355bd637e9189dfa7d96daa61,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1513
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF1400:
+	.string	"VA_U_EOT -1U"
+.LASF755:
+	.string	"_POSIX_THREADS 200809L"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1375:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF1289:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF807:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF1190:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF1133:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF960:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF1008:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF1332:
+	.string	"_WCHAR_T_DEFINED "
+.LASF571:
+	.string	"ESPIPE 29"
+.LASF454:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF918:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF916:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF1121:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF481:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF666:
+	.string	"EMEDIUMTYPE 124"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1414:
+	.string	"va_char16_p_format utf16"
+.LASF679:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF955:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF823:
+	.string	"__SQUAD_TYPE long int"
+.LASF1459:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF1466:
+	.string	"VA_SIGN_PLUS 2"
+.LASF442:
+	.string	"__USE_MISC 1"
+.LASF1226:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF786:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF733:
+	.string	"_XOPEN_XPG2 1"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF885:
+	.string	"R_OK 4"
+.LASF882:
+	.string	"__pid_t_defined "
+.LASF1225:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1481:
+	.string	"VA_STATE_PREC 3"
+.LASF987:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF1482:
+	.string	"VA_STATE_SKIP 4"
+.LASF505:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF651:
+	.string	"ETOOMANYREFS 109"
+.LASF980:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF983:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF1559:
+	.string	"_Bool"
+.LASF1433:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF516:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF947:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF674:
+	.string	"ERFKILL 132"
+.LASF1271:
+	.string	"NFDBITS __NFDBITS"
+.LASF458:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF498:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1070:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF1117:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF948:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF1396:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF971:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF634:
+	.string	"ENOPROTOOPT 92"
+.LASF1489:
+	.string	"VA_QUOTE_kk 5"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF676:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF408:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF783:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF471:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF583:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF647:
+	.string	"ENOBUFS 105"
+.LASF1324:
+	.string	"__WCHAR_T__ "
+.LASF594:
+	.string	"EBADE 52"
+.LASF1081:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF566:
+	.string	"EMFILE 24"
+.LASF1125:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF1545:
+	.string	"va_read_iter_t"
+.LASF1343:
+	.string	"_STDBOOL_H "
+.LASF542:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF618:
+	.string	"ENOTUNIQ 76"
+.LASF1093:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF479:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1162:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF929:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF754:
+	.string	"_XOPEN_SHM 1"
+.LASF1237:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF374:
+	.string	"linux 1"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF873:
+	.string	"__FD_SETSIZE 1024"
+.LASF831:
+	.string	"__STD_TYPE typedef"
+.LASF865:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF460:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1564:
+	.string	"next"
+.LASF975:
+	.string	"_SC_POLL _SC_POLL"
+.LASF626:
+	.string	"EILSEQ 84"
+.LASF1291:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1076:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF560:
+	.string	"EXDEV 18"
+.LASF1313:
+	.string	"_T_PTRDIFF_ "
+.LASF899:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF565:
+	.string	"ENFILE 23"
+.LASF820:
+	.string	"__U32_TYPE unsigned int"
+.LASF1405:
+	.string	"VA_E_ENCODE 3"
+.LASF1197:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1562:
+	.string	"va_rope_chunk_t"
+.LASF1398:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF610:
+	.string	"EADV 68"
+.LASF1189:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF792:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF1500:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF889:
+	.string	"SEEK_SET 0"
+.LASF662:
+	.string	"EISNAM 120"
+.LASF1576:
+	.string	"render_quote"
+.LASF406:
+	.string	"__USE_MISC"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF902:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF956:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1214:
+	.string	"__nlink_t_defined "
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF780:
+	.string	"_POSIX_SHELL 1"
+.LASF750:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF1573:
+	.string	"delim"
+.LASF1323:
+	.string	"__wchar_t__ "
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF568:
+	.string	"ETXTBSY 26"
+.LASF1382:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF397:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF802:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF517:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF840:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1066:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1195:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF958:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1069:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1451:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF869:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF801:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF477:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1546:
+	.string	"va_stream_t"
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF708:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1556:
+	.string	"refill"
+.LASF1095:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF1552:
+	.string	"va_quotations_t"
+.LASF1384:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF796:
+	.string	"_POSIX_TRACE -1"
+.LASF581:
+	.string	"ENOTEMPTY 39"
+.LASF1571:
+	.string	"va_stream_rope_t"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF456:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1266:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1380:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF720:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1334:
+	.string	"___int_wchar_t_h "
+.LASF559:
+	.string	"EEXIST 17"
+.LASF991:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1105:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1239:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1580:
+	.string	"memcpy"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF727:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF500:
+	.string	"__always_inline"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF967:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF760:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF1596:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF598:
+	.string	"EBADRQC 56"
+.LASF742:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF772:
+	.string	"_LFS_LARGEFILE 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF907:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF985:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF1447:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF1038:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF787:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1487:
+	.string	"VA_QUOTE_Q 3"
+.LASF1599:
+	.string	"chunk_data"
+.LASF1146:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF1575:
+	.string	"check_flush"
+.LASF990:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF1198:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1249:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1036:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF1118:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF1241:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF483:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF826:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF608:
+	.string	"EREMOTE 66"
+.LASF906:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF1050:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF1250:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF642:
+	.string	"ENETDOWN 100"
+.LASF1258:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF473:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF533:
+	.string	"__stub_chflags "
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1350:
+	.string	"____mbstate_t_defined 1"
+.LASF564:
+	.string	"EINVAL 22"
+.LASF1346:
+	.string	"false 0"
+.LASF1107:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1462:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF1477:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF585:
+	.string	"EIDRM 43"
+.LASF712:
+	.string	"_GCC_SIZE_T "
+.LASF537:
+	.string	"__stub_setlogin "
+.LASF946:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF1484:
+	.string	"VA_QUOTE_NONE 0"
+.LASF1088:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF539:
+	.string	"__stub_stty "
+.LASF1454:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF438:
+	.string	"__WORDSIZE 64"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1144:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF794:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1104:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF879:
+	.string	"__uid_t_defined "
+.LASF660:
+	.string	"ENOTNAM 118"
+.LASF1498:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF545:
+	.string	"ESRCH 3"
+.LASF646:
+	.string	"ECONNRESET 104"
+.LASF803:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF743:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF966:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF1494:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1046:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF819:
+	.string	"__S32_TYPE int"
+.LASF1506:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF1083:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1223:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1367:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF1537:
+	.string	"has_size"
+.LASF512:
+	.string	"__attribute_copy__"
+.LASF1598:
+	.string	"make_room"
+.LASF756:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF682:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF832:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF725:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF493:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF593:
+	.string	"EL2HLT 51"
+.LASF1007:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF1211:
+	.string	"__ino_t_defined "
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1236:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1325:
+	.string	"_WCHAR_T "
+.LASF1099:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF693:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF551:
+	.string	"EBADF 9"
+.LASF1092:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1532:
+	.string	"type"
+.LASF1229:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1516:
+	.string	"long unsigned int"
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1262:
+	.string	"__timeval_defined 1"
+.LASF1142:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF624:
+	.string	"ELIBMAX 82"
+.LASF1319:
+	.string	"_GCC_PTRDIFF_T "
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF701:
+	.string	"_T_SIZE_ "
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1175:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF1164:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF782:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF1404:
+	.string	"VA_E_DECODE 2"
+.LASF386:
+	.string	"_ERRNO_H 1"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1381:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF1153:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF605:
+	.string	"ENOSR 63"
+.LASF722:
+	.string	"_UNISTD_H 1"
+.LASF430:
+	.string	"__USE_POSIX 1"
+.LASF735:
+	.string	"_XOPEN_XPG4 1"
+.LASF392:
+	.string	"__USE_POSIX"
+.LASF1025:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF1335:
+	.string	"__INT_WCHAR_T_H "
+.LASF878:
+	.string	"__gid_t_defined "
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1161:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1059:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF524:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF908:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF426:
+	.string	"_POSIX_SOURCE"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF932:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF1072:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF1272:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1303:
+	.string	"__iovec_defined 1"
+.LASF799:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF1206:
+	.string	"F_TEST 3"
+.LASF1181:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF475:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1426:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF1173:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF683:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF510:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF1213:
+	.string	"__mode_t_defined "
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1383:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF1463:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF1468:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF1017:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF627:
+	.string	"ERESTART 85"
+.LASF994:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF1010:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1445:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF1486:
+	.string	"VA_QUOTE_q 2"
+.LASF350:
+	.string	"__amd64 1"
+.LASF1519:
+	.string	"unsigned char"
+.LASF1431:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF525:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1320:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF944:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF703:
+	.string	"__SIZE_T "
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF896:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF1425:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF359:
+	.string	"__k8 1"
+.LASF1399:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF1448:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF549:
+	.string	"E2BIG 7"
+.LASF1071:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1569:
+	.string	"chunk_size"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF390:
+	.string	"__USE_ISOC95"
+.LASF389:
+	.string	"__USE_ISOC99"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF901:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF1455:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF1536:
+	.string	"transcode"
+.LASF757:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1427:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF548:
+	.string	"ENXIO 6"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1372:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF1222:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF1312:
+	.string	"_PTRDIFF_T "
+.LASF1137:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF521:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1234:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF399:
+	.string	"__USE_XOPEN2K"
+.LASF395:
+	.string	"__USE_POSIX199506"
+.LASF461:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF1029:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF631:
+	.string	"EDESTADDRREQ 89"
+.LASF1252:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF904:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF1401:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF739:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1152:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF499:
+	.string	"__wur "
+.LASF1452:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF1302:
+	.string	"__have_pthread_attr_t 1"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF462:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1554:
+	.string	"init"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1430:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF1534:
+	.string	"set_chunk_mode"
+.LASF777:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF1483:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF1218:
+	.string	"__clock_t_defined 1"
+.LASF1402:
+	.string	"VA_E_OK 0"
+.LASF420:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1331:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1037:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF842:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF961:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF1080:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1357:
+	.string	"VA_EAT(...) "
+.LASF1005:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF805:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1423:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF1167:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF1265:
+	.string	"__NFDBITS"
+.LASF1348:
+	.string	"_UCHAR_H 1"
+.LASF883:
+	.string	"__intptr_t_defined "
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF515:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1588:
+	.string	"va_rope_put"
+.LASF472:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF726:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF377:
+	.string	"unix 1"
+.LASF630:
+	.string	"ENOTSOCK 88"
+.LASF1060:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF824:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1592:
+	.string	"free_chunks"
+.LASF402:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF612:
+	.string	"ECOMM 70"
+.LASF1480:
+	.string	"VA_STATE_WIDTH 2"
+.LASF1221:
+	.string	"__timer_t_defined 1"
+.LASF997:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF577:
+	.string	"EDEADLK 35"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF623:
+	.string	"ELIBSCN 81"
+.LASF441:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1260:
+	.string	"____sigset_t_defined "
+.LASF1224:
+	.string	"_ENDIAN_H 1"
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF613:
+	.string	"EPROTO 71"
+.LASF1503:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF973:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF409:
+	.string	"__USE_GNU"
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1048:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF552:
+	.string	"ECHILD 10"
+.LASF595:
+	.string	"EBADR 53"
+.LASF713:
+	.string	"_SIZET_ "
+.LASF1368:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF1227:
+	.string	"__BIG_ENDIAN 4321"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF729:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF1026:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF1094:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF1393:
+	.string	"VA_U_BOM 0xfeff"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1406:
+	.string	"VA_E_TRUNC 4"
+.LASF411:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF830:
+	.string	"__U64_TYPE unsigned long int"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF874:
+	.string	"_BITS_TIME64_H 1"
+.LASF1126:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF854:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF485:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1434:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1565:
+	.string	"size"
+.LASF404:
+	.string	"__USE_LARGEFILE64"
+.LASF781:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF699:
+	.string	"_SIZE_T "
+.LASF501:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF818:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1246:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF496:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1073:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF530:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF486:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF643:
+	.string	"ENETUNREACH 101"
+.LASF415:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1347:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1100:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF1042:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF1039:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF1457:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF992:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF1415:
+	.string	"va_char16_p_decode utf16"
+.LASF1524:
+	.string	"size_t"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1235:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1135:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF604:
+	.string	"ETIME 62"
+.LASF576:
+	.string	"ERANGE 34"
+.LASF639:
+	.string	"EAFNOSUPPORT 97"
+.LASF856:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF915:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF534:
+	.string	"__stub_fchflags "
+.LASF1505:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF822:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF812:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF716:
+	.string	"NULL"
+.LASF1539:
+	.string	"str_prefix"
+.LASF1294:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF396:
+	.string	"__USE_XOPEN"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF419:
+	.string	"_DEFAULT_SOURCE"
+.LASF418:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1574:
+	.string	"check_quote"
+.LASF1469:
+	.string	"VA_MODE_NORM 0"
+.LASF1091:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF1212:
+	.string	"__dev_t_defined "
+.LASF439:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF771:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF528:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1336:
+	.string	"_GCC_WCHAR_T "
+.LASF513:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF982:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF711:
+	.string	"___int_size_t_h "
+.LASF835:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF543:
+	.string	"EPERM 1"
+.LASF670:
+	.string	"EKEYREVOKED 128"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF520:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1497:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF644:
+	.string	"ENETRESET 102"
+.LASF695:
+	.string	"__need_size_t "
+.LASF1138:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF1295:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF773:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF423:
+	.string	"__USE_ISOC99 1"
+.LASF1339:
+	.string	"_BSD_WCHAR_T_"
+.LASF1065:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF1001:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF1456:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1043:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF704:
+	.string	"_SIZE_T_ "
+.LASF1233:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF744:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF749:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1409:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF886:
+	.string	"W_OK 2"
+.LASF951:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF715:
+	.string	"__need_size_t"
+.LASF1567:
+	.string	"first"
+.LASF1238:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1470:
+	.string	"VA_MODE_B32 1"
+.LASF976:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF588:
+	.string	"EL3HLT 46"
+.LASF1159:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF468:
+	.string	"__BEGIN_DECLS "
+.LASF1166:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1309:
+	.string	"_STDDEF_H "
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1040:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF398:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1490:
+	.string	"VA_QUOTE_qq 6"
+.LASF465:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF600:
+	.string	"EDEADLOCK EDEADLK"
+.LASF1475:
+	.string	"VA_MODE_X6 6"
+.LASF1140:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1395:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF535:
+	.string	"__stub_gtty "
+.LASF748:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF868:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1257:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1098:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF709:
+	.string	"_SIZE_T_DECLARED "
+.LASF761:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF925:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF1151:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF870:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF970:
+	.string	"_SC_PII _SC_PII"
+.LASF1594:
+	.string	"va_stream_set_full"
+.LASF999:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF1278:
+	.string	"__fsblkcnt_t_defined "
+.LASF1051:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1032:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF774:
+	.string	"_LFS64_STDIO 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1018:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1103:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1279:
+	.string	"__fsfilcnt_t_defined "
+.LASF1419:
+	.string	"VA_SIGIL '~'"
+.LASF1171:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF941:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF1541:
+	.string	"iovec"
+.LASF1587:
+	.string	"va_rope_len"
+.LASF1288:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF447:
+	.string	"__GNU_LIBRARY__"
+.LASF1543:
+	.string	"vtab"
+.LASF1141:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF443:
+	.string	"__USE_ATFILE 1"
+.LASF1134:
+	.string	"_CS_PATH _CS_PATH"
+.LASF747:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF602:
+	.string	"ENOSTR 60"
+.LASF972:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF580:
+	.string	"ENOSYS 38"
+.LASF1446:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF884:
+	.string	"__socklen_t_defined "
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1219:
+	.string	"__clockid_t_defined 1"
+.LASF1102:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF888:
+	.string	"F_OK 0"
+.LASF688:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1504:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF731:
+	.string	"_XOPEN_VERSION 700"
+.LASF649:
+	.string	"ENOTCONN 107"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1276:
+	.string	"__blksize_t_defined "
+.LASF1525:
+	.string	"__ssize_t"
+.LASF1485:
+	.string	"VA_QUOTE_k 1"
+.LASF1012:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF665:
+	.string	"ENOMEDIUM 123"
+.LASF459:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF635:
+	.string	"EPROTONOSUPPORT 93"
+.LASF765:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF453:
+	.string	"__PMT"
+.LASF1337:
+	.string	"_WCHAR_T_DECLARED "
+.LASF689:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF900:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1292:
+	.string	"__LOCK_ALIGNMENT "
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF554:
+	.string	"ENOMEM 12"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1465:
+	.string	"VA_SIGN_SPACE 1"
+.LASF1579:
+	.string	"va_quotation_t"
+.LASF745:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF984:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF1269:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1514:
+	.string	"IOV_BATCH 64"
+.LASF1052:
+	.string	"_SC_BASE _SC_BASE"
+.LASF550:
+	.string	"ENOEXEC 8"
+.LASF784:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1196:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF1194:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF880:
+	.string	"__off_t_defined "
+.LASF641:
+	.string	"EADDRNOTAVAIL 99"
+.LASF506:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1022:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF1245:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1547:
+	.string	"va_stream"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF1180:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1178:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF821:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF579:
+	.string	"ENOLCK 37"
+.LASF628:
+	.string	"ESTRPIPE 86"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF914:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1429:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF449:
+	.string	"__GLIBC__ 2"
+.LASF1016:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1329:
+	.string	"_WCHAR_T_ "
+.LASF767:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF949:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF1287:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1120:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF1366:
+	.string	"VA_F(...) VA_H"
+.LASF463:
+	.string	"__P(args) args"
+.LASF891:
+	.string	"SEEK_END 2"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF945:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF700:
+	.string	"_SYS_SIZE_T_H "
+.LASF846:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF636:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF881:
+	.string	"__useconds_t_defined "
+.LASF1199:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1193:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF954:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF632:
+	.string	"EMSGSIZE 90"
+.LASF1027:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF1388:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF410:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1476:
+	.string	"VA_MODE_X7 7"
+.LASF1582:
+	.string	"va_rope_free"
+.LASF1437:
+	.string	"va_rope_chunk_size 16384"
+.LASF1264:
+	.string	"__suseconds_t_defined "
+.LASF857:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1281:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF668:
+	.string	"ENOKEY 126"
+.LASF1273:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1074:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF887:
+	.string	"X_OK 1"
+.LASF401:
+	.string	"__USE_XOPEN2K8"
+.LASF1511:
+	.string	"VA_QCLASS_CALL 2"
+.LASF1544:
+	.string	"va_read_iter_vtab_t"
+.LASF638:
+	.string	"EPFNOSUPPORT 96"
+.LASF1169:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF1256:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF858:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF718:
+	.string	"__need_NULL"
+.LASF1341:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF923:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF414:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF942:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF440:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF403:
+	.string	"__USE_LARGEFILE"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF741:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF645:
+	.string	"ECONNABORTED 103"
+.LASF470:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1540:
+	.string	"_pad"
+.LASF432:
+	.string	"__USE_POSIX199309 1"
+.LASF1304:
+	.string	"_BITS_UIO_LIM_H 1"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF957:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF1464:
+	.string	"VA_SIGN_NORM 0"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF962:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF469:
+	.string	"__END_DECLS "
+.LASF575:
+	.string	"EDOM 33"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1308:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF678:
+	.string	"_STRING_H 1"
+.LASF1130:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1420:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1202:
+	.string	"_GETOPT_CORE_H 1"
+.LASF843:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1298:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF648:
+	.string	"EISCONN 106"
+.LASF1019:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF1416:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF1386:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF769:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF523:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1467:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1572:
+	.string	"va_quotation_table_t"
+.LASF1517:
+	.string	"short unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1521:
+	.string	"signed char"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1058:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF590:
+	.string	"ELNRNG 48"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF697:
+	.string	"__size_t__ "
+.LASF434:
+	.string	"__USE_XOPEN2K 1"
+.LASF1441:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF1108:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF1106:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF1333:
+	.string	"_WCHAR_T_H "
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF489:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF1220:
+	.string	"__time_t_defined 1"
+.LASF1248:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1240:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF694:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF572:
+	.string	"EROFS 30"
+.LASF753:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF532:
+	.string	"__stub___compat_bdflush "
+.LASF1101:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF965:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF1054:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF809:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF1301:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF926:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF387:
+	.string	"_FEATURES_H 1"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF705:
+	.string	"_BSD_SIZE_T_ "
+.LASF507:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF928:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF491:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1492:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF1136:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF936:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF785:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF912:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF1200:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF968:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF740:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF1365:
+	.string	"VA_P(X,...) X"
+.LASF1184:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF1563:
+	.string	"va_rope_chunk"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1488:
+	.string	"VA_QUOTE_K 4"
+.LASF1275:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF814:
+	.string	"STDOUT_FILENO 1"
+.LASF844:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF541:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF910:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF527:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF836:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1408:
+	.string	"VA_E_ARGC 6"
+.LASF1204:
+	.string	"F_LOCK 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1311:
+	.string	"_ANSI_STDDEF_H "
+.LASF621:
+	.string	"ELIBACC 79"
+.LASF457:
+	.string	"__LEAF , __leaf__"
+.LASF1432:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF1538:
+	.string	"chunk_mode"
+.LASF1177:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF1392:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF1436:
+	.string	"VA_PRINT_ROPE_UTF8_H_ "
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF952:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF1593:
+	.string	"commit"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF978:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF1369:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF1128:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF813:
+	.string	"STDIN_FILENO 0"
+.LASF522:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF737:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF804:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF1362:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF1068:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF1014:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF894:
+	.string	"L_XTND SEEK_END"
+.LASF652:
+	.string	"ETIMEDOUT 110"
+.LASF838:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF974:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF890:
+	.string	"SEEK_CUR 1"
+.LASF1243:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF625:
+	.string	"ELIBEXEC 83"
+.LASF837:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1079:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF1595:
+	.string	"va_stream_set_error"
+.LASF653:
+	.string	"ECONNREFUSED 111"
+.LASF1158:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF526:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1116:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF467:
+	.string	"__ptr_t void *"
+.LASF827:
+	.string	"__SLONG32_TYPE int"
+.LASF728:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1322:
+	.string	"__need_ptrdiff_t"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF1502:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF425:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF892:
+	.string	"L_SET SEEK_SET"
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF391:
+	.string	"__USE_ISOCXX11"
+.LASF1523:
+	.string	"long int"
+.LASF986:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF920:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF1473:
+	.string	"VA_MODE_TYPE 4"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF614:
+	.string	"EMULTIHOP 72"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1157:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF417:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1280:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1009:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1435:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF480:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1064:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF1501:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF561:
+	.string	"ENODEV 19"
+.LASF1570:
+	.string	"alloc"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1585:
+	.string	"va_rope_writev"
+.LASF1285:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF586:
+	.string	"ECHRNG 44"
+.LASF464:
+	.string	"__PMT(args) args"
+.LASF1183:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF800:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF1316:
+	.string	"_PTRDIFF_T_ "
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1389:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1449:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF995:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF1203:
+	.string	"F_ULOCK 0"
+.LASF1315:
+	.string	"__PTRDIFF_T "
+.LASF1561:
+	.string	"va_window_t"
+.LASF1263:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF706:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF601:
+	.string	"EBFONT 59"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1417:
+	.string	"va_char32_p_format utf32"
+.LASF1535:
+	.string	"bulk"
+.LASF860:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1354:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF746:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF1110:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF452:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1131:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF1568:
+	.string	"last"
+.LASF1361:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF1123:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF1209:
+	.string	"_SYS_TYPES_H 1"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF736:
+	.string	"_XOPEN_UNIX 1"
+.LASF797:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF1090:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1089:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF1553:
+	.string	"va_quotations"
+.LASF848:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF864:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1531:
+	.string	"long double"
+.LASF1111:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF911:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF702:
+	.string	"_T_SIZE "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1267:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1530:
+	.string	"iov_len"
+.LASF1002:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF431:
+	.string	"__USE_POSIX2 1"
+.LASF798:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF1338:
+	.string	"__DEFINED_wchar_t "
+.LASF1460:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF1560:
+	.string	"va_stream_vtab_t"
+.LASF1359:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF476:
+	.string	"__flexarr []"
+.LASF416:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF482:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF816:
+	.string	"_BITS_TYPES_H 1"
+.LASF1496:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1493:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1205:
+	.string	"F_TLOCK 2"
+.LASF478:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF686:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1261:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF558:
+	.string	"EBUSY 16"
+.LASF1326:
+	.string	"_T_WCHAR_ "
+.LASF422:
+	.string	"__USE_ISOC11 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF940:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF428:
+	.string	"_POSIX_C_SOURCE"
+.LASF724:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF1305:
+	.string	"__IOV_MAX 1024"
+.LASF789:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF1179:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF1030:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1160:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF905:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF1597:
+	.string	"__errno_location"
+.LASF953:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF730:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF1127:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF766:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF964:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF909:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF950:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF1518:
+	.string	"char"
+.LASF1286:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1542:
+	.string	"va_read_iter"
+.LASF1149:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF1377:
+	.string	"VA_REC1() VA_REC1B"
+.LASF839:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__stub_sigreturn "
+.LASF619:
+	.string	"EBADFD 77"
+.LASF445:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF687:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1124:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF1509:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF989:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF1349:
+	.string	"__mbstate_t_defined 1"
+.LASF1578:
+	.string	"table"
+.LASF817:
+	.string	"__S16_TYPE short int"
+.LASF1020:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF1306:
+	.string	"UIO_MAXIOV __IOV_MAX"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF861:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF732:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF1251:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF429:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF495:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1356:
+	.string	"VA_NIX "
+.LASF664:
+	.string	"EDQUOT 122"
+.LASF1439:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF591:
+	.string	"EUNATCH 49"
+.LASF1584:
+	.string	"va_rope_flatten"
+.LASF1479:
+	.string	"VA_STATE_ARG 1"
+.LASF1345:
+	.string	"true 1"
+.LASF1041:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1174:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF502:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF563:
+	.string	"EISDIR 21"
+.LASF791:
+	.string	"_POSIX_IPV6 200809L"
+.LASF1063:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF1186:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF815:
+	.string	"STDERR_FILENO 2"
+.LASF851:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF707:
+	.string	"_SIZE_T_DEFINED "
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF578:
+	.string	"ENAMETOOLONG 36"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1413:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF1112:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF876:
+	.string	"__STD_TYPE"
+.LASF1021:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF862:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1139:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF834:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF828:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF714:
+	.string	"__size_t "
+.LASF696:
+	.string	"__need_NULL "
+.LASF1187:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF758:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1047:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF1391:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF1555:
+	.string	"finish"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF934:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF717:
+	.string	"NULL ((void *)0)"
+.LASF1508:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF1053:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF1300:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1307:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF1168:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1067:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF540:
+	.string	"_BITS_ERRNO_H 1"
+.LASF1024:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF488:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF529:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF998:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF921:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF1259:
+	.string	"__sigset_t_defined 1"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1155:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF518:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1358:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF503:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1340:
+	.string	"__need_wchar_t"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1314:
+	.string	"_T_PTRDIFF "
+.LASF455:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF617:
+	.string	"EOVERFLOW 75"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1583:
+	.string	"va_rope_clear"
+.LASF597:
+	.string	"ENOANO 55"
+.LASF684:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF567:
+	.string	"ENOTTY 25"
+.LASF672:
+	.string	"EOWNERDEAD 130"
+.LASF372:
+	.string	"__linux 1"
+.LASF451:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF596:
+	.string	"EXFULL 54"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF531:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1215:
+	.string	"__id_t_defined "
+.LASF659:
+	.string	"EUCLEAN 117"
+.LASF1558:
+	.string	"put_len"
+.LASF1062:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF1192:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF640:
+	.string	"EADDRINUSE 98"
+.LASF1013:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF553:
+	.string	"EAGAIN 11"
+.LASF1075:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF1297:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1084:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF556:
+	.string	"EFAULT 14"
+.LASF1216:
+	.string	"__daddr_t_defined "
+.LASF504:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF589:
+	.string	"EL3RST 47"
+.LASF752:
+	.string	"_XOPEN_REALTIME 1"
+.LASF1011:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF919:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF1085:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF1387:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1590:
+	.string	"need"
+.LASF1230:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1244:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF413:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1450:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF1035:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF788:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF1283:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF405:
+	.string	"__USE_FILE_OFFSET64"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1515:
+	.string	"CHUNK_HEAD sizeof(va_rope_chunk_t)"
+.LASF1351:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF810:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF1586:
+	.string	"va_rope_iovec"
+.LASF1443:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF1548:
+	.string	"width"
+.LASF938:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF993:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF669:
+	.string	"EKEYEXPIRED 127"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1247:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1495:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF996:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF849:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF893:
+	.string	"L_INCR SEEK_CUR"
+.LASF1228:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1513:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF1188:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1526:
+	.string	"ssize_t"
+.LASF811:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF859:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF437:
+	.string	"_ATFILE_SOURCE 1"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1412:
+	.string	"va_char_p_decode utf8"
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1330:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1551:
+	.string	"quote"
+.LASF1033:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF490:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1082:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1290:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1589:
+	.string	"va_rope_refill"
+.LASF1176:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF763:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1472:
+	.string	"VA_MODE_PTR 3"
+.LASF673:
+	.string	"ENOTRECOVERABLE 131"
+.LASF680:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1208:
+	.string	"_SYS_UIO_H 1"
+.LASF393:
+	.string	"__USE_POSIX2"
+.LASF1385:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF677:
+	.string	"errno (*__errno_location ())"
+.LASF629:
+	.string	"EUSERS 87"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF1015:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF943:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF1453:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF615:
+	.string	"EDOTDOT 73"
+.LASF620:
+	.string	"EREMCHG 78"
+.LASF1045:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF1352:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF1119:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF1055:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF1533:
+	.string	"take"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF637:
+	.string	"EOPNOTSUPP 95"
+.LASF825:
+	.string	"__SWORD_TYPE long int"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF400:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1078:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1378:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF1277:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF935:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF1232:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1327:
+	.string	"_T_WCHAR "
+.LASF1172:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF569:
+	.string	"EFBIG 27"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF867:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1310:
+	.string	"_STDDEF_H_ "
+.LASF1113:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF875:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF808:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF592:
+	.string	"ENOCSI 50"
+.LASF609:
+	.string	"ENOLINK 67"
+.LASF1115:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF871:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1284:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1006:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF599:
+	.string	"EBADSLT 57"
+.LASF927:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF959:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF633:
+	.string	"EPROTOTYPE 91"
+.LASF979:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1185:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF1317:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1328:
+	.string	"__WCHAR_T "
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF898:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF1201:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF1210:
+	.string	"__u_char_defined "
+.LASF1411:
+	.string	"va_char_p_format utf8"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1255:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF1268:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1371:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF1355:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF963:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF1527:
+	.string	"long long unsigned int"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF872:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1474:
+	.string	"VA_MODE_STAT 5"
+.LASF738:
+	.string	"_XOPEN_LEGACY 1"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF917:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF663:
+	.string	"EREMOTEIO 121"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1114:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF690:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF922:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1374:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF1077:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF508:
+	.string	"__restrict_arr __restrict"
+.LASF1034:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF1191:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF1410:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF751:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF1577:
+	.string	"render_flush"
+.LASF1507:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF661:
+	.string	"ENAVAIL 119"
+.LASF433:
+	.string	"__USE_POSIX199506 1"
+.LASF895:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF977:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF536:
+	.string	"__stub_revoke "
+.LASF1044:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF509:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF547:
+	.string	"EIO 5"
+.LASF723:
+	.string	"_POSIX_VERSION 200809L"
+.LASF1087:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF657:
+	.string	"EINPROGRESS 115"
+.LASF1148:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF435:
+	.string	"__USE_XOPEN2K8 1"
+.LASF847:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF685:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1056:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF573:
+	.string	"EMLINK 31"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF778:
+	.string	"_POSIX_REGEXP 1"
+.LASF913:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF866:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF721:
+	.string	"_STRINGS_H 1"
+.LASF1097:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF877:
+	.string	"__ssize_t_defined "
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1028:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF436:
+	.string	"_ATFILE_SOURCE"
+.LASF1394:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF675:
+	.string	"EHWPOISON 133"
+.LASF1491:
+	.string	"VA_QUOTE_QQ 7"
+.LASF1461:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF1442:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF1397:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1274:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF557:
+	.string	"ENOTBLK 15"
+.LASF924:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF691:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1109:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF484:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF388:
+	.string	"__USE_ISOC11"
+.LASF1478:
+	.string	"VA_STATE_INIT 0"
+.LASF937:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF1293:
+	.string	"__ONCE_ALIGNMENT "
+.LASF775:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF427:
+	.string	"_POSIX_SOURCE 1"
+.LASF1061:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF570:
+	.string	"ENOSPC 28"
+.LASF1282:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF790:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF1376:
+	.string	"VA_REC0() VA_REC0B"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1379:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF1344:
+	.string	"bool _Bool"
+.LASF1318:
+	.string	"___int_ptrdiff_t_h "
+.LASF1150:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF511:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF863:
+	.string	"__TIMER_T_TYPE void *"
+.LASF734:
+	.string	"_XOPEN_XPG3 1"
+.LASF562:
+	.string	"ENOTDIR 20"
+.LASF582:
+	.string	"ELOOP 40"
+.LASF1424:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1591:
+	.string	"va_rope_finish"
+.LASF1510:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF1242:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1581:
+	.string	"writev"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF448:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1217:
+	.string	"__key_t_defined "
+.LASF1528:
+	.string	"long long int"
+.LASF606:
+	.string	"ENONET 64"
+.LASF853:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1096:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF1373:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF1086:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF988:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF1182:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF654:
+	.string	"EHOSTDOWN 112"
+.LASF793:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1049:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF1254:
+	.string	"_SYS_SELECT_H 1"
+.LASF1353:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF1403:
+	.string	"VA_E_NULL 1"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF776:
+	.string	"_POSIX_CPUTIME 0"
+.LASF710:
+	.string	"__DEFINED_size_t "
+.LASF1165:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF622:
+	.string	"ELIBBAD 80"
+.LASF1003:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF1296:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1422:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1428:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1143:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF492:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF616:
+	.string	"EBADMSG 74"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF546:
+	.string	"EINTR 4"
+.LASF1549:
+	.string	"prec"
+.LASF607:
+	.string	"ENOPKG 65"
+.LASF850:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1566:
+	.string	"used"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1363:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF407:
+	.string	"__USE_ATFILE"
+.LASF1132:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF611:
+	.string	"ESRMNT 69"
+.LASF671:
+	.string	"EKEYREJECTED 129"
+.LASF1438:
+	.string	"VA_STREAM_ROPE(M) ((va_stream_rope_t){ VA_STREAM(&va_rope_vtab_utf8), NULL, NULL, va_rope_chunk_size, (M) })"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1004:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF1299:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF375:
+	.string	"__unix 1"
+.LASF514:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1147:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF933:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF544:
+	.string	"ENOENT 2"
+.LASF494:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1529:
+	.string	"iov_base"
+.LASF1057:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF1418:
+	.string	"va_char32_p_decode utf32"
+.LASF1550:
+	.string	"qctxt"
+.LASF1471:
+	.string	"VA_MODE_CHAR 2"
+.LASF412:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF650:
+	.string	"ESHUTDOWN 108"
+.LASF667:
+	.string	"ECANCELED 125"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1512:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF855:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1023:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF1154:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF897:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF719:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF969:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF852:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1444:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF779:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF903:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF845:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF806:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF1342:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF939:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF1440:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF931:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF1360:
+	.string	"VA_PAR ()"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1421:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1145:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF574:
+	.string	"EPIPE 32"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF698:
+	.string	"__SIZE_T__ "
+.LASF981:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF770:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF1390:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF841:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1207:
+	.string	"VA_PRINT_ROPE_H_ "
+.LASF474:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF466:
+	.string	"__STRING(x) #x"
+.LASF1129:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF1499:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF444:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF759:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF1520:
+	.string	"unsigned int"
+.LASF656:
+	.string	"EALREADY 114"
+.LASF1170:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF1253:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF603:
+	.string	"ENODATA 61"
+.LASF1031:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF1163:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF1407:
+	.string	"VA_E_FORMAT 5"
+.LASF487:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF692:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF497:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1231:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1364:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1370:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF587:
+	.string	"EL2NSYNC 45"
+.LASF450:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF519:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF795:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF1522:
+	.string	"short int"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF768:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF1000:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF829:
+	.string	"__S64_TYPE long int"
+.LASF1122:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF1270:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1557:
+	.string	"put_fill"
+.LASF930:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF394:
+	.string	"__USE_POSIX199309"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF655:
+	.string	"EHOSTUNREACH 113"
+.LASF1321:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1156:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF424:
+	.string	"__USE_ISOC95 1"
+.LASF658:
+	.string	"ESTALE 116"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF555:
+	.string	"EACCES 13"
+.LASF1458:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF681:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF584:
+	.string	"ENOMSG 42"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/rope.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
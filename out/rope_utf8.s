@@ -0,0 +1,6143 @@
+	.file	"rope_utf8.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/rope_utf8.c"
+	.type	va_rope_put_utf8, @function
+va_rope_put_utf8:
+.LVL0:
+.LFB8:
+	.file 1 "src/rope_utf8.c"
+	.loc 1 12 1 view -0
+	.cfi_startproc
+	.loc 1 13 5 view .LVU1
+	movq	va_rope_put@GOTPCREL(%rip), %rdx
+	jmp	va_put_utf8@PLT
+.LVL1:
+	.loc 1 13 5 is_stmt 0 view .LVU2
+	.cfi_endproc
+.LFE8:
+	.size	va_rope_put_utf8, .-va_rope_put_utf8
+	.globl	va_rope_vtab_utf8
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	va_rope_vtab_utf8, @object
+	.size	va_rope_vtab_utf8, 56
+va_rope_vtab_utf8:
+	.zero	8
+	.quad	va_rope_put_utf8
+	.quad	va_rope_finish
+	.quad	va_rope_refill
+	.zero	16
+	.byte	1
+	.zero	7
+	.text
+.Letext0:
+	.file 2 "./include/va_print/base.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./include/va_print/rope.h"
+	.file 5 "./include/va_print/utf8.h"
+	.file 6 "./include/va_print/rope_utf8.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4e6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF903
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF860
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF861
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF862
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF863
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF864
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF865
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF866
+	.uleb128 0x15
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF867
+	.uleb128 0x9
+	.long	0x6c
+	.uleb128 0x16
+	.long	.LASF881
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x47
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF868
+	.uleb128 0xc
+	.long	0x6c
+	.long	0x9b
+	.uleb128 0xd
+	.long	0x47
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF869
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF870
+	.uleb128 0x17
+	.byte	0x38
+	.byte	0x2
+	.byte	0xc1
+	.byte	0x9
+	.long	0x135
+	.uleb128 0x5
+	.long	.LASF871
+	.byte	0xc4
+	.byte	0x11
+	.long	0x135
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF872
+	.byte	0xd3
+	.byte	0x10
+	.long	0x186
+	.byte	0x8
+	.uleb128 0xe
+	.string	"end"
+	.byte	0xd7
+	.long	0x19f
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF873
+	.byte	0xdb
+	.byte	0xc
+	.long	0x1af
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF874
+	.byte	0xe2
+	.byte	0xe
+	.long	0x1dc
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF875
+	.byte	0xec
+	.byte	0xe
+	.long	0x1ff
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF876
+	.byte	0xf1
+	.byte	0x13
+	.long	0x32
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF877
+	.byte	0xf5
+	.byte	0x13
+	.long	0x32
+	.byte	0x31
+	.uleb128 0x5
+	.long	.LASF878
+	.byte	0xf9
+	.byte	0x13
+	.long	0x32
+	.byte	0x32
+	.uleb128 0xe
+	.string	"enc"
+	.byte	0xfd
+	.long	0x32
+	.byte	0x33
+	.uleb128 0x5
+	.long	.LASF879
+	.byte	0xff
+	.byte	0xa
+	.long	0x8b
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.long	0x73
+	.uleb128 0xa
+	.long	0x40
+	.long	0x14e
+	.uleb128 0x1
+	.long	0x14e
+	.uleb128 0x1
+	.long	0x180
+	.byte	0
+	.uleb128 0x2
+	.long	0x153
+	.uleb128 0xf
+	.long	.LASF885
+	.byte	0x10
+	.value	0x132
+	.byte	0x10
+	.long	0x17b
+	.uleb128 0x4
+	.long	.LASF880
+	.value	0x135
+	.byte	0x20
+	.long	0x215
+	.byte	0
+	.uleb128 0x6
+	.string	"cur"
+	.value	0x138
+	.byte	0x11
+	.long	0x180
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x153
+	.uleb128 0x2
+	.long	0x185
+	.uleb128 0x18
+	.uleb128 0x2
+	.long	0x13a
+	.uleb128 0xa
+	.long	0x180
+	.long	0x19f
+	.uleb128 0x1
+	.long	0x14e
+	.uleb128 0x1
+	.long	0x78
+	.byte	0
+	.uleb128 0x2
+	.long	0x18b
+	.uleb128 0x7
+	.long	0x1af
+	.uleb128 0x1
+	.long	0x14e
+	.byte	0
+	.uleb128 0x2
+	.long	0x1a4
+	.uleb128 0xa
+	.long	0x78
+	.long	0x1d2
+	.uleb128 0x1
+	.long	0x1d2
+	.uleb128 0x1
+	.long	0x180
+	.uleb128 0x1
+	.long	0x78
+	.uleb128 0x1
+	.long	0x1d7
+	.byte	0
+	.uleb128 0x2
+	.long	0x17b
+	.uleb128 0x2
+	.long	0x78
+	.uleb128 0x2
+	.long	0x1b4
+	.uleb128 0xa
+	.long	0x78
+	.long	0x1ff
+	.uleb128 0x1
+	.long	0x6a
+	.uleb128 0x1
+	.long	0x32
+	.uleb128 0x1
+	.long	0x180
+	.uleb128 0x1
+	.long	0x78
+	.byte	0
+	.uleb128 0x2
+	.long	0x1e1
+	.uleb128 0x8
+	.long	.LASF882
+	.value	0x100
+	.byte	0x3
+	.long	0xa9
+	.uleb128 0x9
+	.long	0x204
+	.uleb128 0x2
+	.long	0x210
+	.uleb128 0x8
+	.long	.LASF883
+	.value	0x139
+	.byte	0x3
+	.long	0x153
+	.uleb128 0x8
+	.long	.LASF884
+	.value	0x169
+	.byte	0x1a
+	.long	0x232
+	.uleb128 0xf
+	.long	.LASF886
+	.byte	0x40
+	.value	0x1b7
+	.byte	0x8
+	.long	0x2a8
+	.uleb128 0x4
+	.long	.LASF880
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x3f8
+	.byte	0
+	.uleb128 0x6
+	.string	"pat"
+	.value	0x1b9
+	.byte	0x14
+	.long	0x21a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF887
+	.value	0x1ba
+	.byte	0xe
+	.long	0x40
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF888
+	.value	0x1bb
+	.byte	0xe
+	.long	0x40
+	.byte	0x1c
+	.uleb128 0x6
+	.string	"opt"
+	.value	0x1bc
+	.byte	0xe
+	.long	0x40
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF889
+	.value	0x1bd
+	.byte	0xe
+	.long	0x40
+	.byte	0x24
+	.uleb128 0x6
+	.string	"win"
+	.value	0x1be
+	.byte	0x11
+	.long	0x3ec
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF890
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x3fd
+	.byte	0x38
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF891
+	.value	0x16c
+	.byte	0x1e
+	.long	0x2b9
+	.uleb128 0x9
+	.long	0x2a8
+	.uleb128 0x19
+	.long	.LASF904
+	.uleb128 0x10
+	.byte	0x38
+	.value	0x174
+	.long	0x32f
+	.uleb128 0x4
+	.long	.LASF892
+	.value	0x176
+	.byte	0xc
+	.long	0x33f
+	.byte	0
+	.uleb128 0x6
+	.string	"put"
+	.value	0x178
+	.byte	0xc
+	.long	0x354
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF893
+	.value	0x17b
+	.byte	0xc
+	.long	0x33f
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF894
+	.value	0x182
+	.byte	0xb
+	.long	0x374
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF895
+	.value	0x186
+	.byte	0xc
+	.long	0x38e
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF896
+	.value	0x18c
+	.byte	0xc
+	.long	0x3a3
+	.byte	0x28
+	.uleb128 0x6
+	.string	"enc"
+	.value	0x191
+	.byte	0x13
+	.long	0x32
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF879
+	.value	0x192
+	.byte	0xa
+	.long	0x3a8
+	.byte	0x31
+	.byte	0
+	.uleb128 0x7
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x33a
+	.byte	0
+	.uleb128 0x2
+	.long	0x226
+	.uleb128 0x2
+	.long	0x32f
+	.uleb128 0x7
+	.long	0x354
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x40
+	.byte	0
+	.uleb128 0x2
+	.long	0x344
+	.uleb128 0xa
+	.long	0x36d
+	.long	0x36d
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x78
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF897
+	.uleb128 0x2
+	.long	0x359
+	.uleb128 0x7
+	.long	0x38e
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x40
+	.uleb128 0x1
+	.long	0x78
+	.byte	0
+	.uleb128 0x2
+	.long	0x379
+	.uleb128 0x7
+	.long	0x3a3
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x78
+	.byte	0
+	.uleb128 0x2
+	.long	0x393
+	.uleb128 0xc
+	.long	0x6c
+	.long	0x3b8
+	.uleb128 0xd
+	.long	0x47
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF898
+	.value	0x193
+	.byte	0x3
+	.long	0x2be
+	.uleb128 0x9
+	.long	0x3b8
+	.uleb128 0x10
+	.byte	0x10
+	.value	0x19a
+	.long	0x3ec
+	.uleb128 0x6
+	.string	"cur"
+	.value	0x19b
+	.byte	0xb
+	.long	0x6a
+	.byte	0
+	.uleb128 0x6
+	.string	"end"
+	.value	0x19c
+	.byte	0xb
+	.long	0x6a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF899
+	.value	0x19d
+	.byte	0x3
+	.long	0x3c9
+	.uleb128 0x2
+	.long	0x3c4
+	.uleb128 0x2
+	.long	0x2b4
+	.uleb128 0x1a
+	.long	.LASF905
+	.byte	0x6
+	.byte	0x17
+	.byte	0x1f
+	.long	0x3c4
+	.uleb128 0x1b
+	.long	0x402
+	.byte	0x1
+	.byte	0x13
+	.byte	0x18
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_rope_vtab_utf8
+	.uleb128 0xb
+	.long	.LASF900
+	.byte	0x4
+	.byte	0x4d
+	.long	0x436
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x6c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF901
+	.byte	0x5
+	.byte	0x69
+	.long	0x451
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x40
+	.uleb128 0x1
+	.long	0x451
+	.byte	0
+	.uleb128 0x2
+	.long	0x456
+	.uleb128 0x7
+	.long	0x466
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x6c
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF906
+	.byte	0x4
+	.byte	0x49
+	.byte	0xc
+	.long	0x36d
+	.long	0x481
+	.uleb128 0x1
+	.long	0x33a
+	.uleb128 0x1
+	.long	0x78
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF902
+	.byte	0x4
+	.byte	0x46
+	.long	0x492
+	.uleb128 0x1
+	.long	0x33a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF907
+	.byte	0x1
+	.byte	0xb
+	.byte	0xd
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x11
+	.string	"s"
+	.byte	0x2b
+	.long	0x33a
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x11
+	.string	"c"
+	.byte	0x37
+	.long	0x40
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x1e
+	.quad	.LVL1
+	.long	0x436
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU2
+	.uleb128 .LVU2
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU2
+	.uleb128 .LVU2
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-1-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF386
+	.file 8 "/usr/include/x86_64-linux-gnu/sys/uio.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF442
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF515
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF541
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF542
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF442
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF602
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF616
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF617
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF618
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF619
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF620
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF641
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF642
+	.file 26 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF643
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF673
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF678
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF681
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF682
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF699
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF700
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF701
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF713
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF725
+	.byte	0x4
+	.file 45 "./include/va_print/core.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF726
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF727
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 46 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 47 "/usr/include/uchar.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF770
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF771
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF831
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 50 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF834
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 51 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF837
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF857
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF438
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF441
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF452
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF453
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF514
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF532
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF540
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF557
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF599
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF601
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF615
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.f6fdfdd3074dba759703a90896f28cf6,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF638
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF640
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF647
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF649
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF651
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF655
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF659
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF672
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF677
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF680
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF683
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF694
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF698
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF712
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF716
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF719
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF620
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF640
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uio_lim.h.20.58ca37993639426c959d6d02e0db4a3a,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF724
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.0e5f0dabba1c666ccadf0408e0d47322,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF740
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF741
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF757
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF758
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF759
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF768
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF620
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF741
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF759
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF761
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF762
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF830
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF833
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF836
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF856
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rope.h.26.f0af04571e11f5a39e85677a90e9d5ba,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF859
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF712:
+	.string	"__ONCE_ALIGNMENT "
+.LASF557:
+	.string	"__STD_TYPE typedef"
+.LASF698:
+	.string	"__fsfilcnt_t_defined "
+.LASF440:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF881:
+	.string	"size_t"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF889:
+	.string	"qctxt"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF775:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF789:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF539:
+	.string	"__stub_sigreturn "
+.LASF403:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF502:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF825:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF415:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF617:
+	.string	"__clockid_t_defined 1"
+.LASF477:
+	.string	"__flexarr []"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF864:
+	.string	"signed char"
+.LASF852:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF858:
+	.string	"va_rope_chunk_size 16384"
+.LASF448:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF853:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF818:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF762:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF766:
+	.string	"true 1"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF833:
+	.string	"va_char_p_decode utf8"
+.LASF806:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF817:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF491:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF900:
+	.string	"va_rope_put"
+.LASF686:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF602:
+	.string	"__STD_TYPE"
+.LASF683:
+	.string	"__suseconds_t_defined "
+.LASF352:
+	.string	"__x86_64 1"
+.LASF679:
+	.string	"____sigset_t_defined "
+.LASF464:
+	.string	"__P(args) args"
+.LASF642:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF849:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF707:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF622:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF813:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF386:
+	.string	"VA_PRINT_ROPE_H_ "
+.LASF681:
+	.string	"__timeval_defined 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF570:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF614:
+	.string	"__daddr_t_defined "
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF759:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF872:
+	.string	"take"
+.LASF871:
+	.string	"type"
+.LASF689:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF736:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF409:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF638:
+	.string	"__size_t "
+.LASF596:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF554:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF452:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF479:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF626:
+	.string	"_T_SIZE "
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF893:
+	.string	"finish"
+.LASF779:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF653:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF406:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF777:
+	.string	"VA_NIX "
+.LASF718:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF393:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF780:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF726:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF760:
+	.string	"NULL"
+.LASF600:
+	.string	"_BITS_TIME64_H 1"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF903:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF831:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF535:
+	.string	"__stub_fchflags "
+.LASF792:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF728:
+	.string	"_STDDEF_H "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF579:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF814:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF417:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF397:
+	.string	"__USE_XOPEN"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF402:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF501:
+	.string	"__always_inline"
+.LASF624:
+	.string	"_SYS_SIZE_T_H "
+.LASF644:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF413:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF703:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF584:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF450:
+	.string	"__GLIBC__ 2"
+.LASF866:
+	.string	"long int"
+.LASF678:
+	.string	"__sigset_t_defined 1"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF418:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF436:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF735:
+	.string	"_PTRDIFF_T_ "
+.LASF414:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF375:
+	.string	"__unix 1"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF822:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF674:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF599:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF647:
+	.string	"__PDP_ENDIAN 3412"
+.LASF671:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF578:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF577:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF498:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF905:
+	.string	"va_rope_vtab_utf8"
+.LASF633:
+	.string	"_SIZE_T_DECLARED "
+.LASF466:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF487:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF884:
+	.string	"va_stream_t"
+.LASF722:
+	.string	"__iovec_defined 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF480:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF447:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF713:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF457:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF461:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF699:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF621:
+	.string	"__size_t__ "
+.LASF656:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF544:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF468:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF819:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF901:
+	.string	"va_put_utf8"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF559:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF537:
+	.string	"__stub_revoke "
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF458:
+	.string	"__LEAF , __leaf__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF575:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF715:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF603:
+	.string	"__u_char_defined "
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF632:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF856:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF635:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF424:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF465:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF634:
+	.string	"__DEFINED_size_t "
+.LASF848:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF705:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF611:
+	.string	"__pid_t_defined "
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF693:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF897:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF509:
+	.string	"__restrict_arr __restrict"
+.LASF533:
+	.string	"__stub___compat_bdflush "
+.LASF630:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF843:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF586:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF446:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF719:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF488:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF837:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF620:
+	.string	"__need_size_t "
+.LASF547:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF569:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF412:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF506:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF426:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF842:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF400:
+	.string	"__USE_XOPEN2K"
+.LASF474:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF601:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF401:
+	.string	"__USE_XOPEN2KXSI"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF504:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF410:
+	.string	"__USE_GNU"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF433:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF395:
+	.string	"__USE_POSIX199309"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF714:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF810:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF616:
+	.string	"__clock_t_defined 1"
+.LASF737:
+	.string	"___int_ptrdiff_t_h "
+.LASF604:
+	.string	"__ino_t_defined "
+.LASF451:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF399:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF416:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF772:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF688:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF751:
+	.string	"_WCHAR_T_DEFINED "
+.LASF795:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF563:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF834:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF754:
+	.string	"__INT_WCHAR_T_H "
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF548:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF593:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF796:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF682:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF508:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF708:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF538:
+	.string	"__stub_setlogin "
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF595:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF585:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF788:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF515:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF765:
+	.string	"bool _Bool"
+.LASF894:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF749:
+	.string	"_BSD_WCHAR_T_ "
+.LASF797:
+	.string	"VA_REC0() VA_REC0B"
+.LASF841:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF851:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF486:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF771:
+	.string	"____mbstate_t_defined 1"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF891:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF665:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF761:
+	.string	"NULL ((void *)0)"
+.LASF840:
+	.string	"VA_SIGIL '~'"
+.LASF496:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF640:
+	.string	"__need_NULL"
+.LASF886:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF434:
+	.string	"__USE_POSIX199506 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF437:
+	.string	"_ATFILE_SOURCE"
+.LASF553:
+	.string	"__SLONG32_TYPE int"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF574:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF821:
+	.string	"VA_U_EOT -1U"
+.LASF791:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF898:
+	.string	"va_stream_vtab_t"
+.LASF441:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF684:
+	.string	"__NFDBITS"
+.LASF727:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF690:
+	.string	"NFDBITS __NFDBITS"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF576:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF687:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF827:
+	.string	"VA_E_TRUNC 4"
+.LASF542:
+	.string	"_BITS_TYPES_H 1"
+.LASF706:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF459:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF826:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF427:
+	.string	"_POSIX_SOURCE"
+.LASF425:
+	.string	"__USE_ISOC95 1"
+.LASF525:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF625:
+	.string	"_T_SIZE_ "
+.LASF658:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF478:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF878:
+	.string	"str_prefix"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF460:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF388:
+	.string	"_FEATURES_H 1"
+.LASF421:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF605:
+	.string	"__dev_t_defined "
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF516:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF404:
+	.string	"__USE_LARGEFILE"
+.LASF490:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF558:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF428:
+	.string	"_POSIX_SOURCE 1"
+.LASF669:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF652:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF773:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF732:
+	.string	"_T_PTRDIFF_ "
+.LASF408:
+	.string	"__USE_ATFILE"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF387:
+	.string	"_SYS_UIO_H 1"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF873:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF594:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF673:
+	.string	"_SYS_SELECT_H 1"
+.LASF648:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF518:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF394:
+	.string	"__USE_POSIX2"
+.LASF710:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF639:
+	.string	"__need_size_t"
+.LASF628:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF615:
+	.string	"__key_t_defined "
+.LASF869:
+	.string	"long long int"
+.LASF828:
+	.string	"VA_E_FORMAT 5"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF742:
+	.string	"__wchar_t__ "
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF532:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF887:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF904:
+	.string	"va_quotations"
+.LASF657:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF816:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF513:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF747:
+	.string	"__WCHAR_T "
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF899:
+	.string	"va_window_t"
+.LASF463:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF494:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF512:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF892:
+	.string	"init"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF454:
+	.string	"__PMT"
+.LASF783:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF668:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF663:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF580:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF438:
+	.string	"_ATFILE_SOURCE 1"
+.LASF807:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF549:
+	.string	"__SQUAD_TYPE long int"
+.LASF786:
+	.string	"VA_P(X,...) X"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF411:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF529:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF730:
+	.string	"_ANSI_STDDEF_H "
+.LASF670:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF359:
+	.string	"__k8 1"
+.LASF524:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF473:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF862:
+	.string	"unsigned int"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF847:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF455:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF407:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF764:
+	.string	"_STDBOOL_H "
+.LASF756:
+	.string	"_WCHAR_T_DECLARED "
+.LASF724:
+	.string	"__IOV_MAX 1024"
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF435:
+	.string	"__USE_XOPEN2K 1"
+.LASF423:
+	.string	"__USE_ISOC11 1"
+.LASF846:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF587:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF546:
+	.string	"__U32_TYPE unsigned int"
+.LASF733:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF485:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF731:
+	.string	"_PTRDIFF_T "
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF489:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF511:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF536:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF583:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF885:
+	.string	"va_read_iter"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF560:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF500:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF880:
+	.string	"vtab"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF672:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF721:
+	.string	"__have_pthread_attr_t 1"
+.LASF612:
+	.string	"__id_t_defined "
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF677:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF608:
+	.string	"__nlink_t_defined "
+.LASF739:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF552:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF598:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF449:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF562:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF571:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF588:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF517:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF467:
+	.string	"__STRING(x) #x"
+.LASF860:
+	.string	"unsigned char"
+.LASF514:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF676:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF645:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF744:
+	.string	"_WCHAR_T "
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF800:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF738:
+	.string	"_GCC_PTRDIFF_T "
+.LASF521:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF867:
+	.string	"char"
+.LASF462:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF523:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF623:
+	.string	"_SIZE_T "
+.LASF752:
+	.string	"_WCHAR_T_H "
+.LASF876:
+	.string	"has_size"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF659:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF870:
+	.string	"long double"
+.LASF802:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF482:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF824:
+	.string	"VA_E_NULL 1"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF861:
+	.string	"short unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF627:
+	.string	"__SIZE_T "
+.LASF643:
+	.string	"_ENDIAN_H 1"
+.LASF442:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF794:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF675:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF391:
+	.string	"__USE_ISOC95"
+.LASF793:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF390:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF398:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF660:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF469:
+	.string	"__BEGIN_DECLS "
+.LASF790:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF755:
+	.string	"_GCC_WCHAR_T "
+.LASF526:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF497:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF812:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF680:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF804:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF590:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF868:
+	.string	"long long unsigned int"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF392:
+	.string	"__USE_ISOCXX11"
+.LASF631:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF613:
+	.string	"__ssize_t_defined "
+.LASF556:
+	.string	"__U64_TYPE unsigned long int"
+.LASF734:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF907:
+	.string	"va_rope_put_utf8"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF619:
+	.string	"__timer_t_defined 1"
+.LASF430:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF890:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF832:
+	.string	"va_char_p_format utf8"
+.LASF493:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF396:
+	.string	"__USE_POSIX199506"
+.LASF830:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF646:
+	.string	"__BIG_ENDIAN 4321"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF717:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF839:
+	.string	"va_char32_p_decode utf32"
+.LASF838:
+	.string	"va_char32_p_format utf32"
+.LASF883:
+	.string	"va_read_iter_t"
+.LASF439:
+	.string	"__WORDSIZE 64"
+.LASF692:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF702:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF540:
+	.string	"__stub_stty "
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF475:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF855:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF555:
+	.string	"__S64_TYPE long int"
+.LASF528:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF661:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF629:
+	.string	"_BSD_SIZE_T_ "
+.LASF472:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF874:
+	.string	"bulk"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF701:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF808:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF746:
+	.string	"_T_WCHAR "
+.LASF545:
+	.string	"__S32_TYPE int"
+.LASF836:
+	.string	"va_char16_p_decode utf16"
+.LASF835:
+	.string	"va_char16_p_format utf16"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF902:
+	.string	"va_rope_finish"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF844:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF694:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF444:
+	.string	"__USE_ATFILE 1"
+.LASF389:
+	.string	"__USE_ISOC11"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF748:
+	.string	"_WCHAR_T_ "
+.LASF610:
+	.string	"__off_t_defined "
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF805:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF750:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF711:
+	.string	"__LOCK_ALIGNMENT "
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF896:
+	.string	"put_len"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF859:
+	.string	"VA_STREAM_ROPE(M) ((va_stream_rope_t){ VA_STREAM(&va_rope_vtab_utf8), NULL, NULL, va_rope_chunk_size, (M) })"
+.LASF534:
+	.string	"__stub_chflags "
+.LASF763:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF685:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF801:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF637:
+	.string	"_SIZET_ "
+.LASF589:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF854:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF811:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF609:
+	.string	"__uid_t_defined "
+.LASF655:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF527:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF875:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF582:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF522:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF505:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF495:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF470:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF820:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF845:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF865:
+	.string	"short int"
+.LASF453:
+	.string	"_SYS_CDEFS_H 1"
+.LASF769:
+	.string	"_UCHAR_H 1"
+.LASF782:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF419:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF696:
+	.string	"__blkcnt_t_defined "
+.LASF798:
+	.string	"VA_REC1() VA_REC1B"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF666:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF483:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF695:
+	.string	"__blksize_t_defined "
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF520:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF725:
+	.string	"UIO_MAXIOV __IOV_MAX"
+.LASF550:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF741:
+	.string	"__need_ptrdiff_t"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF531:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF541:
+	.string	"_SYS_TYPES_H 1"
+.LASF481:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF877:
+	.string	"chunk_mode"
+.LASF567:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF484:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF551:
+	.string	"__SWORD_TYPE long int"
+.LASF743:
+	.string	"__WCHAR_T__ "
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF879:
+	.string	"_pad"
+.LASF492:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF564:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF431:
+	.string	"__USE_POSIX 1"
+.LASF781:
+	.string	"VA_PAR ()"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF723:
+	.string	"_BITS_UIO_LIM_H 1"
+.LASF530:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF757:
+	.string	"__DEFINED_wchar_t "
+.LASF785:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF767:
+	.string	"false 0"
+.LASF895:
+	.string	"put_fill"
+.LASF543:
+	.string	"__S16_TYPE short int"
+.LASF716:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF618:
+	.string	"__time_t_defined 1"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF709:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF662:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF799:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF499:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF503:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF753:
+	.string	"___int_wchar_t_h "
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF654:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF519:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF581:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF507:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF572:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF787:
+	.string	"VA_F(...) VA_H"
+.LASF420:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF636:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF778:
+	.string	"VA_EAT(...) "
+.LASF745:
+	.string	"_T_WCHAR_ "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF774:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF758:
+	.string	"_BSD_WCHAR_T_"
+.LASF649:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF422:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF561:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF770:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF784:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF471:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF651:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF350:
+	.string	"__amd64 1"
+.LASF667:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF432:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF573:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF700:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF697:
+	.string	"__fsblkcnt_t_defined "
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF882:
+	.string	"va_read_iter_vtab_t"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF565:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF607:
+	.string	"__mode_t_defined "
+.LASF850:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF566:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF815:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF456:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF377:
+	.string	"unix 1"
+.LASF641:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF445:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF443:
+	.string	"__USE_MISC 1"
+.LASF768:
+	.string	"__bool_true_false_are_defined 1"
+.LASF592:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF776:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF809:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF740:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF606:
+	.string	"__gid_t_defined "
+.LASF476:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF857:
+	.string	"VA_PRINT_ROPE_UTF8_H_ "
+.LASF568:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF729:
+	.string	"_STDDEF_H_ "
+.LASF823:
+	.string	"VA_E_OK 0"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF906:
+	.string	"va_rope_refill"
+.LASF405:
+	.string	"__USE_LARGEFILE64"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF888:
+	.string	"prec"
+.LASF650:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF372:
+	.string	"__linux 1"
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF691:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF829:
+	.string	"VA_E_ARGC 6"
+.LASF597:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF704:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF429:
+	.string	"_POSIX_C_SOURCE"
+.LASF803:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF591:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF863:
+	.string	"long unsigned int"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF510:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/rope_utf8.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
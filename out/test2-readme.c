@@ -0,0 +1,638 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <uchar.h>
+#include <va_print/file.h>
+
+#pragma GCC diagnostic ignored "-Wmissing-prototypes"
+#pragma GCC diagnostic ignored "-Wvla"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+/*ENUMERATE: open_text_rd*/
+
+static char msg[] = "foo";
+typedef char16_t SomeCharacterType;
+
+/*COPY    README.md Examples*/
+
+/*  - `va_printf("~s ~s ~s", 65, (long long)65, "65")` prints `65 65 65` */
+/*  - `va_printf("~c ~c ~c", 65, (long long)65, "65")` prints `A A 65` */
+/*  - `va_printf("~x ~x ~x", 65, (long long)65, "65")` prints `41 41 65` */
+/*  - `va_printf("~p ~p ~p", 65, (long long)65, "65")` prints */
+/*    `0x41 0x41 0x8838abc3932` (the pointer value of the string) */
+/*  - `va_lprintf("~p", 65)` returns `4`, the length of `0x41` */
+/*  - `va_nprintf(10, "~p", 65)` returns `"0x41"`, the pointer to a compound */
+/*    literal `(char[10]){}` that was printed into */
+/*  - `va_printf("~t x = ~=qzs", u"fo\020o")` prints `char16_t* x = u"fo\no"` */
+
+
+/* Open a file with computed name, up to a fixed path length: */
+
+#include <va_print/char.h>
+
+FILE *open_text_rd1(char const *dir, char const *file, unsigned suffix)
+{
+    return fopen(va_nprintf(80, "~s/~s~.s", dir, file, suffix), "rt");
+}
+
+/* The same with error checking about truncated string or en- or decoding */
+/* errors: */
+
+FILE *open_text_rd2(
+    char const *dir, char const *file, unsigned suffix)
+{
+    va_error_t e;
+    char *fn = va_nprintf(80, "~s/~s~.s", dir, file, suffix, &e);
+    if (e.code != VA_E_OK) {
+        return NULL;
+    }
+    return fopen(fn, "rt");
+}
+
+/* You can use 8-bit, 16-bit, or 32-bit characters seamlessly.  The */
+/* following uses UTF-16 as a parameter, but calls fopen() with an UTF-8 */
+/* string.  The only change is the parameter type.  Just for fun, let's */
+/* use an UTF-32 format string: */
+
+FILE *open_text_rd3(
+    char16_t const *dir, char16_t const *file, unsigned suffix)
+{
+    va_error_t e;
+    char *fn = va_nprintf(80, U"~s/~s~.s", dir, file, suffix, &e);
+    if (e.code != VA_E_OK) {
+        return NULL;
+    }
+    return fopen(fn, "rt");
+}
+
+/* This can also be done by creating a dynamically allocated string.  The */
+/* `va_error_t` mechanism then protects against out-of-memory situation */
+/* (in which case the function deallocates what it allocated before and */
+/* returns NULL), and also against Unicode decoding/encoding errors, and */
+/* other traps. */
+
+#include <va_print/alloc.h>
+
+FILE *open_text_rd4(char const *dir, char const *file, unsigned suffix)
+{
+    FILE *f = NULL;
+    va_error_t e;
+    char *fn = va_asprintf("~s/~s~.s", dir, file, suffix, &e);
+    if (e.code == VA_E_OK) {
+        f = fopen(fn, "rt");
+    }
+    free(fn);
+    return f;
+}
+
+/* Using VLA, do the same with arbitrary length by pre-computing the length */
+/* using va_lprintf(): */
+
+#include <va_print/len.h>
+
+FILE *open_text_rd5(char const *dir, char const *file, unsigned suffix)
+{
+    char s[va_zprintf("~s/~s~.s", dir, file, suffix)];
+    return fopen(va_sprintf(s, "~s/~s~.s", dir, file, suffix), "rt");
+
+}
+
+/*SNIPPET README.md Library Modules*/
+
+/* ### Printing Into Fixed Size Arrays */
+
+#include <va_print/char.h>
+void testfunc2(void) {
+/* #include ... */
+}
+
+/* To print into an string of characters up to a given number of elements */
+/* in the array, the following function can be used, and it returns the */
+/* pointer to the string.  The resulting string is always NUL terminated, */
+/* i.e., the maximum string length is one less than the passed element */
+/* count. */
+
+void testfunc3(void) {
+char s[20];
+char *t = va_snprintf(s, sizeof(s), "foo~s", 5);
+assert(s == t);
+}
+
+/* The target buffer's type may be 8, 16, or 32 bit characters -- no need */
+/* to use a different function.  For anything but `char` buffers, use */
+/* `va_countof()` for the array size, so that the number of elements, not */
+/* the number of bytes, is used as the string size. */
+
+
+void testfunc5(void) {
+char16_t s1[20];
+char16_t *t1 = va_snprintf(s1, va_countof(s1), "foo~s", 5);
+
+char32_t s2[20];
+char32_t *t2 = va_snprintf(s2, va_countof(s2), "foo~s", 5);
+}
+
+/* The `va_countof()` values is inferred when using `va_sprintf`. This */
+/* is different from the standard C `sprintf` function, which unsafely */
+/* assumes a sufficiently large string -- you cannot express that with */
+/* this library, but you'd have to use `snprintf` with a large size */
+/* instead. */
+
+void testfunc7(void) {
+char s[20];
+char *t = va_sprintf(s, "foo~s", 5);
+}
+
+/* It is possible to print into a compound literal of a given */
+/* size and return the pointer to that string.  In this case, */
+/* no character array can be used to infer the string type, */
+/* so it is encoded in the function name.  There are functions */
+/* for `char`, `char16_t`, and `char32_t` strings, as well as */
+/* a generic version that takes as first argument the string */
+/* character type. */
+void testfunc9(void) {
+char     *t1a = va_nprintf (20, "foo~s", 5);
+char16_t *t2a = va_unprintf(20, "foo~s", 5);
+char32_t *t3a = va_Unprintf(20, "foo~s", 5);
+char     *t1b = va_gnprintf(char, 20, "foo~s", 5);
+char16_t *t2b = va_gnprintf(char16_t, 20, "foo~s", 5);
+char32_t *t3b = va_gnprintf(char32_t, 20, "foo~s", 5);
+}
+
+/* The stream for printing can also be generated separately and then used */
+/* for iterative printing using `va_iprintf`.  The stream makes sure not */
+/* to print past the end of the char array. */
+
+void testfunc11(void) {
+char buff[20];
+va_stream_char_p_t stream = VA_STREAM_CHAR_P(buff, va_countof(buff));
+va_iprintf(&stream, "foo");
+va_iprintf(&stream, "bar ~u", 55);
+va_iprintf(&stream, "longer than the string, will be cropped");
+
+/* There is a `stream.pos` counter for the current write index in the */
+/* array, i.e., the string length of the encoded byte sequence.  `pos` */
+/* increments up to `stream.size-1`, but no further (note that `size==0` */
+/* is an illegal configuration, because then there is no space for NUL */
+/* terminating the string). */
+
+/* Creating a `va_stream_char_p_t` with the buffer equal to `NULL` is */
+/* explicitly allowed.  Putting the bytes into a char array will then be */
+/* inhibited.  The printer still increments `stream.pos` up to */
+/* `stream.size-1`, so by this, `strnlen()` functionality can be */
+/* implemented on the resulting string.  This is exactly how `va_zprintf` */
+/* (mnemonic: `siZe`) works. */
+
+/* To determine whether the stream was truncated, i.e., whether the */
+/* buffer was too small for the print result, the stream's error code can */
+/* be checked for the `VA_E_TRUNC` error code value after printing is */
+/* done. */
+
+va_error_t e;
+va_iprintf(&stream, "", &e);
+if (e.code != VA_E_OK) {
+    /* ... some stream error occurred ... */
+}
+
+/* Alternatively, if you have a stream anyway, there is */
+/* `va_stream_get_error()` that returns the stream's error code. */
+/* There is also `va_strerror()` to get the enum value as a string. */
+
+unsigned ec = va_stream_get_error(&stream);
+if (ec != VA_E_OK) {
+    va_fprintf(stderr, "ERROR: found ec=~s\n", va_strerror(ec));
+    /* ... more error handling */
+}
+}
+
+/* Note that there is no `%n` equivalent format specifier for reading the */
+/* printed length; use `stream.pos` instead.  Or use `va_zprintf` to */
+/* compute the needed array size. */
+
+/* There is also `va_lprintf` to count the length of the string, i.e., */
+/* the number of codepoints written, instead of the number of encoded */
+/* bytes. */
+
+/* ### Printing Into Growing Vectors */
+
+#include <va_print/alloc.h>
+void testfunc17(void) {
+/* #include ... */
+}
+
+/* It is possible to print into a string that is allocated grows using */
+/* `malloc()`: */
+
+void testfunc18(void) {
+char *c = va_asprintf("foo~s", msg);
+free(c);
+}
+
+/* Here, the `va_alloc()` function is implicitly used to allocate, */
+/* possibly reallocate while printing, and possibly freeing the string in */
+/* case of an out-of-memory error. */
+
+/* For `char16_t*` and `char32_t*` target strings, there are */
+/* `va_uasprintf` and `va_Uasprintf`, resp. */
+
+/* `va_alloc` is a wrapper around `realloc` and `free`.  Any compatible */
+/* function with the same prototype can be used instead. */
+
+/* A user defined allocation function can be supplied by using the */
+/* `va_axprintf` function, which is just like `va_asprintf`, but takes */
+/* the allocator function of type `void *(void *, size_t nmemb, size_t */
+/* size)` as parameter, which is used for allocation, reallocation, and */
+/* freeing (with `nmemb==0`).  For `char` strings, the function is */
+/* invoked with `size==1`. */
+
+void testfunc20(void) {
+char *c = va_axprintf(va_alloc, "foo~s", msg);
+free(c);
+}
+
+/* For `char16_t` and `char32_t` output strings, there is `va_uaxprintf` */
+/* and `va_Uaxprintf`, resp.  The allocator function will then be invoked */
+/* with a `size==2` for `char16_t` and `size==4` for `char32_t`. */
+
+/* The `va_aeprintf` family (and `va_aexprintf` with a user defined */
+/* allocator) returns a string of exactly the needed size.  It prints */
+/* into an on-stack array of `va_asprintf_stage_size` entries (default: */
+/* 512) first and then allocates the result once.  Longer strings spill */
+/* into a growing heap buffer that is shrunk to fit at the end.  The */
+/* result and the error handling are the same as for `va_asprintf`. */
+
+void testfunc22(void) {
+char *c = va_aeprintf("foo~s", msg);
+free(c);
+}
+
+/* For many short-lived strings that are released together, there is an */
+/* arena: `va_arena_printf` allocates the string from chunks of at least */
+/* `va_arena_chunk_size` bytes (default: 4096).  The string grows in */
+/* place while it is the arena's last allocation, and is shrunk to fit */
+/* at the end.  Strings are not freed individually: `va_arena_reset` */
+/* releases all of them at once and keeps one chunk for reuse, and */
+/* `va_arena_free` gives all chunks back to the allocator. */
+
+void testfunc24(void) {
+va_arena_t arena = VA_ARENA(va_alloc);
+char *c = va_arena_printf(&arena, "foo~s", msg);
+char16_t *d = va_arena_uprintf(&arena, "bar~s", msg);
+va_arena_free(&arena);
+}
+
+/* To avoid allocation for short strings without risking truncation, */
+/* `va_bprintf` prints into a given array and only allocates a buffer if */
+/* the output does not fit.  It returns the `va_stream_vec_t` stream */
+/* object, whose `data` is the result, and `va_vec_is_inline` tells */
+/* whether that is still the array.  `va_vec_free` releases the buffer if */
+/* one was allocated.  There are also `va_ubprintf` and `va_Ubprintf` */
+/* for `char16_t` and `char32_t` arrays, and `va_bxprintf` etc. with a */
+/* user defined allocator. */
+
+void testfunc26(void) {
+char buf[128];
+va_stream_vec_t r = va_bprintf(buf, "foo~s", msg);
+puts(r.data);
+va_vec_free(&r);
+}
+
+/* For temporary strings that are only needed briefly, e.g., as an */
+/* argument of another call, `va_tprintf` prints into a buffer of the */
+/* calling thread that is reused by later calls.  Each thread has a ring */
+/* of `va_tprintf_slots` such buffers (default: 4) that are used in turn, */
+/* so a string stays valid until that many more `va_tprintf` calls were */
+/* made on the same thread, and several temporary strings can be used in */
+/* one expression.  The buffers only grow, so once they are large */
+/* enough, this does not allocate anymore.  The strings must not be */
+/* freed: `va_tprintf_free` releases the buffers of the calling thread. */
+/* There are also `va_utprintf` and `va_Utprintf` for `char16_t` and */
+/* `char32_t` strings, which have their own rings. */
+
+void testfunc28(void) {
+va_printf("~s: ~s\n", va_tprintf("foo~s", msg), va_tprintf("bar~u", 42));
+va_tprintf_free();
+}
+
+/* It is also possible to create a stream for iterative printing. */
+
+void testfunc30(void) {
+va_stream_vec_t stream = VA_STREAM_VEC(va_alloc);
+va_iprintf(&stream, "foo");
+va_iprintf(&stream, "bar ~u", 55);
+}
+
+/* For 16 and 32 bit chars, there is `va_stream_vec16_t` plus */
+/* `VA_STREAM_VEC16` and `va_stream_vec32_t` plus `VA_STREAM_VEC32`. */
+
+/* Such a stream can be used as a string builder that keeps its buffer: */
+/* `va_vec_clear` empties the string without deallocating, so that */
+/* building one string after another does not allocate anymore once the */
+/* buffer is large enough.  `va_vec_reserve` preallocates room for a */
+/* given number of entries, `va_vec_shrink` gives back memory above a */
+/* given size, `va_vec_span` returns a `va_span_t` view of the string, and */
+/* `va_vec_free` deallocates the buffer.  The 16 and 32 bit versions are */
+/* called `va_vec16_clear` etc. */
+
+void testfunc32(void) {
+va_stream_vec_t b = VA_STREAM_VEC(va_alloc);
+va_span_t view;
+va_vec_reserve(&b, 200);
+for (int i = 0; i < 10; i++) {
+    va_vec_clear(&b);
+    va_iprintf(&b, "line ~u: ", i);
+    va_iprintf(&b, "~s", msg);
+    va_printf("~s\n", va_vec_span(&b, &view));
+}
+va_vec_shrink(&b, 1000);
+va_vec_free(&b);
+}
+
+/* ### Printing Into Files */
+
+#include <va_print/file.h>
+void testfunc34(void) {
+/* #include ... */
+}
+
+/* To print into `FILE*` files, there is `va_fprintf`, which returns */
+/* nothing. */
+
+void testfunc35(void) {
+va_fprintf(stderr, "foo~s", msg);
+}
+
+/* There is also `va_printf` that prints into `stdout` and `va_eprintf` */
+/* that prints into `stderr`.  They also both return nothing. */
+
+void testfunc37(void) {
+va_printf("foo~s", msg);
+va_eprintf("foo~s", msg);
+}
+
+/* To write `char16_t` or `char32_t` streams into files, the encodings */
+/* `UTF-16BE` and `UTF-32BE` are used by default.  Functions for this */
+/* are called `va_ufprintf` and `va_Ufprintf`, resp. */
+
+/* For files, there is a stream type `va_stream_file_t` that can be */
+/* constructed using `VA_STREAM_FILE`, e.g., to iteratively print. */
+
+void testfunc39(void) {
+va_stream_file_t stream = VA_STREAM_FILE(stderr);
+va_iprintf(&stream, "foo");
+va_iprintf(&stream, "bar ~u", 55);
+va_iprintf(&stream, "longer than the string, will be cropped");
+
+/* The 16-bit and 32-bit versions use the same stream type, and the */
+/* constructors are called `VA_STREAM_FILE16` and `VA_STREAM_FILE32`, */
+/* resp. */
+
+/* `va_fprintf` locks the file once using `flockfile`, collects the */
+/* encoded output in a stack buffer of `va_file_buf_size` (default: 256) */
+/* bytes, and writes it using `fwrite_unlocked` (where available) each */
+/* time the buffer is full and at the end.  So the output of one */
+/* `va_fprintf` call is not interleaved with that of other threads.  A */
+/* `va_stream_file_t` can be given a buffer using `VA_STREAM_FILE_BUF` */
+/* (`VA_STREAM_FILE16_BUF`, `VA_STREAM_FILE32_BUF`); the buffer is */
+/* written when it is full or when `va_file_flush` is invoked. */
+
+char fbuf[80];
+va_stream_file_t *fstream = &VA_STREAM_FILE_BUF(stderr, fbuf, sizeof(fbuf));
+va_iprintf(fstream, "foo");
+va_iprintf(fstream, "bar ~u", 55);
+va_file_flush(fstream);
+}
+
+
+/* ### Printing Into Raw File Descriptors */
+
+#include <va_print/fd.h>
+void testfunc43(void) {
+/* #include ... */
+}
+
+/* To print into `int` typed file descriptors, there is `va_dprintf`, which */
+/* returns nothing. */
+
+void testfunc44(void) {
+va_dprintf(2, "foo~s", msg);
+}
+
+/* To write `char16_t` or `char32_t` streams into files, the encodings */
+/* `UTF-16BE` and `UTF-32BE` are used by default.  Functions for this */
+/* are called `va_udprintf` and `va_Udprintf`, resp. */
+
+/* For file descriptors, there is a stream type `va_stream_fd_t` that */
+/* can be constructed using `VA_STREAM_FD`, e.g., to iteratively print. */
+
+void testfunc46(void) {
+va_stream_fd_t stream = VA_STREAM_FD(2);
+va_iprintf(&stream, "foo");
+va_iprintf(&stream, "bar ~u", 55);
+va_iprintf(&stream, "longer than the string, will be cropped");
+
+/* The 16-bit and 32-bit versions use the same stream type, and the */
+/* constructors are called `VA_STREAM_FD16` and `VA_STREAM_FD32`, resp. */
+
+/* `va_dprintf` collects its output in a stack buffer of `va_fd_buf_size` */
+/* (default: 512) bytes and writes it at the end, so that a message is */
+/* written with a single `write()` call.  With `O_APPEND` file descriptors */
+/* and pipes, concurrent writers therefore do not interleave within a */
+/* message.  Only messages longer than the buffer or than `PIPE_BUF` are */
+/* written in chunks, and each chunk ends at a code point boundary. */
+/* Unbuffered streams write each code point with a single `write()`. */
+/* Short writes and `EINTR` are handled by retrying.  A `va_stream_fd_t` */
+/* can be given a buffer using `VA_STREAM_FD_BUF` (`VA_STREAM_FD16_BUF`, */
+/* `VA_STREAM_FD32_BUF`); the buffer is written when it is full or when */
+/* `va_fd_flush` is invoked.  The `PIPE_BUF` limit does not apply to such */
+/* buffers. */
+
+char buf[80];
+va_stream_fd_t *bstream = &VA_STREAM_FD_BUF(2, buf, sizeof(buf));
+va_iprintf(bstream, "foo");
+va_iprintf(bstream, "bar ~u", 55);
+va_fd_flush(bstream);
+}
+/* ` */
+
+/* ### Printing Into Ropes */
+
+#include <va_print/rope.h>
+void testfunc50(void) {
+/* #include ... */
+}
+
+/* For very large outputs, reallocating a vector copies the string */
+/* repeatedly and briefly needs memory for both the old and the new */
+/* buffer.  A rope stream of type `va_stream_rope_t` instead appends */
+/* chunks of `va_rope_chunk_size` bytes (default: 16384) to a list, and */
+/* never moves what was written.  It is constructed with `VA_STREAM_ROPE` */
+/* and a `va_alloc` compatible allocator, and each print call appends to */
+/* it.  The output is UTF-8 encoded. */
+
+/* `va_rope_iovec` returns views of the chunks as `struct iovec` */
+/* entries, `va_rope_writev` writes the whole rope to a file descriptor */
+/* with `writev()`, and `va_rope_flatten` copies it into one newly */
+/* allocated NUL terminated string.  `va_rope_clear` empties the rope */
+/* and keeps one chunk, and `va_rope_free` deallocates all chunks. */
+
+void testfunc51(void) {
+va_stream_rope_t rope = VA_STREAM_ROPE(va_alloc);
+for (int i = 0; i < 100000; i++) {
+    va_iprintf(&rope, "line ~u: ~s\n", i, msg);
+}
+va_rope_writev(&rope, 1);
+va_rope_free(&rope);
+}
+
+/* ### Printing non-NUL Terminated Strings */
+
+/* One way to print non-NUL terminated strings or prefixes of strings */
+/* is by specifying the 'precision' in the format.  It is the length */
+/* in `char`, `char16_t`, or `char32_t` elements and not the number of */
+/* extracted codepoints, exactly for this purpose. */
+
+void testfunc53(void) {
+char const *data = "abcdef";
+size_t size = 3;
+va_fprintf(stderr, "token=~.*qs", size, data);
+}
+/* This prints `token="abc"`. */
+
+/* An alternative way of controlling this is to pass a pointer to */
+/* `va_span_t` to the printer, which contains the data and size: */
+
+void testfunc55(void) {
+char const *data = "abcdef";
+size_t size = 3;
+va_fprintf(stderr, "token=~qs", (&(va_span_t){ size, data }));
+}
+
+/* This also prints `token="abc"`. */
+
+/* Note that strings specified by their size may contain U+0000 (NUL) */
+/* characters, and they are quoted accordingly, if requested: */
+
+void testfunc57(void) {
+va_fprintf(stderr, "token=~qs", (&(va_span_t){ 1, "" }));
+}
+
+/* This also prints `token="\000"`. */
+
+/* There are similar types `va_span16_t` and `va_span32_t` for wide */
+/* character strings. */
+
+/* ### Computing String Lengths */
+
+#include <va_print/len.h>
+void testfunc59(void) {
+/* #include ... */
+}
+
+/* The function `va_lprintf` returns the number of codepoints printed */
+/* into an output stream.  This is the string length regardless of output */
+/* encoding. */
+
+void testfunc60(void) {
+size_t cp_count = va_lprintf("foo~s", msg);
+}
+
+/* This is not a good function for computing array sizes -- use the */
+/* `va_zprint` family instead. */
+
+/* If only a bound is of interest, `va_lnprintf` stops counting once the */
+/* given limit is exceeded: it returns the length if it is at most `N`, */
+/* otherwise it returns `N+1` and sets `VA_E_TRUNC`.  The remaining */
+/* arguments are then not rendered anymore, which is cheap even for very */
+/* long strings. */
+
+void testfunc62(void) {
+if (va_lnprintf(80, "foo~s", msg) > 80) {
+    /* does not fit a line */
+}
+}
+
+
+/* ### Computing String Array Sizes */
+
+#include <va_print/char.h>
+void testfunc64(void) {
+/* #include ... */
+}
+
+/* To compute the size of the array needed to store a given printed */
+/* string, there is `va_zprintf`. */
+
+void testfunc65(void) {
+size_t n = va_zprintf("foo~s", msg);
+char *s = malloc(n);
+va_error_t e;
+va_snprintf(s, n, "foo~s", msg, &e);
+assert(e.code == VA_E_OK);
+}
+
+/* This function counts the encoded size of the needed array, i.e., it */
+/* also includes the `NUL` character in the count, and it counts for each */
+/* codepoint, how many UTF-8 (or whatever encoding is used) bytes are */
+/* used for each codepoint.  Nothing is actually encoded: the lengths are */
+/* added up arithmetically, so this is much cheaper than printing.  This */
+/* function is, therefore, useful for computing array sizes that fit the */
+/* printed string exactly. */
+
+/* For `char16_t` and `char32_t` based strings, the function is called */
+/* `va_uzprintf` and `va_Uzprintf`, resp. */
+
+/* There is a generic version that can be passed the array element */
+/* type as the first parameter. */
+
+void testfunc67(void) {
+typedef SomeCharacterType MyChar;
+size_t n = va_gzprintf(MyChar, "foo~s", msg);
+MyChar *s = malloc(sizeof(MyChar) * n);
+va_snprintf(s, n, "foo~s", msg);
+}
+
+/* Similarly, `va_znprintf(N, ...)` (and `va_uznprintf`, `va_Uznprintf`, */
+/* `va_gznprintf`) returns the needed array size if it is at most `N`, */
+/* and `N+1` otherwise, without rendering beyond the limit. */
+
+/* ### Precompiled Format Strings */
+
+#include <va_print/alloc.h>
+void testfunc69(void) {
+/* #include ... */
+}
+
+/* A format string that is used very often can be parsed once with */
+/* `va_format_compile`, and the resulting `va_format_t` can then be */
+/* passed to any print function in place of the format string.  This */
+/* stores the literal text between format specifiers in UTF-8, UTF-16, */
+/* and UTF-32, so that it can be copied into the output as a whole, and */
+/* it stores the options of each format specifier, so that they are not */
+/* parsed again. */
+
+void testfunc70(void) {
+va_format_t *f = va_format_compile("foo~s\n");
+for (unsigned i = 0; i < 3; i++) {
+    va_printf(f, msg);
+}
+va_format_free(f);
+}
+
+/* The output is the same as with the format string, including errors */
+/* like `VA_E_FORMAT` and `VA_E_ARGC`: anything that cannot be */
+/* precompiled, like `~*`, is parsed from the format string as usual. */
+/* The format string is copied, so it need not be kept.  If memory is */
+/* exhausted, `va_format_compile` returns `NULL`, and printing with a */
+/* `NULL` format results in `VA_E_NULL`.  `va_format_xcompile` takes an */
+/* allocator function like `va_axprintf`, and is available from */
+/* `va_print/core.h`. */
+
+/* String literal format strings without any `~` and without further */
+/* arguments, like `va_printf("done\n")`, need no compilation: with */
+/* optimisation, this is recognised at compile time, and the string is */
+/* copied (or transcoded) into the output as a whole instead of being */
+/* parsed. */
+
@@ -0,0 +1,7624 @@
+# 0 "out/test2-readme.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 201710L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE_SIZE__ 1
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "out/test2-readme.c"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 24 "/usr/include/stdio.h" 3 4
+#define _STDIO_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+
+
+
+
+
+#define __USE_ISOC11 1
+
+
+
+
+
+
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+
+
+
+
+
+
+
+#define __GLIBC_USE_DEPRECATED_GETS 0
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/stdio.h" 2 3 4
+
+#define __need___va_list 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+#undef __need___va_list
+
+
+
+
+#define __GNUC_VA_LIST 
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+#define _____fpos_t_defined 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+
+#define ____mbstate_t_defined 1
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+
+#define _____fpos64_t_defined 1
+
+
+
+
+
+
+
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+#define ____FILE_defined 1
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+#define __FILE_defined 1
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+#define __struct_FILE_defined 1
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+
+
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+
+
+
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+
+
+
+
+#define _IO_EOF_SEEN 0x0010
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+
+#define _IO_ERR_SEEN 0x0020
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+
+#define _IO_USER_LOCK 0x8000
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+#define _VA_LIST_DEFINED 
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+
+
+
+#define __off_t_defined 
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+#define __ssize_t_defined 
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 93 "/usr/include/stdio.h" 3 4
+#define _IOFBF 0
+#define _IOLBF 1
+#define _IONBF 2
+
+
+
+#define BUFSIZ 8192
+
+
+
+
+#define EOF (-1)
+
+
+
+
+#define SEEK_SET 0
+#define SEEK_CUR 1
+#define SEEK_END 2
+# 120 "/usr/include/stdio.h" 3 4
+#define P_tmpdir "/tmp"
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 3 4
+#define _BITS_STDIO_LIM_H 1
+
+
+
+
+
+#define L_tmpnam 20
+#define TMP_MAX 238328
+#define FILENAME_MAX 4096
+
+
+#define L_ctermid 9
+
+
+
+
+
+#undef FOPEN_MAX
+#define FOPEN_MAX 16
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+#define stdin stdin
+#define stdout stdout
+#define stderr stderr
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+
+#undef __attr_dealloc_fclose
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+
+
+
+
+
+
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 2 "out/test2-readme.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 25 "/usr/include/stdlib.h" 3 4
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+#define __need_size_t 
+#define __need_wchar_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+#define _STDLIB_H 1
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 3 4
+#define WNOHANG 1
+#define WUNTRACED 2
+
+
+
+#define WSTOPPED 2
+#define WEXITED 4
+#define WCONTINUED 8
+#define WNOWAIT 0x01000000
+
+
+#define __WNOTHREAD 0x20000000
+
+#define __WALL 0x40000000
+#define __WCLONE 0x80000000
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 3 4
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+
+
+#define __WTERMSIG(status) ((status) & 0x7f)
+
+
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+
+
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+
+
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+
+
+
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+
+
+
+
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+
+
+
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+
+
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define __W_CONTINUED 0xffff
+#define __WCOREFLAG 0x80
+# 42 "/usr/include/stdlib.h" 2 3 4
+
+
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define WTERMSIG(status) __WTERMSIG (status)
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define WIFEXITED(status) __WIFEXITED (status)
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+
+
+
+
+
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+#define __ldiv_t_defined 1
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+#define __lldiv_t_defined 1
+
+
+
+
+#define RAND_MAX 2147483647
+
+
+
+
+#define EXIT_FAILURE 1
+#define EXIT_SUCCESS 0
+
+
+
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define _SYS_TYPES_H 1
+
+
+
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+#define __u_char_defined 
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+#define __ino_t_defined 
+
+
+
+
+
+
+
+typedef __dev_t dev_t;
+#define __dev_t_defined 
+
+
+
+typedef __gid_t gid_t;
+#define __gid_t_defined 
+
+
+
+typedef __mode_t mode_t;
+#define __mode_t_defined 
+
+
+
+typedef __nlink_t nlink_t;
+#define __nlink_t_defined 
+
+
+
+typedef __uid_t uid_t;
+#define __uid_t_defined 
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+#define __pid_t_defined 
+
+
+
+
+typedef __id_t id_t;
+#define __id_t_defined 
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+#define __daddr_t_defined 
+
+
+
+
+typedef __key_t key_t;
+#define __key_t_defined 
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+#define __clock_t_defined 1
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+#define __clockid_t_defined 1
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+
+#define __time_t_defined 1
+
+
+
+
+
+
+
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+#define __timer_t_defined 1
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 143 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+
+
+
+
+
+
+#define __BIT_TYPES_DEFINED__ 1
+
+
+
+
+# 1 "/usr/include/endian.h" 1 3 4
+# 19 "/usr/include/endian.h" 3 4
+#define _ENDIAN_H 1
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define _BITS_ENDIAN_H 1
+# 30 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define __LITTLE_ENDIAN 1234
+#define __BIG_ENDIAN 4321
+#define __PDP_ENDIAN 3412
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+
+#define _BITS_ENDIANNESS_H 1
+
+
+
+
+
+
+#define __BYTE_ORDER __LITTLE_ENDIAN
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+
+
+
+
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+
+
+
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+# 25 "/usr/include/endian.h" 2 3 4
+
+
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define BIG_ENDIAN __BIG_ENDIAN
+#define PDP_ENDIAN __PDP_ENDIAN
+#define BYTE_ORDER __BYTE_ORDER
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+#define _BITS_BYTESWAP_H 1
+
+
+
+
+
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+
+
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+#define _BITS_UINTN_IDENTITY_H 1
+
+
+
+
+
+
+
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+
+
+#define htobe16(x) __bswap_16 (x)
+#define htole16(x) __uint16_identity (x)
+#define be16toh(x) __bswap_16 (x)
+#define le16toh(x) __uint16_identity (x)
+
+#define htobe32(x) __bswap_32 (x)
+#define htole32(x) __uint32_identity (x)
+#define be32toh(x) __bswap_32 (x)
+#define le32toh(x) __uint32_identity (x)
+
+#define htobe64(x) __bswap_64 (x)
+#define htole64(x) __uint64_identity (x)
+#define be64toh(x) __bswap_64 (x)
+#define le64toh(x) __uint64_identity (x)
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+#define _SYS_SELECT_H 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/select.h" 3 4
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+
+
+
+
+
+
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+#define __sigset_t_defined 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+#define ____sigset_t_defined 
+
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+#define __timeval_defined 1
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+#define _STRUCT_TIMESPEC 1
+
+
+
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+#define __suseconds_t_defined 
+
+
+
+
+typedef long int __fd_mask;
+
+
+#undef __NFDBITS
+
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+
+
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+#define __FDS_BITS(set) ((set)->__fds_bits)
+
+  } fd_set;
+
+
+#define FD_SETSIZE __FD_SETSIZE
+
+
+
+typedef __fd_mask fd_mask;
+
+
+#define NFDBITS __NFDBITS
+
+
+
+
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+
+
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+#define __blksize_t_defined 
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+#define __blkcnt_t_defined 
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+#define __fsblkcnt_t_defined 
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+#define __fsfilcnt_t_defined 
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+#define _BITS_PTHREADTYPES_COMMON_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+#define _THREAD_SHARED_TYPES_H 1
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define _BITS_PTHREADTYPES_ARCH_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+
+
+
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+# 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __SIZEOF_PTHREAD_COND_T 48
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+
+#define __LOCK_ALIGNMENT 
+#define __ONCE_ALIGNMENT 
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+
+
+
+
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+#define _THREAD_MUTEX_INTERNAL_H 1
+
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+
+
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+#define _RWLOCK_INTERNAL_H 
+
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+
+
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+
+#define __ONCE_FLAG_INIT { 0 }
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+#define __have_pthread_attr_t 1
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 19 "/usr/include/alloca.h" 3 4
+#define _ALLOCA_H 1
+
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+#undef alloca
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+#define alloca(size) __builtin_alloca (size)
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+#define __COMPAR_FN_T 
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 3 "out/test2-readme.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 4 "out/test2-readme.c" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 34 "/usr/include/assert.h" 3 4
+#define _ASSERT_H 1
+
+
+
+
+
+#define __ASSERT_VOID_CAST (void)
+# 65 "/usr/include/assert.h" 3 4
+#define _ASSERT_H_DECLS 
+
+
+
+extern void __assert_fail (const char *__assertion, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+# 107 "/usr/include/assert.h" 3 4
+#define assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))
+# 129 "/usr/include/assert.h" 3 4
+#define __ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__
+# 142 "/usr/include/assert.h" 3 4
+#undef static_assert
+#define static_assert _Static_assert
+# 5 "out/test2-readme.c" 2
+# 1 "/usr/include/uchar.h" 1 3 4
+# 24 "/usr/include/uchar.h" 3 4
+#define _UCHAR_H 1
+
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 30 "/usr/include/uchar.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h" 1 3 4
+
+#define __mbstate_t_defined 1
+
+
+
+typedef __mbstate_t mbstate_t;
+# 33 "/usr/include/uchar.h" 2 3 4
+# 51 "/usr/include/uchar.h" 3 4
+typedef __uint_least16_t char16_t;
+typedef __uint_least32_t char32_t;
+
+
+
+
+# 74 "/usr/include/uchar.h" 3 4
+extern size_t mbrtoc16 (char16_t *__restrict __pc16,
+   const char *__restrict __s, size_t __n,
+   mbstate_t *__restrict __p) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t c16rtomb (char *__restrict __s, char16_t __c16,
+   mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern size_t mbrtoc32 (char32_t *__restrict __pc32,
+   const char *__restrict __s, size_t __n,
+   mbstate_t *__restrict __p) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern size_t c32rtomb (char *__restrict __s, char32_t __c32,
+   mbstate_t *__restrict __ps) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 6 "out/test2-readme.c" 2
+# 1 "./include/va_print/file.h" 1
+# 12 "./include/va_print/file.h"
+#define VA_PRINT_FILE_H_ 
+
+
+# 1 "./include/va_print/core.h" 1
+# 12 "./include/va_print/core.h"
+#define VA_PRINT_CORE_H_ 
+
+# 1 "./include/va_print/base.h" 1
+# 12 "./include/va_print/base.h"
+#define VA_PRINT_BASE_H_ 
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+
+
+
+
+#define _GCC_MAX_ALIGN_T 
+
+
+
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 15 "./include/va_print/base.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 16 "./include/va_print/base.h" 2
+# 26 "./include/va_print/base.h"
+#define VA_CONCAT(A,B) VA_CONCAT1(A,B)
+#define VA_CONCAT1(A,B) VA_CONCAT2(A,B)
+#define VA_CONCAT2(A,B) A ## B
+
+#define VA_BLOCK_STMT(A) do{ A ;}while(0)
+#define VA_BLOCK_EXPR(A) __extension__({ A ;})
+
+
+#define VA_NIX 
+#define VA_EAT(...) 
+#define VA_ECHO(...) __VA_ARGS__
+#define VA_NOC(...) , ##__VA_ARGS__
+#define VA_PAR ()
+
+
+#define VA_EXP1(...) __VA_ARGS__
+#define VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))
+#define VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))
+#define VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))
+
+
+#define VA_P(X,...) X
+#define VA_F(...) VA_H
+
+
+#define VA_SUBVA_H(Z,N) Z
+#define VA_SUBVA_F(Z,N) N
+#define VA_OPT3(...) VA_P(__VA_ARGS__)
+#define VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)
+#define VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)
+#define VA_OPT0(...) __VA_ARGS__
+#define VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))
+
+
+#define VA_REC0B(F,A,...) A
+#define VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)
+#define VA_REC0() VA_REC0B
+#define VA_REC1() VA_REC1B
+#define VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)
+
+#define VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))
+
+
+
+
+#define VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })
+
+
+#define VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })
+
+
+
+
+
+
+
+#define VA_U_ENC 0x1f000000
+
+
+
+
+
+#define VA_U_DATA 0x00ffffff
+# 105 "./include/va_print/base.h"
+#define VA_U_EMORE (29,3U)
+
+
+
+
+
+
+#define VA_U_ECONT 0x80000000
+
+
+#define VA_U_ENC_ERR VA_U_ENC
+
+
+#define VA_U_ENC_UTF8 0x01000000
+
+
+#define VA_U_ENC_UTF16 0x02000000
+
+
+#define VA_U_ENC_UTF32 0x03000000
+
+
+#define VA_U_ENC_ISO88591 0x04000000
+
+
+
+
+
+
+#define VA_ENC_TAG(E) ((unsigned char)((E) >> 24))
+
+
+
+
+#define VA_U_REPLACEMENT 0xfffd
+
+
+#define VA_U_BOM 0xfeff
+
+
+#define VA_U_MAX 0x10ffff
+
+
+#define VA_U_MAXMAX VA_U_DATA
+
+
+#define VA_U_SURR_MIN 0xd800
+
+
+#define VA_U_SURR_MAX 0xdfff
+
+
+
+
+#define va_countof(A) (sizeof(A)/sizeof((A)[0]))
+# 173 "./include/va_print/base.h"
+#define va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = (_val); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })
+# 189 "./include/va_print/base.h"
+
+# 189 "./include/va_print/base.h"
+struct va_read_iter;
+
+
+
+typedef struct {
+
+
+    char const *type;
+# 211 "./include/va_print/base.h"
+    unsigned (*take)(struct va_read_iter *, void const *end);
+
+
+
+    void const *(*end)(struct va_read_iter *, size_t size);
+
+
+
+    void (*set_chunk_mode)(struct va_read_iter *);
+
+
+
+
+
+
+    size_t (*bulk)(
+        struct va_read_iter const *, void const *end, size_t max, size_t *cps);
+# 236 "./include/va_print/base.h"
+    size_t (*transcode)(
+        void *dst, unsigned char enc, void const *src, size_t n);
+
+
+
+    unsigned char has_size;
+
+
+
+    unsigned char chunk_mode;
+
+
+
+    unsigned char str_prefix;
+
+
+
+    unsigned char enc;
+
+    char _pad[sizeof(void*) - 4];
+} va_read_iter_vtab_t;
+# 269 "./include/va_print/base.h"
+#define VA_U_EOT -1U
+# 306 "./include/va_print/base.h"
+typedef struct va_read_iter {
+
+
+    va_read_iter_vtab_t const *vtab;
+
+
+    void const *cur;
+} va_read_iter_t;
+
+
+
+
+
+typedef struct {
+    va_read_iter_t super;
+    void const *end;
+} va_read_iter_end_t;
+
+struct va_format_lit;
+struct va_format_spec;
+# 337 "./include/va_print/base.h"
+typedef struct {
+
+
+    va_read_iter_vtab_t vtab;
+
+
+
+    void const *fmt;
+
+
+
+    struct va_format_lit const *lit;
+    size_t lit_cnt;
+
+
+
+    struct va_format_spec const *spec;
+    size_t spec_cnt;
+
+
+
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_format_t;
+
+typedef struct va_stream va_stream_t;
+
+
+typedef struct va_quotations va_quotations_t;
+
+
+
+
+
+
+
+typedef struct {
+
+    void (*init)(va_stream_t *);
+
+    void (*put)(va_stream_t *, unsigned c);
+
+
+    void (*finish)(va_stream_t *);
+
+
+
+
+
+
+    
+# 386 "./include/va_print/base.h" 3 4
+   _Bool 
+# 386 "./include/va_print/base.h"
+        (*refill)(va_stream_t *, size_t need);
+
+
+
+    void (*put_fill)(va_stream_t *, unsigned c, size_t count);
+
+
+
+
+
+    void (*put_len)(va_stream_t *, size_t count);
+
+
+
+
+    unsigned char enc;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vtab_t;
+
+
+
+
+
+
+typedef struct {
+    void *cur;
+    void *end;
+} va_window_t;
+# 439 "./include/va_print/base.h"
+struct va_stream {
+    va_stream_vtab_t const *vtab;
+    va_read_iter_t pat;
+    unsigned width;
+    unsigned prec;
+    unsigned opt;
+    unsigned qctxt;
+    va_window_t win;
+
+
+
+    va_quotations_t const *quote;
+};
+
+typedef struct va_print va_print_t;
+# 469 "./include/va_print/base.h"
+struct va_print {
+    void (*print) (va_stream_t *s, va_print_t *);
+    void const *value;
+    unsigned width;
+    unsigned prec;
+    unsigned opt;
+    unsigned _pad1;
+};
+
+
+
+
+#define VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })
+
+
+
+typedef struct va_span {
+    size_t size;
+    char const *data;
+} va_span_t;
+
+
+
+typedef struct va_span16 {
+    size_t size;
+    char16_t const *data;
+} va_span16_t;
+
+
+
+typedef struct va_span32 {
+    size_t size;
+    char32_t const *data;
+} va_span32_t;
+# 516 "./include/va_print/base.h"
+typedef struct {
+    unsigned code;
+} va_error_t;
+
+
+
+#define VA_E_OK 0
+
+
+
+#define VA_E_NULL 1
+
+
+
+#define VA_E_DECODE 2
+
+
+
+
+#define VA_E_ENCODE 3
+
+
+
+
+
+#define VA_E_TRUNC 4
+
+
+
+#define VA_E_FORMAT 5
+
+
+
+#define VA_E_ARGC 6
+
+
+
+#define VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)
+# 15 "./include/va_print/core.h" 2
+
+
+
+
+
+# 1 "./include/va_print/utf8.h" 1
+# 12 "./include/va_print/utf8.h"
+#define VA_PRINT_UTF8_H_ 
+# 23 "./include/va_print/utf8.h"
+extern va_read_iter_vtab_t const va_char_p_read_vtab_utf8;
+extern va_read_iter_vtab_t const va_span_p_read_vtab_utf8;
+extern va_read_iter_vtab_t const va_char_p_read_vtab_utf8_chunk;
+extern va_read_iter_vtab_t const va_span_p_read_vtab_utf8_chunk;
+# 52 "./include/va_print/utf8.h"
+extern unsigned va_char_p_take_utf8(
+    va_read_iter_t *i,
+    void const *end);
+
+
+
+
+extern unsigned va_span_p_take_utf8(
+    va_read_iter_t *,
+    void const *end);
+
+
+
+
+extern size_t va_char_p_bulk_utf8(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span_p_bulk_utf8(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+
+
+
+
+extern size_t va_char_p_transcode_utf8(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+# 105 "./include/va_print/utf8.h"
+extern void va_put_utf8(
+    va_stream_t *s,
+    unsigned c,
+    void (*put)(va_stream_t *, char));
+
+
+
+
+
+
+extern size_t va_len_utf8(
+    va_stream_t *,
+    unsigned);
+
+extern va_stream_t *va_xprintf_char_p_utf8(
+    va_stream_t *,
+    char const *x);
+
+extern va_stream_t *va_xprintf_char_const_pp_utf8(
+    va_stream_t *,
+    char const **);
+
+extern va_stream_t *va_xprintf_char_pp_utf8(
+    va_stream_t *,
+    char **);
+
+extern va_stream_t *va_xprintf_last_char_p_utf8(
+    va_stream_t *,
+    char const *x);
+
+extern va_stream_t *va_xprintf_last_char_const_pp_utf8(
+    va_stream_t *,
+    char const **);
+
+extern va_stream_t *va_xprintf_last_char_pp_utf8(
+    va_stream_t *,
+    char **);
+
+extern va_stream_t *va_xprintf_span_p_utf8(
+    va_stream_t *,
+    va_span_t const *);
+
+extern va_stream_t *va_xprintf_last_span_p_utf8(
+    va_stream_t *,
+    va_span_t const *);
+
+extern void va_char_p_set_chunk_mode(
+    va_read_iter_t *iter);
+
+extern void va_span_p_set_chunk_mode(
+    va_read_iter_t *iter);
+# 21 "./include/va_print/core.h" 2
+
+#define va_char_p_format utf8
+
+
+
+
+
+#define va_char_p_decode utf8
+
+
+
+# 1 "./include/va_print/utf16.h" 1
+# 12 "./include/va_print/utf16.h"
+#define VA_PRINT_UTF16_H_ 
+# 24 "./include/va_print/utf16.h"
+extern va_read_iter_vtab_t const va_char16_p_read_vtab_utf16;
+extern va_read_iter_vtab_t const va_span16_p_read_vtab_utf16;
+extern va_read_iter_vtab_t const va_char16_p_read_vtab_utf16_chunk;
+extern va_read_iter_vtab_t const va_span16_p_read_vtab_utf16_chunk;
+
+
+
+
+extern unsigned va_char16_p_take_utf16(
+    va_read_iter_t *,
+    void const *end);
+
+extern unsigned va_span16_p_take_utf16(
+    va_read_iter_t *,
+    void const *end);
+
+
+
+
+extern size_t va_char16_p_bulk_utf16(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span16_p_bulk_utf16(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+
+
+
+
+extern size_t va_char16_p_transcode_utf16(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+# 78 "./include/va_print/utf16.h"
+extern void va_put_utf16(
+    va_stream_t *,
+    unsigned,
+    void (*put)(va_stream_t *, char16_t));
+
+
+
+
+
+
+extern size_t va_len_utf16(
+    va_stream_t *,
+    unsigned);
+
+extern va_stream_t *va_xprintf_char16_p_utf16(
+    va_stream_t *,
+    char16_t const *);
+
+extern va_stream_t *va_xprintf_char16_const_pp_utf16(
+    va_stream_t *,
+    char16_t const **);
+
+extern va_stream_t *va_xprintf_char16_pp_utf16(
+    va_stream_t *,
+    char16_t **);
+
+extern va_stream_t *va_xprintf_last_char16_p_utf16(
+    va_stream_t *,
+    char16_t const *);
+
+extern va_stream_t *va_xprintf_last_char16_const_pp_utf16(
+    va_stream_t *,
+    char16_t const **);
+
+extern va_stream_t *va_xprintf_last_char16_pp_utf16(
+    va_stream_t *,
+    char16_t **);
+
+extern va_stream_t *va_xprintf_span16_p_utf16(
+    va_stream_t *,
+    va_span16_t const *);
+
+extern va_stream_t *va_xprintf_last_span16_p_utf16(
+    va_stream_t *,
+    va_span16_t const *);
+
+extern void va_char16_p_set_chunk_mode(
+    va_read_iter_t *iter);
+
+extern void va_span16_p_set_chunk_mode(
+    va_read_iter_t *iter);
+# 33 "./include/va_print/core.h" 2
+
+#define va_char16_p_format utf16
+
+
+
+
+
+#define va_char16_p_decode utf16
+
+
+
+# 1 "./include/va_print/utf32.h" 1
+# 12 "./include/va_print/utf32.h"
+#define VA_PRINT_UTF32_H_ 
+# 24 "./include/va_print/utf32.h"
+extern va_read_iter_vtab_t const va_char32_p_read_vtab_utf32;
+
+extern va_read_iter_vtab_t const va_span32_p_read_vtab_utf32;
+
+
+
+
+extern unsigned va_char32_p_take_utf32(
+    va_read_iter_t *,
+    void const *end);
+
+extern unsigned va_span32_p_take_utf32(
+    va_read_iter_t *,
+    void const *end);
+
+
+
+
+extern size_t va_char32_p_bulk_utf32(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+extern size_t va_span32_p_bulk_utf32(
+    va_read_iter_t const *,
+    void const *end,
+    size_t max,
+    size_t *cps);
+
+
+
+
+
+extern size_t va_char32_p_transcode_utf32(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n);
+# 77 "./include/va_print/utf32.h"
+extern void va_put_utf32(
+    va_stream_t *,
+    unsigned,
+    void (*put)(va_stream_t *, char32_t));
+
+
+
+
+
+
+extern size_t va_len_utf32(
+    va_stream_t *,
+    unsigned);
+
+extern va_stream_t *va_xprintf_char32_p_utf32(
+    va_stream_t *,
+    char32_t const *);
+
+extern va_stream_t *va_xprintf_char32_const_pp_utf32(
+    va_stream_t *,
+    char32_t const **);
+
+extern va_stream_t *va_xprintf_char32_pp_utf32(
+    va_stream_t *,
+    char32_t **);
+
+extern va_stream_t *va_xprintf_last_char32_p_utf32(
+    va_stream_t *,
+    char32_t const *);
+
+extern va_stream_t *va_xprintf_last_char32_const_pp_utf32(
+    va_stream_t *,
+    char32_t const **);
+
+extern va_stream_t *va_xprintf_last_char32_pp_utf32(
+    va_stream_t *,
+    char32_t **);
+
+extern va_stream_t *va_xprintf_span32_p_utf32(
+    va_stream_t *,
+    va_span32_t const *);
+
+extern va_stream_t *va_xprintf_last_span32_p_utf32(
+    va_stream_t *,
+    va_span32_t const *);
+# 45 "./include/va_print/core.h" 2
+
+#define va_char32_p_format utf32
+
+
+
+
+
+#define va_char32_p_decode utf32
+
+
+
+
+#define VA_SIGIL '~'
+# 70 "./include/va_print/core.h"
+#define va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(fun ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_const_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,va_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_,va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,va_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(fun ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCAT(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t const *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bool:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulong, unsigned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)
+# 109 "./include/va_print/core.h"
+#define va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(va_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CONCAT(va_char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)
+# 132 "./include/va_print/core.h"
+#define va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))
+# 142 "./include/va_print/core.h"
+#define VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)
+# 169 "./include/va_print/core.h"
+#define va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))
+# 185 "./include/va_print/core.h"
+#define va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)
+# 203 "./include/va_print/core.h"
+#define va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))
+
+
+
+
+#define va_xformat(i,s,a) va_xformat ## i (s,a)
+#define va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)
+#define va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)
+
+#define va_xinit(i,arg) (va_xinit ## i arg)
+#define va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))
+
+
+
+#define va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)
+
+
+
+
+#define VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))
+
+
+
+
+
+
+
+#define va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))
+
+
+
+
+
+#define va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)
+
+
+
+
+extern va_read_iter_vtab_t const va_char_p_read_vtab_iso8859_1;
+
+
+
+extern va_read_iter_vtab_t const va_format_read_vtab;
+
+
+
+extern char const va_format_type[];
+
+
+
+
+extern va_stream_t *va_xprintf_schar(va_stream_t *, signed char x);
+extern va_stream_t *va_xprintf_short(va_stream_t *, short x);
+extern va_stream_t *va_xprintf_sint(va_stream_t *, int x);
+extern va_stream_t *va_xprintf_slong(va_stream_t *, long x);
+extern va_stream_t *va_xprintf_sll(va_stream_t *, long long x);
+
+extern va_stream_t *va_xprintf_uchar(va_stream_t *, unsigned char x);
+extern va_stream_t *va_xprintf_ushort(va_stream_t *, unsigned short x);
+extern va_stream_t *va_xprintf_bool(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_uint(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_ulong(va_stream_t *, unsigned long x);
+extern va_stream_t *va_xprintf_ull(va_stream_t *, unsigned long long x);
+
+extern va_stream_t *va_xprintf_ptr(va_stream_t *, void const *);
+extern va_stream_t *va_xprintf_char(va_stream_t *, char x);
+extern va_stream_t *va_xprintf_error_t_p(va_stream_t *, va_error_t *x);
+
+extern va_stream_t *va_xprintf_iter_chunk(va_stream_t *, va_read_iter_t *);
+extern va_stream_t *va_xprintf_iter(va_stream_t *, va_read_iter_t *);
+
+extern va_stream_t *va_xprintf_iter_local(va_stream_t *, va_read_iter_t *);
+extern va_stream_t *va_xprintf_custom(va_stream_t *, va_print_t *);
+
+extern va_stream_t *va_xprintf_last_schar(va_stream_t *, signed char x);
+extern va_stream_t *va_xprintf_last_short(va_stream_t *, short x);
+extern va_stream_t *va_xprintf_last_sint(va_stream_t *, int x);
+extern va_stream_t *va_xprintf_last_slong(va_stream_t *, long x);
+extern va_stream_t *va_xprintf_last_sll(va_stream_t *, long long x);
+
+extern va_stream_t *va_xprintf_last_uchar(va_stream_t *, unsigned char x);
+extern va_stream_t *va_xprintf_last_ushort(va_stream_t *, unsigned short x);
+extern va_stream_t *va_xprintf_last_bool(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_last_uint(va_stream_t *, unsigned int x);
+extern va_stream_t *va_xprintf_last_ulong(va_stream_t *, unsigned long x);
+extern va_stream_t *va_xprintf_last_ull(va_stream_t *, unsigned long long x);
+
+extern va_stream_t *va_xprintf_last_ptr(va_stream_t *, void const *);
+extern va_stream_t *va_xprintf_last_char(va_stream_t *, char x);
+extern va_stream_t *va_xprintf_last_error_t_p(va_stream_t *, va_error_t *x);
+
+extern va_stream_t *va_xprintf_last_iter_chunk(va_stream_t *, va_read_iter_t *);
+extern va_stream_t *va_xprintf_last_custom(va_stream_t *, va_print_t *);
+
+
+
+static inline va_stream_t *va_xprintf_init(
+    va_stream_t *s,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab)
+{
+    s->pat = ((va_read_iter_t){ (get_vtab),(x) });
+    return s;
+}
+# 317 "./include/va_print/core.h"
+extern va_stream_t *va_xprintf_init_last(
+    va_stream_t *,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+
+
+
+
+extern va_stream_t *va_xprintf_init_last_plain(
+    va_stream_t *,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+
+
+
+
+
+__attribute__((always_inline))
+static inline 
+# 337 "./include/va_print/core.h" 3 4
+             _Bool 
+# 337 "./include/va_print/core.h"
+                  va_format_plain_f(void const *x, size_t n)
+{
+    return __builtin_constant_p(__builtin_memchr(x, '~', n) == 
+# 339 "./include/va_print/core.h" 3 4
+                                                                   ((void *)0)
+# 339 "./include/va_print/core.h"
+                                                                       ) &&
+        (__builtin_memchr(x, '~', n) == 
+# 340 "./include/va_print/core.h" 3 4
+                                            ((void *)0)
+# 340 "./include/va_print/core.h"
+                                                );
+}
+
+
+
+
+
+
+extern unsigned va_stream_get_error_f(va_stream_t const *s);
+
+
+
+
+
+extern char const *va_strerror(unsigned);
+
+
+
+
+
+
+extern va_format_t *va_format_compile_f(
+    void *(*alloc)(void *, size_t nmemb, size_t size),
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab);
+
+
+
+
+
+extern void va_format_free(va_format_t *);
+# 16 "./include/va_print/file.h" 2
+
+
+
+
+
+# 1 "./include/va_print/file_utf8.h" 1
+# 12 "./include/va_print/file_utf8.h"
+#define VA_PRINT_FILE_UTF8_H_ 
+# 24 "./include/va_print/file_utf8.h"
+extern va_stream_vtab_t const va_file_vtab_utf8;
+# 22 "./include/va_print/file.h" 2
+
+#define va_file_encode utf8
+
+
+
+# 1 "./include/va_print/file_utf16be.h" 1
+# 12 "./include/va_print/file_utf16be.h"
+#define VA_PRINT_FILE_UTF16BE_H_ 
+# 24 "./include/va_print/file_utf16be.h"
+extern va_stream_vtab_t const va_file16_vtab_utf16be;
+# 28 "./include/va_print/file.h" 2
+
+#define va_file16_encode utf16be
+
+
+
+# 1 "./include/va_print/file_utf32be.h" 1
+# 12 "./include/va_print/file_utf32be.h"
+#define VA_PRINT_FILE_UTF32BE_H_ 
+# 24 "./include/va_print/file_utf32be.h"
+extern va_stream_vtab_t const va_file32_vtab_utf32be;
+# 34 "./include/va_print/file.h" 2
+
+#define va_file32_encode utf32be
+
+
+
+
+#define va_file_buf_size 256
+# 53 "./include/va_print/file.h"
+#define VA_STREAM_FILE(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), NULL, 0, 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FILE16(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), NULL, 0, 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FILE32(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), NULL, 0, 0, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_FILE_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), (B), (N), 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FILE16_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), (B), (N), 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FILE32_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), (B), (N), 0, 0, {0} })
+# 100 "./include/va_print/file.h"
+#define va_xfprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_file_buf_[va_file_buf_size]; va_stream_file_t va_file_s_ = STREAM_BUF(F, va_file_buf_, sizeof(va_file_buf_)); va_file_s_.autoflush = true; (void)va_xprintf(&va_file_s_, __VA_ARGS__))
+# 112 "./include/va_print/file.h"
+#define va_fprintf(F,...) va_xfprintf(VA_STREAM_FILE_BUF, F, __VA_ARGS__)
+
+
+
+
+
+
+#define va_ufprintf(F,...) va_xfprintf(VA_STREAM_FILE16_BUF, F, __VA_ARGS__)
+
+
+
+
+
+
+#define va_Ufprintf(F,...) va_xfprintf(VA_STREAM_FILE32_BUF, F, __VA_ARGS__)
+
+
+
+
+
+
+#define va_printf(...) va_fprintf(stdout, __VA_ARGS__)
+
+
+
+
+
+
+#define va_eprintf(...) va_fprintf(stderr, __VA_ARGS__)
+# 159 "./include/va_print/file.h"
+typedef struct {
+    va_stream_t s;
+    FILE *file;
+    char *data;
+    size_t size;
+    size_t pos;
+    
+# 165 "./include/va_print/file.h" 3 4
+   _Bool 
+# 165 "./include/va_print/file.h"
+        autoflush;
+    char _pad[sizeof(size_t) - 1];
+} va_stream_file_t;
+# 176 "./include/va_print/file.h"
+extern void va_file_init(va_stream_t *);
+
+
+
+
+
+extern void va_file_finish(va_stream_t *);
+
+
+
+
+
+
+extern void va_file_flush(va_stream_file_t *);
+
+
+
+
+
+extern 
+# 195 "./include/va_print/file.h" 3 4
+      _Bool 
+# 195 "./include/va_print/file.h"
+           va_file_refill(va_stream_t *, size_t);
+
+
+
+
+
+
+extern void va_file_write(va_stream_t *, void const *, size_t);
+
+
+
+
+
+extern void va_file_fill(va_stream_t *, void const *x, size_t k, size_t n);
+
+extern void va_file_put(va_stream_t *, char);
+extern void va_file16_put_be(va_stream_t *, char16_t);
+extern void va_file16_put_le(va_stream_t *, char16_t);
+extern void va_file32_put_be(va_stream_t *, char32_t);
+extern void va_file32_put_le(va_stream_t *, char32_t);
+extern void va_file_put_fill(va_stream_t *, unsigned, size_t);
+extern void va_file16_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_file16_put_fill_le(va_stream_t *, unsigned, size_t);
+extern void va_file32_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_file32_put_fill_le(va_stream_t *, unsigned, size_t);
+# 7 "out/test2-readme.c" 2
+
+#pragma GCC diagnostic ignored "-Wmissing-prototypes"
+#pragma GCC diagnostic ignored "-Wvla"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+
+
+static char msg[] = "foo";
+typedef char16_t SomeCharacterType;
+# 33 "out/test2-readme.c"
+# 1 "./include/va_print/char.h" 1
+# 12 "./include/va_print/char.h"
+#define VA_PRINT_CHAR_H_ 
+
+
+
+
+
+
+
+# 1 "./include/va_print/char_utf8.h" 1
+# 12 "./include/va_print/char_utf8.h"
+#define VA_PRINT_CHAR_UTF8_H_ 
+# 23 "./include/va_print/char_utf8.h"
+extern va_stream_vtab_t const va_char_p_vtab_utf8;
+extern va_stream_vtab_t const va_char_p_size_vtab_utf8;
+# 21 "./include/va_print/char.h" 2
+
+#define va_char_p_encode utf8
+
+
+
+# 1 "./include/va_print/char_utf16.h" 1
+# 12 "./include/va_print/char_utf16.h"
+#define VA_PRINT_CHAR_UTF16_H_ 
+# 23 "./include/va_print/char_utf16.h"
+extern va_stream_vtab_t const va_char16_p_vtab_utf16;
+extern va_stream_vtab_t const va_char16_p_size_vtab_utf16;
+# 27 "./include/va_print/char.h" 2
+
+#define va_char16_p_encode utf16
+
+
+
+# 1 "./include/va_print/char_utf32.h" 1
+# 12 "./include/va_print/char_utf32.h"
+#define VA_PRINT_CHAR_UTF32_H_ 
+# 23 "./include/va_print/char_utf32.h"
+extern va_stream_vtab_t const va_char32_p_vtab_utf32;
+extern va_stream_vtab_t const va_char32_p_size_vtab_utf32;
+# 33 "./include/va_print/char.h" 2
+
+#define va_char32_p_encode utf32
+# 46 "./include/va_print/char.h"
+#define va_char_p_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_vtab_,va_char32_p_encode))
+
+
+
+
+
+
+#define va_char_p_size_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_size_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_size_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_size_vtab_,va_char32_p_encode))
+
+
+
+
+
+
+#define VA_STREAM_CHAR_P(S,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_vtab_gen(S)), (S), (N), 0 })
+# 69 "./include/va_print/char.h"
+#define VA_STREAM_CHAR_SIZE(Char,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_size_vtab_gen((Char*)NULL)), NULL, (N), 0 })
+
+
+
+
+
+
+#define VA_STREAM_CHAR_ARR(S) VA_STREAM_CHAR_P(S,va_countof(S))
+# 95 "./include/va_print/char.h"
+#define va_snprintf(S,N,...) VA_BLOCK_EXPR((__typeof__(*(S))*)(va_xprintf( &VA_STREAM_CHAR_P(S,N), __VA_ARGS__)->data))
+# 110 "./include/va_print/char.h"
+#define va_sprintf(S,...) va_snprintf(S,va_countof(S),__VA_ARGS__)
+# 124 "./include/va_print/char.h"
+#define va_gnprintf(Char,N,...) ((Char*)(va_xprintf( &VA_STREAM_CHAR_P((Char[N]){0}, N), __VA_ARGS__)->data))
+# 134 "./include/va_print/char.h"
+#define va_nprintf(...) va_gnprintf(char, __VA_ARGS__)
+
+
+
+
+
+
+
+#define va_unprintf(...) va_gnprintf(char16_t, __VA_ARGS__)
+
+
+
+
+
+
+
+#define va_Unprintf(...) va_gnprintf(char32_t, __VA_ARGS__)
+# 163 "./include/va_print/char.h"
+#define va_gzprintf(Char,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, -(size_t)2), __VA_ARGS__)->pos + 1)
+# 174 "./include/va_print/char.h"
+#define va_zprintf(...) va_gzprintf(char, __VA_ARGS__)
+# 183 "./include/va_print/char.h"
+#define va_uzprintf(...) va_gzprintf(char16_t, __VA_ARGS__)
+# 192 "./include/va_print/char.h"
+#define va_Uzprintf(...) va_gzprintf(char32_t, __VA_ARGS__)
+# 203 "./include/va_print/char.h"
+#define va_gznprintf(Char,N,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, (size_t)(N) + 1), __VA_ARGS__)->pos + 1)
+
+
+
+
+
+
+
+#define va_znprintf(...) va_gznprintf(char, __VA_ARGS__)
+
+
+
+
+
+#define va_uznprintf(...) va_gznprintf(char16_t, __VA_ARGS__)
+
+
+
+
+
+#define va_Uznprintf(...) va_gznprintf(char32_t, __VA_ARGS__)
+
+
+
+
+typedef struct {
+    va_stream_t s;
+    void *data;
+    size_t size;
+    size_t pos;
+} va_stream_char_p_t;
+
+
+
+
+extern void const *va_char_p_end(
+    va_read_iter_t *,
+    size_t);
+
+extern void va_char_p_init(
+    va_stream_t *s);
+
+extern void va_char_p_finish(
+    va_stream_t *s);
+
+extern 
+# 248 "./include/va_print/char.h" 3 4
+      _Bool 
+# 248 "./include/va_print/char.h"
+           va_char_p_refill(
+    va_stream_t *s,
+    size_t need);
+
+extern void va_char_p_put_fill(
+    va_stream_t *,
+    unsigned c,
+    size_t n);
+
+extern void va_char_p_put(
+    va_stream_t *,
+    char);
+
+
+
+
+extern void va_char_p_put_len(
+    va_stream_t *,
+    size_t n);
+
+extern void const *va_char16_p_end(
+    va_read_iter_t *,
+    size_t);
+
+extern void va_char16_p_init(
+    va_stream_t *s);
+
+extern void va_char16_p_finish(
+    va_stream_t *s);
+
+extern 
+# 278 "./include/va_print/char.h" 3 4
+      _Bool 
+# 278 "./include/va_print/char.h"
+           va_char16_p_refill(
+    va_stream_t *s,
+    size_t need);
+
+extern void va_char16_p_put_fill(
+    va_stream_t *,
+    unsigned c,
+    size_t n);
+
+extern void va_char16_p_put(
+    va_stream_t *,
+    char16_t);
+
+extern void const *va_char32_p_end(
+    va_read_iter_t *,
+    size_t);
+
+extern void va_char32_p_init(
+    va_stream_t *s);
+
+extern void va_char32_p_finish(
+    va_stream_t *s);
+
+extern 
+# 301 "./include/va_print/char.h" 3 4
+      _Bool 
+# 301 "./include/va_print/char.h"
+           va_char32_p_refill(
+    va_stream_t *s,
+    size_t need);
+
+extern void va_char32_p_put_fill(
+    va_stream_t *,
+    unsigned c,
+    size_t n);
+
+extern void va_char32_p_put(
+    va_stream_t *,
+    char32_t);
+# 34 "out/test2-readme.c" 2
+
+FILE *open_text_rd1(char const *dir, char const *file, unsigned suffix)
+{
+    return fopen(((char*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[80]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[80]){0}), (80), 0 })))(_Generic(suffix, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 37 "out/test2-readme.c" 3 4
+                _Bool
+# 37 "out/test2-readme.c"
+                :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(file, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 37 "out/test2-readme.c" 3 4
+                _Bool
+# 37 "out/test2-readme.c"
+                :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(dir, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 37 "out/test2-readme.c" 3 4
+                _Bool
+# 37 "out/test2-readme.c"
+                :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[80]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[80]){0}), (80), 0 }))):((void*)0)), "~s/~s~.s", _Generic("~s/~s~.s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),dir),file),suffix)))->data)), "rt");
+}
+
+
+
+
+FILE *open_text_rd2(
+    char const *dir, char const *file, unsigned suffix)
+{
+    va_error_t e;
+    char *fn = ((char*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[80]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[80]){0}), (80), 0 })))(_Generic(&e, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 47 "out/test2-readme.c" 3 4
+              _Bool
+# 47 "out/test2-readme.c"
+              :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(suffix, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 47 "out/test2-readme.c" 3 4
+              _Bool
+# 47 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(file, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 47 "out/test2-readme.c" 3 4
+              _Bool
+# 47 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(dir, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 47 "out/test2-readme.c" 3 4
+              _Bool
+# 47 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[80]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[80]){0}), (80), 0 }))):((void*)0)), "~s/~s~.s", _Generic("~s/~s~.s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),dir),file),suffix),&e)))->data));
+    if (e.code != 0) {
+        return 
+# 49 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 49 "out/test2-readme.c"
+                  ;
+    }
+    return fopen(fn, "rt");
+}
+
+
+
+
+
+
+FILE *open_text_rd3(
+    char16_t const *dir, char16_t const *file, unsigned suffix)
+{
+    va_error_t e;
+    char *fn = ((char*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[80]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[80]){0}), (80), 0 })))(_Generic(&e, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 63 "out/test2-readme.c" 3 4
+              _Bool
+# 63 "out/test2-readme.c"
+              :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(suffix, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 63 "out/test2-readme.c" 3 4
+              _Bool
+# 63 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(file, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 63 "out/test2-readme.c" 3 4
+              _Bool
+# 63 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(dir, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 63 "out/test2-readme.c" 3 4
+              _Bool
+# 63 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[80]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[80]){0}), (80), 0 }))):((void*)0)), U"~s/~s~.s", _Generic(U"~s/~s~.s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),dir),file),suffix),&e)))->data));
+    if (e.code != 0) {
+        return 
+# 65 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 65 "out/test2-readme.c"
+                  ;
+    }
+    return fopen(fn, "rt");
+}
+
+
+
+
+
+
+
+# 1 "./include/va_print/alloc.h" 1
+# 14 "./include/va_print/alloc.h"
+#define VA_PRINT_MALLOC_H_ 
+
+
+
+
+
+
+
+# 1 "./include/va_print/alloc_utf8.h" 1
+# 14 "./include/va_print/alloc_utf8.h"
+#define VA_PRINT_MALLOC_UTF8_H_ 
+# 25 "./include/va_print/alloc_utf8.h"
+extern va_stream_vtab_t const va_vec_vtab_utf8;
+# 23 "./include/va_print/alloc.h" 2
+
+#define va_vec_encode utf8
+
+
+
+# 1 "./include/va_print/alloc_utf16.h" 1
+# 14 "./include/va_print/alloc_utf16.h"
+#define VA_PRINT_MALLOC_UTF16_H_ 
+# 25 "./include/va_print/alloc_utf16.h"
+extern va_stream_vtab_t const va_vec16_vtab_utf16;
+# 29 "./include/va_print/alloc.h" 2
+
+#define va_vec16_encode utf16
+
+
+
+# 1 "./include/va_print/alloc_utf32.h" 1
+# 14 "./include/va_print/alloc_utf32.h"
+#define VA_PRINT_MALLOC_UTF32_H_ 
+# 25 "./include/va_print/alloc_utf32.h"
+extern va_stream_vtab_t const va_vec32_vtab_utf32;
+# 35 "./include/va_print/alloc.h" 2
+
+#define va_vec32_encode utf32
+
+
+
+
+#define va_asprintf_init_size 16
+
+
+
+
+#define va_asprintf_stage_size 512
+
+
+
+
+#define va_arena_chunk_size 4096
+
+
+
+
+
+#define va_tprintf_slots 4
+# 69 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC(M) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC_STAGE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })
+# 86 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC_INLINE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC_ARENA(A) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_VEC16(M) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC16_STAGE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })
+# 118 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC16_INLINE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC16_ARENA(A) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_VEC32(M) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC32_STAGE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })
+# 150 "./include/va_print/alloc.h"
+#define VA_STREAM_VEC32_INLINE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_VEC32_ARENA(A) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })
+# 191 "./include/va_print/alloc.h"
+#define va_axprintf(alloc,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC(alloc), __VA_ARGS__)->data)
+# 207 "./include/va_print/alloc.h"
+#define va_uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16(M), __VA_ARGS__)->data)
+# 223 "./include/va_print/alloc.h"
+#define va_Uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32(M), __VA_ARGS__)->data)
+# 238 "./include/va_print/alloc.h"
+#define va_aexprintf(alloc,...) VA_BLOCK_EXPR( char va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_uaexprintf(alloc,...) VA_BLOCK_EXPR( char16_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC16_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_Uaexprintf(alloc,...) VA_BLOCK_EXPR( char32_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC32_STAGE(alloc, va_stage_), __VA_ARGS__)->data)
+# 271 "./include/va_print/alloc.h"
+#define va_bxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC_INLINE(alloc, B), __VA_ARGS__))
+
+
+
+
+
+#define va_ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC16_INLINE(alloc, B), __VA_ARGS__))
+
+
+
+
+
+#define va_Ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC32_INLINE(alloc, B), __VA_ARGS__))
+
+
+
+
+
+#define va_bprintf(B,...) va_bxprintf(va_alloc, B, __VA_ARGS__)
+
+
+
+
+#define va_ubprintf(B,...) va_ubxprintf(va_alloc, B, __VA_ARGS__)
+
+
+
+
+#define va_Ubprintf(B,...) va_Ubxprintf(va_alloc, B, __VA_ARGS__)
+
+
+
+
+
+
+#define va_vec_is_inline(T) (((T)->data != NULL) && ((T)->data == (T)->stage))
+
+
+
+
+
+
+#define VA_ARENA(M) ((va_arena_t){ NULL, NULL, va_arena_chunk_size, (M) })
+# 327 "./include/va_print/alloc.h"
+#define va_arena_printf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC_ARENA(A), __VA_ARGS__)->data)
+
+
+
+
+
+#define va_arena_uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16_ARENA(A), __VA_ARGS__)->data)
+
+
+
+
+
+#define va_arena_Uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32_ARENA(A), __VA_ARGS__)->data)
+# 357 "./include/va_print/alloc.h"
+#define va_tprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec16(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_Utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec32(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), __VA_ARGS__)->data)
+
+
+
+
+
+
+
+#define va_asprintf(...) va_axprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_uasprintf(...) va_uaxprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_Uasprintf(...) va_Uaxprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_aeprintf(...) va_aexprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_uaeprintf(...) va_uaexprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_Uaeprintf(...) va_Uaexprintf(va_alloc, __VA_ARGS__)
+
+
+
+
+
+#define va_format_compile(X) va_format_xcompile(va_alloc, X)
+
+
+
+
+typedef struct va_arena_chunk va_arena_chunk_t;
+# 431 "./include/va_print/alloc.h"
+typedef struct {
+
+    va_arena_chunk_t *chunk;
+
+    void *last;
+
+    size_t chunk_size;
+
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_arena_t;
+
+typedef struct {
+    va_stream_t s;
+    char *data;
+    size_t size;
+    size_t pos;
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+    char *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vec_t;
+
+typedef struct {
+    va_stream_t s;
+    char16_t *data;
+    size_t size;
+    size_t pos;
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+    char16_t *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vec16_t;
+
+typedef struct {
+    va_stream_t s;
+    char32_t *data;
+    size_t size;
+    size_t pos;
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+    char32_t *stage;
+    va_arena_t *arena;
+    unsigned char keep;
+    char _pad[sizeof(void*) - 1];
+} va_stream_vec32_t;
+
+
+
+
+extern void va_vec_init(
+    va_stream_t *);
+
+extern void va_vec_finish(
+    va_stream_t *);
+
+extern 
+# 487 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 487 "./include/va_print/alloc.h"
+           va_vec_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_vec_put(
+    va_stream_t *,
+    char);
+
+extern void va_vec16_init(
+    va_stream_t *);
+
+extern void va_vec16_finish(
+    va_stream_t *);
+
+extern 
+# 501 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 501 "./include/va_print/alloc.h"
+           va_vec16_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_vec16_put(
+    va_stream_t *,
+    char16_t);
+
+extern void va_vec32_init(
+    va_stream_t *);
+
+extern void va_vec32_finish(
+    va_stream_t *);
+
+extern 
+# 515 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 515 "./include/va_print/alloc.h"
+           va_vec32_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_vec32_put(
+    va_stream_t *,
+    char32_t);
+# 549 "./include/va_print/alloc.h"
+extern void va_vec_clear(
+    va_stream_vec_t *);
+
+extern 
+# 552 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 552 "./include/va_print/alloc.h"
+           va_vec_reserve(
+    va_stream_vec_t *,
+    size_t n);
+
+extern void va_vec_shrink(
+    va_stream_vec_t *,
+    size_t n);
+
+extern va_span_t *va_vec_span(
+    va_stream_vec_t *,
+    va_span_t *span);
+
+extern void va_vec_free(
+    va_stream_vec_t *);
+
+extern void va_vec16_clear(
+    va_stream_vec16_t *);
+
+extern 
+# 570 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 570 "./include/va_print/alloc.h"
+           va_vec16_reserve(
+    va_stream_vec16_t *,
+    size_t n);
+
+extern void va_vec16_shrink(
+    va_stream_vec16_t *,
+    size_t n);
+
+extern va_span16_t *va_vec16_span(
+    va_stream_vec16_t *,
+    va_span16_t *span);
+
+extern void va_vec16_free(
+    va_stream_vec16_t *);
+
+extern void va_vec32_clear(
+    va_stream_vec32_t *);
+
+extern 
+# 588 "./include/va_print/alloc.h" 3 4
+      _Bool 
+# 588 "./include/va_print/alloc.h"
+           va_vec32_reserve(
+    va_stream_vec32_t *,
+    size_t n);
+
+extern void va_vec32_shrink(
+    va_stream_vec32_t *,
+    size_t n);
+
+extern va_span32_t *va_vec32_span(
+    va_stream_vec32_t *,
+    va_span32_t *span);
+
+extern void va_vec32_free(
+    va_stream_vec32_t *);
+# 611 "./include/va_print/alloc.h"
+extern va_stream_vec_t *va_tmp_vec(
+    va_stream_vtab_t const *vtab);
+
+
+
+
+
+extern va_stream_vec16_t *va_tmp_vec16(
+    va_stream_vtab_t const *vtab);
+
+
+
+
+
+extern va_stream_vec32_t *va_tmp_vec32(
+    va_stream_vtab_t const *vtab);
+
+
+
+
+
+
+
+extern void va_tprintf_free(void);
+# 652 "./include/va_print/alloc.h"
+extern void *va_alloc(
+    void *data,
+    size_t nmemb,
+    size_t size);
+
+
+
+
+
+
+
+extern void *va_arena_alloc(
+    va_arena_t *arena,
+    void *data,
+    size_t nmemb,
+    size_t size);
+
+
+
+
+
+extern void va_arena_reset(
+    va_arena_t *arena);
+
+
+
+
+
+extern void va_arena_free(
+    va_arena_t *arena);
+# 77 "out/test2-readme.c" 2
+
+FILE *open_text_rd4(char const *dir, char const *file, unsigned suffix)
+{
+    FILE *f = 
+# 80 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 80 "out/test2-readme.c"
+                 ;
+    va_error_t e;
+    char *fn = __extension__({ ((__typeof__(&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 82 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 82 "out/test2-readme.c"
+              , 16, 0, (va_alloc), 
+# 82 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 82 "out/test2-readme.c"
+              , 
+# 82 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 82 "out/test2-readme.c"
+              , 0, {0} })))(_Generic(&e, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 82 "out/test2-readme.c" 3 4
+              _Bool
+# 82 "out/test2-readme.c"
+              :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(suffix, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 82 "out/test2-readme.c" 3 4
+              _Bool
+# 82 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(file, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 82 "out/test2-readme.c" 3 4
+              _Bool
+# 82 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(dir, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 82 "out/test2-readme.c" 3 4
+              _Bool
+# 82 "out/test2-readme.c"
+              :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 82 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 82 "out/test2-readme.c"
+              , 16, 0, (va_alloc), 
+# 82 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 82 "out/test2-readme.c"
+              , 
+# 82 "out/test2-readme.c" 3 4
+              ((void *)0)
+# 82 "out/test2-readme.c"
+              , 0, {0} }))):((void*)0)), "~s/~s~.s", _Generic("~s/~s~.s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),dir),file),suffix),&e)))->data ;});
+    if (e.code == 0) {
+        f = fopen(fn, "rt");
+    }
+    free(fn);
+    return f;
+}
+
+
+
+
+# 1 "./include/va_print/len.h" 1
+# 12 "./include/va_print/len.h"
+#define VA_PRINT_LEN_H_ 
+# 25 "./include/va_print/len.h"
+#define VA_STREAM_LEN() VA_STREAM_LEN_MAX(-(size_t)1)
+
+
+
+
+
+#define VA_STREAM_LEN_MAX(N) ((va_stream_len_t){ VA_STREAM(&va_len_vtab), 0, (N) })
+# 42 "./include/va_print/len.h"
+#define va_lprintf(...) (va_xprintf(&VA_STREAM_LEN(), __VA_ARGS__)->pos)
+# 53 "./include/va_print/len.h"
+#define va_lnprintf(N,...) (va_xprintf(&VA_STREAM_LEN_MAX(N), __VA_ARGS__)->pos)
+
+
+
+
+
+typedef struct {
+    va_stream_t s;
+    size_t pos;
+    size_t max;
+} va_stream_len_t;
+
+
+
+
+extern va_stream_vtab_t const va_len_vtab;
+# 94 "out/test2-readme.c" 2
+
+FILE *open_text_rd5(char const *dir, char const *file, unsigned suffix)
+{
+    char s[__extension__({ ((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char*)
+# 97 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 97 "out/test2-readme.c"
+          , char *:&va_char_p_size_vtab_utf8, char16_t *:&va_char16_p_size_vtab_utf16, char32_t *:&va_char32_p_size_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), 
+# 97 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 97 "out/test2-readme.c"
+          , (-(size_t)2), 0 })))(_Generic(suffix, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 97 "out/test2-readme.c" 3 4
+          _Bool
+# 97 "out/test2-readme.c"
+          :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(file, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 97 "out/test2-readme.c" 3 4
+          _Bool
+# 97 "out/test2-readme.c"
+          :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(dir, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 97 "out/test2-readme.c" 3 4
+          _Bool
+# 97 "out/test2-readme.c"
+          :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char*)
+# 97 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 97 "out/test2-readme.c"
+          , char *:&va_char_p_size_vtab_utf8, char16_t *:&va_char16_p_size_vtab_utf16, char32_t *:&va_char32_p_size_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), 
+# 97 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 97 "out/test2-readme.c"
+          , (-(size_t)2), 0 }))):((void*)0)), "~s/~s~.s", _Generic("~s/~s~.s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),dir),file),suffix)))->pos + 1 ;})];
+    return fopen(__extension__({ (__typeof__(*(s))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), ((sizeof(s)/sizeof((s)[0]))), 0 })))(_Generic(suffix, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 98 "out/test2-readme.c" 3 4
+                _Bool
+# 98 "out/test2-readme.c"
+                :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(file, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 98 "out/test2-readme.c" 3 4
+                _Bool
+# 98 "out/test2-readme.c"
+                :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)(_Generic(dir, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 98 "out/test2-readme.c" 3 4
+                _Bool
+# 98 "out/test2-readme.c"
+                :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), ((sizeof(s)/sizeof((s)[0]))), 0 }))):((void*)0)), "~s/~s~.s", _Generic("~s/~s~.s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),dir),file),suffix)))->data) ;}), "rt");
+
+}
+
+
+
+
+
+
+void testfunc2(void) {
+
+}
+
+
+
+
+
+
+
+void testfunc3(void) {
+char s[20];
+char *t = __extension__({ (__typeof__(*(s))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), (sizeof(s)), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 119 "out/test2-readme.c" 3 4
+         _Bool
+# 119 "out/test2-readme.c"
+         :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), (sizeof(s)), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data) ;});
+
+# 120 "out/test2-readme.c" 3 4
+((void) sizeof ((
+# 120 "out/test2-readme.c"
+s == t
+# 120 "out/test2-readme.c" 3 4
+) ? 1 : 0), __extension__ ({ if (
+# 120 "out/test2-readme.c"
+s == t
+# 120 "out/test2-readme.c" 3 4
+) ; else __assert_fail (
+# 120 "out/test2-readme.c"
+"s == t"
+# 120 "out/test2-readme.c" 3 4
+, "out/test2-readme.c", 120, __extension__ __PRETTY_FUNCTION__); }))
+# 120 "out/test2-readme.c"
+             ;
+}
+
+
+
+
+
+
+
+void testfunc5(void) {
+char16_t s1[20];
+char16_t *t1 = __extension__({ (__typeof__(*(s1))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s1, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s1), ((sizeof(s1)/sizeof((s1)[0]))), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 131 "out/test2-readme.c" 3 4
+              _Bool
+# 131 "out/test2-readme.c"
+              :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s1, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s1), ((sizeof(s1)/sizeof((s1)[0]))), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data) ;});
+
+char32_t s2[20];
+char32_t *t2 = __extension__({ (__typeof__(*(s2))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s2, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s2), ((sizeof(s2)/sizeof((s2)[0]))), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 134 "out/test2-readme.c" 3 4
+              _Bool
+# 134 "out/test2-readme.c"
+              :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s2, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s2), ((sizeof(s2)/sizeof((s2)[0]))), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data) ;});
+}
+
+
+
+
+
+
+
+void testfunc7(void) {
+char s[20];
+char *t = __extension__({ (__typeof__(*(s))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), ((sizeof(s)/sizeof((s)[0]))), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 145 "out/test2-readme.c" 3 4
+         _Bool
+# 145 "out/test2-readme.c"
+         :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), ((sizeof(s)/sizeof((s)[0]))), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data) ;});
+}
+# 155 "out/test2-readme.c"
+void testfunc9(void) {
+char *t1a = ((char*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[20]){0}), (20), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 156 "out/test2-readme.c" 3 4
+               _Bool
+# 156 "out/test2-readme.c"
+               :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[20]){0}), (20), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data));
+char16_t *t2a = ((char16_t*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char16_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char16_t[20]){0}), (20), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 157 "out/test2-readme.c" 3 4
+               _Bool
+# 157 "out/test2-readme.c"
+               :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char16_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char16_t[20]){0}), (20), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data));
+char32_t *t3a = ((char32_t*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char32_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char32_t[20]){0}), (20), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 158 "out/test2-readme.c" 3 4
+               _Bool
+# 158 "out/test2-readme.c"
+               :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char32_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char32_t[20]){0}), (20), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data));
+char *t1b = ((char*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[20]){0}), (20), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 159 "out/test2-readme.c" 3 4
+               _Bool
+# 159 "out/test2-readme.c"
+               :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char[20]){0}), (20), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data));
+char16_t *t2b = ((char16_t*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char16_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char16_t[20]){0}), (20), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 160 "out/test2-readme.c" 3 4
+               _Bool
+# 160 "out/test2-readme.c"
+               :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char16_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char16_t[20]){0}), (20), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data));
+char32_t *t3b = ((char32_t*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char32_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char32_t[20]){0}), (20), 0 })))(_Generic(5, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 161 "out/test2-readme.c" 3 4
+               _Bool
+# 161 "out/test2-readme.c"
+               :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char32_t[20]){0}, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), ((char32_t[20]){0}), (20), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),5)))->data));
+}
+
+
+
+
+
+void testfunc11(void) {
+char buff[20];
+va_stream_char_p_t stream = ((va_stream_char_p_t){ ((va_stream_t){ _Generic(buff, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (buff), ((sizeof(buff)/sizeof((buff)[0]))), 0 });
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("foo"), __typeof__(&*("foo")))) && va_format_plain_f("foo", sizeof("foo"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+do{ (void)((__typeof__(&stream))(_Generic(55, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 172 "out/test2-readme.c" 3 4
+_Bool
+# 172 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&stream)):((void*)0)), "bar ~u", _Generic("bar ~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),55))) ;}while(0);
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("longer than the string, will be cropped"), __typeof__(&*("longer than the string, will be cropped")))) && va_format_plain_f("longer than the string, will be cropped", sizeof("longer than the string, will be cropped"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "longer than the string, will be cropped", _Generic("longer than the string, will be cropped", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "longer than the string, will be cropped", _Generic("longer than the string, will be cropped", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+# 193 "out/test2-readme.c"
+va_error_t e;
+do{ (void)((__typeof__(&stream))(_Generic(&e, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 194 "out/test2-readme.c" 3 4
+_Bool
+# 194 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&stream)):((void*)0)), "", _Generic("", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),&e))) ;}while(0);
+if (e.code != 0) {
+
+}
+
+
+
+
+
+unsigned ec = va_stream_get_error_f(&(&stream)->s);
+if (ec != 0) {
+    do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 205 "out/test2-readme.c" 3 4
+   stderr
+# 205 "out/test2-readme.c"
+   ), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 205 "out/test2-readme.c" 3 4
+   1
+# 205 "out/test2-readme.c"
+   ; (void)((__typeof__(&va_file_s_))(_Generic(va_strerror(ec), char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 205 "out/test2-readme.c" 3 4
+   _Bool
+# 205 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "ERROR: found ec=~s\n", _Generic("ERROR: found ec=~s\n", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),va_strerror(ec)))) ;}while(0);
+
+}
+}
+# 221 "out/test2-readme.c"
+void testfunc17(void) {
+
+}
+
+
+
+
+void testfunc18(void) {
+char *c = __extension__({ ((__typeof__(&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 229 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 229 "out/test2-readme.c"
+         , 16, 0, (va_alloc), 
+# 229 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 229 "out/test2-readme.c"
+         , 
+# 229 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 229 "out/test2-readme.c"
+         , 0, {0} })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 229 "out/test2-readme.c" 3 4
+         _Bool
+# 229 "out/test2-readme.c"
+         :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 229 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 229 "out/test2-readme.c"
+         , 16, 0, (va_alloc), 
+# 229 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 229 "out/test2-readme.c"
+         , 
+# 229 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 229 "out/test2-readme.c"
+         , 0, {0} }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;});
+free(c);
+}
+# 250 "out/test2-readme.c"
+void testfunc20(void) {
+char *c = __extension__({ ((__typeof__(&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 251 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 251 "out/test2-readme.c"
+         , 16, 0, (va_alloc), 
+# 251 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 251 "out/test2-readme.c"
+         , 
+# 251 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 251 "out/test2-readme.c"
+         , 0, {0} })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 251 "out/test2-readme.c" 3 4
+         _Bool
+# 251 "out/test2-readme.c"
+         :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 251 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 251 "out/test2-readme.c"
+         , 16, 0, (va_alloc), 
+# 251 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 251 "out/test2-readme.c"
+         , 
+# 251 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 251 "out/test2-readme.c"
+         , 0, {0} }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;});
+free(c);
+}
+# 266 "out/test2-readme.c"
+void testfunc22(void) {
+char *c = __extension__({ char va_stage_[512]; ((__typeof__(&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (va_stage_), (sizeof(va_stage_)/sizeof((va_stage_)[0])), 0, (va_alloc), (va_stage_), 
+# 267 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 267 "out/test2-readme.c"
+         , 0, {0} })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 267 "out/test2-readme.c" 3 4
+         _Bool
+# 267 "out/test2-readme.c"
+         :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (va_stage_), (sizeof(va_stage_)/sizeof((va_stage_)[0])), 0, (va_alloc), (va_stage_), 
+# 267 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 267 "out/test2-readme.c"
+         , 0, {0} }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;});
+free(c);
+}
+# 279 "out/test2-readme.c"
+void testfunc24(void) {
+va_arena_t arena = ((va_arena_t){ 
+# 280 "out/test2-readme.c" 3 4
+                  ((void *)0)
+# 280 "out/test2-readme.c"
+                  , 
+# 280 "out/test2-readme.c" 3 4
+                  ((void *)0)
+# 280 "out/test2-readme.c"
+                  , 4096, (va_alloc) });
+char *c = __extension__({ ((__typeof__(&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 281 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 281 "out/test2-readme.c"
+         , 16, 0, 
+# 281 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 281 "out/test2-readme.c"
+         , 
+# 281 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 281 "out/test2-readme.c"
+         , (&arena), 0, {0} })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 281 "out/test2-readme.c" 3 4
+         _Bool
+# 281 "out/test2-readme.c"
+         :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 281 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 281 "out/test2-readme.c"
+         , 16, 0, 
+# 281 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 281 "out/test2-readme.c"
+         , 
+# 281 "out/test2-readme.c" 3 4
+         ((void *)0)
+# 281 "out/test2-readme.c"
+         , (&arena), 0, {0} }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;});
+char16_t *d = __extension__({ ((__typeof__(&((va_stream_vec16_t){ ((va_stream_t){ &va_vec16_vtab_utf16,{0,0},0,0,0,0,{0,0},0 }), 
+# 282 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 282 "out/test2-readme.c"
+             , 16, 0, 
+# 282 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 282 "out/test2-readme.c"
+             , 
+# 282 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 282 "out/test2-readme.c"
+             , (&arena), 0, {0} })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 282 "out/test2-readme.c" 3 4
+             _Bool
+# 282 "out/test2-readme.c"
+             :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec16_t){ ((va_stream_t){ &va_vec16_vtab_utf16,{0,0},0,0,0,0,{0,0},0 }), 
+# 282 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 282 "out/test2-readme.c"
+             , 16, 0, 
+# 282 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 282 "out/test2-readme.c"
+             , 
+# 282 "out/test2-readme.c" 3 4
+             ((void *)0)
+# 282 "out/test2-readme.c"
+             , (&arena), 0, {0} }))):((void*)0)), "bar~s", _Generic("bar~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;});
+va_arena_free(&arena);
+}
+# 295 "out/test2-readme.c"
+void testfunc26(void) {
+char buf[128];
+va_stream_vec_t r = __extension__({ *((__typeof__(&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (buf), (sizeof(buf)/sizeof((buf)[0])), 0, (va_alloc), (buf), 
+# 297 "out/test2-readme.c" 3 4
+                   ((void *)0)
+# 297 "out/test2-readme.c"
+                   , 1, {0} })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 297 "out/test2-readme.c" 3 4
+                   _Bool
+# 297 "out/test2-readme.c"
+                   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (buf), (sizeof(buf)/sizeof((buf)[0])), 0, (va_alloc), (buf), 
+# 297 "out/test2-readme.c" 3 4
+                   ((void *)0)
+# 297 "out/test2-readme.c"
+                   , 1, {0} }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;});
+puts(r.data);
+va_vec_free(&r);
+}
+# 314 "out/test2-readme.c"
+void testfunc28(void) {
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 315 "out/test2-readme.c" 3 4
+stdout
+# 315 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 315 "out/test2-readme.c" 3 4
+1
+# 315 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic(__extension__({ ((__typeof__(va_tmp_vec(&va_vec_vtab_utf8)))(_Generic(42, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 315 "out/test2-readme.c" 3 4
+_Bool
+# 315 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((va_tmp_vec(&va_vec_vtab_utf8))):((void*)0)), "bar~u", _Generic("bar~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),42)))->data ;}), char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 315 "out/test2-readme.c" 3 4
+_Bool
+# 315 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(__extension__({ ((__typeof__(va_tmp_vec(&va_vec_vtab_utf8)))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 315 "out/test2-readme.c" 3 4
+_Bool
+# 315 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((va_tmp_vec(&va_vec_vtab_utf8))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;}), char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 315 "out/test2-readme.c" 3 4
+_Bool
+# 315 "out/test2-readme.c"
+:va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "~s: ~s\n", _Generic("~s: ~s\n", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),__extension__({ ((__typeof__(va_tmp_vec(&va_vec_vtab_utf8)))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 315 "out/test2-readme.c" 3 4
+_Bool
+# 315 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((va_tmp_vec(&va_vec_vtab_utf8))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data ;})),__extension__({ ((__typeof__(va_tmp_vec(&va_vec_vtab_utf8)))(_Generic(42, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 315 "out/test2-readme.c" 3 4
+_Bool
+# 315 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((va_tmp_vec(&va_vec_vtab_utf8))):((void*)0)), "bar~u", _Generic("bar~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),42)))->data ;})))) ;}while(0);
+va_tprintf_free();
+}
+
+
+
+void testfunc30(void) {
+va_stream_vec_t stream = ((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 322 "out/test2-readme.c" 3 4
+                        ((void *)0)
+# 322 "out/test2-readme.c"
+                        , 16, 0, (va_alloc), 
+# 322 "out/test2-readme.c" 3 4
+                        ((void *)0)
+# 322 "out/test2-readme.c"
+                        , 
+# 322 "out/test2-readme.c" 3 4
+                        ((void *)0)
+# 322 "out/test2-readme.c"
+                        , 0, {0} });
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("foo"), __typeof__(&*("foo")))) && va_format_plain_f("foo", sizeof("foo"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+do{ (void)((__typeof__(&stream))(_Generic(55, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 324 "out/test2-readme.c" 3 4
+_Bool
+# 324 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&stream)):((void*)0)), "bar ~u", _Generic("bar ~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),55))) ;}while(0);
+}
+# 339 "out/test2-readme.c"
+void testfunc32(void) {
+va_stream_vec_t b = ((va_stream_vec_t){ ((va_stream_t){ &va_vec_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 340 "out/test2-readme.c" 3 4
+                   ((void *)0)
+# 340 "out/test2-readme.c"
+                   , 16, 0, (va_alloc), 
+# 340 "out/test2-readme.c" 3 4
+                   ((void *)0)
+# 340 "out/test2-readme.c"
+                   , 
+# 340 "out/test2-readme.c" 3 4
+                   ((void *)0)
+# 340 "out/test2-readme.c"
+                   , 0, {0} });
+va_span_t view;
+va_vec_reserve(&b, 200);
+for (int i = 0; i < 10; i++) {
+    va_vec_clear(&b);
+    do{ (void)((__typeof__(&b))(_Generic(i, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 345 "out/test2-readme.c" 3 4
+   _Bool
+# 345 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&b)):((void*)0)), "line ~u: ", _Generic("line ~u: ", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),i))) ;}while(0);
+    do{ (void)((__typeof__(&b))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 346 "out/test2-readme.c" 3 4
+   _Bool
+# 346 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&b)):((void*)0)), "~s", _Generic("~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;}while(0);
+    do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 347 "out/test2-readme.c" 3 4
+   stdout
+# 347 "out/test2-readme.c"
+   ), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 347 "out/test2-readme.c" 3 4
+   1
+# 347 "out/test2-readme.c"
+   ; (void)((__typeof__(&va_file_s_))(_Generic(va_vec_span(&b, &view), char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 347 "out/test2-readme.c" 3 4
+   _Bool
+# 347 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "~s\n", _Generic("~s\n", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),va_vec_span(&b, &view)))) ;}while(0);
+}
+va_vec_shrink(&b, 1000);
+va_vec_free(&b);
+}
+
+
+
+
+void testfunc34(void) {
+
+}
+
+
+
+
+void testfunc35(void) {
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 364 "out/test2-readme.c" 3 4
+stderr
+# 364 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 364 "out/test2-readme.c" 3 4
+1
+# 364 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 364 "out/test2-readme.c" 3 4
+_Bool
+# 364 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;}while(0);
+}
+
+
+
+
+void testfunc37(void) {
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 371 "out/test2-readme.c" 3 4
+stdout
+# 371 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 371 "out/test2-readme.c" 3 4
+1
+# 371 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 371 "out/test2-readme.c" 3 4
+_Bool
+# 371 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;}while(0);
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 372 "out/test2-readme.c" 3 4
+stderr
+# 372 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 372 "out/test2-readme.c" 3 4
+1
+# 372 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 372 "out/test2-readme.c" 3 4
+_Bool
+# 372 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;}while(0);
+}
+# 382 "out/test2-readme.c"
+void testfunc39(void) {
+va_stream_file_t stream = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 383 "out/test2-readme.c" 3 4
+                         stderr
+# 383 "out/test2-readme.c"
+                         ), 
+# 383 "out/test2-readme.c" 3 4
+                         ((void *)0)
+# 383 "out/test2-readme.c"
+                         , 0, 0, 0, {0} });
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("foo"), __typeof__(&*("foo")))) && va_format_plain_f("foo", sizeof("foo"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+do{ (void)((__typeof__(&stream))(_Generic(55, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 385 "out/test2-readme.c" 3 4
+_Bool
+# 385 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&stream)):((void*)0)), "bar ~u", _Generic("bar ~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),55))) ;}while(0);
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("longer than the string, will be cropped"), __typeof__(&*("longer than the string, will be cropped")))) && va_format_plain_f("longer than the string, will be cropped", sizeof("longer than the string, will be cropped"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "longer than the string, will be cropped", _Generic("longer than the string, will be cropped", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "longer than the string, will be cropped", _Generic("longer than the string, will be cropped", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+# 401 "out/test2-readme.c"
+char fbuf[80];
+va_stream_file_t *fstream = &((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 402 "out/test2-readme.c" 3 4
+                            stderr
+# 402 "out/test2-readme.c"
+                            ), (fbuf), (sizeof(fbuf)), 0, 0, {0} });
+do{ (void)((__typeof__(fstream))(((((!__builtin_types_compatible_p(__typeof__("foo"), __typeof__(&*("foo")))) && va_format_plain_f("foo", sizeof("foo"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((fstream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((fstream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+do{ (void)((__typeof__(fstream))(_Generic(55, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 404 "out/test2-readme.c" 3 4
+_Bool
+# 404 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((fstream)):((void*)0)), "bar ~u", _Generic("bar ~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),55))) ;}while(0);
+va_file_flush(fstream);
+}
+
+
+
+
+# 1 "./include/va_print/fd.h" 1
+# 12 "./include/va_print/fd.h"
+#define VA_PRINT_FD_H_ 
+
+
+
+
+
+
+
+# 1 "./include/va_print/fd_utf8.h" 1
+# 12 "./include/va_print/fd_utf8.h"
+#define VA_PRINT_FD_UTF8_H_ 
+# 23 "./include/va_print/fd_utf8.h"
+extern va_stream_vtab_t const va_fd_vtab_utf8;
+# 21 "./include/va_print/fd.h" 2
+
+#define va_fd_encode utf8
+
+
+
+# 1 "./include/va_print/fd_utf16be.h" 1
+# 12 "./include/va_print/fd_utf16be.h"
+#define VA_PRINT_FD_UTF16BE_H_ 
+# 23 "./include/va_print/fd_utf16be.h"
+extern va_stream_vtab_t const va_fd16_vtab_utf16be;
+# 27 "./include/va_print/fd.h" 2
+
+#define va_fd16_encode utf16be
+
+
+
+# 1 "./include/va_print/fd_utf32be.h" 1
+# 12 "./include/va_print/fd_utf32be.h"
+#define VA_PRINT_FD_UTF32BE_H_ 
+# 23 "./include/va_print/fd_utf32be.h"
+extern va_stream_vtab_t const va_fd32_vtab_utf32be;
+# 33 "./include/va_print/fd.h" 2
+
+#define va_fd32_encode utf32be
+
+
+
+
+#define va_fd_buf_size 512
+# 52 "./include/va_print/fd.h"
+#define VA_STREAM_FD(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), NULL, 0, 0, 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FD16(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), NULL, 0, 0, 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FD32(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), NULL, 0, 0, 0, 0, {0} })
+
+
+
+
+
+
+
+#define VA_STREAM_FD_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), (B), (N), 0, 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FD16_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), (B), (N), 0, 0, 0, {0} })
+
+
+
+
+
+
+#define VA_STREAM_FD32_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), (B), (N), 0, 0, 0, {0} })
+# 100 "./include/va_print/fd.h"
+#define va_xdprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_fd_buf_[va_fd_buf_size]; va_stream_fd_t va_fd_s_ = STREAM_BUF(F, va_fd_buf_, sizeof(va_fd_buf_)); va_fd_s_.autoflush = true; (void)va_xprintf(&va_fd_s_, __VA_ARGS__))
+# 112 "./include/va_print/fd.h"
+#define va_dprintf(F,...) va_xdprintf(VA_STREAM_FD_BUF, F, __VA_ARGS__)
+
+
+
+
+
+
+#define va_udprintf(F,...) va_xdprintf(VA_STREAM_FD16_BUF, F, __VA_ARGS__)
+
+
+
+
+
+
+#define va_Udprintf(F,...) va_xdprintf(VA_STREAM_FD32_BUF, F, __VA_ARGS__)
+# 148 "./include/va_print/fd.h"
+typedef struct {
+    va_stream_t s;
+    long fd;
+    char *data;
+    size_t size;
+    size_t pos;
+    size_t mark;
+    
+# 155 "./include/va_print/fd.h" 3 4
+   _Bool 
+# 155 "./include/va_print/fd.h"
+        autoflush;
+    char _pad[sizeof(size_t) - 1];
+} va_stream_fd_t;
+# 168 "./include/va_print/fd.h"
+extern void va_fd_flush(va_stream_fd_t *);
+
+
+
+
+
+extern void va_fd_finish(va_stream_t *);
+
+
+
+
+
+extern 
+# 180 "./include/va_print/fd.h" 3 4
+      _Bool 
+# 180 "./include/va_print/fd.h"
+           va_fd_refill(va_stream_t *, size_t);
+
+
+
+
+
+
+
+extern void va_fd_write(va_stream_t *, void const *, size_t);
+
+
+
+
+
+
+extern void va_fd_put_whole(
+    va_stream_t *,
+    unsigned,
+    void (*)(va_stream_t *, unsigned));
+
+
+
+
+
+extern void va_fd_fill(va_stream_t *, void const *x, size_t k, size_t n);
+
+extern void va_fd_put(va_stream_t *, char);
+extern void va_fd16_put_be(va_stream_t *, char16_t);
+extern void va_fd16_put_le(va_stream_t *, char16_t);
+extern void va_fd32_put_be(va_stream_t *, char32_t);
+extern void va_fd32_put_le(va_stream_t *, char32_t);
+extern void va_fd_put_fill(va_stream_t *, unsigned, size_t);
+extern void va_fd16_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_fd16_put_fill_le(va_stream_t *, unsigned, size_t);
+extern void va_fd32_put_fill_be(va_stream_t *, unsigned, size_t);
+extern void va_fd32_put_fill_le(va_stream_t *, unsigned, size_t);
+# 412 "out/test2-readme.c" 2
+void testfunc43(void) {
+
+}
+
+
+
+
+void testfunc44(void) {
+do{ char va_fd_buf_[512]; va_stream_fd_t va_fd_s_ = ((va_stream_fd_t){ ((va_stream_t){ &va_fd_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (2), (va_fd_buf_), (sizeof(va_fd_buf_)), 0, 0, 0, {0} }); va_fd_s_.autoflush = 
+# 420 "out/test2-readme.c" 3 4
+1
+# 420 "out/test2-readme.c"
+; (void)((__typeof__(&va_fd_s_))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 420 "out/test2-readme.c" 3 4
+_Bool
+# 420 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_fd_s_)):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;}while(0);
+}
+# 430 "out/test2-readme.c"
+void testfunc46(void) {
+va_stream_fd_t stream = ((va_stream_fd_t){ ((va_stream_t){ &va_fd_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (2), 
+# 431 "out/test2-readme.c" 3 4
+                       ((void *)0)
+# 431 "out/test2-readme.c"
+                       , 0, 0, 0, 0, {0} });
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("foo"), __typeof__(&*("foo")))) && va_format_plain_f("foo", sizeof("foo"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+do{ (void)((__typeof__(&stream))(_Generic(55, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 433 "out/test2-readme.c" 3 4
+_Bool
+# 433 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&stream)):((void*)0)), "bar ~u", _Generic("bar ~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),55))) ;}while(0);
+do{ (void)((__typeof__(&stream))(((((!__builtin_types_compatible_p(__typeof__("longer than the string, will be cropped"), __typeof__(&*("longer than the string, will be cropped")))) && va_format_plain_f("longer than the string, will be cropped", sizeof("longer than the string, will be cropped"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((&stream)):((void*)0)), "longer than the string, will be cropped", _Generic("longer than the string, will be cropped", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((&stream)):((void*)0)), "longer than the string, will be cropped", _Generic("longer than the string, will be cropped", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+# 452 "out/test2-readme.c"
+char buf[80];
+va_stream_fd_t *bstream = &((va_stream_fd_t){ ((va_stream_t){ &va_fd_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (2), (buf), (sizeof(buf)), 0, 0, 0, {0} });
+do{ (void)((__typeof__(bstream))(((((!__builtin_types_compatible_p(__typeof__("foo"), __typeof__(&*("foo")))) && va_format_plain_f("foo", sizeof("foo"))) ? va_xprintf_init_last_plain((va_stream_t*)(1?((bstream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)) : va_xprintf_init_last((va_stream_t*)(1?((bstream)):((void*)0)), "foo", _Generic("foo", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)))))) ;}while(0);
+do{ (void)((__typeof__(bstream))(_Generic(55, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 455 "out/test2-readme.c" 3 4
+_Bool
+# 455 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((bstream)):((void*)0)), "bar ~u", _Generic("bar ~u", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),55))) ;}while(0);
+va_fd_flush(bstream);
+}
+
+
+
+
+# 1 "./include/va_print/rope.h" 1
+# 15 "./include/va_print/rope.h"
+#define VA_PRINT_ROPE_H_ 
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/uio.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+#define _SYS_UIO_H 1
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+#define __iovec_defined 1
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 24 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 2 3 4
+
+
+
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h" 3 4
+struct iovec
+  {
+    void *iov_base;
+    size_t iov_len;
+  };
+# 24 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 3 4
+#define _BITS_UIO_LIM_H 1
+# 30 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h" 3 4
+#define __IOV_MAX 1024
+# 25 "/usr/include/x86_64-linux-gnu/sys/uio.h" 2 3 4
+
+#define UIO_MAXIOV __IOV_MAX
+
+
+
+
+
+# 41 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t readv (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 52 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t writev (int __fd, const struct iovec *__iovec, int __count)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 67 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t preadv (int __fd, const struct iovec *__iovec, int __count,
+         __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 80 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+extern ssize_t pwritev (int __fd, const struct iovec *__iovec, int __count,
+   __off_t __offset)
+  __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 174 "/usr/include/x86_64-linux-gnu/sys/uio.h" 3 4
+
+# 18 "./include/va_print/rope.h" 2
+
+# 1 "./include/va_print/rope_utf8.h" 1
+# 12 "./include/va_print/rope_utf8.h"
+#define VA_PRINT_ROPE_UTF8_H_ 
+# 23 "./include/va_print/rope_utf8.h"
+
+# 23 "./include/va_print/rope_utf8.h"
+extern va_stream_vtab_t const va_rope_vtab_utf8;
+# 20 "./include/va_print/rope.h" 2
+
+
+
+
+
+
+#define va_rope_chunk_size 16384
+# 41 "./include/va_print/rope.h"
+#define VA_STREAM_ROPE(M) ((va_stream_rope_t){ VA_STREAM(&va_rope_vtab_utf8), NULL, NULL, va_rope_chunk_size, (M) })
+
+
+
+
+
+
+typedef struct va_rope_chunk va_rope_chunk_t;
+# 57 "./include/va_print/rope.h"
+typedef struct {
+    va_stream_t s;
+    va_rope_chunk_t *first;
+    va_rope_chunk_t *last;
+
+    size_t chunk_size;
+
+    void *(*alloc)(void *, size_t nmemb, size_t size);
+} va_stream_rope_t;
+
+
+
+
+extern void va_rope_finish(
+    va_stream_t *);
+
+extern 
+# 73 "./include/va_print/rope.h" 3 4
+      _Bool 
+# 73 "./include/va_print/rope.h"
+           va_rope_refill(
+    va_stream_t *,
+    size_t);
+
+extern void va_rope_put(
+    va_stream_t *,
+    char);
+
+
+
+
+extern size_t va_rope_len(
+    va_stream_rope_t *);
+
+
+
+
+
+
+extern size_t va_rope_iovec(
+    va_stream_rope_t *,
+    struct iovec *iov,
+    size_t n);
+
+
+
+
+
+
+extern 
+# 102 "./include/va_print/rope.h" 3 4
+      _Bool 
+# 102 "./include/va_print/rope.h"
+           va_rope_writev(
+    va_stream_rope_t *,
+    int fd);
+
+
+
+
+
+
+extern char *va_rope_flatten(
+    va_stream_rope_t *);
+
+
+
+
+
+extern void va_rope_clear(
+    va_stream_rope_t *);
+
+
+
+
+
+extern void va_rope_free(
+    va_stream_rope_t *);
+# 463 "out/test2-readme.c" 2
+void testfunc50(void) {
+
+}
+# 481 "out/test2-readme.c"
+void testfunc51(void) {
+va_stream_rope_t rope = ((va_stream_rope_t){ ((va_stream_t){ &va_rope_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), 
+# 482 "out/test2-readme.c" 3 4
+                       ((void *)0)
+# 482 "out/test2-readme.c"
+                       , 
+# 482 "out/test2-readme.c" 3 4
+                       ((void *)0)
+# 482 "out/test2-readme.c"
+                       , 16384, (va_alloc) });
+for (int i = 0; i < 100000; i++) {
+    do{ (void)((__typeof__(&rope))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 484 "out/test2-readme.c" 3 4
+   _Bool
+# 484 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(i, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 484 "out/test2-readme.c" 3 4
+   _Bool
+# 484 "out/test2-readme.c"
+   :va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&rope)):((void*)0)), "line ~u: ~s\n", _Generic("line ~u: ~s\n", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),i),msg))) ;}while(0);
+}
+va_rope_writev(&rope, 1);
+va_rope_free(&rope);
+}
+# 497 "out/test2-readme.c"
+void testfunc53(void) {
+char const *data = "abcdef";
+size_t size = 3;
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 500 "out/test2-readme.c" 3 4
+stderr
+# 500 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 500 "out/test2-readme.c" 3 4
+1
+# 500 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic(data, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 500 "out/test2-readme.c" 3 4
+_Bool
+# 500 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(size, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 500 "out/test2-readme.c" 3 4
+_Bool
+# 500 "out/test2-readme.c"
+:va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "token=~.*qs", _Generic("token=~.*qs", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),size),data))) ;}while(0);
+}
+
+
+
+
+
+void testfunc55(void) {
+char const *data = "abcdef";
+size_t size = 3;
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 510 "out/test2-readme.c" 3 4
+stderr
+# 510 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 510 "out/test2-readme.c" 3 4
+1
+# 510 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic((&(va_span_t){ size, data }), char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 510 "out/test2-readme.c" 3 4
+_Bool
+# 510 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "token=~qs", _Generic("token=~qs", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),(&(va_span_t){ size, data })))) ;}while(0);
+}
+
+
+
+
+
+
+void testfunc57(void) {
+do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 519 "out/test2-readme.c" 3 4
+stderr
+# 519 "out/test2-readme.c"
+), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 519 "out/test2-readme.c" 3 4
+1
+# 519 "out/test2-readme.c"
+; (void)((__typeof__(&va_file_s_))(_Generic((&(va_span_t){ 1, "" }), char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 519 "out/test2-readme.c" 3 4
+_Bool
+# 519 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), "token=~qs", _Generic("token=~qs", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),(&(va_span_t){ 1, "" })))) ;}while(0);
+}
+# 530 "out/test2-readme.c"
+void testfunc59(void) {
+
+}
+
+
+
+
+
+void testfunc60(void) {
+size_t cp_count = (((__typeof__(&((va_stream_len_t){ ((va_stream_t){ &va_len_vtab,{0,0},0,0,0,0,{0,0},0 }), 0, (-(size_t)1) })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 539 "out/test2-readme.c" 3 4
+                 _Bool
+# 539 "out/test2-readme.c"
+                 :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_len_t){ ((va_stream_t){ &va_len_vtab,{0,0},0,0,0,0,{0,0},0 }), 0, (-(size_t)1) }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->pos);
+}
+# 551 "out/test2-readme.c"
+void testfunc62(void) {
+if ((((__typeof__(&((va_stream_len_t){ ((va_stream_t){ &va_len_vtab,{0,0},0,0,0,0,{0,0},0 }), 0, (80) })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 552 "out/test2-readme.c" 3 4
+   _Bool
+# 552 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_len_t){ ((va_stream_t){ &va_len_vtab,{0,0},0,0,0,0,{0,0},0 }), 0, (80) }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->pos) > 80) {
+
+}
+}
+
+
+
+
+
+void testfunc64(void) {
+
+}
+
+
+
+
+void testfunc65(void) {
+size_t n = __extension__({ ((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char*)
+# 569 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 569 "out/test2-readme.c"
+          , char *:&va_char_p_size_vtab_utf8, char16_t *:&va_char16_p_size_vtab_utf16, char32_t *:&va_char32_p_size_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), 
+# 569 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 569 "out/test2-readme.c"
+          , (-(size_t)2), 0 })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 569 "out/test2-readme.c" 3 4
+          _Bool
+# 569 "out/test2-readme.c"
+          :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((char*)
+# 569 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 569 "out/test2-readme.c"
+          , char *:&va_char_p_size_vtab_utf8, char16_t *:&va_char16_p_size_vtab_utf16, char32_t *:&va_char32_p_size_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), 
+# 569 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 569 "out/test2-readme.c"
+          , (-(size_t)2), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->pos + 1 ;});
+char *s = malloc(n);
+va_error_t e;
+__extension__({ (__typeof__(*(s))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), (n), 0 })))(_Generic(&e, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 572 "out/test2-readme.c" 3 4
+_Bool
+# 572 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)(_Generic(msg, char const *:va_xprintf_char_p_utf8, char *:va_xprintf_char_p_utf8, char const **:va_xprintf_char_const_pp_utf8, char **:va_xprintf_char_pp_utf8, char16_t const *:va_xprintf_char16_p_utf16, char16_t *:va_xprintf_char16_p_utf16, char16_t const **:va_xprintf_char16_const_pp_utf16, char16_t **:va_xprintf_char16_pp_utf16, char32_t const *:va_xprintf_char32_p_utf32, char32_t *:va_xprintf_char32_p_utf32, char32_t const **:va_xprintf_char32_const_pp_utf32, char32_t **:va_xprintf_char32_pp_utf32, va_span_t const *:va_xprintf_span_p_utf8, va_span_t *:va_xprintf_span_p_utf8, va_span16_t const *:va_xprintf_span16_p_utf16, va_span16_t *:va_xprintf_span16_p_utf16, va_span32_t const *:va_xprintf_span32_p_utf32, va_span32_t *:va_xprintf_span32_p_utf32, 
+# 572 "out/test2-readme.c" 3 4
+_Bool
+# 572 "out/test2-readme.c"
+:va_xprintf_bool, unsigned char:va_xprintf_uchar, unsigned short:va_xprintf_ushort, unsigned int:va_xprintf_uint, unsigned long:va_xprintf_ulong, unsigned long long:va_xprintf_ull, char:va_xprintf_char, signed char:va_xprintf_schar, short:va_xprintf_short, int:va_xprintf_sint, long:va_xprintf_slong, long long:va_xprintf_sll, va_print_t *:va_xprintf_custom, va_read_iter_t *:va_xprintf_iter_chunk, va_error_t *:va_xprintf_error_t_p, default:va_xprintf_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), (n), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg),&e)))->data) ;});
+
+# 573 "out/test2-readme.c" 3 4
+((void) sizeof ((
+# 573 "out/test2-readme.c"
+e.code == 0
+# 573 "out/test2-readme.c" 3 4
+) ? 1 : 0), __extension__ ({ if (
+# 573 "out/test2-readme.c"
+e.code == 0
+# 573 "out/test2-readme.c" 3 4
+) ; else __assert_fail (
+# 573 "out/test2-readme.c"
+"e.code == VA_E_OK"
+# 573 "out/test2-readme.c" 3 4
+, "out/test2-readme.c", 573, __extension__ __PRETTY_FUNCTION__); }))
+# 573 "out/test2-readme.c"
+                        ;
+}
+# 590 "out/test2-readme.c"
+void testfunc67(void) {
+typedef SomeCharacterType MyChar;
+size_t n = __extension__({ ((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic((MyChar*)
+# 592 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 592 "out/test2-readme.c"
+          , char *:&va_char_p_size_vtab_utf8, char16_t *:&va_char16_p_size_vtab_utf16, char32_t *:&va_char32_p_size_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), 
+# 592 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 592 "out/test2-readme.c"
+          , (-(size_t)2), 0 })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 592 "out/test2-readme.c" 3 4
+          _Bool
+# 592 "out/test2-readme.c"
+          :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic((MyChar*)
+# 592 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 592 "out/test2-readme.c"
+          , char *:&va_char_p_size_vtab_utf8, char16_t *:&va_char16_p_size_vtab_utf16, char32_t *:&va_char32_p_size_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), 
+# 592 "out/test2-readme.c" 3 4
+          ((void *)0)
+# 592 "out/test2-readme.c"
+          , (-(size_t)2), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->pos + 1 ;});
+MyChar *s = malloc(sizeof(MyChar) * n);
+__extension__({ (__typeof__(*(s))*)(((__typeof__(&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), (n), 0 })))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 594 "out/test2-readme.c" 3 4
+_Bool
+# 594 "out/test2-readme.c"
+:va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&((va_stream_char_p_t){ ((va_stream_t){ _Generic(s, char *:&va_char_p_vtab_utf8, char16_t *:&va_char16_p_vtab_utf16, char32_t *:&va_char32_p_vtab_utf32),{0,0},0,0,0,0,{0,0},0 }), (s), (n), 0 }))):((void*)0)), "foo~s", _Generic("foo~s", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg)))->data) ;});
+}
+# 604 "out/test2-readme.c"
+void testfunc69(void) {
+
+}
+# 616 "out/test2-readme.c"
+void testfunc70(void) {
+va_format_t *f = va_format_compile_f(va_alloc, "foo~s\n", _Generic("foo~s\n", char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab));
+for (unsigned i = 0; i < 3; i++) {
+    do{ char va_file_buf_[256]; va_stream_file_t va_file_s_ = ((va_stream_file_t){ ((va_stream_t){ &va_file_vtab_utf8,{0,0},0,0,0,0,{0,0},0 }), (
+# 619 "out/test2-readme.c" 3 4
+   stdout
+# 619 "out/test2-readme.c"
+   ), (va_file_buf_), (sizeof(va_file_buf_)), 0, 0, {0} }); va_file_s_.autoflush = 
+# 619 "out/test2-readme.c" 3 4
+   1
+# 619 "out/test2-readme.c"
+   ; (void)((__typeof__(&va_file_s_))(_Generic(msg, char const *:va_xprintf_last_char_p_utf8, char *:va_xprintf_last_char_p_utf8, char const **:va_xprintf_last_char_const_pp_utf8, char **:va_xprintf_last_char_pp_utf8, char16_t const *:va_xprintf_last_char16_p_utf16, char16_t *:va_xprintf_last_char16_p_utf16, char16_t const **:va_xprintf_last_char16_const_pp_utf16, char16_t **:va_xprintf_last_char16_pp_utf16, char32_t const *:va_xprintf_last_char32_p_utf32, char32_t *:va_xprintf_last_char32_p_utf32, char32_t const **:va_xprintf_last_char32_const_pp_utf32, char32_t **:va_xprintf_last_char32_pp_utf32, va_span_t const *:va_xprintf_last_span_p_utf8, va_span_t *:va_xprintf_last_span_p_utf8, va_span16_t const *:va_xprintf_last_span16_p_utf16, va_span16_t *:va_xprintf_last_span16_p_utf16, va_span32_t const *:va_xprintf_last_span32_p_utf32, va_span32_t *:va_xprintf_last_span32_p_utf32, 
+# 619 "out/test2-readme.c" 3 4
+   _Bool
+# 619 "out/test2-readme.c"
+   :va_xprintf_last_bool, unsigned char:va_xprintf_last_uchar, unsigned short:va_xprintf_last_ushort, unsigned int:va_xprintf_last_uint, unsigned long:va_xprintf_last_ulong, unsigned long long:va_xprintf_last_ull, char:va_xprintf_last_char, signed char:va_xprintf_last_schar, short:va_xprintf_last_short, int:va_xprintf_last_sint, long:va_xprintf_last_slong, long long:va_xprintf_last_sll, va_print_t *:va_xprintf_last_custom, va_read_iter_t *:va_xprintf_last_iter_chunk, va_error_t *:va_xprintf_last_error_t_p, default:va_xprintf_last_ptr)((va_xprintf_init((va_stream_t*)(1?((&va_file_s_)):((void*)0)), f, _Generic(f, char const *:&va_char_p_read_vtab_utf8, char *:&va_char_p_read_vtab_utf8, char16_t const *:&va_char16_p_read_vtab_utf16, char16_t *:&va_char16_p_read_vtab_utf16, char32_t const *:&va_char32_p_read_vtab_utf32, char32_t *:&va_char32_p_read_vtab_utf32, va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab))),msg))) ;}while(0);
+}
+va_format_free(f);
+}
@@ -0,0 +1,21024 @@
+	.file	"test2-readme.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "out/test2-readme.c"
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"~s/~s~.s"
+.LC1:
+	.string	"rt"
+	.text
+	.globl	open_text_rd1
+	.type	open_text_rd1, @function
+open_text_rd1:
+.LVL0:
+.LFB8:
+	.file 1 "out/test2-readme.c"
+	.loc 1 36 1 view -0
+	.cfi_startproc
+	.loc 1 37 5 view .LVU1
+	.loc 1 36 1 is_stmt 0 view .LVU2
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 37 533 view .LVU3
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	.loc 1 36 1 view .LVU4
+	movq	%rdi, %r8
+	.loc 1 37 713 view .LVU5
+	movl	$20, %ecx
+	.loc 1 36 1 view .LVU6
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbp
+	movl	%edx, %ebx
+	.loc 1 37 261 view .LVU7
+	movq	%r8, %rsi
+.LVL1:
+	.loc 1 37 533 view .LVU8
+	xorl	%edx, %edx
+.LVL2:
+	.loc 1 36 1 view .LVU9
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	.loc 1 37 533 view .LVU10
+	movq	%rax, 88(%rsp)
+	xorl	%eax, %eax
+	.loc 1 37 713 view .LVU11
+	leaq	8(%rsp), %rdi
+.LVL3:
+	.loc 1 37 533 view .LVU12
+	movq	%rax, 112(%rsp)
+	movq	%rax, 120(%rsp)
+	movq	%rax, 128(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, 144(%rsp)
+	.loc 1 37 713 view .LVU13
+	xorl	%eax, %eax
+	rep stosl
+	.loc 1 37 533 view .LVU14
+	leaq	8(%rsp), %rax
+	.loc 1 37 261 view .LVU15
+	leaq	88(%rsp), %rdi
+	.loc 1 37 533 view .LVU16
+	movq	%rdx, 168(%rsp)
+.LVL4:
+.LBB173:
+.LBI173:
+	.file 2 "./include/va_print/core.h"
+	.loc 2 299 28 is_stmt 1 view .LVU17
+.LBB174:
+	.loc 2 304 5 view .LVU18
+.LBE174:
+.LBE173:
+	.loc 1 37 533 is_stmt 0 view .LVU19
+	movq	%rax, 152(%rsp)
+.LBB177:
+.LBB175:
+	.loc 2 304 12 view .LVU20
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 96(%rsp)
+	leaq	.LC0(%rip), %rax
+.LBE175:
+.LBE177:
+	.loc 1 37 533 view .LVU21
+	movq	$80, 160(%rsp)
+.LBB178:
+.LBB176:
+	.loc 2 304 12 view .LVU22
+	movq	%rax, 104(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU23
+.LVL5:
+	.loc 2 305 5 is_stmt 0 view .LVU24
+.LBE176:
+.LBE178:
+	.loc 1 37 261 view .LVU25
+	call	va_xprintf_char_p_utf8@PLT
+.LVL6:
+	.loc 1 37 261 view .LVU26
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_char_p_utf8@PLT
+.LVL7:
+	movl	%ebx, %esi
+	movq	%rax, %rdi
+	call	va_xprintf_last_uint@PLT
+.LVL8:
+	.loc 1 37 12 view .LVU27
+	leaq	.LC1(%rip), %rsi
+	movq	64(%rax), %rdi
+	call	fopen@PLT
+.LVL9:
+	.loc 1 38 1 view .LVU28
+	addq	$184, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL10:
+	.loc 1 38 1 view .LVU29
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL11:
+	.loc 1 38 1 view .LVU30
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	open_text_rd1, .-open_text_rd1
+	.globl	open_text_rd2
+	.type	open_text_rd2, @function
+open_text_rd2:
+.LVL12:
+.LFB9:
+	.loc 1 45 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 46 5 view .LVU32
+	.loc 1 47 5 view .LVU33
+	.loc 1 45 1 is_stmt 0 view .LVU34
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 47 531 view .LVU35
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	.loc 1 45 1 view .LVU36
+	movq	%rdi, %r8
+	.loc 1 47 711 view .LVU37
+	movl	$20, %ecx
+	.loc 1 45 1 view .LVU38
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbp
+	movl	%edx, %ebx
+	.loc 1 47 259 view .LVU39
+	movq	%r8, %rsi
+.LVL13:
+	.loc 1 47 531 view .LVU40
+	xorl	%edx, %edx
+.LVL14:
+	.loc 1 45 1 view .LVU41
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	.loc 1 47 531 view .LVU42
+	movq	%rax, 88(%rsp)
+	xorl	%eax, %eax
+	.loc 1 47 711 view .LVU43
+	leaq	8(%rsp), %rdi
+.LVL15:
+	.loc 1 47 531 view .LVU44
+	movq	%rax, 112(%rsp)
+	movq	%rax, 120(%rsp)
+	movq	%rax, 128(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, 144(%rsp)
+	.loc 1 47 711 view .LVU45
+	xorl	%eax, %eax
+	rep stosl
+	.loc 1 47 531 view .LVU46
+	leaq	8(%rsp), %rax
+	.loc 1 47 259 view .LVU47
+	leaq	88(%rsp), %rdi
+	.loc 1 47 531 view .LVU48
+	movq	%rdx, 168(%rsp)
+.LVL16:
+.LBB179:
+.LBI179:
+	.loc 2 299 28 is_stmt 1 view .LVU49
+.LBB180:
+	.loc 2 304 5 view .LVU50
+.LBE180:
+.LBE179:
+	.loc 1 47 531 is_stmt 0 view .LVU51
+	movq	%rax, 152(%rsp)
+.LBB183:
+.LBB181:
+	.loc 2 304 12 view .LVU52
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 96(%rsp)
+	leaq	.LC0(%rip), %rax
+.LBE181:
+.LBE183:
+	.loc 1 47 531 view .LVU53
+	movq	$80, 160(%rsp)
+.LBB184:
+.LBB182:
+	.loc 2 304 12 view .LVU54
+	movq	%rax, 104(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU55
+.LVL17:
+	.loc 2 305 5 is_stmt 0 view .LVU56
+.LBE182:
+.LBE184:
+	.loc 1 47 259 view .LVU57
+	call	va_xprintf_char_p_utf8@PLT
+.LVL18:
+	.loc 1 47 259 view .LVU58
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_char_p_utf8@PLT
+.LVL19:
+	movl	%ebx, %esi
+	movq	%rax, %rdi
+	call	va_xprintf_uint@PLT
+.LVL20:
+	leaq	4(%rsp), %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_error_t_p@PLT
+.LVL21:
+	.loc 1 48 5 is_stmt 1 view .LVU59
+	.loc 1 48 8 is_stmt 0 view .LVU60
+	cmpl	$0, 4(%rsp)
+	jne	.L6
+	.loc 1 51 5 is_stmt 1 view .LVU61
+	.loc 1 51 12 is_stmt 0 view .LVU62
+	movq	64(%rax), %rdi
+	leaq	.LC1(%rip), %rsi
+	call	fopen@PLT
+.LVL22:
+	.loc 1 51 12 view .LVU63
+	jmp	.L3
+.LVL23:
+.L6:
+	.loc 1 51 12 view .LVU64
+	xorl	%eax, %eax
+.LVL24:
+.L3:
+	.loc 1 52 1 view .LVU65
+	addq	$184, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL25:
+	.loc 1 52 1 view .LVU66
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL26:
+	.loc 1 52 1 view .LVU67
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	open_text_rd2, .-open_text_rd2
+	.section	.rodata.str4.4,"aMS",@progbits,4
+	.align 4
+.LC2:
+	.string	"~"
+	.string	""
+	.string	""
+	.string	"s"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	""
+	.string	""
+	.string	"~"
+	.string	""
+	.string	""
+	.string	"s"
+	.string	""
+	.string	""
+	.string	"~"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"s"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.globl	open_text_rd3
+	.type	open_text_rd3, @function
+open_text_rd3:
+.LVL27:
+.LFB10:
+	.loc 1 61 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 62 5 view .LVU69
+	.loc 1 63 5 view .LVU70
+	.loc 1 61 1 is_stmt 0 view .LVU71
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 63 531 view .LVU72
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	.loc 1 61 1 view .LVU73
+	movq	%rdi, %r8
+	.loc 1 63 711 view .LVU74
+	movl	$20, %ecx
+	.loc 1 61 1 view .LVU75
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbp
+	movl	%edx, %ebx
+	.loc 1 63 259 view .LVU76
+	movq	%r8, %rsi
+.LVL28:
+	.loc 1 63 531 view .LVU77
+	xorl	%edx, %edx
+.LVL29:
+	.loc 1 61 1 view .LVU78
+	subq	$184, %rsp
+	.cfi_def_cfa_offset 208
+	.loc 1 63 531 view .LVU79
+	movq	%rax, 88(%rsp)
+	xorl	%eax, %eax
+	.loc 1 63 711 view .LVU80
+	leaq	8(%rsp), %rdi
+.LVL30:
+	.loc 1 63 531 view .LVU81
+	movq	%rax, 112(%rsp)
+	movq	%rax, 120(%rsp)
+	movq	%rax, 128(%rsp)
+	movq	%rax, 136(%rsp)
+	movq	%rax, 144(%rsp)
+	.loc 1 63 711 view .LVU82
+	xorl	%eax, %eax
+	rep stosl
+	.loc 1 63 531 view .LVU83
+	leaq	8(%rsp), %rax
+	.loc 1 63 259 view .LVU84
+	leaq	88(%rsp), %rdi
+	.loc 1 63 531 view .LVU85
+	movq	%rdx, 168(%rsp)
+.LVL31:
+.LBB185:
+.LBI185:
+	.loc 2 299 28 is_stmt 1 view .LVU86
+.LBB186:
+	.loc 2 304 5 view .LVU87
+.LBE186:
+.LBE185:
+	.loc 1 63 531 is_stmt 0 view .LVU88
+	movq	%rax, 152(%rsp)
+.LBB189:
+.LBB187:
+	.loc 2 304 12 view .LVU89
+	leaq	va_char32_p_read_vtab_utf32(%rip), %rax
+	movq	%rax, 96(%rsp)
+	leaq	.LC2(%rip), %rax
+.LBE187:
+.LBE189:
+	.loc 1 63 531 view .LVU90
+	movq	$80, 160(%rsp)
+.LBB190:
+.LBB188:
+	.loc 2 304 12 view .LVU91
+	movq	%rax, 104(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU92
+.LVL32:
+	.loc 2 305 5 is_stmt 0 view .LVU93
+.LBE188:
+.LBE190:
+	.loc 1 63 259 view .LVU94
+	call	va_xprintf_char16_p_utf16@PLT
+.LVL33:
+	.loc 1 63 259 view .LVU95
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_char16_p_utf16@PLT
+.LVL34:
+	movl	%ebx, %esi
+	movq	%rax, %rdi
+	call	va_xprintf_uint@PLT
+.LVL35:
+	leaq	4(%rsp), %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_error_t_p@PLT
+.LVL36:
+	.loc 1 64 5 is_stmt 1 view .LVU96
+	.loc 1 64 8 is_stmt 0 view .LVU97
+	cmpl	$0, 4(%rsp)
+	jne	.L12
+	.loc 1 67 5 is_stmt 1 view .LVU98
+	.loc 1 67 12 is_stmt 0 view .LVU99
+	movq	64(%rax), %rdi
+	leaq	.LC1(%rip), %rsi
+	call	fopen@PLT
+.LVL37:
+	.loc 1 67 12 view .LVU100
+	jmp	.L9
+.LVL38:
+.L12:
+	.loc 1 67 12 view .LVU101
+	xorl	%eax, %eax
+.LVL39:
+.L9:
+	.loc 1 68 1 view .LVU102
+	addq	$184, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL40:
+	.loc 1 68 1 view .LVU103
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL41:
+	.loc 1 68 1 view .LVU104
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	open_text_rd3, .-open_text_rd3
+	.globl	open_text_rd4
+	.type	open_text_rd4, @function
+open_text_rd4:
+.LVL42:
+.LFB11:
+	.loc 1 79 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 5 view .LVU106
+	.loc 1 81 5 view .LVU107
+	.loc 1 82 5 view .LVU108
+.LBB191:
+	.loc 1 82 32 view .LVU109
+.LBE191:
+	.loc 1 79 1 is_stmt 0 view .LVU110
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %r8
+.LBB194:
+	.loc 1 82 528 view .LVU111
+	xorl	%eax, %eax
+	movl	$24, %ecx
+.LBE194:
+	.loc 1 79 1 view .LVU112
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rsi, %rbp
+.LBB195:
+	.loc 1 82 29 view .LVU113
+	movq	%r8, %rsi
+.LVL43:
+	.loc 1 82 29 view .LVU114
+.LBE195:
+	.loc 1 79 1 view .LVU115
+	movl	%edx, %ebx
+	subq	$152, %rsp
+	.cfi_def_cfa_offset 176
+.LBB196:
+	.loc 1 82 528 view .LVU116
+	leaq	48(%rsp), %rdi
+.LVL44:
+	.loc 1 82 528 view .LVU117
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 82 29 view .LVU118
+	leaq	24(%rsp), %rdi
+	.loc 1 82 528 view .LVU119
+	movq	$16, 96(%rsp)
+	movq	%rax, 24(%rsp)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 112(%rsp)
+.LVL45:
+.LBB192:
+.LBI192:
+	.loc 2 299 28 is_stmt 1 view .LVU120
+.LBB193:
+	.loc 2 304 5 view .LVU121
+	.loc 2 304 12 is_stmt 0 view .LVU122
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 32(%rsp)
+	leaq	.LC0(%rip), %rax
+	movq	%rax, 40(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU123
+.LVL46:
+	.loc 2 305 5 is_stmt 0 view .LVU124
+.LBE193:
+.LBE192:
+	.loc 1 82 29 view .LVU125
+	call	va_xprintf_char_p_utf8@PLT
+.LVL47:
+	.loc 1 82 29 view .LVU126
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_char_p_utf8@PLT
+.LVL48:
+	movl	%ebx, %esi
+	movq	%rax, %rdi
+	call	va_xprintf_uint@PLT
+.LVL49:
+	leaq	20(%rsp), %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_error_t_p@PLT
+.LVL50:
+	.loc 1 82 429 view .LVU127
+	movq	64(%rax), %rbp
+.LVL51:
+	.loc 1 82 429 view .LVU128
+.LBE196:
+	.loc 1 83 5 is_stmt 1 view .LVU129
+	xorl	%eax, %eax
+	.loc 1 83 8 is_stmt 0 view .LVU130
+	cmpl	$0, 20(%rsp)
+	jne	.L15
+	.loc 1 84 9 is_stmt 1 view .LVU131
+	.loc 1 84 13 is_stmt 0 view .LVU132
+	leaq	.LC1(%rip), %rsi
+	movq	%rbp, %rdi
+	call	fopen@PLT
+.LVL52:
+.L15:
+	.loc 1 86 5 view .LVU133
+	movq	%rbp, %rdi
+	movq	%rax, 8(%rsp)
+.LVL53:
+	.loc 1 86 5 is_stmt 1 view .LVU134
+	call	free@PLT
+.LVL54:
+	.loc 1 87 5 view .LVU135
+	.loc 1 88 1 is_stmt 0 view .LVU136
+	movq	8(%rsp), %rax
+	addq	$152, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL55:
+	.loc 1 88 1 view .LVU137
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL56:
+	.loc 1 88 1 view .LVU138
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	open_text_rd4, .-open_text_rd4
+	.globl	open_text_rd5
+	.type	open_text_rd5, @function
+open_text_rd5:
+.LVL57:
+.LFB12:
+	.loc 1 96 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 97 5 view .LVU140
+.LBB197:
+	.loc 1 97 28 view .LVU141
+.LBE197:
+	.loc 1 96 1 is_stmt 0 view .LVU142
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+.LBB208:
+	.loc 1 97 527 view .LVU143
+	xorl	%eax, %eax
+	movl	$16, %ecx
+.LBE208:
+	.loc 1 96 1 view .LVU144
+	movq	%rsp, %rbp
+	.cfi_def_cfa_register 6
+	pushq	%r15
+	.cfi_offset 15, -24
+.LBB209:
+.LBB198:
+.LBB199:
+	.loc 2 304 12 view .LVU145
+	leaq	.LC0(%rip), %r15
+.LBE199:
+.LBE198:
+.LBE209:
+	.loc 1 96 1 view .LVU146
+	pushq	%r14
+	.cfi_offset 14, -32
+.LBB210:
+	.loc 1 97 34 view .LVU147
+	leaq	-136(%rbp), %r14
+.LBE210:
+	.loc 1 96 1 view .LVU148
+	pushq	%r13
+	.cfi_offset 13, -40
+	movq	%rdi, %r13
+.LBB211:
+	.loc 1 97 527 view .LVU149
+	leaq	-112(%rbp), %rdi
+.LVL58:
+	.loc 1 97 527 view .LVU150
+.LBE211:
+	.loc 1 96 1 view .LVU151
+	pushq	%r12
+	.cfi_offset 12, -48
+	movq	%rsi, %r12
+.LBB212:
+	.loc 1 97 34 view .LVU152
+	movq	%r13, %rsi
+.LVL59:
+	.loc 1 97 34 view .LVU153
+.LBE212:
+	.loc 1 96 1 view .LVU154
+	pushq	%rbx
+	.cfi_offset 3, -56
+.LBB213:
+.LBB204:
+.LBB200:
+	.loc 2 304 12 view .LVU155
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbx
+.LBE200:
+.LBE204:
+.LBE213:
+	.loc 1 96 1 view .LVU156
+	subq	$120, %rsp
+	.loc 1 96 1 view .LVU157
+	movl	%edx, -148(%rbp)
+.LBB214:
+	.loc 1 97 527 view .LVU158
+	rep stosl
+	leaq	va_char_p_size_vtab_utf8(%rip), %rax
+.LBB205:
+.LBB201:
+	.loc 2 304 12 view .LVU159
+	movq	%rbx, -128(%rbp)
+.LBE201:
+.LBE205:
+	.loc 1 97 34 view .LVU160
+	movq	%r14, %rdi
+.LBB206:
+.LBB202:
+	.loc 2 304 12 view .LVU161
+	movq	%r15, -120(%rbp)
+.LBE202:
+.LBE206:
+	.loc 1 97 527 view .LVU162
+	movq	%rax, -136(%rbp)
+	movq	$-2, -64(%rbp)
+.LVL60:
+.LBB207:
+.LBI198:
+	.loc 2 299 28 is_stmt 1 view .LVU163
+.LBB203:
+	.loc 2 304 5 view .LVU164
+	.loc 2 305 5 view .LVU165
+	.loc 2 305 5 is_stmt 0 view .LVU166
+.LBE203:
+.LBE207:
+	.loc 1 97 34 view .LVU167
+	call	va_xprintf_char_p_utf8@PLT
+.LVL61:
+	.loc 1 97 34 view .LVU168
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_char_p_utf8@PLT
+.LVL62:
+	movl	-148(%rbp), %esi
+	movq	%rax, %rdi
+	call	va_xprintf_last_uint@PLT
+.LVL63:
+.LBE214:
+.LBB215:
+	.loc 1 98 533 view .LVU169
+	xorl	%edx, %edx
+	.loc 1 98 288 view .LVU170
+	movq	%r13, %rsi
+	movq	%r14, %rdi
+.LBE215:
+.LBB222:
+	.loc 1 97 436 view .LVU171
+	movq	80(%rax), %rax
+.LBE222:
+.LBB223:
+	.loc 1 98 533 view .LVU172
+	movq	%rdx, -56(%rbp)
+.LBB216:
+.LBB217:
+	.loc 2 304 12 view .LVU173
+	movq	%rbx, -128(%rbp)
+.LBE217:
+.LBE216:
+.LBE223:
+.LBB224:
+	.loc 1 97 436 view .LVU174
+	leaq	1(%rax), %rcx
+.LVL64:
+	.loc 1 97 436 view .LVU175
+.LBE224:
+	.loc 1 97 10 view .LVU176
+	addq	$16, %rax
+.LVL65:
+.LBB225:
+.LBB220:
+.LBB218:
+	.loc 2 304 12 view .LVU177
+	movq	%r15, -120(%rbp)
+.LBE218:
+.LBE220:
+.LBE225:
+	.loc 1 97 10 view .LVU178
+	andq	$-16, %rax
+.LVL66:
+.LBB226:
+	.loc 1 98 533 view .LVU179
+	movq	%rcx, -64(%rbp)
+.LBE226:
+	.loc 1 97 10 view .LVU180
+	subq	%rax, %rsp
+.LVL67:
+	.loc 1 98 5 is_stmt 1 view .LVU181
+.LBB227:
+	.loc 1 98 34 view .LVU182
+.LBB221:
+.LBI216:
+	.loc 2 299 28 view .LVU183
+.LBB219:
+	.loc 2 304 5 view .LVU184
+	.loc 2 305 5 view .LVU185
+	.loc 2 305 5 is_stmt 0 view .LVU186
+.LBE219:
+.LBE221:
+	.loc 1 98 533 view .LVU187
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	movq	%rax, -136(%rbp)
+	xorl	%eax, %eax
+	movq	%rsp, -72(%rbp)
+	movq	%rax, -112(%rbp)
+	movq	%rax, -104(%rbp)
+	movq	%rax, -96(%rbp)
+	movq	%rax, -88(%rbp)
+	movq	%rax, -80(%rbp)
+	.loc 1 98 288 view .LVU188
+	call	va_xprintf_char_p_utf8@PLT
+.LVL68:
+	.loc 1 98 288 view .LVU189
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_char_p_utf8@PLT
+.LVL69:
+	movl	-148(%rbp), %esi
+	movq	%rax, %rdi
+	call	va_xprintf_last_uint@PLT
+.LVL70:
+.LBE227:
+	.loc 1 98 12 view .LVU190
+	leaq	.LC1(%rip), %rsi
+.LBB228:
+	.loc 1 98 34 view .LVU191
+	movq	64(%rax), %rdi
+.LBE228:
+	.loc 1 98 12 view .LVU192
+	call	fopen@PLT
+.LVL71:
+	.loc 1 100 1 view .LVU193
+	leaq	-40(%rbp), %rsp
+.LVL72:
+	.loc 1 100 1 view .LVU194
+	popq	%rbx
+	popq	%r12
+.LVL73:
+	.loc 1 100 1 view .LVU195
+	popq	%r13
+.LVL74:
+	.loc 1 100 1 view .LVU196
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	.cfi_def_cfa 7, 8
+.LVL75:
+	.loc 1 100 1 view .LVU197
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	open_text_rd5, .-open_text_rd5
+	.globl	testfunc2
+	.type	testfunc2, @function
+testfunc2:
+.LFB13:
+	.loc 1 107 22 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 109 1 view .LVU199
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	testfunc2, .-testfunc2
+	.section	.rodata.str1.1
+.LC3:
+	.string	"foo~s"
+.LC4:
+	.string	"out/test2-readme.c"
+.LC5:
+	.string	"s == t"
+	.text
+	.globl	testfunc3
+	.type	testfunc3, @function
+testfunc3:
+.LFB14:
+	.loc 1 117 22 view -0
+	.cfi_startproc
+	.loc 1 118 1 view .LVU201
+	.loc 1 119 1 view .LVU202
+.LBB229:
+	.loc 1 119 27 view .LVU203
+.LBE229:
+	.loc 1 117 22 is_stmt 0 view .LVU204
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB234:
+	.loc 1 119 606 view .LVU205
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	xorl	%edx, %edx
+	.loc 1 119 264 view .LVU206
+	movl	$5, %esi
+.LBE234:
+	.loc 1 117 22 view .LVU207
+	subq	$112, %rsp
+	.cfi_def_cfa_offset 128
+.LBB235:
+	.loc 1 119 606 view .LVU208
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	4(%rsp), %rbx
+	.loc 1 119 264 view .LVU209
+	leaq	24(%rsp), %rdi
+	.loc 1 119 606 view .LVU210
+	movq	%rax, 48(%rsp)
+	movq	%rax, 56(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, 80(%rsp)
+.LBB230:
+.LBB231:
+	.loc 2 304 12 view .LVU211
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 32(%rsp)
+	leaq	.LC3(%rip), %rax
+.LBE231:
+.LBE230:
+	.loc 1 119 606 view .LVU212
+	movq	%rbx, 88(%rsp)
+	movq	$20, 96(%rsp)
+	movq	%rdx, 104(%rsp)
+.LVL76:
+.LBB233:
+.LBI230:
+	.loc 2 299 28 is_stmt 1 view .LVU213
+.LBB232:
+	.loc 2 304 5 view .LVU214
+	.loc 2 304 12 is_stmt 0 view .LVU215
+	movq	%rax, 40(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU216
+.LVL77:
+	.loc 2 305 5 is_stmt 0 view .LVU217
+.LBE232:
+.LBE233:
+	.loc 1 119 264 view .LVU218
+	call	va_xprintf_last_sint@PLT
+.LVL78:
+	.loc 1 119 264 view .LVU219
+.LBE235:
+	.loc 1 120 1 is_stmt 1 view .LVU220
+	.loc 1 120 33 is_stmt 0 view .LVU221
+	cmpq	%rbx, 64(%rax)
+	je	.L22
+	.loc 1 120 10 is_stmt 1 discriminator 1 view .LVU222
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$120, %edx
+	leaq	.LC4(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+	call	__assert_fail@PLT
+.LVL79:
+.L22:
+	.loc 1 121 1 is_stmt 0 view .LVU223
+	addq	$112, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	testfunc3, .-testfunc3
+	.globl	testfunc5
+	.type	testfunc5, @function
+testfunc5:
+.LFB15:
+	.loc 1 129 22 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 130 1 view .LVU225
+	.loc 1 131 1 view .LVU226
+.LBB236:
+	.loc 1 131 32 view .LVU227
+.LBE236:
+	.loc 1 129 22 is_stmt 0 view .LVU228
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB241:
+	.loc 1 131 611 view .LVU229
+	leaq	va_char16_p_vtab_utf16(%rip), %rax
+	xorl	%edx, %edx
+	.loc 1 131 291 view .LVU230
+	movl	$5, %esi
+.LBE241:
+	.loc 1 129 22 view .LVU231
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB242:
+.LBB237:
+.LBB238:
+	.loc 2 304 12 view .LVU232
+	leaq	va_char_p_read_vtab_utf8(%rip), %r12
+	leaq	.LC3(%rip), %rbp
+.LBE238:
+.LBE237:
+.LBE242:
+	.loc 1 129 22 view .LVU233
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$208, %rsp
+	.cfi_def_cfa_offset 240
+.LBB243:
+	.loc 1 131 291 view .LVU234
+	leaq	120(%rsp), %rbx
+	.loc 1 131 611 view .LVU235
+	movq	%rax, 120(%rsp)
+	xorl	%eax, %eax
+	movq	%rax, 144(%rsp)
+	.loc 1 131 291 view .LVU236
+	movq	%rbx, %rdi
+	.loc 1 131 611 view .LVU237
+	movq	%rax, 152(%rsp)
+	movq	%rax, 160(%rsp)
+	movq	%rax, 168(%rsp)
+	movq	%rax, 176(%rsp)
+	movq	%rsp, %rax
+	movq	%rdx, 200(%rsp)
+.LVL80:
+.LBB240:
+.LBI237:
+	.loc 2 299 28 is_stmt 1 view .LVU238
+.LBB239:
+	.loc 2 304 5 view .LVU239
+	.loc 2 304 12 is_stmt 0 view .LVU240
+	movq	%r12, 128(%rsp)
+	movq	%rbp, 136(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU241
+.LVL81:
+	.loc 2 305 5 is_stmt 0 view .LVU242
+.LBE239:
+.LBE240:
+	.loc 1 131 611 view .LVU243
+	movq	%rax, 184(%rsp)
+	movq	$20, 192(%rsp)
+	.loc 1 131 291 view .LVU244
+	call	va_xprintf_last_sint@PLT
+.LVL82:
+	.loc 1 131 291 view .LVU245
+.LBE243:
+	.loc 1 133 1 is_stmt 1 view .LVU246
+	.loc 1 134 1 view .LVU247
+.LBB244:
+	.loc 1 134 32 view .LVU248
+	.loc 1 134 611 is_stmt 0 view .LVU249
+	leaq	va_char32_p_vtab_utf32(%rip), %rax
+	xorl	%esi, %esi
+	xorl	%ecx, %ecx
+	movq	%rax, 120(%rsp)
+	.loc 1 134 291 view .LVU250
+	movq	%rbx, %rdi
+	.loc 1 134 611 view .LVU251
+	leaq	40(%rsp), %rax
+	movq	%rsi, 200(%rsp)
+.LVL83:
+.LBB245:
+.LBI245:
+	.loc 2 299 28 is_stmt 1 view .LVU252
+.LBB246:
+	.loc 2 304 5 view .LVU253
+.LBE246:
+.LBE245:
+	.loc 1 134 291 is_stmt 0 view .LVU254
+	movl	$5, %esi
+.LBB248:
+.LBB247:
+	.loc 2 304 12 view .LVU255
+	movq	%r12, 128(%rsp)
+	movq	%rbp, 136(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU256
+.LVL84:
+	.loc 2 305 5 is_stmt 0 view .LVU257
+.LBE247:
+.LBE248:
+	.loc 1 134 611 view .LVU258
+	movq	%rcx, 144(%rsp)
+	movq	%rcx, 152(%rsp)
+	movq	%rcx, 160(%rsp)
+	movq	%rcx, 168(%rsp)
+	movq	%rcx, 176(%rsp)
+	movq	%rax, 184(%rsp)
+	movq	$20, 192(%rsp)
+	.loc 1 134 291 view .LVU259
+	call	va_xprintf_last_sint@PLT
+.LVL85:
+	.loc 1 134 291 view .LVU260
+.LBE244:
+	.loc 1 135 1 view .LVU261
+	addq	$208, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	testfunc5, .-testfunc5
+	.globl	testfunc7
+	.type	testfunc7, @function
+testfunc7:
+.LFB16:
+	.loc 1 143 22 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 144 1 view .LVU263
+	.loc 1 145 1 view .LVU264
+.LBB249:
+	.loc 1 145 27 view .LVU265
+.LBE249:
+	.loc 1 143 22 is_stmt 0 view .LVU266
+	subq	$120, %rsp
+	.cfi_def_cfa_offset 128
+.LBB254:
+	.loc 1 145 606 view .LVU267
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	xorl	%edx, %edx
+	.loc 1 145 281 view .LVU268
+	movl	$5, %esi
+	.loc 1 145 606 view .LVU269
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	.loc 1 145 281 view .LVU270
+	leaq	24(%rsp), %rdi
+	.loc 1 145 606 view .LVU271
+	movq	%rax, 48(%rsp)
+	movq	%rax, 56(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, 80(%rsp)
+	leaq	4(%rsp), %rax
+	movq	%rax, 88(%rsp)
+.LBB250:
+.LBB251:
+	.loc 2 304 12 view .LVU272
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 32(%rsp)
+	leaq	.LC3(%rip), %rax
+.LBE251:
+.LBE250:
+	.loc 1 145 606 view .LVU273
+	movq	$20, 96(%rsp)
+	movq	%rdx, 104(%rsp)
+.LVL86:
+.LBB253:
+.LBI250:
+	.loc 2 299 28 is_stmt 1 view .LVU274
+.LBB252:
+	.loc 2 304 5 view .LVU275
+	.loc 2 304 12 is_stmt 0 view .LVU276
+	movq	%rax, 40(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU277
+.LVL87:
+	.loc 2 305 5 is_stmt 0 view .LVU278
+.LBE252:
+.LBE253:
+	.loc 1 145 281 view .LVU279
+	call	va_xprintf_last_sint@PLT
+.LVL88:
+	.loc 1 145 281 view .LVU280
+.LBE254:
+	.loc 1 146 1 view .LVU281
+	addq	$120, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	testfunc7, .-testfunc7
+	.globl	testfunc9
+	.type	testfunc9, @function
+testfunc9:
+.LFB17:
+	.loc 1 155 22 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 156 1 view .LVU283
+	.loc 1 155 22 is_stmt 0 view .LVU284
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 156 612 view .LVU285
+	xorl	%eax, %eax
+	.loc 1 156 792 view .LVU286
+	movl	$5, %ecx
+	.loc 1 156 612 view .LVU287
+	xorl	%edx, %edx
+	.loc 1 155 22 view .LVU288
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	.loc 1 156 612 view .LVU289
+	leaq	va_char_p_vtab_utf8(%rip), %r15
+	.loc 1 156 256 view .LVU290
+	movl	$5, %esi
+	.loc 1 157 612 view .LVU291
+	leaq	va_char16_p_vtab_utf16(%rip), %r14
+	.loc 1 155 22 view .LVU292
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	.loc 1 158 612 view .LVU293
+	leaq	va_char32_p_vtab_utf32(%rip), %r13
+	.loc 1 155 22 view .LVU294
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 156 792 view .LVU295
+	xorl	%r12d, %r12d
+	.loc 1 155 22 view .LVU296
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+.LBB255:
+.LBB256:
+	.loc 2 304 12 view .LVU297
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbp
+.LBE256:
+.LBE255:
+	.loc 1 155 22 view .LVU298
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB260:
+.LBB257:
+	.loc 2 304 12 view .LVU299
+	leaq	.LC3(%rip), %rbx
+.LBE257:
+.LBE260:
+	.loc 1 155 22 view .LVU300
+	subq	$824, %rsp
+	.cfi_def_cfa_offset 880
+	.loc 1 156 612 view .LVU301
+	movq	%rax, 312(%rsp)
+	.loc 1 156 792 view .LVU302
+	leaq	8(%rsp), %rdi
+	.loc 1 156 612 view .LVU303
+	movq	%rax, 320(%rsp)
+	movq	%rax, 328(%rsp)
+	movq	%rax, 336(%rsp)
+	movq	%rax, 344(%rsp)
+	.loc 1 156 792 view .LVU304
+	movl	%r12d, %eax
+	rep stosl
+	.loc 1 156 612 view .LVU305
+	leaq	8(%rsp), %rax
+	.loc 1 156 256 view .LVU306
+	leaq	288(%rsp), %rdi
+	.loc 1 156 612 view .LVU307
+	movq	%rdx, 368(%rsp)
+.LVL89:
+.LBB261:
+.LBI255:
+	.loc 2 299 28 is_stmt 1 view .LVU308
+.LBB258:
+	.loc 2 304 5 view .LVU309
+.LBE258:
+.LBE261:
+	.loc 1 156 612 is_stmt 0 view .LVU310
+	movq	%r15, 288(%rsp)
+.LBB262:
+.LBB259:
+	.loc 2 304 12 view .LVU311
+	movq	%rbp, 296(%rsp)
+	movq	%rbx, 304(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU312
+.LVL90:
+	.loc 2 305 5 is_stmt 0 view .LVU313
+.LBE259:
+.LBE262:
+	.loc 1 156 612 view .LVU314
+	movq	%rax, 352(%rsp)
+	movq	$20, 360(%rsp)
+	.loc 1 156 256 view .LVU315
+	call	va_xprintf_last_sint@PLT
+.LVL91:
+	.loc 1 157 1 is_stmt 1 view .LVU316
+	.loc 1 157 612 is_stmt 0 view .LVU317
+	xorl	%ecx, %ecx
+	.loc 1 157 800 view .LVU318
+	movl	%r12d, %eax
+	leaq	48(%rsp), %rdi
+	.loc 1 157 612 view .LVU319
+	movq	%rcx, 400(%rsp)
+	xorl	%esi, %esi
+	movq	%rcx, 408(%rsp)
+	movq	%rcx, 416(%rsp)
+	movq	%rcx, 424(%rsp)
+	movq	%rcx, 432(%rsp)
+	.loc 1 157 800 view .LVU320
+	movl	$10, %ecx
+	rep stosl
+	.loc 1 157 612 view .LVU321
+	movq	%rsi, 456(%rsp)
+.LVL92:
+.LBB263:
+.LBI263:
+	.loc 2 299 28 is_stmt 1 view .LVU322
+.LBB264:
+	.loc 2 304 5 view .LVU323
+.LBE264:
+.LBE263:
+	.loc 1 157 612 is_stmt 0 view .LVU324
+	leaq	48(%rsp), %rax
+	.loc 1 157 272 view .LVU325
+	leaq	376(%rsp), %rdi
+.LVL93:
+	.loc 1 157 272 view .LVU326
+	movl	$5, %esi
+	.loc 1 157 612 view .LVU327
+	movq	%r14, 376(%rsp)
+.LBB266:
+.LBB265:
+	.loc 2 304 12 view .LVU328
+	movq	%rbp, 384(%rsp)
+	movq	%rbx, 392(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU329
+.LVL94:
+	.loc 2 305 5 is_stmt 0 view .LVU330
+.LBE265:
+.LBE266:
+	.loc 1 157 612 view .LVU331
+	movq	%rax, 440(%rsp)
+	movq	$20, 448(%rsp)
+	.loc 1 157 272 view .LVU332
+	call	va_xprintf_last_sint@PLT
+.LVL95:
+	.loc 1 158 1 is_stmt 1 view .LVU333
+	.loc 1 158 612 is_stmt 0 view .LVU334
+	xorl	%edi, %edi
+	.loc 1 158 800 view .LVU335
+	movl	%r12d, %eax
+	movl	$20, %ecx
+	.loc 1 158 612 view .LVU336
+	movq	%rdi, 488(%rsp)
+	xorl	%r8d, %r8d
+	.loc 1 158 272 view .LVU337
+	movl	$5, %esi
+	.loc 1 158 612 view .LVU338
+	movq	%rdi, 496(%rsp)
+	movq	%rdi, 504(%rsp)
+	movq	%rdi, 512(%rsp)
+	movq	%rdi, 520(%rsp)
+	.loc 1 158 800 view .LVU339
+	leaq	128(%rsp), %rdi
+	rep stosl
+	.loc 1 158 612 view .LVU340
+	leaq	128(%rsp), %rax
+	.loc 1 158 272 view .LVU341
+	leaq	464(%rsp), %rdi
+	.loc 1 158 612 view .LVU342
+	movq	%r8, 544(%rsp)
+.LVL96:
+.LBB267:
+.LBI267:
+	.loc 2 299 28 is_stmt 1 view .LVU343
+.LBB268:
+	.loc 2 304 5 view .LVU344
+.LBE268:
+.LBE267:
+	.loc 1 158 612 is_stmt 0 view .LVU345
+	movq	%r13, 464(%rsp)
+.LBB270:
+.LBB269:
+	.loc 2 304 12 view .LVU346
+	movq	%rbp, 472(%rsp)
+	movq	%rbx, 480(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU347
+.LVL97:
+	.loc 2 305 5 is_stmt 0 view .LVU348
+.LBE269:
+.LBE270:
+	.loc 1 158 612 view .LVU349
+	movq	%rax, 528(%rsp)
+	movq	$20, 536(%rsp)
+	.loc 1 158 272 view .LVU350
+	call	va_xprintf_last_sint@PLT
+.LVL98:
+	.loc 1 159 1 is_stmt 1 view .LVU351
+	.loc 1 159 792 is_stmt 0 view .LVU352
+	movl	%r12d, %eax
+	leaq	28(%rsp), %rdi
+	.loc 1 159 612 view .LVU353
+	xorl	%r9d, %r9d
+	.loc 1 159 792 view .LVU354
+	movl	$5, %ecx
+	.loc 1 159 612 view .LVU355
+	xorl	%r10d, %r10d
+	.loc 1 159 256 view .LVU356
+	movl	$5, %esi
+	.loc 1 159 612 view .LVU357
+	movq	%r9, 576(%rsp)
+	.loc 1 159 792 view .LVU358
+	rep stosl
+	.loc 1 159 612 view .LVU359
+	leaq	28(%rsp), %rax
+	.loc 1 159 256 view .LVU360
+	leaq	552(%rsp), %rdi
+	.loc 1 159 612 view .LVU361
+	movq	%r9, 584(%rsp)
+	movq	%r9, 592(%rsp)
+	movq	%r9, 600(%rsp)
+	movq	%r9, 608(%rsp)
+	movq	%r10, 632(%rsp)
+.LVL99:
+.LBB271:
+.LBI271:
+	.loc 2 299 28 is_stmt 1 view .LVU362
+.LBB272:
+	.loc 2 304 5 view .LVU363
+.LBE272:
+.LBE271:
+	.loc 1 159 612 is_stmt 0 view .LVU364
+	movq	%r15, 552(%rsp)
+	.loc 1 161 612 view .LVU365
+	xorl	%r15d, %r15d
+.LBB274:
+.LBB273:
+	.loc 2 304 12 view .LVU366
+	movq	%rbp, 560(%rsp)
+	movq	%rbx, 568(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU367
+.LVL100:
+	.loc 2 305 5 is_stmt 0 view .LVU368
+.LBE273:
+.LBE274:
+	.loc 1 159 612 view .LVU369
+	movq	%rax, 616(%rsp)
+	movq	$20, 624(%rsp)
+	.loc 1 159 256 view .LVU370
+	call	va_xprintf_last_sint@PLT
+.LVL101:
+	.loc 1 160 1 is_stmt 1 view .LVU371
+	.loc 1 160 800 is_stmt 0 view .LVU372
+	movl	%r12d, %eax
+	leaq	88(%rsp), %rdi
+	.loc 1 160 612 view .LVU373
+	xorl	%r11d, %r11d
+	.loc 1 160 800 view .LVU374
+	movl	$10, %ecx
+	.loc 1 160 612 view .LVU375
+	movq	%r14, 640(%rsp)
+	.loc 1 160 272 view .LVU376
+	movl	$5, %esi
+	.loc 1 160 612 view .LVU377
+	xorl	%r14d, %r14d
+	.loc 1 160 800 view .LVU378
+	rep stosl
+	.loc 1 160 612 view .LVU379
+	leaq	88(%rsp), %rax
+	.loc 1 160 272 view .LVU380
+	leaq	640(%rsp), %rdi
+	.loc 1 160 612 view .LVU381
+	movq	%r11, 664(%rsp)
+	movq	%r11, 672(%rsp)
+	movq	%r11, 680(%rsp)
+	movq	%r11, 688(%rsp)
+	movq	%r11, 696(%rsp)
+	movq	%r14, 720(%rsp)
+.LVL102:
+.LBB275:
+.LBI275:
+	.loc 2 299 28 is_stmt 1 view .LVU382
+.LBB276:
+	.loc 2 304 5 view .LVU383
+	.loc 2 304 12 is_stmt 0 view .LVU384
+	movq	%rbp, 648(%rsp)
+	movq	%rbx, 656(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU385
+.LVL103:
+	.loc 2 305 5 is_stmt 0 view .LVU386
+.LBE276:
+.LBE275:
+	.loc 1 160 612 view .LVU387
+	movq	%rax, 704(%rsp)
+	movq	$20, 712(%rsp)
+	.loc 1 160 272 view .LVU388
+	call	va_xprintf_last_sint@PLT
+.LVL104:
+	.loc 1 161 1 is_stmt 1 view .LVU389
+	.loc 1 161 800 is_stmt 0 view .LVU390
+	movl	%r12d, %eax
+	movl	$20, %ecx
+	leaq	208(%rsp), %rdi
+	rep stosl
+	.loc 1 161 612 view .LVU391
+	leaq	208(%rsp), %rax
+	.loc 1 161 272 view .LVU392
+	leaq	728(%rsp), %rdi
+	movl	$5, %esi
+	.loc 1 161 612 view .LVU393
+	movq	%rax, 792(%rsp)
+	xorl	%eax, %eax
+	movq	%r13, 728(%rsp)
+	movq	%r15, 752(%rsp)
+	movq	%r15, 760(%rsp)
+	movq	%r15, 768(%rsp)
+	movq	%r15, 776(%rsp)
+	movq	%r15, 784(%rsp)
+.LBB277:
+.LBB278:
+	.loc 2 304 12 view .LVU394
+	movq	%rbp, 736(%rsp)
+	movq	%rbx, 744(%rsp)
+.LBE278:
+.LBE277:
+	.loc 1 161 612 view .LVU395
+	movq	$20, 800(%rsp)
+	movq	%rax, 808(%rsp)
+.LVL105:
+.LBB280:
+.LBI277:
+	.loc 2 299 28 is_stmt 1 view .LVU396
+.LBB279:
+	.loc 2 304 5 view .LVU397
+	.loc 2 305 5 view .LVU398
+	.loc 2 305 5 is_stmt 0 view .LVU399
+.LBE279:
+.LBE280:
+	.loc 1 161 272 view .LVU400
+	call	va_xprintf_last_sint@PLT
+.LVL106:
+	.loc 1 162 1 view .LVU401
+	addq	$824, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	testfunc9, .-testfunc9
+	.section	.rodata.str1.1
+.LC6:
+	.string	"foo"
+.LC7:
+	.string	"bar ~u"
+.LC8:
+	.string	"longer than the string, will be cropped"
+.LC9:
+	.string	""
+.LC10:
+	.string	"ERROR: found ec=~s\n"
+	.text
+	.globl	testfunc11
+	.type	testfunc11, @function
+testfunc11:
+.LFB18:
+	.loc 1 168 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 169 1 view .LVU403
+	.loc 1 170 1 view .LVU404
+	.loc 1 168 23 is_stmt 0 view .LVU405
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 170 20 view .LVU406
+	leaq	va_char_p_vtab_utf8(%rip), %rax
+	xorl	%edx, %edx
+	.loc 1 171 157 view .LVU407
+	leaq	.LC6(%rip), %rsi
+	.loc 1 168 23 view .LVU408
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 171 157 view .LVU409
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbx
+	.loc 1 168 23 view .LVU410
+	subq	$488, %rsp
+	.cfi_def_cfa_offset 512
+	.loc 1 171 157 view .LVU411
+	leaq	32(%rsp), %rbp
+	.loc 1 170 20 view .LVU412
+	movq	%rax, 32(%rsp)
+	xorl	%eax, %eax
+	movq	%rax, 40(%rsp)
+	.loc 1 171 157 view .LVU413
+	movq	%rbp, %rdi
+	.loc 1 170 20 view .LVU414
+	movq	%rax, 48(%rsp)
+	movq	%rax, 56(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, 80(%rsp)
+	movq	%rax, 88(%rsp)
+	leaq	12(%rsp), %rax
+	movq	%rdx, 112(%rsp)
+	.loc 1 171 1 is_stmt 1 view .LVU415
+	.loc 1 171 5 view .LVU416
+	.loc 1 171 157 is_stmt 0 view .LVU417
+	movq	%rbx, %rdx
+	.loc 1 170 20 view .LVU418
+	movq	%rax, 96(%rsp)
+	movq	$20, 104(%rsp)
+	.loc 1 171 157 view .LVU419
+	call	va_xprintf_init_last_plain@PLT
+.LVL107:
+	.loc 1 171 3 is_stmt 1 view .LVU420
+	.loc 1 172 1 view .LVU421
+	.loc 1 172 5 view .LVU422
+.LBB281:
+.LBI281:
+	.loc 2 299 28 view .LVU423
+.LBB282:
+	.loc 2 304 5 view .LVU424
+	.loc 2 304 12 is_stmt 0 view .LVU425
+	leaq	.LC7(%rip), %rax
+.LBE282:
+.LBE281:
+	.loc 1 172 34 view .LVU426
+	movl	$55, %esi
+	movq	%rbp, %rdi
+.LBB284:
+.LBB283:
+	.loc 2 304 12 view .LVU427
+	movq	%rbx, 40(%rsp)
+	movq	%rax, 48(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU428
+.LVL108:
+	.loc 2 305 5 is_stmt 0 view .LVU429
+.LBE283:
+.LBE284:
+	.loc 1 172 34 view .LVU430
+	call	va_xprintf_last_sint@PLT
+.LVL109:
+	.loc 1 172 3 is_stmt 1 view .LVU431
+	.loc 1 173 1 view .LVU432
+	.loc 1 173 5 view .LVU433
+	.loc 1 173 301 is_stmt 0 view .LVU434
+	movq	%rbx, %rdx
+	leaq	.LC8(%rip), %rsi
+	movq	%rbp, %rdi
+	call	va_xprintf_init_last_plain@PLT
+.LVL110:
+	.loc 1 173 3 is_stmt 1 view .LVU435
+	.loc 1 193 1 view .LVU436
+	.loc 1 194 1 view .LVU437
+	.loc 1 194 5 view .LVU438
+.LBB285:
+.LBI285:
+	.loc 2 299 28 view .LVU439
+.LBB286:
+	.loc 2 304 5 view .LVU440
+	.loc 2 304 12 is_stmt 0 view .LVU441
+	leaq	.LC9(%rip), %rax
+.LBE286:
+.LBE285:
+	.loc 1 194 34 view .LVU442
+	movq	%rbp, %rdi
+	leaq	8(%rsp), %rsi
+.LBB288:
+.LBB287:
+	.loc 2 304 12 view .LVU443
+	movq	%rbx, 40(%rsp)
+	movq	%rax, 48(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU444
+.LVL111:
+	.loc 2 305 5 is_stmt 0 view .LVU445
+.LBE287:
+.LBE288:
+	.loc 1 194 34 view .LVU446
+	call	va_xprintf_last_error_t_p@PLT
+.LVL112:
+	.loc 1 194 3 is_stmt 1 view .LVU447
+	.loc 1 195 1 view .LVU448
+	.loc 1 197 1 view .LVU449
+	.loc 1 203 1 view .LVU450
+	.loc 1 203 15 is_stmt 0 view .LVU451
+	movq	%rbp, %rdi
+	call	va_stream_get_error_f@PLT
+.LVL113:
+	.loc 1 204 1 is_stmt 1 view .LVU452
+	.loc 1 204 4 is_stmt 0 view .LVU453
+	testl	%eax, %eax
+	je	.L31
+	movl	%eax, %edx
+	.loc 1 205 5 is_stmt 1 view .LVU454
+.LBB289:
+	.loc 1 205 9 view .LVU455
+	.loc 1 205 33 view .LVU456
+	.loc 1 205 50 is_stmt 0 view .LVU457
+	leaq	128(%rsp), %rdi
+	xorl	%eax, %eax
+.LVL114:
+	.loc 1 205 50 view .LVU458
+	movl	$24, %ecx
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 205 39 view .LVU459
+	movl	%edx, %edi
+	.loc 1 205 50 view .LVU460
+	movq	$256, 200(%rsp)
+	.loc 1 205 61 is_stmt 1 view .LVU461
+	.loc 1 205 50 is_stmt 0 view .LVU462
+	movq	%rax, 120(%rsp)
+	movq	stderr(%rip), %rax
+	.loc 1 205 82 view .LVU463
+	movb	$1, 216(%rsp)
+	.loc 1 205 6 is_stmt 1 view .LVU464
+	.loc 1 205 50 is_stmt 0 view .LVU465
+	movq	%rax, 184(%rsp)
+	leaq	224(%rsp), %rax
+	movq	%rax, 192(%rsp)
+	.loc 1 205 39 view .LVU466
+	call	va_strerror@PLT
+.LVL115:
+	.loc 1 205 39 view .LVU467
+	leaq	120(%rsp), %rdi
+.LBB290:
+.LBB291:
+	.loc 2 304 12 view .LVU468
+	movq	%rbx, 128(%rsp)
+.LBE291:
+.LBE290:
+	.loc 1 205 39 view .LVU469
+	movq	%rax, %rsi
+.LVL116:
+.LBB293:
+.LBI290:
+	.loc 2 299 28 is_stmt 1 view .LVU470
+.LBB292:
+	.loc 2 304 5 view .LVU471
+	.loc 2 304 12 is_stmt 0 view .LVU472
+	leaq	.LC10(%rip), %rax
+	movq	%rax, 136(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU473
+.LVL117:
+	.loc 2 305 5 is_stmt 0 view .LVU474
+.LBE292:
+.LBE293:
+	.loc 1 205 39 view .LVU475
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL118:
+.LBE289:
+	.loc 1 205 7 is_stmt 1 view .LVU476
+.L31:
+	.loc 1 208 1 is_stmt 0 view .LVU477
+	addq	$488, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	testfunc11, .-testfunc11
+	.globl	testfunc17
+	.type	testfunc17, @function
+testfunc17:
+.LFB49:
+	.cfi_startproc
+	.loc 1 221 6 is_stmt 1 view .LVU478
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	testfunc17, .-testfunc17
+	.globl	testfunc18
+	.type	testfunc18, @function
+testfunc18:
+.LFB20:
+	.loc 1 228 23 view -0
+	.cfi_startproc
+	.loc 1 229 1 view .LVU480
+.LBB294:
+	.loc 1 229 27 view .LVU481
+.LBE294:
+	.loc 1 228 23 is_stmt 0 view .LVU482
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 144
+.LBB297:
+	.loc 1 229 603 view .LVU483
+	xorl	%eax, %eax
+	movl	$24, %ecx
+	leaq	32(%rsp), %rdi
+	.loc 1 229 24 view .LVU484
+	leaq	msg(%rip), %rsi
+	.loc 1 229 603 view .LVU485
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 229 24 view .LVU486
+	leaq	8(%rsp), %rdi
+	.loc 1 229 603 view .LVU487
+	movq	$16, 80(%rsp)
+	movq	%rax, 8(%rsp)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 96(%rsp)
+.LVL119:
+.LBB295:
+.LBI295:
+	.loc 2 299 28 is_stmt 1 view .LVU488
+.LBB296:
+	.loc 2 304 5 view .LVU489
+	.loc 2 304 12 is_stmt 0 view .LVU490
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 16(%rsp)
+	leaq	.LC3(%rip), %rax
+	movq	%rax, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU491
+.LVL120:
+	.loc 2 305 5 is_stmt 0 view .LVU492
+.LBE296:
+.LBE295:
+	.loc 1 229 24 view .LVU493
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL121:
+	.loc 1 229 400 view .LVU494
+	movq	64(%rax), %rdi
+.LVL122:
+	.loc 1 229 400 view .LVU495
+.LBE297:
+	.loc 1 230 1 is_stmt 1 view .LVU496
+	.loc 1 231 1 is_stmt 0 view .LVU497
+	addq	$136, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 230 1 view .LVU498
+	jmp	free@PLT
+.LVL123:
+	.loc 1 230 1 view .LVU499
+	.cfi_endproc
+.LFE20:
+	.size	testfunc18, .-testfunc18
+	.globl	testfunc20
+	.type	testfunc20, @function
+testfunc20:
+.LFB63:
+	.cfi_startproc
+	.loc 1 250 6 is_stmt 1 view .LVU500
+	jmp	testfunc18
+	.cfi_endproc
+.LFE63:
+	.size	testfunc20, .-testfunc20
+	.globl	testfunc22
+	.type	testfunc22, @function
+testfunc22:
+.LFB22:
+	.loc 1 266 23 view -0
+	.cfi_startproc
+	.loc 1 267 1 view .LVU502
+.LBB298:
+	.loc 1 267 27 view .LVU503
+	.loc 1 267 48 view .LVU504
+.LBE298:
+	.loc 1 266 23 is_stmt 0 view .LVU505
+	subq	$648, %rsp
+	.cfi_def_cfa_offset 656
+.LBB303:
+	.loc 1 267 603 view .LVU506
+	xorl	%eax, %eax
+	movl	$24, %ecx
+	movq	va_alloc@GOTPCREL(%rip), %rdx
+	leaq	32(%rsp), %rdi
+	.loc 1 267 24 view .LVU507
+	leaq	msg(%rip), %rsi
+	.loc 1 267 603 view .LVU508
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 267 24 view .LVU509
+	leaq	8(%rsp), %rdi
+	.loc 1 267 603 view .LVU510
+	movq	$512, 80(%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%rax, 72(%rsp)
+	movq	%rax, 104(%rsp)
+.LVL124:
+.LBB299:
+.LBI299:
+	.loc 2 299 28 is_stmt 1 view .LVU511
+.LBB300:
+	.loc 2 304 5 view .LVU512
+	.loc 2 304 12 is_stmt 0 view .LVU513
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 16(%rsp)
+	leaq	.LC3(%rip), %rax
+.LBE300:
+.LBE299:
+	.loc 1 267 603 view .LVU514
+	movq	%rdx, 96(%rsp)
+.LBB302:
+.LBB301:
+	.loc 2 304 12 view .LVU515
+	movq	%rax, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU516
+.LVL125:
+	.loc 2 305 5 is_stmt 0 view .LVU517
+.LBE301:
+.LBE302:
+	.loc 1 267 24 view .LVU518
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL126:
+	.loc 1 267 400 view .LVU519
+	movq	64(%rax), %rdi
+.LVL127:
+	.loc 1 267 400 view .LVU520
+.LBE303:
+	.loc 1 268 1 is_stmt 1 view .LVU521
+	.loc 1 269 1 is_stmt 0 view .LVU522
+	addq	$648, %rsp
+	.cfi_def_cfa_offset 8
+	.loc 1 268 1 view .LVU523
+	jmp	free@PLT
+.LVL128:
+	.loc 1 268 1 view .LVU524
+	.cfi_endproc
+.LFE22:
+	.size	testfunc22, .-testfunc22
+	.section	.rodata.str1.1
+.LC11:
+	.string	"bar~s"
+	.text
+	.globl	testfunc24
+	.type	testfunc24, @function
+testfunc24:
+.LFB23:
+	.loc 1 279 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 280 1 view .LVU526
+	.loc 1 279 23 is_stmt 0 view .LVU527
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	.loc 1 280 12 view .LVU528
+	xorl	%eax, %eax
+.LBB304:
+	.loc 1 281 603 view .LVU529
+	movl	$24, %ecx
+.LBB305:
+.LBB306:
+	.loc 2 304 12 view .LVU530
+	leaq	va_char_p_read_vtab_utf8(%rip), %r14
+.LBE306:
+.LBE305:
+.LBE304:
+	.loc 1 279 23 view .LVU531
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+.LBB315:
+	.loc 1 281 34 view .LVU532
+	leaq	msg(%rip), %r13
+.LBE315:
+	.loc 1 279 23 view .LVU533
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+.LBB316:
+	.loc 1 281 34 view .LVU534
+	movq	%r13, %rsi
+.LBE316:
+	.loc 1 279 23 view .LVU535
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+.LBB317:
+	.loc 1 281 603 view .LVU536
+	xorl	%ebp, %ebp
+.LBE317:
+	.loc 1 279 23 view .LVU537
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$160, %rsp
+	.cfi_def_cfa_offset 208
+	.loc 1 280 12 view .LVU538
+	movq	%rax, 8(%rsp)
+.LBB318:
+	.loc 1 281 603 view .LVU539
+	leaq	64(%rsp), %rdi
+	.loc 1 281 34 view .LVU540
+	leaq	40(%rsp), %r12
+.LBE318:
+	.loc 1 280 12 view .LVU541
+	movq	%rax, 16(%rsp)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+.LBB319:
+	.loc 1 281 603 view .LVU542
+	leaq	8(%rsp), %rbx
+.LBE319:
+	.loc 1 280 12 view .LVU543
+	movq	$4096, 24(%rsp)
+	movq	%rax, 32(%rsp)
+	.loc 1 281 1 is_stmt 1 view .LVU544
+.LBB320:
+	.loc 1 281 27 view .LVU545
+	.loc 1 281 603 is_stmt 0 view .LVU546
+	movl	%ebp, %eax
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 281 34 view .LVU547
+	movq	%r12, %rdi
+.LBB311:
+.LBB307:
+	.loc 2 304 12 view .LVU548
+	movq	%r14, 48(%rsp)
+.LBE307:
+.LBE311:
+	.loc 1 281 603 view .LVU549
+	movq	%rax, 40(%rsp)
+.LBB312:
+.LBB308:
+	.loc 2 304 12 view .LVU550
+	leaq	.LC3(%rip), %rax
+.LBE308:
+.LBE312:
+	.loc 1 281 603 view .LVU551
+	movq	%rbx, 144(%rsp)
+.LVL129:
+.LBB313:
+.LBI305:
+	.loc 2 299 28 is_stmt 1 view .LVU552
+.LBB309:
+	.loc 2 304 5 view .LVU553
+.LBE309:
+.LBE313:
+	.loc 1 281 603 is_stmt 0 view .LVU554
+	movq	$16, 112(%rsp)
+.LBB314:
+.LBB310:
+	.loc 2 304 12 view .LVU555
+	movq	%rax, 56(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU556
+.LVL130:
+	.loc 2 305 5 is_stmt 0 view .LVU557
+.LBE310:
+.LBE314:
+	.loc 1 281 34 view .LVU558
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL131:
+	.loc 1 281 34 view .LVU559
+.LBE320:
+	.loc 1 282 1 is_stmt 1 view .LVU560
+.LBB321:
+	.loc 1 282 31 view .LVU561
+	.loc 1 282 609 is_stmt 0 view .LVU562
+	movl	%ebp, %eax
+	leaq	64(%rsp), %rdi
+	.loc 1 282 38 view .LVU563
+	movq	%r13, %rsi
+	.loc 1 282 609 view .LVU564
+	movl	$24, %ecx
+	rep stosl
+	leaq	va_vec16_vtab_utf16(%rip), %rax
+	.loc 1 282 38 view .LVU565
+	movq	%r12, %rdi
+.LBB322:
+.LBB323:
+	.loc 2 304 12 view .LVU566
+	movq	%r14, 48(%rsp)
+.LBE323:
+.LBE322:
+	.loc 1 282 609 view .LVU567
+	movq	%rax, 40(%rsp)
+.LBB327:
+.LBB324:
+	.loc 2 304 12 view .LVU568
+	leaq	.LC11(%rip), %rax
+.LBE324:
+.LBE327:
+	.loc 1 282 609 view .LVU569
+	movq	%rbx, 144(%rsp)
+.LVL132:
+.LBB328:
+.LBI322:
+	.loc 2 299 28 is_stmt 1 view .LVU570
+.LBB325:
+	.loc 2 304 5 view .LVU571
+.LBE325:
+.LBE328:
+	.loc 1 282 609 is_stmt 0 view .LVU572
+	movq	$16, 112(%rsp)
+.LBB329:
+.LBB326:
+	.loc 2 304 12 view .LVU573
+	movq	%rax, 56(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU574
+.LVL133:
+	.loc 2 305 5 is_stmt 0 view .LVU575
+.LBE326:
+.LBE329:
+	.loc 1 282 38 view .LVU576
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL134:
+	.loc 1 282 38 view .LVU577
+.LBE321:
+	.loc 1 283 1 is_stmt 1 view .LVU578
+	movq	%rbx, %rdi
+	call	va_arena_free@PLT
+.LVL135:
+	.loc 1 284 1 is_stmt 0 view .LVU579
+	addq	$160, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	testfunc24, .-testfunc24
+	.globl	testfunc26
+	.type	testfunc26, @function
+testfunc26:
+.LFB24:
+	.loc 1 295 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 296 1 view .LVU581
+	.loc 1 297 1 view .LVU582
+.LBB330:
+	.loc 1 297 37 view .LVU583
+.LBE330:
+	.loc 1 295 23 is_stmt 0 view .LVU584
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+.LBB335:
+	.loc 1 297 613 view .LVU585
+	xorl	%eax, %eax
+	movl	$24, %ecx
+	.loc 1 297 34 view .LVU586
+	leaq	msg(%rip), %rsi
+.LBE335:
+	.loc 1 295 23 view .LVU587
+	subq	$368, %rsp
+	.cfi_def_cfa_offset 384
+.LBB336:
+	.loc 1 297 613 view .LVU588
+	movq	va_alloc@GOTPCREL(%rip), %rdx
+	leaq	24(%rsp), %rdi
+	.loc 1 297 34 view .LVU589
+	movq	%rsp, %rbx
+	.loc 1 297 613 view .LVU590
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 297 34 view .LVU591
+	movq	%rbx, %rdi
+	.loc 1 297 613 view .LVU592
+	movq	%rdx, 88(%rsp)
+	movq	%rax, (%rsp)
+	leaq	240(%rsp), %rax
+	movq	%rax, 64(%rsp)
+	movq	%rax, 96(%rsp)
+.LBB331:
+.LBB332:
+	.loc 2 304 12 view .LVU593
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 8(%rsp)
+	leaq	.LC3(%rip), %rax
+.LBE332:
+.LBE331:
+	.loc 1 297 613 view .LVU594
+	movq	$128, 72(%rsp)
+	movb	$1, 112(%rsp)
+.LVL136:
+.LBB334:
+.LBI331:
+	.loc 2 299 28 is_stmt 1 view .LVU595
+.LBB333:
+	.loc 2 304 5 view .LVU596
+	.loc 2 304 12 is_stmt 0 view .LVU597
+	movq	%rax, 16(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU598
+.LVL137:
+	.loc 2 305 5 is_stmt 0 view .LVU599
+.LBE333:
+.LBE334:
+	.loc 1 297 34 view .LVU600
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL138:
+	.loc 1 297 37 view .LVU601
+	leaq	120(%rsp), %rdi
+	movl	$30, %ecx
+	.loc 1 297 34 view .LVU602
+	movq	%rax, %rsi
+	.loc 1 297 37 view .LVU603
+	rep movsl
+.LBE336:
+	.loc 1 297 17 view .LVU604
+	leaq	120(%rsp), %rsi
+	movq	%rbx, %rdi
+	movl	$30, %ecx
+	rep movsl
+	.loc 1 298 1 is_stmt 1 view .LVU605
+	movq	64(%rsp), %rdi
+	call	puts@PLT
+.LVL139:
+	.loc 1 299 1 view .LVU606
+	movq	%rbx, %rdi
+	call	va_vec_free@PLT
+.LVL140:
+	.loc 1 300 1 is_stmt 0 view .LVU607
+	addq	$368, %rsp
+	.cfi_def_cfa_offset 16
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	testfunc26, .-testfunc26
+	.section	.rodata.str1.1
+.LC12:
+	.string	"bar~u"
+.LC13:
+	.string	"~s: ~s\n"
+	.text
+	.globl	testfunc28
+	.type	testfunc28, @function
+testfunc28:
+.LFB25:
+	.loc 1 314 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 315 1 view .LVU609
+.LBB337:
+	.loc 1 315 5 view .LVU610
+	.loc 1 315 29 view .LVU611
+.LBE337:
+	.loc 1 314 23 is_stmt 0 view .LVU612
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+.LBB352:
+	.loc 1 315 46 view .LVU613
+	xorl	%eax, %eax
+	movl	$24, %ecx
+	.loc 1 315 575 view .LVU614
+	leaq	va_vec_vtab_utf8(%rip), %r12
+.LBE352:
+	.loc 1 314 23 view .LVU615
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB353:
+.LBB338:
+.LBB339:
+	.loc 2 304 12 view .LVU616
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbx
+.LBE339:
+.LBE338:
+.LBE353:
+	.loc 1 314 23 view .LVU617
+	subq	$368, %rsp
+	.cfi_def_cfa_offset 400
+.LBB354:
+	.loc 1 315 46 view .LVU618
+	leaq	16(%rsp), %rdi
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 315 575 view .LVU619
+	movq	%r12, %rdi
+	.loc 1 315 79 view .LVU620
+	movb	$1, 104(%rsp)
+	.loc 1 315 46 view .LVU621
+	movq	%rax, 8(%rsp)
+	movq	stdout(%rip), %rax
+	movq	$256, 88(%rsp)
+	.loc 1 315 58 is_stmt 1 view .LVU622
+	.loc 1 315 3 view .LVU623
+	.loc 1 315 46 is_stmt 0 view .LVU624
+	movq	%rax, 72(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 80(%rsp)
+	.loc 1 315 575 view .LVU625
+	call	va_tmp_vec@PLT
+.LVL141:
+	.loc 1 315 1056 view .LVU626
+	movl	$42, %esi
+.LBB342:
+.LBB340:
+	.loc 2 304 12 view .LVU627
+	movq	%rbx, 8(%rax)
+.LBE340:
+.LBE342:
+	.loc 1 315 575 view .LVU628
+	movq	%rax, %rdi
+.LVL142:
+.LBB343:
+.LBI338:
+	.loc 2 299 28 is_stmt 1 view .LVU629
+.LBB341:
+	.loc 2 304 5 view .LVU630
+	.loc 2 304 12 is_stmt 0 view .LVU631
+	leaq	.LC12(%rip), %rax
+.LVL143:
+	.loc 2 304 12 view .LVU632
+	movq	%rax, 16(%rdi)
+	.loc 2 305 5 is_stmt 1 view .LVU633
+.LVL144:
+	.loc 2 305 5 is_stmt 0 view .LVU634
+.LBE341:
+.LBE343:
+	.loc 1 315 1056 view .LVU635
+	call	va_xprintf_last_sint@PLT
+.LVL145:
+	.loc 1 315 575 view .LVU636
+	movq	%r12, %rdi
+	.loc 1 315 982 view .LVU637
+	movq	64(%rax), %rbp
+	.loc 1 315 575 view .LVU638
+	call	va_tmp_vec@PLT
+.LVL146:
+	.loc 1 315 946 view .LVU639
+	leaq	msg(%rip), %rsi
+.LBB344:
+.LBB345:
+	.loc 2 304 12 view .LVU640
+	movq	%rbx, 8(%rax)
+.LBE345:
+.LBE344:
+	.loc 1 315 575 view .LVU641
+	movq	%rax, %rdi
+.LVL147:
+.LBB347:
+.LBI344:
+	.loc 2 299 28 is_stmt 1 view .LVU642
+.LBB346:
+	.loc 2 304 5 view .LVU643
+	.loc 2 304 12 is_stmt 0 view .LVU644
+	leaq	.LC3(%rip), %rax
+.LVL148:
+	.loc 2 304 12 view .LVU645
+	movq	%rax, 16(%rdi)
+	.loc 2 305 5 is_stmt 1 view .LVU646
+.LVL149:
+	.loc 2 305 5 is_stmt 0 view .LVU647
+.LBE346:
+.LBE347:
+	.loc 1 315 946 view .LVU648
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL150:
+	.loc 1 315 36 view .LVU649
+	leaq	8(%rsp), %rdi
+.LBB348:
+.LBB349:
+	.loc 2 304 12 view .LVU650
+	movq	%rbx, 16(%rsp)
+.LBE349:
+.LBE348:
+	.loc 1 315 983 view .LVU651
+	movq	64(%rax), %rsi
+.LVL151:
+.LBB351:
+.LBI348:
+	.loc 2 299 28 is_stmt 1 view .LVU652
+.LBB350:
+	.loc 2 304 5 view .LVU653
+	.loc 2 304 12 is_stmt 0 view .LVU654
+	leaq	.LC13(%rip), %rax
+	movq	%rax, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU655
+.LVL152:
+	.loc 2 305 5 is_stmt 0 view .LVU656
+.LBE350:
+.LBE351:
+	.loc 1 315 36 view .LVU657
+	call	va_xprintf_char_p_utf8@PLT
+.LVL153:
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL154:
+.LBE354:
+	.loc 1 315 3 is_stmt 1 view .LVU658
+	.loc 1 316 1 view .LVU659
+	.loc 1 317 1 is_stmt 0 view .LVU660
+	addq	$368, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	.loc 1 316 1 view .LVU661
+	jmp	va_tprintf_free@PLT
+.LVL155:
+	.cfi_endproc
+.LFE25:
+	.size	testfunc28, .-testfunc28
+	.globl	testfunc30
+	.type	testfunc30, @function
+testfunc30:
+.LFB26:
+	.loc 1 321 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 322 1 view .LVU663
+	.loc 1 321 23 is_stmt 0 view .LVU664
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 322 17 view .LVU665
+	xorl	%eax, %eax
+	movl	$28, %ecx
+	.loc 1 323 157 view .LVU666
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbp
+	.loc 1 321 23 view .LVU667
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	.loc 1 323 157 view .LVU668
+	movq	%rbp, %rdx
+	leaq	.LC6(%rip), %rsi
+	.loc 1 321 23 view .LVU669
+	subq	$136, %rsp
+	.cfi_def_cfa_offset 160
+	.loc 1 322 17 view .LVU670
+	leaq	16(%rsp), %rdi
+	.loc 1 323 157 view .LVU671
+	leaq	8(%rsp), %rbx
+	.loc 1 322 17 view .LVU672
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 323 157 view .LVU673
+	movq	%rbx, %rdi
+	.loc 1 322 17 view .LVU674
+	movq	$16, 80(%rsp)
+	movq	%rax, 8(%rsp)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 96(%rsp)
+	.loc 1 323 1 is_stmt 1 view .LVU675
+	.loc 1 323 5 view .LVU676
+	.loc 1 323 157 is_stmt 0 view .LVU677
+	call	va_xprintf_init_last_plain@PLT
+.LVL156:
+	.loc 1 323 3 is_stmt 1 view .LVU678
+	.loc 1 324 1 view .LVU679
+	.loc 1 324 5 view .LVU680
+.LBB355:
+.LBI355:
+	.loc 2 299 28 view .LVU681
+.LBB356:
+	.loc 2 304 5 view .LVU682
+	.loc 2 304 12 is_stmt 0 view .LVU683
+	leaq	.LC7(%rip), %rax
+.LBE356:
+.LBE355:
+	.loc 1 324 34 view .LVU684
+	movq	%rbx, %rdi
+	movl	$55, %esi
+.LBB358:
+.LBB357:
+	.loc 2 304 12 view .LVU685
+	movq	%rbp, 16(%rsp)
+	movq	%rax, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU686
+.LVL157:
+	.loc 2 305 5 is_stmt 0 view .LVU687
+.LBE357:
+.LBE358:
+	.loc 1 324 34 view .LVU688
+	call	va_xprintf_last_sint@PLT
+.LVL158:
+	.loc 1 324 3 is_stmt 1 view .LVU689
+	.loc 1 325 1 is_stmt 0 view .LVU690
+	addq	$136, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	testfunc30, .-testfunc30
+	.section	.rodata.str1.1
+.LC14:
+	.string	"line ~u: "
+.LC15:
+	.string	"~s"
+.LC16:
+	.string	"~s\n"
+	.text
+	.globl	testfunc32
+	.type	testfunc32, @function
+testfunc32:
+.LFB27:
+	.loc 1 339 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 340 1 view .LVU692
+	.loc 1 339 23 is_stmt 0 view .LVU693
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 340 17 view .LVU694
+	xorl	%eax, %eax
+	movl	$28, %ecx
+	.loc 1 342 1 view .LVU695
+	movl	$200, %esi
+	.loc 1 339 23 view .LVU696
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB359:
+.LBB360:
+.LBB361:
+	.loc 2 304 12 view .LVU697
+	leaq	va_char_p_read_vtab_utf8(%rip), %r12
+.LBE361:
+.LBE360:
+	.loc 1 343 10 view .LVU698
+	xorl	%ebp, %ebp
+.LBE359:
+	.loc 1 339 23 view .LVU699
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$496, %rsp
+	.cfi_def_cfa_offset 528
+	.loc 1 340 17 view .LVU700
+	leaq	128(%rsp), %rdi
+	.loc 1 342 1 view .LVU701
+	leaq	120(%rsp), %rbx
+	.loc 1 340 17 view .LVU702
+	rep stosl
+	leaq	va_vec_vtab_utf8(%rip), %rax
+	.loc 1 342 1 view .LVU703
+	movq	%rbx, %rdi
+	.loc 1 340 17 view .LVU704
+	movq	$16, 192(%rsp)
+	movq	%rax, 120(%rsp)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	%rax, 208(%rsp)
+	.loc 1 341 1 is_stmt 1 view .LVU705
+	.loc 1 342 1 view .LVU706
+	call	va_vec_reserve@PLT
+.LVL159:
+	.loc 1 343 1 view .LVU707
+.LBB377:
+	.loc 1 343 6 view .LVU708
+	.loc 1 343 19 view .LVU709
+.L52:
+	.loc 1 344 5 discriminator 3 view .LVU710
+	movq	%rbx, %rdi
+	call	va_vec_clear@PLT
+.LVL160:
+	.loc 1 345 5 discriminator 3 view .LVU711
+	.loc 1 345 9 discriminator 3 view .LVU712
+.LBB365:
+.LBI360:
+	.loc 2 299 28 discriminator 3 view .LVU713
+.LBB362:
+	.loc 2 304 5 discriminator 3 view .LVU714
+.LBE362:
+.LBE365:
+	.loc 1 345 33 is_stmt 0 discriminator 3 view .LVU715
+	movl	%ebp, %esi
+	movq	%rbx, %rdi
+.LBB366:
+.LBB363:
+	.loc 2 304 12 discriminator 3 view .LVU716
+	leaq	.LC14(%rip), %rax
+	movq	%r12, 128(%rsp)
+.LBE363:
+.LBE366:
+	.loc 1 343 26 discriminator 3 view .LVU717
+	incl	%ebp
+.LVL161:
+.LBB367:
+.LBB364:
+	.loc 2 304 12 discriminator 3 view .LVU718
+	movq	%rax, 136(%rsp)
+	.loc 2 305 5 is_stmt 1 discriminator 3 view .LVU719
+.LVL162:
+	.loc 2 305 5 is_stmt 0 discriminator 3 view .LVU720
+.LBE364:
+.LBE367:
+	.loc 1 345 33 discriminator 3 view .LVU721
+	call	va_xprintf_last_sint@PLT
+.LVL163:
+	.loc 1 345 7 is_stmt 1 discriminator 3 view .LVU722
+	.loc 1 346 5 discriminator 3 view .LVU723
+	.loc 1 346 9 discriminator 3 view .LVU724
+.LBB368:
+.LBI368:
+	.loc 2 299 28 discriminator 3 view .LVU725
+.LBB369:
+	.loc 2 304 5 discriminator 3 view .LVU726
+	.loc 2 304 12 is_stmt 0 discriminator 3 view .LVU727
+	leaq	.LC15(%rip), %rax
+.LBE369:
+.LBE368:
+	.loc 1 346 33 discriminator 3 view .LVU728
+	movq	%rbx, %rdi
+	leaq	msg(%rip), %rsi
+.LBB371:
+.LBB370:
+	.loc 2 304 12 discriminator 3 view .LVU729
+	movq	%r12, 128(%rsp)
+	movq	%rax, 136(%rsp)
+	.loc 2 305 5 is_stmt 1 discriminator 3 view .LVU730
+.LVL164:
+	.loc 2 305 5 is_stmt 0 discriminator 3 view .LVU731
+.LBE370:
+.LBE371:
+	.loc 1 346 33 discriminator 3 view .LVU732
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL165:
+	.loc 1 346 7 is_stmt 1 discriminator 3 view .LVU733
+	.loc 1 347 5 discriminator 3 view .LVU734
+.LBB372:
+	.loc 1 347 9 discriminator 3 view .LVU735
+	.loc 1 347 33 discriminator 3 view .LVU736
+	.loc 1 347 50 is_stmt 0 discriminator 3 view .LVU737
+	xorl	%eax, %eax
+	leaq	24(%rsp), %rdi
+	.loc 1 347 960 discriminator 3 view .LVU738
+	movq	%rsp, %rsi
+	.loc 1 347 50 discriminator 3 view .LVU739
+	movl	$24, %ecx
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 347 960 discriminator 3 view .LVU740
+	movq	%rbx, %rdi
+	.loc 1 347 82 discriminator 3 view .LVU741
+	movb	$1, 112(%rsp)
+	.loc 1 347 50 discriminator 3 view .LVU742
+	movq	%rax, 16(%rsp)
+	movq	stdout(%rip), %rax
+	movq	$256, 96(%rsp)
+	.loc 1 347 61 is_stmt 1 discriminator 3 view .LVU743
+	.loc 1 347 6 discriminator 3 view .LVU744
+	.loc 1 347 50 is_stmt 0 discriminator 3 view .LVU745
+	movq	%rax, 80(%rsp)
+	leaq	240(%rsp), %rax
+	movq	%rax, 88(%rsp)
+	.loc 1 347 960 discriminator 3 view .LVU746
+	call	va_vec_span@PLT
+.LVL166:
+	.loc 1 347 39 discriminator 3 view .LVU747
+	leaq	16(%rsp), %rdi
+.LBB373:
+.LBB374:
+	.loc 2 304 12 discriminator 3 view .LVU748
+	movq	%r12, 24(%rsp)
+.LBE374:
+.LBE373:
+	.loc 1 347 960 discriminator 3 view .LVU749
+	movq	%rax, %rsi
+.LVL167:
+.LBB376:
+.LBI373:
+	.loc 2 299 28 is_stmt 1 discriminator 3 view .LVU750
+.LBB375:
+	.loc 2 304 5 discriminator 3 view .LVU751
+	.loc 2 304 12 is_stmt 0 discriminator 3 view .LVU752
+	leaq	.LC16(%rip), %rax
+	movq	%rax, 32(%rsp)
+	.loc 2 305 5 is_stmt 1 discriminator 3 view .LVU753
+.LVL168:
+	.loc 2 305 5 is_stmt 0 discriminator 3 view .LVU754
+.LBE375:
+.LBE376:
+	.loc 1 347 39 discriminator 3 view .LVU755
+	call	va_xprintf_last_span_p_utf8@PLT
+.LVL169:
+.LBE372:
+	.loc 1 347 7 is_stmt 1 discriminator 3 view .LVU756
+	.loc 1 343 26 discriminator 3 view .LVU757
+	.loc 1 343 19 discriminator 3 view .LVU758
+	cmpl	$10, %ebp
+	jne	.L52
+.LBE377:
+	.loc 1 349 1 view .LVU759
+	movq	%rbx, %rdi
+	movl	$1000, %esi
+	call	va_vec_shrink@PLT
+.LVL170:
+	.loc 1 350 1 view .LVU760
+	movq	%rbx, %rdi
+	call	va_vec_free@PLT
+.LVL171:
+	.loc 1 351 1 is_stmt 0 view .LVU761
+	addq	$496, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL172:
+	.loc 1 351 1 view .LVU762
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	testfunc32, .-testfunc32
+	.globl	testfunc34
+	.type	testfunc34, @function
+testfunc34:
+.LFB51:
+	.cfi_startproc
+	.loc 1 356 6 is_stmt 1 view .LVU763
+	ret
+	.cfi_endproc
+.LFE51:
+	.size	testfunc34, .-testfunc34
+	.globl	testfunc35
+	.type	testfunc35, @function
+testfunc35:
+.LFB29:
+	.loc 1 363 23 view -0
+	.cfi_startproc
+	.loc 1 364 1 view .LVU765
+.LBB378:
+	.loc 1 364 5 view .LVU766
+	.loc 1 364 29 view .LVU767
+.LBE378:
+	.loc 1 363 23 is_stmt 0 view .LVU768
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 384
+.LBB383:
+	.loc 1 364 46 view .LVU769
+	xorl	%eax, %eax
+	movl	$20, %ecx
+	leaq	32(%rsp), %rdi
+	.loc 1 364 36 view .LVU770
+	leaq	msg(%rip), %rsi
+	.loc 1 364 46 view .LVU771
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 364 36 view .LVU772
+	leaq	8(%rsp), %rdi
+	.loc 1 364 46 view .LVU773
+	movq	$256, 88(%rsp)
+	.loc 1 364 58 is_stmt 1 view .LVU774
+	.loc 1 364 46 is_stmt 0 view .LVU775
+	movq	%rax, 8(%rsp)
+	movq	stderr(%rip), %rax
+	.loc 1 364 79 view .LVU776
+	movb	$1, 104(%rsp)
+	.loc 1 364 3 is_stmt 1 view .LVU777
+.LVL173:
+.LBB379:
+.LBI379:
+	.loc 2 299 28 view .LVU778
+.LBB380:
+	.loc 2 304 5 view .LVU779
+.LBE380:
+.LBE379:
+	.loc 1 364 46 is_stmt 0 view .LVU780
+	movq	%rax, 72(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 80(%rsp)
+.LBB382:
+.LBB381:
+	.loc 2 304 12 view .LVU781
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 16(%rsp)
+	leaq	.LC3(%rip), %rax
+	movq	%rax, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU782
+.LVL174:
+	.loc 2 305 5 is_stmt 0 view .LVU783
+.LBE381:
+.LBE382:
+	.loc 1 364 36 view .LVU784
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL175:
+.LBE383:
+	.loc 1 364 3 is_stmt 1 view .LVU785
+	.loc 1 365 1 is_stmt 0 view .LVU786
+	addq	$376, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	testfunc35, .-testfunc35
+	.globl	testfunc37
+	.type	testfunc37, @function
+testfunc37:
+.LFB30:
+	.loc 1 370 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 371 1 view .LVU788
+.LBB384:
+	.loc 1 371 5 view .LVU789
+	.loc 1 371 29 view .LVU790
+.LBE384:
+	.loc 1 370 23 is_stmt 0 view .LVU791
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+.LBB393:
+	.loc 1 371 46 view .LVU792
+	movl	$20, %ecx
+.LBE393:
+	.loc 1 370 23 view .LVU793
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+.LBB394:
+.LBB385:
+.LBB386:
+	.loc 2 304 12 view .LVU794
+	leaq	va_char_p_read_vtab_utf8(%rip), %r14
+.LBE386:
+.LBE385:
+.LBE394:
+	.loc 1 370 23 view .LVU795
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+.LBB395:
+.LBB390:
+.LBB387:
+	.loc 2 304 12 view .LVU796
+	leaq	.LC3(%rip), %r13
+.LBE387:
+.LBE390:
+.LBE395:
+	.loc 1 370 23 view .LVU797
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+.LBB396:
+	.loc 1 371 36 view .LVU798
+	leaq	msg(%rip), %r12
+.LBE396:
+	.loc 1 370 23 view .LVU799
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+.LBB397:
+	.loc 1 371 46 view .LVU800
+	xorl	%ebp, %ebp
+	.loc 1 371 36 view .LVU801
+	movq	%r12, %rsi
+.LBE397:
+	.loc 1 370 23 view .LVU802
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+.LBB398:
+	.loc 1 371 46 view .LVU803
+	movl	%ebp, %eax
+	leaq	va_file_vtab_utf8(%rip), %rbx
+.LBE398:
+	.loc 1 370 23 view .LVU804
+	subq	$392, %rsp
+	.cfi_def_cfa_offset 448
+.LBB399:
+	.loc 1 371 46 view .LVU805
+	leaq	48(%rsp), %rdi
+	leaq	128(%rsp), %r15
+	rep stosl
+	movq	stdout(%rip), %rax
+	movq	%rbx, 24(%rsp)
+	movq	%r15, 96(%rsp)
+	movq	%rax, 88(%rsp)
+	.loc 1 371 36 view .LVU806
+	leaq	24(%rsp), %rax
+	movq	%rax, %rdi
+.LBB391:
+.LBB388:
+	.loc 2 304 12 view .LVU807
+	movq	%r14, 32(%rsp)
+	movq	%r13, 40(%rsp)
+.LBE388:
+.LBE391:
+	.loc 1 371 46 view .LVU808
+	movq	$256, 104(%rsp)
+	.loc 1 371 58 is_stmt 1 view .LVU809
+	.loc 1 371 79 is_stmt 0 view .LVU810
+	movb	$1, 120(%rsp)
+	.loc 1 371 3 is_stmt 1 view .LVU811
+.LVL176:
+.LBB392:
+.LBI385:
+	.loc 2 299 28 view .LVU812
+.LBB389:
+	.loc 2 304 5 view .LVU813
+	.loc 2 305 5 view .LVU814
+	.loc 2 305 5 is_stmt 0 view .LVU815
+.LBE389:
+.LBE392:
+	.loc 1 371 36 view .LVU816
+	movq	%rax, 8(%rsp)
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL177:
+.LBE399:
+	.loc 1 371 3 is_stmt 1 view .LVU817
+	.loc 1 372 1 view .LVU818
+.LBB400:
+	.loc 1 372 5 view .LVU819
+	.loc 1 372 29 view .LVU820
+	.loc 1 372 46 is_stmt 0 view .LVU821
+	movl	%ebp, %eax
+	leaq	48(%rsp), %rdi
+	.loc 1 372 36 view .LVU822
+	movq	%r12, %rsi
+	.loc 1 372 46 view .LVU823
+	movl	$20, %ecx
+	rep stosl
+	movq	stderr(%rip), %rax
+	.loc 1 372 36 view .LVU824
+	movq	8(%rsp), %rdi
+	.loc 1 372 46 view .LVU825
+	movq	%rbx, 24(%rsp)
+	movq	%r15, 96(%rsp)
+.LBB401:
+.LBB402:
+	.loc 2 304 12 view .LVU826
+	movq	%r14, 32(%rsp)
+	movq	%r13, 40(%rsp)
+.LBE402:
+.LBE401:
+	.loc 1 372 46 view .LVU827
+	movq	%rax, 88(%rsp)
+	movq	$256, 104(%rsp)
+	.loc 1 372 58 is_stmt 1 view .LVU828
+	.loc 1 372 79 is_stmt 0 view .LVU829
+	movb	$1, 120(%rsp)
+	.loc 1 372 3 is_stmt 1 view .LVU830
+.LVL178:
+.LBB404:
+.LBI401:
+	.loc 2 299 28 view .LVU831
+.LBB403:
+	.loc 2 304 5 view .LVU832
+	.loc 2 305 5 view .LVU833
+	.loc 2 305 5 is_stmt 0 view .LVU834
+.LBE403:
+.LBE404:
+	.loc 1 372 36 view .LVU835
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL179:
+.LBE400:
+	.loc 1 372 3 is_stmt 1 view .LVU836
+	.loc 1 373 1 is_stmt 0 view .LVU837
+	addq	$392, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	testfunc37, .-testfunc37
+	.globl	testfunc39
+	.type	testfunc39, @function
+testfunc39:
+.LFB31:
+	.loc 1 382 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 383 1 view .LVU839
+	.loc 1 382 23 is_stmt 0 view .LVU840
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 383 18 view .LVU841
+	movl	$24, %ecx
+	leaq	va_file_vtab_utf8(%rip), %r15
+	.loc 1 382 23 view .LVU842
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+.LBB405:
+.LBB406:
+	.loc 2 304 12 view .LVU843
+	leaq	.LC7(%rip), %r14
+.LBE406:
+.LBE405:
+	.loc 1 382 23 view .LVU844
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	.loc 1 383 18 view .LVU845
+	xorl	%r13d, %r13d
+	.loc 1 382 23 view .LVU846
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 383 18 view .LVU847
+	movl	%r13d, %eax
+	.loc 1 384 157 view .LVU848
+	leaq	.LC6(%rip), %r12
+	.loc 1 382 23 view .LVU849
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 384 157 view .LVU850
+	movq	%r12, %rsi
+	.loc 1 382 23 view .LVU851
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 384 157 view .LVU852
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbx
+	movq	%rbx, %rdx
+	.loc 1 382 23 view .LVU853
+	subq	$296, %rsp
+	.cfi_def_cfa_offset 352
+	.loc 1 383 18 view .LVU854
+	leaq	88(%rsp), %rdi
+	.loc 1 384 157 view .LVU855
+	leaq	80(%rsp), %rbp
+	.loc 1 383 18 view .LVU856
+	movq	%r15, 80(%rsp)
+	rep stosl
+	movq	stderr(%rip), %rax
+	.loc 1 384 157 view .LVU857
+	movq	%rbp, %rdi
+	.loc 1 383 18 view .LVU858
+	movq	%rax, 144(%rsp)
+	.loc 1 384 1 is_stmt 1 view .LVU859
+	.loc 1 384 5 view .LVU860
+	.loc 1 384 157 is_stmt 0 view .LVU861
+	call	va_xprintf_init_last_plain@PLT
+.LVL180:
+	.loc 1 384 3 is_stmt 1 view .LVU862
+	.loc 1 385 1 view .LVU863
+	.loc 1 385 5 view .LVU864
+.LBB409:
+.LBI405:
+	.loc 2 299 28 view .LVU865
+.LBB407:
+	.loc 2 304 5 view .LVU866
+.LBE407:
+.LBE409:
+	.loc 1 385 34 is_stmt 0 view .LVU867
+	movq	%rbp, %rdi
+	movl	$55, %esi
+.LBB410:
+.LBB408:
+	.loc 2 304 12 view .LVU868
+	movq	%rbx, 88(%rsp)
+	movq	%r14, 96(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU869
+.LVL181:
+	.loc 2 305 5 is_stmt 0 view .LVU870
+.LBE408:
+.LBE410:
+	.loc 1 385 34 view .LVU871
+	call	va_xprintf_last_sint@PLT
+.LVL182:
+	.loc 1 385 3 is_stmt 1 view .LVU872
+	.loc 1 386 1 view .LVU873
+	.loc 1 386 5 view .LVU874
+	.loc 1 386 301 is_stmt 0 view .LVU875
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	leaq	.LC8(%rip), %rsi
+	call	va_xprintf_init_last_plain@PLT
+.LVL183:
+	.loc 1 386 3 is_stmt 1 view .LVU876
+	.loc 1 401 1 view .LVU877
+	.loc 1 402 1 view .LVU878
+	.loc 1 402 49 is_stmt 0 view .LVU879
+	movl	%r13d, %eax
+	movl	$24, %ecx
+	.loc 1 403 157 view .LVU880
+	movq	%rbx, %rdx
+	.loc 1 402 49 view .LVU881
+	leaq	192(%rsp), %rdi
+	.loc 1 403 157 view .LVU882
+	leaq	184(%rsp), %rbp
+	movq	%r12, %rsi
+	.loc 1 402 49 view .LVU883
+	movq	%r15, 184(%rsp)
+	rep stosl
+	movq	stderr(%rip), %rax
+	.loc 1 403 157 view .LVU884
+	movq	%rbp, %rdi
+	.loc 1 402 49 view .LVU885
+	movq	$80, 264(%rsp)
+.LVL184:
+	.loc 1 403 1 is_stmt 1 view .LVU886
+	.loc 1 403 5 view .LVU887
+	.loc 1 402 49 is_stmt 0 view .LVU888
+	movq	%rax, 248(%rsp)
+	movq	%rsp, %rax
+	movq	%rax, 256(%rsp)
+	.loc 1 403 157 view .LVU889
+	call	va_xprintf_init_last_plain@PLT
+.LVL185:
+	.loc 1 403 3 is_stmt 1 view .LVU890
+	.loc 1 404 1 view .LVU891
+	.loc 1 404 5 view .LVU892
+.LBB411:
+.LBI411:
+	.loc 2 299 28 view .LVU893
+.LBB412:
+	.loc 2 304 5 view .LVU894
+.LBE412:
+.LBE411:
+	.loc 1 404 34 is_stmt 0 view .LVU895
+	movq	%rbp, %rdi
+	movl	$55, %esi
+.LBB414:
+.LBB413:
+	.loc 2 304 12 view .LVU896
+	movq	%rbx, 192(%rsp)
+	movq	%r14, 200(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU897
+.LVL186:
+	.loc 2 305 5 is_stmt 0 view .LVU898
+.LBE413:
+.LBE414:
+	.loc 1 404 34 view .LVU899
+	call	va_xprintf_last_sint@PLT
+.LVL187:
+	.loc 1 404 3 is_stmt 1 view .LVU900
+	.loc 1 405 1 view .LVU901
+	movq	%rbp, %rdi
+	call	va_file_flush@PLT
+.LVL188:
+	.loc 1 406 1 is_stmt 0 view .LVU902
+	addq	$296, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL189:
+	.loc 1 406 1 view .LVU903
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	testfunc39, .-testfunc39
+	.globl	testfunc43
+	.type	testfunc43, @function
+testfunc43:
+.LFB53:
+	.cfi_startproc
+	.loc 1 412 6 is_stmt 1 view .LVU904
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	testfunc43, .-testfunc43
+	.globl	testfunc44
+	.type	testfunc44, @function
+testfunc44:
+.LFB33:
+	.loc 1 419 23 view -0
+	.cfi_startproc
+	.loc 1 420 1 view .LVU906
+.LBB415:
+	.loc 1 420 5 view .LVU907
+	.loc 1 420 27 view .LVU908
+.LBE415:
+	.loc 1 419 23 is_stmt 0 view .LVU909
+	subq	$632, %rsp
+	.cfi_def_cfa_offset 640
+.LBB420:
+	.loc 1 420 42 view .LVU910
+	xorl	%eax, %eax
+	movl	$22, %ecx
+	leaq	24(%rsp), %rdi
+	.loc 1 420 34 view .LVU911
+	leaq	msg(%rip), %rsi
+	.loc 1 420 42 view .LVU912
+	rep stosl
+	leaq	va_fd_vtab_utf8(%rip), %rax
+	.loc 1 420 34 view .LVU913
+	movq	%rsp, %rdi
+	.loc 1 420 208 view .LVU914
+	movb	$1, 104(%rsp)
+	.loc 1 420 42 view .LVU915
+	movq	%rax, (%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 72(%rsp)
+.LBB416:
+.LBB417:
+	.loc 2 304 12 view .LVU916
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 8(%rsp)
+	leaq	.LC3(%rip), %rax
+.LBE417:
+.LBE416:
+	.loc 1 420 42 view .LVU917
+	movq	$2, 64(%rsp)
+	movq	$512, 80(%rsp)
+	.loc 1 420 189 is_stmt 1 view .LVU918
+	.loc 1 420 3 view .LVU919
+.LVL190:
+.LBB419:
+.LBI416:
+	.loc 2 299 28 view .LVU920
+.LBB418:
+	.loc 2 304 5 view .LVU921
+	.loc 2 304 12 is_stmt 0 view .LVU922
+	movq	%rax, 16(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU923
+.LVL191:
+	.loc 2 305 5 is_stmt 0 view .LVU924
+.LBE418:
+.LBE419:
+	.loc 1 420 34 view .LVU925
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL192:
+.LBE420:
+	.loc 1 420 3 is_stmt 1 view .LVU926
+	.loc 1 421 1 is_stmt 0 view .LVU927
+	addq	$632, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	testfunc44, .-testfunc44
+	.globl	testfunc46
+	.type	testfunc46, @function
+testfunc46:
+.LFB34:
+	.loc 1 430 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 431 1 view .LVU929
+	.loc 1 430 23 is_stmt 0 view .LVU930
+	pushq	%r15
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	.loc 1 431 16 view .LVU931
+	movl	$26, %ecx
+	leaq	va_fd_vtab_utf8(%rip), %r15
+	.loc 1 430 23 view .LVU932
+	pushq	%r14
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+.LBB421:
+.LBB422:
+	.loc 2 304 12 view .LVU933
+	leaq	.LC7(%rip), %r14
+.LBE422:
+.LBE421:
+	.loc 1 430 23 view .LVU934
+	pushq	%r13
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	.loc 1 431 16 view .LVU935
+	xorl	%r13d, %r13d
+	.loc 1 430 23 view .LVU936
+	pushq	%r12
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	.loc 1 431 16 view .LVU937
+	movl	%r13d, %eax
+	.loc 1 432 157 view .LVU938
+	leaq	.LC6(%rip), %r12
+	.loc 1 430 23 view .LVU939
+	pushq	%rbp
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	.loc 1 432 157 view .LVU940
+	movq	%r12, %rsi
+	.loc 1 430 23 view .LVU941
+	pushq	%rbx
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	.loc 1 432 157 view .LVU942
+	leaq	va_char_p_read_vtab_utf8(%rip), %rbx
+	movq	%rbx, %rdx
+	.loc 1 430 23 view .LVU943
+	subq	$312, %rsp
+	.cfi_def_cfa_offset 368
+	.loc 1 432 157 view .LVU944
+	leaq	80(%rsp), %rbp
+	.loc 1 431 16 view .LVU945
+	leaq	88(%rsp), %rdi
+	movq	%r15, 80(%rsp)
+	rep stosl
+	.loc 1 432 157 view .LVU946
+	movq	%rbp, %rdi
+	.loc 1 431 16 view .LVU947
+	movq	$2, 144(%rsp)
+	.loc 1 432 1 is_stmt 1 view .LVU948
+	.loc 1 432 5 view .LVU949
+	.loc 1 432 157 is_stmt 0 view .LVU950
+	call	va_xprintf_init_last_plain@PLT
+.LVL193:
+	.loc 1 432 3 is_stmt 1 view .LVU951
+	.loc 1 433 1 view .LVU952
+	.loc 1 433 5 view .LVU953
+.LBB425:
+.LBI421:
+	.loc 2 299 28 view .LVU954
+.LBB423:
+	.loc 2 304 5 view .LVU955
+.LBE423:
+.LBE425:
+	.loc 1 433 34 is_stmt 0 view .LVU956
+	movq	%rbp, %rdi
+	movl	$55, %esi
+.LBB426:
+.LBB424:
+	.loc 2 304 12 view .LVU957
+	movq	%rbx, 88(%rsp)
+	movq	%r14, 96(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU958
+.LVL194:
+	.loc 2 305 5 is_stmt 0 view .LVU959
+.LBE424:
+.LBE426:
+	.loc 1 433 34 view .LVU960
+	call	va_xprintf_last_sint@PLT
+.LVL195:
+	.loc 1 433 3 is_stmt 1 view .LVU961
+	.loc 1 434 1 view .LVU962
+	.loc 1 434 5 view .LVU963
+	.loc 1 434 301 is_stmt 0 view .LVU964
+	movq	%rbx, %rdx
+	movq	%rbp, %rdi
+	leaq	.LC8(%rip), %rsi
+	call	va_xprintf_init_last_plain@PLT
+.LVL196:
+	.loc 1 434 3 is_stmt 1 view .LVU965
+	.loc 1 452 1 view .LVU966
+	.loc 1 453 1 view .LVU967
+	.loc 1 453 45 is_stmt 0 view .LVU968
+	movl	%r13d, %eax
+	movl	$26, %ecx
+	.loc 1 454 157 view .LVU969
+	movq	%rbx, %rdx
+	leaq	192(%rsp), %rbp
+	.loc 1 453 45 view .LVU970
+	leaq	200(%rsp), %rdi
+	.loc 1 454 157 view .LVU971
+	movq	%r12, %rsi
+	.loc 1 453 45 view .LVU972
+	movq	%r15, 192(%rsp)
+	rep stosl
+	movq	%rsp, %rax
+	.loc 1 454 157 view .LVU973
+	movq	%rbp, %rdi
+	.loc 1 453 45 view .LVU974
+	movq	$2, 256(%rsp)
+	movq	%rax, 264(%rsp)
+	movq	$80, 272(%rsp)
+.LVL197:
+	.loc 1 454 1 is_stmt 1 view .LVU975
+	.loc 1 454 5 view .LVU976
+	.loc 1 454 157 is_stmt 0 view .LVU977
+	call	va_xprintf_init_last_plain@PLT
+.LVL198:
+	.loc 1 454 3 is_stmt 1 view .LVU978
+	.loc 1 455 1 view .LVU979
+	.loc 1 455 5 view .LVU980
+.LBB427:
+.LBI427:
+	.loc 2 299 28 view .LVU981
+.LBB428:
+	.loc 2 304 5 view .LVU982
+.LBE428:
+.LBE427:
+	.loc 1 455 34 is_stmt 0 view .LVU983
+	movq	%rbp, %rdi
+	movl	$55, %esi
+.LBB430:
+.LBB429:
+	.loc 2 304 12 view .LVU984
+	movq	%rbx, 200(%rsp)
+	movq	%r14, 208(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU985
+.LVL199:
+	.loc 2 305 5 is_stmt 0 view .LVU986
+.LBE429:
+.LBE430:
+	.loc 1 455 34 view .LVU987
+	call	va_xprintf_last_sint@PLT
+.LVL200:
+	.loc 1 455 3 is_stmt 1 view .LVU988
+	.loc 1 456 1 view .LVU989
+	movq	%rbp, %rdi
+	call	va_fd_flush@PLT
+.LVL201:
+	.loc 1 457 1 is_stmt 0 view .LVU990
+	addq	$312, %rsp
+	.cfi_def_cfa_offset 56
+	popq	%rbx
+	.cfi_def_cfa_offset 48
+	popq	%rbp
+	.cfi_def_cfa_offset 40
+.LVL202:
+	.loc 1 457 1 view .LVU991
+	popq	%r12
+	.cfi_def_cfa_offset 32
+	popq	%r13
+	.cfi_def_cfa_offset 24
+	popq	%r14
+	.cfi_def_cfa_offset 16
+	popq	%r15
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	testfunc46, .-testfunc46
+	.globl	testfunc50
+	.type	testfunc50, @function
+testfunc50:
+.LFB55:
+	.cfi_startproc
+	.loc 1 463 6 is_stmt 1 view .LVU992
+	ret
+	.cfi_endproc
+.LFE55:
+	.size	testfunc50, .-testfunc50
+	.section	.rodata.str1.1
+.LC17:
+	.string	"line ~u: ~s\n"
+	.text
+	.globl	testfunc51
+	.type	testfunc51, @function
+testfunc51:
+.LFB36:
+	.loc 1 481 23 view -0
+	.cfi_startproc
+	.loc 1 482 1 view .LVU994
+	.loc 1 481 23 is_stmt 0 view .LVU995
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 482 18 view .LVU996
+	leaq	va_rope_vtab_utf8(%rip), %rax
+.LBB431:
+.LBB432:
+.LBB433:
+	.loc 2 304 12 view .LVU997
+	leaq	va_char_p_read_vtab_utf8(%rip), %r12
+.LBE433:
+.LBE432:
+.LBE431:
+	.loc 1 481 23 view .LVU998
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+.LBB442:
+	.loc 1 483 10 view .LVU999
+	xorl	%ebx, %ebx
+.LBE442:
+	.loc 1 481 23 view .LVU1000
+	subq	$96, %rsp
+	.cfi_def_cfa_offset 128
+	.loc 1 482 18 view .LVU1001
+	movq	%rax, (%rsp)
+	xorl	%eax, %eax
+	movq	%rax, 24(%rsp)
+	movq	%rax, 32(%rsp)
+	movq	%rax, 40(%rsp)
+	movq	%rax, 48(%rsp)
+	movq	%rax, 56(%rsp)
+	movq	%rax, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	va_alloc@GOTPCREL(%rip), %rax
+	movq	$16384, 80(%rsp)
+	movq	%rax, 88(%rsp)
+	.loc 1 483 1 is_stmt 1 view .LVU1002
+.LBB443:
+	.loc 1 483 6 view .LVU1003
+.LVL203:
+	.loc 1 483 19 view .LVU1004
+.L69:
+	.loc 1 484 5 view .LVU1005
+	.loc 1 484 9 view .LVU1006
+.LBB438:
+.LBI432:
+	.loc 2 299 28 view .LVU1007
+.LBB434:
+	.loc 2 304 5 view .LVU1008
+.LBE434:
+.LBE438:
+	.loc 1 484 36 is_stmt 0 view .LVU1009
+	movq	%rsp, %rbp
+.LVL204:
+	.loc 1 484 36 view .LVU1010
+	movl	%ebx, %esi
+.LBB439:
+.LBB435:
+	.loc 2 304 12 view .LVU1011
+	movq	%r12, 8(%rsp)
+.LBE435:
+.LBE439:
+	.loc 1 483 30 view .LVU1012
+	incl	%ebx
+.LVL205:
+.LBB440:
+.LBB436:
+	.loc 2 304 12 view .LVU1013
+	leaq	.LC17(%rip), %rax
+.LBE436:
+.LBE440:
+	.loc 1 484 36 view .LVU1014
+	movq	%rbp, %rdi
+.LBB441:
+.LBB437:
+	.loc 2 304 12 view .LVU1015
+	movq	%rax, 16(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1016
+.LVL206:
+	.loc 2 305 5 is_stmt 0 view .LVU1017
+.LBE437:
+.LBE441:
+	.loc 1 484 36 view .LVU1018
+	call	va_xprintf_sint@PLT
+.LVL207:
+	.loc 1 484 36 view .LVU1019
+	leaq	msg(%rip), %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL208:
+	.loc 1 484 7 is_stmt 1 view .LVU1020
+	.loc 1 483 30 view .LVU1021
+	.loc 1 483 19 view .LVU1022
+	cmpl	$100000, %ebx
+	jne	.L69
+.LBE443:
+	.loc 1 486 1 view .LVU1023
+	movq	%rbp, %rdi
+	movl	$1, %esi
+	call	va_rope_writev@PLT
+.LVL209:
+	.loc 1 487 1 view .LVU1024
+	movq	%rbp, %rdi
+	call	va_rope_free@PLT
+.LVL210:
+	.loc 1 488 1 is_stmt 0 view .LVU1025
+	addq	$96, %rsp
+	.cfi_def_cfa_offset 32
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL211:
+	.loc 1 488 1 view .LVU1026
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	testfunc51, .-testfunc51
+	.section	.rodata.str1.1
+.LC18:
+	.string	"token=~.*qs"
+.LC19:
+	.string	"abcdef"
+	.text
+	.globl	testfunc53
+	.type	testfunc53, @function
+testfunc53:
+.LFB37:
+	.loc 1 497 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 498 1 view .LVU1028
+.LVL212:
+	.loc 1 499 1 view .LVU1029
+	.loc 1 500 1 view .LVU1030
+.LBB444:
+	.loc 1 500 5 view .LVU1031
+	.loc 1 500 29 view .LVU1032
+.LBE444:
+	.loc 1 497 23 is_stmt 0 view .LVU1033
+	subq	$376, %rsp
+	.cfi_def_cfa_offset 384
+.LBB449:
+	.loc 1 500 46 view .LVU1034
+	xorl	%eax, %eax
+	movl	$20, %ecx
+	.loc 1 500 36 view .LVU1035
+	movl	$3, %esi
+	.loc 1 500 46 view .LVU1036
+	leaq	32(%rsp), %rdi
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 500 36 view .LVU1037
+	leaq	8(%rsp), %rdi
+	.loc 1 500 46 view .LVU1038
+	movq	$256, 88(%rsp)
+	.loc 1 500 58 is_stmt 1 view .LVU1039
+	.loc 1 500 46 is_stmt 0 view .LVU1040
+	movq	%rax, 8(%rsp)
+	movq	stderr(%rip), %rax
+	.loc 1 500 79 view .LVU1041
+	movb	$1, 104(%rsp)
+	.loc 1 500 3 is_stmt 1 view .LVU1042
+.LVL213:
+.LBB445:
+.LBI445:
+	.loc 2 299 28 view .LVU1043
+.LBB446:
+	.loc 2 304 5 view .LVU1044
+.LBE446:
+.LBE445:
+	.loc 1 500 46 is_stmt 0 view .LVU1045
+	movq	%rax, 72(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 80(%rsp)
+.LBB448:
+.LBB447:
+	.loc 2 304 12 view .LVU1046
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 16(%rsp)
+	leaq	.LC18(%rip), %rax
+	movq	%rax, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1047
+.LVL214:
+	.loc 2 305 5 is_stmt 0 view .LVU1048
+.LBE447:
+.LBE448:
+	.loc 1 500 36 view .LVU1049
+	call	va_xprintf_ulong@PLT
+.LVL215:
+	leaq	.LC19(%rip), %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL216:
+.LBE449:
+	.loc 1 500 3 is_stmt 1 view .LVU1050
+	.loc 1 501 1 is_stmt 0 view .LVU1051
+	addq	$376, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	testfunc53, .-testfunc53
+	.section	.rodata.str1.1
+.LC20:
+	.string	"token=~qs"
+	.text
+	.globl	testfunc55
+	.type	testfunc55, @function
+testfunc55:
+.LFB38:
+	.loc 1 507 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 508 1 view .LVU1053
+.LVL217:
+	.loc 1 509 1 view .LVU1054
+	.loc 1 510 1 view .LVU1055
+.LBB450:
+	.loc 1 510 5 view .LVU1056
+	.loc 1 510 29 view .LVU1057
+.LBE450:
+	.loc 1 507 23 is_stmt 0 view .LVU1058
+	subq	$392, %rsp
+	.cfi_def_cfa_offset 400
+.LBB453:
+	.loc 1 510 46 view .LVU1059
+	xorl	%eax, %eax
+	movl	$20, %ecx
+	leaq	48(%rsp), %rdi
+	.loc 1 510 36 view .LVU1060
+	leaq	8(%rsp), %rsi
+	.loc 1 510 980 view .LVU1061
+	movq	$3, 8(%rsp)
+	.loc 1 510 46 view .LVU1062
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 510 36 view .LVU1063
+	leaq	24(%rsp), %rdi
+	.loc 1 510 46 view .LVU1064
+	movq	$256, 104(%rsp)
+	.loc 1 510 58 is_stmt 1 view .LVU1065
+	.loc 1 510 46 is_stmt 0 view .LVU1066
+	movq	%rax, 24(%rsp)
+	movq	stderr(%rip), %rax
+	.loc 1 510 79 view .LVU1067
+	movb	$1, 120(%rsp)
+	.loc 1 510 3 is_stmt 1 view .LVU1068
+	.loc 1 510 46 is_stmt 0 view .LVU1069
+	movq	%rax, 88(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%rax, 96(%rsp)
+	.loc 1 510 980 view .LVU1070
+	leaq	.LC19(%rip), %rax
+	movq	%rax, 16(%rsp)
+.LVL218:
+.LBB451:
+.LBI451:
+	.loc 2 299 28 is_stmt 1 view .LVU1071
+.LBB452:
+	.loc 2 304 5 view .LVU1072
+	.loc 2 304 12 is_stmt 0 view .LVU1073
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 32(%rsp)
+	leaq	.LC20(%rip), %rax
+	movq	%rax, 40(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1074
+.LVL219:
+	.loc 2 305 5 is_stmt 0 view .LVU1075
+.LBE452:
+.LBE451:
+	.loc 1 510 36 view .LVU1076
+	call	va_xprintf_last_span_p_utf8@PLT
+.LVL220:
+.LBE453:
+	.loc 1 510 3 is_stmt 1 view .LVU1077
+	.loc 1 511 1 is_stmt 0 view .LVU1078
+	addq	$392, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	testfunc55, .-testfunc55
+	.globl	testfunc57
+	.type	testfunc57, @function
+testfunc57:
+.LFB39:
+	.loc 1 518 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 519 1 view .LVU1080
+.LBB454:
+	.loc 1 519 5 view .LVU1081
+	.loc 1 519 29 view .LVU1082
+.LBE454:
+	.loc 1 518 23 is_stmt 0 view .LVU1083
+	subq	$392, %rsp
+	.cfi_def_cfa_offset 400
+.LBB457:
+	.loc 1 519 46 view .LVU1084
+	xorl	%eax, %eax
+	movl	$20, %ecx
+	leaq	48(%rsp), %rdi
+	.loc 1 519 36 view .LVU1085
+	leaq	8(%rsp), %rsi
+	.loc 1 519 980 view .LVU1086
+	movq	$1, 8(%rsp)
+	.loc 1 519 46 view .LVU1087
+	rep stosl
+	leaq	va_file_vtab_utf8(%rip), %rax
+	.loc 1 519 36 view .LVU1088
+	leaq	24(%rsp), %rdi
+	.loc 1 519 46 view .LVU1089
+	movq	$256, 104(%rsp)
+	.loc 1 519 58 is_stmt 1 view .LVU1090
+	.loc 1 519 46 is_stmt 0 view .LVU1091
+	movq	%rax, 24(%rsp)
+	movq	stderr(%rip), %rax
+	.loc 1 519 79 view .LVU1092
+	movb	$1, 120(%rsp)
+	.loc 1 519 3 is_stmt 1 view .LVU1093
+	.loc 1 519 46 is_stmt 0 view .LVU1094
+	movq	%rax, 88(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%rax, 96(%rsp)
+	.loc 1 519 980 view .LVU1095
+	leaq	.LC9(%rip), %rax
+	movq	%rax, 16(%rsp)
+.LVL221:
+.LBB455:
+.LBI455:
+	.loc 2 299 28 is_stmt 1 view .LVU1096
+.LBB456:
+	.loc 2 304 5 view .LVU1097
+	.loc 2 304 12 is_stmt 0 view .LVU1098
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 32(%rsp)
+	leaq	.LC20(%rip), %rax
+	movq	%rax, 40(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1099
+.LVL222:
+	.loc 2 305 5 is_stmt 0 view .LVU1100
+.LBE456:
+.LBE455:
+	.loc 1 519 36 view .LVU1101
+	call	va_xprintf_last_span_p_utf8@PLT
+.LVL223:
+.LBE457:
+	.loc 1 519 3 is_stmt 1 view .LVU1102
+	.loc 1 520 1 is_stmt 0 view .LVU1103
+	addq	$392, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	testfunc57, .-testfunc57
+	.globl	testfunc59
+	.type	testfunc59, @function
+testfunc59:
+.LFB57:
+	.cfi_startproc
+	.loc 1 530 6 is_stmt 1 view .LVU1104
+	ret
+	.cfi_endproc
+.LFE57:
+	.size	testfunc59, .-testfunc59
+	.globl	testfunc60
+	.type	testfunc60, @function
+testfunc60:
+.LFB41:
+	.loc 1 538 23 view -0
+	.cfi_startproc
+	.loc 1 539 1 view .LVU1106
+	.loc 1 538 23 is_stmt 0 view .LVU1107
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 96
+	.loc 1 539 611 view .LVU1108
+	xorl	%eax, %eax
+	movl	$12, %ecx
+	leaq	24(%rsp), %rdi
+	.loc 1 539 130 view .LVU1109
+	leaq	msg(%rip), %rsi
+	.loc 1 539 611 view .LVU1110
+	movq	$-1, 72(%rsp)
+.LVL224:
+.LBB458:
+.LBI458:
+	.loc 2 299 28 is_stmt 1 view .LVU1111
+.LBB459:
+	.loc 2 304 5 view .LVU1112
+.LBE459:
+.LBE458:
+	.loc 1 539 611 is_stmt 0 view .LVU1113
+	rep stosl
+	leaq	va_len_vtab(%rip), %rax
+	.loc 1 539 130 view .LVU1114
+	movq	%rsp, %rdi
+.LVL225:
+	.loc 1 539 611 view .LVU1115
+	movq	%rax, (%rsp)
+.LBB461:
+.LBB460:
+	.loc 2 304 12 view .LVU1116
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 8(%rsp)
+	leaq	.LC3(%rip), %rax
+	movq	%rax, 16(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1117
+.LVL226:
+	.loc 2 305 5 is_stmt 0 view .LVU1118
+.LBE460:
+.LBE461:
+	.loc 1 539 130 view .LVU1119
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL227:
+	.loc 1 540 1 view .LVU1120
+	addq	$88, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	testfunc60, .-testfunc60
+	.globl	testfunc62
+	.type	testfunc62, @function
+testfunc62:
+.LFB42:
+	.loc 1 551 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 552 1 view .LVU1122
+	.loc 1 551 23 is_stmt 0 view .LVU1123
+	subq	$88, %rsp
+	.cfi_def_cfa_offset 96
+.LBB462:
+	.loc 1 552 597 view .LVU1124
+	xorl	%eax, %eax
+	movl	$12, %ecx
+	leaq	24(%rsp), %rdi
+	.loc 1 552 108 view .LVU1125
+	leaq	msg(%rip), %rsi
+	.loc 1 552 597 view .LVU1126
+	movq	$80, 72(%rsp)
+.LVL228:
+.LBB463:
+.LBI463:
+	.loc 2 299 28 is_stmt 1 view .LVU1127
+.LBB464:
+	.loc 2 304 5 view .LVU1128
+.LBE464:
+.LBE463:
+	.loc 1 552 597 is_stmt 0 view .LVU1129
+	rep stosl
+	leaq	va_len_vtab(%rip), %rax
+	.loc 1 552 108 view .LVU1130
+	movq	%rsp, %rdi
+.LVL229:
+	.loc 1 552 597 view .LVU1131
+	movq	%rax, (%rsp)
+.LBB466:
+.LBB465:
+	.loc 2 304 12 view .LVU1132
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, 8(%rsp)
+	leaq	.LC3(%rip), %rax
+	movq	%rax, 16(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1133
+.LVL230:
+	.loc 2 305 5 is_stmt 0 view .LVU1134
+.LBE465:
+.LBE466:
+	.loc 1 552 108 view .LVU1135
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL231:
+	.loc 1 554 1 is_stmt 1 view .LVU1136
+.LBE462:
+	.loc 1 555 1 is_stmt 0 view .LVU1137
+	addq	$88, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	testfunc62, .-testfunc62
+	.globl	testfunc64
+	.type	testfunc64, @function
+testfunc64:
+.LFB59:
+	.cfi_startproc
+	.loc 1 561 6 is_stmt 1 view .LVU1138
+	ret
+	.cfi_endproc
+.LFE59:
+	.size	testfunc64, .-testfunc64
+	.section	.rodata.str1.1
+.LC21:
+	.string	"e.code == VA_E_OK"
+	.text
+	.globl	testfunc65
+	.type	testfunc65, @function
+testfunc65:
+.LFB44:
+	.loc 1 568 23 view -0
+	.cfi_startproc
+	.loc 1 569 1 view .LVU1140
+.LBB467:
+	.loc 1 569 28 view .LVU1141
+.LBE467:
+	.loc 1 568 23 is_stmt 0 view .LVU1142
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+.LBB476:
+	.loc 1 569 607 view .LVU1143
+	xorl	%eax, %eax
+	movl	$16, %ecx
+.LBB468:
+.LBB469:
+	.loc 2 304 12 view .LVU1144
+	leaq	va_char_p_read_vtab_utf8(%rip), %r14
+.LBE469:
+.LBE468:
+.LBE476:
+	.loc 1 568 23 view .LVU1145
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+.LBB477:
+.LBB473:
+.LBB470:
+	.loc 2 304 12 view .LVU1146
+	leaq	.LC3(%rip), %r13
+.LBE470:
+.LBE473:
+.LBE477:
+	.loc 1 568 23 view .LVU1147
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+.LBB478:
+	.loc 1 569 34 view .LVU1148
+	leaq	msg(%rip), %r12
+.LBE478:
+	.loc 1 568 23 view .LVU1149
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+.LBB479:
+	.loc 1 569 34 view .LVU1150
+	movq	%r12, %rsi
+.LBE479:
+	.loc 1 568 23 view .LVU1151
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$96, %rsp
+	.cfi_def_cfa_offset 144
+.LBB480:
+	.loc 1 569 607 view .LVU1152
+	leaq	32(%rsp), %rdi
+	.loc 1 569 34 view .LVU1153
+	leaq	8(%rsp), %rbp
+	.loc 1 569 607 view .LVU1154
+	rep stosl
+	leaq	va_char_p_size_vtab_utf8(%rip), %rax
+	.loc 1 569 34 view .LVU1155
+	movq	%rbp, %rdi
+.LBB474:
+.LBB471:
+	.loc 2 304 12 view .LVU1156
+	movq	%r14, 16(%rsp)
+.LBE471:
+.LBE474:
+	.loc 1 569 607 view .LVU1157
+	movq	%rax, 8(%rsp)
+	movq	$-2, 80(%rsp)
+.LVL232:
+.LBB475:
+.LBI468:
+	.loc 2 299 28 is_stmt 1 view .LVU1158
+.LBB472:
+	.loc 2 304 5 view .LVU1159
+	.loc 2 304 12 is_stmt 0 view .LVU1160
+	movq	%r13, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1161
+.LVL233:
+	.loc 2 305 5 is_stmt 0 view .LVU1162
+.LBE472:
+.LBE475:
+	.loc 1 569 34 view .LVU1163
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL234:
+	.loc 1 569 416 view .LVU1164
+	movq	80(%rax), %rbx
+	incq	%rbx
+.LVL235:
+	.loc 1 569 416 view .LVU1165
+.LBE480:
+	.loc 1 570 1 is_stmt 1 view .LVU1166
+	.loc 1 570 11 is_stmt 0 view .LVU1167
+	movq	%rbx, %rdi
+	call	malloc@PLT
+.LVL236:
+	.loc 1 571 1 is_stmt 1 view .LVU1168
+	.loc 1 572 1 view .LVU1169
+.LBB481:
+	.loc 1 572 17 view .LVU1170
+	.loc 1 572 517 is_stmt 0 view .LVU1171
+	xorl	%ecx, %ecx
+	.loc 1 572 246 view .LVU1172
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	.loc 1 572 517 view .LVU1173
+	leaq	va_char_p_vtab_utf8(%rip), %rdx
+	movq	%rcx, 88(%rsp)
+.LVL237:
+.LBB482:
+.LBI482:
+	.loc 2 299 28 is_stmt 1 view .LVU1174
+.LBB483:
+	.loc 2 304 5 view .LVU1175
+.LBE483:
+.LBE482:
+	.loc 1 572 517 is_stmt 0 view .LVU1176
+	movq	%rdx, 8(%rsp)
+	xorl	%edx, %edx
+	movq	%rdx, 32(%rsp)
+	movq	%rdx, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rdx, 56(%rsp)
+	movq	%rdx, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rbx, 80(%rsp)
+.LBB485:
+.LBB484:
+	.loc 2 304 12 view .LVU1177
+	movq	%r14, 16(%rsp)
+	movq	%r13, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 view .LVU1178
+.LVL238:
+	.loc 2 305 5 is_stmt 0 view .LVU1179
+.LBE484:
+.LBE485:
+	.loc 1 572 246 view .LVU1180
+	call	va_xprintf_char_p_utf8@PLT
+.LVL239:
+	.loc 1 572 246 view .LVU1181
+	leaq	4(%rsp), %rsi
+	movq	%rax, %rdi
+	call	va_xprintf_last_error_t_p@PLT
+.LVL240:
+.LBE481:
+	.loc 1 573 1 is_stmt 1 view .LVU1182
+	.loc 1 573 33 is_stmt 0 view .LVU1183
+	cmpl	$0, 4(%rsp)
+	je	.L84
+	.loc 1 573 10 is_stmt 1 discriminator 1 view .LVU1184
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx
+	movl	$573, %edx
+	leaq	.LC4(%rip), %rsi
+	leaq	.LC21(%rip), %rdi
+	call	__assert_fail@PLT
+.LVL241:
+.L84:
+	.loc 1 574 1 is_stmt 0 view .LVU1185
+	addq	$96, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL242:
+	.loc 1 574 1 view .LVU1186
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	testfunc65, .-testfunc65
+	.globl	testfunc67
+	.type	testfunc67, @function
+testfunc67:
+.LFB45:
+	.loc 1 590 23 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 591 1 view .LVU1188
+	.loc 1 592 1 view .LVU1189
+.LBB486:
+	.loc 1 592 28 view .LVU1190
+.LBE486:
+	.loc 1 590 23 is_stmt 0 view .LVU1191
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+.LBB495:
+	.loc 1 592 607 view .LVU1192
+	xorl	%eax, %eax
+	movl	$16, %ecx
+.LBB487:
+.LBB488:
+	.loc 2 304 12 view .LVU1193
+	leaq	va_char_p_read_vtab_utf8(%rip), %r14
+.LBE488:
+.LBE487:
+.LBE495:
+	.loc 1 590 23 view .LVU1194
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+.LBB496:
+.LBB492:
+.LBB489:
+	.loc 2 304 12 view .LVU1195
+	leaq	.LC3(%rip), %r13
+.LBE489:
+.LBE492:
+.LBE496:
+	.loc 1 590 23 view .LVU1196
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+.LBB497:
+	.loc 1 592 34 view .LVU1197
+	leaq	msg(%rip), %r12
+.LBE497:
+	.loc 1 590 23 view .LVU1198
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+.LBB498:
+	.loc 1 592 34 view .LVU1199
+	movq	%r12, %rsi
+.LBE498:
+	.loc 1 590 23 view .LVU1200
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	subq	$96, %rsp
+	.cfi_def_cfa_offset 144
+.LBB499:
+	.loc 1 592 607 view .LVU1201
+	leaq	32(%rsp), %rdi
+	.loc 1 592 34 view .LVU1202
+	leaq	8(%rsp), %rbp
+	.loc 1 592 607 view .LVU1203
+	rep stosl
+	.loc 1 592 34 view .LVU1204
+	movq	%rbp, %rdi
+	.loc 1 592 607 view .LVU1205
+	leaq	va_char16_p_size_vtab_utf16(%rip), %rax
+.LBB493:
+.LBB490:
+	.loc 2 304 12 view .LVU1206
+	movq	%r14, 16(%rsp)
+	movq	%r13, 24(%rsp)
+.LBE490:
+.LBE493:
+	.loc 1 592 607 view .LVU1207
+	movq	%rax, 8(%rsp)
+	movq	$-2, 80(%rsp)
+.LVL243:
+.LBB494:
+.LBI487:
+	.loc 2 299 28 is_stmt 1 view .LVU1208
+.LBB491:
+	.loc 2 304 5 view .LVU1209
+	.loc 2 305 5 view .LVU1210
+	.loc 2 305 5 is_stmt 0 view .LVU1211
+.LBE491:
+.LBE494:
+	.loc 1 592 34 view .LVU1212
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL244:
+	.loc 1 592 416 view .LVU1213
+	movq	80(%rax), %rbx
+	incq	%rbx
+.LVL245:
+	.loc 1 592 416 view .LVU1214
+.LBE499:
+	.loc 1 593 1 is_stmt 1 view .LVU1215
+	.loc 1 593 13 is_stmt 0 view .LVU1216
+	leaq	(%rbx,%rbx), %rdi
+	call	malloc@PLT
+.LVL246:
+	.loc 1 594 1 is_stmt 1 view .LVU1217
+.LBB500:
+	.loc 1 594 17 view .LVU1218
+	.loc 1 594 597 is_stmt 0 view .LVU1219
+	xorl	%ecx, %ecx
+	.loc 1 594 246 view .LVU1220
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	.loc 1 594 597 view .LVU1221
+	leaq	va_char16_p_vtab_utf16(%rip), %rdx
+	movq	%rbx, 80(%rsp)
+	movq	%rdx, 8(%rsp)
+	xorl	%edx, %edx
+.LBB501:
+.LBB502:
+	.loc 2 304 12 view .LVU1222
+	movq	%r14, 16(%rsp)
+	movq	%r13, 24(%rsp)
+.LBE502:
+.LBE501:
+	.loc 1 594 597 view .LVU1223
+	movq	%rdx, 32(%rsp)
+	movq	%rdx, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rdx, 56(%rsp)
+	movq	%rdx, 64(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rcx, 88(%rsp)
+.LVL247:
+.LBB504:
+.LBI501:
+	.loc 2 299 28 is_stmt 1 view .LVU1224
+.LBB503:
+	.loc 2 304 5 view .LVU1225
+	.loc 2 305 5 view .LVU1226
+	.loc 2 305 5 is_stmt 0 view .LVU1227
+.LBE503:
+.LBE504:
+	.loc 1 594 246 view .LVU1228
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL248:
+	.loc 1 594 246 view .LVU1229
+.LBE500:
+	.loc 1 595 1 view .LVU1230
+	addq	$96, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL249:
+	.loc 1 595 1 view .LVU1231
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+	popq	%r12
+	.cfi_def_cfa_offset 24
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	testfunc67, .-testfunc67
+	.globl	testfunc69
+	.type	testfunc69, @function
+testfunc69:
+.LFB61:
+	.cfi_startproc
+	.loc 1 604 6 is_stmt 1 view .LVU1232
+	ret
+	.cfi_endproc
+.LFE61:
+	.size	testfunc69, .-testfunc69
+	.section	.rodata.str1.1
+.LC22:
+	.string	"foo~s\n"
+	.text
+	.globl	testfunc70
+	.type	testfunc70, @function
+testfunc70:
+.LFB47:
+	.loc 1 616 23 view -0
+	.cfi_startproc
+	.loc 1 617 1 view .LVU1234
+	.loc 1 616 23 is_stmt 0 view .LVU1235
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 617 18 view .LVU1236
+	leaq	va_char_p_read_vtab_utf8(%rip), %rdx
+	leaq	.LC22(%rip), %rsi
+	.loc 1 616 23 view .LVU1237
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+.LBB505:
+.LBB506:
+	.loc 1 619 50 view .LVU1238
+	leaq	va_file_vtab_utf8(%rip), %r12
+.LBE506:
+.LBE505:
+	.loc 1 617 18 view .LVU1239
+	movl	$3, %ebp
+	.loc 1 616 23 view .LVU1240
+	pushq	%rbx
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	subq	$368, %rsp
+	.cfi_def_cfa_offset 400
+	.loc 1 617 18 view .LVU1241
+	movq	va_alloc@GOTPCREL(%rip), %rdi
+	call	va_format_compile_f@PLT
+.LVL250:
+	movq	%rax, %rbx
+.LVL251:
+	.loc 1 618 1 is_stmt 1 view .LVU1242
+.LBB512:
+	.loc 1 618 6 view .LVU1243
+	.loc 1 618 24 view .LVU1244
+.L91:
+	.loc 1 619 5 discriminator 3 view .LVU1245
+.LBB511:
+	.loc 1 619 9 discriminator 3 view .LVU1246
+	.loc 1 619 33 discriminator 3 view .LVU1247
+	.loc 1 619 50 is_stmt 0 discriminator 3 view .LVU1248
+	xorl	%eax, %eax
+	leaq	32(%rsp), %rdi
+	movl	$20, %ecx
+	movq	%r12, 8(%rsp)
+	rep stosl
+	movq	stdout(%rip), %rax
+	.loc 1 619 39 discriminator 3 view .LVU1249
+	leaq	8(%rsp), %rdi
+	leaq	msg(%rip), %rsi
+	.loc 1 619 50 discriminator 3 view .LVU1250
+	movq	$256, 88(%rsp)
+	.loc 1 619 61 is_stmt 1 discriminator 3 view .LVU1251
+	.loc 1 619 50 is_stmt 0 discriminator 3 view .LVU1252
+	movq	%rax, 72(%rsp)
+	leaq	112(%rsp), %rax
+	movq	%rax, 80(%rsp)
+.LBB507:
+.LBB508:
+	.loc 2 304 12 discriminator 3 view .LVU1253
+	leaq	va_format_read_vtab(%rip), %rax
+.LBE508:
+.LBE507:
+	.loc 1 619 82 discriminator 3 view .LVU1254
+	movb	$1, 104(%rsp)
+	.loc 1 619 6 is_stmt 1 discriminator 3 view .LVU1255
+.LVL252:
+.LBB510:
+.LBI507:
+	.loc 2 299 28 discriminator 3 view .LVU1256
+.LBB509:
+	.loc 2 304 5 discriminator 3 view .LVU1257
+	.loc 2 304 12 is_stmt 0 discriminator 3 view .LVU1258
+	movq	%rax, 16(%rsp)
+	movq	%rbx, 24(%rsp)
+	.loc 2 305 5 is_stmt 1 discriminator 3 view .LVU1259
+.LVL253:
+	.loc 2 305 5 is_stmt 0 discriminator 3 view .LVU1260
+.LBE509:
+.LBE510:
+	.loc 1 619 39 discriminator 3 view .LVU1261
+	call	va_xprintf_last_char_p_utf8@PLT
+.LVL254:
+.LBE511:
+	.loc 1 619 7 is_stmt 1 discriminator 3 view .LVU1262
+	.loc 1 618 30 discriminator 3 view .LVU1263
+	.loc 1 618 24 discriminator 3 view .LVU1264
+	decl	%ebp
+.LVL255:
+	.loc 1 618 24 is_stmt 0 discriminator 3 view .LVU1265
+	jne	.L91
+.LBE512:
+	.loc 1 621 1 is_stmt 1 view .LVU1266
+	.loc 1 622 1 is_stmt 0 view .LVU1267
+	addq	$368, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 621 1 view .LVU1268
+	movq	%rbx, %rdi
+	.loc 1 622 1 view .LVU1269
+	popq	%rbx
+	.cfi_def_cfa_offset 24
+.LVL256:
+	.loc 1 622 1 view .LVU1270
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL257:
+	.loc 1 622 1 view .LVU1271
+	popq	%r12
+	.cfi_def_cfa_offset 8
+	.loc 1 621 1 view .LVU1272
+	jmp	va_format_free@PLT
+.LVL258:
+	.loc 1 621 1 view .LVU1273
+	.cfi_endproc
+.LFE47:
+	.size	testfunc70, .-testfunc70
+	.section	.rodata
+	.align 8
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 11
+__PRETTY_FUNCTION__.0:
+	.string	"testfunc65"
+	.align 8
+	.type	__PRETTY_FUNCTION__.1, @object
+	.size	__PRETTY_FUNCTION__.1, 10
+__PRETTY_FUNCTION__.1:
+	.string	"testfunc3"
+	.data
+	.type	msg, @object
+	.size	msg, 4
+msg:
+	.string	"foo"
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "/usr/include/stdio.h"
+	.file 8 "/usr/include/uchar.h"
+	.file 9 "./include/va_print/base.h"
+	.file 10 "./include/va_print/utf8.h"
+	.file 11 "./include/va_print/utf32.h"
+	.file 12 "./include/va_print/file_utf8.h"
+	.file 13 "./include/va_print/file.h"
+	.file 14 "./include/va_print/char_utf8.h"
+	.file 15 "./include/va_print/char_utf16.h"
+	.file 16 "./include/va_print/char_utf32.h"
+	.file 17 "./include/va_print/char.h"
+	.file 18 "./include/va_print/alloc_utf8.h"
+	.file 19 "./include/va_print/alloc_utf16.h"
+	.file 20 "./include/va_print/alloc.h"
+	.file 21 "./include/va_print/len.h"
+	.file 22 "./include/va_print/fd_utf8.h"
+	.file 23 "./include/va_print/fd.h"
+	.file 24 "./include/va_print/rope_utf8.h"
+	.file 25 "./include/va_print/rope.h"
+	.file 26 "/usr/include/stdlib.h"
+	.file 27 "/usr/include/assert.h"
+	.file 28 "./include/va_print/utf16.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x32a2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3b
+	.long	.LASF1341
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xe
+	.long	.LASF1120
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3e
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1114
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1115
+	.uleb128 0x3c
+	.byte	0x8
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1116
+	.uleb128 0x15
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1117
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1118
+	.uleb128 0x15
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1119
+	.uleb128 0xe
+	.long	.LASF1121
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1c
+	.long	0x55
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	.LASF1122
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x16
+	.long	0x45
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1123
+	.uleb128 0xe
+	.long	.LASF1124
+	.byte	0x4
+	.byte	0x37
+	.byte	0x14
+	.long	0x6a
+	.uleb128 0xe
+	.long	.LASF1125
+	.byte	0x4
+	.byte	0x39
+	.byte	0x14
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1126
+	.byte	0x4
+	.byte	0x98
+	.byte	0x12
+	.long	0x89
+	.uleb128 0xe
+	.long	.LASF1127
+	.byte	0x4
+	.byte	0x99
+	.byte	0x12
+	.long	0x89
+	.uleb128 0x7
+	.long	0xc5
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1128
+	.uleb128 0x16
+	.long	0xc5
+	.uleb128 0x12
+	.long	0xc5
+	.long	0xe1
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1178
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x8
+	.long	0x268
+	.uleb128 0x5
+	.long	.LASF1129
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x76
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1130
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0xc0
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1131
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0xc0
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1132
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0xc0
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1133
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0xc0
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1134
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0xc0
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF1135
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0xc0
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF1136
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0xc0
+	.byte	0x38
+	.uleb128 0x5
+	.long	.LASF1137
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0xc0
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1138
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0xc0
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF1139
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0xc0
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF1140
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0xc0
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF1141
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x281
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF1142
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x286
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF1143
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x76
+	.byte	0x70
+	.uleb128 0x5
+	.long	.LASF1144
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x76
+	.byte	0x74
+	.uleb128 0x5
+	.long	.LASF1145
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0xa8
+	.byte	0x78
+	.uleb128 0x5
+	.long	.LASF1146
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x55
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF1147
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x5c
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF1148
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x28b
+	.byte	0x83
+	.uleb128 0x5
+	.long	.LASF1149
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x29b
+	.byte	0x88
+	.uleb128 0x5
+	.long	.LASF1150
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0xb4
+	.byte	0x90
+	.uleb128 0x5
+	.long	.LASF1151
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2a5
+	.byte	0x98
+	.uleb128 0x5
+	.long	.LASF1152
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2af
+	.byte	0xa0
+	.uleb128 0x5
+	.long	.LASF1153
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x286
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF1154
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0x4c
+	.byte	0xb0
+	.uleb128 0x5
+	.long	.LASF1155
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x32
+	.byte	0xb8
+	.uleb128 0x5
+	.long	.LASF1156
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x76
+	.byte	0xc0
+	.uleb128 0x5
+	.long	.LASF1157
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x2b4
+	.byte	0xc4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1158
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0xe1
+	.uleb128 0x3f
+	.long	.LASF1342
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1c
+	.long	.LASF1159
+	.uleb128 0x7
+	.long	0x27c
+	.uleb128 0x7
+	.long	0xe1
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x29b
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x274
+	.uleb128 0x1c
+	.long	.LASF1160
+	.uleb128 0x7
+	.long	0x2a0
+	.uleb128 0x1c
+	.long	.LASF1161
+	.uleb128 0x7
+	.long	0x2aa
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x2c4
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x13
+	.byte	0
+	.uleb128 0x7
+	.long	0x268
+	.uleb128 0xf
+	.long	.LASF1162
+	.byte	0x7
+	.byte	0x90
+	.byte	0xe
+	.long	0x2c4
+	.uleb128 0xf
+	.long	.LASF1163
+	.byte	0x7
+	.byte	0x91
+	.byte	0xe
+	.long	0x2c4
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1164
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1165
+	.uleb128 0x7
+	.long	0x2f4
+	.uleb128 0x40
+	.uleb128 0x7
+	.long	0xcc
+	.uleb128 0x41
+	.long	0x2f5
+	.uleb128 0xe
+	.long	.LASF1166
+	.byte	0x8
+	.byte	0x33
+	.byte	0x1a
+	.long	0x90
+	.uleb128 0x16
+	.long	0x2ff
+	.uleb128 0xe
+	.long	.LASF1167
+	.byte	0x8
+	.byte	0x34
+	.byte	0x1a
+	.long	0x9c
+	.uleb128 0x15
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1168
+	.uleb128 0x1f
+	.byte	0x38
+	.byte	0x9
+	.byte	0xc1
+	.long	0x3bb
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x9
+	.byte	0xc4
+	.byte	0x11
+	.long	0x2f5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1170
+	.byte	0x9
+	.byte	0xd3
+	.byte	0x10
+	.long	0x403
+	.byte	0x8
+	.uleb128 0x13
+	.string	"end"
+	.byte	0x9
+	.byte	0xd7
+	.byte	0x13
+	.long	0x41c
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1171
+	.byte	0x9
+	.byte	0xdb
+	.byte	0xc
+	.long	0x42c
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1172
+	.byte	0x9
+	.byte	0xe2
+	.byte	0xe
+	.long	0x459
+	.byte	0x20
+	.uleb128 0x5
+	.long	.LASF1173
+	.byte	0x9
+	.byte	0xec
+	.byte	0xe
+	.long	0x47c
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF1174
+	.byte	0x9
+	.byte	0xf1
+	.byte	0x13
+	.long	0x4e
+	.byte	0x30
+	.uleb128 0x5
+	.long	.LASF1175
+	.byte	0x9
+	.byte	0xf5
+	.byte	0x13
+	.long	0x4e
+	.byte	0x31
+	.uleb128 0x5
+	.long	.LASF1176
+	.byte	0x9
+	.byte	0xf9
+	.byte	0x13
+	.long	0x4e
+	.byte	0x32
+	.uleb128 0x13
+	.string	"enc"
+	.byte	0x9
+	.byte	0xfd
+	.byte	0x13
+	.long	0x4e
+	.byte	0x33
+	.uleb128 0x5
+	.long	.LASF1177
+	.byte	0x9
+	.byte	0xff
+	.byte	0xa
+	.long	0xd1
+	.byte	0x34
+	.byte	0
+	.uleb128 0x20
+	.long	0x45
+	.long	0x3cf
+	.uleb128 0x3
+	.long	0x3cf
+	.uleb128 0x3
+	.long	0x2ef
+	.byte	0
+	.uleb128 0x7
+	.long	0x3d4
+	.uleb128 0x2f
+	.long	.LASF1179
+	.byte	0x10
+	.value	0x132
+	.byte	0x10
+	.long	0x3fe
+	.uleb128 0x8
+	.long	.LASF1180
+	.byte	0x9
+	.value	0x135
+	.byte	0x20
+	.long	0x493
+	.byte	0
+	.uleb128 0x10
+	.string	"cur"
+	.byte	0x9
+	.value	0x138
+	.byte	0x11
+	.long	0x2ef
+	.byte	0x8
+	.byte	0
+	.uleb128 0x16
+	.long	0x3d4
+	.uleb128 0x7
+	.long	0x3bb
+	.uleb128 0x20
+	.long	0x2ef
+	.long	0x41c
+	.uleb128 0x3
+	.long	0x3cf
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x7
+	.long	0x408
+	.uleb128 0x26
+	.long	0x42c
+	.uleb128 0x3
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x7
+	.long	0x421
+	.uleb128 0x20
+	.long	0x32
+	.long	0x44f
+	.uleb128 0x3
+	.long	0x44f
+	.uleb128 0x3
+	.long	0x2ef
+	.uleb128 0x3
+	.long	0x32
+	.uleb128 0x3
+	.long	0x454
+	.byte	0
+	.uleb128 0x7
+	.long	0x3fe
+	.uleb128 0x7
+	.long	0x32
+	.uleb128 0x7
+	.long	0x431
+	.uleb128 0x20
+	.long	0x32
+	.long	0x47c
+	.uleb128 0x3
+	.long	0x4c
+	.uleb128 0x3
+	.long	0x4e
+	.uleb128 0x3
+	.long	0x2ef
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x7
+	.long	0x45e
+	.uleb128 0x11
+	.long	.LASF1181
+	.byte	0x9
+	.value	0x100
+	.byte	0x3
+	.long	0x323
+	.uleb128 0x16
+	.long	0x481
+	.uleb128 0x7
+	.long	0x48e
+	.uleb128 0x11
+	.long	.LASF1182
+	.byte	0x9
+	.value	0x139
+	.byte	0x3
+	.long	0x3d4
+	.uleb128 0x1e
+	.byte	0x68
+	.byte	0x9
+	.value	0x151
+	.long	0x511
+	.uleb128 0x8
+	.long	.LASF1180
+	.byte	0x9
+	.value	0x154
+	.byte	0x19
+	.long	0x481
+	.byte	0
+	.uleb128 0x10
+	.string	"fmt"
+	.byte	0x9
+	.value	0x158
+	.byte	0x11
+	.long	0x2ef
+	.byte	0x38
+	.uleb128 0x10
+	.string	"lit"
+	.byte	0x9
+	.value	0x15c
+	.byte	0x21
+	.long	0x51b
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF1183
+	.byte	0x9
+	.value	0x15d
+	.byte	0xc
+	.long	0x32
+	.byte	0x48
+	.uleb128 0x8
+	.long	.LASF1184
+	.byte	0x9
+	.value	0x161
+	.byte	0x22
+	.long	0x52a
+	.byte	0x50
+	.uleb128 0x8
+	.long	.LASF1185
+	.byte	0x9
+	.value	0x162
+	.byte	0xc
+	.long	0x32
+	.byte	0x58
+	.uleb128 0x8
+	.long	.LASF1186
+	.byte	0x9
+	.value	0x166
+	.byte	0xd
+	.long	0x548
+	.byte	0x60
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1187
+	.uleb128 0x16
+	.long	0x511
+	.uleb128 0x7
+	.long	0x516
+	.uleb128 0x1c
+	.long	.LASF1188
+	.uleb128 0x16
+	.long	0x520
+	.uleb128 0x7
+	.long	0x525
+	.uleb128 0x20
+	.long	0x4c
+	.long	0x548
+	.uleb128 0x3
+	.long	0x4c
+	.uleb128 0x3
+	.long	0x32
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x7
+	.long	0x52f
+	.uleb128 0x11
+	.long	.LASF1189
+	.byte	0x9
+	.value	0x167
+	.byte	0x3
+	.long	0x4a5
+	.uleb128 0x11
+	.long	.LASF1190
+	.byte	0x9
+	.value	0x169
+	.byte	0x1a
+	.long	0x56c
+	.uleb128 0x16
+	.long	0x55a
+	.uleb128 0x2f
+	.long	.LASF1191
+	.byte	0x40
+	.value	0x1b7
+	.byte	0x8
+	.long	0x5ea
+	.uleb128 0x8
+	.long	.LASF1180
+	.byte	0x9
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x749
+	.byte	0
+	.uleb128 0x10
+	.string	"pat"
+	.byte	0x9
+	.value	0x1b9
+	.byte	0x14
+	.long	0x498
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF1192
+	.byte	0x9
+	.value	0x1ba
+	.byte	0xe
+	.long	0x45
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF1193
+	.byte	0x9
+	.value	0x1bb
+	.byte	0xe
+	.long	0x45
+	.byte	0x1c
+	.uleb128 0x10
+	.string	"opt"
+	.byte	0x9
+	.value	0x1bc
+	.byte	0xe
+	.long	0x45
+	.byte	0x20
+	.uleb128 0x8
+	.long	.LASF1194
+	.byte	0x9
+	.value	0x1bd
+	.byte	0xe
+	.long	0x45
+	.byte	0x24
+	.uleb128 0x10
+	.string	"win"
+	.byte	0x9
+	.value	0x1be
+	.byte	0x11
+	.long	0x73c
+	.byte	0x28
+	.uleb128 0x8
+	.long	.LASF1195
+	.byte	0x9
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x74e
+	.byte	0x38
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1196
+	.byte	0x9
+	.value	0x16c
+	.byte	0x1e
+	.long	0x5fc
+	.uleb128 0x16
+	.long	0x5ea
+	.uleb128 0x1c
+	.long	.LASF1197
+	.uleb128 0x1e
+	.byte	0x38
+	.byte	0x9
+	.value	0x174
+	.long	0x67b
+	.uleb128 0x8
+	.long	.LASF1198
+	.byte	0x9
+	.value	0x176
+	.byte	0xc
+	.long	0x68b
+	.byte	0
+	.uleb128 0x10
+	.string	"put"
+	.byte	0x9
+	.value	0x178
+	.byte	0xc
+	.long	0x6a0
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF1199
+	.byte	0x9
+	.value	0x17b
+	.byte	0xc
+	.long	0x68b
+	.byte	0x10
+	.uleb128 0x8
+	.long	.LASF1200
+	.byte	0x9
+	.value	0x182
+	.byte	0xb
+	.long	0x6c0
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF1201
+	.byte	0x9
+	.value	0x186
+	.byte	0xc
+	.long	0x6da
+	.byte	0x20
+	.uleb128 0x8
+	.long	.LASF1202
+	.byte	0x9
+	.value	0x18c
+	.byte	0xc
+	.long	0x6ef
+	.byte	0x28
+	.uleb128 0x10
+	.string	"enc"
+	.byte	0x9
+	.value	0x191
+	.byte	0x13
+	.long	0x4e
+	.byte	0x30
+	.uleb128 0x8
+	.long	.LASF1177
+	.byte	0x9
+	.value	0x192
+	.byte	0xa
+	.long	0x6f4
+	.byte	0x31
+	.byte	0
+	.uleb128 0x26
+	.long	0x686
+	.uleb128 0x3
+	.long	0x686
+	.byte	0
+	.uleb128 0x7
+	.long	0x55a
+	.uleb128 0x7
+	.long	0x67b
+	.uleb128 0x26
+	.long	0x6a0
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x45
+	.byte	0
+	.uleb128 0x7
+	.long	0x690
+	.uleb128 0x20
+	.long	0x6b9
+	.long	0x6b9
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x15
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1203
+	.uleb128 0x7
+	.long	0x6a5
+	.uleb128 0x26
+	.long	0x6da
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x45
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x7
+	.long	0x6c5
+	.uleb128 0x26
+	.long	0x6ef
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x7
+	.long	0x6df
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x704
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1204
+	.byte	0x9
+	.value	0x193
+	.byte	0x3
+	.long	0x601
+	.uleb128 0x16
+	.long	0x704
+	.uleb128 0x1e
+	.byte	0x10
+	.byte	0x9
+	.value	0x19a
+	.long	0x73c
+	.uleb128 0x10
+	.string	"cur"
+	.byte	0x9
+	.value	0x19b
+	.byte	0xb
+	.long	0x4c
+	.byte	0
+	.uleb128 0x10
+	.string	"end"
+	.byte	0x9
+	.value	0x19c
+	.byte	0xb
+	.long	0x4c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1205
+	.byte	0x9
+	.value	0x19d
+	.byte	0x3
+	.long	0x716
+	.uleb128 0x7
+	.long	0x711
+	.uleb128 0x7
+	.long	0x5f7
+	.uleb128 0x2f
+	.long	.LASF1206
+	.byte	0x10
+	.value	0x1e5
+	.byte	0x10
+	.long	0x77d
+	.uleb128 0x8
+	.long	.LASF1207
+	.byte	0x9
+	.value	0x1e6
+	.byte	0xc
+	.long	0x32
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1208
+	.byte	0x9
+	.value	0x1e7
+	.byte	0x11
+	.long	0x2f5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1209
+	.byte	0x9
+	.value	0x1e8
+	.byte	0x3
+	.long	0x753
+	.uleb128 0x16
+	.long	0x77d
+	.uleb128 0x7
+	.long	0x30b
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x9
+	.value	0x204
+	.long	0x7ac
+	.uleb128 0x8
+	.long	.LASF1210
+	.byte	0x9
+	.value	0x205
+	.byte	0xe
+	.long	0x45
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1211
+	.byte	0x9
+	.value	0x206
+	.byte	0x3
+	.long	0x794
+	.uleb128 0xf
+	.long	.LASF1212
+	.byte	0xa
+	.byte	0x17
+	.byte	0x22
+	.long	0x48e
+	.uleb128 0xf
+	.long	.LASF1213
+	.byte	0xb
+	.byte	0x18
+	.byte	0x22
+	.long	0x48e
+	.uleb128 0xf
+	.long	.LASF1214
+	.byte	0x2
+	.byte	0xf5
+	.byte	0x22
+	.long	0x48e
+	.uleb128 0xf
+	.long	.LASF1215
+	.byte	0xc
+	.byte	0x18
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0x1f
+	.byte	0x68
+	.byte	0xd
+	.byte	0x9f
+	.long	0x84b
+	.uleb128 0x13
+	.string	"s"
+	.byte	0xd
+	.byte	0xa0
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1216
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xb
+	.long	0x2c4
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1208
+	.byte	0xd
+	.byte	0xa2
+	.byte	0xb
+	.long	0xc0
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF1207
+	.byte	0xd
+	.byte	0xa3
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x13
+	.string	"pos"
+	.byte	0xd
+	.byte	0xa4
+	.byte	0xc
+	.long	0x32
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF1217
+	.byte	0xd
+	.byte	0xa5
+	.byte	0x9
+	.long	0x6b9
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF1177
+	.byte	0xd
+	.byte	0xa6
+	.byte	0xa
+	.long	0x6f4
+	.byte	0x61
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1218
+	.byte	0xd
+	.byte	0xa7
+	.byte	0x3
+	.long	0x7e9
+	.uleb128 0x1a
+	.string	"msg"
+	.byte	0xf
+	.byte	0xd
+	.long	0xd1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.uleb128 0xe
+	.long	.LASF1219
+	.byte	0x1
+	.byte	0x10
+	.byte	0x12
+	.long	0x2ff
+	.uleb128 0xf
+	.long	.LASF1220
+	.byte	0xe
+	.byte	0x17
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xf
+	.long	.LASF1221
+	.byte	0xe
+	.byte	0x18
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xf
+	.long	.LASF1222
+	.byte	0xf
+	.byte	0x17
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xf
+	.long	.LASF1223
+	.byte	0xf
+	.byte	0x18
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xf
+	.long	.LASF1224
+	.byte	0x10
+	.byte	0x17
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0x1f
+	.byte	0x58
+	.byte	0x11
+	.byte	0xe4
+	.long	0x8ef
+	.uleb128 0x13
+	.string	"s"
+	.byte	0x11
+	.byte	0xe5
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1208
+	.byte	0x11
+	.byte	0xe6
+	.byte	0xb
+	.long	0x4c
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1207
+	.byte	0x11
+	.byte	0xe7
+	.byte	0xc
+	.long	0x32
+	.byte	0x48
+	.uleb128 0x13
+	.string	"pos"
+	.byte	0x11
+	.byte	0xe8
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1225
+	.byte	0x11
+	.byte	0xe9
+	.byte	0x3
+	.long	0x8b4
+	.uleb128 0xf
+	.long	.LASF1226
+	.byte	0x12
+	.byte	0x19
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xf
+	.long	.LASF1227
+	.byte	0x13
+	.byte	0x19
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0x11
+	.long	.LASF1228
+	.byte	0x14
+	.value	0x1a6
+	.byte	0x1f
+	.long	0x920
+	.uleb128 0x1c
+	.long	.LASF1229
+	.uleb128 0x1e
+	.byte	0x20
+	.byte	0x14
+	.value	0x1af
+	.long	0x967
+	.uleb128 0x8
+	.long	.LASF1230
+	.byte	0x14
+	.value	0x1b1
+	.byte	0x17
+	.long	0x967
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1231
+	.byte	0x14
+	.value	0x1b3
+	.byte	0xb
+	.long	0x4c
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF1232
+	.byte	0x14
+	.value	0x1b5
+	.byte	0xc
+	.long	0x32
+	.byte	0x10
+	.uleb128 0x8
+	.long	.LASF1186
+	.byte	0x14
+	.value	0x1b7
+	.byte	0xd
+	.long	0x548
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0x913
+	.uleb128 0x11
+	.long	.LASF1233
+	.byte	0x14
+	.value	0x1b8
+	.byte	0x3
+	.long	0x925
+	.uleb128 0x1e
+	.byte	0x78
+	.byte	0x14
+	.value	0x1ba
+	.long	0x9ff
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x14
+	.value	0x1bb
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1208
+	.byte	0x14
+	.value	0x1bc
+	.byte	0xb
+	.long	0xc0
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF1207
+	.byte	0x14
+	.value	0x1bd
+	.byte	0xc
+	.long	0x32
+	.byte	0x48
+	.uleb128 0x10
+	.string	"pos"
+	.byte	0x14
+	.value	0x1be
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x8
+	.long	.LASF1186
+	.byte	0x14
+	.value	0x1bf
+	.byte	0xd
+	.long	0x548
+	.byte	0x58
+	.uleb128 0x8
+	.long	.LASF1234
+	.byte	0x14
+	.value	0x1c0
+	.byte	0xb
+	.long	0xc0
+	.byte	0x60
+	.uleb128 0x8
+	.long	.LASF1235
+	.byte	0x14
+	.value	0x1c1
+	.byte	0x11
+	.long	0x9ff
+	.byte	0x68
+	.uleb128 0x8
+	.long	.LASF1236
+	.byte	0x14
+	.value	0x1c2
+	.byte	0x13
+	.long	0x4e
+	.byte	0x70
+	.uleb128 0x8
+	.long	.LASF1177
+	.byte	0x14
+	.value	0x1c3
+	.byte	0xa
+	.long	0x6f4
+	.byte	0x71
+	.byte	0
+	.uleb128 0x7
+	.long	0x96c
+	.uleb128 0x11
+	.long	.LASF1237
+	.byte	0x14
+	.value	0x1c4
+	.byte	0x3
+	.long	0x979
+	.uleb128 0x1e
+	.byte	0x78
+	.byte	0x14
+	.value	0x1c6
+	.long	0xa97
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x14
+	.value	0x1c7
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1208
+	.byte	0x14
+	.value	0x1c8
+	.byte	0xf
+	.long	0xa97
+	.byte	0x40
+	.uleb128 0x8
+	.long	.LASF1207
+	.byte	0x14
+	.value	0x1c9
+	.byte	0xc
+	.long	0x32
+	.byte	0x48
+	.uleb128 0x10
+	.string	"pos"
+	.byte	0x14
+	.value	0x1ca
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x8
+	.long	.LASF1186
+	.byte	0x14
+	.value	0x1cb
+	.byte	0xd
+	.long	0x548
+	.byte	0x58
+	.uleb128 0x8
+	.long	.LASF1234
+	.byte	0x14
+	.value	0x1cc
+	.byte	0xf
+	.long	0xa97
+	.byte	0x60
+	.uleb128 0x8
+	.long	.LASF1235
+	.byte	0x14
+	.value	0x1cd
+	.byte	0x11
+	.long	0x9ff
+	.byte	0x68
+	.uleb128 0x8
+	.long	.LASF1236
+	.byte	0x14
+	.value	0x1ce
+	.byte	0x13
+	.long	0x4e
+	.byte	0x70
+	.uleb128 0x8
+	.long	.LASF1177
+	.byte	0x14
+	.value	0x1cf
+	.byte	0xa
+	.long	0x6f4
+	.byte	0x71
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ff
+	.uleb128 0x11
+	.long	.LASF1238
+	.byte	0x14
+	.value	0x1d0
+	.byte	0x3
+	.long	0xa11
+	.uleb128 0x7
+	.long	0x310
+	.uleb128 0x1f
+	.byte	0x50
+	.byte	0x15
+	.byte	0x3b
+	.long	0xadc
+	.uleb128 0x13
+	.string	"s"
+	.byte	0x15
+	.byte	0x3c
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x13
+	.string	"pos"
+	.byte	0x15
+	.byte	0x3d
+	.byte	0xc
+	.long	0x32
+	.byte	0x40
+	.uleb128 0x13
+	.string	"max"
+	.byte	0x15
+	.byte	0x3e
+	.byte	0xc
+	.long	0x32
+	.byte	0x48
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1239
+	.byte	0x15
+	.byte	0x3f
+	.byte	0x3
+	.long	0xaae
+	.uleb128 0xf
+	.long	.LASF1240
+	.byte	0x15
+	.byte	0x44
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xf
+	.long	.LASF1241
+	.byte	0x16
+	.byte	0x17
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0x1f
+	.byte	0x70
+	.byte	0x17
+	.byte	0x94
+	.long	0xb6e
+	.uleb128 0x13
+	.string	"s"
+	.byte	0x17
+	.byte	0x95
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x13
+	.string	"fd"
+	.byte	0x17
+	.byte	0x96
+	.byte	0xa
+	.long	0x89
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1208
+	.byte	0x17
+	.byte	0x97
+	.byte	0xb
+	.long	0xc0
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF1207
+	.byte	0x17
+	.byte	0x98
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x13
+	.string	"pos"
+	.byte	0x17
+	.byte	0x99
+	.byte	0xc
+	.long	0x32
+	.byte	0x58
+	.uleb128 0x5
+	.long	.LASF1242
+	.byte	0x17
+	.byte	0x9a
+	.byte	0xc
+	.long	0x32
+	.byte	0x60
+	.uleb128 0x5
+	.long	.LASF1217
+	.byte	0x17
+	.byte	0x9b
+	.byte	0x9
+	.long	0x6b9
+	.byte	0x68
+	.uleb128 0x5
+	.long	.LASF1177
+	.byte	0x17
+	.byte	0x9c
+	.byte	0xa
+	.long	0x6f4
+	.byte	0x69
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1243
+	.byte	0x17
+	.byte	0x9d
+	.byte	0x3
+	.long	0xb00
+	.uleb128 0xf
+	.long	.LASF1244
+	.byte	0x18
+	.byte	0x17
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0xe
+	.long	.LASF1245
+	.byte	0x19
+	.byte	0x30
+	.byte	0x1e
+	.long	0xb92
+	.uleb128 0x1c
+	.long	.LASF1246
+	.uleb128 0x1f
+	.byte	0x60
+	.byte	0x19
+	.byte	0x39
+	.long	0xbdf
+	.uleb128 0x13
+	.string	"s"
+	.byte	0x19
+	.byte	0x3a
+	.byte	0x11
+	.long	0x55a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1247
+	.byte	0x19
+	.byte	0x3b
+	.byte	0x16
+	.long	0xbdf
+	.byte	0x40
+	.uleb128 0x5
+	.long	.LASF1231
+	.byte	0x19
+	.byte	0x3c
+	.byte	0x16
+	.long	0xbdf
+	.byte	0x48
+	.uleb128 0x5
+	.long	.LASF1232
+	.byte	0x19
+	.byte	0x3e
+	.byte	0xc
+	.long	0x32
+	.byte	0x50
+	.uleb128 0x5
+	.long	.LASF1186
+	.byte	0x19
+	.byte	0x40
+	.byte	0xd
+	.long	0x548
+	.byte	0x58
+	.byte	0
+	.uleb128 0x7
+	.long	0xb86
+	.uleb128 0xe
+	.long	.LASF1248
+	.byte	0x19
+	.byte	0x41
+	.byte	0x3
+	.long	0xb97
+	.uleb128 0x21
+	.long	.LASF1252
+	.byte	0x2
+	.value	0x172
+	.long	0xc02
+	.uleb128 0x3
+	.long	0xc02
+	.byte	0
+	.uleb128 0x7
+	.long	0x54d
+	.uleb128 0xd
+	.long	.LASF1249
+	.byte	0x2
+	.value	0x169
+	.byte	0x15
+	.long	0xc02
+	.long	0xc28
+	.uleb128 0x3
+	.long	0x548
+	.uleb128 0x3
+	.long	0x2ef
+	.uleb128 0x3
+	.long	0x493
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1250
+	.byte	0x1a
+	.value	0x229
+	.byte	0xe
+	.long	0x4c
+	.long	0xc3f
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1251
+	.byte	0x2
+	.value	0x108
+	.byte	0x15
+	.long	0x686
+	.long	0xc5b
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x3e
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1253
+	.byte	0x19
+	.byte	0x7d
+	.long	0xc6c
+	.uleb128 0x3
+	.long	0xc6c
+	.byte	0
+	.uleb128 0x7
+	.long	0xbe4
+	.uleb128 0x27
+	.long	.LASF1254
+	.byte	0x19
+	.byte	0x66
+	.byte	0xc
+	.long	0x6b9
+	.long	0xc8c
+	.uleb128 0x3
+	.long	0xc6c
+	.uleb128 0x3
+	.long	0x76
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1255
+	.byte	0x2
+	.value	0x100
+	.byte	0x15
+	.long	0x686
+	.long	0xca8
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x76
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1256
+	.byte	0x17
+	.byte	0xa8
+	.long	0xcb9
+	.uleb128 0x3
+	.long	0xcb9
+	.byte	0
+	.uleb128 0x7
+	.long	0xb6e
+	.uleb128 0x30
+	.long	.LASF1257
+	.byte	0xd
+	.byte	0xbd
+	.long	0xccf
+	.uleb128 0x3
+	.long	0xccf
+	.byte	0
+	.uleb128 0x7
+	.long	0x84b
+	.uleb128 0x21
+	.long	.LASF1258
+	.byte	0x14
+	.value	0x22c
+	.long	0xceb
+	.uleb128 0x3
+	.long	0xceb
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x7
+	.long	0xa04
+	.uleb128 0x27
+	.long	.LASF1259
+	.byte	0xa
+	.byte	0x93
+	.byte	0x15
+	.long	0x686
+	.long	0xd0b
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0xd0b
+	.byte	0
+	.uleb128 0x7
+	.long	0x78a
+	.uleb128 0xd
+	.long	.LASF1260
+	.byte	0x14
+	.value	0x230
+	.byte	0x13
+	.long	0xd2c
+	.long	0xd2c
+	.uleb128 0x3
+	.long	0xceb
+	.uleb128 0x3
+	.long	0xd2c
+	.byte	0
+	.uleb128 0x7
+	.long	0x77d
+	.uleb128 0x21
+	.long	.LASF1261
+	.byte	0x14
+	.value	0x225
+	.long	0xd43
+	.uleb128 0x3
+	.long	0xceb
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1262
+	.byte	0x14
+	.value	0x228
+	.byte	0xc
+	.long	0x6b9
+	.long	0xd5f
+	.uleb128 0x3
+	.long	0xceb
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1330
+	.byte	0x14
+	.value	0x27a
+	.byte	0xd
+	.uleb128 0xd
+	.long	.LASF1263
+	.byte	0x14
+	.value	0x263
+	.byte	0x19
+	.long	0xceb
+	.long	0xd7f
+	.uleb128 0x3
+	.long	0x749
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1264
+	.byte	0x14
+	.value	0x234
+	.long	0xd91
+	.uleb128 0x3
+	.long	0xceb
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1265
+	.byte	0x7
+	.value	0x295
+	.byte	0xc
+	.long	0x76
+	.long	0xda8
+	.uleb128 0x3
+	.long	0x2f5
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1266
+	.byte	0x14
+	.value	0x2a8
+	.long	0xdba
+	.uleb128 0x3
+	.long	0x9ff
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1267
+	.byte	0xa
+	.byte	0x83
+	.byte	0x15
+	.long	0x686
+	.long	0xdd5
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x2f5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1268
+	.byte	0x2
+	.value	0x162
+	.byte	0x14
+	.long	0x2f5
+	.long	0xdec
+	.uleb128 0x3
+	.long	0x45
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1269
+	.byte	0x2
+	.value	0x15c
+	.byte	0x11
+	.long	0x45
+	.long	0xe03
+	.uleb128 0x3
+	.long	0xe03
+	.byte	0
+	.uleb128 0x7
+	.long	0x567
+	.uleb128 0xd
+	.long	.LASF1270
+	.byte	0x2
+	.value	0x13d
+	.byte	0x15
+	.long	0x686
+	.long	0xe29
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x2ef
+	.uleb128 0x3
+	.long	0x493
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1271
+	.byte	0x2
+	.value	0x146
+	.byte	0x15
+	.long	0x686
+	.long	0xe4a
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x2ef
+	.uleb128 0x3
+	.long	0x493
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF1272
+	.byte	0x1b
+	.byte	0x45
+	.byte	0xd
+	.long	0xe6b
+	.uleb128 0x3
+	.long	0x2f5
+	.uleb128 0x3
+	.long	0x2f5
+	.uleb128 0x3
+	.long	0x45
+	.uleb128 0x3
+	.long	0x2f5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1273
+	.byte	0x2
+	.value	0x117
+	.byte	0x15
+	.long	0x686
+	.long	0xe87
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x76
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1274
+	.byte	0x1a
+	.value	0x238
+	.long	0xe99
+	.uleb128 0x3
+	.long	0x4c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1275
+	.byte	0x14
+	.value	0x28c
+	.byte	0xe
+	.long	0x4c
+	.long	0xeba
+	.uleb128 0x3
+	.long	0x4c
+	.uleb128 0x3
+	.long	0x32
+	.uleb128 0x3
+	.long	0x32
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1276
+	.byte	0x1c
+	.byte	0x5c
+	.byte	0x15
+	.long	0x686
+	.long	0xed5
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x78f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1277
+	.byte	0x2
+	.value	0x124
+	.byte	0x15
+	.long	0x686
+	.long	0xef1
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0xef1
+	.byte	0
+	.uleb128 0x7
+	.long	0x7ac
+	.uleb128 0xd
+	.long	.LASF1278
+	.byte	0x2
+	.value	0x107
+	.byte	0x15
+	.long	0x686
+	.long	0xf12
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x45
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1279
+	.byte	0x7
+	.value	0x102
+	.byte	0xe
+	.long	0x2c4
+	.long	0xf2e
+	.uleb128 0x3
+	.long	0x2fa
+	.uleb128 0x3
+	.long	0x2fa
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1280
+	.byte	0x2
+	.value	0x11e
+	.byte	0x15
+	.long	0x686
+	.long	0xf4a
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x45
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1281
+	.byte	0xa
+	.byte	0x77
+	.byte	0x15
+	.long	0x686
+	.long	0xf65
+	.uleb128 0x3
+	.long	0x686
+	.uleb128 0x3
+	.long	0x2f5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1284
+	.value	0x268
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x105e
+	.uleb128 0x1b
+	.string	"f"
+	.value	0x269
+	.byte	0xe
+	.long	0xc02
+	.long	.LLST186
+	.long	.LVUS186
+	.uleb128 0x22
+	.long	.LLRL187
+	.long	0x1031
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x26a
+	.byte	0xf
+	.long	0x45
+	.long	.LLST188
+	.long	.LVUS188
+	.uleb128 0x23
+	.long	.LLRL189
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x26b
+	.byte	0xe
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x26b
+	.byte	0x32
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI507
+	.byte	.LVU1256
+	.long	.LLRL190
+	.value	0x26b
+	.byte	0x27
+	.long	0x100d
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST191
+	.long	.LVUS191
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST192
+	.long	.LVUS192
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL254
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL250
+	.long	0xc07
+	.long	0x1050
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC22
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL258
+	.long	0xbf0
+	.byte	0
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x106e
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1288
+	.value	0x25c
+	.uleb128 0xc
+	.long	.LASF1285
+	.value	0x24e
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x118e
+	.uleb128 0x11
+	.long	.LASF1286
+	.byte	0x1
+	.value	0x24f
+	.byte	0x1b
+	.long	0x86c
+	.uleb128 0x1b
+	.string	"n"
+	.value	0x250
+	.byte	0x8
+	.long	0x32
+	.long	.LLST178
+	.long	.LVUS178
+	.uleb128 0x1b
+	.string	"s"
+	.value	0x251
+	.byte	0x9
+	.long	0x10c3
+	.long	.LLST179
+	.long	.LVUS179
+	.uleb128 0x7
+	.long	0x1092
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI487
+	.byte	.LVU1208
+	.long	.LLRL180
+	.value	0x250
+	.byte	0x22
+	.long	0x1101
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST181
+	.long	.LVUS181
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST182
+	.long	.LVUS182
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI501
+	.byte	.LVU1224
+	.long	.LLRL183
+	.value	0x252
+	.byte	0xf6
+	.long	0x113a
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST184
+	.long	.LVUS184
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST185
+	.long	.LVUS185
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL244
+	.long	0xdba
+	.long	0x1158
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL246
+	.long	0xc28
+	.long	0x1173
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.byte	0x73
+	.sleb128 0
+	.byte	0x73
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL248
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1287
+	.value	0x238
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x130c
+	.uleb128 0x1b
+	.string	"n"
+	.value	0x239
+	.byte	0x8
+	.long	0x32
+	.long	.LLST170
+	.long	.LVUS170
+	.uleb128 0x1b
+	.string	"s"
+	.value	0x23a
+	.byte	0x7
+	.long	0xc0
+	.long	.LLST171
+	.long	.LVUS171
+	.uleb128 0x28
+	.string	"e"
+	.value	0x23b
+	.byte	0xc
+	.long	0x7ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.uleb128 0x31
+	.long	.LASF1329
+	.long	0x131c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI468
+	.byte	.LVU1158
+	.long	.LLRL172
+	.value	0x239
+	.byte	0x22
+	.long	0x1229
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST173
+	.long	.LVUS173
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST174
+	.long	.LVUS174
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI482
+	.byte	.LVU1174
+	.long	.LLRL175
+	.value	0x23c
+	.byte	0xf6
+	.long	0x1262
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST176
+	.long	.LVUS176
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST177
+	.long	.LVUS177
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL234
+	.long	0xdba
+	.long	0x1280
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL236
+	.long	0xc28
+	.long	0x1298
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL239
+	.long	0xf4a
+	.long	0x12b6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL240
+	.long	0xed5
+	.long	0x12cf
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL241
+	.long	0xe4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC21
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x23d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0xcc
+	.long	0x131c
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0xa
+	.byte	0
+	.uleb128 0x16
+	.long	0x130c
+	.uleb128 0x24
+	.long	.LASF1289
+	.value	0x231
+	.uleb128 0xc
+	.long	.LASF1290
+	.value	0x227
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13a1
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI463
+	.byte	.LVU1127
+	.long	.LLRL167
+	.value	0x228
+	.byte	0x6c
+	.long	0x137e
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST168
+	.long	.LVUS168
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST169
+	.long	.LVUS169
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL231
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1291
+	.value	0x21a
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1427
+	.uleb128 0x44
+	.long	.LASF1318
+	.byte	0x1
+	.value	0x21b
+	.byte	0x8
+	.long	0x32
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI458
+	.byte	.LVU1111
+	.long	.LLRL164
+	.value	0x21b
+	.byte	0x82
+	.long	0x1404
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST165
+	.long	.LVUS165
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST166
+	.long	.LVUS166
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL227
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1292
+	.value	0x212
+	.uleb128 0xc
+	.long	.LASF1293
+	.value	0x206
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14d2
+	.uleb128 0x23
+	.long	.LLRL161
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x207
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x207
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x32
+	.long	0x325c
+	.quad	.LBI455
+	.byte	.LVU1096
+	.quad	.LBB455
+	.quad	.LBE455-.LBB455
+	.value	0x207
+	.long	0x14b4
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST163
+	.long	.LVUS163
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL223
+	.long	0xcf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1294
+	.value	0x1fb
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1598
+	.uleb128 0xa
+	.long	.LASF1208
+	.value	0x1fc
+	.byte	0xd
+	.long	0x2f5
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC19
+	.byte	0x9f
+	.uleb128 0x33
+	.long	.LASF1207
+	.value	0x1fd
+	.long	0x32
+	.uleb128 0x23
+	.long	.LLRL158
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x1fe
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x1fe
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x32
+	.long	0x325c
+	.quad	.LBI451
+	.byte	.LVU1071
+	.quad	.LBB451
+	.quad	.LBE451-.LBB451
+	.value	0x1fe
+	.long	0x157a
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST160
+	.long	.LVUS160
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL220
+	.long	0xcf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1295
+	.value	0x1f1
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1670
+	.uleb128 0xa
+	.long	.LASF1208
+	.value	0x1f2
+	.byte	0xd
+	.long	0x2f5
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC19
+	.byte	0x9f
+	.uleb128 0x33
+	.long	.LASF1207
+	.value	0x1f3
+	.long	0x32
+	.uleb128 0x23
+	.long	.LLRL154
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x1f4
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x1f4
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI445
+	.byte	.LVU1043
+	.long	.LLRL155
+	.value	0x1f4
+	.byte	0x24
+	.long	0x1635
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST157
+	.long	.LVUS157
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL215
+	.long	0xc3f
+	.long	0x1653
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL216
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC19
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1296
+	.value	0x1e1
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x175d
+	.uleb128 0xa
+	.long	.LASF1297
+	.value	0x1e2
+	.byte	0x12
+	.long	0xbe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x22
+	.long	.LLRL149
+	.long	0x172b
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x1e3
+	.byte	0xa
+	.long	0x76
+	.long	.LLST150
+	.long	.LVUS150
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI432
+	.byte	.LVU1007
+	.long	.LLRL151
+	.value	0x1e4
+	.byte	0x24
+	.long	0x16f1
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST153
+	.long	.LVUS153
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL207
+	.long	0xc8c
+	.long	0x170f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL208
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL209
+	.long	0xc71
+	.long	0x1748
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL210
+	.long	0xc5b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1298
+	.value	0x1cf
+	.uleb128 0xc
+	.long	.LASF1299
+	.value	0x1ae
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18eb
+	.uleb128 0xa
+	.long	.LASF1300
+	.value	0x1af
+	.byte	0x10
+	.long	0xb6e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x28
+	.string	"buf"
+	.value	0x1c4
+	.byte	0x6
+	.long	0x18eb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x34
+	.long	.LASF1301
+	.value	0x1c5
+	.byte	0x11
+	.long	0xcb9
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI421
+	.byte	.LVU954
+	.long	.LLRL143
+	.value	0x1b1
+	.byte	0x22
+	.long	0x17ee
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI427
+	.byte	.LVU981
+	.long	.LLRL146
+	.value	0x1c7
+	.byte	0x22
+	.long	0x1827
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST148
+	.long	.LVUS148
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL193
+	.long	0xe29
+	.long	0x184b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL195
+	.long	0xe6b
+	.long	0x1869
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL196
+	.long	0xe29
+	.long	0x1894
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL198
+	.long	0xe29
+	.long	0x18b8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL200
+	.long	0xe6b
+	.long	0x18d6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL201
+	.long	0xca8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x18fb
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x4f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1302
+	.value	0x1a3
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x199a
+	.uleb128 0x23
+	.long	.LLRL138
+	.uleb128 0xa
+	.long	.LASF1303
+	.value	0x1a4
+	.byte	0xa
+	.long	0x199a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.uleb128 0xa
+	.long	.LASF1304
+	.value	0x1a4
+	.byte	0x2a
+	.long	0xb6e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -640
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI416
+	.byte	.LVU920
+	.long	.LLRL139
+	.value	0x1a4
+	.byte	0x22
+	.long	0x1976
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST141
+	.long	.LVUS141
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL192
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -640
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x19ab
+	.uleb128 0x45
+	.long	0x3e
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1305
+	.value	0x19c
+	.uleb128 0xc
+	.long	.LASF1306
+	.value	0x17e
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b39
+	.uleb128 0xa
+	.long	.LASF1300
+	.value	0x17f
+	.byte	0x12
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0xa
+	.long	.LASF1307
+	.value	0x191
+	.byte	0x6
+	.long	0x18eb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x34
+	.long	.LASF1308
+	.value	0x192
+	.byte	0x13
+	.long	0xccf
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI405
+	.byte	.LVU865
+	.long	.LLRL132
+	.value	0x181
+	.byte	0x22
+	.long	0x1a3c
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST134
+	.long	.LVUS134
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI411
+	.byte	.LVU893
+	.long	.LLRL135
+	.value	0x194
+	.byte	0x22
+	.long	0x1a75
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST137
+	.long	.LVUS137
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL180
+	.long	0xe29
+	.long	0x1a99
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL182
+	.long	0xe6b
+	.long	0x1ab7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL183
+	.long	0xe29
+	.long	0x1ae2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL185
+	.long	0xe29
+	.long	0x1b06
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL187
+	.long	0xe6b
+	.long	0x1b24
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL188
+	.long	0xcbe
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1309
+	.value	0x172
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c5d
+	.uleb128 0x22
+	.long	.LLRL124
+	.long	0x1bd5
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x173
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x173
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI385
+	.byte	.LVU812
+	.long	.LLRL125
+	.value	0x173
+	.byte	0x24
+	.long	0x1bb8
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST127
+	.long	.LVUS127
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL177
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.quad	.LBB400
+	.quad	.LBE400-.LBB400
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x174
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x174
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -424
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI401
+	.byte	.LVU831
+	.long	.LLRL128
+	.value	0x174
+	.byte	0x24
+	.long	0x1c3f
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST129
+	.long	.LVUS129
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST130
+	.long	.LVUS130
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL179
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -440
+	.byte	0x6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1310
+	.value	0x16b
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cfc
+	.uleb128 0x23
+	.long	.LLRL120
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x16c
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x16c
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI379
+	.byte	.LVU778
+	.long	.LLRL121
+	.value	0x16c
+	.byte	0x24
+	.long	0x1cd8
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST122
+	.long	.LVUS122
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST123
+	.long	.LVUS123
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL175
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -376
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1311
+	.value	0x164
+	.uleb128 0xc
+	.long	.LASF1312
+	.value	0x153
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f18
+	.uleb128 0x28
+	.string	"b"
+	.value	0x154
+	.byte	0x11
+	.long	0xa04
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -408
+	.uleb128 0xa
+	.long	.LASF1313
+	.value	0x155
+	.byte	0xb
+	.long	0x77d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.uleb128 0x22
+	.long	.LLRL109
+	.long	0x1ec6
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x157
+	.byte	0xa
+	.long	0x76
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x35
+	.quad	.LBB372
+	.quad	.LBE372-.LBB372
+	.long	0x1dfc
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x15b
+	.byte	0xe
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x15b
+	.byte	0x32
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -512
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI373
+	.byte	.LVU750
+	.long	.LLRL117
+	.value	0x15b
+	.byte	0x27
+	.long	0x1dc7
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST119
+	.long	.LVUS119
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL166
+	.long	0xd10
+	.long	0x1de6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL169
+	.long	0xcf0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -512
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI360
+	.byte	.LVU713
+	.long	.LLRL111
+	.value	0x159
+	.byte	0x21
+	.long	0x1e35
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST113
+	.long	.LVUS113
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI368
+	.byte	.LVU725
+	.long	.LLRL114
+	.value	0x15a
+	.byte	0x21
+	.long	0x1e6e
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST116
+	.long	.LVUS116
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL160
+	.long	0xd31
+	.long	0x1e86
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL163
+	.long	0xe6b
+	.long	0x1ea4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -1
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL165
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL159
+	.long	0xd43
+	.long	0x1ee4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0xc8
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL170
+	.long	0xcd4
+	.long	0x1f03
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x3e8
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL171
+	.long	0xd7f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1314
+	.value	0x141
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1fc4
+	.uleb128 0xa
+	.long	.LASF1300
+	.value	0x142
+	.byte	0x11
+	.long	0xa04
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI355
+	.byte	.LVU681
+	.long	.LLRL106
+	.value	0x144
+	.byte	0x22
+	.long	0x1f7e
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST108
+	.long	.LVUS108
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL156
+	.long	0xe29
+	.long	0x1fa9
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL158
+	.long	0xe6b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1315
+	.value	0x13a
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2156
+	.uleb128 0x22
+	.long	.LLRL96
+	.long	0x2148
+	.uleb128 0xa
+	.long	.LASF1282
+	.value	0x13b
+	.byte	0xa
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0xa
+	.long	.LASF1283
+	.value	0x13b
+	.byte	0x2e
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x36
+	.long	0x325c
+	.quad	.LBI338
+	.byte	.LVU629
+	.long	.LLRL97
+	.value	0x420
+	.long	0x2042
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x36
+	.long	0x325c
+	.quad	.LBI344
+	.byte	.LVU642
+	.long	.LLRL100
+	.value	0x3b2
+	.long	0x207a
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI348
+	.byte	.LVU652
+	.long	.LLRL103
+	.value	0x13b
+	.byte	0x24
+	.long	0x20b3
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST105
+	.long	.LVUS105
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL141
+	.long	0xd68
+	.long	0x20cb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL145
+	.long	0xe6b
+	.long	0x20e3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL146
+	.long	0xd68
+	.long	0x20fb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL150
+	.long	0xdba
+	.long	0x211a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL153
+	.long	0xf4a
+	.long	0x2133
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL154
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL155
+	.long	0xd5f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1316
+	.value	0x127
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2211
+	.uleb128 0x28
+	.string	"buf"
+	.value	0x128
+	.byte	0x6
+	.long	0x2211
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x28
+	.string	"r"
+	.value	0x129
+	.byte	0x11
+	.long	0xa04
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI331
+	.byte	.LVU595
+	.long	.LLRL93
+	.value	0x129
+	.byte	0x22
+	.long	0x21ca
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST95
+	.long	.LVUS95
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL138
+	.long	0xdba
+	.long	0x21ef
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.uleb128 0x37
+	.quad	.LVL139
+	.long	0xd91
+	.uleb128 0x9
+	.quad	.LVL140
+	.long	0xd7f
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x2221
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x7f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1317
+	.value	0x117
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2325
+	.uleb128 0xa
+	.long	.LASF1235
+	.value	0x118
+	.byte	0xc
+	.long	0x96c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x38
+	.string	"c"
+	.value	0x119
+	.byte	0x7
+	.long	0xc0
+	.uleb128 0x38
+	.string	"d"
+	.value	0x11a
+	.byte	0xb
+	.long	0xa97
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI305
+	.byte	.LVU552
+	.long	.LLRL87
+	.value	0x119
+	.byte	0x22
+	.long	0x229b
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI322
+	.byte	.LVU570
+	.long	.LLRL90
+	.value	0x11a
+	.byte	0x26
+	.long	0x22d4
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL131
+	.long	0xdba
+	.long	0x22f2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL134
+	.long	0xdba
+	.long	0x2310
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL135
+	.long	0xda8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1319
+	.value	0x10a
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x23d7
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x10b
+	.byte	0x7
+	.long	0xc0
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x22
+	.long	.LLRL83
+	.long	0x23c9
+	.uleb128 0xa
+	.long	.LASF1320
+	.value	0x10b
+	.byte	0x20
+	.long	0x199a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.uleb128 0xb
+	.long	0x325c
+	.quad	.LBI299
+	.byte	.LVU511
+	.long	.LLRL84
+	.value	0x10b
+	.byte	0x18
+	.long	0x23a6
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST86
+	.long	.LVUS86
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL126
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL128
+	.long	0xe87
+	.byte	0
+	.uleb128 0x47
+	.long	.LASF1343
+	.byte	0x1
+	.byte	0xfa
+	.byte	0x6
+	.long	0x23ed
+	.uleb128 0x18
+	.string	"c"
+	.byte	0xfb
+	.byte	0x7
+	.long	0xc0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1321
+	.byte	0xe4
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2492
+	.uleb128 0x1d
+	.string	"c"
+	.byte	0xe5
+	.byte	0x7
+	.long	0xc0
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x39
+	.long	0x325c
+	.quad	.LBI295
+	.byte	.LVU488
+	.quad	.LBB295
+	.quad	.LBE295-.LBB295
+	.byte	0xe5
+	.byte	0x18
+	.long	0x245e
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST81
+	.long	.LVUS81
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL121
+	.long	0xdba
+	.long	0x2484
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	msg
+	.byte	0
+	.uleb128 0x2b
+	.quad	.LVL123
+	.long	0xe87
+	.byte	0
+	.uleb128 0x48
+	.long	.LASF1322
+	.byte	0x1
+	.byte	0xdd
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1323
+	.byte	0xa8
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2699
+	.uleb128 0x2c
+	.long	.LASF1324
+	.byte	0xa9
+	.byte	0x6
+	.long	0x2b4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -500
+	.uleb128 0x2c
+	.long	.LASF1300
+	.byte	0xaa
+	.byte	0x14
+	.long	0x8ef
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -480
+	.uleb128 0x1a
+	.string	"e"
+	.byte	0xc1
+	.byte	0xc
+	.long	0x7ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -504
+	.uleb128 0x1d
+	.string	"ec"
+	.byte	0xcb
+	.byte	0xa
+	.long	0x45
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0x35
+	.quad	.LBB289
+	.quad	.LBE289-.LBB289
+	.long	0x2581
+	.uleb128 0x2c
+	.long	.LASF1282
+	.byte	0xcd
+	.byte	0xe
+	.long	0x105e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x2c
+	.long	.LASF1283
+	.byte	0xcd
+	.byte	0x32
+	.long	0x84b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.uleb128 0x2d
+	.long	0x325c
+	.quad	.LBI290
+	.byte	.LVU470
+	.long	.LLRL76
+	.byte	0xcd
+	.byte	0x27
+	.long	0x255e
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x37
+	.quad	.LVL115
+	.long	0xdd5
+	.uleb128 0x9
+	.quad	.LVL118
+	.long	0xdba
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -392
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x325c
+	.quad	.LBI281
+	.byte	.LVU423
+	.long	.LLRL70
+	.byte	0xac
+	.byte	0x22
+	.long	0x25b9
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST72
+	.long	.LVUS72
+	.byte	0
+	.uleb128 0x2d
+	.long	0x325c
+	.quad	.LBI285
+	.byte	.LVU439
+	.long	.LLRL73
+	.byte	0xc2
+	.byte	0x22
+	.long	0x25f1
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST75
+	.long	.LVUS75
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL107
+	.long	0xe29
+	.long	0x261c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL109
+	.long	0xe6b
+	.long	0x263a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x37
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL110
+	.long	0xe29
+	.long	0x2665
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL112
+	.long	0xed5
+	.long	0x2684
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -504
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL113
+	.long	0xdec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1325
+	.byte	0x9b
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x290b
+	.uleb128 0x18
+	.string	"t1a"
+	.byte	0x9c
+	.byte	0x7
+	.long	0xc0
+	.uleb128 0x18
+	.string	"t2a"
+	.byte	0x9d
+	.byte	0xb
+	.long	0xa97
+	.uleb128 0x18
+	.string	"t3a"
+	.byte	0x9e
+	.byte	0xb
+	.long	0xaa9
+	.uleb128 0x18
+	.string	"t1b"
+	.byte	0x9f
+	.byte	0x7
+	.long	0xc0
+	.uleb128 0x18
+	.string	"t2b"
+	.byte	0xa0
+	.byte	0xb
+	.long	0xa97
+	.uleb128 0x18
+	.string	"t3b"
+	.byte	0xa1
+	.byte	0xb
+	.long	0xaa9
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI255
+	.byte	.LVU308
+	.long	.LLRL52
+	.byte	0x9c
+	.value	0x100
+	.long	0x2730
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI263
+	.byte	.LVU322
+	.long	.LLRL55
+	.byte	0x9d
+	.value	0x110
+	.long	0x2769
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST57
+	.long	.LVUS57
+	.byte	0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI267
+	.byte	.LVU343
+	.long	.LLRL58
+	.byte	0x9e
+	.value	0x110
+	.long	0x27a2
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST60
+	.long	.LVUS60
+	.byte	0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI271
+	.byte	.LVU362
+	.long	.LLRL61
+	.byte	0x9f
+	.value	0x100
+	.long	0x27db
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST63
+	.long	.LVUS63
+	.byte	0
+	.uleb128 0x49
+	.long	0x325c
+	.quad	.LBI275
+	.byte	.LVU382
+	.quad	.LBB275
+	.quad	.LBE275-.LBB275
+	.byte	0x1
+	.byte	0xa0
+	.value	0x110
+	.long	0x2821
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST64
+	.long	.LVUS64
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI277
+	.byte	.LVU396
+	.long	.LLRL66
+	.byte	0xa1
+	.value	0x110
+	.long	0x285a
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST67
+	.long	.LVUS67
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST68
+	.long	.LVUS68
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL91
+	.long	0xe6b
+	.long	0x2878
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL95
+	.long	0xe6b
+	.long	0x2896
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -504
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL98
+	.long	0xe6b
+	.long	0x28b4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL101
+	.long	0xe6b
+	.long	0x28d2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL104
+	.long	0xe6b
+	.long	0x28f0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL106
+	.long	0xe6b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1326
+	.byte	0x8f
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2991
+	.uleb128 0x1a
+	.string	"s"
+	.byte	0x90
+	.byte	0x6
+	.long	0x2b4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x18
+	.string	"t"
+	.byte	0x91
+	.byte	0x7
+	.long	0xc0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI250
+	.byte	.LVU274
+	.long	.LLRL49
+	.byte	0x91
+	.value	0x119
+	.long	0x2976
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL88
+	.long	0xe6b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1327
+	.byte	0x81
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a86
+	.uleb128 0x1a
+	.string	"s1"
+	.byte	0x82
+	.byte	0xa
+	.long	0x2a86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x18
+	.string	"t1"
+	.byte	0x83
+	.byte	0xb
+	.long	0xa97
+	.uleb128 0x1a
+	.string	"s2"
+	.byte	0x85
+	.byte	0xa
+	.long	0x2a96
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x18
+	.string	"t2"
+	.byte	0x86
+	.byte	0xb
+	.long	0xaa9
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI237
+	.byte	.LVU238
+	.long	.LLRL43
+	.byte	0x83
+	.value	0x123
+	.long	0x2a16
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI245
+	.byte	.LVU252
+	.long	.LLRL46
+	.byte	0x86
+	.value	0x123
+	.long	0x2a4f
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL82
+	.long	0xe6b
+	.long	0x2a6c
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL85
+	.long	0xe6b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x2ff
+	.long	0x2a96
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x13
+	.byte	0
+	.uleb128 0x12
+	.long	0x310
+	.long	0x2aa6
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x13
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1328
+	.byte	0x75
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2b86
+	.uleb128 0x1a
+	.string	"s"
+	.byte	0x76
+	.byte	0x6
+	.long	0x2b4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x1d
+	.string	"t"
+	.byte	0x77
+	.byte	0x7
+	.long	0xc0
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x31
+	.long	.LASF1329
+	.long	0x2b96
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI230
+	.byte	.LVU213
+	.long	.LLRL40
+	.byte	0x77
+	.value	0x108
+	.long	0x2b2c
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL78
+	.long	0xe6b
+	.long	0x2b4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x35
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL79
+	.long	0xe4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x78
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0xcc
+	.long	0x2b96
+	.uleb128 0x17
+	.long	0x3e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x16
+	.long	0x2b86
+	.uleb128 0x4a
+	.long	.LASF1331
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x6
+	.byte	0x1
+	.uleb128 0x29
+	.long	.LASF1333
+	.byte	0x5f
+	.long	0x2c4
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2d4a
+	.uleb128 0x2a
+	.string	"dir"
+	.byte	0x5f
+	.byte	0x21
+	.long	0x2f5
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x19
+	.long	.LASF1216
+	.byte	0x5f
+	.byte	0x32
+	.long	0x2f5
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5f
+	.byte	0x41
+	.long	0x45
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x1d
+	.string	"s"
+	.byte	0x61
+	.byte	0xa
+	.long	0x2d4a
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x4b
+	.long	0x3e
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x2d
+	.long	0x325c
+	.quad	.LBI198
+	.byte	.LVU163
+	.long	.LLRL33
+	.byte	0x61
+	.byte	0x22
+	.long	0x2c53
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI216
+	.byte	.LVU183
+	.long	.LLRL36
+	.byte	0x62
+	.value	0x120
+	.long	0x2c8c
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST38
+	.long	.LVUS38
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL61
+	.long	0xf4a
+	.long	0x2caa
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL62
+	.long	0xf4a
+	.long	0x2cc2
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL63
+	.long	0xf2e
+	.long	0x2cdd
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -164
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL68
+	.long	0xf4a
+	.long	0x2cfb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x7e
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7d
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL69
+	.long	0xf4a
+	.long	0x2d13
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7c
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL70
+	.long	0xf2e
+	.long	0x2d2e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x5
+	.byte	0x91
+	.sleb128 -164
+	.byte	0x94
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL71
+	.long	0xf12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0xc5
+	.long	0x2d5d
+	.uleb128 0x4c
+	.long	0x3e
+	.long	0x2c0e
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1334
+	.byte	0x4e
+	.long	0x2c4
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ecd
+	.uleb128 0x2a
+	.string	"dir"
+	.byte	0x4e
+	.byte	0x21
+	.long	0x2f5
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x19
+	.long	.LASF1216
+	.byte	0x4e
+	.byte	0x32
+	.long	0x2f5
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x4e
+	.byte	0x41
+	.long	0x45
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1d
+	.string	"f"
+	.byte	0x50
+	.byte	0xb
+	.long	0x2c4
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x1a
+	.string	"e"
+	.byte	0x51
+	.byte	0x10
+	.long	0x7ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -156
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x52
+	.byte	0xb
+	.long	0xc0
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x39
+	.long	0x325c
+	.quad	.LBI192
+	.byte	.LVU120
+	.quad	.LBB192
+	.quad	.LBE192-.LBB192
+	.byte	0x52
+	.byte	0x1d
+	.long	0x2e2a
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL47
+	.long	0xf4a
+	.long	0x2e4a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL48
+	.long	0xf4a
+	.long	0x2e62
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL49
+	.long	0xef6
+	.long	0x2e7a
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL50
+	.long	0xed5
+	.long	0x2e93
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -156
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL52
+	.long	0xf12
+	.long	0x2eb8
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL54
+	.long	0xe87
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1335
+	.byte	0x3b
+	.long	0x2c4
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3003
+	.uleb128 0x2a
+	.string	"dir"
+	.byte	0x3c
+	.byte	0x15
+	.long	0x78f
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x19
+	.long	.LASF1216
+	.byte	0x3c
+	.byte	0x2a
+	.long	0x78f
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x3c
+	.byte	0x39
+	.long	0x45
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0x1a
+	.string	"e"
+	.byte	0x3e
+	.byte	0x10
+	.long	0x7ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -204
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x3f
+	.byte	0xb
+	.long	0xc0
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI185
+	.byte	.LVU86
+	.long	.LLRL17
+	.byte	0x3f
+	.value	0x103
+	.long	0x2f7e
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST19
+	.long	.LVUS19
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL33
+	.long	0xeba
+	.long	0x2f9e
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL34
+	.long	0xeba
+	.long	0x2fb6
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL35
+	.long	0xef6
+	.long	0x2fce
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL36
+	.long	0xed5
+	.long	0x2fe7
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -204
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL37
+	.long	0xf12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1336
+	.byte	0x2b
+	.long	0x2c4
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3139
+	.uleb128 0x2a
+	.string	"dir"
+	.byte	0x2c
+	.byte	0x11
+	.long	0x2f5
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x19
+	.long	.LASF1216
+	.byte	0x2c
+	.byte	0x22
+	.long	0x2f5
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x2c
+	.byte	0x31
+	.long	0x45
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x1a
+	.string	"e"
+	.byte	0x2e
+	.byte	0x10
+	.long	0x7ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -204
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x2f
+	.byte	0xb
+	.long	0xc0
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI179
+	.byte	.LVU49
+	.long	.LLRL10
+	.byte	0x2f
+	.value	0x103
+	.long	0x30b4
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL18
+	.long	0xf4a
+	.long	0x30d4
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL19
+	.long	0xf4a
+	.long	0x30ec
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL20
+	.long	0xef6
+	.long	0x3104
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL21
+	.long	0xed5
+	.long	0x311d
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -204
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL22
+	.long	0xf12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1337
+	.byte	0x23
+	.long	0x2c4
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3237
+	.uleb128 0x2a
+	.string	"dir"
+	.byte	0x23
+	.byte	0x21
+	.long	0x2f5
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x19
+	.long	.LASF1216
+	.byte	0x23
+	.byte	0x32
+	.long	0x2f5
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x23
+	.byte	0x41
+	.long	0x45
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x14
+	.long	0x325c
+	.quad	.LBI173
+	.byte	.LVU17
+	.long	.LLRL3
+	.byte	0x25
+	.value	0x105
+	.long	0x31cb
+	.uleb128 0x6
+	.long	0x3280
+	.uleb128 0x2
+	.long	0x3276
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x2
+	.long	0x326c
+	.long	.LLST5
+	.long	.LVUS5
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL6
+	.long	0xf4a
+	.long	0x31eb
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL7
+	.long	0xf4a
+	.long	0x3203
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LVL8
+	.long	0xf2e
+	.long	0x321b
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LVL9
+	.long	0xf12
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1338
+	.value	0x151
+	.byte	0x13
+	.long	0x6b9
+	.long	0x325c
+	.uleb128 0x2e
+	.string	"x"
+	.value	0x151
+	.byte	0x31
+	.long	0x2ef
+	.uleb128 0x2e
+	.string	"n"
+	.value	0x151
+	.byte	0x3b
+	.long	0x32
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1339
+	.value	0x12b
+	.byte	0x1c
+	.long	0x686
+	.long	0x328e
+	.uleb128 0x2e
+	.string	"s"
+	.value	0x12c
+	.byte	0x12
+	.long	0x686
+	.uleb128 0x2e
+	.string	"x"
+	.value	0x12d
+	.byte	0x11
+	.long	0x2ef
+	.uleb128 0x4d
+	.long	.LASF1340
+	.byte	0x2
+	.value	0x12e
+	.byte	0x20
+	.long	0x493
+	.byte	0
+	.uleb128 0x4e
+	.long	0x2b9b
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 36
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x21
+	.sleb128 315
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS186:
+	.uleb128 .LVU1242
+	.uleb128 .LVU1245
+	.uleb128 .LVU1245
+	.uleb128 .LVU1270
+	.uleb128 .LVU1270
+	.uleb128 .LVU1273
+.LLST186:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL256-.Ltext0
+	.uleb128 .LVL258-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS188:
+	.uleb128 .LVU1244
+	.uleb128 .LVU1245
+	.uleb128 .LVU1245
+	.uleb128 .LVU1264
+	.uleb128 .LVU1264
+	.uleb128 .LVU1265
+	.uleb128 .LVU1265
+	.uleb128 .LVU1271
+.LLST188:
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 0x5
+	.byte	0x33
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL254-.Ltext0
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 0x5
+	.byte	0x34
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL255-.Ltext0
+	.uleb128 .LVL257-.Ltext0
+	.uleb128 0x5
+	.byte	0x33
+	.byte	0x76
+	.sleb128 0
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS191:
+	.uleb128 .LVU1256
+	.uleb128 .LVU1260
+.LLST191:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS192:
+	.uleb128 .LVU1256
+	.uleb128 .LVU1260
+.LLST192:
+	.byte	0x4
+	.uleb128 .LVL252-.Ltext0
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS178:
+	.uleb128 .LVU1214
+	.uleb128 .LVU1231
+.LLST178:
+	.byte	0x4
+	.uleb128 .LVL245-.Ltext0
+	.uleb128 .LVL249-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS179:
+	.uleb128 .LVU1217
+	.uleb128 .LVU1229
+.LLST179:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL248-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS181:
+	.uleb128 .LVU1208
+	.uleb128 .LVU1211
+.LLST181:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS182:
+	.uleb128 .LVU1208
+	.uleb128 .LVU1211
+.LLST182:
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS184:
+	.uleb128 .LVU1224
+	.uleb128 .LVU1227
+.LLST184:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS185:
+	.uleb128 .LVU1224
+	.uleb128 .LVU1227
+.LLST185:
+	.byte	0x4
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 .LVL247-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS170:
+	.uleb128 .LVU1165
+	.uleb128 .LVU1186
+.LLST170:
+	.byte	0x4
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS171:
+	.uleb128 .LVU1168
+	.uleb128 .LVU1181
+.LLST171:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL239-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS173:
+	.uleb128 .LVU1158
+	.uleb128 .LVU1162
+.LLST173:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS174:
+	.uleb128 .LVU1158
+	.uleb128 .LVU1162
+.LLST174:
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS176:
+	.uleb128 .LVU1174
+	.uleb128 .LVU1179
+.LLST176:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS177:
+	.uleb128 .LVU1174
+	.uleb128 .LVU1179
+.LLST177:
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS168:
+	.uleb128 .LVU1127
+	.uleb128 .LVU1134
+.LLST168:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS169:
+	.uleb128 .LVU1127
+	.uleb128 .LVU1131
+	.uleb128 .LVU1131
+	.uleb128 .LVU1134
+.LLST169:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS165:
+	.uleb128 .LVU1111
+	.uleb128 .LVU1118
+.LLST165:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS166:
+	.uleb128 .LVU1111
+	.uleb128 .LVU1115
+	.uleb128 .LVU1115
+	.uleb128 .LVU1118
+.LLST166:
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -96
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS162:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1100
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC20
+	.byte	0x9f
+	.byte	0
+.LVUS163:
+	.uleb128 .LVU1096
+	.uleb128 .LVU1100
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS159:
+	.uleb128 .LVU1071
+	.uleb128 .LVU1075
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC20
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 .LVU1071
+	.uleb128 .LVU1075
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS156:
+	.uleb128 .LVU1043
+	.uleb128 .LVU1048
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC18
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 .LVU1043
+	.uleb128 .LVU1048
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU1004
+	.uleb128 .LVU1005
+	.uleb128 .LVU1005
+	.uleb128 .LVU1013
+	.uleb128 .LVU1013
+	.uleb128 .LVU1019
+	.uleb128 .LVU1019
+	.uleb128 .LVU1022
+	.uleb128 .LVU1022
+	.uleb128 .LVU1026
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 .LVL207-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL207-1-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x3
+	.byte	0x73
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS152:
+	.uleb128 .LVU1007
+	.uleb128 .LVU1017
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC17
+	.byte	0x9f
+	.byte	0
+.LVUS153:
+	.uleb128 .LVU1007
+	.uleb128 .LVU1010
+	.uleb128 .LVU1010
+	.uleb128 .LVU1017
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -128
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU975
+	.uleb128 .LVU978
+	.uleb128 .LVU978
+	.uleb128 .LVU991
+	.uleb128 .LVU991
+	.uleb128 0
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 .LVL198-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL198-1-.Ltext0
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LFE34-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -176
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 .LVU954
+	.uleb128 .LVU959
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU954
+	.uleb128 .LVU959
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU981
+	.uleb128 .LVU986
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU981
+	.uleb128 .LVU986
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU920
+	.uleb128 .LVU924
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU920
+	.uleb128 .LVU924
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU886
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 .LVU903
+	.uleb128 .LVU903
+	.uleb128 0
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL185-1-.Ltext0
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LFE31-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -168
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU865
+	.uleb128 .LVU870
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU865
+	.uleb128 .LVU870
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU893
+	.uleb128 .LVU898
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU893
+	.uleb128 .LVU898
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU812
+	.uleb128 .LVU815
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU812
+	.uleb128 .LVU815
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU831
+	.uleb128 .LVU834
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU831
+	.uleb128 .LVU834
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+.LVUS122:
+	.uleb128 .LVU778
+	.uleb128 .LVU783
+.LLST122:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU778
+	.uleb128 .LVU783
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU709
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU718
+	.uleb128 .LVU718
+	.uleb128 .LVU722
+	.uleb128 .LVU722
+	.uleb128 .LVU758
+	.uleb128 .LVU758
+	.uleb128 .LVU762
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL163-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL163-1-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU750
+	.uleb128 .LVU754
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC16
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU750
+	.uleb128 .LVU754
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU713
+	.uleb128 .LVU720
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC14
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU713
+	.uleb128 .LVU720
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU725
+	.uleb128 .LVU731
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC15
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU725
+	.uleb128 .LVU731
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU681
+	.uleb128 .LVU687
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU681
+	.uleb128 .LVU687
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL156-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU629
+	.uleb128 .LVU634
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC12
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU629
+	.uleb128 .LVU632
+	.uleb128 .LVU632
+	.uleb128 .LVU634
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU642
+	.uleb128 .LVU647
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU642
+	.uleb128 .LVU645
+	.uleb128 .LVU645
+	.uleb128 .LVU647
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU652
+	.uleb128 .LVU656
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC13
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU652
+	.uleb128 .LVU656
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU595
+	.uleb128 .LVU599
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU595
+	.uleb128 .LVU599
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU552
+	.uleb128 .LVU557
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU552
+	.uleb128 .LVU557
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU570
+	.uleb128 .LVU575
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC11
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU570
+	.uleb128 .LVU575
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU520
+	.uleb128 .LVU524
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU511
+	.uleb128 .LVU517
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU511
+	.uleb128 .LVU517
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU495
+	.uleb128 .LVU499
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL123-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU488
+	.uleb128 .LVU492
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU488
+	.uleb128 .LVU492
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU452
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU467
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU470
+	.uleb128 .LVU474
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC10
+	.byte	0x9f
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU470
+	.uleb128 .LVU474
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU423
+	.uleb128 .LVU429
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC7
+	.byte	0x9f
+	.byte	0
+.LVUS72:
+	.uleb128 .LVU423
+	.uleb128 .LVU429
+.LLST72:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC9
+	.byte	0x9f
+	.byte	0
+.LVUS75:
+	.uleb128 .LVU439
+	.uleb128 .LVU445
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU308
+	.uleb128 .LVU313
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU308
+	.uleb128 .LVU313
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU322
+	.uleb128 .LVU330
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU322
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU330
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -504
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU343
+	.uleb128 .LVU348
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU343
+	.uleb128 .LVU348
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU362
+	.uleb128 .LVU368
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU362
+	.uleb128 .LVU368
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU382
+	.uleb128 .LVU386
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU382
+	.uleb128 .LVU386
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU396
+	.uleb128 .LVU399
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU396
+	.uleb128 .LVU399
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU274
+	.uleb128 .LVU278
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU238
+	.uleb128 .LVU242
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU238
+	.uleb128 .LVU242
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU252
+	.uleb128 .LVU257
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU252
+	.uleb128 .LVU257
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU219
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 0
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LFE14-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC3
+	.byte	0x9f
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU213
+	.uleb128 .LVU217
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS29:
+	.uleb128 0
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS30:
+	.uleb128 0
+	.uleb128 .LVU153
+	.uleb128 .LVU153
+	.uleb128 .LVU195
+	.uleb128 .LVU195
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 0
+	.uleb128 .LVU168
+	.uleb128 .LVU168
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL61-1-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -164
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LFE12-.Ltext0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -156
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU181
+	.uleb128 .LVU194
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+.LVUS28:
+	.uleb128 .LVU175
+	.uleb128 .LVU177
+	.uleb128 .LVU177
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU189
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL68-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU163
+	.uleb128 .LVU166
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC0
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU163
+	.uleb128 .LVU166
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU183
+	.uleb128 .LVU186
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC0
+	.byte	0x9f
+	.byte	0
+.LVUS38:
+	.uleb128 .LVU183
+	.uleb128 .LVU186
+.LLST38:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x5e
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 0
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 0
+	.uleb128 .LVU126
+	.uleb128 .LVU126
+	.uleb128 .LVU137
+	.uleb128 .LVU137
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL47-1-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU107
+	.uleb128 .LVU133
+	.uleb128 .LVU134
+	.uleb128 .LVU135
+	.uleb128 .LVU135
+	.uleb128 0
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL54-1-.Ltext0
+	.uleb128 .LFE11-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU128
+	.uleb128 .LVU138
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU120
+	.uleb128 .LVU124
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC0
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU120
+	.uleb128 .LVU124
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS13:
+	.uleb128 0
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU95
+	.uleb128 .LVU95
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL33-1-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU77
+	.uleb128 .LVU77
+	.uleb128 .LVU104
+	.uleb128 .LVU104
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU78
+	.uleb128 .LVU78
+	.uleb128 .LVU103
+	.uleb128 .LVU103
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LFE10-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU96
+	.uleb128 .LVU100
+	.uleb128 .LVU101
+	.uleb128 .LVU102
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU86
+	.uleb128 .LVU93
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC2
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU86
+	.uleb128 .LVU93
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS6:
+	.uleb128 0
+	.uleb128 .LVU44
+	.uleb128 .LVU44
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL18-1-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU40
+	.uleb128 .LVU40
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU41
+	.uleb128 .LVU41
+	.uleb128 .LVU66
+	.uleb128 .LVU66
+	.uleb128 0
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LFE9-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS9:
+	.uleb128 .LVU59
+	.uleb128 .LVU63
+	.uleb128 .LVU64
+	.uleb128 .LVU65
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-1-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 64
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC0
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU49
+	.uleb128 .LVU56
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-1-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 .LVU29
+	.uleb128 .LVU29
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LFE8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU17
+	.uleb128 .LVU24
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0xa
+	.byte	0x3
+	.quad	.LC0
+	.byte	0x9f
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU17
+	.uleb128 .LVU24
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB177-.Ltext0
+	.uleb128 .LBE177-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB178-.Ltext0
+	.uleb128 .LBE178-.Ltext0
+	.byte	0
+.LLRL10:
+	.byte	0x4
+	.uleb128 .LBB179-.Ltext0
+	.uleb128 .LBE179-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0
+.LLRL17:
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB189-.Ltext0
+	.uleb128 .LBE189-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0
+.LLRL33:
+	.byte	0x4
+	.uleb128 .LBB198-.Ltext0
+	.uleb128 .LBE198-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB205-.Ltext0
+	.uleb128 .LBE205-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0
+.LLRL40:
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB237-.Ltext0
+	.uleb128 .LBE237-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB240-.Ltext0
+	.uleb128 .LBE240-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB245-.Ltext0
+	.uleb128 .LBE245-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB250-.Ltext0
+	.uleb128 .LBE250-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0
+.LLRL52:
+	.byte	0x4
+	.uleb128 .LBB255-.Ltext0
+	.uleb128 .LBE255-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB260-.Ltext0
+	.uleb128 .LBE260-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB261-.Ltext0
+	.uleb128 .LBE261-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB262-.Ltext0
+	.uleb128 .LBE262-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB267-.Ltext0
+	.uleb128 .LBE267-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB271-.Ltext0
+	.uleb128 .LBE271-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB274-.Ltext0
+	.uleb128 .LBE274-.Ltext0
+	.byte	0
+.LLRL66:
+	.byte	0x4
+	.uleb128 .LBB277-.Ltext0
+	.uleb128 .LBE277-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB280-.Ltext0
+	.uleb128 .LBE280-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB281-.Ltext0
+	.uleb128 .LBE281-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB284-.Ltext0
+	.uleb128 .LBE284-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB285-.Ltext0
+	.uleb128 .LBE285-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB288-.Ltext0
+	.uleb128 .LBE288-.Ltext0
+	.byte	0
+.LLRL76:
+	.byte	0x4
+	.uleb128 .LBB290-.Ltext0
+	.uleb128 .LBE290-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB293-.Ltext0
+	.uleb128 .LBE293-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB298-.Ltext0
+	.uleb128 .LBE298-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB303-.Ltext0
+	.uleb128 .LBE303-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB299-.Ltext0
+	.uleb128 .LBE299-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB302-.Ltext0
+	.uleb128 .LBE302-.Ltext0
+	.byte	0
+.LLRL87:
+	.byte	0x4
+	.uleb128 .LBB305-.Ltext0
+	.uleb128 .LBE305-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB311-.Ltext0
+	.uleb128 .LBE311-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB312-.Ltext0
+	.uleb128 .LBE312-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB313-.Ltext0
+	.uleb128 .LBE313-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB314-.Ltext0
+	.uleb128 .LBE314-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB322-.Ltext0
+	.uleb128 .LBE322-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB327-.Ltext0
+	.uleb128 .LBE327-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB328-.Ltext0
+	.uleb128 .LBE328-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB329-.Ltext0
+	.uleb128 .LBE329-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB331-.Ltext0
+	.uleb128 .LBE331-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB334-.Ltext0
+	.uleb128 .LBE334-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB337-.Ltext0
+	.uleb128 .LBE337-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB352-.Ltext0
+	.uleb128 .LBE352-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB353-.Ltext0
+	.uleb128 .LBE353-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB354-.Ltext0
+	.uleb128 .LBE354-.Ltext0
+	.byte	0
+.LLRL97:
+	.byte	0x4
+	.uleb128 .LBB338-.Ltext0
+	.uleb128 .LBE338-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB342-.Ltext0
+	.uleb128 .LBE342-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB343-.Ltext0
+	.uleb128 .LBE343-.Ltext0
+	.byte	0
+.LLRL100:
+	.byte	0x4
+	.uleb128 .LBB344-.Ltext0
+	.uleb128 .LBE344-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB347-.Ltext0
+	.uleb128 .LBE347-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB348-.Ltext0
+	.uleb128 .LBE348-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB351-.Ltext0
+	.uleb128 .LBE351-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB355-.Ltext0
+	.uleb128 .LBE355-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB358-.Ltext0
+	.uleb128 .LBE358-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB359-.Ltext0
+	.uleb128 .LBE359-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB377-.Ltext0
+	.uleb128 .LBE377-.Ltext0
+	.byte	0
+.LLRL111:
+	.byte	0x4
+	.uleb128 .LBB360-.Ltext0
+	.uleb128 .LBE360-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB365-.Ltext0
+	.uleb128 .LBE365-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB366-.Ltext0
+	.uleb128 .LBE366-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB367-.Ltext0
+	.uleb128 .LBE367-.Ltext0
+	.byte	0
+.LLRL114:
+	.byte	0x4
+	.uleb128 .LBB368-.Ltext0
+	.uleb128 .LBE368-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB371-.Ltext0
+	.uleb128 .LBE371-.Ltext0
+	.byte	0
+.LLRL117:
+	.byte	0x4
+	.uleb128 .LBB373-.Ltext0
+	.uleb128 .LBE373-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB376-.Ltext0
+	.uleb128 .LBE376-.Ltext0
+	.byte	0
+.LLRL120:
+	.byte	0x4
+	.uleb128 .LBB378-.Ltext0
+	.uleb128 .LBE378-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB383-.Ltext0
+	.uleb128 .LBE383-.Ltext0
+	.byte	0
+.LLRL121:
+	.byte	0x4
+	.uleb128 .LBB379-.Ltext0
+	.uleb128 .LBE379-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB382-.Ltext0
+	.uleb128 .LBE382-.Ltext0
+	.byte	0
+.LLRL124:
+	.byte	0x4
+	.uleb128 .LBB384-.Ltext0
+	.uleb128 .LBE384-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB393-.Ltext0
+	.uleb128 .LBE393-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB394-.Ltext0
+	.uleb128 .LBE394-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB395-.Ltext0
+	.uleb128 .LBE395-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB396-.Ltext0
+	.uleb128 .LBE396-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB397-.Ltext0
+	.uleb128 .LBE397-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB398-.Ltext0
+	.uleb128 .LBE398-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB399-.Ltext0
+	.uleb128 .LBE399-.Ltext0
+	.byte	0
+.LLRL125:
+	.byte	0x4
+	.uleb128 .LBB385-.Ltext0
+	.uleb128 .LBE385-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB390-.Ltext0
+	.uleb128 .LBE390-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB391-.Ltext0
+	.uleb128 .LBE391-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB392-.Ltext0
+	.uleb128 .LBE392-.Ltext0
+	.byte	0
+.LLRL128:
+	.byte	0x4
+	.uleb128 .LBB401-.Ltext0
+	.uleb128 .LBE401-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB404-.Ltext0
+	.uleb128 .LBE404-.Ltext0
+	.byte	0
+.LLRL132:
+	.byte	0x4
+	.uleb128 .LBB405-.Ltext0
+	.uleb128 .LBE405-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB409-.Ltext0
+	.uleb128 .LBE409-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB410-.Ltext0
+	.uleb128 .LBE410-.Ltext0
+	.byte	0
+.LLRL135:
+	.byte	0x4
+	.uleb128 .LBB411-.Ltext0
+	.uleb128 .LBE411-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB414-.Ltext0
+	.uleb128 .LBE414-.Ltext0
+	.byte	0
+.LLRL138:
+	.byte	0x4
+	.uleb128 .LBB415-.Ltext0
+	.uleb128 .LBE415-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB420-.Ltext0
+	.uleb128 .LBE420-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB416-.Ltext0
+	.uleb128 .LBE416-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB419-.Ltext0
+	.uleb128 .LBE419-.Ltext0
+	.byte	0
+.LLRL143:
+	.byte	0x4
+	.uleb128 .LBB421-.Ltext0
+	.uleb128 .LBE421-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB425-.Ltext0
+	.uleb128 .LBE425-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB426-.Ltext0
+	.uleb128 .LBE426-.Ltext0
+	.byte	0
+.LLRL146:
+	.byte	0x4
+	.uleb128 .LBB427-.Ltext0
+	.uleb128 .LBE427-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB430-.Ltext0
+	.uleb128 .LBE430-.Ltext0
+	.byte	0
+.LLRL149:
+	.byte	0x4
+	.uleb128 .LBB431-.Ltext0
+	.uleb128 .LBE431-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB442-.Ltext0
+	.uleb128 .LBE442-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB443-.Ltext0
+	.uleb128 .LBE443-.Ltext0
+	.byte	0
+.LLRL151:
+	.byte	0x4
+	.uleb128 .LBB432-.Ltext0
+	.uleb128 .LBE432-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB438-.Ltext0
+	.uleb128 .LBE438-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB439-.Ltext0
+	.uleb128 .LBE439-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB440-.Ltext0
+	.uleb128 .LBE440-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB441-.Ltext0
+	.uleb128 .LBE441-.Ltext0
+	.byte	0
+.LLRL154:
+	.byte	0x4
+	.uleb128 .LBB444-.Ltext0
+	.uleb128 .LBE444-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB449-.Ltext0
+	.uleb128 .LBE449-.Ltext0
+	.byte	0
+.LLRL155:
+	.byte	0x4
+	.uleb128 .LBB445-.Ltext0
+	.uleb128 .LBE445-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB448-.Ltext0
+	.uleb128 .LBE448-.Ltext0
+	.byte	0
+.LLRL158:
+	.byte	0x4
+	.uleb128 .LBB450-.Ltext0
+	.uleb128 .LBE450-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB453-.Ltext0
+	.uleb128 .LBE453-.Ltext0
+	.byte	0
+.LLRL161:
+	.byte	0x4
+	.uleb128 .LBB454-.Ltext0
+	.uleb128 .LBE454-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB457-.Ltext0
+	.uleb128 .LBE457-.Ltext0
+	.byte	0
+.LLRL164:
+	.byte	0x4
+	.uleb128 .LBB458-.Ltext0
+	.uleb128 .LBE458-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB461-.Ltext0
+	.uleb128 .LBE461-.Ltext0
+	.byte	0
+.LLRL167:
+	.byte	0x4
+	.uleb128 .LBB463-.Ltext0
+	.uleb128 .LBE463-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB466-.Ltext0
+	.uleb128 .LBE466-.Ltext0
+	.byte	0
+.LLRL172:
+	.byte	0x4
+	.uleb128 .LBB468-.Ltext0
+	.uleb128 .LBE468-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB473-.Ltext0
+	.uleb128 .LBE473-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB474-.Ltext0
+	.uleb128 .LBE474-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB475-.Ltext0
+	.uleb128 .LBE475-.Ltext0
+	.byte	0
+.LLRL175:
+	.byte	0x4
+	.uleb128 .LBB482-.Ltext0
+	.uleb128 .LBE482-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB485-.Ltext0
+	.uleb128 .LBE485-.Ltext0
+	.byte	0
+.LLRL180:
+	.byte	0x4
+	.uleb128 .LBB487-.Ltext0
+	.uleb128 .LBE487-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB492-.Ltext0
+	.uleb128 .LBE492-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB493-.Ltext0
+	.uleb128 .LBE493-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB494-.Ltext0
+	.uleb128 .LBE494-.Ltext0
+	.byte	0
+.LLRL183:
+	.byte	0x4
+	.uleb128 .LBB501-.Ltext0
+	.uleb128 .LBE501-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB504-.Ltext0
+	.uleb128 .LBE504-.Ltext0
+	.byte	0
+.LLRL187:
+	.byte	0x4
+	.uleb128 .LBB505-.Ltext0
+	.uleb128 .LBE505-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB512-.Ltext0
+	.uleb128 .LBE512-.Ltext0
+	.byte	0
+.LLRL189:
+	.byte	0x4
+	.uleb128 .LBB506-.Ltext0
+	.uleb128 .LBE506-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB511-.Ltext0
+	.uleb128 .LBE511-.Ltext0
+	.byte	0
+.LLRL190:
+	.byte	0x4
+	.uleb128 .LBB507-.Ltext0
+	.uleb128 .LBE507-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB510-.Ltext0
+	.uleb128 .LBE510-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 29 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF388
+	.file 31 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 32 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF516
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF580
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF583
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF443
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF643
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF644
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF645
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF646
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF647
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF648
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF688
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF516
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF387
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF729
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 51 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF776
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF777
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF778
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF779
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF556
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF780
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF781
+	.file 57 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF782
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF799
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF812
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF817
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF821
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF838
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF839
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF840
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF852
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF859
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF860
+	.byte	0x4
+	.byte	0x4
+	.file 74 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF864
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.file 76 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF866
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF867
+	.byte	0x4
+	.byte	0x4
+	.file 79 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF877
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF878
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF879
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF880
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 81 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF961
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF964
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF967
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF987
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF988
+	.file 82 "./include/va_print/file_utf16be.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF989
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF990
+	.file 83 "./include/va_print/file_utf32be.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF991
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1006
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1007
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1008
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1010
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1011
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1032
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1033
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1034
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1035
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1036
+	.file 84 "./include/va_print/alloc_utf32.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1037
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19b
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1087
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1088
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1089
+	.file 85 "./include/va_print/fd_utf16be.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1090
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1091
+	.file 86 "./include/va_print/fd_utf32be.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1092
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1105
+	.file 87 "/usr/include/x86_64-linux-gnu/sys/uio.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1106
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/uio_lim.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1110
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1111
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF387
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF389
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF390
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF391
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF392
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF393
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF439
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF442
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF453
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF454
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF515
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF533
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF541
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF555
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF557
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF575
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF582
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF598
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF640
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF642
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF656
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.53.78a7f18f3bc87ded52f05aa6f6a64310,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF668
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF673
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF675
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF678
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF680
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF687
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF709
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF388
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF543
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF555
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF557
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF726
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF727
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF738
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF750
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.fc9d051d38577d71bf2818359e56065c,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.882ecbf54662e1f16e101552381a65da,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF775
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF786
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF788
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF790
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF794
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF798
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF811
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF816
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF819
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF833
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF837
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF855
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF858
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF556
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF863
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF387
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF557
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF556
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.34.5c7a904026bfb22c2884c9ab35150e04,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF875
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF556
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.f07083f9b666a9e5c52a336c758fdd72,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF896
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF901
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF960
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF963
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF966
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF986
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.file.h.35.97e601440fdd2d29879dd346f15f7c01,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1005
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.char.h.34.e464ebba96a45be0746f2e47582a65f7,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1031
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloc.h.36.de1e80339a384712e904cf7f8ce67801,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1081
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.len.h.12.e878875ba86bc28a3829dd27f56e85ab,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1086
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.fd.h.34.34eaa4e3f8e9cdaee5511d8aa0dc2d5e,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1104
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF556
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF576
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF578
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uio_lim.h.20.58ca37993639426c959d6d02e0db4a3a,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1109
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.rope.h.26.f0af04571e11f5a39e85677a90e9d5ba,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1113
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF837:
+	.string	"__fsfilcnt_t_defined "
+.LASF441:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1230:
+	.string	"chunk"
+.LASF683:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF847:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1226:
+	.string	"va_vec_vtab_utf8"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1220:
+	.string	"va_char_p_vtab_utf8"
+.LASF1120:
+	.string	"size_t"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF932:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF676:
+	.string	"stdin stdin"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF663:
+	.string	"BUFSIZ 8192"
+.LASF803:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF703:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF905:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF1094:
+	.string	"va_fd_buf_size 512"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF682:
+	.string	"__HAVE_FLOAT128 1"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF763:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1034:
+	.string	"va_vec_encode utf8"
+.LASF1041:
+	.string	"va_arena_chunk_size 4096"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF404:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF665:
+	.string	"SEEK_SET 0"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF503:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1029:
+	.string	"va_znprintf(...) va_gznprintf(char, __VA_ARGS__)"
+.LASF806:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF955:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1160:
+	.string	"_IO_codecvt"
+.LASF416:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF777:
+	.string	"__clockid_t_defined 1"
+.LASF1042:
+	.string	"va_tprintf_slots 4"
+.LASF478:
+	.string	"__flexarr []"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF631:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF982:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF1187:
+	.string	"va_format_lit"
+.LASF1112:
+	.string	"va_rope_chunk_size 16384"
+.LASF449:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1070:
+	.string	"va_arena_uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16_ARENA(A), __VA_ARGS__)->data)"
+.LASF815:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF488:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1140:
+	.string	"_IO_save_end"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF757:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF948:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF895:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF732:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1101:
+	.string	"va_xdprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_fd_buf_[va_fd_buf_size]; va_stream_fd_t va_fd_s_ = STREAM_BUF(F, va_fd_buf_, sizeof(va_fd_buf_)); va_fd_s_.autoflush = true; (void)va_xprintf(&va_fd_s_, __VA_ARGS__))"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF899:
+	.string	"true 1"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF963:
+	.string	"va_char_p_decode utf8"
+.LASF936:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF1170:
+	.string	"take"
+.LASF997:
+	.string	"VA_STREAM_FILE_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF741:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1297:
+	.string	"rope"
+.LASF989:
+	.string	"VA_PRINT_FILE_UTF16BE_H_ "
+.LASF1133:
+	.string	"_IO_write_base"
+.LASF492:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF618:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1323:
+	.string	"testfunc11"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF643:
+	.string	"__STD_TYPE"
+.LASF871:
+	.string	"_ASSERT_H_DECLS "
+.LASF813:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF1322:
+	.string	"testfunc17"
+.LASF1321:
+	.string	"testfunc18"
+.LASF465:
+	.string	"__P(args) args"
+.LASF986:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF781:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF979:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1149:
+	.string	"_lock"
+.LASF559:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF943:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF1178:
+	.string	"_IO_FILE"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1265:
+	.string	"puts"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF611:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF774:
+	.string	"__daddr_t_defined "
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF836:
+	.string	"__fsblkcnt_t_defined "
+.LASF728:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1212:
+	.string	"va_char_p_read_vtab_utf8"
+.LASF705:
+	.string	"__f64x(x) x ##f64x"
+.LASF1169:
+	.string	"type"
+.LASF828:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1071:
+	.string	"va_arena_Uprintf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32_ARENA(A), __VA_ARGS__)->data)"
+.LASF1251:
+	.string	"va_xprintf_ulong"
+.LASF889:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF690:
+	.string	"__HAVE_FLOAT32 1"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1138:
+	.string	"_IO_save_base"
+.LASF410:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF642:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF977:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF722:
+	.string	"___int_wchar_t_h "
+.LASF595:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF453:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1007:
+	.string	"VA_PRINT_CHAR_UTF8_H_ "
+.LASF944:
+	.string	"VA_U_BOM 0xfeff"
+.LASF1343:
+	.string	"testfunc20"
+.LASF1319:
+	.string	"testfunc22"
+.LASF563:
+	.string	"_T_SIZE "
+.LASF1317:
+	.string	"testfunc24"
+.LASF1316:
+	.string	"testfunc26"
+.LASF1315:
+	.string	"testfunc28"
+.LASF1199:
+	.string	"finish"
+.LASF909:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF792:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF525:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1142:
+	.string	"_chain"
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF407:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF867:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1146:
+	.string	"_cur_column"
+.LASF992:
+	.string	"va_file32_encode utf32be"
+.LASF394:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1019:
+	.string	"va_sprintf(S,...) va_snprintf(S,va_countof(S),__VA_ARGS__)"
+.LASF910:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF879:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF577:
+	.string	"NULL"
+.LASF475:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1008:
+	.string	"va_char_p_encode utf8"
+.LASF625:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF961:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF1224:
+	.string	"va_char32_p_vtab_utf32"
+.LASF536:
+	.string	"__stub_fchflags "
+.LASF922:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF853:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF620:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF756:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1067:
+	.string	"va_vec_is_inline(T) (((T)->data != NULL) && ((T)->data == (T)->stage))"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1314:
+	.string	"testfunc30"
+.LASF1097:
+	.string	"VA_STREAM_FD32(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), NULL, 0, 0, 0, 0, {0} })"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF418:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1311:
+	.string	"testfunc34"
+.LASF1310:
+	.string	"testfunc35"
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1309:
+	.string	"testfunc37"
+.LASF1306:
+	.string	"testfunc39"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__always_inline"
+.LASF561:
+	.string	"_SYS_SIZE_T_H "
+.LASF1033:
+	.string	"VA_PRINT_MALLOC_UTF8_H_ "
+.LASF783:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF414:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF842:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1005:
+	.string	"va_eprintf(...) va_fprintf(stderr, __VA_ARGS__)"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF451:
+	.string	"__GLIBC__ 2"
+.LASF1104:
+	.string	"va_Udprintf(F,...) va_xdprintf(VA_STREAM_FD32_BUF, F, __VA_ARGS__)"
+.LASF697:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1123:
+	.string	"long int"
+.LASF443:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1065:
+	.string	"va_ubprintf(B,...) va_ubxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF1090:
+	.string	"VA_PRINT_FD_UTF16BE_H_ "
+.LASF797:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF817:
+	.string	"__sigset_t_defined 1"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1264:
+	.string	"va_vec_free"
+.LASF480:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF419:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF437:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1022:
+	.string	"va_unprintf(...) va_gnprintf(char16_t, __VA_ARGS__)"
+.LASF888:
+	.string	"_PTRDIFF_T_ "
+.LASF415:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF644:
+	.string	"_____fpos_t_defined 1"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1233:
+	.string	"va_arena_t"
+.LASF1020:
+	.string	"va_gnprintf(Char,N,...) ((Char*)(va_xprintf( &VA_STREAM_CHAR_P((Char[N]){0}, N), __VA_ARGS__)->data))"
+.LASF873:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF952:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF972:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF1275:
+	.string	"va_alloc"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF640:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1159:
+	.string	"_IO_marker"
+.LASF786:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1209:
+	.string	"va_span_t"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1263:
+	.string	"va_tmp_vec"
+.LASF1086:
+	.string	"va_lnprintf(N,...) (va_xprintf(&VA_STREAM_LEN_MAX(N), __VA_ARGS__)->pos)"
+.LASF1305:
+	.string	"testfunc43"
+.LASF1302:
+	.string	"testfunc44"
+.LASF1299:
+	.string	"testfunc46"
+.LASF1117:
+	.string	"short unsigned int"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF499:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1244:
+	.string	"va_rope_vtab_utf8"
+.LASF483:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF467:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF744:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF677:
+	.string	"stdout stdout"
+.LASF523:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1281:
+	.string	"va_xprintf_char_p_utf8"
+.LASF1052:
+	.string	"VA_STREAM_VEC32_STAGE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1239:
+	.string	"va_stream_len_t"
+.LASF1338:
+	.string	"va_format_plain_f"
+.LASF668:
+	.string	"P_tmpdir \"/tmp\""
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1260:
+	.string	"va_vec_span"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF701:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF770:
+	.string	"__nlink_t_defined "
+.LASF387:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF1190:
+	.string	"va_stream_t"
+.LASF959:
+	.string	"VA_E_ARGC 6"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF481:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF710:
+	.string	"__need_wchar_t "
+.LASF543:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF762:
+	.string	"EXIT_SUCCESS 0"
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF448:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1298:
+	.string	"testfunc50"
+.LASF1296:
+	.string	"testfunc51"
+.LASF458:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1295:
+	.string	"testfunc53"
+.LASF1219:
+	.string	"SomeCharacterType"
+.LASF1294:
+	.string	"testfunc55"
+.LASF1293:
+	.string	"testfunc57"
+.LASF1292:
+	.string	"testfunc59"
+.LASF558:
+	.string	"__size_t__ "
+.LASF616:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF795:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF585:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF469:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1045:
+	.string	"VA_STREAM_VEC_INLINE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF949:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF1017:
+	.string	"VA_STREAM_CHAR_ARR(S) VA_STREAM_CHAR_P(S,va_countof(S))"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF600:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1329:
+	.string	"__PRETTY_FUNCTION__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1038:
+	.string	"va_vec32_encode utf32"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF1249:
+	.string	"va_format_compile_f"
+.LASF915:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1039:
+	.string	"va_asprintf_init_size 16"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1092:
+	.string	"VA_PRINT_FD_UTF32BE_H_ "
+.LASF1124:
+	.string	"__uint_least16_t"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1307:
+	.string	"fbuf"
+.LASF569:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF518:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1116:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF425:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF622:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1153:
+	.string	"_freeres_list"
+.LASF466:
+	.string	"__PMT(args) args"
+.LASF914:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1202:
+	.string	"put_len"
+.LASF1035:
+	.string	"VA_PRINT_MALLOC_UTF16_H_ "
+.LASF1291:
+	.string	"testfunc60"
+.LASF1290:
+	.string	"testfunc62"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1287:
+	.string	"testfunc65"
+.LASF766:
+	.string	"__ino_t_defined "
+.LASF1166:
+	.string	"char16_t"
+.LASF571:
+	.string	"__DEFINED_size_t "
+.LASF1288:
+	.string	"testfunc69"
+.LASF995:
+	.string	"VA_STREAM_FILE16(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF583:
+	.string	"_BITS_TYPES_H 1"
+.LASF824:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1318:
+	.string	"cp_count"
+.LASF1075:
+	.string	"va_asprintf(...) va_axprintf(va_alloc, __VA_ARGS__)"
+.LASF994:
+	.string	"VA_STREAM_FILE(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file_vtab_,va_file_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF978:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF844:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF808:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1081:
+	.string	"va_format_compile(X) va_format_xcompile(va_alloc, X)"
+.LASF826:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF916:
+	.string	"VA_P(X,...) X"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1229:
+	.string	"va_arena_chunk"
+.LASF1127:
+	.string	"__off64_t"
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1078:
+	.string	"va_aeprintf(...) va_aexprintf(va_alloc, __VA_ARGS__)"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1189:
+	.string	"va_format_t"
+.LASF1203:
+	.string	"_Bool"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF510:
+	.string	"__restrict_arr __restrict"
+.LASF534:
+	.string	"__stub___compat_bdflush "
+.LASF768:
+	.string	"__gid_t_defined "
+.LASF567:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF973:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF1040:
+	.string	"va_asprintf_stage_size 512"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1057:
+	.string	"va_Uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC32(M), __VA_ARGS__)->data)"
+.LASF627:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1186:
+	.string	"alloc"
+.LASF447:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF825:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1284:
+	.string	"testfunc70"
+.LASF489:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF687:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1217:
+	.string	"autoflush"
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1050:
+	.string	"VA_STREAM_VEC16_ARENA(A) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF545:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1058:
+	.string	"va_aexprintf(alloc,...) VA_BLOCK_EXPR( char va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF967:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF539:
+	.string	"__stub_setlogin "
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF556:
+	.string	"__need_size_t "
+.LASF588:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF413:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1273:
+	.string	"va_xprintf_last_sint"
+.LASF1331:
+	.string	"testfunc2"
+.LASF1328:
+	.string	"testfunc3"
+.LASF507:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF427:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF1342:
+	.string	"_IO_lock_t"
+.LASF1325:
+	.string	"testfunc9"
+.LASF580:
+	.string	"__need___va_list "
+.LASF1121:
+	.string	"__uint16_t"
+.LASF401:
+	.string	"__USE_XOPEN2K"
+.LASF438:
+	.string	"_ATFILE_SOURCE"
+.LASF1235:
+	.string	"arena"
+.LASF736:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1280:
+	.string	"va_xprintf_last_uint"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1072:
+	.string	"va_tprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), __VA_ARGS__)->data)"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF759:
+	.string	"__lldiv_t_defined 1"
+.LASF505:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF540:
+	.string	"__stub_sigreturn "
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF434:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF1077:
+	.string	"va_Uasprintf(...) va_Uaxprintf(va_alloc, __VA_ARGS__)"
+.LASF1018:
+	.string	"va_snprintf(S,N,...) VA_BLOCK_EXPR((__typeof__(*(S))*)(va_xprintf( &VA_STREAM_CHAR_P(S,N), __VA_ARGS__)->data))"
+.LASF885:
+	.string	"_T_PTRDIFF_ "
+.LASF1030:
+	.string	"va_uznprintf(...) va_gznprintf(char16_t, __VA_ARGS__)"
+.LASF1258:
+	.string	"va_vec_shrink"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1130:
+	.string	"_IO_read_ptr"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF755:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF396:
+	.string	"__USE_POSIX199309"
+.LASF692:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1268:
+	.string	"va_strerror"
+.LASF1277:
+	.string	"va_xprintf_last_error_t_p"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF615:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF706:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF678:
+	.string	"stderr stderr"
+.LASF749:
+	.string	"__W_CONTINUED 0xffff"
+.LASF648:
+	.string	"__FILE_defined 1"
+.LASF846:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF651:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF452:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF400:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1102:
+	.string	"va_dprintf(F,...) va_xdprintf(VA_STREAM_FD_BUF, F, __VA_ARGS__)"
+.LASF500:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF417:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF902:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF1300:
+	.string	"stream"
+.LASF1037:
+	.string	"VA_PRINT_MALLOC_UTF32_H_ "
+.LASF870:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF641:
+	.string	"_BITS_TIME64_H 1"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF604:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF656:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF723:
+	.string	"__INT_WCHAR_T_H "
+.LASF931:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF589:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF576:
+	.string	"__need_size_t"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1141:
+	.string	"_markers"
+.LASF634:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF926:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF657:
+	.string	"_VA_LIST_DEFINED "
+.LASF1216:
+	.string	"file"
+.LASF821:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF925:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF672:
+	.string	"FILENAME_MAX 4096"
+.LASF1246:
+	.string	"va_rope_chunk"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF675:
+	.string	"FOPEN_MAX 16"
+.LASF474:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF636:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF626:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF776:
+	.string	"__clock_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF582:
+	.string	"__GNUC_VA_LIST "
+.LASF715:
+	.string	"_T_WCHAR "
+.LASF516:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF898:
+	.string	"bool _Bool"
+.LASF575:
+	.string	"__size_t "
+.LASF1200:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF718:
+	.string	"_BSD_WCHAR_T_ "
+.LASF637:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF849:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF760:
+	.string	"RAND_MAX 2147483647"
+.LASF971:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF669:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF981:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1253:
+	.string	"va_rope_free"
+.LASF546:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF487:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF670:
+	.string	"L_tmpnam 20"
+.LASF1000:
+	.string	"va_xfprintf(STREAM_BUF,F,...) VA_BLOCK_STMT( char va_file_buf_[va_file_buf_size]; va_stream_file_t va_file_s_ = STREAM_BUF(F, va_file_buf_, sizeof(va_file_buf_)); va_file_s_.autoflush = true; (void)va_xprintf(&va_file_s_, __VA_ARGS__))"
+.LASF645:
+	.string	"____mbstate_t_defined 1"
+.LASF1228:
+	.string	"va_arena_chunk_t"
+.LASF1053:
+	.string	"VA_STREAM_VEC32_INLINE(M,B) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1196:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1126:
+	.string	"__off_t"
+.LASF1337:
+	.string	"open_text_rd1"
+.LASF1336:
+	.string	"open_text_rd2"
+.LASF1335:
+	.string	"open_text_rd3"
+.LASF1334:
+	.string	"open_text_rd4"
+.LASF1333:
+	.string	"open_text_rd5"
+.LASF804:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF547:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF578:
+	.string	"NULL ((void *)0)"
+.LASF1183:
+	.string	"lit_cnt"
+.LASF1106:
+	.string	"_SYS_UIO_H 1"
+.LASF1088:
+	.string	"VA_PRINT_FD_UTF8_H_ "
+.LASF970:
+	.string	"VA_SIGIL '~'"
+.LASF497:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1150:
+	.string	"_offset"
+.LASF1191:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1013:
+	.string	"va_char_p_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_vtab_,va_char32_p_encode))"
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF878:
+	.string	"VA_PRINT_FILE_H_ "
+.LASF1232:
+	.string	"chunk_size"
+.LASF594:
+	.string	"__SLONG32_TYPE int"
+.LASF689:
+	.string	"__HAVE_FLOAT16 0"
+.LASF802:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF601:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF457:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF695:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF388:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF921:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1204:
+	.string	"va_stream_vtab_t"
+.LASF442:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1254:
+	.string	"va_rope_writev"
+.LASF880:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF900:
+	.string	"false 0"
+.LASF422:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF829:
+	.string	"NFDBITS __NFDBITS"
+.LASF1014:
+	.string	"va_char_p_size_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_size_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_size_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_size_vtab_,va_char32_p_encode))"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF845:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1001:
+	.string	"va_fprintf(F,...) va_xfprintf(VA_STREAM_FILE_BUF, F, __VA_ARGS__)"
+.LASF964:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF832:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1184:
+	.string	"spec"
+.LASF731:
+	.string	"WUNTRACED 2"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF617:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF957:
+	.string	"VA_E_TRUNC 4"
+.LASF1114:
+	.string	"long unsigned int"
+.LASF1238:
+	.string	"va_stream_vec16_t"
+.LASF460:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1237:
+	.string	"va_stream_vec_t"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF956:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF428:
+	.string	"_POSIX_SOURCE"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF426:
+	.string	"__USE_ISOC95 1"
+.LASF526:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1093:
+	.string	"va_fd32_encode utf32be"
+.LASF562:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF694:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1125:
+	.string	"__uint_least32_t"
+.LASF985:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF479:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1132:
+	.string	"_IO_read_base"
+.LASF809:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1076:
+	.string	"va_uasprintf(...) va_uaxprintf(va_alloc, __VA_ARGS__)"
+.LASF822:
+	.string	"__suseconds_t_defined "
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF1111:
+	.string	"VA_PRINT_ROPE_UTF8_H_ "
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF461:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF557:
+	.string	"__need_NULL "
+.LASF389:
+	.string	"_FEATURES_H 1"
+.LASF1167:
+	.string	"char32_t"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1157:
+	.string	"_unused2"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1194:
+	.string	"qctxt"
+.LASF520:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF459:
+	.string	"__LEAF , __leaf__"
+.LASF841:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF907:
+	.string	"VA_NIX "
+.LASF491:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF764:
+	.string	"_SYS_TYPES_H 1"
+.LASF700:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF599:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF429:
+	.string	"_POSIX_SOURCE 1"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1043:
+	.string	"VA_STREAM_VEC(M) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF506:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF587:
+	.string	"__U32_TYPE unsigned int"
+.LASF1259:
+	.string	"va_xprintf_last_span_p_utf8"
+.LASF1242:
+	.string	"mark"
+.LASF498:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF903:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1046:
+	.string	"VA_STREAM_VEC_ARENA(A) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF877:
+	.string	"__mbstate_t_defined 1"
+.LASF1145:
+	.string	"_old_offset"
+.LASF856:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF409:
+	.string	"__USE_ATFILE"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1278:
+	.string	"va_xprintf_uint"
+.LASF780:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF1252:
+	.string	"va_format_free"
+.LASF733:
+	.string	"WEXITED 4"
+.LASF1171:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF635:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF894:
+	.string	"__need_ptrdiff_t"
+.LASF1267:
+	.string	"va_xprintf_last_char_p_utf8"
+.LASF754:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF812:
+	.string	"_SYS_SELECT_H 1"
+.LASF714:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF707:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF519:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1276:
+	.string	"va_xprintf_char16_p_utf16"
+.LASF395:
+	.string	"__USE_POSIX2"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF859:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1122:
+	.string	"__uint32_t"
+.LASF872:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF565:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF775:
+	.string	"__key_t_defined "
+.LASF1164:
+	.string	"long long int"
+.LASF1223:
+	.string	"va_char16_p_size_vtab_utf16"
+.LASF958:
+	.string	"VA_E_FORMAT 5"
+.LASF920:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF1256:
+	.string	"va_fd_flush"
+.LASF711:
+	.string	"__wchar_t__ "
+.LASF860:
+	.string	"__have_pthread_attr_t 1"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF533:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1192:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF767:
+	.string	"__dev_t_defined "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1197:
+	.string	"va_quotations"
+.LASF1047:
+	.string	"VA_STREAM_VEC16(M) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF1061:
+	.string	"va_bxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC_INLINE(alloc, B), __VA_ARGS__))"
+.LASF680:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF796:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF946:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF403:
+	.string	"__USE_XOPEN2K8"
+.LASF514:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF716:
+	.string	"__WCHAR_T "
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1340:
+	.string	"get_vtab"
+.LASF564:
+	.string	"__SIZE_T "
+.LASF464:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1308:
+	.string	"fstream"
+.LASF1135:
+	.string	"_IO_write_end"
+.LASF1313:
+	.string	"view"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF495:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1327:
+	.string	"testfunc5"
+.LASF513:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1198:
+	.string	"init"
+.LASF791:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1326:
+	.string	"testfunc7"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF913:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF807:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF827:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF686:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF708:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF596:
+	.string	"__S64_TYPE long int"
+.LASF621:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1262:
+	.string	"va_vec_reserve"
+.LASF439:
+	.string	"_ATFILE_SOURCE 1"
+.LASF937:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF590:
+	.string	"__SQUAD_TYPE long int"
+.LASF673:
+	.string	"L_ctermid 9"
+.LASF597:
+	.string	"__U64_TYPE unsigned long int"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1324:
+	.string	"buff"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF402:
+	.string	"__USE_XOPEN2KXSI"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF412:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF530:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF883:
+	.string	"_ANSI_STDDEF_H "
+.LASF664:
+	.string	"EOF (-1)"
+.LASF1100:
+	.string	"VA_STREAM_FD32_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd32_vtab_,va_fd32_encode)), (FD), (B), (N), 0, 0, 0, {0} })"
+.LASF852:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1286:
+	.string	"MyChar"
+.LASF359:
+	.string	"__k8 1"
+.LASF655:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1255:
+	.string	"va_xprintf_sint"
+.LASF1222:
+	.string	"va_char16_p_vtab_utf16"
+.LASF1060:
+	.string	"va_Uaexprintf(alloc,...) VA_BLOCK_EXPR( char32_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC32_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF1136:
+	.string	"_IO_buf_base"
+.LASF1271:
+	.string	"va_xprintf_init_last_plain"
+.LASF1144:
+	.string	"_flags2"
+.LASF1021:
+	.string	"va_nprintf(...) va_gnprintf(char, __VA_ARGS__)"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF746:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1115:
+	.string	"unsigned int"
+.LASF1069:
+	.string	"va_arena_printf(A,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC_ARENA(A), __VA_ARGS__)->data)"
+.LASF646:
+	.string	"_____fpos64_t_defined 1"
+.LASF1240:
+	.string	"va_len_vtab"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF456:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF984:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF869:
+	.string	"_ASSERT_H 1"
+.LASF1248:
+	.string	"va_stream_rope_t"
+.LASF408:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF405:
+	.string	"__USE_LARGEFILE"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF1241:
+	.string	"va_fd_vtab_utf8"
+.LASF725:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1109:
+	.string	"__IOV_MAX 1024"
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF436:
+	.string	"__USE_XOPEN2K 1"
+.LASF424:
+	.string	"__USE_ISOC11 1"
+.LASF976:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF628:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1155:
+	.string	"__pad5"
+.LASF390:
+	.string	"__USE_ISOC11"
+.LASF1332:
+	.string	"suffix"
+.LASF886:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF486:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF784:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF490:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF862:
+	.string	"alloca"
+.LASF1036:
+	.string	"va_vec16_encode utf16"
+.LASF512:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF537:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1080:
+	.string	"va_Uaeprintf(...) va_Uaexprintf(va_alloc, __VA_ARGS__)"
+.LASF1174:
+	.string	"has_size"
+.LASF624:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF993:
+	.string	"va_file_buf_size 256"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1179:
+	.string	"va_read_iter"
+.LASF983:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF793:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF501:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1180:
+	.string	"vtab"
+.LASF811:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1211:
+	.string	"va_error_t"
+.LASF773:
+	.string	"__id_t_defined "
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF816:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1129:
+	.string	"_flags"
+.LASF884:
+	.string	"_PTRDIFF_T "
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1304:
+	.string	"va_fd_s_"
+.LASF593:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF639:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF450:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF603:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF735:
+	.string	"WNOWAIT 0x01000000"
+.LASF990:
+	.string	"va_file16_encode utf16be"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1247:
+	.string	"first"
+.LASF1156:
+	.string	"_mode"
+.LASF610:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF740:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1221:
+	.string	"va_char_p_size_vtab_utf8"
+.LASF462:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1303:
+	.string	"va_fd_buf_"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF517:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF739:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF468:
+	.string	"__STRING(x) #x"
+.LASF544:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF515:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF699:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF753:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1151:
+	.string	"_codecvt"
+.LASF579:
+	.string	"__need_NULL"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF572:
+	.string	"___int_size_t_h "
+.LASF713:
+	.string	"_WCHAR_T "
+.LASF693:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF866:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF930:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF891:
+	.string	"_GCC_PTRDIFF_T "
+.LASF538:
+	.string	"__stub_revoke "
+.LASF818:
+	.string	"____sigset_t_defined "
+.LASF522:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1128:
+	.string	"char"
+.LASF463:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1188:
+	.string	"va_format_spec"
+.LASF560:
+	.string	"_SIZE_T "
+.LASF721:
+	.string	"_WCHAR_T_H "
+.LASF661:
+	.string	"_IOLBF 1"
+.LASF1064:
+	.string	"va_bprintf(B,...) va_bxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF988:
+	.string	"va_file_encode utf8"
+.LASF1107:
+	.string	"__iovec_defined 1"
+.LASF662:
+	.string	"_IONBF 2"
+.LASF647:
+	.string	"____FILE_defined 1"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1205:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1168:
+	.string	"long double"
+.LASF1234:
+	.string	"stage"
+.LASF892:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF954:
+	.string	"VA_E_NULL 1"
+.LASF612:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF851:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1016:
+	.string	"VA_STREAM_CHAR_SIZE(Char,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_size_vtab_gen((Char*)NULL)), NULL, (N), 0 })"
+.LASF772:
+	.string	"__pid_t_defined "
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF882:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1158:
+	.string	"FILE"
+.LASF782:
+	.string	"_ENDIAN_H 1"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF924:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF814:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF1011:
+	.string	"VA_PRINT_CHAR_UTF32_H_ "
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF392:
+	.string	"__USE_ISOC95"
+.LASF923:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF391:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF399:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF751:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1006:
+	.string	"VA_PRINT_CHAR_H_ "
+.LASF685:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF470:
+	.string	"__BEGIN_DECLS "
+.LASF1257:
+	.string	"va_file_flush"
+.LASF1098:
+	.string	"VA_STREAM_FD_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), (B), (N), 0, 0, 0, {0} })"
+.LASF527:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF386:
+	.string	"_STDIO_H 1"
+.LASF1227:
+	.string	"va_vec16_vtab_utf16"
+.LASF942:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF734:
+	.string	"WCONTINUED 8"
+.LASF435:
+	.string	"__USE_POSIX199506 1"
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF819:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1024:
+	.string	"va_gzprintf(Char,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, -(size_t)2), __VA_ARGS__)->pos + 1)"
+.LASF619:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1207:
+	.string	"size"
+.LASF934:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1165:
+	.string	"long long unsigned int"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF987:
+	.string	"VA_PRINT_FILE_UTF8_H_ "
+.LASF666:
+	.string	"SEEK_CUR 1"
+.LASF750:
+	.string	"__WCOREFLAG 0x80"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF393:
+	.string	"__USE_ISOCXX11"
+.LASF568:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1091:
+	.string	"va_fd16_encode utf16be"
+.LASF1044:
+	.string	"VA_STREAM_VEC_STAGE(M,B) ((va_stream_vec_t){ VA_STREAM(&VA_CONCAT(va_vec_vtab_,va_vec_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF659:
+	.string	"__ssize_t_defined "
+.LASF1185:
+	.string	"spec_cnt"
+.LASF1339:
+	.string	"va_xprintf_init"
+.LASF887:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1068:
+	.string	"VA_ARENA(M) ((va_arena_t){ NULL, NULL, va_arena_chunk_size, (M) })"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF779:
+	.string	"__timer_t_defined 1"
+.LASF431:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF745:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1312:
+	.string	"testfunc32"
+.LASF951:
+	.string	"VA_U_EOT -1U"
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1195:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF940:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF962:
+	.string	"va_char_p_format utf8"
+.LASF494:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF397:
+	.string	"__USE_POSIX199506"
+.LASF960:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF785:
+	.string	"__BIG_ENDIAN 4321"
+.LASF696:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1320:
+	.string	"va_stage_"
+.LASF1154:
+	.string	"_freeres_buf"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF667:
+	.string	"SEEK_END 2"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF969:
+	.string	"va_char32_p_decode utf32"
+.LASF968:
+	.string	"va_char32_p_format utf32"
+.LASF1182:
+	.string	"va_read_iter_t"
+.LASF440:
+	.string	"__WORDSIZE 64"
+.LASF476:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF831:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF720:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1084:
+	.string	"VA_STREAM_LEN_MAX(N) ((va_stream_len_t){ VA_STREAM(&va_len_vtab), 0, (N) })"
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1213:
+	.string	"va_char32_p_read_vtab_utf32"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF541:
+	.string	"__stub_stty "
+.LASF1270:
+	.string	"va_xprintf_init_last"
+.LASF1073:
+	.string	"va_utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec16(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), __VA_ARGS__)->data)"
+.LASF1225:
+	.string	"va_stream_char_p_t"
+.LASF998:
+	.string	"VA_STREAM_FILE16_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file16_vtab_,va_file16_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF737:
+	.string	"__WALL 0x40000000"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF529:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF800:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1272:
+	.string	"__assert_fail"
+.LASF473:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF566:
+	.string	"_BSD_SIZE_T_ "
+.LASF398:
+	.string	"__USE_XOPEN"
+.LASF1172:
+	.string	"bulk"
+.LASF788:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF840:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF938:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF798:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF691:
+	.string	"__HAVE_FLOAT64 1"
+.LASF729:
+	.string	"_STDLIB_H 1"
+.LASF1099:
+	.string	"VA_STREAM_FD16_BUF(FD,B,N) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), (B), (N), 0, 0, 0, {0} })"
+.LASF586:
+	.string	"__S32_TYPE int"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF965:
+	.string	"va_char16_p_format utf16"
+.LASF1103:
+	.string	"va_udprintf(F,...) va_xdprintf(VA_STREAM_FD16_BUF, F, __VA_ARGS__)"
+.LASF738:
+	.string	"__WCLONE 0x80000000"
+.LASF1139:
+	.string	"_IO_backup_base"
+.LASF1148:
+	.string	"_shortbuf"
+.LASF1082:
+	.string	"VA_PRINT_LEN_H_ "
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF613:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF974:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF865:
+	.string	"_STRING_H 1"
+.LASF839:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1066:
+	.string	"va_Ubprintf(B,...) va_Ubxprintf(va_alloc, B, __VA_ARGS__)"
+.LASF724:
+	.string	"_GCC_WCHAR_T "
+.LASF833:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF799:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF445:
+	.string	"__USE_ATFILE 1"
+.LASF1176:
+	.string	"str_prefix"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF681:
+	.string	"_BITS_FLOATN_H "
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF717:
+	.string	"_WCHAR_T_ "
+.LASF658:
+	.string	"__off_t_defined "
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1250:
+	.string	"malloc"
+.LASF875:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF935:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1210:
+	.string	"code"
+.LASF719:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF850:
+	.string	"__LOCK_ALIGNMENT "
+.LASF823:
+	.string	"__NFDBITS"
+.LASF1015:
+	.string	"VA_STREAM_CHAR_P(S,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_vtab_gen(S)), (S), (N), 0 })"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1279:
+	.string	"fopen"
+.LASF684:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1113:
+	.string	"VA_STREAM_ROPE(M) ((va_stream_rope_t){ VA_STREAM(&va_rope_vtab_utf8), NULL, NULL, va_rope_chunk_size, (M) })"
+.LASF535:
+	.string	"__stub_chflags "
+.LASF653:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF896:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF411:
+	.string	"__USE_GNU"
+.LASF574:
+	.string	"_SIZET_ "
+.LASF630:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF947:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF941:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF771:
+	.string	"__uid_t_defined "
+.LASF375:
+	.string	"__unix 1"
+.LASF881:
+	.string	"_STDDEF_H "
+.LASF1009:
+	.string	"VA_PRINT_CHAR_UTF16_H_ "
+.LASF794:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF528:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1173:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1137:
+	.string	"_IO_buf_end"
+.LASF623:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1083:
+	.string	"VA_STREAM_LEN() VA_STREAM_LEN_MAX(-(size_t)1)"
+.LASF1218:
+	.string	"va_stream_file_t"
+.LASF688:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1269:
+	.string	"va_stream_get_error_f"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF702:
+	.string	"__f32(x) x ##f32"
+.LASF1028:
+	.string	"va_gznprintf(Char,N,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, (size_t)(N) + 1), __VA_ARGS__)->pos + 1)"
+.LASF496:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF748:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF471:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1079:
+	.string	"va_uaeprintf(...) va_uaexprintf(va_alloc, __VA_ARGS__)"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF674:
+	.string	"FOPEN_MAX"
+.LASF950:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF975:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF810:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1163:
+	.string	"stderr"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF1119:
+	.string	"short int"
+.LASF454:
+	.string	"_SYS_CDEFS_H 1"
+.LASF876:
+	.string	"_UCHAR_H 1"
+.LASF912:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF787:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1056:
+	.string	"va_uaxprintf(M,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC16(M), __VA_ARGS__)->data)"
+.LASF420:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF509:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1027:
+	.string	"va_Uzprintf(...) va_gzprintf(char32_t, __VA_ARGS__)"
+.LASF835:
+	.string	"__blkcnt_t_defined "
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF928:
+	.string	"VA_REC1() VA_REC1B"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF805:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF484:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF834:
+	.string	"__blksize_t_defined "
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1074:
+	.string	"va_Utprintf(...) VA_BLOCK_EXPR(va_xprintf( va_tmp_vec32(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), __VA_ARGS__)->data)"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1283:
+	.string	"va_file_s_"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1236:
+	.string	"keep"
+.LASF521:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1110:
+	.string	"UIO_MAXIOV __IOV_MAX"
+.LASF999:
+	.string	"VA_STREAM_FILE32_BUF(F,B,N) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), (B), (N), 0, 0, {0} })"
+.LASF591:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF549:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1301:
+	.string	"bstream"
+.LASF1147:
+	.string	"_vtable_offset"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF730:
+	.string	"WNOHANG 1"
+.LASF532:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF629:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF482:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1175:
+	.string	"chunk_mode"
+.LASF608:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1003:
+	.string	"va_Ufprintf(F,...) va_xfprintf(VA_STREAM_FILE32_BUF, F, __VA_ARGS__)"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF485:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF592:
+	.string	"__SWORD_TYPE long int"
+.LASF1051:
+	.string	"VA_STREAM_VEC32(M) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, (M), NULL, NULL, 0, {0} })"
+.LASF1206:
+	.string	"va_span"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF1177:
+	.string	"_pad"
+.LASF991:
+	.string	"VA_PRINT_FILE_UTF32BE_H_ "
+.LASF493:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1245:
+	.string	"va_rope_chunk_t"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF605:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF432:
+	.string	"__USE_POSIX 1"
+.LASF911:
+	.string	"VA_PAR ()"
+.LASF524:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF679:
+	.string	"__attr_dealloc_fclose"
+.LASF1085:
+	.string	"va_lprintf(...) (va_xprintf(&VA_STREAM_LEN(), __VA_ARGS__)->pos)"
+.LASF1108:
+	.string	"_BITS_UIO_LIM_H 1"
+.LASF531:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF726:
+	.string	"__DEFINED_wchar_t "
+.LASF455:
+	.string	"__PMT"
+.LASF704:
+	.string	"__f32x(x) x ##f32x"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1118:
+	.string	"signed char"
+.LASF857:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1201:
+	.string	"put_fill"
+.LASF584:
+	.string	"__S16_TYPE short int"
+.LASF855:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF778:
+	.string	"__time_t_defined 1"
+.LASF1055:
+	.string	"va_axprintf(alloc,...) VA_BLOCK_EXPR(va_xprintf(&VA_STREAM_VEC(alloc), __VA_ARGS__)->data)"
+.LASF848:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF801:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF929:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF1266:
+	.string	"va_arena_free"
+.LASF504:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1161:
+	.string	"_IO_wide_data"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF698:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1059:
+	.string	"va_uaexprintf(alloc,...) VA_BLOCK_EXPR( char16_t va_stage_[va_asprintf_stage_size]; va_xprintf(&VA_STREAM_VEC16_STAGE(alloc, va_stage_), __VA_ARGS__)->data)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF996:
+	.string	"VA_STREAM_FILE32(F) ((va_stream_file_t){ VA_STREAM(&VA_CONCAT(va_file32_vtab_,va_file32_encode)), (F), NULL, 0, 0, 0, {0} })"
+.LASF1054:
+	.string	"VA_STREAM_VEC32_ARENA(A) ((va_stream_vec32_t){ VA_STREAM(&VA_CONCAT(va_vec32_vtab_,va_vec32_encode)), NULL, va_asprintf_init_size, 0, NULL, NULL, (A), 0, {0} })"
+.LASF1105:
+	.string	"VA_PRINT_ROPE_H_ "
+.LASF1341:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF570:
+	.string	"_SIZE_T_DECLARED "
+.LASF508:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1131:
+	.string	"_IO_read_end"
+.LASF652:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF917:
+	.string	"VA_F(...) VA_H"
+.LASF1062:
+	.string	"va_ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC16_INLINE(alloc, B), __VA_ARGS__))"
+.LASF890:
+	.string	"___int_ptrdiff_t_h "
+.LASF1031:
+	.string	"va_Uznprintf(...) va_gznprintf(char32_t, __VA_ARGS__)"
+.LASF758:
+	.string	"__ldiv_t_defined 1"
+.LASF421:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1095:
+	.string	"VA_STREAM_FD(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd_vtab_,va_fd_encode)), (FD), NULL, 0, 0, 0, 0, {0} })"
+.LASF908:
+	.string	"VA_EAT(...) "
+.LASF897:
+	.string	"_STDBOOL_H "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1243:
+	.string	"va_stream_fd_t"
+.LASF904:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF727:
+	.string	"_BSD_WCHAR_T_"
+.LASF1087:
+	.string	"VA_PRINT_FD_H_ "
+.LASF712:
+	.string	"__WCHAR_T__ "
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1010:
+	.string	"va_char16_p_encode utf16"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF602:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF858:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF743:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1289:
+	.string	"testfunc64"
+.LASF1143:
+	.string	"_fileno"
+.LASF472:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF790:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF350:
+	.string	"__amd64 1"
+.LASF1285:
+	.string	"testfunc67"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF433:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF614:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF747:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1261:
+	.string	"va_vec_clear"
+.LASF1181:
+	.string	"va_read_iter_vtab_t"
+.LASF548:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1152:
+	.string	"_wide_data"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF606:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1025:
+	.string	"va_zprintf(...) va_gzprintf(char, __VA_ARGS__)"
+.LASF769:
+	.string	"__mode_t_defined "
+.LASF980:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF607:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF966:
+	.string	"va_char16_p_decode utf16"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1274:
+	.string	"free"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF654:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF1002:
+	.string	"va_ufprintf(F,...) va_xfprintf(VA_STREAM_FILE16_BUF, F, __VA_ARGS__)"
+.LASF927:
+	.string	"VA_REC0() VA_REC0B"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF945:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF864:
+	.string	"__COMPAR_FN_T "
+.LASF377:
+	.string	"unix 1"
+.LASF598:
+	.string	"__STD_TYPE typedef"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1162:
+	.string	"stdout"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF861:
+	.string	"_ALLOCA_H 1"
+.LASF1214:
+	.string	"va_format_read_vtab"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF446:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1063:
+	.string	"va_Ubxprintf(alloc,B,...) VA_BLOCK_EXPR(*va_xprintf(&VA_STREAM_VEC32_INLINE(alloc, B), __VA_ARGS__))"
+.LASF444:
+	.string	"__USE_MISC 1"
+.LASF901:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1048:
+	.string	"VA_STREAM_VEC16_STAGE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 0, {0} })"
+.LASF633:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1012:
+	.string	"va_char32_p_encode utf32"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF581:
+	.string	"__need___va_list"
+.LASF1134:
+	.string	"_IO_write_ptr"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF906:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF742:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1032:
+	.string	"VA_PRINT_MALLOC_H_ "
+.LASF752:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF939:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF893:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF649:
+	.string	"__struct_FILE_defined 1"
+.LASF477:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF761:
+	.string	"EXIT_FAILURE 1"
+.LASF1023:
+	.string	"va_Unprintf(...) va_gnprintf(char32_t, __VA_ARGS__)"
+.LASF709:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF609:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF953:
+	.string	"VA_E_OK 0"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1049:
+	.string	"VA_STREAM_VEC16_INLINE(M,B) ((va_stream_vec16_t){ VA_STREAM(&VA_CONCAT(va_vec16_vtab_,va_vec16_encode)), (B), va_countof(B), 0, (M), (B), NULL, 1, {0} })"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1089:
+	.string	"va_fd_encode utf8"
+.LASF406:
+	.string	"__USE_LARGEFILE64"
+.LASF650:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1026:
+	.string	"va_uzprintf(...) va_gzprintf(char16_t, __VA_ARGS__)"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF919:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1096:
+	.string	"VA_STREAM_FD16(FD) ((va_stream_fd_t){ VA_STREAM(&VA_CONCAT(va_fd16_vtab_,va_fd16_encode)), (FD), NULL, 0, 0, 0, 0, {0} })"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF838:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF765:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1193:
+	.string	"prec"
+.LASF789:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF372:
+	.string	"__linux 1"
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1208:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF868:
+	.string	"_STRINGS_H 1"
+.LASF830:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF542:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1282:
+	.string	"va_file_buf_"
+.LASF863:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF638:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF874:
+	.string	"static_assert"
+.LASF843:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF660:
+	.string	"_IOFBF 0"
+.LASF430:
+	.string	"_POSIX_C_SOURCE"
+.LASF933:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF632:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1004:
+	.string	"va_printf(...) va_fprintf(stdout, __VA_ARGS__)"
+.LASF820:
+	.string	"__timeval_defined 1"
+.LASF854:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF573:
+	.string	"_GCC_SIZE_T "
+.LASF511:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1231:
+	.string	"last"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF671:
+	.string	"TMP_MAX 238328"
+.LASF918:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF1215:
+	.string	"va_file_vtab_utf8"
+.LASF1330:
+	.string	"va_tprintf_free"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"out/test2-readme.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16296 @@
+	.file	"utf16.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/utf16.c"
+	.globl	va_char16_p_bulk_utf16
+	.type	va_char16_p_bulk_utf16, @function
+va_char16_p_bulk_utf16:
+.LVL0:
+.LFB546:
+	.file 1 "src/utf16.c"
+	.loc 1 172 1 view -0
+	.cfi_startproc
+	.loc 1 173 5 view .LVU1
+	.loc 1 172 1 is_stmt 0 view .LVU2
+	movq	%rdi, %rax
+	movq	%rcx, %rdi
+.LVL1:
+	.loc 1 173 21 view .LVU3
+	movq	8(%rax), %r8
+.LVL2:
+	.loc 1 174 5 is_stmt 1 view .LVU4
+	.loc 1 175 5 view .LVU5
+	.loc 1 175 8 is_stmt 0 view .LVU6
+	testq	%rsi, %rsi
+	je	.L2
+	.loc 1 175 57 discriminator 1 view .LVU7
+	subq	%r8, %rsi
+.LVL3:
+	.loc 1 175 57 discriminator 1 view .LVU8
+	sarq	%rsi
+	cmpq	%rsi, %rdx
+	cmova	%rsi, %rdx
+.LVL4:
+.L2:
+	.loc 1 179 5 is_stmt 1 view .LVU9
+	.loc 1 180 5 view .LVU10
+	.loc 1 181 5 view .LVU11
+	.loc 1 181 11 is_stmt 0 view .LVU12
+	movl	$1, %ecx
+.LVL5:
+	.loc 1 179 12 view .LVU13
+	xorl	%eax, %eax
+.LVL6:
+.L3:
+	.loc 1 181 14 is_stmt 1 view .LVU14
+	cmpq	%rdx, %rax
+	jnb	.L7
+.LBB93:
+	.loc 1 182 9 view .LVU15
+	.loc 1 182 24 is_stmt 0 view .LVU16
+	leaq	(%rax,%rax), %r9
+	.loc 1 182 18 view .LVU17
+	movzwl	(%r8,%r9), %esi
+.LVL7:
+	.loc 1 183 9 is_stmt 1 view .LVU18
+	.loc 1 183 12 is_stmt 0 view .LVU19
+	testl	%esi, %esi
+	je	.L7
+	.loc 1 186 9 is_stmt 1 view .LVU20
+	.loc 1 186 27 is_stmt 0 view .LVU21
+	leal	-55296(%rsi), %r10d
+	.loc 1 186 12 view .LVU22
+	cmpl	$2047, %r10d
+	jbe	.L5
+	.loc 1 187 13 is_stmt 1 discriminator 1 view .LVU23
+	.loc 1 187 14 is_stmt 0 discriminator 1 view .LVU24
+	incq	%rax
+.LVL8:
+	.loc 1 188 13 is_stmt 1 discriminator 1 view .LVU25
+	.loc 1 189 13 discriminator 1 view .LVU26
+	jmp	.L6
+.LVL9:
+.L5:
+	.loc 1 192 9 view .LVU27
+	.loc 1 192 12 is_stmt 0 view .LVU28
+	cmpl	$56319, %esi
+	ja	.L7
+	.loc 1 192 35 discriminator 1 view .LVU29
+	movq	%rdx, %rsi
+.LVL10:
+	.loc 1 192 35 discriminator 1 view .LVU30
+	subq	%rax, %rsi
+	.loc 1 192 28 discriminator 1 view .LVU31
+	decq	%rsi
+	je	.L7
+	.loc 1 195 9 is_stmt 1 view .LVU32
+	.loc 1 195 31 is_stmt 0 view .LVU33
+	movw	2(%r8,%r9), %si
+	addw	$9216, %si
+	.loc 1 195 12 view .LVU34
+	cmpw	$1023, %si
+	ja	.L7
+	.loc 1 198 9 is_stmt 1 view .LVU35
+	.loc 1 198 11 is_stmt 0 view .LVU36
+	addq	$2, %rax
+.LVL11:
+	.loc 1 199 9 is_stmt 1 view .LVU37
+.L6:
+	.loc 1 199 9 is_stmt 0 view .LVU38
+	incq	%rcx
+.LVL12:
+	.loc 1 199 9 view .LVU39
+	jmp	.L3
+.LVL13:
+.L7:
+	.loc 1 199 9 view .LVU40
+.LBE93:
+	.loc 1 201 5 is_stmt 1 view .LVU41
+	.loc 1 201 10 is_stmt 0 view .LVU42
+	decq	%rcx
+.LVL14:
+	.loc 1 201 10 view .LVU43
+	movq	%rcx, (%rdi)
+	.loc 1 202 5 is_stmt 1 view .LVU44
+	.loc 1 203 1 is_stmt 0 view .LVU45
+	ret
+	.cfi_endproc
+.LFE546:
+	.size	va_char16_p_bulk_utf16, .-va_char16_p_bulk_utf16
+	.globl	va_span16_p_bulk_utf16
+	.type	va_span16_p_bulk_utf16, @function
+va_span16_p_bulk_utf16:
+.LVL15:
+.LFB547:
+	.loc 1 210 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 211 5 view .LVU47
+	.loc 1 211 41 view .LVU48
+	.loc 1 211 89 view .LVU49
+	.loc 1 211 122 view .LVU50
+	.loc 1 211 40 view .LVU51
+	.loc 1 211 136 view .LVU52
+	.loc 1 211 174 view .LVU53
+	.loc 1 211 187 view .LVU54
+	.loc 1 212 5 view .LVU55
+	.loc 1 212 30 is_stmt 0 view .LVU56
+	movq	16(%rdi), %rax
+	.loc 1 212 8 view .LVU57
+	testq	%rsi, %rsi
+	je	.L18
+	cmpq	%rsi, %rax
+	cmova	%rsi, %rax
+.L18:
+.LVL16:
+	.loc 1 215 5 is_stmt 1 view .LVU58
+	.loc 1 215 12 is_stmt 0 view .LVU59
+	movq	%rax, %rsi
+	jmp	va_char16_p_bulk_utf16
+.LVL17:
+	.loc 1 215 12 view .LVU60
+	.cfi_endproc
+.LFE547:
+	.size	va_span16_p_bulk_utf16, .-va_span16_p_bulk_utf16
+	.globl	va_char16_p_transcode_utf16
+	.type	va_char16_p_transcode_utf16, @function
+va_char16_p_transcode_utf16:
+.LVL18:
+.LFB549:
+	.loc 1 251 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 252 5 view .LVU62
+	.loc 1 253 5 view .LVU63
+	.loc 1 253 27 is_stmt 0 view .LVU64
+	leaq	(%rcx,%rcx), %r8
+	.loc 1 253 21 view .LVU65
+	addq	%rdx, %r8
+.LVL19:
+	.loc 1 254 5 is_stmt 1 view .LVU66
+	.loc 1 254 8 is_stmt 0 view .LVU67
+	testq	%rdi, %rdi
+	jne	.L23
+	.loc 1 255 9 is_stmt 1 view .LVU68
+.LVL20:
+.LBB138:
+.LBI138:
+	.loc 1 221 15 view .LVU69
+.LBB139:
+	.loc 1 226 5 view .LVU70
+	.loc 1 227 5 view .LVU71
+	cmpb	$1, %sil
+	je	.L44
+	cmpb	$3, %sil
+	jne	.L50
+	xorl	%esi, %esi
+.LVL21:
+	.loc 1 227 5 is_stmt 0 view .LVU72
+	xorl	%eax, %eax
+	jmp	.L25
+.LVL22:
+.L44:
+	.loc 1 227 5 view .LVU73
+	xorl	%esi, %esi
+.LVL23:
+	.loc 1 227 5 view .LVU74
+	xorl	%eax, %eax
+.LVL24:
+.L24:
+.LBB140:
+	.loc 1 230 30 is_stmt 1 view .LVU75
+	cmpq	%rsi, %rcx
+	je	.L52
+.LBB141:
+	.loc 1 231 13 view .LVU76
+	.loc 1 231 22 is_stmt 0 view .LVU77
+	movzwl	(%rdx,%rsi,2), %edi
+.LVL25:
+	.loc 1 232 13 is_stmt 1 view .LVU78
+	.loc 1 232 21 is_stmt 0 view .LVU79
+	cmpl	$128, %edi
+	.loc 1 233 48 view .LVU80
+	leal	-55296(%rdi), %r9d
+	.loc 1 232 21 view .LVU81
+	sbbl	%r8d, %r8d
+	.loc 1 233 48 view .LVU82
+	cmpl	$2047, %r9d
+	seta	%r9b
+	.loc 1 233 21 view .LVU83
+	cmpl	$2047, %edi
+	.loc 1 233 31 view .LVU84
+	seta	%dil
+.LVL26:
+	.loc 1 233 31 view .LVU85
+.LBE141:
+	.loc 1 230 36 view .LVU86
+	incq	%rsi
+.LVL27:
+.LBB142:
+	.loc 1 233 31 view .LVU87
+	movzbl	%dil, %edi
+	andl	%r9d, %edi
+	.loc 1 232 35 view .LVU88
+	leal	2(%r8,%rdi), %edi
+	.loc 1 232 15 view .LVU89
+	addq	%rdi, %rax
+.LVL28:
+	.loc 1 232 15 view .LVU90
+.LBE142:
+	.loc 1 230 36 is_stmt 1 view .LVU91
+	.loc 1 230 36 is_stmt 0 view .LVU92
+	jmp	.L24
+.LVL29:
+.L52:
+	.loc 1 230 36 view .LVU93
+	ret
+.LVL30:
+.L25:
+	.loc 1 230 36 view .LVU94
+.LBE140:
+.LBB143:
+	.loc 1 238 30 is_stmt 1 view .LVU95
+	cmpq	%rsi, %rcx
+	je	.L53
+	.loc 1 239 13 view .LVU96
+	.loc 1 239 35 is_stmt 0 view .LVU97
+	movw	(%rdx,%rsi,2), %di
+	andw	$-1024, %di
+	cmpw	$-9216, %di
+	setne	%dil
+	.loc 1 238 36 view .LVU98
+	incq	%rsi
+.LVL31:
+	.loc 1 239 35 view .LVU99
+	movzbl	%dil, %edi
+	.loc 1 239 15 view .LVU100
+	addq	%rdi, %rax
+.LVL32:
+	.loc 1 238 36 is_stmt 1 view .LVU101
+	.loc 1 238 36 is_stmt 0 view .LVU102
+	jmp	.L25
+.L53:
+	.loc 1 238 36 view .LVU103
+.LBE143:
+	.loc 1 241 9 is_stmt 1 view .LVU104
+	.loc 1 241 18 is_stmt 0 view .LVU105
+	salq	$2, %rax
+.LVL33:
+	.loc 1 241 18 view .LVU106
+	ret
+.LVL34:
+.L23:
+	.loc 1 241 18 view .LVU107
+.LBE139:
+.LBE138:
+	.loc 1 257 5 is_stmt 1 view .LVU108
+	cmpb	$1, %sil
+	je	.L47
+	cmpb	$3, %sil
+	je	.L48
+.L50:
+	.loc 1 257 5 is_stmt 0 view .LVU109
+	xorl	%eax, %eax
+	ret
+.L47:
+.LBB144:
+.LBB145:
+.LBB146:
+.LBB147:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 2 1311 33 view .LVU110
+	movaps	.LC0(%rip), %xmm2
+.LBE147:
+.LBE146:
+.LBE145:
+.LBE144:
+	.loc 1 257 5 view .LVU111
+	movq	%rdi, %rax
+.LBB184:
+.LBB170:
+.LBB150:
+.LBB151:
+	.loc 2 1341 33 view .LVU112
+	xorps	%xmm3, %xmm3
+.LVL35:
+.L30:
+	.loc 2 1341 33 view .LVU113
+.LBE151:
+.LBE150:
+.LBE170:
+	.loc 1 260 18 is_stmt 1 view .LVU114
+	cmpq	%r8, %rdx
+	jnb	.L51
+	.loc 1 263 13 view .LVU115
+	.loc 1 263 20 is_stmt 0 view .LVU116
+	movq	%r8, %rcx
+	subq	%rdx, %rcx
+	.loc 1 263 16 view .LVU117
+	cmpq	$14, %rcx
+	jle	.L32
+.LBB171:
+	.loc 1 264 17 is_stmt 1 view .LVU118
+.LVL36:
+.LBB154:
+.LBI154:
+	.loc 2 701 1 view .LVU119
+.LBB155:
+	.loc 2 703 3 view .LVU120
+	.loc 2 703 10 is_stmt 0 view .LVU121
+	movups	(%rdx), %xmm0
+.LVL37:
+	.loc 2 703 10 view .LVU122
+.LBE155:
+.LBE154:
+	.loc 1 265 17 is_stmt 1 view .LVU123
+.LBB156:
+.LBI146:
+	.loc 2 1309 1 view .LVU124
+.LBB148:
+	.loc 2 1311 3 view .LVU125
+	.loc 2 1311 3 is_stmt 0 view .LVU126
+.LBE148:
+.LBE156:
+	.loc 1 266 17 is_stmt 1 view .LVU127
+.LBB157:
+.LBI150:
+	.loc 2 1339 1 view .LVU128
+.LBB152:
+	.loc 2 1341 3 view .LVU129
+	.loc 2 1341 3 is_stmt 0 view .LVU130
+.LBE152:
+.LBE157:
+.LBB158:
+.LBI158:
+	.loc 2 1431 1 is_stmt 1 view .LVU131
+.LBB159:
+	.loc 2 1433 3 view .LVU132
+.LBE159:
+.LBE158:
+.LBB161:
+.LBB149:
+	.loc 2 1311 33 is_stmt 0 view .LVU133
+	movaps	%xmm0, %xmm1
+	andps	%xmm2, %xmm1
+.LBE149:
+.LBE161:
+.LBB162:
+.LBB153:
+	.loc 2 1341 33 view .LVU134
+	pcmpeqw	%xmm3, %xmm1
+.LBE153:
+.LBE162:
+.LBB163:
+.LBB160:
+	.loc 2 1433 10 view .LVU135
+	pmovmskb	%xmm1, %ecx
+.LVL38:
+	.loc 2 1433 10 view .LVU136
+.LBE160:
+.LBE163:
+	.loc 1 266 20 view .LVU137
+	cmpl	$65535, %ecx
+	jne	.L32
+	.loc 1 267 21 is_stmt 1 view .LVU138
+.LVL39:
+.LBB164:
+.LBI164:
+	.loc 2 998 1 view .LVU139
+.LBB165:
+	.loc 2 1000 3 view .LVU140
+	.loc 2 1000 19 is_stmt 0 view .LVU141
+	packuswb	%xmm0, %xmm0
+.LVL40:
+	.loc 2 1000 19 view .LVU142
+.LBE165:
+.LBE164:
+.LBB166:
+.LBI166:
+	.loc 2 743 1 is_stmt 1 view .LVU143
+.LBB167:
+	.loc 2 745 3 view .LVU144
+.LBE167:
+.LBE166:
+	.loc 1 268 23 is_stmt 0 view .LVU145
+	addq	$16, %rdx
+.LVL41:
+	.loc 1 269 23 view .LVU146
+	addq	$8, %rax
+.LVL42:
+.LBB169:
+.LBB168:
+	.loc 2 745 19 view .LVU147
+	movq	%xmm0, -8(%rax)
+.LVL43:
+	.loc 2 745 19 view .LVU148
+.LBE168:
+.LBE169:
+	.loc 1 268 21 is_stmt 1 view .LVU149
+	.loc 1 269 21 view .LVU150
+	.loc 1 270 21 view .LVU151
+	jmp	.L30
+.LVL44:
+.L32:
+	.loc 1 270 21 is_stmt 0 view .LVU152
+.LBE171:
+	.loc 1 274 13 is_stmt 1 view .LVU153
+.LBB172:
+.LBI172:
+	.file 3 "./include/va_print/impl.h"
+	.loc 3 522 24 view .LVU154
+.LBB173:
+	.loc 3 524 5 view .LVU155
+	.loc 3 525 5 view .LVU156
+	.loc 3 525 19 is_stmt 0 view .LVU157
+	movzwl	(%rdx), %ecx
+	.loc 3 526 22 view .LVU158
+	leal	-55296(%rcx), %r9d
+	.loc 3 525 19 view .LVU159
+	movl	%ecx, %esi
+.LVL45:
+	.loc 3 526 5 is_stmt 1 view .LVU160
+	.loc 3 526 8 is_stmt 0 view .LVU161
+	cmpl	$2047, %r9d
+	jbe	.L34
+	.loc 3 527 9 is_stmt 1 view .LVU162
+	.loc 3 527 17 is_stmt 0 view .LVU163
+	addq	$2, %rdx
+.LVL46:
+	.loc 3 528 9 is_stmt 1 view .LVU164
+	.loc 3 528 9 is_stmt 0 view .LVU165
+.LBE173:
+.LBE172:
+.LBB176:
+.LBI176:
+	.loc 3 451 21 is_stmt 1 view .LVU166
+.LBB177:
+	.loc 3 453 5 view .LVU167
+	.loc 3 453 8 is_stmt 0 view .LVU168
+	cmpl	$127, %ecx
+	ja	.L54
+	.loc 3 454 9 is_stmt 1 view .LVU169
+.LVL47:
+	.loc 3 454 16 is_stmt 0 view .LVU170
+	movb	%cl, (%rax)
+	.loc 3 454 11 view .LVU171
+	incq	%rax
+.LVL48:
+	.loc 3 454 11 view .LVU172
+	jmp	.L30
+.LVL49:
+.L34:
+	.loc 3 454 11 view .LVU173
+.LBE177:
+.LBE176:
+.LBB180:
+.LBB174:
+	.loc 3 530 5 is_stmt 1 view .LVU174
+	.loc 3 531 5 view .LVU175
+	.loc 3 531 40 is_stmt 0 view .LVU176
+	movw	2(%rdx), %si
+	.loc 3 531 25 view .LVU177
+	sall	$10, %ecx
+.LVL50:
+	.loc 3 530 9 view .LVU178
+	addq	$4, %rdx
+.LVL51:
+	.loc 3 530 9 view .LVU179
+.LBE174:
+.LBE180:
+.LBB181:
+.LBB178:
+	.loc 3 469 11 view .LVU180
+	addq	$4, %rax
+.LVL52:
+	.loc 3 469 11 view .LVU181
+.LBE178:
+.LBE181:
+.LBB182:
+.LBB175:
+	.loc 3 531 25 view .LVU182
+	andl	$1047552, %ecx
+	.loc 3 531 40 view .LVU183
+	andl	$1023, %esi
+	.loc 3 531 32 view .LVU184
+	orl	%esi, %ecx
+	.loc 3 531 50 view .LVU185
+	addl	$65536, %ecx
+.LVL53:
+	.loc 3 531 50 view .LVU186
+.LBE175:
+.LBE182:
+.LBB183:
+	.loc 3 451 21 is_stmt 1 view .LVU187
+.LBB179:
+	.loc 3 453 5 view .LVU188
+	.loc 3 456 10 view .LVU189
+	.loc 3 460 10 view .LVU190
+	.loc 3 466 9 view .LVU191
+	.loc 3 466 33 is_stmt 0 view .LVU192
+	movl	%ecx, %esi
+	shrl	$18, %esi
+	.loc 3 466 28 view .LVU193
+	orl	$-16, %esi
+	movb	%sil, -4(%rax)
+	.loc 3 467 9 is_stmt 1 view .LVU194
+	.loc 3 467 34 is_stmt 0 view .LVU195
+	movl	%ecx, %esi
+	shrl	$12, %esi
+	.loc 3 467 41 view .LVU196
+	andl	$63, %esi
+	.loc 3 467 28 view .LVU197
+	orl	$-128, %esi
+	movb	%sil, -3(%rax)
+	.loc 3 468 9 is_stmt 1 view .LVU198
+	.loc 3 468 34 is_stmt 0 view .LVU199
+	movl	%ecx, %esi
+	.loc 3 469 33 view .LVU200
+	andl	$63, %ecx
+.LVL54:
+	.loc 3 468 34 view .LVU201
+	shrl	$6, %esi
+.LVL55:
+	.loc 3 469 28 view .LVU202
+	orl	$-128, %ecx
+	.loc 3 468 40 view .LVU203
+	andl	$63, %esi
+	.loc 3 469 28 view .LVU204
+	movb	%cl, -1(%rax)
+	.loc 3 468 28 view .LVU205
+	orl	$-128, %esi
+	movb	%sil, -2(%rax)
+	.loc 3 469 9 is_stmt 1 view .LVU206
+	jmp	.L30
+.LVL56:
+.L54:
+	.loc 3 456 10 view .LVU207
+	.loc 3 457 33 is_stmt 0 view .LVU208
+	movl	%ecx, %r9d
+	.loc 3 458 33 view .LVU209
+	andl	$63, %esi
+	.loc 3 457 33 view .LVU210
+	shrl	$6, %r9d
+	.loc 3 458 28 view .LVU211
+	orl	$-128, %esi
+	.loc 3 456 13 view .LVU212
+	cmpl	$2047, %ecx
+	ja	.L37
+	.loc 3 457 9 is_stmt 1 view .LVU213
+.LVL57:
+	.loc 3 457 28 is_stmt 0 view .LVU214
+	orl	$-64, %r9d
+	.loc 3 458 14 view .LVU215
+	movb	%sil, 1(%rax)
+	.loc 3 458 11 view .LVU216
+	addq	$2, %rax
+.LVL58:
+	.loc 3 457 28 view .LVU217
+	movb	%r9b, -2(%rax)
+	.loc 3 458 9 is_stmt 1 view .LVU218
+.LVL59:
+	.loc 3 458 9 is_stmt 0 view .LVU219
+	jmp	.L30
+.LVL60:
+.L37:
+	.loc 3 461 9 is_stmt 1 view .LVU220
+	.loc 3 461 33 is_stmt 0 view .LVU221
+	shrl	$12, %ecx
+.LVL61:
+	.loc 3 462 40 view .LVU222
+	andl	$63, %r9d
+	.loc 3 463 14 view .LVU223
+	movb	%sil, 2(%rax)
+.LVL62:
+	.loc 3 463 11 view .LVU224
+	addq	$3, %rax
+.LVL63:
+	.loc 3 461 28 view .LVU225
+	orl	$-32, %ecx
+	.loc 3 462 28 view .LVU226
+	orl	$-128, %r9d
+	.loc 3 461 28 view .LVU227
+	movb	%cl, -3(%rax)
+	.loc 3 462 9 is_stmt 1 view .LVU228
+.LVL64:
+	.loc 3 462 28 is_stmt 0 view .LVU229
+	movb	%r9b, -2(%rax)
+	.loc 3 463 9 is_stmt 1 view .LVU230
+	jmp	.L30
+.LVL65:
+.L48:
+	.loc 3 463 9 is_stmt 0 view .LVU231
+.LBE179:
+.LBE183:
+.LBE184:
+.LBB185:
+.LBB186:
+.LBB187:
+.LBB188:
+	.loc 2 1311 33 view .LVU232
+	movaps	.LC1(%rip), %xmm2
+.LBE188:
+.LBE187:
+.LBB191:
+.LBB192:
+	.loc 2 1341 33 view .LVU233
+	movaps	.LC2(%rip), %xmm3
+.LBE192:
+.LBE191:
+.LBE186:
+.LBE185:
+	.loc 1 257 5 view .LVU234
+	movq	%rdi, %rax
+.LVL66:
+.L31:
+.LBB225:
+	.loc 1 281 18 is_stmt 1 view .LVU235
+	cmpq	%r8, %rdx
+	jnb	.L51
+	.loc 1 284 13 view .LVU236
+	.loc 1 284 20 is_stmt 0 view .LVU237
+	movq	%r8, %rcx
+	subq	%rdx, %rcx
+	.loc 1 284 16 view .LVU238
+	cmpq	$14, %rcx
+	jle	.L39
+.LBB220:
+	.loc 1 285 17 is_stmt 1 view .LVU239
+.LVL67:
+.LBB195:
+.LBI195:
+	.loc 2 701 1 view .LVU240
+.LBB196:
+	.loc 2 703 3 view .LVU241
+	.loc 2 703 10 is_stmt 0 view .LVU242
+	movups	(%rdx), %xmm0
+.LVL68:
+	.loc 2 703 10 view .LVU243
+.LBE196:
+.LBE195:
+	.loc 1 286 17 is_stmt 1 view .LVU244
+.LBB197:
+.LBI187:
+	.loc 2 1309 1 view .LVU245
+.LBB189:
+	.loc 2 1311 3 view .LVU246
+	.loc 2 1311 3 is_stmt 0 view .LVU247
+.LBE189:
+.LBE197:
+	.loc 1 287 17 is_stmt 1 view .LVU248
+.LBB198:
+.LBI191:
+	.loc 2 1339 1 view .LVU249
+.LBB193:
+	.loc 2 1341 3 view .LVU250
+	.loc 2 1341 3 is_stmt 0 view .LVU251
+.LBE193:
+.LBE198:
+.LBB199:
+.LBI199:
+	.loc 2 1431 1 is_stmt 1 view .LVU252
+.LBB200:
+	.loc 2 1433 3 view .LVU253
+.LBE200:
+.LBE199:
+.LBB202:
+.LBB190:
+	.loc 2 1311 33 is_stmt 0 view .LVU254
+	movaps	%xmm0, %xmm1
+	andps	%xmm2, %xmm1
+.LBE190:
+.LBE202:
+.LBB203:
+.LBB194:
+	.loc 2 1341 33 view .LVU255
+	pcmpeqw	%xmm3, %xmm1
+.LBE194:
+.LBE203:
+.LBB204:
+.LBB201:
+	.loc 2 1433 10 view .LVU256
+	pmovmskb	%xmm1, %ecx
+.LVL69:
+	.loc 2 1433 10 view .LVU257
+.LBE201:
+.LBE204:
+	.loc 1 287 20 view .LVU258
+	testl	%ecx, %ecx
+	jne	.L39
+.LBB205:
+	.loc 1 288 21 is_stmt 1 view .LVU259
+.LVL70:
+	.loc 1 289 21 view .LVU260
+.LBB206:
+.LBI206:
+	.loc 2 1034 1 view .LVU261
+.LBB207:
+	.loc 2 1036 3 view .LVU262
+	.loc 2 1036 19 is_stmt 0 view .LVU263
+	xorps	%xmm1, %xmm1
+	movaps	%xmm0, %xmm4
+.LBE207:
+.LBE206:
+	.loc 1 291 23 view .LVU264
+	addq	$16, %rdx
+.LVL71:
+	.loc 1 292 23 view .LVU265
+	addq	$32, %rax
+.LVL72:
+.LBB209:
+.LBB208:
+	.loc 2 1036 19 view .LVU266
+	punpcklwd	%xmm1, %xmm4
+.LVL73:
+	.loc 2 1036 19 view .LVU267
+.LBE208:
+.LBE209:
+.LBB210:
+.LBI210:
+	.loc 2 737 1 is_stmt 1 view .LVU268
+.LBB211:
+	.loc 2 739 3 view .LVU269
+.LBE211:
+.LBE210:
+.LBB213:
+.LBB214:
+	.loc 2 1012 19 is_stmt 0 view .LVU270
+	punpckhwd	%xmm1, %xmm0
+.LVL74:
+	.loc 2 1012 19 view .LVU271
+.LBE214:
+.LBE213:
+.LBB216:
+.LBB212:
+	.loc 2 739 8 view .LVU272
+	movups	%xmm4, -32(%rax)
+.LVL75:
+	.loc 2 739 8 view .LVU273
+.LBE212:
+.LBE216:
+	.loc 1 290 21 is_stmt 1 view .LVU274
+.LBB217:
+.LBI213:
+	.loc 2 1010 1 view .LVU275
+.LBB215:
+	.loc 2 1012 3 view .LVU276
+	.loc 2 1012 3 is_stmt 0 view .LVU277
+.LBE215:
+.LBE217:
+.LBB218:
+.LBI218:
+	.loc 2 737 1 is_stmt 1 view .LVU278
+.LBB219:
+	.loc 2 739 3 view .LVU279
+	.loc 2 739 8 is_stmt 0 view .LVU280
+	movups	%xmm0, -16(%rax)
+.LVL76:
+	.loc 2 739 8 view .LVU281
+.LBE219:
+.LBE218:
+	.loc 1 291 21 is_stmt 1 view .LVU282
+	.loc 1 292 21 view .LVU283
+	.loc 1 293 21 view .LVU284
+	jmp	.L31
+.LVL77:
+.L39:
+	.loc 1 293 21 is_stmt 0 view .LVU285
+.LBE205:
+.LBE220:
+	.loc 1 297 13 is_stmt 1 view .LVU286
+.LBB221:
+.LBB222:
+	.loc 3 525 14 is_stmt 0 view .LVU287
+	movzwl	(%rdx), %ecx
+.LBE222:
+.LBE221:
+	.loc 1 297 15 view .LVU288
+	leaq	4(%rax), %r9
+.LVL78:
+.LBB224:
+.LBI221:
+	.loc 3 522 24 is_stmt 1 view .LVU289
+.LBB223:
+	.loc 3 524 5 view .LVU290
+	.loc 3 525 5 view .LVU291
+	.loc 3 526 5 view .LVU292
+	.loc 3 526 22 is_stmt 0 view .LVU293
+	leal	-55296(%rcx), %esi
+	.loc 3 526 8 view .LVU294
+	cmpl	$2047, %esi
+	jbe	.L41
+	.loc 3 527 9 is_stmt 1 view .LVU295
+	.loc 3 527 17 is_stmt 0 view .LVU296
+	addq	$2, %rdx
+.LVL79:
+	.loc 3 528 9 is_stmt 1 view .LVU297
+	.loc 3 528 16 is_stmt 0 view .LVU298
+	jmp	.L42
+.LVL80:
+.L41:
+	.loc 3 530 5 is_stmt 1 view .LVU299
+	.loc 3 531 5 view .LVU300
+	.loc 3 531 40 is_stmt 0 view .LVU301
+	movw	2(%rdx), %si
+	.loc 3 531 25 view .LVU302
+	sall	$10, %ecx
+.LVL81:
+	.loc 3 530 9 view .LVU303
+	addq	$4, %rdx
+.LVL82:
+	.loc 3 531 25 view .LVU304
+	andl	$1047552, %ecx
+	.loc 3 531 40 view .LVU305
+	andl	$1023, %esi
+	.loc 3 531 32 view .LVU306
+	orl	%esi, %ecx
+	.loc 3 531 50 view .LVU307
+	addl	$65536, %ecx
+.LVL83:
+.L42:
+	.loc 3 531 50 view .LVU308
+.LBE223:
+.LBE224:
+	.loc 1 297 18 view .LVU309
+	movl	%ecx, (%rax)
+	.loc 1 297 15 view .LVU310
+	movq	%r9, %rax
+	jmp	.L31
+.LVL84:
+.L51:
+	.loc 1 299 9 is_stmt 1 view .LVU311
+	.loc 1 299 35 is_stmt 0 view .LVU312
+	subq	%rdi, %rax
+.LVL85:
+	.loc 1 299 35 view .LVU313
+.LBE225:
+	.loc 1 303 1 view .LVU314
+	ret
+	.cfi_endproc
+.LFE549:
+	.size	va_char16_p_transcode_utf16, .-va_char16_p_transcode_utf16
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC3:
+	.string	"src/utf16.c"
+.LC4:
+	.string	"iter->vtab == &va_char16_p_read_vtab_utf16"
+	.text
+	.globl	va_char16_p_set_chunk_mode
+	.type	va_char16_p_set_chunk_mode, @function
+va_char16_p_set_chunk_mode:
+.LVL86:
+.LFB541:
+	.loc 1 76 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 77 4 view .LVU316
+	.loc 1 77 36 is_stmt 0 view .LVU317
+	leaq	va_char16_p_read_vtab_utf16(%rip), %rax
+	cmpq	%rax, (%rdi)
+	je	.L56
+.LBB228:
+.LBI228:
+	.loc 1 74 13 is_stmt 1 view .LVU318
+.LVL87:
+.LBB229:
+	.loc 1 77 13 view .LVU319
+.LBE229:
+.LBE228:
+	.loc 1 76 1 is_stmt 0 view .LVU320
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB231:
+.LBB230:
+	.loc 1 77 13 view .LVU321
+	leaq	__PRETTY_FUNCTION__.3(%rip), %rcx
+	movl	$77, %edx
+	leaq	.LC3(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+.LVL88:
+	.loc 1 77 13 view .LVU322
+	call	__assert_fail@PLT
+.LVL89:
+.L56:
+	.cfi_def_cfa_offset 8
+	.loc 1 77 13 view .LVU323
+.LBE230:
+.LBE231:
+	.loc 1 78 5 is_stmt 1 view .LVU324
+	.loc 1 78 16 is_stmt 0 view .LVU325
+	leaq	va_char16_p_read_vtab_utf16_chunk(%rip), %rax
+	movq	%rax, (%rdi)
+	ret
+	.cfi_endproc
+.LFE541:
+	.size	va_char16_p_set_chunk_mode, .-va_char16_p_set_chunk_mode
+	.section	.rodata.str1.1
+.LC5:
+	.string	"iter->vtab == &va_span16_p_read_vtab_utf16"
+	.text
+	.globl	va_span16_p_set_chunk_mode
+	.type	va_span16_p_set_chunk_mode, @function
+va_span16_p_set_chunk_mode:
+.LVL90:
+.LFB542:
+	.loc 1 83 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 84 4 view .LVU327
+	.loc 1 84 36 is_stmt 0 view .LVU328
+	leaq	va_span16_p_read_vtab_utf16(%rip), %rax
+	cmpq	%rax, (%rdi)
+	je	.L61
+.LBB234:
+.LBI234:
+	.loc 1 81 13 is_stmt 1 view .LVU329
+.LVL91:
+.LBB235:
+	.loc 1 84 13 view .LVU330
+.LBE235:
+.LBE234:
+	.loc 1 83 1 is_stmt 0 view .LVU331
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB237:
+.LBB236:
+	.loc 1 84 13 view .LVU332
+	leaq	__PRETTY_FUNCTION__.2(%rip), %rcx
+	movl	$84, %edx
+	leaq	.LC3(%rip), %rsi
+	leaq	.LC5(%rip), %rdi
+.LVL92:
+	.loc 1 84 13 view .LVU333
+	call	__assert_fail@PLT
+.LVL93:
+.L61:
+	.cfi_def_cfa_offset 8
+	.loc 1 84 13 view .LVU334
+.LBE236:
+.LBE237:
+	.loc 1 85 5 is_stmt 1 view .LVU335
+	.loc 1 85 16 is_stmt 0 view .LVU336
+	leaq	va_span16_p_read_vtab_utf16_chunk(%rip), %rax
+	movq	%rax, (%rdi)
+	ret
+	.cfi_endproc
+.LFE542:
+	.size	va_span16_p_set_chunk_mode, .-va_span16_p_set_chunk_mode
+	.section	.rodata.str1.1
+.LC6:
+	.string	"iter->cur != NULL"
+	.text
+	.globl	va_char16_p_take_utf16
+	.type	va_char16_p_take_utf16, @function
+va_char16_p_take_utf16:
+.LVL94:
+.LFB545:
+	.loc 1 126 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 127 4 view .LVU338
+	.loc 1 127 8 is_stmt 0 view .LVU339
+	movq	8(%rdi), %rdx
+	.loc 1 127 47 view .LVU340
+	testq	%rdx, %rdx
+	jne	.L66
+	.loc 1 127 24 is_stmt 1 discriminator 1 view .LVU341
+	.loc 1 126 1 is_stmt 0 discriminator 1 view .LVU342
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	.loc 1 127 24 discriminator 1 view .LVU343
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$127, %edx
+	leaq	.LC3(%rip), %rsi
+.LVL95:
+	.loc 1 127 24 discriminator 1 view .LVU344
+	leaq	.LC6(%rip), %rdi
+.LVL96:
+	.loc 1 127 24 discriminator 1 view .LVU345
+	call	__assert_fail@PLT
+.LVL97:
+.L66:
+	.cfi_def_cfa_offset 8
+	.loc 1 129 5 is_stmt 1 view .LVU346
+	.loc 1 130 5 view .LVU347
+.LBB248:
+.LBI248:
+	.loc 1 91 12 view .LVU348
+.LBB249:
+	.loc 1 97 5 view .LVU349
+	.loc 1 98 5 view .LVU350
+	.loc 1 99 5 view .LVU351
+.LBE249:
+.LBE248:
+	.loc 1 133 16 is_stmt 0 view .LVU352
+	orl	$-1, %eax
+.LBB252:
+.LBB250:
+	.loc 1 99 8 view .LVU353
+	cmpq	%rsi, %rdx
+	je	.L65
+	.loc 1 103 5 is_stmt 1 view .LVU354
+	.loc 1 103 10 is_stmt 0 view .LVU355
+	movzwl	(%rdx), %eax
+	.loc 1 103 8 view .LVU356
+	testw	%ax, %ax
+	jne	.L68
+	.loc 1 103 33 view .LVU357
+	movq	(%rdi), %rcx
+.LBE250:
+.LBE252:
+	.loc 1 133 16 view .LVU358
+	orl	$-1, %eax
+.LBB253:
+.LBB251:
+	.loc 1 103 19 view .LVU359
+	cmpb	$0, 48(%rcx)
+	je	.L65
+	.loc 1 107 15 view .LVU360
+	xorl	%eax, %eax
+	jmp	.L69
+.L68:
+	.loc 1 107 5 is_stmt 1 view .LVU361
+.LVL98:
+	.loc 1 108 5 view .LVU362
+	.loc 1 108 5 is_stmt 0 view .LVU363
+.LBE251:
+.LBE253:
+	.loc 1 131 5 is_stmt 1 view .LVU364
+	.loc 1 135 5 view .LVU365
+	.loc 1 135 23 is_stmt 0 view .LVU366
+	leal	-55296(%rax), %ecx
+.LBB254:
+.LBB255:
+	.loc 1 98 7 view .LVU367
+	leaq	2(%rdx), %r8
+.LBE255:
+.LBE254:
+	.loc 1 135 8 view .LVU368
+	cmpl	$2047, %ecx
+	jbe	.L70
+.LVL99:
+.L69:
+	.loc 1 136 9 is_stmt 1 view .LVU369
+.LBB258:
+.LBI258:
+	.loc 1 111 13 view .LVU370
+.LBB259:
+	.loc 1 115 5 view .LVU371
+	.loc 1 116 5 view .LVU372
+	.loc 1 117 5 view .LVU373
+	.loc 1 116 7 is_stmt 0 view .LVU374
+	addq	$2, %rdx
+.LVL100:
+	.loc 1 116 7 view .LVU375
+	movq	%rdx, 8(%rdi)
+.LVL101:
+	.loc 1 116 7 view .LVU376
+.LBE259:
+.LBE258:
+	.loc 1 137 9 is_stmt 1 view .LVU377
+	.loc 1 137 16 is_stmt 0 view .LVU378
+	ret
+.LVL102:
+.L70:
+	.loc 1 139 5 is_stmt 1 view .LVU379
+	.loc 1 139 8 is_stmt 0 view .LVU380
+	cmpl	$56319, %eax
+	ja	.L71
+	.loc 1 144 5 is_stmt 1 view .LVU381
+	.loc 1 145 5 view .LVU382
+.LVL103:
+.LBB260:
+.LBI254:
+	.loc 1 91 12 view .LVU383
+.LBB256:
+	.loc 1 97 5 view .LVU384
+	.loc 1 98 5 view .LVU385
+	.loc 1 99 5 view .LVU386
+	.loc 1 99 8 is_stmt 0 view .LVU387
+	cmpq	%r8, %rsi
+	jne	.L72
+.LVL104:
+	.loc 1 99 8 view .LVU388
+.LBE256:
+.LBE260:
+	.loc 1 146 9 is_stmt 1 view .LVU389
+	.loc 1 146 23 is_stmt 0 view .LVU390
+	movq	(%rdi), %rdx
+	.loc 1 146 12 view .LVU391
+	cmpb	$0, 49(%rdx)
+	je	.L71
+	jmp	.L79
+.LVL105:
+.L72:
+.LBB261:
+.LBB257:
+	.loc 1 103 5 is_stmt 1 view .LVU392
+	.loc 1 103 10 is_stmt 0 view .LVU393
+	movw	2(%rdx), %cx
+	.loc 1 103 8 view .LVU394
+	leal	9216(%rcx), %esi
+.LVL106:
+	.loc 1 103 8 view .LVU395
+	cmpw	$1023, %si
+	ja	.L71
+	.loc 1 107 5 is_stmt 1 view .LVU396
+.LVL107:
+	.loc 1 108 5 view .LVU397
+	.loc 1 108 5 is_stmt 0 view .LVU398
+.LBE257:
+.LBE261:
+	.loc 1 152 5 is_stmt 1 view .LVU399
+	.loc 1 157 5 view .LVU400
+.LBB262:
+.LBI262:
+	.loc 1 111 13 view .LVU401
+.LBB263:
+	.loc 1 115 5 view .LVU402
+	.loc 1 116 5 view .LVU403
+	.loc 1 117 5 view .LVU404
+.LBE263:
+.LBE262:
+	.loc 1 160 16 is_stmt 0 view .LVU405
+	sall	$10, %eax
+.LVL108:
+	.loc 1 159 8 view .LVU406
+	andl	$1023, %ecx
+.LVL109:
+.LBB266:
+.LBB264:
+	.loc 1 116 7 view .LVU407
+	addq	$4, %rdx
+.LVL110:
+	.loc 1 116 7 view .LVU408
+.LBE264:
+.LBE266:
+	.loc 1 160 16 view .LVU409
+	andl	$1047552, %eax
+.LBB267:
+.LBB265:
+	.loc 1 116 7 view .LVU410
+	movq	%rdx, 8(%rdi)
+.LVL111:
+	.loc 1 116 7 view .LVU411
+.LBE265:
+.LBE267:
+	.loc 1 158 5 is_stmt 1 view .LVU412
+	.loc 1 159 5 view .LVU413
+	.loc 1 160 5 view .LVU414
+	.loc 1 160 23 is_stmt 0 view .LVU415
+	orl	%ecx, %eax
+	.loc 1 160 28 view .LVU416
+	addl	$65536, %eax
+	ret
+.LVL112:
+.L71:
+	.loc 1 163 5 is_stmt 1 view .LVU417
+.LBB268:
+.LBI268:
+	.loc 1 111 13 view .LVU418
+.LBB269:
+	.loc 1 115 5 view .LVU419
+	.loc 1 116 5 view .LVU420
+	.loc 1 117 5 view .LVU421
+	.loc 1 117 12 is_stmt 0 view .LVU422
+	movq	%r8, 8(%rdi)
+.LVL113:
+	.loc 1 117 12 view .LVU423
+.LBE269:
+.LBE268:
+	.loc 1 164 5 is_stmt 1 view .LVU424
+	.loc 1 164 15 is_stmt 0 view .LVU425
+	orl	$33554432, %eax
+.LVL114:
+	.loc 1 164 15 view .LVU426
+	ret
+.LVL115:
+.L79:
+	.loc 1 133 16 view .LVU427
+	orl	$-1, %eax
+.LVL116:
+.L65:
+	.loc 1 165 1 view .LVU428
+	ret
+	.cfi_endproc
+.LFE545:
+	.size	va_char16_p_take_utf16, .-va_char16_p_take_utf16
+	.section	.rodata.str1.1
+.LC7:
+	.string	"iter_super->cur != NULL"
+	.text
+	.globl	va_span16_p_take_utf16
+	.type	va_span16_p_take_utf16, @function
+va_span16_p_take_utf16:
+.LVL117:
+.LFB558:
+	.loc 1 422 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 423 4 view .LVU430
+	.loc 1 423 14 is_stmt 0 view .LVU431
+	movq	8(%rdi), %rax
+	.loc 1 423 47 view .LVU432
+	testq	%rax, %rax
+	jne	.L81
+.LBB273:
+.LBI273:
+	.loc 1 419 17 is_stmt 1 view .LVU433
+.LVL118:
+.LBB274:
+	.loc 1 423 24 view .LVU434
+.LBE274:
+.LBE273:
+	.loc 1 422 1 is_stmt 0 view .LVU435
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB276:
+.LBB275:
+	.loc 1 423 24 view .LVU436
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx
+	movl	$423, %edx
+	leaq	.LC3(%rip), %rsi
+.LVL119:
+	.loc 1 423 24 view .LVU437
+	leaq	.LC7(%rip), %rdi
+.LVL120:
+	.loc 1 423 24 view .LVU438
+	call	__assert_fail@PLT
+.LVL121:
+.L81:
+	.cfi_def_cfa_offset 8
+	.loc 1 423 24 view .LVU439
+.LBE275:
+.LBE276:
+	.loc 1 424 5 is_stmt 1 view .LVU440
+	.loc 1 424 34 view .LVU441
+	.loc 1 424 82 view .LVU442
+	.loc 1 424 115 view .LVU443
+	.loc 1 424 33 view .LVU444
+	.loc 1 424 129 view .LVU445
+	.loc 1 424 167 view .LVU446
+	.loc 1 424 180 view .LVU447
+	.loc 1 425 5 view .LVU448
+	.loc 1 425 8 is_stmt 0 view .LVU449
+	cmpq	16(%rdi), %rax
+	je	.L82
+	.loc 1 434 5 is_stmt 1 view .LVU450
+	.loc 1 434 12 is_stmt 0 view .LVU451
+	jmp	va_char16_p_take_utf16
+.LVL122:
+.L82:
+	.loc 1 435 1 view .LVU452
+	orl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE558:
+	.size	va_span16_p_take_utf16, .-va_span16_p_take_utf16
+	.globl	va_put_utf16
+	.type	va_put_utf16, @function
+va_put_utf16:
+.LVL123:
+.LFB550:
+	.loc 1 309 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 311 5 view .LVU454
+	.loc 1 311 8 is_stmt 0 view .LVU455
+	movl	%esi, %eax
+	.loc 1 309 1 view .LVU456
+	pushq	%r13
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movq	%rdx, %r13
+	pushq	%r12
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%esi, %ebx
+	pushq	%rcx
+	.cfi_def_cfa_offset 48
+.LBB277:
+.LBB278:
+.LBB279:
+.LBB280:
+.LBB281:
+	.loc 3 576 39 view .LVU457
+	movq	48(%rdi), %rdx
+.LVL124:
+	.loc 3 576 39 view .LVU458
+	subq	40(%rdi), %rdx
+.LBE281:
+.LBE280:
+.LBE279:
+.LBE278:
+.LBE277:
+	.loc 1 311 8 view .LVU459
+	andl	$520093696, %eax
+	je	.L87
+	.loc 1 312 9 is_stmt 1 view .LVU460
+	.loc 1 314 15 is_stmt 0 view .LVU461
+	movzwl	%si, %ebx
+	.loc 1 312 12 view .LVU462
+	cmpl	$33554432, %eax
+	jne	.L88
+	jmp	.L89
+.LVL125:
+.L87:
+	.loc 1 321 5 is_stmt 1 view .LVU463
+.LBB289:
+.LBI289:
+	.loc 3 419 19 view .LVU464
+.LBB290:
+	.loc 3 421 5 view .LVU465
+	.loc 3 421 26 is_stmt 0 view .LVU466
+	leal	-55296(%rsi), %eax
+.LBE290:
+.LBE289:
+	.loc 1 321 8 view .LVU467
+	cmpl	$2047, %eax
+	jbe	.L99
+	cmpl	$1114111, %esi
+	jbe	.L90
+.L99:
+	.loc 1 322 9 is_stmt 1 view .LVU468
+.LVL126:
+.LBB291:
+.LBI291:
+	.loc 3 425 20 view .LVU469
+.LBB292:
+	.loc 3 427 5 view .LVU470
+	.loc 3 427 13 is_stmt 0 view .LVU471
+	movl	32(%rbp), %eax
+	.loc 3 427 8 view .LVU472
+	testl	$939524096, %eax
+	jne	.L88
+	.loc 3 428 9 is_stmt 1 view .LVU473
+.LBB293:
+	.loc 3 428 25 view .LVU474
+.LVL127:
+	.loc 3 428 62 view .LVU475
+	.loc 3 428 101 is_stmt 0 view .LVU476
+	andl	$-939524097, %eax
+	.loc 3 428 123 view .LVU477
+	orl	$402653184, %eax
+	movl	%eax, 32(%rbp)
+	jmp	.L88
+.LVL128:
+.L90:
+	.loc 3 428 123 view .LVU478
+.LBE293:
+.LBE292:
+.LBE291:
+	.loc 1 327 5 is_stmt 1 view .LVU479
+	.loc 1 327 8 is_stmt 0 view .LVU480
+	cmpl	$65535, %esi
+	jbe	.L89
+.LBB294:
+	.loc 1 328 9 is_stmt 1 view .LVU481
+	.loc 1 328 11 is_stmt 0 view .LVU482
+	subl	$65536, %ebx
+.LVL129:
+	.loc 1 329 9 is_stmt 1 view .LVU483
+	.loc 1 329 46 is_stmt 0 view .LVU484
+	movl	%ebx, %r12d
+	.loc 1 330 46 view .LVU485
+	andw	$1023, %bx
+.LVL130:
+	.loc 1 329 46 view .LVU486
+	shrl	$10, %r12d
+.LVL131:
+	.loc 1 330 18 view .LVU487
+	subw	$9216, %bx
+	.loc 1 329 18 view .LVU488
+	subw	$10240, %r12w
+.LVL132:
+	.loc 1 330 9 is_stmt 1 view .LVU489
+	.loc 1 331 9 view .LVU490
+.LBB286:
+.LBI278:
+	.loc 3 585 19 view .LVU491
+.LBB284:
+	.loc 3 587 5 view .LVU492
+.LBB283:
+.LBI280:
+	.loc 3 574 22 view .LVU493
+.LBB282:
+	.loc 3 576 5 view .LVU494
+	.loc 3 576 5 is_stmt 0 view .LVU495
+.LBE282:
+.LBE283:
+	.loc 3 587 8 view .LVU496
+	cmpq	$3, %rdx
+	ja	.L92
+	.loc 3 590 5 is_stmt 1 view .LVU497
+	.loc 3 590 20 is_stmt 0 view .LVU498
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	.loc 3 590 37 view .LVU499
+	testq	%rax, %rax
+	jne	.L93
+.LVL133:
+.L94:
+	.loc 3 590 37 view .LVU500
+.LBE284:
+.LBE286:
+	.loc 1 338 9 is_stmt 1 view .LVU501
+	movzwl	%r12w, %esi
+	movq	%rbp, %rdi
+	call	*%r13
+.LVL134:
+	.loc 1 339 9 view .LVU502
+	movzwl	%bx, %esi
+	jmp	.L111
+.LVL135:
+.L93:
+.LBB287:
+.LBB285:
+	.loc 3 590 40 is_stmt 0 view .LVU503
+	movl	$4, %esi
+.LVL136:
+	.loc 3 590 40 view .LVU504
+	call	*%rax
+.LVL137:
+	.loc 3 590 37 view .LVU505
+	testb	%al, %al
+	je	.L94
+.L92:
+.LVL138:
+	.loc 3 590 37 view .LVU506
+.LBE285:
+.LBE287:
+.LBB288:
+	.loc 1 332 13 is_stmt 1 view .LVU507
+	.loc 1 332 23 is_stmt 0 view .LVU508
+	movq	40(%rbp), %rax
+.LVL139:
+	.loc 1 333 13 is_stmt 1 view .LVU509
+	.loc 1 333 18 is_stmt 0 view .LVU510
+	movw	%r12w, (%rax)
+	.loc 1 334 13 is_stmt 1 view .LVU511
+.LVL140:
+	.loc 1 334 15 is_stmt 0 view .LVU512
+	addq	$4, %rax
+.LVL141:
+	.loc 1 334 18 view .LVU513
+	movw	%bx, -2(%rax)
+	.loc 1 335 13 is_stmt 1 view .LVU514
+	jmp	.L110
+.LVL142:
+.L88:
+	.loc 1 335 13 is_stmt 0 view .LVU515
+.LBE288:
+.LBE294:
+	.loc 1 317 11 view .LVU516
+	movl	$65533, %ebx
+.L89:
+.LVL143:
+	.loc 1 344 5 is_stmt 1 view .LVU517
+.LBB295:
+.LBI295:
+	.loc 3 585 19 view .LVU518
+.LBB296:
+	.loc 3 587 5 view .LVU519
+	.loc 3 587 8 is_stmt 0 view .LVU520
+	cmpq	$1, %rdx
+	ja	.L96
+	.loc 3 590 5 is_stmt 1 view .LVU521
+	.loc 3 590 20 is_stmt 0 view .LVU522
+	movq	0(%rbp), %rax
+	movq	24(%rax), %rax
+	.loc 3 590 37 view .LVU523
+	testq	%rax, %rax
+	jne	.L97
+.LVL144:
+.L98:
+	.loc 3 590 37 view .LVU524
+.LBE296:
+.LBE295:
+	.loc 1 350 5 is_stmt 1 view .LVU525
+	movl	%ebx, %esi
+.LVL145:
+.L111:
+	.loc 1 351 1 is_stmt 0 view .LVU526
+	popq	%rdx
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	.loc 1 350 5 view .LVU527
+	movq	%rbp, %rdi
+	.loc 1 351 1 view .LVU528
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	.loc 1 350 5 view .LVU529
+	movq	%r13, %rax
+	.loc 1 351 1 view .LVU530
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL146:
+	.loc 1 351 1 view .LVU531
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL147:
+	.loc 1 350 5 view .LVU532
+	jmp	*%rax
+.LVL148:
+.L97:
+	.cfi_restore_state
+.LBB298:
+.LBB297:
+	.loc 3 590 40 view .LVU533
+	movl	$2, %esi
+	movq	%rbp, %rdi
+.LVL149:
+	.loc 3 590 40 view .LVU534
+	call	*%rax
+.LVL150:
+	.loc 3 590 37 view .LVU535
+	testb	%al, %al
+	je	.L98
+.L96:
+.LVL151:
+	.loc 3 590 37 view .LVU536
+.LBE297:
+.LBE298:
+.LBB299:
+	.loc 1 345 9 is_stmt 1 view .LVU537
+	.loc 1 345 19 is_stmt 0 view .LVU538
+	movq	40(%rbp), %rax
+.LVL152:
+	.loc 1 346 9 is_stmt 1 view .LVU539
+	.loc 1 346 14 is_stmt 0 view .LVU540
+	movw	%bx, (%rax)
+	.loc 1 347 9 is_stmt 1 view .LVU541
+	.loc 1 346 11 is_stmt 0 view .LVU542
+	addq	$2, %rax
+.LVL153:
+.L110:
+	.loc 1 346 11 view .LVU543
+	movq	%rax, 40(%rbp)
+	.loc 1 348 9 is_stmt 1 view .LVU544
+.LBE299:
+	.loc 1 351 1 is_stmt 0 view .LVU545
+	popq	%rax
+	.cfi_def_cfa_offset 40
+	popq	%rbx
+	.cfi_def_cfa_offset 32
+	popq	%rbp
+	.cfi_def_cfa_offset 24
+.LVL154:
+	.loc 1 351 1 view .LVU546
+	popq	%r12
+	.cfi_def_cfa_offset 16
+	popq	%r13
+	.cfi_def_cfa_offset 8
+.LVL155:
+	.loc 1 351 1 view .LVU547
+	ret
+	.cfi_endproc
+.LFE550:
+	.size	va_put_utf16, .-va_put_utf16
+	.globl	va_len_utf16
+	.type	va_len_utf16, @function
+va_len_utf16:
+.LVL156:
+.LFB551:
+	.loc 1 356 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 358 5 view .LVU549
+	.loc 1 358 8 is_stmt 0 view .LVU550
+	testl	$520093696, %esi
+	jne	.L113
+	.loc 1 363 5 is_stmt 1 view .LVU551
+.LVL157:
+.LBB300:
+.LBI300:
+	.loc 3 419 19 view .LVU552
+.LBB301:
+	.loc 3 421 5 view .LVU553
+	.loc 3 421 26 is_stmt 0 view .LVU554
+	leal	-55296(%rsi), %eax
+.LBE301:
+.LBE300:
+	.loc 1 363 8 view .LVU555
+	cmpl	$2047, %eax
+	jbe	.L117
+	cmpl	$1114111, %esi
+	jbe	.L114
+.L117:
+	.loc 1 364 9 is_stmt 1 view .LVU556
+.LVL158:
+.LBB302:
+.LBI302:
+	.loc 3 425 20 view .LVU557
+.LBB303:
+	.loc 3 427 5 view .LVU558
+	.loc 3 427 13 is_stmt 0 view .LVU559
+	movl	32(%rdi), %eax
+	.loc 3 427 8 view .LVU560
+	testl	$939524096, %eax
+	jne	.L113
+	.loc 3 428 9 is_stmt 1 view .LVU561
+.LBB304:
+	.loc 3 428 25 view .LVU562
+.LVL159:
+	.loc 3 428 62 view .LVU563
+	.loc 3 428 101 is_stmt 0 view .LVU564
+	andl	$-939524097, %eax
+	.loc 3 428 123 view .LVU565
+	orl	$402653184, %eax
+	movl	%eax, 32(%rdi)
+.LVL160:
+.L113:
+	.loc 3 428 123 view .LVU566
+.LBE304:
+.LBE303:
+.LBE302:
+	.loc 1 359 16 view .LVU567
+	movl	$1, %eax
+	ret
+.L114:
+	.loc 1 367 5 is_stmt 1 view .LVU568
+.LVL161:
+.LBB305:
+.LBI305:
+	.loc 3 547 22 view .LVU569
+.LBB306:
+	.loc 3 549 5 view .LVU570
+	.loc 3 549 15 is_stmt 0 view .LVU571
+	cmpl	$65535, %esi
+	jbe	.L113
+	movl	$2, %eax
+.LVL162:
+	.loc 3 549 15 view .LVU572
+.LBE306:
+.LBE305:
+	.loc 1 368 1 view .LVU573
+	ret
+	.cfi_endproc
+.LFE551:
+	.size	va_len_utf16, .-va_len_utf16
+	.globl	va_xprintf_char16_p_utf16
+	.type	va_xprintf_char16_p_utf16, @function
+va_xprintf_char16_p_utf16:
+.LVL163:
+.LFB552:
+	.loc 1 373 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 374 5 view .LVU575
+	.loc 1 373 1 is_stmt 0 view .LVU576
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 374 20 view .LVU577
+	leaq	va_char16_p_read_vtab_utf16(%rip), %rax
+	movq	%rsi, 8(%rsp)
+	.loc 1 375 5 is_stmt 1 view .LVU578
+	.loc 1 375 12 is_stmt 0 view .LVU579
+	movq	%rsp, %rsi
+.LVL164:
+	.loc 1 374 20 view .LVU580
+	movq	%rax, (%rsp)
+	.loc 1 375 12 view .LVU581
+	call	va_xprintf_iter_local@PLT
+.LVL165:
+	.loc 1 376 1 view .LVU582
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE552:
+	.size	va_xprintf_char16_p_utf16, .-va_xprintf_char16_p_utf16
+	.globl	va_xprintf_char16_const_pp_utf16
+	.type	va_xprintf_char16_const_pp_utf16, @function
+va_xprintf_char16_const_pp_utf16:
+.LVL166:
+.LFB553:
+	.loc 1 381 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 382 5 view .LVU584
+	.loc 1 381 1 is_stmt 0 view .LVU585
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 382 20 view .LVU586
+	leaq	va_char16_p_read_vtab_utf16(%rip), %rax
+	.loc 1 381 1 view .LVU587
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 382 20 view .LVU588
+	movq	%rax, (%rsp)
+	movq	(%rsi), %rax
+	.loc 1 383 11 view .LVU589
+	movq	%rsp, %rsi
+.LVL167:
+	.loc 1 382 20 view .LVU590
+	movq	%rax, 8(%rsp)
+	.loc 1 383 5 is_stmt 1 view .LVU591
+	.loc 1 383 11 is_stmt 0 view .LVU592
+	call	va_xprintf_iter_chunk@PLT
+.LVL168:
+	.loc 1 384 5 is_stmt 1 view .LVU593
+	.loc 1 384 8 is_stmt 0 view .LVU594
+	movq	8(%rsp), %rax
+	movq	%rax, 0(%rbp)
+	.loc 1 385 5 is_stmt 1 view .LVU595
+	.loc 1 386 1 is_stmt 0 view .LVU596
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL169:
+	.loc 1 386 1 view .LVU597
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL170:
+	.loc 1 386 1 view .LVU598
+	ret
+	.cfi_endproc
+.LFE553:
+	.size	va_xprintf_char16_const_pp_utf16, .-va_xprintf_char16_const_pp_utf16
+	.globl	va_xprintf_char16_pp_utf16
+	.type	va_xprintf_char16_pp_utf16, @function
+va_xprintf_char16_pp_utf16:
+.LVL171:
+.LFB554:
+	.loc 1 391 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 392 5 view .LVU600
+	.loc 1 392 12 is_stmt 0 view .LVU601
+	jmp	va_xprintf_char16_const_pp_utf16
+.LVL172:
+	.loc 1 392 12 view .LVU602
+	.cfi_endproc
+.LFE554:
+	.size	va_xprintf_char16_pp_utf16, .-va_xprintf_char16_pp_utf16
+	.globl	va_xprintf_last_char16_p_utf16
+	.type	va_xprintf_last_char16_p_utf16, @function
+va_xprintf_last_char16_p_utf16:
+.LVL173:
+.LFB555:
+	.loc 1 398 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 399 5 view .LVU604
+	.loc 1 399 12 is_stmt 0 view .LVU605
+	orl	$64, 32(%rdi)
+	.loc 1 400 5 is_stmt 1 view .LVU606
+	.loc 1 400 12 is_stmt 0 view .LVU607
+	jmp	va_xprintf_char16_p_utf16
+.LVL174:
+	.loc 1 400 12 view .LVU608
+	.cfi_endproc
+.LFE555:
+	.size	va_xprintf_last_char16_p_utf16, .-va_xprintf_last_char16_p_utf16
+	.globl	va_xprintf_last_char16_const_pp_utf16
+	.type	va_xprintf_last_char16_const_pp_utf16, @function
+va_xprintf_last_char16_const_pp_utf16:
+.LVL175:
+.LFB556:
+	.loc 1 406 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 407 5 view .LVU610
+	.loc 1 407 12 is_stmt 0 view .LVU611
+	orl	$64, 32(%rdi)
+	.loc 1 408 5 is_stmt 1 view .LVU612
+	.loc 1 408 12 is_stmt 0 view .LVU613
+	jmp	va_xprintf_char16_const_pp_utf16
+.LVL176:
+	.loc 1 408 12 view .LVU614
+	.cfi_endproc
+.LFE556:
+	.size	va_xprintf_last_char16_const_pp_utf16, .-va_xprintf_last_char16_const_pp_utf16
+	.globl	va_xprintf_last_char16_pp_utf16
+	.type	va_xprintf_last_char16_pp_utf16, @function
+va_xprintf_last_char16_pp_utf16:
+.LFB565:
+	.cfi_startproc
+	.loc 1 411 21 is_stmt 1 view .LVU615
+	jmp	va_xprintf_last_char16_const_pp_utf16
+	.cfi_endproc
+.LFE565:
+	.size	va_xprintf_last_char16_pp_utf16, .-va_xprintf_last_char16_pp_utf16
+	.globl	va_xprintf_span16_p_utf16
+	.type	va_xprintf_span16_p_utf16, @function
+va_xprintf_span16_p_utf16:
+.LVL177:
+.LFB559:
+	.loc 1 440 1 view -0
+	.cfi_startproc
+	.loc 1 441 5 view .LVU617
+	.loc 1 440 1 is_stmt 0 view .LVU618
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 441 24 view .LVU619
+	leaq	va_span16_p_read_vtab_utf16(%rip), %rax
+	.loc 1 443 24 view .LVU620
+	movq	(%rsi), %rdx
+	.loc 1 441 24 view .LVU621
+	movq	%rax, (%rsp)
+	.loc 1 442 70 view .LVU622
+	movq	8(%rsi), %rax
+	.loc 1 445 12 view .LVU623
+	movq	%rsp, %rsi
+.LVL178:
+	.loc 1 443 24 view .LVU624
+	addq	%rdx, %rdx
+	.loc 1 441 24 view .LVU625
+	movq	%rax, 8(%rsp)
+	.loc 1 443 24 view .LVU626
+	addq	%rdx, %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 445 5 is_stmt 1 view .LVU627
+	.loc 1 445 12 is_stmt 0 view .LVU628
+	call	va_xprintf_iter_local@PLT
+.LVL179:
+	.loc 1 446 1 view .LVU629
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE559:
+	.size	va_xprintf_span16_p_utf16, .-va_xprintf_span16_p_utf16
+	.globl	va_xprintf_last_span16_p_utf16
+	.type	va_xprintf_last_span16_p_utf16, @function
+va_xprintf_last_span16_p_utf16:
+.LVL180:
+.LFB560:
+	.loc 1 451 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 452 5 view .LVU631
+	.loc 1 452 12 is_stmt 0 view .LVU632
+	orl	$64, 32(%rdi)
+	.loc 1 453 5 is_stmt 1 view .LVU633
+	.loc 1 453 12 is_stmt 0 view .LVU634
+	jmp	va_xprintf_span16_p_utf16
+.LVL181:
+	.loc 1 453 12 view .LVU635
+	.cfi_endproc
+.LFE560:
+	.size	va_xprintf_last_span16_p_utf16, .-va_xprintf_last_span16_p_utf16
+	.section	.rodata
+	.align 16
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 23
+__PRETTY_FUNCTION__.0:
+	.string	"va_span16_p_take_utf16"
+	.align 16
+	.type	__PRETTY_FUNCTION__.1, @object
+	.size	__PRETTY_FUNCTION__.1, 23
+__PRETTY_FUNCTION__.1:
+	.string	"va_char16_p_take_utf16"
+	.align 16
+	.type	__PRETTY_FUNCTION__.2, @object
+	.size	__PRETTY_FUNCTION__.2, 27
+__PRETTY_FUNCTION__.2:
+	.string	"va_span16_p_set_chunk_mode"
+	.align 16
+	.type	__PRETTY_FUNCTION__.3, @object
+	.size	__PRETTY_FUNCTION__.3, 27
+__PRETTY_FUNCTION__.3:
+	.string	"va_char16_p_set_chunk_mode"
+	.globl	va_span16_p_read_vtab_utf16_chunk
+	.section	.rodata.str1.1
+.LC8:
+	.string	"char16_t*"
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	va_span16_p_read_vtab_utf16_chunk, @object
+	.size	va_span16_p_read_vtab_utf16_chunk, 56
+va_span16_p_read_vtab_utf16_chunk:
+	.quad	.LC8
+	.quad	va_span16_p_take_utf16
+	.quad	va_char16_p_end
+	.quad	0
+	.quad	va_span16_p_bulk_utf16
+	.quad	va_char16_p_transcode_utf16
+	.byte	1
+	.byte	1
+	.byte	117
+	.byte	2
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_char16_p_read_vtab_utf16_chunk
+	.align 32
+	.type	va_char16_p_read_vtab_utf16_chunk, @object
+	.size	va_char16_p_read_vtab_utf16_chunk, 56
+va_char16_p_read_vtab_utf16_chunk:
+	.quad	.LC8
+	.quad	va_char16_p_take_utf16
+	.quad	va_char16_p_end
+	.quad	0
+	.quad	va_char16_p_bulk_utf16
+	.quad	va_char16_p_transcode_utf16
+	.byte	0
+	.byte	1
+	.byte	117
+	.byte	2
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_span16_p_read_vtab_utf16
+	.align 32
+	.type	va_span16_p_read_vtab_utf16, @object
+	.size	va_span16_p_read_vtab_utf16, 56
+va_span16_p_read_vtab_utf16:
+	.quad	.LC8
+	.quad	va_span16_p_take_utf16
+	.quad	va_char16_p_end
+	.quad	va_span16_p_set_chunk_mode
+	.quad	va_span16_p_bulk_utf16
+	.quad	va_char16_p_transcode_utf16
+	.byte	1
+	.byte	0
+	.byte	117
+	.byte	2
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_char16_p_read_vtab_utf16
+	.align 32
+	.type	va_char16_p_read_vtab_utf16, @object
+	.size	va_char16_p_read_vtab_utf16, 56
+va_char16_p_read_vtab_utf16:
+	.quad	.LC8
+	.quad	va_char16_p_take_utf16
+	.quad	va_char16_p_end
+	.quad	va_char16_p_set_chunk_mode
+	.quad	va_char16_p_bulk_utf16
+	.quad	va_char16_p_transcode_utf16
+	.byte	0
+	.byte	0
+	.byte	117
+	.byte	2
+	.string	""
+	.string	""
+	.zero	2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC0:
+	.quad	-35747867511423104
+	.quad	-35747867511423104
+	.align 16
+.LC1:
+	.quad	-576188069258921984
+	.quad	-576188069258921984
+	.align 16
+.LC2:
+	.value	-10240
+	.value	-10240
+	.value	-10240
+	.value	-10240
+	.value	-10240
+	.value	-10240
+	.value	-10240
+	.value	-10240
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/uchar.h"
+	.file 7 "./include/va_print/base.h"
+	.file 8 "./include/va_print/utf16.h"
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mmintrin.h"
+	.file 10 "./include/va_print/core.h"
+	.file 11 "/usr/include/assert.h"
+	.file 12 "./include/va_print/char.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1e7d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x45
+	.long	.LASF1212
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1078
+	.uleb128 0x7
+	.long	.LASF1087
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x45
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1079
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1080
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1081
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1082
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1084
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1085
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1086
+	.uleb128 0x7
+	.long	.LASF1088
+	.byte	0x5
+	.byte	0x28
+	.byte	0x1c
+	.long	0x68
+	.uleb128 0x7
+	.long	.LASF1089
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6f
+	.uleb128 0x7
+	.long	.LASF1090
+	.byte	0x5
+	.byte	0x37
+	.byte	0x14
+	.long	0x84
+	.uleb128 0x7
+	.long	.LASF1091
+	.byte	0x5
+	.byte	0x39
+	.byte	0x14
+	.long	0x90
+	.uleb128 0x47
+	.byte	0x8
+	.uleb128 0x2
+	.long	0xbb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1092
+	.uleb128 0x8
+	.long	0xbb
+	.uleb128 0x19
+	.long	0xbb
+	.long	0xd7
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1093
+	.byte	0x6
+	.byte	0x33
+	.byte	0x1a
+	.long	0x9c
+	.uleb128 0x8
+	.long	0xd7
+	.uleb128 0x7
+	.long	.LASF1094
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.long	0xa8
+	.uleb128 0x2f
+	.byte	0x38
+	.byte	0x7
+	.byte	0xc1
+	.long	0x18c
+	.uleb128 0xf
+	.long	.LASF1095
+	.byte	0x7
+	.byte	0xc4
+	.byte	0x11
+	.long	0x18c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1096
+	.byte	0x7
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1e5
+	.byte	0x8
+	.uleb128 0x26
+	.string	"end"
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1fe
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF1097
+	.byte	0x7
+	.byte	0xdb
+	.byte	0xc
+	.long	0x20e
+	.byte	0x18
+	.uleb128 0xf
+	.long	.LASF1098
+	.byte	0x7
+	.byte	0xe2
+	.byte	0xe
+	.long	0x23b
+	.byte	0x20
+	.uleb128 0xf
+	.long	.LASF1099
+	.byte	0x7
+	.byte	0xec
+	.byte	0xe
+	.long	0x25e
+	.byte	0x28
+	.uleb128 0xf
+	.long	.LASF1100
+	.byte	0x7
+	.byte	0xf1
+	.byte	0x13
+	.long	0x61
+	.byte	0x30
+	.uleb128 0xf
+	.long	.LASF1101
+	.byte	0x7
+	.byte	0xf5
+	.byte	0x13
+	.long	0x61
+	.byte	0x31
+	.uleb128 0xf
+	.long	.LASF1102
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x61
+	.byte	0x32
+	.uleb128 0x26
+	.string	"enc"
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x13
+	.long	0x61
+	.byte	0x33
+	.uleb128 0xf
+	.long	.LASF1103
+	.byte	0x7
+	.byte	0xff
+	.byte	0xa
+	.long	0xc7
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.long	0xc2
+	.uleb128 0x8
+	.long	0x18c
+	.uleb128 0x1b
+	.long	0x6f
+	.long	0x1aa
+	.uleb128 0x3
+	.long	0x1aa
+	.uleb128 0x3
+	.long	0x1df
+	.byte	0
+	.uleb128 0x2
+	.long	0x1af
+	.uleb128 0x27
+	.long	.LASF1110
+	.byte	0x10
+	.byte	0x7
+	.value	0x132
+	.byte	0x10
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF1104
+	.byte	0x7
+	.value	0x135
+	.byte	0x20
+	.long	0x275
+	.byte	0
+	.uleb128 0x10
+	.string	"cur"
+	.byte	0x7
+	.value	0x138
+	.byte	0x11
+	.long	0x1df
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0x1af
+	.uleb128 0x2
+	.long	0x1e4
+	.uleb128 0x48
+	.uleb128 0x2
+	.long	0x196
+	.uleb128 0x1b
+	.long	0x1df
+	.long	0x1fe
+	.uleb128 0x3
+	.long	0x1aa
+	.uleb128 0x3
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x1ea
+	.uleb128 0x22
+	.long	0x20e
+	.uleb128 0x3
+	.long	0x1aa
+	.byte	0
+	.uleb128 0x2
+	.long	0x203
+	.uleb128 0x1b
+	.long	0x39
+	.long	0x231
+	.uleb128 0x3
+	.long	0x231
+	.uleb128 0x3
+	.long	0x1df
+	.uleb128 0x3
+	.long	0x39
+	.uleb128 0x3
+	.long	0x236
+	.byte	0
+	.uleb128 0x2
+	.long	0x1da
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x213
+	.uleb128 0x1b
+	.long	0x39
+	.long	0x25e
+	.uleb128 0x3
+	.long	0xb4
+	.uleb128 0x3
+	.long	0x61
+	.uleb128 0x3
+	.long	0x1df
+	.uleb128 0x3
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x240
+	.uleb128 0x11
+	.long	.LASF1105
+	.byte	0x7
+	.value	0x100
+	.byte	0x3
+	.long	0xf4
+	.uleb128 0x8
+	.long	0x263
+	.uleb128 0x2
+	.long	0x270
+	.uleb128 0x11
+	.long	.LASF1106
+	.byte	0x7
+	.value	0x139
+	.byte	0x3
+	.long	0x1af
+	.uleb128 0x8
+	.long	0x27a
+	.uleb128 0x30
+	.byte	0x18
+	.value	0x13f
+	.long	0x2b1
+	.uleb128 0x6
+	.long	.LASF1107
+	.byte	0x7
+	.value	0x140
+	.byte	0x14
+	.long	0x27a
+	.byte	0
+	.uleb128 0x10
+	.string	"end"
+	.byte	0x7
+	.value	0x141
+	.byte	0x11
+	.long	0x1df
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1108
+	.byte	0x7
+	.value	0x142
+	.byte	0x3
+	.long	0x28c
+	.uleb128 0x8
+	.long	0x2b1
+	.uleb128 0x11
+	.long	.LASF1109
+	.byte	0x7
+	.value	0x169
+	.byte	0x1a
+	.long	0x2d5
+	.uleb128 0x8
+	.long	0x2c3
+	.uleb128 0x27
+	.long	.LASF1111
+	.byte	0x40
+	.byte	0x7
+	.value	0x1b7
+	.byte	0x8
+	.long	0x354
+	.uleb128 0x6
+	.long	.LASF1104
+	.byte	0x7
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x4c7
+	.byte	0
+	.uleb128 0x10
+	.string	"pat"
+	.byte	0x7
+	.value	0x1b9
+	.byte	0x14
+	.long	0x27a
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1112
+	.byte	0x7
+	.value	0x1ba
+	.byte	0xe
+	.long	0x6f
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1113
+	.byte	0x7
+	.value	0x1bb
+	.byte	0xe
+	.long	0x6f
+	.byte	0x1c
+	.uleb128 0x10
+	.string	"opt"
+	.byte	0x7
+	.value	0x1bc
+	.byte	0xe
+	.long	0x6f
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1114
+	.byte	0x7
+	.value	0x1bd
+	.byte	0xe
+	.long	0x6f
+	.byte	0x24
+	.uleb128 0x10
+	.string	"win"
+	.byte	0x7
+	.value	0x1be
+	.byte	0x11
+	.long	0x4ba
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1115
+	.byte	0x7
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x4cc
+	.byte	0x38
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1116
+	.byte	0x7
+	.value	0x16c
+	.byte	0x1e
+	.long	0x366
+	.uleb128 0x8
+	.long	0x354
+	.uleb128 0x27
+	.long	.LASF1117
+	.byte	0x40
+	.byte	0x3
+	.value	0x14f
+	.byte	0x8
+	.long	0x381
+	.uleb128 0x10
+	.string	"q"
+	.byte	0x3
+	.value	0x150
+	.byte	0x1b
+	.long	0x63b
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.byte	0x38
+	.value	0x174
+	.long	0x3fa
+	.uleb128 0x6
+	.long	.LASF1118
+	.byte	0x7
+	.value	0x176
+	.byte	0xc
+	.long	0x40a
+	.byte	0
+	.uleb128 0x10
+	.string	"put"
+	.byte	0x7
+	.value	0x178
+	.byte	0xc
+	.long	0x41f
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1119
+	.byte	0x7
+	.value	0x17b
+	.byte	0xc
+	.long	0x40a
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1120
+	.byte	0x7
+	.value	0x182
+	.byte	0xb
+	.long	0x43f
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1121
+	.byte	0x7
+	.value	0x186
+	.byte	0xc
+	.long	0x459
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1122
+	.byte	0x7
+	.value	0x18c
+	.byte	0xc
+	.long	0x46e
+	.byte	0x28
+	.uleb128 0x10
+	.string	"enc"
+	.byte	0x7
+	.value	0x191
+	.byte	0x13
+	.long	0x61
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF1103
+	.byte	0x7
+	.value	0x192
+	.byte	0xa
+	.long	0x473
+	.byte	0x31
+	.byte	0
+	.uleb128 0x22
+	.long	0x405
+	.uleb128 0x3
+	.long	0x405
+	.byte	0
+	.uleb128 0x2
+	.long	0x2c3
+	.uleb128 0x2
+	.long	0x3fa
+	.uleb128 0x22
+	.long	0x41f
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x6f
+	.byte	0
+	.uleb128 0x2
+	.long	0x40f
+	.uleb128 0x1b
+	.long	0x438
+	.long	0x438
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x39
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1123
+	.uleb128 0x2
+	.long	0x424
+	.uleb128 0x22
+	.long	0x459
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x6f
+	.uleb128 0x3
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x444
+	.uleb128 0x22
+	.long	0x46e
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x45e
+	.uleb128 0x19
+	.long	0xbb
+	.long	0x483
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1124
+	.byte	0x7
+	.value	0x193
+	.byte	0x3
+	.long	0x381
+	.uleb128 0x8
+	.long	0x483
+	.uleb128 0x30
+	.byte	0x10
+	.value	0x19a
+	.long	0x4ba
+	.uleb128 0x10
+	.string	"cur"
+	.byte	0x7
+	.value	0x19b
+	.byte	0xb
+	.long	0xb4
+	.byte	0
+	.uleb128 0x10
+	.string	"end"
+	.byte	0x7
+	.value	0x19c
+	.byte	0xb
+	.long	0xb4
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1125
+	.byte	0x7
+	.value	0x19d
+	.byte	0x3
+	.long	0x495
+	.uleb128 0x2
+	.long	0x490
+	.uleb128 0x2
+	.long	0x361
+	.uleb128 0x27
+	.long	.LASF1126
+	.byte	0x10
+	.byte	0x7
+	.value	0x1ec
+	.byte	0x10
+	.long	0x4fc
+	.uleb128 0x6
+	.long	.LASF1127
+	.byte	0x7
+	.value	0x1ed
+	.byte	0xc
+	.long	0x39
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1128
+	.byte	0x7
+	.value	0x1ee
+	.byte	0x15
+	.long	0x4fc
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	0xe3
+	.uleb128 0x11
+	.long	.LASF1129
+	.byte	0x7
+	.value	0x1ef
+	.byte	0x3
+	.long	0x4d1
+	.uleb128 0x8
+	.long	0x501
+	.uleb128 0x28
+	.long	.LASF1130
+	.byte	0x18
+	.long	0x270
+	.uleb128 0x28
+	.long	.LASF1131
+	.byte	0x19
+	.long	0x270
+	.uleb128 0x28
+	.long	.LASF1132
+	.byte	0x1a
+	.long	0x270
+	.uleb128 0x28
+	.long	.LASF1133
+	.byte	0x1b
+	.long	0x270
+	.uleb128 0x2f
+	.byte	0x88
+	.byte	0x3
+	.byte	0xc9
+	.long	0x55e
+	.uleb128 0x26
+	.string	"cls"
+	.byte	0x3
+	.byte	0xce
+	.byte	0x13
+	.long	0x55e
+	.byte	0
+	.uleb128 0x26
+	.string	"esc"
+	.byte	0x3
+	.byte	0xd5
+	.byte	0x18
+	.long	0x56e
+	.byte	0x80
+	.byte	0
+	.uleb128 0x19
+	.long	0x61
+	.long	0x56e
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2
+	.long	0x191
+	.uleb128 0x7
+	.long	.LASF1134
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x3
+	.long	0x53b
+	.uleb128 0x8
+	.long	0x573
+	.uleb128 0x2f
+	.byte	0x38
+	.byte	0x3
+	.byte	0xe0
+	.long	0x5e0
+	.uleb128 0xf
+	.long	.LASF1135
+	.byte	0x3
+	.byte	0xef
+	.byte	0x18
+	.long	0x5e0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1136
+	.byte	0x3
+	.value	0x101
+	.byte	0xb
+	.long	0x60b
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1137
+	.byte	0x3
+	.value	0x10e
+	.byte	0xb
+	.long	0x61f
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1138
+	.byte	0x3
+	.value	0x12a
+	.byte	0xc
+	.long	0x41f
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1139
+	.byte	0x3
+	.value	0x131
+	.byte	0xc
+	.long	0x40a
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1140
+	.byte	0x3
+	.value	0x141
+	.byte	0x21
+	.long	0x624
+	.byte	0x30
+	.byte	0
+	.uleb128 0x19
+	.long	0x5f0
+	.long	0x5f0
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1141
+	.uleb128 0x1b
+	.long	0x438
+	.long	0x60b
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x6f
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f7
+	.uleb128 0x1b
+	.long	0x438
+	.long	0x61f
+	.uleb128 0x3
+	.long	0x405
+	.byte	0
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x2
+	.long	0x57f
+	.uleb128 0x11
+	.long	.LASF1142
+	.byte	0x3
+	.value	0x142
+	.byte	0x3
+	.long	0x584
+	.uleb128 0x8
+	.long	0x629
+	.uleb128 0x19
+	.long	0x64b
+	.long	0x64b
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2
+	.long	0x636
+	.uleb128 0x7
+	.long	.LASF1143
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xd
+	.long	0x65c
+	.uleb128 0x1c
+	.long	0x4c
+	.long	0x668
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1152
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.long	0x65c
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1144
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1145
+	.uleb128 0x7
+	.long	.LASF1146
+	.byte	0x2
+	.byte	0x29
+	.byte	0x13
+	.long	0x68e
+	.uleb128 0x1c
+	.long	0x53
+	.long	0x69a
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1147
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x6a6
+	.uleb128 0x1c
+	.long	0x5f0
+	.long	0x6b2
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1148
+	.byte	0x2
+	.byte	0x2b
+	.byte	0xd
+	.long	0x6be
+	.uleb128 0x1c
+	.long	0x4c
+	.long	0x6ca
+	.uleb128 0x1d
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1149
+	.byte	0x2
+	.byte	0x2d
+	.byte	0xf
+	.long	0x6d6
+	.uleb128 0x1c
+	.long	0x7d
+	.long	0x6e2
+	.uleb128 0x1d
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1150
+	.byte	0x2
+	.byte	0x2f
+	.byte	0xe
+	.long	0x6ee
+	.uleb128 0x1c
+	.long	0xbb
+	.long	0x6fa
+	.uleb128 0x1d
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1151
+	.byte	0x2
+	.byte	0x35
+	.byte	0x13
+	.long	0x706
+	.uleb128 0x1c
+	.long	0x53
+	.long	0x712
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF1153
+	.byte	0x2
+	.byte	0x39
+	.byte	0x13
+	.long	0x706
+	.uleb128 0x8
+	.long	0x712
+	.uleb128 0x29
+	.long	0x513
+	.byte	0x12
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_char16_p_read_vtab_utf16
+	.uleb128 0x29
+	.long	0x51d
+	.byte	0x20
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_span16_p_read_vtab_utf16
+	.uleb128 0x29
+	.long	0x527
+	.byte	0x2e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_char16_p_read_vtab_utf16_chunk
+	.uleb128 0x29
+	.long	0x531
+	.byte	0x3c
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_span16_p_read_vtab_utf16_chunk
+	.uleb128 0x31
+	.long	.LASF1154
+	.byte	0xa
+	.value	0x10f
+	.byte	0x15
+	.long	0x405
+	.long	0x77f
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x77f
+	.byte	0
+	.uleb128 0x2
+	.long	0x27a
+	.uleb128 0x31
+	.long	.LASF1155
+	.byte	0xa
+	.value	0x112
+	.byte	0x15
+	.long	0x405
+	.long	0x7a0
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0x77f
+	.byte	0
+	.uleb128 0x49
+	.long	.LASF1156
+	.byte	0xb
+	.byte	0x45
+	.byte	0xd
+	.long	0x7c1
+	.uleb128 0x3
+	.long	0x18c
+	.uleb128 0x3
+	.long	0x18c
+	.uleb128 0x3
+	.long	0x6f
+	.uleb128 0x3
+	.long	0x18c
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1157
+	.byte	0xc
+	.value	0x10c
+	.byte	0x14
+	.long	0x1df
+	.long	0x7dd
+	.uleb128 0x3
+	.long	0x77f
+	.uleb128 0x3
+	.long	0x39
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1158
+	.value	0x1c0
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB560
+	.quad	.LFE560-.LFB560
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x840
+	.uleb128 0xa
+	.string	"s"
+	.value	0x1c1
+	.byte	0x12
+	.long	0x405
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0xa
+	.string	"x"
+	.value	0x1c2
+	.byte	0x18
+	.long	0x840
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x24
+	.quad	.LVL181
+	.long	0x845
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x50e
+	.uleb128 0x1e
+	.long	.LASF1159
+	.value	0x1b5
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB559
+	.quad	.LFE559-.LFB559
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b6
+	.uleb128 0xa
+	.string	"s"
+	.value	0x1b6
+	.byte	0x12
+	.long	0x405
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0xa
+	.string	"x"
+	.value	0x1b7
+	.byte	0x18
+	.long	0x840
+	.long	.LLST142
+	.long	.LVUS142
+	.uleb128 0x32
+	.long	.LASF1162
+	.value	0x1b9
+	.byte	0x18
+	.long	0x2b1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1f
+	.quad	.LVL179
+	.long	0x784
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF1160
+	.value	0x1a3
+	.byte	0x11
+	.long	0x6f
+	.long	0x93f
+	.uleb128 0x12
+	.long	.LASF1161
+	.byte	0x1
+	.value	0x1a4
+	.byte	0x15
+	.long	0x77f
+	.uleb128 0x5
+	.string	"end"
+	.byte	0x1
+	.value	0x1a5
+	.byte	0x11
+	.long	0x1df
+	.uleb128 0x2a
+	.long	.LASF1176
+	.long	0x94f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0x33
+	.long	.LASF1162
+	.byte	0x19
+	.long	0x954
+	.uleb128 0x2b
+	.uleb128 0x33
+	.long	.LASF1163
+	.byte	0x3d
+	.long	0x77f
+	.uleb128 0x11
+	.long	.LASF1164
+	.byte	0x1
+	.value	0x1a8
+	.byte	0x6c
+	.long	0x2b1
+	.uleb128 0x15
+	.string	"r_"
+	.byte	0x1
+	.value	0x1a8
+	.byte	0x7a
+	.long	0x921
+	.uleb128 0x2
+	.long	0x908
+	.uleb128 0x15
+	.string	"r2_"
+	.byte	0x1
+	.value	0x1a8
+	.byte	0x2d
+	.long	0x921
+	.uleb128 0x33
+	.long	.LASF1165
+	.byte	0x99
+	.long	0x77f
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0xc2
+	.long	0x94f
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x16
+	.byte	0
+	.uleb128 0x8
+	.long	0x93f
+	.uleb128 0x2
+	.long	0x2b1
+	.uleb128 0x4a
+	.long	.LASF1182
+	.byte	0x1
+	.value	0x19b
+	.byte	0x15
+	.long	0x405
+	.long	0x981
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x1
+	.value	0x19c
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x1
+	.value	0x19d
+	.byte	0x10
+	.long	0x981
+	.byte	0
+	.uleb128 0x2
+	.long	0x986
+	.uleb128 0x2
+	.long	0xd7
+	.uleb128 0x1e
+	.long	.LASF1166
+	.value	0x193
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB556
+	.quad	.LFE556-.LFB556
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9ee
+	.uleb128 0xa
+	.string	"s"
+	.value	0x194
+	.byte	0x12
+	.long	0x405
+	.long	.LLST139
+	.long	.LVUS139
+	.uleb128 0xa
+	.string	"x"
+	.value	0x195
+	.byte	0x16
+	.long	0x9ee
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x24
+	.quad	.LVL176
+	.long	0xa7d
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x4fc
+	.uleb128 0x1e
+	.long	.LASF1167
+	.value	0x18b
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB555
+	.quad	.LFE555-.LFB555
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa56
+	.uleb128 0xa
+	.string	"s"
+	.value	0x18c
+	.byte	0x12
+	.long	0x405
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0xa
+	.string	"x"
+	.value	0x18d
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST138
+	.long	.LVUS138
+	.uleb128 0x24
+	.quad	.LVL174
+	.long	0xaed
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF1168
+	.value	0x184
+	.byte	0x15
+	.long	0x405
+	.long	0xa7d
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x1
+	.value	0x185
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x1
+	.value	0x186
+	.byte	0x10
+	.long	0x981
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1169
+	.value	0x17a
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB553
+	.quad	.LFE553-.LFB553
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaed
+	.uleb128 0xa
+	.string	"s"
+	.value	0x17b
+	.byte	0x12
+	.long	0x405
+	.long	.LLST133
+	.long	.LVUS133
+	.uleb128 0xa
+	.string	"x"
+	.value	0x17c
+	.byte	0x16
+	.long	0x9ee
+	.long	.LLST134
+	.long	.LVUS134
+	.uleb128 0x32
+	.long	.LASF1162
+	.value	0x17e
+	.byte	0x14
+	.long	0x27a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1f
+	.quad	.LVL168
+	.long	0x763
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1170
+	.value	0x172
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB552
+	.quad	.LFE552-.LFB552
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb5e
+	.uleb128 0xa
+	.string	"s"
+	.value	0x173
+	.byte	0x12
+	.long	0x405
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0xa
+	.string	"x"
+	.value	0x174
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST132
+	.long	.LVUS132
+	.uleb128 0x32
+	.long	.LASF1162
+	.value	0x176
+	.byte	0x14
+	.long	0x27a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1f
+	.quad	.LVL165
+	.long	0x784
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1171
+	.value	0x161
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB551
+	.quad	.LFE551-.LFB551
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc5e
+	.uleb128 0x3c
+	.string	"s"
+	.value	0x162
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3c
+	.string	"c"
+	.value	0x163
+	.byte	0xe
+	.long	0x6f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x20
+	.long	0x1c2c
+	.quad	.LBI300
+	.byte	.LVU552
+	.quad	.LBB300
+	.quad	.LBE300-.LBB300
+	.value	0x16b
+	.byte	0xa
+	.long	0xbcb
+	.uleb128 0x1
+	.long	0x1c3c
+	.long	.LLST126
+	.long	.LVUS126
+	.byte	0
+	.uleb128 0x20
+	.long	0x1bf8
+	.quad	.LBI302
+	.byte	.LVU557
+	.quad	.LBB302
+	.quad	.LBE302-.LBB302
+	.value	0x16c
+	.byte	0x9
+	.long	0xc2e
+	.uleb128 0x1
+	.long	0x1c11
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x1
+	.long	0x1c06
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x34
+	.long	0x1c1c
+	.quad	.LBB304
+	.quad	.LBE304-.LBB304
+	.uleb128 0x9
+	.long	0x1c1d
+	.long	.LLST129
+	.long	.LVUS129
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	0x1b82
+	.quad	.LBI305
+	.byte	.LVU569
+	.quad	.LBB305
+	.quad	.LBE305-.LBB305
+	.value	0x16f
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1b92
+	.long	.LLST130
+	.long	.LVUS130
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF1213
+	.byte	0x1
+	.value	0x131
+	.byte	0xd
+	.quad	.LFB550
+	.quad	.LFE550-.LFB550
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xec2
+	.uleb128 0xa
+	.string	"s"
+	.value	0x132
+	.byte	0x12
+	.long	0x405
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0xa
+	.string	"c"
+	.value	0x133
+	.byte	0xe
+	.long	0x6f
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0xa
+	.string	"put"
+	.value	0x134
+	.byte	0xc
+	.long	0xed2
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x4c
+	.long	.LASF1177
+	.byte	0x1
+	.value	0x157
+	.byte	0x1
+	.quad	.L89
+	.uleb128 0x25
+	.long	.LLRL109
+	.long	0xda4
+	.uleb128 0x16
+	.string	"hi"
+	.value	0x149
+	.byte	0x12
+	.long	0xd7
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x16
+	.string	"lo"
+	.value	0x14a
+	.byte	0x12
+	.long	0xd7
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x35
+	.quad	.LBB288
+	.quad	.LBE288-.LBB288
+	.long	0xd1d
+	.uleb128 0x16
+	.string	"w"
+	.value	0x14c
+	.byte	0x17
+	.long	0x986
+	.long	.LLST117
+	.long	.LVUS117
+	.byte	0
+	.uleb128 0xc
+	.long	0x1b3a
+	.quad	.LBI278
+	.byte	.LVU491
+	.long	.LLRL112
+	.byte	0x1
+	.value	0x14b
+	.byte	0xd
+	.long	0xd89
+	.uleb128 0x1
+	.long	0x1b55
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x1
+	.long	0x1b4a
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0xc
+	.long	0x1b61
+	.quad	.LBI280
+	.byte	.LVU493
+	.long	.LLRL115
+	.byte	0x3
+	.value	0x24b
+	.byte	0x9
+	.long	0xd79
+	.uleb128 0x1
+	.long	0x1b71
+	.long	.LLST116
+	.long	.LVUS116
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL137
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.quad	.LVL134
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x6
+	.byte	0x7c
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.quad	.LBB299
+	.quad	.LBE299-.LBB299
+	.long	0xdcc
+	.uleb128 0x16
+	.string	"w"
+	.value	0x159
+	.byte	0x13
+	.long	0x986
+	.long	.LLST125
+	.long	.LVUS125
+	.byte	0
+	.uleb128 0x20
+	.long	0x1c2c
+	.quad	.LBI289
+	.byte	.LVU464
+	.quad	.LBB289
+	.quad	.LBE289-.LBB289
+	.value	0x141
+	.byte	0xa
+	.long	0xdff
+	.uleb128 0x1
+	.long	0x1c3c
+	.long	.LLST118
+	.long	.LVUS118
+	.byte	0
+	.uleb128 0x20
+	.long	0x1bf8
+	.quad	.LBI291
+	.byte	.LVU469
+	.quad	.LBB291
+	.quad	.LBE291-.LBB291
+	.value	0x142
+	.byte	0x9
+	.long	0xe62
+	.uleb128 0x1
+	.long	0x1c11
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x1
+	.long	0x1c06
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0x34
+	.long	0x1c1c
+	.quad	.LBB293
+	.quad	.LBE293-.LBB293
+	.uleb128 0x9
+	.long	0x1c1d
+	.long	.LLST121
+	.long	.LVUS121
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1b3a
+	.quad	.LBI295
+	.byte	.LVU518
+	.long	.LLRL122
+	.byte	0x1
+	.value	0x158
+	.byte	0x9
+	.long	0xeac
+	.uleb128 0x1
+	.long	0x1b55
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1
+	.long	0x1b4a
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x36
+	.quad	.LVL150
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.quad	.LVL148
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0xed2
+	.uleb128 0x3
+	.long	0x405
+	.uleb128 0x3
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	0xec2
+	.uleb128 0x2c
+	.long	.LASF1172
+	.byte	0xf6
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB549
+	.quad	.LFE549-.LFB549
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13e6
+	.uleb128 0xe
+	.string	"dst"
+	.byte	0xf7
+	.byte	0xb
+	.long	0xb4
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xe
+	.string	"enc"
+	.byte	0xf8
+	.byte	0x13
+	.long	0x61
+	.long	.LLST15
+	.long	.LVUS15
+	.uleb128 0xe
+	.string	"src"
+	.byte	0xf9
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST16
+	.long	.LVUS16
+	.uleb128 0xe
+	.string	"n"
+	.byte	0xfa
+	.byte	0xc
+	.long	0x39
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x13
+	.string	"p"
+	.byte	0xfc
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x13
+	.string	"e"
+	.byte	0xfd
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x25
+	.long	.LLRL28
+	.long	0x1134
+	.uleb128 0x16
+	.string	"w"
+	.value	0x103
+	.byte	0xf
+	.long	0xb6
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x25
+	.long	.LLRL30
+	.long	0x10bb
+	.uleb128 0x16
+	.string	"v"
+	.value	0x108
+	.byte	0x19
+	.long	0x6fa
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x15
+	.string	"a"
+	.byte	0x1
+	.value	0x109
+	.byte	0x19
+	.long	0x6fa
+	.uleb128 0xc
+	.long	0x197c
+	.quad	.LBI146
+	.byte	.LVU124
+	.long	.LLRL32
+	.byte	0x1
+	.value	0x109
+	.byte	0x1d
+	.long	0xfd2
+	.uleb128 0xd
+	.long	0x1998
+	.uleb128 0x1
+	.long	0x198b
+	.long	.LLST33
+	.long	.LVUS33
+	.byte	0
+	.uleb128 0xc
+	.long	0x1952
+	.quad	.LBI150
+	.byte	.LVU128
+	.long	.LLRL34
+	.byte	0x1
+	.value	0x10a
+	.byte	0x15
+	.long	0xff7
+	.uleb128 0xd
+	.long	0x196e
+	.uleb128 0xd
+	.long	0x1961
+	.byte	0
+	.uleb128 0x20
+	.long	0x1a83
+	.quad	.LBI154
+	.byte	.LVU119
+	.quad	.LBB154
+	.quad	.LBE154-.LBB154
+	.value	0x108
+	.byte	0x1d
+	.long	0x102a
+	.uleb128 0x1
+	.long	0x1a92
+	.long	.LLST35
+	.long	.LVUS35
+	.byte	0
+	.uleb128 0xc
+	.long	0x1935
+	.quad	.LBI158
+	.byte	.LVU131
+	.long	.LLRL36
+	.byte	0x1
+	.value	0x10a
+	.byte	0x15
+	.long	0x104a
+	.uleb128 0xd
+	.long	0x1944
+	.byte	0
+	.uleb128 0x20
+	.long	0x19fa
+	.quad	.LBI164
+	.byte	.LVU139
+	.quad	.LBB164
+	.quad	.LBE164-.LBB164
+	.value	0x10b
+	.byte	0x15
+	.long	0x108a
+	.uleb128 0x1
+	.long	0x1a16
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1
+	.long	0x1a09
+	.long	.LLST37
+	.long	.LVUS37
+	.byte	0
+	.uleb128 0x2d
+	.long	0x1a32
+	.quad	.LBI166
+	.byte	.LVU143
+	.long	.LLRL39
+	.value	0x10b
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x1a4a
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x1
+	.long	0x1a3d
+	.long	.LLST41
+	.long	.LVUS41
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x1b9e
+	.quad	.LBI172
+	.byte	.LVU154
+	.long	.LLRL42
+	.byte	0x1
+	.value	0x112
+	.byte	0x11
+	.long	0x1103
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0x17
+	.long	.LLRL42
+	.uleb128 0x9
+	.long	0x1bba
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x9
+	.long	0x1bc5
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x1bd1
+	.quad	.LBI176
+	.byte	.LVU166
+	.long	.LLRL46
+	.value	0x112
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x1bec
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x1
+	.long	0x1be1
+	.long	.LLST48
+	.long	.LVUS48
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LLRL49
+	.long	0x132e
+	.uleb128 0x16
+	.string	"w"
+	.value	0x118
+	.byte	0x13
+	.long	0x13e6
+	.long	.LLST50
+	.long	.LVUS50
+	.uleb128 0x25
+	.long	.LLRL51
+	.long	0x12ea
+	.uleb128 0x16
+	.string	"v"
+	.value	0x11d
+	.byte	0x19
+	.long	0x6fa
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x15
+	.string	"a"
+	.byte	0x1
+	.value	0x11e
+	.byte	0x19
+	.long	0x6fa
+	.uleb128 0x35
+	.quad	.LBB205
+	.quad	.LBE205-.LBB205
+	.long	0x1249
+	.uleb128 0x15
+	.string	"z"
+	.byte	0x1
+	.value	0x120
+	.byte	0x1d
+	.long	0x6fa
+	.uleb128 0xc
+	.long	0x19a6
+	.quad	.LBI206
+	.byte	.LVU261
+	.long	.LLRL58
+	.byte	0x1
+	.value	0x121
+	.byte	0x15
+	.long	0x11c2
+	.uleb128 0xd
+	.long	0x19c2
+	.uleb128 0x1
+	.long	0x19b5
+	.long	.LLST59
+	.long	.LVUS59
+	.byte	0
+	.uleb128 0xc
+	.long	0x1a5d
+	.quad	.LBI210
+	.byte	.LVU268
+	.long	.LLRL60
+	.byte	0x1
+	.value	0x121
+	.byte	0x15
+	.long	0x11ef
+	.uleb128 0x1
+	.long	0x1a75
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0xd
+	.long	0x1a68
+	.byte	0
+	.uleb128 0xc
+	.long	0x19d0
+	.quad	.LBI213
+	.byte	.LVU275
+	.long	.LLRL62
+	.byte	0x1
+	.value	0x122
+	.byte	0x15
+	.long	0x1214
+	.uleb128 0xd
+	.long	0x19ec
+	.uleb128 0xd
+	.long	0x19df
+	.byte	0
+	.uleb128 0x3d
+	.long	0x1a5d
+	.quad	.LBI218
+	.byte	.LVU278
+	.quad	.LBB218
+	.quad	.LBE218-.LBB218
+	.value	0x122
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x1a75
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0xd
+	.long	0x1a68
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x197c
+	.quad	.LBI187
+	.byte	.LVU245
+	.long	.LLRL53
+	.byte	0x1
+	.value	0x11e
+	.byte	0x1d
+	.long	0x1276
+	.uleb128 0xd
+	.long	0x1998
+	.uleb128 0x1
+	.long	0x198b
+	.long	.LLST54
+	.long	.LVUS54
+	.byte	0
+	.uleb128 0xc
+	.long	0x1952
+	.quad	.LBI191
+	.byte	.LVU249
+	.long	.LLRL55
+	.byte	0x1
+	.value	0x11f
+	.byte	0x15
+	.long	0x129b
+	.uleb128 0xd
+	.long	0x196e
+	.uleb128 0xd
+	.long	0x1961
+	.byte	0
+	.uleb128 0x20
+	.long	0x1a83
+	.quad	.LBI195
+	.byte	.LVU240
+	.quad	.LBB195
+	.quad	.LBE195-.LBB195
+	.value	0x11d
+	.byte	0x1d
+	.long	0x12ce
+	.uleb128 0x1
+	.long	0x1a92
+	.long	.LLST56
+	.long	.LVUS56
+	.byte	0
+	.uleb128 0x2d
+	.long	0x1935
+	.quad	.LBI199
+	.byte	.LVU252
+	.long	.LLRL57
+	.value	0x11f
+	.byte	0x15
+	.uleb128 0xd
+	.long	0x1944
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	0x1b9e
+	.quad	.LBI221
+	.byte	.LVU289
+	.long	.LLRL64
+	.value	0x129
+	.byte	0x14
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST65
+	.long	.LVUS65
+	.uleb128 0x17
+	.long	.LLRL64
+	.uleb128 0x9
+	.long	0x1bba
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x9
+	.long	0x1bc5
+	.long	.LLST67
+	.long	.LVUS67
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.long	0x13eb
+	.quad	.LBI138
+	.byte	.LVU69
+	.quad	.LBB138
+	.quad	.LBE138-.LBB138
+	.byte	0x1
+	.byte	0xff
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x140e
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0x1
+	.long	0x1405
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0x1
+	.long	0x13fa
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x9
+	.long	0x1417
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x4f
+	.long	0x1420
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.long	0x13c1
+	.uleb128 0x9
+	.long	0x1425
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x50
+	.long	0x142e
+	.long	.LLRL25
+	.uleb128 0x9
+	.long	0x142f
+	.long	.LLST26
+	.long	.LVUS26
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	0x143a
+	.quad	.LBB143
+	.quad	.LBE143-.LBB143
+	.uleb128 0x9
+	.long	0x143b
+	.long	.LLST27
+	.long	.LVUS27
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0xe8
+	.uleb128 0x3e
+	.long	.LASF1179
+	.byte	0xdd
+	.byte	0xf
+	.long	0x39
+	.long	0x1446
+	.uleb128 0x21
+	.string	"enc"
+	.byte	0xde
+	.byte	0x13
+	.long	0x61
+	.uleb128 0x21
+	.string	"p"
+	.byte	0xdf
+	.byte	0x15
+	.long	0x4fc
+	.uleb128 0x21
+	.string	"n"
+	.byte	0xe0
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x18
+	.string	"k"
+	.byte	0xe2
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x3f
+	.long	0x143a
+	.uleb128 0x18
+	.string	"i"
+	.byte	0xe6
+	.byte	0x15
+	.long	0x39
+	.uleb128 0x2b
+	.uleb128 0x18
+	.string	"c"
+	.byte	0xe7
+	.byte	0x16
+	.long	0x6f
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x18
+	.string	"i"
+	.byte	0xee
+	.byte	0x15
+	.long	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1173
+	.byte	0xcd
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB547
+	.quad	.LFE547-.LFB547
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1517
+	.uleb128 0x37
+	.long	.LASF1161
+	.byte	0xce
+	.byte	0x1b
+	.long	0x1517
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0xe
+	.string	"end"
+	.byte	0xcf
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0xe
+	.string	"max"
+	.byte	0xd0
+	.byte	0xc
+	.long	0x39
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0xe
+	.string	"cps"
+	.byte	0xd1
+	.byte	0xd
+	.long	0x236
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x51
+	.long	.LASF1162
+	.byte	0x1
+	.byte	0xd3
+	.byte	0x1f
+	.long	0x151c
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x3f
+	.long	0x1509
+	.uleb128 0x40
+	.long	.LASF1163
+	.byte	0xd3
+	.byte	0x44
+	.long	0x1517
+	.uleb128 0x7
+	.long	.LASF1164
+	.byte	0x1
+	.byte	0xd3
+	.byte	0x73
+	.long	0x2be
+	.uleb128 0x18
+	.string	"r_"
+	.byte	0xd3
+	.byte	0x81
+	.long	0x14ed
+	.uleb128 0x2
+	.long	0x14d7
+	.uleb128 0x18
+	.string	"r2_"
+	.byte	0xd3
+	.byte	0x34
+	.long	0x14ed
+	.uleb128 0x40
+	.long	.LASF1165
+	.byte	0xd3
+	.byte	0xa0
+	.long	0x1517
+	.byte	0
+	.uleb128 0x52
+	.quad	.LVL17
+	.long	0x1521
+	.byte	0
+	.uleb128 0x2
+	.long	0x287
+	.uleb128 0x2
+	.long	0x2be
+	.uleb128 0x2c
+	.long	.LASF1174
+	.byte	0xa7
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB546
+	.quad	.LFE546-.LFB546
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15f7
+	.uleb128 0x37
+	.long	.LASF1162
+	.byte	0xa8
+	.byte	0x1b
+	.long	0x1517
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0xe
+	.string	"end"
+	.byte	0xa9
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0xe
+	.string	"max"
+	.byte	0xaa
+	.byte	0xc
+	.long	0x39
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0xe
+	.string	"cps"
+	.byte	0xab
+	.byte	0xd
+	.long	0x236
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x13
+	.string	"p"
+	.byte	0xad
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x13
+	.string	"n"
+	.byte	0xae
+	.byte	0xc
+	.long	0x39
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xb3
+	.byte	0xc
+	.long	0x39
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x13
+	.string	"k"
+	.byte	0xb4
+	.byte	0xc
+	.long	0x39
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x53
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.uleb128 0x13
+	.string	"c0"
+	.byte	0xb6
+	.byte	0x12
+	.long	0x6f
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1175
+	.byte	0x7b
+	.byte	0x11
+	.long	0x6f
+	.quad	.LFB545
+	.quad	.LFE545-.LFB545
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x185f
+	.uleb128 0x37
+	.long	.LASF1162
+	.byte	0x7c
+	.byte	0x15
+	.long	0x77f
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0xe
+	.string	"end"
+	.byte	0x7d
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST75
+	.long	.LVUS75
+	.uleb128 0x2a
+	.long	.LASF1176
+	.long	0x94f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.uleb128 0x13
+	.string	"c0"
+	.byte	0x81
+	.byte	0xe
+	.long	0x6f
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x54
+	.long	.LASF1178
+	.byte	0x1
+	.byte	0xa2
+	.byte	0x1
+	.quad	.L71
+	.uleb128 0x13
+	.string	"cx"
+	.byte	0x90
+	.byte	0xe
+	.long	0x6f
+	.long	.LLST77
+	.long	.LVUS77
+	.uleb128 0x38
+	.long	0x1888
+	.quad	.LBI248
+	.byte	.LVU348
+	.long	.LLRL78
+	.byte	0x82
+	.byte	0xb
+	.long	0x16e5
+	.uleb128 0x1
+	.long	0x18b6
+	.long	.LLST79
+	.long	.LVUS79
+	.uleb128 0x1
+	.long	0x18ad
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x1
+	.long	0x18a2
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x1
+	.long	0x1897
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x17
+	.long	.LLRL78
+	.uleb128 0x9
+	.long	0x18bf
+	.long	.LLST83
+	.long	.LVUS83
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	0x1888
+	.quad	.LBI254
+	.byte	.LVU383
+	.long	.LLRL84
+	.byte	0x91
+	.byte	0xa
+	.long	0x1745
+	.uleb128 0x1
+	.long	0x18b6
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x1
+	.long	0x18ad
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1
+	.long	0x18a2
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x1
+	.long	0x1897
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x17
+	.long	.LLRL84
+	.uleb128 0x9
+	.long	0x18bf
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	0x185f
+	.quad	.LBI258
+	.byte	.LVU370
+	.quad	.LBB258
+	.quad	.LBE258-.LBB258
+	.byte	0x88
+	.byte	0x9
+	.long	0x1791
+	.uleb128 0x1
+	.long	0x1875
+	.long	.LLST90
+	.long	.LVUS90
+	.uleb128 0x1
+	.long	0x186c
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x9
+	.long	0x187e
+	.long	.LLST92
+	.long	.LVUS92
+	.byte	0
+	.uleb128 0x38
+	.long	0x185f
+	.quad	.LBI262
+	.byte	.LVU401
+	.long	.LLRL93
+	.byte	0x9d
+	.byte	0x5
+	.long	0x17d7
+	.uleb128 0x1
+	.long	0x1875
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x1
+	.long	0x186c
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x17
+	.long	.LLRL93
+	.uleb128 0x9
+	.long	0x187e
+	.long	.LLST96
+	.long	.LVUS96
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.long	0x185f
+	.quad	.LBI268
+	.byte	.LVU418
+	.quad	.LBB268
+	.quad	.LBE268-.LBB268
+	.byte	0xa3
+	.byte	0x5
+	.long	0x1823
+	.uleb128 0x1
+	.long	0x1875
+	.long	.LLST97
+	.long	.LVUS97
+	.uleb128 0x1
+	.long	0x186c
+	.long	.LLST98
+	.long	.LVUS98
+	.uleb128 0x9
+	.long	0x187e
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL97
+	.long	0x7a0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7f
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.long	.LASF1209
+	.byte	0x1
+	.byte	0x6f
+	.byte	0xd
+	.byte	0x1
+	.long	0x1888
+	.uleb128 0x21
+	.string	"i"
+	.byte	0x70
+	.byte	0x15
+	.long	0x77f
+	.uleb128 0x21
+	.string	"n"
+	.byte	0x71
+	.byte	0xe
+	.long	0x6f
+	.uleb128 0x18
+	.string	"s"
+	.byte	0x73
+	.byte	0x15
+	.long	0x4fc
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF1180
+	.byte	0x5b
+	.byte	0xc
+	.long	0x438
+	.long	0x18c9
+	.uleb128 0x2e
+	.long	.LASF1181
+	.byte	0x5c
+	.byte	0xf
+	.long	0x18c9
+	.uleb128 0x2e
+	.long	.LASF1162
+	.byte	0x5d
+	.byte	0x15
+	.long	0x77f
+	.uleb128 0x21
+	.string	"e"
+	.byte	0x5e
+	.byte	0x11
+	.long	0x1df
+	.uleb128 0x21
+	.string	"n"
+	.byte	0x5f
+	.byte	0xe
+	.long	0x6f
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x61
+	.byte	0x15
+	.long	0x4fc
+	.byte	0
+	.uleb128 0x2
+	.long	0x6f
+	.uleb128 0x42
+	.long	.LASF1183
+	.byte	0x51
+	.long	0x18f7
+	.uleb128 0x2e
+	.long	.LASF1162
+	.byte	0x52
+	.byte	0x15
+	.long	0x77f
+	.uleb128 0x2a
+	.long	.LASF1176
+	.long	0x1907
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.2
+	.byte	0
+	.uleb128 0x19
+	.long	0xc2
+	.long	0x1907
+	.uleb128 0x1a
+	.long	0x45
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x8
+	.long	0x18f7
+	.uleb128 0x42
+	.long	.LASF1184
+	.byte	0x4a
+	.long	0x1935
+	.uleb128 0x2e
+	.long	.LASF1162
+	.byte	0x4b
+	.byte	0x15
+	.long	0x77f
+	.uleb128 0x2a
+	.long	.LASF1176
+	.long	0x1907
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1185
+	.value	0x597
+	.long	0x4c
+	.long	0x1952
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x597
+	.byte	0x1c
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1186
+	.value	0x53b
+	.long	0x6fa
+	.long	0x197c
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x53b
+	.byte	0x1a
+	.long	0x6fa
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x53b
+	.byte	0x27
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1187
+	.value	0x51d
+	.long	0x6fa
+	.long	0x19a6
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x51d
+	.byte	0x18
+	.long	0x6fa
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x51d
+	.byte	0x25
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1188
+	.value	0x40a
+	.long	0x6fa
+	.long	0x19d0
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x40a
+	.byte	0x1d
+	.long	0x6fa
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x40a
+	.byte	0x2a
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1189
+	.value	0x3f2
+	.long	0x6fa
+	.long	0x19fa
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x3f2
+	.byte	0x1d
+	.long	0x6fa
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x3f2
+	.byte	0x2a
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1190
+	.value	0x3e6
+	.long	0x6fa
+	.long	0x1a24
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x3e6
+	.byte	0x1b
+	.long	0x6fa
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x3e6
+	.byte	0x28
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x56
+	.long	.LASF1214
+	.byte	0x2
+	.value	0x31a
+	.byte	0x1
+	.long	0x6fa
+	.byte	0x3
+	.uleb128 0x43
+	.long	.LASF1191
+	.value	0x2e7
+	.long	0x1a58
+	.uleb128 0x5
+	.string	"__P"
+	.byte	0x2
+	.value	0x2e7
+	.byte	0x1e
+	.long	0x1a58
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x2e7
+	.byte	0x2b
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x2
+	.long	0x712
+	.uleb128 0x43
+	.long	.LASF1192
+	.value	0x2e1
+	.long	0x1a83
+	.uleb128 0x5
+	.string	"__P"
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x1e
+	.long	0x1a58
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x2b
+	.long	0x6fa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1193
+	.value	0x2bd
+	.long	0x6fa
+	.long	0x1aa0
+	.uleb128 0x5
+	.string	"__P"
+	.byte	0x2
+	.value	0x2bd
+	.byte	0x23
+	.long	0x1aa0
+	.byte	0
+	.uleb128 0x2
+	.long	0x71e
+	.uleb128 0x14
+	.long	.LASF1194
+	.value	0x288
+	.long	0x6fa
+	.long	0x1ac2
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x288
+	.byte	0x17
+	.long	0x7d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1195
+	.value	0x260
+	.long	0x6fa
+	.long	0x1b3a
+	.uleb128 0x12
+	.long	.LASF1196
+	.byte	0x2
+	.value	0x260
+	.byte	0x16
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1197
+	.byte	0x2
+	.value	0x260
+	.byte	0x22
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1198
+	.byte	0x2
+	.value	0x260
+	.byte	0x2e
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1199
+	.byte	0x2
+	.value	0x260
+	.byte	0x3a
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1200
+	.byte	0x2
+	.value	0x261
+	.byte	0xf
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1201
+	.byte	0x2
+	.value	0x261
+	.byte	0x1b
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1202
+	.byte	0x2
+	.value	0x261
+	.byte	0x27
+	.long	0x7d
+	.uleb128 0x12
+	.long	.LASF1203
+	.byte	0x2
+	.value	0x261
+	.byte	0x33
+	.long	0x7d
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1204
+	.value	0x249
+	.byte	0x13
+	.long	0x438
+	.long	0x1b61
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x3
+	.value	0x249
+	.byte	0x32
+	.long	0x405
+	.uleb128 0x5
+	.string	"n"
+	.byte	0x3
+	.value	0x249
+	.byte	0x3c
+	.long	0x39
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1205
+	.value	0x23e
+	.byte	0x16
+	.long	0x39
+	.long	0x1b7d
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x3
+	.value	0x23e
+	.byte	0x38
+	.long	0x1b7d
+	.byte	0
+	.uleb128 0x2
+	.long	0x2d0
+	.uleb128 0x23
+	.long	.LASF1206
+	.value	0x223
+	.byte	0x16
+	.long	0x39
+	.long	0x1b9e
+	.uleb128 0x5
+	.string	"c"
+	.byte	0x3
+	.value	0x223
+	.byte	0x2e
+	.long	0x6f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1207
+	.value	0x20a
+	.byte	0x18
+	.long	0x6f
+	.long	0x1bd1
+	.uleb128 0x5
+	.string	"pp"
+	.byte	0x3
+	.value	0x20a
+	.byte	0x37
+	.long	0x9ee
+	.uleb128 0x15
+	.string	"p"
+	.byte	0x3
+	.value	0x20c
+	.byte	0x15
+	.long	0x4fc
+	.uleb128 0x15
+	.string	"c"
+	.byte	0x3
+	.value	0x20d
+	.byte	0xe
+	.long	0x6f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1208
+	.value	0x1c3
+	.byte	0x15
+	.long	0xb6
+	.long	0x1bf8
+	.uleb128 0x5
+	.string	"w"
+	.byte	0x3
+	.value	0x1c3
+	.byte	0x29
+	.long	0xb6
+	.uleb128 0x5
+	.string	"c"
+	.byte	0x3
+	.value	0x1c3
+	.byte	0x35
+	.long	0x6f
+	.byte	0
+	.uleb128 0x57
+	.long	.LASF1210
+	.byte	0x3
+	.value	0x1a9
+	.byte	0x14
+	.byte	0x3
+	.long	0x1c2c
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x3
+	.value	0x1a9
+	.byte	0x35
+	.long	0x405
+	.uleb128 0x5
+	.string	"e"
+	.byte	0x3
+	.value	0x1a9
+	.byte	0x41
+	.long	0x6f
+	.uleb128 0x2b
+	.uleb128 0x15
+	.string	"_xp"
+	.byte	0x3
+	.value	0x1ac
+	.byte	0x2d
+	.long	0x18c9
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1211
+	.value	0x1a3
+	.byte	0x13
+	.long	0x438
+	.long	0x1c48
+	.uleb128 0x5
+	.string	"c"
+	.byte	0x3
+	.value	0x1a3
+	.byte	0x27
+	.long	0x6f
+	.byte	0
+	.uleb128 0x39
+	.long	0x190c
+	.quad	.LFB541
+	.quad	.LFE541-.LFB541
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cd3
+	.uleb128 0x1
+	.long	0x1916
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x44
+	.long	0x190c
+	.quad	.LBI228
+	.byte	.LVU318
+	.long	.LLRL69
+	.byte	0x4a
+	.uleb128 0x1
+	.long	0x1916
+	.long	.LLST70
+	.long	.LVUS70
+	.uleb128 0x17
+	.long	.LLRL69
+	.uleb128 0x1f
+	.quad	.LVL89
+	.long	0x7a0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC4
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4d
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x18ce
+	.quad	.LFB542
+	.quad	.LFE542-.LFB542
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d5e
+	.uleb128 0x1
+	.long	0x18d8
+	.long	.LLST71
+	.long	.LVUS71
+	.uleb128 0x44
+	.long	0x18ce
+	.quad	.LBI234
+	.byte	.LVU329
+	.long	.LLRL72
+	.byte	0x51
+	.uleb128 0x1
+	.long	0x18d8
+	.long	.LLST73
+	.long	.LVUS73
+	.uleb128 0x17
+	.long	.LLRL72
+	.uleb128 0x1f
+	.quad	.LVL93
+	.long	0x7a0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC5
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x54
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	0x8b6
+	.quad	.LFB558
+	.quad	.LFE558-.LFB558
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e32
+	.uleb128 0x1
+	.long	0x8c6
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x1
+	.long	0x8d3
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x9
+	.long	0x8f3
+	.long	.LLST102
+	.long	.LVUS102
+	.uleb128 0xc
+	.long	0x8b6
+	.quad	.LBI273
+	.byte	.LVU433
+	.long	.LLRL103
+	.byte	0x1
+	.value	0x1a3
+	.byte	0x11
+	.long	0x1e1c
+	.uleb128 0x1
+	.long	0x8c6
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x1
+	.long	0x8d3
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x17
+	.long	.LLRL103
+	.uleb128 0x58
+	.long	0x8f3
+	.uleb128 0x1f
+	.quad	.LVL121
+	.long	0x7a0
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x1a7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.quad	.LVL122
+	.long	0x15f7
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.long	0xa56
+	.quad	.LFB554
+	.quad	.LFE554-.LFB554
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0xa66
+	.long	.LLST135
+	.long	.LVUS135
+	.uleb128 0x1
+	.long	0xa71
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x24
+	.quad	.LVL172
+	.long	0xa7d
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 34
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 424
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS143:
+	.uleb128 0
+	.uleb128 .LVU635
+	.uleb128 .LVU635
+	.uleb128 0
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 0
+	.uleb128 .LVU635
+	.uleb128 .LVU635
+	.uleb128 0
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL181-1-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS141:
+	.uleb128 0
+	.uleb128 .LVU629
+	.uleb128 .LVU629
+	.uleb128 0
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL179-1-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS142:
+	.uleb128 0
+	.uleb128 .LVU624
+	.uleb128 .LVU624
+	.uleb128 0
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS139:
+	.uleb128 0
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 0
+.LLST139:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 0
+	.uleb128 .LVU614
+	.uleb128 .LVU614
+	.uleb128 0
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL176-1-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 0
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 0
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS138:
+	.uleb128 0
+	.uleb128 .LVU608
+	.uleb128 .LVU608
+	.uleb128 0
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL174-1-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS133:
+	.uleb128 0
+	.uleb128 .LVU593
+	.uleb128 .LVU593
+	.uleb128 .LVU597
+	.uleb128 .LVU597
+	.uleb128 0
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL168-1-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS134:
+	.uleb128 0
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU598
+	.uleb128 .LVU598
+	.uleb128 0
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 0
+	.uleb128 .LVU582
+	.uleb128 .LVU582
+	.uleb128 0
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LFE552-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS132:
+	.uleb128 0
+	.uleb128 .LVU580
+	.uleb128 .LVU580
+	.uleb128 .LVU582
+	.uleb128 .LVU582
+	.uleb128 0
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL165-1-.Ltext0
+	.uleb128 .LFE552-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 .LVU552
+	.uleb128 .LVU554
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS127:
+	.uleb128 .LVU557
+	.uleb128 .LVU566
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU557
+	.uleb128 .LVU566
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS129:
+	.uleb128 .LVU563
+	.uleb128 .LVU566
+.LLST129:
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU569
+	.uleb128 .LVU572
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS106:
+	.uleb128 0
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU524
+	.uleb128 .LVU524
+	.uleb128 .LVU531
+	.uleb128 .LVU531
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU546
+	.uleb128 .LVU546
+	.uleb128 0
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 0
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU486
+	.uleb128 .LVU486
+	.uleb128 .LVU487
+	.uleb128 .LVU487
+	.uleb128 .LVU500
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU503
+	.uleb128 .LVU504
+	.uleb128 .LVU504
+	.uleb128 .LVU515
+	.uleb128 .LVU515
+	.uleb128 .LVU517
+	.uleb128 .LVU517
+	.uleb128 .LVU526
+	.uleb128 .LVU533
+	.uleb128 .LVU543
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -65536
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x5
+	.byte	0x74
+	.sleb128 -65536
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x8
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU532
+	.uleb128 .LVU532
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU533
+	.uleb128 .LVU547
+	.uleb128 .LVU547
+	.uleb128 0
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL148-1-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU489
+	.uleb128 .LVU515
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU490
+	.uleb128 .LVU515
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS117:
+	.uleb128 .LVU509
+	.uleb128 .LVU510
+	.uleb128 .LVU510
+	.uleb128 .LVU512
+	.uleb128 .LVU512
+	.uleb128 .LVU513
+	.uleb128 .LVU513
+	.uleb128 .LVU515
+.LLST117:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS113:
+	.uleb128 .LVU491
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU506
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 .LVU491
+	.uleb128 .LVU500
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+	.uleb128 .LVU505
+	.uleb128 .LVU506
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL137-1-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS116:
+	.uleb128 .LVU493
+	.uleb128 .LVU495
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS125:
+	.uleb128 .LVU539
+	.uleb128 .LVU540
+	.uleb128 .LVU540
+	.uleb128 .LVU543
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU464
+	.uleb128 .LVU466
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS119:
+	.uleb128 .LVU469
+	.uleb128 .LVU478
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS120:
+	.uleb128 .LVU469
+	.uleb128 .LVU478
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU475
+	.uleb128 .LVU478
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU518
+	.uleb128 .LVU524
+	.uleb128 .LVU533
+	.uleb128 .LVU536
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU518
+	.uleb128 .LVU524
+	.uleb128 .LVU533
+	.uleb128 .LVU534
+	.uleb128 .LVU534
+	.uleb128 .LVU536
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS14:
+	.uleb128 0
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 0
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS15:
+	.uleb128 0
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU107
+	.uleb128 .LVU107
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS16:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU113
+	.uleb128 .LVU113
+	.uleb128 .LVU231
+	.uleb128 .LVU231
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU63
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU150
+	.uleb128 .LVU150
+	.uleb128 .LVU175
+	.uleb128 .LVU175
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU186
+	.uleb128 .LVU207
+	.uleb128 .LVU265
+	.uleb128 .LVU265
+	.uleb128 .LVU283
+	.uleb128 .LVU283
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU313
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU66
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU94
+	.uleb128 .LVU94
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU113
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU231
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU122
+	.uleb128 .LVU142
+	.uleb128 .LVU142
+	.uleb128 .LVU146
+	.uleb128 .LVU146
+	.uleb128 .LVU148
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -16
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU124
+	.uleb128 .LVU126
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU119
+	.uleb128 .LVU122
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU139
+	.uleb128 .LVU142
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU142
+	.uleb128 .LVU148
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU142
+	.uleb128 .LVU147
+	.uleb128 .LVU147
+	.uleb128 .LVU148
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU154
+	.uleb128 .LVU165
+	.uleb128 .LVU173
+	.uleb128 .LVU186
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3906
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3906
+	.sleb128 0
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU156
+	.uleb128 .LVU164
+	.uleb128 .LVU164
+	.uleb128 .LVU165
+	.uleb128 .LVU173
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU186
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU160
+	.uleb128 .LVU165
+	.uleb128 .LVU173
+	.uleb128 .LVU178
+	.uleb128 .LVU178
+	.uleb128 .LVU186
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x5
+	.byte	0x79
+	.sleb128 55296
+	.byte	0x9f
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU165
+	.uleb128 .LVU173
+	.uleb128 .LVU186
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU202
+	.uleb128 .LVU207
+	.uleb128 .LVU222
+	.uleb128 .LVU222
+	.uleb128 .LVU224
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 -2
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU165
+	.uleb128 .LVU170
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+	.uleb128 .LVU172
+	.uleb128 .LVU173
+	.uleb128 .LVU207
+	.uleb128 .LVU214
+	.uleb128 .LVU214
+	.uleb128 .LVU217
+	.uleb128 .LVU217
+	.uleb128 .LVU219
+	.uleb128 .LVU220
+	.uleb128 .LVU221
+	.uleb128 .LVU221
+	.uleb128 .LVU225
+	.uleb128 .LVU225
+	.uleb128 .LVU229
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0
+.LVUS50:
+	.uleb128 .LVU235
+	.uleb128 .LVU266
+	.uleb128 .LVU266
+	.uleb128 .LVU284
+	.uleb128 .LVU284
+	.uleb128 .LVU289
+	.uleb128 .LVU289
+	.uleb128 .LVU311
+.LLST50:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS52:
+	.uleb128 .LVU243
+	.uleb128 .LVU271
+	.uleb128 .LVU271
+	.uleb128 .LVU273
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 -16
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU261
+	.uleb128 .LVU267
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU267
+	.uleb128 .LVU273
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x65
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU277
+	.uleb128 .LVU281
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU245
+	.uleb128 .LVU247
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS56:
+	.uleb128 .LVU240
+	.uleb128 .LVU243
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU289
+	.uleb128 .LVU308
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3906
+	.sleb128 0
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU291
+	.uleb128 .LVU297
+	.uleb128 .LVU297
+	.uleb128 .LVU299
+	.uleb128 .LVU299
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU308
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU292
+	.uleb128 .LVU303
+	.uleb128 .LVU303
+	.uleb128 .LVU304
+	.uleb128 .LVU304
+	.uleb128 .LVU308
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU69
+	.uleb128 .LVU107
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU69
+	.uleb128 .LVU107
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU69
+	.uleb128 .LVU72
+	.uleb128 .LVU72
+	.uleb128 .LVU73
+	.uleb128 .LVU73
+	.uleb128 .LVU74
+	.uleb128 .LVU74
+	.uleb128 .LVU107
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU71
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU106
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU75
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU92
+	.uleb128 .LVU92
+	.uleb128 .LVU94
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU78
+	.uleb128 .LVU85
+	.uleb128 .LVU85
+	.uleb128 .LVU87
+	.uleb128 .LVU87
+	.uleb128 .LVU93
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0xe
+	.byte	0x74
+	.sleb128 0
+	.byte	0x31
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0xe
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x31
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU94
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU102
+	.uleb128 .LVU102
+	.uleb128 .LVU107
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 0
+	.uleb128 .LVU58
+	.uleb128 .LVU58
+	.uleb128 .LVU60
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU55
+	.uleb128 .LVU60
+	.uleb128 .LVU60
+	.uleb128 0
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL17-1-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU9
+	.uleb128 .LVU9
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU13
+	.uleb128 .LVU13
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU10
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 0
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU11
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU27
+	.uleb128 .LVU27
+	.uleb128 .LVU38
+	.uleb128 .LVU38
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU18
+	.uleb128 .LVU30
+	.uleb128 .LVU30
+	.uleb128 .LVU40
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x5
+	.byte	0x7a
+	.sleb128 55296
+	.byte	0x9f
+	.byte	0
+.LVUS74:
+	.uleb128 0
+	.uleb128 .LVU345
+	.uleb128 .LVU345
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 0
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS75:
+	.uleb128 0
+	.uleb128 .LVU344
+	.uleb128 .LVU344
+	.uleb128 .LVU346
+	.uleb128 .LVU346
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU427
+	.uleb128 .LVU427
+	.uleb128 0
+.LLST75:
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU362
+	.uleb128 .LVU369
+	.uleb128 .LVU379
+	.uleb128 .LVU406
+	.uleb128 .LVU406
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU411
+	.uleb128 .LVU417
+	.uleb128 .LVU426
+	.uleb128 .LVU427
+	.uleb128 .LVU428
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 0
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0xa
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS77:
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU397
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU411
+	.uleb128 .LVU427
+	.uleb128 .LVU428
+.LLST77:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x7
+	.byte	0x72
+	.sleb128 0
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x9
+	.byte	0x71
+	.sleb128 2
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0xc
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x94
+	.byte	0x2
+	.byte	0xa
+	.value	0xffff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x3
+	.byte	0x9
+	.byte	0xff
+	.byte	0x9f
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU348
+	.uleb128 .LVU363
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU348
+	.uleb128 .LVU363
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS81:
+	.uleb128 .LVU348
+	.uleb128 .LVU363
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU348
+	.uleb128 .LVU363
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5713
+	.sleb128 0
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU350
+	.uleb128 .LVU363
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU383
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU398
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU383
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU395
+	.uleb128 .LVU395
+	.uleb128 .LVU398
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU383
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU398
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU383
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU398
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5747
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+5747
+	.sleb128 0
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU385
+	.uleb128 .LVU386
+	.uleb128 .LVU386
+	.uleb128 .LVU388
+	.uleb128 .LVU392
+	.uleb128 .LVU398
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS90:
+	.uleb128 .LVU370
+	.uleb128 .LVU376
+.LLST90:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU370
+	.uleb128 .LVU376
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU372
+	.uleb128 .LVU373
+	.uleb128 .LVU373
+	.uleb128 .LVU375
+	.uleb128 .LVU375
+	.uleb128 .LVU376
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU401
+	.uleb128 .LVU411
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU401
+	.uleb128 .LVU411
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU403
+	.uleb128 .LVU404
+	.uleb128 .LVU404
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU411
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x4
+	.byte	0x9f
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU418
+	.uleb128 .LVU423
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU418
+	.uleb128 .LVU423
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU420
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 .LVU423
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x23
+	.uleb128 0x2
+	.byte	0x9f
+	.byte	0
+.LVUS68:
+	.uleb128 0
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 0
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LFE541-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS70:
+	.uleb128 .LVU319
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU323
+.LLST70:
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS71:
+	.uleb128 0
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU334
+	.uleb128 .LVU334
+	.uleb128 0
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU330
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU334
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS100:
+	.uleb128 0
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LFE558-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS101:
+	.uleb128 0
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+	.uleb128 .LVU439
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LFE558-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU448
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 .LVU452
+	.uleb128 0
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL122-1-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LFE558-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS104:
+	.uleb128 .LVU434
+	.uleb128 .LVU438
+	.uleb128 .LVU438
+	.uleb128 .LVU439
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU434
+	.uleb128 .LVU437
+	.uleb128 .LVU437
+	.uleb128 .LVU439
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS135:
+	.uleb128 0
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 0
+.LLST135:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL172-1-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS136:
+	.uleb128 0
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 0
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL172-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL172-1-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL25:
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB142-.Ltext0
+	.uleb128 .LBE142-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB184-.Ltext0
+	.uleb128 .LBE184-.Ltext0
+	.byte	0
+.LLRL30:
+	.byte	0x4
+	.uleb128 .LBB145-.Ltext0
+	.uleb128 .LBE145-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB170-.Ltext0
+	.uleb128 .LBE170-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB171-.Ltext0
+	.uleb128 .LBE171-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB146-.Ltext0
+	.uleb128 .LBE146-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB156-.Ltext0
+	.uleb128 .LBE156-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB161-.Ltext0
+	.uleb128 .LBE161-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0
+.LLRL36:
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB163-.Ltext0
+	.uleb128 .LBE163-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB166-.Ltext0
+	.uleb128 .LBE166-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB169-.Ltext0
+	.uleb128 .LBE169-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB172-.Ltext0
+	.uleb128 .LBE172-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB183-.Ltext0
+	.uleb128 .LBE183-.Ltext0
+	.byte	0
+.LLRL49:
+	.byte	0x4
+	.uleb128 .LBB185-.Ltext0
+	.uleb128 .LBE185-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0
+.LLRL51:
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0
+.LLRL53:
+	.byte	0x4
+	.uleb128 .LBB187-.Ltext0
+	.uleb128 .LBE187-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB197-.Ltext0
+	.uleb128 .LBE197-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0
+.LLRL55:
+	.byte	0x4
+	.uleb128 .LBB191-.Ltext0
+	.uleb128 .LBE191-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB198-.Ltext0
+	.uleb128 .LBE198-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB203-.Ltext0
+	.uleb128 .LBE203-.Ltext0
+	.byte	0
+.LLRL57:
+	.byte	0x4
+	.uleb128 .LBB199-.Ltext0
+	.uleb128 .LBE199-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB204-.Ltext0
+	.uleb128 .LBE204-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0
+.LLRL60:
+	.byte	0x4
+	.uleb128 .LBB210-.Ltext0
+	.uleb128 .LBE210-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB213-.Ltext0
+	.uleb128 .LBE213-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB224-.Ltext0
+	.uleb128 .LBE224-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB228-.Ltext0
+	.uleb128 .LBE228-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB231-.Ltext0
+	.uleb128 .LBE231-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB234-.Ltext0
+	.uleb128 .LBE234-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB237-.Ltext0
+	.uleb128 .LBE237-.Ltext0
+	.byte	0
+.LLRL78:
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB252-.Ltext0
+	.uleb128 .LBE252-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0
+.LLRL84:
+	.byte	0x4
+	.uleb128 .LBB254-.Ltext0
+	.uleb128 .LBE254-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB260-.Ltext0
+	.uleb128 .LBE260-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB261-.Ltext0
+	.uleb128 .LBE261-.Ltext0
+	.byte	0
+.LLRL93:
+	.byte	0x4
+	.uleb128 .LBB262-.Ltext0
+	.uleb128 .LBE262-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB267-.Ltext0
+	.uleb128 .LBE267-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB273-.Ltext0
+	.uleb128 .LBE273-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB276-.Ltext0
+	.uleb128 .LBE276-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB277-.Ltext0
+	.uleb128 .LBE277-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB294-.Ltext0
+	.uleb128 .LBE294-.Ltext0
+	.byte	0
+.LLRL112:
+	.byte	0x4
+	.uleb128 .LBB278-.Ltext0
+	.uleb128 .LBE278-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB286-.Ltext0
+	.uleb128 .LBE286-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB287-.Ltext0
+	.uleb128 .LBE287-.Ltext0
+	.byte	0
+.LLRL115:
+	.byte	0x4
+	.uleb128 .LBB280-.Ltext0
+	.uleb128 .LBE280-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB283-.Ltext0
+	.uleb128 .LBE283-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB295-.Ltext0
+	.uleb128 .LBE295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB298-.Ltext0
+	.uleb128 .LBE298-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF442
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF497
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF570
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF602
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF603
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF604
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF497
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF672
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF673
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF674
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 27 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF734
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF737
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 28 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF740
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "./include/va_print/char_utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF760
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF761
+	.file 30 "./include/va_print/char_utf16.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF763
+	.file 31 "./include/va_print/char_utf32.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF764
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF785
+	.file 32 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF804
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF805
+	.byte	0x4
+	.byte	0x4
+	.file 36 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/xmmintrin.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF882
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF883
+	.byte	0x4
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mm_malloc.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.file 39 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF787
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF886
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF922
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF570
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF964
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF965
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF966
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF967
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF611
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF968
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF969
+	.file 50 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF970
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF987
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1000
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1005
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1008
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1026
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1027
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1028
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1040
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1047
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x4
+	.file 67 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1052
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x524
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1077
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.3e0425629195acf083c9561151306b4d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF441
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF493
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF496
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF507
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF508
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF569
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF587
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF595
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.40.d34159d34f444de373121677553af6a7,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF601
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF609
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF669
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF671
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF733
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF736
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF739
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF759
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.char.h.34.e464ebba96a45be0746f2e47582a65f7,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF784
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF787
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF802
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF803
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.27.cd1557bd11ee28e696cbad9e723079c4,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF880
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF803
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF907
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF914
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF921
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF943
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF949
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF963
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF976
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF978
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF982
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF986
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1004
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1007
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1025
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1039
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1043
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1051
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.xmmintrin.h.78.59bb12a08107158c4936dd3dc3443849,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x516
+	.long	.LASF1076
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF828:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF495:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF917:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1160:
+	.string	"va_span16_p_take_utf16"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1087:
+	.string	"size_t"
+.LASF914:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF816:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF930:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1069:
+	.string	"_MM_ROUND_NEAREST 0x0000"
+.LASF991:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF937:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF843:
+	.string	"VA_MODE_X7 7"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF753:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF1074:
+	.string	"_MM_FLUSH_ZERO_ON 0x8000"
+.LASF458:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF557:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF994:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF728:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF556:
+	.string	"__always_inline"
+.LASF571:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF965:
+	.string	"__clockid_t_defined 1"
+.LASF463:
+	.string	"__USE_ATFILE"
+.LASF532:
+	.string	"__flexarr []"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF660:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF818:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF737:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF755:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF503:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1003:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF862:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF1051:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF726:
+	.string	"VA_E_OK 0"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF761:
+	.string	"va_char_p_encode utf8"
+.LASF833:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1134:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF756:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF721:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF440:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF889:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1165:
+	.string	"val2_"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF1060:
+	.string	"_MM_EXCEPT_INEXACT 0x0020"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF607:
+	.string	"true 1"
+.LASF736:
+	.string	"va_char_p_decode utf8"
+.LASF709:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF720:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF1180:
+	.string	"iter_nth"
+.LASF898:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF612:
+	.string	"_BITS_TYPES_H 1"
+.LASF799:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF546:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF647:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1013:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF672:
+	.string	"__STD_TYPE"
+.LASF597:
+	.string	"_ASSERT_H_DECLS "
+.LASF1001:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF1006:
+	.string	"____sigset_t_defined "
+.LASF519:
+	.string	"__P(args) args"
+.LASF969:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF752:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1034:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF401:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF716:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF877:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF640:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF724:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF778:
+	.string	"va_zprintf(...) va_gzprintf(char, __VA_ARGS__)"
+.LASF813:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF436:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1096:
+	.string	"take"
+.LASF879:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF939:
+	.string	"__f64x(x) x ##f64x"
+.LASF1095:
+	.string	"type"
+.LASF871:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF916:
+	.string	"__HAVE_FLOAT128 1"
+.LASF394:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF924:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1193:
+	.string	"_mm_loadu_si128"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF873:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF984:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF624:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF825:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF507:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF760:
+	.string	"VA_PRINT_CHAR_UTF8_H_ "
+.LASF972:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF534:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF405:
+	.string	"_T_SIZE "
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1119:
+	.string	"finish"
+.LASF682:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF880:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF980:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1179:
+	.string	"transcode_len"
+.LASF398:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF461:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF680:
+	.string	"VA_NIX "
+.LASF1107:
+	.string	"super"
+.LASF448:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF772:
+	.string	"va_sprintf(S,...) va_snprintf(S,va_countof(S),__VA_ARGS__)"
+.LASF683:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF603:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF437:
+	.string	"NULL"
+.LASF529:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1212:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF654:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF734:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF846:
+	.string	"VA_STATE_ARG 1"
+.LASF1163:
+	.string	"val_"
+.LASF590:
+	.string	"__stub_fchflags "
+.LASF695:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF1181:
+	.string	"result"
+.LASF1023:
+	.string	"__blkcnt_t_defined "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF649:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF913:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF717:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF472:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF423:
+	.string	"_T_WCHAR "
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF457:
+	.string	"__USE_XOPEN2K8"
+.LASF1182:
+	.string	"va_xprintf_last_char16_pp_utf16"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1158:
+	.string	"va_xprintf_last_span16_p_utf16"
+.LASF403:
+	.string	"_SYS_SIZE_T_H "
+.LASF971:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF468:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1030:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1214:
+	.string	"_mm_setzero_si128"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF505:
+	.string	"__GLIBC__ 2"
+.LASF931:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1078:
+	.string	"long int"
+.LASF801:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF985:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1005:
+	.string	"__sigset_t_defined 1"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF797:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF473:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF491:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF775:
+	.string	"va_unprintf(...) va_gnprintf(char16_t, __VA_ARGS__)"
+.LASF393:
+	.string	"_PTRDIFF_T_ "
+.LASF469:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1139:
+	.string	"render_flush"
+.LASF773:
+	.string	"va_gnprintf(Char,N,...) ((Char*)(va_xprintf( &VA_STREAM_CHAR_P((Char[N]){0}, N), __VA_ARGS__)->data))"
+.LASF1146:
+	.string	"__v2di"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF725:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF669:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF866:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF974:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1147:
+	.string	"__v2du"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1083:
+	.string	"short unsigned int"
+.LASF863:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF553:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF395:
+	.string	"___int_ptrdiff_t_h "
+.LASF412:
+	.string	"_SIZE_T_DECLARED "
+.LASF521:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF901:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1129:
+	.string	"va_span16_t"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1178:
+	.string	"error"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF515:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF542:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF935:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF945:
+	.string	"__lldiv_t_defined 1"
+.LASF596:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1109:
+	.string	"va_stream_t"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF498:
+	.string	"__USE_MISC 1"
+.LASF651:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF948:
+	.string	"EXIT_SUCCESS 0"
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF502:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1040:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF512:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF782:
+	.string	"va_znprintf(...) va_gznprintf(char, __VA_ARGS__)"
+.LASF1085:
+	.string	"signed char"
+.LASF826:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF400:
+	.string	"__size_t__ "
+.LASF983:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF614:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF523:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF722:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF629:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF592:
+	.string	"__stub_revoke "
+.LASF1190:
+	.string	"_mm_packus_epi16"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1176:
+	.string	"__PRETTY_FUNCTION__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF645:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1175:
+	.string	"va_char16_p_take_utf16"
+.LASF1090:
+	.string	"__uint_least16_t"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF470:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF411:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF970:
+	.string	"_ENDIAN_H 1"
+.LASF759:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF414:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF479:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF520:
+	.string	"__PMT(args) args"
+.LASF687:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF599:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1093:
+	.string	"char16_t"
+.LASF413:
+	.string	"__DEFINED_size_t "
+.LASF1191:
+	.string	"_mm_storel_epi64"
+.LASF1012:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF776:
+	.string	"va_Unprintf(...) va_gnprintf(char32_t, __VA_ARGS__)"
+.LASF751:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF1032:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1014:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF959:
+	.string	"__pid_t_defined "
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF961:
+	.string	"__ssize_t_defined "
+.LASF854:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1123:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF564:
+	.string	"__restrict_arr __restrict"
+.LASF588:
+	.string	"__stub___compat_bdflush "
+.LASF1070:
+	.string	"_MM_ROUND_DOWN 0x2000"
+.LASF954:
+	.string	"__gid_t_defined "
+.LASF409:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1140:
+	.string	"table"
+.LASF1173:
+	.string	"va_span16_p_bulk_utf16"
+.LASF805:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF851:
+	.string	"VA_QUOTE_NONE 0"
+.LASF656:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF501:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1046:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF543:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF921:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF885:
+	.string	"__need_wchar_t "
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF875:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF792:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1077:
+	.string	"_MM_SHUFFLE2(fp1,fp0) (((fp1) << 1) | (fp0))"
+.LASF900:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF593:
+	.string	"__stub_setlogin "
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF611:
+	.string	"__need_size_t "
+.LASF884:
+	.string	"_MM_MALLOC_H_INCLUDED "
+.LASF617:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF576:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1056:
+	.string	"_MM_EXCEPT_DENORM 0x0002"
+.LASF561:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1153:
+	.string	"__m128i_u"
+.LASF1088:
+	.string	"__uint16_t"
+.LASF1161:
+	.string	"iter_super"
+.LASF455:
+	.string	"__USE_XOPEN2K"
+.LASF1008:
+	.string	"__timeval_defined 1"
+.LASF671:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF784:
+	.string	"va_Uznprintf(...) va_gznprintf(char32_t, __VA_ARGS__)"
+.LASF1206:
+	.string	"va_units_utf16"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1081:
+	.string	"long double"
+.LASF559:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1169:
+	.string	"va_xprintf_char16_const_pp_utf16"
+.LASF821:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1042:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF488:
+	.string	"__USE_POSIX199309 1"
+.LASF867:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF771:
+	.string	"va_snprintf(S,N,...) VA_BLOCK_EXPR((__typeof__(*(S))*)(va_xprintf( &VA_STREAM_CHAR_P(S,N), __VA_ARGS__)->data))"
+.LASF783:
+	.string	"va_uznprintf(...) va_gznprintf(char16_t, __VA_ARGS__)"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1075:
+	.string	"_MM_FLUSH_ZERO_OFF 0x0000"
+.LASF1062:
+	.string	"_MM_MASK_INVALID 0x0080"
+.LASF1184:
+	.string	"va_char16_p_set_chunk_mode"
+.LASF897:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF450:
+	.string	"__USE_POSIX199309"
+.LASF926:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF766:
+	.string	"va_char_p_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_vtab_,va_char32_p_encode))"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF941:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF940:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF713:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF1211:
+	.string	"va_u_valid"
+.LASF906:
+	.string	"__W_CONTINUED 0xffff"
+.LASF952:
+	.string	"__ino_t_defined "
+.LASF742:
+	.string	"va_char32_p_decode utf32"
+.LASF476:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF506:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF454:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF471:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF675:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF1015:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF670:
+	.string	"_BITS_TIME64_H 1"
+.LASF633:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF618:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1210:
+	.string	"va_stream_set_error"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF663:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF699:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF718:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF563:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF698:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF912:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1035:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF528:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF665:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF964:
+	.string	"__clock_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF800:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF817:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF845:
+	.string	"VA_STATE_INIT 0"
+.LASF691:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF570:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF606:
+	.string	"bool _Bool"
+.LASF1195:
+	.string	"_mm_set_epi16"
+.LASF1120:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1201:
+	.string	"__q2"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF426:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1135:
+	.string	"delim"
+.LASF1132:
+	.string	"va_char16_p_read_vtab_utf16_chunk"
+.LASF1197:
+	.string	"__q6"
+.LASF700:
+	.string	"VA_REC0() VA_REC0B"
+.LASF744:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF793:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF541:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1045:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF674:
+	.string	"____mbstate_t_defined 1"
+.LASF535:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1116:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF823:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF644:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF992:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF794:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF438:
+	.string	"NULL ((void *)0)"
+.LASF743:
+	.string	"VA_SIGIL '~'"
+.LASF551:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF439:
+	.string	"__need_NULL"
+.LASF1111:
+	.string	"va_stream"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF1209:
+	.string	"iter_advance"
+.LASF489:
+	.string	"__USE_POSIX199506 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF881:
+	.string	"_EMMINTRIN_H_INCLUDED "
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1066:
+	.string	"_MM_MASK_UNDERFLOW 0x0800"
+.LASF492:
+	.string	"_ATFILE_SOURCE"
+.LASF623:
+	.string	"__SLONG32_TYPE int"
+.LASF990:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1164:
+	.string	"_Type"
+.LASF929:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF788:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF694:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF822:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF956:
+	.string	"__nlink_t_defined "
+.LASF1124:
+	.string	"va_stream_vtab_t"
+.LASF496:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1072:
+	.string	"_MM_ROUND_TOWARD_ZERO 0x6000"
+.LASF1011:
+	.string	"__NFDBITS"
+.LASF604:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF938:
+	.string	"__f32x(x) x ##f32x"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF727:
+	.string	"VA_E_NULL 1"
+.LASF767:
+	.string	"va_char_p_size_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_size_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_size_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_size_vtab_,va_char32_p_encode))"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1021:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF888:
+	.string	"WUNTRACED 2"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF626:
+	.string	"__U64_TYPE unsigned long int"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF646:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF960:
+	.string	"__id_t_defined "
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF730:
+	.string	"VA_E_TRUNC 4"
+.LASF1079:
+	.string	"long unsigned int"
+.LASF1033:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF514:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1194:
+	.string	"_mm_set1_epi16"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF729:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF482:
+	.string	"_POSIX_SOURCE"
+.LASF765:
+	.string	"va_char32_p_encode utf32"
+.LASF1171:
+	.string	"va_len_utf16"
+.LASF1089:
+	.string	"__uint32_t"
+.LASF480:
+	.string	"__USE_ISOC95 1"
+.LASF580:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF404:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1065:
+	.string	"_MM_MASK_OVERFLOW 0x0400"
+.LASF928:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1091:
+	.string	"__uint_least32_t"
+.LASF787:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF533:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF997:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1213:
+	.string	"va_put_utf16"
+.LASF1010:
+	.string	"__suseconds_t_defined "
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF814:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1192:
+	.string	"_mm_storeu_si128"
+.LASF803:
+	.string	"__need_NULL "
+.LASF443:
+	.string	"_FEATURES_H 1"
+.LASF1094:
+	.string	"char32_t"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1114:
+	.string	"qctxt"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF513:
+	.string	"__LEAF , __leaf__"
+.LASF1029:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF545:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF827:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF950:
+	.string	"_SYS_TYPES_H 1"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF628:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF996:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF942:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF979:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF511:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF676:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF481:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF390:
+	.string	"_T_PTRDIFF_ "
+.LASF811:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF830:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF1151:
+	.string	"__m128i"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF746:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF1189:
+	.string	"_mm_unpackhi_epi16"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF837:
+	.string	"VA_MODE_B32 1"
+.LASF386:
+	.string	"_STDDEF_H "
+.LASF1174:
+	.string	"va_char16_p_bulk_utf16"
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1097:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF664:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF911:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1000:
+	.string	"_SYS_SELECT_H 1"
+.LASF422:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF573:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1170:
+	.string	"va_xprintf_char16_p_utf16"
+.LASF449:
+	.string	"__USE_POSIX2"
+.LASF754:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1047:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF418:
+	.string	"__need_size_t"
+.LASF852:
+	.string	"VA_QUOTE_k 1"
+.LASF598:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF870:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF407:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF1177:
+	.string	"store"
+.LASF1080:
+	.string	"long long int"
+.LASF832:
+	.string	"VA_SIGN_SPACE 1"
+.LASF731:
+	.string	"VA_E_FORMAT 5"
+.LASF693:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF419:
+	.string	"__wchar_t__ "
+.LASF582:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF587:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1149:
+	.string	"__v8hi"
+.LASF1112:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF770:
+	.string	"VA_STREAM_CHAR_ARR(S) VA_STREAM_CHAR_P(S,va_countof(S))"
+.LASF434:
+	.string	"__DEFINED_wchar_t "
+.LASF1117:
+	.string	"va_quotations"
+.LASF860:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF890:
+	.string	"WEXITED 4"
+.LASF1026:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF719:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF568:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF424:
+	.string	"__WCHAR_T "
+.LASF1145:
+	.string	"double"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF865:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF1061:
+	.string	"_MM_MASK_MASK 0x1f80"
+.LASF518:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF616:
+	.string	"__U32_TYPE unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF785:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF809:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF549:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF389:
+	.string	"_PTRDIFF_T "
+.LASF567:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1118:
+	.string	"init"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF509:
+	.string	"__PMT"
+.LASF1063:
+	.string	"_MM_MASK_DENORM 0x0100"
+.LASF686:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF995:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF1166:
+	.string	"va_xprintf_last_char16_const_pp_utf16"
+.LASF920:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"VA_MODE_PTR 3"
+.LASF625:
+	.string	"__S64_TYPE long int"
+.LASF650:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1055:
+	.string	"_MM_EXCEPT_INVALID 0x0001"
+.LASF1100:
+	.string	"has_size"
+.LASF710:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF619:
+	.string	"__SQUAD_TYPE long int"
+.LASF613:
+	.string	"__S16_TYPE short int"
+.LASF1009:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF456:
+	.string	"__USE_XOPEN2KXSI"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF466:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF584:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF692:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF359:
+	.string	"__k8 1"
+.LASF579:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1052:
+	.string	"__COMPAR_FN_T "
+.LASF1186:
+	.string	"_mm_cmpeq_epi16"
+.LASF968:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF774:
+	.string	"va_nprintf(...) va_gnprintf(char, __VA_ARGS__)"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF903:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1084:
+	.string	"unsigned int"
+.LASF1048:
+	.string	"__have_pthread_attr_t 1"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1058:
+	.string	"_MM_EXCEPT_OVERFLOW 0x0008"
+.LASF750:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF1071:
+	.string	"_MM_ROUND_UP 0x4000"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF510:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF459:
+	.string	"__USE_LARGEFILE"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF605:
+	.string	"_STDBOOL_H "
+.LASF433:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF490:
+	.string	"__USE_XOPEN2K 1"
+.LASF478:
+	.string	"__USE_ISOC11 1"
+.LASF749:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF1108:
+	.string	"va_read_iter_end_t"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1041:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF444:
+	.string	"__USE_ISOC11"
+.LASF391:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF540:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF544:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1050:
+	.string	"alloca"
+.LASF566:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF591:
+	.string	"__stub_gtty "
+.LASF420:
+	.string	"__WCHAR_T__ "
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF653:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1110:
+	.string	"va_read_iter"
+.LASF432:
+	.string	"_GCC_WCHAR_T "
+.LASF630:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1104:
+	.string	"vtab"
+.LASF864:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF999:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF600:
+	.string	"static_assert"
+.LASF849:
+	.string	"VA_STATE_SKIP 4"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1157:
+	.string	"va_char16_p_end"
+.LASF1143:
+	.string	"__m64"
+.LASF1004:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF397:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF622:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF668:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF504:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF632:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF840:
+	.string	"VA_MODE_TYPE 4"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF639:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF807:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF516:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF572:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF896:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1131:
+	.string	"va_span16_p_read_vtab_utf16"
+.LASF1159:
+	.string	"va_xprintf_span16_p_utf16"
+.LASF1082:
+	.string	"unsigned char"
+.LASF569:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF933:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF910:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF666:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF522:
+	.string	"__STRING(x) #x"
+.LASF421:
+	.string	"_WCHAR_T "
+.LASF1126:
+	.string	"va_span16"
+.LASF927:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF856:
+	.string	"VA_QUOTE_kk 5"
+.LASF804:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF703:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF396:
+	.string	"_GCC_PTRDIFF_T "
+.LASF442:
+	.string	"_ASSERT_H 1"
+.LASF1092:
+	.string	"char"
+.LASF517:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF578:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF402:
+	.string	"_SIZE_T "
+.LASF429:
+	.string	"_WCHAR_T_H "
+.LASF847:
+	.string	"VA_STATE_WIDTH 2"
+.LASF1188:
+	.string	"_mm_unpacklo_epi16"
+.LASF1208:
+	.string	"va_store_utf8"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1125:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF705:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF537:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1059:
+	.string	"_MM_EXCEPT_UNDERFLOW 0x0010"
+.LASF641:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1039:
+	.string	"__ONCE_ALIGNMENT "
+.LASF769:
+	.string	"VA_STREAM_CHAR_SIZE(Char,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_size_vtab_gen((Char*)NULL)), NULL, (N), 0 })"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF387:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF406:
+	.string	"__SIZE_T "
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF497:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF697:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF446:
+	.string	"__USE_ISOC95"
+.LASF696:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF445:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1017:
+	.string	"NFDBITS __NFDBITS"
+.LASF453:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF908:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF602:
+	.string	"VA_PRINT_CHAR_H_ "
+.LASF919:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF735:
+	.string	"va_char_p_format utf8"
+.LASF878:
+	.string	"VA_QCLASS_CALL 2"
+.LASF524:
+	.string	"__BEGIN_DECLS "
+.LASF869:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF552:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF715:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF891:
+	.string	"WCONTINUED 8"
+.LASF962:
+	.string	"__daddr_t_defined "
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1007:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF861:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF648:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1127:
+	.string	"size"
+.LASF707:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF836:
+	.string	"VA_MODE_NORM 0"
+.LASF1167:
+	.string	"va_xprintf_last_char16_p_utf16"
+.LASF1141:
+	.string	"long long unsigned int"
+.LASF388:
+	.string	"_ANSI_STDDEF_H "
+.LASF1162:
+	.string	"iter"
+.LASF932:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF907:
+	.string	"__WCOREFLAG 0x80"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF447:
+	.string	"__USE_ISOCXX11"
+.LASF410:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1205:
+	.string	"va_stream_room"
+.LASF583:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF392:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF853:
+	.string	"VA_QUOTE_q 2"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1002:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF967:
+	.string	"__timer_t_defined 1"
+.LASF485:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1137:
+	.string	"check_flush"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF902:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF953:
+	.string	"__dev_t_defined "
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF958:
+	.string	"__off_t_defined "
+.LASF1115:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF548:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF451:
+	.string	"__USE_POSIX199506"
+.LASF733:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF973:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1148:
+	.string	"__v4si"
+.LASF835:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF946:
+	.string	"RAND_MAX 2147483647"
+.LASF1044:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1076:
+	.ascii	"_MM_TRANSPOSE4_PS(row0,row1,row2,row3) do { __v4sf __r0 = (r"
+	.ascii	"ow0), __r1 = (row1), __r2 = (row2), __r3 = (row3); __v4sf __"
+	.ascii	"t0 = __builtin_ia32_unpcklps (__r0, __r1); __v4sf __t1 = __b"
+	.ascii	"uiltin_ia32_unpcklps (__r2, __r3); __v4sf __t2 = __builtin_i"
+	.ascii	"a32_unpckhps (__r0"
+	.string	", __r1); __v4sf __t3 = __builtin_ia32_unpckhps (__r2, __r3); (row0) = __builtin_ia32_movlhps (__t0, __t1); (row1) = __builtin_ia32_movhlps (__t1, __t0); (row2) = __builtin_ia32_movlhps (__t2, __t3); (row3) = __builtin_ia32_movhlps (__t3, __t2); } while (0)"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF1187:
+	.string	"_mm_and_si128"
+.LASF741:
+	.string	"va_char32_p_format utf32"
+.LASF1106:
+	.string	"va_read_iter_t"
+.LASF494:
+	.string	"__WORDSIZE 64"
+.LASF417:
+	.string	"__size_t "
+.LASF745:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF428:
+	.string	"_WCHAR_T_DEFINED "
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF595:
+	.string	"__stub_stty "
+.LASF637:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF530:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF758:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF408:
+	.string	"_BSD_SIZE_T_ "
+.LASF988:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1156:
+	.string	"__assert_fail"
+.LASF527:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1064:
+	.string	"_MM_MASK_DIV_ZERO 0x0200"
+.LASF452:
+	.string	"__USE_XOPEN"
+.LASF1098:
+	.string	"bulk"
+.LASF976:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF740:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF711:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF986:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF764:
+	.string	"VA_PRINT_CHAR_UTF32_H_ "
+.LASF925:
+	.string	"__HAVE_FLOAT64 1"
+.LASF886:
+	.string	"_STDLIB_H 1"
+.LASF615:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"va_char16_p_decode utf16"
+.LASF738:
+	.string	"va_char16_p_format utf16"
+.LASF1168:
+	.string	"va_xprintf_char16_pp_utf16"
+.LASF895:
+	.string	"__WCLONE 0x80000000"
+.LASF1130:
+	.string	"va_char16_p_read_vtab_utf16"
+.LASF1172:
+	.string	"va_char16_p_transcode_utf16"
+.LASF855:
+	.string	"VA_QUOTE_K 4"
+.LASF431:
+	.string	"__INT_WCHAR_T_H "
+.LASF642:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF747:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF1150:
+	.string	"__v16qi"
+.LASF790:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF786:
+	.string	"_STRING_H 1"
+.LASF1027:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF824:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF883:
+	.string	"_MMINTRIN_H_INCLUDED "
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF834:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF831:
+	.string	"VA_SIGN_NORM 0"
+.LASF499:
+	.string	"__USE_ATFILE 1"
+.LASF1019:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1102:
+	.string	"str_prefix"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF915:
+	.string	"_BITS_FLOATN_H "
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF425:
+	.string	"_WCHAR_T_ "
+.LASF678:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF601:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF708:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1025:
+	.string	"__fsfilcnt_t_defined "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1038:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1154:
+	.string	"va_xprintf_iter_chunk"
+.LASF768:
+	.string	"VA_STREAM_CHAR_P(S,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_vtab_gen(S)), (S), (N), 0 })"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1122:
+	.string	"put_len"
+.LASF918:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF872:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF589:
+	.string	"__stub_chflags "
+.LASF441:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF465:
+	.string	"__USE_GNU"
+.LASF704:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF416:
+	.string	"_SIZET_ "
+.LASF659:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1067:
+	.string	"_MM_MASK_INEXACT 0x1000"
+.LASF757:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF714:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF957:
+	.string	"__uid_t_defined "
+.LASF858:
+	.string	"VA_QUOTE_QQ 7"
+.LASF982:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1099:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1136:
+	.string	"check_quote"
+.LASF652:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF577:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF922:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF560:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF464:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF963:
+	.string	"__key_t_defined "
+.LASF1068:
+	.string	"_MM_ROUND_MASK 0x6000"
+.LASF936:
+	.string	"__f32(x) x ##f32"
+.LASF781:
+	.string	"va_gznprintf(Char,N,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, (size_t)(N) + 1), __VA_ARGS__)->pos + 1)"
+.LASF550:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF905:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF874:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF493:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1016:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF525:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF892:
+	.string	"WNOWAIT 0x01000000"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF723:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF748:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1028:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF850:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF848:
+	.string	"VA_STATE_PREC 3"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF998:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF1086:
+	.string	"short int"
+.LASF508:
+	.string	"_SYS_CDEFS_H 1"
+.LASF610:
+	.string	"_UCHAR_H 1"
+.LASF685:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF975:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF474:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF934:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF780:
+	.string	"va_Uzprintf(...) va_gzprintf(char32_t, __VA_ARGS__)"
+.LASF1138:
+	.string	"render_quote"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1183:
+	.string	"va_span16_p_set_chunk_mode"
+.LASF993:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF538:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1022:
+	.string	"__blksize_t_defined "
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF791:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF575:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF620:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF796:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF399:
+	.string	"__need_ptrdiff_t"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF594:
+	.string	"__stub_sigreturn "
+.LASF586:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF658:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF536:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1101:
+	.string	"chunk_mode"
+.LASF1204:
+	.string	"va_stream_reserve"
+.LASF1073:
+	.string	"_MM_FLUSH_ZERO_MASK 0x8000"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF987:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF539:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF621:
+	.string	"__SWORD_TYPE long int"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF1103:
+	.string	"_pad"
+.LASF547:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF887:
+	.string	"WNOHANG 1"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF634:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF486:
+	.string	"__USE_POSIX 1"
+.LASF684:
+	.string	"VA_PAR ()"
+.LASF1057:
+	.string	"_MM_EXCEPT_DIV_ZERO 0x0004"
+.LASF1133:
+	.string	"va_span16_p_read_vtab_utf16_chunk"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1155:
+	.string	"va_xprintf_iter_local"
+.LASF585:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF947:
+	.string	"EXIT_FAILURE 1"
+.LASF949:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF688:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF808:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF810:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF882:
+	.string	"_XMMINTRIN_H_INCLUDED "
+.LASF608:
+	.string	"false 0"
+.LASF1121:
+	.string	"put_fill"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1043:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF966:
+	.string	"__time_t_defined 1"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1036:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF989:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF554:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF558:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1152:
+	.string	"__m64_u"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF815:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF838:
+	.string	"VA_MODE_CHAR 2"
+.LASF430:
+	.string	"___int_wchar_t_h "
+.LASF876:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF981:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1053:
+	.string	"_MM_SHUFFLE(fp3,fp2,fp1,fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))"
+.LASF574:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF655:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF562:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF923:
+	.string	"__HAVE_FLOAT16 0"
+.LASF690:
+	.string	"VA_F(...) VA_H"
+.LASF944:
+	.string	"__ldiv_t_defined 1"
+.LASF475:
+	.string	"_DEFAULT_SOURCE"
+.LASF841:
+	.string	"VA_MODE_STAT 5"
+.LASF415:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF681:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF677:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF435:
+	.string	"_BSD_WCHAR_T_"
+.LASF819:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF657:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF712:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF868:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF763:
+	.string	"va_char16_p_encode utf16"
+.LASF477:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF631:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF673:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF526:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF978:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF350:
+	.string	"__amd64 1"
+.LASF483:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF487:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF643:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF904:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF581:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1105:
+	.string	"va_read_iter_vtab_t"
+.LASF795:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF635:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF955:
+	.string	"__mode_t_defined "
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF636:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1207:
+	.string	"va_take_utf16"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1203:
+	.string	"__q0"
+.LASF1202:
+	.string	"__q1"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1200:
+	.string	"__q3"
+.LASF1199:
+	.string	"__q4"
+.LASF1198:
+	.string	"__q5"
+.LASF377:
+	.string	"unix 1"
+.LASF1196:
+	.string	"__q7"
+.LASF627:
+	.string	"__STD_TYPE typedef"
+.LASF1144:
+	.string	"float"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1142:
+	.string	"va_quotation_t"
+.LASF1049:
+	.string	"_ALLOCA_H 1"
+.LASF798:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1054:
+	.string	"_MM_EXCEPT_MASK 0x003f"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF500:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF802:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF702:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF609:
+	.string	"__bool_true_false_are_defined 1"
+.LASF893:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF662:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF857:
+	.string	"VA_QUOTE_qq 6"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF679:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF899:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF701:
+	.string	"VA_REC1() VA_REC1B"
+.LASF909:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF1185:
+	.string	"_mm_movemask_epi8"
+.LASF777:
+	.string	"va_gzprintf(Char,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, -(size_t)2), __VA_ARGS__)->pos + 1)"
+.LASF531:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF689:
+	.string	"VA_P(X,...) X"
+.LASF859:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF844:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF943:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF638:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF467:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF460:
+	.string	"__USE_LARGEFILE64"
+.LASF779:
+	.string	"va_uzprintf(...) va_gzprintf(char16_t, __VA_ARGS__)"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF894:
+	.string	"__WALL 0x40000000"
+.LASF951:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1113:
+	.string	"prec"
+.LASF977:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF372:
+	.string	"__linux 1"
+.LASF427:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1128:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF806:
+	.string	"_STRINGS_H 1"
+.LASF1018:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF820:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF789:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF732:
+	.string	"VA_E_ARGC 6"
+.LASF1037:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF667:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF842:
+	.string	"VA_MODE_X6 6"
+.LASF1031:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF484:
+	.string	"_POSIX_C_SOURCE"
+.LASF706:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF661:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF829:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF762:
+	.string	"VA_PRINT_CHAR_UTF16_H_ "
+.LASF812:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF565:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1024:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/utf16.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14728 @@
+	.file	"utf32.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/utf32.c"
+	.globl	va_char32_p_bulk_utf32
+	.type	va_char32_p_bulk_utf32, @function
+va_char32_p_bulk_utf32:
+.LVL0:
+.LFB542:
+	.file 1 "src/utf32.c"
+	.loc 1 86 1 view -0
+	.cfi_startproc
+	.loc 1 87 5 view .LVU1
+	.loc 1 87 21 is_stmt 0 view .LVU2
+	movq	8(%rdi), %rdi
+.LVL1:
+	.loc 1 88 5 is_stmt 1 view .LVU3
+	.loc 1 89 5 view .LVU4
+	.loc 1 89 8 is_stmt 0 view .LVU5
+	testq	%rsi, %rsi
+	je	.L2
+	.loc 1 89 57 discriminator 1 view .LVU6
+	subq	%rdi, %rsi
+.LVL2:
+	.loc 1 89 57 discriminator 1 view .LVU7
+	sarq	$2, %rsi
+	cmpq	%rsi, %rdx
+	cmova	%rsi, %rdx
+.LVL3:
+.L2:
+	.loc 1 93 5 is_stmt 1 view .LVU8
+	.loc 1 94 5 view .LVU9
+	.loc 1 93 12 is_stmt 0 view .LVU10
+	xorl	%eax, %eax
+.LVL4:
+.L3:
+	.loc 1 94 35 is_stmt 1 view .LVU11
+	cmpq	%rax, %rdx
+	je	.L5
+	.loc 1 94 25 is_stmt 0 discriminator 1 view .LVU12
+	movl	(%rdi,%rax,4), %esi
+	.loc 1 94 20 discriminator 1 view .LVU13
+	leal	-1(%rsi), %r8d
+	cmpl	$1114110, %r8d
+	ja	.L5
+.LVL5:
+.LBB106:
+.LBI106:
+	.file 2 "./include/va_print/impl.h"
+	.loc 2 419 19 is_stmt 1 discriminator 2 view .LVU14
+.LBB107:
+	.loc 2 421 5 discriminator 2 view .LVU15
+	.loc 2 421 26 is_stmt 0 discriminator 2 view .LVU16
+	subl	$55296, %esi
+.LBE107:
+.LBE106:
+	.loc 1 94 35 discriminator 2 view .LVU17
+	cmpl	$2047, %esi
+	jbe	.L5
+	.loc 1 95 9 is_stmt 1 view .LVU18
+	.loc 1 95 10 is_stmt 0 view .LVU19
+	incq	%rax
+.LVL6:
+	.loc 1 95 10 view .LVU20
+	jmp	.L3
+.L5:
+	.loc 1 97 5 is_stmt 1 view .LVU21
+	.loc 1 97 10 is_stmt 0 view .LVU22
+	movq	%rax, (%rcx)
+	.loc 1 98 5 is_stmt 1 view .LVU23
+	.loc 1 99 1 is_stmt 0 view .LVU24
+	ret
+	.cfi_endproc
+.LFE542:
+	.size	va_char32_p_bulk_utf32, .-va_char32_p_bulk_utf32
+	.globl	va_span32_p_bulk_utf32
+	.type	va_span32_p_bulk_utf32, @function
+va_span32_p_bulk_utf32:
+.LVL7:
+.LFB543:
+	.loc 1 106 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 107 5 view .LVU26
+	.loc 1 107 41 view .LVU27
+	.loc 1 107 89 view .LVU28
+	.loc 1 107 122 view .LVU29
+	.loc 1 107 40 view .LVU30
+	.loc 1 107 136 view .LVU31
+	.loc 1 107 174 view .LVU32
+	.loc 1 107 187 view .LVU33
+	.loc 1 108 5 view .LVU34
+	.loc 1 108 30 is_stmt 0 view .LVU35
+	movq	16(%rdi), %rax
+	.loc 1 108 8 view .LVU36
+	testq	%rsi, %rsi
+	je	.L13
+	cmpq	%rsi, %rax
+	cmova	%rsi, %rax
+.L13:
+.LVL8:
+	.loc 1 111 5 is_stmt 1 view .LVU37
+	.loc 1 111 12 is_stmt 0 view .LVU38
+	movq	%rax, %rsi
+	jmp	va_char32_p_bulk_utf32
+.LVL9:
+	.loc 1 111 12 view .LVU39
+	.cfi_endproc
+.LFE543:
+	.size	va_span32_p_bulk_utf32, .-va_span32_p_bulk_utf32
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"src/utf32.c"
+.LC1:
+	.string	"iter->cur != NULL"
+	.text
+	.globl	va_char32_p_take_utf32
+	.type	va_char32_p_take_utf32, @function
+va_char32_p_take_utf32:
+.LVL10:
+.LFB541:
+	.loc 1 52 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 53 4 view .LVU41
+	.loc 1 53 8 is_stmt 0 view .LVU42
+	movq	8(%rdi), %rdx
+	.loc 1 53 47 view .LVU43
+	testq	%rdx, %rdx
+	jne	.L18
+	.loc 1 53 24 is_stmt 1 discriminator 1 view .LVU44
+	.loc 1 52 1 is_stmt 0 discriminator 1 view .LVU45
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	.loc 1 53 24 discriminator 1 view .LVU46
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$53, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL11:
+	.loc 1 53 24 discriminator 1 view .LVU47
+	leaq	.LC1(%rip), %rdi
+.LVL12:
+	.loc 1 53 24 discriminator 1 view .LVU48
+	call	__assert_fail@PLT
+.LVL13:
+.L18:
+	.cfi_def_cfa_offset 8
+	.loc 1 54 5 is_stmt 1 view .LVU49
+	.loc 1 55 16 is_stmt 0 view .LVU50
+	orl	$-1, %eax
+	.loc 1 54 8 view .LVU51
+	cmpq	%rsi, %rdx
+	je	.L17
+	.loc 1 57 5 is_stmt 1 view .LVU52
+.LVL14:
+	.loc 1 58 5 view .LVU53
+	.loc 1 58 14 is_stmt 0 view .LVU54
+	movl	(%rdx), %eax
+.LVL15:
+	.loc 1 59 5 is_stmt 1 view .LVU55
+	.loc 1 59 8 is_stmt 0 view .LVU56
+	testl	%eax, %eax
+	jne	.L20
+	.loc 1 61 9 is_stmt 1 view .LVU57
+	.loc 1 61 24 is_stmt 0 view .LVU58
+	movq	(%rdi), %rcx
+	.loc 1 61 12 view .LVU59
+	cmpb	$0, 48(%rcx)
+	je	.L23
+	.loc 1 66 5 is_stmt 1 view .LVU60
+	.loc 1 66 20 is_stmt 0 view .LVU61
+	addq	$4, %rdx
+.LVL16:
+	.loc 1 66 20 view .LVU62
+	movq	%rdx, 8(%rdi)
+.LVL17:
+	.loc 1 67 5 is_stmt 1 view .LVU63
+.LBB108:
+.LBI108:
+	.loc 2 419 19 view .LVU64
+.LBB109:
+	.loc 2 421 5 view .LVU65
+	.loc 2 421 5 is_stmt 0 view .LVU66
+	ret
+.LVL18:
+.L20:
+	.loc 2 421 5 view .LVU67
+.LBE109:
+.LBE108:
+	.loc 1 66 5 is_stmt 1 view .LVU68
+	.loc 1 66 20 is_stmt 0 view .LVU69
+	addq	$4, %rdx
+.LVL19:
+	.loc 1 66 20 view .LVU70
+	movq	%rdx, 8(%rdi)
+.LVL20:
+	.loc 1 67 5 is_stmt 1 view .LVU71
+.LBB111:
+	.loc 2 419 19 view .LVU72
+.LBB110:
+	.loc 2 421 5 view .LVU73
+	.loc 2 421 26 is_stmt 0 view .LVU74
+	leal	-55296(%rax), %edx
+.LVL21:
+	.loc 2 421 26 view .LVU75
+.LBE110:
+.LBE111:
+	.loc 1 67 8 view .LVU76
+	cmpl	$2047, %edx
+	jbe	.L25
+	cmpl	$1114111, %eax
+	jbe	.L17
+.L25:
+	.loc 1 71 5 is_stmt 1 view .LVU77
+	.loc 1 71 8 is_stmt 0 view .LVU78
+	cmpl	$16777215, %eax
+	ja	.L24
+	.loc 1 78 5 is_stmt 1 view .LVU79
+	.loc 1 78 15 is_stmt 0 view .LVU80
+	orl	$50331648, %eax
+.LVL22:
+	.loc 1 78 15 view .LVU81
+	ret
+.LVL23:
+.L23:
+	.loc 1 55 16 view .LVU82
+	orl	$-1, %eax
+.LVL24:
+	.loc 1 55 16 view .LVU83
+	ret
+.LVL25:
+.L24:
+	.loc 1 75 16 view .LVU84
+	movl	$65533, %eax
+.LVL26:
+.L17:
+	.loc 1 79 1 view .LVU85
+	ret
+	.cfi_endproc
+.LFE541:
+	.size	va_char32_p_take_utf32, .-va_char32_p_take_utf32
+	.globl	va_char32_p_transcode_utf32
+	.type	va_char32_p_transcode_utf32, @function
+va_char32_p_transcode_utf32:
+.LVL27:
+.LFB545:
+	.loc 1 144 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 145 5 view .LVU87
+	.loc 1 146 5 view .LVU88
+	.loc 1 146 21 is_stmt 0 view .LVU89
+	leaq	(%rdx,%rcx,4), %r8
+.LVL28:
+	.loc 1 147 5 is_stmt 1 view .LVU90
+	.loc 1 147 8 is_stmt 0 view .LVU91
+	testq	%rdi, %rdi
+	jne	.L33
+	.loc 1 148 9 is_stmt 1 view .LVU92
+.LVL29:
+.LBB170:
+.LBI170:
+	.loc 1 117 15 view .LVU93
+.LBB171:
+	.loc 1 122 5 view .LVU94
+	.loc 1 123 5 view .LVU95
+	cmpb	$1, %sil
+	je	.L53
+	cmpb	$2, %sil
+	jne	.L59
+	xorl	%esi, %esi
+.LVL30:
+	.loc 1 123 5 is_stmt 0 view .LVU96
+	xorl	%eax, %eax
+	jmp	.L35
+.LVL31:
+.L53:
+	.loc 1 123 5 view .LVU97
+	xorl	%esi, %esi
+.LVL32:
+	.loc 1 123 5 view .LVU98
+	xorl	%eax, %eax
+.LVL33:
+.L34:
+.LBB172:
+	.loc 1 125 30 is_stmt 1 view .LVU99
+	cmpq	%rsi, %rcx
+	je	.L61
+	.loc 1 126 13 view .LVU100
+	.loc 1 126 18 is_stmt 0 view .LVU101
+	movl	(%rdx,%rsi,4), %r8d
+.LVL34:
+.LBB173:
+.LBI173:
+	.loc 2 538 22 is_stmt 1 view .LVU102
+.LBB174:
+	.loc 2 540 5 view .LVU103
+	.loc 2 540 15 is_stmt 0 view .LVU104
+	cmpl	$128, %r8d
+	sbbl	%r9d, %r9d
+	.loc 2 540 34 view .LVU105
+	xorl	%edi, %edi
+	cmpl	$2047, %r8d
+	seta	%dil
+	.loc 2 540 49 view .LVU106
+	cmpl	$65535, %r8d
+	seta	%r8b
+.LBE174:
+.LBE173:
+	.loc 1 125 36 view .LVU107
+	incq	%rsi
+.LVL35:
+.LBB176:
+.LBB175:
+	.loc 2 540 49 view .LVU108
+	movzbl	%r8b, %r8d
+	.loc 2 540 44 view .LVU109
+	addl	%r8d, %edi
+	leal	2(%r9,%rdi), %edi
+.LBE175:
+.LBE176:
+	.loc 1 126 15 view .LVU110
+	addq	%rdi, %rax
+.LVL36:
+	.loc 1 125 36 is_stmt 1 view .LVU111
+	.loc 1 125 36 is_stmt 0 view .LVU112
+	jmp	.L34
+.L61:
+	.loc 1 125 36 view .LVU113
+	ret
+.LVL37:
+.L35:
+	.loc 1 125 36 view .LVU114
+.LBE172:
+.LBB177:
+	.loc 1 131 30 is_stmt 1 view .LVU115
+	cmpq	%rsi, %rcx
+	je	.L62
+	.loc 1 132 13 view .LVU116
+.LVL38:
+.LBB178:
+.LBI178:
+	.loc 2 547 22 view .LVU117
+.LBB179:
+	.loc 2 549 5 view .LVU118
+	.loc 2 549 15 is_stmt 0 view .LVU119
+	cmpl	$65536, (%rdx,%rsi,4)
+	sbbq	%rdi, %rdi
+.LBE179:
+.LBE178:
+	.loc 1 131 36 view .LVU120
+	incq	%rsi
+.LVL39:
+	.loc 1 132 15 view .LVU121
+	leaq	2(%rax,%rdi), %rax
+.LVL40:
+	.loc 1 131 36 is_stmt 1 view .LVU122
+	.loc 1 131 36 is_stmt 0 view .LVU123
+	jmp	.L35
+.L62:
+	.loc 1 131 36 view .LVU124
+.LBE177:
+	.loc 1 134 9 is_stmt 1 view .LVU125
+	.loc 1 134 18 is_stmt 0 view .LVU126
+	addq	%rax, %rax
+.LVL41:
+	.loc 1 134 18 view .LVU127
+	ret
+.LVL42:
+.L33:
+	.loc 1 134 18 view .LVU128
+.LBE171:
+.LBE170:
+	.loc 1 150 5 is_stmt 1 view .LVU129
+	cmpb	$1, %sil
+	je	.L57
+	cmpb	$2, %sil
+	je	.L58
+.L59:
+	.loc 1 150 5 is_stmt 0 view .LVU130
+	xorl	%eax, %eax
+	ret
+.L57:
+.LBB180:
+.LBB181:
+.LBB182:
+.LBB183:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 3 1311 33 view .LVU131
+	movaps	.LC2(%rip), %xmm3
+.LBE183:
+.LBE182:
+.LBE181:
+.LBE180:
+	.loc 1 150 5 view .LVU132
+	movq	%rdi, %rax
+.LBB223:
+.LBB219:
+.LBB186:
+.LBB187:
+	.loc 3 1347 33 view .LVU133
+	xorps	%xmm4, %xmm4
+.LVL43:
+.L41:
+	.loc 3 1347 33 view .LVU134
+.LBE187:
+.LBE186:
+.LBE219:
+	.loc 1 153 18 is_stmt 1 view .LVU135
+	cmpq	%r8, %rdx
+	jnb	.L60
+	.loc 1 156 13 view .LVU136
+	.loc 1 156 20 is_stmt 0 view .LVU137
+	movq	%r8, %rcx
+	subq	%rdx, %rcx
+	.loc 1 156 16 view .LVU138
+	cmpq	$28, %rcx
+	jle	.L43
+.LBB220:
+	.loc 1 157 17 is_stmt 1 view .LVU139
+.LVL44:
+.LBB190:
+.LBI190:
+	.loc 3 701 1 view .LVU140
+.LBB191:
+	.loc 3 703 3 view .LVU141
+.LBE191:
+.LBE190:
+.LBB193:
+.LBB194:
+	.loc 3 703 10 is_stmt 0 view .LVU142
+	movups	16(%rdx), %xmm2
+.LBE194:
+.LBE193:
+.LBB196:
+.LBB192:
+	movups	(%rdx), %xmm0
+.LVL45:
+	.loc 3 703 10 view .LVU143
+.LBE192:
+.LBE196:
+	.loc 1 158 17 is_stmt 1 view .LVU144
+.LBB197:
+.LBI193:
+	.loc 3 701 1 view .LVU145
+.LBB195:
+	.loc 3 703 3 view .LVU146
+	.loc 3 703 3 is_stmt 0 view .LVU147
+.LBE195:
+.LBE197:
+	.loc 1 159 17 is_stmt 1 view .LVU148
+.LBB198:
+.LBI198:
+	.loc 3 1321 1 view .LVU149
+.LBB199:
+	.loc 3 1323 3 view .LVU150
+	.loc 3 1323 3 is_stmt 0 view .LVU151
+.LBE199:
+.LBE198:
+.LBB201:
+.LBI182:
+	.loc 3 1309 1 is_stmt 1 view .LVU152
+.LBB184:
+	.loc 3 1311 3 view .LVU153
+	.loc 3 1311 3 is_stmt 0 view .LVU154
+.LBE184:
+.LBE201:
+	.loc 1 160 17 is_stmt 1 view .LVU155
+.LBB202:
+.LBI186:
+	.loc 3 1345 1 view .LVU156
+.LBB188:
+	.loc 3 1347 3 view .LVU157
+	.loc 3 1347 3 is_stmt 0 view .LVU158
+.LBE188:
+.LBE202:
+.LBB203:
+.LBI203:
+	.loc 3 1431 1 is_stmt 1 view .LVU159
+.LBB204:
+	.loc 3 1433 3 view .LVU160
+.LBE204:
+.LBE203:
+.LBB206:
+.LBB200:
+	.loc 3 1323 33 is_stmt 0 view .LVU161
+	movaps	%xmm2, %xmm1
+	orps	%xmm0, %xmm1
+.LVL46:
+	.loc 3 1323 33 view .LVU162
+.LBE200:
+.LBE206:
+.LBB207:
+.LBB185:
+	.loc 3 1311 33 view .LVU163
+	andps	%xmm3, %xmm1
+.LVL47:
+	.loc 3 1311 33 view .LVU164
+.LBE185:
+.LBE207:
+.LBB208:
+.LBB189:
+	.loc 3 1347 33 view .LVU165
+	pcmpeqd	%xmm4, %xmm1
+.LBE189:
+.LBE208:
+.LBB209:
+.LBB205:
+	.loc 3 1433 10 view .LVU166
+	pmovmskb	%xmm1, %ecx
+.LVL48:
+	.loc 3 1433 10 view .LVU167
+.LBE205:
+.LBE209:
+	.loc 1 160 20 view .LVU168
+	cmpl	$65535, %ecx
+	jne	.L43
+.LBB210:
+	.loc 1 161 21 is_stmt 1 view .LVU169
+.LVL49:
+.LBB211:
+.LBI211:
+	.loc 3 992 1 view .LVU170
+.LBB212:
+	.loc 3 994 3 view .LVU171
+	.loc 3 994 19 is_stmt 0 view .LVU172
+	packssdw	%xmm2, %xmm0
+.LVL50:
+	.loc 3 994 19 view .LVU173
+.LBE212:
+.LBE211:
+	.loc 1 162 21 is_stmt 1 view .LVU174
+.LBB213:
+.LBI213:
+	.loc 3 998 1 view .LVU175
+.LBB214:
+	.loc 3 1000 3 view .LVU176
+.LBE214:
+.LBE213:
+	.loc 1 163 23 is_stmt 0 view .LVU177
+	leaq	32(%rdx), %r9
+	.loc 1 164 23 view .LVU178
+	addq	$8, %rax
+.LVL51:
+.LBB216:
+.LBB215:
+	.loc 3 1000 19 view .LVU179
+	packuswb	%xmm0, %xmm0
+.LVL52:
+	.loc 3 1000 19 view .LVU180
+.LBE215:
+.LBE216:
+.LBB217:
+.LBI217:
+	.loc 3 743 1 is_stmt 1 view .LVU181
+.LBB218:
+	.loc 3 745 3 view .LVU182
+	.loc 3 745 19 is_stmt 0 view .LVU183
+	movq	%xmm0, -8(%rax)
+.LVL53:
+	.loc 3 745 19 view .LVU184
+.LBE218:
+.LBE217:
+	.loc 1 163 21 is_stmt 1 view .LVU185
+	.loc 1 164 21 view .LVU186
+	.loc 1 165 21 view .LVU187
+	jmp	.L44
+.LVL54:
+.L43:
+	.loc 1 165 21 is_stmt 0 view .LVU188
+.LBE210:
+.LBE220:
+	.loc 1 169 13 is_stmt 1 view .LVU189
+	.loc 1 169 36 is_stmt 0 view .LVU190
+	leaq	4(%rdx), %r9
+.LVL55:
+	.loc 1 169 17 view .LVU191
+	movl	(%rdx), %edx
+.LVL56:
+.LBB221:
+.LBI221:
+	.loc 2 451 21 is_stmt 1 view .LVU192
+.LBB222:
+	.loc 2 453 5 view .LVU193
+	.loc 2 453 8 is_stmt 0 view .LVU194
+	cmpl	$127, %edx
+	ja	.L45
+	.loc 2 454 9 is_stmt 1 view .LVU195
+.LVL57:
+	.loc 2 454 16 is_stmt 0 view .LVU196
+	movb	%dl, (%rax)
+	.loc 2 454 11 view .LVU197
+	incq	%rax
+.LVL58:
+	.loc 2 454 11 view .LVU198
+	jmp	.L44
+.LVL59:
+.L45:
+	.loc 2 456 10 is_stmt 1 view .LVU199
+	.loc 2 458 33 is_stmt 0 view .LVU200
+	movl	%edx, %r10d
+	.loc 2 457 33 view .LVU201
+	movl	%edx, %ecx
+	.loc 2 458 33 view .LVU202
+	andl	$63, %r10d
+	.loc 2 457 33 view .LVU203
+	shrl	$6, %ecx
+	.loc 2 458 28 view .LVU204
+	orl	$-128, %r10d
+	.loc 2 456 13 view .LVU205
+	cmpl	$2047, %edx
+	ja	.L46
+	.loc 2 457 9 is_stmt 1 view .LVU206
+.LVL60:
+	.loc 2 457 28 is_stmt 0 view .LVU207
+	orl	$-64, %ecx
+	.loc 2 458 14 view .LVU208
+	movb	%r10b, 1(%rax)
+	.loc 2 458 11 view .LVU209
+	addq	$2, %rax
+.LVL61:
+	.loc 2 457 28 view .LVU210
+	movb	%cl, -2(%rax)
+	.loc 2 458 9 is_stmt 1 view .LVU211
+.LVL62:
+	.loc 2 458 9 is_stmt 0 view .LVU212
+	jmp	.L44
+.LVL63:
+.L46:
+	.loc 2 460 10 is_stmt 1 view .LVU213
+	.loc 2 461 33 is_stmt 0 view .LVU214
+	movl	%edx, %esi
+	.loc 2 462 40 view .LVU215
+	andl	$63, %ecx
+	.loc 2 461 33 view .LVU216
+	shrl	$12, %esi
+	.loc 2 462 28 view .LVU217
+	orl	$-128, %ecx
+	.loc 2 460 13 view .LVU218
+	cmpl	$65535, %edx
+	ja	.L47
+	.loc 2 461 9 is_stmt 1 view .LVU219
+.LVL64:
+	.loc 2 461 28 is_stmt 0 view .LVU220
+	orl	$-32, %esi
+	.loc 2 462 14 view .LVU221
+	movb	%cl, 1(%rax)
+	.loc 2 463 11 view .LVU222
+	addq	$3, %rax
+.LVL65:
+	.loc 2 461 28 view .LVU223
+	movb	%sil, -3(%rax)
+	.loc 2 462 9 is_stmt 1 view .LVU224
+.LVL66:
+	.loc 2 463 9 view .LVU225
+	.loc 2 463 14 is_stmt 0 view .LVU226
+	movb	%r10b, -1(%rax)
+	jmp	.L44
+.LVL67:
+.L47:
+	.loc 2 466 9 is_stmt 1 view .LVU227
+	.loc 2 466 33 is_stmt 0 view .LVU228
+	shrl	$18, %edx
+.LVL68:
+	.loc 2 467 41 view .LVU229
+	andl	$63, %esi
+	.loc 2 468 14 view .LVU230
+	movb	%cl, 2(%rax)
+.LVL69:
+	.loc 2 469 11 view .LVU231
+	addq	$4, %rax
+.LVL70:
+	.loc 2 469 14 view .LVU232
+	movb	%r10b, -1(%rax)
+	.loc 2 466 28 view .LVU233
+	orl	$-16, %edx
+	.loc 2 467 28 view .LVU234
+	orl	$-128, %esi
+	.loc 2 466 28 view .LVU235
+	movb	%dl, -4(%rax)
+	.loc 2 467 9 is_stmt 1 view .LVU236
+.LVL71:
+	.loc 2 467 28 is_stmt 0 view .LVU237
+	movb	%sil, -3(%rax)
+	.loc 2 468 9 is_stmt 1 view .LVU238
+	.loc 2 469 9 view .LVU239
+.LVL72:
+.L44:
+	.loc 2 469 11 is_stmt 0 view .LVU240
+	movq	%r9, %rdx
+	jmp	.L41
+.LVL73:
+.L58:
+	.loc 2 469 11 view .LVU241
+.LBE222:
+.LBE221:
+.LBE223:
+.LBB224:
+.LBB225:
+.LBB226:
+.LBB227:
+	.loc 3 1311 33 view .LVU242
+	movaps	.LC3(%rip), %xmm3
+.LBE227:
+.LBE226:
+.LBE225:
+.LBE224:
+	.loc 1 150 5 view .LVU243
+	movq	%rdi, %rax
+.LBB277:
+.LBB273:
+.LBB230:
+.LBB231:
+	.loc 3 1347 33 view .LVU244
+	xorps	%xmm4, %xmm4
+.LVL74:
+.L42:
+	.loc 3 1347 33 view .LVU245
+.LBE231:
+.LBE230:
+.LBE273:
+	.loc 1 176 18 is_stmt 1 view .LVU246
+	cmpq	%r8, %rdx
+	jnb	.L60
+	.loc 1 180 13 view .LVU247
+	.loc 1 180 20 is_stmt 0 view .LVU248
+	movq	%r8, %rcx
+	subq	%rdx, %rcx
+	.loc 1 180 16 view .LVU249
+	cmpq	$28, %rcx
+	jle	.L49
+.LBB274:
+	.loc 1 181 17 is_stmt 1 view .LVU250
+.LVL75:
+.LBB234:
+.LBI234:
+	.loc 3 701 1 view .LVU251
+.LBB235:
+	.loc 3 703 3 view .LVU252
+	.loc 3 703 10 is_stmt 0 view .LVU253
+	movups	(%rdx), %xmm0
+.LVL76:
+	.loc 3 703 10 view .LVU254
+.LBE235:
+.LBE234:
+	.loc 1 182 17 is_stmt 1 view .LVU255
+.LBB236:
+.LBI236:
+	.loc 3 701 1 view .LVU256
+.LBB237:
+	.loc 3 703 3 view .LVU257
+	.loc 3 703 10 is_stmt 0 view .LVU258
+	movups	16(%rdx), %xmm2
+.LVL77:
+	.loc 3 703 10 view .LVU259
+.LBE237:
+.LBE236:
+	.loc 1 183 17 is_stmt 1 view .LVU260
+.LBB238:
+.LBI238:
+	.loc 3 1321 1 view .LVU261
+.LBB239:
+	.loc 3 1323 3 view .LVU262
+	.loc 3 1323 3 is_stmt 0 view .LVU263
+.LBE239:
+.LBE238:
+.LBB241:
+.LBI226:
+	.loc 3 1309 1 is_stmt 1 view .LVU264
+.LBB228:
+	.loc 3 1311 3 view .LVU265
+	.loc 3 1311 3 is_stmt 0 view .LVU266
+.LBE228:
+.LBE241:
+	.loc 1 184 17 is_stmt 1 view .LVU267
+.LBB242:
+.LBI230:
+	.loc 3 1345 1 view .LVU268
+.LBB232:
+	.loc 3 1347 3 view .LVU269
+	.loc 3 1347 3 is_stmt 0 view .LVU270
+.LBE232:
+.LBE242:
+.LBB243:
+.LBI243:
+	.loc 3 1431 1 is_stmt 1 view .LVU271
+.LBB244:
+	.loc 3 1433 3 view .LVU272
+.LBE244:
+.LBE243:
+.LBB246:
+.LBB240:
+	.loc 3 1323 33 is_stmt 0 view .LVU273
+	movaps	%xmm0, %xmm1
+	orps	%xmm2, %xmm1
+.LVL78:
+	.loc 3 1323 33 view .LVU274
+.LBE240:
+.LBE246:
+.LBB247:
+.LBB229:
+	.loc 3 1311 33 view .LVU275
+	andps	%xmm3, %xmm1
+.LVL79:
+	.loc 3 1311 33 view .LVU276
+.LBE229:
+.LBE247:
+.LBB248:
+.LBB233:
+	.loc 3 1347 33 view .LVU277
+	pcmpeqd	%xmm4, %xmm1
+.LBE233:
+.LBE248:
+.LBB249:
+.LBB245:
+	.loc 3 1433 10 view .LVU278
+	pmovmskb	%xmm1, %ecx
+.LVL80:
+	.loc 3 1433 10 view .LVU279
+.LBE245:
+.LBE249:
+	.loc 1 184 20 view .LVU280
+	cmpl	$65535, %ecx
+	jne	.L49
+.LBB250:
+	.loc 1 185 21 is_stmt 1 view .LVU281
+.LVL81:
+	.loc 1 186 21 view .LVU282
+.LBB251:
+.LBI251:
+	.loc 3 1112 1 view .LVU283
+.LBB252:
+	.loc 3 1114 3 view .LVU284
+	.loc 3 1114 3 is_stmt 0 view .LVU285
+.LBE252:
+.LBE251:
+.LBB254:
+.LBI254:
+	.loc 3 1112 1 is_stmt 1 view .LVU286
+.LBB255:
+	.loc 3 1114 3 view .LVU287
+	.loc 3 1114 3 is_stmt 0 view .LVU288
+.LBE255:
+.LBE254:
+.LBB258:
+.LBI258:
+	.loc 3 992 1 is_stmt 1 view .LVU289
+.LBB259:
+	.loc 3 994 3 view .LVU290
+.LBE259:
+.LBE258:
+.LBB261:
+.LBB256:
+	.loc 3 1114 33 is_stmt 0 view .LVU291
+	movaps	.LC4(%rip), %xmm1
+.LBE256:
+.LBE261:
+	.loc 1 188 23 view .LVU292
+	leaq	32(%rdx), %rsi
+	.loc 1 189 23 view .LVU293
+	addq	$16, %rax
+.LVL82:
+.LBB262:
+.LBB257:
+	.loc 3 1114 33 view .LVU294
+	paddd	%xmm1, %xmm0
+.LVL83:
+	.loc 3 1114 33 view .LVU295
+.LBE257:
+.LBE262:
+.LBB263:
+.LBB253:
+	paddd	%xmm1, %xmm2
+.LVL84:
+	.loc 3 1114 33 view .LVU296
+.LBE253:
+.LBE263:
+.LBB264:
+.LBB260:
+	.loc 3 994 19 view .LVU297
+	packssdw	%xmm2, %xmm0
+.LVL85:
+	.loc 3 994 19 view .LVU298
+.LBE260:
+.LBE264:
+	.loc 1 187 21 is_stmt 1 view .LVU299
+.LBB265:
+.LBI265:
+	.loc 3 1058 1 view .LVU300
+.LBB266:
+	.loc 3 1060 3 view .LVU301
+	.loc 3 1060 3 is_stmt 0 view .LVU302
+.LBE266:
+.LBE265:
+.LBB268:
+.LBI268:
+	.loc 3 737 1 is_stmt 1 view .LVU303
+.LBB269:
+	.loc 3 739 3 view .LVU304
+.LBE269:
+.LBE268:
+.LBB271:
+.LBB267:
+	.loc 3 1060 33 is_stmt 0 view .LVU305
+	paddw	.LC5(%rip), %xmm0
+.LVL86:
+	.loc 3 1060 33 view .LVU306
+.LBE267:
+.LBE271:
+.LBB272:
+.LBB270:
+	.loc 3 739 8 view .LVU307
+	movups	%xmm0, -16(%rax)
+.LVL87:
+	.loc 3 739 8 view .LVU308
+.LBE270:
+.LBE272:
+	.loc 1 188 21 is_stmt 1 view .LVU309
+	.loc 1 189 21 view .LVU310
+	.loc 1 190 21 view .LVU311
+	jmp	.L50
+.LVL88:
+.L49:
+	.loc 1 190 21 is_stmt 0 view .LVU312
+.LBE250:
+.LBE274:
+	.loc 1 194 13 is_stmt 1 view .LVU313
+	.loc 1 194 37 is_stmt 0 view .LVU314
+	leaq	4(%rdx), %rsi
+.LVL89:
+	.loc 1 194 17 view .LVU315
+	movl	(%rdx), %edx
+.LVL90:
+.LBB275:
+.LBI275:
+	.loc 2 478 25 is_stmt 1 view .LVU316
+.LBB276:
+	.loc 2 480 5 view .LVU317
+	.loc 2 480 8 is_stmt 0 view .LVU318
+	cmpl	$65535, %edx
+	jbe	.L51
+	.loc 2 481 9 is_stmt 1 view .LVU319
+	.loc 2 481 11 is_stmt 0 view .LVU320
+	subl	$65536, %edx
+.LVL91:
+	.loc 2 482 9 is_stmt 1 view .LVU321
+	.loc 2 483 11 is_stmt 0 view .LVU322
+	addq	$4, %rax
+.LVL92:
+	.loc 2 482 39 view .LVU323
+	movl	%edx, %ecx
+	.loc 2 483 39 view .LVU324
+	andw	$1023, %dx
+.LVL93:
+	.loc 2 482 39 view .LVU325
+	shrl	$10, %ecx
+.LVL94:
+	.loc 2 483 16 view .LVU326
+	subw	$9216, %dx
+	.loc 2 482 16 view .LVU327
+	subw	$10240, %cx
+	.loc 2 483 16 view .LVU328
+	movw	%dx, -2(%rax)
+.LVL95:
+	.loc 2 482 16 view .LVU329
+	movw	%cx, -4(%rax)
+	.loc 2 483 9 is_stmt 1 view .LVU330
+.LVL96:
+	.loc 2 483 9 is_stmt 0 view .LVU331
+	jmp	.L50
+.LVL97:
+.L51:
+	.loc 2 486 9 is_stmt 1 view .LVU332
+	.loc 2 486 16 is_stmt 0 view .LVU333
+	movw	%dx, (%rax)
+	.loc 2 486 11 view .LVU334
+	addq	$2, %rax
+.LVL98:
+.L50:
+	.loc 2 483 11 view .LVU335
+	movq	%rsi, %rdx
+	jmp	.L42
+.LVL99:
+.L60:
+	.loc 2 483 11 view .LVU336
+.LBE276:
+.LBE275:
+	.loc 1 196 9 is_stmt 1 view .LVU337
+	.loc 1 196 35 is_stmt 0 view .LVU338
+	subq	%rdi, %rax
+.LBE277:
+	.loc 1 200 1 view .LVU339
+	ret
+	.cfi_endproc
+.LFE545:
+	.size	va_char32_p_transcode_utf32, .-va_char32_p_transcode_utf32
+	.section	.rodata.str1.1
+.LC6:
+	.string	"iter_super->cur != NULL"
+	.text
+	.globl	va_span32_p_take_utf32
+	.type	va_span32_p_take_utf32, @function
+va_span32_p_take_utf32:
+.LVL100:
+.LFB554:
+	.loc 1 296 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 297 4 view .LVU341
+	.loc 1 297 14 is_stmt 0 view .LVU342
+	movq	8(%rdi), %rax
+	.loc 1 297 47 view .LVU343
+	testq	%rax, %rax
+	jne	.L64
+.LBB281:
+.LBI281:
+	.loc 1 293 17 is_stmt 1 view .LVU344
+.LVL101:
+.LBB282:
+	.loc 1 297 24 view .LVU345
+.LBE282:
+.LBE281:
+	.loc 1 296 1 is_stmt 0 view .LVU346
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB284:
+.LBB283:
+	.loc 1 297 24 view .LVU347
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx
+	movl	$297, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL102:
+	.loc 1 297 24 view .LVU348
+	leaq	.LC6(%rip), %rdi
+.LVL103:
+	.loc 1 297 24 view .LVU349
+	call	__assert_fail@PLT
+.LVL104:
+.L64:
+	.cfi_def_cfa_offset 8
+	.loc 1 297 24 view .LVU350
+.LBE283:
+.LBE284:
+	.loc 1 298 5 is_stmt 1 view .LVU351
+	.loc 1 298 34 view .LVU352
+	.loc 1 298 82 view .LVU353
+	.loc 1 298 115 view .LVU354
+	.loc 1 298 33 view .LVU355
+	.loc 1 298 129 view .LVU356
+	.loc 1 298 167 view .LVU357
+	.loc 1 298 180 view .LVU358
+	.loc 1 299 5 view .LVU359
+	.loc 1 299 8 is_stmt 0 view .LVU360
+	cmpq	16(%rdi), %rax
+	je	.L65
+	.loc 1 302 5 is_stmt 1 view .LVU361
+	.loc 1 302 12 is_stmt 0 view .LVU362
+	jmp	va_char32_p_take_utf32
+.LVL105:
+.L65:
+	.loc 1 303 1 view .LVU363
+	orl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE554:
+	.size	va_span32_p_take_utf32, .-va_span32_p_take_utf32
+	.globl	va_put_utf32
+	.type	va_put_utf32, @function
+va_put_utf32:
+.LVL106:
+.LFB546:
+	.loc 1 206 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 208 5 view .LVU365
+	.loc 1 206 1 is_stmt 0 view .LVU366
+	pushq	%r12
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	.loc 1 208 8 view .LVU367
+	movl	%esi, %eax
+	.loc 1 206 1 view .LVU368
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 208 8 view .LVU369
+	andl	$520093696, %eax
+	je	.L70
+	.loc 1 209 9 is_stmt 1 view .LVU370
+	.loc 1 211 15 is_stmt 0 view .LVU371
+	andl	$16777215, %ebp
+	.loc 1 209 12 view .LVU372
+	cmpl	$50331648, %eax
+	jne	.L71
+	jmp	.L72
+.L70:
+	.loc 1 218 5 is_stmt 1 view .LVU373
+.LVL107:
+.LBB285:
+.LBI285:
+	.loc 2 419 19 view .LVU374
+.LBB286:
+	.loc 2 421 5 view .LVU375
+	.loc 2 421 26 is_stmt 0 view .LVU376
+	leal	-55296(%rsi), %eax
+.LBE286:
+.LBE285:
+	.loc 1 218 8 view .LVU377
+	cmpl	$2047, %eax
+	jbe	.L78
+	cmpl	$1114111, %esi
+	jbe	.L72
+.L78:
+	.loc 1 219 9 is_stmt 1 view .LVU378
+.LVL108:
+.LBB287:
+.LBI287:
+	.loc 2 425 20 view .LVU379
+.LBB288:
+	.loc 2 427 5 view .LVU380
+	.loc 2 427 13 is_stmt 0 view .LVU381
+	movl	32(%rdi), %eax
+	.loc 2 427 8 view .LVU382
+	testl	$939524096, %eax
+	je	.L74
+.LVL109:
+.L71:
+	.loc 2 427 8 view .LVU383
+.LBE288:
+.LBE287:
+	.loc 1 214 11 view .LVU384
+	movl	$65533, %ebp
+	jmp	.L72
+.LVL110:
+.L74:
+.LBB291:
+.LBB290:
+	.loc 2 428 9 is_stmt 1 view .LVU385
+.LBB289:
+	.loc 2 428 25 view .LVU386
+	.loc 2 428 62 view .LVU387
+	.loc 2 428 101 is_stmt 0 view .LVU388
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU389
+	orl	$402653184, %eax
+	movl	%eax, 32(%rdi)
+	jmp	.L71
+.LVL111:
+.L72:
+	.loc 2 428 123 view .LVU390
+.LBE289:
+.LBE290:
+.LBE291:
+	.loc 1 224 5 is_stmt 1 view .LVU391
+.LBB292:
+.LBI292:
+	.loc 2 585 19 view .LVU392
+.LBB293:
+	.loc 2 587 5 view .LVU393
+.LBB294:
+.LBI294:
+	.loc 2 574 22 view .LVU394
+.LBB295:
+	.loc 2 576 5 view .LVU395
+	.loc 2 576 39 is_stmt 0 view .LVU396
+	movq	48(%rdi), %rax
+	subq	40(%rdi), %rax
+.LBE295:
+.LBE294:
+	.loc 2 587 8 view .LVU397
+	cmpq	$3, %rax
+	ja	.L75
+	.loc 2 590 5 is_stmt 1 view .LVU398
+	.loc 2 590 20 is_stmt 0 view .LVU399
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	.loc 2 590 37 view .LVU400
+	testq	%rax, %rax
+	jne	.L76
+.LVL112:
+.L77:
+	.loc 2 590 37 view .LVU401
+.LBE293:
+.LBE292:
+	.loc 1 230 5 is_stmt 1 view .LVU402
+	.loc 1 231 1 is_stmt 0 view .LVU403
+	addq	$24, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	.loc 1 230 5 view .LVU404
+	movl	%ebp, %esi
+	movq	%r12, %rax
+	.loc 1 231 1 view .LVU405
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL113:
+	.loc 1 231 1 view .LVU406
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL114:
+	.loc 1 230 5 view .LVU407
+	jmp	*%rax
+.LVL115:
+.L76:
+	.cfi_restore_state
+.LBB297:
+.LBB296:
+	.loc 2 590 40 view .LVU408
+	movq	%rdi, 8(%rsp)
+	movl	$4, %esi
+	call	*%rax
+.LVL116:
+	.loc 2 590 37 view .LVU409
+	movq	8(%rsp), %rdi
+	testb	%al, %al
+	je	.L77
+.LVL117:
+.L75:
+	.loc 2 590 37 view .LVU410
+.LBE296:
+.LBE297:
+.LBB298:
+	.loc 1 225 9 is_stmt 1 view .LVU411
+	.loc 1 225 19 is_stmt 0 view .LVU412
+	movq	40(%rdi), %rax
+.LVL118:
+	.loc 1 226 9 is_stmt 1 view .LVU413
+	.loc 1 226 14 is_stmt 0 view .LVU414
+	movl	%ebp, (%rax)
+	.loc 1 227 9 is_stmt 1 view .LVU415
+	.loc 1 226 11 is_stmt 0 view .LVU416
+	addq	$4, %rax
+.LVL119:
+	.loc 1 226 11 view .LVU417
+	movq	%rax, 40(%rdi)
+	.loc 1 228 9 is_stmt 1 view .LVU418
+.LBE298:
+	.loc 1 231 1 is_stmt 0 view .LVU419
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	popq	%rbp
+	.cfi_def_cfa_offset 16
+.LVL120:
+	.loc 1 231 1 view .LVU420
+	popq	%r12
+	.cfi_def_cfa_offset 8
+.LVL121:
+	.loc 1 231 1 view .LVU421
+	ret
+	.cfi_endproc
+.LFE546:
+	.size	va_put_utf32, .-va_put_utf32
+	.globl	va_len_utf32
+	.type	va_len_utf32, @function
+va_len_utf32:
+.LVL122:
+.LFB547:
+	.loc 1 236 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 238 5 view .LVU423
+	.loc 1 238 8 is_stmt 0 view .LVU424
+	testl	$520093696, %esi
+	jne	.L87
+.LVL123:
+.LBB299:
+.LBI299:
+	.loc 2 419 19 is_stmt 1 view .LVU425
+.LBB300:
+	.loc 2 421 5 view .LVU426
+	.loc 2 421 26 is_stmt 0 view .LVU427
+	leal	-55296(%rsi), %eax
+.LBE300:
+.LBE299:
+	.loc 1 238 33 view .LVU428
+	cmpl	$2047, %eax
+	jbe	.L89
+	cmpl	$1114111, %esi
+	jbe	.L87
+.L89:
+	.loc 1 239 9 is_stmt 1 view .LVU429
+.LVL124:
+.LBB301:
+.LBI301:
+	.loc 2 425 20 view .LVU430
+.LBB302:
+	.loc 2 427 5 view .LVU431
+	.loc 2 427 13 is_stmt 0 view .LVU432
+	movl	32(%rdi), %eax
+	.loc 2 427 8 view .LVU433
+	testl	$939524096, %eax
+	jne	.L87
+	.loc 2 428 9 is_stmt 1 view .LVU434
+.LBB303:
+	.loc 2 428 25 view .LVU435
+.LVL125:
+	.loc 2 428 62 view .LVU436
+	.loc 2 428 101 is_stmt 0 view .LVU437
+	andl	$-939524097, %eax
+	.loc 2 428 123 view .LVU438
+	orl	$402653184, %eax
+	movl	%eax, 32(%rdi)
+.LVL126:
+.L87:
+	.loc 2 428 123 view .LVU439
+.LBE303:
+.LBE302:
+.LBE301:
+	.loc 1 241 5 is_stmt 1 view .LVU440
+	.loc 1 242 1 is_stmt 0 view .LVU441
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE547:
+	.size	va_len_utf32, .-va_len_utf32
+	.globl	va_xprintf_char32_p_utf32
+	.type	va_xprintf_char32_p_utf32, @function
+va_xprintf_char32_p_utf32:
+.LVL127:
+.LFB548:
+	.loc 1 247 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 248 5 view .LVU443
+	.loc 1 247 1 is_stmt 0 view .LVU444
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 248 20 view .LVU445
+	leaq	va_char32_p_read_vtab_utf32(%rip), %rax
+	movq	%rsi, 8(%rsp)
+	.loc 1 249 5 is_stmt 1 view .LVU446
+	.loc 1 249 12 is_stmt 0 view .LVU447
+	movq	%rsp, %rsi
+.LVL128:
+	.loc 1 248 20 view .LVU448
+	movq	%rax, (%rsp)
+	.loc 1 249 12 view .LVU449
+	call	va_xprintf_iter_local@PLT
+.LVL129:
+	.loc 1 250 1 view .LVU450
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE548:
+	.size	va_xprintf_char32_p_utf32, .-va_xprintf_char32_p_utf32
+	.globl	va_xprintf_char32_const_pp_utf32
+	.type	va_xprintf_char32_const_pp_utf32, @function
+va_xprintf_char32_const_pp_utf32:
+.LVL130:
+.LFB549:
+	.loc 1 255 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 256 5 view .LVU452
+	.loc 1 255 1 is_stmt 0 view .LVU453
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 256 20 view .LVU454
+	leaq	va_char32_p_read_vtab_utf32(%rip), %rax
+	.loc 1 255 1 view .LVU455
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 256 20 view .LVU456
+	movq	%rax, (%rsp)
+	movq	(%rsi), %rax
+	.loc 1 257 11 view .LVU457
+	movq	%rsp, %rsi
+.LVL131:
+	.loc 1 256 20 view .LVU458
+	movq	%rax, 8(%rsp)
+	.loc 1 257 5 is_stmt 1 view .LVU459
+	.loc 1 257 11 is_stmt 0 view .LVU460
+	call	va_xprintf_iter@PLT
+.LVL132:
+	.loc 1 258 5 is_stmt 1 view .LVU461
+	.loc 1 258 8 is_stmt 0 view .LVU462
+	movq	8(%rsp), %rax
+	movq	%rax, 0(%rbp)
+	.loc 1 259 5 is_stmt 1 view .LVU463
+	.loc 1 260 1 is_stmt 0 view .LVU464
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL133:
+	.loc 1 260 1 view .LVU465
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL134:
+	.loc 1 260 1 view .LVU466
+	ret
+	.cfi_endproc
+.LFE549:
+	.size	va_xprintf_char32_const_pp_utf32, .-va_xprintf_char32_const_pp_utf32
+	.globl	va_xprintf_char32_pp_utf32
+	.type	va_xprintf_char32_pp_utf32, @function
+va_xprintf_char32_pp_utf32:
+.LVL135:
+.LFB550:
+	.loc 1 265 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 266 5 view .LVU468
+	.loc 1 266 12 is_stmt 0 view .LVU469
+	jmp	va_xprintf_char32_const_pp_utf32
+.LVL136:
+	.loc 1 266 12 view .LVU470
+	.cfi_endproc
+.LFE550:
+	.size	va_xprintf_char32_pp_utf32, .-va_xprintf_char32_pp_utf32
+	.globl	va_xprintf_last_char32_p_utf32
+	.type	va_xprintf_last_char32_p_utf32, @function
+va_xprintf_last_char32_p_utf32:
+.LVL137:
+.LFB551:
+	.loc 1 272 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 273 5 view .LVU472
+	.loc 1 273 12 is_stmt 0 view .LVU473
+	orl	$64, 32(%rdi)
+	.loc 1 274 5 is_stmt 1 view .LVU474
+	.loc 1 274 12 is_stmt 0 view .LVU475
+	jmp	va_xprintf_char32_p_utf32
+.LVL138:
+	.loc 1 274 12 view .LVU476
+	.cfi_endproc
+.LFE551:
+	.size	va_xprintf_last_char32_p_utf32, .-va_xprintf_last_char32_p_utf32
+	.globl	va_xprintf_last_char32_const_pp_utf32
+	.type	va_xprintf_last_char32_const_pp_utf32, @function
+va_xprintf_last_char32_const_pp_utf32:
+.LVL139:
+.LFB552:
+	.loc 1 280 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 281 5 view .LVU478
+	.loc 1 281 12 is_stmt 0 view .LVU479
+	orl	$64, 32(%rdi)
+	.loc 1 282 5 is_stmt 1 view .LVU480
+	.loc 1 282 12 is_stmt 0 view .LVU481
+	jmp	va_xprintf_char32_const_pp_utf32
+.LVL140:
+	.loc 1 282 12 view .LVU482
+	.cfi_endproc
+.LFE552:
+	.size	va_xprintf_last_char32_const_pp_utf32, .-va_xprintf_last_char32_const_pp_utf32
+	.globl	va_xprintf_last_char32_pp_utf32
+	.type	va_xprintf_last_char32_pp_utf32, @function
+va_xprintf_last_char32_pp_utf32:
+.LFB559:
+	.cfi_startproc
+	.loc 1 285 21 is_stmt 1 view .LVU483
+	jmp	va_xprintf_last_char32_const_pp_utf32
+	.cfi_endproc
+.LFE559:
+	.size	va_xprintf_last_char32_pp_utf32, .-va_xprintf_last_char32_pp_utf32
+	.globl	va_xprintf_span32_p_utf32
+	.type	va_xprintf_span32_p_utf32, @function
+va_xprintf_span32_p_utf32:
+.LVL141:
+.LFB555:
+	.loc 1 308 1 view -0
+	.cfi_startproc
+	.loc 1 309 5 view .LVU485
+	.loc 1 308 1 is_stmt 0 view .LVU486
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 309 24 view .LVU487
+	leaq	va_span32_p_read_vtab_utf32(%rip), %rax
+	.loc 1 311 24 view .LVU488
+	movq	(%rsi), %rdx
+	.loc 1 309 24 view .LVU489
+	movq	%rax, (%rsp)
+	.loc 1 310 70 view .LVU490
+	movq	8(%rsi), %rax
+	.loc 1 313 12 view .LVU491
+	movq	%rsp, %rsi
+.LVL142:
+	.loc 1 309 24 view .LVU492
+	movq	%rax, 8(%rsp)
+	.loc 1 311 24 view .LVU493
+	leaq	(%rax,%rdx,4), %rax
+	movq	%rax, 16(%rsp)
+	.loc 1 313 5 is_stmt 1 view .LVU494
+	.loc 1 313 12 is_stmt 0 view .LVU495
+	call	va_xprintf_iter_local@PLT
+.LVL143:
+	.loc 1 314 1 view .LVU496
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE555:
+	.size	va_xprintf_span32_p_utf32, .-va_xprintf_span32_p_utf32
+	.globl	va_xprintf_last_span32_p_utf32
+	.type	va_xprintf_last_span32_p_utf32, @function
+va_xprintf_last_span32_p_utf32:
+.LVL144:
+.LFB556:
+	.loc 1 319 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 320 5 view .LVU498
+	.loc 1 320 12 is_stmt 0 view .LVU499
+	orl	$64, 32(%rdi)
+	.loc 1 321 5 is_stmt 1 view .LVU500
+	.loc 1 321 12 is_stmt 0 view .LVU501
+	jmp	va_xprintf_span32_p_utf32
+.LVL145:
+	.loc 1 321 12 view .LVU502
+	.cfi_endproc
+.LFE556:
+	.size	va_xprintf_last_span32_p_utf32, .-va_xprintf_last_span32_p_utf32
+	.section	.rodata
+	.align 16
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 23
+__PRETTY_FUNCTION__.0:
+	.string	"va_span32_p_take_utf32"
+	.align 16
+	.type	__PRETTY_FUNCTION__.1, @object
+	.size	__PRETTY_FUNCTION__.1, 23
+__PRETTY_FUNCTION__.1:
+	.string	"va_char32_p_take_utf32"
+	.globl	va_span32_p_read_vtab_utf32
+	.section	.rodata.str1.1
+.LC7:
+	.string	"char32_t*"
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	va_span32_p_read_vtab_utf32, @object
+	.size	va_span32_p_read_vtab_utf32, 56
+va_span32_p_read_vtab_utf32:
+	.quad	.LC7
+	.quad	va_span32_p_take_utf32
+	.quad	va_char32_p_end
+	.quad	0
+	.quad	va_span32_p_bulk_utf32
+	.quad	va_char32_p_transcode_utf32
+	.byte	1
+	.byte	0
+	.byte	85
+	.byte	3
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_char32_p_read_vtab_utf32
+	.align 32
+	.type	va_char32_p_read_vtab_utf32, @object
+	.size	va_char32_p_read_vtab_utf32, 56
+va_char32_p_read_vtab_utf32:
+	.quad	.LC7
+	.quad	va_char32_p_take_utf32
+	.quad	va_char32_p_end
+	.quad	0
+	.quad	va_char32_p_bulk_utf32
+	.quad	va_char32_p_transcode_utf32
+	.byte	0
+	.byte	0
+	.byte	85
+	.byte	3
+	.string	""
+	.string	""
+	.zero	2
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC2:
+	.quad	-545460846720
+	.quad	-545460846720
+	.align 16
+.LC3:
+	.quad	-281470681808896
+	.quad	-281470681808896
+	.align 16
+.LC4:
+	.long	-32768
+	.long	-32768
+	.long	-32768
+	.long	-32768
+	.align 16
+.LC5:
+	.value	-32768
+	.value	-32768
+	.value	-32768
+	.value	-32768
+	.value	-32768
+	.value	-32768
+	.value	-32768
+	.value	-32768
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/uchar.h"
+	.file 7 "./include/va_print/base.h"
+	.file 8 "./include/va_print/utf32.h"
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mmintrin.h"
+	.file 10 "./include/va_print/core.h"
+	.file 11 "/usr/include/assert.h"
+	.file 12 "./include/va_print/char.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1bc6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x3b
+	.long	.LASF1208
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1078
+	.uleb128 0x7
+	.long	.LASF1087
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x45
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1079
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1080
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1081
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1082
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1084
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1085
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1086
+	.uleb128 0x7
+	.long	.LASF1088
+	.byte	0x5
+	.byte	0x28
+	.byte	0x1c
+	.long	0x68
+	.uleb128 0x7
+	.long	.LASF1089
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6f
+	.uleb128 0x7
+	.long	.LASF1090
+	.byte	0x5
+	.byte	0x37
+	.byte	0x14
+	.long	0x84
+	.uleb128 0x7
+	.long	.LASF1091
+	.byte	0x5
+	.byte	0x39
+	.byte	0x14
+	.long	0x90
+	.uleb128 0x3d
+	.byte	0x8
+	.uleb128 0x1
+	.long	0xbb
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1092
+	.uleb128 0xc
+	.long	0xbb
+	.uleb128 0x1b
+	.long	0xbb
+	.long	0xd7
+	.uleb128 0x1c
+	.long	0x45
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1093
+	.byte	0x6
+	.byte	0x33
+	.byte	0x1a
+	.long	0x9c
+	.uleb128 0x7
+	.long	.LASF1094
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.long	0xa8
+	.uleb128 0xc
+	.long	0xe3
+	.uleb128 0x28
+	.byte	0x38
+	.byte	0x7
+	.byte	0xc1
+	.long	0x18c
+	.uleb128 0x10
+	.long	.LASF1095
+	.byte	0x7
+	.byte	0xc4
+	.byte	0x11
+	.long	0x18c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1096
+	.byte	0x7
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1e5
+	.byte	0x8
+	.uleb128 0x22
+	.string	"end"
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1fe
+	.byte	0x10
+	.uleb128 0x10
+	.long	.LASF1097
+	.byte	0x7
+	.byte	0xdb
+	.byte	0xc
+	.long	0x20e
+	.byte	0x18
+	.uleb128 0x10
+	.long	.LASF1098
+	.byte	0x7
+	.byte	0xe2
+	.byte	0xe
+	.long	0x23b
+	.byte	0x20
+	.uleb128 0x10
+	.long	.LASF1099
+	.byte	0x7
+	.byte	0xec
+	.byte	0xe
+	.long	0x25e
+	.byte	0x28
+	.uleb128 0x10
+	.long	.LASF1100
+	.byte	0x7
+	.byte	0xf1
+	.byte	0x13
+	.long	0x61
+	.byte	0x30
+	.uleb128 0x10
+	.long	.LASF1101
+	.byte	0x7
+	.byte	0xf5
+	.byte	0x13
+	.long	0x61
+	.byte	0x31
+	.uleb128 0x10
+	.long	.LASF1102
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x61
+	.byte	0x32
+	.uleb128 0x22
+	.string	"enc"
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x13
+	.long	0x61
+	.byte	0x33
+	.uleb128 0x10
+	.long	.LASF1103
+	.byte	0x7
+	.byte	0xff
+	.byte	0xa
+	.long	0xc7
+	.byte	0x34
+	.byte	0
+	.uleb128 0x1
+	.long	0xc2
+	.uleb128 0xc
+	.long	0x18c
+	.uleb128 0x17
+	.long	0x6f
+	.long	0x1aa
+	.uleb128 0x4
+	.long	0x1aa
+	.uleb128 0x4
+	.long	0x1df
+	.byte	0
+	.uleb128 0x1
+	.long	0x1af
+	.uleb128 0x23
+	.long	.LASF1110
+	.byte	0x10
+	.byte	0x7
+	.value	0x132
+	.byte	0x10
+	.long	0x1da
+	.uleb128 0x6
+	.long	.LASF1104
+	.byte	0x7
+	.value	0x135
+	.byte	0x20
+	.long	0x275
+	.byte	0
+	.uleb128 0x11
+	.string	"cur"
+	.byte	0x7
+	.value	0x138
+	.byte	0x11
+	.long	0x1df
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	0x1af
+	.uleb128 0x1
+	.long	0x1e4
+	.uleb128 0x3e
+	.uleb128 0x1
+	.long	0x196
+	.uleb128 0x17
+	.long	0x1df
+	.long	0x1fe
+	.uleb128 0x4
+	.long	0x1aa
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x1
+	.long	0x1ea
+	.uleb128 0x1d
+	.long	0x20e
+	.uleb128 0x4
+	.long	0x1aa
+	.byte	0
+	.uleb128 0x1
+	.long	0x203
+	.uleb128 0x17
+	.long	0x39
+	.long	0x231
+	.uleb128 0x4
+	.long	0x231
+	.uleb128 0x4
+	.long	0x1df
+	.uleb128 0x4
+	.long	0x39
+	.uleb128 0x4
+	.long	0x236
+	.byte	0
+	.uleb128 0x1
+	.long	0x1da
+	.uleb128 0x1
+	.long	0x39
+	.uleb128 0x1
+	.long	0x213
+	.uleb128 0x17
+	.long	0x39
+	.long	0x25e
+	.uleb128 0x4
+	.long	0xb4
+	.uleb128 0x4
+	.long	0x61
+	.uleb128 0x4
+	.long	0x1df
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x1
+	.long	0x240
+	.uleb128 0x12
+	.long	.LASF1105
+	.byte	0x7
+	.value	0x100
+	.byte	0x3
+	.long	0xf4
+	.uleb128 0xc
+	.long	0x263
+	.uleb128 0x1
+	.long	0x270
+	.uleb128 0x12
+	.long	.LASF1106
+	.byte	0x7
+	.value	0x139
+	.byte	0x3
+	.long	0x1af
+	.uleb128 0xc
+	.long	0x27a
+	.uleb128 0x29
+	.byte	0x18
+	.value	0x13f
+	.long	0x2b1
+	.uleb128 0x6
+	.long	.LASF1107
+	.byte	0x7
+	.value	0x140
+	.byte	0x14
+	.long	0x27a
+	.byte	0
+	.uleb128 0x11
+	.string	"end"
+	.byte	0x7
+	.value	0x141
+	.byte	0x11
+	.long	0x1df
+	.byte	0x10
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1108
+	.byte	0x7
+	.value	0x142
+	.byte	0x3
+	.long	0x28c
+	.uleb128 0xc
+	.long	0x2b1
+	.uleb128 0x12
+	.long	.LASF1109
+	.byte	0x7
+	.value	0x169
+	.byte	0x1a
+	.long	0x2d5
+	.uleb128 0xc
+	.long	0x2c3
+	.uleb128 0x23
+	.long	.LASF1111
+	.byte	0x40
+	.byte	0x7
+	.value	0x1b7
+	.byte	0x8
+	.long	0x354
+	.uleb128 0x6
+	.long	.LASF1104
+	.byte	0x7
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x4c7
+	.byte	0
+	.uleb128 0x11
+	.string	"pat"
+	.byte	0x7
+	.value	0x1b9
+	.byte	0x14
+	.long	0x27a
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1112
+	.byte	0x7
+	.value	0x1ba
+	.byte	0xe
+	.long	0x6f
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1113
+	.byte	0x7
+	.value	0x1bb
+	.byte	0xe
+	.long	0x6f
+	.byte	0x1c
+	.uleb128 0x11
+	.string	"opt"
+	.byte	0x7
+	.value	0x1bc
+	.byte	0xe
+	.long	0x6f
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1114
+	.byte	0x7
+	.value	0x1bd
+	.byte	0xe
+	.long	0x6f
+	.byte	0x24
+	.uleb128 0x11
+	.string	"win"
+	.byte	0x7
+	.value	0x1be
+	.byte	0x11
+	.long	0x4ba
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1115
+	.byte	0x7
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x4cc
+	.byte	0x38
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1116
+	.byte	0x7
+	.value	0x16c
+	.byte	0x1e
+	.long	0x366
+	.uleb128 0xc
+	.long	0x354
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x40
+	.byte	0x2
+	.value	0x14f
+	.byte	0x8
+	.long	0x381
+	.uleb128 0x11
+	.string	"q"
+	.byte	0x2
+	.value	0x150
+	.byte	0x1b
+	.long	0x627
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.byte	0x38
+	.value	0x174
+	.long	0x3fa
+	.uleb128 0x6
+	.long	.LASF1118
+	.byte	0x7
+	.value	0x176
+	.byte	0xc
+	.long	0x40a
+	.byte	0
+	.uleb128 0x11
+	.string	"put"
+	.byte	0x7
+	.value	0x178
+	.byte	0xc
+	.long	0x41f
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1119
+	.byte	0x7
+	.value	0x17b
+	.byte	0xc
+	.long	0x40a
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1120
+	.byte	0x7
+	.value	0x182
+	.byte	0xb
+	.long	0x43f
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1121
+	.byte	0x7
+	.value	0x186
+	.byte	0xc
+	.long	0x459
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1122
+	.byte	0x7
+	.value	0x18c
+	.byte	0xc
+	.long	0x46e
+	.byte	0x28
+	.uleb128 0x11
+	.string	"enc"
+	.byte	0x7
+	.value	0x191
+	.byte	0x13
+	.long	0x61
+	.byte	0x30
+	.uleb128 0x6
+	.long	.LASF1103
+	.byte	0x7
+	.value	0x192
+	.byte	0xa
+	.long	0x473
+	.byte	0x31
+	.byte	0
+	.uleb128 0x1d
+	.long	0x405
+	.uleb128 0x4
+	.long	0x405
+	.byte	0
+	.uleb128 0x1
+	.long	0x2c3
+	.uleb128 0x1
+	.long	0x3fa
+	.uleb128 0x1d
+	.long	0x41f
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x6f
+	.byte	0
+	.uleb128 0x1
+	.long	0x40f
+	.uleb128 0x17
+	.long	0x438
+	.long	0x438
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1123
+	.uleb128 0x1
+	.long	0x424
+	.uleb128 0x1d
+	.long	0x459
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x6f
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x1
+	.long	0x444
+	.uleb128 0x1d
+	.long	0x46e
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x1
+	.long	0x45e
+	.uleb128 0x1b
+	.long	0xbb
+	.long	0x483
+	.uleb128 0x1c
+	.long	0x45
+	.byte	0x6
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1124
+	.byte	0x7
+	.value	0x193
+	.byte	0x3
+	.long	0x381
+	.uleb128 0xc
+	.long	0x483
+	.uleb128 0x29
+	.byte	0x10
+	.value	0x19a
+	.long	0x4ba
+	.uleb128 0x11
+	.string	"cur"
+	.byte	0x7
+	.value	0x19b
+	.byte	0xb
+	.long	0xb4
+	.byte	0
+	.uleb128 0x11
+	.string	"end"
+	.byte	0x7
+	.value	0x19c
+	.byte	0xb
+	.long	0xb4
+	.byte	0x8
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1125
+	.byte	0x7
+	.value	0x19d
+	.byte	0x3
+	.long	0x495
+	.uleb128 0x1
+	.long	0x490
+	.uleb128 0x1
+	.long	0x361
+	.uleb128 0x23
+	.long	.LASF1126
+	.byte	0x10
+	.byte	0x7
+	.value	0x1f3
+	.byte	0x10
+	.long	0x4fc
+	.uleb128 0x6
+	.long	.LASF1127
+	.byte	0x7
+	.value	0x1f4
+	.byte	0xc
+	.long	0x39
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1128
+	.byte	0x7
+	.value	0x1f5
+	.byte	0x15
+	.long	0x4fc
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1
+	.long	0xef
+	.uleb128 0x12
+	.long	.LASF1129
+	.byte	0x7
+	.value	0x1f6
+	.byte	0x3
+	.long	0x4d1
+	.uleb128 0xc
+	.long	0x501
+	.uleb128 0x32
+	.long	.LASF1130
+	.byte	0x18
+	.long	0x270
+	.uleb128 0x32
+	.long	.LASF1131
+	.byte	0x1a
+	.long	0x270
+	.uleb128 0x28
+	.byte	0x88
+	.byte	0x2
+	.byte	0xc9
+	.long	0x54a
+	.uleb128 0x22
+	.string	"cls"
+	.byte	0x2
+	.byte	0xce
+	.byte	0x13
+	.long	0x54a
+	.byte	0
+	.uleb128 0x22
+	.string	"esc"
+	.byte	0x2
+	.byte	0xd5
+	.byte	0x18
+	.long	0x55a
+	.byte	0x80
+	.byte	0
+	.uleb128 0x1b
+	.long	0x61
+	.long	0x55a
+	.uleb128 0x1c
+	.long	0x45
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x1
+	.long	0x191
+	.uleb128 0x7
+	.long	.LASF1132
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x3
+	.long	0x527
+	.uleb128 0xc
+	.long	0x55f
+	.uleb128 0x28
+	.byte	0x38
+	.byte	0x2
+	.byte	0xe0
+	.long	0x5cc
+	.uleb128 0x10
+	.long	.LASF1133
+	.byte	0x2
+	.byte	0xef
+	.byte	0x18
+	.long	0x5cc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1134
+	.byte	0x2
+	.value	0x101
+	.byte	0xb
+	.long	0x5f7
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF1135
+	.byte	0x2
+	.value	0x10e
+	.byte	0xb
+	.long	0x60b
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1136
+	.byte	0x2
+	.value	0x12a
+	.byte	0xc
+	.long	0x41f
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1137
+	.byte	0x2
+	.value	0x131
+	.byte	0xc
+	.long	0x40a
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF1138
+	.byte	0x2
+	.value	0x141
+	.byte	0x21
+	.long	0x610
+	.byte	0x30
+	.byte	0
+	.uleb128 0x1b
+	.long	0x5dc
+	.long	0x5dc
+	.uleb128 0x1c
+	.long	0x45
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1139
+	.uleb128 0x17
+	.long	0x438
+	.long	0x5f7
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x6f
+	.byte	0
+	.uleb128 0x1
+	.long	0x5e3
+	.uleb128 0x17
+	.long	0x438
+	.long	0x60b
+	.uleb128 0x4
+	.long	0x405
+	.byte	0
+	.uleb128 0x1
+	.long	0x5fc
+	.uleb128 0x1
+	.long	0x56b
+	.uleb128 0x12
+	.long	.LASF1140
+	.byte	0x2
+	.value	0x142
+	.byte	0x3
+	.long	0x570
+	.uleb128 0xc
+	.long	0x615
+	.uleb128 0x1b
+	.long	0x637
+	.long	0x637
+	.uleb128 0x1c
+	.long	0x45
+	.byte	0x7
+	.byte	0
+	.uleb128 0x1
+	.long	0x622
+	.uleb128 0x7
+	.long	.LASF1141
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xd
+	.long	0x648
+	.uleb128 0x13
+	.long	0x4c
+	.long	0x654
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1152
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.long	0x648
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1142
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1143
+	.uleb128 0x7
+	.long	.LASF1144
+	.byte	0x3
+	.byte	0x29
+	.byte	0x13
+	.long	0x67a
+	.uleb128 0x13
+	.long	0x53
+	.long	0x686
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1145
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x692
+	.uleb128 0x13
+	.long	0x5dc
+	.long	0x69e
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1146
+	.byte	0x3
+	.byte	0x2b
+	.byte	0xd
+	.long	0x6aa
+	.uleb128 0x13
+	.long	0x4c
+	.long	0x6b6
+	.uleb128 0x14
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1147
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x16
+	.long	0x6c2
+	.uleb128 0x13
+	.long	0x6f
+	.long	0x6ce
+	.uleb128 0x14
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1148
+	.byte	0x3
+	.byte	0x2d
+	.byte	0xf
+	.long	0x6da
+	.uleb128 0x13
+	.long	0x7d
+	.long	0x6e6
+	.uleb128 0x14
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1149
+	.byte	0x3
+	.byte	0x2e
+	.byte	0x18
+	.long	0x6f2
+	.uleb128 0x13
+	.long	0x68
+	.long	0x6fe
+	.uleb128 0x14
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1150
+	.byte	0x3
+	.byte	0x2f
+	.byte	0xe
+	.long	0x70a
+	.uleb128 0x13
+	.long	0xbb
+	.long	0x716
+	.uleb128 0x14
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1151
+	.byte	0x3
+	.byte	0x35
+	.byte	0x13
+	.long	0x722
+	.uleb128 0x13
+	.long	0x53
+	.long	0x72e
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF1153
+	.byte	0x3
+	.byte	0x39
+	.byte	0x13
+	.long	0x722
+	.uleb128 0xc
+	.long	0x72e
+	.uleb128 0x34
+	.long	0x513
+	.byte	0x12
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_char32_p_read_vtab_utf32
+	.uleb128 0x34
+	.long	0x51d
+	.byte	0x20
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_span32_p_read_vtab_utf32
+	.uleb128 0x2a
+	.long	.LASF1154
+	.byte	0xa
+	.value	0x110
+	.byte	0x15
+	.long	0x405
+	.long	0x77b
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x77b
+	.byte	0
+	.uleb128 0x1
+	.long	0x27a
+	.uleb128 0x2a
+	.long	.LASF1155
+	.byte	0xa
+	.value	0x112
+	.byte	0x15
+	.long	0x405
+	.long	0x79c
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x77b
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF1156
+	.byte	0xb
+	.byte	0x45
+	.byte	0xd
+	.long	0x7bd
+	.uleb128 0x4
+	.long	0x18c
+	.uleb128 0x4
+	.long	0x18c
+	.uleb128 0x4
+	.long	0x6f
+	.uleb128 0x4
+	.long	0x18c
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1157
+	.byte	0xc
+	.value	0x123
+	.byte	0x14
+	.long	0x1df
+	.long	0x7d9
+	.uleb128 0x4
+	.long	0x77b
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1158
+	.value	0x13c
+	.long	0x405
+	.quad	.LFB556
+	.quad	.LFE556-.LFB556
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x83b
+	.uleb128 0x15
+	.string	"s"
+	.value	0x13d
+	.byte	0x12
+	.long	0x405
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x15
+	.string	"x"
+	.value	0x13e
+	.byte	0x18
+	.long	0x83b
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x1f
+	.quad	.LVL145
+	.long	0x840
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1
+	.long	0x50e
+	.uleb128 0x24
+	.long	.LASF1159
+	.value	0x131
+	.long	0x405
+	.quad	.LFB555
+	.quad	.LFE555-.LFB555
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8b0
+	.uleb128 0x15
+	.string	"s"
+	.value	0x132
+	.byte	0x12
+	.long	0x405
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x15
+	.string	"x"
+	.value	0x133
+	.byte	0x18
+	.long	0x83b
+	.long	.LLST114
+	.long	.LVUS114
+	.uleb128 0x35
+	.long	.LASF1162
+	.value	0x135
+	.byte	0x18
+	.long	0x2b1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x20
+	.quad	.LVL143
+	.long	0x780
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1160
+	.value	0x125
+	.byte	0x11
+	.long	0x6f
+	.long	0x939
+	.uleb128 0xe
+	.long	.LASF1161
+	.byte	0x1
+	.value	0x126
+	.byte	0x15
+	.long	0x77b
+	.uleb128 0x3
+	.string	"end"
+	.byte	0x1
+	.value	0x127
+	.byte	0x11
+	.long	0x1df
+	.uleb128 0x37
+	.long	.LASF1176
+	.long	0x949
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0x2b
+	.long	.LASF1162
+	.byte	0x19
+	.long	0x94e
+	.uleb128 0x2c
+	.uleb128 0x2b
+	.long	.LASF1163
+	.byte	0x3d
+	.long	0x77b
+	.uleb128 0x12
+	.long	.LASF1164
+	.byte	0x1
+	.value	0x12a
+	.byte	0x6c
+	.long	0x2b1
+	.uleb128 0x2d
+	.string	"r_"
+	.byte	0x1
+	.value	0x12a
+	.byte	0x7a
+	.long	0x91b
+	.uleb128 0x1
+	.long	0x902
+	.uleb128 0x2d
+	.string	"r2_"
+	.byte	0x1
+	.value	0x12a
+	.byte	0x2d
+	.long	0x91b
+	.uleb128 0x2b
+	.long	.LASF1165
+	.byte	0x99
+	.long	0x77b
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	0xc2
+	.long	0x949
+	.uleb128 0x1c
+	.long	0x45
+	.byte	0x16
+	.byte	0
+	.uleb128 0xc
+	.long	0x939
+	.uleb128 0x1
+	.long	0x2b1
+	.uleb128 0x40
+	.long	.LASF1209
+	.byte	0x1
+	.value	0x11d
+	.byte	0x15
+	.long	0x405
+	.long	0x97b
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x1
+	.value	0x11e
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x3
+	.string	"x"
+	.byte	0x1
+	.value	0x11f
+	.byte	0x10
+	.long	0x97b
+	.byte	0
+	.uleb128 0x1
+	.long	0x980
+	.uleb128 0x1
+	.long	0xe3
+	.uleb128 0x24
+	.long	.LASF1166
+	.value	0x115
+	.long	0x405
+	.quad	.LFB552
+	.quad	.LFE552-.LFB552
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9e7
+	.uleb128 0x15
+	.string	"s"
+	.value	0x116
+	.byte	0x12
+	.long	0x405
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0x15
+	.string	"x"
+	.value	0x117
+	.byte	0x16
+	.long	0x9e7
+	.long	.LLST112
+	.long	.LVUS112
+	.uleb128 0x1f
+	.quad	.LVL140
+	.long	0xa75
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x1
+	.long	0x4fc
+	.uleb128 0x24
+	.long	.LASF1167
+	.value	0x10d
+	.long	0x405
+	.quad	.LFB551
+	.quad	.LFE551-.LFB551
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa4e
+	.uleb128 0x15
+	.string	"s"
+	.value	0x10e
+	.byte	0x12
+	.long	0x405
+	.long	.LLST109
+	.long	.LVUS109
+	.uleb128 0x15
+	.string	"x"
+	.value	0x10f
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x1f
+	.quad	.LVL138
+	.long	0xae2
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF1168
+	.value	0x106
+	.byte	0x15
+	.long	0x405
+	.long	0xa75
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x1
+	.value	0x107
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x3
+	.string	"x"
+	.byte	0x1
+	.value	0x108
+	.byte	0x10
+	.long	0x97b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1169
+	.byte	0xfc
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB549
+	.quad	.LFE549-.LFB549
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xae2
+	.uleb128 0x9
+	.string	"s"
+	.byte	0xfd
+	.byte	0x12
+	.long	0x405
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x9
+	.string	"x"
+	.byte	0xfe
+	.byte	0x16
+	.long	0x9e7
+	.long	.LLST106
+	.long	.LVUS106
+	.uleb128 0x35
+	.long	.LASF1162
+	.value	0x100
+	.byte	0x14
+	.long	0x27a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x20
+	.quad	.LVL132
+	.long	0x75f
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1170
+	.byte	0xf4
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB548
+	.quad	.LFE548-.LFB548
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb50
+	.uleb128 0x9
+	.string	"s"
+	.byte	0xf5
+	.byte	0x12
+	.long	0x405
+	.long	.LLST103
+	.long	.LVUS103
+	.uleb128 0x9
+	.string	"x"
+	.byte	0xf6
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST104
+	.long	.LVUS104
+	.uleb128 0x41
+	.long	.LASF1162
+	.byte	0x1
+	.byte	0xf8
+	.byte	0x14
+	.long	0x27a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x20
+	.quad	.LVL129
+	.long	0x780
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1171
+	.byte	0xe9
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB547
+	.quad	.LFE547-.LFB547
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc18
+	.uleb128 0x25
+	.string	"s"
+	.byte	0xea
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x25
+	.string	"c"
+	.byte	0xeb
+	.byte	0xe
+	.long	0x6f
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x21
+	.long	0x1a8b
+	.quad	.LBI299
+	.byte	.LVU425
+	.quad	.LBB299
+	.quad	.LBE299-.LBB299
+	.byte	0xee
+	.byte	0x25
+	.long	0xbb9
+	.uleb128 0x2
+	.long	0x1a9b
+	.long	.LLST99
+	.long	.LVUS99
+	.byte	0
+	.uleb128 0x19
+	.long	0x1a52
+	.quad	.LBI301
+	.byte	.LVU430
+	.quad	.LBB301
+	.quad	.LBE301-.LBB301
+	.byte	0xef
+	.byte	0x9
+	.uleb128 0x2
+	.long	0x1a6b
+	.long	.LLST100
+	.long	.LVUS100
+	.uleb128 0x2
+	.long	0x1a60
+	.long	.LLST101
+	.long	.LVUS101
+	.uleb128 0x2e
+	.long	0x1a76
+	.quad	.LBB303
+	.quad	.LBE303-.LBB303
+	.uleb128 0x1e
+	.long	0x1a77
+	.long	.LLST102
+	.long	.LVUS102
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.long	.LASF1210
+	.byte	0x1
+	.byte	0xca
+	.byte	0xd
+	.quad	.LFB546
+	.quad	.LFE546-.LFB546
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdb5
+	.uleb128 0x9
+	.string	"s"
+	.byte	0xcb
+	.byte	0x12
+	.long	0x405
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x9
+	.string	"c"
+	.byte	0xcc
+	.byte	0xe
+	.long	0x6f
+	.long	.LLST87
+	.long	.LVUS87
+	.uleb128 0x9
+	.string	"put"
+	.byte	0xcd
+	.byte	0xc
+	.long	0xdc5
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x43
+	.long	.LASF1211
+	.byte	0x1
+	.byte	0xdf
+	.byte	0x1
+	.quad	.L72
+	.uleb128 0x2f
+	.quad	.LBB298
+	.quad	.LBE298-.LBB298
+	.long	0xca2
+	.uleb128 0xa
+	.string	"w"
+	.byte	0xe1
+	.byte	0x13
+	.long	0x980
+	.long	.LLST98
+	.long	.LVUS98
+	.byte	0
+	.uleb128 0x21
+	.long	0x1a8b
+	.quad	.LBI285
+	.byte	.LVU374
+	.quad	.LBB285
+	.quad	.LBE285-.LBB285
+	.byte	0xda
+	.byte	0xa
+	.long	0xcd4
+	.uleb128 0x2
+	.long	0x1a9b
+	.long	.LLST89
+	.long	.LVUS89
+	.byte	0
+	.uleb128 0xb
+	.long	0x1a52
+	.quad	.LBI287
+	.byte	.LVU379
+	.long	.LLRL90
+	.byte	0xdb
+	.byte	0x9
+	.long	0xd2a
+	.uleb128 0x2
+	.long	0x1a6b
+	.long	.LLST91
+	.long	.LVUS91
+	.uleb128 0x2
+	.long	0x1a60
+	.long	.LLST92
+	.long	.LVUS92
+	.uleb128 0x2e
+	.long	0x1a76
+	.quad	.LBB289
+	.quad	.LBE289-.LBB289
+	.uleb128 0x1e
+	.long	0x1a77
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1984
+	.quad	.LBI292
+	.byte	.LVU392
+	.long	.LLRL94
+	.byte	0xe0
+	.byte	0x9
+	.long	0xda7
+	.uleb128 0x2
+	.long	0x199f
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0x2
+	.long	0x1994
+	.long	.LLST96
+	.long	.LVUS96
+	.uleb128 0x44
+	.long	0x19ab
+	.quad	.LBI294
+	.byte	.LVU394
+	.quad	.LBB294
+	.quad	.LBE294-.LBB294
+	.byte	0x2
+	.value	0x24b
+	.byte	0x9
+	.long	0xd90
+	.uleb128 0x2
+	.long	0x19bb
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x45
+	.quad	.LVL116
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x34
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.quad	.LVL115
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+	.uleb128 0x1d
+	.long	0xdc5
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	0xdb5
+	.uleb128 0x18
+	.long	.LASF1172
+	.byte	0x8b
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB545
+	.quad	.LFE545-.LFB545
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13f6
+	.uleb128 0x9
+	.string	"dst"
+	.byte	0x8c
+	.byte	0xb
+	.long	0xb4
+	.long	.LLST17
+	.long	.LVUS17
+	.uleb128 0x9
+	.string	"enc"
+	.byte	0x8d
+	.byte	0x13
+	.long	0x61
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x9
+	.string	"src"
+	.byte	0x8e
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x8f
+	.byte	0xc
+	.long	0x39
+	.long	.LLST20
+	.long	.LVUS20
+	.uleb128 0xa
+	.string	"p"
+	.byte	0x91
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST21
+	.long	.LVUS21
+	.uleb128 0xa
+	.string	"e"
+	.byte	0x92
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x26
+	.long	.LLRL32
+	.long	0x108f
+	.uleb128 0xa
+	.string	"w"
+	.byte	0x98
+	.byte	0xf
+	.long	0xb6
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x26
+	.long	.LLRL34
+	.long	0x1053
+	.uleb128 0xa
+	.string	"v0"
+	.byte	0x9d
+	.byte	0x19
+	.long	0x716
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0xa
+	.string	"v1"
+	.byte	0x9e
+	.byte	0x19
+	.long	0x716
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x16
+	.string	"a"
+	.byte	0x9f
+	.byte	0x19
+	.long	0x716
+	.uleb128 0x2f
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.long	0xf73
+	.uleb128 0xa
+	.string	"v"
+	.byte	0xa1
+	.byte	0x1d
+	.long	0x716
+	.long	.LLST47
+	.long	.LVUS47
+	.uleb128 0x21
+	.long	0x17e3
+	.quad	.LBI211
+	.byte	.LVU170
+	.quad	.LBB211
+	.quad	.LBE211-.LBB211
+	.byte	0xa1
+	.byte	0x21
+	.long	0xf0c
+	.uleb128 0x2
+	.long	0x17ff
+	.long	.LLST48
+	.long	.LVUS48
+	.uleb128 0x2
+	.long	0x17f2
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0xb
+	.long	0x17b9
+	.quad	.LBI213
+	.byte	.LVU175
+	.long	.LLRL50
+	.byte	0xa2
+	.byte	0x15
+	.long	0xf3f
+	.uleb128 0x2
+	.long	0x17d5
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x2
+	.long	0x17c8
+	.long	.LLST51
+	.long	.LVUS51
+	.byte	0
+	.uleb128 0x19
+	.long	0x181b
+	.quad	.LBI217
+	.byte	.LVU181
+	.quad	.LBB217
+	.quad	.LBE217-.LBB217
+	.byte	0xa2
+	.byte	0x15
+	.uleb128 0x2
+	.long	0x1833
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x8
+	.long	0x1826
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x173b
+	.quad	.LBI182
+	.byte	.LVU152
+	.long	.LLRL37
+	.byte	0x9f
+	.byte	0x1d
+	.long	0xf96
+	.uleb128 0x8
+	.long	0x1757
+	.uleb128 0x8
+	.long	0x174a
+	.byte	0
+	.uleb128 0xb
+	.long	0x16e7
+	.quad	.LBI186
+	.byte	.LVU156
+	.long	.LLRL38
+	.byte	0xa0
+	.byte	0x15
+	.long	0xfb9
+	.uleb128 0x8
+	.long	0x1703
+	.uleb128 0x8
+	.long	0x16f6
+	.byte	0
+	.uleb128 0xb
+	.long	0x186c
+	.quad	.LBI190
+	.byte	.LVU140
+	.long	.LLRL39
+	.byte	0x9d
+	.byte	0x1e
+	.long	0xfdf
+	.uleb128 0x2
+	.long	0x187b
+	.long	.LLST40
+	.long	.LVUS40
+	.byte	0
+	.uleb128 0xb
+	.long	0x186c
+	.quad	.LBI193
+	.byte	.LVU145
+	.long	.LLRL41
+	.byte	0x9e
+	.byte	0x1e
+	.long	0x1005
+	.uleb128 0x2
+	.long	0x187b
+	.long	.LLST42
+	.long	.LVUS42
+	.byte	0
+	.uleb128 0xb
+	.long	0x1711
+	.quad	.LBI198
+	.byte	.LVU149
+	.long	.LLRL43
+	.byte	0x9f
+	.byte	0x1d
+	.long	0x1038
+	.uleb128 0x2
+	.long	0x172d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x2
+	.long	0x1720
+	.long	.LLST45
+	.long	.LVUS45
+	.byte	0
+	.uleb128 0x27
+	.long	0x16ca
+	.quad	.LBI203
+	.byte	.LVU159
+	.long	.LLRL46
+	.byte	0xa0
+	.byte	0x15
+	.uleb128 0x8
+	.long	0x16d9
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x1a2b
+	.quad	.LBI221
+	.byte	.LVU192
+	.quad	.LBB221
+	.quad	.LBE221-.LBB221
+	.byte	0xa9
+	.byte	0x11
+	.uleb128 0x2
+	.long	0x1a46
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x2
+	.long	0x1a3b
+	.long	.LLST55
+	.long	.LVUS55
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LLRL56
+	.long	0x1306
+	.uleb128 0xa
+	.string	"w"
+	.byte	0xaf
+	.byte	0x13
+	.long	0x13f6
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x26
+	.long	.LLRL58
+	.long	0x12ca
+	.uleb128 0xa
+	.string	"v0"
+	.byte	0xb5
+	.byte	0x19
+	.long	0x716
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0xa
+	.string	"v1"
+	.byte	0xb6
+	.byte	0x19
+	.long	0x716
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x16
+	.string	"a"
+	.byte	0xb7
+	.byte	0x19
+	.long	0x716
+	.uleb128 0x2f
+	.quad	.LBB250
+	.quad	.LBE250-.LBB250
+	.long	0x11d2
+	.uleb128 0x16
+	.string	"b"
+	.byte	0xb9
+	.byte	0x1d
+	.long	0x716
+	.uleb128 0xa
+	.string	"v"
+	.byte	0xba
+	.byte	0x1d
+	.long	0x716
+	.long	.LLST69
+	.long	.LVUS69
+	.uleb128 0xb
+	.long	0x1765
+	.quad	.LBI251
+	.byte	.LVU283
+	.long	.LLRL70
+	.byte	0xba
+	.byte	0x21
+	.long	0x1139
+	.uleb128 0x8
+	.long	0x1781
+	.uleb128 0x2
+	.long	0x1774
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.uleb128 0xb
+	.long	0x1765
+	.quad	.LBI254
+	.byte	.LVU286
+	.long	.LLRL72
+	.byte	0xba
+	.byte	0x21
+	.long	0x1164
+	.uleb128 0x8
+	.long	0x1781
+	.uleb128 0x2
+	.long	0x1774
+	.long	.LLST73
+	.long	.LVUS73
+	.byte	0
+	.uleb128 0xb
+	.long	0x17e3
+	.quad	.LBI258
+	.byte	.LVU289
+	.long	.LLRL74
+	.byte	0xba
+	.byte	0x21
+	.long	0x1187
+	.uleb128 0x8
+	.long	0x17ff
+	.uleb128 0x8
+	.long	0x17f2
+	.byte	0
+	.uleb128 0xb
+	.long	0x178f
+	.quad	.LBI265
+	.byte	.LVU300
+	.long	.LLRL75
+	.byte	0xbb
+	.byte	0x15
+	.long	0x11b2
+	.uleb128 0x8
+	.long	0x17ab
+	.uleb128 0x2
+	.long	0x179e
+	.long	.LLST76
+	.long	.LVUS76
+	.byte	0
+	.uleb128 0x27
+	.long	0x1846
+	.quad	.LBI268
+	.byte	.LVU303
+	.long	.LLRL77
+	.byte	0xbb
+	.byte	0x15
+	.uleb128 0x8
+	.long	0x185e
+	.uleb128 0x8
+	.long	0x1851
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x173b
+	.quad	.LBI226
+	.byte	.LVU264
+	.long	.LLRL61
+	.byte	0xb7
+	.byte	0x1d
+	.long	0x11f5
+	.uleb128 0x8
+	.long	0x1757
+	.uleb128 0x8
+	.long	0x174a
+	.byte	0
+	.uleb128 0xb
+	.long	0x16e7
+	.quad	.LBI230
+	.byte	.LVU268
+	.long	.LLRL62
+	.byte	0xb8
+	.byte	0x15
+	.long	0x1218
+	.uleb128 0x8
+	.long	0x1703
+	.uleb128 0x8
+	.long	0x16f6
+	.byte	0
+	.uleb128 0x21
+	.long	0x186c
+	.quad	.LBI234
+	.byte	.LVU251
+	.quad	.LBB234
+	.quad	.LBE234-.LBB234
+	.byte	0xb5
+	.byte	0x1e
+	.long	0x124a
+	.uleb128 0x2
+	.long	0x187b
+	.long	.LLST63
+	.long	.LVUS63
+	.byte	0
+	.uleb128 0x21
+	.long	0x186c
+	.quad	.LBI236
+	.byte	.LVU256
+	.quad	.LBB236
+	.quad	.LBE236-.LBB236
+	.byte	0xb6
+	.byte	0x1e
+	.long	0x127c
+	.uleb128 0x2
+	.long	0x187b
+	.long	.LLST64
+	.long	.LVUS64
+	.byte	0
+	.uleb128 0xb
+	.long	0x1711
+	.quad	.LBI238
+	.byte	.LVU261
+	.long	.LLRL65
+	.byte	0xb7
+	.byte	0x1d
+	.long	0x12af
+	.uleb128 0x2
+	.long	0x172d
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x2
+	.long	0x1720
+	.long	.LLST67
+	.long	.LVUS67
+	.byte	0
+	.uleb128 0x27
+	.long	0x16ca
+	.quad	.LBI243
+	.byte	.LVU271
+	.long	.LLRL68
+	.byte	0xb8
+	.byte	0x15
+	.uleb128 0x8
+	.long	0x16d9
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x1a04
+	.quad	.LBI275
+	.byte	.LVU316
+	.quad	.LBB275
+	.quad	.LBE275-.LBB275
+	.byte	0xc2
+	.byte	0x11
+	.uleb128 0x2
+	.long	0x1a1f
+	.long	.LLST78
+	.long	.LVUS78
+	.uleb128 0x2
+	.long	0x1a14
+	.long	.LLST79
+	.long	.LVUS79
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x13fb
+	.quad	.LBI170
+	.byte	.LVU93
+	.quad	.LBB170
+	.quad	.LBE170-.LBB170
+	.byte	0x94
+	.byte	0x10
+	.uleb128 0x2
+	.long	0x1420
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x2
+	.long	0x1417
+	.long	.LLST24
+	.long	.LVUS24
+	.uleb128 0x2
+	.long	0x140c
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x1e
+	.long	0x1429
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x47
+	.long	0x1432
+	.quad	.LBB172
+	.quad	.LBE172-.LBB172
+	.long	0x13a3
+	.uleb128 0x1e
+	.long	0x1437
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x27
+	.long	0x19e8
+	.quad	.LBI173
+	.byte	.LVU102
+	.long	.LLRL28
+	.byte	0x7e
+	.byte	0x12
+	.uleb128 0x2
+	.long	0x19f8
+	.long	.LLST29
+	.long	.LVUS29
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	0x1441
+	.quad	.LBB177
+	.quad	.LBE177-.LBB177
+	.uleb128 0x1e
+	.long	0x1442
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x19
+	.long	0x19cc
+	.quad	.LBI178
+	.byte	.LVU117
+	.quad	.LBB178
+	.quad	.LBE178-.LBB178
+	.byte	0x84
+	.byte	0x12
+	.uleb128 0x2
+	.long	0x19dc
+	.long	.LLST31
+	.long	.LVUS31
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1
+	.long	0xd7
+	.uleb128 0x48
+	.long	.LASF1200
+	.byte	0x1
+	.byte	0x75
+	.byte	0xf
+	.long	0x39
+	.byte	0x1
+	.long	0x144d
+	.uleb128 0x30
+	.string	"enc"
+	.byte	0x76
+	.byte	0x13
+	.long	0x61
+	.uleb128 0x30
+	.string	"p"
+	.byte	0x77
+	.byte	0x15
+	.long	0x4fc
+	.uleb128 0x30
+	.string	"n"
+	.byte	0x78
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x16
+	.string	"k"
+	.byte	0x7a
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x38
+	.long	0x1441
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x7d
+	.byte	0x15
+	.long	0x39
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x83
+	.byte	0x15
+	.long	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1173
+	.byte	0x65
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB543
+	.quad	.LFE543-.LFB543
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1518
+	.uleb128 0x31
+	.long	.LASF1161
+	.byte	0x66
+	.byte	0x1b
+	.long	0x1518
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0x9
+	.string	"end"
+	.byte	0x67
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST8
+	.long	.LVUS8
+	.uleb128 0x9
+	.string	"max"
+	.byte	0x68
+	.byte	0xc
+	.long	0x39
+	.long	.LLST9
+	.long	.LVUS9
+	.uleb128 0x25
+	.string	"cps"
+	.byte	0x69
+	.byte	0xd
+	.long	0x236
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x49
+	.long	.LASF1162
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x1f
+	.long	0x151d
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x38
+	.long	0x150a
+	.uleb128 0x39
+	.long	.LASF1163
+	.byte	0x6b
+	.byte	0x44
+	.long	0x1518
+	.uleb128 0x7
+	.long	.LASF1164
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x73
+	.long	0x2be
+	.uleb128 0x16
+	.string	"r_"
+	.byte	0x6b
+	.byte	0x81
+	.long	0x14ee
+	.uleb128 0x1
+	.long	0x14d8
+	.uleb128 0x16
+	.string	"r2_"
+	.byte	0x6b
+	.byte	0x34
+	.long	0x14ee
+	.uleb128 0x39
+	.long	.LASF1165
+	.byte	0x6b
+	.byte	0xa0
+	.long	0x1518
+	.byte	0
+	.uleb128 0x4a
+	.quad	.LVL9
+	.long	0x1522
+	.byte	0
+	.uleb128 0x1
+	.long	0x287
+	.uleb128 0x1
+	.long	0x2be
+	.uleb128 0x18
+	.long	.LASF1174
+	.byte	0x51
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB542
+	.quad	.LFE542-.LFB542
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15eb
+	.uleb128 0x31
+	.long	.LASF1162
+	.byte	0x52
+	.byte	0x1b
+	.long	0x1518
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x9
+	.string	"end"
+	.byte	0x53
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x9
+	.string	"max"
+	.byte	0x54
+	.byte	0xc
+	.long	0x39
+	.long	.LLST2
+	.long	.LVUS2
+	.uleb128 0x25
+	.string	"cps"
+	.byte	0x55
+	.byte	0xd
+	.long	0x236
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0xa
+	.string	"p"
+	.byte	0x57
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0xa
+	.string	"n"
+	.byte	0x58
+	.byte	0xc
+	.long	0x39
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0xa
+	.string	"i"
+	.byte	0x5d
+	.byte	0xc
+	.long	0x39
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x19
+	.long	0x1a8b
+	.quad	.LBI106
+	.byte	.LVU14
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.byte	0x5e
+	.byte	0x26
+	.uleb128 0x2
+	.long	0x1a9b
+	.long	.LLST6
+	.long	.LVUS6
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1175
+	.byte	0x31
+	.byte	0x11
+	.long	0x6f
+	.quad	.LFB541
+	.quad	.LFE541-.LFB541
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16ca
+	.uleb128 0x31
+	.long	.LASF1162
+	.byte	0x32
+	.byte	0x15
+	.long	0x77b
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x9
+	.string	"end"
+	.byte	0x33
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST12
+	.long	.LVUS12
+	.uleb128 0x37
+	.long	.LASF1176
+	.long	0x949
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.uleb128 0xa
+	.string	"s"
+	.byte	0x39
+	.byte	0x15
+	.long	0x4fc
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0xa
+	.string	"c0"
+	.byte	0x3a
+	.byte	0xe
+	.long	0x6f
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.long	0x1a8b
+	.quad	.LBI108
+	.byte	.LVU64
+	.long	.LLRL15
+	.byte	0x43
+	.byte	0x9
+	.long	0x168e
+	.uleb128 0x2
+	.long	0x1a9b
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x20
+	.quad	.LVL13
+	.long	0x79c
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC1
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x35
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1177
+	.value	0x597
+	.long	0x4c
+	.long	0x16e7
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x597
+	.byte	0x1c
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1178
+	.value	0x541
+	.long	0x716
+	.long	0x1711
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x541
+	.byte	0x1a
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x541
+	.byte	0x27
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1179
+	.value	0x529
+	.long	0x716
+	.long	0x173b
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x529
+	.byte	0x17
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x529
+	.byte	0x24
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1180
+	.value	0x51d
+	.long	0x716
+	.long	0x1765
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x51d
+	.byte	0x18
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x51d
+	.byte	0x25
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1181
+	.value	0x458
+	.long	0x716
+	.long	0x178f
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x458
+	.byte	0x18
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x458
+	.byte	0x25
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1182
+	.value	0x422
+	.long	0x716
+	.long	0x17b9
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x422
+	.byte	0x18
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x422
+	.byte	0x25
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1183
+	.value	0x3e6
+	.long	0x716
+	.long	0x17e3
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x3e6
+	.byte	0x1b
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x3e6
+	.byte	0x28
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1184
+	.value	0x3e0
+	.long	0x716
+	.long	0x180d
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x3e0
+	.byte	0x1a
+	.long	0x716
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x3e0
+	.byte	0x27
+	.long	0x716
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF1212
+	.byte	0x3
+	.value	0x31a
+	.byte	0x1
+	.long	0x716
+	.byte	0x3
+	.uleb128 0x3a
+	.long	.LASF1185
+	.value	0x2e7
+	.long	0x1841
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x3
+	.value	0x2e7
+	.byte	0x1e
+	.long	0x1841
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x2e7
+	.byte	0x2b
+	.long	0x716
+	.byte	0
+	.uleb128 0x1
+	.long	0x72e
+	.uleb128 0x3a
+	.long	.LASF1186
+	.value	0x2e1
+	.long	0x186c
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x3
+	.value	0x2e1
+	.byte	0x1e
+	.long	0x1841
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x3
+	.value	0x2e1
+	.byte	0x2b
+	.long	0x716
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1187
+	.value	0x2bd
+	.long	0x716
+	.long	0x1889
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x3
+	.value	0x2bd
+	.byte	0x23
+	.long	0x1889
+	.byte	0
+	.uleb128 0x1
+	.long	0x73a
+	.uleb128 0xf
+	.long	.LASF1188
+	.value	0x288
+	.long	0x716
+	.long	0x18ab
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x288
+	.byte	0x17
+	.long	0x7d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1189
+	.value	0x282
+	.long	0x716
+	.long	0x18c8
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x282
+	.byte	0x15
+	.long	0x4c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1190
+	.value	0x260
+	.long	0x716
+	.long	0x1940
+	.uleb128 0xe
+	.long	.LASF1191
+	.byte	0x3
+	.value	0x260
+	.byte	0x16
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1192
+	.byte	0x3
+	.value	0x260
+	.byte	0x22
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1193
+	.byte	0x3
+	.value	0x260
+	.byte	0x2e
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1194
+	.byte	0x3
+	.value	0x260
+	.byte	0x3a
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1195
+	.byte	0x3
+	.value	0x261
+	.byte	0xf
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1196
+	.byte	0x3
+	.value	0x261
+	.byte	0x1b
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1197
+	.byte	0x3
+	.value	0x261
+	.byte	0x27
+	.long	0x7d
+	.uleb128 0xe
+	.long	.LASF1198
+	.byte	0x3
+	.value	0x261
+	.byte	0x33
+	.long	0x7d
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1199
+	.value	0x25a
+	.long	0x716
+	.long	0x1984
+	.uleb128 0xe
+	.long	.LASF1195
+	.byte	0x3
+	.value	0x25a
+	.byte	0x14
+	.long	0x4c
+	.uleb128 0xe
+	.long	.LASF1196
+	.byte	0x3
+	.value	0x25a
+	.byte	0x1e
+	.long	0x4c
+	.uleb128 0xe
+	.long	.LASF1197
+	.byte	0x3
+	.value	0x25a
+	.byte	0x28
+	.long	0x4c
+	.uleb128 0xe
+	.long	.LASF1198
+	.byte	0x3
+	.value	0x25a
+	.byte	0x32
+	.long	0x4c
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1201
+	.value	0x249
+	.byte	0x13
+	.long	0x438
+	.long	0x19ab
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x2
+	.value	0x249
+	.byte	0x32
+	.long	0x405
+	.uleb128 0x3
+	.string	"n"
+	.byte	0x2
+	.value	0x249
+	.byte	0x3c
+	.long	0x39
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1202
+	.value	0x23e
+	.byte	0x16
+	.long	0x39
+	.long	0x19c7
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x2
+	.value	0x23e
+	.byte	0x38
+	.long	0x19c7
+	.byte	0
+	.uleb128 0x1
+	.long	0x2d0
+	.uleb128 0x1a
+	.long	.LASF1203
+	.value	0x223
+	.byte	0x16
+	.long	0x39
+	.long	0x19e8
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x2
+	.value	0x223
+	.byte	0x2e
+	.long	0x6f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1204
+	.value	0x21a
+	.byte	0x16
+	.long	0x39
+	.long	0x1a04
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x2
+	.value	0x21a
+	.byte	0x2d
+	.long	0x6f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1205
+	.value	0x1de
+	.byte	0x19
+	.long	0x13f6
+	.long	0x1a2b
+	.uleb128 0x3
+	.string	"w"
+	.byte	0x2
+	.value	0x1de
+	.byte	0x32
+	.long	0x13f6
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x2
+	.value	0x1de
+	.byte	0x3e
+	.long	0x6f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1206
+	.value	0x1c3
+	.byte	0x15
+	.long	0xb6
+	.long	0x1a52
+	.uleb128 0x3
+	.string	"w"
+	.byte	0x2
+	.value	0x1c3
+	.byte	0x29
+	.long	0xb6
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x2
+	.value	0x1c3
+	.byte	0x35
+	.long	0x6f
+	.byte	0
+	.uleb128 0x4c
+	.long	.LASF1213
+	.byte	0x2
+	.value	0x1a9
+	.byte	0x14
+	.byte	0x3
+	.long	0x1a86
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x2
+	.value	0x1a9
+	.byte	0x35
+	.long	0x405
+	.uleb128 0x3
+	.string	"e"
+	.byte	0x2
+	.value	0x1a9
+	.byte	0x41
+	.long	0x6f
+	.uleb128 0x2c
+	.uleb128 0x2d
+	.string	"_xp"
+	.byte	0x2
+	.value	0x1ac
+	.byte	0x2d
+	.long	0x1a86
+	.byte	0
+	.byte	0
+	.uleb128 0x1
+	.long	0x6f
+	.uleb128 0x1a
+	.long	.LASF1207
+	.value	0x1a3
+	.byte	0x13
+	.long	0x438
+	.long	0x1aa7
+	.uleb128 0x3
+	.string	"c"
+	.byte	0x2
+	.value	0x1a3
+	.byte	0x27
+	.long	0x6f
+	.byte	0
+	.uleb128 0x4d
+	.long	0x8b0
+	.quad	.LFB554
+	.quad	.LFE554-.LFB554
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b7b
+	.uleb128 0x2
+	.long	0x8c0
+	.long	.LLST80
+	.long	.LVUS80
+	.uleb128 0x2
+	.long	0x8cd
+	.long	.LLST81
+	.long	.LVUS81
+	.uleb128 0x1e
+	.long	0x8ed
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x4e
+	.long	0x8b0
+	.quad	.LBI281
+	.byte	.LVU344
+	.long	.LLRL83
+	.byte	0x1
+	.value	0x125
+	.byte	0x11
+	.long	0x1b65
+	.uleb128 0x2
+	.long	0x8c0
+	.long	.LLST84
+	.long	.LVUS84
+	.uleb128 0x2
+	.long	0x8cd
+	.long	.LLST85
+	.long	.LVUS85
+	.uleb128 0x4f
+	.long	.LLRL83
+	.uleb128 0x50
+	.long	0x8ed
+	.uleb128 0x20
+	.quad	.LVL104
+	.long	0x79c
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC6
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x129
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.quad	.LVL105
+	.long	0x15eb
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.long	0xa4e
+	.quad	.LFB550
+	.quad	.LFE550-.LFB550
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	0xa5e
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x2
+	.long	0xa69
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x1f
+	.quad	.LVL136
+	.long	0xa75
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 298
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 34
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0xb
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS115:
+	.uleb128 0
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 0
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 0
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL145-1-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU496
+	.uleb128 .LVU496
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL143-1-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS114:
+	.uleb128 0
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 0
+.LLST114:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS111:
+	.uleb128 0
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 0
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 .LFE552-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 0
+	.uleb128 .LVU482
+	.uleb128 .LVU482
+	.uleb128 0
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL140-1-.Ltext0
+	.uleb128 .LFE552-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS109:
+	.uleb128 0
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 0
+.LLST109:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE551-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS110:
+	.uleb128 0
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 0
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL138-1-.Ltext0
+	.uleb128 .LFE551-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS105:
+	.uleb128 0
+	.uleb128 .LVU461
+	.uleb128 .LVU461
+	.uleb128 .LVU465
+	.uleb128 .LVU465
+	.uleb128 0
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL132-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL132-1-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS106:
+	.uleb128 0
+	.uleb128 .LVU458
+	.uleb128 .LVU458
+	.uleb128 .LVU466
+	.uleb128 .LVU466
+	.uleb128 0
+.LLST106:
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LFE549-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS103:
+	.uleb128 0
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 0
+.LLST103:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 .LFE548-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS104:
+	.uleb128 0
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU450
+	.uleb128 .LVU450
+	.uleb128 0
+.LLST104:
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL129-1-.Ltext0
+	.uleb128 .LFE548-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS99:
+	.uleb128 .LVU425
+	.uleb128 .LVU427
+.LLST99:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU430
+	.uleb128 .LVU439
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS101:
+	.uleb128 .LVU430
+	.uleb128 .LVU439
+.LLST101:
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS102:
+	.uleb128 .LVU436
+	.uleb128 .LVU439
+.LLST102:
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 0
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU410
+	.uleb128 .LVU410
+	.uleb128 0
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0x4
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS87:
+	.uleb128 0
+	.uleb128 .LVU390
+	.uleb128 .LVU390
+	.uleb128 .LVU406
+	.uleb128 .LVU406
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU420
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS88:
+	.uleb128 0
+	.uleb128 .LVU401
+	.uleb128 .LVU401
+	.uleb128 .LVU407
+	.uleb128 .LVU407
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU408
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU421
+	.uleb128 .LVU421
+	.uleb128 0
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-1-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU413
+	.uleb128 .LVU414
+	.uleb128 .LVU414
+	.uleb128 .LVU417
+	.uleb128 .LVU417
+	.uleb128 0
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU374
+	.uleb128 .LVU376
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU379
+	.uleb128 .LVU383
+	.uleb128 .LVU385
+	.uleb128 .LVU390
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS92:
+	.uleb128 .LVU379
+	.uleb128 .LVU383
+	.uleb128 .LVU385
+	.uleb128 .LVU390
+.LLST92:
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU387
+	.uleb128 .LVU390
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU392
+	.uleb128 .LVU401
+	.uleb128 .LVU408
+	.uleb128 .LVU410
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS96:
+	.uleb128 .LVU392
+	.uleb128 .LVU401
+	.uleb128 .LVU408
+	.uleb128 .LVU409
+	.uleb128 .LVU409
+	.uleb128 .LVU410
+.LLST96:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL116-1-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU394
+	.uleb128 .LVU396
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS17:
+	.uleb128 0
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 0
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS18:
+	.uleb128 0
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU128
+	.uleb128 .LVU128
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 0
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS20:
+	.uleb128 0
+	.uleb128 .LVU134
+	.uleb128 .LVU134
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU245
+	.uleb128 .LVU245
+	.uleb128 0
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS21:
+	.uleb128 .LVU88
+	.uleb128 .LVU186
+	.uleb128 .LVU186
+	.uleb128 .LVU188
+	.uleb128 .LVU188
+	.uleb128 .LVU191
+	.uleb128 .LVU191
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU310
+	.uleb128 .LVU310
+	.uleb128 .LVU312
+	.uleb128 .LVU312
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU336
+	.uleb128 .LVU336
+	.uleb128 0
+.LLST21:
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL73-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU90
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU114
+	.uleb128 .LVU114
+	.uleb128 0
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LFE545-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU134
+	.uleb128 .LVU179
+	.uleb128 .LVU179
+	.uleb128 .LVU187
+	.uleb128 .LVU187
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU199
+	.uleb128 .LVU199
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU227
+	.uleb128 .LVU227
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU240
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -8
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU143
+	.uleb128 .LVU173
+	.uleb128 .LVU173
+	.uleb128 .LVU184
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU147
+	.uleb128 .LVU188
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU173
+	.uleb128 .LVU180
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS48:
+	.uleb128 .LVU170
+	.uleb128 .LVU173
+.LLST48:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU170
+	.uleb128 .LVU173
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS51:
+	.uleb128 .LVU175
+	.uleb128 .LVU180
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS53:
+	.uleb128 .LVU180
+	.uleb128 .LVU184
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU140
+	.uleb128 .LVU143
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS42:
+	.uleb128 .LVU145
+	.uleb128 .LVU147
+.LLST42:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS45:
+	.uleb128 .LVU149
+	.uleb128 .LVU151
+.LLST45:
+	.byte	0x4
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS54:
+	.uleb128 .LVU192
+	.uleb128 .LVU229
+	.uleb128 .LVU229
+	.uleb128 .LVU231
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL68-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x2
+	.byte	0x79
+	.sleb128 -4
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU192
+	.uleb128 .LVU196
+	.uleb128 .LVU196
+	.uleb128 .LVU198
+	.uleb128 .LVU198
+	.uleb128 .LVU207
+	.uleb128 .LVU207
+	.uleb128 .LVU210
+	.uleb128 .LVU210
+	.uleb128 .LVU212
+	.uleb128 .LVU213
+	.uleb128 .LVU220
+	.uleb128 .LVU220
+	.uleb128 .LVU223
+	.uleb128 .LVU223
+	.uleb128 .LVU225
+	.uleb128 .LVU227
+	.uleb128 .LVU228
+	.uleb128 .LVU228
+	.uleb128 .LVU232
+	.uleb128 .LVU232
+	.uleb128 .LVU237
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL64-.Ltext0
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 .LVL71-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0
+.LVUS57:
+	.uleb128 .LVU245
+	.uleb128 .LVU294
+	.uleb128 .LVU294
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU332
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL74-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS59:
+	.uleb128 .LVU254
+	.uleb128 .LVU295
+	.uleb128 .LVU295
+	.uleb128 .LVU308
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU259
+	.uleb128 .LVU296
+	.uleb128 .LVU296
+	.uleb128 .LVU308
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 16
+	.byte	0
+.LVUS69:
+	.uleb128 .LVU298
+	.uleb128 .LVU306
+.LLST69:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU283
+	.uleb128 .LVU285
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS73:
+	.uleb128 .LVU285
+	.uleb128 .LVU288
+.LLST73:
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU300
+	.uleb128 .LVU302
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU251
+	.uleb128 .LVU254
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS64:
+	.uleb128 .LVU256
+	.uleb128 .LVU259
+.LLST64:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 16
+	.byte	0x9f
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU261
+	.uleb128 .LVU263
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS67:
+	.uleb128 .LVU261
+	.uleb128 .LVU263
+.LLST67:
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU316
+	.uleb128 .LVU325
+	.uleb128 .LVU325
+	.uleb128 .LVU326
+	.uleb128 .LVU326
+	.uleb128 .LVU329
+	.uleb128 .LVU332
+	.uleb128 .LVU335
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL93-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 0x9
+	.byte	0x74
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x4
+	.byte	0x40
+	.byte	0x3c
+	.byte	0x24
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS79:
+	.uleb128 .LVU316
+	.uleb128 .LVU322
+	.uleb128 .LVU322
+	.uleb128 .LVU323
+	.uleb128 .LVU323
+	.uleb128 .LVU331
+	.uleb128 .LVU332
+	.uleb128 .LVU333
+	.uleb128 .LVU333
+	.uleb128 .LVU335
+.LLST79:
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL97-.Ltext0
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU93
+	.uleb128 .LVU128
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU93
+	.uleb128 .LVU128
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS25:
+	.uleb128 .LVU93
+	.uleb128 .LVU96
+	.uleb128 .LVU96
+	.uleb128 .LVU97
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU98
+	.uleb128 .LVU128
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL32-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 .LVU95
+	.uleb128 .LVU99
+	.uleb128 .LVU99
+	.uleb128 .LVU127
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS27:
+	.uleb128 .LVU99
+	.uleb128 .LVU108
+	.uleb128 .LVU108
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU114
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU102
+	.uleb128 .LVU104
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU114
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU128
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x3
+	.byte	0x74
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL42-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU117
+	.uleb128 .LVU119
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x7
+	.byte	0x74
+	.sleb128 0
+	.byte	0x32
+	.byte	0x24
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0
+.LVUS7:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 0
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE543-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS8:
+	.uleb128 0
+	.uleb128 .LVU37
+	.uleb128 .LVU37
+	.uleb128 .LVU39
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS9:
+	.uleb128 0
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 0
+.LLST9:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE543-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU34
+	.uleb128 .LVU39
+	.uleb128 .LVU39
+	.uleb128 0
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-1-.Ltext0
+	.uleb128 .LFE543-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU3
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU7
+	.uleb128 .LVU7
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 0
+	.uleb128 .LVU8
+	.uleb128 .LVU8
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS3:
+	.uleb128 .LVU3
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS4:
+	.uleb128 .LVU4
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU9
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 0
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU14
+	.uleb128 .LVU16
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS11:
+	.uleb128 0
+	.uleb128 .LVU48
+	.uleb128 .LVU48
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE541-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS12:
+	.uleb128 0
+	.uleb128 .LVU47
+	.uleb128 .LVU47
+	.uleb128 .LVU49
+	.uleb128 .LVU49
+	.uleb128 0
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL11-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LFE541-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU53
+	.uleb128 .LVU62
+	.uleb128 .LVU62
+	.uleb128 .LVU63
+	.uleb128 .LVU63
+	.uleb128 .LVU67
+	.uleb128 .LVU67
+	.uleb128 .LVU70
+	.uleb128 .LVU70
+	.uleb128 .LVU71
+	.uleb128 .LVU71
+	.uleb128 .LVU75
+	.uleb128 .LVU75
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL19-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x6
+	.byte	0x75
+	.sleb128 8
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU55
+	.uleb128 .LVU81
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU82
+	.uleb128 .LVU83
+	.uleb128 .LVU83
+	.uleb128 .LVU84
+	.uleb128 .LVU84
+	.uleb128 .LVU85
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x5
+	.byte	0x71
+	.sleb128 55296
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x2
+	.byte	0x71
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU64
+	.uleb128 .LVU66
+	.uleb128 .LVU72
+	.uleb128 .LVU74
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS80:
+	.uleb128 0
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS81:
+	.uleb128 0
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU350
+	.uleb128 .LVU350
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST81:
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU359
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL105-1-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU345
+	.uleb128 .LVU349
+	.uleb128 .LVU349
+	.uleb128 .LVU350
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL103-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS85:
+	.uleb128 .LVU345
+	.uleb128 .LVU348
+	.uleb128 .LVU348
+	.uleb128 .LVU350
+.LLST85:
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS107:
+	.uleb128 0
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 0
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS108:
+	.uleb128 0
+	.uleb128 .LVU470
+	.uleb128 .LVU470
+	.uleb128 0
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL136-1-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL15:
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB111-.Ltext0
+	.uleb128 .LBE111-.Ltext0
+	.byte	0
+.LLRL28:
+	.byte	0x4
+	.uleb128 .LBB173-.Ltext0
+	.uleb128 .LBE173-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB176-.Ltext0
+	.uleb128 .LBE176-.Ltext0
+	.byte	0
+.LLRL32:
+	.byte	0x4
+	.uleb128 .LBB180-.Ltext0
+	.uleb128 .LBE180-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB223-.Ltext0
+	.uleb128 .LBE223-.Ltext0
+	.byte	0
+.LLRL34:
+	.byte	0x4
+	.uleb128 .LBB181-.Ltext0
+	.uleb128 .LBE181-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0
+.LLRL37:
+	.byte	0x4
+	.uleb128 .LBB182-.Ltext0
+	.uleb128 .LBE182-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB201-.Ltext0
+	.uleb128 .LBE201-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB207-.Ltext0
+	.uleb128 .LBE207-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB186-.Ltext0
+	.uleb128 .LBE186-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB202-.Ltext0
+	.uleb128 .LBE202-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB208-.Ltext0
+	.uleb128 .LBE208-.Ltext0
+	.byte	0
+.LLRL39:
+	.byte	0x4
+	.uleb128 .LBB190-.Ltext0
+	.uleb128 .LBE190-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB196-.Ltext0
+	.uleb128 .LBE196-.Ltext0
+	.byte	0
+.LLRL41:
+	.byte	0x4
+	.uleb128 .LBB193-.Ltext0
+	.uleb128 .LBE193-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB197-.Ltext0
+	.uleb128 .LBE197-.Ltext0
+	.byte	0
+.LLRL43:
+	.byte	0x4
+	.uleb128 .LBB198-.Ltext0
+	.uleb128 .LBE198-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB206-.Ltext0
+	.uleb128 .LBE206-.Ltext0
+	.byte	0
+.LLRL46:
+	.byte	0x4
+	.uleb128 .LBB203-.Ltext0
+	.uleb128 .LBE203-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB209-.Ltext0
+	.uleb128 .LBE209-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB213-.Ltext0
+	.uleb128 .LBE213-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0
+.LLRL56:
+	.byte	0x4
+	.uleb128 .LBB224-.Ltext0
+	.uleb128 .LBE224-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB277-.Ltext0
+	.uleb128 .LBE277-.Ltext0
+	.byte	0
+.LLRL58:
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB273-.Ltext0
+	.uleb128 .LBE273-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB274-.Ltext0
+	.uleb128 .LBE274-.Ltext0
+	.byte	0
+.LLRL61:
+	.byte	0x4
+	.uleb128 .LBB226-.Ltext0
+	.uleb128 .LBE226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB241-.Ltext0
+	.uleb128 .LBE241-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB247-.Ltext0
+	.uleb128 .LBE247-.Ltext0
+	.byte	0
+.LLRL62:
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB242-.Ltext0
+	.uleb128 .LBE242-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0
+.LLRL65:
+	.byte	0x4
+	.uleb128 .LBB238-.Ltext0
+	.uleb128 .LBE238-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB246-.Ltext0
+	.uleb128 .LBE246-.Ltext0
+	.byte	0
+.LLRL68:
+	.byte	0x4
+	.uleb128 .LBB243-.Ltext0
+	.uleb128 .LBE243-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB249-.Ltext0
+	.uleb128 .LBE249-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB251-.Ltext0
+	.uleb128 .LBE251-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB254-.Ltext0
+	.uleb128 .LBE254-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB261-.Ltext0
+	.uleb128 .LBE261-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB262-.Ltext0
+	.uleb128 .LBE262-.Ltext0
+	.byte	0
+.LLRL74:
+	.byte	0x4
+	.uleb128 .LBB258-.Ltext0
+	.uleb128 .LBE258-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB264-.Ltext0
+	.uleb128 .LBE264-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB265-.Ltext0
+	.uleb128 .LBE265-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB271-.Ltext0
+	.uleb128 .LBE271-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB268-.Ltext0
+	.uleb128 .LBE268-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB272-.Ltext0
+	.uleb128 .LBE272-.Ltext0
+	.byte	0
+.LLRL83:
+	.byte	0x4
+	.uleb128 .LBB281-.Ltext0
+	.uleb128 .LBE281-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB284-.Ltext0
+	.uleb128 .LBE284-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB287-.Ltext0
+	.uleb128 .LBE287-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB291-.Ltext0
+	.uleb128 .LBE291-.Ltext0
+	.byte	0
+.LLRL94:
+	.byte	0x4
+	.uleb128 .LBB292-.Ltext0
+	.uleb128 .LBE292-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB297-.Ltext0
+	.uleb128 .LBE297-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF442
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF497
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF570
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF602
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF603
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF604
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF497
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF672
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF673
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF674
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 27 "./include/va_print/utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF734
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 28 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF737
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF740
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "./include/va_print/char_utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF760
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF761
+	.file 30 "./include/va_print/char_utf16.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF763
+	.file 31 "./include/va_print/char_utf32.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF764
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF785
+	.file 32 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF804
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF805
+	.byte	0x4
+	.byte	0x4
+	.file 36 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/xmmintrin.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF882
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF883
+	.byte	0x4
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mm_malloc.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.file 39 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF787
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF886
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF922
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF570
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF964
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF965
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF966
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF967
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF611
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF968
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF969
+	.file 50 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF970
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF987
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1000
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1005
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1008
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1026
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1027
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1028
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1040
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1047
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x4
+	.file 67 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1052
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x524
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1077
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.3e0425629195acf083c9561151306b4d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF441
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF493
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF496
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF507
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF508
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF569
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF587
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF595
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.40.d34159d34f444de373121677553af6a7,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF601
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF609
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF627
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF669
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF671
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF733
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF736
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF739
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF759
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.char.h.34.e464ebba96a45be0746f2e47582a65f7,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF784
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF787
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF788
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF792
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF794
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF796
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF802
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF803
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.27.cd1557bd11ee28e696cbad9e723079c4,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF880
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF803
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF907
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF914
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF921
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF943
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF949
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF963
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF976
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF978
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF982
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF986
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1004
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1007
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1025
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1039
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1043
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1051
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.xmmintrin.h.78.59bb12a08107158c4936dd3dc3443849,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x516
+	.long	.LASF1076
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF828:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF1025:
+	.string	"__fsfilcnt_t_defined "
+.LASF495:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF917:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1087:
+	.string	"size_t"
+.LASF914:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF816:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF930:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1069:
+	.string	"_MM_ROUND_NEAREST 0x0000"
+.LASF991:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF937:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF843:
+	.string	"VA_MODE_X7 7"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF753:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF949:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1181:
+	.string	"_mm_sub_epi32"
+.LASF1074:
+	.string	"_MM_FLUSH_ZERO_ON 0x8000"
+.LASF458:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF557:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF994:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF728:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF864:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF470:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF965:
+	.string	"__clockid_t_defined 1"
+.LASF463:
+	.string	"__USE_ATFILE"
+.LASF532:
+	.string	"__flexarr []"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF660:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF818:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF737:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF755:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF503:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1003:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF862:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF726:
+	.string	"VA_E_OK 0"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF761:
+	.string	"va_char_p_encode utf8"
+.LASF833:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1132:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF756:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF721:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF440:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF889:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1165:
+	.string	"val2_"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF1060:
+	.string	"_MM_EXCEPT_INEXACT 0x0020"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF607:
+	.string	"true 1"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF736:
+	.string	"va_char_p_decode utf8"
+.LASF709:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF720:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF898:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1147:
+	.string	"__v4su"
+.LASF799:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF546:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF647:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF687:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF1013:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF672:
+	.string	"__STD_TYPE"
+.LASF597:
+	.string	"_ASSERT_H_DECLS "
+.LASF1001:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF1006:
+	.string	"____sigset_t_defined "
+.LASF519:
+	.string	"__P(args) args"
+.LASF969:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF752:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1034:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF401:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF716:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF877:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF640:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF724:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1176:
+	.string	"__PRETTY_FUNCTION__"
+.LASF778:
+	.string	"va_zprintf(...) va_gzprintf(char, __VA_ARGS__)"
+.LASF813:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF436:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1096:
+	.string	"take"
+.LASF879:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF939:
+	.string	"__f64x(x) x ##f64x"
+.LASF1095:
+	.string	"type"
+.LASF871:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF916:
+	.string	"__HAVE_FLOAT128 1"
+.LASF394:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF924:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1187:
+	.string	"_mm_loadu_si128"
+.LASF464:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF878:
+	.string	"VA_QCLASS_CALL 2"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF873:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF984:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF624:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF825:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF507:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF760:
+	.string	"VA_PRINT_CHAR_UTF8_H_ "
+.LASF972:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF534:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF405:
+	.string	"_T_SIZE "
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1119:
+	.string	"finish"
+.LASF682:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF880:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF980:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1200:
+	.string	"transcode_len"
+.LASF398:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF461:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF680:
+	.string	"VA_NIX "
+.LASF1107:
+	.string	"super"
+.LASF448:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF772:
+	.string	"va_sprintf(S,...) va_snprintf(S,va_countof(S),__VA_ARGS__)"
+.LASF683:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF603:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF437:
+	.string	"NULL"
+.LASF529:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1208:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF654:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF734:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF846:
+	.string	"VA_STATE_ARG 1"
+.LASF1163:
+	.string	"val_"
+.LASF590:
+	.string	"__stub_fchflags "
+.LASF695:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1023:
+	.string	"__blkcnt_t_defined "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF913:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF717:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF472:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF423:
+	.string	"_T_WCHAR "
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF457:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF556:
+	.string	"__always_inline"
+.LASF403:
+	.string	"_SYS_SIZE_T_H "
+.LASF982:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF971:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF468:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1030:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1212:
+	.string	"_mm_setzero_si128"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF505:
+	.string	"__GLIBC__ 2"
+.LASF931:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1078:
+	.string	"long int"
+.LASF497:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF801:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF985:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1005:
+	.string	"__sigset_t_defined 1"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF473:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF491:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF775:
+	.string	"va_unprintf(...) va_gnprintf(char16_t, __VA_ARGS__)"
+.LASF393:
+	.string	"_PTRDIFF_T_ "
+.LASF469:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1137:
+	.string	"render_flush"
+.LASF773:
+	.string	"va_gnprintf(Char,N,...) ((Char*)(va_xprintf( &VA_STREAM_CHAR_P((Char[N]){0}, N), __VA_ARGS__)->data))"
+.LASF1144:
+	.string	"__v2di"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF725:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF669:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF866:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF974:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1145:
+	.string	"__v2du"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1083:
+	.string	"short unsigned int"
+.LASF863:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF553:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF395:
+	.string	"___int_ptrdiff_t_h "
+.LASF412:
+	.string	"_SIZE_T_DECLARED "
+.LASF521:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF901:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF515:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF542:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF360:
+	.string	"__k8__ 1"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF935:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF596:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1109:
+	.string	"va_stream_t"
+.LASF732:
+	.string	"VA_E_ARGC 6"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF498:
+	.string	"__USE_MISC 1"
+.LASF651:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF948:
+	.string	"EXIT_SUCCESS 0"
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF502:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1040:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF512:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF782:
+	.string	"va_znprintf(...) va_gznprintf(char, __VA_ARGS__)"
+.LASF1085:
+	.string	"signed char"
+.LASF620:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF826:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF400:
+	.string	"__size_t__ "
+.LASF983:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF614:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF523:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF722:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF629:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF570:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1183:
+	.string	"_mm_packus_epi16"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF513:
+	.string	"__LEAF , __leaf__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF645:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF958:
+	.string	"__off_t_defined "
+.LASF1090:
+	.string	"__uint_least16_t"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF797:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF411:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF759:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF414:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF479:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF520:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF599:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1016:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1093:
+	.string	"char16_t"
+.LASF413:
+	.string	"__DEFINED_size_t "
+.LASF1185:
+	.string	"_mm_storel_epi64"
+.LASF1012:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF776:
+	.string	"va_Unprintf(...) va_gnprintf(char32_t, __VA_ARGS__)"
+.LASF751:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF1032:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1014:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF932:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF959:
+	.string	"__pid_t_defined "
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF635:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF854:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1123:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF564:
+	.string	"__restrict_arr __restrict"
+.LASF588:
+	.string	"__stub___compat_bdflush "
+.LASF1070:
+	.string	"_MM_ROUND_DOWN 0x2000"
+.LASF954:
+	.string	"__gid_t_defined "
+.LASF409:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1138:
+	.string	"table"
+.LASF746:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF805:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF851:
+	.string	"VA_QUOTE_NONE 0"
+.LASF656:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF465:
+	.string	"__USE_GNU"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1046:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF543:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF921:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF885:
+	.string	"__need_wchar_t "
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF875:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF792:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1077:
+	.string	"_MM_SHUFFLE2(fp1,fp0) (((fp1) << 1) | (fp0))"
+.LASF900:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF593:
+	.string	"__stub_setlogin "
+.LASF1026:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF611:
+	.string	"__need_size_t "
+.LASF884:
+	.string	"_MM_MALLOC_H_INCLUDED "
+.LASF617:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF576:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1056:
+	.string	"_MM_EXCEPT_DENORM 0x0002"
+.LASF561:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1153:
+	.string	"__m128i_u"
+.LASF1088:
+	.string	"__uint16_t"
+.LASF1161:
+	.string	"iter_super"
+.LASF455:
+	.string	"__USE_XOPEN2K"
+.LASF671:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF784:
+	.string	"va_Uznprintf(...) va_gznprintf(char32_t, __VA_ARGS__)"
+.LASF1203:
+	.string	"va_units_utf16"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF945:
+	.string	"__lldiv_t_defined 1"
+.LASF559:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF594:
+	.string	"__stub_sigreturn "
+.LASF821:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1042:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF488:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF771:
+	.string	"va_snprintf(S,N,...) VA_BLOCK_EXPR((__typeof__(*(S))*)(va_xprintf( &VA_STREAM_CHAR_P(S,N), __VA_ARGS__)->data))"
+.LASF783:
+	.string	"va_uznprintf(...) va_gznprintf(char16_t, __VA_ARGS__)"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1075:
+	.string	"_MM_FLUSH_ZERO_OFF 0x0000"
+.LASF1062:
+	.string	"_MM_MASK_INVALID 0x0080"
+.LASF815:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF1179:
+	.string	"_mm_or_si128"
+.LASF450:
+	.string	"__USE_POSIX199309"
+.LASF926:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF766:
+	.string	"va_char_p_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_vtab_,va_char32_p_encode))"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF941:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF940:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF713:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF1207:
+	.string	"va_u_valid"
+.LASF906:
+	.string	"__W_CONTINUED 0xffff"
+.LASF952:
+	.string	"__ino_t_defined "
+.LASF742:
+	.string	"va_char32_p_decode utf32"
+.LASF1174:
+	.string	"va_char32_p_bulk_utf32"
+.LASF506:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF454:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF471:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF675:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF1015:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF670:
+	.string	"_BITS_TIME64_H 1"
+.LASF1154:
+	.string	"va_xprintf_iter"
+.LASF1169:
+	.string	"va_xprintf_char32_const_pp_utf32"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF618:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1213:
+	.string	"va_stream_set_error"
+.LASF418:
+	.string	"__need_size_t"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF663:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF699:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF718:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF563:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1009:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF698:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF912:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1035:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF528:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF665:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF964:
+	.string	"__clock_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF800:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF817:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF845:
+	.string	"VA_STATE_INIT 0"
+.LASF691:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF735:
+	.string	"va_char_p_format utf8"
+.LASF606:
+	.string	"bool _Bool"
+.LASF1190:
+	.string	"_mm_set_epi16"
+.LASF1120:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1196:
+	.string	"__q2"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF426:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1133:
+	.string	"delim"
+.LASF1192:
+	.string	"__q6"
+.LASF700:
+	.string	"VA_REC0() VA_REC0B"
+.LASF744:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF793:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF541:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1045:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF674:
+	.string	"____mbstate_t_defined 1"
+.LASF535:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1116:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF823:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF644:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF992:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF794:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF438:
+	.string	"NULL ((void *)0)"
+.LASF743:
+	.string	"VA_SIGIL '~'"
+.LASF551:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1129:
+	.string	"va_span32_t"
+.LASF439:
+	.string	"__need_NULL"
+.LASF1111:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF867:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF489:
+	.string	"__USE_POSIX199506 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1066:
+	.string	"_MM_MASK_UNDERFLOW 0x0800"
+.LASF492:
+	.string	"_ATFILE_SOURCE"
+.LASF623:
+	.string	"__SLONG32_TYPE int"
+.LASF990:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1164:
+	.string	"_Type"
+.LASF929:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF788:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF694:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF822:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF956:
+	.string	"__nlink_t_defined "
+.LASF1124:
+	.string	"va_stream_vtab_t"
+.LASF496:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF897:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1011:
+	.string	"__NFDBITS"
+.LASF604:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF938:
+	.string	"__f32x(x) x ##f32x"
+.LASF476:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF727:
+	.string	"VA_E_NULL 1"
+.LASF767:
+	.string	"va_char_p_size_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_size_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_size_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_size_vtab_,va_char32_p_encode))"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1021:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF888:
+	.string	"WUNTRACED 2"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF626:
+	.string	"__U64_TYPE unsigned long int"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF646:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF730:
+	.string	"VA_E_TRUNC 4"
+.LASF1079:
+	.string	"long unsigned int"
+.LASF1033:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1199:
+	.string	"_mm_set_epi32"
+.LASF1188:
+	.string	"_mm_set1_epi16"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF729:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF482:
+	.string	"_POSIX_SOURCE"
+.LASF1089:
+	.string	"__uint32_t"
+.LASF480:
+	.string	"__USE_ISOC95 1"
+.LASF580:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF404:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1065:
+	.string	"_MM_MASK_OVERFLOW 0x0400"
+.LASF928:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1091:
+	.string	"__uint_least32_t"
+.LASF1172:
+	.string	"va_char32_p_transcode_utf32"
+.LASF533:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF997:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1010:
+	.string	"__suseconds_t_defined "
+.LASF1159:
+	.string	"va_xprintf_span32_p_utf32"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF814:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1186:
+	.string	"_mm_storeu_si128"
+.LASF803:
+	.string	"__need_NULL "
+.LASF443:
+	.string	"_FEATURES_H 1"
+.LASF1094:
+	.string	"char32_t"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1114:
+	.string	"qctxt"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF571:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1029:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF545:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF827:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF950:
+	.string	"_SYS_TYPES_H 1"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF628:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF763:
+	.string	"va_char16_p_encode utf16"
+.LASF996:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF942:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF979:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF511:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF676:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF481:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF390:
+	.string	"_T_PTRDIFF_ "
+.LASF811:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF830:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF1151:
+	.string	"__m128i"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF968:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF837:
+	.string	"VA_MODE_B32 1"
+.LASF386:
+	.string	"_STDDEF_H "
+.LASF960:
+	.string	"__id_t_defined "
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1097:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF664:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1189:
+	.string	"_mm_set1_epi32"
+.LASF911:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1000:
+	.string	"_SYS_SELECT_H 1"
+.LASF422:
+	.string	"_T_WCHAR_ "
+.LASF1171:
+	.string	"va_len_utf32"
+.LASF573:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF449:
+	.string	"__USE_POSIX2"
+.LASF754:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1047:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF525:
+	.string	"__END_DECLS "
+.LASF852:
+	.string	"VA_QUOTE_k 1"
+.LASF598:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF870:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF407:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF1211:
+	.string	"store"
+.LASF1080:
+	.string	"long long int"
+.LASF1210:
+	.string	"va_put_utf32"
+.LASF1051:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF731:
+	.string	"VA_E_FORMAT 5"
+.LASF693:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF419:
+	.string	"__wchar_t__ "
+.LASF1184:
+	.string	"_mm_packs_epi32"
+.LASF587:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1148:
+	.string	"__v8hi"
+.LASF1112:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF770:
+	.string	"VA_STREAM_CHAR_ARR(S) VA_STREAM_CHAR_P(S,va_countof(S))"
+.LASF434:
+	.string	"__DEFINED_wchar_t "
+.LASF1117:
+	.string	"va_quotations"
+.LASF1166:
+	.string	"va_xprintf_last_char32_const_pp_utf32"
+.LASF860:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF1167:
+	.string	"va_xprintf_last_char32_p_utf32"
+.LASF1149:
+	.string	"__v8hu"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF719:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF568:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF424:
+	.string	"__WCHAR_T "
+.LASF1143:
+	.string	"double"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF865:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF1061:
+	.string	"_MM_MASK_MASK 0x1f80"
+.LASF518:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF616:
+	.string	"__U32_TYPE unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF785:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF809:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF549:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF389:
+	.string	"_PTRDIFF_T "
+.LASF567:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1118:
+	.string	"init"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF509:
+	.string	"__PMT"
+.LASF1063:
+	.string	"_MM_MASK_DENORM 0x0100"
+.LASF686:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF995:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF920:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"VA_MODE_PTR 3"
+.LASF625:
+	.string	"__S64_TYPE long int"
+.LASF650:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1055:
+	.string	"_MM_EXCEPT_INVALID 0x0001"
+.LASF1100:
+	.string	"has_size"
+.LASF710:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF619:
+	.string	"__SQUAD_TYPE long int"
+.LASF689:
+	.string	"VA_P(X,...) X"
+.LASF890:
+	.string	"WEXITED 4"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF456:
+	.string	"__USE_XOPEN2KXSI"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF466:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF584:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF692:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF359:
+	.string	"__k8 1"
+.LASF579:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1052:
+	.string	"__COMPAR_FN_T "
+.LASF998:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF774:
+	.string	"va_nprintf(...) va_gnprintf(char, __VA_ARGS__)"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF903:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1084:
+	.string	"unsigned int"
+.LASF1048:
+	.string	"__have_pthread_attr_t 1"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1058:
+	.string	"_MM_EXCEPT_OVERFLOW 0x0008"
+.LASF750:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF1071:
+	.string	"_MM_ROUND_UP 0x4000"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF510:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF459:
+	.string	"__USE_LARGEFILE"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF605:
+	.string	"_STDBOOL_H "
+.LASF433:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF490:
+	.string	"__USE_XOPEN2K 1"
+.LASF478:
+	.string	"__USE_ISOC11 1"
+.LASF749:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF1108:
+	.string	"va_read_iter_end_t"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1041:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF444:
+	.string	"__USE_ISOC11"
+.LASF391:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF540:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF702:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF544:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1050:
+	.string	"alloca"
+.LASF566:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF591:
+	.string	"__stub_gtty "
+.LASF420:
+	.string	"__WCHAR_T__ "
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF653:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1110:
+	.string	"va_read_iter"
+.LASF432:
+	.string	"_GCC_WCHAR_T "
+.LASF630:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__wur "
+.LASF733:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF1104:
+	.string	"vtab"
+.LASF999:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF600:
+	.string	"static_assert"
+.LASF849:
+	.string	"VA_STATE_SKIP 4"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1141:
+	.string	"__m64"
+.LASF1004:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF397:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF622:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF668:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF504:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF632:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF840:
+	.string	"VA_MODE_TYPE 4"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF639:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF807:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF1182:
+	.string	"_mm_add_epi16"
+.LASF516:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF572:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF896:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF522:
+	.string	"__STRING(x) #x"
+.LASF791:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1082:
+	.string	"unsigned char"
+.LASF569:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF933:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1178:
+	.string	"_mm_cmpeq_epi32"
+.LASF910:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF666:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF633:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF421:
+	.string	"_WCHAR_T "
+.LASF927:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF856:
+	.string	"VA_QUOTE_kk 5"
+.LASF804:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF703:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF396:
+	.string	"_GCC_PTRDIFF_T "
+.LASF592:
+	.string	"__stub_revoke "
+.LASF1092:
+	.string	"char"
+.LASF517:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF578:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF402:
+	.string	"_SIZE_T "
+.LASF429:
+	.string	"_WCHAR_T_H "
+.LASF847:
+	.string	"VA_STATE_WIDTH 2"
+.LASF1206:
+	.string	"va_store_utf8"
+.LASF1168:
+	.string	"va_xprintf_char32_pp_utf32"
+.LASF1125:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1081:
+	.string	"long double"
+.LASF705:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF537:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1059:
+	.string	"_MM_EXCEPT_UNDERFLOW 0x0010"
+.LASF641:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1039:
+	.string	"__ONCE_ALIGNMENT "
+.LASF769:
+	.string	"VA_STREAM_CHAR_SIZE(Char,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_size_vtab_gen((Char*)NULL)), NULL, (N), 0 })"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF387:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF406:
+	.string	"__SIZE_T "
+.LASF970:
+	.string	"_ENDIAN_H 1"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF697:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF684:
+	.string	"VA_PAR ()"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF446:
+	.string	"__USE_ISOC95"
+.LASF696:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF445:
+	.string	"__USE_ISOC99"
+.LASF649:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1017:
+	.string	"NFDBITS __NFDBITS"
+.LASF787:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF453:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF908:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF602:
+	.string	"VA_PRINT_CHAR_H_ "
+.LASF919:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1157:
+	.string	"va_char32_p_end"
+.LASF524:
+	.string	"__BEGIN_DECLS "
+.LASF869:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF552:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF715:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF891:
+	.string	"WCONTINUED 8"
+.LASF962:
+	.string	"__daddr_t_defined "
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1007:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF861:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF648:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1127:
+	.string	"size"
+.LASF1160:
+	.string	"va_span32_p_take_utf32"
+.LASF707:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF1126:
+	.string	"va_span32"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1139:
+	.string	"long long unsigned int"
+.LASF388:
+	.string	"_ANSI_STDDEF_H "
+.LASF1162:
+	.string	"iter"
+.LASF881:
+	.string	"_EMMINTRIN_H_INCLUDED "
+.LASF907:
+	.string	"__WCOREFLAG 0x80"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF447:
+	.string	"__USE_ISOCXX11"
+.LASF410:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1202:
+	.string	"va_stream_room"
+.LASF583:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF392:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF853:
+	.string	"VA_QUOTE_q 2"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1002:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF967:
+	.string	"__timer_t_defined 1"
+.LASF485:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1135:
+	.string	"check_flush"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF902:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF953:
+	.string	"__dev_t_defined "
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1115:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF548:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF451:
+	.string	"__USE_POSIX199506"
+.LASF973:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1146:
+	.string	"__v4si"
+.LASF835:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF946:
+	.string	"RAND_MAX 2147483647"
+.LASF1044:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1076:
+	.ascii	"_MM_TRANSPOSE4_PS(row0,row1,row2,row3) do { __v4sf __r0 = (r"
+	.ascii	"ow0), __r1 = (row1), __r2 = (row2), __r3 = (row3); __v4sf __"
+	.ascii	"t0 = __builtin_ia32_unpcklps (__r0, __r1); __v4sf __t1 = __b"
+	.ascii	"uiltin_ia32_unpcklps (__r2, __r3); __v4sf __t2 = __builtin_i"
+	.ascii	"a32_unpckhps (__r0"
+	.string	", __r1); __v4sf __t3 = __builtin_ia32_unpckhps (__r2, __r3); (row0) = __builtin_ia32_movlhps (__t0, __t1); (row1) = __builtin_ia32_movhlps (__t1, __t0); (row2) = __builtin_ia32_movlhps (__t2, __t3); (row3) = __builtin_ia32_movhlps (__t3, __t2); } while (0)"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF1180:
+	.string	"_mm_and_si128"
+.LASF741:
+	.string	"va_char32_p_format utf32"
+.LASF1106:
+	.string	"va_read_iter_t"
+.LASF494:
+	.string	"__WORDSIZE 64"
+.LASF417:
+	.string	"__size_t "
+.LASF745:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF428:
+	.string	"_WCHAR_T_DEFINED "
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF595:
+	.string	"__stub_stty "
+.LASF637:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF530:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF758:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF408:
+	.string	"_BSD_SIZE_T_ "
+.LASF988:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1156:
+	.string	"__assert_fail"
+.LASF527:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1064:
+	.string	"_MM_MASK_DIV_ZERO 0x0200"
+.LASF452:
+	.string	"__USE_XOPEN"
+.LASF1098:
+	.string	"bulk"
+.LASF976:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF740:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF711:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF986:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF764:
+	.string	"VA_PRINT_CHAR_UTF32_H_ "
+.LASF925:
+	.string	"__HAVE_FLOAT64 1"
+.LASF886:
+	.string	"_STDLIB_H 1"
+.LASF615:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"va_char16_p_decode utf16"
+.LASF738:
+	.string	"va_char16_p_format utf16"
+.LASF895:
+	.string	"__WCLONE 0x80000000"
+.LASF855:
+	.string	"VA_QUOTE_K 4"
+.LASF431:
+	.string	"__INT_WCHAR_T_H "
+.LASF642:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF747:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF1150:
+	.string	"__v16qi"
+.LASF790:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF786:
+	.string	"_STRING_H 1"
+.LASF1027:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF824:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF883:
+	.string	"_MMINTRIN_H_INCLUDED "
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF834:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF831:
+	.string	"VA_SIGN_NORM 0"
+.LASF499:
+	.string	"__USE_ATFILE 1"
+.LASF1019:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1102:
+	.string	"str_prefix"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF915:
+	.string	"_BITS_FLOATN_H "
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF425:
+	.string	"_WCHAR_T_ "
+.LASF678:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF601:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF708:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1038:
+	.string	"__LOCK_ALIGNMENT "
+.LASF768:
+	.string	"VA_STREAM_CHAR_P(S,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_vtab_gen(S)), (S), (N), 0 })"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1122:
+	.string	"put_len"
+.LASF918:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF872:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF589:
+	.string	"__stub_chflags "
+.LASF441:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF1008:
+	.string	"__timeval_defined 1"
+.LASF704:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF416:
+	.string	"_SIZET_ "
+.LASF659:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1067:
+	.string	"_MM_MASK_INEXACT 0x1000"
+.LASF757:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF714:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF957:
+	.string	"__uid_t_defined "
+.LASF858:
+	.string	"VA_QUOTE_QQ 7"
+.LASF442:
+	.string	"_ASSERT_H 1"
+.LASF582:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1099:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1134:
+	.string	"check_quote"
+.LASF652:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF577:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF922:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF560:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF963:
+	.string	"__key_t_defined "
+.LASF1068:
+	.string	"_MM_ROUND_MASK 0x6000"
+.LASF936:
+	.string	"__f32(x) x ##f32"
+.LASF781:
+	.string	"va_gznprintf(Char,N,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, (size_t)(N) + 1), __VA_ARGS__)->pos + 1)"
+.LASF550:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF905:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF874:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF493:
+	.string	"_ATFILE_SOURCE 1"
+.LASF961:
+	.string	"__ssize_t_defined "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF892:
+	.string	"WNOWAIT 0x01000000"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF723:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF748:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1028:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF850:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF848:
+	.string	"VA_STATE_PREC 3"
+.LASF836:
+	.string	"VA_MODE_NORM 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF1086:
+	.string	"short int"
+.LASF508:
+	.string	"_SYS_CDEFS_H 1"
+.LASF610:
+	.string	"_UCHAR_H 1"
+.LASF685:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF975:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF474:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF934:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF780:
+	.string	"va_Uzprintf(...) va_gzprintf(char32_t, __VA_ARGS__)"
+.LASF1136:
+	.string	"render_quote"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF993:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF538:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1022:
+	.string	"__blksize_t_defined "
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1204:
+	.string	"va_units_utf8"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF575:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1131:
+	.string	"va_span32_p_read_vtab_utf32"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF796:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF399:
+	.string	"__need_ptrdiff_t"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF887:
+	.string	"WNOHANG 1"
+.LASF586:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF658:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF536:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1101:
+	.string	"chunk_mode"
+.LASF1201:
+	.string	"va_stream_reserve"
+.LASF1073:
+	.string	"_MM_FLUSH_ZERO_MASK 0x8000"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF987:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF539:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF621:
+	.string	"__SWORD_TYPE long int"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF1103:
+	.string	"_pad"
+.LASF547:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF634:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF486:
+	.string	"__USE_POSIX 1"
+.LASF1057:
+	.string	"_MM_EXCEPT_DIV_ZERO 0x0004"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1155:
+	.string	"va_xprintf_iter_local"
+.LASF585:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF947:
+	.string	"EXIT_FAILURE 1"
+.LASF1130:
+	.string	"va_char32_p_read_vtab_utf32"
+.LASF688:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF808:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF810:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF882:
+	.string	"_XMMINTRIN_H_INCLUDED "
+.LASF608:
+	.string	"false 0"
+.LASF1121:
+	.string	"put_fill"
+.LASF613:
+	.string	"__S16_TYPE short int"
+.LASF1043:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF966:
+	.string	"__time_t_defined 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1036:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF989:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF554:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF558:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1152:
+	.string	"__m64_u"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF838:
+	.string	"VA_MODE_CHAR 2"
+.LASF430:
+	.string	"___int_wchar_t_h "
+.LASF876:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF981:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1053:
+	.string	"_MM_SHUFFLE(fp3,fp2,fp1,fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))"
+.LASF574:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF655:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF562:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF923:
+	.string	"__HAVE_FLOAT16 0"
+.LASF612:
+	.string	"_BITS_TYPES_H 1"
+.LASF690:
+	.string	"VA_F(...) VA_H"
+.LASF944:
+	.string	"__ldiv_t_defined 1"
+.LASF475:
+	.string	"_DEFAULT_SOURCE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF841:
+	.string	"VA_MODE_STAT 5"
+.LASF415:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF681:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF677:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF435:
+	.string	"_BSD_WCHAR_T_"
+.LASF819:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF657:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF662:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF868:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF1175:
+	.string	"va_char32_p_take_utf32"
+.LASF477:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF631:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF673:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF526:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF978:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF350:
+	.string	"__amd64 1"
+.LASF483:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF487:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF643:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF904:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF581:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1105:
+	.string	"va_read_iter_vtab_t"
+.LASF795:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF955:
+	.string	"__mode_t_defined "
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF636:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1198:
+	.string	"__q0"
+.LASF1197:
+	.string	"__q1"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1195:
+	.string	"__q3"
+.LASF1194:
+	.string	"__q4"
+.LASF1193:
+	.string	"__q5"
+.LASF377:
+	.string	"unix 1"
+.LASF1191:
+	.string	"__q7"
+.LASF627:
+	.string	"__STD_TYPE typedef"
+.LASF1142:
+	.string	"float"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1140:
+	.string	"va_quotation_t"
+.LASF1049:
+	.string	"_ALLOCA_H 1"
+.LASF798:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1054:
+	.string	"_MM_EXCEPT_MASK 0x003f"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF500:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF802:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF609:
+	.string	"__bool_true_false_are_defined 1"
+.LASF893:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1173:
+	.string	"va_span32_p_bulk_utf32"
+.LASF765:
+	.string	"va_char32_p_encode utf32"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF501:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF857:
+	.string	"VA_QUOTE_qq 6"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF679:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF899:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF701:
+	.string	"VA_REC1() VA_REC1B"
+.LASF909:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF712:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF1177:
+	.string	"_mm_movemask_epi8"
+.LASF777:
+	.string	"va_gzprintf(Char,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, -(size_t)2), __VA_ARGS__)->pos + 1)"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1209:
+	.string	"va_xprintf_last_char32_pp_utf32"
+.LASF531:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF832:
+	.string	"VA_SIGN_SPACE 1"
+.LASF859:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF514:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF844:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF943:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF638:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1158:
+	.string	"va_xprintf_last_span32_p_utf32"
+.LASF1205:
+	.string	"va_store_utf16"
+.LASF467:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF460:
+	.string	"__USE_LARGEFILE64"
+.LASF779:
+	.string	"va_uzprintf(...) va_gzprintf(char16_t, __VA_ARGS__)"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1072:
+	.string	"_MM_ROUND_TOWARD_ZERO 0x6000"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF894:
+	.string	"__WALL 0x40000000"
+.LASF951:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1113:
+	.string	"prec"
+.LASF977:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF372:
+	.string	"__linux 1"
+.LASF427:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1128:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF806:
+	.string	"_STRINGS_H 1"
+.LASF1018:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF820:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF789:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1170:
+	.string	"va_xprintf_char32_p_utf32"
+.LASF1037:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF667:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF842:
+	.string	"VA_MODE_X6 6"
+.LASF1031:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF484:
+	.string	"_POSIX_C_SOURCE"
+.LASF706:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF661:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF829:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF762:
+	.string	"VA_PRINT_CHAR_UTF16_H_ "
+.LASF812:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF565:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1024:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/utf32.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
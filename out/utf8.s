@@ -0,0 +1,18061 @@
+	.file	"utf8.c"
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "src/utf8.c"
+	.type	iter_nth, @function
+iter_nth:
+.LVL0:
+.LFB543:
+	.file 1 "src/utf8.c"
+	.loc 1 99 1 view -0
+	.cfi_startproc
+	.loc 1 100 5 view .LVU1
+	.loc 1 101 5 view .LVU2
+	.loc 1 101 7 is_stmt 0 view .LVU3
+	movl	%ecx, %ecx
+	.loc 1 101 7 view .LVU4
+	addq	8(%rsi), %rcx
+.LVL1:
+	.loc 1 102 5 is_stmt 1 view .LVU5
+	.loc 1 102 8 is_stmt 0 view .LVU6
+	cmpq	%rdx, %rcx
+	je	.L4
+	.loc 1 106 5 is_stmt 1 view .LVU7
+	.loc 1 106 10 is_stmt 0 view .LVU8
+	movzbl	(%rcx), %eax
+	.loc 1 106 8 view .LVU9
+	testb	%al, %al
+	jne	.L6
+	.loc 1 106 33 discriminator 1 view .LVU10
+	movq	(%rsi), %rdx
+.LVL2:
+	.loc 1 106 19 discriminator 1 view .LVU11
+	cmpb	$0, 48(%rdx)
+	jne	.L6
+	orl	$-1, %eax
+	jmp	.L6
+.LVL3:
+.L4:
+	.loc 1 106 19 discriminator 1 view .LVU12
+	orl	$-1, %eax
+	.loc 1 104 15 view .LVU13
+	xorl	%edx, %edx
+.LVL4:
+	.loc 1 104 15 view .LVU14
+	jmp	.L2
+.L6:
+	.loc 1 108 15 view .LVU15
+	movb	$1, %dl
+.L2:
+	.loc 1 103 17 view .LVU16
+	movl	%eax, (%rdi)
+	.loc 1 112 1 view .LVU17
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE543:
+	.size	iter_nth, .-iter_nth
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"src/utf8.c"
+.LC1:
+	.string	"iter->cur != NULL"
+.LC2:
+	.string	"r >= 0x80"
+.LC3:
+	.string	"r >= 0x0800"
+.LC4:
+	.string	"(r < VA_U_SURR_MIN) || (r > VA_U_SURR_MAX)"
+.LC5:
+	.string	"r >= 0x010000"
+.LC6:
+	.string	"r <= 0x10ffff"
+	.text
+	.globl	va_char_p_take_utf8
+	.type	va_char_p_take_utf8, @function
+va_char_p_take_utf8:
+.LVL5:
+.LFB546:
+	.loc 1 187 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 188 4 view .LVU19
+	.loc 1 187 1 is_stmt 0 view .LVU20
+	pushq	%rbx
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 188 8 view .LVU21
+	movq	8(%rdi), %r9
+	.loc 1 188 47 view .LVU22
+	testq	%r9, %r9
+	jne	.L9
+	.loc 1 188 24 is_stmt 1 discriminator 1 view .LVU23
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$188, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL6:
+	.loc 1 188 24 is_stmt 0 discriminator 1 view .LVU24
+	leaq	.LC1(%rip), %rdi
+.LVL7:
+	.loc 1 188 24 discriminator 1 view .LVU25
+	jmp	.L41
+.LVL8:
+.L9:
+	.loc 1 188 24 discriminator 1 view .LVU26
+	movq	%rdi, %r10
+	.loc 1 191 11 view .LVU27
+	movq	%rsi, %rdx
+	movq	%rsi, %r11
+	.loc 1 190 5 is_stmt 1 view .LVU28
+	.loc 1 191 5 view .LVU29
+	.loc 1 191 11 is_stmt 0 view .LVU30
+	xorl	%ecx, %ecx
+	leaq	8(%rsp), %rdi
+.LVL9:
+	.loc 1 191 11 view .LVU31
+	movq	%r10, %rsi
+.LVL10:
+	.loc 1 191 11 view .LVU32
+	call	iter_nth
+.LVL11:
+	.loc 1 192 5 is_stmt 1 view .LVU33
+	.loc 1 192 12 is_stmt 0 view .LVU34
+	movl	8(%rsp), %r8d
+	.loc 1 192 8 view .LVU35
+	cmpl	$-1, %r8d
+	jne	.L10
+.LVL12:
+.L16:
+	.loc 1 194 16 view .LVU36
+	orl	$-1, %r8d
+	jmp	.L8
+.L10:
+	.loc 1 196 5 is_stmt 1 view .LVU37
+	.loc 1 196 8 is_stmt 0 view .LVU38
+	cmpl	$127, %r8d
+	ja	.L12
+	.loc 1 197 9 is_stmt 1 view .LVU39
+.LVL13:
+.LBB108:
+.LBI108:
+	.loc 1 114 13 view .LVU40
+.LBB109:
+	.loc 1 118 5 view .LVU41
+	.loc 1 119 5 view .LVU42
+	.loc 1 120 5 view .LVU43
+	.loc 1 119 7 is_stmt 0 view .LVU44
+	incq	%r9
+.LVL14:
+	.loc 1 119 7 view .LVU45
+	jmp	.L40
+.LVL15:
+.L12:
+	.loc 1 119 7 view .LVU46
+.LBE109:
+.LBE108:
+	.loc 1 200 5 is_stmt 1 view .LVU47
+	.loc 1 200 8 is_stmt 0 view .LVU48
+	cmpl	$191, %r8d
+	ja	.L13
+	.loc 1 204 9 is_stmt 1 view .LVU49
+.LVL16:
+.LBB110:
+.LBI110:
+	.loc 1 114 13 view .LVU50
+.LBB111:
+	.loc 1 118 5 view .LVU51
+	.loc 1 119 5 view .LVU52
+	.loc 1 120 5 view .LVU53
+	.loc 1 119 7 is_stmt 0 view .LVU54
+	incq	%r9
+.LVL17:
+	.loc 1 119 7 view .LVU55
+.LBE111:
+.LBE110:
+	.loc 1 205 32 view .LVU56
+	orl	$-2130706432, %r8d
+.LBB113:
+.LBB112:
+	.loc 1 119 7 view .LVU57
+	movq	%r9, 8(%r10)
+.LVL18:
+	.loc 1 119 7 view .LVU58
+.LBE112:
+.LBE113:
+	.loc 1 205 9 is_stmt 1 view .LVU59
+	.loc 1 205 32 is_stmt 0 view .LVU60
+	jmp	.L8
+.L13:
+	.loc 1 207 5 is_stmt 1 view .LVU61
+	.loc 1 211 5 view .LVU62
+	.loc 1 211 8 is_stmt 0 view .LVU63
+	leal	-194(%r8), %eax
+	cmpl	$50, %eax
+	ja	.L26
+	.loc 1 217 5 is_stmt 1 view .LVU64
+	.loc 1 217 17 view .LVU65
+	.loc 1 218 5 view .LVU66
+	.loc 1 218 10 is_stmt 0 view .LVU67
+	leaq	12(%rsp), %rdi
+	movl	$1, %ecx
+	movq	%r11, %rdx
+	call	iter_nth
+.LVL19:
+	.loc 1 218 8 view .LVU68
+	testb	%al, %al
+	jne	.L15
+	.loc 1 219 9 is_stmt 1 view .LVU69
+	.loc 1 219 23 is_stmt 0 view .LVU70
+	movq	(%r10), %rax
+	.loc 1 219 12 view .LVU71
+	cmpb	$0, 49(%rax)
+	je	.L26
+	jmp	.L16
+.L15:
+	.loc 1 226 5 is_stmt 1 view .LVU72
+	.loc 1 226 13 is_stmt 0 view .LVU73
+	movl	12(%rsp), %eax
+	movl	%eax, %edx
+	andl	$192, %edx
+	.loc 1 226 8 view .LVU74
+	cmpl	$128, %edx
+	jne	.L26
+	.loc 1 232 5 is_stmt 1 view .LVU75
+	cmpl	$240, %r8d
+	je	.L17
+	ja	.L18
+	cmpl	$224, %r8d
+	je	.L19
+	cmpl	$237, %r8d
+	je	.L20
+	jmp	.L43
+.L18:
+	cmpl	$244, %r8d
+	je	.L22
+	.loc 1 255 5 view .LVU76
+	.loc 1 255 22 is_stmt 0 view .LVU77
+	movl	%r8d, %ebx
+	.loc 1 255 34 view .LVU78
+	andl	$63, %eax
+	.loc 1 255 22 view .LVU79
+	sall	$6, %ebx
+	.loc 1 255 14 view .LVU80
+	orl	%eax, %ebx
+.LVL20:
+	.loc 1 256 5 is_stmt 1 view .LVU81
+	jmp	.L23
+.LVL21:
+.L19:
+	.loc 1 235 9 view .LVU82
+	.loc 1 235 12 is_stmt 0 view .LVU83
+	cmpl	$159, %eax
+	jbe	.L26
+	.loc 1 255 5 is_stmt 1 view .LVU84
+	.loc 1 255 34 is_stmt 0 view .LVU85
+	andl	$63, %eax
+	.loc 1 255 14 view .LVU86
+	orb	$56, %ah
+	jmp	.L37
+.L17:
+	.loc 1 240 9 is_stmt 1 view .LVU87
+	.loc 1 240 12 is_stmt 0 view .LVU88
+	cmpl	$143, %eax
+	jbe	.L26
+	.loc 1 255 5 is_stmt 1 view .LVU89
+	.loc 1 255 34 is_stmt 0 view .LVU90
+	andl	$63, %eax
+	.loc 1 255 14 view .LVU91
+	orb	$60, %ah
+	jmp	.L37
+.L20:
+	.loc 1 246 9 is_stmt 1 view .LVU92
+	.loc 1 246 12 is_stmt 0 view .LVU93
+	cmpl	$159, %eax
+	ja	.L26
+	.loc 1 255 5 is_stmt 1 view .LVU94
+	.loc 1 255 34 is_stmt 0 view .LVU95
+	andl	$63, %eax
+	.loc 1 255 14 view .LVU96
+	orl	$15168, %eax
+.L37:
+	movl	%eax, %ebx
+.LVL22:
+	.loc 1 256 5 is_stmt 1 view .LVU97
+	jmp	.L23
+.LVL23:
+.L22:
+	.loc 1 251 9 view .LVU98
+	.loc 1 251 12 is_stmt 0 view .LVU99
+	cmpl	$143, %eax
+	ja	.L26
+	.loc 1 255 5 is_stmt 1 view .LVU100
+	.loc 1 255 34 is_stmt 0 view .LVU101
+	andl	$63, %eax
+	.loc 1 255 14 view .LVU102
+	orb	$61, %ah
+	jmp	.L37
+.L43:
+	.loc 1 255 5 is_stmt 1 view .LVU103
+	.loc 1 255 22 is_stmt 0 view .LVU104
+	movl	%r8d, %ebx
+	.loc 1 255 34 view .LVU105
+	andl	$63, %eax
+	.loc 1 255 22 view .LVU106
+	sall	$6, %ebx
+	.loc 1 255 14 view .LVU107
+	orl	%eax, %ebx
+.LVL24:
+	.loc 1 256 5 is_stmt 1 view .LVU108
+	.loc 1 256 8 is_stmt 0 view .LVU109
+	cmpl	$223, %r8d
+	ja	.L23
+	.loc 1 257 9 is_stmt 1 view .LVU110
+	.loc 1 257 11 is_stmt 0 view .LVU111
+	movl	%ebx, %r8d
+	andl	$2047, %r8d
+.LVL25:
+	.loc 1 258 8 is_stmt 1 view .LVU112
+	.loc 1 258 40 is_stmt 0 view .LVU113
+	andl	$1920, %ebx
+	jne	.L24
+	.loc 1 258 17 is_stmt 1 discriminator 1 view .LVU114
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$258, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL26:
+	.loc 1 258 17 is_stmt 0 discriminator 1 view .LVU115
+	leaq	.LC2(%rip), %rdi
+.LVL27:
+.L41:
+	.loc 1 258 17 discriminator 1 view .LVU116
+	call	__assert_fail@PLT
+.LVL28:
+.L24:
+	.loc 1 259 9 is_stmt 1 view .LVU117
+.LBB114:
+.LBI114:
+	.loc 1 114 13 view .LVU118
+.LBB115:
+	.loc 1 118 5 view .LVU119
+	.loc 1 119 5 view .LVU120
+	.loc 1 120 5 view .LVU121
+	.loc 1 119 7 is_stmt 0 view .LVU122
+	addq	$2, %r9
+.LVL29:
+	.loc 1 119 7 view .LVU123
+	jmp	.L40
+.LVL30:
+.L23:
+	.loc 1 119 7 view .LVU124
+.LBE115:
+.LBE114:
+	.loc 1 264 5 is_stmt 1 view .LVU125
+	.loc 1 264 10 is_stmt 0 view .LVU126
+	movl	$2, %ecx
+	movq	%r11, %rdx
+	movq	%r10, %rsi
+.LVL31:
+	.loc 1 264 10 view .LVU127
+	call	iter_nth
+.LVL32:
+	.loc 1 264 8 view .LVU128
+	testb	%al, %al
+	jne	.L25
+.LVL33:
+	.loc 1 265 9 is_stmt 1 view .LVU129
+	.loc 1 265 23 is_stmt 0 view .LVU130
+	movq	(%r10), %rax
+	.loc 1 265 12 view .LVU131
+	cmpb	$0, 49(%rax)
+	je	.L42
+	jmp	.L16
+.L25:
+	.loc 1 272 5 is_stmt 1 view .LVU132
+	.loc 1 272 13 is_stmt 0 view .LVU133
+	movl	12(%rsp), %eax
+	movl	%eax, %edx
+	andl	$192, %edx
+	.loc 1 272 8 view .LVU134
+	cmpl	$128, %edx
+	je	.L27
+.L42:
+	.loc 1 273 9 is_stmt 1 view .LVU135
+.LBB116:
+	.loc 1 273 25 view .LVU136
+.LVL34:
+	.loc 1 273 54 view .LVU137
+	.loc 1 273 115 is_stmt 0 view .LVU138
+	orl	$536870912, %r8d
+	jmp	.L39
+.LVL35:
+.L27:
+	.loc 1 273 115 view .LVU139
+.LBE116:
+	.loc 1 276 5 is_stmt 1 view .LVU140
+	.loc 1 276 12 is_stmt 0 view .LVU141
+	sall	$6, %ebx
+.LVL36:
+	.loc 1 276 24 view .LVU142
+	andl	$63, %eax
+	.loc 1 276 7 view .LVU143
+	orl	%eax, %ebx
+.LVL37:
+	.loc 1 277 5 is_stmt 1 view .LVU144
+	.loc 1 277 8 is_stmt 0 view .LVU145
+	cmpl	$239, %r8d
+	ja	.L28
+	.loc 1 278 9 is_stmt 1 view .LVU146
+	.loc 1 278 11 is_stmt 0 view .LVU147
+	movzwl	%bx, %r8d
+.LVL38:
+	.loc 1 279 8 is_stmt 1 view .LVU148
+	.loc 1 279 40 is_stmt 0 view .LVU149
+	andb	$-8, %bh
+.LVL39:
+	.loc 1 279 17 view .LVU150
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$279, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL40:
+	.loc 1 279 17 view .LVU151
+	leaq	.LC3(%rip), %rdi
+	.loc 1 279 40 view .LVU152
+	je	.L41
+	.loc 1 280 8 is_stmt 1 view .LVU153
+	.loc 1 280 21 is_stmt 0 view .LVU154
+	leal	-55296(%r8), %eax
+	.loc 1 280 17 view .LVU155
+	movl	$280, %edx
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+.LBB117:
+.LBB118:
+	.loc 1 119 7 view .LVU156
+	addq	$3, %r9
+.LBE118:
+.LBE117:
+	.loc 1 280 17 view .LVU157
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC4(%rip), %rdi
+	.loc 1 280 40 view .LVU158
+	cmpl	$2047, %eax
+	ja	.L40
+	jmp	.L41
+.LVL41:
+.L28:
+	.loc 1 286 5 is_stmt 1 view .LVU159
+	.loc 1 286 10 is_stmt 0 view .LVU160
+	movl	$3, %ecx
+	movq	%r11, %rdx
+	call	iter_nth
+.LVL42:
+	.loc 1 286 8 view .LVU161
+	testb	%al, %al
+	jne	.L31
+	.loc 1 287 9 is_stmt 1 view .LVU162
+	.loc 1 287 23 is_stmt 0 view .LVU163
+	movq	(%r10), %rax
+	.loc 1 287 12 view .LVU164
+	cmpb	$0, 49(%rax)
+	je	.L38
+	jmp	.L16
+.L31:
+	.loc 1 294 5 is_stmt 1 view .LVU165
+	.loc 1 294 13 is_stmt 0 view .LVU166
+	movl	12(%rsp), %eax
+	movl	%eax, %edx
+	andl	$192, %edx
+	.loc 1 294 8 view .LVU167
+	cmpl	$128, %edx
+	je	.L32
+.L38:
+	.loc 1 295 9 is_stmt 1 view .LVU168
+.LBB119:
+	.loc 1 295 25 view .LVU169
+.LVL43:
+	.loc 1 295 54 view .LVU170
+	.loc 1 295 115 is_stmt 0 view .LVU171
+	orl	$1073741824, %r8d
+.LVL44:
+.L39:
+	.loc 1 295 115 view .LVU172
+	movl	%r8d, 8(%rsp)
+.LBE119:
+	.loc 1 296 9 is_stmt 1 view .LVU173
+	jmp	.L26
+.L32:
+	.loc 1 298 5 view .LVU174
+	.loc 1 298 12 is_stmt 0 view .LVU175
+	sall	$6, %ebx
+.LVL45:
+	.loc 1 298 24 view .LVU176
+	andl	$63, %eax
+	.loc 1 300 13 view .LVU177
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$300, %edx
+	.loc 1 298 7 view .LVU178
+	orl	%ebx, %eax
+.LVL46:
+	.loc 1 299 5 is_stmt 1 view .LVU179
+	.loc 1 300 13 is_stmt 0 view .LVU180
+	leaq	.LC0(%rip), %rsi
+.LVL47:
+	.loc 1 300 13 view .LVU181
+	leaq	.LC5(%rip), %rdi
+	.loc 1 299 7 view .LVU182
+	movl	%eax, %r8d
+	andl	$2097151, %r8d
+.LVL48:
+	.loc 1 300 4 is_stmt 1 view .LVU183
+	.loc 1 300 36 is_stmt 0 view .LVU184
+	testl	$2031616, %eax
+	je	.L41
+	.loc 1 301 4 is_stmt 1 view .LVU185
+	.loc 1 301 13 is_stmt 0 view .LVU186
+	leaq	__PRETTY_FUNCTION__.1(%rip), %rcx
+	movl	$301, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC6(%rip), %rdi
+	.loc 1 301 36 view .LVU187
+	cmpl	$1114111, %r8d
+	ja	.L41
+	.loc 1 302 5 is_stmt 1 view .LVU188
+.LVL49:
+.LBB120:
+.LBI120:
+	.loc 1 114 13 view .LVU189
+.LBB121:
+	.loc 1 118 5 view .LVU190
+	.loc 1 119 5 view .LVU191
+	.loc 1 120 5 view .LVU192
+	.loc 1 119 7 is_stmt 0 view .LVU193
+	addq	$4, %r9
+.LVL50:
+.L40:
+	.loc 1 119 7 view .LVU194
+	movq	%r9, 8(%r10)
+.LBE121:
+.LBE120:
+	.loc 1 303 5 is_stmt 1 view .LVU195
+	.loc 1 303 12 is_stmt 0 view .LVU196
+	jmp	.L8
+.LVL51:
+.L26:
+	.loc 1 306 5 is_stmt 1 view .LVU197
+.LBB122:
+.LBI122:
+	.loc 1 114 13 view .LVU198
+.LBB123:
+	.loc 1 118 5 view .LVU199
+	.loc 1 119 5 view .LVU200
+	.loc 1 120 5 view .LVU201
+	.loc 1 119 7 is_stmt 0 view .LVU202
+	incq	%r9
+.LVL52:
+	.loc 1 119 7 view .LVU203
+.LBE123:
+.LBE122:
+	.loc 1 307 15 view .LVU204
+	movl	8(%rsp), %r8d
+.LBB125:
+.LBB124:
+	.loc 1 119 7 view .LVU205
+	movq	%r9, 8(%r10)
+.LVL53:
+	.loc 1 119 7 view .LVU206
+.LBE124:
+.LBE125:
+	.loc 1 307 5 is_stmt 1 view .LVU207
+	.loc 1 307 15 is_stmt 0 view .LVU208
+	orl	$16777216, %r8d
+.LVL54:
+.L8:
+	.loc 1 308 1 view .LVU209
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 16
+	movl	%r8d, %eax
+	popq	%rbx
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE546:
+	.size	va_char_p_take_utf8, .-va_char_p_take_utf8
+	.globl	va_char_p_bulk_utf8
+	.type	va_char_p_bulk_utf8, @function
+va_char_p_bulk_utf8:
+.LVL55:
+.LFB547:
+	.loc 1 315 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 316 5 view .LVU211
+	.loc 1 315 1 is_stmt 0 view .LVU212
+	movq	%rdi, %rax
+	movq	%rcx, %r10
+	movq	%rdx, %rdi
+.LVL56:
+	.loc 1 316 26 view .LVU213
+	movq	8(%rax), %r8
+.LVL57:
+	.loc 1 317 5 is_stmt 1 view .LVU214
+	.loc 1 318 5 view .LVU215
+	.loc 1 318 8 is_stmt 0 view .LVU216
+	testq	%rsi, %rsi
+	je	.L45
+	.loc 1 318 62 discriminator 1 view .LVU217
+	subq	%r8, %rsi
+.LVL58:
+	.loc 1 318 62 discriminator 1 view .LVU218
+	cmpq	%rsi, %rdx
+	cmova	%rsi, %rdi
+.L45:
+.LVL59:
+	.loc 1 322 5 is_stmt 1 view .LVU219
+	.loc 1 323 5 view .LVU220
+	.loc 1 324 5 view .LVU221
+	.loc 1 323 12 is_stmt 0 view .LVU222
+	xorl	%esi, %esi
+	.loc 1 322 12 view .LVU223
+	xorl	%edx, %edx
+.LVL60:
+.L46:
+	.loc 1 324 14 is_stmt 1 view .LVU224
+	cmpq	%rdi, %rdx
+	jnb	.L59
+.LBB139:
+	.loc 1 325 9 view .LVU225
+	.loc 1 325 24 is_stmt 0 view .LVU226
+	leaq	(%r8,%rdx), %rcx
+	.loc 1 325 18 view .LVU227
+	movzbl	(%rcx), %eax
+.LVL61:
+	.loc 1 326 9 is_stmt 1 view .LVU228
+	.loc 1 326 12 is_stmt 0 view .LVU229
+	cmpl	$127, %eax
+	ja	.L47
+.LBB140:
+	.loc 1 327 13 is_stmt 1 view .LVU230
+	.loc 1 327 16 is_stmt 0 view .LVU231
+	testl	%eax, %eax
+	je	.L59
+	.loc 1 330 13 is_stmt 1 view .LVU232
+	.loc 1 330 24 is_stmt 0 view .LVU233
+	movq	%rdi, %r9
+.LBB141:
+.LBB142:
+	.loc 1 144 12 view .LVU234
+	xorl	%eax, %eax
+.LVL62:
+	.loc 1 144 12 view .LVU235
+.LBE142:
+.LBE141:
+	.loc 1 330 24 view .LVU236
+	subq	%rdx, %r9
+.LVL63:
+.LBB162:
+.LBI141:
+	.loc 1 140 15 is_stmt 1 view .LVU237
+.LBB161:
+	.loc 1 144 5 view .LVU238
+	.loc 1 145 5 view .LVU239
+	.loc 1 145 20 view .LVU240
+.L49:
+	.loc 1 145 43 is_stmt 0 view .LVU241
+	leaq	(%rcx,%rax), %r11
+	.loc 1 145 20 view .LVU242
+	andb	$15, %r11b
+	je	.L77
+	.loc 1 146 9 is_stmt 1 view .LVU243
+	.loc 1 146 12 is_stmt 0 view .LVU244
+	cmpb	$0, (%rcx,%rax)
+	jle	.L50
+	.loc 1 149 9 is_stmt 1 view .LVU245
+	.loc 1 149 10 is_stmt 0 view .LVU246
+	incq	%rax
+.LVL64:
+	.loc 1 145 20 is_stmt 1 view .LVU247
+	cmpq	%rax, %r9
+	jne	.L49
+	jmp	.L55
+.L77:
+.LBB143:
+.LBB144:
+.LBB145:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 2 1335 34 is_stmt 0 view .LVU248
+	xorps	%xmm1, %xmm1
+.L53:
+	.loc 2 1335 34 view .LVU249
+.LBE145:
+.LBE144:
+.LBE143:
+	.loc 1 151 20 is_stmt 1 view .LVU250
+	movq	%r9, %r11
+	subq	%rax, %r11
+	cmpq	$15, %r11
+	jbe	.L55
+.LBB160:
+	.loc 1 152 9 view .LVU251
+.LVL65:
+	.loc 1 160 9 view .LVU252
+.LBB148:
+.LBI148:
+	.loc 2 695 1 view .LVU253
+.LBB149:
+	.loc 2 697 3 view .LVU254
+	.loc 2 697 10 is_stmt 0 view .LVU255
+	movaps	(%rcx,%rax), %xmm0
+.LVL66:
+	.loc 2 697 10 view .LVU256
+.LBE149:
+.LBE148:
+	.loc 1 161 9 is_stmt 1 view .LVU257
+.LBB150:
+.LBI144:
+	.loc 2 1333 1 view .LVU258
+.LBB146:
+	.loc 2 1335 3 view .LVU259
+	.loc 2 1335 3 is_stmt 0 view .LVU260
+.LBE146:
+.LBE150:
+	.loc 1 162 9 is_stmt 1 view .LVU261
+.LBB151:
+.LBI151:
+	.loc 2 1321 1 view .LVU262
+.LBB152:
+	.loc 2 1323 3 view .LVU263
+	.loc 2 1323 3 is_stmt 0 view .LVU264
+.LBE152:
+.LBE151:
+.LBB154:
+.LBI154:
+	.loc 2 1431 1 is_stmt 1 view .LVU265
+.LBB155:
+	.loc 2 1433 3 view .LVU266
+.LBE155:
+.LBE154:
+.LBB157:
+.LBB147:
+	.loc 2 1335 34 is_stmt 0 view .LVU267
+	movaps	%xmm0, %xmm2
+	pcmpeqb	%xmm1, %xmm2
+.LBE147:
+.LBE157:
+.LBB158:
+.LBB153:
+	.loc 2 1323 33 view .LVU268
+	orps	%xmm2, %xmm0
+.LVL67:
+	.loc 2 1323 33 view .LVU269
+.LBE153:
+.LBE158:
+.LBB159:
+.LBB156:
+	.loc 2 1433 10 view .LVU270
+	pmovmskb	%xmm0, %r11d
+.LVL68:
+	.loc 2 1433 10 view .LVU271
+.LBE156:
+.LBE159:
+	.loc 1 162 12 view .LVU272
+	testl	%r11d, %r11d
+	jne	.L55
+.LBE160:
+	.loc 1 151 30 is_stmt 1 view .LVU273
+	addq	$16, %rax
+.LVL69:
+	.loc 1 151 30 is_stmt 0 view .LVU274
+	jmp	.L53
+.LVL70:
+.L78:
+	.loc 1 177 20 view .LVU275
+	cmpb	$0, (%rcx,%rax)
+	jle	.L50
+	.loc 1 178 9 is_stmt 1 view .LVU276
+	.loc 1 178 10 is_stmt 0 view .LVU277
+	incq	%rax
+.LVL71:
+.L55:
+	.loc 1 177 35 is_stmt 1 view .LVU278
+	cmpq	%r9, %rax
+	jb	.L78
+.L50:
+.LVL72:
+	.loc 1 177 35 is_stmt 0 view .LVU279
+.LBE161:
+.LBE162:
+	.loc 1 331 13 is_stmt 1 view .LVU280
+	.loc 1 331 15 is_stmt 0 view .LVU281
+	addq	%rax, %rdx
+.LVL73:
+	.loc 1 332 13 is_stmt 1 view .LVU282
+	.loc 1 332 15 is_stmt 0 view .LVU283
+	addq	%rax, %rsi
+.LVL74:
+	.loc 1 333 13 is_stmt 1 view .LVU284
+	jmp	.L46
+.LVL75:
+.L47:
+	.loc 1 333 13 is_stmt 0 view .LVU285
+.LBE140:
+	.loc 1 337 9 is_stmt 1 view .LVU286
+	.loc 1 338 9 view .LVU287
+	.loc 1 339 9 view .LVU288
+	.loc 1 340 9 view .LVU289
+	.loc 1 340 26 is_stmt 0 view .LVU290
+	leal	-194(%rax), %ecx
+	.loc 1 340 12 view .LVU291
+	cmpl	$29, %ecx
+	jbe	.L63
+	.loc 1 343 14 is_stmt 1 view .LVU292
+	.loc 1 343 31 is_stmt 0 view .LVU293
+	leal	-224(%rax), %ecx
+	.loc 1 343 17 view .LVU294
+	cmpl	$15, %ecx
+	ja	.L58
+	.loc 1 344 13 is_stmt 1 view .LVU295
+.LVL76:
+	.loc 1 345 13 view .LVU296
+	.loc 1 345 16 is_stmt 0 view .LVU297
+	cmpl	$224, %eax
+	je	.L64
+	.loc 1 346 13 is_stmt 1 view .LVU298
+	.loc 1 339 18 is_stmt 0 view .LVU299
+	cmpl	$237, %eax
+	movl	$191, %ecx
+	movl	$159, %eax
+.LVL77:
+	.loc 1 339 18 view .LVU300
+	movl	$128, %r9d
+	cmovne	%ecx, %eax
+	jmp	.L76
+.LVL78:
+.L58:
+	.loc 1 348 14 is_stmt 1 view .LVU301
+	.loc 1 348 31 is_stmt 0 view .LVU302
+	leal	-240(%rax), %ecx
+	.loc 1 348 17 view .LVU303
+	cmpl	$4, %ecx
+	ja	.L59
+	.loc 1 349 13 is_stmt 1 view .LVU304
+.LVL79:
+	.loc 1 350 13 view .LVU305
+	.loc 1 350 16 is_stmt 0 view .LVU306
+	cmpl	$240, %eax
+	je	.L66
+	.loc 1 351 13 is_stmt 1 view .LVU307
+	.loc 1 339 18 is_stmt 0 view .LVU308
+	cmpl	$244, %eax
+	movl	$191, %ecx
+	movl	$143, %eax
+.LVL80:
+	.loc 1 339 18 view .LVU309
+	movl	$128, %r9d
+	cmovne	%ecx, %eax
+	jmp	.L75
+.LVL81:
+.L63:
+	.loc 1 339 18 view .LVU310
+	movl	$191, %eax
+.LVL82:
+	.loc 1 338 18 view .LVU311
+	movl	$128, %r9d
+	.loc 1 341 17 view .LVU312
+	movl	$2, %ecx
+.LVL83:
+	.loc 1 341 17 view .LVU313
+	jmp	.L57
+.LVL84:
+.L64:
+	.loc 1 339 18 view .LVU314
+	movl	$191, %eax
+.LVL85:
+	.loc 1 345 34 view .LVU315
+	movl	$160, %r9d
+.LVL86:
+.L76:
+	.loc 1 344 17 view .LVU316
+	movl	$3, %ecx
+	jmp	.L57
+.LVL87:
+.L66:
+	.loc 1 339 18 view .LVU317
+	movl	$191, %eax
+.LVL88:
+	.loc 1 350 34 view .LVU318
+	movl	$144, %r9d
+.LVL89:
+.L75:
+	.loc 1 349 17 view .LVU319
+	movl	$4, %ecx
+.LVL90:
+.L57:
+	.loc 1 356 9 is_stmt 1 view .LVU320
+	.loc 1 356 22 is_stmt 0 view .LVU321
+	movq	%rdi, %r11
+	subq	%rdx, %r11
+	.loc 1 356 12 view .LVU322
+	cmpq	%rcx, %r11
+	jb	.L59
+	.loc 1 359 9 is_stmt 1 view .LVU323
+	.loc 1 359 15 is_stmt 0 view .LVU324
+	movzbl	1(%r8,%rdx), %r11d
+	.loc 1 359 27 view .LVU325
+	cmpl	%r11d, %eax
+	jb	.L59
+	cmpl	%r9d, %r11d
+	jb	.L59
+	.loc 1 362 9 is_stmt 1 view .LVU326
+	.loc 1 362 12 is_stmt 0 view .LVU327
+	cmpq	$2, %rcx
+	je	.L60
+	.loc 1 362 24 discriminator 1 view .LVU328
+	movb	2(%r8,%rdx), %al
+.LVL91:
+	.loc 1 362 24 discriminator 1 view .LVU329
+	andl	$-64, %eax
+	cmpb	$-128, %al
+	jne	.L59
+	.loc 1 365 9 is_stmt 1 view .LVU330
+	.loc 1 365 12 is_stmt 0 view .LVU331
+	cmpq	$4, %rcx
+	jne	.L60
+	.loc 1 365 24 discriminator 1 view .LVU332
+	movb	3(%r8,%rdx), %al
+	andl	$-64, %eax
+	cmpb	$-128, %al
+	jne	.L59
+.L60:
+	.loc 1 368 9 is_stmt 1 view .LVU333
+	.loc 1 368 11 is_stmt 0 view .LVU334
+	addq	%rcx, %rdx
+.LVL92:
+	.loc 1 369 9 is_stmt 1 view .LVU335
+	.loc 1 369 10 is_stmt 0 view .LVU336
+	incq	%rsi
+.LVL93:
+	.loc 1 369 10 view .LVU337
+	jmp	.L46
+.LVL94:
+.L59:
+	.loc 1 369 10 view .LVU338
+.LBE139:
+	.loc 1 371 5 is_stmt 1 view .LVU339
+	.loc 1 371 10 is_stmt 0 view .LVU340
+	movq	%rsi, (%r10)
+	.loc 1 372 5 is_stmt 1 view .LVU341
+	.loc 1 373 1 is_stmt 0 view .LVU342
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE547:
+	.size	va_char_p_bulk_utf8, .-va_char_p_bulk_utf8
+	.globl	va_span_p_bulk_utf8
+	.type	va_span_p_bulk_utf8, @function
+va_span_p_bulk_utf8:
+.LVL95:
+.LFB548:
+	.loc 1 380 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 381 5 view .LVU344
+	.loc 1 381 41 view .LVU345
+	.loc 1 381 89 view .LVU346
+	.loc 1 381 122 view .LVU347
+	.loc 1 381 40 view .LVU348
+	.loc 1 381 136 view .LVU349
+	.loc 1 381 174 view .LVU350
+	.loc 1 381 187 view .LVU351
+	.loc 1 382 5 view .LVU352
+	.loc 1 382 30 is_stmt 0 view .LVU353
+	movq	16(%rdi), %rax
+	.loc 1 382 8 view .LVU354
+	testq	%rsi, %rsi
+	je	.L80
+	cmpq	%rsi, %rax
+	cmova	%rsi, %rax
+.L80:
+.LVL96:
+	.loc 1 385 5 is_stmt 1 view .LVU355
+	.loc 1 385 12 is_stmt 0 view .LVU356
+	movq	%rax, %rsi
+	jmp	va_char_p_bulk_utf8
+.LVL97:
+	.loc 1 385 12 view .LVU357
+	.cfi_endproc
+.LFE548:
+	.size	va_span_p_bulk_utf8, .-va_span_p_bulk_utf8
+	.globl	va_char_p_transcode_utf8
+	.type	va_char_p_transcode_utf8, @function
+va_char_p_transcode_utf8:
+.LVL98:
+.LFB550:
+	.loc 1 416 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 417 5 view .LVU359
+	.loc 1 418 5 view .LVU360
+	.loc 1 416 1 is_stmt 0 view .LVU361
+	movl	%esi, %r9d
+	movq	%rdx, %r8
+	.loc 1 418 26 view .LVU362
+	leaq	(%rdx,%rcx), %rsi
+.LVL99:
+	.loc 1 419 5 is_stmt 1 view .LVU363
+	.loc 1 419 8 is_stmt 0 view .LVU364
+	testq	%rdi, %rdi
+	jne	.L110
+.LBB214:
+.LBB215:
+.LBB216:
+	.loc 1 398 17 view .LVU365
+	xorl	%edx, %edx
+.LVL100:
+	.loc 1 398 17 view .LVU366
+.LBE216:
+	.loc 1 397 12 view .LVU367
+	xorl	%esi, %esi
+.LVL101:
+	.loc 1 396 12 view .LVU368
+	xorl	%eax, %eax
+.LVL102:
+.L85:
+.LBB217:
+	.loc 1 398 26 is_stmt 1 view .LVU369
+	cmpq	%rdx, %rcx
+	je	.L112
+	.loc 1 399 9 view .LVU370
+	.loc 1 399 17 is_stmt 0 view .LVU371
+	movb	(%r8,%rdx), %dil
+	.loc 1 399 29 view .LVU372
+	movl	%edi, %r10d
+	andl	$-64, %r10d
+	cmpb	$-128, %r10b
+	setne	%r10b
+	movzbl	%r10b, %r10d
+	.loc 1 399 11 view .LVU373
+	addq	%r10, %rax
+.LVL103:
+	.loc 1 400 9 is_stmt 1 view .LVU374
+	.loc 1 400 21 is_stmt 0 view .LVU375
+	cmpb	$-17, %dil
+	seta	%dil
+	.loc 1 398 32 view .LVU376
+	incq	%rdx
+.LVL104:
+	.loc 1 400 21 view .LVU377
+	movzbl	%dil, %edi
+	.loc 1 400 12 view .LVU378
+	addq	%rdi, %rsi
+.LVL105:
+	.loc 1 398 32 is_stmt 1 view .LVU379
+	.loc 1 398 32 is_stmt 0 view .LVU380
+	jmp	.L85
+.L112:
+	.loc 1 398 32 view .LVU381
+.LBE217:
+	.loc 1 402 5 is_stmt 1 view .LVU382
+	cmpb	$2, %r9b
+	je	.L88
+	xorl	%edx, %edx
+.LVL106:
+	.loc 1 406 18 is_stmt 0 view .LVU383
+	salq	$2, %rax
+.LVL107:
+	.loc 1 402 5 view .LVU384
+	cmpb	$3, %r9b
+	cmovne	%rdx, %rax
+	ret
+.LVL108:
+.L88:
+	.loc 1 404 9 is_stmt 1 view .LVU385
+	.loc 1 404 19 is_stmt 0 view .LVU386
+	addq	%rsi, %rax
+.LVL109:
+	.loc 1 404 25 view .LVU387
+	addq	%rax, %rax
+	ret
+.LVL110:
+.L110:
+	.loc 1 404 25 view .LVU388
+.LBE215:
+.LBE214:
+	.loc 1 422 5 is_stmt 1 view .LVU389
+	cmpb	$2, %r9b
+	je	.L108
+	cmpb	$3, %r9b
+	je	.L109
+	xorl	%eax, %eax
+	ret
+.L108:
+	movq	%rdi, %rax
+.LBB218:
+.LBB219:
+.LBB220:
+.LBB221:
+.LBB222:
+	.loc 2 1030 19 is_stmt 0 view .LVU390
+	xorps	%xmm1, %xmm1
+.LVL111:
+.L91:
+	.loc 2 1030 19 view .LVU391
+.LBE222:
+.LBE221:
+.LBE220:
+.LBE219:
+	.loc 1 425 18 is_stmt 1 view .LVU392
+	cmpq	%rsi, %r8
+	jnb	.L111
+	.loc 1 428 13 view .LVU393
+	.loc 1 428 20 is_stmt 0 view .LVU394
+	movq	%rsi, %rdx
+	subq	%r8, %rdx
+	.loc 1 428 16 view .LVU395
+	cmpq	$15, %rdx
+	jle	.L93
+.LBB248:
+	.loc 1 429 17 is_stmt 1 view .LVU396
+.LVL112:
+.LBB239:
+.LBI239:
+	.loc 2 701 1 view .LVU397
+.LBB240:
+	.loc 2 703 3 view .LVU398
+	.loc 2 703 3 is_stmt 0 view .LVU399
+.LBE240:
+.LBE239:
+	.loc 1 430 17 is_stmt 1 view .LVU400
+.LBB242:
+.LBI242:
+	.loc 2 1431 1 view .LVU401
+.LBB243:
+	.loc 2 1433 3 view .LVU402
+.LBE243:
+.LBE242:
+.LBB245:
+.LBB241:
+	.loc 2 703 10 is_stmt 0 view .LVU403
+	movups	(%r8), %xmm0
+.LBE241:
+.LBE245:
+.LBB246:
+.LBB244:
+	.loc 2 1433 10 view .LVU404
+	pmovmskb	%xmm0, %edx
+.LVL113:
+	.loc 2 1433 10 view .LVU405
+.LBE244:
+.LBE246:
+	.loc 1 430 20 view .LVU406
+	testl	%edx, %edx
+	jne	.L93
+.LBB247:
+	.loc 1 431 21 is_stmt 1 view .LVU407
+.LVL114:
+	.loc 1 432 21 view .LVU408
+.LBB225:
+.LBI221:
+	.loc 2 1028 1 view .LVU409
+.LBB223:
+	.loc 2 1030 3 view .LVU410
+	.loc 2 1030 19 is_stmt 0 view .LVU411
+	movaps	%xmm0, %xmm2
+.LBE223:
+.LBE225:
+.LBB226:
+.LBB227:
+	.loc 2 1006 19 view .LVU412
+	punpckhbw	%xmm1, %xmm0
+.LBE227:
+.LBE226:
+	.loc 1 434 23 view .LVU413
+	leaq	16(%r8), %rcx
+	.loc 1 435 23 view .LVU414
+	addq	$32, %rax
+.LVL115:
+.LBB229:
+.LBB224:
+	.loc 2 1030 19 view .LVU415
+	punpcklbw	%xmm1, %xmm2
+.LVL116:
+	.loc 2 1030 19 view .LVU416
+.LBE224:
+.LBE229:
+.LBB230:
+.LBI230:
+	.loc 2 737 1 is_stmt 1 view .LVU417
+.LBB231:
+	.loc 2 739 3 view .LVU418
+.LBE231:
+.LBE230:
+.LBB233:
+.LBB234:
+	.loc 2 739 8 is_stmt 0 view .LVU419
+	movups	%xmm0, -16(%rax)
+.LVL117:
+	.loc 2 739 8 view .LVU420
+.LBE234:
+.LBE233:
+.LBB236:
+.LBB232:
+	movups	%xmm2, -32(%rax)
+.LVL118:
+	.loc 2 739 8 view .LVU421
+.LBE232:
+.LBE236:
+	.loc 1 433 21 is_stmt 1 view .LVU422
+.LBB237:
+.LBI226:
+	.loc 2 1004 1 view .LVU423
+.LBB228:
+	.loc 2 1006 3 view .LVU424
+	.loc 2 1006 3 is_stmt 0 view .LVU425
+.LBE228:
+.LBE237:
+.LBB238:
+.LBI233:
+	.loc 2 737 1 is_stmt 1 view .LVU426
+.LBB235:
+	.loc 2 739 3 view .LVU427
+	.loc 2 739 3 is_stmt 0 view .LVU428
+.LBE235:
+.LBE238:
+	.loc 1 434 21 is_stmt 1 view .LVU429
+	.loc 1 435 21 view .LVU430
+	.loc 1 436 21 view .LVU431
+	jmp	.L94
+.LVL119:
+.L93:
+	.loc 1 436 21 is_stmt 0 view .LVU432
+.LBE247:
+.LBE248:
+	.loc 1 440 13 is_stmt 1 view .LVU433
+.LBB249:
+.LBI249:
+	.file 3 "./include/va_print/impl.h"
+	.loc 3 496 24 view .LVU434
+.LBB250:
+	.loc 3 498 5 view .LVU435
+	.loc 3 499 5 view .LVU436
+	.loc 3 499 14 is_stmt 0 view .LVU437
+	movzbl	(%r8), %edx
+.LVL120:
+	.loc 3 500 5 is_stmt 1 view .LVU438
+	.loc 3 501 17 is_stmt 0 view .LVU439
+	leaq	1(%r8), %rcx
+	.loc 3 500 8 view .LVU440
+	cmpl	$127, %edx
+	jbe	.L96
+	.loc 3 504 5 is_stmt 1 view .LVU441
+	.loc 3 506 38 is_stmt 0 view .LVU442
+	movzbl	1(%r8), %r9d
+	.loc 3 504 8 view .LVU443
+	cmpl	$223, %edx
+	ja	.L97
+	.loc 3 505 9 is_stmt 1 view .LVU444
+	.loc 3 506 28 is_stmt 0 view .LVU445
+	sall	$6, %edx
+.LVL121:
+	.loc 3 506 42 view .LVU446
+	andl	$63, %r9d
+	.loc 3 505 17 view .LVU447
+	leaq	2(%r8), %rcx
+.LVL122:
+	.loc 3 506 9 is_stmt 1 view .LVU448
+	.loc 3 506 28 is_stmt 0 view .LVU449
+	andl	$1984, %edx
+	.loc 3 506 34 view .LVU450
+	orl	%r9d, %edx
+.LVL123:
+	.loc 3 506 34 view .LVU451
+.LBE250:
+.LBE249:
+.LBB253:
+.LBI253:
+	.loc 3 478 25 is_stmt 1 view .LVU452
+.LBB254:
+	.loc 3 480 5 view .LVU453
+	jmp	.L96
+.LVL124:
+.L97:
+	.loc 3 480 5 is_stmt 0 view .LVU454
+.LBE254:
+.LBE253:
+.LBB257:
+.LBB251:
+	.loc 3 508 5 is_stmt 1 view .LVU455
+	.loc 3 510 63 is_stmt 0 view .LVU456
+	movb	2(%r8), %r10b
+	.loc 3 508 8 view .LVU457
+	cmpl	$239, %edx
+	ja	.L98
+	.loc 3 509 9 is_stmt 1 view .LVU458
+	.loc 3 510 28 is_stmt 0 view .LVU459
+	sall	$12, %edx
+.LVL125:
+	.loc 3 510 53 view .LVU460
+	sall	$6, %r9d
+	.loc 3 510 67 view .LVU461
+	andl	$63, %r10d
+	.loc 3 509 17 view .LVU462
+	leaq	3(%r8), %rcx
+.LVL126:
+	.loc 3 510 9 is_stmt 1 view .LVU463
+	.loc 3 510 28 is_stmt 0 view .LVU464
+	movzwl	%dx, %edx
+	.loc 3 510 53 view .LVU465
+	andl	$4032, %r9d
+	.loc 3 510 35 view .LVU466
+	orl	%r9d, %edx
+	.loc 3 510 59 view .LVU467
+	orl	%r10d, %edx
+.LVL127:
+	.loc 3 510 59 view .LVU468
+.LBE251:
+.LBE257:
+.LBB258:
+	.loc 3 478 25 is_stmt 1 view .LVU469
+.LBB255:
+	.loc 3 480 5 view .LVU470
+	jmp	.L96
+.LVL128:
+.L98:
+	.loc 3 480 5 is_stmt 0 view .LVU471
+.LBE255:
+.LBE258:
+.LBB259:
+.LBB252:
+	.loc 3 512 5 is_stmt 1 view .LVU472
+	.loc 3 512 13 is_stmt 0 view .LVU473
+	leaq	4(%r8), %rcx
+.LVL129:
+	.loc 3 513 5 is_stmt 1 view .LVU474
+	.loc 3 513 24 is_stmt 0 view .LVU475
+	sall	$18, %edx
+.LVL130:
+	.loc 3 514 39 view .LVU476
+	movb	3(%r8), %r8b
+.LVL131:
+	.loc 3 513 49 view .LVU477
+	sall	$12, %r9d
+	.loc 3 513 24 view .LVU478
+	andl	$1835008, %edx
+	.loc 3 513 49 view .LVU479
+	andl	$258048, %r9d
+	.loc 3 514 25 view .LVU480
+	sall	$6, %r10d
+	.loc 3 513 31 view .LVU481
+	orl	%r9d, %edx
+	.loc 3 514 39 view .LVU482
+	andl	$63, %r8d
+	.loc 3 514 25 view .LVU483
+	andl	$4032, %r10d
+	.loc 3 514 31 view .LVU484
+	orl	%r8d, %edx
+	orl	%r10d, %edx
+.LVL132:
+	.loc 3 514 31 view .LVU485
+.LBE252:
+.LBE259:
+.LBB260:
+	.loc 3 478 25 is_stmt 1 view .LVU486
+.LBB256:
+	.loc 3 480 5 view .LVU487
+	.loc 3 480 8 is_stmt 0 view .LVU488
+	cmpl	$65535, %edx
+	jbe	.L96
+	.loc 3 481 9 is_stmt 1 view .LVU489
+	.loc 3 481 11 is_stmt 0 view .LVU490
+	subl	$65536, %edx
+.LVL133:
+	.loc 3 482 9 is_stmt 1 view .LVU491
+	.loc 3 483 11 is_stmt 0 view .LVU492
+	addq	$4, %rax
+.LVL134:
+	.loc 3 482 39 view .LVU493
+	movl	%edx, %r8d
+	.loc 3 483 39 view .LVU494
+	andw	$1023, %dx
+.LVL135:
+	.loc 3 482 39 view .LVU495
+	shrl	$10, %r8d
+.LVL136:
+	.loc 3 483 16 view .LVU496
+	subw	$9216, %dx
+	.loc 3 482 16 view .LVU497
+	subw	$10240, %r8w
+	.loc 3 483 16 view .LVU498
+	movw	%dx, -2(%rax)
+	.loc 3 482 16 view .LVU499
+	movw	%r8w, -4(%rax)
+	.loc 3 483 9 is_stmt 1 view .LVU500
+.LVL137:
+	.loc 3 483 9 is_stmt 0 view .LVU501
+	jmp	.L94
+.LVL138:
+.L96:
+	.loc 3 486 9 is_stmt 1 view .LVU502
+	.loc 3 486 16 is_stmt 0 view .LVU503
+	movw	%dx, (%rax)
+	.loc 3 486 11 view .LVU504
+	addq	$2, %rax
+.LVL139:
+.L94:
+	.loc 3 483 11 view .LVU505
+	movq	%rcx, %r8
+	jmp	.L91
+.LVL140:
+.L109:
+	.loc 3 483 11 view .LVU506
+.LBE256:
+.LBE260:
+.LBE218:
+	.loc 1 422 5 view .LVU507
+	movq	%rdi, %rax
+.LVL141:
+.L92:
+.LBB261:
+	.loc 1 447 18 is_stmt 1 view .LVU508
+	cmpq	%rsi, %r8
+	jnb	.L111
+	.loc 1 449 13 view .LVU509
+	.loc 1 449 20 is_stmt 0 view .LVU510
+	movq	%rsi, %rdx
+	subq	%r8, %rdx
+	.loc 1 449 16 view .LVU511
+	cmpq	$15, %rdx
+	jle	.L100
+.LBB262:
+	.loc 1 450 17 is_stmt 1 view .LVU512
+.LVL142:
+.LBB263:
+.LBI263:
+	.loc 2 701 1 view .LVU513
+.LBB264:
+	.loc 2 703 3 view .LVU514
+	.loc 2 703 3 is_stmt 0 view .LVU515
+.LBE264:
+.LBE263:
+	.loc 1 451 17 is_stmt 1 view .LVU516
+.LBB266:
+.LBI266:
+	.loc 2 1431 1 view .LVU517
+.LBB267:
+	.loc 2 1433 3 view .LVU518
+.LBE267:
+.LBE266:
+.LBB269:
+.LBB265:
+	.loc 2 703 10 is_stmt 0 view .LVU519
+	movups	(%r8), %xmm0
+.LBE265:
+.LBE269:
+.LBB270:
+.LBB268:
+	.loc 2 1433 10 view .LVU520
+	pmovmskb	%xmm0, %edx
+.LVL143:
+	.loc 2 1433 10 view .LVU521
+.LBE268:
+.LBE270:
+	.loc 1 451 20 view .LVU522
+	testl	%edx, %edx
+	jne	.L100
+.LBB271:
+	.loc 1 452 21 is_stmt 1 view .LVU523
+.LVL144:
+	.loc 1 453 21 view .LVU524
+.LBB272:
+.LBI272:
+	.loc 2 1028 1 view .LVU525
+.LBB273:
+	.loc 2 1030 3 view .LVU526
+	.loc 2 1030 19 is_stmt 0 view .LVU527
+	xorps	%xmm1, %xmm1
+	movaps	%xmm0, %xmm2
+.LBE273:
+.LBE272:
+	.loc 1 459 23 view .LVU528
+	addq	$16, %r8
+.LVL145:
+	.loc 1 460 23 view .LVU529
+	addq	$64, %rax
+.LVL146:
+.LBB275:
+.LBB274:
+	.loc 2 1030 19 view .LVU530
+	punpcklbw	%xmm1, %xmm2
+.LVL147:
+	.loc 2 1030 19 view .LVU531
+.LBE274:
+.LBE275:
+	.loc 1 454 21 is_stmt 1 view .LVU532
+.LBB276:
+.LBI276:
+	.loc 2 1004 1 view .LVU533
+.LBB277:
+	.loc 2 1006 3 view .LVU534
+	.loc 2 1006 19 is_stmt 0 view .LVU535
+	punpckhbw	%xmm1, %xmm0
+.LVL148:
+	.loc 2 1006 19 view .LVU536
+.LBE277:
+.LBE276:
+	.loc 1 455 21 is_stmt 1 view .LVU537
+.LBB278:
+.LBI278:
+	.loc 2 1034 1 view .LVU538
+.LBB279:
+	.loc 2 1036 3 view .LVU539
+	.loc 2 1036 19 is_stmt 0 view .LVU540
+	xorps	%xmm1, %xmm1
+	movaps	%xmm2, %xmm3
+.LBE279:
+.LBE278:
+.LBB281:
+.LBB282:
+	.loc 2 1012 19 view .LVU541
+	punpckhwd	%xmm1, %xmm2
+.LVL149:
+	.loc 2 1012 19 view .LVU542
+.LBE282:
+.LBE281:
+.LBB284:
+.LBB285:
+	.loc 2 739 8 view .LVU543
+	movups	%xmm2, -48(%rax)
+.LVL150:
+	.loc 2 739 8 view .LVU544
+.LBE285:
+.LBE284:
+.LBB287:
+.LBB288:
+	.loc 2 1036 19 view .LVU545
+	movaps	%xmm0, %xmm2
+.LBE288:
+.LBE287:
+.LBB291:
+.LBB280:
+	punpcklwd	%xmm1, %xmm3
+.LVL151:
+	.loc 2 1036 19 view .LVU546
+.LBE280:
+.LBE291:
+.LBB292:
+.LBI292:
+	.loc 2 737 1 is_stmt 1 view .LVU547
+.LBB293:
+	.loc 2 739 3 view .LVU548
+.LBE293:
+.LBE292:
+.LBB295:
+.LBB296:
+	.loc 2 1012 19 is_stmt 0 view .LVU549
+	punpckhwd	%xmm1, %xmm0
+.LVL152:
+	.loc 2 1012 19 view .LVU550
+.LBE296:
+.LBE295:
+.LBB298:
+.LBB289:
+	.loc 2 1036 19 view .LVU551
+	punpcklwd	%xmm1, %xmm2
+.LBE289:
+.LBE298:
+.LBB299:
+.LBB294:
+	.loc 2 739 8 view .LVU552
+	movups	%xmm3, -64(%rax)
+.LVL153:
+	.loc 2 739 8 view .LVU553
+.LBE294:
+.LBE299:
+	.loc 1 456 21 is_stmt 1 view .LVU554
+.LBB300:
+.LBI281:
+	.loc 2 1010 1 view .LVU555
+.LBB283:
+	.loc 2 1012 3 view .LVU556
+	.loc 2 1012 3 is_stmt 0 view .LVU557
+.LBE283:
+.LBE300:
+.LBB301:
+.LBI284:
+	.loc 2 737 1 is_stmt 1 view .LVU558
+.LBB286:
+	.loc 2 739 3 view .LVU559
+.LBE286:
+.LBE301:
+	.loc 1 457 21 view .LVU560
+.LBB302:
+.LBI287:
+	.loc 2 1034 1 view .LVU561
+.LBB290:
+	.loc 2 1036 3 view .LVU562
+	.loc 2 1036 3 is_stmt 0 view .LVU563
+.LBE290:
+.LBE302:
+.LBB303:
+.LBI303:
+	.loc 2 737 1 is_stmt 1 view .LVU564
+.LBB304:
+	.loc 2 739 3 view .LVU565
+	.loc 2 739 8 is_stmt 0 view .LVU566
+	movups	%xmm2, -32(%rax)
+.LVL154:
+	.loc 2 739 8 view .LVU567
+.LBE304:
+.LBE303:
+	.loc 1 458 21 is_stmt 1 view .LVU568
+.LBB305:
+.LBI295:
+	.loc 2 1010 1 view .LVU569
+.LBB297:
+	.loc 2 1012 3 view .LVU570
+	.loc 2 1012 3 is_stmt 0 view .LVU571
+.LBE297:
+.LBE305:
+.LBB306:
+.LBI306:
+	.loc 2 737 1 is_stmt 1 view .LVU572
+.LBB307:
+	.loc 2 739 3 view .LVU573
+	.loc 2 739 8 is_stmt 0 view .LVU574
+	movups	%xmm0, -16(%rax)
+.LVL155:
+	.loc 2 739 8 view .LVU575
+.LBE307:
+.LBE306:
+	.loc 1 459 21 is_stmt 1 view .LVU576
+	.loc 1 460 21 view .LVU577
+	.loc 1 461 21 view .LVU578
+	jmp	.L92
+.LVL156:
+.L100:
+	.loc 1 461 21 is_stmt 0 view .LVU579
+.LBE271:
+.LBE262:
+	.loc 1 465 13 is_stmt 1 view .LVU580
+.LBB308:
+.LBB309:
+	.loc 3 499 14 is_stmt 0 view .LVU581
+	movzbl	(%r8), %edx
+.LBE309:
+.LBE308:
+	.loc 1 465 15 view .LVU582
+	leaq	4(%rax), %rcx
+.LVL157:
+.LBB311:
+.LBI308:
+	.loc 3 496 24 is_stmt 1 view .LVU583
+.LBB310:
+	.loc 3 498 5 view .LVU584
+	.loc 3 499 5 view .LVU585
+	.loc 3 500 5 view .LVU586
+	.loc 3 500 8 is_stmt 0 view .LVU587
+	cmpl	$127, %edx
+	ja	.L102
+	.loc 3 501 9 is_stmt 1 view .LVU588
+	.loc 3 501 17 is_stmt 0 view .LVU589
+	incq	%r8
+.LVL158:
+	.loc 3 502 9 is_stmt 1 view .LVU590
+	.loc 3 502 16 is_stmt 0 view .LVU591
+	jmp	.L103
+.LVL159:
+.L102:
+	.loc 3 504 5 is_stmt 1 view .LVU592
+	.loc 3 506 38 is_stmt 0 view .LVU593
+	movzbl	1(%r8), %r9d
+	.loc 3 504 8 view .LVU594
+	cmpl	$223, %edx
+	ja	.L104
+	.loc 3 505 9 is_stmt 1 view .LVU595
+	.loc 3 506 28 is_stmt 0 view .LVU596
+	sall	$6, %edx
+.LVL160:
+	.loc 3 506 42 view .LVU597
+	andl	$63, %r9d
+	.loc 3 505 17 view .LVU598
+	addq	$2, %r8
+.LVL161:
+	.loc 3 506 9 is_stmt 1 view .LVU599
+	.loc 3 506 28 is_stmt 0 view .LVU600
+	andl	$1984, %edx
+	.loc 3 506 34 view .LVU601
+	orl	%r9d, %edx
+	jmp	.L103
+.LVL162:
+.L104:
+	.loc 3 508 5 is_stmt 1 view .LVU602
+	.loc 3 510 63 is_stmt 0 view .LVU603
+	movb	2(%r8), %r10b
+	.loc 3 508 8 view .LVU604
+	cmpl	$239, %edx
+	ja	.L105
+	.loc 3 509 9 is_stmt 1 view .LVU605
+	.loc 3 510 28 is_stmt 0 view .LVU606
+	sall	$12, %edx
+.LVL163:
+	.loc 3 510 53 view .LVU607
+	sall	$6, %r9d
+	.loc 3 510 67 view .LVU608
+	andl	$63, %r10d
+	.loc 3 509 17 view .LVU609
+	addq	$3, %r8
+.LVL164:
+	.loc 3 510 9 is_stmt 1 view .LVU610
+	.loc 3 510 28 is_stmt 0 view .LVU611
+	movzwl	%dx, %edx
+	.loc 3 510 53 view .LVU612
+	andl	$4032, %r9d
+	.loc 3 510 35 view .LVU613
+	orl	%r9d, %edx
+	.loc 3 510 59 view .LVU614
+	orl	%r10d, %edx
+	jmp	.L103
+.LVL165:
+.L105:
+	.loc 3 512 5 is_stmt 1 view .LVU615
+	.loc 3 513 5 view .LVU616
+	.loc 3 513 24 is_stmt 0 view .LVU617
+	sall	$18, %edx
+.LVL166:
+	.loc 3 513 49 view .LVU618
+	sall	$12, %r9d
+	.loc 3 512 9 view .LVU619
+	addq	$4, %r8
+.LVL167:
+	.loc 3 513 49 view .LVU620
+	andl	$258048, %r9d
+	.loc 3 513 24 view .LVU621
+	andl	$1835008, %edx
+	.loc 3 514 25 view .LVU622
+	sall	$6, %r10d
+	.loc 3 513 31 view .LVU623
+	orl	%r9d, %edx
+	.loc 3 514 39 view .LVU624
+	movb	-1(%r8), %r9b
+	.loc 3 514 25 view .LVU625
+	andl	$4032, %r10d
+	.loc 3 514 39 view .LVU626
+	andl	$63, %r9d
+	.loc 3 514 31 view .LVU627
+	orl	%r9d, %edx
+	orl	%r10d, %edx
+.LVL168:
+.L103:
+	.loc 3 514 31 view .LVU628
+.LBE310:
+.LBE311:
+	.loc 1 465 18 view .LVU629
+	movl	%edx, (%rax)
+	.loc 1 465 15 view .LVU630
+	movq	%rcx, %rax
+	jmp	.L92
+.LVL169:
+.L111:
+	.loc 1 467 9 is_stmt 1 view .LVU631
+	.loc 1 467 35 is_stmt 0 view .LVU632
+	subq	%rdi, %rax
+.LVL170:
+	.loc 1 467 35 view .LVU633
+.LBE261:
+	.loc 1 471 1 view .LVU634
+	ret
+	.cfi_endproc
+.LFE550:
+	.size	va_char_p_transcode_utf8, .-va_char_p_transcode_utf8
+	.section	.rodata.str1.1
+.LC7:
+	.string	"iter->vtab == &va_char_p_read_vtab_utf8"
+	.text
+	.globl	va_char_p_set_chunk_mode
+	.type	va_char_p_set_chunk_mode, @function
+va_char_p_set_chunk_mode:
+.LVL171:
+.LFB541:
+	.loc 1 79 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 80 4 view .LVU636
+	.loc 1 80 36 is_stmt 0 view .LVU637
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	cmpq	%rax, (%rdi)
+	je	.L114
+.LBB314:
+.LBI314:
+	.loc 1 77 13 is_stmt 1 view .LVU638
+.LVL172:
+.LBB315:
+	.loc 1 80 13 view .LVU639
+.LBE315:
+.LBE314:
+	.loc 1 79 1 is_stmt 0 view .LVU640
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB317:
+.LBB316:
+	.loc 1 80 13 view .LVU641
+	leaq	__PRETTY_FUNCTION__.3(%rip), %rcx
+	movl	$80, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC7(%rip), %rdi
+.LVL173:
+	.loc 1 80 13 view .LVU642
+	call	__assert_fail@PLT
+.LVL174:
+.L114:
+	.cfi_def_cfa_offset 8
+	.loc 1 80 13 view .LVU643
+.LBE316:
+.LBE317:
+	.loc 1 81 5 is_stmt 1 view .LVU644
+	.loc 1 81 16 is_stmt 0 view .LVU645
+	leaq	va_char_p_read_vtab_utf8_chunk(%rip), %rax
+	movq	%rax, (%rdi)
+	ret
+	.cfi_endproc
+.LFE541:
+	.size	va_char_p_set_chunk_mode, .-va_char_p_set_chunk_mode
+	.section	.rodata.str1.1
+.LC8:
+	.string	"iter->vtab == &va_span_p_read_vtab_utf8"
+	.text
+	.globl	va_span_p_set_chunk_mode
+	.type	va_span_p_set_chunk_mode, @function
+va_span_p_set_chunk_mode:
+.LVL175:
+.LFB542:
+	.loc 1 86 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 87 4 view .LVU647
+	.loc 1 87 36 is_stmt 0 view .LVU648
+	leaq	va_span_p_read_vtab_utf8(%rip), %rax
+	cmpq	%rax, (%rdi)
+	je	.L119
+.LBB320:
+.LBI320:
+	.loc 1 84 13 is_stmt 1 view .LVU649
+.LVL176:
+.LBB321:
+	.loc 1 87 13 view .LVU650
+.LBE321:
+.LBE320:
+	.loc 1 86 1 is_stmt 0 view .LVU651
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB323:
+.LBB322:
+	.loc 1 87 13 view .LVU652
+	leaq	__PRETTY_FUNCTION__.2(%rip), %rcx
+	movl	$87, %edx
+	leaq	.LC0(%rip), %rsi
+	leaq	.LC8(%rip), %rdi
+.LVL177:
+	.loc 1 87 13 view .LVU653
+	call	__assert_fail@PLT
+.LVL178:
+.L119:
+	.cfi_def_cfa_offset 8
+	.loc 1 87 13 view .LVU654
+.LBE322:
+.LBE323:
+	.loc 1 88 5 is_stmt 1 view .LVU655
+	.loc 1 88 16 is_stmt 0 view .LVU656
+	leaq	va_span_p_read_vtab_utf8_chunk(%rip), %rax
+	movq	%rax, (%rdi)
+	ret
+	.cfi_endproc
+.LFE542:
+	.size	va_span_p_set_chunk_mode, .-va_span_p_set_chunk_mode
+	.section	.rodata.str1.1
+.LC9:
+	.string	"iter_super->cur != NULL"
+	.text
+	.globl	va_span_p_take_utf8
+	.type	va_span_p_take_utf8, @function
+va_span_p_take_utf8:
+.LVL179:
+.LFB559:
+	.loc 1 616 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 617 4 view .LVU658
+	.loc 1 617 14 is_stmt 0 view .LVU659
+	movq	8(%rdi), %rdx
+	.loc 1 617 47 view .LVU660
+	testq	%rdx, %rdx
+	jne	.L124
+.LBB327:
+.LBI327:
+	.loc 1 613 17 is_stmt 1 view .LVU661
+.LVL180:
+.LBB328:
+	.loc 1 617 24 view .LVU662
+.LBE328:
+.LBE327:
+	.loc 1 616 1 is_stmt 0 view .LVU663
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+.LBB330:
+.LBB329:
+	.loc 1 617 24 view .LVU664
+	leaq	__PRETTY_FUNCTION__.0(%rip), %rcx
+	movl	$617, %edx
+	leaq	.LC0(%rip), %rsi
+.LVL181:
+	.loc 1 617 24 view .LVU665
+	leaq	.LC9(%rip), %rdi
+.LVL182:
+	.loc 1 617 24 view .LVU666
+	call	__assert_fail@PLT
+.LVL183:
+.L124:
+	.cfi_def_cfa_offset 8
+	.loc 1 617 24 view .LVU667
+	movq	%rsi, %rax
+.LBE329:
+.LBE330:
+	.loc 1 618 5 is_stmt 1 view .LVU668
+	.loc 1 618 34 view .LVU669
+.LVL184:
+	.loc 1 618 82 view .LVU670
+	.loc 1 618 115 view .LVU671
+	.loc 1 618 33 view .LVU672
+	.loc 1 618 129 view .LVU673
+	.loc 1 618 167 view .LVU674
+	.loc 1 618 180 view .LVU675
+	.loc 1 619 5 view .LVU676
+	.loc 1 619 32 is_stmt 0 view .LVU677
+	movq	16(%rdi), %rsi
+.LVL185:
+	.loc 1 619 8 view .LVU678
+	cmpq	%rsi, %rdx
+	je	.L125
+	.loc 1 623 5 is_stmt 1 view .LVU679
+	.loc 1 623 8 is_stmt 0 view .LVU680
+	testq	%rax, %rax
+	je	.L126
+	cmpq	%rax, %rsi
+	cmova	%rax, %rsi
+.L126:
+.LVL186:
+	.loc 1 626 5 is_stmt 1 view .LVU681
+	.loc 1 626 12 is_stmt 0 view .LVU682
+	jmp	va_char_p_take_utf8
+.LVL187:
+.L125:
+	.loc 1 627 1 view .LVU683
+	orl	$-1, %eax
+.LVL188:
+	.loc 1 627 1 view .LVU684
+	ret
+	.cfi_endproc
+.LFE559:
+	.size	va_span_p_take_utf8, .-va_span_p_take_utf8
+	.globl	va_put_utf8
+	.type	va_put_utf8, @function
+va_put_utf8:
+.LVL189:
+.LFB551:
+	.loc 1 477 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 479 5 view .LVU686
+	.loc 1 477 1 is_stmt 0 view .LVU687
+	pushq	%r14
+	.cfi_def_cfa_offset 16
+	.cfi_offset 14, -16
+	.loc 1 479 8 view .LVU688
+	movl	%esi, %eax
+	.loc 1 477 1 view .LVU689
+	pushq	%r13
+	.cfi_def_cfa_offset 24
+	.cfi_offset 13, -24
+	pushq	%r12
+	.cfi_def_cfa_offset 32
+	.cfi_offset 12, -32
+	movq	%rdx, %r12
+	pushq	%rbp
+	.cfi_def_cfa_offset 40
+	.cfi_offset 6, -40
+	movq	%rdi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 48
+	.cfi_offset 3, -48
+	movl	%esi, %ebx
+	subq	$16, %rsp
+	.cfi_def_cfa_offset 64
+	.loc 1 479 8 view .LVU690
+	andl	$520093696, %eax
+	je	.L134
+	.loc 1 480 9 is_stmt 1 view .LVU691
+	.loc 1 480 12 is_stmt 0 view .LVU692
+	cmpl	$16777216, %eax
+	jne	.L135
+	.loc 1 482 13 is_stmt 1 view .LVU693
+.LVL190:
+.LBB331:
+.LBI331:
+	.loc 3 585 19 view .LVU694
+.LBB332:
+	.loc 3 587 5 view .LVU695
+.LBB333:
+.LBI333:
+	.loc 3 574 22 view .LVU696
+.LBB334:
+	.loc 3 576 5 view .LVU697
+	.loc 3 576 5 is_stmt 0 view .LVU698
+.LBE334:
+.LBE333:
+	.loc 3 587 8 view .LVU699
+	movq	40(%rdi), %rax
+	cmpq	%rax, 48(%rdi)
+	jne	.L136
+	.loc 3 590 5 is_stmt 1 view .LVU700
+	.loc 3 590 20 is_stmt 0 view .LVU701
+	movq	(%rdi), %rax
+	movq	24(%rax), %rax
+	.loc 3 590 37 view .LVU702
+	testq	%rax, %rax
+	jne	.L137
+.LVL191:
+.L138:
+	.loc 3 590 37 view .LVU703
+.LBE332:
+.LBE331:
+	.loc 1 488 13 is_stmt 1 view .LVU704
+	.loc 1 539 1 is_stmt 0 view .LVU705
+	addq	$16, %rsp
+	.cfi_remember_state
+	.cfi_def_cfa_offset 48
+	.loc 1 488 13 view .LVU706
+	movsbl	%bl, %esi
+	movq	%rbp, %rdi
+	movq	%r12, %rax
+	.loc 1 539 1 view .LVU707
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+.LVL192:
+	.loc 1 539 1 view .LVU708
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL193:
+	.loc 1 539 1 view .LVU709
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL194:
+	.loc 1 539 1 view .LVU710
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	.loc 1 488 13 view .LVU711
+	jmp	*%rax
+.LVL195:
+.L137:
+	.cfi_restore_state
+.LBB336:
+.LBB335:
+	.loc 3 590 40 view .LVU712
+	movl	$1, %esi
+	call	*%rax
+.LVL196:
+	.loc 3 590 37 view .LVU713
+	testb	%al, %al
+	je	.L138
+.L136:
+.LVL197:
+	.loc 3 590 37 view .LVU714
+.LBE335:
+.LBE336:
+.LBB337:
+	.loc 1 483 17 is_stmt 1 view .LVU715
+	.loc 1 483 23 is_stmt 0 view .LVU716
+	movq	40(%rbp), %rax
+.LVL198:
+	.loc 1 484 17 is_stmt 1 view .LVU717
+	.loc 1 484 24 is_stmt 0 view .LVU718
+	movb	%bl, (%rax)
+	.loc 1 485 17 is_stmt 1 view .LVU719
+	.loc 1 484 19 is_stmt 0 view .LVU720
+	incq	%rax
+.LVL199:
+	.loc 1 484 19 view .LVU721
+	movq	%rax, 40(%rbp)
+	.loc 1 486 17 is_stmt 1 view .LVU722
+	jmp	.L133
+.LVL200:
+.L135:
+	.loc 1 486 17 is_stmt 0 view .LVU723
+.LBE337:
+	.loc 1 492 9 is_stmt 1 view .LVU724
+	.loc 1 492 12 is_stmt 0 view .LVU725
+	testl	%esi, %esi
+	jns	.L140
+	jmp	.L133
+.L134:
+	.loc 1 499 5 is_stmt 1 view .LVU726
+.LVL201:
+.LBB338:
+.LBI338:
+	.loc 3 419 19 view .LVU727
+.LBB339:
+	.loc 3 421 5 view .LVU728
+	.loc 3 421 26 is_stmt 0 view .LVU729
+	leal	-55296(%rsi), %eax
+.LBE339:
+.LBE338:
+	.loc 1 499 8 view .LVU730
+	cmpl	$2047, %eax
+	jbe	.L154
+	cmpl	$1114111, %esi
+	jbe	.L141
+.L154:
+	.loc 1 500 9 is_stmt 1 view .LVU731
+.LVL202:
+.LBB340:
+.LBI340:
+	.loc 3 425 20 view .LVU732
+.LBB341:
+	.loc 3 427 5 view .LVU733
+	.loc 3 427 13 is_stmt 0 view .LVU734
+	movl	32(%rbp), %eax
+	.loc 3 427 8 view .LVU735
+	testl	$939524096, %eax
+	je	.L143
+.LVL203:
+.L140:
+	.loc 3 427 8 view .LVU736
+.LBE341:
+.LBE340:
+	.loc 1 477 1 view .LVU737
+	movl	$65533, %ebx
+	jmp	.L144
+.LVL204:
+.L143:
+.LBB344:
+.LBB343:
+	.loc 3 428 9 is_stmt 1 view .LVU738
+.LBB342:
+	.loc 3 428 25 view .LVU739
+	.loc 3 428 62 view .LVU740
+	.loc 3 428 101 is_stmt 0 view .LVU741
+	andl	$-939524097, %eax
+	.loc 3 428 123 view .LVU742
+	orl	$402653184, %eax
+	movl	%eax, 32(%rbp)
+.LVL205:
+	.loc 3 428 123 view .LVU743
+.LBE342:
+.LBE343:
+.LBE344:
+	.loc 1 511 10 is_stmt 1 view .LVU744
+	.loc 1 516 10 view .LVU745
+	jmp	.L140
+.LVL206:
+.L141:
+	.loc 1 505 5 view .LVU746
+	.loc 1 506 5 view .LVU747
+	.loc 1 507 5 view .LVU748
+	.loc 1 507 8 is_stmt 0 view .LVU749
+	cmpl	$127, %esi
+	ja	.L146
+	.loc 1 508 9 is_stmt 1 view .LVU750
+	.loc 1 508 18 is_stmt 0 view .LVU751
+	movb	%sil, 12(%rsp)
+	.loc 1 509 9 is_stmt 1 view .LVU752
+.LVL207:
+	.loc 1 509 11 is_stmt 0 view .LVU753
+	movl	$1, %ebx
+.LVL208:
+	.loc 1 509 11 view .LVU754
+	jmp	.L147
+.LVL209:
+.L146:
+	.loc 1 511 10 is_stmt 1 view .LVU755
+	.loc 1 513 40 is_stmt 0 view .LVU756
+	movl	%esi, %ecx
+	.loc 1 512 34 view .LVU757
+	movl	%esi, %eax
+	.loc 1 513 40 view .LVU758
+	andl	$63, %ecx
+	.loc 1 512 34 view .LVU759
+	shrl	$6, %eax
+	.loc 1 513 28 view .LVU760
+	orl	$-128, %ecx
+	.loc 1 511 13 view .LVU761
+	cmpl	$2047, %esi
+	ja	.L148
+	.loc 1 512 9 is_stmt 1 view .LVU762
+	.loc 1 512 28 is_stmt 0 view .LVU763
+	orl	$-64, %eax
+	.loc 1 513 14 view .LVU764
+	movb	%cl, 13(%rsp)
+	.loc 1 514 11 view .LVU765
+	movl	$2, %ebx
+	.loc 1 512 28 view .LVU766
+	movb	%al, 12(%rsp)
+	.loc 1 513 9 is_stmt 1 view .LVU767
+	.loc 1 514 9 view .LVU768
+.LVL210:
+	.loc 1 514 9 is_stmt 0 view .LVU769
+	jmp	.L147
+.LVL211:
+.L148:
+	.loc 1 516 10 is_stmt 1 view .LVU770
+	.loc 1 524 34 is_stmt 0 view .LVU771
+	movl	%esi, %edx
+.LVL212:
+	.loc 1 525 40 view .LVU772
+	andl	$63, %eax
+	.loc 1 524 34 view .LVU773
+	shrl	$12, %edx
+	.loc 1 525 28 view .LVU774
+	orl	$-128, %eax
+	.loc 1 516 13 view .LVU775
+	cmpl	$65535, %esi
+	ja	.L149
+.L144:
+	.loc 1 517 9 is_stmt 1 view .LVU776
+	.loc 1 517 34 is_stmt 0 view .LVU777
+	movl	%ebx, %eax
+	shrl	$12, %eax
+	.loc 1 517 28 view .LVU778
+	orl	$-32, %eax
+	movb	%al, 12(%rsp)
+	.loc 1 518 9 is_stmt 1 view .LVU779
+	.loc 1 518 34 is_stmt 0 view .LVU780
+	movl	%ebx, %eax
+	.loc 1 519 40 view .LVU781
+	andl	$63, %ebx
+	.loc 1 518 34 view .LVU782
+	shrl	$6, %eax
+	.loc 1 519 28 view .LVU783
+	orl	$-128, %ebx
+	.loc 1 518 40 view .LVU784
+	andl	$63, %eax
+	.loc 1 519 28 view .LVU785
+	movb	%bl, 14(%rsp)
+	.loc 1 520 11 view .LVU786
+	movl	$3, %ebx
+	.loc 1 518 28 view .LVU787
+	orl	$-128, %eax
+	movb	%al, 13(%rsp)
+	.loc 1 519 9 is_stmt 1 view .LVU788
+	.loc 1 520 9 view .LVU789
+.LVL213:
+	.loc 1 520 9 is_stmt 0 view .LVU790
+	jmp	.L147
+.LVL214:
+.L149:
+	.loc 1 523 9 is_stmt 1 view .LVU791
+	.loc 1 524 41 is_stmt 0 view .LVU792
+	andl	$63, %edx
+	.loc 1 523 34 view .LVU793
+	shrl	$18, %ebx
+	.loc 1 525 14 view .LVU794
+	movb	%al, 14(%rsp)
+	.loc 1 524 28 view .LVU795
+	orl	$-128, %edx
+	.loc 1 526 14 view .LVU796
+	movb	%cl, 15(%rsp)
+	.loc 1 523 28 view .LVU797
+	orl	$-16, %ebx
+	.loc 1 524 28 view .LVU798
+	movb	%dl, 13(%rsp)
+	.loc 1 523 28 view .LVU799
+	movb	%bl, 12(%rsp)
+	.loc 1 524 9 is_stmt 1 view .LVU800
+	.loc 1 525 9 view .LVU801
+	.loc 1 526 9 view .LVU802
+	.loc 1 527 9 view .LVU803
+.LVL215:
+	.loc 1 527 11 is_stmt 0 view .LVU804
+	movl	$4, %ebx
+.LVL216:
+.L147:
+	.loc 1 531 5 is_stmt 1 view .LVU805
+.LBB345:
+.LBI345:
+	.loc 3 585 19 view .LVU806
+.LBB346:
+	.loc 3 587 5 view .LVU807
+.LBB347:
+.LBI347:
+	.loc 3 574 22 view .LVU808
+.LBB348:
+	.loc 3 576 5 view .LVU809
+	.loc 3 576 39 is_stmt 0 view .LVU810
+	movq	48(%rbp), %rax
+	subq	40(%rbp), %rax
+	leaq	12(%rsp), %r14
+.LBE348:
+.LBE347:
+	.loc 3 587 8 view .LVU811
+	cmpq	%rbx, %rax
+	jb	.L150
+.LVL217:
+.L152:
+	.loc 3 587 8 view .LVU812
+.LBE346:
+.LBE345:
+	.loc 1 532 9 is_stmt 1 view .LVU813
+	movq	40(%rbp), %rdi
+	movq	%r14, %rsi
+	movq	%rbx, %rcx
+	rep movsb
+	.loc 1 533 9 view .LVU814
+	.loc 1 533 40 is_stmt 0 view .LVU815
+	addq	%rbx, 40(%rbp)
+	.loc 1 534 9 is_stmt 1 view .LVU816
+	jmp	.L133
+.LVL218:
+.L150:
+.LBB350:
+.LBB349:
+	.loc 3 590 5 view .LVU817
+	.loc 3 590 20 is_stmt 0 view .LVU818
+	movq	0(%rbp), %rax
+	movq	24(%rax), %rax
+	.loc 3 590 37 view .LVU819
+	testq	%rax, %rax
+	je	.L151
+	.loc 3 590 40 view .LVU820
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+.LVL219:
+	.loc 3 590 40 view .LVU821
+	call	*%rax
+.LVL220:
+	.loc 3 590 37 view .LVU822
+	testb	%al, %al
+	jne	.L152
+.L151:
+.LVL221:
+	.loc 3 590 37 view .LVU823
+.LBE349:
+.LBE350:
+	.loc 1 527 11 view .LVU824
+	xorl	%r13d, %r13d
+.L153:
+.LVL222:
+.LBB351:
+	.loc 1 537 9 is_stmt 1 discriminator 3 view .LVU825
+	movsbl	(%r14,%r13), %esi
+	.loc 1 536 32 is_stmt 0 discriminator 3 view .LVU826
+	incq	%r13
+.LVL223:
+	.loc 1 537 9 discriminator 3 view .LVU827
+	movq	%rbp, %rdi
+	call	*%r12
+.LVL224:
+	.loc 1 536 32 is_stmt 1 discriminator 3 view .LVU828
+	.loc 1 536 26 discriminator 3 view .LVU829
+	cmpq	%r13, %rbx
+	jne	.L153
+.LVL225:
+.L133:
+	.loc 1 536 26 is_stmt 0 discriminator 3 view .LVU830
+.LBE351:
+	.loc 1 539 1 view .LVU831
+	addq	$16, %rsp
+	.cfi_def_cfa_offset 48
+	popq	%rbx
+	.cfi_def_cfa_offset 40
+	popq	%rbp
+	.cfi_def_cfa_offset 32
+.LVL226:
+	.loc 1 539 1 view .LVU832
+	popq	%r12
+	.cfi_def_cfa_offset 24
+.LVL227:
+	.loc 1 539 1 view .LVU833
+	popq	%r13
+	.cfi_def_cfa_offset 16
+	popq	%r14
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE551:
+	.size	va_put_utf8, .-va_put_utf8
+	.globl	va_len_utf8
+	.type	va_len_utf8, @function
+va_len_utf8:
+.LVL228:
+.LFB552:
+	.loc 1 544 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 546 5 view .LVU835
+	.loc 1 546 8 is_stmt 0 view .LVU836
+	movl	%esi, %edx
+	andl	$520093696, %edx
+	je	.L167
+	.loc 1 547 9 is_stmt 1 view .LVU837
+	.loc 1 548 20 is_stmt 0 view .LVU838
+	movl	$1, %eax
+	.loc 1 547 12 view .LVU839
+	cmpl	$16777216, %edx
+	je	.L166
+	.loc 1 550 9 is_stmt 1 view .LVU840
+	.loc 1 551 20 is_stmt 0 view .LVU841
+	xorl	%eax, %eax
+	.loc 1 550 12 view .LVU842
+	testl	%esi, %esi
+	jns	.L174
+	jmp	.L166
+.L167:
+	.loc 1 557 5 is_stmt 1 view .LVU843
+.LVL229:
+.LBB352:
+.LBI352:
+	.loc 3 419 19 view .LVU844
+.LBB353:
+	.loc 3 421 5 view .LVU845
+	.loc 3 421 26 is_stmt 0 view .LVU846
+	leal	-55296(%rsi), %eax
+.LBE353:
+.LBE352:
+	.loc 1 557 8 view .LVU847
+	cmpl	$2047, %eax
+	jbe	.L178
+	cmpl	$1114111, %esi
+	jbe	.L170
+.L178:
+	.loc 1 558 9 is_stmt 1 view .LVU848
+.LVL230:
+.LBB354:
+.LBI354:
+	.loc 3 425 20 view .LVU849
+.LBB355:
+	.loc 3 427 5 view .LVU850
+	.loc 3 427 13 is_stmt 0 view .LVU851
+	movl	32(%rdi), %eax
+	.loc 3 427 8 view .LVU852
+	testl	$939524096, %eax
+	je	.L172
+.LVL231:
+.L174:
+	.loc 3 427 8 view .LVU853
+.LBE355:
+.LBE354:
+	.loc 1 559 11 view .LVU854
+	movl	$65533, %esi
+.LVL232:
+	.loc 1 559 11 view .LVU855
+	jmp	.L169
+.LVL233:
+.L172:
+.LBB358:
+.LBB357:
+	.loc 3 428 9 is_stmt 1 view .LVU856
+.LBB356:
+	.loc 3 428 25 view .LVU857
+	.loc 3 428 62 view .LVU858
+	.loc 3 428 101 is_stmt 0 view .LVU859
+	andl	$-939524097, %eax
+	.loc 3 428 123 view .LVU860
+	orl	$402653184, %eax
+	movl	%eax, 32(%rdi)
+	jmp	.L174
+.LVL234:
+.L170:
+	.loc 3 428 123 view .LVU861
+.LBE356:
+.LBE357:
+.LBE358:
+	.loc 1 561 5 is_stmt 1 view .LVU862
+.LBB359:
+.LBI359:
+	.loc 3 538 22 view .LVU863
+.LBB360:
+	.loc 3 540 5 view .LVU864
+	.loc 3 540 15 is_stmt 0 view .LVU865
+	movl	$1, %edx
+	cmpl	$127, %esi
+	jbe	.L173
+.LVL235:
+.L169:
+	.loc 3 540 15 view .LVU866
+	movl	$2, %edx
+.L173:
+	.loc 3 540 34 view .LVU867
+	xorl	%eax, %eax
+	cmpl	$2047, %esi
+	seta	%al
+	.loc 3 540 49 view .LVU868
+	xorl	%ecx, %ecx
+	cmpl	$65535, %esi
+	seta	%cl
+	.loc 3 540 44 view .LVU869
+	addl	%ecx, %eax
+	addl	%edx, %eax
+.L166:
+.LBE360:
+.LBE359:
+	.loc 1 562 1 view .LVU870
+	ret
+	.cfi_endproc
+.LFE552:
+	.size	va_len_utf8, .-va_len_utf8
+	.globl	va_xprintf_char_p_utf8
+	.type	va_xprintf_char_p_utf8, @function
+va_xprintf_char_p_utf8:
+.LVL236:
+.LFB553:
+	.loc 1 567 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 568 5 view .LVU872
+	.loc 1 567 1 is_stmt 0 view .LVU873
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	.loc 1 568 20 view .LVU874
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	movq	%rsi, 8(%rsp)
+	.loc 1 569 5 is_stmt 1 view .LVU875
+	.loc 1 569 12 is_stmt 0 view .LVU876
+	movq	%rsp, %rsi
+.LVL237:
+	.loc 1 568 20 view .LVU877
+	movq	%rax, (%rsp)
+	.loc 1 569 12 view .LVU878
+	call	va_xprintf_iter_local@PLT
+.LVL238:
+	.loc 1 570 1 view .LVU879
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE553:
+	.size	va_xprintf_char_p_utf8, .-va_xprintf_char_p_utf8
+	.globl	va_xprintf_char_const_pp_utf8
+	.type	va_xprintf_char_const_pp_utf8, @function
+va_xprintf_char_const_pp_utf8:
+.LVL239:
+.LFB554:
+	.loc 1 575 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 576 5 view .LVU881
+	.loc 1 575 1 is_stmt 0 view .LVU882
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	.loc 1 576 20 view .LVU883
+	leaq	va_char_p_read_vtab_utf8(%rip), %rax
+	.loc 1 575 1 view .LVU884
+	movq	%rsi, %rbp
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 576 20 view .LVU885
+	movq	%rax, (%rsp)
+	movq	(%rsi), %rax
+	.loc 1 577 11 view .LVU886
+	movq	%rsp, %rsi
+.LVL240:
+	.loc 1 576 20 view .LVU887
+	movq	%rax, 8(%rsp)
+	.loc 1 577 5 is_stmt 1 view .LVU888
+	.loc 1 577 11 is_stmt 0 view .LVU889
+	call	va_xprintf_iter_chunk@PLT
+.LVL241:
+	.loc 1 578 5 is_stmt 1 view .LVU890
+	.loc 1 578 8 is_stmt 0 view .LVU891
+	movq	8(%rsp), %rax
+	movq	%rax, 0(%rbp)
+	.loc 1 579 5 is_stmt 1 view .LVU892
+	.loc 1 580 1 is_stmt 0 view .LVU893
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 24
+	movq	%rbx, %rax
+	popq	%rbx
+	.cfi_def_cfa_offset 16
+.LVL242:
+	.loc 1 580 1 view .LVU894
+	popq	%rbp
+	.cfi_def_cfa_offset 8
+.LVL243:
+	.loc 1 580 1 view .LVU895
+	ret
+	.cfi_endproc
+.LFE554:
+	.size	va_xprintf_char_const_pp_utf8, .-va_xprintf_char_const_pp_utf8
+	.globl	va_xprintf_char_pp_utf8
+	.type	va_xprintf_char_pp_utf8, @function
+va_xprintf_char_pp_utf8:
+.LVL244:
+.LFB555:
+	.loc 1 585 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 586 5 view .LVU897
+	.loc 1 586 12 is_stmt 0 view .LVU898
+	jmp	va_xprintf_char_const_pp_utf8
+.LVL245:
+	.loc 1 586 12 view .LVU899
+	.cfi_endproc
+.LFE555:
+	.size	va_xprintf_char_pp_utf8, .-va_xprintf_char_pp_utf8
+	.globl	va_xprintf_last_char_p_utf8
+	.type	va_xprintf_last_char_p_utf8, @function
+va_xprintf_last_char_p_utf8:
+.LVL246:
+.LFB556:
+	.loc 1 592 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 593 5 view .LVU901
+	.loc 1 593 12 is_stmt 0 view .LVU902
+	orl	$64, 32(%rdi)
+	.loc 1 594 5 is_stmt 1 view .LVU903
+	.loc 1 594 12 is_stmt 0 view .LVU904
+	jmp	va_xprintf_char_p_utf8
+.LVL247:
+	.loc 1 594 12 view .LVU905
+	.cfi_endproc
+.LFE556:
+	.size	va_xprintf_last_char_p_utf8, .-va_xprintf_last_char_p_utf8
+	.globl	va_xprintf_last_char_const_pp_utf8
+	.type	va_xprintf_last_char_const_pp_utf8, @function
+va_xprintf_last_char_const_pp_utf8:
+.LVL248:
+.LFB557:
+	.loc 1 600 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 601 5 view .LVU907
+	.loc 1 601 12 is_stmt 0 view .LVU908
+	orl	$64, 32(%rdi)
+	.loc 1 602 5 is_stmt 1 view .LVU909
+	.loc 1 602 12 is_stmt 0 view .LVU910
+	jmp	va_xprintf_char_const_pp_utf8
+.LVL249:
+	.loc 1 602 12 view .LVU911
+	.cfi_endproc
+.LFE557:
+	.size	va_xprintf_last_char_const_pp_utf8, .-va_xprintf_last_char_const_pp_utf8
+	.globl	va_xprintf_last_char_pp_utf8
+	.type	va_xprintf_last_char_pp_utf8, @function
+va_xprintf_last_char_pp_utf8:
+.LFB566:
+	.cfi_startproc
+	.loc 1 605 21 is_stmt 1 view .LVU912
+	jmp	va_xprintf_last_char_const_pp_utf8
+	.cfi_endproc
+.LFE566:
+	.size	va_xprintf_last_char_pp_utf8, .-va_xprintf_last_char_pp_utf8
+	.globl	va_xprintf_span_p_utf8
+	.type	va_xprintf_span_p_utf8, @function
+va_xprintf_span_p_utf8:
+.LVL250:
+.LFB560:
+	.loc 1 632 1 view -0
+	.cfi_startproc
+	.loc 1 633 5 view .LVU914
+	.loc 1 632 1 is_stmt 0 view .LVU915
+	subq	$40, %rsp
+	.cfi_def_cfa_offset 48
+	.loc 1 633 24 view .LVU916
+	leaq	va_span_p_read_vtab_utf8(%rip), %rax
+	movq	%rax, (%rsp)
+	.loc 1 634 67 view .LVU917
+	movq	8(%rsi), %rax
+	.loc 1 633 24 view .LVU918
+	movq	%rax, 8(%rsp)
+	.loc 1 635 24 view .LVU919
+	addq	(%rsi), %rax
+	.loc 1 637 12 view .LVU920
+	movq	%rsp, %rsi
+.LVL251:
+	.loc 1 633 24 view .LVU921
+	movq	%rax, 16(%rsp)
+	.loc 1 637 5 is_stmt 1 view .LVU922
+	.loc 1 637 12 is_stmt 0 view .LVU923
+	call	va_xprintf_iter_local@PLT
+.LVL252:
+	.loc 1 638 1 view .LVU924
+	addq	$40, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE560:
+	.size	va_xprintf_span_p_utf8, .-va_xprintf_span_p_utf8
+	.globl	va_xprintf_last_span_p_utf8
+	.type	va_xprintf_last_span_p_utf8, @function
+va_xprintf_last_span_p_utf8:
+.LVL253:
+.LFB561:
+	.loc 1 643 1 is_stmt 1 view -0
+	.cfi_startproc
+	.loc 1 644 5 view .LVU926
+	.loc 1 644 12 is_stmt 0 view .LVU927
+	orl	$64, 32(%rdi)
+	.loc 1 645 5 is_stmt 1 view .LVU928
+	.loc 1 645 12 is_stmt 0 view .LVU929
+	jmp	va_xprintf_span_p_utf8
+.LVL254:
+	.loc 1 645 12 view .LVU930
+	.cfi_endproc
+.LFE561:
+	.size	va_xprintf_last_span_p_utf8, .-va_xprintf_last_span_p_utf8
+	.section	.rodata
+	.align 16
+	.type	__PRETTY_FUNCTION__.0, @object
+	.size	__PRETTY_FUNCTION__.0, 20
+__PRETTY_FUNCTION__.0:
+	.string	"va_span_p_take_utf8"
+	.align 16
+	.type	__PRETTY_FUNCTION__.1, @object
+	.size	__PRETTY_FUNCTION__.1, 20
+__PRETTY_FUNCTION__.1:
+	.string	"va_char_p_take_utf8"
+	.align 16
+	.type	__PRETTY_FUNCTION__.2, @object
+	.size	__PRETTY_FUNCTION__.2, 25
+__PRETTY_FUNCTION__.2:
+	.string	"va_span_p_set_chunk_mode"
+	.align 16
+	.type	__PRETTY_FUNCTION__.3, @object
+	.size	__PRETTY_FUNCTION__.3, 25
+__PRETTY_FUNCTION__.3:
+	.string	"va_char_p_set_chunk_mode"
+	.globl	va_span_p_read_vtab_utf8_chunk
+	.section	.rodata.str1.1
+.LC10:
+	.string	"char*"
+	.section	.data.rel.ro,"aw"
+	.align 32
+	.type	va_span_p_read_vtab_utf8_chunk, @object
+	.size	va_span_p_read_vtab_utf8_chunk, 56
+va_span_p_read_vtab_utf8_chunk:
+	.quad	.LC10
+	.quad	va_span_p_take_utf8
+	.quad	va_char_p_end
+	.quad	0
+	.quad	va_span_p_bulk_utf8
+	.quad	va_char_p_transcode_utf8
+	.byte	1
+	.byte	1
+	.byte	0
+	.byte	1
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_char_p_read_vtab_utf8_chunk
+	.align 32
+	.type	va_char_p_read_vtab_utf8_chunk, @object
+	.size	va_char_p_read_vtab_utf8_chunk, 56
+va_char_p_read_vtab_utf8_chunk:
+	.quad	.LC10
+	.quad	va_char_p_take_utf8
+	.quad	va_char_p_end
+	.quad	0
+	.quad	va_char_p_bulk_utf8
+	.quad	va_char_p_transcode_utf8
+	.byte	0
+	.byte	1
+	.byte	0
+	.byte	1
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_span_p_read_vtab_utf8
+	.align 32
+	.type	va_span_p_read_vtab_utf8, @object
+	.size	va_span_p_read_vtab_utf8, 56
+va_span_p_read_vtab_utf8:
+	.quad	.LC10
+	.quad	va_span_p_take_utf8
+	.quad	va_char_p_end
+	.quad	va_span_p_set_chunk_mode
+	.quad	va_span_p_bulk_utf8
+	.quad	va_char_p_transcode_utf8
+	.byte	1
+	.byte	0
+	.byte	0
+	.byte	1
+	.string	""
+	.string	""
+	.zero	2
+	.globl	va_char_p_read_vtab_utf8
+	.align 32
+	.type	va_char_p_read_vtab_utf8, @object
+	.size	va_char_p_read_vtab_utf8, 56
+va_char_p_read_vtab_utf8:
+	.quad	.LC10
+	.quad	va_char_p_take_utf8
+	.quad	va_char_p_end
+	.quad	va_char_p_set_chunk_mode
+	.quad	va_char_p_bulk_utf8
+	.quad	va_char_p_transcode_utf8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	1
+	.string	""
+	.string	""
+	.zero	2
+	.text
+.Letext0:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 6 "/usr/include/uchar.h"
+	.file 7 "./include/va_print/base.h"
+	.file 8 "./include/va_print/utf8.h"
+	.file 9 "./include/va_print/core.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/assert.h"
+	.file 12 "./include/va_print/char.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x2186
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x46
+	.long	.LASF1199
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1079
+	.uleb128 0xf
+	.long	.LASF1089
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x45
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1080
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1081
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF1082
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0x2
+	.long	0x79
+	.uleb128 0xc
+	.long	0x68
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1084
+	.uleb128 0xc
+	.long	0x72
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1085
+	.uleb128 0xc
+	.long	0x7e
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1086
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1087
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1088
+	.uleb128 0xf
+	.long	.LASF1090
+	.byte	0x5
+	.byte	0x28
+	.byte	0x1c
+	.long	0x61
+	.uleb128 0xf
+	.long	.LASF1091
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x16
+	.long	0x8a
+	.uleb128 0xf
+	.long	.LASF1092
+	.byte	0x5
+	.byte	0x37
+	.byte	0x14
+	.long	0x9f
+	.uleb128 0xf
+	.long	.LASF1093
+	.byte	0x5
+	.byte	0x39
+	.byte	0x14
+	.long	0xab
+	.uleb128 0x48
+	.byte	0x8
+	.uleb128 0x2
+	.long	0x72
+	.uleb128 0x18
+	.long	0x72
+	.long	0xe6
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1094
+	.byte	0x6
+	.byte	0x33
+	.byte	0x1a
+	.long	0xb7
+	.uleb128 0xf
+	.long	.LASF1095
+	.byte	0x6
+	.byte	0x34
+	.byte	0x1a
+	.long	0xc3
+	.uleb128 0x2b
+	.byte	0x38
+	.byte	0x7
+	.byte	0xc1
+	.long	0x196
+	.uleb128 0x11
+	.long	.LASF1096
+	.byte	0x7
+	.byte	0xc4
+	.byte	0x11
+	.long	0x68
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1097
+	.byte	0x7
+	.byte	0xd3
+	.byte	0x10
+	.long	0x1e5
+	.byte	0x8
+	.uleb128 0x23
+	.string	"end"
+	.byte	0x7
+	.byte	0xd7
+	.byte	0x13
+	.long	0x1fe
+	.byte	0x10
+	.uleb128 0x11
+	.long	.LASF1098
+	.byte	0x7
+	.byte	0xdb
+	.byte	0xc
+	.long	0x20e
+	.byte	0x18
+	.uleb128 0x11
+	.long	.LASF1099
+	.byte	0x7
+	.byte	0xe2
+	.byte	0xe
+	.long	0x23b
+	.byte	0x20
+	.uleb128 0x11
+	.long	.LASF1100
+	.byte	0x7
+	.byte	0xec
+	.byte	0xe
+	.long	0x25e
+	.byte	0x28
+	.uleb128 0x11
+	.long	.LASF1101
+	.byte	0x7
+	.byte	0xf1
+	.byte	0x13
+	.long	0x7e
+	.byte	0x30
+	.uleb128 0x11
+	.long	.LASF1102
+	.byte	0x7
+	.byte	0xf5
+	.byte	0x13
+	.long	0x7e
+	.byte	0x31
+	.uleb128 0x11
+	.long	.LASF1103
+	.byte	0x7
+	.byte	0xf9
+	.byte	0x13
+	.long	0x7e
+	.byte	0x32
+	.uleb128 0x23
+	.string	"enc"
+	.byte	0x7
+	.byte	0xfd
+	.byte	0x13
+	.long	0x7e
+	.byte	0x33
+	.uleb128 0x11
+	.long	.LASF1104
+	.byte	0x7
+	.byte	0xff
+	.byte	0xa
+	.long	0xd6
+	.byte	0x34
+	.byte	0
+	.uleb128 0x1a
+	.long	0x8a
+	.long	0x1aa
+	.uleb128 0x4
+	.long	0x1aa
+	.uleb128 0x4
+	.long	0x1df
+	.byte	0
+	.uleb128 0x2
+	.long	0x1af
+	.uleb128 0x24
+	.long	.LASF1111
+	.byte	0x10
+	.byte	0x7
+	.value	0x132
+	.byte	0x10
+	.long	0x1da
+	.uleb128 0x9
+	.long	.LASF1105
+	.byte	0x7
+	.value	0x135
+	.byte	0x20
+	.long	0x275
+	.byte	0
+	.uleb128 0x12
+	.string	"cur"
+	.byte	0x7
+	.value	0x138
+	.byte	0x11
+	.long	0x1df
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	0x1af
+	.uleb128 0x2
+	.long	0x1e4
+	.uleb128 0x49
+	.uleb128 0x2
+	.long	0x196
+	.uleb128 0x1a
+	.long	0x1df
+	.long	0x1fe
+	.uleb128 0x4
+	.long	0x1aa
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x1ea
+	.uleb128 0x1d
+	.long	0x20e
+	.uleb128 0x4
+	.long	0x1aa
+	.byte	0
+	.uleb128 0x2
+	.long	0x203
+	.uleb128 0x1a
+	.long	0x39
+	.long	0x231
+	.uleb128 0x4
+	.long	0x231
+	.uleb128 0x4
+	.long	0x1df
+	.uleb128 0x4
+	.long	0x39
+	.uleb128 0x4
+	.long	0x236
+	.byte	0
+	.uleb128 0x2
+	.long	0x1da
+	.uleb128 0x2
+	.long	0x39
+	.uleb128 0x2
+	.long	0x213
+	.uleb128 0x1a
+	.long	0x39
+	.long	0x25e
+	.uleb128 0x4
+	.long	0xcf
+	.uleb128 0x4
+	.long	0x7e
+	.uleb128 0x4
+	.long	0x1df
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x240
+	.uleb128 0x10
+	.long	.LASF1106
+	.byte	0x7
+	.value	0x100
+	.byte	0x3
+	.long	0xfe
+	.uleb128 0xc
+	.long	0x263
+	.uleb128 0x2
+	.long	0x270
+	.uleb128 0x10
+	.long	.LASF1107
+	.byte	0x7
+	.value	0x139
+	.byte	0x3
+	.long	0x1af
+	.uleb128 0xc
+	.long	0x27a
+	.uleb128 0x2c
+	.byte	0x18
+	.value	0x13f
+	.long	0x2b1
+	.uleb128 0x9
+	.long	.LASF1108
+	.byte	0x7
+	.value	0x140
+	.byte	0x14
+	.long	0x27a
+	.byte	0
+	.uleb128 0x12
+	.string	"end"
+	.byte	0x7
+	.value	0x141
+	.byte	0x11
+	.long	0x1df
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1109
+	.byte	0x7
+	.value	0x142
+	.byte	0x3
+	.long	0x28c
+	.uleb128 0xc
+	.long	0x2b1
+	.uleb128 0x10
+	.long	.LASF1110
+	.byte	0x7
+	.value	0x169
+	.byte	0x1a
+	.long	0x2d5
+	.uleb128 0xc
+	.long	0x2c3
+	.uleb128 0x24
+	.long	.LASF1112
+	.byte	0x40
+	.byte	0x7
+	.value	0x1b7
+	.byte	0x8
+	.long	0x354
+	.uleb128 0x9
+	.long	.LASF1105
+	.byte	0x7
+	.value	0x1b8
+	.byte	0x1d
+	.long	0x4c7
+	.byte	0
+	.uleb128 0x12
+	.string	"pat"
+	.byte	0x7
+	.value	0x1b9
+	.byte	0x14
+	.long	0x27a
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1113
+	.byte	0x7
+	.value	0x1ba
+	.byte	0xe
+	.long	0x8a
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1114
+	.byte	0x7
+	.value	0x1bb
+	.byte	0xe
+	.long	0x8a
+	.byte	0x1c
+	.uleb128 0x12
+	.string	"opt"
+	.byte	0x7
+	.value	0x1bc
+	.byte	0xe
+	.long	0x8a
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1115
+	.byte	0x7
+	.value	0x1bd
+	.byte	0xe
+	.long	0x8a
+	.byte	0x24
+	.uleb128 0x12
+	.string	"win"
+	.byte	0x7
+	.value	0x1be
+	.byte	0x11
+	.long	0x4ba
+	.byte	0x28
+	.uleb128 0x9
+	.long	.LASF1116
+	.byte	0x7
+	.value	0x1c2
+	.byte	0x1c
+	.long	0x4cc
+	.byte	0x38
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1117
+	.byte	0x7
+	.value	0x16c
+	.byte	0x1e
+	.long	0x366
+	.uleb128 0xc
+	.long	0x354
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x40
+	.byte	0x3
+	.value	0x14f
+	.byte	0x8
+	.long	0x381
+	.uleb128 0x12
+	.string	"q"
+	.byte	0x3
+	.value	0x150
+	.byte	0x1b
+	.long	0x636
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.byte	0x38
+	.value	0x174
+	.long	0x3fa
+	.uleb128 0x9
+	.long	.LASF1119
+	.byte	0x7
+	.value	0x176
+	.byte	0xc
+	.long	0x40a
+	.byte	0
+	.uleb128 0x12
+	.string	"put"
+	.byte	0x7
+	.value	0x178
+	.byte	0xc
+	.long	0x41f
+	.byte	0x8
+	.uleb128 0x9
+	.long	.LASF1120
+	.byte	0x7
+	.value	0x17b
+	.byte	0xc
+	.long	0x40a
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1121
+	.byte	0x7
+	.value	0x182
+	.byte	0xb
+	.long	0x43f
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1122
+	.byte	0x7
+	.value	0x186
+	.byte	0xc
+	.long	0x459
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1123
+	.byte	0x7
+	.value	0x18c
+	.byte	0xc
+	.long	0x46e
+	.byte	0x28
+	.uleb128 0x12
+	.string	"enc"
+	.byte	0x7
+	.value	0x191
+	.byte	0x13
+	.long	0x7e
+	.byte	0x30
+	.uleb128 0x9
+	.long	.LASF1104
+	.byte	0x7
+	.value	0x192
+	.byte	0xa
+	.long	0x473
+	.byte	0x31
+	.byte	0
+	.uleb128 0x1d
+	.long	0x405
+	.uleb128 0x4
+	.long	0x405
+	.byte	0
+	.uleb128 0x2
+	.long	0x2c3
+	.uleb128 0x2
+	.long	0x3fa
+	.uleb128 0x1d
+	.long	0x41f
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x8a
+	.byte	0
+	.uleb128 0x2
+	.long	0x40f
+	.uleb128 0x1a
+	.long	0x438
+	.long	0x438
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1124
+	.uleb128 0x2
+	.long	0x424
+	.uleb128 0x1d
+	.long	0x459
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x8a
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x444
+	.uleb128 0x1d
+	.long	0x46e
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x2
+	.long	0x45e
+	.uleb128 0x18
+	.long	0x72
+	.long	0x483
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1125
+	.byte	0x7
+	.value	0x193
+	.byte	0x3
+	.long	0x381
+	.uleb128 0xc
+	.long	0x483
+	.uleb128 0x2c
+	.byte	0x10
+	.value	0x19a
+	.long	0x4ba
+	.uleb128 0x12
+	.string	"cur"
+	.byte	0x7
+	.value	0x19b
+	.byte	0xb
+	.long	0xcf
+	.byte	0
+	.uleb128 0x12
+	.string	"end"
+	.byte	0x7
+	.value	0x19c
+	.byte	0xb
+	.long	0xcf
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1126
+	.byte	0x7
+	.value	0x19d
+	.byte	0x3
+	.long	0x495
+	.uleb128 0x2
+	.long	0x490
+	.uleb128 0x2
+	.long	0x361
+	.uleb128 0x24
+	.long	.LASF1127
+	.byte	0x10
+	.byte	0x7
+	.value	0x1e5
+	.byte	0x10
+	.long	0x4fc
+	.uleb128 0x9
+	.long	.LASF1128
+	.byte	0x7
+	.value	0x1e6
+	.byte	0xc
+	.long	0x39
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1129
+	.byte	0x7
+	.value	0x1e7
+	.byte	0x11
+	.long	0x68
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1130
+	.byte	0x7
+	.value	0x1e8
+	.byte	0x3
+	.long	0x4d1
+	.uleb128 0xc
+	.long	0x4fc
+	.uleb128 0x25
+	.long	.LASF1131
+	.byte	0x17
+	.long	0x270
+	.uleb128 0x25
+	.long	.LASF1132
+	.byte	0x18
+	.long	0x270
+	.uleb128 0x25
+	.long	.LASF1133
+	.byte	0x19
+	.long	0x270
+	.uleb128 0x25
+	.long	.LASF1134
+	.byte	0x1a
+	.long	0x270
+	.uleb128 0x2b
+	.byte	0x88
+	.byte	0x3
+	.byte	0xc9
+	.long	0x559
+	.uleb128 0x23
+	.string	"cls"
+	.byte	0x3
+	.byte	0xce
+	.byte	0x13
+	.long	0x559
+	.byte	0
+	.uleb128 0x23
+	.string	"esc"
+	.byte	0x3
+	.byte	0xd5
+	.byte	0x18
+	.long	0x569
+	.byte	0x80
+	.byte	0
+	.uleb128 0x18
+	.long	0x7e
+	.long	0x569
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x2
+	.long	0x6d
+	.uleb128 0xf
+	.long	.LASF1135
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x3
+	.long	0x536
+	.uleb128 0xc
+	.long	0x56e
+	.uleb128 0x2b
+	.byte	0x38
+	.byte	0x3
+	.byte	0xe0
+	.long	0x5db
+	.uleb128 0x11
+	.long	.LASF1136
+	.byte	0x3
+	.byte	0xef
+	.byte	0x18
+	.long	0x5db
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1137
+	.byte	0x3
+	.value	0x101
+	.byte	0xb
+	.long	0x606
+	.byte	0x10
+	.uleb128 0x9
+	.long	.LASF1138
+	.byte	0x3
+	.value	0x10e
+	.byte	0xb
+	.long	0x61a
+	.byte	0x18
+	.uleb128 0x9
+	.long	.LASF1139
+	.byte	0x3
+	.value	0x12a
+	.byte	0xc
+	.long	0x41f
+	.byte	0x20
+	.uleb128 0x9
+	.long	.LASF1140
+	.byte	0x3
+	.value	0x131
+	.byte	0xc
+	.long	0x40a
+	.byte	0x28
+	.uleb128 0x9
+	.long	.LASF1141
+	.byte	0x3
+	.value	0x141
+	.byte	0x21
+	.long	0x61f
+	.byte	0x30
+	.byte	0
+	.uleb128 0x18
+	.long	0x5eb
+	.long	0x5eb
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1142
+	.uleb128 0x1a
+	.long	0x438
+	.long	0x606
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x8a
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f2
+	.uleb128 0x1a
+	.long	0x438
+	.long	0x61a
+	.uleb128 0x4
+	.long	0x405
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b
+	.uleb128 0x2
+	.long	0x57a
+	.uleb128 0x10
+	.long	.LASF1143
+	.byte	0x3
+	.value	0x142
+	.byte	0x3
+	.long	0x57f
+	.uleb128 0xc
+	.long	0x624
+	.uleb128 0x18
+	.long	0x646
+	.long	0x646
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2
+	.long	0x631
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1144
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1145
+	.uleb128 0xf
+	.long	.LASF1146
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x665
+	.uleb128 0x1f
+	.long	0x5eb
+	.long	0x671
+	.uleb128 0x20
+	.byte	0x1
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1147
+	.byte	0x2
+	.byte	0x2b
+	.byte	0xd
+	.long	0x67d
+	.uleb128 0x1f
+	.long	0x4c
+	.long	0x689
+	.uleb128 0x20
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1148
+	.byte	0x2
+	.byte	0x2d
+	.byte	0xf
+	.long	0x695
+	.uleb128 0x1f
+	.long	0x98
+	.long	0x6a1
+	.uleb128 0x20
+	.byte	0x7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1149
+	.byte	0x2
+	.byte	0x2f
+	.byte	0xe
+	.long	0x6ad
+	.uleb128 0x1f
+	.long	0x72
+	.long	0x6b9
+	.uleb128 0x20
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1150
+	.byte	0x2
+	.byte	0x35
+	.byte	0x13
+	.long	0x6ca
+	.uleb128 0xc
+	.long	0x6b9
+	.uleb128 0x1f
+	.long	0x53
+	.long	0x6d6
+	.uleb128 0x20
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4a
+	.long	.LASF1200
+	.byte	0x2
+	.byte	0x39
+	.byte	0x13
+	.long	0x6ca
+	.byte	0x1
+	.uleb128 0xc
+	.long	0x6d6
+	.uleb128 0x26
+	.long	0x50e
+	.byte	0x15
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_char_p_read_vtab_utf8
+	.uleb128 0x26
+	.long	0x518
+	.byte	0x23
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_span_p_read_vtab_utf8
+	.uleb128 0x26
+	.long	0x522
+	.byte	0x31
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_char_p_read_vtab_utf8_chunk
+	.uleb128 0x26
+	.long	0x52c
+	.byte	0x3f
+	.uleb128 0x9
+	.byte	0x3
+	.quad	va_span_p_read_vtab_utf8_chunk
+	.uleb128 0x36
+	.long	.LASF1151
+	.value	0x10f
+	.long	0x405
+	.long	0x742
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x742
+	.byte	0
+	.uleb128 0x2
+	.long	0x27a
+	.uleb128 0x36
+	.long	.LASF1152
+	.value	0x112
+	.long	0x405
+	.long	0x761
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x742
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1153
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.long	0xcf
+	.long	0x781
+	.uleb128 0x4
+	.long	0xcf
+	.uleb128 0x4
+	.long	0x1df
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x4b
+	.long	.LASF1154
+	.byte	0xb
+	.byte	0x45
+	.byte	0xd
+	.long	0x7a2
+	.uleb128 0x4
+	.long	0x68
+	.uleb128 0x4
+	.long	0x68
+	.uleb128 0x4
+	.long	0x8a
+	.uleb128 0x4
+	.long	0x68
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF1155
+	.byte	0xc
+	.byte	0xee
+	.byte	0x14
+	.long	0x1df
+	.long	0x7bd
+	.uleb128 0x4
+	.long	0x742
+	.uleb128 0x4
+	.long	0x39
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1156
+	.value	0x280
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB561
+	.quad	.LFE561-.LFB561
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x820
+	.uleb128 0x7
+	.string	"s"
+	.value	0x281
+	.byte	0x12
+	.long	0x405
+	.long	.LLST163
+	.long	.LVUS163
+	.uleb128 0x7
+	.string	"x"
+	.value	0x282
+	.byte	0x16
+	.long	0x820
+	.long	.LLST164
+	.long	.LVUS164
+	.uleb128 0x27
+	.quad	.LVL254
+	.long	0x825
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x509
+	.uleb128 0x13
+	.long	.LASF1157
+	.value	0x275
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB560
+	.quad	.LFE560-.LFB560
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x896
+	.uleb128 0x7
+	.string	"s"
+	.value	0x276
+	.byte	0x12
+	.long	0x405
+	.long	.LLST161
+	.long	.LVUS161
+	.uleb128 0x7
+	.string	"x"
+	.value	0x277
+	.byte	0x16
+	.long	0x820
+	.long	.LLST162
+	.long	.LVUS162
+	.uleb128 0x2d
+	.long	.LASF1160
+	.value	0x279
+	.byte	0x18
+	.long	0x2b1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1b
+	.quad	.LVL252
+	.long	0x747
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1158
+	.value	0x265
+	.byte	0x11
+	.long	0x8a
+	.long	0x925
+	.uleb128 0x4c
+	.long	.LASF1159
+	.byte	0x1
+	.value	0x266
+	.byte	0x15
+	.long	0x742
+	.uleb128 0x5
+	.string	"end"
+	.byte	0x1
+	.value	0x267
+	.byte	0x11
+	.long	0x1df
+	.uleb128 0x28
+	.long	.LASF1174
+	.long	0x935
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.uleb128 0x21
+	.long	.LASF1160
+	.value	0x26a
+	.byte	0x19
+	.long	0x93a
+	.uleb128 0x29
+	.uleb128 0x21
+	.long	.LASF1161
+	.value	0x26a
+	.byte	0x3d
+	.long	0x742
+	.uleb128 0x10
+	.long	.LASF1162
+	.byte	0x1
+	.value	0x26a
+	.byte	0x6c
+	.long	0x2b1
+	.uleb128 0xe
+	.string	"r_"
+	.byte	0x1
+	.value	0x26a
+	.byte	0x7a
+	.long	0x905
+	.uleb128 0x2
+	.long	0x8ec
+	.uleb128 0xe
+	.string	"r2_"
+	.byte	0x1
+	.value	0x26a
+	.byte	0x2d
+	.long	0x905
+	.uleb128 0x21
+	.long	.LASF1163
+	.value	0x26a
+	.byte	0x99
+	.long	0x742
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	0x79
+	.long	0x935
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x13
+	.byte	0
+	.uleb128 0xc
+	.long	0x925
+	.uleb128 0x2
+	.long	0x2b1
+	.uleb128 0x4d
+	.long	.LASF1178
+	.byte	0x1
+	.value	0x25d
+	.byte	0x15
+	.long	0x405
+	.long	0x967
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x1
+	.value	0x25e
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x1
+	.value	0x25f
+	.byte	0xc
+	.long	0x967
+	.byte	0
+	.uleb128 0x2
+	.long	0xd1
+	.uleb128 0x13
+	.long	.LASF1164
+	.value	0x255
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB557
+	.quad	.LFE557-.LFB557
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9cf
+	.uleb128 0x7
+	.string	"s"
+	.value	0x256
+	.byte	0x12
+	.long	0x405
+	.long	.LLST159
+	.long	.LVUS159
+	.uleb128 0x7
+	.string	"x"
+	.value	0x257
+	.byte	0x12
+	.long	0x9cf
+	.long	.LLST160
+	.long	.LVUS160
+	.uleb128 0x27
+	.quad	.LVL249
+	.long	0xa5e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x68
+	.uleb128 0x13
+	.long	.LASF1165
+	.value	0x24d
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB556
+	.quad	.LFE556-.LFB556
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa37
+	.uleb128 0x7
+	.string	"s"
+	.value	0x24e
+	.byte	0x12
+	.long	0x405
+	.long	.LLST157
+	.long	.LVUS157
+	.uleb128 0x7
+	.string	"x"
+	.value	0x24f
+	.byte	0x11
+	.long	0x68
+	.long	.LLST158
+	.long	.LVUS158
+	.uleb128 0x27
+	.quad	.LVL247
+	.long	0xace
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF1166
+	.value	0x246
+	.byte	0x15
+	.long	0x405
+	.long	0xa5e
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x1
+	.value	0x247
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x1
+	.value	0x248
+	.byte	0xc
+	.long	0x967
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1167
+	.value	0x23c
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB554
+	.quad	.LFE554-.LFB554
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xace
+	.uleb128 0x7
+	.string	"s"
+	.value	0x23d
+	.byte	0x12
+	.long	0x405
+	.long	.LLST153
+	.long	.LVUS153
+	.uleb128 0x7
+	.string	"x"
+	.value	0x23e
+	.byte	0x12
+	.long	0x9cf
+	.long	.LLST154
+	.long	.LVUS154
+	.uleb128 0x2d
+	.long	.LASF1160
+	.value	0x240
+	.byte	0x14
+	.long	0x27a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1b
+	.quad	.LVL241
+	.long	0x728
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1168
+	.value	0x234
+	.byte	0x15
+	.long	0x405
+	.quad	.LFB553
+	.quad	.LFE553-.LFB553
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb3f
+	.uleb128 0x7
+	.string	"s"
+	.value	0x235
+	.byte	0x12
+	.long	0x405
+	.long	.LLST151
+	.long	.LVUS151
+	.uleb128 0x7
+	.string	"x"
+	.value	0x236
+	.byte	0x11
+	.long	0x68
+	.long	.LLST152
+	.long	.LVUS152
+	.uleb128 0x2d
+	.long	.LASF1160
+	.value	0x238
+	.byte	0x14
+	.long	0x27a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1b
+	.quad	.LVL238
+	.long	0x747
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1169
+	.value	0x21d
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB552
+	.quad	.LFE552-.LFB552
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc3e
+	.uleb128 0x4e
+	.string	"s"
+	.byte	0x1
+	.value	0x21e
+	.byte	0x12
+	.long	0x405
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x7
+	.string	"c"
+	.value	0x21f
+	.byte	0xe
+	.long	0x8a
+	.long	.LLST144
+	.long	.LVUS144
+	.uleb128 0x15
+	.long	0x1f39
+	.quad	.LBI352
+	.value	.LVU844
+	.quad	.LBB352
+	.quad	.LBE352-.LBB352
+	.byte	0x1
+	.value	0x22d
+	.byte	0xa
+	.long	0xbb5
+	.uleb128 0x1
+	.long	0x1f4b
+	.long	.LLST145
+	.long	.LVUS145
+	.byte	0
+	.uleb128 0xa
+	.long	0x1f05
+	.quad	.LBI354
+	.value	.LVU849
+	.long	.LLRL146
+	.value	0x22e
+	.byte	0x9
+	.long	0xc0d
+	.uleb128 0x1
+	.long	0x1f1e
+	.long	.LLST147
+	.long	.LVUS147
+	.uleb128 0x1
+	.long	0x1f13
+	.long	.LLST148
+	.long	.LVUS148
+	.uleb128 0x39
+	.long	0x1f29
+	.quad	.LBB356
+	.quad	.LBE356-.LBB356
+	.uleb128 0xb
+	.long	0x1f2a
+	.long	.LLST149
+	.long	.LVUS149
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	0x1e84
+	.quad	.LBI359
+	.value	.LVU863
+	.quad	.LBB359
+	.quad	.LBE359-.LBB359
+	.value	0x231
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x1e96
+	.long	.LLST150
+	.long	.LVUS150
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.long	.LASF1201
+	.byte	0x1
+	.value	0x1d9
+	.byte	0xd
+	.quad	.LFB551
+	.quad	.LFE551-.LFB551
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xeb1
+	.uleb128 0x7
+	.string	"s"
+	.value	0x1da
+	.byte	0x12
+	.long	0x405
+	.long	.LLST125
+	.long	.LVUS125
+	.uleb128 0x7
+	.string	"c"
+	.value	0x1db
+	.byte	0xe
+	.long	0x8a
+	.long	.LLST126
+	.long	.LVUS126
+	.uleb128 0x7
+	.string	"put"
+	.value	0x1dc
+	.byte	0xc
+	.long	0xec1
+	.long	.LLST127
+	.long	.LVUS127
+	.uleb128 0x50
+	.string	"x"
+	.byte	0x1
+	.value	0x1f9
+	.byte	0xa
+	.long	0xd6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x8
+	.string	"n"
+	.value	0x1fa
+	.byte	0xc
+	.long	0x39
+	.long	.LLST128
+	.long	.LVUS128
+	.uleb128 0x16
+	.quad	.LBB337
+	.quad	.LBE337-.LBB337
+	.long	0xcdd
+	.uleb128 0x8
+	.string	"w"
+	.value	0x1e3
+	.byte	0x17
+	.long	0xd1
+	.long	.LLST133
+	.long	.LVUS133
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB351
+	.quad	.LBE351-.LBB351
+	.long	0xd15
+	.uleb128 0x8
+	.string	"i"
+	.value	0x218
+	.byte	0x11
+	.long	0x39
+	.long	.LLST143
+	.long	.LVUS143
+	.uleb128 0x2e
+	.quad	.LVL224
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1e38
+	.quad	.LBI331
+	.value	.LVU694
+	.long	.LLRL129
+	.value	0x1e2
+	.byte	0x11
+	.long	0xd8e
+	.uleb128 0x1
+	.long	0x1e55
+	.long	.LLST130
+	.long	.LVUS130
+	.uleb128 0x1
+	.long	0x1e4a
+	.long	.LLST131
+	.long	.LVUS131
+	.uleb128 0x15
+	.long	0x1e61
+	.quad	.LBI333
+	.value	.LVU696
+	.quad	.LBB333
+	.quad	.LBE333-.LBB333
+	.byte	0x3
+	.value	0x24b
+	.byte	0x9
+	.long	0xd7e
+	.uleb128 0x1
+	.long	0x1e73
+	.long	.LLST132
+	.long	.LVUS132
+	.byte	0
+	.uleb128 0x2e
+	.quad	.LVL196
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x1f39
+	.quad	.LBI338
+	.value	.LVU727
+	.quad	.LBB338
+	.quad	.LBE338-.LBB338
+	.byte	0x1
+	.value	0x1f3
+	.byte	0xa
+	.long	0xdc3
+	.uleb128 0x1
+	.long	0x1f4b
+	.long	.LLST134
+	.long	.LVUS134
+	.byte	0
+	.uleb128 0xa
+	.long	0x1f05
+	.quad	.LBI340
+	.value	.LVU732
+	.long	.LLRL135
+	.value	0x1f4
+	.byte	0x9
+	.long	0xe1b
+	.uleb128 0x1
+	.long	0x1f1e
+	.long	.LLST136
+	.long	.LVUS136
+	.uleb128 0x1
+	.long	0x1f13
+	.long	.LLST137
+	.long	.LVUS137
+	.uleb128 0x39
+	.long	0x1f29
+	.quad	.LBB342
+	.quad	.LBE342-.LBB342
+	.uleb128 0xb
+	.long	0x1f2a
+	.long	.LLST138
+	.long	.LVUS138
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1e38
+	.quad	.LBI345
+	.value	.LVU806
+	.long	.LLRL139
+	.value	0x213
+	.byte	0x9
+	.long	0xe9b
+	.uleb128 0x1
+	.long	0x1e55
+	.long	.LLST140
+	.long	.LVUS140
+	.uleb128 0x1
+	.long	0x1e4a
+	.long	.LLST141
+	.long	.LVUS141
+	.uleb128 0x15
+	.long	0x1e61
+	.quad	.LBI347
+	.value	.LVU808
+	.quad	.LBB347
+	.quad	.LBE347-.LBB347
+	.byte	0x3
+	.value	0x24b
+	.byte	0x9
+	.long	0xe84
+	.uleb128 0x1
+	.long	0x1e73
+	.long	.LLST142
+	.long	.LVUS142
+	.byte	0
+	.uleb128 0x2e
+	.quad	.LVL220
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x73
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.quad	.LVL195
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0xec1
+	.uleb128 0x4
+	.long	0x405
+	.uleb128 0x4
+	.long	0x72
+	.byte	0
+	.uleb128 0x2
+	.long	0xeb1
+	.uleb128 0x13
+	.long	.LASF1170
+	.value	0x19b
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB550
+	.quad	.LFE550-.LFB550
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1466
+	.uleb128 0x7
+	.string	"dst"
+	.value	0x19c
+	.byte	0xb
+	.long	0xcf
+	.long	.LLST56
+	.long	.LVUS56
+	.uleb128 0x7
+	.string	"enc"
+	.value	0x19d
+	.byte	0x13
+	.long	0x7e
+	.long	.LLST57
+	.long	.LVUS57
+	.uleb128 0x7
+	.string	"src"
+	.value	0x19e
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST58
+	.long	.LVUS58
+	.uleb128 0x7
+	.string	"n"
+	.value	0x19f
+	.byte	0xc
+	.long	0x39
+	.long	.LLST59
+	.long	.LVUS59
+	.uleb128 0x8
+	.string	"p"
+	.value	0x1a1
+	.byte	0x1a
+	.long	0x1466
+	.long	.LLST60
+	.long	.LVUS60
+	.uleb128 0x8
+	.string	"e"
+	.value	0x1a2
+	.byte	0x1a
+	.long	0x1466
+	.long	.LLST61
+	.long	.LVUS61
+	.uleb128 0x16
+	.quad	.LBB218
+	.quad	.LBE218-.LBB218
+	.long	0x1120
+	.uleb128 0x8
+	.string	"w"
+	.value	0x1a8
+	.byte	0x13
+	.long	0x146b
+	.long	.LLST66
+	.long	.LVUS66
+	.uleb128 0x3b
+	.long	.LLRL67
+	.long	0x10a6
+	.uleb128 0x8
+	.string	"v"
+	.value	0x1ad
+	.byte	0x19
+	.long	0x6b9
+	.long	.LLST68
+	.long	.LVUS68
+	.uleb128 0x3b
+	.long	.LLRL69
+	.long	0x1059
+	.uleb128 0xe
+	.string	"z"
+	.byte	0x1
+	.value	0x1af
+	.byte	0x1d
+	.long	0x6b9
+	.uleb128 0xa
+	.long	0x1d3a
+	.quad	.LBI221
+	.value	.LVU409
+	.long	.LLRL70
+	.value	0x1b0
+	.byte	0x15
+	.long	0xfdd
+	.uleb128 0x6
+	.long	0x1d56
+	.uleb128 0x1
+	.long	0x1d49
+	.long	.LLST71
+	.long	.LVUS71
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d8e
+	.quad	.LBI226
+	.value	.LVU423
+	.long	.LLRL72
+	.value	0x1b1
+	.byte	0x15
+	.long	0x1002
+	.uleb128 0x6
+	.long	0x1daa
+	.uleb128 0x6
+	.long	0x1d9d
+	.byte	0
+	.uleb128 0xa
+	.long	0x1dc6
+	.quad	.LBI230
+	.value	.LVU417
+	.long	.LLRL73
+	.value	0x1b0
+	.byte	0x15
+	.long	0x102f
+	.uleb128 0x1
+	.long	0x1de1
+	.long	.LLST74
+	.long	.LVUS74
+	.uleb128 0x6
+	.long	0x1dd4
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1dc6
+	.quad	.LBI233
+	.value	.LVU426
+	.long	.LLRL75
+	.value	0x1b1
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x1de1
+	.long	.LLST76
+	.long	.LVUS76
+	.uleb128 0x6
+	.long	0x1dd4
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1df4
+	.quad	.LBI239
+	.value	.LVU397
+	.long	.LLRL77
+	.value	0x1ad
+	.byte	0x1d
+	.long	0x1081
+	.uleb128 0x1
+	.long	0x1e03
+	.long	.LLST78
+	.long	.LVUS78
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1c9f
+	.quad	.LBI242
+	.value	.LVU401
+	.long	.LLRL79
+	.value	0x1ae
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x1cae
+	.long	.LLST80
+	.long	.LVUS80
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1ea2
+	.quad	.LBI249
+	.value	.LVU434
+	.long	.LLRL81
+	.value	0x1b8
+	.byte	0x11
+	.long	0x10ee
+	.uleb128 0x1
+	.long	0x1eb4
+	.long	.LLST82
+	.long	.LVUS82
+	.uleb128 0x17
+	.long	.LLRL81
+	.uleb128 0xb
+	.long	0x1ec0
+	.long	.LLST83
+	.long	.LVUS83
+	.uleb128 0xb
+	.long	0x1ecb
+	.long	.LLST84
+	.long	.LVUS84
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1edc
+	.quad	.LBI253
+	.value	.LVU452
+	.long	.LLRL85
+	.value	0x1b8
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x1ef9
+	.long	.LLST86
+	.long	.LVUS86
+	.uleb128 0x1
+	.long	0x1eee
+	.long	.LLST87
+	.long	.LVUS87
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB261
+	.quad	.LBE261-.LBB261
+	.long	0x140b
+	.uleb128 0x8
+	.string	"w"
+	.value	0x1be
+	.byte	0x13
+	.long	0x1470
+	.long	.LLST88
+	.long	.LVUS88
+	.uleb128 0x16
+	.quad	.LBB262
+	.quad	.LBE262-.LBB262
+	.long	0x13c6
+	.uleb128 0x8
+	.string	"v"
+	.value	0x1c2
+	.byte	0x19
+	.long	0x6b9
+	.long	.LLST89
+	.long	.LVUS89
+	.uleb128 0x16
+	.quad	.LBB271
+	.quad	.LBE271-.LBB271
+	.long	0x1379
+	.uleb128 0xe
+	.string	"z"
+	.byte	0x1
+	.value	0x1c4
+	.byte	0x1d
+	.long	0x6b9
+	.uleb128 0x8
+	.string	"lo"
+	.value	0x1c5
+	.byte	0x1d
+	.long	0x6b9
+	.long	.LLST94
+	.long	.LVUS94
+	.uleb128 0x8
+	.string	"hi"
+	.value	0x1c6
+	.byte	0x1d
+	.long	0x6b9
+	.long	.LLST95
+	.long	.LVUS95
+	.uleb128 0xa
+	.long	0x1d3a
+	.quad	.LBI272
+	.value	.LVU525
+	.long	.LLRL96
+	.value	0x1c5
+	.byte	0x22
+	.long	0x11e1
+	.uleb128 0x6
+	.long	0x1d56
+	.uleb128 0x1
+	.long	0x1d49
+	.long	.LLST97
+	.long	.LVUS97
+	.byte	0
+	.uleb128 0x15
+	.long	0x1d8e
+	.quad	.LBI276
+	.value	.LVU533
+	.quad	.LBB276
+	.quad	.LBE276-.LBB276
+	.byte	0x1
+	.value	0x1c6
+	.byte	0x22
+	.long	0x121b
+	.uleb128 0x6
+	.long	0x1daa
+	.uleb128 0x1
+	.long	0x1d9d
+	.long	.LLST98
+	.long	.LVUS98
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d10
+	.quad	.LBI278
+	.value	.LVU538
+	.long	.LLRL99
+	.value	0x1c7
+	.byte	0x15
+	.long	0x1248
+	.uleb128 0x6
+	.long	0x1d2c
+	.uleb128 0x1
+	.long	0x1d1f
+	.long	.LLST100
+	.long	.LVUS100
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d64
+	.quad	.LBI281
+	.value	.LVU555
+	.long	.LLRL101
+	.value	0x1c8
+	.byte	0x15
+	.long	0x126d
+	.uleb128 0x6
+	.long	0x1d80
+	.uleb128 0x6
+	.long	0x1d73
+	.byte	0
+	.uleb128 0xa
+	.long	0x1dc6
+	.quad	.LBI284
+	.value	.LVU558
+	.long	.LLRL102
+	.value	0x1c8
+	.byte	0x15
+	.long	0x1292
+	.uleb128 0x6
+	.long	0x1de1
+	.uleb128 0x6
+	.long	0x1dd4
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d10
+	.quad	.LBI287
+	.value	.LVU561
+	.long	.LLRL103
+	.value	0x1c9
+	.byte	0x15
+	.long	0x12b7
+	.uleb128 0x6
+	.long	0x1d2c
+	.uleb128 0x6
+	.long	0x1d1f
+	.byte	0
+	.uleb128 0xa
+	.long	0x1dc6
+	.quad	.LBI292
+	.value	.LVU547
+	.long	.LLRL104
+	.value	0x1c7
+	.byte	0x15
+	.long	0x12e4
+	.uleb128 0x1
+	.long	0x1de1
+	.long	.LLST105
+	.long	.LVUS105
+	.uleb128 0x6
+	.long	0x1dd4
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d64
+	.quad	.LBI295
+	.value	.LVU569
+	.long	.LLRL106
+	.value	0x1ca
+	.byte	0x15
+	.long	0x1309
+	.uleb128 0x6
+	.long	0x1d80
+	.uleb128 0x6
+	.long	0x1d73
+	.byte	0
+	.uleb128 0x15
+	.long	0x1dc6
+	.quad	.LBI303
+	.value	.LVU564
+	.quad	.LBB303
+	.quad	.LBE303-.LBB303
+	.byte	0x1
+	.value	0x1c9
+	.byte	0x15
+	.long	0x1343
+	.uleb128 0x1
+	.long	0x1de1
+	.long	.LLST107
+	.long	.LVUS107
+	.uleb128 0x6
+	.long	0x1dd4
+	.byte	0
+	.uleb128 0x3a
+	.long	0x1dc6
+	.quad	.LBI306
+	.value	.LVU572
+	.quad	.LBB306
+	.quad	.LBE306-.LBB306
+	.value	0x1ca
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x1de1
+	.long	.LLST108
+	.long	.LVUS108
+	.uleb128 0x6
+	.long	0x1dd4
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x1df4
+	.quad	.LBI263
+	.value	.LVU513
+	.long	.LLRL90
+	.value	0x1c2
+	.byte	0x1d
+	.long	0x13a1
+	.uleb128 0x1
+	.long	0x1e03
+	.long	.LLST91
+	.long	.LVUS91
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1c9f
+	.quad	.LBI266
+	.value	.LVU517
+	.long	.LLRL92
+	.value	0x1c3
+	.byte	0x15
+	.uleb128 0x1
+	.long	0x1cae
+	.long	.LLST93
+	.long	.LVUS93
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1ea2
+	.quad	.LBI308
+	.value	.LVU583
+	.long	.LLRL109
+	.value	0x1d1
+	.byte	0x14
+	.uleb128 0x1
+	.long	0x1eb4
+	.long	.LLST110
+	.long	.LVUS110
+	.uleb128 0x17
+	.long	.LLRL109
+	.uleb128 0xb
+	.long	0x1ec0
+	.long	.LLST111
+	.long	.LVUS111
+	.uleb128 0xb
+	.long	0x1ecb
+	.long	.LLST112
+	.long	.LVUS112
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.long	0x1475
+	.quad	.LBB214
+	.quad	.LBE214-.LBB214
+	.byte	0x1
+	.value	0x1a4
+	.byte	0x10
+	.uleb128 0x6
+	.long	0x149f
+	.uleb128 0x6
+	.long	0x1494
+	.uleb128 0x6
+	.long	0x1487
+	.uleb128 0xb
+	.long	0x14aa
+	.long	.LLST62
+	.long	.LVUS62
+	.uleb128 0xb
+	.long	0x14b5
+	.long	.LLST63
+	.long	.LVUS63
+	.uleb128 0x3c
+	.long	0x14c1
+	.long	.LLRL64
+	.uleb128 0xb
+	.long	0x14c2
+	.long	.LLST65
+	.long	.LVUS65
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x85
+	.uleb128 0x2
+	.long	0xe6
+	.uleb128 0x2
+	.long	0xf2
+	.uleb128 0x1c
+	.long	.LASF1175
+	.byte	0x1
+	.value	0x187
+	.byte	0xf
+	.long	0x39
+	.byte	0x1
+	.long	0x14cf
+	.uleb128 0x5
+	.string	"enc"
+	.byte	0x1
+	.value	0x188
+	.byte	0x13
+	.long	0x7e
+	.uleb128 0x5
+	.string	"p"
+	.byte	0x1
+	.value	0x189
+	.byte	0x1a
+	.long	0x1466
+	.uleb128 0x5
+	.string	"n"
+	.byte	0x1
+	.value	0x18a
+	.byte	0xc
+	.long	0x39
+	.uleb128 0xe
+	.string	"k"
+	.byte	0x1
+	.value	0x18c
+	.byte	0xc
+	.long	0x39
+	.uleb128 0xe
+	.string	"k4"
+	.byte	0x1
+	.value	0x18d
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x29
+	.uleb128 0xe
+	.string	"i"
+	.byte	0x1
+	.value	0x18e
+	.byte	0x11
+	.long	0x39
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1171
+	.value	0x177
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB548
+	.quad	.LFE548-.LFB548
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15ac
+	.uleb128 0x3d
+	.long	.LASF1159
+	.value	0x178
+	.long	0x15ac
+	.long	.LLST51
+	.long	.LVUS51
+	.uleb128 0x7
+	.string	"end"
+	.value	0x179
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST52
+	.long	.LVUS52
+	.uleb128 0x7
+	.string	"max"
+	.value	0x17a
+	.byte	0xc
+	.long	0x39
+	.long	.LLST53
+	.long	.LVUS53
+	.uleb128 0x7
+	.string	"cps"
+	.value	0x17b
+	.byte	0xd
+	.long	0x236
+	.long	.LLST54
+	.long	.LVUS54
+	.uleb128 0x53
+	.long	.LASF1160
+	.byte	0x1
+	.value	0x17d
+	.byte	0x1f
+	.long	0x15b1
+	.long	.LLST55
+	.long	.LVUS55
+	.uleb128 0x2f
+	.long	0x159e
+	.uleb128 0x21
+	.long	.LASF1161
+	.value	0x17d
+	.byte	0x44
+	.long	0x15ac
+	.uleb128 0x10
+	.long	.LASF1162
+	.byte	0x1
+	.value	0x17d
+	.byte	0x73
+	.long	0x2be
+	.uleb128 0xe
+	.string	"r_"
+	.byte	0x1
+	.value	0x17d
+	.byte	0x81
+	.long	0x157f
+	.uleb128 0x2
+	.long	0x1566
+	.uleb128 0xe
+	.string	"r2_"
+	.byte	0x1
+	.value	0x17d
+	.byte	0x34
+	.long	0x157f
+	.uleb128 0x21
+	.long	.LASF1163
+	.value	0x17d
+	.byte	0xa0
+	.long	0x15ac
+	.byte	0
+	.uleb128 0x3e
+	.quad	.LVL97
+	.long	0x15b6
+	.byte	0
+	.uleb128 0x2
+	.long	0x287
+	.uleb128 0x2
+	.long	0x2be
+	.uleb128 0x13
+	.long	.LASF1172
+	.value	0x136
+	.byte	0xf
+	.long	0x39
+	.quad	.LFB547
+	.quad	.LFE547-.LFB547
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1805
+	.uleb128 0x3d
+	.long	.LASF1160
+	.value	0x137
+	.long	0x15ac
+	.long	.LLST25
+	.long	.LVUS25
+	.uleb128 0x7
+	.string	"end"
+	.value	0x138
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST26
+	.long	.LVUS26
+	.uleb128 0x7
+	.string	"max"
+	.value	0x139
+	.byte	0xc
+	.long	0x39
+	.long	.LLST27
+	.long	.LVUS27
+	.uleb128 0x7
+	.string	"cps"
+	.value	0x13a
+	.byte	0xd
+	.long	0x236
+	.long	.LLST28
+	.long	.LVUS28
+	.uleb128 0x8
+	.string	"p"
+	.value	0x13c
+	.byte	0x1a
+	.long	0x1466
+	.long	.LLST29
+	.long	.LVUS29
+	.uleb128 0x8
+	.string	"n"
+	.value	0x13d
+	.byte	0xc
+	.long	0x39
+	.long	.LLST30
+	.long	.LVUS30
+	.uleb128 0x8
+	.string	"i"
+	.value	0x142
+	.byte	0xc
+	.long	0x39
+	.long	.LLST31
+	.long	.LVUS31
+	.uleb128 0x8
+	.string	"k"
+	.value	0x143
+	.byte	0xc
+	.long	0x39
+	.long	.LLST32
+	.long	.LVUS32
+	.uleb128 0x3f
+	.quad	.LBB139
+	.quad	.LBE139-.LBB139
+	.uleb128 0x8
+	.string	"c0"
+	.value	0x145
+	.byte	0x12
+	.long	0x8a
+	.long	.LLST33
+	.long	.LVUS33
+	.uleb128 0x8
+	.string	"len"
+	.value	0x151
+	.byte	0x10
+	.long	0x39
+	.long	.LLST34
+	.long	.LVUS34
+	.uleb128 0x8
+	.string	"lo"
+	.value	0x152
+	.byte	0x12
+	.long	0x8a
+	.long	.LLST35
+	.long	.LVUS35
+	.uleb128 0x8
+	.string	"hi"
+	.value	0x153
+	.byte	0x12
+	.long	0x8a
+	.long	.LLST36
+	.long	.LVUS36
+	.uleb128 0x3f
+	.quad	.LBB140
+	.quad	.LBE140-.LBB140
+	.uleb128 0x8
+	.string	"m"
+	.value	0x14a
+	.byte	0x14
+	.long	0x39
+	.long	.LLST37
+	.long	.LVUS37
+	.uleb128 0x1e
+	.long	0x1b57
+	.quad	.LBI141
+	.value	.LVU237
+	.long	.LLRL38
+	.value	0x14a
+	.byte	0x18
+	.uleb128 0x1
+	.long	0x1b71
+	.long	.LLST39
+	.long	.LVUS39
+	.uleb128 0x1
+	.long	0x1b68
+	.long	.LLST40
+	.long	.LVUS40
+	.uleb128 0x17
+	.long	.LLRL38
+	.uleb128 0xb
+	.long	0x1b7a
+	.long	.LLST41
+	.long	.LVUS41
+	.uleb128 0x3c
+	.long	0x1b83
+	.long	.LLRL42
+	.uleb128 0xb
+	.long	0x1b84
+	.long	.LLST43
+	.long	.LVUS43
+	.uleb128 0xb
+	.long	0x1b8d
+	.long	.LLST44
+	.long	.LVUS44
+	.uleb128 0x30
+	.long	0x1b96
+	.uleb128 0x31
+	.long	0x1cbc
+	.quad	.LBI144
+	.value	.LVU258
+	.long	.LLRL45
+	.byte	0xa1
+	.byte	0x15
+	.long	0x1786
+	.uleb128 0x6
+	.long	0x1cd8
+	.uleb128 0x1
+	.long	0x1ccb
+	.long	.LLST46
+	.long	.LVUS46
+	.byte	0
+	.uleb128 0x40
+	.long	0x1e16
+	.quad	.LBI148
+	.value	.LVU253
+	.quad	.LBB148
+	.quad	.LBE148-.LBB148
+	.byte	0xa0
+	.byte	0x15
+	.long	0x17b9
+	.uleb128 0x1
+	.long	0x1e25
+	.long	.LLST47
+	.long	.LVUS47
+	.byte	0
+	.uleb128 0x31
+	.long	0x1ce6
+	.quad	.LBI151
+	.value	.LVU262
+	.long	.LLRL48
+	.byte	0xa2
+	.byte	0xd
+	.long	0x17e5
+	.uleb128 0x6
+	.long	0x1d02
+	.uleb128 0x1
+	.long	0x1cf5
+	.long	.LLST49
+	.long	.LVUS49
+	.byte	0
+	.uleb128 0x32
+	.long	0x1c9f
+	.quad	.LBI154
+	.value	.LVU265
+	.long	.LLRL50
+	.byte	0xa2
+	.uleb128 0x6
+	.long	0x1cae
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.long	.LASF1173
+	.byte	0x1
+	.byte	0xba
+	.byte	0x11
+	.long	0x8a
+	.quad	.LFB546
+	.quad	.LFE546-.LFB546
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b52
+	.uleb128 0x55
+	.long	.LASF1160
+	.byte	0x1
+	.byte	0xba
+	.byte	0x35
+	.long	0x742
+	.long	.LLST3
+	.long	.LVUS3
+	.uleb128 0x33
+	.string	"end"
+	.byte	0xba
+	.byte	0x47
+	.long	0x1df
+	.long	.LLST4
+	.long	.LVUS4
+	.uleb128 0x28
+	.long	.LASF1174
+	.long	0x935
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.1
+	.uleb128 0x41
+	.string	"c0"
+	.byte	0xbe
+	.long	0x8a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x56
+	.long	.LASF1202
+	.byte	0x1
+	.value	0x131
+	.byte	0x1
+	.quad	.L26
+	.uleb128 0x41
+	.string	"cx"
+	.byte	0xd9
+	.long	0x8a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x42
+	.string	"r"
+	.byte	0xff
+	.byte	0xe
+	.long	0x8a
+	.long	.LLST5
+	.long	.LVUS5
+	.uleb128 0x2f
+	.long	0x18ae
+	.uleb128 0xe
+	.string	"_xp"
+	.byte	0x1
+	.value	0x10d
+	.byte	0x29
+	.long	0x1b52
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.long	0x18d8
+	.uleb128 0x8
+	.string	"_xp"
+	.value	0x111
+	.byte	0x29
+	.long	0x1b52
+	.long	.LLST16
+	.long	.LVUS16
+	.byte	0
+	.uleb128 0x2f
+	.long	0x18eb
+	.uleb128 0xe
+	.string	"_xp"
+	.byte	0x1
+	.value	0x123
+	.byte	0x29
+	.long	0x1b52
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB119
+	.quad	.LBE119-.LBB119
+	.long	0x1915
+	.uleb128 0x8
+	.string	"_xp"
+	.value	0x127
+	.byte	0x29
+	.long	0x1b52
+	.long	.LLST17
+	.long	.LVUS17
+	.byte	0
+	.uleb128 0x40
+	.long	0x1ba1
+	.quad	.LBI108
+	.value	.LVU40
+	.quad	.LBB108
+	.quad	.LBE108-.LBB108
+	.byte	0xc5
+	.byte	0x9
+	.long	0x1962
+	.uleb128 0x1
+	.long	0x1bb7
+	.long	.LLST6
+	.long	.LVUS6
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST7
+	.long	.LVUS7
+	.uleb128 0xb
+	.long	0x1bc0
+	.long	.LLST8
+	.long	.LVUS8
+	.byte	0
+	.uleb128 0x31
+	.long	0x1ba1
+	.quad	.LBI110
+	.value	.LVU50
+	.long	.LLRL9
+	.byte	0xcc
+	.byte	0x9
+	.long	0x19a9
+	.uleb128 0x1
+	.long	0x1bb7
+	.long	.LLST10
+	.long	.LVUS10
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST11
+	.long	.LVUS11
+	.uleb128 0x17
+	.long	.LLRL9
+	.uleb128 0xb
+	.long	0x1bc0
+	.long	.LLST12
+	.long	.LVUS12
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0x1ba1
+	.quad	.LBI114
+	.value	.LVU118
+	.quad	.LBB114
+	.quad	.LBE114-.LBB114
+	.byte	0x1
+	.value	0x103
+	.byte	0x9
+	.long	0x19f8
+	.uleb128 0x1
+	.long	0x1bb7
+	.long	.LLST13
+	.long	.LVUS13
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST14
+	.long	.LVUS14
+	.uleb128 0xb
+	.long	0x1bc0
+	.long	.LLST15
+	.long	.LVUS15
+	.byte	0
+	.uleb128 0x57
+	.long	0x1ba1
+	.quad	.LBB117
+	.quad	.LBE117-.LBB117
+	.byte	0x1
+	.value	0x119
+	.byte	0x9
+	.long	0x1a25
+	.uleb128 0x6
+	.long	0x1bb7
+	.uleb128 0x6
+	.long	0x1bae
+	.uleb128 0x30
+	.long	0x1bc0
+	.byte	0
+	.uleb128 0x15
+	.long	0x1ba1
+	.quad	.LBI120
+	.value	.LVU189
+	.quad	.LBB120
+	.quad	.LBE120-.LBB120
+	.byte	0x1
+	.value	0x12e
+	.byte	0x5
+	.long	0x1a74
+	.uleb128 0x1
+	.long	0x1bb7
+	.long	.LLST18
+	.long	.LVUS18
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST19
+	.long	.LVUS19
+	.uleb128 0xb
+	.long	0x1bc0
+	.long	.LLST20
+	.long	.LVUS20
+	.byte	0
+	.uleb128 0xa
+	.long	0x1ba1
+	.quad	.LBI122
+	.value	.LVU198
+	.long	.LLRL21
+	.value	0x132
+	.byte	0x5
+	.long	0x1abc
+	.uleb128 0x1
+	.long	0x1bb7
+	.long	.LLST22
+	.long	.LVUS22
+	.uleb128 0x1
+	.long	0x1bae
+	.long	.LLST23
+	.long	.LVUS23
+	.uleb128 0x17
+	.long	.LLRL21
+	.uleb128 0xb
+	.long	0x1bc0
+	.long	.LLST24
+	.long	.LVUS24
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.quad	.LVL11
+	.long	0x1bca
+	.long	0x1ae5
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x7a
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7b
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x34
+	.quad	.LVL19
+	.long	0x1bca
+	.long	0x1b08
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x2
+	.byte	0x75
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7b
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x31
+	.byte	0
+	.uleb128 0x58
+	.quad	.LVL28
+	.long	0x781
+	.uleb128 0x34
+	.quad	.LVL32
+	.long	0x1bca
+	.long	0x1b38
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7b
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x32
+	.byte	0
+	.uleb128 0x1b
+	.quad	.LVL42
+	.long	0x1bca
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x7b
+	.sleb128 0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x1
+	.byte	0x33
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x8a
+	.uleb128 0x59
+	.long	.LASF1176
+	.byte	0x1
+	.byte	0x8c
+	.byte	0xf
+	.long	0x39
+	.byte	0x1
+	.long	0x1ba1
+	.uleb128 0x2a
+	.string	"p"
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x1466
+	.uleb128 0x2a
+	.string	"n"
+	.byte	0x8e
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x90
+	.byte	0xc
+	.long	0x39
+	.uleb128 0x29
+	.uleb128 0x22
+	.string	"q"
+	.byte	0x98
+	.byte	0x15
+	.long	0x1df
+	.uleb128 0x22
+	.string	"v"
+	.byte	0xa0
+	.byte	0x11
+	.long	0x6b9
+	.uleb128 0x22
+	.string	"z"
+	.byte	0xa1
+	.byte	0x11
+	.long	0x6b9
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.long	.LASF1196
+	.byte	0x1
+	.byte	0x72
+	.byte	0xd
+	.byte	0x1
+	.long	0x1bca
+	.uleb128 0x2a
+	.string	"i"
+	.byte	0x73
+	.byte	0x15
+	.long	0x742
+	.uleb128 0x2a
+	.string	"n"
+	.byte	0x74
+	.byte	0xe
+	.long	0x8a
+	.uleb128 0x22
+	.string	"s"
+	.byte	0x76
+	.byte	0x1a
+	.long	0x1466
+	.byte	0
+	.uleb128 0x5b
+	.long	.LASF1203
+	.byte	0x1
+	.byte	0x5e
+	.byte	0xc
+	.long	0x438
+	.quad	.LFB543
+	.quad	.LFE543-.LFB543
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c3a
+	.uleb128 0x43
+	.long	.LASF1177
+	.byte	0x5f
+	.byte	0xf
+	.long	0x1b52
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x43
+	.long	.LASF1160
+	.byte	0x60
+	.byte	0x15
+	.long	0x742
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x33
+	.string	"e"
+	.byte	0x61
+	.byte	0x11
+	.long	0x1df
+	.long	.LLST0
+	.long	.LVUS0
+	.uleb128 0x33
+	.string	"n"
+	.byte	0x62
+	.byte	0xe
+	.long	0x8a
+	.long	.LLST1
+	.long	.LVUS1
+	.uleb128 0x42
+	.string	"i"
+	.byte	0x64
+	.byte	0x1a
+	.long	0x1466
+	.long	.LLST2
+	.long	.LVUS2
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF1179
+	.byte	0x54
+	.long	0x1c62
+	.uleb128 0x45
+	.long	.LASF1160
+	.byte	0x55
+	.long	0x742
+	.uleb128 0x28
+	.long	.LASF1174
+	.long	0x1c72
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.2
+	.byte	0
+	.uleb128 0x18
+	.long	0x79
+	.long	0x1c72
+	.uleb128 0x19
+	.long	0x45
+	.byte	0x18
+	.byte	0
+	.uleb128 0xc
+	.long	0x1c62
+	.uleb128 0x44
+	.long	.LASF1180
+	.byte	0x4d
+	.long	0x1c9f
+	.uleb128 0x45
+	.long	.LASF1160
+	.byte	0x4e
+	.long	0x742
+	.uleb128 0x28
+	.long	.LASF1174
+	.long	0x1c72
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1181
+	.value	0x597
+	.long	0x4c
+	.long	0x1cbc
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x597
+	.byte	0x1c
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1182
+	.value	0x535
+	.long	0x6b9
+	.long	0x1ce6
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x535
+	.byte	0x19
+	.long	0x6b9
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x535
+	.byte	0x26
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1183
+	.value	0x529
+	.long	0x6b9
+	.long	0x1d10
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x529
+	.byte	0x17
+	.long	0x6b9
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x529
+	.byte	0x24
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1184
+	.value	0x40a
+	.long	0x6b9
+	.long	0x1d3a
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x40a
+	.byte	0x1d
+	.long	0x6b9
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x40a
+	.byte	0x2a
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1185
+	.value	0x404
+	.long	0x6b9
+	.long	0x1d64
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x404
+	.byte	0x1c
+	.long	0x6b9
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x404
+	.byte	0x29
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1186
+	.value	0x3f2
+	.long	0x6b9
+	.long	0x1d8e
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x3f2
+	.byte	0x1d
+	.long	0x6b9
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x3f2
+	.byte	0x2a
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1187
+	.value	0x3ec
+	.long	0x6b9
+	.long	0x1db8
+	.uleb128 0x5
+	.string	"__A"
+	.byte	0x2
+	.value	0x3ec
+	.byte	0x1c
+	.long	0x6b9
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x3ec
+	.byte	0x29
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x5c
+	.long	.LASF1204
+	.byte	0x2
+	.value	0x31a
+	.byte	0x1
+	.long	0x6b9
+	.byte	0x3
+	.uleb128 0x5d
+	.long	.LASF1188
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x1
+	.byte	0x3
+	.long	0x1def
+	.uleb128 0x5
+	.string	"__P"
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x1e
+	.long	0x1def
+	.uleb128 0x5
+	.string	"__B"
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x2b
+	.long	0x6b9
+	.byte	0
+	.uleb128 0x2
+	.long	0x6d6
+	.uleb128 0x14
+	.long	.LASF1189
+	.value	0x2bd
+	.long	0x6b9
+	.long	0x1e11
+	.uleb128 0x5
+	.string	"__P"
+	.byte	0x2
+	.value	0x2bd
+	.byte	0x23
+	.long	0x1e11
+	.byte	0
+	.uleb128 0x2
+	.long	0x6e3
+	.uleb128 0x14
+	.long	.LASF1190
+	.value	0x2b7
+	.long	0x6b9
+	.long	0x1e33
+	.uleb128 0x5
+	.string	"__P"
+	.byte	0x2
+	.value	0x2b7
+	.byte	0x20
+	.long	0x1e33
+	.byte	0
+	.uleb128 0x2
+	.long	0x6c5
+	.uleb128 0x1c
+	.long	.LASF1191
+	.byte	0x3
+	.value	0x249
+	.byte	0x13
+	.long	0x438
+	.byte	0x3
+	.long	0x1e61
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x3
+	.value	0x249
+	.byte	0x32
+	.long	0x405
+	.uleb128 0x5
+	.string	"n"
+	.byte	0x3
+	.value	0x249
+	.byte	0x3c
+	.long	0x39
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1192
+	.byte	0x3
+	.value	0x23e
+	.byte	0x16
+	.long	0x39
+	.byte	0x3
+	.long	0x1e7f
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x3
+	.value	0x23e
+	.byte	0x38
+	.long	0x1e7f
+	.byte	0
+	.uleb128 0x2
+	.long	0x2d0
+	.uleb128 0x1c
+	.long	.LASF1193
+	.byte	0x3
+	.value	0x21a
+	.byte	0x16
+	.long	0x39
+	.byte	0x3
+	.long	0x1ea2
+	.uleb128 0x5
+	.string	"c"
+	.byte	0x3
+	.value	0x21a
+	.byte	0x2d
+	.long	0x8a
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1194
+	.byte	0x3
+	.value	0x1f0
+	.byte	0x18
+	.long	0x8a
+	.byte	0x3
+	.long	0x1ed7
+	.uleb128 0x5
+	.string	"pp"
+	.byte	0x3
+	.value	0x1f0
+	.byte	0x3b
+	.long	0x1ed7
+	.uleb128 0xe
+	.string	"p"
+	.byte	0x3
+	.value	0x1f2
+	.byte	0x1a
+	.long	0x1466
+	.uleb128 0xe
+	.string	"c"
+	.byte	0x3
+	.value	0x1f3
+	.byte	0xe
+	.long	0x8a
+	.byte	0
+	.uleb128 0x2
+	.long	0x1466
+	.uleb128 0x1c
+	.long	.LASF1195
+	.byte	0x3
+	.value	0x1de
+	.byte	0x19
+	.long	0x146b
+	.byte	0x3
+	.long	0x1f05
+	.uleb128 0x5
+	.string	"w"
+	.byte	0x3
+	.value	0x1de
+	.byte	0x32
+	.long	0x146b
+	.uleb128 0x5
+	.string	"c"
+	.byte	0x3
+	.value	0x1de
+	.byte	0x3e
+	.long	0x8a
+	.byte	0
+	.uleb128 0x5e
+	.long	.LASF1197
+	.byte	0x3
+	.value	0x1a9
+	.byte	0x14
+	.byte	0x3
+	.long	0x1f39
+	.uleb128 0x5
+	.string	"s"
+	.byte	0x3
+	.value	0x1a9
+	.byte	0x35
+	.long	0x405
+	.uleb128 0x5
+	.string	"e"
+	.byte	0x3
+	.value	0x1a9
+	.byte	0x41
+	.long	0x8a
+	.uleb128 0x29
+	.uleb128 0xe
+	.string	"_xp"
+	.byte	0x3
+	.value	0x1ac
+	.byte	0x2d
+	.long	0x1b52
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1198
+	.byte	0x3
+	.value	0x1a3
+	.byte	0x13
+	.long	0x438
+	.byte	0x3
+	.long	0x1f57
+	.uleb128 0x5
+	.string	"c"
+	.byte	0x3
+	.value	0x1a3
+	.byte	0x27
+	.long	0x8a
+	.byte	0
+	.uleb128 0x35
+	.long	0x1c77
+	.quad	.LFB541
+	.quad	.LFE541-.LFB541
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1fe3
+	.uleb128 0x1
+	.long	0x1c81
+	.long	.LLST113
+	.long	.LVUS113
+	.uleb128 0x32
+	.long	0x1c77
+	.quad	.LBI314
+	.value	.LVU638
+	.long	.LLRL114
+	.byte	0x4d
+	.uleb128 0x1
+	.long	0x1c81
+	.long	.LLST115
+	.long	.LVUS115
+	.uleb128 0x17
+	.long	.LLRL114
+	.uleb128 0x1b
+	.quad	.LVL174
+	.long	0x781
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC7
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x50
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.3
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0x1c3a
+	.quad	.LFB542
+	.quad	.LFE542-.LFB542
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x206f
+	.uleb128 0x1
+	.long	0x1c44
+	.long	.LLST116
+	.long	.LVUS116
+	.uleb128 0x32
+	.long	0x1c3a
+	.quad	.LBI320
+	.value	.LVU649
+	.long	.LLRL117
+	.byte	0x54
+	.uleb128 0x1
+	.long	0x1c44
+	.long	.LLST118
+	.long	.LVUS118
+	.uleb128 0x17
+	.long	.LLRL117
+	.uleb128 0x1b
+	.quad	.LVL178
+	.long	0x781
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC8
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x57
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	0x896
+	.quad	.LFB559
+	.quad	.LFE559-.LFB559
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x213b
+	.uleb128 0x1
+	.long	0x8a6
+	.long	.LLST119
+	.long	.LVUS119
+	.uleb128 0x1
+	.long	0x8b3
+	.long	.LLST120
+	.long	.LVUS120
+	.uleb128 0xb
+	.long	0x8d3
+	.long	.LLST121
+	.long	.LVUS121
+	.uleb128 0xa
+	.long	0x896
+	.quad	.LBI327
+	.value	.LVU661
+	.long	.LLRL122
+	.value	0x265
+	.byte	0x11
+	.long	0x212d
+	.uleb128 0x1
+	.long	0x8a6
+	.long	.LLST123
+	.long	.LVUS123
+	.uleb128 0x1
+	.long	0x8b3
+	.long	.LLST124
+	.long	.LVUS124
+	.uleb128 0x17
+	.long	.LLRL122
+	.uleb128 0x30
+	.long	0x8d3
+	.uleb128 0x1b
+	.quad	.LVL183
+	.long	0x781
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC9
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x9
+	.byte	0x3
+	.quad	.LC0
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x51
+	.uleb128 0x3
+	.byte	0xa
+	.value	0x269
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x52
+	.uleb128 0x9
+	.byte	0x3
+	.quad	__PRETTY_FUNCTION__.0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.quad	.LVL187
+	.long	0x1805
+	.byte	0
+	.uleb128 0x5f
+	.long	0xa37
+	.quad	.LFB555
+	.quad	.LFE555-.LFB555
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	0xa47
+	.long	.LLST155
+	.long	.LVUS155
+	.uleb128 0x1
+	.long	0xa52
+	.long	.LLST156
+	.long	.LVUS156
+	.uleb128 0x27
+	.quad	.LVL245
+	.long	0xa5e
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x54
+	.uleb128 0x3
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x49
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x18
+	.uleb128 0x7e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 34
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x52
+	.uleb128 0x1
+	.uleb128 0x2138
+	.uleb128 0x5
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x50
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x51
+	.uleb128 0x48
+	.byte	0x1
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x82
+	.uleb128 0x19
+	.uleb128 0x83
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x52
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x53
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x54
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x55
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x17
+	.uleb128 0x2137
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x56
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x57
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x58
+	.uleb128 0x48
+	.byte	0
+	.uleb128 0x7d
+	.uleb128 0x1
+	.uleb128 0x7f
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x59
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_loclists,"",@progbits
+	.long	.Ldebug_loc3-.Ldebug_loc2
+.Ldebug_loc2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.Ldebug_loc0:
+.LVUS163:
+	.uleb128 0
+	.uleb128 .LVU930
+	.uleb128 .LVU930
+	.uleb128 0
+.LLST163:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL254-1-.Ltext0
+	.uleb128 .LFE561-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS164:
+	.uleb128 0
+	.uleb128 .LVU930
+	.uleb128 .LVU930
+	.uleb128 0
+.LLST164:
+	.byte	0x4
+	.uleb128 .LVL253-.Ltext0
+	.uleb128 .LVL254-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL254-1-.Ltext0
+	.uleb128 .LFE561-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS161:
+	.uleb128 0
+	.uleb128 .LVU924
+	.uleb128 .LVU924
+	.uleb128 0
+.LLST161:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL252-1-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS162:
+	.uleb128 0
+	.uleb128 .LVU921
+	.uleb128 .LVU921
+	.uleb128 0
+.LLST162:
+	.byte	0x4
+	.uleb128 .LVL250-.Ltext0
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL251-.Ltext0
+	.uleb128 .LFE560-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS159:
+	.uleb128 0
+	.uleb128 .LVU911
+	.uleb128 .LVU911
+	.uleb128 0
+.LLST159:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL249-1-.Ltext0
+	.uleb128 .LFE557-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS160:
+	.uleb128 0
+	.uleb128 .LVU911
+	.uleb128 .LVU911
+	.uleb128 0
+.LLST160:
+	.byte	0x4
+	.uleb128 .LVL248-.Ltext0
+	.uleb128 .LVL249-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL249-1-.Ltext0
+	.uleb128 .LFE557-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS157:
+	.uleb128 0
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 0
+.LLST157:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS158:
+	.uleb128 0
+	.uleb128 .LVU905
+	.uleb128 .LVU905
+	.uleb128 0
+.LLST158:
+	.byte	0x4
+	.uleb128 .LVL246-.Ltext0
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL247-1-.Ltext0
+	.uleb128 .LFE556-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS153:
+	.uleb128 0
+	.uleb128 .LVU890
+	.uleb128 .LVU890
+	.uleb128 .LVU894
+	.uleb128 .LVU894
+	.uleb128 0
+.LLST153:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL241-1-.Ltext0
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL242-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS154:
+	.uleb128 0
+	.uleb128 .LVU887
+	.uleb128 .LVU887
+	.uleb128 .LVU895
+	.uleb128 .LVU895
+	.uleb128 0
+.LLST154:
+	.byte	0x4
+	.uleb128 .LVL239-.Ltext0
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL240-.Ltext0
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL243-.Ltext0
+	.uleb128 .LFE554-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS151:
+	.uleb128 0
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 0
+.LLST151:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS152:
+	.uleb128 0
+	.uleb128 .LVU877
+	.uleb128 .LVU877
+	.uleb128 .LVU879
+	.uleb128 .LVU879
+	.uleb128 0
+.LLST152:
+	.byte	0x4
+	.uleb128 .LVL236-.Ltext0
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL237-.Ltext0
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x4
+	.uleb128 .LVL238-1-.Ltext0
+	.uleb128 .LFE553-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS144:
+	.uleb128 0
+	.uleb128 .LVU855
+	.uleb128 .LVU855
+	.uleb128 .LVU856
+	.uleb128 .LVU856
+	.uleb128 .LVU866
+.LLST144:
+	.byte	0x4
+	.uleb128 .LVL228-.Ltext0
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL232-.Ltext0
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS145:
+	.uleb128 .LVU844
+	.uleb128 .LVU846
+.LLST145:
+	.byte	0x4
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 .LVL229-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS147:
+	.uleb128 .LVU849
+	.uleb128 .LVU853
+	.uleb128 .LVU856
+	.uleb128 .LVU861
+.LLST147:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS148:
+	.uleb128 .LVU849
+	.uleb128 .LVU853
+	.uleb128 .LVU856
+	.uleb128 .LVU861
+.LLST148:
+	.byte	0x4
+	.uleb128 .LVL230-.Ltext0
+	.uleb128 .LVL231-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS149:
+	.uleb128 .LVU858
+	.uleb128 .LVU861
+.LLST149:
+	.byte	0x4
+	.uleb128 .LVL233-.Ltext0
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS150:
+	.uleb128 .LVU863
+	.uleb128 .LVU866
+.LLST150:
+	.byte	0x4
+	.uleb128 .LVL234-.Ltext0
+	.uleb128 .LVL235-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS125:
+	.uleb128 0
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU709
+	.uleb128 .LVU709
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU812
+	.uleb128 .LVU812
+	.uleb128 .LVU817
+	.uleb128 .LVU817
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU832
+	.uleb128 .LVU832
+	.uleb128 0
+.LLST125:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL193-.Ltext0
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0x4
+	.uleb128 .LVL226-.Ltext0
+	.uleb128 .LFE551-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS126:
+	.uleb128 0
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU708
+	.uleb128 .LVU708
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU736
+	.uleb128 .LVU738
+	.uleb128 .LVU743
+	.uleb128 .LVU746
+	.uleb128 .LVU754
+	.uleb128 .LVU754
+	.uleb128 .LVU755
+.LLST126:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL192-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL208-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS127:
+	.uleb128 0
+	.uleb128 .LVU703
+	.uleb128 .LVU703
+	.uleb128 .LVU710
+	.uleb128 .LVU710
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU712
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU723
+	.uleb128 .LVU723
+	.uleb128 .LVU772
+	.uleb128 .LVU772
+	.uleb128 .LVU833
+	.uleb128 .LVU833
+	.uleb128 0
+.LLST127:
+	.byte	0x4
+	.uleb128 .LVL189-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL194-.Ltext0
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL195-1-.Ltext0
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL212-.Ltext0
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 0x1
+	.byte	0x5c
+	.byte	0x4
+	.uleb128 .LVL227-.Ltext0
+	.uleb128 .LFE551-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS128:
+	.uleb128 .LVU753
+	.uleb128 .LVU755
+	.uleb128 .LVU769
+	.uleb128 .LVU770
+	.uleb128 .LVU790
+	.uleb128 .LVU791
+	.uleb128 .LVU804
+	.uleb128 .LVU805
+	.uleb128 .LVU805
+	.uleb128 .LVU830
+.LLST128:
+	.byte	0x4
+	.uleb128 .LVL207-.Ltext0
+	.uleb128 .LVL209-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL210-.Ltext0
+	.uleb128 .LVL211-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL213-.Ltext0
+	.uleb128 .LVL214-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL215-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS133:
+	.uleb128 .LVU717
+	.uleb128 .LVU718
+	.uleb128 .LVU718
+	.uleb128 .LVU721
+	.uleb128 .LVU721
+	.uleb128 .LVU723
+.LLST133:
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL198-.Ltext0
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL199-.Ltext0
+	.uleb128 .LVL200-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS143:
+	.uleb128 .LVU825
+	.uleb128 .LVU827
+	.uleb128 .LVU827
+	.uleb128 .LVU829
+	.uleb128 .LVU829
+	.uleb128 .LVU830
+.LLST143:
+	.byte	0x4
+	.uleb128 .LVL222-.Ltext0
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0x4
+	.uleb128 .LVL223-.Ltext0
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 0x3
+	.byte	0x7d
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL224-.Ltext0
+	.uleb128 .LVL225-.Ltext0
+	.uleb128 0x1
+	.byte	0x5d
+	.byte	0
+.LVUS130:
+	.uleb128 .LVU694
+	.uleb128 .LVU703
+	.uleb128 .LVU712
+	.uleb128 .LVU714
+.LLST130:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS131:
+	.uleb128 .LVU694
+	.uleb128 .LVU703
+	.uleb128 .LVU712
+	.uleb128 .LVU713
+	.uleb128 .LVU713
+	.uleb128 .LVU714
+.LLST131:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL191-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL195-.Ltext0
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL196-1-.Ltext0
+	.uleb128 .LVL197-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS132:
+	.uleb128 .LVU696
+	.uleb128 .LVU698
+.LLST132:
+	.byte	0x4
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 .LVL190-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS134:
+	.uleb128 .LVU727
+	.uleb128 .LVU729
+.LLST134:
+	.byte	0x4
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 .LVL201-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS136:
+	.uleb128 .LVU732
+	.uleb128 .LVU736
+	.uleb128 .LVU738
+	.uleb128 .LVU743
+.LLST136:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0
+.LVUS137:
+	.uleb128 .LVU732
+	.uleb128 .LVU736
+	.uleb128 .LVU738
+	.uleb128 .LVU743
+.LLST137:
+	.byte	0x4
+	.uleb128 .LVL202-.Ltext0
+	.uleb128 .LVL203-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL205-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS138:
+	.uleb128 .LVU740
+	.uleb128 .LVU746
+.LLST138:
+	.byte	0x4
+	.uleb128 .LVL204-.Ltext0
+	.uleb128 .LVL206-.Ltext0
+	.uleb128 0x3
+	.byte	0x75
+	.sleb128 32
+	.byte	0x9f
+	.byte	0
+.LVUS140:
+	.uleb128 .LVU806
+	.uleb128 .LVU812
+	.uleb128 .LVU817
+	.uleb128 .LVU823
+.LLST140:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0
+.LVUS141:
+	.uleb128 .LVU806
+	.uleb128 .LVU812
+	.uleb128 .LVU817
+	.uleb128 .LVU821
+	.uleb128 .LVU821
+	.uleb128 .LVU823
+.LLST141:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL217-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL218-.Ltext0
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL219-.Ltext0
+	.uleb128 .LVL221-.Ltext0
+	.uleb128 0x1
+	.byte	0x56
+	.byte	0
+.LVUS142:
+	.uleb128 .LVU808
+	.uleb128 .LVU810
+.LLST142:
+	.byte	0x4
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 .LVL216-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS56:
+	.uleb128 0
+	.uleb128 .LVU369
+	.uleb128 .LVU369
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 0
+.LLST56:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS57:
+	.uleb128 0
+	.uleb128 .LVU363
+	.uleb128 .LVU363
+	.uleb128 0
+.LLST57:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS58:
+	.uleb128 0
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 0
+.LLST58:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS59:
+	.uleb128 0
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU506
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 0
+.LLST59:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS60:
+	.uleb128 .LVU360
+	.uleb128 .LVU366
+	.uleb128 .LVU366
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 .LVU391
+	.uleb128 .LVU391
+	.uleb128 .LVU430
+	.uleb128 .LVU430
+	.uleb128 .LVU432
+	.uleb128 .LVU432
+	.uleb128 .LVU448
+	.uleb128 .LVU448
+	.uleb128 .LVU454
+	.uleb128 .LVU454
+	.uleb128 .LVU463
+	.uleb128 .LVU463
+	.uleb128 .LVU471
+	.uleb128 .LVU471
+	.uleb128 .LVU474
+	.uleb128 .LVU474
+	.uleb128 .LVU502
+	.uleb128 .LVU506
+	.uleb128 .LVU508
+	.uleb128 .LVU508
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU577
+	.uleb128 .LVU577
+	.uleb128 .LVU616
+	.uleb128 .LVU616
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU633
+.LLST60:
+	.byte	0x4
+	.uleb128 .LVL98-.Ltext0
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL100-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL122-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL126-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL129-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL140-.Ltext0
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -16
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL170-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS61:
+	.uleb128 .LVU363
+	.uleb128 .LVU368
+	.uleb128 .LVU368
+	.uleb128 .LVU388
+	.uleb128 .LVU388
+	.uleb128 0
+.LLST61:
+	.byte	0x4
+	.uleb128 .LVL99-.Ltext0
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL101-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x6
+	.byte	0x78
+	.sleb128 0
+	.byte	0x72
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 .LFE550-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS66:
+	.uleb128 .LVU391
+	.uleb128 .LVU415
+	.uleb128 .LVU415
+	.uleb128 .LVU431
+	.uleb128 .LVU431
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU502
+	.uleb128 .LVU502
+	.uleb128 .LVU505
+.LLST66:
+	.byte	0x4
+	.uleb128 .LVL111-.Ltext0
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL115-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -32
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS68:
+	.uleb128 .LVU399
+	.uleb128 .LVU420
+.LLST68:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL117-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+.LVUS71:
+	.uleb128 .LVU409
+	.uleb128 .LVU416
+.LLST71:
+	.byte	0x4
+	.uleb128 .LVL114-.Ltext0
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+.LVUS74:
+	.uleb128 .LVU416
+	.uleb128 .LVU421
+.LLST74:
+	.byte	0x4
+	.uleb128 .LVL116-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS76:
+	.uleb128 .LVU425
+	.uleb128 .LVU428
+.LLST76:
+	.byte	0x4
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 .LVL118-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS78:
+	.uleb128 .LVU397
+	.uleb128 .LVU399
+.LLST78:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS80:
+	.uleb128 .LVU401
+	.uleb128 .LVU405
+.LLST80:
+	.byte	0x4
+	.uleb128 .LVL112-.Ltext0
+	.uleb128 .LVL113-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+.LVUS82:
+	.uleb128 .LVU434
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU485
+.LLST82:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3894
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3894
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3894
+	.sleb128 0
+	.byte	0
+.LVUS83:
+	.uleb128 .LVU436
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU485
+.LLST83:
+	.byte	0x4
+	.uleb128 .LVL119-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x3
+	.byte	0x72
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS84:
+	.uleb128 .LVU438
+	.uleb128 .LVU446
+	.uleb128 .LVU446
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU460
+	.uleb128 .LVU460
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU476
+	.uleb128 .LVU476
+	.uleb128 .LVU477
+	.uleb128 .LVU477
+	.uleb128 .LVU485
+.LLST84:
+	.byte	0x4
+	.uleb128 .LVL120-.Ltext0
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL121-.Ltext0
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL125-.Ltext0
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL130-.Ltext0
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL131-.Ltext0
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS86:
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU485
+	.uleb128 .LVU495
+	.uleb128 .LVU495
+	.uleb128 .LVU496
+.LLST86:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL135-.Ltext0
+	.uleb128 .LVL136-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS87:
+	.uleb128 .LVU451
+	.uleb128 .LVU454
+	.uleb128 .LVU468
+	.uleb128 .LVU471
+	.uleb128 .LVU485
+	.uleb128 .LVU492
+	.uleb128 .LVU492
+	.uleb128 .LVU493
+	.uleb128 .LVU493
+	.uleb128 .LVU501
+	.uleb128 .LVU503
+	.uleb128 .LVU505
+.LLST87:
+	.byte	0x4
+	.uleb128 .LVL123-.Ltext0
+	.uleb128 .LVL124-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL127-.Ltext0
+	.uleb128 .LVL128-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL132-.Ltext0
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL133-.Ltext0
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL134-.Ltext0
+	.uleb128 .LVL137-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL138-.Ltext0
+	.uleb128 .LVL139-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 2
+	.byte	0x9f
+	.byte	0
+.LVUS88:
+	.uleb128 .LVU508
+	.uleb128 .LVU530
+	.uleb128 .LVU530
+	.uleb128 .LVU578
+	.uleb128 .LVU578
+	.uleb128 .LVU583
+	.uleb128 .LVU583
+	.uleb128 .LVU631
+.LLST88:
+	.byte	0x4
+	.uleb128 .LVL141-.Ltext0
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL146-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x3
+	.byte	0x70
+	.sleb128 -64
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL169-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS89:
+	.uleb128 .LVU515
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU536
+	.uleb128 .LVU536
+	.uleb128 .LVU544
+.LLST89:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL150-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 -16
+	.byte	0
+.LVUS94:
+	.uleb128 .LVU531
+	.uleb128 .LVU542
+.LLST94:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS95:
+	.uleb128 .LVU536
+	.uleb128 .LVU550
+.LLST95:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL152-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS97:
+	.uleb128 .LVU525
+	.uleb128 .LVU529
+	.uleb128 .LVU529
+	.uleb128 .LVU531
+.LLST97:
+	.byte	0x4
+	.uleb128 .LVL144-.Ltext0
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0x4
+	.uleb128 .LVL145-.Ltext0
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS98:
+	.uleb128 .LVU533
+	.uleb128 .LVU536
+.LLST98:
+	.byte	0x4
+	.uleb128 .LVL147-.Ltext0
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS100:
+	.uleb128 .LVU538
+	.uleb128 .LVU542
+.LLST100:
+	.byte	0x4
+	.uleb128 .LVL148-.Ltext0
+	.uleb128 .LVL149-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS105:
+	.uleb128 .LVU546
+	.uleb128 .LVU553
+.LLST105:
+	.byte	0x4
+	.uleb128 .LVL151-.Ltext0
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 0x1
+	.byte	0x64
+	.byte	0
+.LVUS107:
+	.uleb128 .LVU563
+	.uleb128 .LVU567
+.LLST107:
+	.byte	0x4
+	.uleb128 .LVL153-.Ltext0
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 0x1
+	.byte	0x63
+	.byte	0
+.LVUS108:
+	.uleb128 .LVU571
+	.uleb128 .LVU575
+.LLST108:
+	.byte	0x4
+	.uleb128 .LVL154-.Ltext0
+	.uleb128 .LVL155-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS91:
+	.uleb128 .LVU513
+	.uleb128 .LVU515
+.LLST91:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS93:
+	.uleb128 .LVU517
+	.uleb128 .LVU521
+.LLST93:
+	.byte	0x4
+	.uleb128 .LVL142-.Ltext0
+	.uleb128 .LVL143-.Ltext0
+	.uleb128 0x2
+	.byte	0x78
+	.sleb128 0
+	.byte	0
+.LVUS110:
+	.uleb128 .LVU583
+	.uleb128 .LVU628
+.LLST110:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x6
+	.byte	0xa0
+	.long	.Ldebug_info0+3894
+	.sleb128 0
+	.byte	0
+.LVUS111:
+	.uleb128 .LVU585
+	.uleb128 .LVU590
+	.uleb128 .LVU590
+	.uleb128 .LVU592
+	.uleb128 .LVU592
+	.uleb128 .LVU599
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU610
+	.uleb128 .LVU610
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU628
+.LLST111:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL158-.Ltext0
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL159-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -3
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x3
+	.byte	0x78
+	.sleb128 -4
+	.byte	0x9f
+	.byte	0
+.LVUS112:
+	.uleb128 .LVU586
+	.uleb128 .LVU597
+	.uleb128 .LVU597
+	.uleb128 .LVU599
+	.uleb128 .LVU599
+	.uleb128 .LVU602
+	.uleb128 .LVU602
+	.uleb128 .LVU607
+	.uleb128 .LVU607
+	.uleb128 .LVU610
+	.uleb128 .LVU610
+	.uleb128 .LVU615
+	.uleb128 .LVU615
+	.uleb128 .LVU618
+	.uleb128 .LVU618
+	.uleb128 .LVU620
+	.uleb128 .LVU620
+	.uleb128 .LVU628
+.LLST112:
+	.byte	0x4
+	.uleb128 .LVL157-.Ltext0
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL160-.Ltext0
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL161-.Ltext0
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 -2
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL162-.Ltext0
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL163-.Ltext0
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL164-.Ltext0
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 -3
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL165-.Ltext0
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL166-.Ltext0
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL167-.Ltext0
+	.uleb128 .LVL168-.Ltext0
+	.uleb128 0x8
+	.byte	0x78
+	.sleb128 -4
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS62:
+	.uleb128 .LVU369
+	.uleb128 .LVU384
+	.uleb128 .LVU385
+	.uleb128 .LVU387
+.LLST62:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL107-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL109-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS63:
+	.uleb128 .LVU369
+	.uleb128 .LVU388
+.LLST63:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS65:
+	.uleb128 .LVU369
+	.uleb128 .LVU377
+	.uleb128 .LVU377
+	.uleb128 .LVU380
+	.uleb128 .LVU380
+	.uleb128 .LVU383
+	.uleb128 .LVU385
+	.uleb128 .LVU388
+.LLST65:
+	.byte	0x4
+	.uleb128 .LVL102-.Ltext0
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL104-.Ltext0
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 0x3
+	.byte	0x71
+	.sleb128 -1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL105-.Ltext0
+	.uleb128 .LVL106-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL108-.Ltext0
+	.uleb128 .LVL110-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS51:
+	.uleb128 0
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 0
+.LLST51:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LFE548-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS52:
+	.uleb128 0
+	.uleb128 .LVU355
+	.uleb128 .LVU355
+	.uleb128 .LVU357
+.LLST52:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL96-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS53:
+	.uleb128 0
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 0
+.LLST53:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LFE548-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS54:
+	.uleb128 0
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 0
+.LLST54:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LFE548-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS55:
+	.uleb128 .LVU352
+	.uleb128 .LVU357
+	.uleb128 .LVU357
+	.uleb128 0
+.LLST55:
+	.byte	0x4
+	.uleb128 .LVL95-.Ltext0
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL97-1-.Ltext0
+	.uleb128 .LFE548-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS25:
+	.uleb128 0
+	.uleb128 .LVU213
+	.uleb128 .LVU213
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST25:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL56-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS26:
+	.uleb128 0
+	.uleb128 .LVU218
+	.uleb128 .LVU218
+	.uleb128 0
+.LLST26:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL58-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS27:
+	.uleb128 0
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST27:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS28:
+	.uleb128 0
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST28:
+	.byte	0x4
+	.uleb128 .LVL55-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS29:
+	.uleb128 .LVU214
+	.uleb128 0
+.LLST29:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS30:
+	.uleb128 .LVU215
+	.uleb128 .LVU219
+	.uleb128 .LVU219
+	.uleb128 0
+.LLST30:
+	.byte	0x4
+	.uleb128 .LVL57-.Ltext0
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS31:
+	.uleb128 .LVU220
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST31:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0
+.LVUS32:
+	.uleb128 .LVU221
+	.uleb128 .LVU224
+	.uleb128 .LVU224
+	.uleb128 0
+.LLST32:
+	.byte	0x4
+	.uleb128 .LVL59-.Ltext0
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL60-.Ltext0
+	.uleb128 .LFE547-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS33:
+	.uleb128 .LVU228
+	.uleb128 .LVU235
+	.uleb128 .LVU235
+	.uleb128 .LVU285
+	.uleb128 .LVU285
+	.uleb128 .LVU300
+	.uleb128 .LVU300
+	.uleb128 .LVU301
+	.uleb128 .LVU301
+	.uleb128 .LVU309
+	.uleb128 .LVU309
+	.uleb128 .LVU310
+	.uleb128 .LVU310
+	.uleb128 .LVU311
+	.uleb128 .LVU311
+	.uleb128 .LVU313
+	.uleb128 .LVU313
+	.uleb128 .LVU314
+	.uleb128 .LVU314
+	.uleb128 .LVU315
+	.uleb128 .LVU315
+	.uleb128 .LVU316
+	.uleb128 .LVU316
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU318
+	.uleb128 .LVU318
+	.uleb128 .LVU319
+	.uleb128 .LVU319
+	.uleb128 .LVU335
+.LLST33:
+	.byte	0x4
+	.uleb128 .LVL61-.Ltext0
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL62-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL77-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL80-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL82-.Ltext0
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 194
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL83-.Ltext0
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL85-.Ltext0
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 224
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL86-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL88-.Ltext0
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 0x4
+	.byte	0x72
+	.sleb128 240
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL89-.Ltext0
+	.uleb128 .LVL92-.Ltext0
+	.uleb128 0xb
+	.byte	0x78
+	.sleb128 0
+	.byte	0x71
+	.sleb128 0
+	.byte	0x22
+	.byte	0x94
+	.byte	0x1
+	.byte	0x8
+	.byte	0xff
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0
+.LVUS34:
+	.uleb128 .LVU296
+	.uleb128 .LVU301
+	.uleb128 .LVU305
+	.uleb128 .LVU310
+	.uleb128 .LVU314
+	.uleb128 .LVU317
+	.uleb128 .LVU317
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU338
+.LLST34:
+	.byte	0x4
+	.uleb128 .LVL76-.Ltext0
+	.uleb128 .LVL78-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL79-.Ltext0
+	.uleb128 .LVL81-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL84-.Ltext0
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 0x2
+	.byte	0x33
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL87-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS35:
+	.uleb128 .LVU288
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU338
+.LLST35:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x80
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL94-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS36:
+	.uleb128 .LVU289
+	.uleb128 .LVU320
+	.uleb128 .LVU320
+	.uleb128 .LVU329
+.LLST36:
+	.byte	0x4
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0xbf
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL90-.Ltext0
+	.uleb128 .LVL91-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS37:
+	.uleb128 .LVU279
+	.uleb128 .LVU285
+.LLST37:
+	.byte	0x4
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 .LVL75-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS39:
+	.uleb128 .LVU237
+	.uleb128 .LVU279
+.LLST39:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS40:
+	.uleb128 .LVU237
+	.uleb128 .LVU279
+.LLST40:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS41:
+	.uleb128 .LVU239
+	.uleb128 .LVU241
+	.uleb128 .LVU241
+	.uleb128 .LVU279
+.LLST41:
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 0x2
+	.byte	0x30
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL63-.Ltext0
+	.uleb128 .LVL72-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0
+.LVUS43:
+	.uleb128 .LVU252
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST43:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x8
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0
+.LVUS44:
+	.uleb128 .LVU256
+	.uleb128 .LVU269
+	.uleb128 .LVU269
+	.uleb128 .LVU274
+	.uleb128 .LVU274
+	.uleb128 .LVU275
+.LLST44:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0x4
+	.uleb128 .LVL67-.Ltext0
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 0x5
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x4
+	.uleb128 .LVL69-.Ltext0
+	.uleb128 .LVL70-.Ltext0
+	.uleb128 0x7
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x40
+	.byte	0x1c
+	.byte	0
+.LVUS46:
+	.uleb128 .LVU258
+	.uleb128 .LVU260
+.LLST46:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS47:
+	.uleb128 .LVU253
+	.uleb128 .LVU256
+.LLST47:
+	.byte	0x4
+	.uleb128 .LVL65-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x6
+	.byte	0x72
+	.sleb128 0
+	.byte	0x70
+	.sleb128 0
+	.byte	0x22
+	.byte	0x9f
+	.byte	0
+.LVUS49:
+	.uleb128 .LVU262
+	.uleb128 .LVU264
+.LLST49:
+	.byte	0x4
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 .LVL66-.Ltext0
+	.uleb128 0x1
+	.byte	0x61
+	.byte	0
+.LVUS3:
+	.uleb128 0
+	.uleb128 .LVU25
+	.uleb128 .LVU25
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU31
+	.uleb128 .LVU31
+	.uleb128 .LVU36
+	.uleb128 .LVU36
+	.uleb128 .LVU115
+	.uleb128 .LVU115
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 .LVU127
+	.uleb128 .LVU127
+	.uleb128 .LVU129
+	.uleb128 .LVU129
+	.uleb128 .LVU151
+	.uleb128 .LVU151
+	.uleb128 .LVU159
+	.uleb128 .LVU159
+	.uleb128 .LVU181
+	.uleb128 .LVU181
+	.uleb128 .LVU197
+	.uleb128 .LVU197
+	.uleb128 .LVU209
+	.uleb128 .LVU209
+	.uleb128 0
+.LLST3:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL7-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL9-.Ltext0
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL12-.Ltext0
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL26-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL31-.Ltext0
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL33-.Ltext0
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL40-.Ltext0
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL47-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL54-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS4:
+	.uleb128 0
+	.uleb128 .LVU24
+	.uleb128 .LVU24
+	.uleb128 .LVU26
+	.uleb128 .LVU26
+	.uleb128 .LVU32
+	.uleb128 .LVU32
+	.uleb128 .LVU33
+	.uleb128 .LVU33
+	.uleb128 .LVU116
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU117
+	.uleb128 0
+.LLST4:
+	.byte	0x4
+	.uleb128 .LVL5-.Ltext0
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL6-.Ltext0
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL8-.Ltext0
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL10-.Ltext0
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL11-1-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0x4
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LFE546-.Ltext0
+	.uleb128 0x1
+	.byte	0x5b
+	.byte	0
+.LVUS5:
+	.uleb128 .LVU81
+	.uleb128 .LVU82
+	.uleb128 .LVU97
+	.uleb128 .LVU98
+	.uleb128 .LVU108
+	.uleb128 .LVU112
+	.uleb128 .LVU112
+	.uleb128 .LVU116
+	.uleb128 .LVU117
+	.uleb128 .LVU124
+	.uleb128 .LVU124
+	.uleb128 .LVU142
+	.uleb128 .LVU144
+	.uleb128 .LVU148
+	.uleb128 .LVU148
+	.uleb128 .LVU150
+	.uleb128 .LVU159
+	.uleb128 .LVU176
+	.uleb128 .LVU179
+	.uleb128 .LVU183
+	.uleb128 .LVU183
+	.uleb128 .LVU194
+.LLST5:
+	.byte	0x4
+	.uleb128 .LVL20-.Ltext0
+	.uleb128 .LVL21-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL22-.Ltext0
+	.uleb128 .LVL23-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL24-.Ltext0
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL25-.Ltext0
+	.uleb128 .LVL27-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 .LVL36-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL37-.Ltext0
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL38-.Ltext0
+	.uleb128 .LVL39-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0x4
+	.uleb128 .LVL41-.Ltext0
+	.uleb128 .LVL45-.Ltext0
+	.uleb128 0x1
+	.byte	0x53
+	.byte	0x4
+	.uleb128 .LVL46-.Ltext0
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL48-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x58
+	.byte	0
+.LVUS16:
+	.uleb128 .LVU137
+	.uleb128 .LVU139
+.LLST16:
+	.byte	0x4
+	.uleb128 .LVL34-.Ltext0
+	.uleb128 .LVL35-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0
+.LVUS17:
+	.uleb128 .LVU170
+	.uleb128 .LVU172
+.LLST17:
+	.byte	0x4
+	.uleb128 .LVL43-.Ltext0
+	.uleb128 .LVL44-.Ltext0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -24
+	.byte	0x9f
+	.byte	0
+.LVUS6:
+	.uleb128 .LVU40
+	.uleb128 .LVU46
+.LLST6:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS7:
+	.uleb128 .LVU40
+	.uleb128 .LVU46
+.LLST7:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS8:
+	.uleb128 .LVU42
+	.uleb128 .LVU43
+	.uleb128 .LVU43
+	.uleb128 .LVU45
+	.uleb128 .LVU45
+	.uleb128 .LVU46
+.LLST8:
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL13-.Ltext0
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL14-.Ltext0
+	.uleb128 .LVL15-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS10:
+	.uleb128 .LVU50
+	.uleb128 .LVU58
+.LLST10:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS11:
+	.uleb128 .LVU50
+	.uleb128 .LVU58
+.LLST11:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS12:
+	.uleb128 .LVU52
+	.uleb128 .LVU53
+	.uleb128 .LVU53
+	.uleb128 .LVU55
+	.uleb128 .LVU55
+	.uleb128 .LVU58
+.LLST12:
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL16-.Ltext0
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL17-.Ltext0
+	.uleb128 .LVL18-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS13:
+	.uleb128 .LVU118
+	.uleb128 .LVU124
+.LLST13:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x2
+	.byte	0x32
+	.byte	0x9f
+	.byte	0
+.LVUS14:
+	.uleb128 .LVU118
+	.uleb128 .LVU124
+.LLST14:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS15:
+	.uleb128 .LVU120
+	.uleb128 .LVU121
+	.uleb128 .LVU121
+	.uleb128 .LVU123
+	.uleb128 .LVU123
+	.uleb128 .LVU124
+.LLST15:
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL28-.Ltext0
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 2
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL29-.Ltext0
+	.uleb128 .LVL30-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS18:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST18:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x2
+	.byte	0x34
+	.byte	0x9f
+	.byte	0
+.LVUS19:
+	.uleb128 .LVU189
+	.uleb128 .LVU194
+.LLST19:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x1
+	.byte	0x5a
+	.byte	0
+.LVUS20:
+	.uleb128 .LVU191
+	.uleb128 .LVU192
+	.uleb128 .LVU192
+	.uleb128 .LVU194
+.LLST20:
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL49-.Ltext0
+	.uleb128 .LVL50-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 4
+	.byte	0x9f
+	.byte	0
+.LVUS22:
+	.uleb128 .LVU198
+	.uleb128 .LVU206
+.LLST22:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x2
+	.byte	0x31
+	.byte	0x9f
+	.byte	0
+.LVUS23:
+	.uleb128 .LVU198
+	.uleb128 .LVU206
+.LLST23:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0
+.LVUS24:
+	.uleb128 .LVU200
+	.uleb128 .LVU201
+	.uleb128 .LVU201
+	.uleb128 .LVU203
+	.uleb128 .LVU203
+	.uleb128 .LVU206
+.LLST24:
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0x4
+	.uleb128 .LVL51-.Ltext0
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 0x3
+	.byte	0x79
+	.sleb128 1
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL52-.Ltext0
+	.uleb128 .LVL53-.Ltext0
+	.uleb128 0x1
+	.byte	0x59
+	.byte	0
+.LVUS0:
+	.uleb128 0
+	.uleb128 .LVU11
+	.uleb128 .LVU11
+	.uleb128 .LVU12
+	.uleb128 .LVU12
+	.uleb128 .LVU14
+	.uleb128 .LVU14
+	.uleb128 0
+.LLST0:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL2-.Ltext0
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL3-.Ltext0
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x4
+	.uleb128 .LVL4-.Ltext0
+	.uleb128 .LFE543-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x51
+	.byte	0x9f
+	.byte	0
+.LVUS1:
+	.uleb128 0
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST1:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE543-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0x9f
+	.byte	0
+.LVUS2:
+	.uleb128 .LVU2
+	.uleb128 .LVU5
+	.uleb128 .LVU5
+	.uleb128 0
+.LLST2:
+	.byte	0x4
+	.uleb128 .LVL0-.Ltext0
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 0x2
+	.byte	0x74
+	.sleb128 8
+	.byte	0x4
+	.uleb128 .LVL1-.Ltext0
+	.uleb128 .LFE543-.Ltext0
+	.uleb128 0x1
+	.byte	0x52
+	.byte	0
+.LVUS113:
+	.uleb128 0
+	.uleb128 .LVU642
+	.uleb128 .LVU642
+	.uleb128 .LVU643
+	.uleb128 .LVU643
+	.uleb128 0
+.LLST113:
+	.byte	0x4
+	.uleb128 .LVL171-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 .LFE541-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS115:
+	.uleb128 .LVU639
+	.uleb128 .LVU642
+	.uleb128 .LVU642
+	.uleb128 .LVU643
+.LLST115:
+	.byte	0x4
+	.uleb128 .LVL172-.Ltext0
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL173-.Ltext0
+	.uleb128 .LVL174-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS116:
+	.uleb128 0
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU654
+	.uleb128 .LVU654
+	.uleb128 0
+.LLST116:
+	.byte	0x4
+	.uleb128 .LVL175-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 .LFE542-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS118:
+	.uleb128 .LVU650
+	.uleb128 .LVU653
+	.uleb128 .LVU653
+	.uleb128 .LVU654
+.LLST118:
+	.byte	0x4
+	.uleb128 .LVL176-.Ltext0
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL177-.Ltext0
+	.uleb128 .LVL178-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS119:
+	.uleb128 0
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST119:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS120:
+	.uleb128 0
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 .LVU667
+	.uleb128 .LVU667
+	.uleb128 .LVU678
+	.uleb128 .LVU678
+	.uleb128 .LVU681
+	.uleb128 .LVU681
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU684
+	.uleb128 .LVU684
+	.uleb128 0
+.LLST120:
+	.byte	0x4
+	.uleb128 .LVL179-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL185-.Ltext0
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL186-.Ltext0
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 0x1
+	.byte	0x50
+	.byte	0x4
+	.uleb128 .LVL188-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS121:
+	.uleb128 .LVU676
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 .LVU683
+	.uleb128 0
+.LLST121:
+	.byte	0x4
+	.uleb128 .LVL184-.Ltext0
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL187-1-.Ltext0
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0x4
+	.uleb128 .LVL187-.Ltext0
+	.uleb128 .LFE559-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0
+.LVUS123:
+	.uleb128 .LVU662
+	.uleb128 .LVU666
+	.uleb128 .LVU666
+	.uleb128 .LVU667
+.LLST123:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL182-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS124:
+	.uleb128 .LVU662
+	.uleb128 .LVU665
+	.uleb128 .LVU665
+	.uleb128 .LVU667
+.LLST124:
+	.byte	0x4
+	.uleb128 .LVL180-.Ltext0
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL181-.Ltext0
+	.uleb128 .LVL183-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.LVUS155:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 0
+.LLST155:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x4
+	.uleb128 .LVL245-1-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x55
+	.byte	0x9f
+	.byte	0
+.LVUS156:
+	.uleb128 0
+	.uleb128 .LVU899
+	.uleb128 .LVU899
+	.uleb128 0
+.LLST156:
+	.byte	0x4
+	.uleb128 .LVL244-.Ltext0
+	.uleb128 .LVL245-1-.Ltext0
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x4
+	.uleb128 .LVL245-1-.Ltext0
+	.uleb128 .LFE555-.Ltext0
+	.uleb128 0x4
+	.byte	0xa3
+	.uleb128 0x1
+	.byte	0x54
+	.byte	0x9f
+	.byte	0
+.Ldebug_loc3:
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL9:
+	.byte	0x4
+	.uleb128 .LBB110-.Ltext0
+	.uleb128 .LBE110-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL21:
+	.byte	0x4
+	.uleb128 .LBB122-.Ltext0
+	.uleb128 .LBE122-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB125-.Ltext0
+	.uleb128 .LBE125-.Ltext0
+	.byte	0
+.LLRL38:
+	.byte	0x4
+	.uleb128 .LBB141-.Ltext0
+	.uleb128 .LBE141-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB162-.Ltext0
+	.uleb128 .LBE162-.Ltext0
+	.byte	0
+.LLRL42:
+	.byte	0x4
+	.uleb128 .LBB143-.Ltext0
+	.uleb128 .LBE143-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB160-.Ltext0
+	.uleb128 .LBE160-.Ltext0
+	.byte	0
+.LLRL45:
+	.byte	0x4
+	.uleb128 .LBB144-.Ltext0
+	.uleb128 .LBE144-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB150-.Ltext0
+	.uleb128 .LBE150-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB157-.Ltext0
+	.uleb128 .LBE157-.Ltext0
+	.byte	0
+.LLRL48:
+	.byte	0x4
+	.uleb128 .LBB151-.Ltext0
+	.uleb128 .LBE151-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB158-.Ltext0
+	.uleb128 .LBE158-.Ltext0
+	.byte	0
+.LLRL50:
+	.byte	0x4
+	.uleb128 .LBB154-.Ltext0
+	.uleb128 .LBE154-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB159-.Ltext0
+	.uleb128 .LBE159-.Ltext0
+	.byte	0
+.LLRL64:
+	.byte	0x4
+	.uleb128 .LBB216-.Ltext0
+	.uleb128 .LBE216-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB217-.Ltext0
+	.uleb128 .LBE217-.Ltext0
+	.byte	0
+.LLRL67:
+	.byte	0x4
+	.uleb128 .LBB219-.Ltext0
+	.uleb128 .LBE219-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB248-.Ltext0
+	.uleb128 .LBE248-.Ltext0
+	.byte	0
+.LLRL69:
+	.byte	0x4
+	.uleb128 .LBB220-.Ltext0
+	.uleb128 .LBE220-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB247-.Ltext0
+	.uleb128 .LBE247-.Ltext0
+	.byte	0
+.LLRL70:
+	.byte	0x4
+	.uleb128 .LBB221-.Ltext0
+	.uleb128 .LBE221-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB225-.Ltext0
+	.uleb128 .LBE225-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB229-.Ltext0
+	.uleb128 .LBE229-.Ltext0
+	.byte	0
+.LLRL72:
+	.byte	0x4
+	.uleb128 .LBB226-.Ltext0
+	.uleb128 .LBE226-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB237-.Ltext0
+	.uleb128 .LBE237-.Ltext0
+	.byte	0
+.LLRL73:
+	.byte	0x4
+	.uleb128 .LBB230-.Ltext0
+	.uleb128 .LBE230-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB236-.Ltext0
+	.uleb128 .LBE236-.Ltext0
+	.byte	0
+.LLRL75:
+	.byte	0x4
+	.uleb128 .LBB233-.Ltext0
+	.uleb128 .LBE233-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB238-.Ltext0
+	.uleb128 .LBE238-.Ltext0
+	.byte	0
+.LLRL77:
+	.byte	0x4
+	.uleb128 .LBB239-.Ltext0
+	.uleb128 .LBE239-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB245-.Ltext0
+	.uleb128 .LBE245-.Ltext0
+	.byte	0
+.LLRL79:
+	.byte	0x4
+	.uleb128 .LBB242-.Ltext0
+	.uleb128 .LBE242-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB246-.Ltext0
+	.uleb128 .LBE246-.Ltext0
+	.byte	0
+.LLRL81:
+	.byte	0x4
+	.uleb128 .LBB249-.Ltext0
+	.uleb128 .LBE249-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB257-.Ltext0
+	.uleb128 .LBE257-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB259-.Ltext0
+	.uleb128 .LBE259-.Ltext0
+	.byte	0
+.LLRL85:
+	.byte	0x4
+	.uleb128 .LBB253-.Ltext0
+	.uleb128 .LBE253-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB258-.Ltext0
+	.uleb128 .LBE258-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB260-.Ltext0
+	.uleb128 .LBE260-.Ltext0
+	.byte	0
+.LLRL90:
+	.byte	0x4
+	.uleb128 .LBB263-.Ltext0
+	.uleb128 .LBE263-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB269-.Ltext0
+	.uleb128 .LBE269-.Ltext0
+	.byte	0
+.LLRL92:
+	.byte	0x4
+	.uleb128 .LBB266-.Ltext0
+	.uleb128 .LBE266-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB270-.Ltext0
+	.uleb128 .LBE270-.Ltext0
+	.byte	0
+.LLRL96:
+	.byte	0x4
+	.uleb128 .LBB272-.Ltext0
+	.uleb128 .LBE272-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB275-.Ltext0
+	.uleb128 .LBE275-.Ltext0
+	.byte	0
+.LLRL99:
+	.byte	0x4
+	.uleb128 .LBB278-.Ltext0
+	.uleb128 .LBE278-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB291-.Ltext0
+	.uleb128 .LBE291-.Ltext0
+	.byte	0
+.LLRL101:
+	.byte	0x4
+	.uleb128 .LBB281-.Ltext0
+	.uleb128 .LBE281-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB300-.Ltext0
+	.uleb128 .LBE300-.Ltext0
+	.byte	0
+.LLRL102:
+	.byte	0x4
+	.uleb128 .LBB284-.Ltext0
+	.uleb128 .LBE284-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB301-.Ltext0
+	.uleb128 .LBE301-.Ltext0
+	.byte	0
+.LLRL103:
+	.byte	0x4
+	.uleb128 .LBB287-.Ltext0
+	.uleb128 .LBE287-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB298-.Ltext0
+	.uleb128 .LBE298-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB302-.Ltext0
+	.uleb128 .LBE302-.Ltext0
+	.byte	0
+.LLRL104:
+	.byte	0x4
+	.uleb128 .LBB292-.Ltext0
+	.uleb128 .LBE292-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB299-.Ltext0
+	.uleb128 .LBE299-.Ltext0
+	.byte	0
+.LLRL106:
+	.byte	0x4
+	.uleb128 .LBB295-.Ltext0
+	.uleb128 .LBE295-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB305-.Ltext0
+	.uleb128 .LBE305-.Ltext0
+	.byte	0
+.LLRL109:
+	.byte	0x4
+	.uleb128 .LBB308-.Ltext0
+	.uleb128 .LBE308-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB311-.Ltext0
+	.uleb128 .LBE311-.Ltext0
+	.byte	0
+.LLRL114:
+	.byte	0x4
+	.uleb128 .LBB314-.Ltext0
+	.uleb128 .LBE314-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB317-.Ltext0
+	.uleb128 .LBE317-.Ltext0
+	.byte	0
+.LLRL117:
+	.byte	0x4
+	.uleb128 .LBB320-.Ltext0
+	.uleb128 .LBE320-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB323-.Ltext0
+	.uleb128 .LBE323-.Ltext0
+	.byte	0
+.LLRL122:
+	.byte	0x4
+	.uleb128 .LBB327-.Ltext0
+	.uleb128 .LBE327-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB330-.Ltext0
+	.uleb128 .LBE330-.Ltext0
+	.byte	0
+.LLRL129:
+	.byte	0x4
+	.uleb128 .LBB331-.Ltext0
+	.uleb128 .LBE331-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB336-.Ltext0
+	.uleb128 .LBE336-.Ltext0
+	.byte	0
+.LLRL135:
+	.byte	0x4
+	.uleb128 .LBB340-.Ltext0
+	.uleb128 .LBE340-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB344-.Ltext0
+	.uleb128 .LBE344-.Ltext0
+	.byte	0
+.LLRL139:
+	.byte	0x4
+	.uleb128 .LBB345-.Ltext0
+	.uleb128 .LBE345-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB350-.Ltext0
+	.uleb128 .LBE350-.Ltext0
+	.byte	0
+.LLRL146:
+	.byte	0x4
+	.uleb128 .LBB354-.Ltext0
+	.uleb128 .LBE354-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB358-.Ltext0
+	.uleb128 .LBE358-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_macro,"",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF444
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF499
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF572
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF614
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x4
+	.file 25 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF624
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF625
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF626
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF633
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF499
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF693
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF694
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF695
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF755
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 31 "./include/va_print/utf16.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF758
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 32 "./include/va_print/utf32.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF761
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./include/va_print/char_utf8.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF781
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF782
+	.file 34 "./include/va_print/char_utf16.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF783
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF784
+	.file 35 "./include/va_print/char_utf32.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF785
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF881
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/xmmintrin.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF882
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mmintrin.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF883
+	.byte	0x4
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/mm_malloc.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF884
+	.file 39 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF443
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF886
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF922
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF572
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF964
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF965
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF966
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF967
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF612
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF968
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF969
+	.file 50 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF970
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF987
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1000
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1005
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1008
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1026
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1027
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1028
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1040
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1047
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x4
+	.file 67 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1052
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x524
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1077
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1078
+	.byte	0x4
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF385
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.39.3e0425629195acf083c9561151306b4d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF441
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF443
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.19.94fa84bfdc4fa1f32c117154c6101507,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF495
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF498
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.features.h.395.96ec08e97b0d70ff094b9574a8620dfe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF509
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF510
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF569
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF571
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF589
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF597
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF613
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF440
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF612
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.assert.h.34.5c7a904026bfb22c2884c9ab35150e04,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF623
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF631
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.uchar.h.24.85bd62af3b80c3717f6763c48c24a571,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF612
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF648
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF690
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF692
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.base.h.26.4680fed823837225645ef8d84fe21a15,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF754
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.22.3240ee22d96dbd4f2295308d8c8a8fa1,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF757
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.34.95f9234905b2231100b1f91679ce8495,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF760
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.core.h.46.28443812148d376bf25f1161f98e0696,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF780
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.char.h.34.e464ebba96a45be0746f2e47582a65f7,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF805
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.impl.h.13.ba8b097355bd637e9189dfa7d96daa61,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF880
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF611
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF613
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF895
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF907
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF914
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF921
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF943
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF949
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF963
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF976
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF978
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF982
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF986
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF999
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1004
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1007
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1010
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1021
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1025
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1039
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1043
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1046
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF612
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1051
+	.byte	0
+	.section	.debug_macro,"G",@progbits,wm4.xmmintrin.h.78.59bb12a08107158c4936dd3dc3443849,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x516
+	.long	.LASF1076
+	.byte	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF828:
+	.string	"VA_OPT_LAST 0x0040"
+.LASF497:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF257:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF321:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF917:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF59:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF114:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1089:
+	.string	"size_t"
+.LASF816:
+	.string	"VA_BGET(X,W) (((X) >> VA_SHIFT(W)) & VA_MASK(W))"
+.LASF68:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF930:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF251:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1059:
+	.string	"_MM_EXCEPT_UNDERFLOW 0x0010"
+.LASF1069:
+	.string	"_MM_ROUND_NEAREST 0x0000"
+.LASF991:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF937:
+	.string	"__f64(x) x ##f64"
+.LASF340:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF843:
+	.string	"VA_MODE_X7 7"
+.LASF320:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF774:
+	.string	"va_xformat1(s,a) va_xprintf_gen(va_xprintf_, s, a)"
+.LASF25:
+	.string	"__LP64__ 1"
+.LASF949:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1074:
+	.string	"_MM_FLUSH_ZERO_ON 0x8000"
+.LASF460:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF244:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF559:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF994:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF749:
+	.string	"VA_E_DECODE 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF864:
+	.string	"VA_OPT_RESET_ARG (VA_MASH(VA_OPT_ERR) | VA_OPT_LAST | VA_OPT_INIT | VA_OPT_SIM)"
+.LASF573:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF965:
+	.string	"__clockid_t_defined 1"
+.LASF465:
+	.string	"__USE_ATFILE"
+.LASF534:
+	.string	"__flexarr []"
+.LASF195:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF681:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF818:
+	.string	"VA_BSET(X,W,V) __extension__({ __typeof__(X) *_xp = &(X); *_xp = VA_BPUT(*_xp,W,V); })"
+.LASF758:
+	.string	"VA_PRINT_UTF16_H_ "
+.LASF776:
+	.string	"va_xinit0(z,x,g) (va_format_plain(x) ? va_xprintf_init_last_plain((va_stream_t*)(1?(z):((void*)0)), x, g) : va_xprintf_init_last((va_stream_t*)(1?(z):((void*)0)), x, g))"
+.LASF375:
+	.string	"__unix 1"
+.LASF505:
+	.string	"__GNU_LIBRARY__"
+.LASF145:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF178:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1003:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF862:
+	.string	"VA_OPT_EMORE (30, 3U)"
+.LASF747:
+	.string	"VA_E_OK 0"
+.LASF305:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF104:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF782:
+	.string	"va_char_p_encode utf8"
+.LASF833:
+	.string	"VA_SIGN_PLUS 2"
+.LASF38:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF311:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF226:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1135:
+	.string	"va_quotation_table_t"
+.LASF169:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF53:
+	.string	"__INT8_TYPE__ signed char"
+.LASF777:
+	.string	"va_xinit1(z,x,g) va_xprintf_init((va_stream_t*)(1?(z):((void*)0)), x, g)"
+.LASF1164:
+	.string	"va_xprintf_last_char_const_pp_utf8"
+.LASF228:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF742:
+	.string	"VA_U_SURR_MAX 0xdfff"
+.LASF440:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF889:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF44:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1163:
+	.string	"val2_"
+.LASF129:
+	.string	"__UINT8_C(c) c"
+.LASF1060:
+	.string	"_MM_EXCEPT_INEXACT 0x0020"
+.LASF54:
+	.string	"__INT16_TYPE__ short int"
+.LASF374:
+	.string	"linux 1"
+.LASF629:
+	.string	"true 1"
+.LASF371:
+	.string	"__gnu_linux__ 1"
+.LASF757:
+	.string	"va_char_p_decode utf8"
+.LASF730:
+	.string	"VA_U_ECONT 0x80000000"
+.LASF1097:
+	.string	"take"
+.LASF1203:
+	.string	"iter_nth"
+.LASF898:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF548:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF668:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF708:
+	.string	"VA_EXP3(...) VA_EXP2(VA_EXP2(VA_EXP2(VA_EXP2(__VA_ARGS__))))"
+.LASF1013:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF693:
+	.string	"__STD_TYPE"
+.LASF619:
+	.string	"_ASSERT_H_DECLS "
+.LASF1001:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF352:
+	.string	"__x86_64 1"
+.LASF1006:
+	.string	"____sigset_t_defined "
+.LASF521:
+	.string	"__P(args) args"
+.LASF840:
+	.string	"VA_MODE_TYPE 4"
+.LASF773:
+	.string	"va_xformat0(s,a) va_xprintf_gen(va_xprintf_last_, s, a)"
+.LASF1034:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF401:
+	.string	"__SIZE_T__ "
+.LASF231:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF737:
+	.string	"VA_U_REPLACEMENT 0xfffd"
+.LASF1158:
+	.string	"va_span_p_take_utf8"
+.LASF227:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF877:
+	.string	"VA_QCLASS_QUOTE 1"
+.LASF111:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF661:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF745:
+	.string	"VA_U_EOT -1U"
+.LASF165:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF799:
+	.string	"va_zprintf(...) va_gzprintf(char, __VA_ARGS__)"
+.LASF813:
+	.string	"VA_MASH2(S,M) ((M) << (S))"
+.LASF436:
+	.string	"__need_wchar_t"
+.LASF224:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF189:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1131:
+	.string	"va_char_p_read_vtab_utf8"
+.LASF879:
+	.string	"VA_QCLASS_ESC(N) (3 + (N))"
+.LASF939:
+	.string	"__f64x(x) x ##f64x"
+.LASF1096:
+	.string	"type"
+.LASF871:
+	.string	"VA_DELIM(prefix,delimfront,delimback) (((0ULL|(prefix)) << 8) | ((0ULL|(delimfront)) << 16) | ((0ULL|(delimback)) << 32))"
+.LASF860:
+	.string	"VA_OPT_BASE (21, 0x3fU)"
+.LASF1162:
+	.string	"_Type"
+.LASF394:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF924:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1189:
+	.string	"_mm_loadu_si128"
+.LASF466:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF241:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF42:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF873:
+	.string	"VA_DELIM_PREFIX(x) ((unsigned char) ((x) >> 8))"
+.LASF143:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF645:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF269:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF825:
+	.string	"VA_OPT_MINUS 0x0008"
+.LASF509:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF781:
+	.string	"VA_PRINT_CHAR_UTF8_H_ "
+.LASF972:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF536:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF405:
+	.string	"_T_SIZE "
+.LASF176:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF37:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1120:
+	.string	"finish"
+.LASF703:
+	.string	"VA_ECHO(...) __VA_ARGS__"
+.LASF319:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF880:
+	.string	"VA_POSSIBLE_CALL(x) "
+.LASF980:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1175:
+	.string	"transcode_len"
+.LASF398:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF268:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF463:
+	.string	"__USE_FILE_OFFSET64"
+.LASF240:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF615:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1108:
+	.string	"super"
+.LASF450:
+	.string	"__USE_POSIX"
+.LASF35:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF793:
+	.string	"va_sprintf(S,...) va_snprintf(S,va_countof(S),__VA_ARGS__)"
+.LASF704:
+	.string	"VA_NOC(...) , ##__VA_ARGS__"
+.LASF307:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF625:
+	.string	"VA_PRINT_CORE_H_ "
+.LASF437:
+	.string	"NULL"
+.LASF531:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF291:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1199:
+	.string	"GNU C17 12.2.0 -mtune=generic -march=x86-64 -g3 -Os -fno-strict-aliasing -fno-delete-null-pointer-checks -fwrapv -fconserve-stack -fstack-usage -fasynchronous-unwind-tables"
+.LASF675:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF755:
+	.string	"VA_PRINT_UTF8_H_ "
+.LASF846:
+	.string	"VA_STATE_ARG 1"
+.LASF1161:
+	.string	"val_"
+.LASF592:
+	.string	"__stub_fchflags "
+.LASF716:
+	.string	"VA_OPT1(Z,N,...) VA_OPT2(__VA_ARGS__) (Z,N)"
+.LASF1177:
+	.string	"result"
+.LASF1023:
+	.string	"__blkcnt_t_defined "
+.LASF48:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1170:
+	.string	"va_char_p_transcode_utf8"
+.LASF670:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF913:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF262:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF738:
+	.string	"VA_U_BOM 0xfeff"
+.LASF197:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF474:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF423:
+	.string	"_T_WCHAR "
+.LASF144:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF459:
+	.string	"__USE_XOPEN2K8"
+.LASF283:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF558:
+	.string	"__always_inline"
+.LASF403:
+	.string	"_SYS_SIZE_T_H "
+.LASF971:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF65:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF470:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1030:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1204:
+	.string	"_mm_setzero_si128"
+.LASF356:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF507:
+	.string	"__GLIBC__ 2"
+.LASF931:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1079:
+	.string	"long int"
+.LASF985:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1005:
+	.string	"__sigset_t_defined 1"
+.LASF276:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF606:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF284:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF475:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF493:
+	.string	"__USE_XOPEN2K8 1"
+.LASF317:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF796:
+	.string	"va_unprintf(...) va_gnprintf(char16_t, __VA_ARGS__)"
+.LASF393:
+	.string	"_PTRDIFF_T_ "
+.LASF471:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF256:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF243:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF76:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1140:
+	.string	"render_flush"
+.LASF794:
+	.string	"va_gnprintf(Char,N,...) ((Char*)(va_xprintf( &VA_STREAM_CHAR_P((Char[N]){0}, N), __VA_ARGS__)->data))"
+.LASF621:
+	.string	"__ASSERT_FUNCTION __extension__ __PRETTY_FUNCTION__"
+.LASF61:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF746:
+	.string	"VA_PRINT(p_,x_) ((va_print_t){ .print= (p_), .value = (x_) })"
+.LASF41:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF330:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF690:
+	.string	"__FD_SETSIZE 1024"
+.LASF298:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF866:
+	.string	"VA_WIDTH_NONE VA_WIDTH_MASK"
+.LASF974:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1146:
+	.string	"__v2du"
+.LASF289:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF75:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1083:
+	.string	"short unsigned int"
+.LASF863:
+	.string	"VA_OPT_RESET_END (VA_MASH(VA_OPT_ERR) | VA_OPT_INIT)"
+.LASF201:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF555:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF395:
+	.string	"___int_ptrdiff_t_h "
+.LASF539:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF523:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF901:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF147:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF188:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1202:
+	.string	"error"
+.LASF1168:
+	.string	"va_xprintf_char_p_utf8"
+.LASF517:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF381:
+	.string	"__STDC_IEC_559__ 1"
+.LASF27:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF544:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF31:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF124:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF194:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF935:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF945:
+	.string	"__lldiv_t_defined 1"
+.LASF443:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF380:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1110:
+	.string	"va_stream_t"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF249:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF313:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF537:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF599:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF948:
+	.string	"EXIT_SUCCESS 0"
+.LASF160:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF246:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF504:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1040:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF163:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF514:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF803:
+	.string	"va_znprintf(...) va_gznprintf(char, __VA_ARGS__)"
+.LASF1087:
+	.string	"signed char"
+.LASF400:
+	.string	"__size_t__ "
+.LASF666:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF983:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF635:
+	.string	"__U16_TYPE unsigned short int"
+.LASF233:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF525:
+	.string	"__ptr_t void *"
+.LASF325:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF743:
+	.string	"va_countof(A) (sizeof(A)/sizeof((A)[0]))"
+.LASF1201:
+	.string	"va_put_utf8"
+.LASF171:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF650:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF572:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF98:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF130:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1174:
+	.string	"__PRETTY_FUNCTION__"
+.LASF236:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 201710L"
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF281:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF958:
+	.string	"__off_t_defined "
+.LASF1092:
+	.string	"__uint_least16_t"
+.LASF139:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF472:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF411:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF780:
+	.string	"va_stream_get_error(stream) va_stream_get_error_f(&(stream)->s)"
+.LASF414:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF481:
+	.string	"__USE_ISOC99 1"
+.LASF232:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF672:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF162:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF522:
+	.string	"__PMT(args) args"
+.LASF379:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF318:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF151:
+	.string	"__GCC_IEC_559 2"
+.LASF288:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1094:
+	.string	"char16_t"
+.LASF413:
+	.string	"__DEFINED_size_t "
+.LASF633:
+	.string	"_BITS_TYPES_H 1"
+.LASF1012:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF797:
+	.string	"va_Unprintf(...) va_gnprintf(char32_t, __VA_ARGS__)"
+.LASF772:
+	.string	"va_xformat(i,s,a) va_xformat ## i (s,a)"
+.LASF1032:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1019:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF177:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1014:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF81:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF133:
+	.string	"__UINT32_C(c) c ## U"
+.LASF959:
+	.string	"__pid_t_defined "
+.LASF367:
+	.string	"__SSE2_MATH__ 1"
+.LASF101:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF193:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF961:
+	.string	"__ssize_t_defined "
+.LASF854:
+	.string	"VA_QUOTE_Q 3"
+.LASF29:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF221:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1124:
+	.string	"_Bool"
+.LASF126:
+	.string	"__INT64_C(c) c ## L"
+.LASF566:
+	.string	"__restrict_arr __restrict"
+.LASF590:
+	.string	"__stub___compat_bdflush "
+.LASF1070:
+	.string	"_MM_ROUND_DOWN 0x2000"
+.LASF954:
+	.string	"__gid_t_defined "
+.LASF409:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1141:
+	.string	"table"
+.LASF767:
+	.string	"va_format_xcompile(alloc,X) va_format_compile_f(alloc, X, va_format_gen(X))"
+.LASF1185:
+	.string	"_mm_unpacklo_epi8"
+.LASF851:
+	.string	"VA_QUOTE_NONE 0"
+.LASF677:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF263:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF503:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF345:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1046:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF545:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF223:
+	.string	"__FLT32_DIG__ 6"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF921:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF885:
+	.string	"__need_wchar_t "
+.LASF72:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF875:
+	.string	"VA_DELIM_BACK(x) ((unsigned short) ((x) >> 32))"
+.LASF601:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1077:
+	.string	"_MM_SHUFFLE2(fp1,fp0) (((fp1) << 1) | (fp0))"
+.LASF900:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF595:
+	.string	"__stub_setlogin "
+.LASF26:
+	.string	"__SIZEOF_INT__ 4"
+.LASF612:
+	.string	"__need_size_t "
+.LASF1154:
+	.string	"__assert_fail"
+.LASF638:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF578:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF237:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1056:
+	.string	"_MM_EXCEPT_DENORM 0x0002"
+.LASF563:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF483:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1200:
+	.string	"__m128i_u"
+.LASF1090:
+	.string	"__uint16_t"
+.LASF1159:
+	.string	"iter_super"
+.LASF457:
+	.string	"__USE_XOPEN2K"
+.LASF1008:
+	.string	"__timeval_defined 1"
+.LASF692:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF805:
+	.string	"va_Uznprintf(...) va_gznprintf(char32_t, __VA_ARGS__)"
+.LASF458:
+	.string	"__USE_XOPEN2KXSI"
+.LASF112:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF167:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF384:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1082:
+	.string	"long double"
+.LASF1176:
+	.string	"ascii_run"
+.LASF561:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF596:
+	.string	"__stub_sigreturn "
+.LASF821:
+	.string	"VA_MCLR(X,MASK) VA_MSET_IF(X,MASK,0)"
+.LASF185:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF211:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF490:
+	.string	"__USE_POSIX199309 1"
+.LASF369:
+	.string	"__SEG_FS 1"
+.LASF792:
+	.string	"va_snprintf(S,N,...) VA_BLOCK_EXPR((__typeof__(*(S))*)(va_xprintf( &VA_STREAM_CHAR_P(S,N), __VA_ARGS__)->data))"
+.LASF804:
+	.string	"va_uznprintf(...) va_gznprintf(char16_t, __VA_ARGS__)"
+.LASF79:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF119:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF258:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1075:
+	.string	"_MM_FLUSH_ZERO_OFF 0x0000"
+.LASF1062:
+	.string	"_MM_MASK_INVALID 0x0080"
+.LASF815:
+	.string	"VA_MASH(W) (VA_MASH1(W))"
+.LASF1183:
+	.string	"_mm_or_si128"
+.LASF452:
+	.string	"__USE_POSIX199309"
+.LASF926:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF385:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF787:
+	.string	"va_char_p_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_vtab_,va_char32_p_encode))"
+.LASF335:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF941:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF940:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF734:
+	.string	"VA_U_ENC_UTF32 0x03000000"
+.LASF1198:
+	.string	"va_u_valid"
+.LASF906:
+	.string	"__W_CONTINUED 0xffff"
+.LASF952:
+	.string	"__ino_t_defined "
+.LASF1064:
+	.string	"_MM_MASK_DIV_ZERO 0x0200"
+.LASF508:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF212:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF456:
+	.string	"__USE_UNIX98"
+.LASF69:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF473:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF696:
+	.string	"VA_CONCAT(A,B) VA_CONCAT1(A,B)"
+.LASF1015:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF618:
+	.string	"__ASSERT_VOID_CAST (void)"
+.LASF691:
+	.string	"_BITS_TIME64_H 1"
+.LASF654:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF127:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1053:
+	.string	"_MM_SHUFFLE(fp3,fp2,fp1,fp0) (((fp3) << 6) | ((fp2) << 4) | ((fp1) << 2) | (fp0))"
+.LASF639:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1197:
+	.string	"va_stream_set_error"
+.LASF339:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF684:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF720:
+	.string	"VA_REC1B(F,A,X,...) VA_RECA(F,F VA_NIX (VA_OPT(0,1,__VA_ARGS__),A,X),__VA_ARGS__)"
+.LASF378:
+	.string	"__ELF__ 1"
+.LASF1009:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF565:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF719:
+	.string	"VA_REC0B(F,A,...) A"
+.LASF102:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF912:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1035:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF203:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF530:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF306:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF686:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF676:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF964:
+	.string	"__clock_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF817:
+	.string	"VA_BPUT(X,W,V) ((((X) | VA_MASH(W)) ^ VA_MASH(W)) | ((V) << VA_SHIFT(W)))"
+.LASF845:
+	.string	"VA_STATE_INIT 0"
+.LASF712:
+	.string	"VA_SUBVA_H(Z,N) Z"
+.LASF857:
+	.string	"VA_QUOTE_qq 6"
+.LASF628:
+	.string	"bool _Bool"
+.LASF1121:
+	.string	"refill"
+.LASF99:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF106:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF128:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF426:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1136:
+	.string	"delim"
+.LASF826:
+	.string	"VA_OPT_EQUAL 0x0010"
+.LASF721:
+	.string	"VA_REC0() VA_REC0B"
+.LASF765:
+	.ascii	"va_xprintf_gen(fun,s,x) _Generic(x, char const *:VA_CONCAT(f"
+	.ascii	"un ##char_p_,va_char_p_decode), char *:VA_CONCAT(fun ##char_"
+	.ascii	"p_,va_char_p_decode), char const **:VA_CONCAT(fun ##char_con"
+	.ascii	"st_pp_,va_char_p_decode), char **:VA_CONCAT(fun ##char_pp_,v"
+	.ascii	"a_char_p_decode), char16_t const *:VA_CONCAT(fun ##char16_p_"
+	.ascii	",va_char16_p_decode), char16_t *:VA_CONCAT(fun ##char16_p_,v"
+	.ascii	"a_char16_p_decode), char16_t const **:VA_CONCAT(fun ##char16"
+	.ascii	"_const_pp_,va_char16_p_decode), char16_t **:VA_CONCAT(fun ##"
+	.ascii	"char16_pp_,va_char16_p_decode), char32_t const *:VA_CONCAT(f"
+	.ascii	"un ##char32_p_,va_char32_p_decode), char32_t *:VA_CONCAT(fun"
+	.ascii	" ##char32_p_,va_char32_p_decode), char32_t const **:VA_CONCA"
+	.ascii	"T(fun ##char32_const_pp_,va_char32_p_decode), char32_t **:VA"
+	.ascii	"_CONCAT(fun ##char32_pp_,va_char32_p_decode), va_span_t cons"
+	.ascii	"t *:VA_CONCAT(fun ##span_p_,va_char_p_decode), va_span_t *:V"
+	.ascii	"A_CONCAT(fun ##span_p_,va_char_p_decode), va_span16_t const "
+	.ascii	"*:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span16_t"
+	.ascii	" *:VA_CONCAT(fun ##span16_p_,va_char16_p_decode), va_span32_"
+	.ascii	"t const *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), va_"
+	.ascii	"span32_t *:VA_CONCAT(fun ##span32_p_,va_char32_p_decode), bo"
+	.ascii	"ol:fun ##bool, unsigned char:fun ##uchar, unsigned short:fun"
+	.ascii	" ##ushort, unsigned int:fun ##uint, unsigned long:fun ##ulon"
+	.ascii	"g, unsig"
+	.string	"ned long long:fun ##ull, char:fun ##char, signed char:fun ##schar, short:fun ##short, int:fun ##sint, long:fun ##slong, long long:fun ##sll, va_print_t *:fun ##custom, va_read_iter_t *:fun ##iter_chunk, va_error_t *:fun ##error_t_p, default:fun ##ptr)(s,x)"
+.LASF299:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1167:
+	.string	"va_xprintf_char_const_pp_utf8"
+.LASF180:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF602:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF543:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1045:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF695:
+	.string	"____mbstate_t_defined 1"
+.LASF914:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF121:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1117:
+	.string	"va_quotations_t"
+.LASF155:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF823:
+	.string	"VA_OPT_UPPER 0x0002"
+.LASF665:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF992:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF315:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF603:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF438:
+	.string	"NULL ((void *)0)"
+.LASF764:
+	.string	"VA_SIGIL '~'"
+.LASF553:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF439:
+	.string	"__need_NULL"
+.LASF1112:
+	.string	"va_stream"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1196:
+	.string	"iter_advance"
+.LASF491:
+	.string	"__USE_POSIX199506 1"
+.LASF43:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF881:
+	.string	"_EMMINTRIN_H_INCLUDED "
+.LASF64:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1066:
+	.string	"_MM_MASK_UNDERFLOW 0x0800"
+.LASF494:
+	.string	"_ATFILE_SOURCE"
+.LASF644:
+	.string	"__SLONG32_TYPE int"
+.LASF990:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF116:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF316:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF929:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF444:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF715:
+	.string	"VA_OPT2(...) VA_OPT3(VA_SUB ## __VA_ARGS__)"
+.LASF822:
+	.string	"VA_OPT_VAR 0x0001"
+.LASF956:
+	.string	"__nlink_t_defined "
+.LASF1125:
+	.string	"va_stream_vtab_t"
+.LASF498:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF897:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1011:
+	.string	"__NFDBITS"
+.LASF626:
+	.string	"VA_PRINT_BASE_H_ "
+.LASF274:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF938:
+	.string	"__f32x(x) x ##f32x"
+.LASF478:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF741:
+	.string	"VA_U_SURR_MIN 0xd800"
+.LASF788:
+	.string	"va_char_p_size_vtab_gen(x) _Generic(x, char *:&VA_CONCAT(va_char_p_size_vtab_,va_char_p_encode), char16_t *:&VA_CONCAT(va_char16_p_size_vtab_,va_char16_p_encode), char32_t *:&VA_CONCAT(va_char32_p_size_vtab_,va_char32_p_encode))"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1021:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF368:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF888:
+	.string	"WUNTRACED 2"
+.LASF383:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF108:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF667:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF344:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF751:
+	.string	"VA_E_TRUNC 4"
+.LASF1080:
+	.string	"long unsigned int"
+.LASF1033:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF516:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF152:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF750:
+	.string	"VA_E_ENCODE 3"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF58:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF484:
+	.string	"_POSIX_SOURCE"
+.LASF1091:
+	.string	"__uint32_t"
+.LASF482:
+	.string	"__USE_ISOC95 1"
+.LASF582:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF594:
+	.string	"__stub_revoke "
+.LASF304:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF404:
+	.string	"_T_SIZE_ "
+.LASF154:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1065:
+	.string	"_MM_MASK_OVERFLOW 0x0400"
+.LASF928:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF91:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1093:
+	.string	"__uint_least32_t"
+.LASF535:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF997:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1010:
+	.string	"__suseconds_t_defined "
+.LASF360:
+	.string	"__k8__ 1"
+.LASF24:
+	.string	"_LP64 1"
+.LASF137:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF297:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF814:
+	.string	"VA_MASH1(W) (VA_MASH2 W)"
+.LASF260:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1180:
+	.string	"va_char_p_set_chunk_mode"
+.LASF613:
+	.string	"__need_NULL "
+.LASF445:
+	.string	"_FEATURES_H 1"
+.LASF1095:
+	.string	"char32_t"
+.LASF161:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF222:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1115:
+	.string	"qctxt"
+.LASF149:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF515:
+	.string	"__LEAF , __leaf__"
+.LASF1029:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF701:
+	.string	"VA_NIX "
+.LASF547:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF827:
+	.string	"VA_OPT_SIM 0x0020"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF142:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF649:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1169:
+	.string	"va_len_utf8"
+.LASF282:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF996:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF21:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF22:
+	.string	"__OPTIMIZE__ 1"
+.LASF1156:
+	.string	"va_xprintf_last_span_p_utf8"
+.LASF979:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF100:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF969:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF697:
+	.string	"VA_CONCAT1(A,B) VA_CONCAT2(A,B)"
+.LASF247:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF390:
+	.string	"_T_PTRDIFF_ "
+.LASF811:
+	.string	"VA_SHIFT1(W) (VA_SHIFT2 W)"
+.LASF830:
+	.string	"VA_OPT_SIGN (8, 3U)"
+.LASF1150:
+	.string	"__m128i"
+.LASF209:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF273:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF968:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1186:
+	.string	"_mm_unpackhi_epi16"
+.LASF363:
+	.string	"__SSE__ 1"
+.LASF837:
+	.string	"VA_MODE_B32 1"
+.LASF386:
+	.string	"_STDDEF_H "
+.LASF960:
+	.string	"__id_t_defined "
+.LASF196:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1098:
+	.string	"set_chunk_mode"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF329:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF685:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF266:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF399:
+	.string	"__need_ptrdiff_t"
+.LASF1165:
+	.string	"va_xprintf_last_char_p_utf8"
+.LASF911:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1000:
+	.string	"_SYS_SELECT_H 1"
+.LASF422:
+	.string	"_T_WCHAR_ "
+.LASF122:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF575:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF451:
+	.string	"__USE_POSIX2"
+.LASF775:
+	.string	"va_xinit(i,arg) (va_xinit ## i arg)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1047:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF418:
+	.string	"__need_size_t"
+.LASF852:
+	.string	"VA_QUOTE_k 1"
+.LASF620:
+	.string	"assert(expr) ((void) sizeof ((expr) ? 1 : 0), __extension__ ({ if (expr) ; else __assert_fail (#expr, __FILE__, __LINE__, __ASSERT_FUNCTION); }))"
+.LASF870:
+	.string	"VA_PREC_MAX (VA_PREC_MASK-1)"
+.LASF407:
+	.string	"_SIZE_T_ "
+.LASF156:
+	.string	"__FLT_RADIX__ 2"
+.LASF768:
+	.string	"VA_INIT(Z,X,G) va_xprintf_init((va_stream_t*)(1?(Z):((void*)0)), X, G)"
+.LASF1081:
+	.string	"long long int"
+.LASF1051:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF752:
+	.string	"VA_E_FORMAT 5"
+.LASF714:
+	.string	"VA_OPT3(...) VA_P(__VA_ARGS__)"
+.LASF51:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF419:
+	.string	"__wchar_t__ "
+.LASF1173:
+	.string	"va_char_p_take_utf8"
+.LASF584:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF589:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1148:
+	.string	"__v8hi"
+.LASF1113:
+	.string	"width"
+.LASF95:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF791:
+	.string	"VA_STREAM_CHAR_ARR(S) VA_STREAM_CHAR_P(S,va_countof(S))"
+.LASF434:
+	.string	"__DEFINED_wchar_t "
+.LASF1118:
+	.string	"va_quotations"
+.LASF812:
+	.string	"VA_SHIFT(W) (VA_SHIFT1(W))"
+.LASF890:
+	.string	"WEXITED 4"
+.LASF1026:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF138:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1188:
+	.string	"_mm_storeu_si128"
+.LASF740:
+	.string	"VA_U_MAXMAX VA_U_DATA"
+.LASF338:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF570:
+	.string	"__attribute_copy__"
+.LASF242:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF353:
+	.string	"__x86_64__ 1"
+.LASF424:
+	.string	"__WCHAR_T "
+.LASF1145:
+	.string	"double"
+.LASF140:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF865:
+	.string	"VA_WIDTH_MASK 0x7fffffff"
+.LASF1061:
+	.string	"_MM_MASK_MASK 0x1f80"
+.LASF520:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1132:
+	.string	"va_span_p_read_vtab_utf8"
+.LASF637:
+	.string	"__U32_TYPE unsigned int"
+.LASF97:
+	.string	"__WINT_WIDTH__ 32"
+.LASF806:
+	.string	"VA_PRINT_IMPL_H_ "
+.LASF809:
+	.string	"VA_MASK(W) (VA_MASK1(W))"
+.LASF34:
+	.string	"__CHAR_BIT__ 8"
+.LASF551:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF347:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF389:
+	.string	"_PTRDIFF_T "
+.LASF569:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1119:
+	.string	"init"
+.LASF86:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF511:
+	.string	"__PMT"
+.LASF1063:
+	.string	"_MM_MASK_DENORM 0x0100"
+.LASF707:
+	.string	"VA_EXP2(...) VA_EXP1(VA_EXP1(VA_EXP1(VA_EXP1(__VA_ARGS__))))"
+.LASF351:
+	.string	"__amd64__ 1"
+.LASF995:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF55:
+	.string	"__INT32_TYPE__ int"
+.LASF920:
+	.string	"__f128(x) x ##f128"
+.LASF210:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF146:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF839:
+	.string	"VA_MODE_PTR 3"
+.LASF942:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF646:
+	.string	"__S64_TYPE long int"
+.LASF671:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1055:
+	.string	"_MM_EXCEPT_INVALID 0x0001"
+.LASF1101:
+	.string	"has_size"
+.LASF731:
+	.string	"VA_U_ENC_ERR VA_U_ENC"
+.LASF640:
+	.string	"__SQUAD_TYPE long int"
+.LASF634:
+	.string	"__S16_TYPE short int"
+.LASF39:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF123:
+	.string	"__INT32_C(c) c"
+.LASF278:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF46:
+	.string	"__WCHAR_TYPE__ int"
+.LASF984:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF78:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF468:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF586:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF713:
+	.string	"VA_SUBVA_F(Z,N) N"
+.LASF324:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF47:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1179:
+	.string	"va_span_p_set_chunk_mode"
+.LASF359:
+	.string	"__k8 1"
+.LASF581:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1052:
+	.string	"__COMPAR_FN_T "
+.LASF916:
+	.string	"__HAVE_FLOAT128 1"
+.LASF998:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF795:
+	.string	"va_nprintf(...) va_gnprintf(char, __VA_ARGS__)"
+.LASF28:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF903:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF67:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1086:
+	.string	"unsigned int"
+.LASF1048:
+	.string	"__have_pthread_attr_t 1"
+.LASF71:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1058:
+	.string	"_MM_EXCEPT_OVERFLOW 0x0008"
+.LASF771:
+	.string	"va_xprintf(Zero,X,...) ((__typeof__(Zero))(VA_REC( va_xformat, va_xinit,((Zero),X,va_format_gen(X)), __VA_ARGS__)))"
+.LASF1071:
+	.string	"_MM_ROUND_UP 0x4000"
+.LASF159:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF252:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF512:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF464:
+	.string	"__USE_MISC"
+.LASF277:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF461:
+	.string	"__USE_LARGEFILE"
+.LASF158:
+	.string	"__FLT_DIG__ 6"
+.LASF627:
+	.string	"_STDBOOL_H "
+.LASF433:
+	.string	"_WCHAR_T_DECLARED "
+.LASF382:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF492:
+	.string	"__USE_XOPEN2K 1"
+.LASF480:
+	.string	"__USE_ISOC11 1"
+.LASF770:
+	.string	"va_pprintf(P,X,...) va_iprintf(&VA_STREAM(P), X, __VA_ARGS__)"
+.LASF1109:
+	.string	"va_read_iter_end_t"
+.LASF164:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF80:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1041:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF264:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF446:
+	.string	"__USE_ISOC11"
+.LASF820:
+	.string	"VA_MSET_IF(X,MASK,COND) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; if (!(COND)) { *_xp ^= _m; } })"
+.LASF391:
+	.string	"_T_PTRDIFF "
+.LASF94:
+	.string	"__LONG_WIDTH__ 64"
+.LASF542:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF723:
+	.string	"VA_RECA(F,A,...) VA_OPT(VA_REC0,VA_REC1,__VA_ARGS__) VA_PAR (F,A,__VA_ARGS__)"
+.LASF259:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF208:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF271:
+	.string	"__FLT32X_DIG__ 15"
+.LASF90:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF546:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1050:
+	.string	"alloca"
+.LASF103:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF568:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF593:
+	.string	"__stub_gtty "
+.LASF420:
+	.string	"__WCHAR_T__ "
+.LASF349:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF674:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF40:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1111:
+	.string	"va_read_iter"
+.LASF432:
+	.string	"_GCC_WCHAR_T "
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF557:
+	.string	"__wur "
+.LASF52:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1105:
+	.string	"vtab"
+.LASF999:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF622:
+	.string	"static_assert"
+.LASF849:
+	.string	"VA_STATE_SKIP 4"
+.LASF92:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF710:
+	.string	"VA_P(X,...) X"
+.LASF1134:
+	.string	"va_span_p_read_vtab_utf8_chunk"
+.LASF253:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF397:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF643:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF361:
+	.string	"__code_model_small__ 1"
+.LASF689:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF506:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF653:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF272:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1130:
+	.string	"va_span_t"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF660:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF807:
+	.string	"VA_MASK2(S,M) (M)"
+.LASF518:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF574:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF110:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF896:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF524:
+	.string	"__STRING(x) #x"
+.LASF1085:
+	.string	"unsigned char"
+.LASF571:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF933:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF910:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF687:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF135:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF225:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF421:
+	.string	"_WCHAR_T "
+.LASF927:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF168:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF302:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF856:
+	.string	"VA_QUOTE_kk 5"
+.LASF614:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF724:
+	.string	"VA_REC(F,I,A,...) VA_EXP(VA_RECA(F,I VA_NIX (VA_OPT(0,1,__VA_ARGS__),A),__VA_ARGS__))"
+.LASF396:
+	.string	"_GCC_PTRDIFF_T "
+.LASF617:
+	.string	"_ASSERT_H 1"
+.LASF1084:
+	.string	"char"
+.LASF519:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF580:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF402:
+	.string	"_SIZE_T "
+.LASF429:
+	.string	"_WCHAR_T_H "
+.LASF1166:
+	.string	"va_xprintf_char_pp_utf8"
+.LASF847:
+	.string	"VA_STATE_WIDTH 2"
+.LASF1184:
+	.string	"_mm_unpacklo_epi16"
+.LASF84:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1126:
+	.string	"va_window_t"
+.LASF206:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF726:
+	.string	"VA_READ_ITER(TAKE,DATA) ((va_read_iter_t){ (TAKE),(DATA) })"
+.LASF748:
+	.string	"VA_E_NULL 1"
+.LASF662:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1039:
+	.string	"__ONCE_ALIGNMENT "
+.LASF790:
+	.string	"VA_STREAM_CHAR_SIZE(Char,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_size_vtab_gen((Char*)NULL)), NULL, (N), 0 })"
+.LASF300:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF255:
+	.string	"__FLT128_DIG__ 33"
+.LASF117:
+	.string	"__INT8_C(c) c"
+.LASF229:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF387:
+	.string	"_STDDEF_H_ "
+.LASF175:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF406:
+	.string	"__SIZE_T "
+.LASF970:
+	.string	"_ENDIAN_H 1"
+.LASF499:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF718:
+	.string	"VA_OPT(Z,N,...) VA_OPT0(VA_OPT1 VA_NIX (Z,N, VA_F VA_NOC(__VA_ARGS__) ()))"
+.LASF705:
+	.string	"VA_PAR ()"
+.LASF333:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF214:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF448:
+	.string	"__USE_ISOC95"
+.LASF717:
+	.string	"VA_OPT0(...) __VA_ARGS__"
+.LASF447:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1017:
+	.string	"NFDBITS __NFDBITS"
+.LASF455:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF908:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF624:
+	.string	"VA_PRINT_CHAR_H_ "
+.LASF919:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF202:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF343:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF756:
+	.string	"va_char_p_format utf8"
+.LASF878:
+	.string	"VA_QCLASS_CALL 2"
+.LASF526:
+	.string	"__BEGIN_DECLS "
+.LASF869:
+	.string	"VA_PREC_NONE VA_PREC_MASK"
+.LASF554:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF736:
+	.string	"VA_ENC_TAG(E) ((unsigned char)((E) >> 24))"
+.LASF891:
+	.string	"WCONTINUED 8"
+.LASF962:
+	.string	"__daddr_t_defined "
+.LASF267:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1007:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF861:
+	.string	"VA_OPT_ERR (27, 7U)"
+.LASF56:
+	.string	"__INT64_TYPE__ long int"
+.LASF669:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF245:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1128:
+	.string	"size"
+.LASF728:
+	.string	"VA_U_DATA 0x00ffffff"
+.LASF836:
+	.string	"VA_MODE_NORM 0"
+.LASF309:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1142:
+	.string	"long long unsigned int"
+.LASF388:
+	.string	"_ANSI_STDDEF_H "
+.LASF1160:
+	.string	"iter"
+.LASF932:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF907:
+	.string	"__WCOREFLAG 0x80"
+.LASF205:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF449:
+	.string	"__USE_ISOCXX11"
+.LASF410:
+	.string	"_SIZE_T_DEFINED "
+.LASF87:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1192:
+	.string	"va_stream_room"
+.LASF647:
+	.string	"__U64_TYPE unsigned long int"
+.LASF392:
+	.string	"__PTRDIFF_T "
+.LASF293:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF77:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF853:
+	.string	"VA_QUOTE_q 2"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF217:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1002:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF967:
+	.string	"__timer_t_defined 1"
+.LASF487:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1138:
+	.string	"check_flush"
+.LASF66:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF902:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF953:
+	.string	"__dev_t_defined "
+.LASF50:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1190:
+	.string	"_mm_load_si128"
+.LASF1116:
+	.string	"quote"
+.LASF301:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF950:
+	.string	"_SYS_TYPES_H 1"
+.LASF550:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF453:
+	.string	"__USE_POSIX199506"
+.LASF754:
+	.string	"VA_E_FOREACH EACH(VA_E_OK) EACH(VA_E_NULL) EACH(VA_E_DECODE) EACH(VA_E_ENCODE) EACH(VA_E_TRUNC) EACH(VA_E_FORMAT) EACH(VA_E_ARGC)"
+.LASF973:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1147:
+	.string	"__v4si"
+.LASF835:
+	.string	"VA_OPT_MODE (10, 7U)"
+.LASF148:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF23:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF946:
+	.string	"RAND_MAX 2147483647"
+.LASF1044:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1076:
+	.ascii	"_MM_TRANSPOSE4_PS(row0,row1,row2,row3) do { __v4sf __r0 = (r"
+	.ascii	"ow0), __r1 = (row1), __r2 = (row2), __r3 = (row3); __v4sf __"
+	.ascii	"t0 = __builtin_ia32_unpcklps (__r0, __r1); __v4sf __t1 = __b"
+	.ascii	"uiltin_ia32_unpcklps (__r2, __r3); __v4sf __t2 = __builtin_i"
+	.ascii	"a32_unpckhps (__r0"
+	.string	", __r1); __v4sf __t3 = __builtin_ia32_unpckhps (__r2, __r3); (row0) = __builtin_ia32_movlhps (__t0, __t1); (row1) = __builtin_ia32_movhlps (__t1, __t0); (row2) = __builtin_ia32_movlhps (__t2, __t3); (row3) = __builtin_ia32_movhlps (__t3, __t2); } while (0)"
+.LASF1187:
+	.string	"_mm_unpackhi_epi8"
+.LASF365:
+	.string	"__FXSR__ 1"
+.LASF763:
+	.string	"va_char32_p_decode utf32"
+.LASF762:
+	.string	"va_char32_p_format utf32"
+.LASF1107:
+	.string	"va_read_iter_t"
+.LASF496:
+	.string	"__WORDSIZE 64"
+.LASF417:
+	.string	"__size_t "
+.LASF766:
+	.ascii	"va_format_gen(x) _Generic(x, char const *:&VA_CONCAT(va_char"
+	.ascii	"_p_read_vtab_,va_char_p_format), char *:&VA_CONCAT(va_char_p"
+	.ascii	"_read_vtab_,va_char_p_format), char16_t const *:&VA_CONCAT(v"
+	.ascii	"a_char16_p_read_vtab_,va_char16_p_format), char16_t *:&VA_CO"
+	.ascii	"NCAT(va_"
+	.string	"char16_p_read_vtab_,va_char16_p_format), char32_t const *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), char32_t *:&VA_CONCAT(va_char32_p_read_vtab_,va_char32_p_format), va_format_t const *:&va_format_read_vtab, va_format_t *:&va_format_read_vtab)"
+.LASF428:
+	.string	"_WCHAR_T_DEFINED "
+.LASF346:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF597:
+	.string	"__stub_stty "
+.LASF1004:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF658:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF308:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF532:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF779:
+	.string	"va_format_plain(X) (VA_IS_ARRAY(X) && va_format_plain_f(X, sizeof(X)))"
+.LASF125:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF585:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF988:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF408:
+	.string	"_BSD_SIZE_T_ "
+.LASF529:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF454:
+	.string	"__USE_XOPEN"
+.LASF1099:
+	.string	"bulk"
+.LASF976:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF362:
+	.string	"__MMX__ 1"
+.LASF1182:
+	.string	"_mm_cmpeq_epi8"
+.LASF732:
+	.string	"VA_U_ENC_UTF8 0x01000000"
+.LASF986:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF785:
+	.string	"VA_PRINT_CHAR_UTF32_H_ "
+.LASF925:
+	.string	"__HAVE_FLOAT64 1"
+.LASF886:
+	.string	"_STDLIB_H 1"
+.LASF636:
+	.string	"__S32_TYPE int"
+.LASF760:
+	.string	"va_char16_p_decode utf16"
+.LASF759:
+	.string	"va_char16_p_format utf16"
+.LASF895:
+	.string	"__WCLONE 0x80000000"
+.LASF855:
+	.string	"VA_QUOTE_K 4"
+.LASF431:
+	.string	"__INT_WCHAR_T_H "
+.LASF663:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1149:
+	.string	"__v16qi"
+.LASF442:
+	.string	"_STRING_H 1"
+.LASF1027:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF824:
+	.string	"VA_OPT_ZERO 0x0004"
+.LASF883:
+	.string	"_MMINTRIN_H_INCLUDED "
+.LASF172:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF834:
+	.string	"VA_SIGN_ZEXT 3"
+.LASF831:
+	.string	"VA_SIGN_NORM 0"
+.LASF501:
+	.string	"__USE_ATFILE 1"
+.LASF1103:
+	.string	"str_prefix"
+.LASF182:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF915:
+	.string	"_BITS_FLOATN_H "
+.LASF295:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF425:
+	.string	"_WCHAR_T_ "
+.LASF699:
+	.string	"VA_BLOCK_STMT(A) do{ A ;}while(0)"
+.LASF623:
+	.string	"static_assert _Static_assert"
+.LASF85:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF220:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF729:
+	.string	"VA_U_EMORE (29,3U)"
+.LASF219:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF296:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1025:
+	.string	"__fsfilcnt_t_defined "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF192:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1038:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1151:
+	.string	"va_xprintf_iter_chunk"
+.LASF789:
+	.string	"VA_STREAM_CHAR_P(S,N) ((va_stream_char_p_t){ VA_STREAM(va_char_p_vtab_gen(S)), (S), (N), 0 })"
+.LASF204:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1123:
+	.string	"put_len"
+.LASF918:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF280:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF872:
+	.string	"VA_DELIM_WIDTH(x) ((unsigned char) ((x) >> 0))"
+.LASF591:
+	.string	"__stub_chflags "
+.LASF441:
+	.string	"_GCC_MAX_ALIGN_T "
+.LASF467:
+	.string	"__USE_GNU"
+.LASF725:
+	.string	"VA_STREAM(F) ((va_stream_t){ F,{0,0},0,0,0,0,{0,0},0 })"
+.LASF416:
+	.string	"_SIZET_ "
+.LASF680:
+	.string	"__TIMER_T_TYPE void *"
+.LASF187:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1067:
+	.string	"_MM_MASK_INEXACT 0x1000"
+.LASF778:
+	.string	"VA_IS_ARRAY(X) (!__builtin_types_compatible_p(__typeof__(X), __typeof__(&*(X))))"
+.LASF735:
+	.string	"VA_U_ENC_ISO88591 0x04000000"
+.LASF957:
+	.string	"__uid_t_defined "
+.LASF1171:
+	.string	"va_span_p_bulk_utf8"
+.LASF982:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1100:
+	.string	"transcode"
+.LASF364:
+	.string	"__SSE2__ 1"
+.LASF265:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1137:
+	.string	"check_quote"
+.LASF673:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF579:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF922:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF562:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF323:
+	.string	"__REGISTER_PREFIX__ "
+.LASF322:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF174:
+	.string	"__DBL_DIG__ 15"
+.LASF963:
+	.string	"__key_t_defined "
+.LASF1068:
+	.string	"_MM_ROUND_MASK 0x6000"
+.LASF936:
+	.string	"__f32(x) x ##f32"
+.LASF802:
+	.string	"va_gznprintf(Char,N,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, (size_t)(N) + 1), __VA_ARGS__)->pos + 1)"
+.LASF552:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF905:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF33:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF874:
+	.string	"VA_DELIM_FRONT(x) ((unsigned short) ((x) >> 16))"
+.LASF248:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF495:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1016:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF527:
+	.string	"__END_DECLS "
+.LASF370:
+	.string	"__SEG_GS 1"
+.LASF892:
+	.string	"WNOWAIT 0x01000000"
+.LASF115:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF761:
+	.string	"VA_PRINT_UTF32_H_ "
+.LASF744:
+	.ascii	"va_boxof(_val,_Target,_slot) ({ __typeof__(*(_val)) *val_ = "
+	.ascii	"(_va"
+	.string	"l); typedef __typeof__(_Target) _Type; _Type *r_ = (_Type*)(((size_t)val_) - offsetof(_Type, _slot)); __auto_type r2_ = _Generic(0 ? val_ : (void*)1, void * : r_, void const * : (_Type const *)r_); __typeof__(r2_->_slot) *val2_ = val_; (void)val2_; r2_; })"
+.LASF769:
+	.string	"va_iprintf(P,X,...) VA_BLOCK_STMT((void)va_xprintf(P,X,__VA_ARGS__))"
+.LASF357:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF73:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1028:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF850:
+	.string	"VA_OPT_QUOTE (16, 7U)"
+.LASF848:
+	.string	"VA_STATE_PREC 3"
+.LASF876:
+	.string	"VA_QCLASS_PLAIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF366:
+	.string	"__SSE_MATH__ 1"
+.LASF1088:
+	.string	"short int"
+.LASF510:
+	.string	"_SYS_CDEFS_H 1"
+.LASF632:
+	.string	"_UCHAR_H 1"
+.LASF706:
+	.string	"VA_EXP1(...) __VA_ARGS__"
+.LASF89:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF131:
+	.string	"__UINT16_C(c) c"
+.LASF975:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF215:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF216:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF476:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF934:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF801:
+	.string	"va_Uzprintf(...) va_gzprintf(char32_t, __VA_ARGS__)"
+.LASF1139:
+	.string	"render_quote"
+.LASF290:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF993:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF540:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1022:
+	.string	"__blksize_t_defined "
+.LASF230:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1193:
+	.string	"va_units_utf8"
+.LASF105:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF238:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF74:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF70:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF577:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF641:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF30:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF605:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF312:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1172:
+	.string	"va_char_p_bulk_utf8"
+.LASF179:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF887:
+	.string	"WNOHANG 1"
+.LASF588:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF679:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF538:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1102:
+	.string	"chunk_mode"
+.LASF1191:
+	.string	"va_stream_reserve"
+.LASF1073:
+	.string	"_MM_FLUSH_ZERO_MASK 0x8000"
+.LASF181:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF987:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF109:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF541:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF642:
+	.string	"__SWORD_TYPE long int"
+.LASF1127:
+	.string	"va_span"
+.LASF93:
+	.string	"__INT_WIDTH__ 32"
+.LASF1104:
+	.string	"_pad"
+.LASF549:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF254:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF655:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF488:
+	.string	"__USE_POSIX 1"
+.LASF1057:
+	.string	"_MM_EXCEPT_DIV_ZERO 0x0004"
+.LASF107:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1152:
+	.string	"va_xprintf_iter_local"
+.LASF587:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF947:
+	.string	"EXIT_FAILURE 1"
+.LASF884:
+	.string	"_MM_MALLOC_H_INCLUDED "
+.LASF709:
+	.string	"VA_EXP(...) VA_EXP3(VA_EXP3(VA_EXP3(VA_EXP3(__VA_ARGS__))))"
+.LASF198:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF808:
+	.string	"VA_MASK1(W) (VA_MASK2 W)"
+.LASF810:
+	.string	"VA_SHIFT2(S,M) (S)"
+.LASF882:
+	.string	"_XMMINTRIN_H_INCLUDED "
+.LASF630:
+	.string	"false 0"
+.LASF1122:
+	.string	"put_fill"
+.LASF342:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1043:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF348:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF966:
+	.string	"__time_t_defined 1"
+.LASF36:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1036:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF989:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF556:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF560:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF234:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF858:
+	.string	"VA_QUOTE_QQ 7"
+.LASF303:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF60:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF838:
+	.string	"VA_MODE_CHAR 2"
+.LASF430:
+	.string	"___int_wchar_t_h "
+.LASF1153:
+	.string	"memcpy"
+.LASF294:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF981:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF32:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF576:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF412:
+	.string	"_SIZE_T_DECLARED "
+.LASF564:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF45:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF261:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF923:
+	.string	"__HAVE_FLOAT16 0"
+.LASF711:
+	.string	"VA_F(...) VA_H"
+.LASF944:
+	.string	"__ldiv_t_defined 1"
+.LASF477:
+	.string	"_DEFAULT_SOURCE"
+.LASF841:
+	.string	"VA_MODE_STAT 5"
+.LASF415:
+	.string	"_GCC_SIZE_T "
+.LASF286:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF702:
+	.string	"VA_EAT(...) "
+.LASF213:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF698:
+	.string	"VA_CONCAT2(A,B) A ## B"
+.LASF83:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1155:
+	.string	"va_char_p_end"
+.LASF341:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF435:
+	.string	"_BSD_WCHAR_T_"
+.LASF819:
+	.string	"VA_MSET(X,MASK,V) __extension__({ __typeof__(X) *_xp = &(X); __typeof__(X) _m = (MASK); *_xp |= _m; *_xp ^= _m; *_xp |= (V); })"
+.LASF678:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF733:
+	.string	"VA_U_ENC_UTF16 0x02000000"
+.LASF868:
+	.string	"VA_PREC_MASK 0x7fffffff"
+.LASF784:
+	.string	"va_char16_p_encode utf16"
+.LASF479:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF652:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF694:
+	.string	"__mbstate_t_defined 1"
+.LASF207:
+	.string	"__FLT16_DIG__ 3"
+.LASF150:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF355:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF528:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF978:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF350:
+	.string	"__amd64 1"
+.LASF485:
+	.string	"_POSIX_SOURCE 1"
+.LASF199:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF489:
+	.string	"__USE_POSIX2 1"
+.LASF376:
+	.string	"__unix__ 1"
+.LASF664:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1133:
+	.string	"va_char_p_read_vtab_utf8_chunk"
+.LASF904:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF583:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1106:
+	.string	"va_read_iter_vtab_t"
+.LASF604:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF190:
+	.string	"__LDBL_DIG__ 18"
+.LASF656:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF955:
+	.string	"__mode_t_defined "
+.LASF88:
+	.string	"__WINT_MIN__ 0U"
+.LASF657:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF239:
+	.string	"__FLT64_DIG__ 15"
+.LASF314:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF166:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF118:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF867:
+	.string	"VA_WIDTH_MAX (VA_WIDTH_MASK-1)"
+.LASF62:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF739:
+	.string	"VA_U_MAX 0x10ffff"
+.LASF513:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1157:
+	.string	"va_xprintf_span_p_utf8"
+.LASF377:
+	.string	"unix 1"
+.LASF648:
+	.string	"__STD_TYPE typedef"
+.LASF1144:
+	.string	"float"
+.LASF235:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1143:
+	.string	"va_quotation_t"
+.LASF1049:
+	.string	"_ALLOCA_H 1"
+.LASF607:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1054:
+	.string	"_MM_EXCEPT_MASK 0x003f"
+.LASF373:
+	.string	"__linux__ 1"
+.LASF502:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF191:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF500:
+	.string	"__USE_MISC 1"
+.LASF631:
+	.string	"__bool_true_false_are_defined 1"
+.LASF893:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF683:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF786:
+	.string	"va_char32_p_encode utf32"
+.LASF183:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1178:
+	.string	"va_xprintf_last_char_pp_utf8"
+.LASF700:
+	.string	"VA_BLOCK_EXPR(A) __extension__({ A ;})"
+.LASF899:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF132:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF722:
+	.string	"VA_REC1() VA_REC1B"
+.LASF909:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF1181:
+	.string	"_mm_movemask_epi8"
+.LASF798:
+	.string	"va_gzprintf(Char,...) VA_BLOCK_EXPR(va_xprintf( &VA_STREAM_CHAR_SIZE(Char, -(size_t)2), __VA_ARGS__)->pos + 1)"
+.LASF186:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF533:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF832:
+	.string	"VA_SIGN_SPACE 1"
+.LASF859:
+	.string	"VA_OPT_SIZE (19, 3U)"
+.LASF844:
+	.string	"VA_OPT_STATE (13, 7U)"
+.LASF943:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF659:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1195:
+	.string	"va_store_utf16"
+.LASF469:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF57:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF270:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF96:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF462:
+	.string	"__USE_LARGEFILE64"
+.LASF800:
+	.string	"va_uzprintf(...) va_gzprintf(char16_t, __VA_ARGS__)"
+.LASF120:
+	.string	"__INT16_C(c) c"
+.LASF287:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1072:
+	.string	"_MM_ROUND_TOWARD_ZERO 0x6000"
+.LASF310:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF894:
+	.string	"__WALL 0x40000000"
+.LASF951:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1114:
+	.string	"prec"
+.LASF977:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF372:
+	.string	"__linux 1"
+.LASF427:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1129:
+	.string	"data"
+.LASF141:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF200:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF184:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF616:
+	.string	"_STRINGS_H 1"
+.LASF1018:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF292:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF598:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF49:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF753:
+	.string	"VA_E_ARGC 6"
+.LASF1037:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF688:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF842:
+	.string	"VA_MODE_X6 6"
+.LASF1031:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF486:
+	.string	"_POSIX_C_SOURCE"
+.LASF727:
+	.string	"VA_U_ENC 0x1f000000"
+.LASF173:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF682:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1078:
+	.string	"ASCII_BLOCK 16U"
+.LASF829:
+	.string	"VA_OPT_INIT 0x0080"
+.LASF783:
+	.string	"VA_PRINT_CHAR_UTF16_H_ "
+.LASF1042:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1194:
+	.string	"va_take_utf8"
+.LASF651:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF567:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF82:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF134:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF113:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF136:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1024:
+	.string	"__fsblkcnt_t_defined "
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"src/utf8.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -2,9 +2,77 @@
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
 #include <assert.h>
+#include <string.h>
 #include "va_print/alloc.h"
 #include "va_print/impl.h"
 
+/* ********************************************************************** */
+/* static functions */
+
+static void commit(va_stream_vec_t *t)
+{
+    if (t->s.win.cur != NULL) {
+        t->pos = (size_t)((char*)t->s.win.cur - t->data);
+        t->s.win = (va_window_t){ NULL, NULL };
+    }
+}
+
+/**
+ * Allocate, reallocate, or deallocate like the 'alloc' protocol, but
+ * from the arena if the stream has one.
+ */
+static void *vec_alloc(va_stream_vec_t *t, void *data, size_t nmemb)
+{
+    if (t->arena != NULL) {
+        return va_arena_alloc(t->arena, data, nmemb, sizeof(*t->data));
+    }
+    return t->alloc(data, nmemb, sizeof(*t->data));
+}
+
+/**
+ * Reallocate to 'size' entries.  The staging buffer is not owned by the
+ * stream, so it is copied into a new allocation instead.  On failure,
+ * the old data is kept.
+ */
+static bool resize(va_stream_vec_t *t, size_t size)
+{
+    char *new_data;
+    if (t->data == t->stage) {
+        new_data = vec_alloc(t, NULL, size);
+        if (new_data != NULL) {
+            memcpy(new_data, t->data, t->pos * sizeof(*t->data));
+        }
+    }
+    else {
+        new_data = vec_alloc(t, t->data, size);
+    }
+    if (new_data == NULL) {
+        return false;
+    }
+    t->data = new_data;
+    t->size = size;
+    return true;
+}
+
+/**
+ * Like resize(), but on failure, the stream is marked full and its data
+ * is deallocated.
+ */
+static bool grow(va_stream_vec_t *t, size_t size)
+{
+    if (resize(t, size)) {
+        return true;
+    }
+    if (t->data != t->stage) {
+        (void)vec_alloc(t, t->data, 0);
+    }
+    va_stream_set_full(&t->s);
+    t->pos = 0;
+    t->size = 0;
+    t->data = NULL;
+    return false;
+}
+
 /* ********************************************************************** */
 /* extern functions */
 
@@ -16,42 +84,161 @@ extern void va_vec_init(
         return;
     }
 
-    t->data = t->alloc(NULL, t->size, sizeof(*t->data));
+    t->data = vec_alloc(t, NULL, t->size);
     if (t->data == NULL) {
-        va_stream_set_error(s, VA_E_TRUNC);
+        va_stream_set_full(s);
         t->pos = 0;
         t->size = 0;
         return;
     }
 
     t->pos = 0;
-    t->data[0] = 0;
 }
 
-extern void va_vec_put(
-    va_stream_t *s,
-    char c)
+extern void va_vec_finish(
+    va_stream_t *s)
 {
     va_stream_vec_t *t = (va_stream_vec_t*)s;
+    commit(t);
     if (t->data == NULL) {
         return;
     }
+    t->data[t->pos] = 0;
+    if (t->keep || ((t->stage == NULL) && (t->arena == NULL))) {
+        return;
+    }
 
-    if ((t->pos + 1) >= t->size) {
-        t->size *= 2;
-        char *new_data = t->alloc(t->data, t->size, sizeof(*t->data));
+    /* with a staging buffer: exactly one allocation of the final size,
+     * in an arena: give back the unused tail */
+    size_t size = t->pos + 1;
+    if (t->data == t->stage) {
+        char *new_data = vec_alloc(t, NULL, size);
         if (new_data == NULL) {
-            (void)t->alloc(t->data, 0, sizeof(*t->data));
-            va_stream_set_error(s, VA_E_TRUNC);
+            va_stream_set_full(s);
             t->pos = 0;
             t->size = 0;
             t->data = NULL;
             return;
         }
+        memcpy(new_data, t->data, size * sizeof(*t->data));
         t->data = new_data;
+        t->size = size;
+    }
+    else if (size < t->size) {
+        /* spilled: shrink to fit, keep the old buffer on failure */
+        char *new_data = vec_alloc(t, t->data, size);
+        if (new_data != NULL) {
+            t->data = new_data;
+            t->size = size;
+        }
+    }
+}
+
+extern bool va_vec_refill(
+    va_stream_t *s,
+    size_t need)
+{
+    va_stream_vec_t *t = (va_stream_vec_t*)s;
+    commit(t);
+    if (t->data == NULL) {
+        return false;
+    }
+
+    size_t n = (need + sizeof(*t->data) - 1) / sizeof(*t->data);
+    if ((t->pos + n) >= t->size) {
+        size_t size = t->size * 2;
+        while ((t->pos + n) >= size) {
+            size *= 2;
+        }
+        if (!grow(t, size)) {
+            return false;
+        }
+    }
+
+    t->s.win = (va_window_t){ t->data + t->pos, t->data + t->size - 1 };
+    return true;
+}
+
+extern void va_vec_put(
+    va_stream_t *s,
+    char c)
+{
+    va_stream_vec_t *t = (va_stream_vec_t*)s;
+    if (t->data == NULL) {
+        return;
+    }
+
+    if (((t->pos + 1) >= t->size) && !grow(t, t->size * 2)) {
+        return;
     }
 
     t->data[t->pos] = c;
-    t->data[t->pos+1] = 0;
     t->pos++;
 }
+
+extern void va_vec_clear(
+    va_stream_vec_t *t)
+{
+    commit(t);
+    t->pos = 0;
+    if (t->data != NULL) {
+        t->data[0] = 0;
+    }
+    else if (t->size == 0) {
+        /* after an allocation error: try again with the next print */
+        t->size = va_asprintf_init_size;
+    }
+}
+
+extern bool va_vec_reserve(
+    va_stream_vec_t *t,
+    size_t n)
+{
+    commit(t);
+    if (n >= (-(size_t)1 / sizeof(*t->data))) {
+        return false;
+    }
+    if (t->data == NULL) {
+        t->size = (n < va_asprintf_init_size) ? va_asprintf_init_size : n + 1;
+        t->pos = 0;
+        t->data = vec_alloc(t, NULL, t->size);
+        if (t->data == NULL) {
+            return false;
+        }
+        t->data[0] = 0;
+        return true;
+    }
+    return (n < t->size) || resize(t, n + 1);
+}
+
+extern void va_vec_shrink(
+    va_stream_vec_t *t,
+    size_t n)
+{
+    commit(t);
+    size_t size = ((n > t->pos) ? n : t->pos) + 1;
+    if ((t->data != NULL) && (t->data != t->stage) && (size < t->size)) {
+        (void)resize(t, size);
+    }
+}
+
+extern va_span_t *va_vec_span(
+    va_stream_vec_t *t,
+    va_span_t *span)
+{
+    commit(t);
+    *span = (va_span_t){ t->pos, t->data };
+    return span;
+}
+
+extern void va_vec_free(
+    va_stream_vec_t *t)
+{
+    commit(t);
+    if ((t->data != NULL) && (t->data != t->stage)) {
+        (void)vec_alloc(t, t->data, 0);
+    }
+    t->data = NULL;
+    t->pos = 0;
+    t->size = va_asprintf_init_size;
+}
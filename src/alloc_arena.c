@@ -0,0 +1,160 @@
+/* -*- Mode: C -*- */
+/* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include "va_print/alloc.h"
+
+/* ********************************************************************** */
+/* types */
+
+/**
+ * Allocations are aligned like for malloc(), and each one is preceded by
+ * a header with its size, so that it can be copied when it cannot grow
+ * in place.
+ */
+#define ALIGN        ((size_t)_Alignof(max_align_t))
+#define ALIGN_UP(N)  ((((N) + ALIGN - 1) / ALIGN) * ALIGN)
+#define HEAD         ALIGN_UP(sizeof(size_t))
+#define CHUNK_HEAD   ALIGN_UP(sizeof(va_arena_chunk_t))
+
+/**
+ * A chunk header, followed by 'size' bytes of memory at CHUNK_HEAD.
+ */
+struct va_arena_chunk {
+    va_arena_chunk_t *next;
+    size_t size;
+    size_t used;
+};
+
+/* ********************************************************************** */
+/* static functions */
+
+static char *chunk_data(va_arena_chunk_t *c)
+{
+    return (char*)c + CHUNK_HEAD;
+}
+
+static size_t *head(void *data)
+{
+    return (size_t*)((char*)data - HEAD);
+}
+
+/**
+ * Bytes needed for an allocation of 'n' bytes, or 0 on overflow.
+ */
+static size_t block_size(size_t n)
+{
+    if (n > (-(size_t)1 - HEAD - ALIGN)) {
+        return 0;
+    }
+    return HEAD + ALIGN_UP(n);
+}
+
+static void *take(va_arena_t *a, size_t n)
+{
+    size_t need = block_size(n);
+    if (need == 0) {
+        return NULL;
+    }
+    va_arena_chunk_t *c = a->chunk;
+    if ((c == NULL) || ((c->size - c->used) < need)) {
+        size_t size = (need < a->chunk_size) ? a->chunk_size : need;
+        size = ALIGN_UP(size);
+        if (size > (-(size_t)1 - CHUNK_HEAD)) {
+            return NULL;
+        }
+        c = a->alloc(NULL, CHUNK_HEAD + size, 1);
+        if (c == NULL) {
+            return NULL;
+        }
+        c->next = a->chunk;
+        c->size = size;
+        c->used = 0;
+        a->chunk = c;
+    }
+    char *p = chunk_data(c) + c->used;
+    c->used += need;
+    a->last = p + HEAD;
+    *head(a->last) = n;
+    return a->last;
+}
+
+/* ********************************************************************** */
+/* extern functions */
+
+extern void *va_arena_alloc(
+    va_arena_t *a,
+    void *data,
+    size_t nmemb,
+    size_t size)
+{
+    assert(size != 0);
+    if (nmemb == 0) {
+        /* only the last allocation can be given back */
+        if ((data != NULL) && (data == a->last)) {
+            a->chunk->used -= block_size(*head(data));
+            a->last = NULL;
+        }
+        return NULL;
+    }
+
+    size_t n;
+    if (__builtin_mul_overflow(nmemb, size, &n)) {
+        return NULL;
+    }
+    if (data == NULL) {
+        return take(a, n);
+    }
+
+    size_t old = *head(data);
+    if (data == a->last) {
+        /* grow or shrink in place */
+        va_arena_chunk_t *c = a->chunk;
+        size_t off = (size_t)((char*)data - chunk_data(c));
+        if (n <= (c->size - off)) {
+            c->used = off - HEAD + block_size(n);
+            *head(data) = n;
+            return data;
+        }
+    }
+    else if (n <= old) {
+        return data;
+    }
+
+    void *new_data = take(a, n);
+    if (new_data != NULL) {
+        memcpy(new_data, data, (old < n) ? old : n);
+    }
+    return new_data;
+}
+
+extern void va_arena_reset(
+    va_arena_t *a)
+{
+    va_arena_chunk_t *c = a->chunk;
+    if (c == NULL) {
+        return;
+    }
+    while (c->next != NULL) {
+        va_arena_chunk_t *next = c->next->next;
+        (void)a->alloc(c->next, 0, 1);
+        c->next = next;
+    }
+    c->used = 0;
+    a->last = NULL;
+}
+
+extern void va_arena_free(
+    va_arena_t *a)
+{
+    va_arena_chunk_t *c = a->chunk;
+    while (c != NULL) {
+        va_arena_chunk_t *next = c->next;
+        (void)a->alloc(c, 0, 1);
+        c = next;
+    }
+    a->chunk = NULL;
+    a->last = NULL;
+}
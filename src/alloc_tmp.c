@@ -0,0 +1,71 @@
+/* -*- Mode: C -*- */
+/* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
+
+#include "va_print/alloc.h"
+
+/* ********************************************************************** */
+/* static objects */
+
+/**
+ * The per-thread rings of string builders used by va_tprintf() etc.
+ * The buffers are kept across calls and only grow, until
+ * va_tprintf_free() is called.
+ */
+static _Thread_local va_stream_vec_t   ring[va_tprintf_slots];
+static _Thread_local va_stream_vec16_t ring16[va_tprintf_slots];
+static _Thread_local va_stream_vec32_t ring32[va_tprintf_slots];
+
+static _Thread_local unsigned next;
+static _Thread_local unsigned next16;
+static _Thread_local unsigned next32;
+
+/* ********************************************************************** */
+/* extern functions */
+
+extern va_stream_vec_t *va_tmp_vec(
+    va_stream_vtab_t const *vtab)
+{
+    va_stream_vec_t *t = &ring[next];
+    next = (next + 1) % va_tprintf_slots;
+    if (t->alloc == NULL) {
+        *t = VA_STREAM_VEC(va_alloc);
+    }
+    va_vec_clear(t);
+    t->s = VA_STREAM(vtab);
+    return t;
+}
+
+extern va_stream_vec16_t *va_tmp_vec16(
+    va_stream_vtab_t const *vtab)
+{
+    va_stream_vec16_t *t = &ring16[next16];
+    next16 = (next16 + 1) % va_tprintf_slots;
+    if (t->alloc == NULL) {
+        *t = VA_STREAM_VEC16(va_alloc);
+    }
+    va_vec16_clear(t);
+    t->s = VA_STREAM(vtab);
+    return t;
+}
+
+extern va_stream_vec32_t *va_tmp_vec32(
+    va_stream_vtab_t const *vtab)
+{
+    va_stream_vec32_t *t = &ring32[next32];
+    next32 = (next32 + 1) % va_tprintf_slots;
+    if (t->alloc == NULL) {
+        *t = VA_STREAM_VEC32(va_alloc);
+    }
+    va_vec32_clear(t);
+    t->s = VA_STREAM(vtab);
+    return t;
+}
+
+extern void va_tprintf_free(void)
+{
+    for (unsigned i = 0; i < va_tprintf_slots; i++) {
+        va_vec_free(&ring[i]);
+        va_vec16_free(&ring16[i]);
+        va_vec32_free(&ring32[i]);
+    }
+}
@@ -19,4 +19,7 @@ static void va_vec16_put_utf16(va_stream_t *s, unsigned c)
 va_stream_vtab_t const va_vec16_vtab_utf16 = {
     .init = va_vec16_init,
     .put = va_vec16_put_utf16,
+    .finish = va_vec16_finish,
+    .refill = va_vec16_refill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF16),
 };
@@ -19,4 +19,7 @@ static void va_vec32_put_utf32(va_stream_t *s, unsigned c)
 va_stream_vtab_t const va_vec32_vtab_utf32 = {
     .init = va_vec32_init,
     .put = va_vec32_put_utf32,
+    .finish = va_vec32_finish,
+    .refill = va_vec32_refill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF32),
 };
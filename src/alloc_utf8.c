@@ -19,4 +19,7 @@ static void va_vec_put_utf8(va_stream_t *s, unsigned c)
 va_stream_vtab_t const va_vec_vtab_utf8 = {
     .init = va_vec_init,
     .put = va_vec_put_utf8,
+    .finish = va_vec_finish,
+    .refill = va_vec_refill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF8),
 };
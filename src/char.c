@@ -2,9 +2,22 @@
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
 #include <assert.h>
+#include <string.h>
 #include "va_print/char.h"
 #include "va_print/impl.h"
 
+/* ********************************************************************** */
+/* static functions */
+
+static void commit(va_stream_char_p_t *t)
+{
+    if (t->s.win.cur != NULL) {
+        char *data = t->data;
+        t->pos = (size_t)((char*)t->s.win.cur - data);
+        t->s.win = (va_window_t){ NULL, NULL };
+    }
+}
+
 /* ********************************************************************** */
 /* extern functions */
 
@@ -12,27 +25,77 @@ extern void va_char_p_init(va_stream_t *s)
 {
     va_stream_char_p_t *t = (va_stream_char_p_t*)s;
     assert((t->size > 0) && "string must not be size 0: need to fit NUL");
-    char *data = t->data;
     if (t->pos >= t->size) {
-        va_stream_set_error(&t->s, VA_E_TRUNC);
-        return;
+        va_stream_set_full(&t->s);
     }
-    if (data != NULL) {
+}
+
+extern void va_char_p_finish(va_stream_t *s)
+{
+    va_stream_char_p_t *t = (va_stream_char_p_t*)s;
+    commit(t);
+    char *data = t->data;
+    if ((data != NULL) && (t->pos < t->size)) {
         data[t->pos] = 0;
     }
 }
 
+extern bool va_char_p_refill(va_stream_t *s, size_t need)
+{
+    va_stream_char_p_t *t = (va_stream_char_p_t*)s;
+    commit(t);
+    char *data = t->data;
+    if ((data == NULL) || ((t->pos + 1) >= t->size)) {
+        return false;
+    }
+    if (((t->size - 1 - t->pos) * sizeof(*data)) < need) {
+        return false;
+    }
+    t->s.win = (va_window_t){ data + t->pos, data + t->size - 1 };
+    return true;
+}
+
+extern void va_char_p_put_fill(va_stream_t *s, unsigned c, size_t n)
+{
+    va_stream_char_p_t *t = (va_stream_char_p_t*)s;
+    commit(t);
+    size_t k = (t->pos + 1 < t->size) ? t->size - 1 - t->pos : 0;
+    if (k >= n) {
+        k = n;
+    }
+    else {
+        va_stream_set_full(&t->s);
+    }
+    char *data = t->data;
+    if (data != NULL) {
+        memset(data + t->pos, (int)c, k);
+    }
+    t->pos += k;
+}
+
+extern void va_char_p_put_len(va_stream_t *s, size_t n)
+{
+    va_stream_char_p_t *t = (va_stream_char_p_t*)s;
+    size_t k = (t->pos + 1 < t->size) ? t->size - 1 - t->pos : 0;
+    if (k >= n) {
+        k = n;
+    }
+    else {
+        va_stream_set_full(&t->s);
+    }
+    t->pos += k;
+}
+
 extern void va_char_p_put(va_stream_t *s, char c)
 {
     va_stream_char_p_t *t = (va_stream_char_p_t*)s;
     if (t->pos + 1 >= t->size) {
-        va_stream_set_error(&t->s, VA_E_TRUNC);
+        va_stream_set_full(&t->s);
         return;
     }
     char *data = t->data;
     if (data != NULL) {
         data[t->pos] = c;
-        data[t->pos+1] = 0;
     }
     t->pos++;
 }
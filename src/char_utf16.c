@@ -13,10 +13,27 @@ static void va_char16_p_put_utf16(va_stream_t *s, unsigned c)
     va_put_utf16(s, c, va_char16_p_put);
 }
 
+static void va_char16_p_size_put_utf16(va_stream_t *s, unsigned c)
+{
+    va_char_p_put_len(s, va_len_utf16(s, c));
+}
+
 /* ********************************************************************** */
 /* extern objects */
 
 va_stream_vtab_t const va_char16_p_vtab_utf16 = {
     .init = va_char16_p_init,
     .put = va_char16_p_put_utf16,
+    .finish = va_char16_p_finish,
+    .refill = va_char16_p_refill,
+    .put_fill = va_char16_p_put_fill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF16),
+};
+
+va_stream_vtab_t const va_char16_p_size_vtab_utf16 = {
+    .init = va_char16_p_init,
+    .put = va_char16_p_size_put_utf16,
+    .put_fill = va_char16_p_put_fill,
+    .put_len = va_char_p_put_len,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF16),
 };
@@ -13,10 +13,27 @@ static void va_char32_p_put_utf32(va_stream_t *s, unsigned c)
     va_put_utf32(s, c, va_char32_p_put);
 }
 
+static void va_char32_p_size_put_utf32(va_stream_t *s, unsigned c)
+{
+    va_char_p_put_len(s, va_len_utf32(s, c));
+}
+
 /* ********************************************************************** */
 /* extern objects */
 
 va_stream_vtab_t const va_char32_p_vtab_utf32 = {
     .init = va_char32_p_init,
     .put = va_char32_p_put_utf32,
+    .finish = va_char32_p_finish,
+    .refill = va_char32_p_refill,
+    .put_fill = va_char32_p_put_fill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF32),
+};
+
+va_stream_vtab_t const va_char32_p_size_vtab_utf32 = {
+    .init = va_char32_p_init,
+    .put = va_char32_p_size_put_utf32,
+    .put_fill = va_char32_p_put_fill,
+    .put_len = va_char_p_put_len,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF32),
 };
@@ -2,14 +2,15 @@
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
 #include <assert.h>
+#include <stdatomic.h>
 #include <string.h>
 #include "va_print/core.h"
 #include "va_print/impl.h"
 
-/* ********************************************************************** */
-/* sigil to use in format strings */
-#ifndef VA_SIGIL
-#define VA_SIGIL '~'
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
 #endif
 
 /* ********************************************************************** */
@@ -24,6 +25,67 @@ static char const *digit2_b32[2] = {
     "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567"
 };
 
+/* decimal digit pairs 00..99 */
+static char const digit_pair[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * Literal run of a precompiled format string, from 'at' up to the next
+ * sigil or the end of the format string.  All positions are byte
+ * offsets into the format string.
+ */
+struct va_format_lit {
+    size_t at;
+    size_t next;
+    /** number of code points */
+    size_t cps;
+    /** the run encoded in VA_ENC_TAG() 1..3, and its size in bytes */
+    void const *data[4];
+    size_t size[4];
+};
+
+/**
+ * Format specifier of a precompiled format string, from 'at' right
+ * after the sigil to 'next' after the conversion letter, and the
+ * stream settings that parse_format() derives from it.
+ */
+struct va_format_spec {
+    size_t at;
+    size_t next;
+    unsigned opt;
+    unsigned width;
+    unsigned prec;
+    unsigned _pad;
+};
+
+/* ********************************************************************** */
+/* extern object definitions */
+
+char const va_format_type[] = "va_format_t*";
+
+va_read_iter_vtab_t const va_format_read_vtab = {
+    va_format_type,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    false,
+    false,
+    0,
+    0,
+    {0}
+};
+
 /* ********************************************************************** */
 /* static functions */
 
@@ -37,7 +99,83 @@ extern void va_stream_render(va_stream_t *s, unsigned c)
     if (s->width > 0) {
         s->width--;
     }
-    if ((s->opt & VA_OPT_SIM) == 0) {
+    if ((s->opt & VA_OPT_SIM) != 0) {
+        return;
+    }
+    /* valid code points are stored into the output window directly,
+     * without the stream's and the encoder's 'put' */
+    if ((va_stream_room(s) >= 4) && va_u_valid(c)) {
+        switch (s->vtab->enc) {
+        case VA_ENC_TAG(VA_U_ENC_UTF8):
+            s->win.cur = va_store_utf8(s->win.cur, c);
+            return;
+
+        case VA_ENC_TAG(VA_U_ENC_UTF16):
+            s->win.cur = va_store_utf16(s->win.cur, c);
+            return;
+
+        case VA_ENC_TAG(VA_U_ENC_UTF32): {
+            char32_t *w = s->win.cur;
+            *w++ = c;
+            s->win.cur = w;
+            return;
+        }
+        }
+    }
+    s->vtab->put(s, c);
+}
+
+/**
+ * Render the ASCII character 'c' 'n' times, e.g., for padding.
+ */
+static void render_fill(va_stream_t *s, unsigned c, size_t n)
+{
+    s->width = (n < s->width) ? s->width - (unsigned)n : 0;
+    if ((s->opt & VA_OPT_SIM) != 0) {
+        return;
+    }
+    if (s->vtab->put_fill != NULL) {
+        s->vtab->put_fill(s, c, n);
+        return;
+    }
+    switch (s->vtab->enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8):
+        while ((n > 0) && va_stream_reserve(s, 1)) {
+            size_t k = va_stream_room(s);
+            k = (k < n) ? k : n;
+            memset(s->win.cur, (int)c, k);
+            s->win.cur = (char*)s->win.cur + k;
+            n -= k;
+        }
+        break;
+
+    case VA_ENC_TAG(VA_U_ENC_UTF16):
+        while ((n > 0) && va_stream_reserve(s, sizeof(char16_t))) {
+            size_t k = va_stream_room(s) / sizeof(char16_t);
+            k = (k < n) ? k : n;
+            char16_t *w = s->win.cur;
+            for (size_t i = 0; i < k; i++) {
+                *w++ = (char16_t)c;
+            }
+            s->win.cur = w;
+            n -= k;
+        }
+        break;
+
+    case VA_ENC_TAG(VA_U_ENC_UTF32):
+        while ((n > 0) && va_stream_reserve(s, sizeof(char32_t))) {
+            size_t k = va_stream_room(s) / sizeof(char32_t);
+            k = (k < n) ? k : n;
+            char32_t *w = s->win.cur;
+            for (size_t i = 0; i < k; i++) {
+                *w++ = c;
+            }
+            s->win.cur = w;
+            n -= k;
+        }
+        break;
+    }
+    for (; n > 0; n--) {
         s->vtab->put(s, c);
     }
 }
@@ -267,28 +405,120 @@ static va_quotation_t quote_sh = {
     .render_quote = render_quote_sh,
 };
 
-static va_quotation_t const *va_quote[VA_MASK(VA_OPT_QUOTE) + 1] = {
+/* the global quotation methods: published atomically */
+static _Atomic(va_quotation_t const *) va_quote[VA_MASK(VA_OPT_QUOTE) + 1] = {
     [VA_QUOTE_q] = &quote_c,
     [VA_QUOTE_Q] = &quote_j,
     [VA_QUOTE_k] = &quote_sh,
 };
 
+/* the quotation methods of the thread, or NULL for the global ones */
+static _Thread_local va_quotations_t const *va_quote_thread;
+
 extern va_quotation_t const *va_quotation_set(
     unsigned which,
     va_quotation_t const *quotation)
 {
     which &= VA_MASK(VA_OPT_QUOTE);
-    va_quotation_t const *old = va_quote[which];
-    va_quote[which] = quotation;
+    return atomic_exchange_explicit(&va_quote[which], quotation, memory_order_acq_rel);
+}
+
+extern void va_quotations_init(
+    va_quotations_t *set)
+{
+    for (unsigned i = 0; i <= VA_MASK(VA_OPT_QUOTE); i++) {
+        set->q[i] = atomic_load_explicit(&va_quote[i], memory_order_acquire);
+    }
+}
+
+extern va_quotations_t const *va_quotations_thread(
+    va_quotations_t const *set)
+{
+    va_quotations_t const *old = va_quote_thread;
+    va_quote_thread = set;
     return old;
 }
 
+/**
+ * The quotation method selected in the stream options, or NULL.  This
+ * is looked up once per string.
+ */
+static va_quotation_t const *quotation_get(
+    va_stream_t const *s)
+{
+    unsigned which = VA_BGET(s->opt, VA_OPT_QUOTE);
+    if (s->quote != NULL) {
+        return s->quote->q[which];
+    }
+    va_quotations_t const *t = va_quote_thread;
+    if (t != NULL) {
+        return t->q[which];
+    }
+    return atomic_load_explicit(&va_quote[which], memory_order_acquire);
+}
+
+/**
+ * Render a character of a quotation with a class table.
+ */
+static void render_quote_table(
+    va_quotation_t const *q,
+    va_stream_t *s,
+    unsigned c)
+{
+    unsigned k = (c < 0x80) ? q->table->cls[c] : VA_QCLASS_CALL;
+    if (k <= VA_QCLASS_QUOTE) {
+        render(s, c);
+        return;
+    }
+    if (k == VA_QCLASS_CALL) {
+        if (q->render_quote != NULL) {
+            return q->render_quote(s, c);
+        }
+        va_stream_render(s, c);
+        return;
+    }
+    for (char const *e = q->table->esc[k - VA_QCLASS_ESC(0)]; *e != 0; e++) {
+        render(s, (unsigned char)*e);
+    }
+}
+
+/**
+ * Check whether a character causes quotation in a quotation with a
+ * class table.
+ */
+static bool check_quote_table(
+    va_quotation_t const *q,
+    va_stream_t *s,
+    unsigned c)
+{
+    s->qctxt = 1; /* the string is not empty */
+    if (c < 0x80) {
+        return q->table->cls[c] != VA_QCLASS_PLAIN;
+    }
+    return (q->check_quote != NULL) && q->check_quote(s, c);
+}
+
+static bool check_quote_put(
+    va_quotation_t const *q,
+    va_stream_t *s,
+    unsigned c)
+{
+    if (q->table != NULL) {
+        return check_quote_table(q, s, c);
+    }
+    VA_POSSIBLE_CALL("check_quote_sh");
+    return q->check_quote(s, c);
+}
+
 static void render_quote_put(
+    va_quotation_t const *q,
     va_stream_t *s,
     unsigned c)
 {
-    va_quotation_t const *q = va_quote[VA_BGET(s->opt, VA_OPT_QUOTE)];
     if (q != NULL) {
+        if (q->table != NULL) {
+            return render_quote_table(q, s, c);
+        }
         VA_POSSIBLE_CALL("render_quote_c");
         VA_POSSIBLE_CALL("render_quote_j");
         VA_POSSIBLE_CALL("render_quote_sh");
@@ -298,14 +528,79 @@ static void render_quote_put(
 }
 
 static void render_quote_flush(
+    va_quotation_t const *q,
     va_stream_t *s)
 {
-    va_quotation_t const *q = va_quote[VA_BGET(s->opt, VA_OPT_QUOTE)];
     if ((q != NULL) && (q->render_flush != NULL)) {
         return q->render_flush(s);
     }
 }
 
+/**
+ * Number of code points that are rendered ahead to compute the padding
+ * of right-justified strings, so that they need not be rendered again.
+ */
+#define AHEAD_SIZE 64
+
+/**
+ * A stream that renders ahead: it has the state of the stream it was
+ * started from, but collects the code points in 'buf'.  If there are
+ * more than AHEAD_SIZE, 'n' is set beyond that and the rest is only
+ * measured.
+ */
+typedef struct {
+    va_stream_t s;
+    size_t n;
+    unsigned buf[AHEAD_SIZE];
+} stream_ahead_t;
+
+static void ahead_put(va_stream_t *s_, unsigned c)
+{
+    stream_ahead_t *s = (stream_ahead_t*)s_;
+    if (s->n >= AHEAD_SIZE) {
+        s->n = AHEAD_SIZE + 1;
+        s->s.opt |= VA_OPT_SIM;
+        return;
+    }
+    s->buf[s->n++] = c;
+}
+
+static va_stream_vtab_t const ahead_vtab = {
+    .put = ahead_put,
+};
+
+static void ahead_start(stream_ahead_t *a, va_stream_t *s)
+{
+    a->s = *s;
+    a->s.vtab = &ahead_vtab;
+    a->s.win = (va_window_t){ NULL, NULL };
+    /* if nothing is output, there is nothing to collect */
+    a->n = ((s->opt & VA_OPT_SIM) != 0) ? AHEAD_SIZE + 1 : 0;
+}
+
+/**
+ * Take back the state from the stream that rendered ahead and write
+ * the padding.  Returns whether all output was collected, so that
+ * ahead_replay() can be used instead of rendering it again.
+ */
+static bool ahead_end(stream_ahead_t *a, va_stream_t *s)
+{
+    unsigned sim = s->opt & VA_OPT_SIM;
+    s->opt = a->s.opt;
+    VA_MSET_IF(s->opt, VA_OPT_SIM, sim != 0);
+    s->qctxt = a->s.qctxt;
+    s->width = a->s.width;
+    render_fill(s, ' ', s->width);
+    return a->n <= AHEAD_SIZE;
+}
+
+static void ahead_replay(stream_ahead_t const *a, va_stream_t *s)
+{
+    for (size_t i = 0; i < a->n; i++) {
+        render(s, a->buf[i]);
+    }
+}
+
 static void render_int(
     va_stream_t *s,
     unsigned long long x,
@@ -322,34 +617,586 @@ static void render_rawstr(va_stream_t *s, char const *start)
             s->width--;
         }
 
-        /* space */
-        while (s->width > 0) {
-            render(s, ' ');
+        /* space */
+        render_fill(s, ' ', s->width);
+    }
+
+    /* meat */
+    for(char const *cur = start; (*cur != 0); cur++) {
+        render(s, (unsigned char)*cur);
+    }
+
+    /* space */
+    render_fill(s, ' ', s->width);
+}
+
+/**
+ * Render a run of ASCII characters.  If the stream has a known
+ * encoding, the run is stored into the output window at once.
+ */
+static void render_ascii(va_stream_t *s, char const *p, size_t n)
+{
+    s->width = (n < s->width) ? s->width - (unsigned)n : 0;
+    if (((s->opt & VA_OPT_SIM) != 0) || (n == 0)) {
+        return;
+    }
+    if (s->vtab->put_len != NULL) {
+        s->vtab->put_len(s, n);
+        return;
+    }
+    switch (s->vtab->enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8):
+        if (va_stream_reserve(s, n)) {
+            memcpy(s->win.cur, p, n);
+            s->win.cur = (char*)s->win.cur + n;
+            return;
+        }
+        break;
+
+    case VA_ENC_TAG(VA_U_ENC_UTF16):
+        if (va_stream_reserve(s, n * sizeof(char16_t))) {
+            char16_t *w = s->win.cur;
+            for (size_t i = 0; i < n; i++) {
+                *w++ = (unsigned char)p[i];
+            }
+            s->win.cur = w;
+            return;
+        }
+        break;
+
+    case VA_ENC_TAG(VA_U_ENC_UTF32):
+        if (va_stream_reserve(s, n * sizeof(char32_t))) {
+            char32_t *w = s->win.cur;
+            for (size_t i = 0; i < n; i++) {
+                *w++ = (unsigned char)p[i];
+            }
+            s->win.cur = w;
+            return;
+        }
+        break;
+    }
+    for (size_t i = 0; i < n; i++) {
+        s->vtab->put(s, (unsigned char)p[i]);
+    }
+}
+
+static void render_ptr(va_stream_t *s, void const *x)
+{
+    if (VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_TYPE) {
+        render_rawstr(s, "void*");
+        return;
+    }
+    if (VA_BGET(s->opt, VA_OPT_QUOTE) != 0) {
+        s->opt |= VA_OPT_VAR;
+    }
+    render_int(s, (size_t)x, 16, 0);
+    return;
+}
+
+static void iter_skip(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    size_t n,
+    size_t cps)
+{
+    iter->cur = (char const *)iter->cur + (n << (iter->vtab->enc - 1));
+    s->width = (cps < s->width) ? s->width - (unsigned)cps : 0;
+    VA_BSET(s->opt, VA_OPT_EMORE, 0);
+}
+
+/**
+ * Make sure that the output window has room for 'need' bytes, but only
+ * if there is valid input left for the bulk functions, so that a
+ * string that exactly fits does not make the stream grow.
+ */
+static bool iter_reserve_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *end,
+    size_t need)
+{
+    if (va_stream_room(s) >= need) {
+        return true;
+    }
+    size_t cps;
+    /* any code point has at most 4 code units */
+    if (iter->vtab->bulk(iter, end, 4, &cps) == 0) {
+        return false;
+    }
+    return va_stream_reserve(s, need);
+}
+
+/**
+ * Count the valid prefix of the string against the width, without
+ * decoding code point by code point.  Only for strings without
+ * quotation.
+ */
+static void iter_count_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *end)
+{
+    if (iter->cur == NULL) {
+        return;
+    }
+    size_t cps;
+    size_t n = iter->vtab->bulk(iter, end, s->width, &cps);
+    iter_skip(s, iter, n, cps);
+}
+
+/**
+ * Same encoding pass-through: copy the valid prefix of the string
+ * into the stream's output window as is.  Only for strings without
+ * quotation.  Stops at invalid or incomplete sequences, NUL, and if the
+ * window cannot be refilled, so that the code point by code point
+ * rendering takes over in these cases.
+ */
+static void iter_copy_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *end)
+{
+    if (iter->cur == NULL) {
+        return;
+    }
+    unsigned shift = iter->vtab->enc - 1U;
+    /* at least one code unit: bulk() only takes whole code points */
+    while (iter_reserve_bulk(s, iter, end, 1U << shift)) {
+        size_t cps;
+        size_t n = iter->vtab->bulk(iter, end, va_stream_room(s) >> shift, &cps);
+        if (n == 0) {
+            return;
+        }
+        memcpy(s->win.cur, iter->cur, n << shift);
+        s->win.cur = (char*)s->win.cur + (n << shift);
+        iter_skip(s, iter, n, cps);
+        if (va_stream_room(s) >= 4) {
+            /* not stopped by the window size */
+            return;
+        }
+    }
+}
+
+/**
+ * Length-only pass-through: add the encoded length of the valid prefix
+ * of the string to a sizing stream, see va_stream_vtab_t::put_len.
+ * Like iter_copy_bulk(), but nothing is stored.
+ */
+static void iter_len_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *end)
+{
+    if (iter->cur == NULL) {
+        return;
+    }
+    size_t cps;
+    size_t n = iter->vtab->bulk(iter, end, -(size_t)1, &cps);
+    if (n == 0) {
+        return;
+    }
+    size_t k = n;
+    if (iter->vtab->enc != s->vtab->enc) {
+        k = iter->vtab->transcode(NULL, s->vtab->enc, iter->cur, n) >>
+            (s->vtab->enc - 1);
+    }
+    s->vtab->put_len(s, k);
+    iter_skip(s, iter, n, cps);
+}
+
+/**
+ * Transcoding pass-through: convert the valid prefix of the string
+ * directly into the stream's output window.  Like iter_copy_bulk(),
+ * but for strings in a different encoding.
+ */
+static void iter_transcode_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *end)
+{
+    if (iter->cur == NULL) {
+        return;
+    }
+    /* a source code unit makes at most 4 bytes: with less room, the
+     * code point by code point rendering fills the rest of the window */
+    while (iter_reserve_bulk(s, iter, end, 1)) {
+        size_t max = va_stream_room(s) / 4;
+        if (max == 0) {
+            return;
+        }
+        size_t cps;
+        size_t n = iter->vtab->bulk(iter, end, max, &cps);
+        if (n == 0) {
+            return;
+        }
+        size_t k = iter->vtab->transcode(s->win.cur, s->vtab->enc, iter->cur, n);
+        if (k == 0) {
+            return;
+        }
+        s->win.cur = (char*)s->win.cur + k;
+        iter_skip(s, iter, n, cps);
+        if (n < max) {
+            /* not stopped by the window size */
+            return;
+        }
+    }
+}
+
+/*
+ * Plain runs of quoted strings: the built-in quotations and those with
+ * a class table leave most characters as they are, so runs of such
+ * characters are found by scanning and then output in bulk.  The kinds
+ * of runs are:
+ */
+#define PLAIN_NONE       0 /* user-defined quotation: no runs */
+#define PLAIN_QUOTE      1 /* render_quote_c(), render_quote_j() */
+#define PLAIN_QUOTE_7BIT 2 /* the same with the '0' flag */
+#define PLAIN_SH         3 /* render_quote_sh() */
+#define PLAIN_SH_CHECK   4 /* check_quote_sh() returns false */
+#define PLAIN_TABLE      5 /* class table: class <= 'max' */
+
+typedef struct {
+    /** PLAIN_TABLE: the class table */
+    unsigned char const *cls;
+    unsigned kind;
+    /** PLAIN_TABLE: the highest class of plain ASCII units */
+    unsigned char max;
+    /** PLAIN_TABLE: whether non-ASCII units are plain */
+    bool other;
+    unsigned char _pad[2];
+} plain_t;
+
+#if defined(__AVX2__)
+#define PLAIN_BLOCK 32U
+#define VEC_T             __m256i
+#define VEC_LOAD(P)       _mm256_loadu_si256((void const *)(P))
+#define VEC_SET1(C)       _mm256_set1_epi8((char)(C))
+#define VEC_EQ(A,B)       _mm256_cmpeq_epi8(A,B)
+#define VEC_GT(A,B)       _mm256_cmpgt_epi8(A,B)
+#define VEC_OR(A,B)       _mm256_or_si256(A,B)
+#define VEC_AND(A,B)      _mm256_and_si256(A,B)
+#define VEC_ANDNOT(A,B)   _mm256_andnot_si256(A,B)
+#define VEC_MASK(A)       ((unsigned)_mm256_movemask_epi8(A))
+#elif defined(__SSE2__)
+#define PLAIN_BLOCK 16U
+#define VEC_T             __m128i
+#define VEC_LOAD(P)       _mm_loadu_si128((void const *)(P))
+#define VEC_SET1(C)       _mm_set1_epi8((char)(C))
+#define VEC_EQ(A,B)       _mm_cmpeq_epi8(A,B)
+#define VEC_GT(A,B)       _mm_cmpgt_epi8(A,B)
+#define VEC_OR(A,B)       _mm_or_si128(A,B)
+#define VEC_AND(A,B)      _mm_and_si128(A,B)
+#define VEC_ANDNOT(A,B)   _mm_andnot_si128(A,B)
+#define VEC_MASK(A)       ((unsigned)_mm_movemask_epi8(A))
+#endif
+
+/**
+ * Which runs are output in bulk by the quotation of the stream.
+ */
+static void plain_render(plain_t *pl, va_quotation_t const *q, va_stream_t const *s)
+{
+    *pl = (plain_t){ .kind = PLAIN_NONE };
+    if ((q == &quote_c) || (q == &quote_j)) {
+        pl->kind = ((s->opt & VA_OPT_ZERO) != 0) ? PLAIN_QUOTE_7BIT : PLAIN_QUOTE;
+    }
+    else if (q == &quote_sh) {
+        pl->kind = PLAIN_SH;
+    }
+    else if ((q != NULL) && (q->table != NULL)) {
+        pl->kind = PLAIN_TABLE;
+        pl->cls = q->table->cls;
+        pl->max = VA_QCLASS_QUOTE;
+        pl->other = (q->render_quote == NULL);
+    }
+}
+
+/**
+ * Which runs can be skipped when checking whether the quotation 'q'
+ * is needed.
+ */
+static void plain_check(plain_t *pl, va_quotation_t const *q)
+{
+    *pl = (plain_t){ .kind = PLAIN_NONE };
+    if (q->check_quote == check_quote_sh) {
+        pl->kind = PLAIN_SH_CHECK;
+    }
+    else if (q->table != NULL) {
+        pl->kind = PLAIN_TABLE;
+        pl->cls = q->table->cls;
+        pl->max = VA_QCLASS_PLAIN;
+        pl->other = (q->check_quote == NULL);
+    }
+}
+
+/**
+ * Whether the code unit 'c' of a valid string is in a plain run.  This
+ * works for all encodings: units of multi-unit code points are all
+ * plain or all not.
+ */
+__attribute__((always_inline))
+static inline bool plain_unit(plain_t const *pl, unsigned c)
+{
+    switch (pl->kind) {
+    case PLAIN_QUOTE:
+        return (c >= 0x20) && (c != 0x7f) && (c != '"') && (c != '\'') && (c != '\\');
+    case PLAIN_QUOTE_7BIT:
+        return (c >= 0x20) && (c < 0x7f) && (c != '"') && (c != '\'') && (c != '\\');
+    case PLAIN_SH:
+        return (c != '\'');
+    case PLAIN_SH_CHECK:
+        return ((c >= '+') && (c <= '9')) || (c == '_') ||
+            (((c | 0x20) >= 'a') && ((c | 0x20) <= 'z'));
+    case PLAIN_TABLE:
+        return (c < 0x80) ? (pl->cls[c] <= pl->max) : pl->other;
+    }
+    return false;
+}
+
+#ifdef PLAIN_BLOCK
+/**
+ * Bit mask of the bytes of the block 'v' that are not in a plain run.
+ */
+__attribute__((always_inline))
+static inline unsigned plain_block_mask(plain_t const *pl, VEC_T v)
+{
+    unsigned kind = pl->kind;
+    switch (kind) {
+    case PLAIN_QUOTE:
+    case PLAIN_QUOTE_7BIT: {
+        /* signed compare: also true for bytes >= 0x80 */
+        VEC_T x = VEC_GT(VEC_SET1(0x20), v);
+        if (kind == PLAIN_QUOTE) {
+            x = VEC_ANDNOT(VEC_GT(VEC_SET1(0), v), x);
+        }
+        x = VEC_OR(x, VEC_EQ(v, VEC_SET1(0x7f)));
+        x = VEC_OR(x, VEC_EQ(v, VEC_SET1('"')));
+        x = VEC_OR(x, VEC_EQ(v, VEC_SET1('\'')));
+        x = VEC_OR(x, VEC_EQ(v, VEC_SET1('\\')));
+        return VEC_MASK(x);
+    }
+    case PLAIN_SH:
+        return VEC_MASK(VEC_EQ(v, VEC_SET1('\'')));
+    case PLAIN_SH_CHECK: {
+        VEC_T l = VEC_OR(v, VEC_SET1(0x20));
+        VEC_T x = VEC_AND(VEC_GT(v, VEC_SET1('+' - 1)), VEC_GT(VEC_SET1('9' + 1), v));
+        x = VEC_OR(x, VEC_AND(VEC_GT(l, VEC_SET1('a' - 1)), VEC_GT(VEC_SET1('z' + 1), l)));
+        x = VEC_OR(x, VEC_EQ(v, VEC_SET1('_')));
+        return ~VEC_MASK(x) & (unsigned)((1ULL << PLAIN_BLOCK) - 1);
+    }
+    }
+    return 0;
+}
+#endif
+
+/**
+ * Length of the plain run at the start of the 'n' bytes of valid UTF-8
+ * at 'p'.
+ */
+static size_t plain_run_utf8(plain_t const *pl, unsigned char const *p, size_t n)
+{
+    size_t i = 0;
+#ifdef PLAIN_BLOCK
+    /* class tables are looked up unit by unit */
+    for (; (pl->kind != PLAIN_TABLE) && ((n - i) >= PLAIN_BLOCK); i += PLAIN_BLOCK) {
+        unsigned m = plain_block_mask(pl, VEC_LOAD(p + i));
+        if (m != 0) {
+            return i + (size_t)__builtin_ctz(m);
+        }
+    }
+#endif
+    while ((i < n) && plain_unit(pl, p[i])) {
+        i++;
+    }
+    return i;
+}
+
+static size_t plain_run_utf16(plain_t const *pl, char16_t const *p, size_t n)
+{
+    size_t i = 0;
+    while ((i < n) && plain_unit(pl, p[i])) {
+        i++;
+    }
+    return i;
+}
+
+static size_t plain_run_utf32(plain_t const *pl, char32_t const *p, size_t n)
+{
+    size_t i = 0;
+    while ((i < n) && plain_unit(pl, p[i])) {
+        i++;
+    }
+    return i;
+}
+
+/**
+ * Output the plain run of the string from iter->cur up to 'run': in
+ * bulk if the stream has an output window or counts lengths, and code
+ * point by code point otherwise, e.g., if the window is full.
+ */
+static void iter_plain_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *run)
+{
+    if (((s->opt & VA_OPT_SIM) == 0) && (s->vtab->enc != 0)) {
+        if (s->vtab->put_len != NULL) {
+            iter_len_bulk(s, iter, run);
+        }
+        else if (iter->vtab->enc == s->vtab->enc) {
+            iter_copy_bulk(s, iter, run);
+        }
+        else if (iter->vtab->transcode != NULL) {
+            iter_transcode_bulk(s, iter, run);
+        }
+    }
+    switch (iter->vtab->enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8): {
+        unsigned char const *p = iter->cur;
+        while (p < (unsigned char const *)run) {
+            render(s, va_take_utf8(&p));
+        }
+        break;
+    }
+
+    case VA_ENC_TAG(VA_U_ENC_UTF16): {
+        char16_t const *p = iter->cur;
+        while (p < (char16_t const *)run) {
+            render(s, va_take_utf16(&p));
+        }
+        break;
+    }
+
+    case VA_ENC_TAG(VA_U_ENC_UTF32): {
+        char32_t const *p = iter->cur;
+        while (p < (char32_t const *)run) {
+            render(s, *p++);
+        }
+        break;
+    }
+    }
+    iter->cur = run;
+}
+
+/**
+ * Quotation check: skip the plain run of characters that do not cause
+ * quotation.  The string is read in pieces, as the check usually stops
+ * early.
+ */
+static void iter_check_bulk(
+    va_stream_t *s,
+    va_read_iter_t *iter,
+    void const *end,
+    plain_t const *pl)
+{
+    if (iter->cur == NULL) {
+        return;
+    }
+    for (;;) {
+        size_t cps;
+        size_t n = iter->vtab->bulk(iter, end, 256, &cps);
+        size_t m;
+        switch (iter->vtab->enc) {
+        case VA_ENC_TAG(VA_U_ENC_UTF8):
+            m = plain_run_utf8(pl, iter->cur, n);
+            break;
+        case VA_ENC_TAG(VA_U_ENC_UTF16):
+            m = plain_run_utf16(pl, iter->cur, n);
+            break;
+        case VA_ENC_TAG(VA_U_ENC_UTF32):
+            m = plain_run_utf32(pl, iter->cur, n);
+            break;
+        default:
+            return;
+        }
+        if (m > 0) {
+            s->qctxt = 1; /* the string is not empty */
+            iter->cur = (char const *)iter->cur + (m << (iter->vtab->enc - 1));
+            VA_BSET(s->opt, VA_OPT_EMORE, 0);
+        }
+        if ((m < n) || (n == 0)) {
+            return;
+        }
+    }
+}
+
+/**
+ * Quoted strings: decode the valid prefix of the string without the
+ * iterator's 'take' and pass it to the quotation code point by code
+ * point.  The decoding loop is specialised for each encoding.  With
+ * the built-in quotations and class tables, plain runs are output in
+ * bulk.  At most
+ * 'max' code units are read.
+ */
+static void iter_quote_bulk(
+    va_stream_t *s,
+    va_quotation_t const *q,
+    va_read_iter_t *iter,
+    void const *end,
+    size_t max)
+{
+    if (iter->cur == NULL) {
+        return;
+    }
+    size_t cps;
+    size_t n = iter->vtab->bulk(iter, end, max, &cps);
+    if (n == 0) {
+        return;
+    }
+    void const *start = iter->cur;
+    plain_t pl;
+    plain_render(&pl, q, s);
+    size_t m;
+    switch (iter->vtab->enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8): {
+        unsigned char const *p = iter->cur;
+        unsigned char const *e = p + n;
+        while (p < e) {
+            if ((pl.kind != PLAIN_NONE) && ((m = plain_run_utf8(&pl, p, (size_t)(e - p))) > 0)) {
+                iter->cur = p;
+                iter_plain_bulk(s, iter, p + m);
+                p += m;
+                continue;
+            }
+            render_quote_put(q, s, va_take_utf8(&p));
         }
+        break;
     }
 
-    /* meat */
-    for(char const *cur = start; (*cur != 0); cur++) {
-        render(s, (unsigned char)*cur);
+    case VA_ENC_TAG(VA_U_ENC_UTF16): {
+        char16_t const *p = iter->cur;
+        char16_t const *e = p + n;
+        while (p < e) {
+            if ((pl.kind != PLAIN_NONE) && ((m = plain_run_utf16(&pl, p, (size_t)(e - p))) > 0)) {
+                iter->cur = p;
+                iter_plain_bulk(s, iter, p + m);
+                p += m;
+                continue;
+            }
+            render_quote_put(q, s, va_take_utf16(&p));
+        }
+        break;
     }
 
-    /* space */
-    while (s->width > 0) {
-        render(s, ' ');
+    case VA_ENC_TAG(VA_U_ENC_UTF32): {
+        char32_t const *p = iter->cur;
+        char32_t const *e = p + n;
+        while (p < e) {
+            if ((pl.kind != PLAIN_NONE) && ((m = plain_run_utf32(&pl, p, (size_t)(e - p))) > 0)) {
+                iter->cur = p;
+                iter_plain_bulk(s, iter, p + m);
+                p += m;
+                continue;
+            }
+            render_quote_put(q, s, *p++);
+        }
+        break;
     }
-}
 
-static void render_ptr(va_stream_t *s, void const *x)
-{
-    if (VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_TYPE) {
-        render_rawstr(s, "void*");
+    default:
         return;
     }
-    if (VA_BGET(s->opt, VA_OPT_QUOTE) != 0) {
-        s->opt |= VA_OPT_VAR;
-    }
-    render_int(s, (size_t)x, 16, 0);
-    return;
+    iter->cur = (char const *)start + (n << (iter->vtab->enc - 1));
+    VA_BSET(s->opt, VA_OPT_EMORE, 0);
 }
 
 static void render_iter_algo(va_stream_t *s, va_read_iter_t *iter)
@@ -375,18 +1222,28 @@ static void render_iter_algo(va_stream_t *s, va_read_iter_t *iter)
     }
 
     /* quotation marks */
+    va_quotation_t const *q = quotation_get(s);
     unsigned ch;
     unsigned long long delim = 0;
     if ((s->opt & VA_OPT_VAR) == 0) {
-        va_quotation_t const *q = va_quote[VA_BGET(s->opt, VA_OPT_QUOTE)];
         if (q != NULL) {
-            if (q->check_quote == NULL) {
+            if ((q->check_quote == NULL) && (q->table == NULL)) {
                 delim = q->delim[VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_CHAR ? 0 : 1];
             }
             else {
-                for (iter_start(s,iter,start); (ch = iter_take(s,iter,end)) != VA_U_EOT;) {
-                    VA_POSSIBLE_CALL("check_quote_sh");
-                    if (q->check_quote(s, ch)) {
+                plain_t pl;
+                plain_check(&pl, q);
+                bool check_bulk =
+                    (pl.kind != PLAIN_NONE) &&
+                    (iter->vtab->bulk != NULL) && (iter->vtab->enc != 0);
+                for (iter_start(s,iter,start);;) {
+                    if (check_bulk) {
+                        iter_check_bulk(s, iter, end, &pl);
+                    }
+                    if ((ch = iter_take(s,iter,end)) == VA_U_EOT) {
+                        break;
+                    }
+                    if (check_quote_put(q, s, ch)) {
                         delim |= q->delim[VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_CHAR ? 0 : 1];
                         goto done_check_quote;
                     }
@@ -411,41 +1268,110 @@ static void render_iter_algo(va_stream_t *s, va_read_iter_t *iter)
     }
     delim += 0U + !!VA_DELIM_FRONT(delim) + !!VA_DELIM_BACK(delim) + !!VA_DELIM_PREFIX(delim);
 
+    /* without quotation, valid runs need not be decoded */
+    bool bulk =
+        (iter->vtab->bulk != NULL) && (q == NULL);
+    bool out = bulk && ((s->opt & VA_OPT_SIM) == 0);
+    bool copy = out && (iter->vtab->enc != 0) &&
+        (iter->vtab->enc == s->vtab->enc);
+    bool transcode = out && !copy &&
+        (iter->vtab->transcode != NULL) && (s->vtab->enc != 0);
+    bool len = (copy || transcode) && (s->vtab->put_len != NULL);
+    bool quote =
+        (iter->vtab->bulk != NULL) && (iter->vtab->enc != 0) && !bulk &&
+        ((s->opt & VA_OPT_SIM) == 0);
+
     /* reinterpret 'width' into how many spaces are written */
+    stream_ahead_t ahead;
+    bool resume = false;
+    bool at_end = false;
     if ((s->opt & VA_OPT_MINUS) == 0) {
         if (s->width <= VA_DELIM_WIDTH(delim)) {
             s->width = 0;
         }
-        else {
+        else if (bulk) {
             s->width -= VA_DELIM_WIDTH(delim);
+            unsigned sim = s->opt & VA_OPT_SIM;
             s->opt |= VA_OPT_SIM;
             iter_start(s,iter,start);
-            while ((s->width > 0) && ((ch = iter_take(s,iter,end)) != VA_U_EOT)) {
-                render_quote_put(s, ch);
+            while (s->width > 0) {
+                iter_count_bulk(s, iter, end);
+                if (s->width == 0) {
+                    break;
+                }
+                if ((ch = iter_take(s,iter,end)) == VA_U_EOT) {
+                    break;
+                }
+                render_quote_put(q, s, ch);
             }
-            render_quote_flush(s);
-            VA_MCLR(s->opt, VA_OPT_SIM);
+            render_quote_flush(q, s);
+            VA_MSET_IF(s->opt, VA_OPT_SIM, sim != 0);
 
             /* space */
-            while (s->width > 0) {
-                render(s, ' ');
+            render_fill(s, ' ', s->width);
+        }
+        else {
+            /* Decoding and quoting is done once: the output is rendered
+             * ahead until the width is reached, and if it fits into the
+             * buffer, it is replayed and the iteration is resumed. */
+            s->width -= VA_DELIM_WIDTH(delim);
+            ahead_start(&ahead, s);
+            iter_start(&ahead.s,iter,start);
+            while (ahead.s.width > 0) {
+                if (quote) {
+                    /* may render beyond the width: this is replayed */
+                    iter_quote_bulk(&ahead.s, q, iter, end, ahead.s.width);
+                    if (ahead.s.width == 0) {
+                        break;
+                    }
+                }
+                if ((ch = iter_take(&ahead.s,iter,end)) == VA_U_EOT) {
+                    render_quote_flush(q, &ahead.s);
+                    at_end = true;
+                    break;
+                }
+                render_quote_put(q, &ahead.s, ch);
             }
+            resume = ahead_end(&ahead, s);
         }
     }
 
     /* meat */
     render(s, VA_DELIM_PREFIX(delim));
     render(s, VA_DELIM_FRONT(delim));
-    for (iter_start(s,iter,start); (ch = iter_take(s,iter,end)) != VA_U_EOT;) {
-        render_quote_put(s, ch);
+    if (resume) {
+        ahead_replay(&ahead, s);
+        if (at_end) {
+            goto done_meat;
+        }
+    }
+    else {
+        iter_start(s,iter,start);
+    }
+    for (;;) {
+        if (len) {
+            iter_len_bulk(s, iter, end);
+        }
+        else if (copy) {
+            iter_copy_bulk(s, iter, end);
+        }
+        else if (transcode) {
+            iter_transcode_bulk(s, iter, end);
+        }
+        else if (quote) {
+            iter_quote_bulk(s, q, iter, end, -(size_t)1);
+        }
+        if ((ch = iter_take(s,iter,end)) == VA_U_EOT) {
+            break;
+        }
+        render_quote_put(q, s, ch);
     }
-    render_quote_flush(s);
+    render_quote_flush(q, s);
+done_meat:
     render(s, VA_DELIM_BACK(delim));
 
     /* space */
-    while (s->width > 0) {
-        render(s, ' ');
-    }
+    render_fill(s, ' ', s->width);
 }
 
 static void render_iter(va_stream_t *s, va_read_iter_t *iter, void const *start)
@@ -472,7 +1398,7 @@ typedef struct {
 static void custom_needquote(va_stream_t *s_, unsigned c)
 {
     stream_redirect_t *s = (stream_redirect_t*)s_;
-    if (s->q->check_quote(s->dst, c)) {
+    if (check_quote_put(s->q, s->dst, c)) {
         s->info = 1;
     }
 }
@@ -480,7 +1406,7 @@ static void custom_needquote(va_stream_t *s_, unsigned c)
 static void custom_put(va_stream_t *s_, unsigned c)
 {
     stream_redirect_t *s = (stream_redirect_t*)s_;
-    render_quote_put(s->dst, c);
+    render_quote_put(s->q, s->dst, c);
 }
 
 static va_stream_vtab_t custom_needquote_vtab = {
@@ -493,7 +1419,8 @@ static va_stream_vtab_t custom_put_vtab = {
 
 static void render_custom(va_stream_t *s, va_print_t *print)
 {
-    stream_redirect_t s2 = { VA_STREAM(NULL), s, 0, 0 };
+    stream_redirect_t s2 = { VA_STREAM(NULL), s, 0, quotation_get(s) };
+    s2.s.quote = s->quote;
     print->width = s->width;
     print->prec = s->prec;
     print->opt = s->opt;
@@ -503,9 +1430,8 @@ static void render_custom(va_stream_t *s, va_print_t *print)
     /* quotation marks */
     unsigned long long delim = 0;
     if ((s->opt & VA_OPT_VAR) == 0) {
-        s2.q = va_quote[VA_BGET(s->opt, VA_OPT_QUOTE)];
         if (s2.q != NULL) {
-            if (s2.q->check_quote == NULL) {
+            if ((s2.q->check_quote == NULL) && (s2.q->table == NULL)) {
                 delim = s2.q->delim[VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_CHAR ? 0 : 1];
             }
             else {
@@ -525,36 +1451,40 @@ static void render_custom(va_stream_t *s, va_print_t *print)
     s2.s.vtab = &custom_put_vtab;
 
     /* reinterpret 'width' into how many spaces are written */
+    stream_ahead_t ahead;
+    bool replay = false;
     if ((s->opt & VA_OPT_MINUS) == 0) {
         if (s->width <= VA_DELIM_WIDTH(delim)) {
             s->width = 0;
         }
         else {
+            /* the printer is only invoked again if its output does not
+             * fit into the buffer */
             s->width -= VA_DELIM_WIDTH(delim);
-            s->opt |= VA_OPT_SIM;
+            ahead_start(&ahead, s);
+            s2.dst = &ahead.s;
             print->width = s->width;
             print->print(&s2.s, print);
-            render_quote_flush(s);
-            VA_MCLR(s->opt, VA_OPT_SIM);
-
-            /* space */
-            while (s->width > 0) {
-                render(s, ' ');
-            }
+            render_quote_flush(s2.q, &ahead.s);
+            s2.dst = s;
+            replay = ahead_end(&ahead, s);
         }
     }
 
     /* meat */
     render(s, VA_DELIM_FRONT(delim));
-    print->width = s->width;
-    print->print(&s2.s, print);
-    render_quote_flush(s);
+    if (replay) {
+        ahead_replay(&ahead, s);
+    }
+    else {
+        print->width = s->width;
+        print->print(&s2.s, print);
+        render_quote_flush(s2.q, s);
+    }
     render(s, VA_DELIM_BACK(delim));
 
     /* space */
-    while (s->width > 0) {
-        render(s, ' ');
-    }
+    render_fill(s, ' ', s->width);
 }
 
 static inline unsigned get_prec(va_stream_t *s, unsigned def)
@@ -605,17 +1535,51 @@ static void render_int(
         }
     }
 
-    /* compute length */
-    unsigned len = 0;
-    unsigned long long div = 0;
+    /* which set of digits? */
+    char const **digit2 = digit2_std;
+    if ((base <= 32) && (VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_B32)) {
+        digit2 = digit2_b32;
+    }
+    char const *digit = digit2[!!(s->opt & VA_OPT_UPPER)];
+
+    /* convert into buf, backwards from the end */
+    char buf[sizeof(x) * 8];
+    char *end = buf + sizeof(buf);
+    char *cur = end;
     if ((x > 0) || (get_prec(s,1) > 0)) {
-        div = 1;
-        len++;
-        while ((x / div) >= base) {
-            div *= base;
-            len++;
+        if ((base == 10) && (digit2 == digit2_std)) {
+            /* two digits per division by a constant, i.e., multiplication */
+            while (x >= 100) {
+                unsigned i = (unsigned)(x % 100) * 2;
+                x /= 100;
+                *--cur = digit_pair[i + 1];
+                *--cur = digit_pair[i];
+            }
+            if (x >= 10) {
+                unsigned i = (unsigned)x * 2;
+                *--cur = digit_pair[i + 1];
+                *--cur = digit_pair[i];
+            }
+            else {
+                *--cur = digit[x];
+            }
+        }
+        else if ((base & (base - 1)) == 0) {
+            /* 2, 4, 8, 16, 32: shift and mask */
+            unsigned shift = (unsigned)__builtin_ctz(base);
+            do {
+                *--cur = digit[x & (base - 1)];
+                x >>= shift;
+            } while (x > 0);
+        }
+        else {
+            do {
+                *--cur = digit[x % base];
+                x /= base;
+            } while (x > 0);
         }
     }
+    unsigned len = (unsigned)(end - cur);
     unsigned blen = len;
     if (len < get_prec(s,1)) {
         len = get_prec(s,1);
@@ -634,9 +1598,7 @@ static void render_int(
 
     if ((s->opt & VA_OPT_MINUS) == 0) {
         s->width = (s->width > len) ? (s->width - len) : 0;
-        while (s->width > 0) {
-            render(s, ' ');
-        }
+        render_fill(s, ' ', s->width);
     }
 
     if (prefix0) {
@@ -652,25 +1614,11 @@ static void render_int(
         len--;
     }
 
-    while (len > blen) {
-        render(s, '0');
-        len--;
-    }
+    render_fill(s, '0', len - blen);
 
-    /* which set of digits? */
-    char const **digit2 = digit2_std;
-    if ((base <= 32) && (VA_BGET(s->opt, VA_OPT_MODE) == VA_MODE_B32)) {
-        digit2 = digit2_b32;
-    }
-    char const *digit = digit2[!!(s->opt & VA_OPT_UPPER)];
-    while (div > 0) {
-        render(s, (unsigned char)digit[(x / div) % base]);
-        div /= base;
-    }
+    render_ascii(s, cur, blen);
 
-    while (s->width > 0) {
-        render(s, ' ');
-    }
+    render_fill(s, ' ', s->width);
 }
 
 static unsigned arr1_utf64_take(va_read_iter_t *iter, void const *end)
@@ -701,9 +1649,12 @@ static va_read_iter_vtab_t const arr1_vtab_8 = {
     arr1_utf64_take,
     arr1_utf64_end,
     NULL,
+    NULL,
+    NULL,
     true,
     false,
     0,
+    0,
     {0},
 };
 
@@ -712,9 +1663,12 @@ static va_read_iter_vtab_t const arr1_vtab_16 = {
     arr1_utf64_take,
     arr1_utf64_end,
     NULL,
+    NULL,
+    NULL,
     true,
     false,
     'u',
+    0,
     {0},
 };
 
@@ -723,9 +1677,12 @@ static va_read_iter_vtab_t const arr1_vtab_32 = {
     arr1_utf64_take,
     arr1_utf64_end,
     NULL,
+    NULL,
+    NULL,
     true,
     false,
     'U',
+    0,
     {0},
 };
 
@@ -840,13 +1797,91 @@ static unsigned iter_take_pat(va_stream_t *s, va_read_iter_t *iter)
     return iter_take(s, iter, NULL);
 }
 
+/**
+ * The precompiled format that the format iterator reads, or NULL.
+ *
+ * A va_format_t passed as format starts with va_format_read_vtab, and
+ * is switched here to reading its format string. */
+static va_format_t const *format_plan(va_read_iter_t *pat)
+{
+    if (pat->vtab == &va_format_read_vtab) {
+        va_format_t const *f = pat->cur;
+        if (f == NULL) {
+            return NULL;
+        }
+        *pat = VA_READ_ITER(&f->vtab, f->fmt);
+        return f;
+    }
+    if (pat->vtab->type != va_format_type) {
+        return NULL;
+    }
+    return va_boxof(pat->vtab, va_format_t, vtab);
+}
+
+/**
+ * Find the entry at position 'cur' in an array of va_format_lit or
+ * va_format_spec, both of which start with 'at'. */
+static void const *format_find(
+    va_format_t const *f,
+    void const *cur,
+    void const *base,
+    size_t cnt,
+    size_t size)
+{
+    size_t at = (size_t)((char const *)cur - (char const *)f->fmt);
+    size_t lo = 0;
+    while (lo < cnt) {
+        size_t mid = lo + ((cnt - lo) / 2);
+        char const *e = (char const *)base + (mid * size);
+        size_t e_at = *(size_t const *)e;
+        if (e_at == at) {
+            return e;
+        }
+        if (e_at < at) {
+            lo = mid + 1;
+        }
+        else {
+            cnt = mid;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Render a pre-encoded literal run.  Like render() for each of its
+ * code points, but into the output window at once if possible.
+ */
+static void render_lit(va_stream_t *s, struct va_format_lit const *lit)
+{
+    s->width = (lit->cps < s->width) ? s->width - (unsigned)lit->cps : 0;
+    if ((s->opt & VA_OPT_SIM) != 0) {
+        return;
+    }
+    unsigned enc = s->vtab->enc;
+    if ((enc != 0) && (s->vtab->put_len != NULL)) {
+        s->vtab->put_len(s, lit->size[enc] >> (enc - 1));
+        return;
+    }
+    if ((enc != 0) && va_stream_reserve(s, lit->size[enc])) {
+        memcpy(s->win.cur, lit->data[enc], lit->size[enc]);
+        s->win.cur = (char*)s->win.cur + lit->size[enc];
+        return;
+    }
+    char32_t const *u = lit->data[VA_ENC_TAG(VA_U_ENC_UTF32)];
+    for (size_t i = 0; i < lit->cps; i++) {
+        s->vtab->put(s, u[i]);
+    }
+}
+
 /**
  * Returns non-0 iff the same value should be printed again. */
 static unsigned parse_format(va_stream_t *s)
 {
+    va_format_t const *plan = format_plan(&s->pat);
     va_read_iter_t iter[1] = { s->pat };
 
 again:;
+    void const *at = iter->cur;
     unsigned c = iter_take(s, iter, NULL);
     /* stay at end of string, regardless of STATE */
     if ((c == 0) || (c == VA_U_EOT)) {
@@ -859,6 +1894,17 @@ again:;
         s->prec = VA_PREC_NONE;
         s->opt &= VA_OPT_RESET_ARG;
 
+        /* precompiled literal run */
+        if (plan != NULL) {
+            struct va_format_lit const *lit = format_find(
+                plan, at, plan->lit, plan->lit_cnt, sizeof(*lit));
+            if (lit != NULL) {
+                render_lit(s, lit);
+                iter->cur = (char const *)plan->fmt + lit->next;
+                c = iter_take_pat(s, iter);
+            }
+        }
+
         /* print part between format specifiers */
         for (;;) {
             if ((c == 0) || (c == VA_U_EOT)) {
@@ -872,6 +1918,20 @@ again:;
             c = iter_take_pat(s, iter);
         }
 
+        /* precompiled format specifier */
+        if (plan != NULL) {
+            struct va_format_spec const *spec = format_find(
+                plan, s->pat.cur, plan->spec, plan->spec_cnt, sizeof(*spec));
+            if (spec != NULL) {
+                s->opt |= spec->opt;
+                s->width = spec->width;
+                s->prec = spec->prec;
+                iter->cur = (char const *)plan->fmt + spec->next;
+                s->pat = *iter;
+                goto end_of_spec;
+            }
+        }
+
         /* assume default width */
         s->width = VA_WIDTH_NONE;
 
@@ -993,9 +2053,7 @@ end_of_size:
             if (s->width == VA_WIDTH_NONE) {
                 s->width = (s->opt & VA_OPT_ZERO) ? 0 : 1;
             }
-            while (s->width > 0) {
-                render(s, VA_SIGIL);
-            }
+            render_fill(s, VA_SIGIL, s->width);
             goto again;
 
         case 's': case 'S':
@@ -1056,6 +2114,7 @@ end_of_size:
     if (s->width == VA_WIDTH_NONE) {
         s->width = 0;
     }
+end_of_spec:
     assert((VA_BGET(s->opt, VA_OPT_STATE) == VA_STATE_ARG) ||
            (VA_BGET(s->opt, VA_OPT_STATE) == VA_STATE_SKIP));
     /* if there is a '=' option, repeat printing */
@@ -1106,12 +2165,21 @@ static bool set_ast(va_stream_t *s, long long x)
     return 1;
 }
 
-static void ensure_init(va_stream_t *s)
+static void ensure_init_stream(va_stream_t *s)
 {
-    /* init */
-    if (s->vtab->init != NULL) {
-        s->vtab->init(s);
+    /* init, once per print call */
+    if ((s->opt & VA_OPT_INIT) == 0) {
+        s->opt |= VA_OPT_INIT;
+        VA_MCLR(s->opt, VA_OPT_SIM);
+        if (s->vtab->init != NULL) {
+            s->vtab->init(s);
+        }
     }
+}
+
+static void ensure_init(va_stream_t *s)
+{
+    ensure_init_stream(s);
 
     /* first format */
     if (VA_BGET(s->opt, VA_OPT_STATE) == VA_STATE_INIT) {
@@ -1119,18 +2187,41 @@ static void ensure_init(va_stream_t *s)
     }
 }
 
-#define RENDER_LOOP(s, astval, render) \
+static void finish(va_stream_t *s)
+{
+    if ((s->opt & VA_OPT_INIT) == 0) {
+        return;
+    }
+    VA_MCLR(s->opt, VA_OPT_INIT);
+    if (s->vtab->finish != NULL) {
+        s->vtab->finish(s);
+    }
+}
+
+/* VA_OPT_LAST is reset by parse_format(), so it is checked before.
+ * If the stream is full, rendering is skipped, unless 'always' is set
+ * because rendering has side effects, like advancing an iterator. */
+#define RENDER_LOOP_X(s, astval, render, always) \
     do{ \
+        bool last = !!(s->opt & VA_OPT_LAST); \
         ensure_init(s); \
         unsigned u; \
         do { \
-            if (set_ast(s, astval)) { \
+            if (set_ast(s, astval) && \
+                ((always) || ((s->opt & VA_OPT_SIM) == 0))) \
+            { \
                 render; \
             } \
             while ((u = parse_format(s)) >= 2) {} \
         } while (u); \
+        if (last) { \
+            finish(s); \
+        } \
     }while(0)
 
+#define RENDER_LOOP(s, astval, render) \
+    RENDER_LOOP_X(s, astval, render, false)
+
 static va_stream_t *xprintf_sll(va_stream_t *s, long long x, unsigned sz)
 {
     RENDER_LOOP(s, x, render_sll(s, x, sz));
@@ -1149,12 +2240,184 @@ static va_stream_t *xprintf_bool(va_stream_t *s, unsigned long long x)
     return s;
 }
 
+/* precompiled formats */
+
+static void format_scratch_put(va_stream_t *s, unsigned c)
+{
+    (void)s;
+    (void)c;
+}
+
+static va_stream_vtab_t const format_scratch_vtab = {
+    .put = format_scratch_put,
+};
+
+/**
+ * State of scanning a format string for precompilation.  With 'lit'
+ * and 'spec' set to NULL, this only counts entries and pool sizes.
+ */
+typedef struct {
+    void const *x;
+    va_read_iter_vtab_t const *vtab;
+    struct va_format_lit *lit;
+    struct va_format_spec *spec;
+    char *pool[4];
+    size_t lit_cnt;
+    size_t spec_cnt;
+    size_t size[4];
+} format_scan_t;
+
+/**
+ * Literal run at position 'at' up to the next sigil or end.  Runs
+ * with decoding errors are left to parse_format(), because of the
+ * error bookkeeping in iter_take().
+ */
+static void format_scan_lit(format_scan_t *t, size_t at)
+{
+    char const *start = (char const *)t->x + at;
+    va_read_iter_t iter = VA_READ_ITER(t->vtab, start);
+    size_t size[4] = { 0 };
+    size_t cps = 0;
+    for (;;) {
+        void const *cur = iter.cur;
+        unsigned c = t->vtab->take(&iter, NULL);
+        if ((c == 0) || (c == VA_U_EOT) || (c == VA_SIGIL)) {
+            iter.cur = cur;
+            break;
+        }
+        if ((c & VA_U_ENC) != 0) {
+            return;
+        }
+        cps++;
+        size[VA_ENC_TAG(VA_U_ENC_UTF8)] +=
+            (c < 0x80) ? 1 : (c < 0x800) ? 2 : (c < 0x10000) ? 3 : 4;
+        size[VA_ENC_TAG(VA_U_ENC_UTF16)] += (c < 0x10000) ? 2 : 4;
+        size[VA_ENC_TAG(VA_U_ENC_UTF32)] += 4;
+    }
+    if (cps == 0) {
+        return;
+    }
+
+    if (t->lit != NULL) {
+        struct va_format_lit *lit = &t->lit[t->lit_cnt];
+        lit->at = at;
+        lit->next = (size_t)((char const *)iter.cur - (char const *)t->x);
+        lit->cps = cps;
+        for (unsigned e = 1; e < 4; e++) {
+            lit->data[e] = t->pool[e];
+            lit->size[e] = size[e];
+        }
+        char *w8 = t->pool[VA_ENC_TAG(VA_U_ENC_UTF8)];
+        char16_t *w16 = (char16_t *)t->pool[VA_ENC_TAG(VA_U_ENC_UTF16)];
+        char32_t *w32 = (char32_t *)t->pool[VA_ENC_TAG(VA_U_ENC_UTF32)];
+        iter.cur = start;
+        for (size_t i = 0; i < cps; i++) {
+            unsigned c = t->vtab->take(&iter, NULL);
+            w8 = va_store_utf8(w8, c);
+            w16 = va_store_utf16(w16, c);
+            *w32++ = c;
+        }
+        for (unsigned e = 1; e < 4; e++) {
+            t->pool[e] += size[e];
+        }
+    }
+    t->lit_cnt++;
+    for (unsigned e = 1; e < 4; e++) {
+        t->size[e] += size[e];
+    }
+}
+
+/**
+ * Format specifier at position 'at', right after the sigil at 'sigil'.
+ * This runs parse_format() on a scratch stream to get the settings,
+ * and only keeps specifiers that are parsed completely without errors,
+ * i.e., no '*', no '~~', and no VA_E_FORMAT.  Returns the position
+ * after the specifier, or 0 if it was not kept.
+ */
+static size_t format_scan_spec(format_scan_t *t, size_t sigil, size_t at)
+{
+    va_stream_t s = VA_STREAM(&format_scratch_vtab);
+    s.pat = VA_READ_ITER(t->vtab, (char const *)t->x + sigil);
+    (void)parse_format(&s);
+    if ((VA_BGET(s.opt, VA_OPT_STATE) != VA_STATE_ARG) ||
+        (VA_BGET(s.opt, VA_OPT_ERR) != 0))
+    {
+        return 0;
+    }
+
+    /* a sigil inside means that '~~' was printed and parsing went on */
+    va_read_iter_t iter = VA_READ_ITER(t->vtab, (char const *)t->x + at);
+    while (iter.cur != s.pat.cur) {
+        if (t->vtab->take(&iter, NULL) == VA_SIGIL) {
+            return 0;
+        }
+    }
+
+    size_t next = (size_t)((char const *)s.pat.cur - (char const *)t->x);
+    if (t->spec != NULL) {
+        struct va_format_spec *spec = &t->spec[t->spec_cnt];
+        spec->at = at;
+        spec->next = next;
+        spec->opt = s.opt;
+        spec->width = s.width;
+        spec->prec = s.prec;
+    }
+    t->spec_cnt++;
+    return next;
+}
+
+/**
+ * Scan the format string for literal runs and specifiers.  Literal
+ * runs are tried at the start, after specifiers, and after '~~';
+ * specifiers after an odd number of sigils.  Entries are found by
+ * position only, so an entry that is never reached does no harm.
+ */
+static void format_scan(format_scan_t *t)
+{
+    va_read_iter_t iter = VA_READ_ITER(t->vtab, t->x);
+    size_t spec_end = 0;
+    size_t prev = 0;
+    unsigned sigils = 0;
+    for (;;) {
+        size_t at = (size_t)((char const *)iter.cur - (char const *)t->x);
+        if ((at == spec_end) || ((sigils > 0) && ((sigils & 1) == 0))) {
+            format_scan_lit(t, at);
+        }
+        if ((sigils & 1) != 0) {
+            size_t next = format_scan_spec(t, prev, at);
+            if (next != 0) {
+                spec_end = next;
+            }
+        }
+        unsigned c = t->vtab->take(&iter, NULL);
+        if ((c == 0) || (c == VA_U_EOT)) {
+            break;
+        }
+        sigils = (c == VA_SIGIL) ? sigils + 1 : 0;
+        prev = at;
+    }
+}
+
+static size_t align4(size_t x)
+{
+    return (x + 3) & ~(size_t)3;
+}
+
 /* ********************************************************************** */
 /* extern functions */
 
 extern va_stream_t *va_xprintf_iter(
     va_stream_t *s,
     va_read_iter_t *x)
+{
+    void const *start = x->cur;
+    RENDER_LOOP_X(s, 0, render_iter(s, x, start), true);
+    return s;
+}
+
+extern va_stream_t *va_xprintf_iter_local(
+    va_stream_t *s,
+    va_read_iter_t *x)
 {
     void const *start = x->cur;
     RENDER_LOOP(s, 0, render_iter(s, x, start));
@@ -1255,14 +2518,19 @@ extern unsigned va_stream_get_error_f(va_stream_t const *s)
     return VA_BGET(s->opt, VA_OPT_ERR);
 }
 
-extern va_stream_t *va_xprintf_error_t_p(va_stream_t *s, va_error_t *x)
+static va_stream_t *take_error(va_stream_t *s, va_error_t *x)
 {
-    ensure_init(s);
     x->code = VA_BGET(s->opt, VA_OPT_ERR);
     VA_BSET(s->opt, VA_OPT_ERR, 0);
     return s;
 }
 
+extern va_stream_t *va_xprintf_error_t_p(va_stream_t *s, va_error_t *x)
+{
+    ensure_init(s);
+    return take_error(s, x);
+}
+
 extern va_stream_t *va_xprintf_last_schar(va_stream_t *s, signed char x)
 {
     s->opt |= VA_OPT_LAST;
@@ -1362,7 +2630,8 @@ extern va_stream_t *va_xprintf_last_error_t_p(va_stream_t *s, va_error_t *x)
     }
     s->opt |= VA_OPT_LAST;
     while (parse_format(s) >= 2) {}
-    return va_xprintf_error_t_p(s,x);
+    finish(s);
+    return take_error(s,x);
 }
 
 extern va_stream_t *va_xprintf_init_last(
@@ -1374,9 +2643,108 @@ extern va_stream_t *va_xprintf_init_last(
     ensure_init(s);
     s->opt |= VA_OPT_LAST;
     while (parse_format(s) >= 2) {}
+    finish(s);
     return s;
 }
 
+extern va_format_t *va_format_compile_f(
+    void *(*alloc)(void *, size_t nmemb, size_t size),
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab)
+{
+    if ((x == NULL) || (get_vtab->take == NULL)) {
+        return NULL;
+    }
+
+    /* count */
+    format_scan_t t = { .x = x, .vtab = get_vtab };
+    format_scan(&t);
+
+    va_read_iter_t iter = VA_READ_ITER(get_vtab, x);
+    while (true) {
+        unsigned c = get_vtab->take(&iter, NULL);
+        if ((c == 0) || (c == VA_U_EOT)) {
+            break;
+        }
+    }
+    size_t unit = (get_vtab->enc == 0) ? 1 : (1U << (get_vtab->enc - 1));
+    size_t fmt_len = (size_t)((char const *)iter.cur - (char const *)x);
+
+    /* one block: header, entries, UTF-32, format string, UTF-16, UTF-8 */
+    size_t off_lit  = sizeof(va_format_t);
+    size_t off_spec = off_lit  + (t.lit_cnt * sizeof(struct va_format_lit));
+    size_t off32    = off_spec + (t.spec_cnt * sizeof(struct va_format_spec));
+    size_t off_fmt  = off32    + t.size[VA_ENC_TAG(VA_U_ENC_UTF32)];
+    size_t off16    = align4(off_fmt + fmt_len + unit);
+    size_t off8     = off16    + t.size[VA_ENC_TAG(VA_U_ENC_UTF16)];
+    size_t total    = off8     + t.size[VA_ENC_TAG(VA_U_ENC_UTF8)];
+    char *p = alloc(NULL, total, 1);
+    if (p == NULL) {
+        return NULL;
+    }
+
+    va_format_t *f = (va_format_t *)p;
+    f->vtab = *get_vtab;
+    f->vtab.type = va_format_type;
+    memcpy(p + off_fmt, x, fmt_len);
+    memset(p + off_fmt + fmt_len, 0, unit);
+    f->fmt = p + off_fmt;
+    f->alloc = alloc;
+
+    /* fill */
+    t = (format_scan_t){
+        .x = x,
+        .vtab = get_vtab,
+        .lit = (struct va_format_lit *)(p + off_lit),
+        .spec = (struct va_format_spec *)(p + off_spec),
+        .pool = { NULL, p + off8, p + off16, p + off32 },
+    };
+    format_scan(&t);
+    f->lit = t.lit;
+    f->lit_cnt = t.lit_cnt;
+    f->spec = t.spec;
+    f->spec_cnt = t.spec_cnt;
+    return f;
+}
+
+extern void va_format_free(va_format_t *f)
+{
+    if (f != NULL) {
+        f->alloc(f, 0, 1);
+    }
+}
+
+extern va_stream_t *va_xprintf_init_last_plain(
+    va_stream_t *s,
+    void const *x,
+    va_read_iter_vtab_t const *get_vtab)
+{
+    va_xprintf_init(s, x, get_vtab);
+    ensure_init_stream(s);
+    if ((VA_BGET(s->opt, VA_OPT_STATE) == VA_STATE_INIT) &&
+        (s->pat.vtab->bulk != NULL) &&
+        (s->vtab->enc != 0))
+    {
+        if ((s->vtab->put_len != NULL) &&
+            ((s->vtab->enc == s->pat.vtab->enc) ||
+             (s->pat.vtab->transcode != NULL)))
+        {
+            iter_len_bulk(s, &s->pat, NULL);
+        }
+        else
+        if (s->vtab->enc == s->pat.vtab->enc) {
+            iter_copy_bulk(s, &s->pat, NULL);
+        }
+        else
+        if (s->pat.vtab->transcode != NULL) {
+            iter_transcode_bulk(s, &s->pat, NULL);
+        }
+    }
+
+    /* whatever is left, e.g., encoding errors */
+    return va_xprintf_init_last(s, s->pat.cur, get_vtab);
+}
+
 extern char const *va_strerror(unsigned u)
 {
     static char const *const name[] = {
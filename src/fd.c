@@ -2,17 +2,210 @@
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
 #include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
 #include <assert.h>
 #include "va_print/fd.h"
 #include "va_print/impl.h"
 
+#ifndef PIPE_BUF
+#define PIPE_BUF 512
+#endif
+
+/* ********************************************************************** */
+/* static functions */
+
+static bool fd_write(va_stream_fd_t *t, char const *p, size_t n)
+{
+    while (n > 0) {
+        ssize_t k = write((int)t->fd, p, n);
+        if (k < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (k == 0) {
+            return false;
+        }
+        p += k;
+        n -= (size_t)k;
+    }
+    return true;
+}
+
+/**
+ * Take over what was written into the output window.  The window only
+ * ever receives whole code points.
+ */
+static void fd_commit(va_stream_fd_t *t)
+{
+    if (t->s.win.cur != NULL) {
+        t->pos = (size_t)((char*)t->s.win.cur - t->data);
+        t->mark = t->pos;
+        t->s.win = (va_window_t){ NULL, NULL };
+    }
+}
+
+/**
+ * Write the first n bytes of the buffer and move the rest to the front.
+ */
+static void fd_flush_head(va_stream_fd_t *t, size_t n)
+{
+    if (n == 0) {
+        return;
+    }
+    assert(n <= t->pos);
+    if (!fd_write(t, t->data, n)) {
+        va_stream_set_error(&t->s, VA_E_TRUNC);
+    }
+    t->pos -= n;
+    memmove(t->data, t->data + n, t->pos);
+    t->mark = 0;
+}
+
+/**
+ * The number of bytes collected before writing: the whole buffer, but
+ * for 'autoflush' streams, at most PIPE_BUF, because larger writes are
+ * not atomic on pipes.
+ */
+static size_t fd_cap(va_stream_fd_t const *t)
+{
+    if (!t->autoflush) {
+        return t->size;
+    }
+    return t->size < PIPE_BUF ? t->size : PIPE_BUF;
+}
+
 /* ********************************************************************** */
 /* extern functions */
 
-extern void va_fd_put(va_stream_t *s, char c)
+extern void va_fd_flush(va_stream_fd_t *t)
+{
+    fd_commit(t);
+    fd_flush_head(t, t->pos);
+}
+
+extern void va_fd_finish(va_stream_t *s)
 {
     va_stream_fd_t *t = (va_stream_fd_t*)s;
-    if (write((int)t->fd, &c, 1) != 1) {
-        va_stream_set_error(&t->s, VA_E_TRUNC);
+    if (t->autoflush) {
+        va_fd_flush(t);
     }
 }
+
+extern void va_fd_write(va_stream_t *s, void const *x, size_t n)
+{
+    va_stream_fd_t *t = (va_stream_fd_t*)s;
+    fd_commit(t);
+    size_t cap = fd_cap(t);
+    if ((t->pos + n) > cap) {
+        /* keep an incomplete code point for the next write */
+        fd_flush_head(t, t->mark);
+        if ((t->pos + n) > cap) {
+            va_fd_flush(t);
+        }
+    }
+    if ((t->data == NULL) || (n > cap)) {
+        if (!fd_write(t, x, n)) {
+            va_stream_set_error(&t->s, VA_E_TRUNC);
+        }
+        return;
+    }
+    memcpy(t->data + t->pos, x, n);
+    t->pos += n;
+}
+
+extern bool va_fd_refill(va_stream_t *s, size_t need)
+{
+    va_stream_fd_t *t = (va_stream_fd_t*)s;
+    fd_commit(t);
+    if (t->data == NULL) {
+        return false;
+    }
+    size_t cap = fd_cap(t);
+    if ((t->pos + need) > cap) {
+        va_fd_flush(t);
+        if (need > cap) {
+            return false;
+        }
+    }
+    t->s.win = (va_window_t){ t->data + t->pos, t->data + cap };
+    return true;
+}
+
+extern void va_fd_fill(va_stream_t *s, void const *x, size_t k, size_t n)
+{
+    va_stream_fd_t *t = (va_stream_fd_t*)s;
+    fd_commit(t);
+    if (t->data == NULL) {
+        /* unbuffered: write whole code points in chunks */
+        char chunk[64];
+        size_t m = sizeof(chunk) / k;
+        va_fill_pattern(chunk, x, k, (m < n) ? m : n);
+        while (n > 0) {
+            size_t j = (m < n) ? m : n;
+            if (!fd_write(t, chunk, j * k)) {
+                va_stream_set_error(&t->s, VA_E_TRUNC);
+                return;
+            }
+            n -= j;
+        }
+        return;
+    }
+    size_t cap = fd_cap(t);
+    while (n > 0) {
+        size_t j = (cap - t->pos) / k;
+        if (j == 0) {
+            va_fd_flush(t);
+            j = cap / k;
+            if (j == 0) {
+                va_fd_write(s, x, k);
+                n--;
+                continue;
+            }
+        }
+        j = (j < n) ? j : n;
+        va_fill_pattern(t->data + t->pos, x, k, j);
+        t->pos += j * k;
+        t->mark = t->pos;
+        n -= j;
+    }
+}
+
+extern void va_fd_put_whole(
+    va_stream_t *s,
+    unsigned c,
+    void (*put)(va_stream_t *, unsigned))
+{
+    va_stream_fd_t *t = (va_stream_fd_t*)s;
+    if (t->data != NULL) {
+        put(s, c);
+        if (t->s.win.cur == NULL) {
+            /* put() did not use the window */
+            t->mark = t->pos;
+        }
+        return;
+    }
+
+    /* unbuffered: collect the code units of c for a single write() */
+    char x[4];
+    t->data = x;
+    t->size = sizeof(x);
+    put(s, c);
+    va_fd_flush(t);
+    t->data = NULL;
+    t->size = 0;
+}
+
+extern void va_fd_put(va_stream_t *s, char c)
+{
+    va_fd_write(s, &c, 1);
+}
+
+extern void va_fd_put_fill(va_stream_t *s, unsigned c, size_t n)
+{
+    char x = (char)c;
+    va_fd_fill(s, &x, 1, n);
+}
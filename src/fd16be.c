@@ -1,7 +1,6 @@
 /* -*- Mode: C -*- */
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
-#include <unistd.h>
 #include <assert.h>
 #include "va_print/fd.h"
 #include "va_print/impl.h"
@@ -11,11 +10,14 @@
 
 extern void va_fd16_put_be(va_stream_t *s, char16_t c)
 {
-    va_stream_fd_t *t = (va_stream_fd_t*)s;
     unsigned char x[2];
     x[0] = (unsigned char)(c >> 8);
     x[1] = (unsigned char)(c & 0xff);
-    if (write((int)t->fd, &x, 2) != 2) {
-        va_stream_set_error(&t->s, VA_E_TRUNC);
-    }
+    va_fd_write(s, x, 2);
+}
+
+extern void va_fd16_put_fill_be(va_stream_t *s, unsigned c, size_t n)
+{
+    unsigned char x[2] = { 0, (unsigned char)c };
+    va_fd_fill(s, x, 2, n);
 }
@@ -8,14 +8,21 @@
 /* ********************************************************************** */
 /* static functions */
 
-static void va_fd16_put_utf16be(va_stream_t *s, unsigned c)
+static void va_fd16_put_utf16be_encode(va_stream_t *s, unsigned c)
 {
     va_put_utf16(s, c, va_fd16_put_be);
 }
 
+static void va_fd16_put_utf16be(va_stream_t *s, unsigned c)
+{
+    va_fd_put_whole(s, c, va_fd16_put_utf16be_encode);
+}
+
 /* ********************************************************************** */
 /* extern objects */
 
 va_stream_vtab_t const va_fd16_vtab_utf16be = {
-    .put = va_fd16_put_utf16be
+    .put = va_fd16_put_utf16be,
+    .finish = va_fd_finish,
+    .put_fill = va_fd16_put_fill_be,
 };
@@ -8,14 +8,21 @@
 /* ********************************************************************** */
 /* static functions */
 
-static void va_fd16_put_utf16le(va_stream_t *s, unsigned c)
+static void va_fd16_put_utf16le_encode(va_stream_t *s, unsigned c)
 {
     va_put_utf16(s, c, va_fd16_put_le);
 }
 
+static void va_fd16_put_utf16le(va_stream_t *s, unsigned c)
+{
+    va_fd_put_whole(s, c, va_fd16_put_utf16le_encode);
+}
+
 /* ********************************************************************** */
 /* extern objects */
 
 va_stream_vtab_t const va_fd16_vtab_utf16le = {
-    .put = va_fd16_put_utf16le
+    .put = va_fd16_put_utf16le,
+    .finish = va_fd_finish,
+    .put_fill = va_fd16_put_fill_le,
 };
@@ -8,14 +8,21 @@
 /* ********************************************************************** */
 /* static functions */
 
-static void va_fd32_put_utf32be(va_stream_t *s, unsigned c)
+static void va_fd32_put_utf32be_encode(va_stream_t *s, unsigned c)
 {
     va_put_utf32(s, c, va_fd32_put_be);
 }
 
+static void va_fd32_put_utf32be(va_stream_t *s, unsigned c)
+{
+    va_fd_put_whole(s, c, va_fd32_put_utf32be_encode);
+}
+
 /* ********************************************************************** */
 /* extern objects */
 
 va_stream_vtab_t const va_fd32_vtab_utf32be = {
-    .put = va_fd32_put_utf32be
+    .put = va_fd32_put_utf32be,
+    .finish = va_fd_finish,
+    .put_fill = va_fd32_put_fill_be,
 };
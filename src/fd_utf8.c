@@ -8,14 +8,23 @@
 /* ********************************************************************** */
 /* static functions */
 
-static void va_fd_put_utf8(va_stream_t *s, unsigned c)
+static void va_fd_put_utf8_encode(va_stream_t *s, unsigned c)
 {
     va_put_utf8(s, c, va_fd_put);
 }
 
+static void va_fd_put_utf8(va_stream_t *s, unsigned c)
+{
+    va_fd_put_whole(s, c, va_fd_put_utf8_encode);
+}
+
 /* ********************************************************************** */
 /* extern objects */
 
 va_stream_vtab_t const va_fd_vtab_utf8 = {
-    .put = va_fd_put_utf8
+    .put = va_fd_put_utf8,
+    .finish = va_fd_finish,
+    .refill = va_fd_refill,
+    .put_fill = va_fd_put_fill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF8),
 };
@@ -2,17 +2,145 @@
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #include "va_print/file.h"
 #include "va_print/impl.h"
 
+/*
+ * fwrite_unlocked() is a GNU/BSD extension that glibc declares with
+ * _DEFAULT_SOURCE or _GNU_SOURCE.  Elsewhere, plain fwrite() is used.
+ * Define va_fwrite_unlocked to override this choice.
+ */
+#ifndef va_fwrite_unlocked
+#if defined(__GLIBC__) && (defined(_DEFAULT_SOURCE) || defined(_GNU_SOURCE))
+#define va_fwrite_unlocked fwrite_unlocked
+#else
+#define va_fwrite_unlocked fwrite
+#endif
+#endif
+
+/* ********************************************************************** */
+/* static functions */
+
+static void file_commit(va_stream_file_t *t)
+{
+    if (t->s.win.cur != NULL) {
+        t->pos = (size_t)((char*)t->s.win.cur - t->data);
+        t->s.win = (va_window_t){ NULL, NULL };
+    }
+}
+
 /* ********************************************************************** */
 /* extern functions */
 
-extern void va_file_put(va_stream_t *s, char c)
+extern void va_file_init(va_stream_t *s)
 {
     va_stream_file_t *t = (va_stream_file_t*)s;
-    if (fputc(c, t->file) < 0) {
+    flockfile(t->file);
+}
+
+extern void va_file_finish(va_stream_t *s)
+{
+    va_stream_file_t *t = (va_stream_file_t*)s;
+    if (t->autoflush) {
+        va_file_flush(t);
+    }
+    funlockfile(t->file);
+}
+
+extern void va_file_flush(va_stream_file_t *t)
+{
+    file_commit(t);
+    if (t->pos == 0) {
+        return;
+    }
+    /* recursive lock: this is cheap within a print call */
+    flockfile(t->file);
+    if (va_fwrite_unlocked(t->data, 1, t->pos, t->file) != t->pos) {
         va_stream_set_error(&t->s, VA_E_TRUNC);
     }
+    funlockfile(t->file);
+    t->pos = 0;
+}
+
+extern void va_file_write(va_stream_t *s, void const *x, size_t n)
+{
+    va_stream_file_t *t = (va_stream_file_t*)s;
+    file_commit(t);
+    if ((t->pos + n) > t->size) {
+        va_file_flush(t);
+    }
+    if ((t->data == NULL) || (n > t->size)) {
+        if (fwrite(x, 1, n, t->file) != n) {
+            va_stream_set_error(&t->s, VA_E_TRUNC);
+        }
+        return;
+    }
+    memcpy(t->data + t->pos, x, n);
+    t->pos += n;
+}
+
+extern bool va_file_refill(va_stream_t *s, size_t need)
+{
+    va_stream_file_t *t = (va_stream_file_t*)s;
+    file_commit(t);
+    if (t->data == NULL) {
+        return false;
+    }
+    if ((t->pos + need) > t->size) {
+        va_file_flush(t);
+        if (need > t->size) {
+            return false;
+        }
+    }
+    t->s.win = (va_window_t){ t->data + t->pos, t->data + t->size };
+    return true;
+}
+
+extern void va_file_fill(va_stream_t *s, void const *x, size_t k, size_t n)
+{
+    va_stream_file_t *t = (va_stream_file_t*)s;
+    file_commit(t);
+    if (t->data == NULL) {
+        char chunk[64];
+        size_t m = sizeof(chunk) / k;
+        va_fill_pattern(chunk, x, k, (m < n) ? m : n);
+        while (n > 0) {
+            size_t j = (m < n) ? m : n;
+            if (fwrite(chunk, k, j, t->file) != j) {
+                va_stream_set_error(&t->s, VA_E_TRUNC);
+                return;
+            }
+            n -= j;
+        }
+        return;
+    }
+    while (n > 0) {
+        size_t j = (t->size - t->pos) / k;
+        if (j == 0) {
+            va_file_flush(t);
+            j = t->size / k;
+            if (j == 0) {
+                va_file_write(s, x, k);
+                n--;
+                continue;
+            }
+        }
+        j = (j < n) ? j : n;
+        va_fill_pattern(t->data + t->pos, x, k, j);
+        t->pos += j * k;
+        n -= j;
+    }
+}
+
+extern void va_file_put(va_stream_t *s, char c)
+{
+    va_file_write(s, &c, 1);
+}
+
+extern void va_file_put_fill(va_stream_t *s, unsigned c, size_t n)
+{
+    char x = (char)c;
+    va_file_fill(s, &x, 1, n);
 }
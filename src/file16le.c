@@ -1,7 +1,6 @@
 /* -*- Mode: C -*- */
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
-#include <stdio.h>
 #include <assert.h>
 #include "va_print/file.h"
 #include "va_print/impl.h"
@@ -11,15 +10,14 @@
 
 extern void va_file16_put_le(va_stream_t *s, char16_t c)
 {
-    va_stream_file_t *t = (va_stream_file_t*)s;
-    if (fputc((char)(c & 0xff), t->file) < 0) {
-        goto error;
-    }
-    if (fputc((char)(c >> 8), t->file) < 0) {
-        goto error;
-    }
-    return;
+    unsigned char x[2];
+    x[0] = (unsigned char)(c & 0xff);
+    x[1] = (unsigned char)(c >> 8);
+    va_file_write(s, x, 2);
+}
 
-error:
-    va_stream_set_error(&t->s, VA_E_TRUNC);
+extern void va_file16_put_fill_le(va_stream_t *s, unsigned c, size_t n)
+{
+    unsigned char x[2] = { (unsigned char)c, 0 };
+    va_file_fill(s, x, 2, n);
 }
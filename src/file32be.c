@@ -1,7 +1,6 @@
 /* -*- Mode: C -*- */
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
-#include <stdio.h>
 #include <assert.h>
 #include "va_print/file.h"
 #include "va_print/impl.h"
@@ -11,21 +10,16 @@
 
 extern void va_file32_put_be(va_stream_t *s, char32_t c)
 {
-    va_stream_file_t *t = (va_stream_file_t*)s;
-    if (fputc((char)((c >> 24) & 0xff), t->file) < 0) {
-        goto error;
-    }
-    if (fputc((char)((c >> 16) & 0xff), t->file) < 0) {
-        goto error;
-    }
-    if (fputc((char)((c >> 8) & 0xff), t->file) < 0) {
-        goto error;
-    }
-    if (fputc((char)(c & 0xff), t->file) < 0) {
-        goto error;
-    }
-    return;
+    unsigned char x[4];
+    x[0] = (unsigned char)((c >> 24) & 0xff);
+    x[1] = (unsigned char)((c >> 16) & 0xff);
+    x[2] = (unsigned char)((c >> 8) & 0xff);
+    x[3] = (unsigned char)(c & 0xff);
+    va_file_write(s, x, 4);
+}
 
-error:
-    va_stream_set_error(&t->s, VA_E_TRUNC);
+extern void va_file32_put_fill_be(va_stream_t *s, unsigned c, size_t n)
+{
+    unsigned char x[4] = { 0, 0, 0, (unsigned char)c };
+    va_file_fill(s, x, 4, n);
 }
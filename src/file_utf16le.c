@@ -17,5 +17,8 @@ static void va_file16_put_utf16le(va_stream_t *s, unsigned c)
 /* extern objects */
 
 va_stream_vtab_t const va_file16_vtab_utf16le = {
-    .put = va_file16_put_utf16le
+    .init = va_file_init,
+    .put = va_file16_put_utf16le,
+    .finish = va_file_finish,
+    .put_fill = va_file16_put_fill_le,
 };
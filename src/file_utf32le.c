@@ -17,5 +17,8 @@ static void va_file32_put_utf32le(va_stream_t *s, unsigned c)
 /* extern objects */
 
 va_stream_vtab_t const va_file32_vtab_utf32le = {
-    .put = va_file32_put_utf32le
+    .init = va_file_init,
+    .put = va_file32_put_utf32le,
+    .finish = va_file_finish,
+    .put_fill = va_file32_put_fill_le,
 };
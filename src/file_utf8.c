@@ -17,5 +17,10 @@ static void va_file_put_utf8(va_stream_t *s, unsigned c)
 /* extern objects */
 
 va_stream_vtab_t const va_file_vtab_utf8 = {
-    .put = va_file_put_utf8
+    .init = va_file_init,
+    .put = va_file_put_utf8,
+    .finish = va_file_finish,
+    .refill = va_file_refill,
+    .put_fill = va_file_put_fill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF8),
 };
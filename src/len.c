@@ -3,20 +3,43 @@
 
 #include <assert.h>
 #include "va_print/len.h"
+#include "va_print/impl.h"
 
 /* ********************************************************************** */
 /* static functions */
 
-static void va_len_put(va_stream_t *s, unsigned c)
+static void va_len_put_len(va_stream_t *s, size_t n)
 {
     va_stream_len_t *t = (va_stream_len_t*)s;
+    size_t room = (t->pos < t->max) ? t->max - t->pos : 0;
+    if (n > room) {
+        t->pos = t->max + 1;
+        va_stream_set_full(s);
+        return;
+    }
+    t->pos += n;
+}
+
+static void va_len_put_fill(va_stream_t *s, unsigned c, size_t n)
+{
+    (void)c;
+    va_len_put_len(s, n);
+}
+
+static void va_len_put(va_stream_t *s, unsigned c)
+{
     (void)c;
-    t->pos++;
+    va_len_put_len(s, 1);
 }
 
 /* ********************************************************************** */
 /* extern objects */
 
+/* Code points are counted like UTF-32 code units, so that valid string
+ * runs are measured in bulk. */
 va_stream_vtab_t const va_len_vtab = {
     .put = va_len_put,
+    .put_fill = va_len_put_fill,
+    .put_len = va_len_put_len,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF32),
 };
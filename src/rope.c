@@ -0,0 +1,247 @@
+/* -*- Mode: C -*- */
+/* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include "va_print/rope.h"
+#include "va_print/impl.h"
+
+/* ********************************************************************** */
+/* types */
+
+/** Number of chunks passed to a single writev() call. */
+#define IOV_BATCH 64
+
+#define CHUNK_HEAD sizeof(va_rope_chunk_t)
+
+/**
+ * A chunk header, followed by 'size' bytes of memory at CHUNK_HEAD,
+ * 'used' of which are written.
+ */
+struct va_rope_chunk {
+    va_rope_chunk_t *next;
+    size_t size;
+    size_t used;
+};
+
+/* ********************************************************************** */
+/* static functions */
+
+static char *chunk_data(va_rope_chunk_t *c)
+{
+    return (char*)c + CHUNK_HEAD;
+}
+
+/**
+ * Take over what was written into the output window.
+ */
+static void commit(va_stream_rope_t *t)
+{
+    if (t->s.win.cur != NULL) {
+        t->last->used = (size_t)((char*)t->s.win.cur - chunk_data(t->last));
+        t->s.win = (va_window_t){ NULL, NULL };
+    }
+}
+
+/**
+ * Make sure the last chunk has room for 'need' bytes by appending a new
+ * chunk if necessary.  The rest of the old last chunk stays unused.  If
+ * memory is exhausted, this marks the stream full and returns false.
+ */
+static bool make_room(va_stream_rope_t *t, size_t need)
+{
+    va_rope_chunk_t *c = t->last;
+    if ((c != NULL) && ((c->size - c->used) >= need)) {
+        return true;
+    }
+
+    size_t size = (need < t->chunk_size) ? t->chunk_size : need;
+    c = NULL;
+    if (size <= (-(size_t)1 - CHUNK_HEAD)) {
+        c = t->alloc(NULL, CHUNK_HEAD + size, 1);
+    }
+    if (c == NULL) {
+        va_stream_set_full(&t->s);
+        return false;
+    }
+    c->next = NULL;
+    c->size = size;
+    c->used = 0;
+    if (t->last != NULL) {
+        t->last->next = c;
+    }
+    else {
+        t->first = c;
+    }
+    t->last = c;
+    return true;
+}
+
+/**
+ * Deallocate the chunk c and all following ones.
+ */
+static void free_chunks(va_stream_rope_t *t, va_rope_chunk_t *c)
+{
+    while (c != NULL) {
+        va_rope_chunk_t *next = c->next;
+        (void)t->alloc(c, 0, 1);
+        c = next;
+    }
+}
+
+/* ********************************************************************** */
+/* extern functions */
+
+extern void va_rope_finish(
+    va_stream_t *s)
+{
+    commit((va_stream_rope_t*)s);
+}
+
+extern bool va_rope_refill(
+    va_stream_t *s,
+    size_t need)
+{
+    va_stream_rope_t *t = (va_stream_rope_t*)s;
+    commit(t);
+    if (!make_room(t, need)) {
+        return false;
+    }
+    va_rope_chunk_t *c = t->last;
+    t->s.win = (va_window_t){ chunk_data(c) + c->used, chunk_data(c) + c->size };
+    return true;
+}
+
+extern void va_rope_put(
+    va_stream_t *s,
+    char c)
+{
+    va_stream_rope_t *t = (va_stream_rope_t*)s;
+    commit(t);
+    if (!make_room(t, 1)) {
+        return;
+    }
+    chunk_data(t->last)[t->last->used++] = c;
+}
+
+extern size_t va_rope_len(
+    va_stream_rope_t *t)
+{
+    commit(t);
+    size_t n = 0;
+    for (va_rope_chunk_t *c = t->first; c != NULL; c = c->next) {
+        n += c->used;
+    }
+    return n;
+}
+
+extern size_t va_rope_iovec(
+    va_stream_rope_t *t,
+    struct iovec *iov,
+    size_t n)
+{
+    commit(t);
+    size_t k = 0;
+    for (va_rope_chunk_t *c = t->first; c != NULL; c = c->next) {
+        if (c->used == 0) {
+            continue;
+        }
+        if (k < n) {
+            iov[k].iov_base = chunk_data(c);
+            iov[k].iov_len = c->used;
+        }
+        k++;
+    }
+    return k;
+}
+
+extern bool va_rope_writev(
+    va_stream_rope_t *t,
+    int fd)
+{
+    commit(t);
+    struct iovec iov[IOV_BATCH];
+    va_rope_chunk_t *c = t->first;
+    size_t off = 0;
+    for (;;) {
+        /* collect the next batch starting at offset 'off' into c */
+        int n = 0;
+        size_t o = off;
+        for (va_rope_chunk_t *d = c; (d != NULL) && (n < IOV_BATCH); d = d->next) {
+            if (d->used > o) {
+                iov[n].iov_base = chunk_data(d) + o;
+                iov[n].iov_len = d->used - o;
+                n++;
+            }
+            o = 0;
+        }
+        if (n == 0) {
+            return true;
+        }
+
+        ssize_t k = writev(fd, iov, n);
+        if (k < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (k == 0) {
+            return false;
+        }
+
+        /* skip what was written, also after a short write */
+        size_t m = (size_t)k;
+        while (m > 0) {
+            size_t r = c->used - off;
+            if (m < r) {
+                off += m;
+                break;
+            }
+            m -= r;
+            c = c->next;
+            off = 0;
+        }
+    }
+}
+
+extern char *va_rope_flatten(
+    va_stream_rope_t *t)
+{
+    size_t n = va_rope_len(t);
+    char *p = t->alloc(NULL, n + 1, 1);
+    if (p == NULL) {
+        return NULL;
+    }
+    char *w = p;
+    for (va_rope_chunk_t *c = t->first; c != NULL; c = c->next) {
+        memcpy(w, chunk_data(c), c->used);
+        w += c->used;
+    }
+    *w = 0;
+    return p;
+}
+
+extern void va_rope_clear(
+    va_stream_rope_t *t)
+{
+    commit(t);
+    va_rope_chunk_t *c = t->first;
+    if (c == NULL) {
+        return;
+    }
+    free_chunks(t, c->next);
+    c->next = NULL;
+    c->used = 0;
+    t->last = c;
+}
+
+extern void va_rope_free(
+    va_stream_rope_t *t)
+{
+    commit(t);
+    free_chunks(t, t->first);
+    t->first = NULL;
+    t->last = NULL;
+}
@@ -0,0 +1,24 @@
+/* -*- Mode: C -*- */
+/* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
+
+#include "va_print/rope.h"
+#include "va_print/rope_utf8.h"
+#include "va_print/utf8.h"
+
+/* ********************************************************************** */
+/* static functions */
+
+static void va_rope_put_utf8(va_stream_t *s, unsigned c)
+{
+    va_put_utf8(s, c, va_rope_put);
+}
+
+/* ********************************************************************** */
+/* extern objects */
+
+va_stream_vtab_t const va_rope_vtab_utf8 = {
+    .put = va_rope_put_utf8,
+    .finish = va_rope_finish,
+    .refill = va_rope_refill,
+    .enc = VA_ENC_TAG(VA_U_ENC_UTF8),
+};
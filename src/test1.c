@@ -1,9 +1,14 @@
 /* -*- Mode: C -*- */
 
+#define _GNU_SOURCE
+
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
 
 #include "va_print/core.h"
 #include "va_print/len.h"
@@ -11,6 +16,8 @@
 #include "va_print/alloc.h"
 #include "va_print/file.h"
 #include "va_print/fd.h"
+#include "va_print/rope.h"
+#include "va_print/impl.h"
 
 #define __unused __attribute__((__unused__))
 
@@ -39,8 +46,107 @@ static void my_print_my_value(va_stream_t *s, va_print_t *p)
 
 #define P_VALUE(v) (&((my_print_my_value_t){ VA_PRINT(&my_print_my_value,0), (v) }).super)
 
+static unsigned my_print_cnt;
+
+/* counts calls, prints 'i' right-justified in 'r' columns */
+static void my_print_count(va_stream_t *s, va_print_t *p)
+{
+    my_print_my_value_t *v = va_boxof(p, *v, super);
+    my_print_cnt++;
+    va_iprintf(s, "~*si", v->value->r, v->value->i);
+}
+
+#define P_COUNT(v) (&((my_print_my_value_t){ VA_PRINT(&my_print_count,0), (v) }).super)
+
 static va_stream_vtab_t myvtab[1] = {{ .put = myputc }};
 
+/* config file quotation: \xHH for control characters */
+static void my_render_quote_hex(va_stream_t *s, unsigned c)
+{
+    if (c >= 0x80) {
+        va_stream_render(s, c);
+        return;
+    }
+    va_stream_render(s, '\\');
+    va_stream_render(s, 'x');
+    va_stream_render(s, (unsigned char)"0123456789abcdef"[c >> 4]);
+    va_stream_render(s, (unsigned char)"0123456789abcdef"[c & 15]);
+}
+
+static bool my_check_flush_empty(va_stream_t *s)
+{
+    return (s->qctxt == 0);
+}
+
+static char const *const my_esc[] = { "\\\"", "\\\\", "\\n" };
+
+static va_quotation_table_t const my_table = {
+    .cls = {
+        [0 ... '\n' - 1] = VA_QCLASS_CALL,
+        ['\n'] = VA_QCLASS_ESC(2),
+        ['\n' + 1 ... 0x1f] = VA_QCLASS_CALL,
+        [' ' ... '!'] = VA_QCLASS_QUOTE,
+        ['"'] = VA_QCLASS_ESC(0),
+        ['#' ... ','] = VA_QCLASS_QUOTE,
+        [':' ... '@'] = VA_QCLASS_QUOTE,
+        ['['] = VA_QCLASS_QUOTE,
+        ['\\'] = VA_QCLASS_ESC(1),
+        [']' ... '^'] = VA_QCLASS_QUOTE,
+        ['`'] = VA_QCLASS_QUOTE,
+        ['{' ... '~'] = VA_QCLASS_QUOTE,
+        [0x7f] = VA_QCLASS_CALL,
+        /* the rest is 0 == VA_QCLASS_PLAIN: -./0-9A-Z_a-z */
+    },
+    .esc = my_esc,
+};
+
+static va_quotation_t const my_quote_table = {
+    .delim = { VA_DELIM(0, '"', '"'), VA_DELIM(0, '"', '"') },
+    .check_flush = my_check_flush_empty,
+    .render_quote = my_render_quote_hex,
+    .table = &my_table,
+};
+
+static unsigned my_init_cnt, my_finish_cnt;
+
+static void my_count_init(va_stream_t *s __unused)
+{
+    my_init_cnt++;
+}
+
+static void my_count_finish(va_stream_t *s __unused)
+{
+    my_finish_cnt++;
+}
+
+static va_stream_vtab_t mycountvtab[1] = {{
+    .init = my_count_init,
+    .put = myputc,
+    .finish = my_count_finish,
+}};
+
+static unsigned my_alloc_cnt;
+static size_t my_alloc_max = -(size_t)1;
+
+/* counts allocations, and fails for more than my_alloc_max bytes */
+static void *my_alloc(void *data, size_t nmemb, size_t size)
+{
+    if (nmemb != 0) {
+        my_alloc_cnt++;
+        if ((nmemb * size) > my_alloc_max) {
+            return NULL;
+        }
+    }
+    return va_alloc(data, nmemb, size);
+}
+
+#define COUNT_HOOKS(...) \
+    do { \
+        my_init_cnt = my_finish_cnt = 0; \
+        va_pprintf(mycountvtab, __VA_ARGS__); \
+        printf(";1 1;%u %u\n", my_init_cnt, my_finish_cnt); \
+    } while (0)
+
 __unused
 static void test_iuscp(
     unsigned line, char const *f, int a, unsigned b, char const *c, char d, void *e)
@@ -92,6 +198,17 @@ extern va_stream_t foo(va_stream_t);
 #define PRINTF1(F,W,...) va_printf("~u;~s;~s;" F "\n", __LINE__, F, W, __VA_ARGS__)
 #define PRINTF2(W,F,...) PRINTF1(F,W,__VA_ARGS__)
 
+/* print with a precompiled format */
+#define PRINTF3(W,F,...) \
+    do { \
+        va_format_t *f_ = va_format_compile(F); \
+        assert(f_ != NULL); \
+        va_printf("~u;~s;~s;", __LINE__, F, W); \
+        va_printf(f_, __VA_ARGS__); \
+        va_printf("\n"); \
+        va_format_free(f_); \
+    } while (0)
+
 int main(void)
 {
     va_error_t e __unused = {0};
@@ -143,6 +260,203 @@ int main(void)
     PRINTF1("test\u201c~qs", a4b, "\u201c");
     free(a4b);
 
+    /* longer than va_asprintf_init_size: output window is refilled */
+    char *a5 = va_asprintf("~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz");
+    PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", a5);
+    free(a5);
+
+    char16_t *a6 = va_uasprintf("~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz");
+    PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", a6);
+    free(a6);
+
+    char32_t *a7 = va_Uasprintf("~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz");
+    PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", a7);
+    free(a7);
+
+    /* staged in a local array: a single allocation of the exact size */
+    {
+        my_alloc_cnt = 0;
+        char *a8 = va_aexprintf(my_alloc, "~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz", &e);
+        PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", a8);
+        printf("%u;;1 0;%u %u\n", __LINE__, my_alloc_cnt, e.code);
+        free(a8);
+
+        char16_t *a9 = va_uaeprintf("~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz");
+        PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", a9);
+        free(a9);
+
+        char32_t *a10 = va_Uaeprintf("~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz");
+        PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", a10);
+        free(a10);
+
+        /* longer than va_asprintf_stage_size: spills into the heap */
+        my_alloc_cnt = 0;
+        char *a11 = va_aexprintf(my_alloc, "~1000sx~s", "", 5);
+        printf("%u;;1002 0;%zu %u\n", __LINE__, strlen(a11), (my_alloc_cnt > 1) ? 0 : 1);
+        PRINTF2("x5", "~s", a11 + 1000);
+        free(a11);
+
+        /* allocation errors are reported like for va_axprintf() */
+        my_alloc_max = 4;
+        char *a12 = va_aexprintf(my_alloc, "~s", "hello", &e);
+        printf("%u;;1 4;%d %u\n", __LINE__, a12 == NULL, e.code);
+        char *a13 = va_axprintf(my_alloc, "~s", "hello", &e);
+        printf("%u;;1 4;%d %u\n", __LINE__, a13 == NULL, e.code);
+        my_alloc_max = 600;
+        char *a14 = va_aexprintf(my_alloc, "~1000s", "", &e);
+        printf("%u;;1 4;%d %u\n", __LINE__, a14 == NULL, e.code);
+        my_alloc_max = -(size_t)1;
+    }
+
+    /* arena: strings grow in place and are released together */
+    {
+        va_arena_t ar = VA_ARENA(my_alloc);
+        my_alloc_cnt = 0;
+        char *b1 = va_arena_printf(&ar, "~s~s", "0123456789abcdef0123456789\u201c", U"\U0001f600xyz");
+        char16_t *b2 = va_arena_uprintf(&ar, "~s|~d", "\u201c", 42);
+        char32_t *b3 = va_arena_Uprintf(&ar, "~s|~5s", u"\U0001f600", "x");
+        PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", b1);
+        PRINTF2("\u201c|42", "~s", b2);
+        PRINTF2("\U0001f600|    x", "~s", b3);
+        printf("%u;;1;%u\n", __LINE__, my_alloc_cnt);
+
+        /* larger than a chunk */
+        char *b4 = va_arena_printf(&ar, "~5000sx", "");
+        printf("%u;;5001 3;%zu %u\n", __LINE__, strlen(b4), my_alloc_cnt);
+        PRINTF2("0123456789abcdef0123456789\u201c\U0001f600xyz", "~s", b1);
+
+        /* reset keeps the current chunk */
+        va_arena_reset(&ar);
+        char *b5 = va_arena_printf(&ar, "~s", "again");
+        PRINTF2("again", "~s", b5);
+        printf("%u;;3;%u\n", __LINE__, my_alloc_cnt);
+
+        /* allocation errors */
+        va_arena_free(&ar);
+        my_alloc_max = 100;
+        char *b6 = va_arena_printf(&ar, "~s", "x", &e);
+        printf("%u;;1 4;%d %u\n", __LINE__, b6 == NULL, e.code);
+        my_alloc_max = -(size_t)1;
+        va_arena_free(&ar);
+    }
+
+    /* string builder: the buffer is kept across print calls */
+    {
+        va_stream_vec_t sb = VA_STREAM_VEC(my_alloc);
+        va_span_t sp;
+        my_alloc_cnt = 0;
+        bool ok = va_vec_reserve(&sb, 100);
+        printf("%u;;1 1;%d %u\n", __LINE__, ok, my_alloc_cnt);
+        for (unsigned i = 0; i < 3; i++) {
+            va_vec_clear(&sb);
+            va_iprintf(&sb, "a~u", i);
+            va_iprintf(&sb, "~s", "\u201cb");
+        }
+        PRINTF2("a2\u201cb", "~s", sb.data);
+        printf("%u;;1;%u\n", __LINE__, my_alloc_cnt);
+        va_vec_span(&sb, &sp);
+        printf("%u;;6;%zu\n", __LINE__, sp.size);
+        PRINTF2("[a2\u201cb]", "[~s]", &sp);
+
+        va_iprintf(&sb, "~200s", "");
+        printf("%u;;206 3;%zu %u\n", __LINE__, strlen(sb.data), my_alloc_cnt);
+        va_vec_clear(&sb);
+        va_vec_shrink(&sb, 20);
+        printf("%u;;21 4;%zu %u\n", __LINE__, sb.size, my_alloc_cnt);
+        va_iprintf(&sb, "x");
+        PRINTF2("x", "~s", sb.data);
+        va_vec_free(&sb);
+
+        va_stream_vec16_t sb16 = VA_STREAM_VEC16(va_alloc);
+        va_span16_t sp16;
+        va_iprintf(&sb16, "~s", "x\u201c");
+        va_vec16_clear(&sb16);
+        va_iprintf(&sb16, "~s", "y\U0001f600");
+        printf("%u;;3;%zu\n", __LINE__, va_vec16_span(&sb16, &sp16)->size);
+        PRINTF2("y\U0001f600", "~s", &sp16);
+        va_vec16_free(&sb16);
+
+        va_stream_vec32_t sb32 = VA_STREAM_VEC32(va_alloc);
+        va_span32_t sp32;
+        va_iprintf(&sb32, "~s", "y\U0001f600");
+        va_vec32_reserve(&sb32, 1000);
+        printf("%u;;1001 2;%zu %zu\n", __LINE__, sb32.size, va_vec32_span(&sb32, &sp32)->size);
+        va_vec32_free(&sb32);
+    }
+
+    /* printing into a local array, allocating only if it does not fit */
+    {
+        char ib[16];
+        my_alloc_cnt = 0;
+        va_stream_vec_t r1 = va_bxprintf(my_alloc, ib, "~s~u", "\u201c", 42, &e);
+        PRINTF2("\u201c42", "~s", r1.data);
+        printf("%u;;1 0 5 0;%d %u %zu %u\n", __LINE__,
+            va_vec_is_inline(&r1), my_alloc_cnt, r1.pos, e.code);
+        va_vec_free(&r1);
+
+        va_stream_vec_t r2 = va_bxprintf(my_alloc, ib, "~s~20s", "\u201c", "x", &e);
+        PRINTF2("\u201c                   x", "~s", r2.data);
+        printf("%u;;0 1 23 0;%d %u %zu %u\n", __LINE__,
+            va_vec_is_inline(&r2), my_alloc_cnt, r2.pos, e.code);
+        va_vec_free(&r2);
+
+        char16_t ib16[4];
+        va_stream_vec16_t r3 = va_ubprintf(ib16, "~s", "ab\U0001f600");
+        PRINTF2("ab\U0001f600", "~s", r3.data);
+        printf("%u;;0;%d\n", __LINE__, va_vec_is_inline(&r3));
+        va_vec16_free(&r3);
+
+        char32_t ib32[4];
+        va_stream_vec32_t r4 = va_Ubprintf(ib32, "~s", "ab\U0001f600");
+        PRINTF2("ab\U0001f600", "~s", r4.data);
+        printf("%u;;1;%d\n", __LINE__, va_vec_is_inline(&r4));
+        va_vec32_free(&r4);
+
+        /* exactly fits */
+        char ib4[4];
+        va_stream_vec_t r6 = va_bprintf(ib4, "~s", "abc");
+        printf("%u;;1;%d\n", __LINE__, va_vec_is_inline(&r6));
+        va_stream_vec_t r7 = va_bprintf(ib4, "~s", u"abc");
+        printf("%u;;1;%d\n", __LINE__, va_vec_is_inline(&r7));
+        va_vec_free(&r6);
+        va_vec_free(&r7);
+
+        my_alloc_max = 4;
+        va_stream_vec_t r5 = va_bxprintf(my_alloc, ib, "~40s", "x", &e);
+        printf("%u;;1 0 4;%d %d %u\n", __LINE__,
+            r5.data == NULL, va_vec_is_inline(&r5), e.code);
+        my_alloc_max = -(size_t)1;
+    }
+
+    /* temporary strings */
+    {
+        PRINTF2("a1 b2 c3", "~s ~s ~s",
+            va_tprintf("a~s", 1), va_tprintf("b~s", 2), va_tprintf("c~s", 3));
+        PRINTF2("x\U0001f600 y", "~s ~s",
+            va_utprintf("x~s", "\U0001f600"), va_Utprintf("~c", 'y'));
+
+        /* the ring is reused: same buffer after va_tprintf_slots calls */
+        char *t1 = va_tprintf("~50s", "long");
+        for (unsigned i = 1; i < va_tprintf_slots; i++) {
+            (void)va_tprintf("~s", i);
+        }
+        char *t2 = va_tprintf("~s", "short");
+        printf("%u;;1;%d\n", __LINE__, t1 == t2);
+        PRINTF2("short", "~s", t2);
+
+        /* errors do not stick to a buffer */
+        (void)va_tprintf("~", 1);
+        for (unsigned i = 1; i < va_tprintf_slots; i++) {
+            (void)va_tprintf("~s", i);
+        }
+        char *t3 = va_tprintf("~s", "ok", &e);
+        printf("%u;;ok 0;%s %u\n", __LINE__, t3, e.code);
+
+        va_tprintf_free();
+        PRINTF2("again", "~s", va_tprintf("~s", "again"));
+        va_tprintf_free();
+    }
+
     TEST_IUSCP("Foo: X=~i, [~8x], ~s ~c ~px",  a, 1239, "foo", 'a', p);
     TEST_IUSCP("Foo: X=~i, [~#8x], ~8s ~c ~p",  a, -1239U, "foo", 'a', p);
     TEST_IUSCP("Foo: X=~c, [~#08x], ~.5s ~c ~p", 'a', -1239U, "foo", 'a', p);
@@ -452,6 +766,18 @@ int main(void)
     PRINTF2("0xffff", "~#x", (unsigned short)-1);
     PRINTF2("0xff", "~#x", (unsigned char)-1);
 
+    PRINTF2("0 9 10 99 100 999 1000 10000000000", "~u ~u ~u ~u ~u ~u ~u ~u",
+        0, 9, 10, 99, 100, 999, 1000, 10000000000ULL);
+    PRINTF2("-9223372036854775808", "~d", (signed long long)(1ULL << 63));
+    PRINTF2("0b1111111111111111111111111111111111111111111111111111111111111111",
+        "~#b", (unsigned long long)-1);
+    PRINTF2("01777777777777777777777", "~#o", (unsigned long long)-1);
+    PRINTF2("0ep777777777777", "~#e", (unsigned long long)-1);
+    PRINTF2("a A 0 0 ", "~e ~E ~x ~.0x~o ", 0, 0, 0, 0, 0);
+    PRINTF2("00012345 0x00ab   -42", "~.8u ~#.4x ~5d", 12345, 0xab, -42);
+    PRINTF2("12345678901234567890", "~s", va_unprintf(24, "~u", 12345678901234567890ULL));
+    PRINTF2("1234567", "~s", va_unprintf(8, "~u", 12345678901234567890ULL));
+    PRINTF2("12345678901234567890", "~s", va_Unprintf(24, "~u", 12345678901234567890ULL));
     PRINTF2("CD", "~hhX", 0xabcdU);
     PRINTF2("-0x3211", "~#hx", 0xabcdef);
     PRINTF2("-12817", "~#hd", 0xabcdef);
@@ -930,6 +1256,12 @@ int main(void)
     PRINTF2("a0x10b", "a~pb", 16);
     PRINTF2("a10b", "a~#pb", 16);
 
+    COUNT_HOOKS("~u;", __LINE__);
+    COUNT_HOOKS("~u;~s~s", __LINE__, "a", 5);
+    COUNT_HOOKS("~u;~s~s~s", __LINE__, "a", 5);
+    COUNT_HOOKS("~u;~s", __LINE__, "a", 5);
+    COUNT_HOOKS("~u;~s~s", __LINE__, "a", &e);
+
     va_stream_file_t *fbu = &VA_STREAM_FILE(stdout);
     assert(va_stream_get_error(fbu) == VA_E_OK);
 
@@ -1125,6 +1457,22 @@ int main(void)
     va_printf("M5b;;a(2\\3i)    b;a~-10sb", P_VALUE(&val1)); va_printf("\n");
     va_printf("M5b;;a'(2\\\\3i)' b;a~-10qcb", P_VALUE(&val1)); va_printf("\n");
 
+    /* right-justified output is rendered once if it is short */
+    my_value_t val2 = { 4, 7 };
+    my_print_cnt = 0;
+    PRINTF2("     7i", "~7s", P_COUNT(&val2));
+    printf("%u;;1;%u\n", __LINE__, my_print_cnt);
+    PRINTF2("  \"   7i\"", "~9qs", P_COUNT(&val2));
+    printf("%u;;2;%u\n", __LINE__, my_print_cnt);
+    my_value_t val3 = { 99, 7 };
+    PRINTF2(va_nprintf(120, " ~99si", 7), "~101s", P_COUNT(&val3));
+    printf("%u;;4;%u\n", __LINE__, my_print_cnt);
+    PRINTF2("   \"a\\tb\"", "~9qs", "a\tb");
+    PRINTF2("\"a\\tb\\tcdefgh\"", "~5qs", "a\tb\tcdefgh");
+    PRINTF2("  'a b'", "~7ks", "a b");
+    PRINTF2(va_nprintf(120, " ~qs", va_nprintf(100, "~94qs", "a\tb")),
+        "~100qs", va_nprintf(100, "~94qs", "a\tb"));
+
     /* UTF8/16 end of string handling */
     PRINTF2("abc", "~s", va_nprintf(4, "~s", "abcdefg"));
     PRINTF2("ab\xe2", "~s", va_nprintf(4, "~s", "ab\u201ccdefg"));
@@ -1139,6 +1487,123 @@ int main(void)
     PRINTF2("ab", "~s", va_unprintf(4, "~.3s", ITER("ab\U0010201ccdefg")));
     PRINTF2("0xf", "~s", va_unprintf(4, "~#zx", -1));
 
+    /* quoted strings are decoded in valid runs */
+    PRINTF2("\"a\\tb“\U0001f600\\\"c\"", "~s", va_nprintf(30, "~qs", "a\tb“\U0001f600\"c"));
+    PRINTF2("\"a\\tb“\U0001f600\\\"c\"", "~s", va_unprintf(30, "~qs", u"a\tb“\U0001f600\"c"));
+    PRINTF2("\"a\\tb“\U0001f600\\\"c\"", "~s", va_Unprintf(30, "~qs", U"a\tb“\U0001f600\"c"));
+    PRINTF2("\"a\\ufffdb\\u201c\"", "~s", va_nprintf(30, "~0qs", "a\xff" "b“"));
+    PRINTF2("  \"a\\tb“\"", "~s", va_nprintf(30, "~9.6qs", "a\tb“xyz"));
+    PRINTF2("\"a\\tb\xe2\x80", "~s", va_nprintf(8, "~qs", "a\tb“"));
+
+    /* plain runs of quoted strings are scanned in blocks */
+    PRINTF2("\"0123456789abcdef0123456789abcdef\\\"0123456789abcdef“0123456789\\\\\"",
+        "~qs", "0123456789abcdef0123456789abcdef\"0123456789abcdef“0123456789\\");
+    PRINTF2("\"0123456789abcdef0123456789abcdef0123456789abcde\\u201c01\\n\"",
+        "~0Qs", "0123456789abcdef0123456789abcdef0123456789abcde“01\n");
+    PRINTF2("'0123456789abcdef0123456789abcdef\t\"'\\''x'",
+        "~ks", "0123456789abcdef0123456789abcdef\t\"'x");
+    PRINTF2("0123456789abcdef0123456789abcdef/.,+-_ABCXYZ",
+        "~ks", "0123456789abcdef0123456789abcdef/.,+-_ABCXYZ");
+    PRINTF2("'0123456789abcdef0123456789abcdef@'", "~ks", "0123456789abcdef0123456789abcdef@");
+    PRINTF2("'0123456789abcdef0123456789abcdef\U0001f600'",
+        "~ks", u"0123456789abcdef0123456789abcdef\U0001f600");
+
+    /* quotation with a class table */
+    va_quotation_t const *old_qq = va_quotation_set(VA_QUOTE_qq, &my_quote_table);
+    PRINTF2("abc", "~qqs", "abc");
+    PRINTF2("\"\"", "~qqs", "");
+    PRINTF2("a\u201cb", "~qqs", "a\u201cb");
+    PRINTF2("\"a b\"", "~qqs", "a b");
+    PRINTF2("\"a\\\"b\\\\c\\nd\\x01e\\x7f\u201c\"", "~qqs", "a\"b\\c\nd\x01" "e\x7f\u201c");
+    PRINTF2("\"a\\\"b\\nc\U0001f600\"", "~qqs", u"a\"b\nc\U0001f600");
+    PRINTF2("\"a\\\"b\\nc\U0001f600\"", "~qqs", U"a\"b\nc\U0001f600");
+    PRINTF2("0123456789abcdef0123456789abcdef/.-_ABCXYZ\u201c",
+        "~qqs", "0123456789abcdef0123456789abcdef/.-_ABCXYZ\u201c");
+    PRINTF2("\"0123456789abcdef0123456789abcdef,\\x09\"",
+        "~qqs", "0123456789abcdef0123456789abcdef,\t");
+    PRINTF2("    \"a\\nb\"", "~10qqs", "a\nb");
+    PRINTF2("  ab", "~4qqs", "ab");
+    PRINTF2("\"(2\\\\3i)\"", "~qqs", P_VALUE(&val1));
+    PRINTF2("'a b'", "~ks", "a b");
+    va_quotation_set(VA_QUOTE_qq, old_qq);
+    PRINTF2("a b", "~qqs", "a b");
+
+    /* quotation methods per thread and per stream */
+    va_quotations_t my_quotes;
+    va_quotations_init(&my_quotes);
+    my_quotes.q[VA_QUOTE_qq] = &my_quote_table;
+    my_quotes.q[VA_QUOTE_k] = NULL;
+    assert(va_quotations_thread(&my_quotes) == NULL);
+    PRINTF2("\"a b\"", "~qqs", "a b");
+    PRINTF2("\"a\\tb\"", "~qs", "a\tb");
+    PRINTF2("a b", "~ks", "a b");
+    PRINTF2("\"(2\\\\3i)\"", "~qqs", P_VALUE(&val1));
+    assert(va_quotations_thread(NULL) == &my_quotes);
+    PRINTF2("a b", "~qqs", "a b");
+    PRINTF2("'a b'", "~ks", "a b");
+    {
+        char qbuf[20];
+        va_stream_char_p_t qs = VA_STREAM_CHAR_ARR(qbuf);
+        qs.s.quote = &my_quotes;
+        va_iprintf(&qs.s, "~qqs ~ks", "a\"b", "c d");
+        PRINTF2("\"a\\\"b\" c d", "~s", qbuf);
+    }
+    PRINTF2("a b", "~qqs", "a b");
+
+    /* same-encoding strings are copied in bulk */
+    PRINTF2("a\u201cb\U0001f600c", "~s", va_nprintf(20, "~s", "a\u201cb\U0001f600c"));
+    PRINTF2("  ab\u201c", "~s", va_nprintf(20, "~5s", "ab\u201c"));
+    PRINTF2("ab\u201c  ", "~s", va_nprintf(20, "~-5s", "ab\u201c"));
+    PRINTF2("ab\xff" "cd", "~s", va_nprintf(20, "~s", "ab\xff" "cd"));
+    PRINTF2("ab\xe2\x80" "c", "~s", va_nprintf(20, "~s", "ab\xe2\x80" "c"));
+    PRINTF2("abcd", "~s", va_nprintf(20, "~s", (&(va_span_t){ .data = "ab\0cd", .size = 5 })));
+    PRINTF2("abc\u201c", "~s", va_nprintf(7, "~s", "abc\u201c\u201d"));
+    PRINTF2("a\u201cb\U0001f600c", "~s", va_unprintf(20, "~s", u"a\u201cb\U0001f600c"));
+    PRINTF2("a\u201cb\U0001f600c", "~s", va_Unprintf(20, "~s", U"a\u201cb\U0001f600c"));
+    PRINTF2("ab", "~s", va_unprintf(3, "~s", u"abcd"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF0123456789abcdef\u201c0123456789",
+        "~s", va_nprintf(80, "~s",
+            "0123456789abcdef0123456789ABCDEF0123456789abcdef\u201c0123456789"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF0\xff" "23456789abcdef",
+        "~s", va_nprintf(80, "~s",
+            "0123456789abcdef0123456789ABCDEF0\xff" "23456789abcdef"));
+    PRINTF2("    0123456789abcdef0123456789ABCDEF0123456789\u201c",
+        "~s", va_nprintf(80, "~47s",
+            "0123456789abcdef0123456789ABCDEF0123456789\u201c"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF01234567",
+        "~s", va_nprintf(80, "~s",
+            (&(va_span_t){ .data = "0123456789abcdef0123456789ABCDEF0123456789", .size = 40 })));
+
+    /* transcoding between encodings */
+    PRINTF2("0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef",
+        "~s", va_nprintf(80, "~s",
+            u"0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef",
+        "~s", va_nprintf(80, "~s",
+            U"0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef",
+        "~s", va_unprintf(80, "~s",
+            "0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef",
+        "~s", va_unprintf(80, "~s",
+            U"0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef"));
+    PRINTF2("\u00e4\u201c\u00e4\u201c\u00e4\u201c\u00e4\u201c\u00e4\u201c\U0001f600",
+        "~s", va_Unprintf(80, "~s",
+            u"\u00e4\u201c\u00e4\u201c\u00e4\u201c\u00e4\u201c\u00e4\u201c\U0001f600"));
+    PRINTF2("0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef",
+        "~s", va_Unprintf(80, "~s",
+            "0123456789abcdef0123456789ABCDEF\u00e4\u201c\U0001f600xyz0123456789abcdef"));
+    PRINTF2("0123456789abcdef\ufffdxyz", "~s", va_nprintf(80, "~s",
+        ((char16_t const[]){ '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f',
+            0xd800, 'x','y','z', 0 })));
+    PRINTF2("0123456789abcdef\ufffdxyz", "~s", va_nprintf(80, "~s",
+        ((char32_t const[]){ '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f',
+            0x110000, 'x','y','z', 0 })));
+    PRINTF2("0123456789ab\u201c", "~s", va_nprintf(16, "~s",
+        u"0123456789ab\u201c\u201d"));
+    PRINTF2("        0123456789abcdef\u201c", "~s", va_nprintf(80, "~25s",
+        u"0123456789abcdef\u201c"));
+
     printf("%u;;1;%zu\n", __LINE__, va_zprintf(""));
     printf("%u;;5;%zu\n", __LINE__, va_zprintf("~#x",18));
     printf("%u;;6;%zu\n", __LINE__, va_gzprintf(char,"a~sb", "\u201c"));
@@ -1151,13 +1616,269 @@ int main(void)
     printf("%u;;4;%zu\n", __LINE__, va_Uzprintf("a~sb", "\u201c"));
     printf("%u;;4;%zu\n", __LINE__, va_Uzprintf("a~sb", "\U0010201c"));
 
+    /* sizes are computed without encoding */
+    printf("%u;;8;%zu\n", __LINE__, va_zprintf("~s", u"\u201c\U0001f600"));
+    printf("%u;;4;%zu\n", __LINE__, va_uzprintf("~s", U"\u201c\U0001f600"));
+    printf("%u;;3;%zu\n", __LINE__, va_Uzprintf("~s", "\u201c\U0001f600"));
+    printf("%u;;4;%zu\n", __LINE__, va_zprintf("~s", "a\xff" "b"));
+    printf("%u;;4;%zu\n", __LINE__, va_uzprintf("~s", "a\xff" "b"));
+    printf("%u;;5;%zu\n", __LINE__, va_zprintf("~.2s", u"\U0001f600\U0001f600"));
+    printf("%u;;5;%zu\n", __LINE__, va_uzprintf("~3s", U"\U0001f600"));
+    printf("%u;;3;%zu\n", __LINE__, va_lprintf("~s~s", u"\u201c\U0001f600", "x"));
+
     va_fprintf(stdout, "~u;;a5c;a~sc\n", __LINE__, 5);
     va_fprintf(stdout, "~u;;a5c;a~sc\n", __LINE__, "5");
+    va_fprintf(stdout, "~u;;a~sc;a~sc\n", __LINE__,
+        u"0123456789012345678901234567890123456789\u201c",
+        U"0123456789012345678901234567890123456789\u201c");
+
+    char filebuf[8];
+    va_stream_file_t *fib = &VA_STREAM_FILE_BUF(stdout, filebuf, sizeof(filebuf));
+    va_iprintf(fib, "~u;;a5c;", __LINE__);
+    va_iprintf(fib, "a~sc\n", "5");
+    va_file_flush(fib);
+
+    /* padding is filled in bulk */
+    printf("%u;;1000000000;%zu\n", __LINE__, va_lprintf("~*s", 1000000000, "x"));
+    printf("%u;;2000000001;%zu\n", __LINE__, va_zprintf("~*~", 2000000000));
+    PRINTF2("   ", "~s", va_nprintf(4, "~10s", "x"));
+    PRINTF2("x  |", "~s", va_unprintf(8, "~-3s|", "x"));
+    PRINTF2("  0012", "~s", va_Unprintf(8, "~6.4d", 12));
+    char *padded = va_asprintf("~5000d", 7);
+    printf("%u;;5000;%zu\n", __LINE__, strlen(padded));
+    PRINTF2("7", "~s", padded + 4999);
+    free(padded);
+    char padbuf[701];
+    memset(padbuf, ' ', 699);
+    padbuf[699] = 'x';
+    padbuf[700] = 0;
+    va_fprintf(stdout, "~u;;~s;~700s\n", __LINE__, padbuf, "x");
+    va_iprintf(fib, "~u;;~s;~700s\n", __LINE__, padbuf, "x");
+    va_file_flush(fib);
+    va_iprintf(&VA_STREAM_FILE(stdout), "~u;;~s;~700s\n", __LINE__, padbuf, "x");
     fflush(stdout);
 
+    va_dprintf(1, "~u;;~s;~700s\n", __LINE__, padbuf, "x");
+    va_iprintf(&VA_STREAM_FD(1), "~u;;~s;~700s\n", __LINE__, padbuf, "x");
+
     va_dprintf(1, "~u;;a0005c;a~.4sc\n", __LINE__, 5);
     va_dprintf(1, "~u;;a5   c;a~-4sc\n", __LINE__, "5");
 
+    char fdbuf[8];
+    va_stream_fd_t *fdb = &VA_STREAM_FD_BUF(1, fdbuf, sizeof(fdbuf));
+    va_iprintf(fdb, "~u;;a5c;", __LINE__);
+    va_iprintf(fdb, "a~sc\n", "5");
+    va_fd_flush(fdb);
+
+    fdb = &VA_STREAM_FD_BUF(1, fdbuf, 5);
+    va_iprintf(fdb, "~u;;a\u201cb\U0001f600c;", __LINE__);
+    va_iprintf(fdb, "a\u201c~sc\n", "b\U0001f600");
+    va_fd_flush(fdb);
+    va_iprintf(fdb, "~u;;~s;~700s\n", __LINE__, padbuf, "x");
+    va_fd_flush(fdb);
+
+    va_iprintf(&VA_STREAM_FD(1), "~u;;a\u201cc;a~sc\n", __LINE__, "\u201c");
+
+    /* buffered streams collect output across print calls: in a packet
+     * mode pipe, each read() returns what one write() wrote */
+    {
+        int pfd[2];
+        int rc = pipe2(pfd, O_DIRECT | O_NONBLOCK);
+        assert(rc == 0);
+        char pbuf[64];
+        char rbuf[64];
+        va_stream_fd_t *ps = &VA_STREAM_FD_BUF(pfd[1], pbuf, sizeof(pbuf));
+        va_iprintf(ps, "a");
+        va_iprintf(ps, "~s", "b\u201c");
+        va_iprintf(ps, "~u", 7);
+        printf("%u;;-1;%zd\n", __LINE__, read(pfd[0], rbuf, sizeof(rbuf)));
+        va_fd_flush(ps);
+        ssize_t n = read(pfd[0], rbuf, sizeof(rbuf));
+        printf("%u;;ab\u201c7;%.*s\n", __LINE__, (int)n, rbuf);
+        printf("%u;;-1;%zd\n", __LINE__, read(pfd[0], rbuf, sizeof(rbuf)));
+        va_dprintf(pfd[1], "x~s", "y");
+        n = read(pfd[0], rbuf, sizeof(rbuf));
+        printf("%u;;xy;%.*s\n", __LINE__, (int)n, rbuf);
+        close(pfd[0]);
+        close(pfd[1]);
+
+        /* large buffers are not written in PIPE_BUF chunks: a
+         * seqpacket socket keeps the boundaries of larger writes */
+        rc = socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK, 0, pfd);
+        assert(rc == 0);
+        static char lbuf[16384];
+        static char lread[16384];
+        ps = &VA_STREAM_FD_BUF(pfd[1], lbuf, sizeof(lbuf));
+        va_iprintf(ps, "~3000s", "a");
+        va_iprintf(ps, "~3000s", "b");
+        va_iprintf(ps, "~3000s", "c");
+        printf("%u;;-1;%zd\n", __LINE__, read(pfd[0], lread, sizeof(lread)));
+        va_fd_flush(ps);
+        printf("%u;;9000;%zd\n", __LINE__, read(pfd[0], lread, sizeof(lread)));
+        printf("%u;;a;%c\n", __LINE__, lread[2999]);
+        printf("%u;;c;%c\n", __LINE__, lread[8999]);
+        printf("%u;;-1;%zd\n", __LINE__, read(pfd[0], lread, sizeof(lread)));
+        close(pfd[0]);
+        close(pfd[1]);
+
+        FILE *tf = tmpfile();
+        assert(tf != NULL);
+        setvbuf(tf, NULL, _IONBF, 0);
+        va_stream_file_t *ts = &VA_STREAM_FILE_BUF(tf, pbuf, sizeof(pbuf));
+        va_iprintf(ts, "a");
+        va_iprintf(ts, "~s", "b\u201c");
+        printf("%u;;0;%ld\n", __LINE__, ftell(tf));
+        va_file_flush(ts);
+        printf("%u;;5;%ld\n", __LINE__, ftell(tf));
+        va_fprintf(tf, "x~s", "y");
+        printf("%u;;7;%ld\n", __LINE__, ftell(tf));
+        fclose(tf);
+    }
+
+    /* ropes */
+    {
+        va_stream_rope_t rope = VA_STREAM_ROPE(va_alloc);
+        rope.chunk_size = 8;
+        va_iprintf(&rope, "~u;;a\u201cb~20sc;", __LINE__, "\U0001f600");
+        va_iprintf(&rope, "a\u201cb~20sc\n", "\U0001f600");
+        struct iovec iov[2];
+        size_t n = va_rope_iovec(&rope, iov, 2);
+        printf("%u;;1 1;%d %d\n", __LINE__, n > 2, iov[0].iov_len <= 8);
+        char *flat = va_rope_flatten(&rope);
+        printf("%u;;1;%d\n", __LINE__, strlen(flat) == va_rope_len(&rope));
+        free(flat);
+        fflush(stdout);
+        printf("%u;;1;%d\n", __LINE__, va_rope_writev(&rope, 1));
+
+        va_rope_clear(&rope);
+        printf("%u;;0 0;%zu %zu\n", __LINE__,
+            va_rope_len(&rope), va_rope_iovec(&rope, NULL, 0));
+        rope.chunk_size = 1000;
+        va_iprintf(&rope, "~u;;~s;~700s\n", __LINE__, padbuf, "x");
+        flat = va_rope_flatten(&rope);
+        printf("%s", flat);
+        free(flat);
+
+        my_alloc_cnt = 0;
+        my_alloc_max = 0;
+        va_stream_rope_t r2 = VA_STREAM_ROPE(my_alloc);
+        va_iprintf(&r2, "~s", "abc", &e);
+        printf("%u;;0 4;%zu %u\n", __LINE__, va_rope_len(&r2), e.code);
+        my_alloc_max = -(size_t)1;
+
+        va_rope_free(&rope);
+        va_rope_free(&r2);
+    }
+
+    /* precompiled formats */
+    PRINTF3("a5b", "a~sb", 5);
+    PRINTF3("a\u201c5\U0001f600b", "a\u201c~s\U0001f600b", 5);
+    PRINTF3("|\"ab\"  |0x1f|+7|", "|~-6.2qs|~#x|~+d|", "abc", 31, 7);
+    PRINTF3("16 0x10", "~d ~=#x", 16);
+    PRINTF3("a~b7", "a~~b~s", 7);
+    PRINTF3("a~~~~b7", "a~4~b~s", 7);
+    PRINTF3("a~~~~~b7", "a~*~b~s", 5, 7);
+    PRINTF3("a  5b", "a~*sb", 3, 5);
+    PRINTF3("a5  b", "a~-*.*sb", 3, 1, 5);
+    PRINTF3("ab", "ab~", 7, &e);
+    assert(e.code == VA_E_FORMAT);
+    PRINTF3("ab7c", "a~jb~sc", 6, 7, &e);
+    assert(e.code == VA_E_FORMAT);
+    PRINTF3("a5b", "a~s~sb", 5, &e);
+    assert(e.code == VA_E_ARGC);
+    PRINTF3("a5b", "a~sb", 5, 6, &e);
+    assert(e.code == VA_E_ARGC);
+    PRINTF3("a5b", "a~sb", 5, &e);
+    assert(e.code == VA_E_OK);
+    PRINTF3(va_nprintf(16, "a\xff" "b~s", 5), "a\xff" "b~s", 5, &e);
+    assert(e.code == VA_E_DECODE);
+    {
+        va_format_t *f = va_format_compile(u"x\u201c~5sy");
+        va_format_t *g = va_format_compile(U"~s\U0001f600~~");
+        for (unsigned i = 0; i < 3; i++) {
+            PRINTF2("x\u201c    1y", "~s", va_nprintf(16, f, i + 1 - i));
+            PRINTF2("x\u201c    1y", "~s", va_unprintf(16, f, 1));
+            PRINTF2("x\u201c    1y", "~s", va_Unprintf(16, f, 1));
+            PRINTF2("2\U0001f600~", "~s", va_nprintf(16, g, 2));
+            PRINTF2("2\U0001f600~", "~s", va_unprintf(16, g, 2));
+            PRINTF2("2\U0001f600~", "~s", va_Unprintf(16, g, 2));
+        }
+        PRINTF2("x\u201c  ", "~s", va_nprintf(7, f, 1));
+        PRINTF2("x\u201c   ", "~s", va_unprintf(6, f, 1));
+        printf("%u;;8;%zu\n", __LINE__, va_lprintf(f, 1));
+        printf("%u;;11;%zu\n", __LINE__, va_zprintf(f, 1));
+        printf("%u;;9;%zu\n", __LINE__, va_uzprintf(f, 1));
+        char *fa = va_asprintf(f, 1);
+        PRINTF2("x\u201c    1y", "~s", fa);
+        free(fa);
+        va_iprintf(fib, "~u;;x\u201c    1y;", __LINE__);
+        va_iprintf(fib, f, 1);
+        va_iprintf(fib, "\n");
+        va_file_flush(fib);
+        va_dprintf(1, "~u;;x\u201c    1y;", __LINE__);
+        va_dprintf(1, f, 1);
+        va_dprintf(1, "\n");
+        va_format_free(f);
+        va_format_free(g);
+    }
+    /* formats without sigil are copied in bulk */
+    PRINTF2("abc\u201cd", "~s", va_nprintf(16, "abc\u201cd"));
+    PRINTF2("abc\u201cd", "~s", va_unprintf(16, "abc\u201cd"));
+    PRINTF2("abc\u201cd", "~s", va_Unprintf(16, "abc\u201cd"));
+    PRINTF2("abc\u201cd", "~s", va_nprintf(16, u"abc\u201cd"));
+    PRINTF2("abc\u201cd", "~s", va_nprintf(16, U"abc\u201cd"));
+    PRINTF2("abc", "~s", va_nprintf(4, "abcdef"));
+    PRINTF2("ab", "~s", va_nprintf(16, "ab\0cd"));
+    {
+        char pb[16];
+        va_stream_char_p_t *ps = va_xprintf(
+            &VA_STREAM_CHAR_P(pb, sizeof(pb)), "a\xff" "b");
+        PRINTF2(va_nprintf(16, "a~sb", "\xff"), "~s", pb);
+        assert(va_stream_get_error(ps) == VA_E_DECODE);
+        ps = va_xprintf(&VA_STREAM_CHAR_P(pb, 3), "abcdef");
+        PRINTF2("ab", "~s", pb);
+        assert(va_stream_get_error(ps) == VA_E_TRUNC);
+    }
+    va_iprintf(fib, "~u;;a\u201cb;", __LINE__);
+    va_iprintf(fib, "a\u201cb");
+    va_iprintf(fib, "\n");
+    va_file_flush(fib);
+
+    /* a full stream skips rendering, but reads all arguments */
+    PRINTF2("abc", "~s", va_nprintf(4, "ab~s~s", "cdef", 5, &e));
+    assert(e.code == VA_E_TRUNC);
+    PRINTF2("abc", "~s", va_nprintf(4, "ab~s~s", "c", "", &e));
+    assert(e.code == VA_E_OK);
+    PRINTF2("abc", "~s", va_nprintf(4, "abc~*s|~-5s~5d", 5, "x", "y", 7, &e));
+    assert(e.code == VA_E_TRUNC);
+    PRINTF2("abc", "~s", va_nprintf(4, "abcd~s~s", 5, &e));
+    assert(e.code == VA_E_TRUNC);
+    PRINTF2("ab", "~s", va_unprintf(3, "abcd~s", 5, 6, &e));
+    assert(e.code == VA_E_TRUNC);
+    {
+        char const *pp = "hello";
+        PRINTF2("x", "~s", va_nprintf(2, "xy~.3s~=.1s", &pp));
+        PRINTF2("ello", "~s", pp);
+    }
+    printf("%u;;8;%zu\n", __LINE__, va_lnprintf(10, "abc~s", "defgh"));
+    printf("%u;;8;%zu\n", __LINE__, va_lnprintf(8, "abc~s", "defgh"));
+    printf("%u;;8;%zu\n", __LINE__, va_lnprintf(7, "abc~s", "defgh", &e));
+    assert(e.code == VA_E_TRUNC);
+    printf("%u;;3;%zu\n", __LINE__, va_lnprintf(2, "~10s", "x"));
+    printf("%u;;1;%zu\n", __LINE__, va_lnprintf(0, "~s~s", "x", 5, &e));
+    assert(e.code == VA_E_TRUNC);
+    printf("%u;;4;%zu\n", __LINE__, va_znprintf(4, "abc"));
+    printf("%u;;4;%zu\n", __LINE__, va_znprintf(3, "abc"));
+    printf("%u;;4;%zu\n", __LINE__, va_znprintf(3, "a~s", "\u201c"));
+    printf("%u;;5;%zu\n", __LINE__, va_uznprintf(5, "a~sb", "\U0001f600"));
+    printf("%u;;4;%zu\n", __LINE__, va_uznprintf(3, "a~sb", "\U0001f600"));
+    printf("%u;;4;%zu\n", __LINE__, va_Uznprintf(3, "a~sb", "\U0001f600"));
+
+    va_format_t *nf = NULL;
+    PRINTF2("", "~s", va_nprintf(16, nf, 1, &e));
+    assert(e.code == VA_E_NULL);
+    va_format_free(nf);
+
 #endif
 
     return 0;
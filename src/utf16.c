@@ -8,6 +8,10 @@
 #include <va_print/core.h>
 #include <va_print/impl.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* ********************************************************************** */
 /* extern objects */
 
@@ -16,9 +20,12 @@ va_read_iter_vtab_t const va_char16_p_read_vtab_utf16 = {
     va_char16_p_take_utf16,
     va_char16_p_end,
     va_char16_p_set_chunk_mode,
+    va_char16_p_bulk_utf16,
+    va_char16_p_transcode_utf16,
     false,
     false,
     'u',
+    VA_ENC_TAG(VA_U_ENC_UTF16),
     {0}
 };
 
@@ -27,9 +34,12 @@ va_read_iter_vtab_t const va_span16_p_read_vtab_utf16 = {
     va_span16_p_take_utf16,
     va_char16_p_end,
     va_span16_p_set_chunk_mode,
+    va_span16_p_bulk_utf16,
+    va_char16_p_transcode_utf16,
     true,
     false,
     'u',
+    VA_ENC_TAG(VA_U_ENC_UTF16),
     {0}
 };
 
@@ -38,9 +48,12 @@ va_read_iter_vtab_t const va_char16_p_read_vtab_utf16_chunk = {
     va_char16_p_take_utf16,
     va_char16_p_end,
     NULL,
+    va_char16_p_bulk_utf16,
+    va_char16_p_transcode_utf16,
     false,
     true,
     'u',
+    VA_ENC_TAG(VA_U_ENC_UTF16),
     {0}
 };
 
@@ -49,9 +62,12 @@ va_read_iter_vtab_t const va_span16_p_read_vtab_utf16_chunk = {
     va_span16_p_take_utf16,
     va_char16_p_end,
     NULL,
+    va_span16_p_bulk_utf16,
+    va_char16_p_transcode_utf16,
     true,
     true,
     'u',
+    VA_ENC_TAG(VA_U_ENC_UTF16),
     {0}
 };
 
@@ -148,6 +164,144 @@ error:
     return c0 | VA_U_ENC_UTF16;
 }
 
+extern size_t va_char16_p_bulk_utf16(
+    va_read_iter_t const *iter,
+    void const *end,
+    size_t max,
+    size_t *cps)
+{
+    char16_t const *p = iter->cur;
+    size_t n = max;
+    if ((end != NULL) && ((size_t)((char16_t const *)end - p) < n)) {
+        n = (size_t)((char16_t const *)end - p);
+    }
+
+    size_t i = 0;
+    size_t k = 0;
+    while (i < n) {
+        unsigned c0 = p[i];
+        if (c0 == 0) {
+            break;
+        }
+        if ((c0 < VA_U_SURR_MIN) || (c0 > VA_U_SURR_MAX)) {
+            i++;
+            k++;
+            continue;
+        }
+        /* a high surrogate followed by a low one */
+        if ((c0 >= 0xdc00) || ((n - i) < 2)) {
+            break;
+        }
+        if ((p[i+1] < 0xdc00) || (p[i+1] > 0xdfff)) {
+            break;
+        }
+        i += 2;
+        k++;
+    }
+    *cps = k;
+    return i;
+}
+
+extern size_t va_span16_p_bulk_utf16(
+    va_read_iter_t const *iter_super,
+    void const *end,
+    size_t max,
+    size_t *cps)
+{
+    va_read_iter_end_t const *iter = va_boxof(iter_super, *iter, super);
+    if ((end == NULL) || (iter->end < end)) {
+        end = iter->end;
+    }
+    return va_char16_p_bulk_utf16(iter_super, end, max, cps);
+}
+
+/**
+ * Encoded size in bytes of 'n' valid UTF-16 code units in encoding 'enc'.
+ */
+static size_t transcode_len(
+    unsigned char enc,
+    char16_t const *p,
+    size_t n)
+{
+    size_t k = 0;
+    switch (enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8):
+        /* a surrogate pair makes 4 bytes, i.e., 2 for each half */
+        for (size_t i = 0; i < n; i++) {
+            unsigned c = p[i];
+            k += 1U + (c >= 0x80) +
+                ((c >= 0x800) && ((c < VA_U_SURR_MIN) || (c > VA_U_SURR_MAX)));
+        }
+        return k;
+
+    case VA_ENC_TAG(VA_U_ENC_UTF32):
+        for (size_t i = 0; i < n; i++) {
+            k += ((p[i] & 0xfc00) != 0xdc00);
+        }
+        return k * sizeof(char32_t);
+    }
+    return 0;
+}
+
+extern size_t va_char16_p_transcode_utf16(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n)
+{
+    char16_t const *p = src;
+    char16_t const *e = p + n;
+    if (dst == NULL) {
+        return transcode_len(enc, p, n);
+    }
+    switch (enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8): {
+        char *w = dst;
+        while (p < e) {
+#ifdef __SSE2__
+            /* 8 ASCII characters at once */
+            if ((e - p) >= 8) {
+                __m128i v = _mm_loadu_si128((void const *)p);
+                __m128i a = _mm_and_si128(v, _mm_set1_epi16(-0x80));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(a, _mm_setzero_si128())) == 0xffff) {
+                    _mm_storel_epi64((void *)w, _mm_packus_epi16(v, v));
+                    p += 8;
+                    w += 8;
+                    continue;
+                }
+            }
+#endif
+            w = va_store_utf8(w, va_take_utf16(&p));
+        }
+        return (size_t)(w - (char *)dst);
+    }
+
+    case VA_ENC_TAG(VA_U_ENC_UTF32): {
+        char32_t *w = dst;
+        while (p < e) {
+#ifdef __SSE2__
+            /* 8 BMP characters at once */
+            if ((e - p) >= 8) {
+                __m128i v = _mm_loadu_si128((void const *)p);
+                __m128i a = _mm_and_si128(v, _mm_set1_epi16(-0x800));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(a, _mm_set1_epi16(-0x2800))) == 0) {
+                    __m128i z = _mm_setzero_si128();
+                    _mm_storeu_si128((void *)w,       _mm_unpacklo_epi16(v, z));
+                    _mm_storeu_si128((void *)(w + 4), _mm_unpackhi_epi16(v, z));
+                    p += 8;
+                    w += 8;
+                    continue;
+                }
+            }
+#endif
+            *w++ = va_take_utf16(&p);
+        }
+        return (size_t)((char *)w - (char *)dst);
+    }
+    }
+    return 0;
+}
+
 extern void va_put_utf16(
     va_stream_t *s,
     unsigned c,
@@ -157,8 +311,8 @@ extern void va_put_utf16(
     if ((c & VA_U_ENC) != 0) {
         if ((c & VA_U_ENC) == VA_U_ENC_UTF16) {
             /* pass-through erroneous word */
-            put(s, c & 0xffff);
-            return;
+            c &= 0xffff;
+            goto store;
         }
         c = VA_U_REPLACEMENT;
     }
@@ -170,14 +324,47 @@ extern void va_put_utf16(
     }
 
     /* now do the encoding */
-    if (c <= 0xffff) {
-        put(s, c & 0xffff);
+    if (c > 0xffff) {
+        c -= 0x10000;
+        char16_t hi = (char16_t)(0xd800 + (c >> 10));
+        char16_t lo = (char16_t)(0xdc00 + (c & 0x3ff));
+        if (va_stream_reserve(s, 2 * sizeof(char16_t))) {
+            char16_t *w = s->win.cur;
+            *w++ = hi;
+            *w++ = lo;
+            s->win.cur = w;
+            return;
+        }
+        put(s, hi);
+        put(s, lo);
         return;
     }
 
-    c -= 0x10000;
-    put(s, (char16_t)(0xd800 + (c >> 10)));
-    put(s, (char16_t)(0xdc00 + (c & 0x3ff)));
+store:
+    if (va_stream_reserve(s, sizeof(char16_t))) {
+        char16_t *w = s->win.cur;
+        *w++ = c & 0xffff;
+        s->win.cur = w;
+        return;
+    }
+    put(s, c & 0xffff);
+}
+
+extern size_t va_len_utf16(
+    va_stream_t *s,
+    unsigned c)
+{
+    /* decoder errors */
+    if ((c & VA_U_ENC) != 0) {
+        return 1;
+    }
+
+    /* encoding errors */
+    if (!va_u_valid(c)) {
+        va_stream_set_error(s, VA_E_ENCODE);
+        return 1;
+    }
+    return va_units_utf16(c);
 }
 
 extern va_stream_t *va_xprintf_char16_p_utf16(
@@ -185,7 +372,7 @@ extern va_stream_t *va_xprintf_char16_p_utf16(
     char16_t const *x)
 {
     va_read_iter_t iter = VA_READ_ITER(&va_char16_p_read_vtab_utf16, x);
-    return va_xprintf_iter(s, &iter);
+    return va_xprintf_iter_local(s, &iter);
 }
 
 extern va_stream_t *va_xprintf_char16_const_pp_utf16(
@@ -255,7 +442,7 @@ extern va_stream_t *va_xprintf_span16_p_utf16(
         .super = VA_READ_ITER(&va_span16_p_read_vtab_utf16, x->data),
         .end = x->data + x->size
     };
-    return va_xprintf_iter(s, &iter.super);
+    return va_xprintf_iter_local(s, &iter.super);
 }
 
 extern va_stream_t *va_xprintf_last_span16_p_utf16(
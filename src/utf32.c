@@ -8,6 +8,10 @@
 #include <va_print/core.h>
 #include <va_print/impl.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* ********************************************************************** */
 /* extern objects */
 
@@ -16,9 +20,12 @@ va_read_iter_vtab_t const va_char32_p_read_vtab_utf32 = {
     va_char32_p_take_utf32,
     va_char32_p_end,
     NULL,
+    va_char32_p_bulk_utf32,
+    va_char32_p_transcode_utf32,
     false,
     false,
     'U',
+    VA_ENC_TAG(VA_U_ENC_UTF32),
     {0}
 };
 
@@ -27,9 +34,12 @@ va_read_iter_vtab_t const va_span32_p_read_vtab_utf32 = {
     va_span32_p_take_utf32,
     va_char32_p_end,
     NULL,
+    va_span32_p_bulk_utf32,
+    va_char32_p_transcode_utf32,
     true,
     false,
     'U',
+    VA_ENC_TAG(VA_U_ENC_UTF32),
     {0}
 };
 
@@ -68,6 +78,127 @@ extern unsigned va_char32_p_take_utf32(
     return c0 | VA_U_ENC_UTF32;
 }
 
+extern size_t va_char32_p_bulk_utf32(
+    va_read_iter_t const *iter,
+    void const *end,
+    size_t max,
+    size_t *cps)
+{
+    char32_t const *p = iter->cur;
+    size_t n = max;
+    if ((end != NULL) && ((size_t)((char32_t const *)end - p) < n)) {
+        n = (size_t)((char32_t const *)end - p);
+    }
+
+    size_t i = 0;
+    while ((i < n) && (p[i] != 0) && va_u_valid(p[i])) {
+        i++;
+    }
+    *cps = i;
+    return i;
+}
+
+extern size_t va_span32_p_bulk_utf32(
+    va_read_iter_t const *iter_super,
+    void const *end,
+    size_t max,
+    size_t *cps)
+{
+    va_read_iter_end_t const *iter = va_boxof(iter_super, *iter, super);
+    if ((end == NULL) || (iter->end < end)) {
+        end = iter->end;
+    }
+    return va_char32_p_bulk_utf32(iter_super, end, max, cps);
+}
+
+/**
+ * Encoded size in bytes of 'n' valid UTF-32 code units in encoding 'enc'.
+ */
+static size_t transcode_len(
+    unsigned char enc,
+    char32_t const *p,
+    size_t n)
+{
+    size_t k = 0;
+    switch (enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8):
+        for (size_t i = 0; i < n; i++) {
+            k += va_units_utf8(p[i]);
+        }
+        return k;
+
+    case VA_ENC_TAG(VA_U_ENC_UTF16):
+        for (size_t i = 0; i < n; i++) {
+            k += va_units_utf16(p[i]);
+        }
+        return k * sizeof(char16_t);
+    }
+    return 0;
+}
+
+extern size_t va_char32_p_transcode_utf32(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n)
+{
+    char32_t const *p = src;
+    char32_t const *e = p + n;
+    if (dst == NULL) {
+        return transcode_len(enc, p, n);
+    }
+    switch (enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF8): {
+        char *w = dst;
+        while (p < e) {
+#ifdef __SSE2__
+            /* 8 ASCII characters at once */
+            if ((e - p) >= 8) {
+                __m128i v0 = _mm_loadu_si128((void const *)p);
+                __m128i v1 = _mm_loadu_si128((void const *)(p + 4));
+                __m128i a = _mm_and_si128(_mm_or_si128(v0, v1), _mm_set1_epi32(-0x80));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, _mm_setzero_si128())) == 0xffff) {
+                    __m128i v = _mm_packs_epi32(v0, v1);
+                    _mm_storel_epi64((void *)w, _mm_packus_epi16(v, v));
+                    p += 8;
+                    w += 8;
+                    continue;
+                }
+            }
+#endif
+            w = va_store_utf8(w, *p++);
+        }
+        return (size_t)(w - (char *)dst);
+    }
+
+    case VA_ENC_TAG(VA_U_ENC_UTF16): {
+        char16_t *w = dst;
+        while (p < e) {
+#ifdef __SSE2__
+            /* 8 BMP characters at once: there is no unsigned 32 to 16
+             * bit pack in SSE2, so shift into the signed range and back */
+            if ((e - p) >= 8) {
+                __m128i v0 = _mm_loadu_si128((void const *)p);
+                __m128i v1 = _mm_loadu_si128((void const *)(p + 4));
+                __m128i a = _mm_and_si128(_mm_or_si128(v0, v1), _mm_set1_epi32(-0x10000));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, _mm_setzero_si128())) == 0xffff) {
+                    __m128i b = _mm_set1_epi32(0x8000);
+                    __m128i v = _mm_packs_epi32(_mm_sub_epi32(v0, b), _mm_sub_epi32(v1, b));
+                    _mm_storeu_si128((void *)w, _mm_add_epi16(v, _mm_set1_epi16(-0x8000)));
+                    p += 8;
+                    w += 8;
+                    continue;
+                }
+            }
+#endif
+            w = va_store_utf16(w, *p++);
+        }
+        return (size_t)((char *)w - (char *)dst);
+    }
+    }
+    return 0;
+}
+
 extern void va_put_utf32(
     va_stream_t *s,
     unsigned c,
@@ -77,8 +208,8 @@ extern void va_put_utf32(
     if ((c & VA_U_ENC) != 0) {
         if ((c & VA_U_ENC) == VA_U_ENC_UTF32) {
             /* pass-through erroneous word */
-            put(s, c & VA_U_DATA);
-            return;
+            c &= VA_U_DATA;
+            goto store;
         }
         c = VA_U_REPLACEMENT;
     }
@@ -89,15 +220,33 @@ extern void va_put_utf32(
         c = VA_U_REPLACEMENT;
     }
 
+store:
+    if (va_stream_reserve(s, sizeof(char32_t))) {
+        char32_t *w = s->win.cur;
+        *w++ = c;
+        s->win.cur = w;
+        return;
+    }
     put(s, c);
 }
 
+extern size_t va_len_utf32(
+    va_stream_t *s,
+    unsigned c)
+{
+    /* decoding errors are passed through or replaced */
+    if (((c & VA_U_ENC) == 0) && !va_u_valid(c)) {
+        va_stream_set_error(s, VA_E_ENCODE);
+    }
+    return 1;
+}
+
 extern va_stream_t *va_xprintf_char32_p_utf32(
     va_stream_t *s,
     char32_t const *x)
 {
     va_read_iter_t iter = VA_READ_ITER(&va_char32_p_read_vtab_utf32, x);
-    return va_xprintf_iter(s, &iter);
+    return va_xprintf_iter_local(s, &iter);
 }
 
 extern va_stream_t *va_xprintf_char32_const_pp_utf32(
@@ -161,7 +310,7 @@ extern va_stream_t *va_xprintf_span32_p_utf32(
         .super = VA_READ_ITER(&va_span32_p_read_vtab_utf32, x->data),
         .end = x->data + x->size
     };
-    return va_xprintf_iter(s, &iter.super);
+    return va_xprintf_iter_local(s, &iter.super);
 }
 
 extern va_stream_t *va_xprintf_last_span32_p_utf32(
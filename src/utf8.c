@@ -2,12 +2,19 @@
 /* (c) Henrik Theiling, LICENSE: BSD-3-Clause */
 
 #include <stddef.h>
+#include <string.h>
 #include <assert.h>
 #include <va_print/char.h>
 #include <va_print/utf8.h>
 #include <va_print/core.h>
 #include <va_print/impl.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /* ********************************************************************** */
 /* extern objects */
 
@@ -16,9 +23,12 @@ va_read_iter_vtab_t const va_char_p_read_vtab_utf8 = {
     va_char_p_take_utf8,
     va_char_p_end,
     va_char_p_set_chunk_mode,
+    va_char_p_bulk_utf8,
+    va_char_p_transcode_utf8,
     false,
     false,
     0,
+    VA_ENC_TAG(VA_U_ENC_UTF8),
     {0}
 };
 
@@ -27,9 +37,12 @@ va_read_iter_vtab_t const va_span_p_read_vtab_utf8 = {
     va_span_p_take_utf8,
     va_char_p_end,
     va_span_p_set_chunk_mode,
+    va_span_p_bulk_utf8,
+    va_char_p_transcode_utf8,
     true,
     false,
     0,
+    VA_ENC_TAG(VA_U_ENC_UTF8),
     {0}
 };
 
@@ -38,9 +51,12 @@ va_read_iter_vtab_t const va_char_p_read_vtab_utf8_chunk = {
     va_char_p_take_utf8,
     va_char_p_end,
     NULL,
+    va_char_p_bulk_utf8,
+    va_char_p_transcode_utf8,
     false,
     true,
     0,
+    VA_ENC_TAG(VA_U_ENC_UTF8),
     {0}
 };
 
@@ -49,9 +65,12 @@ va_read_iter_vtab_t const va_span_p_read_vtab_utf8_chunk = {
     va_span_p_take_utf8,
     va_char_p_end,
     NULL,
+    va_span_p_bulk_utf8,
+    va_char_p_transcode_utf8,
     true,
     true,
     0,
+    VA_ENC_TAG(VA_U_ENC_UTF8),
     {0}
 };
 
@@ -101,6 +120,66 @@ static void iter_advance(
     i->cur = s;
 }
 
+#if defined(__AVX2__)
+#define ASCII_BLOCK 32U
+#elif defined(__SSE2__)
+#define ASCII_BLOCK 16U
+#else
+#define ASCII_BLOCK sizeof(size_t)
+#endif
+
+/**
+ * Length of the run of non-NUL ASCII characters at p, at most n bytes.
+ *
+ * Whole blocks are checked with aligned loads, so the block that
+ * contains the NUL terminator may be read beyond the end of the string,
+ * but never into the next page, like strlen() does.  The address
+ * sanitizer does not know that, so it is switched off here.
+ */
+__attribute__((no_sanitize_address))
+static size_t ascii_run(
+    unsigned char const *p,
+    size_t n)
+{
+    size_t i = 0;
+    while ((i < n) && ((((size_t)(p + i)) % ASCII_BLOCK) != 0)) {
+        if ((p[i] == 0) || (p[i] >= 0x80)) {
+            return i;
+        }
+        i++;
+    }
+    for (; (n - i) >= ASCII_BLOCK; i += ASCII_BLOCK) {
+        void const *q = p + i;
+#if defined(__AVX2__)
+        __m256i v = _mm256_load_si256(q);
+        __m256i z = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+        if (_mm256_movemask_epi8(_mm256_or_si256(v, z)) != 0) {
+            break;
+        }
+#elif defined(__SSE2__)
+        __m128i v = _mm_load_si128(q);
+        __m128i z = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+        if (_mm_movemask_epi8(_mm_or_si128(v, z)) != 0) {
+            break;
+        }
+#else
+        /* word-at-a-time: top bit set, or zero byte */
+        size_t const lo = ((size_t)-1) / 0xff;
+        size_t const hi = lo << 7;
+        size_t v;
+        memcpy(&v, q, sizeof(v));
+        if (((v | ((v - lo) & ~v)) & hi) != 0) {
+            break;
+        }
+#endif
+    }
+    /* the stopping block, or the tail */
+    while ((i < n) && (p[i] != 0) && (p[i] < 0x80)) {
+        i++;
+    }
+    return i;
+}
+
 /* ********************************************************************** */
 /* extern functions */
 
@@ -228,6 +307,169 @@ error:
     return c0 | VA_U_ENC_UTF8;
 }
 
+extern size_t va_char_p_bulk_utf8(
+    va_read_iter_t const *iter,
+    void const *end,
+    size_t max,
+    size_t *cps)
+{
+    unsigned char const *p = iter->cur;
+    size_t n = max;
+    if ((end != NULL) && ((size_t)((unsigned char const *)end - p) < n)) {
+        n = (size_t)((unsigned char const *)end - p);
+    }
+
+    size_t i = 0;
+    size_t k = 0;
+    while (i < n) {
+        unsigned c0 = p[i];
+        if (c0 < 0x80) {
+            if (c0 == 0) {
+                break;
+            }
+            size_t m = ascii_run(p + i, n - i);
+            i += m;
+            k += m;
+            continue;
+        }
+
+        /* same checks as va_char_p_take_utf8(): stop at anything else */
+        size_t len;
+        unsigned lo = 0x80;
+        unsigned hi = 0xbf;
+        if ((c0 >= 0xc2) && (c0 <= 0xdf)) {
+            len = 2;
+        }
+        else if ((c0 >= 0xe0) && (c0 <= 0xef)) {
+            len = 3;
+            if (c0 == 0xe0) { lo = 0xa0; }
+            if (c0 == 0xed) { hi = 0x9f; }
+        }
+        else if ((c0 >= 0xf0) && (c0 <= 0xf4)) {
+            len = 4;
+            if (c0 == 0xf0) { lo = 0x90; }
+            if (c0 == 0xf4) { hi = 0x8f; }
+        }
+        else {
+            break;
+        }
+        if (len > (n - i)) {
+            break;
+        }
+        if ((p[i+1] < lo) || (p[i+1] > hi)) {
+            break;
+        }
+        if ((len >= 3) && ((p[i+2] & 0xc0) != 0x80)) {
+            break;
+        }
+        if ((len >= 4) && ((p[i+3] & 0xc0) != 0x80)) {
+            break;
+        }
+        i += len;
+        k++;
+    }
+    *cps = k;
+    return i;
+}
+
+extern size_t va_span_p_bulk_utf8(
+    va_read_iter_t const *iter_super,
+    void const *end,
+    size_t max,
+    size_t *cps)
+{
+    va_read_iter_end_t const *iter = va_boxof(iter_super, *iter, super);
+    if ((end == NULL) || (iter->end < end)) {
+        end = iter->end;
+    }
+    return va_char_p_bulk_utf8(iter_super, end, max, cps);
+}
+
+/**
+ * Encoded size in bytes of 'n' valid UTF-8 code units in encoding 'enc'.
+ */
+static size_t transcode_len(
+    unsigned char enc,
+    unsigned char const *p,
+    size_t n)
+{
+    size_t k = 0;
+    size_t k4 = 0;
+    for (size_t i = 0; i < n; i++) {
+        k  += ((p[i] & 0xc0) != 0x80);
+        k4 += (p[i] >= 0xf0);
+    }
+    switch (enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF16):
+        return (k + k4) * sizeof(char16_t);
+    case VA_ENC_TAG(VA_U_ENC_UTF32):
+        return k * sizeof(char32_t);
+    }
+    return 0;
+}
+
+extern size_t va_char_p_transcode_utf8(
+    void *dst,
+    unsigned char enc,
+    void const *src,
+    size_t n)
+{
+    unsigned char const *p = src;
+    unsigned char const *e = p + n;
+    if (dst == NULL) {
+        return transcode_len(enc, p, n);
+    }
+    switch (enc) {
+    case VA_ENC_TAG(VA_U_ENC_UTF16): {
+        char16_t *w = dst;
+        while (p < e) {
+#ifdef __SSE2__
+            /* 16 ASCII characters at once */
+            if ((e - p) >= 16) {
+                __m128i v = _mm_loadu_si128((void const *)p);
+                if (_mm_movemask_epi8(v) == 0) {
+                    __m128i z = _mm_setzero_si128();
+                    _mm_storeu_si128((void *)w, _mm_unpacklo_epi8(v, z));
+                    _mm_storeu_si128((void *)(w + 8), _mm_unpackhi_epi8(v, z));
+                    p += 16;
+                    w += 16;
+                    continue;
+                }
+            }
+#endif
+            w = va_store_utf16(w, va_take_utf8(&p));
+        }
+        return (size_t)((char *)w - (char *)dst);
+    }
+
+    case VA_ENC_TAG(VA_U_ENC_UTF32): {
+        char32_t *w = dst;
+        while (p < e) {
+#ifdef __SSE2__
+            if ((e - p) >= 16) {
+                __m128i v = _mm_loadu_si128((void const *)p);
+                if (_mm_movemask_epi8(v) == 0) {
+                    __m128i z = _mm_setzero_si128();
+                    __m128i lo = _mm_unpacklo_epi8(v, z);
+                    __m128i hi = _mm_unpackhi_epi8(v, z);
+                    _mm_storeu_si128((void *)w,        _mm_unpacklo_epi16(lo, z));
+                    _mm_storeu_si128((void *)(w + 4),  _mm_unpackhi_epi16(lo, z));
+                    _mm_storeu_si128((void *)(w + 8),  _mm_unpacklo_epi16(hi, z));
+                    _mm_storeu_si128((void *)(w + 12), _mm_unpackhi_epi16(hi, z));
+                    p += 16;
+                    w += 16;
+                    continue;
+                }
+            }
+#endif
+            *w++ = va_take_utf8(&p);
+        }
+        return (size_t)((char *)w - (char *)dst);
+    }
+    }
+    return 0;
+}
+
 extern void va_put_utf8(
     va_stream_t *s,
     unsigned c,
@@ -237,6 +479,12 @@ extern void va_put_utf8(
     if ((c & VA_U_ENC) != 0) {
         if ((c & VA_U_ENC) == VA_U_ENC_UTF8) {
             /* pass-through erroneous byte */
+            if (va_stream_reserve(s, 1)) {
+                char *w = s->win.cur;
+                *w++ = (char)(c & 0xff);
+                s->win.cur = w;
+                return;
+            }
             put(s, (char)(c & 0xff));
             return;
         }
@@ -254,26 +502,63 @@ extern void va_put_utf8(
     }
 
     /* now do the encoding */
+    char x[4];
+    size_t n;
     if (c <= 0x7f) {
-        put(s, c & 0x7f);
-        return;
+        x[0] = c & 0x7f;
+        n = 1;
     }
-    if (c <= 0x7ff) {
-        put(s, (char)(0xc0 | ((c >> 6) & 0x1f)));
-        put(s, (char)(0x80 | ((c >> 0) & 0x3f)));
-        return;
+    else if (c <= 0x7ff) {
+        x[0] = (char)(0xc0 | ((c >> 6) & 0x1f));
+        x[1] = (char)(0x80 | ((c >> 0) & 0x3f));
+        n = 2;
     }
-    if (c <= 0xffff) {
-        put(s, (char)(0xe0 | ((c >> 12) & 0x0f)));
-        put(s, (char)(0x80 | ((c >> 6)  & 0x3f)));
-        put(s, (char)(0x80 | ((c >> 0)  & 0x3f)));
+    else if (c <= 0xffff) {
+        x[0] = (char)(0xe0 | ((c >> 12) & 0x0f));
+        x[1] = (char)(0x80 | ((c >> 6)  & 0x3f));
+        x[2] = (char)(0x80 | ((c >> 0)  & 0x3f));
+        n = 3;
+    }
+    else {
+        x[0] = (char)(0xf0 | ((c >> 18) & 0x07));
+        x[1] = (char)(0x80 | ((c >> 12) & 0x3f));
+        x[2] = (char)(0x80 | ((c >> 6)  & 0x3f));
+        x[3] = (char)(0x80 | ((c >> 0)  & 0x3f));
+        n = 4;
+    }
+
+    /* store into output window, or byte by byte */
+    if (va_stream_reserve(s, n)) {
+        memcpy(s->win.cur, x, n);
+        s->win.cur = (char*)s->win.cur + n;
         return;
     }
+    for (size_t i = 0; i < n; i++) {
+        put(s, x[i]);
+    }
+}
 
-    put(s, (char)(0xf0 | ((c >> 18) & 0x07)));
-    put(s, (char)(0x80 | ((c >> 12) & 0x3f)));
-    put(s, (char)(0x80 | ((c >> 6)  & 0x3f)));
-    put(s, (char)(0x80 | ((c >> 0)  & 0x3f)));
+extern size_t va_len_utf8(
+    va_stream_t *s,
+    unsigned c)
+{
+    /* decoder errors */
+    if ((c & VA_U_ENC) != 0) {
+        if ((c & VA_U_ENC) == VA_U_ENC_UTF8) {
+            return 1;
+        }
+        if ((c & VA_U_ECONT) != 0) {
+            return 0;
+        }
+        c = VA_U_REPLACEMENT;
+    }
+
+    /* encoding errors */
+    if (!va_u_valid(c)) {
+        va_stream_set_error(s, VA_E_ENCODE);
+        c = VA_U_REPLACEMENT;
+    }
+    return va_units_utf8(c);
 }
 
 extern va_stream_t *va_xprintf_char_p_utf8(
@@ -281,7 +566,7 @@ extern va_stream_t *va_xprintf_char_p_utf8(
     char const *x)
 {
     va_read_iter_t iter = VA_READ_ITER(&va_char_p_read_vtab_utf8, x);
-    return va_xprintf_iter(s, &iter);
+    return va_xprintf_iter_local(s, &iter);
 }
 
 extern va_stream_t *va_xprintf_char_const_pp_utf8(
@@ -349,7 +634,7 @@ extern va_stream_t *va_xprintf_span_p_utf8(
         .super = VA_READ_ITER(&va_span_p_read_vtab_utf8, x->data),
         .end = x->data + x->size
     };
-    return va_xprintf_iter(s, &iter.super);
+    return va_xprintf_iter_local(s, &iter.super);
 }
 
 extern va_stream_t *va_xprintf_last_span_p_utf8(